@@ -76,4 +76,29 @@ WaitableGroup WaitOrShutdown::create_waitable_group(WaitablePtr waitable, EventP
     return waitables;
 }
 
+Expected<std::unique_ptr<ReadyEvent>> ReadyEvent::create(bool is_ready)
+{
+    TRY(auto event, Event::create(is_ready ? Event::State::signalled : Event::State::not_signalled));
+    auto ready_event = make_unique_nothrow<ReadyEvent>(std::move(event), is_ready);
+    CHECK_NOT_NULL_AS_EXPECTED(ready_event, HAILO_OUT_OF_HOST_MEMORY);
+    return ready_event;
+}
+
+ReadyEvent::ReadyEvent(Event &&event, bool is_ready) :
+    m_event(std::move(event)),
+    m_is_ready(is_ready)
+{}
+
+hailo_status ReadyEvent::update(bool is_ready)
+{
+    if (is_ready == m_is_ready) {
+        return HAILO_SUCCESS;
+    }
+
+    auto status = is_ready ? m_event.signal() : m_event.reset();
+    CHECK_SUCCESS(status);
+    m_is_ready = is_ready;
+    return HAILO_SUCCESS;
+}
+
 } /* namespace hailort */
@@ -111,6 +111,28 @@ private:
     WaitableGroup m_waitable_group;
 };
 
+// Manual reset event that mirrors a readiness condition of its owner, so the readiness can be polled together with
+// the other fds of the application (e.g. with epoll). The owner updates it (under its own lock) whenever the condition
+// may change. The event is signaled/reset only when the condition actually changes.
+class ReadyEvent final
+{
+public:
+    static Expected<std::unique_ptr<ReadyEvent>> create(bool is_ready);
+
+    explicit ReadyEvent(Event &&event, bool is_ready);
+
+    ReadyEvent(const ReadyEvent &other) = delete;
+    ReadyEvent &operator=(const ReadyEvent &other) = delete;
+
+    hailo_status update(bool is_ready);
+
+    underlying_waitable_handle_t get_underlying_handle() { return m_event.get_underlying_handle(); }
+
+private:
+    Event m_event;
+    bool m_is_ready;
+};
+
 } /* namespace hailort */
 
 #endif /* _EVENT_INTERNAL_HPP_ */
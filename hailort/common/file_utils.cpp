@@ -144,6 +144,12 @@ Expected<size_t> FileReader::get_size()
     return static_cast<size_t>(file_size);
 }
 
+bool FileReader::supports_concurrent_reads() const
+{
+    // All the reads share the same stream (and close() closes it)
+    return false;
+}
+
 std::shared_ptr<std::ifstream> FileReader::get_fstream() const
 {
     return m_fstream;
@@ -223,6 +229,11 @@ Expected<bool> BufferReader::good() const
     return true;
 }
 
+bool BufferReader::supports_concurrent_reads() const
+{
+    return true;
+}
+
 const MemoryView BufferReader::get_memview() const
 {
     return m_memview;
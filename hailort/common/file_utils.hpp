@@ -44,6 +44,8 @@ public:
     virtual Expected<size_t> get_size() = 0;
     virtual Expected<bool> good() const = 0;
     virtual Expected<size_t> calculate_remaining_size() = 0;
+    // Whether open, read_from_offset and close may be called from several threads at once
+    virtual bool supports_concurrent_reads() const = 0;
     static Expected<std::shared_ptr<FileReader>> create_reader(const std::string &file_path);
     static Expected<std::shared_ptr<BufferReader>> create_reader(const MemoryView &memview);
 };
@@ -63,6 +65,7 @@ public:
     virtual Expected<size_t> get_size();
     virtual Expected<bool> good() const;
     virtual Expected<size_t> calculate_remaining_size();
+    virtual bool supports_concurrent_reads() const;
 
     std::shared_ptr<std::ifstream> get_fstream() const;
 
@@ -87,6 +90,7 @@ public:
     virtual Expected<size_t> get_size();
     virtual Expected<bool> good() const;
     virtual Expected<size_t> calculate_remaining_size();
+    virtual bool supports_concurrent_reads() const;
 
     const MemoryView get_memview() const;
 
@@ -9,6 +9,14 @@
 #include "fork_support.hpp"
 #include "common/logger_macros.hpp"
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#endif
+
 
 namespace hailort
 {
@@ -189,5 +197,56 @@ void SharedConditionVariable::notify_all()
 
 #endif /* HAILO_IS_FORK_SUPPORTED */
 
+#ifdef __linux__
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32 bit integer");
+
+void SharedFutex::wait(uint32_t sequence, std::chrono::milliseconds timeout)
+{
+    // Registering as a waiter before the kernel compares the sequence makes sure a concurrent notify() either sees the
+    // waiter (and wakes it) or changes the sequence before the comparison.
+    m_waiters_count.fetch_add(1);
+
+    struct timespec relative_timeout{};
+    struct timespec *relative_timeout_ptr = nullptr;
+    if (UINT32_MAX != timeout.count()) {
+        relative_timeout.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        relative_timeout.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+        relative_timeout_ptr = &relative_timeout;
+    }
+
+    // Not a private futex, since the waiter and the notifier may be in different processes.
+    auto err = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_sequence), FUTEX_WAIT, sequence, relative_timeout_ptr,
+        nullptr, 0);
+    if ((0 != err) && (EAGAIN != errno) && (ETIMEDOUT != errno) && (EINTR != errno)) {
+        LOGGER__ERROR("Failed waiting on futex, errno {}", errno);
+    }
+
+    m_waiters_count.fetch_sub(1);
+}
+
+void SharedFutex::notify()
+{
+    m_sequence.fetch_add(1);
+    if (0 != m_waiters_count.load()) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_sequence), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+    }
+}
+#else
+void SharedFutex::wait(uint32_t sequence, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+    m_cv.wait_for(lock, timeout, [this, sequence]() { return sequence != m_sequence.load(); });
+}
+
+void SharedFutex::notify()
+{
+    {
+        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+        m_sequence.fetch_add(1);
+    }
+    m_cv.notify_all();
+}
+#endif /* __linux__ */
+
 
 } /* namespace hailort */
@@ -15,6 +15,9 @@
 #include <mutex>
 #include <functional>
 #include <map>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <assert.h>
 
 #ifndef _MSC_VER
@@ -214,6 +217,41 @@ class SharedAllocatedObject {};
 #endif
 
 
+// A sequence number that can be waited on for a change, residing in memory shared between forked processes. On linux it
+// is a futex, and notify() enters the kernel only if someone waits. Elsewhere, it falls back to a shared condition
+// variable.
+class SharedFutex final {
+public:
+    SharedFutex() : m_sequence(0), m_waiters_count(0) {}
+
+    SharedFutex(const SharedFutex &) = delete;
+    SharedFutex &operator=(const SharedFutex &) = delete;
+    SharedFutex(SharedFutex &&) = delete;
+    SharedFutex &operator=(SharedFutex &&) = delete;
+
+    // Read before checking the waited condition, and passed to wait() if it isn't met yet.
+    uint32_t sequence() const
+    {
+        return m_sequence.load();
+    }
+
+    // Blocks until the sequence changes from the given one (or until the timeout expires). May return spuriously, so
+    // the waited condition should be checked again.
+    void wait(uint32_t sequence, std::chrono::milliseconds timeout);
+
+    // Advances the sequence, waking all of the waiters.
+    void notify();
+
+private:
+    std::atomic<uint32_t> m_sequence;
+    std::atomic<uint32_t> m_waiters_count;
+#ifndef __linux__
+    RecursiveSharedMutex m_mutex;
+    SharedConditionVariable m_cv;
+#endif
+};
+
+
 } /* namespace hailort */
 
 #endif /* _HAILO_FORK_SUPPORT_HPP_ */
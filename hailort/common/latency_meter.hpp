@@ -11,119 +11,165 @@
 #define _HAILO_LATENCY_METER_HPP_
 
 #include "hailo/expected.hpp"
-#include "common/circular_buffer.hpp"
+#include "common/runtime_statistics_internal.hpp"
 
+#include <atomic>
+#include <cassert>
+#include <map>
+#include <memory>
 #include <set>
-#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace hailort
 {
 
 /**
- * Used to measure latency of hailo datastream - the average amount of time between
- * the start of the action to the end of the last stream.
+ * Used to measure latency of hailo datastream - the amount of time between the start of the action to the end of the
+ * last stream. Both the average latency and a latency histogram (for the percentiles) are kept.
+ *
+ * The n-th start sample and the n-th end sample of each channel belong to the n-th frame. Each frame has a slot in a
+ * ring of atomics, and the thread adding the frame's last sample records its latency - so no lock is taken by the
+ * samples' threads. Up to timestamps_list_length frames may be measured at once.
  */
 class LatencyMeter final {
 public:
     using duration = std::chrono::nanoseconds;
-    using TimestampsArray = CircularArray<duration>;
 
     LatencyMeter(const std::set<std::string> &output_names, size_t timestamps_list_length) :
-        m_start_timestamps(timestamps_list_length),
+        m_frames(std::max(timestamps_list_length, static_cast<size_t>(1))),
+        m_start_samples_count(0),
         m_latency_count(0),
-        m_latency_sum(0)
+        m_latency_sum_ns(0)
     {
         for (auto &ch : output_names) {
-            m_end_timestamps_per_channel.emplace(ch, TimestampsArray(timestamps_list_length));
+            m_end_samples_count_per_channel.emplace(ch, 0);
+        }
+        for (auto &frame : m_frames) {
+            frame.start_ns = 0;
+            frame.end_ns = 0;
+            frame.samples_count = 0;
         }
     }
 
+    LatencyMeter(const LatencyMeter &) = delete;
+    LatencyMeter &operator=(const LatencyMeter &) = delete;
+
     /**
      * Adds the given timestamp as a start.
      * @note Assumes it is the only thread that is calling the function
      */
     void add_start_sample(duration timestamp)
     {
-        m_start_timestamps.push_back(timestamp);
-        update_latency();
+        auto &frame = m_frames[m_start_samples_count++ % m_frames.size()];
+        frame.start_ns.store(timestamp.count(), std::memory_order_relaxed);
+        add_frame_sample(frame);
     }
 
     /*
      * Adds the given timestamp as the end of the given channel. The operation is done
      * after this function is called on all channels.
      * @note Assumes that only one thread per channel is calling this function.
-     */  
+     */
     void add_end_sample(const std::string &stream_name, duration timestamp)
     {
         // Safe to access from several threads (when each pass different channel) because the map cannot
         // be changed in runtime.
-        assert(m_end_timestamps_per_channel.find(stream_name) != m_end_timestamps_per_channel.end());
-        m_end_timestamps_per_channel.at(stream_name).push_back(timestamp);
-        update_latency();
+        assert(m_end_samples_count_per_channel.find(stream_name) != m_end_samples_count_per_channel.end());
+        auto &end_samples_count = m_end_samples_count_per_channel.at(stream_name);
+        auto &frame = m_frames[end_samples_count++ % m_frames.size()];
+
+        auto end = frame.end_ns.load(std::memory_order_relaxed);
+        while ((timestamp.count() > end) &&
+            !frame.end_ns.compare_exchange_weak(end, timestamp.count(), std::memory_order_relaxed)) {}
+        add_frame_sample(frame);
     }
 
     /**
-     * Queries average latency. One can clear measured latency by passing clear=true.
+     * Queries average latency. One can clear measured latency (and the histogram) by passing clear=true.
      */
     Expected<duration> get_latency(bool clear)
     {
-        std::lock_guard<std::mutex> lock_guard(m_lock);
-
-        if (m_latency_count == 0) {
+        const auto count = m_latency_count.load();
+        if (count == 0) {
             return make_unexpected(HAILO_NOT_AVAILABLE);
         }
-        
-        duration latency = (m_latency_sum / m_latency_count);
+
+        duration latency(m_latency_sum_ns.load() / count);
         if (clear) {
-            m_latency_sum = duration();
+            m_latency_sum_ns = 0;
             m_latency_count = 0;
+            m_histogram.reset();
         }
 
         return latency;
     }
 
-private:
-    void update_latency()
+    /**
+     * Queries the latency percentiles (since the last clear). Should be called before get_latency(clear=true).
+     */
+    Expected<LatencyHistogramResults> get_latency_histogram() const
     {
-        std::lock_guard<std::mutex> lock_guard(m_lock);
-
-        if (m_start_timestamps.empty()) {
-            // wait for begin sample
-            return;
+        if (0 == m_histogram.count()) {
+            return make_unexpected(HAILO_NOT_AVAILABLE);
         }
+        return m_histogram.get_results();
+    }
 
-        duration end(0);
-        for (auto &end_timesatmps : m_end_timestamps_per_channel) {
-            if (end_timesatmps.second.empty()) {
-                // Wait for all channel samples
-                return;
-            }
+    /**
+     * Queries the fraction of the frames (since the last clear) with a latency of up to max_latency.
+     */
+    Expected<double> get_latency_attainment(duration max_latency) const
+    {
+        const auto count = m_histogram.count();
+        if (0 == count) {
+            return make_unexpected(HAILO_NOT_AVAILABLE);
+        }
+        duration sum{};
+        const auto counts = m_histogram.get_cumulative_counts({max_latency}, sum);
+        return static_cast<double>(counts[0]) / static_cast<double>(count);
+    }
 
-            end = std::max(end, end_timesatmps.second.front());
+private:
+    struct FrameSamples {
+        std::atomic<int64_t> start_ns;
+        // The latest end sample of the frame's channels
+        std::atomic<int64_t> end_ns;
+        // Amount of the frame's samples added so far (the start sample and an end sample per channel)
+        std::atomic<size_t> samples_count;
+    };
+
+    void add_frame_sample(FrameSamples &frame)
+    {
+        const auto frame_samples_count = m_end_samples_count_per_channel.size() + 1;
+        // acq_rel, so the thread adding the last sample sees the timestamps of all the others
+        if (frame_samples_count != (frame.samples_count.fetch_add(1, std::memory_order_acq_rel) + 1)) {
+            return;
         }
 
-        duration start = m_start_timestamps.front();
+        const auto start = frame.start_ns.load(std::memory_order_relaxed);
+        const auto end = frame.end_ns.load(std::memory_order_relaxed);
         assert(start <= end);
 
         // calculate the latency
-        m_latency_sum += (end - start);
-        m_latency_count++;
-
-        // pop fronts
-        m_start_timestamps.pop_front();
-        for (auto &end_timesatmps : m_end_timestamps_per_channel) {
-            end_timesatmps.second.pop_front();
-        }
+        const auto latency = std::max(end - start, static_cast<int64_t>(0));
+        m_histogram.record(duration(latency));
+        m_latency_sum_ns.fetch_add(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+        m_latency_count.fetch_add(1, std::memory_order_release);
+
+        // Free the slot for the frame timestamps_list_length frames later
+        frame.end_ns.store(0, std::memory_order_relaxed);
+        frame.samples_count.store(0, std::memory_order_release);
     }
 
-    std::mutex m_lock;
-
-    TimestampsArray m_start_timestamps;
-    std::unordered_map<std::string, TimestampsArray> m_end_timestamps_per_channel;
+    std::vector<FrameSamples> m_frames;
+    std::atomic<size_t> m_start_samples_count;
+    // Amount of end samples added per channel, each is the channel's next frame
+    std::unordered_map<std::string, std::atomic<size_t>> m_end_samples_count_per_channel;
 
-    size_t m_latency_count;
-    duration m_latency_sum;
+    LatencyHistogram m_histogram;
+    std::atomic<uint64_t> m_latency_count;
+    std::atomic<uint64_t> m_latency_sum_ns;
 };
 
 using LatencyMeterPtr = std::shared_ptr<LatencyMeter>;
@@ -13,6 +13,9 @@
 
 #include "hailo/hailort.h"
 
+#include <atomic>
+#include <chrono>
+
 #define SPDLOG_NO_EXCEPTIONS
 
 /* Minimum log level availble at compile time */
@@ -69,6 +72,54 @@ do{\
     level(__VA_ARGS__);\
 } while(0) // NOLINT: clang complains about this code never executing
 
+// Limits the messages of a call site to LOG_RATE_LIMIT_BURST per LOG_RATE_LIMIT_INTERVAL_NS, so an error storm (e.g. a
+// timeout on every frame) doesn't flood the log from the hot paths. The amount of the suppressed messages is logged
+// with the next message of the call site. Lock free - the races between the threads only affect the exact counts.
+class LogRateLimiter final
+{
+public:
+    static constexpr uint32_t LOG_RATE_LIMIT_BURST = 10;
+    static constexpr int64_t LOG_RATE_LIMIT_INTERVAL_NS = 1000000000; // 1 second
+
+    LogRateLimiter() : m_interval_start_ns(0), m_interval_count(0), m_suppressed_count(0) {}
+
+    // Returns true if the message should be logged, with the amount of the messages suppressed before it
+    bool should_log(uint64_t &suppressed_count)
+    {
+        const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        auto interval_start_ns = m_interval_start_ns.load(std::memory_order_relaxed);
+        if (((now_ns - interval_start_ns) >= LOG_RATE_LIMIT_INTERVAL_NS) &&
+                m_interval_start_ns.compare_exchange_strong(interval_start_ns, now_ns, std::memory_order_relaxed)) {
+            m_interval_count.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_interval_count.fetch_add(1, std::memory_order_relaxed) < LOG_RATE_LIMIT_BURST) {
+            suppressed_count = m_suppressed_count.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        m_suppressed_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    std::atomic<int64_t> m_interval_start_ns;
+    std::atomic<uint32_t> m_interval_count;
+    std::atomic<uint64_t> m_suppressed_count;
+};
+
+#define LOGGER_TO_SPDLOG_RATE_LIMITED(level, ...)\
+do{\
+    static hailort::LogRateLimiter __log_rate_limiter;\
+    uint64_t __log_suppressed_count = 0;\
+    if (__log_rate_limiter.should_log(__log_suppressed_count)) {\
+        if (0 != __log_suppressed_count) {\
+            level("{} similar messages were suppressed", __log_suppressed_count);\
+        }\
+        LOGGER_TO_SPDLOG(level, __VA_ARGS__);\
+    }\
+} while(0) // NOLINT: clang complains about this code never executing
+
 #define LOGGER__TRACE(...)  LOGGER_TO_SPDLOG(SPDLOG_TRACE, __VA_ARGS__)
 #define LOGGER__DEBUG(...)  LOGGER_TO_SPDLOG(SPDLOG_DEBUG, __VA_ARGS__)
 #define LOGGER__INFO(...)  LOGGER_TO_SPDLOG(SPDLOG_INFO, __VA_ARGS__)
@@ -77,6 +128,10 @@ do{\
 #define LOGGER__ERROR(...)  LOGGER_TO_SPDLOG(SPDLOG_ERROR, __VA_ARGS__)
 #define LOGGER__CRITICAL(...)  LOGGER_TO_SPDLOG(SPDLOG_CRITICAL, __VA_ARGS__)
 
+// For call sites that may log on every frame (e.g. the interrupts and scheduler threads) - see LogRateLimiter
+#define LOGGER__WARNING_RATE_LIMITED(...)  LOGGER_TO_SPDLOG_RATE_LIMITED(SPDLOG_WARN, __VA_ARGS__)
+#define LOGGER__ERROR_RATE_LIMITED(...)  LOGGER_TO_SPDLOG_RATE_LIMITED(SPDLOG_ERROR, __VA_ARGS__)
+
 } /* namespace hailort */
 
 #endif /* _LOGGER_MACROS_HPP_ */
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file nms_frame_utils.hpp
+ * @brief Finds the valid bytes of NMS frames - the frames are sized for the maximum detections, while the
+ *        detections are packed at their start
+ **/
+
+#ifndef _HAILO_NMS_FRAME_UTILS_HPP_
+#define _HAILO_NMS_FRAME_UTILS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace hailort
+{
+
+class NmsFrameUtils final
+{
+public:
+    NmsFrameUtils() = delete;
+
+    // Whether the valid bytes of the frames of the format are a prefix of the frame (see get_valid_size())
+    static bool is_compactable(const hailo_format_t &format)
+    {
+        return (HAILO_FORMAT_TYPE_FLOAT32 == format.type) &&
+            ((HAILO_FORMAT_ORDER_HAILO_NMS == format.order) || (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == format.order));
+    }
+
+    // Returns the size of the valid prefix of the frame (the detections counts and the detections), the rest of the
+    // frame isn't used. A frame of a format that isn't compactable (or a malformed frame) is valid as a whole.
+    static size_t get_valid_size(const MemoryView &frame, const hailo_format_t &format, uint32_t number_of_classes)
+    {
+        if (!is_compactable(format)) {
+            return frame.size();
+        }
+
+        if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == format.order) {
+            uint16_t detections_count = 0;
+            if (frame.size() < sizeof(detections_count)) {
+                return frame.size();
+            }
+            memcpy(&detections_count, frame.data(), sizeof(detections_count));
+            const auto valid_size = sizeof(detections_count) + (detections_count * sizeof(hailo_detection_t));
+            return std::min(valid_size, frame.size());
+        }
+
+        // HAILO_FORMAT_ORDER_HAILO_NMS - each class is its bboxes count, followed by its bboxes
+        size_t offset = 0;
+        for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+            float32_t bbox_count = 0;
+            if ((frame.size() - offset) < sizeof(bbox_count)) {
+                return frame.size();
+            }
+            memcpy(&bbox_count, frame.data() + offset, sizeof(bbox_count));
+            if (!(bbox_count >= 0) || (bbox_count > static_cast<float32_t>(frame.size()))) {
+                return frame.size();
+            }
+            offset += sizeof(bbox_count) + (static_cast<size_t>(bbox_count) * sizeof(hailo_bbox_float32_t));
+            if (offset > frame.size()) {
+                return frame.size();
+            }
+        }
+        return offset;
+    }
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_NMS_FRAME_UTILS_HPP_ */
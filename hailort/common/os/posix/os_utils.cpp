@@ -15,6 +15,16 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#endif /* defined(__linux__) */
 
 #if defined(__QNX__)
 #define OS_UTILS__QNX_PAGE_SIZE (4096)
@@ -41,14 +51,29 @@ bool OsUtils::is_pid_alive(uint32_t pid)
     return (0 == kill(pid, EXISTENCE_CHECK_SIGNAL));
 }
 
+Expected<std::string> OsUtils::get_process_name(uint32_t pid)
+{
+#if defined(__linux__)
+    const auto comm_path = "/proc/" + std::to_string(pid) + "/comm";
+    std::ifstream comm_file(comm_path);
+    CHECK_AS_EXPECTED(comm_file.good(), HAILO_NOT_FOUND, "Failed open {}", comm_path);
+
+    std::string name;
+    std::getline(comm_file, name);
+    CHECK_AS_EXPECTED(!name.empty(), HAILO_NOT_FOUND, "Process {} has no name", pid);
+    return name;
+#elif defined(__QNX__)
+    (void)pid;
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+#endif
+}
+
 void OsUtils::set_current_thread_name(const std::string &name)
 {
-    (void)name;
-#ifndef NDEBUG
+    // Named on release builds as well, so the threads can be told apart when tuning their affinity and priority.
     // pthread_setname_np name size is limited to 16 chars (including null terminator)
     assert(name.size() < 16);
     pthread_setname_np(pthread_self(), name.c_str());
-#endif /* NDEBUG */
 }
 
 hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
@@ -70,6 +95,138 @@ hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
 #endif
 }
 
+hailo_status OsUtils::set_current_thread_numa_affinity(int numa_node)
+{
+#if defined(__linux__)
+    CHECK(numa_node >= 0, HAILO_INVALID_ARGUMENT, "Invalid numa node {}", numa_node);
+
+    // The cpulist file is formatted as ranges list, e.g. "0-7,16-23"
+    const auto cpulist_path = "/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist";
+    std::ifstream cpulist_file(cpulist_path);
+    CHECK(cpulist_file.good(), HAILO_NOT_AVAILABLE, "Failed open {}", cpulist_path);
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    std::string range;
+    while (std::getline(cpulist_file, range, ',')) {
+        int first = 0;
+        int last = 0;
+        char dash = 0;
+        std::istringstream range_stream(range);
+        range_stream >> first;
+        if (!(range_stream >> dash >> last)) {
+            // Single cpu
+            last = first;
+        }
+        for (int cpu = first; (cpu <= last) && (cpu < CPU_SETSIZE); cpu++) {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+    CHECK(CPU_COUNT(&cpuset) > 0, HAILO_NOT_AVAILABLE, "No cpus found for numa node {}", numa_node);
+
+    static const pid_t CURRENT_THREAD = 0;
+    int rc = sched_setaffinity(CURRENT_THREAD, sizeof(cpu_set_t), &cpuset);
+    CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "sched_setaffinity failed with status {}", rc);
+
+    return HAILO_SUCCESS;
+#elif defined(__QNX__)
+    (void)numa_node;
+    return HAILO_NOT_IMPLEMENTED;
+#endif
+}
+
+hailo_status OsUtils::set_current_thread_cpu_mask(uint64_t cpu_mask)
+{
+#if defined(__linux__)
+    CHECK(0 != cpu_mask, HAILO_INVALID_ARGUMENT, "Empty cpu mask");
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int cpu = 0; cpu < static_cast<int>(sizeof(cpu_mask) * 8); cpu++) {
+        if (cpu_mask & (1ULL << cpu)) {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+
+    static const pid_t CURRENT_THREAD = 0;
+    int rc = sched_setaffinity(CURRENT_THREAD, sizeof(cpu_set_t), &cpuset);
+    CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "sched_setaffinity failed with status {}", rc);
+
+    return HAILO_SUCCESS;
+#elif defined(__QNX__)
+    (void)cpu_mask;
+    // TODO: impl on qnx (HRT-10889)
+    return HAILO_NOT_IMPLEMENTED;
+#endif
+}
+
+hailo_status OsUtils::set_current_thread_realtime_priority(uint32_t priority)
+{
+    const auto min_priority = sched_get_priority_min(SCHED_FIFO);
+    const auto max_priority = sched_get_priority_max(SCHED_FIFO);
+    CHECK((static_cast<int>(priority) >= min_priority) && (static_cast<int>(priority) <= max_priority),
+        HAILO_INVALID_ARGUMENT, "Invalid real-time priority {} (valid range is {}-{})", priority, min_priority,
+        max_priority);
+
+    struct sched_param param = {};
+    param.sched_priority = static_cast<int>(priority);
+    // pthread_setschedparam returns the error instead of setting errno
+    int rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "pthread_setschedparam failed with error {}", rc);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsUtils::bind_memory_to_numa_node(void *address, size_t size, int numa_node)
+{
+#if defined(__linux__)
+    CHECK(numa_node >= 0, HAILO_INVALID_ARGUMENT, "Invalid numa node {}", numa_node);
+
+    // Using the syscall directly to avoid depending on libnuma.
+    static const size_t BITS_PER_MASK_WORD = sizeof(unsigned long) * 8;
+    const auto node = static_cast<size_t>(numa_node);
+    std::vector<unsigned long> nodemask((node / BITS_PER_MASK_WORD) + 1, 0);
+    nodemask[node / BITS_PER_MASK_WORD] = 1UL << (node % BITS_PER_MASK_WORD);
+    // The kernel ignores the last bit of maxnode, hence the +1
+    const unsigned long maxnode = (nodemask.size() * BITS_PER_MASK_WORD) + 1;
+    // MPOL_PREFERRED falls back to other nodes if the node is out of memory.
+    long rc = syscall(SYS_mbind, address, size, MPOL_PREFERRED, nodemask.data(), maxnode, 0);
+    CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "mbind failed with errno {}", errno);
+
+    return HAILO_SUCCESS;
+#elif defined(__QNX__)
+    (void)address;
+    (void)size;
+    (void)numa_node;
+    return HAILO_NOT_IMPLEMENTED;
+#endif
+}
+
+static void align_to_pages(void *&address, size_t &size)
+{
+    // POSIX requires the address to be page aligned (Linux aligns it down by itself)
+    const auto page_size = OsUtils::get_page_size();
+    const auto begin = reinterpret_cast<uintptr_t>(address) & ~(static_cast<uintptr_t>(page_size) - 1);
+    size += reinterpret_cast<uintptr_t>(address) - begin;
+    address = reinterpret_cast<void*>(begin);
+}
+
+hailo_status OsUtils::lock_memory(void *address, size_t size)
+{
+    align_to_pages(address, size);
+    // mlock faults in the pages of the range before it returns
+    CHECK(0 == mlock(address, size), HAILO_OUT_OF_HOST_MEMORY,
+        "mlock of {} bytes failed with errno {} (the locked memory limit may be too low, see RLIMIT_MEMLOCK)", size, errno);
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsUtils::unlock_memory(void *address, size_t size)
+{
+    align_to_pages(address, size);
+    CHECK(0 == munlock(address, size), HAILO_INTERNAL_FAILURE, "munlock of {} bytes failed with errno {}", size, errno);
+    return HAILO_SUCCESS;
+}
+
 size_t OsUtils::get_page_size()
 {
     static const auto page_size = sysconf(_SC_PAGESIZE);
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_memory_buffer.cpp
+ * @brief Shared memory buffer for Linux, using POSIX shared memory objects
+ **/
+
+#include "common/shared_memory_buffer.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hailort
+{
+
+static Expected<void*> map_shared_memory(int fd, size_t size)
+{
+    void *address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    CHECK_AS_EXPECTED(MAP_FAILED != address, HAILO_INTERNAL_FAILURE, "Failed to mmap shared memory, errno = {}", errno);
+    return address;
+}
+
+Expected<SharedMemoryBufferPtr> SharedMemoryBuffer::create_shared(const std::string &name, size_t size)
+{
+    // Only the processes of the creating user may access the buffer
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    CHECK_AS_EXPECTED(-1 != fd, HAILO_FILE_OPERATION_FAILURE, "Failed to create shared memory {}, errno = {}", name, errno);
+
+    if (0 != ftruncate(fd, static_cast<off_t>(size))) {
+        LOGGER__ERROR("Failed to set the size of shared memory {} to {}, errno = {}", name, size, errno);
+        close(fd);
+        shm_unlink(name.c_str());
+        return make_unexpected(HAILO_FILE_OPERATION_FAILURE);
+    }
+
+    // The mapping stays valid after the fd is closed
+    auto address = map_shared_memory(fd, size);
+    close(fd);
+    if (!address) {
+        shm_unlink(name.c_str());
+        return make_unexpected(address.status());
+    }
+
+    auto buffer = make_shared_nothrow<SharedMemoryBuffer>(name, address.value(), size, true);
+    if (nullptr == buffer) {
+        munmap(address.value(), size);
+        shm_unlink(name.c_str());
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return buffer;
+}
+
+Expected<SharedMemoryBufferPtr> SharedMemoryBuffer::open_shared(const std::string &name, size_t size)
+{
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    CHECK_AS_EXPECTED(-1 != fd, HAILO_FILE_OPERATION_FAILURE, "Failed to open shared memory {}, errno = {}", name, errno);
+
+    struct stat shm_stat = {};
+    if ((0 != fstat(fd, &shm_stat)) || (static_cast<size_t>(shm_stat.st_size) < size)) {
+        LOGGER__ERROR("Shared memory {} is smaller than {} bytes", name, size);
+        close(fd);
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
+
+    auto address = map_shared_memory(fd, size);
+    close(fd);
+    CHECK_EXPECTED(address);
+
+    auto buffer = make_shared_nothrow<SharedMemoryBuffer>(name, address.value(), size, false);
+    if (nullptr == buffer) {
+        munmap(address.value(), size);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return buffer;
+}
+
+hailo_status SharedMemoryBuffer::remove(const std::string &name)
+{
+    if (0 != shm_unlink(name.c_str())) {
+        CHECK(ENOENT == errno, HAILO_FILE_OPERATION_FAILURE, "Failed to unlink shared memory {}, errno = {}", name, errno);
+        return HAILO_NOT_FOUND;
+    }
+    return HAILO_SUCCESS;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string &name, void *address, size_t size, bool is_owner) :
+    m_name(name),
+    m_address(address),
+    m_size(size),
+    m_is_owner(is_owner),
+    m_creating_pid(OsUtils::get_curr_pid())
+{}
+
+SharedMemoryBuffer::~SharedMemoryBuffer()
+{
+    if (0 != munmap(m_address, m_size)) {
+        LOGGER__ERROR("Failed to munmap shared memory {}, errno = {}", m_name, errno);
+    }
+
+    if (m_is_owner && (OsUtils::get_curr_pid() == m_creating_pid) && (0 != shm_unlink(m_name.c_str()))) {
+        LOGGER__ERROR("Failed to unlink shared memory {}, errno = {}", m_name, errno);
+    }
+}
+
+} /* namespace hailort */
@@ -21,6 +21,7 @@ namespace hailort
 {
 
 #define LINUX_RMEM_MAX_PATH "/proc/sys/net/core/rmem_max"
+#define LINUX_WMEM_MAX_PATH "/proc/sys/net/core/wmem_max"
 
 hailo_status Socket::SocketModuleWrapper::init_module()
 {
@@ -133,40 +134,61 @@ hailo_status Socket::pton(int af, const char *src, void *dst)
     return HAILO_SUCCESS;
 }
 
-hailo_status Socket::set_recv_buffer_size_max()
+// Reads a max socket buffer size (rmem_max/wmem_max). Returns UINT64_MAX if it can't be read (so the kernel clamps
+// the requested size to the actual max)
+static uint64_t read_socket_buffer_size_max(const char *path)
 {
-    int socket_rc = SOCKET_ERROR;
-    FILE *rmem_max_file = NULL;
-    uint8_t rmem_max_buffer[20] = {};
-    uint64_t rmem_max = 0;
+    FILE *max_file = NULL;
+    uint8_t max_buffer[20] = {};
+    uint64_t max_value = 0;
     int file_status = 0;
     size_t bytes_read = 0;
-   
-    rmem_max_file = fopen(LINUX_RMEM_MAX_PATH, "r");
-    if (NULL != rmem_max_file) {
-        bytes_read = fread(rmem_max_buffer, sizeof(rmem_max_buffer), sizeof(*rmem_max_buffer), rmem_max_file);
-        if ((0 != bytes_read) || (feof(rmem_max_file))) {
-            rmem_max = strtoul((char *)rmem_max_buffer, NULL, 10);
+
+    max_file = fopen(path, "r");
+    if (NULL != max_file) {
+        bytes_read = fread(max_buffer, sizeof(max_buffer), sizeof(*max_buffer), max_file);
+        if ((0 != bytes_read) || (feof(max_file))) {
+            max_value = strtoul((char *)max_buffer, NULL, 10);
         }
 
-        if (0 == rmem_max) {
-            LOGGER__WARN("Could not read rmem_max value from file '{}'", LINUX_RMEM_MAX_PATH);
-            rmem_max = UINT64_MAX;
+        if (0 == max_value) {
+            LOGGER__WARN("Could not read max value from file '{}'", path);
+            max_value = UINT64_MAX;
         }
 
-        file_status = fclose(rmem_max_file);
+        file_status = fclose(max_file);
         if (0 != file_status) {
-            LOGGER__WARN("Could not close file '{}' errno - {}.", LINUX_RMEM_MAX_PATH, errno);
+            LOGGER__WARN("Could not close file '{}' errno - {}.", path, errno);
         }
     } else {
-        LOGGER__WARN("Could not open file '{}' to read rmem_max value.", LINUX_RMEM_MAX_PATH);
+        LOGGER__WARN("Could not open file '{}' to read max value.", path);
     }
+
+    return max_value;
+}
+
+hailo_status Socket::set_recv_buffer_size_max()
+{
+    int socket_rc = SOCKET_ERROR;
+    uint64_t rmem_max = read_socket_buffer_size_max(LINUX_RMEM_MAX_PATH);
+
     socket_rc = setsockopt(m_socket_fd, SOL_SOCKET, SO_RCVBUF, &rmem_max, sizeof(rmem_max));
     CHECK(0 == socket_rc, HAILO_ETH_FAILURE,  "Cannot set the rcv socket buffer to {}", rmem_max);
 
     return HAILO_SUCCESS;
 }
 
+hailo_status Socket::set_send_buffer_size_max()
+{
+    int socket_rc = SOCKET_ERROR;
+    uint64_t wmem_max = read_socket_buffer_size_max(LINUX_WMEM_MAX_PATH);
+
+    socket_rc = setsockopt(m_socket_fd, SOL_SOCKET, SO_SNDBUF, &wmem_max, sizeof(wmem_max));
+    CHECK(0 == socket_rc, HAILO_ETH_FAILURE,  "Cannot set the send socket buffer to {}", wmem_max);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status Socket::set_timeout(std::chrono::milliseconds timeout_ms, timeval_t *timeout)
 {
     int socket_rc = SOCKET_ERROR;
@@ -281,6 +303,185 @@ hailo_status Socket::recv_from(uint8_t *dest_buffer, size_t dest_buffer_size, in
     return HAILO_SUCCESS;
 }
 
+#if defined(__linux__)
+hailo_status Socket::send_to_batch(const MemoryView *datagrams, size_t datagrams_count, const MemoryView &prefix,
+    int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent)
+{
+    std::array<struct mmsghdr, MAX_SOCKET_BATCH_SIZE> messages{};
+    std::array<std::array<struct iovec, 2>, MAX_SOCKET_BATCH_SIZE> iovecs{};
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(dest_addr);
+    CHECK_ARG_NOT_NULL(datagrams_sent);
+    CHECK((0 < datagrams_count) && (datagrams_count <= MAX_SOCKET_BATCH_SIZE), HAILO_INVALID_ARGUMENT,
+        "Invalid batch size {} (max {})", datagrams_count, MAX_SOCKET_BATCH_SIZE);
+
+    for (size_t i = 0; i < datagrams_count; i++) {
+        size_t iovecs_count = 0;
+        // The prefix is gathered by the kernel, so there's no need to copy the datagrams to a padded buffer
+        if (!prefix.empty()) {
+            iovecs[i][iovecs_count].iov_base = const_cast<uint8_t*>(prefix.data());
+            iovecs[i][iovecs_count].iov_len = prefix.size();
+            iovecs_count++;
+        }
+        iovecs[i][iovecs_count].iov_base = const_cast<uint8_t*>(datagrams[i].data());
+        iovecs[i][iovecs_count].iov_len = datagrams[i].size();
+        iovecs_count++;
+
+        messages[i].msg_hdr.msg_name = const_cast<sockaddr*>(dest_addr);
+        messages[i].msg_hdr.msg_namelen = dest_addr_size;
+        messages[i].msg_hdr.msg_iov = iovecs[i].data();
+        messages[i].msg_hdr.msg_iovlen = iovecs_count;
+    }
+
+    const int number_of_sent_datagrams = sendmmsg(m_socket_fd, messages.data(), static_cast<unsigned int>(datagrams_count),
+        flags);
+    if (-1 == number_of_sent_datagrams) {
+        if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
+            LOGGER__ERROR("Udp send timeout");
+            return HAILO_TIMEOUT;
+        } else if (EINTR == errno) {
+            LOGGER__ERROR("Udp send interrupted!");
+            return HAILO_INTERRUPTED_BY_SIGNAL;
+        } else if (EPIPE == errno) {
+            // When socket is aborted from another thread sendmmsg will return errno EPIPE
+            LOGGER__INFO("Udp send aborted!");
+            return HAILO_STREAM_ABORT;
+        } else {
+            LOGGER__ERROR("Udp failed to send data, errno:{}.", errno);
+            return HAILO_ETH_SEND_FAILURE;
+        }
+    }
+
+    *datagrams_sent = static_cast<size_t>(number_of_sent_datagrams);
+    return HAILO_SUCCESS;
+}
+
+hailo_status Socket::recv_from_batch(MemoryView *datagrams, size_t datagrams_count, int flags, sockaddr *src_addr,
+    socklen_t src_addr_size, size_t *bytes_received, size_t *datagrams_received)
+{
+    std::array<struct mmsghdr, MAX_SOCKET_BATCH_SIZE> messages{};
+    std::array<struct iovec, MAX_SOCKET_BATCH_SIZE> iovecs{};
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(src_addr);
+    CHECK_ARG_NOT_NULL(bytes_received);
+    CHECK_ARG_NOT_NULL(datagrams_received);
+    CHECK((0 < datagrams_count) && (datagrams_count <= MAX_SOCKET_BATCH_SIZE), HAILO_INVALID_ARGUMENT,
+        "Invalid batch size {} (max {})", datagrams_count, MAX_SOCKET_BATCH_SIZE);
+
+    for (size_t i = 0; i < datagrams_count; i++) {
+        iovecs[i].iov_base = datagrams[i].data();
+        iovecs[i].iov_len = datagrams[i].size();
+        messages[i].msg_hdr.msg_name = src_addr;
+        messages[i].msg_hdr.msg_namelen = src_addr_size;
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // MSG_WAITFORONE - only the first datagram is waited for (by the socket's timeout), the rest are the ones that
+    // are already queued on the socket
+    const int number_of_received_datagrams = recvmmsg(m_socket_fd, messages.data(),
+        static_cast<unsigned int>(datagrams_count), flags | MSG_WAITFORONE, nullptr);
+    if (-1 == number_of_received_datagrams) {
+        if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
+            LOGGER__ERROR("Udp recvmmsg failed with timeout");
+            return HAILO_TIMEOUT;
+        } else if (EINTR == errno) {
+            LOGGER__ERROR("Udp recv interrupted!");
+            return HAILO_INTERRUPTED_BY_SIGNAL;
+        } else {
+            LOGGER__ERROR("Udp failed to recv data");
+            return HAILO_ETH_RECV_FAILURE;
+        }
+    }
+    else if ((0 == number_of_received_datagrams) ||
+             ((0 == messages[0].msg_len) && (0 != datagrams[0].size()))) {
+        LOGGER__INFO("Udp socket was aborted");
+        return HAILO_STREAM_ABORT;
+    }
+
+    for (int i = 0; i < number_of_received_datagrams; i++) {
+        if (messages[i].msg_hdr.msg_namelen > src_addr_size) {
+            LOGGER__ERROR("src_addr size invalid");
+            return HAILO_ETH_RECV_FAILURE;
+        }
+        bytes_received[i] = messages[i].msg_len;
+    }
+
+    *datagrams_received = static_cast<size_t>(number_of_received_datagrams);
+    return HAILO_SUCCESS;
+}
+#else
+hailo_status Socket::send_to_batch(const MemoryView *datagrams, size_t datagrams_count, const MemoryView &prefix,
+    int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent)
+{
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(dest_addr);
+    CHECK_ARG_NOT_NULL(datagrams_sent);
+    CHECK(0 < datagrams_count, HAILO_INVALID_ARGUMENT, "Can't send an empty batch");
+
+    // No sendmmsg - a single datagram is sent, with the prefix gathered by sendmsg
+    std::array<struct iovec, 2> iovecs{};
+    size_t iovecs_count = 0;
+    if (!prefix.empty()) {
+        iovecs[iovecs_count].iov_base = const_cast<uint8_t*>(prefix.data());
+        iovecs[iovecs_count].iov_len = prefix.size();
+        iovecs_count++;
+    }
+    iovecs[iovecs_count].iov_base = const_cast<uint8_t*>(datagrams[0].data());
+    iovecs[iovecs_count].iov_len = datagrams[0].size();
+    iovecs_count++;
+
+    struct msghdr message{};
+    message.msg_name = const_cast<sockaddr*>(dest_addr);
+    message.msg_namelen = dest_addr_size;
+    message.msg_iov = iovecs.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(iovecs_count);
+
+    if (-1 == sendmsg(m_socket_fd, &message, flags)) {
+        if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
+            LOGGER__ERROR("Udp send timeout");
+            return HAILO_TIMEOUT;
+        } else if (EINTR == errno) {
+            LOGGER__ERROR("Udp send interrupted!");
+            return HAILO_INTERRUPTED_BY_SIGNAL;
+        } else if (EPIPE == errno) {
+            LOGGER__INFO("Udp send aborted!");
+            return HAILO_STREAM_ABORT;
+        } else {
+            LOGGER__ERROR("Udp failed to send data, errno:{}.", errno);
+            return HAILO_ETH_SEND_FAILURE;
+        }
+    }
+
+    *datagrams_sent = 1;
+    return HAILO_SUCCESS;
+}
+
+hailo_status Socket::recv_from_batch(MemoryView *datagrams, size_t datagrams_count, int flags, sockaddr *src_addr,
+    socklen_t src_addr_size, size_t *bytes_received, size_t *datagrams_received)
+{
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(bytes_received);
+    CHECK_ARG_NOT_NULL(datagrams_received);
+    CHECK(0 < datagrams_count, HAILO_INVALID_ARGUMENT, "Can't receive an empty batch");
+
+    // No recvmmsg - a single datagram is received
+    auto status = recv_from(datagrams[0].data(), datagrams[0].size(), flags, src_addr, src_addr_size, &bytes_received[0]);
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    *datagrams_received = 1;
+    return HAILO_SUCCESS;
+}
+#endif /* defined(__linux__) */
+
 hailo_status Socket::has_data(sockaddr *src_addr, socklen_t src_addr_size, bool log_timeouts_in_debug)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -53,6 +53,12 @@ bool OsUtils::is_pid_alive(uint32_t pid)
     }
 }
 
+Expected<std::string> OsUtils::get_process_name(uint32_t pid)
+{
+    (void)pid;
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 void OsUtils::set_current_thread_name(const std::string &name)
 {
     (void)name;
@@ -67,6 +73,58 @@ hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
     return HAILO_SUCCESS;
 }
 
+hailo_status OsUtils::set_current_thread_numa_affinity(int numa_node)
+{
+    // TODO: impl using GetNumaNodeProcessorMaskEx
+    (void)numa_node;
+    return HAILO_NOT_IMPLEMENTED;
+}
+
+hailo_status OsUtils::set_current_thread_cpu_mask(uint64_t cpu_mask)
+{
+    CHECK(0 != cpu_mask, HAILO_INVALID_ARGUMENT, "Empty cpu mask");
+    CHECK(0 != SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(cpu_mask)), HAILO_INTERNAL_FAILURE,
+        "SetThreadAffinityMask failed. LE={}", GetLastError());
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsUtils::set_current_thread_realtime_priority(uint32_t priority)
+{
+    // Windows has no per-thread real-time priority levels - any priority maps to the highest thread priority of the
+    // process priority class.
+    CHECK(0 != priority, HAILO_INVALID_ARGUMENT, "Invalid real-time priority {}", priority);
+    CHECK(0 != SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL), HAILO_INTERNAL_FAILURE,
+        "SetThreadPriority failed. LE={}", GetLastError());
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsUtils::bind_memory_to_numa_node(void *address, size_t size, int numa_node)
+{
+    // On windows, the numa node is given on allocation (VirtualAllocExNuma)
+    (void)address;
+    (void)size;
+    (void)numa_node;
+    return HAILO_NOT_IMPLEMENTED;
+}
+
+hailo_status OsUtils::lock_memory(void *address, size_t size)
+{
+    // The pages of the range are faulted in by VirtualLock
+    CHECK(VirtualLock(address, size), HAILO_OUT_OF_HOST_MEMORY,
+        "VirtualLock of {} bytes failed with error {} (the working set of the process may be too small)", size,
+        GetLastError());
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsUtils::unlock_memory(void *address, size_t size)
+{
+    CHECK(VirtualUnlock(address, size), HAILO_INTERNAL_FAILURE, "VirtualUnlock of {} bytes failed with error {}", size,
+        GetLastError());
+    return HAILO_SUCCESS;
+}
+
 static size_t get_page_size_impl()
 {
     SYSTEM_INFO system_info{};
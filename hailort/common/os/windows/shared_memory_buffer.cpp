@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_memory_buffer.cpp
+ * @brief Shared memory buffer for Windows (not supported)
+ **/
+
+#include "common/shared_memory_buffer.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+namespace hailort
+{
+
+Expected<SharedMemoryBufferPtr> SharedMemoryBuffer::create_shared(const std::string &name, size_t size)
+{
+    (void)name;
+    (void)size;
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<SharedMemoryBufferPtr> SharedMemoryBuffer::open_shared(const std::string &name, size_t size)
+{
+    (void)name;
+    (void)size;
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+hailo_status SharedMemoryBuffer::remove(const std::string &name)
+{
+    (void)name;
+    return HAILO_NOT_SUPPORTED;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string &name, void *address, size_t size, bool is_owner) :
+    m_name(name),
+    m_address(address),
+    m_size(size),
+    m_is_owner(is_owner),
+    m_creating_pid(OsUtils::get_curr_pid())
+{}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() = default;
+
+} /* namespace hailort */
@@ -153,6 +153,18 @@ hailo_status Socket::set_recv_buffer_size_max()
     return HAILO_SUCCESS;
 }
 
+hailo_status Socket::set_send_buffer_size_max()
+{
+    int socket_rc = SOCKET_ERROR;
+
+    const int MAX_SEND_BUFFER_SIZE = 52428800;
+    socket_rc = setsockopt(m_socket_fd, SOL_SOCKET, SO_SNDBUF,
+        reinterpret_cast<const char*>(&MAX_SEND_BUFFER_SIZE), sizeof(MAX_SEND_BUFFER_SIZE));
+    CHECK(0 == socket_rc, HAILO_ETH_FAILURE, "Failed setsockopt(SOL_SOCKET, SO_SNDBUF). WSALE={}", WSAGetLastError());
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status Socket::set_timeout(const std::chrono::milliseconds timeout_ms, timeval_t *timeout)
 {
     int socket_rc = SOCKET_ERROR;
@@ -249,6 +261,64 @@ hailo_status Socket::recv_from(uint8_t *dest_buffer, size_t dest_buffer_size, in
     return HAILO_SUCCESS;
 }
 
+hailo_status Socket::send_to_batch(const MemoryView *datagrams, size_t datagrams_count, const MemoryView &prefix,
+    int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent)
+{
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(dest_addr);
+    CHECK_ARG_NOT_NULL(datagrams_sent);
+    CHECK(0 < datagrams_count, HAILO_INVALID_ARGUMENT, "Can't send an empty batch");
+
+    // There's no sendmmsg on windows, so a single datagram is sent (the prefix is still gathered without a copy)
+    std::array<WSABUF, 2> buffers{};
+    DWORD buffers_count = 0;
+    if (!prefix.empty()) {
+        buffers[buffers_count].buf = reinterpret_cast<char*>(const_cast<uint8_t*>(prefix.data()));
+        buffers[buffers_count].len = static_cast<ULONG>(prefix.size());
+        buffers_count++;
+    }
+    buffers[buffers_count].buf = reinterpret_cast<char*>(const_cast<uint8_t*>(datagrams[0].data()));
+    buffers[buffers_count].len = static_cast<ULONG>(datagrams[0].size());
+    buffers_count++;
+
+    DWORD number_of_sent_bytes = 0;
+    const auto result = WSASendTo(m_socket_fd, buffers.data(), buffers_count, &number_of_sent_bytes,
+        static_cast<DWORD>(flags), dest_addr, dest_addr_size, nullptr, nullptr);
+    if (SOCKET_ERROR == result) {
+        const int wsale = WSAGetLastError();
+        if (WSAETIMEDOUT == wsale) {
+            LOGGER__ERROR("Udp send timeout");
+            return HAILO_TIMEOUT;
+        } else {
+            LOGGER__ERROR("Udp failed to send data, WSALE={}.", wsale);
+            return HAILO_ETH_SEND_FAILURE;
+        }
+    }
+
+    *datagrams_sent = 1;
+    return HAILO_SUCCESS;
+}
+
+hailo_status Socket::recv_from_batch(MemoryView *datagrams, size_t datagrams_count, int flags, sockaddr *src_addr,
+    socklen_t src_addr_size, size_t *bytes_received, size_t *datagrams_received)
+{
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(bytes_received);
+    CHECK_ARG_NOT_NULL(datagrams_received);
+    CHECK(0 < datagrams_count, HAILO_INVALID_ARGUMENT, "Can't receive an empty batch");
+
+    // There's no recvmmsg on windows, so a single datagram is received
+    auto status = recv_from(datagrams[0].data(), datagrams[0].size(), flags, src_addr, src_addr_size, &bytes_received[0]);
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    *datagrams_received = 1;
+    return HAILO_SUCCESS;
+}
+
 hailo_status Socket::has_data(sockaddr *src_addr, socklen_t src_addr_size, bool log_timeouts_in_debug)
 {
     int number_of_received_bytes = SOCKET_ERROR;
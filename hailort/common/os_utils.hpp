@@ -62,8 +62,23 @@ public:
 
     static uint32_t get_curr_pid();
     static bool is_pid_alive(uint32_t pid);
+    // The name of the process's executable (as shown by ps, may be truncated)
+    static Expected<std::string> get_process_name(uint32_t pid);
     static void set_current_thread_name(const std::string &name);
     static hailo_status set_current_thread_affinity(uint8_t cpu_index);
+    // Sets the affinity of the current thread to all cpus of the given numa node.
+    static hailo_status set_current_thread_numa_affinity(int numa_node);
+    // Sets the affinity of the current thread to the cpus set in cpu_mask (bit i - cpu i).
+    static hailo_status set_current_thread_cpu_mask(uint64_t cpu_mask);
+    // Runs the current thread with a real-time FIFO scheduling policy at the given priority (1-99).
+    static hailo_status set_current_thread_realtime_priority(uint32_t priority);
+    // Sets the memory policy of the given range (page aligned), so its pages are allocated on the given numa node
+    // (if possible). Should be called before the pages are touched.
+    static hailo_status bind_memory_to_numa_node(void *address, size_t size, int numa_node);
+    // Faults in the pages of the given range and locks them in RAM, so accessing them never faults (subject to the
+    // process's locked memory limit). The range is extended to whole pages.
+    static hailo_status lock_memory(void *address, size_t size);
+    static hailo_status unlock_memory(void *address, size_t size);
     static size_t get_page_size();
     static size_t get_dma_able_alignment();
 };
@@ -12,12 +12,16 @@
 
 #include "hailo/runtime_statistics.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <mutex>
 #include <limits>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <vector>
 
 namespace hailort
 {
@@ -271,6 +275,400 @@ private:
     T m_sum; // the sum of data added with add_data_point, before inversion
 };
 
+// An accumulator for data points added per frame by many threads (e.g. the pipeline elements' latency and fps). The data
+// points are accumulated into SHARDS_COUNT shards - a thread always adds to the same shard, so the shards' locks are
+// practically uncontended (unlike the single lock of FullAccumulator) - and the shards are merged on read, using
+// Chan's parallel variant of Welford's algorithm.
+// See: https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+// If IsAverageFps, the data points are durations, and the statistics are of their inverse (as in AverageFPSAccumulator).
+template<typename T, bool IsAverageFps = false, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+class ShardedFullAccumulator : public Accumulator<T>
+{
+public:
+    // Creation isn't thread safe
+    ShardedFullAccumulator(const std::string& data_type) :
+        Accumulator<T>(data_type),
+        m_shards()
+    {}
+    ShardedFullAccumulator(ShardedFullAccumulator &&) = delete;
+    ShardedFullAccumulator(const ShardedFullAccumulator &) = delete;
+    ShardedFullAccumulator &operator=(ShardedFullAccumulator &&) = delete;
+    ShardedFullAccumulator &operator=(const ShardedFullAccumulator &) = delete;
+    virtual ~ShardedFullAccumulator() = default;
+
+    virtual void add_data_point(T data, uint32_t samples_count = 1) override
+    {
+        if (IsAverageFps) {
+            assert(0 != data);
+        }
+        const auto value = IsAverageFps ? (1.0 / static_cast<double>(data)) : static_cast<double>(data);
+
+        auto &shard = m_shards[current_thread_shard_index()];
+        ShardLock lock(shard);
+        shard.stats.add(value, static_cast<double>(data), samples_count);
+    }
+
+    virtual AccumulatorResults get() const override
+    {
+        const auto stats = merge(false);
+        return results(stats);
+    }
+
+    virtual AccumulatorResults get_and_clear() override
+    {
+        const auto stats = merge(true);
+        return results(stats);
+    }
+
+    virtual Expected<size_t> count() const override
+    {
+        return Expected<size_t>(merge(false).count);
+    }
+
+    virtual Expected<double> min() const override
+    {
+        return min_of(merge(false));
+    }
+
+    virtual Expected<double> max() const override
+    {
+        return max_of(merge(false));
+    }
+
+    virtual Expected<double> mean() const override
+    {
+        return mean_of(merge(false));
+    }
+
+    // Sample variance
+    virtual Expected<double> var() const override
+    {
+        return var_of(merge(false));
+    }
+
+    // Sample sd
+    virtual Expected<double> sd() const override
+    {
+        return sd_of(merge(false));
+    }
+
+    // Sample mean sd
+    virtual Expected<double> mean_sd() const override
+    {
+        return mean_sd_of(merge(false));
+    }
+
+private:
+    static constexpr size_t SHARDS_COUNT = 16;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Stats {
+        size_t count = 0;
+        double min = static_cast<double>(std::numeric_limits<T>::max());
+        double max = static_cast<double>(std::numeric_limits<T>::min());
+        double mean = 0;
+        double M2 = 0; // Sum {i=1...n} (x_i-x_mean)^2
+        double sum = 0; // The sum of the data points before the inversion (used only if IsAverageFps)
+
+        void add(double value, double data, uint32_t samples_count)
+        {
+            sum += data;
+            min = std::min(min, value);
+            max = std::max(max, value);
+            count += samples_count;
+            const auto delta = value - mean;
+            mean += ((delta * samples_count) / static_cast<double>(count));
+            M2 += delta * (value - mean);
+        }
+
+        void merge(const Stats &other)
+        {
+            if (0 == other.count) {
+                return;
+            }
+            const auto merged_count = count + other.count;
+            const auto delta = other.mean - mean;
+            mean += delta * static_cast<double>(other.count) / static_cast<double>(merged_count);
+            M2 += other.M2 + ((delta * delta) * static_cast<double>(count) * static_cast<double>(other.count) /
+                static_cast<double>(merged_count));
+            count = merged_count;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            sum += other.sum;
+        }
+    };
+
+    struct Shard {
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+        Stats stats;
+        // Keeps the shards on separate cache lines, so the threads don't invalidate each other's shards
+        uint8_t padding[CACHE_LINE_SIZE];
+    };
+
+    class ShardLock final {
+    public:
+        ShardLock(Shard &shard) : m_shard(shard)
+        {
+            while (m_shard.lock.test_and_set(std::memory_order_acquire)) {}
+        }
+        ~ShardLock()
+        {
+            m_shard.lock.clear(std::memory_order_release);
+        }
+
+    private:
+        Shard &m_shard;
+    };
+
+    static size_t current_thread_shard_index()
+    {
+        static std::atomic<size_t> next_index(0);
+        static thread_local const size_t index = (next_index++ % SHARDS_COUNT);
+        return index;
+    }
+
+    Stats merge(bool clear) const
+    {
+        Stats result;
+        for (auto &shard : m_shards) {
+            ShardLock lock(shard);
+            result.merge(shard.stats);
+            if (clear) {
+                shard.stats = Stats();
+            }
+        }
+        return result;
+    }
+
+    static AccumulatorResults results(const Stats &stats)
+    {
+        return AccumulatorResults(Expected<size_t>(stats.count), min_of(stats), max_of(stats), mean_of(stats),
+            var_of(stats), sd_of(stats), mean_sd_of(stats));
+    }
+
+    static Expected<double> min_of(const Stats &stats)
+    {
+        if (stats.count < 1) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(stats.min);
+    }
+
+    static Expected<double> max_of(const Stats &stats)
+    {
+        if (stats.count < 1) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(stats.max);
+    }
+
+    static Expected<double> mean_of(const Stats &stats)
+    {
+        if (stats.count < 1) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        // The average fps is the frames count over the total duration (rather than the mean of the inverses)
+        return Expected<double>(IsAverageFps ? (static_cast<double>(stats.count) / stats.sum) : stats.mean);
+    }
+
+    static Expected<double> var_of(const Stats &stats)
+    {
+        if (stats.count < 2) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(stats.M2 / static_cast<double>(stats.count - 1));
+    }
+
+    static Expected<double> sd_of(const Stats &stats)
+    {
+        if (stats.count < 2) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(std::sqrt(stats.M2 / static_cast<double>(stats.count - 1)));
+    }
+
+    static Expected<double> mean_sd_of(const Stats &stats)
+    {
+        if (stats.count < 2) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        // Calculation based on: https://en.wikipedia.org/wiki/Standard_deviation#Standard_deviation_of_the_mean
+        return Expected<double>(std::sqrt(stats.M2 / static_cast<double>(stats.count - 1)) / std::sqrt(stats.count));
+    }
+
+    // Mutable, as the shards are locked by the const getters
+    mutable std::array<Shard, SHARDS_COUNT> m_shards;
+};
+
+template<typename T>
+using ShardedAverageFPSAccumulator = ShardedFullAccumulator<T, true>;
+
+// Lock free latency histogram with HDR-style buckets - each power of 2 range of durations is split to SUB_BUCKETS_COUNT
+// equal buckets, so percentiles are kept with a relative error of at most 1/SUB_BUCKETS_COUNT, in constant memory.
+// Recording is thread safe and may run concurrently with get_results (the results may then miss the concurrent records).
+class LatencyHistogram final
+{
+public:
+    LatencyHistogram() : m_buckets(), m_count(0), m_sum_ns(0), m_min_ns(std::numeric_limits<uint64_t>::max()), m_max_ns(0)
+    {
+        for (auto &bucket : m_buckets) {
+            bucket = 0;
+        }
+    }
+    LatencyHistogram(LatencyHistogram &&) = delete;
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram &operator=(LatencyHistogram &&) = delete;
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+    ~LatencyHistogram() = default;
+
+    void record(std::chrono::nanoseconds duration)
+    {
+        const auto value = std::min(static_cast<uint64_t>(std::max(duration.count(), static_cast<int64_t>(0))), MAX_VALUE_NS);
+        m_buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum_ns.fetch_add(value, std::memory_order_relaxed);
+
+        auto min = m_min_ns.load(std::memory_order_relaxed);
+        while ((value < min) && !m_min_ns.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+        auto max = m_max_ns.load(std::memory_order_relaxed);
+        while ((value > max) && !m_max_ns.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    }
+
+    LatencyHistogramResults get_results() const
+    {
+        LatencyHistogramResults results{};
+        results.count = static_cast<size_t>(m_count.load(std::memory_order_relaxed));
+        if (0 == results.count) {
+            return results;
+        }
+
+        std::array<uint64_t, BUCKETS_COUNT> buckets{};
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+            buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+            total += buckets[i];
+        }
+
+        results.min_ms = ns_to_ms(m_min_ns.load(std::memory_order_relaxed));
+        results.max_ms = ns_to_ms(m_max_ns.load(std::memory_order_relaxed));
+        results.mean_ms = ns_to_ms(m_sum_ns.load(std::memory_order_relaxed)) / static_cast<double>(results.count);
+        results.p50_ms = std::min(percentile_ms(buckets, total, 0.5), results.max_ms);
+        results.p90_ms = std::min(percentile_ms(buckets, total, 0.9), results.max_ms);
+        results.p99_ms = std::min(percentile_ms(buckets, total, 0.99), results.max_ms);
+        results.p999_ms = std::min(percentile_ms(buckets, total, 0.999), results.max_ms);
+        return results;
+    }
+
+    // Returns the amount of the recorded durations of up to each of the given bounds (sorted ascending) - each bucket is
+    // counted by its middle value, and the sum of all the durations. Used for exporting the histogram with other buckets.
+    std::vector<uint64_t> get_cumulative_counts(const std::vector<std::chrono::nanoseconds> &upper_bounds,
+        std::chrono::nanoseconds &sum) const
+    {
+        std::vector<uint64_t> counts(upper_bounds.size(), 0);
+        size_t bound_index = 0;
+        uint64_t seen = 0;
+        for (size_t i = 0; (i < BUCKETS_COUNT) && (bound_index < upper_bounds.size()); i++) {
+            while ((bound_index < upper_bounds.size()) &&
+                    (bucket_value_ns(i) > static_cast<double>(upper_bounds[bound_index].count()))) {
+                counts[bound_index++] = seen;
+            }
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+        }
+        for (; bound_index < upper_bounds.size(); bound_index++) {
+            counts[bound_index] = seen;
+        }
+        sum = std::chrono::nanoseconds(m_sum_ns.load(std::memory_order_relaxed));
+        return counts;
+    }
+
+    size_t count() const
+    {
+        return static_cast<size_t>(m_count.load(std::memory_order_relaxed));
+    }
+
+    // Not atomic with concurrent record() calls - a duration recorded meanwhile may be partly kept
+    void reset()
+    {
+        for (auto &bucket : m_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum_ns.store(0, std::memory_order_relaxed);
+        m_min_ns.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        m_max_ns.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t SUB_BUCKETS_BITS = 5;
+    static constexpr uint64_t SUB_BUCKETS_COUNT = (1 << SUB_BUCKETS_BITS);
+    // ~18 minutes, longer durations are counted as MAX_VALUE_NS
+    static constexpr uint32_t MAX_VALUE_BITS = 40;
+    static constexpr uint64_t MAX_VALUE_NS = (1ULL << MAX_VALUE_BITS) - 1;
+    // Values below SUB_BUCKETS_COUNT have a bucket each, then SUB_BUCKETS_COUNT buckets per power of 2
+    static constexpr size_t BUCKETS_COUNT = (MAX_VALUE_BITS - SUB_BUCKETS_BITS + 1) * SUB_BUCKETS_COUNT;
+
+    static uint32_t msb(uint64_t value)
+    {
+        uint32_t result = 0;
+        while (value >>= 1) {
+            result++;
+        }
+        return result;
+    }
+
+    static size_t bucket_index(uint64_t value)
+    {
+        if (value < SUB_BUCKETS_COUNT) {
+            return static_cast<size_t>(value);
+        }
+
+        const auto shift = msb(value) - SUB_BUCKETS_BITS;
+        return static_cast<size_t>(((shift + 1) * SUB_BUCKETS_COUNT) + ((value >> shift) - SUB_BUCKETS_COUNT));
+    }
+
+    // Returns the middle of the range of values counted by the bucket
+    static double bucket_value_ns(size_t index)
+    {
+        if (index < SUB_BUCKETS_COUNT) {
+            return static_cast<double>(index);
+        }
+
+        const auto shift = static_cast<uint32_t>(index / SUB_BUCKETS_COUNT) - 1;
+        const auto lowest = (SUB_BUCKETS_COUNT + (index % SUB_BUCKETS_COUNT)) << shift;
+        return static_cast<double>(lowest) + (static_cast<double>(1ULL << shift) / 2);
+    }
+
+    static double ns_to_ms(uint64_t value_ns)
+    {
+        return static_cast<double>(value_ns) / 1e6;
+    }
+
+    static double percentile_ms(const std::array<uint64_t, BUCKETS_COUNT> &buckets, uint64_t total, double percentile)
+    {
+        const auto rank = std::max(static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(total))),
+            static_cast<uint64_t>(1));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return bucket_value_ns(i) / 1e6;
+            }
+        }
+        return bucket_value_ns(BUCKETS_COUNT - 1) / 1e6;
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKETS_COUNT> m_buckets;
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sum_ns;
+    std::atomic<uint64_t> m_min_ns;
+    std::atomic<uint64_t> m_max_ns;
+};
+using LatencyHistogramPtr = std::shared_ptr<LatencyHistogram>;
+
 } /* namespace hailort */
 
 #endif /* _HAILO_RUNTIME_STATISTICS_INTERNAL_HPP_ */
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file seqlock_shared_memory.cpp
+ * @brief Named shared memory holding a single message, published by one process and read by any number of processes
+ **/
+
+#include "common/seqlock_shared_memory.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace hailort
+{
+
+static constexpr uint32_t SEQLOCK_SHARED_MEMORY_MAGIC = 0x484C5351; // "HLSQ"
+static constexpr uint32_t SEQLOCK_SHARED_MEMORY_VERSION = 1;
+static constexpr size_t SEQLOCK_SHARED_MEMORY_MESSAGE_ALIGNMENT = 64;
+// A reader that keeps racing with the writer gives up after this many attempts (each attempt is a single copy)
+static constexpr uint32_t SEQLOCK_SHARED_MEMORY_MAX_READ_ATTEMPTS = 1000;
+
+// The atomics are shared between processes, so they must not be implemented with a (process local) lock
+static_assert(2 == ATOMIC_LLONG_LOCK_FREE, "64 bit atomics must be lock free");
+
+struct SeqlockSharedMemory::Header {
+    // Set last by the writer, once the rest of the header is valid
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t writer_pid;
+    uint32_t reserved;
+    uint64_t max_message_size;
+    // Odd while the writer is copying a message, 0 if no message was published yet
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> message_size;
+    std::atomic<int64_t> last_write_time_ms;
+};
+
+size_t SeqlockSharedMemory::message_offset()
+{
+    return ((sizeof(Header) + SEQLOCK_SHARED_MEMORY_MESSAGE_ALIGNMENT - 1) /
+        SEQLOCK_SHARED_MEMORY_MESSAGE_ALIGNMENT) * SEQLOCK_SHARED_MEMORY_MESSAGE_ALIGNMENT;
+}
+
+Expected<SeqlockSharedMemoryPtr> SeqlockSharedMemory::create_shared(const std::string &name, size_t max_message_size)
+{
+    TRY(auto shared_memory, SharedMemoryBuffer::create_shared(name, message_offset() + max_message_size));
+
+    // The shared memory is zero initialized, so the sequence and the message size are already 0
+    auto header = reinterpret_cast<Header*>(shared_memory->user_address());
+    header->version = SEQLOCK_SHARED_MEMORY_VERSION;
+    header->writer_pid = OsUtils::get_curr_pid();
+    header->max_message_size = max_message_size;
+    header->magic.store(SEQLOCK_SHARED_MEMORY_MAGIC, std::memory_order_release);
+
+    auto seqlock_shared_memory = make_shared_nothrow<SeqlockSharedMemory>(std::move(shared_memory));
+    CHECK_NOT_NULL_AS_EXPECTED(seqlock_shared_memory, HAILO_OUT_OF_HOST_MEMORY);
+    return seqlock_shared_memory;
+}
+
+Expected<SeqlockSharedMemoryPtr> SeqlockSharedMemory::open_shared(const std::string &name)
+{
+    // The size of the message is known only after reading the header
+    uint64_t max_message_size = 0;
+    {
+        TRY(auto header_memory, SharedMemoryBuffer::open_shared(name, message_offset()));
+        auto header = reinterpret_cast<const Header*>(header_memory->user_address());
+        // The writer may have not finished creating the object yet
+        CHECK_AS_EXPECTED(SEQLOCK_SHARED_MEMORY_MAGIC == header->magic.load(std::memory_order_acquire), HAILO_NOT_AVAILABLE,
+            "Shared memory {} is not initialized", name);
+        CHECK_AS_EXPECTED(SEQLOCK_SHARED_MEMORY_VERSION == header->version, HAILO_INVALID_OPERATION,
+            "Shared memory {} has version {}, expected {}", name, header->version, SEQLOCK_SHARED_MEMORY_VERSION);
+        max_message_size = header->max_message_size;
+    }
+
+    TRY(auto shared_memory, SharedMemoryBuffer::open_shared(name, message_offset() + static_cast<size_t>(max_message_size)));
+    auto seqlock_shared_memory = make_shared_nothrow<SeqlockSharedMemory>(std::move(shared_memory));
+    CHECK_NOT_NULL_AS_EXPECTED(seqlock_shared_memory, HAILO_OUT_OF_HOST_MEMORY);
+    return seqlock_shared_memory;
+}
+
+SeqlockSharedMemory::SeqlockSharedMemory(SharedMemoryBufferPtr shared_memory) :
+    m_shared_memory(std::move(shared_memory))
+{}
+
+SeqlockSharedMemory::Header *SeqlockSharedMemory::header() const
+{
+    return reinterpret_cast<Header*>(m_shared_memory->user_address());
+}
+
+uint8_t *SeqlockSharedMemory::message_address() const
+{
+    return reinterpret_cast<uint8_t*>(m_shared_memory->user_address()) + message_offset();
+}
+
+size_t SeqlockSharedMemory::max_message_size() const
+{
+    return static_cast<size_t>(header()->max_message_size);
+}
+
+uint32_t SeqlockSharedMemory::writer_pid() const
+{
+    return header()->writer_pid;
+}
+
+std::chrono::system_clock::time_point SeqlockSharedMemory::last_write_time() const
+{
+    return std::chrono::system_clock::time_point(
+        std::chrono::milliseconds(header()->last_write_time_ms.load(std::memory_order_relaxed)));
+}
+
+hailo_status SeqlockSharedMemory::write(const uint8_t *message, size_t message_size)
+{
+    CHECK(message_size <= max_message_size(), HAILO_INSUFFICIENT_BUFFER,
+        "Message of {} bytes doesn't fit into shared memory {} (max {} bytes)", message_size, name(), max_message_size());
+
+    auto hdr = header();
+    const auto sequence = hdr->sequence.load(std::memory_order_relaxed);
+    hdr->sequence.store(sequence + 1, std::memory_order_relaxed);
+    // Readers that see the new message's bytes must also see the odd sequence
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(message_address(), message, message_size);
+    hdr->message_size.store(message_size, std::memory_order_relaxed);
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    hdr->last_write_time_ms.store(static_cast<int64_t>(now), std::memory_order_relaxed);
+
+    hdr->sequence.store(sequence + 2, std::memory_order_release);
+    return HAILO_SUCCESS;
+}
+
+hailo_status SeqlockSharedMemory::read(std::vector<uint8_t> &message) const
+{
+    const auto hdr = header();
+    for (uint32_t attempt = 0; attempt < SEQLOCK_SHARED_MEMORY_MAX_READ_ATTEMPTS; attempt++) {
+        const auto sequence_before = hdr->sequence.load(std::memory_order_acquire);
+        if (0 == sequence_before) {
+            return HAILO_NOT_AVAILABLE;
+        }
+        if (0 != (sequence_before & 1)) {
+            // The writer is in the middle of a copy
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto message_size = hdr->message_size.load(std::memory_order_relaxed);
+        if (message_size > hdr->max_message_size) {
+            continue; // Torn read, the sequence check below would have failed anyway
+        }
+        message.resize(static_cast<size_t>(message_size));
+        std::memcpy(message.data(), message_address(), message.size());
+
+        // The copy must be done before re-checking the sequence
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_before == hdr->sequence.load(std::memory_order_relaxed)) {
+            return HAILO_SUCCESS;
+        }
+    }
+
+    LOGGER__WARNING("Failed taking a consistent copy of shared memory {}", name());
+    return HAILO_TIMEOUT;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file seqlock_shared_memory.hpp
+ * @brief Named shared memory holding a single message, published by one process and read by any number of processes
+ **/
+
+#ifndef _HAILO_SEQLOCK_SHARED_MEMORY_HPP_
+#define _HAILO_SEQLOCK_SHARED_MEMORY_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "common/shared_memory_buffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+class SeqlockSharedMemory;
+using SeqlockSharedMemoryPtr = std::shared_ptr<SeqlockSharedMemory>;
+
+/**
+ * The message is guarded by a sequence lock: the writer makes the sequence odd while copying a new message, and even
+ * once the copy is done. Readers never write to the shared memory (so they can't block the writer, nor each other) -
+ * a reader copies the message out and retries if the sequence was odd or has changed during the copy.
+ */
+class SeqlockSharedMemory final
+{
+public:
+    // Creates the shared memory object named name, which can hold messages of up to max_message_size bytes.
+    // Should be called only by the single writer of the name.
+    static Expected<SeqlockSharedMemoryPtr> create_shared(const std::string &name, size_t max_message_size);
+    // Opens a shared memory object created (by another process) with create_shared.
+    static Expected<SeqlockSharedMemoryPtr> open_shared(const std::string &name);
+
+    explicit SeqlockSharedMemory(SharedMemoryBufferPtr shared_memory);
+
+    SeqlockSharedMemory(const SeqlockSharedMemory &) = delete;
+    SeqlockSharedMemory &operator=(const SeqlockSharedMemory &) = delete;
+    SeqlockSharedMemory(SeqlockSharedMemory &&) = delete;
+    SeqlockSharedMemory &operator=(SeqlockSharedMemory &&) = delete;
+
+    // Publishes a new message. Must not be called concurrently (there is a single writer).
+    hailo_status write(const uint8_t *message, size_t message_size);
+
+    // Copies the last published message into message (resized to the message's size). Returns HAILO_NOT_AVAILABLE if
+    // nothing was published yet, and HAILO_TIMEOUT if a consistent copy couldn't be taken.
+    hailo_status read(std::vector<uint8_t> &message) const;
+
+    // The pid of the writer, and the (system clock) time of its last published message
+    uint32_t writer_pid() const;
+    std::chrono::system_clock::time_point last_write_time() const;
+
+    size_t max_message_size() const;
+    const std::string &name() const { return m_shared_memory->name(); }
+
+private:
+    struct Header;
+
+    static size_t message_offset();
+    Header *header() const;
+    uint8_t *message_address() const;
+
+    SharedMemoryBufferPtr m_shared_memory;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SEQLOCK_SHARED_MEMORY_HPP_ */
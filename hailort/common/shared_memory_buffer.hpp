@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_memory_buffer.hpp
+ * @brief Named shared memory, used for passing buffers between unrelated processes
+ **/
+
+#ifndef _HAILO_SHARED_MEMORY_BUFFER_HPP_
+#define _HAILO_SHARED_MEMORY_BUFFER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include <memory>
+#include <string>
+
+namespace hailort
+{
+
+class SharedMemoryBuffer;
+using SharedMemoryBufferPtr = std::shared_ptr<SharedMemoryBuffer>;
+
+class SharedMemoryBuffer final
+{
+public:
+    // Creates a new shared memory object named name. The name is removed once the created object is destroyed (processes
+    // that already opened it keep their mapping).
+    static Expected<SharedMemoryBufferPtr> create_shared(const std::string &name, size_t size);
+    // Opens a shared memory object created by another process. The object must be at least size bytes large.
+    static Expected<SharedMemoryBufferPtr> open_shared(const std::string &name, size_t size);
+    // Removes the name of a shared memory object left by a process that didn't destroy it (e.g. crashed). Returns
+    // HAILO_NOT_FOUND if there is no such name.
+    static hailo_status remove(const std::string &name);
+
+    SharedMemoryBuffer(const std::string &name, void *address, size_t size, bool is_owner);
+    ~SharedMemoryBuffer();
+
+    SharedMemoryBuffer(const SharedMemoryBuffer &) = delete;
+    SharedMemoryBuffer &operator=(const SharedMemoryBuffer &) = delete;
+    SharedMemoryBuffer(SharedMemoryBuffer &&) = delete;
+    SharedMemoryBuffer &operator=(SharedMemoryBuffer &&) = delete;
+
+    const std::string &name() const { return m_name; }
+    void *user_address() { return m_address; }
+    size_t size() const { return m_size; }
+
+private:
+    const std::string m_name;
+    void *m_address;
+    const size_t m_size;
+    // Whether this object created the shared memory object (and should remove its name). A forked child doesn't remove
+    // the name of its parent's shared memory.
+    const bool m_is_owner;
+    const uint32_t m_creating_pid;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SHARED_MEMORY_BUFFER_HPP_ */
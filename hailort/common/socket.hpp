@@ -28,6 +28,8 @@ namespace hailort
 #define MIN_UDP_PAYLOAD_SIZE (24)
 #define MAX_UDP_PAYLOAD_SIZE (1456)
 #define MAX_UDP_PADDED_PAYLOAD_SIZE (MAX_UDP_PAYLOAD_SIZE - PADDING_BYTES_SIZE - PADDING_ALIGN_BYTES)
+// Max number of datagrams moved by a single send_to_batch/recv_from_batch call
+#define MAX_SOCKET_BATCH_SIZE (32)
 
 #define CHECK_VALID_SOCKET_AS_EXPECTED(sock) CHECK((sock) != INVALID_SOCKET, make_unexpected(HAILO_ETH_FAILURE), "Invalid socket")
 
@@ -51,6 +53,7 @@ public:
     hailo_status get_sock_name(sockaddr *addr, socklen_t *len);
 
     hailo_status set_recv_buffer_size_max();
+    hailo_status set_send_buffer_size_max();
     hailo_status set_timeout(const std::chrono::milliseconds timeout_ms, timeval_t *timeout);
     hailo_status enable_broadcast();
     hailo_status abort();
@@ -63,6 +66,17 @@ public:
         sockaddr *src_addr, socklen_t src_addr_size, size_t *bytes_received, bool log_timeouts_in_debug = false);
     hailo_status has_data(sockaddr *src_addr, socklen_t src_addr_size, bool log_timeouts_in_debug = false);
 
+    // Sends up to datagrams_count (<= MAX_SOCKET_BATCH_SIZE) datagrams, each prefixed by prefix (may be empty).
+    // On linux it's done with a single sendmmsg syscall. datagrams_sent is set to the number of datagrams that were
+    // sent, which may be smaller than datagrams_count.
+    hailo_status send_to_batch(const MemoryView *datagrams, size_t datagrams_count, const MemoryView &prefix, int flags,
+        const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent);
+    // Receives up to datagrams_count (<= MAX_SOCKET_BATCH_SIZE) datagrams, blocking (up to the socket's timeout) only
+    // until the first one arrives. On linux it's done with a single recvmmsg syscall. The size of each received
+    // datagram is written to bytes_received, and datagrams_received is set to the number of received datagrams.
+    hailo_status recv_from_batch(MemoryView *datagrams, size_t datagrams_count, int flags, sockaddr *src_addr,
+        socklen_t src_addr_size, size_t *bytes_received, size_t *datagrams_received);
+
 private:
     class SocketModuleWrapper final {
     public:
@@ -258,6 +258,31 @@ struct hailo_desc_list_program_params {
     bool is_debug;              // in
 };
 
+/* structure used in ioctl HAILO_DESC_LIST_PROGRAM_BATCH */
+// Max amount of buffers programmed to a descriptors list by a single ioctl call.
+#define HAILO_MAX_DESC_LIST_PROGRAMS_PER_BATCH (64)
+
+struct hailo_desc_list_buffer_program {
+    size_t buffer_handle;       // in
+    size_t buffer_size;         // in
+    size_t buffer_offset;       // in
+    uint32_t starting_desc;     // in
+    enum hailo_vdma_interrupts_domain last_interrupts_domain;  // in
+};
+
+// Same as HAILO_DESC_LIST_PROGRAM, for multiple buffers (or multiple parts of a buffer) on the same descriptors list.
+struct hailo_desc_list_program_batch_params {
+    uintptr_t desc_handle;      // in
+    uint8_t channel_index;      // in
+    bool should_bind;           // in
+    bool is_debug;              // in
+    uint8_t programs_count;     // in
+    struct hailo_desc_list_buffer_program
+        programs[HAILO_MAX_DESC_LIST_PROGRAMS_PER_BATCH];   // in, programmed by the given order. On failure, stops on
+                                                            // the first failed program.
+    uint8_t programmed_count;   // out, amount of buffers programmed successfully.
+};
+
 /* structure used in ioctl HAILO_VDMA_ENABLE_CHANNELS */
 struct hailo_vdma_enable_channels_params {
     uint32_t channels_bitmap_per_engine[MAX_VDMA_ENGINES];  // in
@@ -269,7 +294,7 @@ struct hailo_vdma_disable_channels_params {
     uint32_t channels_bitmap_per_engine[MAX_VDMA_ENGINES];  // in
 };
 
-/* structure used in ioctl HAILO_VDMA_INTERRUPTS_WAIT */
+/* structure used in ioctl HAILO_VDMA_INTERRUPTS_WAIT and HAILO_VDMA_INTERRUPTS_POLL */
 struct hailo_vdma_interrupts_channel_data {
     uint8_t engine_index;
     uint8_t channel_index;
@@ -506,6 +531,28 @@ struct hailo_vdma_launch_transfer_params {
     int launch_transfer_status;                                         // out, status of the launch transfer call. (only used in case of error)
 };
 
+/* structure used in ioctl HAILO_VDMA_LAUNCH_TRANSFERS */
+// Max amount of transfers (possibly on different channels) launched by a single ioctl call.
+#define HAILO_MAX_TRANSFERS_PER_LAUNCH (32)
+
+struct hailo_vdma_launch_transfers_params {
+    uint8_t transfers_count;                                            // in
+    struct hailo_vdma_launch_transfer_params
+        transfers[HAILO_MAX_TRANSFERS_PER_LAUNCH];                      // in/out, launched by the given order. On
+                                                                        // failure, stops on the first failed transfer.
+    uint8_t launched_count;                                             // out, amount of transfers launched successfully.
+};
+
+/* structure used in ioctl HAILO_VDMA_SET_INTERRUPTS_COALESCING */
+// Transfers may be launched without an interrupt on their last descriptor. If such transfers are still ongoing
+// timeout_us after they were launched, the driver wakes the interrupts waiters as if an interrupt was raised (and
+// reports all transfers completed so far). timeout_us = 0 disables the timer.
+struct hailo_vdma_interrupts_coalescing_params {
+    uint8_t engine_index;   // in
+    uint8_t channel_index;  // in
+    uint32_t timeout_us;    // in
+};
+
 /* structure used in ioctl HAILO_SOC_CONNECT */
 struct hailo_soc_connect_params {
     uint8_t input_channel_index;    // out
@@ -552,12 +599,15 @@ struct tCompatibleHailoIoctlData
         struct hailo_desc_list_create_params DescListCreate;
         struct hailo_desc_list_release_params DescListReleaseParam;
         struct hailo_desc_list_program_params DescListProgram;
+        struct hailo_desc_list_program_batch_params DescListProgramBatch;
         struct hailo_d2h_notification D2HNotification;
         struct hailo_device_properties DeviceProperties;
         struct hailo_driver_info DriverInfo;
         struct hailo_read_log_params ReadLog;
         struct hailo_mark_as_in_use_params MarkAsInUse;
         struct hailo_vdma_launch_transfer_params LaunchTransfer;
+        struct hailo_vdma_launch_transfers_params LaunchTransfers;
+        struct hailo_vdma_interrupts_coalescing_params VdmaInterruptsCoalescing;
         struct hailo_soc_connect_params ConnectParams;
         struct hailo_soc_close_params SocCloseParams;
         struct hailo_pci_ep_accept_params AcceptParams;
@@ -598,6 +648,10 @@ enum hailo_vdma_ioctl_code {
     HAILO_VDMA_CONTINUOUS_BUFFER_ALLOC_CODE,
     HAILO_VDMA_CONTINUOUS_BUFFER_FREE_CODE,
     HAILO_VDMA_LAUNCH_TRANSFER_CODE,
+    HAILO_VDMA_LAUNCH_TRANSFERS_CODE,
+    HAILO_VDMA_INTERRUPTS_POLL_CODE,
+    HAILO_VDMA_SET_INTERRUPTS_COALESCING_CODE,
+    HAILO_DESC_LIST_PROGRAM_BATCH_CODE,
 
     // Must be last
     HAILO_VDMA_IOCTL_MAX_NR,
@@ -606,6 +660,8 @@ enum hailo_vdma_ioctl_code {
 #define HAILO_VDMA_ENABLE_CHANNELS            _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_ENABLE_CHANNELS_CODE,              struct hailo_vdma_enable_channels_params)
 #define HAILO_VDMA_DISABLE_CHANNELS           _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_DISABLE_CHANNELS_CODE,             struct hailo_vdma_disable_channels_params)
 #define HAILO_VDMA_INTERRUPTS_WAIT            _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_VDMA_INTERRUPTS_WAIT_CODE,              struct hailo_vdma_interrupts_wait_params)
+// Same as HAILO_VDMA_INTERRUPTS_WAIT, but never blocks - returns channels_count=0 if no interrupt is pending.
+#define HAILO_VDMA_INTERRUPTS_POLL            _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_VDMA_INTERRUPTS_POLL_CODE,              struct hailo_vdma_interrupts_wait_params)
 #define HAILO_VDMA_INTERRUPTS_READ_TIMESTAMPS _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_VDMA_INTERRUPTS_READ_TIMESTAMPS_CODE,   struct hailo_vdma_interrupts_read_timestamp_params)
 
 #define HAILO_VDMA_BUFFER_MAP                 _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_VDMA_BUFFER_MAP_CODE,                   struct hailo_vdma_buffer_map_params)
@@ -615,6 +671,7 @@ enum hailo_vdma_ioctl_code {
 #define HAILO_DESC_LIST_CREATE                _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_DESC_LIST_CREATE_CODE,                  struct hailo_desc_list_create_params)
 #define HAILO_DESC_LIST_RELEASE               _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_DESC_LIST_RELEASE_CODE,                 struct hailo_desc_list_release_params)
 #define HAILO_DESC_LIST_PROGRAM               _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_DESC_LIST_PROGRAM_CODE,                 struct hailo_desc_list_program_params)
+#define HAILO_DESC_LIST_PROGRAM_BATCH         _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_DESC_LIST_PROGRAM_BATCH_CODE,           struct hailo_desc_list_program_batch_params)
 
 #define HAILO_VDMA_LOW_MEMORY_BUFFER_ALLOC    _IOWR_(HAILO_VDMA_IOCTL_MAGIC, HAILO_VDMA_LOW_MEMORY_BUFFER_ALLOC_CODE,      struct hailo_allocate_low_memory_buffer_params)
 #define HAILO_VDMA_LOW_MEMORY_BUFFER_FREE     _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_LOW_MEMORY_BUFFER_FREE_CODE,       struct hailo_free_low_memory_buffer_params)
@@ -625,6 +682,8 @@ enum hailo_vdma_ioctl_code {
 #define HAILO_VDMA_CONTINUOUS_BUFFER_FREE     _IOR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_CONTINUOUS_BUFFER_FREE_CODE,       struct hailo_free_continuous_buffer_params)
 
 #define HAILO_VDMA_LAUNCH_TRANSFER           _IOWR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_LAUNCH_TRANSFER_CODE,              struct hailo_vdma_launch_transfer_params)
+#define HAILO_VDMA_LAUNCH_TRANSFERS          _IOWR_(HAILO_VDMA_IOCTL_MAGIC,  HAILO_VDMA_LAUNCH_TRANSFERS_CODE,             struct hailo_vdma_launch_transfers_params)
+#define HAILO_VDMA_SET_INTERRUPTS_COALESCING _IOR_(HAILO_VDMA_IOCTL_MAGIC,   HAILO_VDMA_SET_INTERRUPTS_COALESCING_CODE,    struct hailo_vdma_interrupts_coalescing_params)
 
 enum hailo_nnc_ioctl_code {
     HAILO_FW_CONTROL_CODE,
@@ -14,10 +14,19 @@
 #include "hrpc_protocol/serializer.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
 #include "hailort_service/service_resource_manager.hpp"
+#include "common/nms_frame_utils.hpp"
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 using namespace hailort;
 
 // TODO: These macros should be merged with the grpc macros, also change them to TRY
@@ -65,6 +74,9 @@ struct InferModelInfo
     std::unordered_map<std::string, size_t> output_streams_sizes;
     std::vector<std::string> inputs_names;
     std::vector<std::string> outputs_names;
+    // The NMS outputs sent compactly (see NmsFrameUtils), with their format and classes count - if the client
+    // supports it
+    std::unordered_map<std::string, std::pair<hailo_format_t, uint32_t>> compact_outputs;
 };
 
 void init_logger(const std::string &name)
@@ -75,8 +87,27 @@ void init_logger(const std::string &name)
     spdlog::set_default_logger(make_shared_nothrow<spdlog::logger>(name, console_sink));
 }
 
+// The configured models of the warm model pool are adopted by these params (the streams are ordered by their names)
+static std::string configure_params_key(const rpc_create_configured_infer_model_request_params_t &params)
+{
+    std::stringstream key;
+    key << params.batch_size << "," << static_cast<int>(params.power_mode) << "," << params.latency_flag;
+    for (const auto &streams_params : {&params.input_streams_params, &params.output_streams_params}) {
+        const std::map<std::string, rpc_stream_params_t> ordered_streams_params(streams_params->begin(), streams_params->end());
+        key << "|";
+        for (const auto &stream_params : ordered_streams_params) {
+            key << ";" << stream_params.first << ":" << stream_params.second.format_order << ","
+                << stream_params.second.format_type << "," << stream_params.second.nms_score_threshold << ","
+                << stream_params.second.nms_iou_threshold << "," << stream_params.second.nms_max_proposals_per_class << ","
+                << stream_params.second.nms_max_accumulated_mask_size;
+        }
+    }
+    return key.str();
+}
+
 void hrpc::HailoRTServer::cleanup_infer_model_hef_buffers(const std::vector<uint32_t> &infer_model_handles)
 {
+    std::lock_guard<std::mutex> lock(m_resources_mutex);
     for (const auto &infer_model_handle : infer_model_handles) {
         auto hef_buffers_iter = m_hef_buffers_per_infer_model.find(infer_model_handle);
         if (m_hef_buffers_per_infer_model.end() != hef_buffers_iter) {
@@ -87,6 +118,7 @@ void hrpc::HailoRTServer::cleanup_infer_model_hef_buffers(const std::vector<uint
 
 void hrpc::HailoRTServer::cleanup_cim_buffer_pools(const std::vector<uint32_t> &cim_handles)
 {
+    std::lock_guard<std::mutex> lock(m_resources_mutex);
     for (const auto &cim_handle : cim_handles) {
         auto buffer_pool_iter = m_buffer_pool_per_cim.find(cim_handle);
         if (m_buffer_pool_per_cim.end() != buffer_pool_iter) {
@@ -97,6 +129,12 @@ void hrpc::HailoRTServer::cleanup_cim_buffer_pools(const std::vector<uint32_t> &
 
 hailo_status hrpc::HailoRTServer::cleanup_client_resources(RpcConnection client_connection)
 {
+    if (nullptr != m_warm_model_pool) {
+        park_client_resources();
+        CHECK_SUCCESS(client_connection.close());
+        return HAILO_SUCCESS;
+    }
+
     std::set<uint32_t> pids = {SINGLE_CLIENT_PID};
     auto cim_handles = ServiceResourceManager<ConfiguredInferModel>::get_instance().resources_handles_by_pids(pids);
     (void)ServiceResourceManager<ConfiguredInferModel>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
@@ -106,17 +144,238 @@ hailo_status hrpc::HailoRTServer::cleanup_client_resources(RpcConnection client_
     (void)ServiceResourceManager<InferModelInfo>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
     (void)ServiceResourceManager<InferModel>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
     cleanup_infer_model_hef_buffers(infer_model_handles);
-    m_infer_model_to_info_id.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        m_infer_model_to_info_id.clear();
+    }
 
     (void)ServiceResourceManager<VDevice>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
     CHECK_SUCCESS(client_connection.close());
     return HAILO_SUCCESS;
 }
 
+void hrpc::HailoRTServer::park_client_resources()
+{
+    // By the client's resources hierarchy - the configured models are parked on their infer models, which are parked
+    // on their vdevices
+    std::set<uint32_t> pids = {SINGLE_CLIENT_PID};
+    for (const auto &cim_handle : ServiceResourceManager<ConfiguredInferModel>::get_instance().resources_handles_by_pids(pids)) {
+        release_configured_infer_model(cim_handle);
+    }
+
+    (void)ServiceResourceManager<InferModelInfo>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
+    for (const auto &infer_model_handle : ServiceResourceManager<InferModel>::get_instance().resources_handles_by_pids(pids)) {
+        release_infer_model(infer_model_handle);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        m_infer_model_to_info_id.clear();
+    }
+
+    for (const auto &vdevice_handle : ServiceResourceManager<VDevice>::get_instance().resources_handles_by_pids(pids)) {
+        release_vdevice(vdevice_handle);
+    }
+}
+
+Expected<std::shared_ptr<VDevice>> hrpc::HailoRTServer::create_vdevice(const hailo_vdevice_params_t &params)
+{
+    if (nullptr == m_warm_model_pool) {
+        TRY(auto vdevice, VDevice::create(params));
+        return std::shared_ptr<VDevice>(std::move(vdevice));
+    }
+
+    // Adopting releases the parked vdevices on a miss, so their devices can be opened here
+    const auto params_key = WarmModelPool::vdevice_params_key(params);
+    auto parked_vdevice = m_warm_model_pool->adopt_vdevice(params_key);
+    if (nullptr != parked_vdevice) {
+        return parked_vdevice;
+    }
+
+    TRY(auto created_vdevice, VDevice::create(params));
+    std::shared_ptr<VDevice> vdevice = std::move(created_vdevice);
+    if (WarmModelPool::is_poolable(params)) {
+        m_warm_model_pool->add_vdevice(params_key, vdevice);
+    }
+    return vdevice;
+}
+
+void hrpc::HailoRTServer::release_vdevice(uint32_t vdevice_handle)
+{
+    auto vdevice = ServiceResourceManager<VDevice>::get_instance().release_resource(vdevice_handle, SINGLE_CLIENT_PID);
+    if ((nullptr != m_warm_model_pool) && (nullptr != vdevice)) {
+        m_warm_model_pool->park_vdevice(vdevice.get());
+    }
+}
+
+// Because the infer model is created with a hef buffer, we need to keep the buffer until the configure stage.
+// Here I keep it until the infer model is destroyed (or with the infer model in the warm model pool)
+Expected<hrpc::infer_model_handle_t> hrpc::HailoRTServer::create_infer_model(std::shared_ptr<VDevice> vdevice,
+    Buffer &&hef_buffer)
+{
+    TRY(auto infer_model, vdevice->create_infer_model(MemoryView(hef_buffer)));
+
+    const bool is_pooled = (nullptr != m_warm_model_pool) && m_warm_model_pool->is_pooled(vdevice.get());
+    PooledInferModelInfo pooled_info{vdevice.get(), "", {}};
+    if (is_pooled) {
+        pooled_info.hef_hash = infer_model->hef().hash();
+        auto parked_model = m_warm_model_pool->adopt_infer_model(vdevice.get(), pooled_info.hef_hash);
+        if (parked_model) {
+            // The parked model (and its configured models) replaces the one created above
+            infer_model = parked_model->infer_model;
+            hef_buffer = std::move(parked_model->hef_buffer);
+            pooled_info.configured_models = std::move(parked_model->configured_models);
+        }
+    }
+
+    auto &infer_model_manager = ServiceResourceManager<InferModel>::get_instance();
+    auto infer_model_id = infer_model_manager.register_resource(SINGLE_CLIENT_PID, std::move(infer_model));
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        m_hef_buffers_per_infer_model.emplace(infer_model_id, std::move(hef_buffer));
+        if (is_pooled) {
+            m_pooled_infer_models.emplace(infer_model_id, std::move(pooled_info));
+        }
+    }
+    return infer_model_id;
+}
+
+void hrpc::HailoRTServer::release_infer_model(infer_model_handle_t infer_model_handle)
+{
+    Buffer hef_buffer;
+    PooledInferModelInfo pooled_info{nullptr, "", {}};
+    bool is_pooled = false;
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        auto hef_buffer_iter = m_hef_buffers_per_infer_model.find(infer_model_handle);
+        if (m_hef_buffers_per_infer_model.end() != hef_buffer_iter) {
+            hef_buffer = std::move(hef_buffer_iter->second);
+            m_hef_buffers_per_infer_model.erase(hef_buffer_iter);
+        }
+        auto pooled_info_iter = m_pooled_infer_models.find(infer_model_handle);
+        if (m_pooled_infer_models.end() != pooled_info_iter) {
+            pooled_info = std::move(pooled_info_iter->second);
+            m_pooled_infer_models.erase(pooled_info_iter);
+            is_pooled = true;
+        }
+    }
+
+    auto infer_model = ServiceResourceManager<InferModel>::get_instance().release_resource(infer_model_handle, SINGLE_CLIENT_PID);
+    if (!is_pooled || (nullptr == infer_model) || (0 == hef_buffer.size())) {
+        return;
+    }
+
+    PooledInferModel model;
+    model.infer_model = std::move(infer_model);
+    model.hef_buffer = std::move(hef_buffer);
+    model.configured_models = std::move(pooled_info.configured_models);
+    m_warm_model_pool->park_infer_model(pooled_info.vdevice, pooled_info.hef_hash, std::move(model));
+}
+
+std::shared_ptr<ConfiguredInferModel> hrpc::HailoRTServer::adopt_configured_infer_model(infer_model_handle_t infer_model_handle,
+    const std::string &params_key)
+{
+    std::lock_guard<std::mutex> lock(m_resources_mutex);
+    auto pooled_info_iter = m_pooled_infer_models.find(infer_model_handle);
+    if (m_pooled_infer_models.end() == pooled_info_iter) {
+        return nullptr;
+    }
+
+    auto &configured_models = pooled_info_iter->second.configured_models;
+    auto found = std::find_if(configured_models.begin(), configured_models.end(), [&params_key] (const PooledConfiguredModel &pooled) {
+        return pooled.params_key == params_key;
+    });
+    if (configured_models.end() == found) {
+        return nullptr;
+    }
+
+    auto configured_infer_model = std::move(found->configured_infer_model);
+    configured_models.erase(found);
+    LOGGER__INFO("Adopting a parked configured model, skipping its configuration");
+    return configured_infer_model;
+}
+
+void hrpc::HailoRTServer::add_configured_infer_model(uint32_t cim_handle, infer_model_handle_t infer_model_handle,
+    const std::string &params_key)
+{
+    std::lock_guard<std::mutex> lock(m_resources_mutex);
+    if (!contains(m_pooled_infer_models, infer_model_handle)) {
+        return;
+    }
+    m_pooled_configured_models[cim_handle] = PooledConfiguredModelInfo{infer_model_handle, params_key, true};
+}
+
+void hrpc::HailoRTServer::set_configured_infer_model_unpoolable(uint32_t cim_handle)
+{
+    std::lock_guard<std::mutex> lock(m_resources_mutex);
+    auto pooled_info_iter = m_pooled_configured_models.find(cim_handle);
+    if (m_pooled_configured_models.end() != pooled_info_iter) {
+        pooled_info_iter->second.is_poolable = false;
+    }
+}
+
+void hrpc::HailoRTServer::release_configured_infer_model(uint32_t cim_handle)
+{
+    auto &manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
+    PooledConfiguredModelInfo pooled_info{0, "", false};
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        m_buffer_pool_per_cim.erase(cim_handle);
+        auto pooled_info_iter = m_pooled_configured_models.find(cim_handle);
+        if (m_pooled_configured_models.end() != pooled_info_iter) {
+            pooled_info = std::move(pooled_info_iter->second);
+            m_pooled_configured_models.erase(pooled_info_iter);
+        }
+    }
+
+    if (!pooled_info.is_poolable) {
+        auto shutdown_lambda = [] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
+            configured_infer_model->shutdown();
+            return HAILO_SUCCESS;
+        };
+        manager.execute<hailo_status>(cim_handle, shutdown_lambda);
+        (void)manager.release_resource(cim_handle, SINGLE_CLIENT_PID);
+        return;
+    }
+
+    auto configured_infer_model = manager.release_resource(cim_handle, SINGLE_CLIENT_PID);
+    if (nullptr == configured_infer_model) {
+        return;
+    }
+
+    // The model is parked idle - its frames in flight are waited for (or canceled, if they don't complete in time)
+    auto status = HAILO_UNINITIALIZED;
+    auto async_queue_size = configured_infer_model->get_async_queue_size();
+    if (async_queue_size) {
+        status = configured_infer_model->wait_for_async_ready(std::chrono::milliseconds(HAILO_DEFAULT_VSTREAM_TIMEOUT_MS),
+            static_cast<uint32_t>(async_queue_size.value()));
+    }
+    if (HAILO_SUCCESS != status) {
+        status = configured_infer_model->recover();
+    }
+    if (HAILO_SUCCESS != status) {
+        LOGGER__WARNING("Failed to recover the configured model (status {}), it won't be parked", status);
+        configured_infer_model->shutdown();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_resources_mutex);
+        auto infer_model_info_iter = m_pooled_infer_models.find(pooled_info.infer_model_handle);
+        if (m_pooled_infer_models.end() != infer_model_info_iter) {
+            infer_model_info_iter->second.configured_models.emplace_back(
+                PooledConfiguredModel{std::move(pooled_info.params_key), std::move(configured_infer_model)});
+            return;
+        }
+    }
+    // The infer model was already released, so there's nothing to park the configured model on
+    configured_infer_model->shutdown();
+}
+
 Expected<std::unique_ptr<hrpc::HailoRTServer>> hrpc::HailoRTServer::create_unique()
 {
     TRY(auto connection_context, ConnectionContext::create_shared(true));
-    auto res = make_unique_nothrow<HailoRTServer>(connection_context);
+    TRY(auto warm_model_pool, WarmModelPool::create_unique());
+    auto res = make_unique_nothrow<HailoRTServer>(connection_context, std::move(warm_model_pool));
     CHECK_NOT_NULL(res, HAILO_OUT_OF_HOST_MEMORY);
     return res;
 }
@@ -131,30 +390,32 @@ int main()
     auto &infer_model_to_info_id = server->get_infer_model_to_info_id();
     auto &buffer_pool_per_cim = server->get_buffer_pool_per_cim();
 
-    // Because the infer model is created with a hef buffer, we need to keep the buffer until the configure stage.
-    // Here I keep it until the infer model is destroyed
-    auto &hef_buffers = server->get_hef_buffers();
+    auto &resources_mutex = server->get_resources_mutex();
 
     dispatcher.register_action(HailoRpcActionID::VDEVICE__CREATE,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
-        TRY_AS_HRPC_STATUS(auto vdevice_params, CreateVDeviceSerializer::deserialize_request(request), CreateVDeviceSerializer);
-        TRY_AS_HRPC_STATUS(auto vdevice, VDevice::create(vdevice_params), CreateVDeviceSerializer);
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
+        TRY_AS_HRPC_STATUS(auto tuple, CreateVDeviceSerializer::deserialize_request(request), CreateVDeviceSerializer);
+        auto vdevice_params = std::get<0>(tuple);
+        const auto supports_flat_messages = std::get<1>(tuple);
+        TRY_AS_HRPC_STATUS(auto vdevice, server->create_vdevice(vdevice_params), CreateVDeviceSerializer);
 
         auto &manager = ServiceResourceManager<VDevice>::get_instance();
         auto id = manager.register_resource(SINGLE_CLIENT_PID, std::move(vdevice));
-        auto reply = CreateVDeviceSerializer::serialize_reply(HAILO_SUCCESS, id);
+        // The client sends its hot requests in the flat format only once it reads the reply, and the callbacks follow
+        // its requests - so the callbacks are sent in the flat format only once the client accepts it
+        server_context->connection().set_flat_messages_enabled(supports_flat_messages);
+        auto reply = CreateVDeviceSerializer::serialize_reply(HAILO_SUCCESS, id, supports_flat_messages);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::VDEVICE__DESTROY,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
-        auto &manager = ServiceResourceManager<VDevice>::get_instance();
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         TRY_AS_HRPC_STATUS(auto vdevice_handle, DestroyVDeviceSerializer::deserialize_request(request), DestroyVDeviceSerializer);
-        (void)manager.release_resource(vdevice_handle, SINGLE_CLIENT_PID);
+        server->release_vdevice(vdevice_handle);
         TRY_AS_HRPC_STATUS(auto reply, DestroyVDeviceSerializer::serialize_reply(HAILO_SUCCESS), DestroyVDeviceSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::VDEVICE__CREATE_INFER_MODEL,
-    [&hef_buffers] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
         TRY_AS_HRPC_STATUS(auto tuple, CreateInferModelSerializer::deserialize_request(request), CreateInferModelSerializer);
         auto vdevice_handle = std::get<0>(tuple);
         uint64_t hef_size = std::get<1>(tuple);
@@ -166,30 +427,24 @@ int main()
         CHECK_SUCCESS_AS_HRPC_STATUS(status, CreateInferModelSerializer);
 
         auto &vdevice_manager = ServiceResourceManager<VDevice>::get_instance();
-        auto lambda = [view = MemoryView(hef_buffer)] (std::shared_ptr<VDevice> vdevice) {
-            return vdevice->create_infer_model(view);
+        auto lambda = [&server, &hef_buffer] (std::shared_ptr<VDevice> vdevice) {
+            return server->create_infer_model(vdevice, std::move(hef_buffer));
         };
-        auto infer_model = vdevice_manager.execute<Expected<std::shared_ptr<InferModel>>>(vdevice_handle, lambda);
-        CHECK_EXPECTED_AS_HRPC_STATUS(infer_model, CreateInferModelSerializer);
+        auto infer_model_id = vdevice_manager.execute<Expected<hrpc::infer_model_handle_t>>(vdevice_handle, lambda);
+        CHECK_EXPECTED_AS_HRPC_STATUS(infer_model_id, CreateInferModelSerializer);
 
-        auto &infer_model_manager = ServiceResourceManager<InferModel>::get_instance();
-        auto infer_model_id = infer_model_manager.register_resource(SINGLE_CLIENT_PID, std::move(infer_model.release()));
-        hef_buffers.emplace(infer_model_id, std::move(hef_buffer));
-
-        TRY_AS_HRPC_STATUS(auto reply, CreateInferModelSerializer::serialize_reply(HAILO_SUCCESS, infer_model_id), CreateInferModelSerializer);
+        TRY_AS_HRPC_STATUS(auto reply, CreateInferModelSerializer::serialize_reply(HAILO_SUCCESS, infer_model_id.value()), CreateInferModelSerializer);
         return reply;
-    });
+    }, hrpc::ActionThread::CONNECTION); // Reads the hef from the connection
     dispatcher.register_action(HailoRpcActionID::INFER_MODEL__DESTROY,
-    [&hef_buffers] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
-        auto &manager = ServiceResourceManager<InferModel>::get_instance();
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         TRY_AS_HRPC_STATUS(auto infer_model_handle, DestroyInferModelSerializer::deserialize_request(request), DestroyInferModelSerializer);
-        hef_buffers.erase(infer_model_handle);
-        (void)manager.release_resource(infer_model_handle, SINGLE_CLIENT_PID);
+        server->release_infer_model(infer_model_handle);
         TRY_AS_HRPC_STATUS(auto reply, DestroyInferModelSerializer::serialize_reply(HAILO_SUCCESS), DestroyInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::INFER_MODEL__CREATE_CONFIGURED_INFER_MODEL,
-    [&buffer_pool_per_cim, &infer_model_to_info_id]
+    [&server, &buffer_pool_per_cim, &infer_model_to_info_id, &resources_mutex]
     (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &infer_model_manager = ServiceResourceManager<InferModel>::get_instance();
 
@@ -197,7 +452,9 @@ int main()
         const auto &infer_model_handle = request_params.infer_model_handle;
         const auto &vdevice_handle = request_params.vdevice_handle;
 
-        auto lambda = [&request_params] (std::shared_ptr<InferModel> infer_model) -> Expected<ConfiguredInferModel> {
+        // The params are set on the infer model for an adopted configured model as well, as the streams' info is
+        // taken from the infer model
+        auto set_params_lambda = [&request_params] (std::shared_ptr<InferModel> infer_model) -> hailo_status {
             const auto &input_streams_formats = request_params.input_streams_params;
             const auto &output_streams_formats = request_params.output_streams_params;
             for (const auto &input_stream_format : input_streams_formats) {
@@ -241,14 +498,25 @@ int main()
             infer_model->set_power_mode(request_params.power_mode);
             infer_model->set_hw_latency_measurement_flags(request_params.latency_flag);
 
-            return infer_model->configure();
+            return HAILO_SUCCESS;
         };
-
-        auto configured_infer_model = infer_model_manager.execute<Expected<ConfiguredInferModel>>(infer_model_handle, lambda);
-        CHECK_EXPECTED_AS_HRPC_STATUS(configured_infer_model, CreateConfiguredInferModelSerializer);
+        auto status = infer_model_manager.execute<hailo_status>(infer_model_handle, set_params_lambda);
+        CHECK_SUCCESS_AS_HRPC_STATUS(status, CreateConfiguredInferModelSerializer);
+
+        const auto params_key = configure_params_key(request_params);
+        auto configured_infer_model = server->adopt_configured_infer_model(infer_model_handle, params_key);
+        if (nullptr == configured_infer_model) {
+            auto configure_lambda = [] (std::shared_ptr<InferModel> infer_model) {
+                return infer_model->configure();
+            };
+            auto configured = infer_model_manager.execute<Expected<ConfiguredInferModel>>(infer_model_handle, configure_lambda);
+            CHECK_EXPECTED_AS_HRPC_STATUS(configured, CreateConfiguredInferModelSerializer);
+            configured_infer_model = make_shared_nothrow<ConfiguredInferModel>(configured.release());
+        }
 
         TRY_AS_HRPC_STATUS(auto async_queue_size, configured_infer_model->get_async_queue_size(), CreateConfiguredInferModelSerializer);
-        auto set_model_info_lambda = [] (std::shared_ptr<InferModel> infer_model) -> Expected<std::shared_ptr<InferModelInfo>> {
+        const auto supports_compact_nms_outputs = request_params.supports_compact_nms_outputs;
+        auto set_model_info_lambda = [supports_compact_nms_outputs] (std::shared_ptr<InferModel> infer_model) -> Expected<std::shared_ptr<InferModelInfo>> {
             auto infer_model_info = make_shared_nothrow<InferModelInfo>();
             CHECK_NOT_NULL_AS_EXPECTED(infer_model_info, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -259,6 +527,11 @@ int main()
             for (const auto &output : infer_model->outputs()) {
                 infer_model_info->output_streams_sizes.emplace(output.name(), output.get_frame_size());
                 infer_model_info->outputs_names.push_back(output.name());
+                if (supports_compact_nms_outputs && output.is_nms() && NmsFrameUtils::is_compactable(output.format())) {
+                    TRY(auto nms_shape, output.get_nms_shape());
+                    infer_model_info->compact_outputs.emplace(output.name(),
+                        std::make_pair(output.format(), nms_shape.number_of_classes));
+                }
             }
             return infer_model_info;
         };
@@ -269,8 +542,8 @@ int main()
         auto infer_model_info_id = infer_model_infos_manager.register_resource(SINGLE_CLIENT_PID, std::move(model_info.release()));
 
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
-        auto cim_id = cim_manager.register_resource(SINGLE_CLIENT_PID,
-            std::move(make_shared_nothrow<ConfiguredInferModel>(configured_infer_model.release())));
+        auto cim_id = cim_manager.register_resource(SINGLE_CLIENT_PID, configured_infer_model);
+        server->add_configured_infer_model(cim_id, infer_model_handle, params_key);
 
         auto buffer_pool = ServiceNetworkGroupBufferPool::create(vdevice_handle);
         CHECK_EXPECTED_AS_HRPC_STATUS(buffer_pool, CreateConfiguredInferModelSerializer);
@@ -292,31 +565,30 @@ int main()
                 infer_model_info->output_streams_sizes[output_name], BUFFER_POOL_SIZE);
             CHECK_SUCCESS_AS_HRPC_STATUS(status, CreateConfiguredInferModelSerializer);
         }
-        buffer_pool_per_cim.emplace(cim_id, buffer_pool_ptr);
-
-        infer_model_to_info_id[infer_model_handle] = infer_model_info_id;
+        {
+            std::lock_guard<std::mutex> lock(resources_mutex);
+            buffer_pool_per_cim.emplace(cim_id, buffer_pool_ptr);
+            infer_model_to_info_id[infer_model_handle] = infer_model_info_id;
+        }
+        std::vector<std::string> compact_outputs;
+        for (const auto &compact_output : infer_model_info->compact_outputs) {
+            compact_outputs.push_back(compact_output.first);
+        }
         TRY_AS_HRPC_STATUS(auto reply,
-            CreateConfiguredInferModelSerializer::serialize_reply(HAILO_SUCCESS, cim_id, static_cast<uint32_t>(async_queue_size)),
+            CreateConfiguredInferModelSerializer::serialize_reply(HAILO_SUCCESS, cim_id, static_cast<uint32_t>(async_queue_size),
+                compact_outputs),
             CreateConfiguredInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__DESTROY,
-    [&buffer_pool_per_cim] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
-        auto &manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         TRY_AS_HRPC_STATUS(auto configured_infer_model_handle, DestroyConfiguredInferModelSerializer::deserialize_request(request), DestroyInferModelSerializer);
-
-        auto shutdown_lambda = [] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
-            configured_infer_model->shutdown();
-            return HAILO_SUCCESS;
-        };
-        manager.execute<hailo_status>(configured_infer_model_handle, shutdown_lambda);
-        buffer_pool_per_cim.erase(configured_infer_model_handle);
-        (void)manager.release_resource(configured_infer_model_handle, SINGLE_CLIENT_PID);
+        server->release_configured_infer_model(configured_infer_model_handle);
         TRY_AS_HRPC_STATUS(auto reply, DestroyConfiguredInferModelSerializer::serialize_reply(HAILO_SUCCESS), DestroyInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_TIMEOUT,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         TRY_AS_HRPC_STATUS(auto tuple, SetSchedulerTimeoutSerializer::deserialize_request(request), SetSchedulerTimeoutSerializer);
         const auto &configured_infer_model_handle = std::get<0>(tuple);
@@ -325,12 +597,13 @@ int main()
             return configured_infer_model->set_scheduler_timeout(timeout);
         };
         auto status = cim_manager.execute<hailo_status>(configured_infer_model_handle, lambda);
+        server->set_configured_infer_model_unpoolable(configured_infer_model_handle);
         TRY_AS_HRPC_STATUS(auto reply, SetSchedulerTimeoutSerializer::serialize_reply(status), SetSchedulerTimeoutSerializer);
 
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_THRESHOLD,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         TRY_AS_HRPC_STATUS(auto tuple, SetSchedulerThresholdSerializer::deserialize_request(request), SetSchedulerThresholdSerializer);
         const auto &configured_infer_model_handle = std::get<0>(tuple);
@@ -339,12 +612,13 @@ int main()
             return configured_infer_model->set_scheduler_threshold(threshold);
         };
         auto status = cim_manager.execute<hailo_status>(configured_infer_model_handle, lambda);
+        server->set_configured_infer_model_unpoolable(configured_infer_model_handle);
         TRY_AS_HRPC_STATUS(auto reply, SetSchedulerThresholdSerializer::serialize_reply(status), SetSchedulerThresholdSerializer);
 
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_PRIORITY,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         TRY_AS_HRPC_STATUS(auto tuple, SetSchedulerPrioritySerializer::deserialize_request(request), SetSchedulerPrioritySerializer);
         const auto &configured_infer_model_handle = std::get<0>(tuple);
@@ -353,6 +627,7 @@ int main()
             return configured_infer_model->set_scheduler_priority(static_cast<uint8_t>(priority));
         };
         auto status = cim_manager.execute<hailo_status>(configured_infer_model_handle, lambda);
+        server->set_configured_infer_model_unpoolable(configured_infer_model_handle);
         TRY_AS_HRPC_STATUS(auto reply, SetSchedulerPrioritySerializer::serialize_reply(status), SetSchedulerPrioritySerializer);
 
         return reply;
@@ -412,7 +687,7 @@ int main()
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__SHUTDOWN,
-    [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&server] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
 
         auto configured_infer_model_handle = ShutdownSerializer::deserialize_request(request);
@@ -423,12 +698,13 @@ int main()
         };
 
         auto status = cim_manager.execute<hailo_status>(configured_infer_model_handle.value(), lambda);
+        server->set_configured_infer_model_unpoolable(configured_infer_model_handle.value());
         TRY_AS_HRPC_STATUS(auto reply, ShutdownSerializer::serialize_reply(status), ShutdownSerializer);
 
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
-    [&infer_model_to_info_id, &buffer_pool_per_cim]
+    [&infer_model_to_info_id, &buffer_pool_per_cim, &resources_mutex]
     (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         auto bindings_lambda = [] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
@@ -438,95 +714,208 @@ int main()
         auto configured_infer_model_handle = std::get<0>(request_tuple);
         auto infer_model_handle = std::get<1>(request_tuple);
         auto callback_id = std::get<2>(request_tuple);
-
-        auto bindings = cim_manager.execute<Expected<ConfiguredInferModel::Bindings>>(configured_infer_model_handle, bindings_lambda);
-        CHECK_EXPECTED_AS_HRPC_STATUS(bindings, RunAsyncSerializer);
+        auto frames_count = std::get<3>(request_tuple);
+        auto dma_buffer_edges = std::get<4>(request_tuple);
+
+        uint32_t infer_model_info_id = 0;
+        std::shared_ptr<ServiceNetworkGroupBufferPool> buffer_pool = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(resources_mutex);
+            infer_model_info_id = infer_model_to_info_id[infer_model_handle];
+            auto buffer_pool_iter = buffer_pool_per_cim.find(configured_infer_model_handle);
+            if (buffer_pool_per_cim.end() != buffer_pool_iter) {
+                buffer_pool = buffer_pool_iter->second;
+            }
+        }
+        if (nullptr == buffer_pool) {
+            CHECK_SUCCESS_AS_HRPC_STATUS(HAILO_NOT_FOUND, RunAsyncSerializer);
+        }
 
         auto infer_model_info_lambda = [] (std::shared_ptr<InferModelInfo> infer_model_info) {
             return *infer_model_info;
         };
         auto &infer_model_infos_manager = ServiceResourceManager<InferModelInfo>::get_instance();
-        auto infer_model_info = infer_model_infos_manager.execute<Expected<InferModelInfo>>(infer_model_to_info_id[infer_model_handle],
+        auto infer_model_info = infer_model_infos_manager.execute<Expected<InferModelInfo>>(infer_model_info_id,
             infer_model_info_lambda);
         CHECK_EXPECTED_AS_HRPC_STATUS(infer_model_info, RunAsyncSerializer);
 
-        std::vector<BufferPtr> inputs; // TODO: add infer vector pool
-        inputs.reserve(infer_model_info->inputs_names.size());
-        for (const auto &input_name : infer_model_info->inputs_names) {
-            TRY_AS_HRPC_STATUS(auto input, bindings->input(input_name), RunAsyncSerializer);
+        const auto edges_per_frame = infer_model_info->inputs_names.size() + infer_model_info->outputs_names.size();
+        if (!dma_buffer_edges.empty() && (dma_buffer_edges.size() != (frames_count * edges_per_frame))) {
+            LOGGER__ERROR("Got {} dma buffer edges, expected {}", dma_buffer_edges.size(), frames_count * edges_per_frame);
+            CHECK_SUCCESS_AS_HRPC_STATUS(HAILO_INVALID_ARGUMENT, RunAsyncSerializer);
+        }
+        if (!dma_buffer_edges.empty() && !server_context->connection().is_fd_passing_supported()) {
+            LOGGER__ERROR("dma buffers can't be passed over this connection");
+            CHECK_SUCCESS_AS_HRPC_STATUS(HAILO_NOT_SUPPORTED, RunAsyncSerializer);
+        }
+        auto is_dma_buffer_edge = [&dma_buffer_edges, edges_per_frame] (uint32_t frame_index, size_t edge_index) {
+            return !dma_buffer_edges.empty() && dma_buffer_edges[(frame_index * edges_per_frame) + edge_index];
+        };
 
-            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool_per_cim[configured_infer_model_handle]->acquire_buffer(input_name),
-                RunAsyncSerializer);
+        // The frames of the request are completed together, by a single callback message sent once all of them are done.
+        struct RunAsyncFrames {
+            std::mutex mutex;
+            uint32_t frames_left;
+            hailo_status status;
+            // The buffers acquired from the pool (edges bound to dmabufs don't use them), by their edge's name
+            std::vector<std::pair<std::string, BufferPtr>> inputs; // TODO: add infer vector pool
+            std::vector<std::pair<std::string, BufferPtr>> outputs; // TODO: add infer vector pool
+            // The dmabufs' fds received from the client, closed once the frames are done
+            std::vector<int> dma_buffer_fds;
+        };
+        auto frames = make_shared_nothrow<RunAsyncFrames>();
+        if (nullptr == frames) {
+            CHECK_SUCCESS_AS_HRPC_STATUS(HAILO_OUT_OF_HOST_MEMORY, RunAsyncSerializer);
+        }
+        frames->frames_left = frames_count;
+        frames->status = HAILO_SUCCESS;
+        frames->inputs.reserve(frames_count * infer_model_info->inputs_names.size());
+        frames->outputs.reserve(frames_count * infer_model_info->outputs_names.size());
+
+        auto return_buffers_to_pool = [frames, buffer_pool] () {
+#ifndef _WIN32 // fds are passed only over unix sockets
+            for (auto fd : frames->dma_buffer_fds) {
+                ::close(fd);
+            }
+#endif
+            frames->dma_buffer_fds.clear();
 
-            auto status = server_context->connection().read_buffer(MemoryView(*buffer_ptr));
-            CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+            for (const auto &input : frames->inputs) {
+                auto status = buffer_pool->return_to_pool(input.first, input.second);
+                if (status != HAILO_SUCCESS) {
+                    LOGGER__CRITICAL("return_to_pool failed for input {}, status = {}. Server should restart!", input.first, status);
+                    return;
+                }
+            }
+            for (const auto &output : frames->outputs) {
+                auto status = buffer_pool->return_to_pool(output.first, output.second);
+                if (status != HAILO_SUCCESS) {
+                    LOGGER__CRITICAL("return_to_pool failed for output {}, status = {}. Server should restart!", output.first, status);
+                    return;
+                }
+            }
+        };
 
-            inputs.emplace_back(buffer_ptr);
-            status = input.set_buffer(MemoryView(*buffer_ptr));
-            CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
-        }
+        // Marks done_frames_count frames as done, and once all the frames are done - triggers their callback
+        auto frames_done = [frames, callback_id, frames_count, server_context, return_buffers_to_pool,
+            compact_outputs = infer_model_info->compact_outputs]
+            (uint32_t done_frames_count, hailo_status frames_status) {
+            {
+                std::unique_lock<std::mutex> lock(frames->mutex);
+                if ((HAILO_SUCCESS == frames->status) && (HAILO_SUCCESS != frames_status)) {
+                    frames->status = frames_status;
+                }
+                frames->frames_left -= done_frames_count;
+                if (0 != frames->frames_left) {
+                    return;
+                }
+            }
 
-        std::vector<BufferPtr> outputs; // TODO: add infer vector pool
-        outputs.reserve(infer_model_info->outputs_names.size());
-        for (const auto &output_name : infer_model_info->outputs_names) {
-            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool_per_cim[configured_infer_model_handle]->acquire_buffer(output_name),
-                RunAsyncSerializer);
+            const auto callback_status = frames->status;
+            auto status = server_context->trigger_callback(callback_id, callback_status,
+                [frames, callback_status, &compact_outputs] (hrpc::RpcConnection connection) -> hailo_status {
+                if (HAILO_SUCCESS == callback_status) {
+                    for (const auto &output : frames->outputs) {
+                        auto compact_output = compact_outputs.find(output.first);
+                        if (compact_outputs.end() == compact_output) {
+                            auto status = connection.write_buffer(MemoryView(*output.second));
+                            CHECK_SUCCESS(status);
+                            continue;
+                        }
 
-            auto output = bindings->output(output_name);
-            CHECK_EXPECTED_AS_HRPC_STATUS(output, RunAsyncSerializer);
+                        // Only the valid bytes of the NMS frame are sent, preceded by their size
+                        const auto valid_size = NmsFrameUtils::get_valid_size(MemoryView(*output.second),
+                            compact_output->second.first, compact_output->second.second);
+                        uint32_t valid_size_header = static_cast<uint32_t>(valid_size);
+                        auto status = connection.write_buffer(MemoryView(&valid_size_header, sizeof(valid_size_header)));
+                        CHECK_SUCCESS(status);
+                        status = connection.write_buffer(MemoryView(output.second->data(), valid_size));
+                        CHECK_SUCCESS(status);
+                    }
+                }
+                return HAILO_SUCCESS;
+            }, frames_count);
 
-            auto status = output->set_buffer(MemoryView(buffer_ptr->data(), buffer_ptr->size()));
-            CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+            // HAILO_COMMUNICATION_CLOSED means the client disconnected. Server doesn't need to restart in this case.
+            if ((status != HAILO_SUCCESS) && (status != HAILO_COMMUNICATION_CLOSED)) {
+                LOGGER__CRITICAL("Error {} returned from connection.write(). Server Should restart!", status);
+            }
 
-            outputs.emplace_back(buffer_ptr);
-        }
+            return_buffers_to_pool();
+        };
 
-        auto infer_lambda =
-            [bindings = bindings.release(), callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle,
-                infer_model_info]
-            (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
-                return configured_infer_model->run_async(bindings,
-                    [callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle, infer_model_info]
-                        (const AsyncInferCompletionInfo &completion_info) {
-                    auto status = server_context->trigger_callback(callback_id, completion_info.status, [outputs, completion_info] (hrpc::RpcConnection connection) -> hailo_status {
-                        if (HAILO_SUCCESS == completion_info.status) {
-                            for (auto output : outputs) {
-                                auto status = connection.write_buffer(MemoryView(*output));
-                                CHECK_SUCCESS(status);
-                            }
-                        }
-                        return HAILO_SUCCESS;
-                    });
+        // Each frame is launched once its inputs are read. If a frame fails, it and the frames after it are done (the callback
+        // is sent once the launched frames are done). If no frame was launched, no callback is sent at all.
+        auto run_frame = [&] (uint32_t frame_index) -> hailo_status {
+            TRY(auto bindings, cim_manager.execute<Expected<ConfiguredInferModel::Bindings>>(configured_infer_model_handle, bindings_lambda));
+
+            size_t edge_index = 0;
+            for (const auto &input_name : infer_model_info->inputs_names) {
+                TRY(auto input, bindings.input(input_name));
+                if (is_dma_buffer_edge(frame_index, edge_index++)) {
+                    TRY(auto fd, server_context->connection().read_fd());
+                    frames->dma_buffer_fds.emplace_back(fd);
+
+                    auto status = input.set_dma_buffer(hailo_dma_buffer_t{fd, infer_model_info->input_streams_sizes.at(input_name)});
+                    CHECK_SUCCESS(status);
+                    continue;
+                }
 
-                    // HAILO_COMMUNICATION_CLOSED means the client disconnected. Server doesn't need to restart in this case.
-                    if ((status != HAILO_SUCCESS) && (status != HAILO_COMMUNICATION_CLOSED)) {
-                        LOGGER__CRITICAL("Error {} returned from connection.write(). Server Should restart!", status);
-                    }
+                TRY(auto buffer_ptr, buffer_pool->acquire_buffer(input_name));
+                frames->inputs.emplace_back(input_name, buffer_ptr);
 
-                    for (uint32_t i = 0; i < inputs.size(); i++) {
-                        status = buffer_pool_per_cim[configured_infer_model_handle]->return_to_pool(infer_model_info->inputs_names[i], inputs[i]);
-                        if (status != HAILO_SUCCESS) {
-                            LOGGER__CRITICAL("return_to_pool failed for input {}, status = {}. Server should restart!", infer_model_info->inputs_names[i], status);
-                            return;
-                        }
-                    }
-                    for (uint32_t i = 0; i < outputs.size(); i++) {
-                        status = buffer_pool_per_cim[configured_infer_model_handle]->return_to_pool(infer_model_info->outputs_names[i], outputs[i]);
-                        if (status != HAILO_SUCCESS) {
-                            LOGGER__CRITICAL("return_to_pool failed for output {}, status = {}. Server should restart!", infer_model_info->outputs_names[i], status);
-                            return;
-                        }
-                    }
+                auto status = server_context->connection().read_buffer(MemoryView(*buffer_ptr));
+                CHECK_SUCCESS(status);
+
+                status = input.set_buffer(MemoryView(*buffer_ptr));
+                CHECK_SUCCESS(status);
+            }
+
+            for (const auto &output_name : infer_model_info->outputs_names) {
+                TRY(auto output, bindings.output(output_name));
+                if (is_dma_buffer_edge(frame_index, edge_index++)) {
+                    TRY(auto fd, server_context->connection().read_fd());
+                    frames->dma_buffer_fds.emplace_back(fd);
+
+                    auto status = output.set_dma_buffer(hailo_dma_buffer_t{fd, infer_model_info->output_streams_sizes.at(output_name)});
+                    CHECK_SUCCESS(status);
+                    continue;
+                }
+
+                TRY(auto buffer_ptr, buffer_pool->acquire_buffer(output_name));
+                frames->outputs.emplace_back(output_name, buffer_ptr);
+
+                auto status = output.set_buffer(MemoryView(buffer_ptr->data(), buffer_ptr->size()));
+                CHECK_SUCCESS(status);
+            }
+
+            auto infer_lambda = [bindings, frames_done] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
+                return configured_infer_model->run_async(bindings,
+                    [frames_done] (const AsyncInferCompletionInfo &completion_info) {
+                    frames_done(1, completion_info.status);
                 });
             };
-        auto job = cim_manager.execute<Expected<AsyncInferJob>>(configured_infer_model_handle, infer_lambda);
-        CHECK_EXPECTED_AS_HRPC_STATUS(job, RunAsyncSerializer);
+            TRY(auto job, cim_manager.execute<Expected<AsyncInferJob>>(configured_infer_model_handle, infer_lambda));
+            job.detach();
+
+            return HAILO_SUCCESS;
+        };
 
-        job->detach();
+        for (uint32_t frame_index = 0; frame_index < frames_count; frame_index++) {
+            auto status = run_frame(frame_index);
+            if (HAILO_SUCCESS != status) {
+                if (0 == frame_index) {
+                    return_buffers_to_pool();
+                } else {
+                    frames_done(frames_count - frame_index, status);
+                }
+                CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+            }
+        }
 
         TRY_AS_HRPC_STATUS(auto reply, RunAsyncSerializer::serialize_reply(HAILO_SUCCESS), RunAsyncSerializer);
         return reply;
-    });
+    }, hrpc::ActionThread::CONNECTION); // Reads the inputs from the connection
 
     server->set_dispatcher(dispatcher);
     auto status = server->serve();
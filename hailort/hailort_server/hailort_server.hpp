@@ -12,6 +12,7 @@
 
 #include "hrpc/server.hpp"
 #include "hailort_service/cng_buffer_pool.hpp"
+#include "warm_model_pool.hpp"
 
 namespace hrpc
 {
@@ -22,17 +23,56 @@ class Server;
 class HailoRTServer : public Server {
 public:
     static Expected<std::unique_ptr<HailoRTServer>> create_unique();
-    explicit HailoRTServer(std::shared_ptr<ConnectionContext> connection_context) : Server(connection_context) {};
+    HailoRTServer(std::shared_ptr<ConnectionContext> connection_context, std::unique_ptr<WarmModelPool> &&warm_model_pool) :
+        Server(connection_context), m_warm_model_pool(std::move(warm_model_pool)) {};
 
     std::unordered_map<uint32_t, uint32_t> &get_infer_model_to_info_id() { return m_infer_model_to_info_id; };
     std::unordered_map<uint32_t, std::shared_ptr<ServiceNetworkGroupBufferPool>> &get_buffer_pool_per_cim() { return m_buffer_pool_per_cim; };
     std::unordered_map<infer_model_handle_t, Buffer> &get_hef_buffers() { return m_hef_buffers_per_infer_model; };
+    // Guards the maps above, as the actions run on several threads
+    std::mutex &get_resources_mutex() { return m_resources_mutex; };
+
+    // The following functions go through the warm model pool, if it's enabled (see warm_model_pool.hpp)
+    Expected<std::shared_ptr<VDevice>> create_vdevice(const hailo_vdevice_params_t &params);
+    void release_vdevice(uint32_t vdevice_handle);
+    Expected<infer_model_handle_t> create_infer_model(std::shared_ptr<VDevice> vdevice, Buffer &&hef_buffer);
+    void release_infer_model(infer_model_handle_t infer_model_handle);
+    // Returns a parked configured model of the infer model, configured with the same params - or nullptr
+    std::shared_ptr<ConfiguredInferModel> adopt_configured_infer_model(infer_model_handle_t infer_model_handle,
+        const std::string &params_key);
+    void add_configured_infer_model(uint32_t cim_handle, infer_model_handle_t infer_model_handle,
+        const std::string &params_key);
+    // The client changed the model's state (e.g. its scheduler params, or shut it down), so it won't be parked
+    void set_configured_infer_model_unpoolable(uint32_t cim_handle);
+    void release_configured_infer_model(uint32_t cim_handle);
 
 private:
+    struct PooledInferModelInfo
+    {
+        const VDevice *vdevice;
+        std::string hef_hash;
+        // The parked configured models of the infer model (the ones its client destroyed, or the ones adopted with
+        // the infer model that weren't configured again)
+        std::vector<PooledConfiguredModel> configured_models;
+    };
+    struct PooledConfiguredModelInfo
+    {
+        infer_model_handle_t infer_model_handle;
+        std::string params_key;
+        bool is_poolable;
+    };
+
+    // Releases the client's resources to the warm model pool
+    void park_client_resources();
 
     std::unordered_map<uint32_t, uint32_t> m_infer_model_to_info_id;
     std::unordered_map<uint32_t, std::shared_ptr<ServiceNetworkGroupBufferPool>> m_buffer_pool_per_cim;
     std::unordered_map<infer_model_handle_t, Buffer> m_hef_buffers_per_infer_model;
+    std::mutex m_resources_mutex;
+    std::unique_ptr<WarmModelPool> m_warm_model_pool;
+    // Guarded by the resources mutex (used only if the warm model pool is enabled)
+    std::unordered_map<infer_model_handle_t, PooledInferModelInfo> m_pooled_infer_models;
+    std::unordered_map<uint32_t, PooledConfiguredModelInfo> m_pooled_configured_models;
     virtual hailo_status cleanup_client_resources(RpcConnection client_connection) override;
     void cleanup_cim_buffer_pools(const std::vector<uint32_t> &cim_handles);
     void cleanup_infer_model_hef_buffers(const std::vector<uint32_t> &infer_model_handles);
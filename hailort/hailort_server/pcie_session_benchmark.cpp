@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file pcie_session_benchmark.cpp
+ * @brief Measures the bandwidth and latency of a PcieSession, with or without the streaming mode.
+ *
+ * Runs on both sides of the session with the same arguments - "server" on the device (the pci endpoint) and "client"
+ * on the host, which prints the results:
+ *  unidirectional - The client writes the messages, and the server acks once it read all of them.
+ *  ping-pong      - The client writes each message and reads it back from the server (the latency is the round trip).
+ **/
+
+#include "vdma/pcie_session.hpp"
+#include "vdma/driver/hailort_driver.hpp"
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+
+using namespace hailort;
+
+// Note: The driver doesn't choose sessions by port yet, so the benchmark can't run alongside hailort_server
+#define BENCHMARK_PCIE_PORT (1213355092)
+#define BENCHMARK_ACK_SIZE (8)
+
+static const std::chrono::milliseconds BENCHMARK_TIMEOUT(10000);
+
+struct BenchmarkParams {
+    bool is_server = false;
+    bool is_ping_pong = false;
+    size_t message_size = 4096;
+    size_t iterations = 1000;
+    PcieSessionStreamingParams streaming_params{};
+};
+
+static void print_usage()
+{
+    std::cout << "Usage: pcie_session_benchmark <server|client> [--mode unidirectional|ping-pong] [--size BYTES]"
+        " [--iterations COUNT] [--streaming-message-size BYTES] [--credits COUNT]" << std::endl <<
+        "Both sides must be run with the same arguments." << std::endl;
+}
+
+static Expected<BenchmarkParams> parse_args(int argc, char **argv)
+{
+    CHECK_AS_EXPECTED(argc >= 2, HAILO_INVALID_ARGUMENT);
+    BenchmarkParams params;
+    const std::string role = argv[1];
+    CHECK_AS_EXPECTED(("server" == role) || ("client" == role), HAILO_INVALID_ARGUMENT, "Invalid role {}", role);
+    params.is_server = ("server" == role);
+
+    params.streaming_params.credits_count = 16;
+    for (int i = 2; i < argc; i += 2) {
+        const std::string arg = argv[i];
+        CHECK_AS_EXPECTED((i + 1) < argc, HAILO_INVALID_ARGUMENT, "Missing value of {}", arg);
+        const std::string value = argv[i + 1];
+        if ("--mode" == arg) {
+            CHECK_AS_EXPECTED(("unidirectional" == value) || ("ping-pong" == value), HAILO_INVALID_ARGUMENT,
+                "Invalid mode {}", value);
+            params.is_ping_pong = ("ping-pong" == value);
+        } else if ("--size" == arg) {
+            params.message_size = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else if ("--iterations" == arg) {
+            params.iterations = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else if ("--streaming-message-size" == arg) {
+            params.streaming_params.message_size = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else if ("--credits" == arg) {
+            params.streaming_params.credits_count = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else {
+            LOGGER__ERROR("Unknown argument {}", arg);
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
+        }
+    }
+
+    CHECK_AS_EXPECTED((0 < params.message_size) && (0 < params.iterations), HAILO_INVALID_ARGUMENT,
+        "Size and iterations must be positive");
+    if (0 == params.streaming_params.message_size) {
+        // Without the streaming mode, the transfers are of the user buffers
+        CHECK_AS_EXPECTED((0 == (params.message_size % 8)) && (params.message_size <= PcieSession::max_transfer_size()),
+            HAILO_INVALID_ARGUMENT, "Size must be a multiple of 8, up to {}", PcieSession::max_transfer_size());
+    }
+    return params;
+}
+
+static Expected<PcieSession> create_session(const BenchmarkParams &params)
+{
+    if (params.is_server) {
+        TRY(auto driver, HailoRTDriver::create_pcie_ep());
+        return PcieSession::accept(std::move(driver), BENCHMARK_PCIE_PORT, params.streaming_params);
+    }
+
+    TRY(auto device_infos, HailoRTDriver::scan_devices());
+    for (auto &device_info : device_infos) {
+        if (HailoRTDriver::AcceleratorType::SOC_ACCELERATOR == device_info.accelerator_type) {
+            TRY(auto driver, HailoRTDriver::create(device_info.device_id, device_info.dev_path));
+            return PcieSession::connect(std::move(driver), BENCHMARK_PCIE_PORT, params.streaming_params);
+        }
+    }
+
+    LOGGER__ERROR("No suitable device found");
+    return make_unexpected(HAILO_NOT_FOUND);
+}
+
+static hailo_status run_server(PcieSession &session, const BenchmarkParams &params, Buffer &buffer, Buffer &ack)
+{
+    for (size_t i = 0; i < params.iterations; i++) {
+        CHECK_SUCCESS(session.read(buffer.data(), buffer.size(), BENCHMARK_TIMEOUT));
+        if (params.is_ping_pong) {
+            CHECK_SUCCESS(session.write(buffer.data(), buffer.size(), BENCHMARK_TIMEOUT));
+        }
+    }
+
+    if (!params.is_ping_pong) {
+        CHECK_SUCCESS(session.write(ack.data(), ack.size(), BENCHMARK_TIMEOUT));
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status run_client(PcieSession &session, const BenchmarkParams &params, Buffer &buffer, Buffer &ack)
+{
+    using duration_us = std::chrono::duration<double, std::micro>;
+    double min_latency_us = std::numeric_limits<double>::max();
+    double max_latency_us = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < params.iterations; i++) {
+        const auto iteration_start = std::chrono::steady_clock::now();
+        CHECK_SUCCESS(session.write(buffer.data(), buffer.size(), BENCHMARK_TIMEOUT));
+        if (params.is_ping_pong) {
+            CHECK_SUCCESS(session.read(buffer.data(), buffer.size(), BENCHMARK_TIMEOUT));
+            const auto latency_us = duration_us(std::chrono::steady_clock::now() - iteration_start).count();
+            min_latency_us = std::min(min_latency_us, latency_us);
+            max_latency_us = std::max(max_latency_us, latency_us);
+        }
+    }
+    if (!params.is_ping_pong) {
+        CHECK_SUCCESS(session.read(ack.data(), ack.size(), BENCHMARK_TIMEOUT));
+    }
+    const auto elapsed_us = duration_us(std::chrono::steady_clock::now() - start).count();
+
+    // In ping-pong mode, each message crosses the link twice
+    const auto transferred_bytes = static_cast<double>(params.message_size * params.iterations *
+        (params.is_ping_pong ? 2 : 1));
+    std::cout << (params.is_ping_pong ? "ping-pong" : "unidirectional") << ", " << params.message_size << " bytes x " <<
+        params.iterations << ", streaming " << (session.is_streaming() ? "on" : "off") << std::endl;
+    std::cout << "  Bandwidth: " << (transferred_bytes * 8 / elapsed_us) << " Mbps" << std::endl;
+    if (params.is_ping_pong) {
+        std::cout << "  Latency (round trip): avg " << (elapsed_us / static_cast<double>(params.iterations)) <<
+            " us, min " << min_latency_us << " us, max " << max_latency_us << " us" << std::endl;
+    } else {
+        std::cout << "  Time per message: " << (elapsed_us / static_cast<double>(params.iterations)) << " us" << std::endl;
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status run(int argc, char **argv)
+{
+    auto params = parse_args(argc, argv);
+    if (!params) {
+        print_usage();
+        return params.status();
+    }
+
+    TRY(auto session, create_session(params.value()));
+    // Page aligned, as the transfers without the streaming mode are of these buffers
+    TRY(auto buffer, Buffer::create(params->message_size, 0, BufferStorageParams::create_dma()));
+    TRY(auto ack, Buffer::create(BENCHMARK_ACK_SIZE, 0, BufferStorageParams::create_dma()));
+
+    auto status = params->is_server ? run_server(session, params.value(), buffer, ack) :
+        run_client(session, params.value(), buffer, ack);
+    auto close_status = session.close();
+    CHECK_SUCCESS(status);
+    return close_status;
+}
+
+int main(int argc, char **argv)
+{
+    const auto status = run(argc, argv);
+    return (HAILO_SUCCESS == status) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file warm_model_pool.cpp
+ * @brief Implementation of the warm model pool
+ **/
+
+#include "warm_model_pool.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace hrpc
+{
+
+Expected<std::unique_ptr<WarmModelPool>> WarmModelPool::create_unique()
+{
+    auto timeout_env_var = get_env_variable(HAILORT_SERVER_WARM_POOL_TIMEOUT_S_ENV_VAR);
+    if (!timeout_env_var) {
+        return std::unique_ptr<WarmModelPool>(nullptr);
+    }
+
+    const auto timeout_s = std::stoul(timeout_env_var.value());
+    CHECK_AS_EXPECTED(timeout_s > 0, HAILO_INVALID_ARGUMENT, "{} must be larger than 0",
+        HAILORT_SERVER_WARM_POOL_TIMEOUT_S_ENV_VAR);
+
+    auto pool = make_unique_nothrow<WarmModelPool>(std::chrono::seconds(timeout_s));
+    CHECK_NOT_NULL_AS_EXPECTED(pool, HAILO_OUT_OF_HOST_MEMORY);
+    LOGGER__INFO("Warm model pool is enabled, the models of departed clients are kept for {}s", timeout_s);
+    return pool;
+}
+
+WarmModelPool::WarmModelPool(std::chrono::seconds parking_timeout) :
+    m_parking_timeout(parking_timeout),
+    m_is_running(true),
+    m_expiration_thread([this] { expiration_thread_main(); })
+{}
+
+WarmModelPool::~WarmModelPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_running = false;
+    }
+    m_cv.notify_all();
+    if (m_expiration_thread.joinable()) {
+        m_expiration_thread.join();
+    }
+}
+
+bool WarmModelPool::is_poolable(const hailo_vdevice_params_t &params)
+{
+    return HAILO_SCHEDULING_ALGORITHM_NONE != params.scheduling_algorithm;
+}
+
+std::string WarmModelPool::vdevice_params_key(const hailo_vdevice_params_t &params)
+{
+    std::stringstream key;
+    key << params.device_count << "," << static_cast<int>(params.scheduling_algorithm) << ","
+        << ((nullptr == params.group_id) ? "" : params.group_id);
+    return key.str();
+}
+
+std::shared_ptr<VDevice> WarmModelPool::adopt_vdevice(const std::string &params_key)
+{
+    std::vector<PooledVDevice> released_vdevices;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = std::find_if(m_vdevices.begin(), m_vdevices.end(), [&params_key] (const PooledVDevice &pooled) {
+            return pooled.is_parked && (pooled.params_key == params_key);
+        });
+        if (m_vdevices.end() != found) {
+            found->is_parked = false;
+            LOGGER__INFO("Adopting a parked vdevice ({} parked models)", found->models.size());
+            return found->vdevice;
+        }
+
+        auto parked_end = std::stable_partition(m_vdevices.begin(), m_vdevices.end(), [] (const PooledVDevice &pooled) {
+            return pooled.is_parked;
+        });
+        std::move(m_vdevices.begin(), parked_end, std::back_inserter(released_vdevices));
+        m_vdevices.erase(m_vdevices.begin(), parked_end);
+    }
+
+    // The parked vdevices are released outside the lock. The vdevices the expiration thread releases are waited for as
+    // well, so the caller can open the devices once this returns.
+    std::lock_guard<std::mutex> release_lock(m_release_mutex);
+    if (!released_vdevices.empty()) {
+        LOGGER__INFO("Releasing {} parked vdevices, created with other params", released_vdevices.size());
+        released_vdevices.clear();
+    }
+    return nullptr;
+}
+
+void WarmModelPool::add_vdevice(const std::string &params_key, std::shared_ptr<VDevice> vdevice)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PooledVDevice pooled;
+    pooled.params_key = params_key;
+    pooled.vdevice = std::move(vdevice);
+    pooled.is_parked = false;
+    m_vdevices.emplace_back(std::move(pooled));
+}
+
+void WarmModelPool::park_vdevice(const VDevice *vdevice)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = std::find_if(m_vdevices.begin(), m_vdevices.end(), [vdevice] (const PooledVDevice &pooled) {
+            return pooled.vdevice.get() == vdevice;
+        });
+        if (m_vdevices.end() == found) {
+            return;
+        }
+        found->is_parked = true;
+        found->parking_time = std::chrono::steady_clock::now();
+        LOGGER__INFO("Parking a vdevice with {} models", found->models.size());
+    }
+    m_cv.notify_all();
+}
+
+bool WarmModelPool::is_pooled(const VDevice *vdevice)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::any_of(m_vdevices.begin(), m_vdevices.end(), [vdevice] (const PooledVDevice &pooled) {
+        return pooled.vdevice.get() == vdevice;
+    });
+}
+
+void WarmModelPool::park_infer_model(const VDevice *vdevice, const std::string &hef_hash, PooledInferModel &&model)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = std::find_if(m_vdevices.begin(), m_vdevices.end(), [vdevice] (const PooledVDevice &pooled) {
+        return pooled.vdevice.get() == vdevice;
+    });
+    if (m_vdevices.end() == found) {
+        return;
+    }
+    found->models.emplace_back(hef_hash, std::move(model));
+}
+
+Expected<PooledInferModel> WarmModelPool::adopt_infer_model(const VDevice *vdevice, const std::string &hef_hash)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = std::find_if(m_vdevices.begin(), m_vdevices.end(), [vdevice] (const PooledVDevice &pooled) {
+        return pooled.vdevice.get() == vdevice;
+    });
+    if (m_vdevices.end() == found) {
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    auto &models = found->models;
+    auto model = std::find_if(models.begin(), models.end(), [&hef_hash] (const std::pair<std::string, PooledInferModel> &pooled) {
+        return pooled.first == hef_hash;
+    });
+    if (models.end() == model) {
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    auto res = std::move(model->second);
+    models.erase(model);
+    LOGGER__INFO("Adopting a parked infer model ({} configured models)", res.configured_models.size());
+    return res;
+}
+
+void WarmModelPool::expiration_thread_main()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_is_running) {
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<PooledVDevice> expired_vdevices;
+        auto next_expiration = std::chrono::steady_clock::time_point::max();
+        for (auto it = m_vdevices.begin(); it != m_vdevices.end();) {
+            if (!it->is_parked) {
+                it++;
+                continue;
+            }
+            const auto expiration = it->parking_time + m_parking_timeout;
+            if (expiration <= now) {
+                expired_vdevices.emplace_back(std::move(*it));
+                it = m_vdevices.erase(it);
+            } else {
+                next_expiration = std::min(next_expiration, expiration);
+                it++;
+            }
+        }
+
+        if (!expired_vdevices.empty()) {
+            // Releasing the models and the vdevices takes a while, the pool isn't blocked meanwhile
+            std::unique_lock<std::mutex> release_lock(m_release_mutex);
+            lock.unlock();
+            LOGGER__INFO("Releasing {} parked vdevices (their clients didn't reconnect)", expired_vdevices.size());
+            expired_vdevices.clear();
+            release_lock.unlock();
+            lock.lock();
+            continue;
+        }
+
+        if (std::chrono::steady_clock::time_point::max() == next_expiration) {
+            m_cv.wait(lock);
+        } else {
+            m_cv.wait_until(lock, next_expiration);
+        }
+    }
+
+    // The remaining vdevices are released by the pool's destructor
+}
+
+} // namespace hrpc
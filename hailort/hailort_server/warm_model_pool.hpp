@@ -0,0 +1,113 @@
+#ifndef HAILORT_WARM_MODEL_POOL_HPP_
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file warm_model_pool.hpp
+ * @brief Keeps the vdevice and the configured models of a departed client for a while, so a reconnecting client gets
+ *        them without configuring them again
+ **/
+
+#define HAILORT_WARM_MODEL_POOL_HPP_
+
+#include "hailo/vdevice.hpp"
+#include "hailo/infer_model.hpp"
+#include "hailo/buffer.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <vector>
+
+using namespace hailort;
+
+// The seconds a departed client's vdevice (with its models) is kept for a reconnecting client. The pool is disabled
+// if unset.
+#define HAILORT_SERVER_WARM_POOL_TIMEOUT_S_ENV_VAR ("HAILORT_SERVER_WARM_POOL_TIMEOUT_S")
+
+namespace hrpc
+{
+
+struct PooledConfiguredModel
+{
+    // The params the model was configured with (the same params configure the same model)
+    std::string params_key;
+    std::shared_ptr<ConfiguredInferModel> configured_infer_model;
+};
+
+struct PooledInferModel
+{
+    std::shared_ptr<InferModel> infer_model;
+    // The infer model was created from this buffer, it's kept for configuring the model with other params
+    Buffer hef_buffer;
+    // Destroyed before the infer model (declared after it)
+    std::vector<PooledConfiguredModel> configured_models;
+};
+
+// A vdevice is added to the pool once it's created, and parked once its client destroys it (or disconnects). The infer
+// models are parked on their vdevice - keyed by their HEF's hash - with the configured models the client destroyed.
+// A client creating a vdevice with the same params adopts the parked vdevice, and then its infer models and configured
+// models, by their HEF and configure params.
+// A VDevice keeps its configured network groups until it's destroyed, so keeping a model configured doesn't hold any
+// device resources beyond the ones its vdevice already holds.
+// The pool is thread safe.
+class WarmModelPool final
+{
+public:
+    // Returns nullptr if the pool is disabled (see HAILORT_SERVER_WARM_POOL_TIMEOUT_S_ENV_VAR)
+    static Expected<std::unique_ptr<WarmModelPool>> create_unique();
+
+    explicit WarmModelPool(std::chrono::seconds parking_timeout);
+    ~WarmModelPool();
+
+    WarmModelPool(const WarmModelPool &) = delete;
+    WarmModelPool &operator=(const WarmModelPool &) = delete;
+
+    // Only the vdevices of the model scheduler are pooled - the configured models are switched by the scheduler, so
+    // the client of a pooled model doesn't depend on the activation state its previous client left
+    static bool is_poolable(const hailo_vdevice_params_t &params);
+    static std::string vdevice_params_key(const hailo_vdevice_params_t &params);
+
+    // Returns a parked vdevice created with the same params, or nullptr. On a miss, the parked vdevices are released -
+    // their devices can't be opened by another vdevice.
+    std::shared_ptr<VDevice> adopt_vdevice(const std::string &params_key);
+    void add_vdevice(const std::string &params_key, std::shared_ptr<VDevice> vdevice);
+    // The vdevice was destroyed by its client - it's kept with its models for the parking timeout (and released by the
+    // pool afterwards)
+    void park_vdevice(const VDevice *vdevice);
+    // Whether the vdevice was added to the pool (and its models may be parked)
+    bool is_pooled(const VDevice *vdevice);
+
+    void park_infer_model(const VDevice *vdevice, const std::string &hef_hash, PooledInferModel &&model);
+    // Returns HAILO_NOT_FOUND if no infer model of the HEF is parked on the vdevice
+    Expected<PooledInferModel> adopt_infer_model(const VDevice *vdevice, const std::string &hef_hash);
+
+private:
+    struct PooledVDevice
+    {
+        std::string params_key;
+        std::shared_ptr<VDevice> vdevice;
+        bool is_parked;
+        std::chrono::steady_clock::time_point parking_time;
+        // (HEF hash, model). Destroyed before the vdevice (declared after it).
+        std::vector<std::pair<std::string, PooledInferModel>> models;
+    };
+
+    void expiration_thread_main();
+
+    const std::chrono::seconds m_parking_timeout;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // Held while releasing vdevices outside m_mutex (locked after m_mutex, if both are locked)
+    std::mutex m_release_mutex;
+    bool m_is_running;
+    std::vector<PooledVDevice> m_vdevices;
+    std::thread m_expiration_thread;
+};
+
+} // namespace hrpc
+
+#endif // HAILORT_WARM_MODEL_POOL_HPP_
@@ -14,6 +14,8 @@
 
 #include "common/utils.hpp"
 #include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+#include "common/nms_frame_utils.hpp"
 
 #include "hailort_rpc_service.hpp"
 #include "cng_buffer_pool.hpp"
@@ -28,17 +30,61 @@
 #include "net_flow/ops_metadata/yolov5_seg_op_metadata.hpp"
 
 #include "hef/layer_info.hpp"
+#include "utils/profiler/tracer_macros.hpp"
+#include "vdevice/scheduler/scheduler_client_utils.hpp"
 
+#include <sstream>
 #include <thread>
 
 
 #define MAX_GRPC_BUFFER_SIZE (2ULL * 1024 * 1024 * 1024) // 2GB
+// Bounds of the callbacks batched in a single reply to the callbacks listener
+#define MAX_CALLBACKS_PER_REPLY (64)
+#define MAX_CALLBACKS_DATA_SIZE_PER_REPLY (16 * 1024 * 1024) // 16MB
+// If set, the device time of the scheduled networks is accounted per client process, and the clients share the devices
+// fairly - a client with frames to run isn't starved by a greedy one. The value is a comma separated list of
+// "<process name or pid>:<quota percent>" pairs, e.g. "detector:60,*:20" - a client gets at most its quota of the device
+// time while others have frames to run ("*" matches the clients not listed; clients without a quota share the rest).
+#define HAILO_SERVICE_CLIENT_QUOTAS_ENV_VAR ("HAILO_SERVICE_CLIENT_QUOTAS")
 namespace hailort
 {
 
-HailoRtRpcService::HailoRtRpcService()
-    : ProtoHailoRtRpc::Service()
+static Expected<std::map<std::string, uint32_t>> parse_client_quotas(const std::string &client_quotas)
 {
+    std::map<std::string, uint32_t> quotas;
+    std::istringstream client_quotas_stream(client_quotas);
+    std::string client_quota;
+    while (std::getline(client_quotas_stream, client_quota, ',')) {
+        if (client_quota.empty()) {
+            continue;
+        }
+        const auto separator_pos = client_quota.rfind(':');
+        CHECK_AS_EXPECTED((std::string::npos != separator_pos) && (0 != separator_pos), HAILO_INVALID_ARGUMENT,
+            "Invalid client quota '{}', expected '<process name or pid>:<quota percent>'", client_quota);
+        TRY(const auto quota_percent, StringUtils::to_uint32(client_quota.substr(separator_pos + 1), 10),
+            "Invalid quota of client '{}'", client_quota);
+        CHECK_AS_EXPECTED(quota_percent <= 100, HAILO_INVALID_ARGUMENT, "Invalid quota of client '{}'", client_quota);
+        quotas[client_quota.substr(0, separator_pos)] = quota_percent;
+    }
+    return quotas;
+}
+
+HailoRtRpcService::HailoRtRpcService()
+    : ProtoHailoRtRpc::Service(),
+    m_is_client_accounting_enabled(false)
+{
+    auto client_quotas_env_var = get_env_variable(HAILO_SERVICE_CLIENT_QUOTAS_ENV_VAR);
+    if (client_quotas_env_var) {
+        auto client_quotas = parse_client_quotas(client_quotas_env_var.value());
+        if (client_quotas) {
+            m_client_quotas = client_quotas.release();
+            m_is_client_accounting_enabled = true;
+        } else {
+            LOGGER__ERROR("Invalid {} value '{}', the device time isn't accounted per client",
+                HAILO_SERVICE_CLIENT_QUOTAS_ENV_VAR, client_quotas_env_var.value());
+        }
+    }
+
     m_keep_alive = make_unique_nothrow<std::thread>([this] () {
         this->keep_alive();
     });
@@ -96,33 +142,41 @@ void HailoRtRpcService::abort_vstreams_by_pids(std::set<uint32_t> &pids)
 
 void HailoRtRpcService::remove_disconnected_clients()
 {
-    std::this_thread::sleep_for(hailort::HAILO_KEEPALIVE_INTERVAL / 2);
     auto now = std::chrono::high_resolution_clock::now();
     std::set<uint32_t> pids_to_remove;
     {
+        // Only finding the disconnected clients under the lock, so the keep-alives of the other clients aren't blocked by the cleanup
         std::unique_lock<std::mutex> lock(m_keep_alive_mutex);
-        for (auto pid_to_last_alive : m_clients_pids) {
-            auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - pid_to_last_alive.second);
+        for (auto iter = m_clients_pids.begin(); iter != m_clients_pids.end(); ) {
+            auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - iter->second);
             if (duration > hailort::HAILO_KEEPALIVE_INTERVAL) {
-                auto client_pid = pid_to_last_alive.first;
-                pids_to_remove.insert(client_pid);
+                pids_to_remove.insert(iter->first);
+                iter = m_clients_pids.erase(iter);
+            } else {
+                ++iter;
             }
         }
+    }
+    if (pids_to_remove.empty()) {
+        return;
+    }
 
+    // Releasing client by client, each resource type is locked only while its own resources of the client are released
+    std::unique_lock<std::mutex> cleanup_lock(m_clients_cleanup_mutex);
+    for (auto client_pid : pids_to_remove) {
         // We abort vstreams before releasing them to avoid cases where the vstream is stuck in execute of a
         // blocking operation (which will be finished with timeout).
         // To release the vstream the ServiceResourceManager is waiting for the resource_mutex which is also locked in execute.
-        abort_vstreams_by_pids(pids_to_remove);
-        for (auto &client_pid : pids_to_remove) {
-            ServiceResourceManager<OutputVStream>::get_instance().release_by_pid(client_pid);
-            ServiceResourceManager<InputVStream>::get_instance().release_by_pid(client_pid);
-            ServiceResourceManager<ConfiguredNetworkGroup>::get_instance().release_by_pid(client_pid);
-            ServiceResourceManager<VDevice>::get_instance().release_by_pid(client_pid);
-
-            LOGGER__INFO("Client disconnected, pid: {}", client_pid);
-            HAILORT_OS_LOG_INFO("Client disconnected, pid: {}", client_pid);
-            m_clients_pids.erase(client_pid);
-        }
+        std::set<uint32_t> client_pids = {client_pid};
+        abort_vstreams_by_pids(client_pids);
+        ServiceResourceManager<OutputVStream>::get_instance().release_by_pid(client_pid);
+        ServiceResourceManager<InputVStream>::get_instance().release_by_pid(client_pid);
+        ServiceResourceManager<ConfiguredNetworkGroup>::get_instance().release_by_pid(client_pid);
+        ServiceResourceManager<VDevice>::get_instance().release_by_pid(client_pid);
+        release_shared_memory_by_pid(client_pid);
+
+        LOGGER__INFO("Client disconnected, pid: {}", client_pid);
+        HAILORT_OS_LOG_INFO("Client disconnected, pid: {}", client_pid);
     }
 }
 
@@ -130,6 +184,7 @@ void HailoRtRpcService::remove_disconnected_clients()
 void HailoRtRpcService::keep_alive()
 {
     while (true) {
+        std::this_thread::sleep_for(hailort::HAILO_KEEPALIVE_INTERVAL / 2);
         remove_disconnected_clients();
     }
 }
@@ -285,6 +340,7 @@ grpc::Status HailoRtRpcService::VDevice_configure(grpc::ServerContext*, const VD
 
     auto &networks_manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
     for (auto network : networks.value()) {
+        set_scheduler_client(*network, request->pid());
         auto ng_handle = networks_manager.register_resource(request->pid(), network);
         reply->add_networks_handles(ng_handle);
 
@@ -304,6 +360,35 @@ grpc::Status HailoRtRpcService::VDevice_configure(grpc::ServerContext*, const VD
     return grpc::Status::OK;
 }
 
+uint32_t HailoRtRpcService::get_client_quota_percent(uint32_t pid)
+{
+    auto quota = m_client_quotas.find(std::to_string(pid));
+    if (m_client_quotas.end() == quota) {
+        auto process_name = OsUtils::get_process_name(pid);
+        quota = process_name ? m_client_quotas.find(process_name.value()) : m_client_quotas.end();
+    }
+    if (m_client_quotas.end() == quota) {
+        quota = m_client_quotas.find("*");
+    }
+    return (m_client_quotas.end() == quota) ? 0 : quota->second;
+}
+
+void HailoRtRpcService::set_scheduler_client(ConfiguredNetworkGroup &network_group, uint32_t pid)
+{
+    if (!m_is_client_accounting_enabled || !network_group.is_scheduled()) {
+        return;
+    }
+
+    const auto quota_percent = get_client_quota_percent(pid);
+    auto status = SchedulerClientUtils::set_network_group_client(network_group, pid, quota_percent);
+    if (HAILO_SUCCESS != status) {
+        // The network runs anyway, without being accounted to the client
+        LOGGER__WARNING("Failed accounting network group {} to client {}, status {}", network_group.name(), pid, status);
+        return;
+    }
+    LOGGER__INFO("Network group {} is accounted to client {} (quota {}%)", network_group.name(), pid, quota_percent);
+}
+
 hailo_status HailoRtRpcService::create_buffer_pools_for_ng(uint32_t vdevice_handle, uint32_t ng_handle, uint32_t request_pid,
     bool allocate_for_raw_streams)
 {
@@ -364,12 +449,59 @@ grpc::Status HailoRtRpcService::VDevice_get_default_streams_interface(grpc::Serv
     return grpc::Status::OK;
 }
 
+void HailoRtRpcService::get_callback_ids(uint32_t vdevice_handle, uint32_t max_callbacks_count,
+    VDevice_get_callback_id_Reply *reply)
+{
+    max_callbacks_count = std::min<uint32_t>(max_callbacks_count, MAX_CALLBACKS_PER_REPLY);
+    auto lambda = [max_callbacks_count](std::shared_ptr<VDeviceCallbacksQueue> cb_queue) {
+        return cb_queue->dequeue_all(max_callbacks_count, MAX_CALLBACKS_DATA_SIZE_PER_REPLY);
+    };
+
+    auto &cb_queue_manager = ServiceResourceManager<VDeviceCallbacksQueue>::get_instance();
+    auto cb_ids = cb_queue_manager.execute<Expected<std::vector<ProtoCallbackIdentifier>>>(vdevice_handle, lambda);
+    if (cb_ids.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
+        reply->set_status(static_cast<uint32_t>(HAILO_SHUTDOWN_EVENT_SIGNALED));
+        return;
+    }
+    if (!cb_ids) {
+        LOGGER__ERROR("Failed to get callbacks with status={}", cb_ids.status());
+        reply->set_status(static_cast<uint32_t>(cb_ids.status()));
+        return;
+    }
+
+    for (auto &cb_id : cb_ids.value()) {
+        *reply->add_callback_ids() = std::move(cb_id);
+    }
+    reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+}
+
+grpc::Status HailoRtRpcService::VDevice_get_callback_ids_stream(grpc::ServerContext *context,
+    const VDevice_get_callback_id_Request *request, grpc::ServerWriter<VDevice_get_callback_id_Reply> *writer)
+{
+    const uint32_t max_callbacks_count = (0 == request->max_callbacks_count()) ?
+        MAX_CALLBACKS_PER_REPLY : request->max_callbacks_count();
+    while (!context->IsCancelled()) {
+        VDevice_get_callback_id_Reply reply;
+        get_callback_ids(request->identifier().vdevice_handle(), max_callbacks_count, &reply);
+        if (!writer->Write(reply)) {
+            break; // The client is gone
+        }
+        if (HAILO_SUCCESS != reply.status()) {
+            break; // Shutdown (or failure) ends the stream
+        }
+    }
+    return grpc::Status::OK;
+}
+
 grpc::Status HailoRtRpcService::VDevice_get_callback_id(grpc::ServerContext*,
     const VDevice_get_callback_id_Request* request, VDevice_get_callback_id_Reply* reply)
 {
+    if (0 != request->max_callbacks_count()) {
+        get_callback_ids(request->identifier().vdevice_handle(), request->max_callbacks_count(), reply);
+        return grpc::Status::OK;
+    }
+
     auto lambda = [](std::shared_ptr<VDeviceCallbacksQueue> cb_queue) {
-        // TODO: HRT-12360 - Add a `dequeue_all` function that returns all the cb_ids currently in the queue.
-        // (Need to think on the shutdown case)
         return cb_queue->dequeue();
     };
 
@@ -415,7 +547,8 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_dup_handle(grpc::ServerCo
 }
 
 ProtoCallbackIdentifier serialize_callback_identifier(uint32_t vdevice_handle, uint32_t ng_handle,
-    callback_type_t cb_type, const std::string &stream_name, uint32_t cb_idx,  hailo_status status, BufferPtr buffer = nullptr)
+    callback_type_t cb_type, const std::string &stream_name, uint32_t cb_idx,  hailo_status status, BufferPtr buffer = nullptr,
+    uint64_t trace_id = 0)
 {
     ProtoCallbackIdentifier cb_identifier;
     cb_identifier.set_vdevice_handle(vdevice_handle);
@@ -427,6 +560,8 @@ ProtoCallbackIdentifier serialize_callback_identifier(uint32_t vdevice_handle, u
     if (buffer != nullptr) {
         cb_identifier.set_data(buffer->data(), buffer->size());
     }
+    cb_identifier.set_trace_id(trace_id);
+    cb_identifier.set_service_enqueue_time_ns(get_frame_trace_time_ns());
 
     return cb_identifier;
 }
@@ -584,15 +719,29 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_infer_async(grpc::ServerC
     auto vdevice_handle = request->identifier().vdevice_handle();
     auto ng_handle = request->identifier().network_group_handle();
     auto infer_request_done_cb_idx = request->infer_request_done_cb_idx();
+    const auto trace_id = request->trace_id();
+    const auto handler_start_time_ns = get_frame_trace_time_ns();
+    if (0 != request->client_send_time_ns()) {
+        TRACE(ServiceFrameStageTrace, trace_id, "rpc_transport", handler_start_time_ns - request->client_send_time_ns());
+    }
 
     // Prepare buffers
     auto named_buffers_callbacks = prepare_named_buffers_callbacks(vdevice_handle, ng_handle, request);
     CHECK_EXPECTED_AS_RPC_STATUS(named_buffers_callbacks, reply);
+    const auto prepare_end_time_ns = get_frame_trace_time_ns();
+    TRACE(ServiceFrameStageTrace, trace_id, "service_prepare", prepare_end_time_ns - handler_start_time_ns);
+
+    // Set once infer_async returns - the time until the callback is the time the frame waited for the scheduler and the
+    // device (which are split by the frame's scheduler traces, that carry the same trace id)
+    auto enqueue_end_time_ns = make_shared_nothrow<std::atomic<uint64_t>>(prepare_end_time_ns);
+    CHECK_AS_RPC_STATUS(nullptr != enqueue_end_time_ns, reply, HAILO_OUT_OF_HOST_MEMORY);
 
     // Prepare request finish callback
-    auto infer_request_done_cb = [this, vdevice_handle, ng_handle, infer_request_done_cb_idx](hailo_status status) {
+    auto infer_request_done_cb = [this, vdevice_handle, ng_handle, infer_request_done_cb_idx, trace_id,
+        enqueue_end_time_ns](hailo_status status) {
+        TRACE(ServiceFrameStageTrace, trace_id, "device", get_frame_trace_time_ns() - enqueue_end_time_ns->load());
         auto cb_identifier = serialize_callback_identifier(vdevice_handle, ng_handle, CALLBACK_TYPE_INFER_REQUEST,
-            "", infer_request_done_cb_idx, status);
+            "", infer_request_done_cb_idx, status, nullptr, trace_id);
         enqueue_cb_identifier(vdevice_handle, std::move(cb_identifier));
     };
 
@@ -603,7 +752,14 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_infer_async(grpc::ServerC
     };
 
     auto &manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
-    auto status = manager.execute(request->identifier().network_group_handle(), lambda, named_buffers_callbacks.release(), infer_request_done_cb);
+    hailo_status status = HAILO_UNINITIALIZED;
+    {
+        FrameTraceIdScope trace_id_scope(trace_id);
+        status = manager.execute(request->identifier().network_group_handle(), lambda, named_buffers_callbacks.release(), infer_request_done_cb);
+    }
+    const auto infer_enqueue_end_time_ns = get_frame_trace_time_ns();
+    enqueue_end_time_ns->store(infer_enqueue_end_time_ns);
+    TRACE(ServiceFrameStageTrace, trace_id, "infer_enqueue", infer_enqueue_end_time_ns - prepare_end_time_ns);
     if (HAILO_STREAM_ABORT == status) {
         LOGGER__INFO("User aborted inference");
         reply->set_status(static_cast<uint32_t>(HAILO_STREAM_ABORT));
@@ -1337,6 +1493,7 @@ grpc::Status HailoRtRpcService::InputVStream_release(grpc::ServerContext *, cons
     auto vstream_handle = request->vstream_identifier().vstream_handle();
     auto &manager = ServiceResourceManager<InputVStream>::get_instance();
     manager.release_resource(vstream_handle, request->pid());
+    release_vstream_shared_memory(request->pid(), true, vstream_handle);
     reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
     return grpc::Status::OK;
 }
@@ -1403,6 +1560,7 @@ grpc::Status HailoRtRpcService::OutputVStream_release(grpc::ServerContext *, con
     auto vstream_handle = request->vstream_identifier().vstream_handle();
     auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
     manager.release_resource(vstream_handle, request->pid());
+    release_vstream_shared_memory(request->pid(), false, vstream_handle);
     reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
     return grpc::Status::OK;
 }
@@ -1443,6 +1601,14 @@ grpc::Status HailoRtRpcService::InputVStream_write(grpc::ServerContext*, const I
 {
     MemoryView mem_view = MemoryView::create_const(reinterpret_cast<const uint8_t*>(request->data().c_str()),
         request->data().size());
+    SharedMemoryBufferPtr shared_memory = nullptr;
+    if (!request->shared_memory().name().empty()) {
+        auto shared_memory_exp = get_vstream_shared_memory(true, request->identifier().vstream_handle(), request->shared_memory());
+        CHECK_EXPECTED_AS_RPC_STATUS(shared_memory_exp, reply);
+        shared_memory = shared_memory_exp.release();
+        mem_view = MemoryView(shared_memory->user_address(), request->shared_memory().size());
+    }
+
     auto lambda = [](std::shared_ptr<InputVStream> input_vstream, const MemoryView &buffer) {
         return input_vstream->write(std::move(buffer));
     };
@@ -1517,14 +1683,33 @@ grpc::Status HailoRtRpcService::OutputVStream_read(grpc::ServerContext*, const O
     auto vstream_name = output_vstream_name(request->identifier().vstream_handle());
     CHECK_EXPECTED_AS_RPC_STATUS(vstream_name, reply);
 
-    auto buffer_exp = acquire_buffer_from_cng_pool(ng_handle, vstream_name.value());
-    CHECK_EXPECTED_AS_RPC_STATUS(buffer_exp, reply);
-    auto buffer = buffer_exp.value();
-
     auto lambda = [](std::shared_ptr<OutputVStream> output_vstream, MemoryView &buffer) {
         return output_vstream->read(std::move(buffer));
     };
     auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
+
+    if (!request->shared_memory().name().empty()) {
+        // The frame is read straight into the client's shared memory, so it isn't sent in the reply
+        auto shared_memory = get_vstream_shared_memory(false, request->identifier().vstream_handle(), request->shared_memory());
+        CHECK_EXPECTED_AS_RPC_STATUS(shared_memory, reply);
+
+        auto status = manager.execute(request->identifier().vstream_handle(), lambda,
+            MemoryView(shared_memory.value()->user_address(), request->shared_memory().size()));
+        if (HAILO_STREAM_ABORT == status) {
+            LOGGER__INFO("User aborted VStream read.");
+            reply->set_status(static_cast<uint32_t>(HAILO_STREAM_ABORT));
+            return grpc::Status::OK;
+        }
+        CHECK_SUCCESS_AS_RPC_STATUS(status,  reply, "VStream read failed");
+
+        reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+        return grpc::Status::OK;
+    }
+
+    auto buffer_exp = acquire_buffer_from_cng_pool(ng_handle, vstream_name.value());
+    CHECK_EXPECTED_AS_RPC_STATUS(buffer_exp, reply);
+    auto buffer = buffer_exp.value();
+
     auto status = manager.execute(request->identifier().vstream_handle(), lambda, MemoryView(buffer->data(), buffer->size()));
 
     if (HAILO_STREAM_ABORT == status) {
@@ -1534,13 +1719,29 @@ grpc::Status HailoRtRpcService::OutputVStream_read(grpc::ServerContext*, const O
     }
     CHECK_SUCCESS_AS_RPC_STATUS(status,  reply, "VStream read failed");
 
-    if (buffer->size() > MAX_GRPC_BUFFER_SIZE) {
-        LOGGER__ERROR("Response buffer size is too big: {}. Max response size is: {}", buffer->size(), MAX_GRPC_BUFFER_SIZE);
+    // NMS frames are sized for the maximum detections, so only their valid bytes are sent (if the client accepts it)
+    auto data_size = buffer->size();
+    if (request->supports_compact_nms()) {
+        auto valid_size_lambda = [&buffer] (std::shared_ptr<OutputVStream> output_vstream) -> size_t {
+            const auto &vstream_info = output_vstream->get_info();
+            if (!HailoRTCommon::is_nms(vstream_info)) {
+                return buffer->size();
+            }
+            return NmsFrameUtils::get_valid_size(MemoryView(*buffer), output_vstream->get_user_buffer_format(),
+                vstream_info.nms_shape.number_of_classes);
+        };
+        auto valid_size = manager.execute<Expected<size_t>>(request->identifier().vstream_handle(), valid_size_lambda);
+        CHECK_EXPECTED_AS_RPC_STATUS(valid_size, reply);
+        data_size = valid_size.value();
+    }
+
+    if (data_size > MAX_GRPC_BUFFER_SIZE) {
+        LOGGER__ERROR("Response buffer size is too big: {}. Max response size is: {}", data_size, MAX_GRPC_BUFFER_SIZE);
         reply->set_status(static_cast<uint32_t>(HAILO_RPC_FAILED));
         return grpc::Status::OK;
     }
 
-    reply->set_data(buffer->data(), buffer->size());
+    reply->set_data(buffer->data(), data_size);
 
     status = return_buffer_to_cng_pool(ng_handle, vstream_name.value(), buffer);
     CHECK_SUCCESS_AS_RPC_STATUS(status, reply);
@@ -1549,6 +1750,37 @@ grpc::Status HailoRtRpcService::OutputVStream_read(grpc::ServerContext*, const O
     return grpc::Status::OK;
 }
 
+Expected<SharedMemoryBufferPtr> HailoRtRpcService::get_vstream_shared_memory(bool is_input, uint32_t vstream_handle,
+    const ProtoSharedMemoryBuffer &proto_shared_memory)
+{
+    std::unique_lock<std::mutex> lock(m_shared_memory_buffers_mutex);
+    const auto key = std::make_tuple(proto_shared_memory.pid(), is_input, vstream_handle);
+    auto it = m_shared_memory_buffers.find(key);
+    if ((m_shared_memory_buffers.end() != it) && (it->second->name() == proto_shared_memory.name()) &&
+        (it->second->size() >= proto_shared_memory.size())) {
+        return SharedMemoryBufferPtr(it->second);
+    }
+
+    TRY(auto shared_memory, SharedMemoryBuffer::open_shared(proto_shared_memory.name(), proto_shared_memory.size()));
+    m_shared_memory_buffers[key] = shared_memory;
+    return shared_memory;
+}
+
+void HailoRtRpcService::release_vstream_shared_memory(uint32_t pid, bool is_input, uint32_t vstream_handle)
+{
+    std::unique_lock<std::mutex> lock(m_shared_memory_buffers_mutex);
+    m_shared_memory_buffers.erase(std::make_tuple(pid, is_input, vstream_handle));
+}
+
+void HailoRtRpcService::release_shared_memory_by_pid(uint32_t pid)
+{
+    std::unique_lock<std::mutex> lock(m_shared_memory_buffers_mutex);
+    // The buffers are ordered by pid first, so the client's buffers are a single range
+    auto begin = m_shared_memory_buffers.lower_bound(std::make_tuple(pid, false, 0U));
+    auto end = m_shared_memory_buffers.lower_bound(std::make_tuple(pid + 1, false, 0U));
+    m_shared_memory_buffers.erase(begin, end);
+}
+
 Expected<std::vector<hailo_stream_info_t>> HailoRtRpcService::get_all_stream_infos(uint32_t ng_handle)
 {
     auto lambda = [](std::shared_ptr<ConfiguredNetworkGroup> cng) {
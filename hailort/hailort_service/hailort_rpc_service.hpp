@@ -29,6 +29,7 @@
 #include "hailo/hailort.h"
 #include "hailo/network_group.hpp"
 #include "vdevice_callbacks_queue.hpp"
+#include "common/shared_memory_buffer.hpp"
 
 #include <thread>
 
@@ -56,6 +57,8 @@ public:
         VDevice_get_default_streams_interface_Reply* reply) override;
     virtual grpc::Status VDevice_get_callback_id(grpc::ServerContext*, const VDevice_get_callback_id_Request* request,
         VDevice_get_callback_id_Reply* reply) override;
+    virtual grpc::Status VDevice_get_callback_ids_stream(grpc::ServerContext *context, const VDevice_get_callback_id_Request *request,
+        grpc::ServerWriter<VDevice_get_callback_id_Reply> *writer) override;
     virtual grpc::Status VDevice_finish_callback_listener(grpc::ServerContext*, const VDevice_finish_callback_listener_Request* request,
         VDevice_finish_callback_listener_Reply* reply) override;
 
@@ -243,16 +246,37 @@ private:
     hailo_status add_output_named_buffer(const ProtoTransferRequest &proto_stream_transfer_request, uint32_t vdevice_handle,
         uint32_t ng_handle, NamedBuffersCallbacks &named_buffers_callbacks);
     void enqueue_cb_identifier(uint32_t vdevice_handle, ProtoCallbackIdentifier &&cb_identifier);
+    // Fills the reply with the callbacks ready (waits for at least one)
+    void get_callback_ids(uint32_t vdevice_handle, uint32_t max_callbacks_count, VDevice_get_callback_id_Reply *reply);
     hailo_status return_buffer_to_cng_pool(uint32_t ng_handle, const std::string &output_name, BufferPtr buffer);
     Expected<BufferPtr> acquire_buffer_from_cng_pool(uint32_t ng_handle, const std::string &output_name);
     Expected<size_t> output_vstream_frame_size(uint32_t vstream_handle);
     hailo_status update_buffer_size_in_pool(uint32_t vstream_handle, uint32_t network_group_handle);
+    // Returns the client's shared memory buffer of the vstream (opened on the first use)
+    Expected<SharedMemoryBufferPtr> get_vstream_shared_memory(bool is_input, uint32_t vstream_handle,
+        const ProtoSharedMemoryBuffer &proto_shared_memory);
+    void release_vstream_shared_memory(uint32_t pid, bool is_input, uint32_t vstream_handle);
+    void release_shared_memory_by_pid(uint32_t pid);
+    // The device time quota of the client (see HAILO_SERVICE_CLIENT_QUOTAS_ENV_VAR), 0 if it has no quota
+    uint32_t get_client_quota_percent(uint32_t pid);
+    void set_scheduler_client(ConfiguredNetworkGroup &network_group, uint32_t pid);
 
     std::mutex m_keep_alive_mutex;
+    // Serializes the release of the disconnected clients' resources (done by the keep-alive thread and by VDevice_create)
+    std::mutex m_clients_cleanup_mutex;
     std::map<uint32_t, std::chrono::time_point<std::chrono::high_resolution_clock>> m_clients_pids;
     std::unique_ptr<std::thread> m_keep_alive;
 
     std::mutex m_vdevice_mutex;
+
+    // Set if the device time of the scheduled networks is accounted per client.
+    // The keys are the clients' process names (or pids), and "*" for the rest of the clients.
+    bool m_is_client_accounting_enabled;
+    std::map<std::string, uint32_t> m_client_quotas;
+
+    std::mutex m_shared_memory_buffers_mutex;
+    // (pid, is_input, vstream_handle) -> the shared memory the vstream's frames are passed through
+    std::map<std::tuple<uint32_t, bool, uint32_t>, SharedMemoryBufferPtr> m_shared_memory_buffers;
 };
 
 }
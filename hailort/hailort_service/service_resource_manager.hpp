@@ -14,10 +14,14 @@
 #include "hailo/expected.hpp"
 #include "common/utils.hpp"
 #include "common/os_utils.hpp"
+#include "utils/read_mostly_map.hpp"
 
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <set>
+#include <vector>
 
 #define SINGLE_CLIENT_PID (0)
 
@@ -27,15 +31,25 @@ namespace hailort
 template<class T>
 struct Resource {
     Resource(uint32_t pid, std::shared_ptr<T> resource)
-        : resource(std::move(resource))
+        : resource(std::move(resource)), is_released(false)
     {
         pids.insert(pid);
     }
 
     std::shared_ptr<T> resource;
+    // Guarded by the manager's mutex
     std::unordered_set<uint32_t> pids;
+    // Held (shared) while executing on the resource, so releasing it waits for the running executions
+    std::shared_timed_mutex mutex;
+    // Guarded by the resource's mutex. Set once the resource was released - an execution that found it just before
+    // it was removed from the manager must not run on it.
+    bool is_released;
 };
 
+// The resources are looked up without any lock (see ReadMostlyMap), so the executions of the clients don't contend on
+// the manager. The manager's mutex serializes the bookkeeping (registering, releasing and the pids), and is never held
+// while waiting for a resource. The resources are indexed by pid, so releasing the resources of a client doesn't block
+// the executions of other clients.
 template<class T>
 class ServiceResourceManager
 {
@@ -49,11 +63,9 @@ public:
     template<class K, class Func, typename... Args>
     K execute(uint32_t handle, Func &lambda, Args... args)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         TRY(auto resource, resource_lookup(handle));
-        assert(contains(m_resources_mutexes, handle));
-        std::shared_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
-        lock.unlock();
+        std::shared_lock<std::shared_timed_mutex> resource_lock(resource->mutex);
+        CHECK(!resource->is_released, HAILO_NOT_FOUND, "Failed to find resource with handle {}", handle);
         auto ret = lambda(resource->resource, args...);
 
         return ret;
@@ -62,11 +74,9 @@ public:
     template<class Func, typename... Args>
     hailo_status execute(uint32_t handle, Func &lambda, Args... args)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         TRY(auto resource, resource_lookup(handle));
-        assert(contains(m_resources_mutexes, handle));
-        std::shared_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
-        lock.unlock();
+        std::shared_lock<std::shared_timed_mutex> resource_lock(resource->mutex);
+        CHECK(!resource->is_released, HAILO_NOT_FOUND, "Failed to find resource with handle {}", handle);
         auto ret = lambda(resource->resource, args...);
 
         return ret;
@@ -77,8 +87,11 @@ public:
         std::unique_lock<std::mutex> lock(m_mutex);
         auto index = m_current_handle_index.load();
         // Create a new resource and register
-        m_resources.emplace(m_current_handle_index, std::make_shared<Resource<T>>(pid, std::move(resource)));
-        m_resources_mutexes[m_current_handle_index]; // construct std::shared_timed_mutex
+        auto resource_ref = std::make_shared<Resource<T>>(pid, std::move(resource));
+        m_resources.update([index, &resource_ref](ResourcesMap &resources) {
+            resources.emplace(index, std::move(resource_ref));
+        });
+        m_handles_by_pid[pid].insert(index);
         m_current_handle_index++;
         return index;
     }
@@ -87,66 +100,76 @@ public:
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         TRY(auto resource, resource_lookup(handle));
-        assert(contains(m_resources_mutexes, handle));
-        std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
         resource->pids.insert(pid);
+        m_handles_by_pid[pid].insert(handle);
 
         return Expected<uint32_t>(handle);
     }
 
     std::shared_ptr<T> release_resource(uint32_t handle, uint32_t pid)
     {
-        std::shared_ptr<T> res = nullptr;
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto found = m_resources.find(handle);
-        if (found == m_resources.end()) {
-            LOGGER__INFO("Failed to release resource with handle {} and PID {}. The resource no longer exists or may have already been released",
-                handle, pid);
-            return res;
-        }
-
-        assert(contains(m_resources_mutexes, handle));
-        auto resource = m_resources[handle];
-        bool release_resource = false;
+        std::shared_ptr<Resource<T>> resource = nullptr;
         {
-            std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
-            resource->pids.erase(pid);
-            if ((SINGLE_CLIENT_PID == pid) || all_pids_dead(resource)) {
-                release_resource = true;
-                res = resource->resource;
-                m_resources.erase(handle);
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto found = m_resources.find(handle);
+            if (!found) {
+                LOGGER__INFO("Failed to release resource with handle {} and PID {}. The resource no longer exists or may have already been released",
+                    handle, pid);
+                return nullptr;
             }
+
+            found.value()->pids.erase(pid);
+            remove_from_pid_index(pid, handle);
+            if ((SINGLE_CLIENT_PID != pid) && !all_pids_dead(found.value())) {
+                return nullptr;
+            }
+            resource = found.release();
+            for (auto &other_pid : resource->pids) {
+                remove_from_pid_index(other_pid, handle);
+            }
+            m_resources.update([handle](ResourcesMap &resources) {
+                resources.erase(handle);
+            });
         }
-        if (release_resource) {
-            m_resources_mutexes.erase(handle);
-        }
-        return res;
+
+        // The resource can't be found anymore, wait for the executions that already started
+        std::unique_lock<std::shared_timed_mutex> resource_lock(resource->mutex);
+        resource->is_released = true;
+        return resource->resource;
     }
 
     std::vector<std::shared_ptr<T>> release_by_pid(uint32_t pid)
     {
-        std::vector<std::shared_ptr<T>> res;
-        std::unique_lock<std::mutex> lock(m_mutex);
-        for (auto iter = m_resources.begin(); iter != m_resources.end(); ) {
-            auto handle = iter->first;
-            bool release_resource = false;
-            if (contains(iter->second->pids, pid)) {
-                assert(contains(m_resources_mutexes, handle));
-                {
-                    std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
-                    iter->second->pids.erase(pid);
-                    if (iter->second->pids.empty()) {
-                        release_resource = true;
-                        res.push_back(iter->second->resource);
-                        iter = m_resources.erase(iter);
+        std::vector<std::shared_ptr<Resource<T>>> released_resources;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto handles = m_handles_by_pid.find(pid);
+            if (handles == m_handles_by_pid.end()) {
+                return {};
+            }
+
+            m_resources.update([&handles, &released_resources, pid](ResourcesMap &resources) {
+                for (auto handle : handles->second) {
+                    auto found = resources.find(handle);
+                    if (found == resources.end()) {
+                        continue;
+                    }
+                    found->second->pids.erase(pid);
+                    if (found->second->pids.empty()) {
+                        released_resources.push_back(found->second);
+                        resources.erase(found);
                     }
                 }
-            }
-            if (release_resource) {
-                m_resources_mutexes.erase(handle);
-            } else {
-                ++iter;
-            }
+            });
+            m_handles_by_pid.erase(handles);
+        }
+
+        std::vector<std::shared_ptr<T>> res;
+        res.reserve(released_resources.size());
+        for (auto &resource : released_resources) {
+            std::unique_lock<std::shared_timed_mutex> resource_lock(resource->mutex);
+            resource->is_released = true;
+            res.push_back(resource->resource);
         }
 
         return res;
@@ -156,11 +179,10 @@ public:
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         std::vector<uint32_t> resources_handles;
-        for (auto &handle_resource_pair : m_resources) {
-            for (auto &pid : pids) {
-                if (contains(handle_resource_pair.second->pids, pid)) {
-                    resources_handles.emplace_back(handle_resource_pair.first);
-                }
+        for (auto &pid : pids) {
+            auto handles = m_handles_by_pid.find(pid);
+            if (handles != m_handles_by_pid.end()) {
+                resources_handles.insert(resources_handles.end(), handles->second.begin(), handles->second.end());
             }
         }
         return resources_handles;
@@ -173,12 +195,23 @@ private:
 
     Expected<std::shared_ptr<Resource<T>>> resource_lookup(uint32_t handle)
     {
-        auto found = m_resources.find(handle);
-        CHECK_AS_EXPECTED(found != m_resources.end(), HAILO_NOT_FOUND, "Failed to find resource with handle {}", handle);
-        auto resource = found->second;
+        auto resource = m_resources.find(handle);
+        CHECK_EXPECTED(resource, "Failed to find resource with handle {}", handle);
         return resource;
     }
 
+    void remove_from_pid_index(uint32_t pid, uint32_t handle)
+    {
+        auto handles = m_handles_by_pid.find(pid);
+        if (handles == m_handles_by_pid.end()) {
+            return;
+        }
+        handles->second.erase(handle);
+        if (handles->second.empty()) {
+            m_handles_by_pid.erase(handles);
+        }
+    }
+
     bool all_pids_dead(std::shared_ptr<Resource<T>> resource)
     {
         for (auto &pid : resource->pids) {
@@ -189,10 +222,12 @@ private:
         return true;
     }
 
+    using ResourcesMap = std::unordered_map<uint32_t, std::shared_ptr<Resource<T>>>;
+
     std::mutex m_mutex;
     std::atomic<uint32_t> m_current_handle_index;
-    std::unordered_map<uint32_t, std::shared_ptr<Resource<T>>> m_resources;
-    std::unordered_map<uint32_t, std::shared_timed_mutex> m_resources_mutexes;
+    ReadMostlyMap<uint32_t, std::shared_ptr<Resource<T>>> m_resources;
+    std::unordered_map<uint32_t, std::unordered_set<uint32_t>> m_handles_by_pid;
 };
 
 }
@@ -60,6 +60,29 @@ public:
         return callback_id;
     }
 
+    // Waits for a callback, and returns it along with the callbacks already queued after it - up to max_count callbacks,
+    // stopping once their data reaches max_data_size bytes.
+    Expected<std::vector<ProtoCallbackIdentifier>> dequeue_all(size_t max_count, size_t max_data_size)
+    {
+        TRY_WITH_ACCEPTABLE_STATUS(HAILO_SHUTDOWN_EVENT_SIGNALED, auto first_callback_id,
+            m_callbacks_ids_queue.dequeue());
+
+        size_t data_size = first_callback_id.data().size();
+        std::vector<ProtoCallbackIdentifier> callback_ids;
+        callback_ids.emplace_back(std::move(first_callback_id));
+        while ((callback_ids.size() < max_count) && (data_size < max_data_size)) {
+            auto callback_id = m_callbacks_ids_queue.dequeue(std::chrono::milliseconds(0));
+            if ((HAILO_TIMEOUT == callback_id.status()) || (HAILO_SHUTDOWN_EVENT_SIGNALED == callback_id.status())) {
+                break; // The shutdown is returned by the next call
+            }
+            CHECK_EXPECTED(callback_id);
+            data_size += callback_id->data().size();
+            callback_ids.emplace_back(callback_id.release());
+        }
+
+        return callback_ids;
+    }
+
     hailo_status shutdown()
     {
         return m_shutdown_event->signal();
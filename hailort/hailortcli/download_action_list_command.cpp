@@ -14,6 +14,8 @@
 
 #include <iostream>
 #include <iomanip>
+#include <map>
+#include <vector>
 
 #define MHz (1000 * 1000)
 // div factor is valid only for Hailo8-B0 platform. 
@@ -38,6 +40,10 @@ hailo_status DownloadActionListCommand::execute(Device &device, const std::strin
 {
     TRY(auto action_list_json, init_json_object(device, hef_file_path));
     TRY(action_list_json["network_groups"], parse_network_groups(device, network_groups));
+    const uint32_t clock_cycle_MHz = action_list_json["clock_cycle_MHz"];
+    for (auto &network_group_json : action_list_json["network_groups"]) {
+        add_timing_analysis(network_group_json, clock_cycle_MHz);
+    }
 
     return write_to_json(action_list_json, output_file_path);
 }
@@ -48,6 +54,14 @@ hailo_status DownloadActionListCommand::execute(Device &device, std::shared_ptr<
     TRY(auto network_groups_list_json, parse_network_group(device, network_group, network_group_index));
     network_groups_list_json[0]["batch_size"] = batch_size;
     network_groups_list_json[0]["fps"] = fps;
+    add_timing_analysis(network_groups_list_json[0], action_list_json_param["clock_cycle_MHz"]);
+
+    const auto &analysis_json = network_groups_list_json[0]["timing_analysis"];
+    if (analysis_json.contains("context_switch_overhead_per_frame_us")) {
+        std::cout << fmt::format("> Batch {}: context switch overhead of {:.2f} us per frame (critical path of {:.2f} us per batch)",
+            batch_size, analysis_json["context_switch_overhead_per_frame_us"].get<double>(),
+            analysis_json["critical_path"]["total_time_us"].get<double>()) << std::endl;
+    }
     action_list_json_param["runs"] += network_groups_list_json[0];
     return HAILO_SUCCESS;
 }
@@ -527,6 +541,182 @@ Expected<ordered_json> DownloadActionListCommand::parse_network_group(Device &de
     return network_group_list_json;
 }
 
+// The buckets the time of the actions is summed into, in the timing analysis
+static const char *action_category(CONTEXT_SWITCH_DEFS__ACTION_TYPE_t action_type)
+{
+    switch (action_type) {
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_FETCH_CFG_CHANNEL_DESCRIPTORS:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_FETCH_CCW_BURSTS:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ACTIVATE_CFG_CHANNEL:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_DEACTIVATE_CFG_CHANNEL:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_TRIGGER_SEQUENCER:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_SEQUENCER_DONE_INTERRUPT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_MODULE_CONFIG_DONE_INTERRUPT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_WRITE_DATA_BY_TYPE:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ENABLE_NMS:
+        return "config_load";
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ACTIVATE_DDR_BUFFER_INPUT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ACTIVATE_DDR_BUFFER_OUTPUT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ADD_DDR_PAIR_INFO:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_DDR_BUFFERING_START:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_DDR_BUFFERING_RESET:
+        return "ddr";
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ENABLE_LCU_DEFAULT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_ENABLE_LCU_NON_DEFAULT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_DISABLE_LCU:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_SWITCH_LCU_BATCH:
+        return "lcu";
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_INPUT_CHANNEL_TRANSFER_DONE_INTERRUPT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_OUTPUT_CHANNEL_TRANSFER_DONE_INTERRUPT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_WAIT_FOR_DMA_IDLE_ACTION:
+        return "boundary_wait";
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_LCU_INTERRUPT:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_WAIT_FOR_NMS:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_WAIT_FOR_CACHE_UPDATED:
+    case CONTEXT_SWITCH_DEFS__ACTION_TYPE_APPLICATION_CHANGE_INTERRUPT:
+        return "compute_wait";
+    default:
+        return "other";
+    }
+}
+
+// The time of the waits for the network itself (the boundary transfers and the compute) isn't overhead of the
+// context switch - the rest of the time of a dynamic context is.
+static bool is_context_switch_overhead(const std::string &category)
+{
+    return ("boundary_wait" != category) && ("compute_wait" != category);
+}
+
+ordered_json DownloadActionListCommand::analyze_context(const ordered_json &context_json, uint32_t clock_cycle_MHz)
+{
+    static const std::vector<std::string> CATEGORIES = {"config_load", "ddr", "lcu", "boundary_wait", "compute_wait", "other"};
+
+    struct ActionTypeStats {
+        size_t count = 0;
+        double time_us = 0;
+    };
+    std::map<std::string, ActionTypeStats> action_types;
+    std::map<std::string, double> categories_time_us;
+    for (const auto &category : CATEGORIES) {
+        categories_time_us[category] = 0;
+    }
+
+    // The timestamp of an action is the timer's value once it was executed, so the time of an action is measured from
+    // the previous executed action (the time of the first one is unknown). Actions that weren't executed (in the measured
+    // batch) have a zero timestamp. The sub-actions of a repeated action share its timestamp, so the time of the block
+    // is accounted to the type of its sub-actions.
+    uint32_t first_timestamp = 0;
+    uint32_t previous_timestamp = 0;
+    ordered_json longest_action_json = {};
+    double longest_action_time_us = -1;
+    for (const auto &action_json : context_json["actions"]) {
+        const uint32_t timestamp = action_json["timestamp"];
+        if ((0 == timestamp) || action_json.contains("sub_action_index")) {
+            continue;
+        }
+
+        const double time_us = ((0 == previous_timestamp) || (timestamp < previous_timestamp)) ? 0 :
+            static_cast<double>(timestamp - previous_timestamp) / clock_cycle_MHz;
+        if (0 == first_timestamp) {
+            first_timestamp = timestamp;
+        }
+        previous_timestamp = timestamp;
+
+        auto action_type = action_json["type"].get<CONTEXT_SWITCH_DEFS__ACTION_TYPE_t>();
+        if (CONTEXT_SWITCH_DEFS__ACTION_TYPE_REPEATED_ACTION == action_type) {
+            action_type = action_json["data"]["sub_action_type"].get<CONTEXT_SWITCH_DEFS__ACTION_TYPE_t>();
+        }
+        const std::string type_name = ordered_json(action_type);
+        auto &stats = action_types[type_name];
+        stats.count++;
+        stats.time_us += time_us;
+        categories_time_us[action_category(action_type)] += time_us;
+
+        if (time_us > longest_action_time_us) {
+            longest_action_time_us = time_us;
+            longest_action_json = {
+                {"address", action_json["address"]},
+                {"type", type_name},
+                {"time_us", time_us}
+            };
+        }
+    }
+
+    double overhead_time_us = 0;
+    ordered_json categories_json = {};
+    for (const auto &category : CATEGORIES) {
+        categories_json[category + "_time_us"] = categories_time_us[category];
+        if (is_context_switch_overhead(category)) {
+            overhead_time_us += categories_time_us[category];
+        }
+    }
+
+    ordered_json action_types_json = ordered_json::object();
+    for (const auto &stats : action_types) {
+        action_types_json[stats.first] = {
+            {"count", stats.second.count},
+            {"total_time_us", stats.second.time_us}
+        };
+    }
+
+    return ordered_json {
+        {"context_name", context_json["context_name"]},
+        {"total_time_us", static_cast<double>(previous_timestamp - first_timestamp) / clock_cycle_MHz},
+        {"context_switch_overhead_us", overhead_time_us},
+        {"categories", categories_json},
+        {"action_types", action_types_json},
+        {"longest_action", longest_action_json}
+    };
+}
+
+void DownloadActionListCommand::add_timing_analysis(ordered_json &network_group_json, uint32_t clock_cycle_MHz)
+{
+    if (0 == clock_cycle_MHz) {
+        // The timestamps can't be converted to time
+        return;
+    }
+
+    ordered_json contexts_json = ordered_json::array();
+    ordered_json critical_path_contexts_json = ordered_json::array();
+    double critical_path_time_us = 0;
+    double overhead_time_us = 0;
+    std::string slowest_context_name;
+    double slowest_context_time_us = -1;
+    for (const auto &context_json : network_group_json["contexts"]) {
+        auto context_analysis_json = analyze_context(context_json, clock_cycle_MHz);
+
+        // The dynamic contexts run one after the other for each batch, so they are the critical path of the inference
+        // (the activation, preliminary and batch switching contexts run only on activation and batch switches).
+        const std::string context_name = context_json["context_name"];
+        if (0 == context_name.rfind("dynamic_", 0)) {
+            const double context_time_us = context_analysis_json["total_time_us"];
+            critical_path_time_us += context_time_us;
+            overhead_time_us += context_analysis_json["context_switch_overhead_us"].get<double>();
+            critical_path_contexts_json.emplace_back(context_name);
+            if (context_time_us > slowest_context_time_us) {
+                slowest_context_time_us = context_time_us;
+                slowest_context_name = context_name;
+            }
+        }
+        contexts_json.emplace_back(std::move(context_analysis_json));
+    }
+
+    ordered_json analysis_json = {
+        {"critical_path", {
+            {"contexts", critical_path_contexts_json},
+            {"total_time_us", critical_path_time_us},
+            {"slowest_context", slowest_context_name}
+        }},
+        {"context_switch_overhead_per_batch_us", overhead_time_us}
+    };
+    const int batch_size = network_group_json["batch_size"];
+    if (0 < batch_size) {
+        analysis_json["context_switch_overhead_per_frame_us"] = overhead_time_us / batch_size;
+    }
+    analysis_json["contexts"] = contexts_json;
+    network_group_json["timing_analysis"] = analysis_json;
+}
+
 template<typename ActionData>
 static json unpack_vdma_channel_id(const ActionData &data)
 {
@@ -67,6 +67,8 @@ private:
     static Expected<ordered_json> parse_network_groups(Device &device, const ConfiguredNetworkGroupVector &network_groups);
     static Expected<ordered_json> parse_network_group(Device &device,
         const std::shared_ptr<ConfiguredNetworkGroup> network_group, uint32_t network_group_id);
+    static ordered_json analyze_context(const ordered_json &context_json, uint32_t clock_cycle_MHz);
+    static void add_timing_analysis(ordered_json &network_group_json, uint32_t clock_cycle_MHz);
 };
 
 // JSON serialization
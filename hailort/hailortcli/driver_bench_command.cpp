@@ -0,0 +1,352 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file driver_bench_command.cpp
+ * @brief Measures the costs of the driver (and of the host kernel and IOMMU beneath it), using the driver directly -
+ *        without any of the library's channels, streams or pipelines
+ **/
+
+#include "driver_bench_command.hpp"
+#include "common.hpp"
+
+#include "os/mmap_buffer.hpp"
+#include "vdma/memory/descriptor_list.hpp"
+#include "utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+
+static const char *CSV_SUFFIX = ".csv";
+// The descriptors are programmed with the largest page size, as the library does for large buffers
+static const uint16_t BENCH_DESC_PAGE_SIZE = vdma::MAX_SG_PAGE_SIZE;
+// The transfers launched before the channel is disabled again (the channel's ongoing transfers are limited)
+static const uint32_t LAUNCHES_PER_ENABLE = HAILO_MAX_BATCH_SIZE;
+// The waiter is given this long to block in the driver, before it's woken up
+static const std::chrono::milliseconds WAITER_BLOCK_TIME(1);
+
+static std::chrono::nanoseconds elapsed_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+static double to_us(std::chrono::nanoseconds duration)
+{
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+
+static uint32_t descriptors_count(size_t size)
+{
+    const auto required = std::max(MIN_SG_DESCS_COUNT,
+        static_cast<uint32_t>(DIV_ROUND_UP(size, static_cast<size_t>(BENCH_DESC_PAGE_SIZE))));
+    // Circular lists are sized by a power of 2
+    uint32_t count = 1;
+    while (count < required) {
+        count <<= 1;
+    }
+    return count;
+}
+
+DriverBenchCommand::DriverBenchCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("driver-bench",
+        "Measure the costs of the driver - the ioctl round-trip, vDMA buffer map/unmap and descriptors programming by "
+        "the buffer size, the transfer launch and the wakeup of a thread blocked on interrupts. The driver is used "
+        "directly, so the results are the costs of the driver, the host kernel and the IOMMU settings, without the "
+        "library's. The device must not be used by another process")),
+    m_sizes({4096, 65536, 1048576, 4194304})
+{
+    m_app->add_option("-s,--device-id", m_device_id, "Device id of the PCIe device, as given by scan (the first "
+        "device if unset)")
+        ->default_val("");
+    m_app->add_option("--iterations", m_iterations, "Amount of samples of each measurement")
+        ->check(CLI::PositiveNumber)
+        ->default_val(1000);
+    m_app->add_option("--sizes", m_sizes, "Sizes (in bytes) of the buffers that are mapped and programmed")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    m_app->add_option("--channel-index", m_channel_index, "Index of the H2D channel (of the first vDMA engine) that "
+        "is used for the launch and wakeup measurements")
+        ->check(CLI::Range(MIN_H2D_CHANNEL_INDEX, MAX_H2D_CHANNEL_INDEX))
+        ->default_val(MIN_H2D_CHANNEL_INDEX);
+    m_app->add_flag("--launch", m_should_launch, "Measure the transfer launch as well. The transfers are launched on "
+        "the host side of the channel only (no model is configured), so they are aborted by disabling the channel "
+        "instead of being completed")
+        ->default_val(false);
+    m_app->add_option("--csv", m_csv_path, "If set save the samples of each measurement as csv to the specified path")
+        ->default_val("")
+        ->check(FileSuffixValidator(CSV_SUFFIX));
+}
+
+hailo_status DriverBenchCommand::execute()
+{
+    auto device_id = m_device_id;
+    if (device_id.empty()) {
+        TRY(const auto devices, HailoRTDriver::scan_devices(HailoRTDriver::AcceleratorType::NNC_ACCELERATOR));
+        CHECK(!devices.empty(), HAILO_INVALID_OPERATION, "There are no PCIe devices on the system");
+        device_id = devices[0].device_id;
+    }
+
+    TRY(auto driver, HailoRTDriver::create_pcie(device_id), "Failed opening the driver of device {}", device_id);
+    CHECK_SUCCESS(driver->mark_as_used(), "Failed using device {} (is it used by another process?)", device_id);
+    std::cout << fmt::format("Benchmarking the driver of device {} ({} iterations)", device_id, m_iterations) << std::endl;
+
+    std::vector<Measurement> measurements;
+    CHECK_SUCCESS(measure_ioctl(*driver, measurements));
+    CHECK_SUCCESS(measure_buffer_map(*driver, measurements));
+    CHECK_SUCCESS(measure_descriptors_program(*driver, measurements));
+    if (m_should_launch) {
+        CHECK_SUCCESS(measure_launch(*driver, measurements));
+    }
+    CHECK_SUCCESS(measure_wakeup(*driver, measurements));
+
+    print_results(measurements);
+    if (!m_csv_path.empty()) {
+        CHECK_SUCCESS(write_results_csv(measurements, m_csv_path));
+    }
+    return HAILO_SUCCESS;
+}
+
+vdma::ChannelId DriverBenchCommand::channel_id() const
+{
+    return vdma::ChannelId{vdma::DEFAULT_ENGINE_INDEX, m_channel_index};
+}
+
+ChannelsBitmap DriverBenchCommand::channels_bitmap() const
+{
+    ChannelsBitmap bitmap{};
+    bitmap[vdma::DEFAULT_ENGINE_INDEX] = (1u << m_channel_index);
+    return bitmap;
+}
+
+hailo_status DriverBenchCommand::measure_ioctl(HailoRTDriver &driver, std::vector<Measurement> &measurements)
+{
+    // Polling the interrupts of an idle channel is the cheapest ioctl that reaches the driver
+    CHECK_SUCCESS(driver.vdma_enable_channels(channels_bitmap(), false));
+    Measurement measurement{"ioctl round-trip", {}};
+    hailo_status status = HAILO_SUCCESS;
+    for (uint32_t i = 0; i < m_iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        auto irq_data = driver.vdma_interrupts_poll(channels_bitmap());
+        const auto duration = elapsed_since(start);
+        if (!irq_data) {
+            status = irq_data.status();
+            break;
+        }
+        measurement.samples.emplace_back(duration);
+    }
+    CHECK_SUCCESS(driver.vdma_disable_channels(channels_bitmap()));
+
+    if (HAILO_NOT_SUPPORTED == status) {
+        std::cout << "The driver doesn't support interrupts polling, the ioctl round-trip isn't measured" << std::endl;
+        return HAILO_SUCCESS;
+    }
+    CHECK_SUCCESS(status, "Failed polling the interrupts of channel {}", channel_id());
+    measurements.emplace_back(std::move(measurement));
+    return HAILO_SUCCESS;
+}
+
+hailo_status DriverBenchCommand::measure_buffer_map(HailoRTDriver &driver, std::vector<Measurement> &measurements)
+{
+    for (const auto size : m_sizes) {
+        TRY(auto buffer, MmapBuffer<void>::create_shared_memory(size));
+        // The pages are touched before they're mapped, so the page faults aren't measured
+        memset(buffer.address(), 0, size);
+
+        Measurement map_measurement{fmt::format("map {}B", size), {}};
+        Measurement unmap_measurement{fmt::format("unmap {}B", size), {}};
+        for (uint32_t i = 0; i < m_iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            TRY(const auto handle, driver.vdma_buffer_map(reinterpret_cast<uintptr_t>(buffer.address()), size,
+                HailoRTDriver::DmaDirection::BOTH, HailoRTDriver::INVALID_MAPPED_BUFFER_DRIVER_IDENTIFIER,
+                HailoRTDriver::DmaBufferType::USER_PTR_BUFFER));
+            map_measurement.samples.emplace_back(elapsed_since(start));
+
+            start = std::chrono::steady_clock::now();
+            CHECK_SUCCESS(driver.vdma_buffer_unmap(handle));
+            unmap_measurement.samples.emplace_back(elapsed_since(start));
+        }
+        measurements.emplace_back(std::move(map_measurement));
+        measurements.emplace_back(std::move(unmap_measurement));
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status DriverBenchCommand::measure_descriptors_program(HailoRTDriver &driver,
+    std::vector<Measurement> &measurements)
+{
+    for (const auto size : m_sizes) {
+        TRY(auto buffer, MmapBuffer<void>::create_shared_memory(size));
+        memset(buffer.address(), 0, size);
+        TRY(const auto buffer_handle, driver.vdma_buffer_map(reinterpret_cast<uintptr_t>(buffer.address()), size,
+            HailoRTDriver::DmaDirection::BOTH, HailoRTDriver::INVALID_MAPPED_BUFFER_DRIVER_IDENTIFIER,
+            HailoRTDriver::DmaBufferType::USER_PTR_BUFFER));
+        auto desc_list = driver.descriptors_list_create(descriptors_count(size), BENCH_DESC_PAGE_SIZE, true);
+        if (!desc_list) {
+            (void)driver.vdma_buffer_unmap(buffer_handle);
+            return desc_list.status();
+        }
+
+        Measurement measurement{fmt::format("program {}B", size), {}};
+        hailo_status status = HAILO_SUCCESS;
+        for (uint32_t i = 0; i < m_iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            status = driver.descriptors_list_program(desc_list->handle, buffer_handle, size, 0, m_channel_index, 0,
+                true, InterruptsDomain::NONE);
+            if (HAILO_SUCCESS != status) {
+                break;
+            }
+            measurement.samples.emplace_back(elapsed_since(start));
+        }
+
+        (void)driver.descriptors_list_release(desc_list.value());
+        (void)driver.vdma_buffer_unmap(buffer_handle);
+        CHECK_SUCCESS(status, "Failed programming descriptors for a buffer of {} bytes", size);
+        measurements.emplace_back(std::move(measurement));
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status DriverBenchCommand::measure_launch(HailoRTDriver &driver, std::vector<Measurement> &measurements)
+{
+    // The smallest size is launched, so the launches of a single enable fit the descriptors list
+    const size_t size = *std::min_element(m_sizes.begin(), m_sizes.end());
+    const auto descs_per_transfer = static_cast<uint32_t>(DIV_ROUND_UP(size, static_cast<size_t>(BENCH_DESC_PAGE_SIZE)));
+    const auto desc_count = descriptors_count(static_cast<size_t>(descs_per_transfer) * LAUNCHES_PER_ENABLE *
+        BENCH_DESC_PAGE_SIZE);
+    CHECK(desc_count <= MAX_SG_DESCS_COUNT, HAILO_INVALID_ARGUMENT,
+        "The buffers of {} bytes are too large for the launch measurement", size);
+
+    TRY(auto buffer, MmapBuffer<void>::create_shared_memory(size));
+    memset(buffer.address(), 0, size);
+    TRY(const auto buffer_handle, driver.vdma_buffer_map(reinterpret_cast<uintptr_t>(buffer.address()), size,
+        HailoRTDriver::DmaDirection::H2D, HailoRTDriver::INVALID_MAPPED_BUFFER_DRIVER_IDENTIFIER,
+        HailoRTDriver::DmaBufferType::USER_PTR_BUFFER));
+    auto desc_list = driver.descriptors_list_create(desc_count, BENCH_DESC_PAGE_SIZE, true);
+    if (!desc_list) {
+        (void)driver.vdma_buffer_unmap(buffer_handle);
+        return desc_list.status();
+    }
+
+    Measurement measurement{fmt::format("launch {}B", size), {}};
+    hailo_status status = HAILO_SUCCESS;
+    uint32_t launched = 0;
+    while ((HAILO_SUCCESS == status) && (launched < m_iterations)) {
+        status = driver.vdma_enable_channels(channels_bitmap(), false);
+        if (HAILO_SUCCESS != status) {
+            break;
+        }
+
+        uint32_t starting_desc = 0;
+        const auto launches = std::min(LAUNCHES_PER_ENABLE, m_iterations - launched);
+        for (uint32_t i = 0; i < launches; i++) {
+            const std::vector<HailoRTDriver::TransferBuffer> transfer_buffers{{buffer_handle, 0, size}};
+            const auto start = std::chrono::steady_clock::now();
+            auto descs_programed = driver.launch_transfer(channel_id(), desc_list->handle, starting_desc,
+                transfer_buffers, true, InterruptsDomain::NONE, InterruptsDomain::HOST);
+            const auto duration = elapsed_since(start);
+            if (!descs_programed) {
+                status = descs_programed.status();
+                break;
+            }
+            measurement.samples.emplace_back(duration);
+            starting_desc = (starting_desc + descs_programed.value()) % desc_count;
+        }
+        launched += launches;
+
+        // The transfers can't complete without a configured model, disabling the channel aborts them
+        const auto disable_status = driver.vdma_disable_channels(channels_bitmap());
+        if (HAILO_SUCCESS == status) {
+            status = disable_status;
+        }
+    }
+
+    (void)driver.descriptors_list_release(desc_list.value());
+    (void)driver.vdma_buffer_unmap(buffer_handle);
+    CHECK_SUCCESS(status, "Failed launching transfers on channel {}", channel_id());
+    measurements.emplace_back(std::move(measurement));
+    return HAILO_SUCCESS;
+}
+
+hailo_status DriverBenchCommand::measure_wakeup(HailoRTDriver &driver, std::vector<Measurement> &measurements)
+{
+    // A thread blocked in vdma_interrupts_wait is woken up by disabling its channels, the same way it's woken up by
+    // an interrupt (without the device's part in it). The samples are the time from the disable to the waiter's return.
+    Measurement measurement{"interrupts wakeup", {}};
+    for (uint32_t i = 0; i < m_iterations; i++) {
+        CHECK_SUCCESS(driver.vdma_enable_channels(channels_bitmap(), false));
+
+        std::atomic_bool is_waiting(false);
+        hailo_status wait_status = HAILO_UNINITIALIZED;
+        std::chrono::steady_clock::time_point wakeup_time;
+        std::thread waiter([&driver, &is_waiting, &wait_status, &wakeup_time, this] () {
+            is_waiting = true;
+            auto irq_data = driver.vdma_interrupts_wait(channels_bitmap());
+            wakeup_time = std::chrono::steady_clock::now();
+            wait_status = irq_data.status();
+        });
+        while (!is_waiting) {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(WAITER_BLOCK_TIME);
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto disable_status = driver.vdma_disable_channels(channels_bitmap());
+        waiter.join();
+        CHECK_SUCCESS(disable_status);
+        CHECK_SUCCESS(wait_status, "Failed waiting for the interrupts of channel {}", channel_id());
+        measurement.samples.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(wakeup_time - start));
+    }
+    measurements.emplace_back(std::move(measurement));
+    return HAILO_SUCCESS;
+}
+
+void DriverBenchCommand::print_results(const std::vector<Measurement> &measurements)
+{
+    std::cout << fmt::format("{:<24} {:>10} {:>10} {:>10} {:>10} {:>10} {:>12}", "measurement", "min us", "p50 us",
+        "p99 us", "max us", "mean us", "stddev us") << std::endl;
+    for (const auto &measurement : measurements) {
+        if (measurement.samples.empty()) {
+            continue;
+        }
+        auto samples_us = std::vector<double>();
+        samples_us.reserve(measurement.samples.size());
+        for (const auto &sample : measurement.samples) {
+            samples_us.emplace_back(to_us(sample));
+        }
+        std::sort(samples_us.begin(), samples_us.end());
+
+        const auto count = static_cast<double>(samples_us.size());
+        const auto mean = std::accumulate(samples_us.begin(), samples_us.end(), 0.0) / count;
+        const auto variance = std::accumulate(samples_us.begin(), samples_us.end(), 0.0,
+            [mean] (double sum, double sample) { return sum + ((sample - mean) * (sample - mean)); }) / count;
+        const auto percentile = [&samples_us] (double fraction) {
+            const auto index = static_cast<size_t>(fraction * static_cast<double>(samples_us.size() - 1));
+            return samples_us[index];
+        };
+        std::cout << fmt::format("{:<24} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>12.2f}", measurement.name,
+            samples_us.front(), percentile(0.5), percentile(0.99), samples_us.back(), mean, std::sqrt(variance))
+            << std::endl;
+    }
+}
+
+hailo_status DriverBenchCommand::write_results_csv(const std::vector<Measurement> &measurements, const std::string &path)
+{
+    std::ofstream csv_file(path, std::ios::out);
+    CHECK(csv_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed creating csv file {}", path);
+
+    csv_file << "measurement,sample,duration_us" << std::endl;
+    for (const auto &measurement : measurements) {
+        for (size_t i = 0; i < measurement.samples.size(); i++) {
+            csv_file << measurement.name << "," << i << "," << to_us(measurement.samples[i]) << std::endl;
+        }
+    }
+    CHECK(csv_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing csv file {}", path);
+    return HAILO_SUCCESS;
+}
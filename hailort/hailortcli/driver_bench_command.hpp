@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file driver_bench_command.hpp
+ * @brief Measures the costs of the driver (and of the host kernel and IOMMU beneath it), using the driver directly -
+ *        without any of the library's channels, streams or pipelines
+ **/
+
+#ifndef _HAILO_DRIVER_BENCH_COMMAND_HPP_
+#define _HAILO_DRIVER_BENCH_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "CLI/CLI.hpp"
+
+#include "vdma/driver/hailort_driver.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+class DriverBenchCommand : public Command {
+public:
+    explicit DriverBenchCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+private:
+    struct Measurement {
+        std::string name;
+        std::vector<std::chrono::nanoseconds> samples;
+    };
+
+    hailo_status measure_ioctl(HailoRTDriver &driver, std::vector<Measurement> &measurements);
+    hailo_status measure_buffer_map(HailoRTDriver &driver, std::vector<Measurement> &measurements);
+    hailo_status measure_descriptors_program(HailoRTDriver &driver, std::vector<Measurement> &measurements);
+    hailo_status measure_launch(HailoRTDriver &driver, std::vector<Measurement> &measurements);
+    hailo_status measure_wakeup(HailoRTDriver &driver, std::vector<Measurement> &measurements);
+
+    vdma::ChannelId channel_id() const;
+    ChannelsBitmap channels_bitmap() const;
+
+    static void print_results(const std::vector<Measurement> &measurements);
+    static hailo_status write_results_csv(const std::vector<Measurement> &measurements, const std::string &path);
+
+    std::string m_device_id;
+    uint32_t m_iterations;
+    std::vector<uint32_t> m_sizes;
+    uint8_t m_channel_index;
+    bool m_should_launch;
+    std::string m_csv_path;
+};
+
+#endif /* _HAILO_DRIVER_BENCH_COMMAND_HPP_ */
@@ -9,6 +9,7 @@
  * HailoRT command line interface.
  **/
 #include "run2/run2_command.hpp"
+#include "run2/autotune_command.hpp"
 #include "hailortcli.hpp"
 #include "scan_command.hpp"
 #include "power_measurement_command.hpp"
@@ -23,8 +24,12 @@
 #include "mon_command.hpp"
 #if defined(__GNUC__)
 #include "udp_rate_limiter_command.hpp"
+#include "driver_bench_command.hpp"
 #endif
 #include "parse_hef_command.hpp"
+#include "simulate_scheduler_command.hpp"
+#include "startup_bench_command.hpp"
+#include "replay_command.hpp"
 #include "fw_control_command.hpp"
 #include "measure_nnc_performance_command.hpp"
 
@@ -186,6 +191,7 @@ public:
 
         add_subcommand<RunCommand>();
         add_subcommand<Run2Command>();
+        add_subcommand<AutotuneCommand>();
         add_subcommand<ScanSubcommand>();
         add_subcommand<BenchmarkCommand>();
         add_subcommand<PowerMeasurementSubcommand>();
@@ -199,8 +205,12 @@ public:
 #if defined(__GNUC__)
         add_subcommand<UdpRateLimiterCommand>();
         add_subcommand<HwInferEstimatorCommand>();
+        add_subcommand<DriverBenchCommand>();
 #endif
         add_subcommand<ParseHefCommand>();
+        add_subcommand<SimulateSchedulerCommand>();
+        add_subcommand<StartupBenchCommand>();
+        add_subcommand<ReplayCommand>();
         add_subcommand<FwControlCommand>();
     }
 
@@ -361,6 +361,12 @@ void InferStatsPrinter::print_stdout_single_element(const T &results, size_t fra
         std::cout << "    HW Latency: " << InferStatsPrinter::latency_result_to_ms(hw_latency.value()) << " ms" << std::endl;
     }
 
+    if (auto hw_latency_histogram = results.hw_latency_histogram()) {
+        std::cout << "    HW Latency percentiles: p50 " << hw_latency_histogram->p50_ms << " ms, p90 " <<
+            hw_latency_histogram->p90_ms << " ms, p99 " << hw_latency_histogram->p99_ms << " ms, max " <<
+            hw_latency_histogram->max_ms << " ms" << std::endl;
+    }
+
     if (auto overall_latency = results.overall_latency()) {
         std::cout << "    Overall Latency: " << InferStatsPrinter::latency_result_to_ms(overall_latency.value()) << " ms" << std::endl;
     }
@@ -26,6 +26,7 @@ public:
         m_total_recv_frame_size(total_recv_frame_size),
         m_infer_duration(nullptr),
         m_hw_latency(nullptr),
+        m_hw_latency_histogram(nullptr),
         m_overall_latency(nullptr)
     {}
 
@@ -70,6 +71,15 @@ public:
         return latency_cpy;
     }
 
+    Expected<LatencyHistogramResults> hw_latency_histogram() const
+    {
+        if (!m_hw_latency_histogram) {
+            return make_unexpected(HAILO_NOT_AVAILABLE);
+        }
+        LatencyHistogramResults histogram_cpy = *m_hw_latency_histogram;
+        return histogram_cpy;
+    }
+
     Expected<std::chrono::nanoseconds> overall_latency() const
     {
         if (!m_overall_latency) {
@@ -86,6 +96,7 @@ public:
     // TODO: change to optional
     std::shared_ptr<double> m_infer_duration;
     std::shared_ptr<std::chrono::nanoseconds> m_hw_latency;
+    std::shared_ptr<LatencyHistogramResults> m_hw_latency_histogram;
     std::shared_ptr<std::chrono::nanoseconds> m_overall_latency;
 };
 
@@ -197,6 +208,29 @@ public:
         return m_result_per_network.at(network_name).hw_latency();
     }
 
+    // Of all the networks, takes the slowest network's percentiles
+    Expected<LatencyHistogramResults> hw_latency_histogram(const std::string &network_name = "") const
+    {
+        if (network_name.empty()) {
+            LatencyHistogramResults acc_histogram{};
+            for (auto &network_result_pair : m_result_per_network) {
+                auto histogram_per_network = network_result_pair.second.hw_latency_histogram();
+                if(!histogram_per_network) {
+                    return make_unexpected(HAILO_NOT_AVAILABLE);
+                }
+                acc_histogram.count += histogram_per_network->count;
+                acc_histogram.p50_ms = std::max(acc_histogram.p50_ms, histogram_per_network->p50_ms);
+                acc_histogram.p90_ms = std::max(acc_histogram.p90_ms, histogram_per_network->p90_ms);
+                acc_histogram.p99_ms = std::max(acc_histogram.p99_ms, histogram_per_network->p99_ms);
+                acc_histogram.max_ms = std::max(acc_histogram.max_ms, histogram_per_network->max_ms);
+            }
+            return acc_histogram;
+        }
+        CHECK_AS_EXPECTED(contains(m_result_per_network, network_name), HAILO_NOT_FOUND,
+            "There is no results for network {}", network_name);
+        return m_result_per_network.at(network_name).hw_latency_histogram();
+    }
+
     Expected<std::chrono::nanoseconds> overall_latency(const std::string &network_name = "") const
     {
         if (network_name.empty()) {
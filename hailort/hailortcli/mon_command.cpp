@@ -10,11 +10,14 @@
 #include "hailo/hailort.h"
 
 #include "common/filesystem.hpp"
+#include "common/os_utils.hpp"
 
 #include "mon_command.hpp"
 #include "common.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <set>
 #include <signal.h>
 #include <thread>
 #if defined(__GNUC__)
@@ -33,7 +36,6 @@ constexpr size_t NUMBER_WIDTH = 15;
 constexpr size_t FRAME_VALUE_WIDTH = 8;
 constexpr size_t TERMINAL_DEFAULT_WIDTH = 80;
 constexpr size_t LINE_LENGTH = NETWORK_GROUP_NAME_WIDTH + STREAM_NAME_WIDTH + UTILIZATION_WIDTH + NUMBER_WIDTH;
-constexpr std::chrono::milliseconds EPSILON_TIME(500);
 
 inline std::string truncate_str(const std::string &original_str, uint32_t max_length)
 {
@@ -41,6 +43,72 @@ inline std::string truncate_str(const std::string &original_str, uint32_t max_le
     return (original_str.length() > max_length) ? original_str.substr(0, (max_length - ELLIPSIS.length())) + ELLIPSIS : original_str;
 }
 
+Expected<std::vector<ProtoMon>> MonitorStatesReader::read(uint32_t pid)
+{
+    std::vector<ProtoMon> mon_messages;
+#if defined(__GNUC__)
+    std::set<std::string> names;
+    if (0 != pid) {
+        names.insert(get_scheduler_mon_shm_name(pid));
+    } else {
+        TRY(const auto shm_dir_valid, Filesystem::is_directory(SCHEDULER_MON_SHM_DIR));
+        if (!shm_dir_valid) {
+            return mon_messages;
+        }
+        TRY(const auto shm_files, Filesystem::get_files_in_dir_flat(SCHEDULER_MON_SHM_DIR));
+        const std::string shm_dir = SCHEDULER_MON_SHM_DIR;
+        const std::string prefix = SCHEDULER_MON_SHM_NAME_PREFIX;
+        for (const auto &shm_file : shm_files) {
+            const auto name = shm_file.substr(shm_dir.length());
+            if (0 == name.compare(0, prefix.length(), prefix)) {
+                names.insert("/" + name);
+            }
+        }
+    }
+
+    // Closing the states of processes that ended (or stopped the monitor)
+    for (auto it = m_shared_states.begin(); it != m_shared_states.end();) {
+        it = contains(names, it->first) ? std::next(it) : m_shared_states.erase(it);
+    }
+
+    for (const auto &name : names) {
+        if (!contains(m_shared_states, name)) {
+            if (0 != pid) {
+                // Not an error - the process may not have started the monitor yet
+                if (!Filesystem::does_file_exists(std::string(SCHEDULER_MON_SHM_DIR) + name.substr(1))) {
+                    continue;
+                }
+            }
+            auto shared_state = SeqlockSharedMemory::open_shared(name);
+            if (!shared_state) {
+                continue; // The process may be in the middle of creating it
+            }
+            m_shared_states.emplace(name, shared_state.release());
+        }
+
+        const auto &shared_state = m_shared_states.at(name);
+        if (!OsUtils::is_pid_alive(shared_state->writer_pid())) {
+            continue; // Left by a process that crashed
+        }
+        auto status = shared_state->read(m_serialized_state);
+        if (HAILO_NOT_AVAILABLE == status) {
+            continue; // The process didn't publish its first state yet
+        }
+        CHECK_SUCCESS(status);
+
+        ProtoMon mon_message;
+        if (!mon_message.ParseFromArray(m_serialized_state.data(), static_cast<int>(m_serialized_state.size()))) {
+            LOGGER__WARNING("Failed to parse the monitor state of {}", name);
+            continue;
+        }
+        mon_messages.emplace_back(std::move(mon_message));
+    }
+#else
+    (void)pid;
+#endif
+    return mon_messages;
+}
+
 MonCommand::MonCommand(CLI::App &parent_app) :
     Command(parent_app.add_subcommand("monitor", "Monitor of networks - Presents information about the running networks. " \
      "To enable monitor, set in the application process the environment variable '" + std::string(SCHEDULER_MON_ENV_VAR) + "' to 1."))
@@ -61,24 +129,32 @@ void MonCommand::print_devices_info_header()
     std::cout << 
         std::setw(DEVICE_ID_WIDTH) << std::left << "Device ID" <<
         std::setw(UTILIZATION_WIDTH) << std::left << "Utilization (%)" <<
-        std::setw(STRING_WIDTH) << std::left << "Architecture" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Architecture" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Power (W)" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Temp (C)" <<
         "\n" << std::left << std::string(LINE_LENGTH, '-') << "\n";
 }
 
 void MonCommand::print_devices_info_table(const ProtoMon &mon_message)
 {
-    auto data_line_len = NUMBER_WIDTH + NETWORK_GROUP_NAME_WIDTH + DEVICE_ID_WIDTH;
+    const uint32_t NUMBER_OBJECTS_COUNT = 3;
+    auto data_line_len = DEVICE_ID_WIDTH + UTILIZATION_WIDTH + (NUMBER_WIDTH * NUMBER_OBJECTS_COUNT);
     auto rest_line_len = LINE_LENGTH - data_line_len;
 
     for (const auto &device_info : mon_message.device_infos()) {
         auto device_id = device_info.device_id();
         auto utilization = device_info.utilization();
         auto device_arch = device_info.device_arch();
+        // Shown only if the telemetry sampling of the device runs
+        auto power = device_info.has_telemetry() ? std::to_string(device_info.power_watts()).substr(0, 5) : "-";
+        auto temperature = device_info.has_telemetry() ? std::to_string(device_info.temperature()).substr(0, 5) : "-";
 
         std::cout << std::setprecision(1) << std::fixed <<
             std::setw(DEVICE_ID_WIDTH) << std::left << device_id <<
             std::setw(UTILIZATION_WIDTH) << std::left << utilization <<
-            std::setw(STRING_WIDTH) << std::left << device_arch <<
+            std::setw(NUMBER_WIDTH) << std::left << device_arch <<
+            std::setw(NUMBER_WIDTH) << std::left << power <<
+            std::setw(NUMBER_WIDTH) << std::left << temperature <<
             std::string(rest_line_len, ' ') << "\n";
     }
 }
@@ -178,6 +254,35 @@ hailo_status MonCommand::print_frames_table(const ProtoMon &mon_message)
     return HAILO_SUCCESS;
 }
 
+void MonCommand::print_clients_info_header()
+{
+    std::cout <<
+        std::setw(STRING_WIDTH) << std::left << "Client" <<
+        std::setw(NUMBER_WIDTH) << std::left << "PID" <<
+        std::setw(UTILIZATION_WIDTH) << std::left << "Utilization (%)" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Quota (%)" <<
+        "\n" << std::left << std::string(LINE_LENGTH, '-') << "\n";
+}
+
+void MonCommand::print_clients_info_table(const ProtoMon &mon_message)
+{
+    const uint32_t NUMBER_OBJECTS_COUNT = 2;
+    auto data_line_len = STRING_WIDTH + UTILIZATION_WIDTH + (NUMBER_WIDTH * NUMBER_OBJECTS_COUNT);
+    auto rest_line_len = LINE_LENGTH - data_line_len;
+
+    for (const auto &client_info : mon_message.client_infos()) {
+        auto client_name = truncate_str(client_info.client_name(), STRING_WIDTH);
+        auto quota = (0 == client_info.quota_percent()) ? "-" : std::to_string(client_info.quota_percent());
+
+        std::cout << std::setprecision(1) << std::fixed <<
+            std::setw(STRING_WIDTH) << std::left << client_name <<
+            std::setw(NUMBER_WIDTH) << std::left << client_info.client_pid() <<
+            std::setw(UTILIZATION_WIDTH) << std::left << client_info.utilization() <<
+            std::setw(NUMBER_WIDTH) << std::left << quota <<
+            std::string(rest_line_len, ' ') << "\n";
+    }
+}
+
 #if defined(__GNUC__)
 Expected<uint16_t> get_terminal_line_width()
 {
@@ -215,6 +320,19 @@ hailo_status MonCommand::print_tables(const std::vector<ProtoMon> &mon_messages,
     for (const auto &mon_message : mon_messages) {
         CHECK_SUCCESS(print_frames_table(mon_message));
     }
+
+    // The clients are accounted only by the multi-process service
+    const auto has_clients = std::any_of(mon_messages.begin(), mon_messages.end(),
+        [](const ProtoMon &mon_message) { return mon_message.client_infos_size() > 0; });
+    if (has_clients) {
+        std::cout << std::string(terminal_line_width, ' ') << "\n";
+        std::cout << std::string(terminal_line_width, ' ') << "\n";
+
+        print_clients_info_header();
+        for (const auto &mon_message : mon_messages) {
+            print_clients_info_table(mon_message);
+        }
+    }
     return HAILO_SUCCESS;
 }
 
@@ -229,40 +347,14 @@ hailo_status MonCommand::run_monitor()
     // Note: There is no need to unregister to previous SIGINT handler since we finish running after it is called.
     signal(SIGINT, signit_handler);
 
-    std::chrono::milliseconds time_interval = DEFAULT_SCHEDULER_MON_INTERVAL + EPSILON_TIME;
     TRY(const auto terminal_line_width, get_terminal_line_width());
 
     AlternativeTerminal alt_terminal;
     while (keep_running) {
-        bool print_warning_msg = true; // Will change to false only if mon directory is valid and there are updated files in it.
-        TRY(const auto mon_dir_valid, Filesystem::is_directory(SCHEDULER_MON_TMP_DIR));
-
-        std::vector<ProtoMon> mon_messages;
-        if (mon_dir_valid) {
-            TRY(auto scheduler_mon_files, Filesystem::get_latest_files_in_dir_flat(SCHEDULER_MON_TMP_DIR, time_interval));
-            print_warning_msg = scheduler_mon_files.empty();
-
-            mon_messages.reserve(scheduler_mon_files.size());
-            for (const auto &mon_file : scheduler_mon_files) {
-                auto file = LockedFile::create(mon_file, "r");
-                if (HAILO_SUCCESS != file.status()) {
-                    LOGGER__ERROR("Failed to open and lock file {}, with status: {}", mon_file, file.status());
-                    continue;
-                }
-
-                ProtoMon mon_message;
-                if (!mon_message.ParseFromFileDescriptor(file->get_fd())) {
-                    LOGGER__WARNING("Failed to ParseFromFileDescriptor monitor file {} with errno {}", mon_file, errno);
-                    continue;
-                }
-
-                mon_messages.emplace_back(std::move(mon_message));
-            }
-        }
-
+        TRY(const auto mon_messages, m_states_reader.read());
         CHECK_SUCCESS(print_tables(mon_messages, terminal_line_width));
-        if (print_warning_msg) {
-            std::cout << FORMAT_GREEN_PRINT << "Monitor did not retrieve any files. This occurs when there is no application currently running.\n"
+        if (mon_messages.empty()) {
+            std::cout << FORMAT_GREEN_PRINT << "Monitor did not retrieve any state. This occurs when there is no application currently running.\n"
             << "If this is not the case, verify that environment variable '" << SCHEDULER_MON_ENV_VAR << "' is set to 1.\n" << FORMAT_NORMAL_PRINT;
         }
 
@@ -19,9 +19,25 @@
 
 #include "CLI/CLI.hpp"
 
+#include <map>
+#include <vector>
+
 namespace hailort
 {
 
+// Reads the states published by the monitored processes. The shared memory objects stay opened between the reads, so
+// the states can be read in high frequency (reading is a copy, and never blocks the monitored processes).
+class MonitorStatesReader final
+{
+public:
+    // The states of the running processes. If pid isn't 0, only the state published by pid is read.
+    Expected<std::vector<ProtoMon>> read(uint32_t pid = 0);
+
+private:
+    std::map<std::string, SeqlockSharedMemoryPtr> m_shared_states;
+    std::vector<uint8_t> m_serialized_state;
+};
+
 class MonCommand : public Command
 {
 public:
@@ -35,10 +51,14 @@ private:
     void print_devices_info_header();
     void print_networks_info_header();
     void print_frames_header();
+    void print_clients_info_header();
     void print_devices_info_table(const ProtoMon &mon_message);
     void print_networks_info_table(const ProtoMon &mon_message);
     hailo_status print_frames_table(const ProtoMon &mon_message);
+    void print_clients_info_table(const ProtoMon &mon_message);
     hailo_status run_in_alternative_terminal();
+
+    MonitorStatesReader m_states_reader;
 };
 
 } /* namespace hailort */
@@ -0,0 +1,464 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file replay_command.cpp
+ * @brief Replays a traffic record (HAILO_TRACE=record) - the frames of each model are sent at their recorded
+ *        arrival times, and the latency and the scheduler's behavior are reported
+ **/
+
+#include "replay_command.hpp"
+#include "common.hpp"
+
+#include "common/async_thread.hpp"
+#include "common/file_utils.hpp"
+#include "utils/profiler/traffic_record_format.hpp"
+
+#include "hailo/vdevice.hpp"
+#include "hailo/hef.hpp"
+#include "hailo/infer_model.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+
+static const char *CSV_SUFFIX = ".csv";
+// A frame sent later than that after its arrival time waited for the model to be ready (its queue was full)
+static const std::chrono::milliseconds LATE_FRAME_THRESHOLD(1);
+static const std::chrono::milliseconds MODEL_READY_TIMEOUT(10000);
+static const std::chrono::milliseconds LAST_FRAME_TIMEOUT(10000);
+
+// The replay of a single model. The results are updated by the inference callbacks (under the mutex)
+struct ModelReplay {
+    const ReplayCommand::RecordedModel *recorded = nullptr;
+    std::string hef_path;
+    std::shared_ptr<InferModel> infer_model;
+    ConfiguredInferModel configured_infer_model;
+    // Input name -> the index of the recorded stream whose payloads are sent to the input
+    std::map<std::string, size_t> payload_streams;
+    std::vector<Buffer> buffers;
+
+    std::mutex mutex;
+    // By the frames' indices, negative for frames that weren't completed
+    std::vector<double> latencies_ms;
+    std::chrono::steady_clock::time_point last_completion_time;
+    uint64_t late_frames = 0;
+    double max_lag_ms = 0;
+    hailo_status inference_status = HAILO_SUCCESS;
+    hailo_scheduler_overload_stats_t overload_stats{};
+};
+
+static double to_ms(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static double percentile(const std::vector<double> &sorted_values, double ratio)
+{
+    const auto index = static_cast<size_t>(ratio * static_cast<double>(sorted_values.size() - 1));
+    return sorted_values[index];
+}
+
+ReplayCommand::ReplayCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("replay",
+        "Replay a traffic record (recorded by running the application with HAILO_TRACE=record, and "
+        "HAILO_TRAFFIC_RECORD_PAYLOADS=1 to record the input frames as well). The frames of each recorded model are "
+        "sent at their recorded arrival times, and the latency of the frames and the frames shed by the scheduler are "
+        "reported. Running with HAILO_TRACE=scheduler profiles the scheduler's decisions during the replay"))
+{
+    add_vdevice_options(m_app, m_vdevice_params);
+    m_app->add_option("record", m_record_path, "Path of the traffic record (.hrec)")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("--hef", m_hef_paths, "Paths of the HEFs of the recorded models (matched by their network group names)")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("--speed", m_speed, "Replay speed factor (2 replays the traffic twice as fast as it was recorded)")
+        ->check(CLI::PositiveNumber)
+        ->default_val(1.0);
+    m_app->add_option("--csv", m_csv_path, "If set save the arrival time and latency of each frame as csv to the specified path")
+        ->default_val("")
+        ->check(FileSuffixValidator(CSV_SUFFIX));
+}
+
+Expected<std::map<uint32_t, ReplayCommand::RecordedModel>> ReplayCommand::parse_record(Buffer &record_buffer)
+{
+    CHECK_AS_EXPECTED(record_buffer.size() >= sizeof(TrafficRecordFileHeader), HAILO_INVALID_ARGUMENT,
+        "The traffic record is too short");
+    TrafficRecordFileHeader file_header{};
+    std::memcpy(&file_header, record_buffer.data(), sizeof(file_header));
+    CHECK_AS_EXPECTED(TRAFFIC_RECORD_MAGIC == file_header.magic, HAILO_INVALID_ARGUMENT, "The file isn't a traffic record");
+    CHECK_AS_EXPECTED(TRAFFIC_RECORD_VERSION == file_header.version, HAILO_INVALID_ARGUMENT,
+        "Unsupported traffic record version {} (expected {})", file_header.version, TRAFFIC_RECORD_VERSION);
+
+    std::map<uint32_t, RecordedModel> models;
+    size_t offset = sizeof(file_header);
+    while (offset < record_buffer.size()) {
+        // The record may have been cut by the recording process' exit
+        if ((record_buffer.size() - offset) < sizeof(TrafficRecordHeader)) {
+            LOGGER__WARNING("The traffic record ends with a partial record, ignoring it");
+            break;
+        }
+        TrafficRecordHeader header{};
+        std::memcpy(&header, record_buffer.data() + offset, sizeof(header));
+        offset += sizeof(header);
+        if ((record_buffer.size() - offset) < header.data_size) {
+            LOGGER__WARNING("The traffic record ends with a partial record, ignoring it");
+            break;
+        }
+        const MemoryView data(record_buffer.data() + offset, header.data_size);
+        offset += header.data_size;
+
+        switch (static_cast<TrafficRecordType>(header.type)) {
+        case TrafficRecordType::CORE_OP:
+        {
+            auto &model = models[header.core_op_handle];
+            model.name = std::string(reinterpret_cast<const char*>(data.data()), data.size());
+            model.batch_size = header.batch_size;
+            break;
+        }
+        case TrafficRecordType::INPUT_STREAM:
+        {
+            auto &streams = models[header.core_op_handle].streams;
+            CHECK_AS_EXPECTED(header.stream_index == streams.size(), HAILO_INVALID_ARGUMENT,
+                "Invalid traffic record - stream index {} is out of order", header.stream_index);
+            RecordedStream stream;
+            stream.name = std::string(reinterpret_cast<const char*>(data.data()), data.size());
+            streams.emplace_back(std::move(stream));
+            break;
+        }
+        case TrafficRecordType::FRAME:
+        {
+            auto &model = models[header.core_op_handle];
+            CHECK_AS_EXPECTED(header.stream_index < model.streams.size(), HAILO_INVALID_ARGUMENT,
+                "Invalid traffic record - frame of an unknown stream {}", header.stream_index);
+            model.streams[header.stream_index].payloads.emplace_back();
+            if (0 == header.stream_index) {
+                model.arrivals_ns.emplace_back(header.timestamp_ns);
+            }
+            break;
+        }
+        case TrafficRecordType::PAYLOAD:
+        {
+            auto &model = models[header.core_op_handle];
+            CHECK_AS_EXPECTED(header.stream_index < model.streams.size(), HAILO_INVALID_ARGUMENT,
+                "Invalid traffic record - frame of an unknown stream {}", header.stream_index);
+            auto &payloads = model.streams[header.stream_index].payloads;
+            if (!payloads.empty()) {
+                payloads.back() = data;
+            }
+            break;
+        }
+        default:
+            // Skipping records of newer versions of the format
+            LOGGER__DEBUG("Skipping a traffic record of type {}", header.type);
+            break;
+        }
+    }
+
+    for (auto it = models.begin(); it != models.end();) {
+        if (it->second.arrivals_ns.empty()) {
+            it = models.erase(it);
+        } else if (it->second.name.empty()) {
+            LOGGER__WARNING("Skipping the {} frames of core-op {}, which wasn't recorded", it->second.arrivals_ns.size(),
+                it->first);
+            it = models.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    CHECK_AS_EXPECTED(!models.empty(), HAILO_INVALID_ARGUMENT, "The traffic record has no frames");
+    return models;
+}
+
+Expected<std::map<std::string, std::string>> ReplayCommand::map_models_to_hefs(
+    const std::map<uint32_t, RecordedModel> &models)
+{
+    std::map<std::string, std::string> hef_by_network_group;
+    for (const auto &hef_path : m_hef_paths) {
+        TRY(auto hef, Hef::create(hef_path));
+        for (const auto &network_group_name : hef.get_network_groups_names()) {
+            hef_by_network_group.emplace(network_group_name, hef_path);
+        }
+    }
+
+    std::map<std::string, std::string> hef_by_model;
+    for (const auto &model : models) {
+        auto found = hef_by_network_group.find(model.second.name);
+        CHECK_AS_EXPECTED(hef_by_network_group.end() != found, HAILO_NOT_FOUND,
+            "None of the given HEFs has the recorded model {}", model.second.name);
+        hef_by_model.emplace(model.second.name, found->second);
+    }
+    return hef_by_model;
+}
+
+static hailo_status prepare_model(VDevice &vdevice, ModelReplay &model)
+{
+    TRY(model.infer_model, vdevice.create_infer_model(model.hef_path));
+    if (0 != model.recorded->batch_size) {
+        model.infer_model->set_batch_size(static_cast<uint16_t>(model.recorded->batch_size));
+    }
+
+    // The recorded frames are the frames of the streams (after the host's transformations), so they are sent to inputs
+    // of a single stream, whose format is set to the stream's format
+    auto &hef = model.infer_model->hef();
+    const auto &network_group_name = model.recorded->name;
+    TRY(const auto stream_infos, hef.get_input_stream_infos(network_group_name));
+    for (const auto &input_name : model.infer_model->get_input_names()) {
+        TRY(const auto stream_names, hef.get_stream_names_from_vstream_name(input_name, network_group_name));
+        if (1 != stream_names.size()) {
+            continue;
+        }
+        const auto &streams = model.recorded->streams;
+        auto recorded_stream = std::find_if(streams.begin(), streams.end(), [&stream_names](const ReplayCommand::RecordedStream &stream) {
+            return (stream.name == stream_names[0]) && std::any_of(stream.payloads.begin(), stream.payloads.end(),
+                [](const MemoryView &payload) { return !payload.empty(); });
+        });
+        auto stream_info = std::find_if(stream_infos.begin(), stream_infos.end(), [&stream_names](const hailo_stream_info_t &info) {
+            return stream_names[0] == info.name;
+        });
+        if ((streams.end() == recorded_stream) || (stream_infos.end() == stream_info)) {
+            continue;
+        }
+
+        TRY(auto input, model.infer_model->input(input_name));
+        input.set_format_type(stream_info->format.type);
+        input.set_format_order(stream_info->format.order);
+        model.payload_streams.emplace(input_name, static_cast<size_t>(std::distance(streams.begin(), recorded_stream)));
+    }
+
+    TRY(model.configured_infer_model, model.infer_model->configure());
+
+    for (auto it = model.payload_streams.begin(); it != model.payload_streams.end();) {
+        TRY(auto input, model.infer_model->input(it->first));
+        const auto &payloads = model.recorded->streams[it->second].payloads;
+        const auto invalid_payload = std::find_if(payloads.begin(), payloads.end(), [&input](const MemoryView &payload) {
+            return !payload.empty() && (payload.size() != input.get_frame_size());
+        });
+        if (payloads.end() != invalid_payload) {
+            LOGGER__WARNING("The recorded frames of input {} of {} are of {} bytes, expected {} - sending blank frames instead",
+                it->first, model.recorded->name, invalid_payload->size(), input.get_frame_size());
+            it = model.payload_streams.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    model.latencies_ms.assign(model.recorded->arrivals_ns.size(), -1);
+    return HAILO_SUCCESS;
+}
+
+static hailo_status replay_model(ModelReplay &model, std::chrono::steady_clock::time_point start_time,
+    uint64_t first_arrival_ns, double speed)
+{
+    TRY(auto bindings, model.configured_infer_model.create_bindings());
+
+    // Blank frames for the inputs without recorded frames, and the outputs of all the frames
+    std::map<std::string, MemoryView> blank_inputs;
+    for (const auto &input_name : model.infer_model->get_input_names()) {
+        TRY(auto input, model.infer_model->input(input_name));
+        TRY(auto buffer, Buffer::create(input.get_frame_size(), 0, BufferStorageParams::create_dma()));
+        model.buffers.emplace_back(std::move(buffer));
+        blank_inputs.emplace(input_name, MemoryView(model.buffers.back()));
+    }
+    for (const auto &output_name : model.infer_model->get_output_names()) {
+        TRY(auto output, model.infer_model->output(output_name));
+        TRY(auto buffer, Buffer::create(output.get_frame_size(), 0, BufferStorageParams::create_dma()));
+        model.buffers.emplace_back(std::move(buffer));
+        CHECK_SUCCESS(bindings.output(output_name)->set_buffer(MemoryView(model.buffers.back())));
+    }
+
+    AsyncInferJob last_job;
+    const auto &arrivals_ns = model.recorded->arrivals_ns;
+    for (size_t frame_index = 0; frame_index < arrivals_ns.size(); frame_index++) {
+        const auto arrival_time = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::nano>(static_cast<double>(arrivals_ns[frame_index] - first_arrival_ns) / speed));
+        std::this_thread::sleep_until(arrival_time);
+
+        for (const auto &blank_input : blank_inputs) {
+            auto view = blank_input.second;
+            auto payload_stream = model.payload_streams.find(blank_input.first);
+            if (model.payload_streams.end() != payload_stream) {
+                const auto &payloads = model.recorded->streams[payload_stream->second].payloads;
+                if ((frame_index < payloads.size()) && !payloads[frame_index].empty()) {
+                    view = payloads[frame_index];
+                }
+            }
+            CHECK_SUCCESS(bindings.input(blank_input.first)->set_buffer(view));
+        }
+
+        CHECK_SUCCESS(model.configured_infer_model.wait_for_async_ready(MODEL_READY_TIMEOUT),
+            "Model {} wasn't ready for frame {}", model.recorded->name, frame_index);
+        const auto lag_ms = to_ms(std::chrono::steady_clock::now() - arrival_time);
+        {
+            std::lock_guard<std::mutex> lock(model.mutex);
+            if (lag_ms > to_ms(LATE_FRAME_THRESHOLD)) {
+                model.late_frames++;
+            }
+            model.max_lag_ms = std::max(model.max_lag_ms, lag_ms);
+            if (HAILO_SUCCESS != model.inference_status) {
+                break;
+            }
+        }
+
+        TRY(last_job, model.configured_infer_model.run_async(bindings,
+            [&model, frame_index, arrival_time](const AsyncInferCompletionInfo &completion_info) {
+                const auto now = std::chrono::steady_clock::now();
+                std::lock_guard<std::mutex> lock(model.mutex);
+                if ((HAILO_FRAME_DROPPED == completion_info.status) || (HAILO_QUEUE_IS_FULL == completion_info.status)) {
+                    // Counted by the scheduler's overload stats
+                    return;
+                }
+                if (HAILO_SUCCESS != completion_info.status) {
+                    model.inference_status = completion_info.status;
+                    return;
+                }
+                model.latencies_ms[frame_index] = to_ms(now - arrival_time);
+                model.last_completion_time = std::max(model.last_completion_time, now);
+            }));
+        last_job.detach();
+    }
+
+    CHECK_SUCCESS(last_job.wait(LAST_FRAME_TIMEOUT), "Failed waiting for the last frame of {}", model.recorded->name);
+    auto overload_stats = model.configured_infer_model.get_scheduler_overload_stats();
+    if (overload_stats) {
+        model.overload_stats = overload_stats.release();
+    }
+    model.configured_infer_model.shutdown();
+
+    std::lock_guard<std::mutex> lock(model.mutex);
+    CHECK_SUCCESS(model.inference_status, "Inference of {} failed", model.recorded->name);
+    return HAILO_SUCCESS;
+}
+
+static void print_results(const std::vector<std::unique_ptr<ModelReplay>> &models,
+    std::chrono::steady_clock::time_point start_time, uint64_t first_arrival_ns, double speed)
+{
+    std::cout << fmt::format("{:<28} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {:>8} {:>10} {:>8} {:>8}",
+        "model", "frames", "rec fps", "fps", "mean ms", "p50 ms", "p99 ms", "max ms", "late", "max lag ms", "dropped",
+        "rejected") << std::endl;
+    for (const auto &model : models) {
+        const auto &arrivals_ns = model->recorded->arrivals_ns;
+        std::vector<double> latencies_ms;
+        std::copy_if(model->latencies_ms.begin(), model->latencies_ms.end(), std::back_inserter(latencies_ms),
+            [](double latency_ms) { return latency_ms >= 0; });
+        std::sort(latencies_ms.begin(), latencies_ms.end());
+
+        const auto recorded_duration_s = static_cast<double>(arrivals_ns.back() - arrivals_ns.front()) / 1e9;
+        const auto recorded_fps = (recorded_duration_s > 0) ?
+            (static_cast<double>(arrivals_ns.size() - 1) / recorded_duration_s) : 0.0;
+        const auto first_arrival_time = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::nano>(static_cast<double>(arrivals_ns.front() - first_arrival_ns) / speed));
+        const auto replay_duration_s = to_ms(model->last_completion_time - first_arrival_time) / 1000.0;
+        const auto fps = (!latencies_ms.empty() && (replay_duration_s > 0)) ?
+            (static_cast<double>(latencies_ms.size()) / replay_duration_s) : 0.0;
+        const auto mean_ms = latencies_ms.empty() ? 0.0 :
+            std::accumulate(latencies_ms.begin(), latencies_ms.end(), 0.0) / static_cast<double>(latencies_ms.size());
+
+        std::cout << fmt::format("{:<28} {:>8} {:>10.2f} {:>10.2f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>8} {:>10.3f} {:>8} {:>8}",
+            model->recorded->name, arrivals_ns.size(), recorded_fps, fps, mean_ms,
+            latencies_ms.empty() ? 0.0 : percentile(latencies_ms, 0.5),
+            latencies_ms.empty() ? 0.0 : percentile(latencies_ms, 0.99),
+            latencies_ms.empty() ? 0.0 : latencies_ms.back(), model->late_frames, model->max_lag_ms,
+            model->overload_stats.dropped_frames, model->overload_stats.rejected_frames) << std::endl;
+    }
+    std::cout << fmt::format("Latency is measured from the recorded arrival of each frame (speed x{}). 'late' frames "
+        "were sent more than {} ms after their arrival, since the model's queue was full", speed,
+        LATE_FRAME_THRESHOLD.count()) << std::endl;
+}
+
+static hailo_status write_results_csv(const std::vector<std::unique_ptr<ModelReplay>> &models,
+    uint64_t first_arrival_ns, double speed, const std::string &path)
+{
+    std::ofstream csv_file(path, std::ios::out);
+    CHECK(csv_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed creating csv file {}", path);
+
+    csv_file << "model,frame,arrival_ms,latency_ms" << std::endl;
+    for (const auto &model : models) {
+        const auto &arrivals_ns = model->recorded->arrivals_ns;
+        for (size_t i = 0; i < arrivals_ns.size(); i++) {
+            csv_file << model->recorded->name << "," << i << "," <<
+                (static_cast<double>(arrivals_ns[i] - first_arrival_ns) / speed / 1e6) << ",";
+            // Shed frames have no latency
+            if (model->latencies_ms[i] >= 0) {
+                csv_file << model->latencies_ms[i];
+            }
+            csv_file << std::endl;
+        }
+    }
+    CHECK(csv_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing csv file {}", path);
+    return HAILO_SUCCESS;
+}
+
+hailo_status ReplayCommand::execute()
+{
+    // The payloads are read from the record while replaying, so the whole record is kept in memory
+    TRY(auto record_buffer, read_binary_file(m_record_path));
+    TRY(const auto recorded_models, parse_record(record_buffer));
+    TRY(const auto hef_by_model, map_models_to_hefs(recorded_models));
+
+    hailo_vdevice_params_t vdevice_params{};
+    CHECK_SUCCESS(hailo_init_vdevice_params(&vdevice_params));
+    if (m_vdevice_params.device_count != HAILO_DEFAULT_DEVICE_COUNT) {
+        vdevice_params.device_count = m_vdevice_params.device_count;
+    }
+    std::vector<hailo_device_id_t> dev_ids;
+    if (!m_vdevice_params.device_params.device_ids.empty()) {
+        TRY(auto dev_ids_strs, get_device_ids(m_vdevice_params.device_params));
+        TRY(dev_ids, HailoRTCommon::to_device_ids_vector(dev_ids_strs));
+
+        vdevice_params.device_ids = dev_ids.data();
+        vdevice_params.device_count = static_cast<uint32_t>(dev_ids.size());
+    }
+    vdevice_params.group_id = m_vdevice_params.group_id.c_str();
+    vdevice_params.multi_process_service = m_vdevice_params.multi_process_service;
+    TRY(auto vdevice, VDevice::create(vdevice_params), "Failed creating vdevice");
+
+    std::vector<std::unique_ptr<ModelReplay>> models;
+    uint64_t first_arrival_ns = std::numeric_limits<uint64_t>::max();
+    for (const auto &recorded_model : recorded_models) {
+        auto model = std::make_unique<ModelReplay>();
+        model->recorded = &recorded_model.second;
+        model->hef_path = hef_by_model.at(recorded_model.second.name);
+        CHECK_SUCCESS(prepare_model(*vdevice, *model), "Failed preparing model {}", recorded_model.second.name);
+        first_arrival_ns = std::min(first_arrival_ns, recorded_model.second.arrivals_ns.front());
+        std::cout << fmt::format("Replaying {} frames of {} ({} of its inputs with the recorded frames)",
+            recorded_model.second.arrivals_ns.size(), recorded_model.second.name, model->payload_streams.size()) << std::endl;
+        models.emplace_back(std::move(model));
+    }
+
+    // Each model is replayed by its own thread, so a model waiting for its queue doesn't delay the arrivals of the others
+    const auto start_time = std::chrono::steady_clock::now();
+    std::vector<AsyncThreadPtr<hailo_status>> replay_threads;
+    for (auto &model : models) {
+        auto model_ptr = model.get();
+        const auto speed = m_speed;
+        replay_threads.emplace_back(std::make_unique<AsyncThread<hailo_status>>("REPLAY",
+            [model_ptr, start_time, first_arrival_ns, speed]() {
+                return replay_model(*model_ptr, start_time, first_arrival_ns, speed);
+            }));
+    }
+    auto replay_status = HAILO_SUCCESS;
+    for (auto &replay_thread : replay_threads) {
+        const auto status = replay_thread->get();
+        if (HAILO_SUCCESS != status) {
+            replay_status = status;
+        }
+    }
+    CHECK_SUCCESS(replay_status, "Replay failed");
+
+    print_results(models, start_time, first_arrival_ns, m_speed);
+    if (!m_csv_path.empty()) {
+        CHECK_SUCCESS(write_results_csv(models, first_arrival_ns, m_speed, m_csv_path));
+    }
+    return HAILO_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file replay_command.hpp
+ * @brief Replays a traffic record (HAILO_TRACE=record) - the frames of each model are sent at their recorded
+ *        arrival times, and the latency and the scheduler's behavior are reported
+ **/
+
+#ifndef _HAILO_REPLAY_COMMAND_HPP_
+#define _HAILO_REPLAY_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+#include "CLI/CLI.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+
+class ReplayCommand : public Command {
+public:
+    explicit ReplayCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+    struct RecordedStream {
+        std::string name;
+        // The recorded frames of the stream, by their order (empty views for frames recorded without their payload)
+        std::vector<MemoryView> payloads;
+    };
+
+    struct RecordedModel {
+        std::string name;
+        uint32_t batch_size = 0;
+        // By the streams' indices
+        std::vector<RecordedStream> streams;
+        // The arrival times of the model's frames (the frames written to its first input stream), in nanoseconds since
+        // the start of the record
+        std::vector<uint64_t> arrivals_ns;
+    };
+
+private:
+    // The record's models (with frames), by their recorded core-op handles. The payloads point into record_buffer.
+    static Expected<std::map<uint32_t, RecordedModel>> parse_record(Buffer &record_buffer);
+    Expected<std::map<std::string, std::string>> map_models_to_hefs(const std::map<uint32_t, RecordedModel> &models);
+
+    std::string m_record_path;
+    std::vector<std::string> m_hef_paths;
+    hailo_vdevice_params m_vdevice_params;
+    double m_speed;
+    std::string m_csv_path;
+};
+
+#endif /* _HAILO_REPLAY_COMMAND_HPP_ */
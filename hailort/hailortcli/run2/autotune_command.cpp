@@ -0,0 +1,522 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file autotune_command.cpp
+ * @brief Search the runtime parameters of networks for their service level objectives
+ **/
+
+#include "autotune_command.hpp"
+#include "run2_command.hpp"
+#include "network_runner.hpp"
+#include "../common.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+using namespace hailort;
+
+using ordered_json = nlohmann::ordered_json;
+
+constexpr uint32_t DEFAULT_PATIENCE = 2;
+constexpr uint32_t DEFAULT_MAX_ROUNDS = 2;
+constexpr uint32_t DEFAULT_MAX_TRIALS = 100;
+// A candidate replaces the best one only if it improves the objective by more than this fraction, so the noise of the
+// measurements doesn't move the search
+constexpr double MIN_IMPROVEMENT = 0.02;
+// The search of the max load factor stops once the met and the missed load factors are this close (relatively)
+constexpr double LOAD_FACTOR_PRECISION = 0.05;
+constexpr uint32_t MAX_LOAD_SEARCH_STEPS = 8;
+
+static const char *JSON_SUFFIX = ".json";
+
+enum class AutotuneObjective {
+    MAX_FPS,
+    MIN_LATENCY
+};
+
+enum class TunedParam {
+    BATCH_SIZE,
+    SCHEDULER_THRESHOLD,
+    SCHEDULER_TIMEOUT,
+    ASYNC_QUEUE_SIZE,
+    VSTREAM_QUEUE_SIZE
+};
+
+static const std::vector<TunedParam> TUNED_PARAMS = { TunedParam::BATCH_SIZE, TunedParam::SCHEDULER_THRESHOLD,
+    TunedParam::SCHEDULER_TIMEOUT, TunedParam::ASYNC_QUEUE_SIZE, TunedParam::VSTREAM_QUEUE_SIZE };
+
+// The set-net option of the parameter
+static std::string get_set_net_option(TunedParam param)
+{
+    switch (param) {
+    case TunedParam::BATCH_SIZE:
+        return "--batch-size";
+    case TunedParam::SCHEDULER_THRESHOLD:
+        return "--scheduler-threshold";
+    case TunedParam::SCHEDULER_TIMEOUT:
+        return "--scheduler-timeout";
+    case TunedParam::ASYNC_QUEUE_SIZE:
+        return "--async-queue-size";
+    case TunedParam::VSTREAM_QUEUE_SIZE:
+        return "--vstream-queue-size";
+    }
+    return "<Unknown>";
+}
+
+static uint32_t get_tuned_param(const NetworkParams &params, TunedParam param)
+{
+    switch (param) {
+    case TunedParam::BATCH_SIZE:
+        return params.batch_size;
+    case TunedParam::SCHEDULER_THRESHOLD:
+        return params.scheduler_threshold;
+    case TunedParam::SCHEDULER_TIMEOUT:
+        return params.scheduler_timeout_ms;
+    case TunedParam::ASYNC_QUEUE_SIZE:
+        return params.async_queue_size;
+    case TunedParam::VSTREAM_QUEUE_SIZE:
+        return params.vstream_queue_size;
+    }
+    return 0;
+}
+
+static void set_tuned_param(NetworkParams &params, TunedParam param, uint32_t value)
+{
+    switch (param) {
+    case TunedParam::BATCH_SIZE:
+        params.batch_size = static_cast<uint16_t>(value);
+        break;
+    case TunedParam::SCHEDULER_THRESHOLD:
+        params.scheduler_threshold = value;
+        break;
+    case TunedParam::SCHEDULER_TIMEOUT:
+        params.scheduler_timeout_ms = value;
+        break;
+    case TunedParam::ASYNC_QUEUE_SIZE:
+        params.async_queue_size = value;
+        break;
+    case TunedParam::VSTREAM_QUEUE_SIZE:
+        params.vstream_queue_size = value;
+        break;
+    }
+}
+
+// Whether the parameter has an effect on the network
+static bool is_tuned_param_applicable(const NetworkParams &params, TunedParam param)
+{
+    switch (param) {
+    case TunedParam::BATCH_SIZE:
+        return true;
+    case TunedParam::SCHEDULER_THRESHOLD:
+    case TunedParam::SCHEDULER_TIMEOUT:
+        return HAILO_SCHEDULING_ALGORITHM_NONE != params.scheduling_algorithm;
+    case TunedParam::ASYNC_QUEUE_SIZE:
+        return InferenceMode::FULL_ASYNC == params.mode;
+    case TunedParam::VSTREAM_QUEUE_SIZE:
+        return InferenceMode::FULL_SYNC == params.mode;
+    }
+    return false;
+}
+
+/** Autotune */
+class Autotune : public Run2
+{
+public:
+    Autotune();
+
+    AutotuneObjective get_objective() const;
+    const std::string &get_output_path() const;
+    uint32_t get_patience() const;
+    uint32_t get_max_rounds() const;
+    uint32_t get_max_trials() const;
+    // The values searched for the parameter (in the given order)
+    const std::vector<uint32_t> &get_values(TunedParam param) const;
+
+private:
+    void add_values_option(CLI::App *group, const std::string &name, const std::string &description, TunedParam param,
+        const std::vector<uint32_t> &default_values);
+
+    AutotuneObjective m_objective;
+    std::string m_output_path;
+    uint32_t m_patience;
+    uint32_t m_max_rounds;
+    uint32_t m_max_trials;
+    std::map<TunedParam, std::vector<uint32_t>> m_values;
+};
+
+Autotune::Autotune() :
+    Run2("Search the runtime parameters of the networks for their service level objectives (running each candidate "
+        "for --time-to-run seconds), and save them as a config that 'hailortcli run2 --tuned-config' loads", "autotune")
+{
+    auto autotune_options_group = add_option_group("Autotune Options");
+    autotune_options_group->add_option("--objective", m_objective,
+        "max_fps maximizes the total fps at which the --slo-max-latency of the networks is met (searching the max load "
+        "factor of their arrival rates), min_latency minimizes the max p99 latency of the networks at their --slo-fps")
+        ->transform(HailoCheckedTransformer<AutotuneObjective>({
+            { "max_fps", AutotuneObjective::MAX_FPS },
+            { "min_latency", AutotuneObjective::MIN_LATENCY }
+        }))
+        ->default_val("max_fps");
+    autotune_options_group->add_option("-o,--output", m_output_path, "Path of the tuned config")
+        ->default_val("tuned_config.json")
+        ->check(FileSuffixValidator(JSON_SUFFIX));
+    autotune_options_group->add_option("--patience", m_patience,
+        "Stop searching the values of a parameter after this amount of consecutive values that don't improve the objective")
+        ->default_val(DEFAULT_PATIENCE)
+        ->check(CLI::PositiveNumber);
+    autotune_options_group->add_option("--max-rounds", m_max_rounds,
+        "Max rounds over all the parameters (the search stops once a round doesn't improve the objective)")
+        ->default_val(DEFAULT_MAX_ROUNDS)
+        ->check(CLI::PositiveNumber);
+    autotune_options_group->add_option("--max-trials", m_max_trials, "Max runs of the networks")
+        ->default_val(DEFAULT_MAX_TRIALS)
+        ->check(CLI::PositiveNumber);
+
+    auto search_space_group = add_option_group("Search Space",
+        "The values searched for each parameter of each network, starting from the set-net values. Set a single value "
+        "to fix a parameter");
+    add_values_option(search_space_group, "--batch-sizes", "Batch sizes", TunedParam::BATCH_SIZE, {1, 2, 4, 8, 16});
+    add_values_option(search_space_group, "--scheduler-thresholds", "Scheduler thresholds",
+        TunedParam::SCHEDULER_THRESHOLD, {0, 2, 4, 8});
+    add_values_option(search_space_group, "--scheduler-timeouts", "Scheduler timeouts in milliseconds",
+        TunedParam::SCHEDULER_TIMEOUT, {0, 5, 10, 20});
+    add_values_option(search_space_group, "--async-queue-sizes", "Async queue sizes (full_async mode)",
+        TunedParam::ASYNC_QUEUE_SIZE, {1, 2, 4, 8});
+    add_values_option(search_space_group, "--vstream-queue-sizes",
+        "Queue sizes (the buffers pool sizes) of the vstreams (full_sync mode)", TunedParam::VSTREAM_QUEUE_SIZE, {2, 4, 8});
+}
+
+void Autotune::add_values_option(CLI::App *group, const std::string &name, const std::string &description,
+    TunedParam param, const std::vector<uint32_t> &default_values)
+{
+    auto &values = m_values[param];
+    values = default_values;
+    auto option = group->add_option(name, values, description)
+        ->delimiter(',')
+        ->capture_default_str();
+    if (TunedParam::BATCH_SIZE == param) {
+        option->check(CLI::Range(1u, static_cast<uint32_t>(UINT16_MAX)));
+    }
+}
+
+AutotuneObjective Autotune::get_objective() const
+{
+    return m_objective;
+}
+
+const std::string &Autotune::get_output_path() const
+{
+    return m_output_path;
+}
+
+uint32_t Autotune::get_patience() const
+{
+    return m_patience;
+}
+
+uint32_t Autotune::get_max_rounds() const
+{
+    return m_max_rounds;
+}
+
+uint32_t Autotune::get_max_trials() const
+{
+    return m_max_trials;
+}
+
+const std::vector<uint32_t> &Autotune::get_values(TunedParam param) const
+{
+    return m_values.at(param);
+}
+
+struct TrialResult
+{
+    // Whether the objectives of all the networks were met
+    bool is_met;
+    double load_factor;
+    // The total fps of the networks, and the max p99 latency of a network
+    double fps;
+    double latency_ms;
+};
+
+static std::string get_params_str(const std::vector<NetworkParams> &network_params)
+{
+    std::stringstream res;
+    for (const auto &params : network_params) {
+        if (&params != network_params.data()) {
+            res << "; ";
+        }
+        res << Filesystem::basename(params.hef_path) << ":";
+        for (const auto param : TUNED_PARAMS) {
+            if (is_tuned_param_applicable(params, param)) {
+                res << " " << get_set_net_option(param) << " " << get_tuned_param(params, param);
+            }
+        }
+    }
+    return res.str();
+}
+
+/** AutotuneSearch */
+// Coordinate search - each parameter of each network is searched in turn, with the others set to the best values found
+// so far. The values of a parameter are tried in order, so the search of a parameter stops early once --patience values
+// in a row didn't improve the objective.
+class AutotuneSearch final
+{
+public:
+    AutotuneSearch(Autotune &app, VDevice &vdevice);
+
+    hailo_status search();
+
+private:
+    Expected<TrialResult> run_trial(const std::vector<NetworkParams> &candidate, double load_factor);
+    // On max_fps, the max load factor at which the objectives are met is searched from the load factor of the best
+    // candidate so far - a candidate that misses the objectives there can't be better, so it is dropped after one run.
+    Expected<TrialResult> evaluate(const std::vector<NetworkParams> &candidate);
+    Expected<TrialResult> find_max_load_factor(const std::vector<NetworkParams> &candidate, double start_load_factor,
+        bool drop_if_missed);
+    bool is_better(const TrialResult &result) const;
+    bool has_trials_left() const;
+    ordered_json get_results_json() const;
+
+    Autotune &m_app;
+    VDevice &m_vdevice;
+    uint32_t m_trials_count;
+    std::vector<NetworkParams> m_best_params;
+    TrialResult m_best_result;
+};
+
+AutotuneSearch::AutotuneSearch(Autotune &app, VDevice &vdevice) :
+    m_app(app),
+    m_vdevice(vdevice),
+    m_trials_count(0),
+    m_best_params(app.get_network_params()),
+    m_best_result()
+{
+}
+
+Expected<TrialResult> AutotuneSearch::run_trial(const std::vector<NetworkParams> &candidate, double load_factor)
+{
+    m_trials_count++;
+    std::cout << fmt::format("Trial {} (load factor {:.2f}): {}", m_trials_count, load_factor, get_params_str(candidate))
+        << std::endl;
+
+    m_app.set_network_params(candidate);
+    m_app.set_load_factor(load_factor);
+    std::vector<std::shared_ptr<NetworkRunner>> net_runners;
+    TRY(const auto slo_results, run_and_get_slo_results(m_app, m_vdevice, load_factor, net_runners));
+
+    TrialResult result{};
+    result.load_factor = load_factor;
+    result.is_met = std::all_of(slo_results.begin(), slo_results.end(), [](const SloResult &slo_result) {
+        return slo_result.is_met;
+    });
+    for (auto &net_runner : net_runners) {
+        result.fps += net_runner->get_last_measured_fps();
+        // Without a latency measurement the latency can't be told as met
+        auto latency_meter = net_runner->get_overall_latency_meter();
+        if (!latency_meter) {
+            result.is_met = false;
+            continue;
+        }
+        auto latency = latency_meter->get_latency_histogram();
+        if (!latency || (0 == latency->count)) {
+            result.is_met = false;
+            continue;
+        }
+        result.latency_ms = std::max(result.latency_ms, latency->p99_ms);
+    }
+
+    std::cout << fmt::format("Trial {} results: fps {:.2f}, max p99 latency {:.3f} ms, objectives {}", m_trials_count,
+        result.fps, result.latency_ms, result.is_met ? "met" : "missed") << std::endl;
+    return result;
+}
+
+Expected<TrialResult> AutotuneSearch::find_max_load_factor(const std::vector<NetworkParams> &candidate,
+    double start_load_factor, bool drop_if_missed)
+{
+    // The load factor grows (or shrinks) by 2 until the objectives are met at one load factor and missed at another,
+    // then it is bisected between them
+    TrialResult res{};
+    double met_load_factor = 0;
+    double missed_load_factor = 0;
+    double load_factor = start_load_factor;
+    for (uint32_t step = 0; (step < MAX_LOAD_SEARCH_STEPS) && has_trials_left(); step++) {
+        TRY(const auto result, run_trial(candidate, load_factor));
+        if (result.is_met) {
+            met_load_factor = load_factor;
+            res = result;
+        } else {
+            missed_load_factor = load_factor;
+            if (drop_if_missed && (0 == met_load_factor)) {
+                break;
+            }
+        }
+
+        if (0 == missed_load_factor) {
+            load_factor = met_load_factor * 2;
+        } else if (0 == met_load_factor) {
+            load_factor = missed_load_factor / 2;
+        } else if (missed_load_factor <= (met_load_factor * (1 + LOAD_FACTOR_PRECISION))) {
+            break;
+        } else {
+            load_factor = (met_load_factor + missed_load_factor) / 2;
+        }
+    }
+    return res;
+}
+
+Expected<TrialResult> AutotuneSearch::evaluate(const std::vector<NetworkParams> &candidate)
+{
+    if (AutotuneObjective::MIN_LATENCY == m_app.get_objective()) {
+        return run_trial(candidate, 1.0);
+    }
+    const auto start_load_factor = m_best_result.is_met ? m_best_result.load_factor : 1.0;
+    return find_max_load_factor(candidate, start_load_factor, m_best_result.is_met);
+}
+
+bool AutotuneSearch::is_better(const TrialResult &result) const
+{
+    if (!result.is_met) {
+        return false;
+    }
+    if (!m_best_result.is_met) {
+        return true;
+    }
+    if (AutotuneObjective::MAX_FPS == m_app.get_objective()) {
+        return result.fps > (m_best_result.fps * (1 + MIN_IMPROVEMENT));
+    }
+    return result.latency_ms < (m_best_result.latency_ms * (1 - MIN_IMPROVEMENT));
+}
+
+bool AutotuneSearch::has_trials_left() const
+{
+    return m_trials_count < m_app.get_max_trials();
+}
+
+ordered_json AutotuneSearch::get_results_json() const
+{
+    ordered_json results;
+    results["objective"] = (AutotuneObjective::MAX_FPS == m_app.get_objective()) ? "max_fps" : "min_latency";
+    results["objectives_met"] = m_best_result.is_met;
+    results["load_factor"] = m_best_result.load_factor;
+    results["fps"] = m_best_result.fps;
+    results["max_p99_latency_ms"] = m_best_result.latency_ms;
+    results["trials"] = m_trials_count;
+    return results;
+}
+
+hailo_status AutotuneSearch::search()
+{
+    TRY(m_best_result, evaluate(m_best_params));
+
+    for (uint32_t round = 0; (round < m_app.get_max_rounds()) && has_trials_left(); round++) {
+        bool is_improved = false;
+        for (size_t network_index = 0; network_index < m_best_params.size(); network_index++) {
+            for (const auto param : TUNED_PARAMS) {
+                if (!is_tuned_param_applicable(m_best_params[network_index], param)) {
+                    continue;
+                }
+
+                uint32_t misses_count = 0;
+                for (const auto value : m_app.get_values(param)) {
+                    if (!has_trials_left() || (misses_count >= m_app.get_patience())) {
+                        break;
+                    }
+                    if (value == get_tuned_param(m_best_params[network_index], param)) {
+                        continue;
+                    }
+
+                    auto candidate = m_best_params;
+                    set_tuned_param(candidate[network_index], param, value);
+                    auto result = evaluate(candidate);
+                    if (!result) {
+                        // E.g. a batch size or a queue size the network doesn't support
+                        LOGGER__WARNING("Trial of {} {} for {} failed with status {}, skipping it",
+                            get_set_net_option(param), value, candidate[network_index].hef_path, result.status());
+                        misses_count++;
+                        continue;
+                    }
+
+                    if (is_better(*result)) {
+                        m_best_params = std::move(candidate);
+                        m_best_result = result.release();
+                        misses_count = 0;
+                        is_improved = true;
+                    } else {
+                        misses_count++;
+                    }
+                }
+            }
+        }
+        if (!is_improved) {
+            break;
+        }
+    }
+
+    std::cout << fmt::format("Autotune finished after {} trials. Best parameters: {}", m_trials_count,
+        get_params_str(m_best_params)) << std::endl;
+    if (m_best_result.is_met) {
+        std::cout << fmt::format("Objectives met at load factor {:.2f}: fps {:.2f}, max p99 latency {:.3f} ms",
+            m_best_result.load_factor, m_best_result.fps, m_best_result.latency_ms) << std::endl;
+    } else {
+        LOGGER__WARNING("The service level objectives weren't met by any of the candidates");
+    }
+
+    CHECK_SUCCESS(write_tuned_config(m_best_params, m_app.get_output_path(), get_results_json()));
+    std::cout << fmt::format("Tuned config saved to {} (load it with 'hailortcli run2 --tuned-config')",
+        m_app.get_output_path()) << std::endl;
+    return HAILO_SUCCESS;
+}
+
+/** AutotuneCommand */
+AutotuneCommand::AutotuneCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand(std::make_shared<Autotune>()))
+{
+}
+
+static hailo_status validate_autotune_params(Autotune &app)
+{
+    CHECK(!app.get_measure_fw_actions(), HAILO_INVALID_OPERATION, "Measuring fw actions is not supported by autotune");
+    CHECK(app.get_load_sweep().empty(), HAILO_INVALID_OPERATION,
+        "--load-sweep is not supported by autotune (the load factor is searched on --objective=max_fps)");
+
+    const auto &network_params = app.get_network_params();
+    for (const auto &params : network_params) {
+        // The latency is measured from the arrival, so the latency of closed loop runs isn't comparable
+        CHECK(params.arrival.is_open_loop(), HAILO_INVALID_OPERATION,
+            "Autotune requires all the networks to run open loop (set with set-net --arrival), network {} runs closed loop",
+            params.hef_path);
+        CHECK((AutotuneObjective::MIN_LATENCY != app.get_objective()) || (0 < params.slo_fps), HAILO_INVALID_OPERATION,
+            "--objective=min_latency requires the target fps of each network (set with set-net --slo-fps), network {} has none",
+            params.hef_path);
+    }
+    const auto has_latency_slo = std::any_of(network_params.begin(), network_params.end(), [](const NetworkParams &params) {
+        return 0 < params.slo_max_latency_ms;
+    });
+    CHECK((AutotuneObjective::MAX_FPS != app.get_objective()) || has_latency_slo, HAILO_INVALID_OPERATION,
+        "--objective=max_fps requires a latency objective (set with set-net --slo-max-latency)");
+
+    return validate_arrival_params(app);
+}
+
+hailo_status AutotuneCommand::execute()
+{
+    Autotune *app = reinterpret_cast<Autotune*>(m_app);
+
+    app->update_network_params();
+
+    CHECK(0 < app->get_network_params().size(), HAILO_INVALID_OPERATION, "Nothing to tune");
+    if (!app->get_tuned_config_path().empty()) {
+        CHECK_SUCCESS(app->load_tuned_config());
+    }
+    CHECK_SUCCESS(validate_autotune_params(*app));
+
+    TRY(auto vdevice, app->create_vdevice());
+    AutotuneSearch search(*app, *vdevice);
+    return search.search();
+}
@@ -0,0 +1,24 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file autotune_command.hpp
+ * @brief Search the runtime parameters of networks for their service level objectives
+ **/
+
+#ifndef _HAILO_HAILORTCLI_RUN2_AUTOTUNE_COMMAND_HPP_
+#define _HAILO_HAILORTCLI_RUN2_AUTOTUNE_COMMAND_HPP_
+
+#include "../command.hpp"
+
+
+class AutotuneCommand : public Command {
+public:
+    explicit AutotuneCommand(CLI::App &parent_app);
+
+    hailo_status execute() override;
+};
+
+
+#endif /* _HAILO_HAILORTCLI_RUN2_AUTOTUNE_COMMAND_HPP_ */
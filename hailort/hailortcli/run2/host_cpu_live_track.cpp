@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file host_cpu_live_track.cpp
+ * @brief Host CPU live track
+ **/
+
+#include "host_cpu_live_track.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+using namespace hailort;
+
+Expected<std::shared_ptr<HostCpuLiveTrack>> HostCpuLiveTrack::create_shared(std::function<uint64_t()> frames_count_getter)
+{
+#if defined(__linux__)
+    auto res = make_shared_nothrow<HostCpuLiveTrack>(frames_count_getter);
+    CHECK_NOT_NULL_AS_EXPECTED(res, HAILO_OUT_OF_HOST_MEMORY);
+    return res;
+#else
+    (void)frames_count_getter;
+    LOGGER__ERROR("Measuring the host CPU is supported on Linux only");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+#endif
+}
+
+HostCpuLiveTrack::HostCpuLiveTrack(std::function<uint64_t()> frames_count_getter) :
+    LiveStats::Track(), m_frames_count_getter(frames_count_getter), m_start_time()
+{}
+
+hailo_status HostCpuLiveTrack::start_impl()
+{
+    TRY(auto threads_usage, read_threads_usage());
+    m_start_usage.clear();
+    for (const auto &thread_usage : threads_usage) {
+        m_start_usage.emplace(thread_usage.first, thread_usage.second.second);
+    }
+    m_start_time = std::chrono::steady_clock::now();
+    return HAILO_SUCCESS;
+}
+
+uint32_t HostCpuLiveTrack::push_text_impl(std::stringstream &ss)
+{
+    auto roles_usage = get_roles_usage();
+    if (!roles_usage) {
+        ss << "Host CPU: NaN (err)\n";
+        return 1;
+    }
+
+    const auto elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+    const auto frames_count = m_frames_count_getter();
+    ss << "Host CPU (% of a core, context switches per frame):";
+    for (size_t i = 0; i < roles_usage->size(); i++) {
+        const auto &role_usage = roles_usage.value()[i];
+        if (0 == role_usage.threads_count) {
+            continue;
+        }
+        ss << fmt::format(" | {}: {:.1f}%", get_role_name(static_cast<ThreadRole>(i)),
+            100 * std::chrono::duration<double>(role_usage.cpu_time).count() / elapsed_sec);
+        if (0 != frames_count) {
+            ss << fmt::format(" ({:.2f} cs)", static_cast<double>(role_usage.context_switches) / static_cast<double>(frames_count));
+        }
+    }
+    ss << "\n";
+    return 1;
+}
+
+void HostCpuLiveTrack::push_json_impl(nlohmann::ordered_json &json)
+{
+    auto roles_usage = get_roles_usage();
+    if (!roles_usage) {
+        return;
+    }
+
+    const auto elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+    const auto frames_count = m_frames_count_getter();
+    nlohmann::ordered_json host_cpu_json;
+    host_cpu_json["frames_count"] = frames_count;
+    for (size_t i = 0; i < roles_usage->size(); i++) {
+        const auto &role_usage = roles_usage.value()[i];
+        const auto cpu_time_sec = std::chrono::duration<double>(role_usage.cpu_time).count();
+        nlohmann::ordered_json role_json;
+        role_json["threads_count"] = role_usage.threads_count;
+        role_json["cpu_time_sec"] = cpu_time_sec;
+        role_json["cpu_percent"] = 100 * cpu_time_sec / elapsed_sec;
+        role_json["context_switches"] = role_usage.context_switches;
+        if (0 != frames_count) {
+            role_json["cpu_time_per_frame_us"] = cpu_time_sec * 1e6 / static_cast<double>(frames_count);
+            role_json["context_switches_per_frame"] = static_cast<double>(role_usage.context_switches) / static_cast<double>(frames_count);
+        }
+        host_cpu_json["roles"][get_role_name(static_cast<ThreadRole>(i))] = role_json;
+    }
+    json["host_cpu"] = host_cpu_json;
+}
+
+HostCpuLiveTrack::ThreadRole HostCpuLiveTrack::get_thread_role(const std::string &thread_name)
+{
+    static const std::vector<std::pair<std::string, ThreadRole>> ROLE_BY_NAME_PREFIX = {
+        { "HRT_SCHEDULER", ThreadRole::SCHEDULER },
+        { "HRT_INTERRUPTS", ThreadRole::INTERRUPTS_DISPATCHER },
+        { "HRT_LAUNCH_", ThreadRole::TRANSFER_LAUNCHER },
+        { "HRT_PIPE_", ThreadRole::PIPELINE_QUEUES },
+        { "PUSH_QUEUE", ThreadRole::PIPELINE_QUEUES },
+        { "ASYNC_PUSH_Q", ThreadRole::PIPELINE_QUEUES },
+        { "PULL_QUEUE", ThreadRole::PIPELINE_QUEUES },
+        { "ASYNC_NMS", ThreadRole::POST_PROCESS },
+        { "HRT_TRANSFORM", ThreadRole::POST_PROCESS },
+        { "HRT_", ThreadRole::OTHER_HAILORT },
+        { "NOTIFY_", ThreadRole::OTHER_HAILORT },
+        { "STREAM_", ThreadRole::OTHER_HAILORT },
+    };
+
+    for (const auto &role_by_prefix : ROLE_BY_NAME_PREFIX) {
+        if (0 == thread_name.rfind(role_by_prefix.first, 0)) {
+            return role_by_prefix.second;
+        }
+    }
+    // The application's threads (and any thread without a libhailort name)
+    return ThreadRole::USER;
+}
+
+std::string HostCpuLiveTrack::get_role_name(ThreadRole role)
+{
+    switch (role) {
+    case ThreadRole::USER:
+        return "user";
+    case ThreadRole::SCHEDULER:
+        return "scheduler";
+    case ThreadRole::INTERRUPTS_DISPATCHER:
+        return "interrupts_dispatcher";
+    case ThreadRole::TRANSFER_LAUNCHER:
+        return "transfer_launcher";
+    case ThreadRole::PIPELINE_QUEUES:
+        return "pipeline_queues";
+    case ThreadRole::POST_PROCESS:
+        return "post_process";
+    case ThreadRole::OTHER_HAILORT:
+        return "other_hailort";
+    default:
+        return "<Unknown>";
+    }
+}
+
+#if defined(__linux__)
+
+Expected<std::unordered_map<uint32_t, std::pair<HostCpuLiveTrack::ThreadRole, HostCpuLiveTrack::ThreadUsage>>>
+HostCpuLiveTrack::read_threads_usage()
+{
+    static const auto CLOCK_TICKS_PER_SEC = sysconf(_SC_CLK_TCK);
+    static const std::string TASKS_DIR = "/proc/self/task";
+
+    std::unordered_map<uint32_t, std::pair<ThreadRole, ThreadUsage>> threads_usage;
+    auto dir = opendir(TASKS_DIR.c_str());
+    CHECK_AS_EXPECTED(nullptr != dir, HAILO_OPEN_FILE_FAILURE, "Failed opening {}, errno {}", TASKS_DIR, errno);
+    while (auto entry = readdir(dir)) {
+        const std::string tid_str = entry->d_name;
+        if ((tid_str == ".") || (tid_str == "..")) {
+            continue;
+        }
+        const auto task_dir = TASKS_DIR + "/" + tid_str;
+
+        // A thread may exit while being read, it is skipped then
+        std::ifstream stat_file(task_dir + "/stat");
+        std::string stat;
+        if (!std::getline(stat_file, stat)) {
+            continue;
+        }
+        // The name is in parentheses (and may hold spaces), utime and stime are the 12th and 13th fields after it
+        const auto name_begin = stat.find('(');
+        const auto name_end = stat.rfind(')');
+        if ((std::string::npos == name_begin) || (std::string::npos == name_end)) {
+            continue;
+        }
+        const auto thread_name = stat.substr(name_begin + 1, name_end - name_begin - 1);
+        std::istringstream fields(stat.substr(name_end + 1));
+        std::string field;
+        for (int i = 0; i < 11; i++) {
+            fields >> field;
+        }
+        uint64_t utime_ticks = 0;
+        uint64_t stime_ticks = 0;
+        if (!(fields >> utime_ticks >> stime_ticks)) {
+            continue;
+        }
+
+        ThreadUsage usage{};
+        usage.cpu_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(
+            static_cast<double>(utime_ticks + stime_ticks) / static_cast<double>(CLOCK_TICKS_PER_SEC)));
+
+        std::ifstream status_file(task_dir + "/status");
+        std::string line;
+        while (std::getline(status_file, line)) {
+            static const std::string VOLUNTARY = "voluntary_ctxt_switches:";
+            static const std::string NONVOLUNTARY = "nonvoluntary_ctxt_switches:";
+            if (0 == line.rfind(VOLUNTARY, 0)) {
+                usage.context_switches += std::strtoull(line.c_str() + VOLUNTARY.size(), nullptr, 10);
+            } else if (0 == line.rfind(NONVOLUNTARY, 0)) {
+                usage.context_switches += std::strtoull(line.c_str() + NONVOLUNTARY.size(), nullptr, 10);
+            }
+        }
+
+        const auto tid = static_cast<uint32_t>(std::strtoul(tid_str.c_str(), nullptr, 10));
+        threads_usage.emplace(tid, std::make_pair(get_thread_role(thread_name), usage));
+    }
+    closedir(dir);
+
+    return threads_usage;
+}
+
+#else
+
+Expected<std::unordered_map<uint32_t, std::pair<HostCpuLiveTrack::ThreadRole, HostCpuLiveTrack::ThreadUsage>>>
+HostCpuLiveTrack::read_threads_usage()
+{
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+#endif
+
+Expected<HostCpuLiveTrack::RolesUsage> HostCpuLiveTrack::get_roles_usage()
+{
+    TRY(const auto threads_usage, read_threads_usage());
+
+    // Threads that exited since the track started aren't counted anymore
+    RolesUsage roles_usage{};
+    for (const auto &thread_usage : threads_usage) {
+        auto usage = thread_usage.second.second;
+        const auto start_usage = m_start_usage.find(thread_usage.first);
+        if (m_start_usage.end() != start_usage) {
+            usage.cpu_time -= start_usage->second.cpu_time;
+            usage.context_switches -= start_usage->second.context_switches;
+        }
+
+        auto &role_usage = roles_usage[static_cast<size_t>(thread_usage.second.first)];
+        role_usage.cpu_time += usage.cpu_time;
+        role_usage.context_switches += usage.context_switches;
+        role_usage.threads_count++;
+    }
+    return roles_usage;
+}
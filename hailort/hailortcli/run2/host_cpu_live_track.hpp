@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file host_cpu_live_track.hpp
+ * @brief Host CPU live track - the CPU time and context switches of the process' threads, grouped by the threads' role
+ *        (told by the names libhailort gives its threads)
+ **/
+
+#ifndef _HAILO_HAILORTCLI_RUN2_HOST_CPU_LIVE_TRACK_HPP_
+#define _HAILO_HAILORTCLI_RUN2_HOST_CPU_LIVE_TRACK_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "live_stats.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+class HostCpuLiveTrack : public LiveStats::Track
+{
+public:
+    // frames_count_getter returns the amount of frames inferred by all the networks since the track started
+    static hailort::Expected<std::shared_ptr<HostCpuLiveTrack>> create_shared(std::function<uint64_t()> frames_count_getter);
+
+    HostCpuLiveTrack(std::function<uint64_t()> frames_count_getter);
+    virtual ~HostCpuLiveTrack() = default;
+    virtual hailo_status start_impl() override;
+    virtual uint32_t push_text_impl(std::stringstream &ss) override;
+    virtual void push_json_impl(nlohmann::ordered_json &json) override;
+
+private:
+    enum class ThreadRole {
+        USER = 0,
+        SCHEDULER,
+        INTERRUPTS_DISPATCHER,
+        TRANSFER_LAUNCHER,
+        PIPELINE_QUEUES,
+        POST_PROCESS,
+        OTHER_HAILORT,
+
+        COUNT
+    };
+
+    struct ThreadUsage {
+        std::chrono::nanoseconds cpu_time;
+        uint64_t context_switches;
+    };
+
+    struct RoleUsage {
+        std::chrono::nanoseconds cpu_time;
+        uint64_t context_switches;
+        uint32_t threads_count;
+    };
+
+    using RolesUsage = std::array<RoleUsage, static_cast<size_t>(ThreadRole::COUNT)>;
+
+    static ThreadRole get_thread_role(const std::string &thread_name);
+    static std::string get_role_name(ThreadRole role);
+    // Returns the usage of each thread of the process (by its tid) and its role
+    static hailort::Expected<std::unordered_map<uint32_t, std::pair<ThreadRole, ThreadUsage>>> read_threads_usage();
+
+    // The usage of each role since the track started
+    hailort::Expected<RolesUsage> get_roles_usage();
+
+    std::function<uint64_t()> m_frames_count_getter;
+    std::chrono::time_point<std::chrono::steady_clock> m_start_time;
+    // The usage of the threads that existed when the track started
+    std::unordered_map<uint32_t, ThreadUsage> m_start_usage;
+};
+
+#endif /* _HAILO_HAILORTCLI_RUN2_HOST_CPU_LIVE_TRACK_HPP_ */
@@ -8,15 +8,88 @@
 
 #include "io_wrappers.hpp"
 
-FramerateThrottle::FramerateThrottle(uint32_t framerate) :
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if !defined(_MSC_VER)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ArrivalParams::ArrivalParams() :
+    process(ArrivalProcess::CLOSED_LOOP), load_factor(1.0), seed(0)
+{}
+
+Expected<std::vector<std::chrono::nanoseconds>> read_arrival_trace(const std::string &file_path)
+{
+    std::ifstream file(file_path);
+    CHECK_AS_EXPECTED(file.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening arrival trace file {}", file_path);
+
+    std::vector<std::chrono::nanoseconds> trace;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || ('#' == line[0])) {
+            continue;
+        }
+        char *end = nullptr;
+        const auto arrival_ms = std::strtod(line.c_str(), &end);
+        CHECK_AS_EXPECTED((end != line.c_str()) && (arrival_ms >= 0), HAILO_INVALID_ARGUMENT,
+            "Invalid arrival time '{}' in trace file {}", line, file_path);
+        const auto arrival = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double, std::milli>(arrival_ms));
+        CHECK_AS_EXPECTED(trace.empty() || (arrival >= trace.back()), HAILO_INVALID_ARGUMENT,
+            "Arrival times in trace file {} must be ascending", file_path);
+        trace.push_back(arrival);
+    }
+    CHECK_AS_EXPECTED(trace.size() >= 2, HAILO_INVALID_ARGUMENT, "Trace file {} must hold at least 2 arrival times",
+        file_path);
+
+    return trace;
+}
+
+double get_arrival_rate(uint32_t framerate, const ArrivalParams &arrival_params)
+{
+    switch (arrival_params.process) {
+    case ArrivalProcess::UNIFORM:
+    case ArrivalProcess::POISSON:
+        return framerate * arrival_params.load_factor;
+    case ArrivalProcess::TRACE:
+    {
+        const auto &trace = arrival_params.trace;
+        if (trace.size() < 2) {
+            return 0;
+        }
+        const auto duration_sec = std::chrono::duration<double>(trace.back() - trace.front()).count();
+        return (duration_sec > 0) ?
+            (static_cast<double>(trace.size() - 1) / duration_sec * arrival_params.load_factor) : 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+FramerateThrottle::FramerateThrottle(uint32_t framerate, const ArrivalParams &arrival_params) :
     m_framerate(framerate),
     m_framerate_interval(std::chrono::duration<double>(1) / framerate),
-    m_last_write_time(std::chrono::steady_clock::now())
-{}
+    m_last_write_time(std::chrono::steady_clock::now()),
+    m_arrival_params(arrival_params),
+    m_random_engine(arrival_params.seed),
+    m_next_arrival_time(std::chrono::steady_clock::now()),
+    m_trace_index(0)
+{
+    if (ArrivalProcess::TRACE == m_arrival_params.process) {
+        m_next_arrival_time += next_interarrival_time();
+    }
+}
 
 void FramerateThrottle::throttle()
 {
-    if (m_framerate == UNLIMITED_FRAMERATE) {
+    if ((m_framerate == UNLIMITED_FRAMERATE) || m_arrival_params.is_open_loop()) {
         return;
     }
 
@@ -24,3 +97,180 @@ void FramerateThrottle::throttle()
     std::this_thread::sleep_for(m_framerate_interval - elapsed_time);
     m_last_write_time = std::chrono::steady_clock::now();
 }
+
+std::chrono::steady_clock::time_point FramerateThrottle::wait_for_arrival()
+{
+    if (!m_arrival_params.is_open_loop()) {
+        return std::chrono::steady_clock::now();
+    }
+
+    // The arrivals are scheduled ahead of time, so a late frame doesn't delay the ones after it
+    const auto arrival_time = m_next_arrival_time;
+    std::this_thread::sleep_until(arrival_time);
+    m_next_arrival_time += next_interarrival_time();
+    return arrival_time;
+}
+
+double FramerateThrottle::arrival_rate() const
+{
+    return get_arrival_rate(m_framerate, m_arrival_params);
+}
+
+std::chrono::nanoseconds FramerateThrottle::next_interarrival_time()
+{
+    const auto rate = arrival_rate();
+    switch (m_arrival_params.process) {
+    case ArrivalProcess::UNIFORM:
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(1 / rate));
+    case ArrivalProcess::POISSON:
+    {
+        std::exponential_distribution<double> interarrival_sec(rate);
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double>(interarrival_sec(m_random_engine)));
+    }
+    case ArrivalProcess::TRACE:
+    {
+        // When the trace ends it starts over, one average interval after its last arrival
+        const auto &trace = m_arrival_params.trace;
+        const auto index = m_trace_index % trace.size();
+        const auto interarrival = (0 == index) ?
+            ((0 == m_trace_index) ? trace.front() : std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double>(1 / (rate / m_arrival_params.load_factor)))) :
+            (trace[index] - trace[index - 1]);
+        m_trace_index++;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(interarrival / m_arrival_params.load_factor);
+    }
+    default:
+        return std::chrono::nanoseconds(0);
+    }
+}
+
+// The frames prefetched ahead of the frame being sent
+static constexpr size_t MAPPED_DATASET_PREFETCH_FRAMES = 16;
+
+#define NPY_MAGIC ("\x93NUMPY")
+#define NPY_MAGIC_SIZE (6)
+
+// Returns the offset of the data of a .npy file (see the NumPy format specification), or 0 for a raw file
+static Expected<size_t> get_npy_data_offset(const std::string &file_path, const uint8_t *file_data, size_t file_size)
+{
+    const std::string npy_suffix = ".npy";
+    const bool is_npy = (file_path.size() > npy_suffix.size()) &&
+        (0 == file_path.compare(file_path.size() - npy_suffix.size(), npy_suffix.size(), npy_suffix));
+    if (!is_npy) {
+        return static_cast<size_t>(0);
+    }
+
+    CHECK_AS_EXPECTED((file_size >= 10) && (0 == std::memcmp(file_data, NPY_MAGIC, NPY_MAGIC_SIZE)),
+        HAILO_INVALID_ARGUMENT, "Input file {} is not a valid .npy file", file_path);
+    const auto major_version = file_data[NPY_MAGIC_SIZE];
+    // Version 1.0 has a 2 bytes header length, and the later versions have a 4 bytes one (both little endian)
+    if (1 == major_version) {
+        const size_t header_size = static_cast<size_t>(file_data[8]) | (static_cast<size_t>(file_data[9]) << 8);
+        return 10 + header_size;
+    }
+    CHECK_AS_EXPECTED(file_size >= 12, HAILO_INVALID_ARGUMENT, "Input file {} is not a valid .npy file", file_path);
+    size_t header_size = 0;
+    for (size_t i = 0; i < sizeof(uint32_t); i++) {
+        header_size |= static_cast<size_t>(file_data[8 + i]) << (8 * i);
+    }
+    return 12 + header_size;
+}
+
+Expected<std::shared_ptr<MappedDataset>> MappedDataset::create(const std::string &file_path, size_t frame_size)
+{
+#if defined(_MSC_VER)
+    (void)file_path;
+    (void)frame_size;
+    LOGGER__ERROR("Mapping input files is not supported on Windows");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+#else
+    const int fd = open(file_path.c_str(), O_RDONLY);
+    CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Failed opening input file {}, errno = {}", file_path, errno);
+    struct stat file_stat{};
+    const auto stat_result = fstat(fd, &file_stat);
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+    void *address = ((0 == stat_result) && (0 < file_size)) ?
+        mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    // The mapping holds a reference to the file
+    close(fd);
+    CHECK_AS_EXPECTED(MAP_FAILED != address, HAILO_FILE_OPERATION_FAILURE, "Failed mapping input file {}, errno = {}",
+        file_path, errno);
+    // The frames are read in order, so the kernel may read ahead aggressively and drop the pages behind
+    (void)madvise(address, file_size, MADV_SEQUENTIAL);
+
+    auto data_offset = get_npy_data_offset(file_path, static_cast<const uint8_t*>(address), file_size);
+    const auto data_size = (data_offset && (data_offset.value() <= file_size)) ? (file_size - data_offset.value()) : 0;
+    if (!data_offset || (0 == data_size) || (0 != (data_size % frame_size))) {
+        munmap(address, file_size);
+        CHECK_SUCCESS_AS_EXPECTED(data_offset.status());
+        LOGGER__ERROR("Input file ({}) data size {} must be a multiple of the frame size {}", file_path, data_size,
+            frame_size);
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
+
+    auto dataset = make_shared_nothrow<MappedDataset>(address, file_size, data_offset.value(), frame_size,
+        data_size / frame_size);
+    if (nullptr == dataset) {
+        munmap(address, file_size);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+    dataset->prefetch(0);
+    return dataset;
+#endif
+}
+
+MappedDataset::MappedDataset(void *address, size_t mapped_size, size_t data_offset, size_t frame_size,
+    size_t frames_count) :
+    m_address(address),
+    m_mapped_size(mapped_size),
+    m_data_offset(data_offset),
+    m_frame_size(frame_size),
+    m_frames_count(frames_count),
+    m_next_frame_index(0),
+    m_prefetched_frames_end(0)
+{}
+
+MappedDataset::~MappedDataset()
+{
+#if !defined(_MSC_VER)
+    munmap(m_address, m_mapped_size);
+#endif
+}
+
+void MappedDataset::copy_next_frame(uint8_t *dst)
+{
+    const auto frame = static_cast<const uint8_t*>(m_address) + m_data_offset + (m_next_frame_index * m_frame_size);
+    std::memcpy(dst, frame, m_frame_size);
+
+    m_next_frame_index = (m_next_frame_index + 1) % m_frames_count;
+    if (0 == m_next_frame_index) {
+        m_prefetched_frames_end = 0;
+    }
+    // Prefetching in chunks, once half of the prefetched frames were sent
+    if ((m_next_frame_index + (MAPPED_DATASET_PREFETCH_FRAMES / 2)) >= m_prefetched_frames_end) {
+        prefetch(m_next_frame_index);
+    }
+}
+
+void MappedDataset::prefetch(size_t first_frame_index)
+{
+#if !defined(_MSC_VER)
+    const auto first_index = std::max(first_frame_index, m_prefetched_frames_end);
+    const auto end_index = std::min(first_frame_index + MAPPED_DATASET_PREFETCH_FRAMES, m_frames_count);
+    if (first_index >= end_index) {
+        return;
+    }
+
+    // madvise requires a page aligned address
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin_offset = m_data_offset + (first_index * m_frame_size);
+    const auto aligned_begin_offset = begin_offset - (begin_offset % page_size);
+    const auto end_offset = m_data_offset + (end_index * m_frame_size);
+    (void)madvise(static_cast<uint8_t*>(m_address) + aligned_begin_offset, end_offset - aligned_begin_offset,
+        MADV_WILLNEED);
+    m_prefetched_frames_end = end_index;
+#else
+    (void)first_frame_index;
+#endif
+}
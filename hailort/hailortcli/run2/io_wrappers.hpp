@@ -19,7 +19,9 @@
 #include "hailo/dma_mapped_buffer.hpp"
 
 #include <chrono>
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace hailort;
 
@@ -33,17 +35,96 @@ constexpr std::chrono::milliseconds HAILORTCLI_DEFAULT_TIMEOUT(HAILO_DEFAULT_VST
 #endif /* ifndef HAILO_EMULATOR */
 
 
+enum class ArrivalProcess {
+    // The next frame is sent once the previous one was sent (limited by the framerate)
+    CLOSED_LOOP,
+    // Open loop - frames arrive at the framerate, regardless of when the previous frames were sent
+    UNIFORM,
+    // Open loop - frames arrive as a Poisson process of the framerate
+    POISSON,
+    // Open loop - frames arrive at the times read from a file (replayed cyclically)
+    TRACE,
+};
+
+struct ArrivalParams
+{
+    ArrivalParams();
+
+    bool is_open_loop() const
+    {
+        return ArrivalProcess::CLOSED_LOOP != process;
+    }
+
+    ArrivalProcess process;
+    std::string trace_path;
+    // The arrival times of the trace (set from trace_path when the network runner is created)
+    std::vector<std::chrono::nanoseconds> trace;
+    // Multiplies the arrival rate (used for sweeping the load)
+    double load_factor;
+    uint32_t seed;
+};
+
+// The average amount of frames arriving per second (0 for closed loop)
+double get_arrival_rate(uint32_t framerate, const ArrivalParams &arrival_params);
+
+// Reads the arrival times of a trace file - the arrival time in milliseconds (from the trace's start) in each line
+Expected<std::vector<std::chrono::nanoseconds>> read_arrival_trace(const std::string &file_path);
+
 class FramerateThrottle final
 {
 public:
-    FramerateThrottle(uint32_t framerate);
+    FramerateThrottle(uint32_t framerate, const ArrivalParams &arrival_params = ArrivalParams());
     ~FramerateThrottle() = default;
+    // Closed loop - waits for the framerate interval since the last call
     void throttle();
+    // Open loop - waits until the next frame arrives and returns its arrival time (which passed already if the frames
+    // are sent slower than they arrive). Closed loop - returns the current time.
+    std::chrono::steady_clock::time_point wait_for_arrival();
+    double arrival_rate() const;
 
 private:
+    std::chrono::nanoseconds next_interarrival_time();
+
     const uint32_t m_framerate;
     const std::chrono::duration<double> m_framerate_interval;
     decltype(std::chrono::steady_clock::now()) m_last_write_time;
+
+    const ArrivalParams m_arrival_params;
+    std::mt19937_64 m_random_engine;
+    std::chrono::steady_clock::time_point m_next_arrival_time;
+    size_t m_trace_index;
+};
+
+// An input file mapped to memory, streamed frame by frame (the file may be larger than the RAM, as its pages are read on
+// demand). The file holds raw frames, or is a .npy file whose data is the frames.
+class MappedDataset final
+{
+public:
+    static Expected<std::shared_ptr<MappedDataset>> create(const std::string &file_path, size_t frame_size);
+    ~MappedDataset();
+
+    MappedDataset(const MappedDataset &) = delete;
+    MappedDataset &operator=(const MappedDataset &) = delete;
+
+    size_t frames_count() const { return m_frames_count; }
+
+    // Copies the next frame into dst (cycling back to the first frame after the last one), and prefetches the frames
+    // after it, so their pages are read from the file before they are needed.
+    void copy_next_frame(uint8_t *dst);
+
+    MappedDataset(void *address, size_t mapped_size, size_t data_offset, size_t frame_size, size_t frames_count);
+
+private:
+    void prefetch(size_t first_frame_index);
+
+    void *m_address;
+    const size_t m_mapped_size;
+    const size_t m_data_offset;
+    const size_t m_frame_size;
+    const size_t m_frames_count;
+    size_t m_next_frame_index;
+    // The frames before this index were prefetched already
+    size_t m_prefetched_frames_end;
 };
 
 // Wrapper for InputStream or InputVStream objects.
@@ -56,9 +137,21 @@ class WriterWrapper final : public std::enable_shared_from_this<WriterWrapper<Wr
 public:
     template<typename WriterParams>
     static Expected<std::shared_ptr<WriterWrapper>> create(Writer &writer, const WriterParams &params,
-        VDevice &vdevice, const LatencyMeterPtr &overall_latency_meter, uint32_t framerate, bool async_api)
+        VDevice &vdevice, const LatencyMeterPtr &overall_latency_meter, uint32_t framerate,
+        const ArrivalParams &arrival_params, bool async_api)
     {
-        TRY(auto dataset, create_dataset(writer, params));
+        std::shared_ptr<MappedDataset> mapped_dataset = nullptr;
+        std::vector<BufferPtr> dataset;
+        if (params.is_input_file_mapped) {
+            CHECK_AS_EXPECTED(!params.input_file_path.empty(), HAILO_INVALID_ARGUMENT,
+                "Mapping the input file of {} requires an input file", writer.name());
+            TRY(mapped_dataset, MappedDataset::create(params.input_file_path, writer.get_frame_size()));
+            // The frames are copied from the mapped file into the staging buffers when they are sent
+            TRY(const auto staging_buffers_count, get_amount_of_staging_buffers(writer, async_api));
+            TRY(dataset, create_staging_buffers(writer.get_frame_size(), staging_buffers_count));
+        } else {
+            TRY(dataset, create_dataset(writer, params));
+        }
 
         std::vector<DmaMappedBuffer> dataset_mapped_buffers;
         if (async_api) {
@@ -67,7 +160,7 @@ public:
 
         std::shared_ptr<WriterWrapper> wrapper(
             new (std::nothrow) WriterWrapper(writer, std::move(dataset), std::move(dataset_mapped_buffers),
-                                             overall_latency_meter, framerate));
+                                             std::move(mapped_dataset), overall_latency_meter, framerate, arrival_params));
         CHECK_NOT_NULL_AS_EXPECTED(wrapper, HAILO_OUT_OF_HOST_MEMORY);
 
         return wrapper;
@@ -78,7 +171,7 @@ public:
 
     hailo_status write()
     {
-        before_write_start();
+        before_write_start(m_framerate_throttle.wait_for_arrival());
         auto status = get().write(MemoryView(*next_buffer()));
         if (HAILO_SUCCESS != status) {
             return status;
@@ -95,7 +188,7 @@ public:
 
     hailo_status write_async(typename Writer::TransferDoneCallback callback)
     {
-        before_write_start();
+        before_write_start(m_framerate_throttle.wait_for_arrival());
         auto self = std::enable_shared_from_this<WriterWrapper<Writer>>::shared_from_this();
         auto status = get().write_async(MemoryView(*next_buffer()),
             [self, original=callback](const typename Writer::CompletionInfo &completion_info) {
@@ -112,18 +205,21 @@ public:
 
 private:
     WriterWrapper(Writer &writer, std::vector<BufferPtr> &&dataset, std::vector<DmaMappedBuffer> &&dataset_mapped_buffers,
-                  const LatencyMeterPtr &overall_latency_meter, uint32_t framerate) :
+                  std::shared_ptr<MappedDataset> &&mapped_dataset, const LatencyMeterPtr &overall_latency_meter,
+                  uint32_t framerate, const ArrivalParams &arrival_params) :
         m_writer(std::ref(writer)),
         m_dataset(std::move(dataset)),
         m_dataset_mapped_buffers(std::move(dataset_mapped_buffers)),
+        m_mapped_dataset(std::move(mapped_dataset)),
         m_overall_latency_meter(overall_latency_meter),
-        m_framerate_throttle(framerate)
+        m_framerate_throttle(framerate, arrival_params)
     {}
 
-    void before_write_start()
+    // On open loop, the latency is measured from the frame's arrival (so the time it waited to be sent is included)
+    void before_write_start(std::chrono::steady_clock::time_point arrival_time)
     {
         if (m_overall_latency_meter) {
-            m_overall_latency_meter->add_start_sample(std::chrono::steady_clock::now().time_since_epoch());
+            m_overall_latency_meter->add_start_sample(arrival_time.time_since_epoch());
         }
     }
 
@@ -136,7 +232,38 @@ private:
 
     BufferPtr next_buffer()
     {
-        return m_dataset[next_buffer_index()];
+        auto buffer = m_dataset[next_buffer_index()];
+        if (m_mapped_dataset) {
+            m_mapped_dataset->copy_next_frame(buffer->data());
+        }
+        return buffer;
+    }
+
+    // A staging buffer is reused only once the frame sent from it was transferred - so on the async API there is one
+    // more staging buffer than the frames that can be in flight.
+    static Expected<size_t> get_amount_of_staging_buffers(InputStream &input_stream, bool async_api)
+    {
+        if (async_api) {
+            TRY(const auto queue_size, input_stream.get_async_max_queue_size());
+            return queue_size + 1;
+        }
+        return static_cast<size_t>(1);
+    }
+
+    static Expected<size_t> get_amount_of_staging_buffers(InputVStream &/*input_vstream*/, bool /*async_api*/)
+    {
+        return static_cast<size_t>(1);
+    }
+
+    static Expected<std::vector<BufferPtr>> create_staging_buffers(size_t frame_size, size_t buffers_count)
+    {
+        std::vector<BufferPtr> staging_buffers;
+        staging_buffers.reserve(buffers_count);
+        for (size_t i = 0; i < buffers_count; i++) {
+            TRY(auto buffer, Buffer::create_shared(frame_size, BufferStorageParams::create_dma()));
+            staging_buffers.emplace_back(std::move(buffer));
+        }
+        return staging_buffers;
     }
 
     template<typename WriterParams>
@@ -193,6 +320,8 @@ private:
 
     std::vector<BufferPtr> m_dataset;
     std::vector<DmaMappedBuffer> m_dataset_mapped_buffers;
+    // If the input file is mapped, m_dataset holds the staging buffers its frames are copied into
+    std::shared_ptr<MappedDataset> m_mapped_dataset;
     size_t m_current_buffer_index = 0;
 
     LatencyMeterPtr m_overall_latency_meter;
@@ -48,6 +48,12 @@ Expected<double> LiveStats::Track::get_last_measured_fps()
     return make_unexpected(HAILO_NOT_AVAILABLE);
 }
 
+Expected<uint64_t> LiveStats::Track::get_frames_count()
+{
+    // This virtual getter is supported only for the derived class NetworkLiveTrack
+    return make_unexpected(HAILO_NOT_AVAILABLE);
+}
+
 
 LiveStats::LiveStats(std::chrono::milliseconds interval) :
     m_running(false),
@@ -140,6 +146,21 @@ Expected<std::vector<double>> LiveStats::get_last_measured_fps_per_network_group
     return last_measured_fpss;
 }
 
+uint64_t LiveStats::get_frames_count()
+{
+    // The network tracks are added before the live stats start, so they aren't changed meanwhile
+    uint64_t frames_count = 0;
+    if (contains(m_tracks, NETWORK_STATS_LEVEL)) {
+        for (auto &track : m_tracks[NETWORK_STATS_LEVEL]) {
+            auto track_frames_count = track->get_frames_count();
+            if (track_frames_count) {
+                frames_count += track_frames_count.value();
+            }
+        }
+    }
+    return frames_count;
+}
+
 hailo_status LiveStats::start()
 {
     // In order to re-start LiveStats, we should add m_stop_event->reset() here
@@ -35,6 +35,7 @@ public:
         uint32_t push_text(std::stringstream &ss);
         void push_json(nlohmann::ordered_json &json);
         virtual hailort::Expected<double> get_last_measured_fps();
+        virtual hailort::Expected<uint64_t> get_frames_count();
 
     protected:
         virtual hailo_status start_impl() = 0;
@@ -52,6 +53,8 @@ public:
     hailo_status start();
     void stop();
     hailort::Expected<std::vector<double>> get_last_measured_fps_per_network_group();
+    // The amount of frames inferred by all the networks since the live stats started
+    uint64_t get_frames_count();
 
 private:
     bool m_running;
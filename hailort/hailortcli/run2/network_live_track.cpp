@@ -18,7 +18,7 @@ std::mutex NetworkLiveTrack::mutex;
 
 NetworkLiveTrack::NetworkLiveTrack(const std::string &name, std::shared_ptr<ConfiguredNetworkGroup> cng,
     std::shared_ptr<ConfiguredInferModel> configured_infer_model, LatencyMeterPtr overall_latency_meter,
-    bool measure_fps, const std::string &hef_path) :
+    bool measure_fps, bool measure_pipeline_latency, const std::string &hef_path) :
     m_name(name),
     m_count(0),
     m_last_get_time(),
@@ -26,6 +26,7 @@ NetworkLiveTrack::NetworkLiveTrack(const std::string &name, std::shared_ptr<Conf
     m_configured_infer_model(configured_infer_model),
     m_overall_latency_meter(overall_latency_meter),
     m_measure_fps(measure_fps),
+    m_measure_pipeline_latency(measure_pipeline_latency),
     m_hef_path(hef_path),
     m_last_measured_fps(0)
 {
@@ -50,6 +51,11 @@ double NetworkLiveTrack::get_fps()
     return fps;
 }
 
+Expected<uint64_t> NetworkLiveTrack::get_frames_count()
+{
+    return static_cast<uint64_t>(m_count.load());
+}
+
 Expected<double> NetworkLiveTrack::get_last_measured_fps()
 {
     return Expected<double>(m_last_measured_fps);
@@ -76,6 +82,11 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
         auto hw_latency_measurement = m_cng->get_latency_measurement();
         if (hw_latency_measurement) {
             ss << fmt::format("{}hw latency: {:.2f} ms", get_separator(), InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency));
+            const auto &histogram = hw_latency_measurement->hw_latency_histogram;
+            if (0 != histogram.count) {
+                ss << fmt::format(" (p50: {:.2f}, p90: {:.2f}, p99: {:.2f}, max: {:.2f} ms)", histogram.p50_ms,
+                    histogram.p90_ms, histogram.p99_ms, histogram.max_ms);
+            }
         } else if (HAILO_NOT_AVAILABLE != hw_latency_measurement.status()) { // HAILO_NOT_AVAILABLE is a valid error, we ignore it
             ss << fmt::format("{}hw latency: NaN (err)", get_separator());
         }
@@ -84,6 +95,11 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
         auto hw_latency_measurement = m_configured_infer_model->get_hw_latency_measurement();
         if (hw_latency_measurement) {
             ss << fmt::format("{}hw latency: {:.2f} ms", get_separator(), InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency));
+            const auto &histogram = hw_latency_measurement->hw_latency_histogram;
+            if (0 != histogram.count) {
+                ss << fmt::format(" (p50: {:.2f}, p90: {:.2f}, p99: {:.2f}, max: {:.2f} ms)", histogram.p50_ms,
+                    histogram.p90_ms, histogram.p99_ms, histogram.max_ms);
+            }
         }
         else if (HAILO_NOT_AVAILABLE != hw_latency_measurement.status()) { // HAILO_NOT_AVAILABLE is a valid error, we ignore it
             ss << fmt::format("{}hw latency: NaN (err)", get_separator());
@@ -94,6 +110,10 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
         auto overall_latency_measurement = m_overall_latency_meter->get_latency(false);
         if (overall_latency_measurement) {
             ss << fmt::format("{}overall latency: {:.2f} ms", get_separator(), InferStatsPrinter::latency_result_to_ms(*overall_latency_measurement));
+            if (auto histogram = m_overall_latency_meter->get_latency_histogram()) {
+                ss << fmt::format(" (p50: {:.2f}, p90: {:.2f}, p99: {:.2f}, max: {:.2f} ms)", histogram->p50_ms,
+                    histogram->p90_ms, histogram->p99_ms, histogram->max_ms);
+            }
         }
         else if (HAILO_NOT_AVAILABLE != overall_latency_measurement.status()) { // HAILO_NOT_AVAILABLE is a valid error, we ignore it
             ss << fmt::format("{}overall latency: NaN (err)", get_separator());
@@ -101,7 +121,50 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
     }
     ss << "\n";
 
-    return 1;
+    return 1 + push_pipeline_latency_text(ss);
+}
+
+uint32_t NetworkLiveTrack::push_pipeline_latency_text(std::stringstream &ss)
+{
+    if (!m_measure_pipeline_latency || (nullptr == m_configured_infer_model)) {
+        return 0;
+    }
+
+    auto elements_latency = m_configured_infer_model->get_pipeline_elements_latency();
+    if (!elements_latency) {
+        ss << "  pipeline latency: NaN (err)\n";
+        return 1;
+    }
+
+    uint32_t lines_count = 0;
+    for (const auto &element_latency : elements_latency.value()) {
+        // Queue elements measure only the wait time, the other elements measure only the processing time
+        const auto is_wait_time = (0 != element_latency.wait_time.count);
+        const auto &latency = is_wait_time ? element_latency.wait_time : element_latency.processing_time;
+        if (0 == latency.count) {
+            continue;
+        }
+
+        ss << fmt::format("  {} {}: p50 {:.3f} | p99 {:.3f} | p999 {:.3f} | max {:.3f} ms\n", element_latency.element_name,
+            is_wait_time ? "wait" : "processing", latency.p50_ms, latency.p99_ms, latency.p999_ms, latency.max_ms);
+        lines_count++;
+    }
+
+    return lines_count;
+}
+
+static nlohmann::ordered_json latency_histogram_to_json(const LatencyHistogramResults &latency)
+{
+    return nlohmann::ordered_json{
+        {"count", latency.count},
+        {"min_ms", latency.min_ms},
+        {"mean_ms", latency.mean_ms},
+        {"p50_ms", latency.p50_ms},
+        {"p90_ms", latency.p90_ms},
+        {"p99_ms", latency.p99_ms},
+        {"p999_ms", latency.p999_ms},
+        {"max_ms", latency.max_ms}
+    };
 }
 
 void NetworkLiveTrack::push_json_impl(nlohmann::ordered_json &json)
@@ -143,10 +206,36 @@ void NetworkLiveTrack::push_json_impl(nlohmann::ordered_json &json)
         if (overall_latency_measurement){
             network_group_json["overall_latency"] = InferStatsPrinter::latency_result_to_ms(*overall_latency_measurement);
         }
+        if (auto histogram = m_overall_latency_meter->get_latency_histogram()) {
+            network_group_json["overall_latency_percentiles"] = latency_histogram_to_json(histogram.value());
+        }
     }
+
+    push_pipeline_latency_json(network_group_json);
     json["network_groups"].emplace_back(network_group_json);
 }
 
+void NetworkLiveTrack::push_pipeline_latency_json(nlohmann::ordered_json &network_group_json)
+{
+    if (!m_measure_pipeline_latency || (nullptr == m_configured_infer_model)) {
+        return;
+    }
+
+    auto elements_latency = m_configured_infer_model->get_pipeline_elements_latency();
+    if (!elements_latency) {
+        return;
+    }
+
+    network_group_json["pipeline_elements_latency"] = nlohmann::ordered_json::array();
+    for (const auto &element_latency : elements_latency.value()) {
+        nlohmann::ordered_json element_json;
+        element_json["name"] = element_latency.element_name;
+        element_json["processing_time"] = latency_histogram_to_json(element_latency.processing_time);
+        element_json["wait_time"] = latency_histogram_to_json(element_latency.wait_time);
+        network_group_json["pipeline_elements_latency"].emplace_back(element_json);
+    }
+}
+
 void NetworkLiveTrack::progress()
 {
     if (!m_started) {
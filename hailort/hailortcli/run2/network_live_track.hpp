@@ -26,7 +26,8 @@ class NetworkLiveTrack : public LiveStats::Track
 public:
     NetworkLiveTrack(const std::string &name, std::shared_ptr<hailort::ConfiguredNetworkGroup> cng,
         std::shared_ptr<hailort::ConfiguredInferModel> configured_infer_model,
-        hailort::LatencyMeterPtr overall_latency_meter, bool measure_fps, const std::string &hef_path);
+        hailort::LatencyMeterPtr overall_latency_meter, bool measure_fps, bool measure_pipeline_latency,
+        const std::string &hef_path);
     virtual ~NetworkLiveTrack() = default;
     virtual hailo_status start_impl() override;
     virtual uint32_t push_text_impl(std::stringstream &ss) override;
@@ -35,9 +36,12 @@ public:
     void progress();
 
     hailort::Expected<double> get_last_measured_fps();
+    virtual hailort::Expected<uint64_t> get_frames_count() override;
 
 private:
     double get_fps();
+    uint32_t push_pipeline_latency_text(std::stringstream &ss);
+    void push_pipeline_latency_json(nlohmann::ordered_json &network_group_json);
 
     static size_t max_ng_name;
     static std::mutex mutex;
@@ -49,6 +53,7 @@ private:
     std::shared_ptr<hailort::ConfiguredInferModel> m_configured_infer_model;
     hailort::LatencyMeterPtr m_overall_latency_meter;
     const bool m_measure_fps;
+    const bool m_measure_pipeline_latency;
     const std::string &m_hef_path;
 
     double m_last_measured_fps;
@@ -74,7 +74,7 @@ hailo_status NetworkRunner::wait_for_threads(std::vector<AsyncThreadPtr<hailo_st
     return last_error_status;
 }
 
-IoParams::IoParams() : name(), input_file_path()
+IoParams::IoParams() : name(), input_file_path(), is_input_file_mapped(false)
 {
 }
 
@@ -88,8 +88,15 @@ StreamParams::StreamParams() : IoParams(), flags(HAILO_STREAM_FLAGS_NONE)
 
 NetworkParams::NetworkParams() : hef_path(), net_group_name(), vstream_params(), stream_params(),
     scheduling_algorithm(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN), multi_process_service(false),
-    batch_size(HAILO_DEFAULT_BATCH_SIZE), scheduler_threshold(0), scheduler_timeout_ms(0),
-    framerate(UNLIMITED_FRAMERATE), measure_hw_latency(false),measure_overall_latency(false)
+    batch_size(HAILO_DEFAULT_BATCH_SIZE), scheduler_threshold(0), scheduler_timeout_ms(0), scheduler_deadline_ms(0),
+    scheduler_share(HAILO_SCHEDULER_SHARE_DEFAULT), scheduler_device_mask(HAILO_SCHEDULER_ALL_DEVICES_MASK),
+    scheduler_sticky_placement(false), scheduler_pinned_device(HAILO_SCHEDULER_NO_PINNED_DEVICE),
+    scheduler_min_burst_size(HAILO_SCHEDULER_BURST_SIZE_DEFAULT),
+    scheduler_max_burst_size(HAILO_SCHEDULER_BURST_SIZE_DEFAULT),
+    scheduler_overload_policy(HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE), scheduler_max_pending_frames(0),
+    async_queue_size(0), vstream_queue_size(0),
+    framerate(UNLIMITED_FRAMERATE), arrival(), slo_fps(0), slo_max_latency_ms(0), measure_hw_latency(false),
+    measure_overall_latency(false), measure_pipeline_latency(false)
 {
 }
 
@@ -150,6 +157,9 @@ Expected<std::shared_ptr<FullAsyncNetworkRunner>> FullAsyncNetworkRunner::create
         if (params.measure_hw_latency) {
             infer_model_ptr->set_hw_latency_measurement_flags(HAILO_LATENCY_MEASURE);
         }
+        if (params.measure_pipeline_latency) {
+            infer_model_ptr->set_pipeline_elements_stats_flags(HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY);
+        }
 
         /* Pipeline Params */
         for (const auto &input_name : infer_model_ptr->get_input_names()) {
@@ -176,6 +186,10 @@ Expected<std::shared_ptr<FullAsyncNetworkRunner>> FullAsyncNetworkRunner::create
         }
 
         TRY(auto configured_model, infer_model_ptr->configure());
+        if (0 != params.async_queue_size) {
+            auto status = configured_model.set_async_queue_size(params.async_queue_size);
+            CHECK_SUCCESS_AS_EXPECTED(status);
+        }
         auto configured_infer_model_ptr = make_shared_nothrow<ConfiguredInferModel>(std::move(configured_model));
         CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -206,6 +220,9 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
 {
     // The network params passed to the NetworkRunner may be changed by this function, hence we copy them.
     auto final_net_params = params;
+    if (ArrivalProcess::TRACE == final_net_params.arrival.process) {
+        TRY(final_net_params.arrival.trace, read_arrival_trace(final_net_params.arrival.trace_path));
+    }
 
     std::shared_ptr<NetworkRunner> net_runner_ptr = nullptr;
     if (InferenceMode::FULL_ASYNC == final_net_params.mode) {
@@ -235,6 +252,30 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
             CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_threshold(final_net_params.scheduler_threshold));
             CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_timeout(std::chrono::milliseconds(final_net_params.scheduler_timeout_ms)));
             CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_priority(final_net_params.scheduler_priority));
+            if (HAILO_SCHEDULING_ALGORITHM_DEADLINE == final_net_params.scheduling_algorithm) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_deadline(
+                    std::chrono::milliseconds(final_net_params.scheduler_deadline_ms)));
+            }
+            if (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == final_net_params.scheduling_algorithm) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_share(final_net_params.scheduler_share));
+            }
+            if (HAILO_SCHEDULER_ALL_DEVICES_MASK != final_net_params.scheduler_device_mask) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_device_affinity(final_net_params.scheduler_device_mask));
+            }
+            if (final_net_params.scheduler_sticky_placement) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_sticky_placement(true));
+            }
+            if (HAILO_SCHEDULER_NO_PINNED_DEVICE != final_net_params.scheduler_pinned_device) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_pinned_device(final_net_params.scheduler_pinned_device));
+            }
+            if (HAILO_SCHEDULER_BURST_SIZE_DEFAULT != final_net_params.scheduler_max_burst_size) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_burst_size_bounds(
+                    final_net_params.scheduler_min_burst_size, final_net_params.scheduler_max_burst_size));
+            }
+            if (HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE != final_net_params.scheduler_overload_policy) {
+                CHECK_SUCCESS_AS_EXPECTED(cfgr_net_group->set_scheduler_overload_policy(
+                    final_net_params.scheduler_overload_policy, final_net_params.scheduler_max_pending_frames));
+            }
         }
 
         switch (final_net_params.mode)
@@ -245,7 +286,7 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
             for (auto &vstream_params : final_net_params.vstream_params) {
                 vstreams_params.emplace(vstream_params.name, vstream_params.params);
             }
-            TRY(auto vstreams, create_vstreams(*cfgr_net_group, vstreams_params));
+            TRY(auto vstreams, create_vstreams(*cfgr_net_group, vstreams_params, final_net_params.vstream_queue_size));
 
             auto net_runner = make_shared_nothrow<FullSyncNetworkRunner>(final_net_params, net_group_name, vdevice,
                 std::move(vstreams.first), std::move(vstreams.second), cfgr_net_group);
@@ -295,9 +336,47 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
         }
     }
 
+    if (final_net_params.arrival.is_open_loop()) {
+        CHECK_SUCCESS_AS_EXPECTED(net_runner_ptr->create_open_loop_latency_meter());
+    }
+
     return net_runner_ptr;
 }
 
+hailo_status NetworkRunner::create_open_loop_latency_meter()
+{
+    assert(!m_overall_latency_meter);
+    const auto input_names = get_input_names();
+    if (1 != input_names.size()) {
+        // The frames of each input arrive separately, so there is no single arrival time to measure from
+        LOGGER__WARNING("Latency isn't measured for network {} running open loop, as it has multiple inputs", m_name);
+        return HAILO_SUCCESS;
+    }
+
+    // In full async mode there is a single callback per frame
+    const auto output_names = (InferenceMode::FULL_ASYNC == m_params.mode) ?
+        std::set<std::string>{ "INFERENCE" } : get_output_names();
+    // Frames aren't sent one at a time as in the closed loop latency measurement, many may be in flight
+    m_overall_latency_meter = make_shared_nothrow<LatencyMeter>(output_names, OPEN_LOOP_LATENCY_TIMESTAMPS_LIST_LENGTH);
+    CHECK_NOT_NULL(m_overall_latency_meter, HAILO_OUT_OF_HOST_MEMORY);
+    return HAILO_SUCCESS;
+}
+
+LatencyMeterPtr NetworkRunner::get_overall_latency_meter()
+{
+    return m_overall_latency_meter;
+}
+
+const std::string &NetworkRunner::get_name() const
+{
+    return m_name;
+}
+
+double NetworkRunner::get_arrival_rate() const
+{
+    return ::get_arrival_rate(m_params.framerate, m_params.arrival);
+}
+
 bool NetworkRunner::inference_succeeded(hailo_status status)
 {
     const auto status_find_result = std::find(NetworkRunner::ALLOWED_INFERENCE_RETURN_VALUES.cbegin(),
@@ -322,7 +401,8 @@ hailo_status NetworkRunner::run(EventPtr shutdown_event, LiveStats &live_stats,
 
     // If we measure latency (hw or overall) we send frames one at a time. Hence we don't measure fps.
     const auto measure_fps = !m_params.measure_hw_latency && !m_params.measure_overall_latency;
-    auto net_live_track = std::make_shared<NetworkLiveTrack>(m_name, m_cng, m_configured_infer_model, m_overall_latency_meter, measure_fps, m_params.hef_path);
+    auto net_live_track = std::make_shared<NetworkLiveTrack>(m_name, m_cng, m_configured_infer_model, m_overall_latency_meter, measure_fps,
+        m_params.measure_pipeline_latency, m_params.hef_path);
     live_stats.add(net_live_track, 1); //support progress over multiple outputs
 
 #if defined(_MSC_VER)
@@ -368,7 +448,7 @@ double NetworkRunner::get_last_measured_fps()
 }
 
 Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> NetworkRunner::create_vstreams(
-    ConfiguredNetworkGroup &net_group, const std::map<std::string, hailo_vstream_params_t> &params)
+    ConfiguredNetworkGroup &net_group, const std::map<std::string, hailo_vstream_params_t> &params, uint32_t queue_size)
 {//TODO: support network name
     size_t match_count = 0;
 
@@ -396,6 +476,15 @@ Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> Netwo
 
     CHECK(match_count == params.size(), make_unexpected(HAILO_INVALID_ARGUMENT), "One of the params has an invalid vStream name");
 
+    if (0 != queue_size) {
+        for (auto &name_params_pair : input_vstreams_params) {
+            name_params_pair.second.queue_size = queue_size;
+        }
+        for (auto &name_params_pair : output_vstreams_params) {
+            name_params_pair.second.queue_size = queue_size;
+        }
+    }
+
     TRY(auto input_vstreams, VStreamsBuilder::create_input_vstreams(net_group, input_vstreams_params));
     TRY(auto output_vstreams, VStreamsBuilder::create_output_vstreams(net_group, output_vstreams_params));
 
@@ -423,7 +512,7 @@ Expected<std::vector<AsyncThreadPtr<hailo_status>>> FullSyncNetworkRunner::start
     for (auto &input_vstream : m_input_vstreams) {
         const auto vstream_params = get_params(input_vstream.name());
         TRY(auto writer, WriterWrapper<InputVStream>::create(input_vstream, vstream_params, m_vdevice,
-            m_overall_latency_meter, m_params.framerate, SYNC_API));
+            m_overall_latency_meter, m_params.framerate, m_params.arrival, SYNC_API));
 
         threads.emplace_back(std::make_unique<AsyncThread<hailo_status>>("WRITE",
             [this, writer, shutdown_event]() mutable {
@@ -522,14 +611,21 @@ VStreamParams FullAsyncNetworkRunner::get_params(const std::string &name)
 }
 
 Expected<AsyncInferJob> FullAsyncNetworkRunner::create_infer_job(const ConfiguredInferModel::Bindings &bindings,
-    std::weak_ptr<NetworkLiveTrack> net_live_track_weak, FramerateThrottle &frame_rate_throttle, hailo_status &inference_status)
+    std::weak_ptr<NetworkLiveTrack> net_live_track_weak, FramerateThrottle &frame_rate_throttle,
+    std::chrono::steady_clock::time_point arrival_time, hailo_status &inference_status)
 {
     frame_rate_throttle.throttle();
     if (m_overall_latency_meter) {
-        m_overall_latency_meter->add_start_sample(std::chrono::steady_clock::now().time_since_epoch());
+        // On open loop, the latency is measured from the frame's arrival (including the wait for the model to be ready)
+        const auto start_time = m_params.arrival.is_open_loop() ? arrival_time : std::chrono::steady_clock::now();
+        m_overall_latency_meter->add_start_sample(start_time.time_since_epoch());
     }
 
     TRY(auto job, m_configured_infer_model->run_async(bindings, [=, &inference_status] (const AsyncInferCompletionInfo &completion_info) {
+        if ((HAILO_FRAME_DROPPED == completion_info.status) || (HAILO_QUEUE_IS_FULL == completion_info.status)) {
+            // The frame was shed by the scheduler overload policy
+            return;
+        }
         if (HAILO_SUCCESS != completion_info.status) {
             inference_status = completion_info.status;
             if (HAILO_STREAM_ABORT != completion_info.status) {
@@ -564,6 +660,43 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
 
         status = m_configured_infer_model->set_scheduler_priority(m_params.scheduler_priority);
         CHECK_SUCCESS(status);
+
+        if (HAILO_SCHEDULING_ALGORITHM_DEADLINE == m_params.scheduling_algorithm) {
+            status = m_configured_infer_model->set_scheduler_deadline(std::chrono::milliseconds(m_params.scheduler_deadline_ms));
+            CHECK_SUCCESS(status);
+        }
+
+        if (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == m_params.scheduling_algorithm) {
+            status = m_configured_infer_model->set_scheduler_share(m_params.scheduler_share);
+            CHECK_SUCCESS(status);
+        }
+
+        if (HAILO_SCHEDULER_ALL_DEVICES_MASK != m_params.scheduler_device_mask) {
+            status = m_configured_infer_model->set_scheduler_device_affinity(m_params.scheduler_device_mask);
+            CHECK_SUCCESS(status);
+        }
+
+        if (m_params.scheduler_sticky_placement) {
+            status = m_configured_infer_model->set_scheduler_sticky_placement(true);
+            CHECK_SUCCESS(status);
+        }
+
+        if (HAILO_SCHEDULER_NO_PINNED_DEVICE != m_params.scheduler_pinned_device) {
+            status = m_configured_infer_model->set_scheduler_pinned_device(m_params.scheduler_pinned_device);
+            CHECK_SUCCESS(status);
+        }
+
+        if (HAILO_SCHEDULER_BURST_SIZE_DEFAULT != m_params.scheduler_max_burst_size) {
+            status = m_configured_infer_model->set_scheduler_burst_size_bounds(m_params.scheduler_min_burst_size,
+                m_params.scheduler_max_burst_size);
+            CHECK_SUCCESS(status);
+        }
+
+        if (HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE != m_params.scheduler_overload_policy) {
+            status = m_configured_infer_model->set_scheduler_overload_policy(m_params.scheduler_overload_policy,
+                m_params.scheduler_max_pending_frames);
+            CHECK_SUCCESS(status);
+        }
     } else {
         TRY(guard, ConfiguredInferModelActivationGuard::create(m_configured_infer_model));
     }
@@ -571,6 +704,8 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
     TRY(auto bindings, m_configured_infer_model->create_bindings());
 
     std::unordered_map<std::string, Buffer> input_buffers; // Keys are inputs names
+    // The inputs whose files are mapped - their input_buffers are staging buffers the frames are copied into
+    std::unordered_map<std::string, std::shared_ptr<MappedDataset>> mapped_datasets;
     std::vector<Buffer> output_buffers;
     std::vector<DmaMappedBuffer> dma_mapped_buffers;
 
@@ -580,7 +715,15 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
 
         auto params = get_params(name);
         Buffer buffer {};
-        if (params.input_file_path.empty()) {
+        if (params.is_input_file_mapped) {
+            CHECK(!params.input_file_path.empty(), HAILO_INVALID_ARGUMENT,
+                "Mapping the input file of {} requires an input file", name);
+            TRY(auto mapped_dataset, MappedDataset::create(params.input_file_path, input_config.get_frame_size()));
+            mapped_datasets.emplace(name, std::move(mapped_dataset));
+            // A staging buffer is reused only once the frame sent from it was inferred
+            TRY(const auto queue_size, m_configured_infer_model->get_async_queue_size());
+            TRY(buffer, Buffer::create(input_config.get_frame_size() * (queue_size + 1), BufferStorageParams::create_dma()));
+        } else if (params.input_file_path.empty()) {
             TRY(buffer, Buffer::create(input_config.get_frame_size(), const_byte, BufferStorageParams::create_dma()));
         } else {
             TRY(buffer, read_binary_file(params.input_file_path, BufferStorageParams::create_dma()));
@@ -589,7 +732,7 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
             "Size of data for input '{}' must be a multiple of the frame size {}. Received - {}", name, input_config.get_frame_size(), buffer.size());
         input_buffers.emplace(name, std::move(buffer));
 
-        for (uint32_t i = 0; i < (input_buffers.at(name).size() % input_config.get_frame_size()); i++) {
+        for (uint32_t i = 0; i < (input_buffers.at(name).size() / input_config.get_frame_size()); i++) {
             TRY(auto mapped_buffer, DmaMappedBuffer::create(m_vdevice, input_buffers.at(name).data() + (i * input_config.get_frame_size()),
                 input_config.get_frame_size(), HAILO_DMA_BUFFER_DIRECTION_H2D));
             dma_mapped_buffers.emplace_back(std::move(mapped_buffer));
@@ -608,7 +751,7 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
         CHECK_SUCCESS(bindings.output(name)->set_buffer(MemoryView(output_buffers.back())));
     }
 
-    FramerateThrottle frame_rate_throttle(m_params.framerate);
+    FramerateThrottle frame_rate_throttle(m_params.framerate, m_params.arrival);
 
     AsyncInferJob last_job;
     auto inference_status = HAILO_SUCCESS;
@@ -618,12 +761,17 @@ hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shut
             for (const auto &name : get_input_names()) {
                 TRY(auto input_config, m_infer_model->input(name));
                 auto offset = (frame_id % (input_buffers.at(name).size() / input_config.get_frame_size())) * input_config.get_frame_size();
+                if (contains(mapped_datasets, name)) {
+                    mapped_datasets.at(name)->copy_next_frame(input_buffers.at(name).data() + offset);
+                }
                 CHECK_SUCCESS(bindings.input(name)->set_buffer(MemoryView(input_buffers.at(name).data() + offset,
                     input_config.get_frame_size())));
             }
             frame_id++;
+            const auto arrival_time = frame_rate_throttle.wait_for_arrival();
             if (HAILO_SUCCESS == m_configured_infer_model->wait_for_async_ready(DEFAULT_TRANSFER_TIMEOUT)) {
-                TRY(last_job, create_infer_job(bindings, net_live_track, frame_rate_throttle, inference_status));
+                TRY(last_job, create_infer_job(bindings, net_live_track, frame_rate_throttle, arrival_time,
+                    inference_status));
                 last_job.detach();
             }
         }
@@ -655,7 +803,7 @@ Expected<std::vector<AsyncThreadPtr<hailo_status>>> RawNetworkRunner::start_infe
     for (auto &input_stream : m_input_streams) {
         const auto stream_params = get_params(input_stream.get().name());
         TRY(auto writer, WriterWrapper<InputStream>::create(input_stream.get(), stream_params, m_vdevice,
-            m_overall_latency_meter, m_params.framerate, async_streams));
+            m_overall_latency_meter, m_params.framerate, m_params.arrival, async_streams));
 
         if (async_streams) {
             threads.emplace_back(std::make_unique<AsyncThread<hailo_status>>("WRITE_ASYNC",
@@ -718,7 +866,7 @@ hailo_status RawNetworkRunner::run_single_thread_async_infer(EventPtr shutdown_e
     std::vector<SemaphorePtr> input_semaphores;
     for (auto &input_stream : m_input_streams) {
         TRY(auto writer_wrapper, WriterWrapper<InputStream>::create(input_stream.get(),
-            get_params(input_stream.get().name()), m_vdevice, m_overall_latency_meter, m_params.framerate, ASYNC_API));
+            get_params(input_stream.get().name()), m_vdevice, m_overall_latency_meter, m_params.framerate, m_params.arrival, ASYNC_API));
 
         TRY(auto max_queue_size, writer_wrapper->get().get_async_max_queue_size());
         TRY(auto semaphore, Semaphore::create_shared(static_cast<uint32_t>(max_queue_size)));
@@ -34,6 +34,7 @@
 using namespace hailort;
 
 constexpr std::chrono::milliseconds SYNC_EVENT_TIMEOUT(1000);
+constexpr size_t OPEN_LOOP_LATENCY_TIMESTAMPS_LIST_LENGTH(4096);
 
 
 enum class InferenceMode {
@@ -51,6 +52,8 @@ struct IoParams
 
     std::string name;
     std::string input_file_path;
+    // The input file is mapped to memory and streamed frame by frame, instead of being loaded (see MappedDataset)
+    bool is_input_file_mapped;
 };
 
 struct VStreamParams : public IoParams
@@ -83,12 +86,30 @@ struct NetworkParams
     uint32_t scheduler_threshold;
     uint32_t scheduler_timeout_ms;
     uint8_t scheduler_priority;
+    uint32_t scheduler_deadline_ms;
+    uint32_t scheduler_share;
+    uint64_t scheduler_device_mask;
+    bool scheduler_sticky_placement;
+    uint32_t scheduler_pinned_device;
+    uint32_t scheduler_min_burst_size;
+    uint32_t scheduler_max_burst_size;
+    hailo_scheduler_overload_policy_t scheduler_overload_policy;
+    uint32_t scheduler_max_pending_frames;
+    // The async queue size of the model on full_async mode (0 keeps the model's default, its max queue size)
+    uint32_t async_queue_size;
+    // The queue size (the buffers pool size) of the vstreams on full_sync mode (0 keeps the default of each vstream)
+    uint32_t vstream_queue_size;
 
     // Run parameters
     uint32_t framerate;
+    ArrivalParams arrival;
+    // The network's service level objectives (0 means no objective)
+    double slo_fps;
+    double slo_max_latency_ms;
 
     bool measure_hw_latency;
     bool measure_overall_latency;
+    bool measure_pipeline_latency;
     InferenceMode mode;
 
     bool is_async() const
@@ -133,6 +154,11 @@ public:
     // Must be called prior to run
     void set_overall_latency_meter(LatencyMeterPtr latency_meter);
     void set_latency_barrier(BarrierPtr latency_barrier);
+    // The latency meter of the frames end to end (the sojourn time from the frame's arrival on open loop), or nullptr
+    LatencyMeterPtr get_overall_latency_meter();
+    const std::string &get_name() const;
+    // The average amount of frames arriving per second on open loop (0 for closed loop)
+    double get_arrival_rate() const;
     std::shared_ptr<ConfiguredNetworkGroup> get_configured_network_group();
     void set_last_measured_fps(double fps);
     double get_last_measured_fps();
@@ -140,6 +166,7 @@ public:
 protected:
     static bool inference_succeeded(hailo_status status);
     static Expected<std::string> get_network_group_name(const NetworkParams &params, const Hef &hef);
+    hailo_status create_open_loop_latency_meter();
     // Use 'inference_succeeded(async_thread->get())' to check for a thread's success
     virtual Expected<std::vector<AsyncThreadPtr<hailo_status>>> start_inference_threads(EventPtr shutdown_event,
         std::shared_ptr<NetworkLiveTrack> net_live_track) = 0;
@@ -149,8 +176,10 @@ protected:
     virtual std::set<std::string> get_input_names() = 0;
     virtual std::set<std::string> get_output_names() = 0;
 
+    // A non zero queue_size overrides the queue size of all the vstreams
     static Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> create_vstreams(
-        ConfiguredNetworkGroup &net_group, const std::map<std::string, hailo_vstream_params_t> &params);
+        ConfiguredNetworkGroup &net_group, const std::map<std::string, hailo_vstream_params_t> &params,
+        uint32_t queue_size);
 
     template <typename Writer>
     hailo_status run_write(WriterWrapperPtr<Writer> writer, EventPtr shutdown_event,
@@ -399,7 +428,8 @@ public:
     virtual hailo_status run_single_thread_async_infer(EventPtr, std::shared_ptr<NetworkLiveTrack>) override;
 
     Expected<AsyncInferJob> create_infer_job(const ConfiguredInferModel::Bindings &bindings,
-        std::weak_ptr<NetworkLiveTrack> net_live_track, FramerateThrottle &frame_rate_throttle, hailo_status &inference_status);
+        std::weak_ptr<NetworkLiveTrack> net_live_track, FramerateThrottle &frame_rate_throttle,
+        std::chrono::steady_clock::time_point arrival_time, hailo_status &inference_status);
 
     virtual void stop() override;
     virtual std::set<std::string> get_input_names() override;
@@ -11,25 +11,39 @@
 #include "live_stats.hpp"
 #include "timer_live_track.hpp"
 #include "measurement_live_track.hpp"
+#include "host_cpu_live_track.hpp"
 #include "network_runner.hpp"
 
 #include "common/barrier.hpp"
 #include "common/async_thread.hpp"
+#include "common/filesystem.hpp"
+#include "common/os_utils.hpp"
+#include "utils/profiler/monitor_handler.hpp"
+#include "../mon_command.hpp"
 #include "../common.hpp"
 #include "hailo/vdevice.hpp"
 #include "hailo/hef.hpp"
 #include "../download_action_list_command.hpp"
 
+#include <fstream>
+#include <map>
 #include <memory>
+#include <thread>
 #include <vector>
 #include <regex>
 
 using namespace hailort;
 
 constexpr uint32_t DEFAULT_TIME_TO_RUN_SECONDS = 5;
+constexpr double DEFAULT_SLO_ATTAINMENT_PERCENT = 99.0;
+// The measured fps may be below the offered fps by up to this fraction and still meet the fps objective
+constexpr double SLO_FPS_TOLERANCE = 0.01;
+constexpr std::chrono::milliseconds SCHEDULER_MON_PUBLISH_EPSILON(500);
 
 static const char *JSON_SUFFIX = ".json";
+static const char *CSV_SUFFIX = ".csv";
 static const char *RUNTIME_DATA_OUTPUT_PATH_HEF_PLACE_HOLDER = "<hef>";
+static const char *TUNED_CONFIG_NETWORKS_KEY = "networks";
 static const std::vector<uint16_t> DEFAULT_BATCH_SIZES = {1, 2, 4, 8, 16};
 static const uint16_t RUNTIME_DATA_BATCH_INDEX_TO_MEASURE_DEFAULT = 2;
 
@@ -177,6 +191,9 @@ VStreamApp::VStreamApp(const std::string &description, const std::string &name,
     add_option("--input-file", m_vstream_params.input_file_path,
         "Input file path. If not given, random data will be used. File format should be raw binary data with size that is a factor of the input shape size")
         ->default_val("");
+    add_flag("--mmap-input-file", m_vstream_params.is_input_file_mapped,
+        "Map the input file to memory and stream its frames one by one, instead of loading it (for datasets larger than the RAM). "
+        "The file may also be a .npy file");
 
     auto format_opt_group = add_option_group("Format");
     format_opt_group->add_option("--type", m_vstream_params.params.user_buffer_format.type, "Format type")
@@ -184,7 +201,8 @@ VStreamApp::VStreamApp(const std::string &description, const std::string &name,
             { "auto", HAILO_FORMAT_TYPE_AUTO },
             { "uint8", HAILO_FORMAT_TYPE_UINT8 },
             { "uint16", HAILO_FORMAT_TYPE_UINT16 },
-            { "float32", HAILO_FORMAT_TYPE_FLOAT32 }
+            { "float32", HAILO_FORMAT_TYPE_FLOAT32 },
+            { "float16", HAILO_FORMAT_TYPE_FLOAT16 }
         }))
         ->default_val("auto");
 
@@ -236,6 +254,9 @@ StreamApp::StreamApp(const std::string &description, const std::string &name, CL
     add_option("--input-file", m_stream_params.input_file_path,
         "Input file path. If not given, random data will be used. File format should be raw binary data with size that is a factor of the input shape size")
         ->default_val("");
+    add_flag("--mmap-input-file", m_stream_params.is_input_file_mapped,
+        "Map the input file to memory and stream its frames one by one, instead of loading it (for datasets larger than the RAM). "
+        "The file may also be a .npy file");
 }
 
 /** NetworkGroupNameValidator */
@@ -274,9 +295,71 @@ NetworkApp::NetworkApp(const std::string &description, const std::string &name)
     net_params->add_option("--scheduler-threshold", m_params.scheduler_threshold, "Scheduler threshold")->default_val(0);
     net_params->add_option("--scheduler-timeout", m_params.scheduler_timeout_ms, "Scheduler timeout in milliseconds")->default_val(0);
     net_params->add_option("--scheduler-priority", m_params.scheduler_priority, "Scheduler priority")->default_val(HAILO_SCHEDULER_PRIORITY_NORMAL);
+    net_params->add_option("--scheduler-deadline", m_params.scheduler_deadline_ms,
+        "Scheduler deadline in milliseconds (used with the deadline scheduling algorithm, 0 means no deadline)")->default_val(0);
+    net_params->add_option("--scheduler-share", m_params.scheduler_share,
+        "Scheduler share of the device time (used with the fair_share scheduling algorithm)")
+        ->check(CLI::PositiveNumber)->default_val(HAILO_SCHEDULER_SHARE_DEFAULT);
+    net_params->add_option("--scheduler-device-mask", m_params.scheduler_device_mask,
+        "Mask of the vdevice devices the network may run on (bit i is the i-th device)")
+        ->default_val(HAILO_SCHEDULER_ALL_DEVICES_MASK);
+    net_params->add_flag("--scheduler-sticky", m_params.scheduler_sticky_placement,
+        "Don't load the network on a device while another device holds it (unless the device has nothing else to run)");
+    net_params->add_option("--scheduler-pinned-device", m_params.scheduler_pinned_device,
+        "Index of a vdevice device the network owns (it runs only the network, streaming without scheduling decisions)");
+    auto scheduler_max_burst = net_params->add_option("--scheduler-max-burst", m_params.scheduler_max_burst_size,
+        "Max frames streamed to a device before switching (the burst adapts to the traffic, down to --scheduler-min-burst)")
+        ->check(CLI::PositiveNumber);
+    net_params->add_option("--scheduler-min-burst", m_params.scheduler_min_burst_size,
+        "Min frames streamed to a device before switching")
+        ->check(CLI::PositiveNumber)->needs(scheduler_max_burst)->default_val(1);
+    auto scheduler_max_pending = net_params->add_option("--scheduler-max-pending", m_params.scheduler_max_pending_frames,
+        "Frames that may wait for a device before the scheduler overload policy applies")
+        ->check(CLI::PositiveNumber);
+    net_params->add_option("--scheduler-overload-policy", m_params.scheduler_overload_policy,
+        "What the scheduler does with a new frame once --scheduler-max-pending frames wait for a device")
+        ->transform(HailoCheckedTransformer<hailo_scheduler_overload_policy_t>({
+            { "queue", HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE },
+            { "drop_oldest", HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_OLDEST },
+            { "drop_newest", HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_NEWEST },
+            { "reject", HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT }
+        }))
+        ->needs(scheduler_max_pending)
+        ->default_val("queue");
+    net_params->add_option("--async-queue-size", m_params.async_queue_size,
+        "Inferences queued simultaneously on full_async mode (0 means the max async queue size of the model)")
+        ->default_val(0);
+    net_params->add_option("--vstream-queue-size", m_params.vstream_queue_size,
+        "Queue size (the buffers pool size) of the vstreams on full_sync mode (0 means the default of each vstream)")
+        ->default_val(0);
 
     auto run_params = add_option_group("Run Parameters");
     run_params->add_option("--framerate", m_params.framerate, "Input vStreams framerate")->default_val(UNLIMITED_FRAMERATE);
+    run_params->add_option("--arrival", m_params.arrival.process,
+        "Frames arrival process. closed_loop sends each frame once the previous one was sent, the open loop processes "
+        "send the frames at their arrival time (at the --framerate rate, or read from --arrival-trace) regardless of "
+        "the device's progress, and measure the latency from the arrival")
+        ->transform(HailoCheckedTransformer<ArrivalProcess>({
+            { "closed_loop", ArrivalProcess::CLOSED_LOOP },
+            { "uniform", ArrivalProcess::UNIFORM },
+            { "poisson", ArrivalProcess::POISSON },
+            { "trace", ArrivalProcess::TRACE }
+        }))
+        ->default_val("closed_loop");
+    run_params->add_option("--arrival-trace", m_params.arrival.trace_path,
+        "Arrival times file (used with --arrival=trace) - the arrival time in milliseconds from the start in each line, "
+        "replayed cyclically")
+        ->check(CLI::ExistingFile);
+
+    auto slo_params = add_option_group("Service Level Objectives");
+    slo_params->add_option("--slo-fps", m_params.slo_fps,
+        "The fps the network must sustain (multiplied by the load factor on --load-sweep). Also the arrival rate if "
+        "--framerate isn't set")
+        ->check(CLI::PositiveNumber);
+    slo_params->add_option("--slo-max-latency", m_params.slo_max_latency_ms,
+        "Max latency in milliseconds of --slo-attainment percent of the frames (the latency from the arrival, so open "
+        "loop arrival is required)")
+        ->check(CLI::PositiveNumber);
 
     auto vstream_subcommand = add_io_app_subcom<VStreamApp>("Set vStream", "set-vstream", hef_path_option, net_group_name_option);
     auto stream_subcommand = add_io_app_subcom<StreamApp>("Set Stream", "set-stream", hef_path_option, net_group_name_option);
@@ -290,64 +373,7 @@ const NetworkParams& NetworkApp::get_params()
     return m_params;
 }
 
-/** Run2 */
-class Run2 : public CLI::App
-{
-public:
-    Run2();
-
-    Expected<std::unique_ptr<VDevice>> create_vdevice();
-    Expected<std::vector<std::shared_ptr<NetworkRunner>>> init_and_run_net_runners(VDevice *vdevice);
-
-    const std::vector<NetworkParams>& get_network_params();
-    std::chrono::seconds get_time_to_run();
-    std::vector<hailo_device_id_t> get_dev_ids();
-    uint32_t get_device_count();
-    bool get_measure_power();
-    bool get_measure_current();
-    bool get_measure_temp();
-    bool get_measure_hw_latency();
-    bool get_measure_overall_latency();
-    bool get_multi_process_service();
-    bool get_measure_fw_actions();
-    std::string get_measure_fw_actions_output_path();
-    const std::string &get_group_id();
-    InferenceMode get_mode() const;
-    const std::string &get_output_json_path();
-
-    void update_network_params();
-    void set_batch_size(uint16_t batch_size);
-
-private:
-    void add_measure_fw_actions_subcom();
-    void add_net_app_subcom();
-
-    bool is_ethernet_device() const;
-    void validate_and_set_scheduling_algorithm();
-    void validate_mode_supports_service();
-
-    std::vector<NetworkParams> m_network_params;
-    uint32_t m_time_to_run;
-    InferenceMode m_mode;
-    hailo_scheduling_algorithm_t m_scheduling_algorithm = HAILO_SCHEDULING_ALGORITHM_MAX_ENUM;
-    std::string m_stats_json_path;
-    std::vector<std::string> m_device_ids;
-    uint32_t m_device_count;
-    bool m_multi_process_service;
-    std::string m_group_id;
-
-    bool m_measure_hw_latency;
-    bool m_measure_overall_latency;
-
-    bool m_measure_power;
-    bool m_measure_current;
-    bool m_measure_temp;
-
-    bool m_measure_fw_actions;
-    std::string m_measure_fw_actions_output_path;
-};
-
-Run2::Run2() : CLI::App("Run networks", "run2")
+Run2::Run2(const std::string &description, const std::string &name) : CLI::App(description, name)
 {
     add_measure_fw_actions_subcom();
     add_net_app_subcom();
@@ -372,6 +398,8 @@ Run2::Run2() : CLI::App("Run networks", "run2")
     add_option("--scheduling-algorithm", m_scheduling_algorithm, "Scheduling algorithm")
         ->transform(HailoCheckedTransformer<hailo_scheduling_algorithm_t>({
             { "round_robin", HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN },
+            { "deadline", HAILO_SCHEDULING_ALGORITHM_DEADLINE },
+            { "fair_share", HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE },
             { "none", HAILO_SCHEDULING_ALGORITHM_NONE },
         }));
 
@@ -404,9 +432,43 @@ Run2::Run2() : CLI::App("Run networks", "run2")
     measurement_options_group->add_flag("--measure-overall-latency", m_measure_overall_latency, "Measure overall latency measurement")
         ->default_val(false);
 
+    measurement_options_group->add_flag("--measure-pipeline-latency", m_measure_pipeline_latency,
+        "Measure the processing and queue wait time percentiles of each infer pipeline element (full_async mode only)")
+        ->default_val(false);
+
     auto measure_temp_opt = measurement_options_group->add_flag("--measure-temp", m_measure_temp, "Measure chip temperature")
         ->default_val(false);
 
+    measurement_options_group->add_flag("--measure-host-cpu", m_measure_host_cpu,
+        "Measure the host CPU time and context switches per frame, by the role of the threads (Linux only)")
+        ->default_val(false);
+
+    auto load_options_group = add_option_group("Open Loop Load Options");
+    auto load_sweep_opt = load_options_group->add_option("--load-sweep", m_load_sweep,
+        "Runs for --time-to-run at each of the given load factors (multiplying the arrival rate of each network, which "
+        "must run open loop - see set-net --arrival), and reports the throughput and latency percentiles of each")
+        ->check(CLI::PositiveNumber)
+        ->delimiter(',');
+    load_options_group->add_option("--load-sweep-csv", m_load_sweep_csv_path, "If set save the load sweep results as csv to the specified path")
+        ->default_val("")
+        ->needs(load_sweep_opt)
+        ->check(FileSuffixValidator(CSV_SUFFIX));
+    load_options_group->add_option("--arrival-seed", m_arrival_seed,
+        "Seed of the poisson arrival process (each network gets the seed plus its index)")
+        ->default_val(0);
+
+    auto slo_options_group = add_option_group("SLO Options");
+    slo_options_group->add_option("--slo-attainment", m_slo_attainment_percent,
+        "Percent of the frames that must meet the --slo-max-latency of their network. The service level objectives "
+        "(set with set-net --slo-fps/--slo-max-latency) are reported after the run (after each load factor on --load-sweep)")
+        ->check(CLI::Range(0.0, 100.0))
+        ->default_val(DEFAULT_SLO_ATTAINMENT_PERCENT);
+
+    add_option("--tuned-config", m_tuned_config_path,
+        "Load the network parameters found by 'hailortcli autotune' (set the networks in the order they were tuned)")
+        ->check(FileSuffixValidator(JSON_SUFFIX))
+        ->check(CLI::ExistingFile);
+
     if (VDevice::service_over_ip_mode()) {
         multi_process_flag
         ->excludes(measure_power_opt)
@@ -493,6 +555,11 @@ bool Run2::get_measure_temp()
     return m_measure_temp;
 }
 
+bool Run2::get_measure_host_cpu()
+{
+    return m_measure_host_cpu;
+}
+
 bool Run2::get_measure_hw_latency()
 {
     return m_measure_hw_latency;
@@ -528,7 +595,92 @@ void Run2::update_network_params()
         params.multi_process_service = m_multi_process_service;
         params.measure_hw_latency = m_measure_hw_latency;
         params.measure_overall_latency = m_measure_overall_latency;
+        params.measure_pipeline_latency = m_measure_pipeline_latency;
         params.scheduling_algorithm = m_scheduling_algorithm;
+        params.arrival.seed = m_arrival_seed + static_cast<uint32_t>(&params - m_network_params.data());
+        if ((0 < params.slo_fps) && (UNLIMITED_FRAMERATE == params.framerate)) {
+            params.framerate = static_cast<uint32_t>(std::ceil(params.slo_fps));
+        }
+    }
+}
+
+void Run2::set_network_params(const std::vector<NetworkParams> &network_params)
+{
+    m_network_params = network_params;
+}
+
+const std::string &Run2::get_tuned_config_path() const
+{
+    return m_tuned_config_path;
+}
+
+static Expected<ordered_json> read_json_file(const std::string &path)
+{
+    std::ifstream json_file(path);
+    CHECK_AS_EXPECTED(json_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening json file {}", path);
+
+    ordered_json res;
+    json_file >> res;
+    CHECK_AS_EXPECTED(json_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed reading json file {}", path);
+    return res;
+}
+
+hailo_status Run2::load_tuned_config()
+{
+    TRY(const auto tuned_config, read_json_file(m_tuned_config_path));
+    CHECK(tuned_config.contains(TUNED_CONFIG_NETWORKS_KEY), HAILO_INVALID_ARGUMENT,
+        "Tuned config {} has no '{}'", m_tuned_config_path, TUNED_CONFIG_NETWORKS_KEY);
+    const auto &networks = tuned_config[TUNED_CONFIG_NETWORKS_KEY];
+    CHECK(networks.size() == m_network_params.size(), HAILO_INVALID_ARGUMENT,
+        "Tuned config {} has {} networks, while {} networks are set", m_tuned_config_path, networks.size(),
+        m_network_params.size());
+
+    for (size_t i = 0; i < m_network_params.size(); i++) {
+        auto &params = m_network_params[i];
+        const auto &network = networks[i];
+        const auto hef_path = network.value("hef", std::string());
+        CHECK(Filesystem::basename(hef_path) == Filesystem::basename(params.hef_path), HAILO_INVALID_ARGUMENT,
+            "Network {} of the tuned config {} was tuned for {}, while {} is set", i, m_tuned_config_path, hef_path,
+            params.hef_path);
+
+        params.batch_size = network.value("batch_size", params.batch_size);
+        params.scheduler_threshold = network.value("scheduler_threshold", params.scheduler_threshold);
+        params.scheduler_timeout_ms = network.value("scheduler_timeout_ms", params.scheduler_timeout_ms);
+        params.async_queue_size = network.value("async_queue_size", params.async_queue_size);
+        params.vstream_queue_size = network.value("vstream_queue_size", params.vstream_queue_size);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status write_tuned_config(const std::vector<NetworkParams> &network_params, const std::string &path,
+    const ordered_json &results)
+{
+    ordered_json tuned_config;
+    tuned_config[TUNED_CONFIG_NETWORKS_KEY] = ordered_json::array();
+    for (const auto &params : network_params) {
+        ordered_json network;
+        network["hef"] = params.hef_path;
+        network["name"] = params.net_group_name;
+        network["batch_size"] = params.batch_size;
+        network["scheduler_threshold"] = params.scheduler_threshold;
+        network["scheduler_timeout_ms"] = params.scheduler_timeout_ms;
+        network["async_queue_size"] = params.async_queue_size;
+        network["vstream_queue_size"] = params.vstream_queue_size;
+        tuned_config[TUNED_CONFIG_NETWORKS_KEY].emplace_back(std::move(network));
+    }
+    tuned_config["results"] = results;
+
+    std::ofstream json_file(path, std::ios::out);
+    CHECK(json_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed creating json file {}", path);
+    json_file << tuned_config.dump(4) << std::endl;
+    CHECK(json_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing json file {}", path);
+    return HAILO_SUCCESS;
+}
+
+void Run2::set_load_factor(double load_factor)
+{
+    for (auto &params : m_network_params) {
+        params.arrival.load_factor = load_factor;
     }
 }
 
@@ -569,6 +721,28 @@ const std::string &Run2::get_output_json_path()
     return m_stats_json_path;
 }
 
+const std::vector<double> &Run2::get_load_sweep()
+{
+    return m_load_sweep;
+}
+
+const std::string &Run2::get_load_sweep_csv_path()
+{
+    return m_load_sweep_csv_path;
+}
+
+double Run2::get_slo_attainment() const
+{
+    return m_slo_attainment_percent / 100.0;
+}
+
+bool Run2::has_slo() const
+{
+    return std::any_of(m_network_params.begin(), m_network_params.end(), [](const NetworkParams &params) {
+        return (0 < params.slo_fps) || (0 < params.slo_max_latency_ms);
+    });
+}
+
 static bool is_valid_ip(const std::string &ip)
 {
     int a,b,c,d;
@@ -759,6 +933,14 @@ Expected<std::vector<std::shared_ptr<NetworkRunner>>> Run2::init_and_run_net_run
         }
     }
 
+    if (get_measure_host_cpu()) {
+        auto live_stats_ptr = live_stats.get();
+        TRY(auto host_cpu_live_track, HostCpuLiveTrack::create_shared([live_stats_ptr]() {
+            return live_stats_ptr->get_frames_count();
+        }));
+        live_stats->add(host_cpu_live_track, 3);
+    }
+
     CHECK_SUCCESS_AS_EXPECTED(live_stats->start());
     auto status = shutdown_event->wait(get_time_to_run());
     if (HAILO_TIMEOUT != status) {
@@ -778,6 +960,240 @@ Expected<std::vector<std::shared_ptr<NetworkRunner>>> Run2::init_and_run_net_run
     return net_runners;
 }
 
+struct LoadSweepResult
+{
+    std::string network_name;
+    double load_factor;
+    double offered_fps;
+    double fps;
+    LatencyHistogramResults latency;
+};
+
+hailo_status validate_arrival_params(Run2 &app)
+{
+    for (const auto &params : app.get_network_params()) {
+        if ((ArrivalProcess::UNIFORM == params.arrival.process) || (ArrivalProcess::POISSON == params.arrival.process)) {
+            CHECK(UNLIMITED_FRAMERATE != params.framerate, HAILO_INVALID_ARGUMENT,
+                "Open loop arrival of network {} requires the arrival rate to be set with --framerate", params.hef_path);
+        }
+        if (ArrivalProcess::TRACE == params.arrival.process) {
+            CHECK(!params.arrival.trace_path.empty(), HAILO_INVALID_ARGUMENT,
+                "--arrival=trace of network {} requires --arrival-trace", params.hef_path);
+        }
+        if (params.arrival.is_open_loop()) {
+            // Measuring latency sends one frame at a time, while on open loop the frames are sent as they arrive
+            CHECK(!(app.get_measure_hw_latency() || app.get_measure_overall_latency()), HAILO_INVALID_OPERATION,
+                "Latency measurement can't be enabled with open loop arrival (the latency from the arrival is measured anyway)");
+        }
+        CHECK(app.get_load_sweep().empty() || params.arrival.is_open_loop(), HAILO_INVALID_OPERATION,
+            "--load-sweep requires all the networks to run open loop (set with set-net --arrival)");
+        CHECK((0 == params.slo_max_latency_ms) || params.arrival.is_open_loop(), HAILO_INVALID_OPERATION,
+            "--slo-max-latency of network {} requires open loop arrival (set with set-net --arrival)", params.hef_path);
+    }
+    CHECK(app.get_load_sweep().empty() || !app.get_measure_fw_actions(), HAILO_INVALID_OPERATION,
+        "--load-sweep is not supported when measuring fw actions");
+    CHECK(!app.has_slo() || !app.get_measure_fw_actions(), HAILO_INVALID_OPERATION,
+        "Service level objectives are not supported when measuring fw actions");
+    return HAILO_SUCCESS;
+}
+
+using SchedulerSwitchesCounts = std::map<std::string, uint64_t>;
+
+// Reads the scheduler switches count of each network, from the state published by the monitor (of this process, or
+// of the service's processes when running with the multi process service)
+static Expected<SchedulerSwitchesCounts> read_scheduler_switches_counts(bool multi_process_service)
+{
+#if defined(__GNUC__)
+    if (!multi_process_service && !is_env_variable_on(SCHEDULER_MON_ENV_VAR, SCHEDULER_MON_ENV_VAR_VALUE)) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
+    MonitorStatesReader states_reader;
+    TRY(const auto mon_messages, states_reader.read(multi_process_service ? 0 : OsUtils::get_curr_pid()));
+    if (mon_messages.empty()) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
+    SchedulerSwitchesCounts switches_counts;
+    for (const auto &mon_message : mon_messages) {
+        for (const auto &network_info : mon_message.networks_infos()) {
+            switches_counts[network_info.network_name()] += network_info.scheduler_switches_count();
+        }
+    }
+    return switches_counts;
+#else
+    (void)multi_process_service;
+    return make_unexpected(HAILO_NOT_AVAILABLE);
+#endif
+}
+
+static Expected<double> get_latency_attainment(NetworkRunner &net_runner, const NetworkParams &params)
+{
+    auto latency_meter = net_runner.get_overall_latency_meter();
+    if (!latency_meter || (0 == params.slo_max_latency_ms)) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+    const auto max_latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double, std::milli>(params.slo_max_latency_ms));
+    return latency_meter->get_latency_attainment(max_latency);
+}
+
+static Expected<uint64_t> get_scheduler_switches_count(const std::string &network_name,
+    const Expected<SchedulerSwitchesCounts> &switches_counts_before, const Expected<SchedulerSwitchesCounts> &switches_counts_after)
+{
+    if (!switches_counts_before || !switches_counts_after || !contains(*switches_counts_after, network_name)) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+    const auto before = contains(*switches_counts_before, network_name) ? switches_counts_before->at(network_name) : 0;
+    return switches_counts_after->at(network_name) - before;
+}
+
+static SloResult get_slo_result(Run2 &app, NetworkRunner &net_runner, const NetworkParams &params, double load_factor,
+    const Expected<SchedulerSwitchesCounts> &switches_counts_before, const Expected<SchedulerSwitchesCounts> &switches_counts_after)
+{
+    const auto target_fps = params.slo_fps * load_factor;
+    const auto fps = net_runner.get_last_measured_fps();
+    auto latency_attainment = get_latency_attainment(net_runner, params);
+
+    bool is_met = true;
+    if (0 < target_fps) {
+        is_met &= (fps >= (target_fps * (1.0 - SLO_FPS_TOLERANCE)));
+    }
+    if (0 < params.slo_max_latency_ms) {
+        // If no latency was measured (e.g. no frame was received), the objective isn't met
+        is_met &= (latency_attainment && (*latency_attainment >= app.get_slo_attainment()));
+    }
+
+    return SloResult{net_runner.get_name(), load_factor, target_fps, fps, params.slo_max_latency_ms,
+        std::move(latency_attainment),
+        get_scheduler_switches_count(net_runner.get_name(), switches_counts_before, switches_counts_after), is_met};
+}
+
+Expected<std::vector<SloResult>> run_and_get_slo_results(Run2 &app, VDevice &vdevice, double load_factor,
+    std::vector<std::shared_ptr<NetworkRunner>> &net_runners)
+{
+    const auto switches_counts_before = read_scheduler_switches_counts(app.get_multi_process_service());
+    TRY(net_runners, app.init_and_run_net_runners(&vdevice));
+    if (switches_counts_before) {
+        // Waiting for the monitor to publish the counts of the end of the run
+        std::this_thread::sleep_for(DEFAULT_SCHEDULER_MON_INTERVAL + SCHEDULER_MON_PUBLISH_EPSILON);
+    }
+    const auto switches_counts_after = read_scheduler_switches_counts(app.get_multi_process_service());
+
+    std::vector<SloResult> results;
+    if (app.has_slo()) {
+        const auto &network_params = app.get_network_params();
+        for (size_t i = 0; i < net_runners.size(); i++) {
+            results.emplace_back(get_slo_result(app, *net_runners[i], network_params[i], load_factor,
+                switches_counts_before, switches_counts_after));
+        }
+    }
+    return results;
+}
+
+static void print_slo_results(const std::vector<SloResult> &results, double slo_attainment)
+{
+    std::cout << fmt::format("Service level objectives results (latency attainment of {:.2f}%):", slo_attainment * 100) << std::endl;
+    std::cout << fmt::format("{:<32} {:>6} {:>12} {:>10} {:>14} {:>14} {:>10} {:>8}", "network", "load", "target fps",
+        "fps", "max latency ms", "attainment %", "switches", "SLO") << std::endl;
+    for (const auto &result : results) {
+        const auto target_fps = (0 < result.target_fps) ? fmt::format("{:.2f}", result.target_fps) : "-";
+        const auto max_latency = (0 < result.max_latency_ms) ? fmt::format("{:.3f}", result.max_latency_ms) : "-";
+        const auto attainment = result.latency_attainment ? fmt::format("{:.2f}", *result.latency_attainment * 100) : "-";
+        const auto switches = result.scheduler_switches_count ? std::to_string(*result.scheduler_switches_count) : "N/A";
+        std::cout << fmt::format("{:<32} {:>6.2f} {:>12} {:>10.2f} {:>14} {:>14} {:>10} {:>8}", result.network_name,
+            result.load_factor, target_fps, result.fps, max_latency, attainment, switches,
+            result.is_met ? "met" : "missed") << std::endl;
+    }
+    const auto has_switches_count = std::any_of(results.begin(), results.end(), [](const SloResult &result) {
+        return result.scheduler_switches_count.has_value();
+    });
+    if (!has_switches_count) {
+        std::cout << "The scheduler switches are counted by the monitor, set the environment variable '" <<
+            SCHEDULER_MON_ENV_VAR << "' to 1 to count them" << std::endl;
+    }
+}
+
+static void print_load_sweep_results(const std::vector<LoadSweepResult> &results)
+{
+    std::cout << "Load sweep results:" << std::endl;
+    std::cout << fmt::format("{:<32} {:>6} {:>12} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}", "network", "load",
+        "offered fps", "fps", "p50 ms", "p90 ms", "p99 ms", "p99.9 ms", "max ms") << std::endl;
+    for (const auto &result : results) {
+        std::cout << fmt::format("{:<32} {:>6.2f} {:>12.2f} {:>10.2f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}",
+            result.network_name, result.load_factor, result.offered_fps, result.fps, result.latency.p50_ms,
+            result.latency.p90_ms, result.latency.p99_ms, result.latency.p999_ms, result.latency.max_ms) << std::endl;
+    }
+}
+
+static hailo_status write_load_sweep_results_csv(const std::vector<LoadSweepResult> &results, const std::string &path)
+{
+    std::ofstream csv_file(path, std::ios::out);
+    CHECK(csv_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed creating csv file {}", path);
+
+    csv_file << "network,load_factor,offered_fps,fps,latency_count,mean_ms,p50_ms,p90_ms,p99_ms,p999_ms,max_ms" << std::endl;
+    for (const auto &result : results) {
+        csv_file << result.network_name << "," << result.load_factor << "," << result.offered_fps << "," << result.fps << "," <<
+            result.latency.count << "," << result.latency.mean_ms << "," << result.latency.p50_ms << "," <<
+            result.latency.p90_ms << "," << result.latency.p99_ms << "," << result.latency.p999_ms << "," <<
+            result.latency.max_ms << std::endl;
+    }
+    CHECK(csv_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing csv file {}", path);
+    return HAILO_SUCCESS;
+}
+
+// Runs the networks at each load factor, so the throughput and latency percentiles can be drawn as a curve of the load.
+// With service level objectives, the max load factor at which the objectives of all the networks are met is reported.
+static hailo_status run_load_sweep(Run2 &app, VDevice &vdevice)
+{
+    std::vector<LoadSweepResult> results;
+    std::vector<SloResult> slo_results;
+    double max_sustainable_load = 0;
+    for (const auto load_factor : app.get_load_sweep()) {
+        app.set_load_factor(load_factor);
+        std::cout << fmt::format("Running at load factor {:.2f}", load_factor) << std::endl;
+
+        std::vector<std::shared_ptr<NetworkRunner>> net_runners;
+        TRY(auto load_slo_results, run_and_get_slo_results(app, vdevice, load_factor, net_runners));
+        const auto is_slo_met = std::all_of(load_slo_results.begin(), load_slo_results.end(),
+            [](const SloResult &result) { return result.is_met; });
+        if (is_slo_met) {
+            max_sustainable_load = std::max(max_sustainable_load, load_factor);
+        }
+        for (auto &slo_result : load_slo_results) {
+            slo_results.emplace_back(std::move(slo_result));
+        }
+
+        for (auto &net_runner : net_runners) {
+            LoadSweepResult result{};
+            result.network_name = net_runner->get_name();
+            result.load_factor = load_factor;
+            result.offered_fps = net_runner->get_arrival_rate();
+            result.fps = net_runner->get_last_measured_fps();
+            if (auto latency_meter = net_runner->get_overall_latency_meter()) {
+                if (auto latency = latency_meter->get_latency_histogram()) {
+                    result.latency = latency.release();
+                }
+            }
+            results.emplace_back(std::move(result));
+        }
+    }
+
+    print_load_sweep_results(results);
+    if (!app.get_load_sweep_csv_path().empty()) {
+        CHECK_SUCCESS(write_load_sweep_results_csv(results, app.get_load_sweep_csv_path()));
+    }
+    if (app.has_slo()) {
+        print_slo_results(slo_results, app.get_slo_attainment());
+        if (0 < max_sustainable_load) {
+            std::cout << fmt::format("Max sustainable load factor: {:.2f}", max_sustainable_load) << std::endl;
+        } else {
+            std::cout << "The service level objectives weren't met at any of the load factors" << std::endl;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status Run2Command::execute()
 {
     Run2 *app = reinterpret_cast<Run2*>(m_app);
@@ -785,6 +1201,9 @@ hailo_status Run2Command::execute()
     app->update_network_params();
 
     CHECK(0 < app->get_network_params().size(), HAILO_INVALID_OPERATION, "Nothing to run");
+    if (!app->get_tuned_config_path().empty()) {
+        CHECK_SUCCESS(app->load_tuned_config());
+    }
 
     if (app->get_measure_hw_latency() || app->get_measure_overall_latency()) {
         CHECK(1 == app->get_network_params().size(), HAILO_INVALID_OPERATION, "When latency measurement is enabled, only one model is allowed");
@@ -795,7 +1214,19 @@ hailo_status Run2Command::execute()
         LOGGER__WARNING("\"hailortcli run2\" is not optimized for single model usage. It is recommended to use \"hailortcli run\" command for a single model");
     }
 
+    CHECK_SUCCESS(validate_arrival_params(*app));
+
     TRY(auto vdevice, app->create_vdevice());
+    if (!app->get_load_sweep().empty()) {
+        return run_load_sweep(*app, *vdevice);
+    }
+    if (app->has_slo()) {
+        std::vector<std::shared_ptr<NetworkRunner>> net_runners;
+        TRY(const auto slo_results, run_and_get_slo_results(*app, *vdevice, 1.0, net_runners));
+        print_slo_results(slo_results, app->get_slo_attainment());
+        return HAILO_SUCCESS;
+    }
+
     std::vector<uint16_t> batch_sizes_to_run = { app->get_network_params()[0].batch_size };
     if(app->get_measure_fw_actions() && app->get_network_params()[0].batch_size == HAILO_DEFAULT_BATCH_SIZE) {
         // In case measure-fw-actions is enabled and no batch size was provided - we want to run with batch sizes 1,2,4,8,16
@@ -13,6 +13,8 @@
 #include "../command.hpp"
 #include "network_runner.hpp"
 
+#include <nlohmann/json.hpp>
+
 #include <type_traits>
 
 
@@ -91,4 +93,104 @@ private:
 };
 
 
+/** Run2 */
+class Run2 : public CLI::App
+{
+public:
+    Run2(const std::string &description = "Run networks", const std::string &name = "run2");
+
+    Expected<std::unique_ptr<VDevice>> create_vdevice();
+    Expected<std::vector<std::shared_ptr<NetworkRunner>>> init_and_run_net_runners(VDevice *vdevice);
+
+    const std::vector<NetworkParams>& get_network_params();
+    std::chrono::seconds get_time_to_run();
+    std::vector<hailo_device_id_t> get_dev_ids();
+    uint32_t get_device_count();
+    bool get_measure_power();
+    bool get_measure_current();
+    bool get_measure_temp();
+    bool get_measure_host_cpu();
+    bool get_measure_hw_latency();
+    bool get_measure_overall_latency();
+    bool get_multi_process_service();
+    bool get_measure_fw_actions();
+    std::string get_measure_fw_actions_output_path();
+    const std::string &get_group_id();
+    InferenceMode get_mode() const;
+    const std::string &get_output_json_path();
+    const std::vector<double> &get_load_sweep();
+    const std::string &get_load_sweep_csv_path();
+    double get_slo_attainment() const;
+    bool has_slo() const;
+
+    const std::string &get_tuned_config_path() const;
+
+    void update_network_params();
+    // Sets the parameters found by "hailortcli autotune" (see write_tuned_config) to the networks
+    hailo_status load_tuned_config();
+    void set_network_params(const std::vector<NetworkParams> &network_params);
+    void set_batch_size(uint16_t batch_size);
+    void set_load_factor(double load_factor);
+
+private:
+    void add_measure_fw_actions_subcom();
+    void add_net_app_subcom();
+
+    bool is_ethernet_device() const;
+    void validate_and_set_scheduling_algorithm();
+    void validate_mode_supports_service();
+
+    std::vector<NetworkParams> m_network_params;
+    uint32_t m_time_to_run;
+    InferenceMode m_mode;
+    hailo_scheduling_algorithm_t m_scheduling_algorithm = HAILO_SCHEDULING_ALGORITHM_MAX_ENUM;
+    std::string m_stats_json_path;
+    std::vector<std::string> m_device_ids;
+    uint32_t m_device_count;
+    bool m_multi_process_service;
+    std::string m_group_id;
+
+    bool m_measure_hw_latency;
+    bool m_measure_overall_latency;
+    bool m_measure_pipeline_latency;
+
+    bool m_measure_power;
+    bool m_measure_current;
+    bool m_measure_temp;
+    bool m_measure_host_cpu;
+
+    bool m_measure_fw_actions;
+    std::string m_measure_fw_actions_output_path;
+
+    std::vector<double> m_load_sweep;
+    std::string m_load_sweep_csv_path;
+    uint32_t m_arrival_seed;
+
+    double m_slo_attainment_percent;
+
+    std::string m_tuned_config_path;
+};
+
+struct SloResult
+{
+    std::string network_name;
+    double load_factor;
+    // The objectives (0 if not set) and the measured values
+    double target_fps;
+    double fps;
+    double max_latency_ms;
+    Expected<double> latency_attainment;
+    Expected<uint64_t> scheduler_switches_count;
+    bool is_met;
+};
+
+hailo_status validate_arrival_params(Run2 &app);
+// Runs the networks once, and returns the results of each network's service level objectives
+Expected<std::vector<SloResult>> run_and_get_slo_results(Run2 &app, VDevice &vdevice, double load_factor,
+    std::vector<std::shared_ptr<NetworkRunner>> &net_runners);
+// Writes the parameters of the networks that "hailortcli run2 --tuned-config" loads
+hailo_status write_tuned_config(const std::vector<NetworkParams> &network_params, const std::string &path,
+    const nlohmann::ordered_json &results);
+
+
 #endif /* _HAILO_HAILORTCLI_RUN2_RUN2_COMMAND_HPP_ */
@@ -708,6 +708,11 @@ static hailo_status run_streaming_impl(std::shared_ptr<ConfiguredNetworkGroup> c
             auto hw_latency_p = make_shared_nothrow<std::chrono::nanoseconds>(hw_latency->avg_hw_latency);
             CHECK_NOT_NULL(hw_latency_p, HAILO_OUT_OF_HOST_MEMORY);
             inference_result.m_hw_latency = std::move(hw_latency_p);
+            if (0 != hw_latency->hw_latency_histogram.count) {
+                auto hw_latency_histogram_p = make_shared_nothrow<LatencyHistogramResults>(hw_latency->hw_latency_histogram);
+                CHECK_NOT_NULL(hw_latency_histogram_p, HAILO_OUT_OF_HOST_MEMORY);
+                inference_result.m_hw_latency_histogram = std::move(hw_latency_histogram_p);
+            }
         }
     } else {
         inference_result.m_infer_duration = std::make_unique<double>(std::chrono::duration<double>(end - start).count());
@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_simulator.cpp
+ * @brief Replays a recorded scheduler workload against the scheduler oracle, using a modeled device.
+ **/
+
+#include "scheduler_simulator.hpp"
+
+#include "vdevice/scheduler/scheduler_oracle.hpp"
+#include "vdevice/scheduler/scheduler_cost_model.hpp"
+
+#include <algorithm>
+#include <limits>
+
+
+namespace hailort
+{
+
+// Frames sent by the streaming optimization on each call (as in CoreOpsScheduler)
+static const uint32_t STREAMING_BURST_SIZE = 1;
+
+Expected<SimulationResults> SchedulerSimulator::simulate(const SimulationParams &params)
+{
+    CHECK_AS_EXPECTED(!params.devices_ids.empty(), HAILO_INVALID_ARGUMENT, "No devices to simulate");
+    CHECK_AS_EXPECTED(params.devices_ids.size() == params.devices_arch.size(), HAILO_INVALID_ARGUMENT,
+        "Devices ids and archs must have the same size");
+    for (const auto &core_op_pair : params.core_ops) {
+        CHECK_AS_EXPECTED(core_op_pair.second.max_ongoing_frames > 0, HAILO_INVALID_ARGUMENT,
+            "Core op {} max ongoing frames must be larger than 0", core_op_pair.second.name);
+        CHECK_AS_EXPECTED(core_op_pair.second.share > 0, HAILO_INVALID_ARGUMENT,
+            "Core op {} share must be larger than 0", core_op_pair.second.name);
+        CHECK_AS_EXPECTED(std::is_sorted(core_op_pair.second.arrival_times.begin(),
+            core_op_pair.second.arrival_times.end()), HAILO_INVALID_ARGUMENT,
+            "Core op {} arrival times must be sorted", core_op_pair.second.name);
+    }
+
+    auto devices_ids = params.devices_ids;
+    auto devices_arch = params.devices_arch;
+    auto simulator = make_unique_nothrow<SchedulerSimulator>(params, devices_ids, devices_arch);
+    CHECK_NOT_NULL_AS_EXPECTED(simulator, HAILO_OUT_OF_HOST_MEMORY);
+    return simulator->run();
+}
+
+SchedulerSimulator::SchedulerSimulator(const SimulationParams &params, std::vector<std::string> &devices_ids,
+    std::vector<std::string> &devices_arch) :
+    SchedulerBase(params.algorithm, devices_ids, devices_arch),
+    m_switch_time(params.switch_time),
+    m_is_cost_model_enabled(params.is_cost_model_enabled),
+    m_now(),
+    m_switches_count(0)
+{
+    for (const auto &core_op_pair : params.core_ops) {
+        CoreOpState state;
+        state.params = core_op_pair.second;
+        m_core_ops.emplace(core_op_pair.first, std::move(state));
+        m_core_op_priority[core_op_pair.second.priority].add(core_op_pair.first);
+    }
+
+    for (const auto &device_id : devices_ids) {
+        m_devices_states[device_id] = DeviceState();
+    }
+}
+
+Expected<SimulationResults> SchedulerSimulator::run()
+{
+    SimulationResults results;
+    for (const auto &core_op_pair : m_core_ops) {
+        results.core_ops[core_op_pair.first] = SimulatedCoreOpResults();
+    }
+
+    while (advance_to_next_event()) {
+        complete_done_frames(results);
+        enqueue_arrived_frames();
+        schedule();
+    }
+
+    for (auto &core_op_pair : results.core_ops) {
+        std::sort(core_op_pair.second.latencies.begin(), core_op_pair.second.latencies.end());
+    }
+    results.switches_count = m_switches_count;
+    return results;
+}
+
+bool SchedulerSimulator::advance_to_next_event()
+{
+    auto next_event_time = TimePoint::max();
+
+    for (const auto &core_op_pair : m_core_ops) {
+        const auto &core_op = core_op_pair.second;
+        if (core_op.next_arrival_index < core_op.params.arrival_times.size()) {
+            const auto arrival_time = TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+                core_op.params.arrival_times[core_op.next_arrival_index]));
+            next_event_time = std::min(next_event_time, arrival_time);
+        }
+
+        // The timeout may make pending frames ready without any other event.
+        if (!core_op.pending_frames.empty()) {
+            const auto timeout_time = core_op.last_run_time + get_timeout(core_op);
+            if (timeout_time > m_now) {
+                next_event_time = std::min(next_event_time, timeout_time);
+            }
+        }
+    }
+
+    for (const auto &device_pair : m_devices_states) {
+        if (!device_pair.second.ongoing_frames.empty()) {
+            next_event_time = std::min(next_event_time, device_pair.second.ongoing_frames.front().done_time);
+        }
+    }
+
+    if (TimePoint::max() == next_event_time) {
+        return false;
+    }
+
+    m_now = std::max(m_now, next_event_time);
+    return true;
+}
+
+void SchedulerSimulator::complete_done_frames(SimulationResults &results)
+{
+    for (auto &device_pair : m_devices_states) {
+        auto &ongoing_frames = device_pair.second.ongoing_frames;
+        auto device_info = m_devices.at(device_pair.first);
+        while (!ongoing_frames.empty() && (ongoing_frames.front().done_time <= m_now)) {
+            const auto frame = ongoing_frames.front();
+            ongoing_frames.pop_front();
+            device_info->ongoing_infer_requests.fetch_sub(1);
+
+            auto &core_op = m_core_ops.at(frame.core_op_handle);
+            core_op.consumed_device_time_ms +=
+                std::chrono::duration<double, std::milli>(core_op.params.frame_time).count();
+
+            results.core_ops.at(frame.core_op_handle).latencies.push_back(frame.done_time - frame.arrival_time);
+            results.duration = std::max(results.duration,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(frame.done_time.time_since_epoch()));
+        }
+    }
+}
+
+void SchedulerSimulator::enqueue_arrived_frames()
+{
+    for (auto &core_op_pair : m_core_ops) {
+        auto &core_op = core_op_pair.second;
+        while (core_op.next_arrival_index < core_op.params.arrival_times.size()) {
+            const auto arrival_time = TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+                core_op.params.arrival_times[core_op.next_arrival_index]));
+            if (arrival_time > m_now) {
+                break;
+            }
+
+            const bool was_empty = core_op.pending_frames.empty();
+            core_op.pending_frames.push_back(arrival_time);
+            core_op.next_arrival_index++;
+            if (was_empty && (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == m_algorithm)) {
+                catch_up_virtual_time(core_op_pair.first);
+            }
+        }
+    }
+}
+
+void SchedulerSimulator::schedule()
+{
+    for (const auto &core_op_pair : m_core_ops) {
+        optimize_streaming(core_op_pair.first);
+    }
+
+    const auto oracle_decisions = CoreOpsSchedulerOracle::get_oracle_decisions(*this);
+    for (const auto &run_params : oracle_decisions) {
+        switch_core_op(run_params.core_op_handle, run_params.device_id);
+    }
+}
+
+void SchedulerSimulator::optimize_streaming(scheduler_core_op_handle_t core_op_handle)
+{
+    const auto &core_op = m_core_ops.at(core_op_handle);
+    auto next_pair = m_devices.upper_bound(core_op.last_device);
+    if (m_devices.end() == next_pair) {
+        next_pair = m_devices.begin();
+    }
+
+    auto &device_info = next_pair->second;
+    if ((device_info->current_core_op_handle == core_op_handle) && !device_info->is_switching_core_op &&
+        !CoreOpsSchedulerOracle::should_stop_streaming(*this, core_op.params.priority, device_info->device_id) &&
+        (get_frames_ready_to_transfer(core_op_handle, device_info->device_id) >= STREAMING_BURST_SIZE)) {
+        send_frames(core_op_handle, device_info->device_id, STREAMING_BURST_SIZE);
+    }
+}
+
+void SchedulerSimulator::switch_core_op(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id)
+{
+    auto &core_op = m_core_ops.at(core_op_handle);
+    auto device_info = m_devices.at(device_id);
+    auto &device_state = m_devices_states.at(device_id);
+    device_info->is_switching_core_op = false;
+
+    const auto burst_size = core_op.params.max_ongoing_frames;
+    const auto frames_count = std::min(get_frames_ready_to_transfer(core_op_handle, device_id), burst_size);
+    if (0 == frames_count) {
+        return;
+    }
+
+    device_info->frames_left_before_stop_streaming = burst_size;
+    if (core_op_handle != device_info->current_core_op_handle) {
+        device_state.free_time = std::max(device_state.free_time, m_now) + m_switch_time;
+        m_switches_count++;
+    }
+
+    core_op.last_run_time = m_now;
+    device_info->current_core_op_handle = core_op_handle;
+    send_frames(core_op_handle, device_id, frames_count);
+}
+
+void SchedulerSimulator::send_frames(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id,
+    uint32_t frames_count)
+{
+    auto &core_op = m_core_ops.at(core_op_handle);
+    auto device_info = m_devices.at(device_id);
+    auto &device_state = m_devices_states.at(device_id);
+
+    for (uint32_t i = 0; i < frames_count; i++) {
+        if (device_info->frames_left_before_stop_streaming > 0) {
+            device_info->frames_left_before_stop_streaming--;
+        }
+
+        const auto arrival_time = core_op.pending_frames.front();
+        core_op.pending_frames.pop_front();
+
+        // The device runs the frames in the order they were sent.
+        device_state.free_time = std::max(device_state.free_time, m_now) + core_op.params.frame_time;
+        device_state.ongoing_frames.push_back(OngoingFrame{core_op_handle, arrival_time, device_state.free_time});
+        device_info->ongoing_infer_requests.fetch_add(1);
+    }
+
+    core_op.last_device = device_id;
+}
+
+uint32_t SchedulerSimulator::get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle,
+    const device_id_t &device_id)
+{
+    const auto &core_op = m_core_ops.at(core_op_handle);
+    auto device_info = m_devices.at(device_id);
+
+    const auto max_ongoing_frames = core_op.params.max_ongoing_frames;
+    const uint32_t ongoing_frames = (device_info->current_core_op_handle == core_op_handle) ?
+        device_info->ongoing_infer_requests.load() : 0;
+    assert(ongoing_frames <= max_ongoing_frames);
+
+    const auto pending_frames = static_cast<uint32_t>(core_op.pending_frames.size());
+    return std::min(pending_frames, max_ongoing_frames - ongoing_frames);
+}
+
+void SchedulerSimulator::catch_up_virtual_time(scheduler_core_op_handle_t core_op_handle)
+{
+    auto min_virtual_time = std::numeric_limits<double>::max();
+    for (const auto &core_op_pair : m_core_ops) {
+        if ((core_op_pair.first != core_op_handle) && !core_op_pair.second.pending_frames.empty()) {
+            min_virtual_time = std::min(min_virtual_time, get_core_op_virtual_time(core_op_pair.first));
+        }
+    }
+
+    if (std::numeric_limits<double>::max() != min_virtual_time) {
+        auto &core_op = m_core_ops.at(core_op_handle);
+        core_op.consumed_device_time_ms = std::max(core_op.consumed_device_time_ms,
+            min_virtual_time * core_op.params.share);
+    }
+}
+
+uint32_t SchedulerSimulator::get_threshold(const CoreOpState &core_op) const
+{
+    if ((DEFAULT_SCHEDULER_MIN_THRESHOLD != core_op.params.threshold) || !m_is_cost_model_enabled) {
+        return core_op.params.threshold;
+    }
+
+    return SchedulerCostModel::get_threshold(std::chrono::duration<double, std::milli>(m_switch_time).count(),
+        std::chrono::duration<double, std::milli>(core_op.params.frame_time).count(), core_op.params.deadline,
+        static_cast<uint16_t>(core_op.params.max_ongoing_frames));
+}
+
+std::chrono::milliseconds SchedulerSimulator::get_timeout(const CoreOpState &core_op) const
+{
+    if ((DEFAULT_SCHEDULER_TIMEOUT != core_op.params.timeout) || !m_is_cost_model_enabled) {
+        return core_op.params.timeout;
+    }
+
+    return SchedulerCostModel::get_timeout(std::chrono::duration<double, std::milli>(m_switch_time).count(),
+        core_op.params.deadline);
+}
+
+SchedulerBase::ReadyInfo SchedulerSimulator::is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle,
+    bool check_threshold, const device_id_t &device_id)
+{
+    ReadyInfo result;
+    result.is_ready = (get_frames_ready_to_transfer(core_op_handle, device_id) > 0);
+
+    if (check_threshold) {
+        const auto &core_op = m_core_ops.at(core_op_handle);
+        result.over_threshold = (core_op.pending_frames.size() >= get_threshold(core_op));
+        result.over_timeout = (get_timeout(core_op) <= (m_now - core_op.last_run_time));
+
+        if (!result.over_threshold && !result.over_timeout) {
+            result.is_ready = false;
+        }
+    }
+
+    return result;
+}
+
+std::chrono::time_point<std::chrono::steady_clock> SchedulerSimulator::get_core_op_deadline(
+    const scheduler_core_op_handle_t &core_op_handle)
+{
+    const auto &core_op = m_core_ops.at(core_op_handle);
+    if ((DEFAULT_SCHEDULER_DEADLINE == core_op.params.deadline) || core_op.pending_frames.empty()) {
+        return TimePoint::max();
+    }
+    return core_op.pending_frames.front() + core_op.params.deadline;
+}
+
+double SchedulerSimulator::get_core_op_virtual_time(const scheduler_core_op_handle_t &core_op_handle)
+{
+    const auto &core_op = m_core_ops.at(core_op_handle);
+    return core_op.consumed_device_time_ms / core_op.params.share;
+}
+
+bool SchedulerSimulator::is_core_op_sticky(const scheduler_core_op_handle_t &/*core_op_handle*/)
+{
+    // Placement constraints are not recorded in the trace
+    return false;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_simulator.hpp
+ * @brief Replays a recorded scheduler workload against the scheduler oracle, using a modeled device.
+ *
+ * The simulated scheduler implements the flow of CoreOpsScheduler (streaming optimization, oracle decisions and core
+ * op switches) over a simulated clock. Each modeled device runs the frames of its active core op one after the other
+ * (each frame takes the core op's frame time), and loading another core op on a device takes the switch time.
+ * Note: The dynamic batch (multi-context) flow isn't modeled - all core ops use the streaming flow.
+ **/
+
+#ifndef _HAILO_SCHEDULER_SIMULATOR_HPP_
+#define _HAILO_SCHEDULER_SIMULATOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "vdevice/scheduler/scheduler_base.hpp"
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+// Workload and scheduler params of a single core op
+struct SimulatedCoreOpParams {
+    std::string name;
+    core_op_priority_t priority = HAILO_SCHEDULER_PRIORITY_NORMAL;
+    uint32_t threshold = DEFAULT_SCHEDULER_MIN_THRESHOLD;
+    std::chrono::milliseconds timeout = DEFAULT_SCHEDULER_TIMEOUT;
+    std::chrono::milliseconds deadline = DEFAULT_SCHEDULER_DEADLINE;
+    uint32_t share = HAILO_SCHEDULER_SHARE_DEFAULT;
+    // Maximum frames sent to a device at once. It is also the amount of frames sent on each switch.
+    uint32_t max_ongoing_frames = 1;
+    // Device time of a single frame
+    std::chrono::nanoseconds frame_time = std::chrono::nanoseconds(0);
+    // Times the frames were sent by the user (relative to the start of the workload), sorted.
+    std::vector<std::chrono::nanoseconds> arrival_times;
+};
+
+struct SimulationParams {
+    hailo_scheduling_algorithm_t algorithm = HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN;
+    std::vector<std::string> devices_ids;
+    std::vector<std::string> devices_arch;
+    std::chrono::nanoseconds switch_time = std::chrono::nanoseconds(0);
+    // If set, core ops with the default threshold and timeout use the values chosen by the scheduler cost model.
+    bool is_cost_model_enabled = true;
+    std::map<scheduler_core_op_handle_t, SimulatedCoreOpParams> core_ops;
+};
+
+struct SimulatedCoreOpResults {
+    // Time from the frame arrival until the modeled device finished running it, sorted.
+    std::vector<std::chrono::nanoseconds> latencies;
+};
+
+struct SimulationResults {
+    // Time from the first arrival until the last frame is done
+    std::chrono::nanoseconds duration = std::chrono::nanoseconds(0);
+    size_t switches_count = 0;
+    std::map<scheduler_core_op_handle_t, SimulatedCoreOpResults> core_ops;
+};
+
+class SchedulerSimulator final : public SchedulerBase
+{
+public:
+    static Expected<SimulationResults> simulate(const SimulationParams &params);
+
+    SchedulerSimulator(const SimulationParams &params, std::vector<std::string> &devices_ids,
+        std::vector<std::string> &devices_arch);
+    virtual ~SchedulerSimulator() = default;
+    SchedulerSimulator(const SchedulerSimulator &other) = delete;
+    SchedulerSimulator &operator=(const SchedulerSimulator &other) = delete;
+    SchedulerSimulator &operator=(SchedulerSimulator &&other) = delete;
+    SchedulerSimulator(SchedulerSimulator &&other) noexcept = delete;
+
+    virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
+        const device_id_t &device_id) override;
+    virtual std::chrono::time_point<std::chrono::steady_clock> get_core_op_deadline(
+        const scheduler_core_op_handle_t &core_op_handle) override;
+    virtual double get_core_op_virtual_time(const scheduler_core_op_handle_t &core_op_handle) override;
+    virtual bool is_core_op_sticky(const scheduler_core_op_handle_t &core_op_handle) override;
+
+private:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+    struct CoreOpState {
+        SimulatedCoreOpParams params;
+        // Index of the first arrival that wasn't enqueued yet
+        size_t next_arrival_index = 0;
+        // Arrival times of the frames that were enqueued but not sent to a device yet
+        std::deque<TimePoint> pending_frames;
+        TimePoint last_run_time;
+        device_id_t last_device;
+        double consumed_device_time_ms = 0;
+    };
+
+    struct OngoingFrame {
+        scheduler_core_op_handle_t core_op_handle;
+        TimePoint arrival_time;
+        TimePoint done_time;
+    };
+
+    struct DeviceState {
+        // The time the device finishes all the frames sent to it (and switches)
+        TimePoint free_time;
+        std::deque<OngoingFrame> ongoing_frames;
+    };
+
+    Expected<SimulationResults> run();
+    // Returns false if there are no more events
+    bool advance_to_next_event();
+    void complete_done_frames(SimulationResults &results);
+    void enqueue_arrived_frames();
+    void schedule();
+
+    void optimize_streaming(scheduler_core_op_handle_t core_op_handle);
+    void switch_core_op(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id);
+    void send_frames(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id, uint32_t frames_count);
+    uint32_t get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id);
+    void catch_up_virtual_time(scheduler_core_op_handle_t core_op_handle);
+
+    uint32_t get_threshold(const CoreOpState &core_op) const;
+    std::chrono::milliseconds get_timeout(const CoreOpState &core_op) const;
+
+    const std::chrono::nanoseconds m_switch_time;
+    const bool m_is_cost_model_enabled;
+    std::map<scheduler_core_op_handle_t, CoreOpState> m_core_ops;
+    std::map<device_id_t, DeviceState> m_devices_states;
+    TimePoint m_now;
+    size_t m_switches_count;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SCHEDULER_SIMULATOR_HPP_ */
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file simulate_scheduler_command.cpp
+ * @brief Replays the workload recorded in a profiler trace against the scheduling algorithms, using a modeled device
+ **/
+
+#include "simulate_scheduler_command.hpp"
+
+#include "vdevice/scheduler/scheduler_cost_model.hpp"
+
+#include "tracer_profiler.pb.h"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+
+namespace hailort
+{
+
+#define NAME_WIDTH (40)
+#define NUMBER_WIDTH (12)
+#define LINE_LENGTH (NAME_WIDTH + (6 * NUMBER_WIDTH))
+
+static const std::string SIMULATED_DEVICE_ID_PREFIX = "simulated_device_";
+
+SimulateSchedulerCommand::SimulateSchedulerCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("simulate-scheduler",
+        "Replay the workload recorded in a profiler trace (.hrtt) against the scheduling algorithms, using a modeled device")),
+    m_switch_time_ms(0),
+    m_frame_time_ms(0),
+    m_device_count(0)
+{
+    m_app->add_option("trace", m_trace_path, "Profiler trace file (created when running with HAILO_TRACE=scheduler)")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("--scheduling-algorithm", m_algorithms,
+        "Scheduling algorithms to simulate. If not set, all algorithms are simulated")
+        ->transform(HailoCheckedTransformer<hailo_scheduling_algorithm_t>({
+            { "round_robin", HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN },
+            { "deadline", HAILO_SCHEDULING_ALGORITHM_DEADLINE },
+            { "fair_share", HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE },
+        }));
+    m_app->add_option("--switch-time-ms", m_switch_time_ms,
+        "Modeled core op switch time. If not set, the average switch time in the trace is used")
+        ->check(CLI::NonNegativeNumber)
+        ->default_val(0);
+    m_app->add_option("--frame-time-ms", m_frame_time_ms,
+        "Modeled device time of a single frame (of all core ops). If not set, the frame time of each core op is measured from the trace")
+        ->check(CLI::NonNegativeNumber)
+        ->default_val(0);
+    m_app->add_option("--device-count", m_device_count,
+        "Amount of modeled devices. If not set, the devices in the trace are used")
+        ->default_val(0);
+}
+
+hailo_status SimulateSchedulerCommand::execute()
+{
+    TRY(auto recorded, parse_trace());
+    print_results("Recorded", recorded.params, recorded.results);
+
+    if (0 != m_device_count) {
+        recorded.params.devices_ids.clear();
+        recorded.params.devices_arch.clear();
+        for (uint32_t i = 0; i < m_device_count; i++) {
+            recorded.params.devices_ids.emplace_back(SIMULATED_DEVICE_ID_PREFIX + std::to_string(i));
+            recorded.params.devices_arch.emplace_back("");
+        }
+    }
+
+    if (m_algorithms.empty()) {
+        m_algorithms = { HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN, HAILO_SCHEDULING_ALGORITHM_DEADLINE,
+            HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE };
+    }
+
+    for (const auto algorithm : m_algorithms) {
+        auto params = recorded.params;
+        params.algorithm = algorithm;
+        TRY(const auto results, SchedulerSimulator::simulate(params));
+
+        const auto title = (HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN == algorithm) ? "Simulated round_robin" :
+            (HAILO_SCHEDULING_ALGORITHM_DEADLINE == algorithm) ? "Simulated deadline" : "Simulated fair_share";
+        print_results(title, params, results);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+static double to_ms(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Assumes that the values are sorted
+static std::chrono::nanoseconds get_percentile(const std::vector<std::chrono::nanoseconds> &values, double percentile)
+{
+    if (values.empty()) {
+        return std::chrono::nanoseconds(0);
+    }
+    const auto index = static_cast<size_t>(percentile * static_cast<double>(values.size() - 1));
+    return values[index];
+}
+
+static std::chrono::nanoseconds get_median(std::vector<std::chrono::nanoseconds> values)
+{
+    std::sort(values.begin(), values.end());
+    return get_percentile(values, 0.5);
+}
+
+Expected<SimulateSchedulerCommand::RecordedTrace> SimulateSchedulerCommand::parse_trace()
+{
+    ProtoProfiler profiler_trace;
+    std::ifstream trace_file(m_trace_path, std::ios::in | std::ios::binary);
+    CHECK_AS_EXPECTED(trace_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening trace file {}", m_trace_path);
+    CHECK_AS_EXPECTED(profiler_trace.ParseFromIstream(&trace_file), HAILO_INVALID_ARGUMENT,
+        "Failed parsing trace file {}", m_trace_path);
+
+    RecordedTrace recorded;
+    auto &params = recorded.params;
+    params.is_cost_model_enabled = !is_env_variable_on(DISABLE_SCHEDULER_COST_MODEL_ENV_VAR);
+
+    // Each frame is counted once - on the first input stream (when sent by the user and when sent to the device) and
+    // on the first output stream (when the device is done).
+    std::map<scheduler_core_op_handle_t, std::string> first_input_stream;
+    std::map<scheduler_core_op_handle_t, std::string> first_output_stream;
+    std::map<scheduler_core_op_handle_t, std::deque<uint64_t>> recorded_arrivals;
+    std::map<std::pair<scheduler_core_op_handle_t, std::string>, std::deque<uint64_t>> sent_frames;
+    std::map<std::string, uint64_t> last_frame_done_time;
+    std::map<std::string, scheduler_core_op_handle_t> current_core_op;
+    std::map<scheduler_core_op_handle_t, std::vector<std::chrono::nanoseconds>> frame_time_samples;
+    std::vector<double> switch_time_samples_ms;
+    std::map<scheduler_core_op_handle_t, std::vector<uint64_t>> arrival_timestamps;
+    uint64_t last_done_timestamp = 0;
+
+    for (const auto &trace : profiler_trace.added_trace()) {
+        switch (trace.trace_case()) {
+        case ProtoTraceMessage::kAddedDevice:
+            params.devices_ids.emplace_back(trace.added_device().device_info().device_id());
+            params.devices_arch.emplace_back(trace.added_device().device_info().device_arch());
+            break;
+        case ProtoTraceMessage::kAddedCoreOp: {
+            const auto handle = static_cast<scheduler_core_op_handle_t>(trace.added_core_op().core_op_handle());
+            SimulatedCoreOpParams core_op_params;
+            core_op_params.name = trace.added_core_op().core_op_name();
+            core_op_params.max_ongoing_frames = 0; // Set by the streams queue sizes
+            params.core_ops[handle] = core_op_params;
+            break;
+        }
+        case ProtoTraceMessage::kAddedStream: {
+            const auto &stream = trace.added_stream();
+            const auto handle = static_cast<scheduler_core_op_handle_t>(stream.core_op_handle());
+            if (!contains(params.core_ops, handle)) {
+                break;
+            }
+
+            auto &first_stream = (PROTO__STREAM_DIRECTION__H2D == stream.direction()) ?
+                first_input_stream : first_output_stream;
+            if (!contains(first_stream, handle)) {
+                first_stream[handle] = stream.stream_name();
+            }
+
+            // The ongoing frames on a device are bounded by the smallest stream queue
+            auto &max_ongoing_frames = params.core_ops[handle].max_ongoing_frames;
+            const auto queue_size = static_cast<uint32_t>(stream.queue_size());
+            if ((queue_size > 0) && ((0 == max_ongoing_frames) || (queue_size < max_ongoing_frames))) {
+                max_ongoing_frames = queue_size;
+            }
+            break;
+        }
+        case ProtoTraceMessage::kCoreOpSetValue: {
+            const auto &value = trace.core_op_set_value();
+            const auto handle = static_cast<scheduler_core_op_handle_t>(value.core_op_handle());
+            if (!contains(params.core_ops, handle)) {
+                break;
+            }
+
+            // The last value set in the trace is used for the whole simulation
+            auto &core_op_params = params.core_ops[handle];
+            if (ProtoProfilerSetSchedulerParam::kTimeout == value.value_case()) {
+                core_op_params.timeout = std::chrono::milliseconds(value.timeout());
+            } else if (ProtoProfilerSetSchedulerParam::kThreshold == value.value_case()) {
+                core_op_params.threshold = static_cast<uint32_t>(value.threshold());
+            } else if (ProtoProfilerSetSchedulerParam::kPriority == value.value_case()) {
+                core_op_params.priority = static_cast<core_op_priority_t>(value.priority());
+            }
+            break;
+        }
+        case ProtoTraceMessage::kActivateCoreOp: {
+            const auto &activate = trace.activate_core_op();
+            const auto handle = static_cast<scheduler_core_op_handle_t>(activate.new_core_op_handle());
+            const auto &device_id = activate.device_id();
+            // Activations of the same core op are batch switches
+            if (!contains(current_core_op, device_id) || (current_core_op[device_id] != handle)) {
+                switch_time_samples_ms.push_back(activate.duration());
+                recorded.results.switches_count++;
+            }
+            current_core_op[device_id] = handle;
+            last_frame_done_time[device_id] = activate.time_stamp();
+            break;
+        }
+        case ProtoTraceMessage::kFrameEnqueue: {
+            const auto &frame = trace.frame_enqueue();
+            const auto handle = static_cast<scheduler_core_op_handle_t>(frame.core_op_handle());
+            if (PROTO__STREAM_DIRECTION__H2D == frame.direction()) {
+                if (contains(first_input_stream, handle) && (first_input_stream[handle] == frame.stream_name())) {
+                    recorded_arrivals[handle].push_back(frame.time_stamp());
+                    arrival_timestamps[handle].push_back(frame.time_stamp());
+                }
+                break;
+            }
+
+            if (!contains(first_output_stream, handle) || (first_output_stream[handle] != frame.stream_name())) {
+                break;
+            }
+
+            // If the device was busy when the frame was sent, the time since the previous frame was done is the
+            // device time of the frame (as measured by the scheduler).
+            const auto done_time = frame.time_stamp();
+            auto &sent = sent_frames[std::make_pair(handle, frame.device_id())];
+            if (!sent.empty()) {
+                const auto start_time = std::max(last_frame_done_time[frame.device_id()], sent.front());
+                sent.pop_front();
+                if (done_time > start_time) {
+                    frame_time_samples[handle].emplace_back(done_time - start_time);
+                }
+            }
+            last_frame_done_time[frame.device_id()] = done_time;
+
+            auto &arrivals = recorded_arrivals[handle];
+            if (!arrivals.empty()) {
+                if (done_time >= arrivals.front()) {
+                    recorded.results.core_ops[handle].latencies.emplace_back(done_time - arrivals.front());
+                }
+                arrivals.pop_front();
+            }
+            last_done_timestamp = std::max(last_done_timestamp, done_time);
+            break;
+        }
+        case ProtoTraceMessage::kFrameDequeue: {
+            const auto &frame = trace.frame_dequeue();
+            const auto handle = static_cast<scheduler_core_op_handle_t>(frame.core_op_handle());
+            if ((PROTO__STREAM_DIRECTION__H2D == frame.direction()) && contains(first_input_stream, handle) &&
+                    (first_input_stream[handle] == frame.stream_name())) {
+                sent_frames[std::make_pair(handle, frame.device_id())].push_back(frame.time_stamp());
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    CHECK_AS_EXPECTED(!params.devices_ids.empty(), HAILO_INVALID_ARGUMENT, "No devices were found in the trace");
+    CHECK_AS_EXPECTED(!arrival_timestamps.empty(), HAILO_INVALID_ARGUMENT,
+        "No frames were found in the trace (was it recorded with the scheduler?)");
+
+    // Times in the simulation are relative to the first frame
+    auto start_timestamp = std::numeric_limits<uint64_t>::max();
+    for (const auto &timestamps_pair : arrival_timestamps) {
+        for (const auto timestamp : timestamps_pair.second) {
+            start_timestamp = std::min(start_timestamp, timestamp);
+        }
+    }
+
+    // Core ops that didn't get any frame are not simulated
+    for (auto it = params.core_ops.begin(); it != params.core_ops.end();) {
+        if (!contains(arrival_timestamps, it->first)) {
+            it = params.core_ops.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto &core_op_pair : params.core_ops) {
+        auto &core_op_params = core_op_pair.second;
+        for (const auto timestamp : arrival_timestamps[core_op_pair.first]) {
+            core_op_params.arrival_times.emplace_back(timestamp - start_timestamp);
+        }
+        std::sort(core_op_params.arrival_times.begin(), core_op_params.arrival_times.end());
+        core_op_params.max_ongoing_frames = std::max(core_op_params.max_ongoing_frames, 1u);
+
+        if (0 != m_frame_time_ms) {
+            core_op_params.frame_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double, std::milli>(m_frame_time_ms));
+        } else {
+            CHECK_AS_EXPECTED(!frame_time_samples[core_op_pair.first].empty(), HAILO_INVALID_ARGUMENT,
+                "Failed measuring the frame time of {} from the trace, use --frame-time-ms", core_op_params.name);
+            core_op_params.frame_time = get_median(frame_time_samples[core_op_pair.first]);
+        }
+    }
+
+    if (0 != m_switch_time_ms) {
+        params.switch_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double, std::milli>(m_switch_time_ms));
+    } else if (!switch_time_samples_ms.empty()) {
+        const auto average_ms = std::accumulate(switch_time_samples_ms.begin(), switch_time_samples_ms.end(), 0.0) /
+            static_cast<double>(switch_time_samples_ms.size());
+        params.switch_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double, std::milli>(average_ms));
+    }
+
+    for (auto &core_op_pair : recorded.results.core_ops) {
+        std::sort(core_op_pair.second.latencies.begin(), core_op_pair.second.latencies.end());
+    }
+    if (last_done_timestamp > start_timestamp) {
+        recorded.results.duration = std::chrono::nanoseconds(last_done_timestamp - start_timestamp);
+    }
+
+    return recorded;
+}
+
+void SimulateSchedulerCommand::print_results(const std::string &title, const SimulationParams &params,
+    const SimulationResults &results)
+{
+    const auto duration_sec = std::chrono::duration<double>(results.duration).count();
+
+    std::cout << title << " (" << params.devices_ids.size() << " devices, switch time " << std::fixed <<
+        std::setprecision(3) << to_ms(params.switch_time) << " ms): " << results.switches_count << " switches, " <<
+        to_ms(results.duration) << " ms\n";
+    std::cout << std::setw(NAME_WIDTH) << std::left << "Model" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Frames" <<
+        std::setw(NUMBER_WIDTH) << std::left << "FPS" <<
+        std::setw(NUMBER_WIDTH) << std::left << "Avg (ms)" <<
+        std::setw(NUMBER_WIDTH) << std::left << "P50 (ms)" <<
+        std::setw(NUMBER_WIDTH) << std::left << "P90 (ms)" <<
+        std::setw(NUMBER_WIDTH) << std::left << "P99 (ms)" <<
+        "\n" << std::string(LINE_LENGTH, '-') << "\n";
+
+    for (const auto &core_op_pair : params.core_ops) {
+        const auto results_it = results.core_ops.find(core_op_pair.first);
+        const auto latencies = (results.core_ops.end() != results_it) ? results_it->second.latencies :
+            std::vector<std::chrono::nanoseconds>();
+        const auto frames_count = latencies.size();
+        const auto fps = (duration_sec > 0) ? (static_cast<double>(frames_count) / duration_sec) : 0;
+        const auto average_ms = latencies.empty() ? 0 :
+            (to_ms(std::accumulate(latencies.begin(), latencies.end(), std::chrono::nanoseconds(0))) /
+                static_cast<double>(frames_count));
+
+        std::cout << std::setw(NAME_WIDTH) << std::left << core_op_pair.second.name <<
+            std::setw(NUMBER_WIDTH) << std::left << frames_count <<
+            std::setw(NUMBER_WIDTH) << std::left << std::setprecision(2) << fps <<
+            std::setw(NUMBER_WIDTH) << std::left << average_ms <<
+            std::setw(NUMBER_WIDTH) << std::left << to_ms(get_percentile(latencies, 0.5)) <<
+            std::setw(NUMBER_WIDTH) << std::left << to_ms(get_percentile(latencies, 0.9)) <<
+            std::setw(NUMBER_WIDTH) << std::left << to_ms(get_percentile(latencies, 0.99)) << "\n";
+    }
+    std::cout << std::endl;
+}
+
+} /* namespace hailort */
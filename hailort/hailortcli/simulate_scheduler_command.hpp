@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file simulate_scheduler_command.hpp
+ * @brief Replays the workload recorded in a profiler trace against the scheduling algorithms, using a modeled device
+ **/
+
+#ifndef _HAILO_SIMULATE_SCHEDULER_COMMAND_HPP_
+#define _HAILO_SIMULATE_SCHEDULER_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+#include "scheduler_simulator.hpp"
+
+#include "hailo/hailort.h"
+#include "CLI/CLI.hpp"
+
+
+namespace hailort
+{
+
+class SimulateSchedulerCommand : public Command
+{
+public:
+    explicit SimulateSchedulerCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+private:
+    // The workload recorded in the trace, and the results of the recorded run
+    struct RecordedTrace {
+        SimulationParams params;
+        SimulationResults results;
+    };
+
+    Expected<RecordedTrace> parse_trace();
+    static void print_results(const std::string &title, const SimulationParams &params,
+        const SimulationResults &results);
+
+    std::string m_trace_path;
+    std::vector<hailo_scheduling_algorithm_t> m_algorithms;
+    double m_switch_time_ms;
+    double m_frame_time_ms;
+    uint32_t m_device_count;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SIMULATE_SCHEDULER_COMMAND_HPP_ */
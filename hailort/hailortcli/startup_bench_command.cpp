@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file startup_bench_command.cpp
+ * @brief Measures the time to the first inference of a HEF, by the phases of the startup
+ **/
+
+#include "startup_bench_command.hpp"
+#include "common.hpp"
+
+#include "common/async_thread.hpp"
+
+#include "hailo/device.hpp"
+#include "hailo/vdevice.hpp"
+#include "hailo/hef.hpp"
+#include "hailo/vstream.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+
+static const char *CSV_SUFFIX = ".csv";
+static const char *TOTAL_PHASE_NAME = "total";
+// The stages of the configure phase are indented in the results
+static const char *CONFIGURE_STAGE_PREFIX = "  ";
+
+static std::chrono::microseconds elapsed_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+static double to_ms(std::chrono::microseconds duration)
+{
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+
+StartupBenchCommand::StartupBenchCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("startup-bench",
+        "Measure the time to the first inference of a HEF, by the phases of the startup (device scan and open, HEF "
+        "parse, configure, activation and the first frames). The first iteration is the cold start of the process, "
+        "the next iterations are warm starts (everything is released and re-created, in the same process)"))
+{
+    add_vdevice_options(m_app, m_vdevice_params);
+    m_app->add_option("hef", m_hef_path, "Path of the HEF to load")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("--batch-size", m_batch_size, "Batch size (the first inference is of a single batch)")
+        ->check(CLI::PositiveNumber)
+        ->default_val(1);
+    m_app->add_option("--iterations", m_iterations, "Amount of startups to measure")
+        ->check(CLI::PositiveNumber)
+        ->default_val(3);
+    m_app->add_option("--csv", m_csv_path, "If set save the duration of each phase of each iteration as csv to the specified path")
+        ->default_val("")
+        ->check(FileSuffixValidator(CSV_SUFFIX));
+}
+
+hailo_status StartupBenchCommand::execute()
+{
+    std::vector<PhasesDurations> iterations;
+    iterations.reserve(m_iterations);
+    for (uint32_t i = 0; i < m_iterations; i++) {
+        TRY(auto durations, run_startup(), "Startup iteration {} failed", i);
+        iterations.emplace_back(std::move(durations));
+    }
+
+    print_results(iterations);
+    if (!m_csv_path.empty()) {
+        CHECK_SUCCESS(write_results_csv(iterations, m_csv_path));
+    }
+    return HAILO_SUCCESS;
+}
+
+Expected<StartupBenchCommand::PhasesDurations> StartupBenchCommand::run_startup()
+{
+    PhasesDurations durations;
+    const auto startup_start = std::chrono::steady_clock::now();
+
+    auto start = std::chrono::steady_clock::now();
+    if (m_vdevice_params.device_params.device_ids.empty()) {
+        TRY(const auto scanned_device_ids, Device::scan());
+        CHECK_AS_EXPECTED(!scanned_device_ids.empty(), HAILO_INVALID_OPERATION, "No devices were found");
+        durations.emplace_back("device scan", elapsed_since(start));
+    }
+
+    hailo_vdevice_params_t vdevice_params{};
+    CHECK_SUCCESS_AS_EXPECTED(hailo_init_vdevice_params(&vdevice_params));
+    if (m_vdevice_params.device_count != HAILO_DEFAULT_DEVICE_COUNT) {
+        vdevice_params.device_count = m_vdevice_params.device_count;
+    }
+    std::vector<hailo_device_id_t> dev_ids;
+    if (!m_vdevice_params.device_params.device_ids.empty()) {
+        TRY(auto dev_ids_strs, get_device_ids(m_vdevice_params.device_params));
+        TRY(dev_ids, HailoRTCommon::to_device_ids_vector(dev_ids_strs));
+
+        vdevice_params.device_ids = dev_ids.data();
+        vdevice_params.device_count = static_cast<uint32_t>(dev_ids.size());
+    }
+    // The network group is activated explicitly, so the activation is measured (the service always schedules)
+    vdevice_params.scheduling_algorithm = m_vdevice_params.multi_process_service ?
+        HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN : HAILO_SCHEDULING_ALGORITHM_NONE;
+    vdevice_params.group_id = m_vdevice_params.group_id.c_str();
+    vdevice_params.multi_process_service = m_vdevice_params.multi_process_service;
+
+    start = std::chrono::steady_clock::now();
+    TRY(auto vdevice, VDevice::create(vdevice_params), "Failed creating vdevice");
+    durations.emplace_back("device open", elapsed_since(start));
+
+    start = std::chrono::steady_clock::now();
+    TRY(auto hef, Hef::create(m_hef_path));
+    durations.emplace_back("hef parse", elapsed_since(start));
+
+    TRY(auto configure_params, vdevice->create_configure_params(hef));
+    CHECK_AS_EXPECTED(1 == configure_params.size(), HAILO_INVALID_OPERATION,
+        "startup-bench supports HEFs with a single network group (the HEF has {})", configure_params.size());
+    for (auto &params : configure_params) {
+        params.second.batch_size = m_batch_size;
+    }
+
+    start = std::chrono::steady_clock::now();
+    TRY(auto network_groups, vdevice->configure(hef, configure_params));
+    durations.emplace_back("configure", elapsed_since(start));
+    auto network_group = network_groups[0];
+
+    auto configure_stages = network_group->get_configure_stages_durations();
+    if (configure_stages) {
+        durations.emplace_back(std::string(CONFIGURE_STAGE_PREFIX) + "buffers allocation", configure_stages->buffers_allocation);
+        durations.emplace_back(std::string(CONFIGURE_STAGE_PREFIX) + "resources building", configure_stages->resources_building);
+        durations.emplace_back(std::string(CONFIGURE_STAGE_PREFIX) + "firmware upload", configure_stages->firmware_upload);
+    }
+
+    std::unique_ptr<ActivatedNetworkGroup> activated_network_group;
+    if (!m_vdevice_params.multi_process_service) {
+        start = std::chrono::steady_clock::now();
+        TRY(activated_network_group, network_group->activate());
+        durations.emplace_back("activation", elapsed_since(start));
+    }
+
+    start = std::chrono::steady_clock::now();
+    TRY(auto vstreams, VStreamsBuilder::create_vstreams(*network_group, {}, HAILO_FORMAT_TYPE_AUTO));
+    durations.emplace_back("vstreams creation", elapsed_since(start));
+
+    // Each input is written on its own thread, as the frames of a batch may not fit in the input's queue
+    start = std::chrono::steady_clock::now();
+    std::vector<AsyncThreadPtr<hailo_status>> write_threads;
+    for (auto &input_vstream : vstreams.first) {
+        write_threads.emplace_back(std::make_unique<AsyncThread<hailo_status>>("WRITE", [this, &input_vstream]() -> hailo_status {
+            TRY(auto frame, Buffer::create(input_vstream.get_frame_size(), 0));
+            for (uint16_t i = 0; i < m_batch_size; i++) {
+                CHECK_SUCCESS(input_vstream.write(MemoryView(frame)));
+            }
+            return HAILO_SUCCESS;
+        }));
+    }
+    auto read_status = HAILO_SUCCESS;
+    for (auto &output_vstream : vstreams.second) {
+        auto frame = Buffer::create(output_vstream.get_frame_size());
+        read_status = frame.status();
+        for (uint16_t i = 0; (HAILO_SUCCESS == read_status) && (i < m_batch_size); i++) {
+            read_status = output_vstream.read(MemoryView(*frame));
+        }
+        if (HAILO_SUCCESS != read_status) {
+            break;
+        }
+    }
+    if (HAILO_SUCCESS != read_status) {
+        // Aborting the inputs, so the write threads don't wait for the outputs to be read
+        for (auto &input_vstream : vstreams.first) {
+            (void)input_vstream.abort();
+        }
+    }
+    auto write_status = HAILO_SUCCESS;
+    for (auto &write_thread : write_threads) {
+        const auto status = write_thread->get();
+        if (HAILO_SUCCESS != status) {
+            write_status = status;
+        }
+    }
+    CHECK_SUCCESS_AS_EXPECTED(read_status, "Failed reading the first frames");
+    CHECK_SUCCESS_AS_EXPECTED(write_status, "Failed writing the first frames");
+    durations.emplace_back("first inference", elapsed_since(start));
+
+    durations.emplace_back(TOTAL_PHASE_NAME, elapsed_since(startup_start));
+    return durations;
+}
+
+void StartupBenchCommand::print_results(const std::vector<PhasesDurations> &iterations)
+{
+    std::cout << fmt::format("Startup phases ({} iterations - the first is the cold start, the others are warm):",
+        iterations.size()) << std::endl;
+    std::cout << fmt::format("{:<24} {:>12} {:>14} {:>14} {:>14}", "phase", "cold ms", "warm mean ms", "warm min ms",
+        "warm max ms") << std::endl;
+
+    for (const auto &cold_phase : iterations[0]) {
+        std::vector<double> warm_durations_ms;
+        for (size_t i = 1; i < iterations.size(); i++) {
+            const auto phase = std::find_if(iterations[i].begin(), iterations[i].end(),
+                [&cold_phase](const std::pair<std::string, std::chrono::microseconds> &other) {
+                    return other.first == cold_phase.first;
+                });
+            if (iterations[i].end() != phase) {
+                warm_durations_ms.emplace_back(to_ms(phase->second));
+            }
+        }
+
+        if (warm_durations_ms.empty()) {
+            std::cout << fmt::format("{:<24} {:>12.3f} {:>14} {:>14} {:>14}", cold_phase.first, to_ms(cold_phase.second),
+                "-", "-", "-") << std::endl;
+            continue;
+        }
+        const auto warm_mean_ms = std::accumulate(warm_durations_ms.begin(), warm_durations_ms.end(), 0.0) /
+            static_cast<double>(warm_durations_ms.size());
+        const auto warm_min_max_ms = std::minmax_element(warm_durations_ms.begin(), warm_durations_ms.end());
+        std::cout << fmt::format("{:<24} {:>12.3f} {:>14.3f} {:>14.3f} {:>14.3f}", cold_phase.first,
+            to_ms(cold_phase.second), warm_mean_ms, *warm_min_max_ms.first, *warm_min_max_ms.second) << std::endl;
+    }
+}
+
+hailo_status StartupBenchCommand::write_results_csv(const std::vector<PhasesDurations> &iterations, const std::string &path)
+{
+    std::ofstream csv_file(path, std::ios::out);
+    CHECK(csv_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed creating csv file {}", path);
+
+    csv_file << "iteration,phase,duration_ms" << std::endl;
+    for (size_t i = 0; i < iterations.size(); i++) {
+        for (const auto &phase : iterations[i]) {
+            // The configure stages are written without the indentation
+            auto phase_name = phase.first;
+            phase_name.erase(0, phase_name.find_first_not_of(' '));
+            csv_file << i << "," << phase_name << "," << to_ms(phase.second) << std::endl;
+        }
+    }
+    CHECK(csv_file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing csv file {}", path);
+    return HAILO_SUCCESS;
+}
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file startup_bench_command.hpp
+ * @brief Measures the time to the first inference of a HEF, by the phases of the startup
+ **/
+
+#ifndef _HAILO_STARTUP_BENCH_COMMAND_HPP_
+#define _HAILO_STARTUP_BENCH_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "CLI/CLI.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+class StartupBenchCommand : public Command {
+public:
+    explicit StartupBenchCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+private:
+    // The duration of each phase of a startup, by the order of the phases (phases that weren't measured are absent)
+    using PhasesDurations = std::vector<std::pair<std::string, std::chrono::microseconds>>;
+
+    Expected<PhasesDurations> run_startup();
+    static void print_results(const std::vector<PhasesDurations> &iterations);
+    static hailo_status write_results_csv(const std::vector<PhasesDurations> &iterations, const std::string &path);
+
+    std::string m_hef_path;
+    hailo_vdevice_params m_vdevice_params;
+    uint16_t m_batch_size;
+    uint32_t m_iterations;
+    std::string m_csv_path;
+};
+
+#endif /* _HAILO_STARTUP_BENCH_COMMAND_HPP_ */
@@ -40,6 +40,12 @@ hailo_status ResultEvent::wait(std::chrono::milliseconds timeout)
     return m_event->wait(timeout);
 }
 
+hailo_status ResultEvent::reset()
+{
+    m_value = Buffer();
+    return m_event->reset();
+}
+
 Client::~Client()
 {
     is_running = false;
@@ -80,9 +86,17 @@ hailo_status Client::message_loop()
             continue;
         }
 
-        std::unique_lock<std::mutex> lock(m_message_mutex);
-        auto event = m_events[header.message_id];
-        lock.unlock();
+        std::shared_ptr<ResultEvent> event;
+        {
+            std::unique_lock<std::mutex> lock(m_events_mutex);
+            auto event_it = m_events.find(header.message_id);
+            if (m_events.end() == event_it) {
+                // The request was already timed out
+                LOGGER__WARNING("Got a reply to message {} which isn't pending, ignoring it", header.message_id);
+                continue;
+            }
+            event = event_it->second;
+        }
         auto status = event->signal(std::move(message));
         CHECK_SUCCESS(status);
     }
@@ -93,30 +107,76 @@ hailo_status Client::message_loop()
 Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const MemoryView &request,
     std::function<hailo_status(RpcConnection)> write_buffers_callback)
 {
+    TRY(auto pending_request, send_request(action_id, request, write_buffers_callback));
+    return wait_for_reply(pending_request);
+}
+
+Expected<PendingRequest> Client::send_request(HailoRpcActionID action_id, const MemoryView &request,
+    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+{
+    TRY(auto event, acquire_result_event());
+
     std::unique_lock<std::mutex> lock(m_message_mutex);
     rpc_message_header_t header;
     header.size = static_cast<uint32_t>(request.size());
     header.message_id = m_messages_sent++;
     header.action_id = static_cast<uint32_t>(action_id);
 
+    // The request is registered before it is written, so its reply can't arrive before it is pending
+    {
+        std::unique_lock<std::mutex> events_lock(m_events_mutex);
+        m_events[header.message_id] = event;
+    }
+
     auto status = m_connection.write_message(header, request);
-    CHECK_SUCCESS_AS_EXPECTED(status);
-    if (write_buffers_callback) {
+    if ((HAILO_SUCCESS == status) && write_buffers_callback) {
         status = write_buffers_callback(m_connection);
+    }
+    if (HAILO_SUCCESS != status) {
+        remove_pending_request(header.message_id);
         CHECK_SUCCESS_AS_EXPECTED(status);
     }
 
-    TRY(auto event, ResultEvent::create_shared());
-    m_events[header.message_id] = event;
+    return PendingRequest{header.message_id, event};
+}
 
-    lock.unlock();
-    status = event->wait(REQUEST_TIMEOUT);
-    CHECK_SUCCESS_AS_EXPECTED(status);
+Expected<Buffer> Client::wait_for_reply(const PendingRequest &pending_request, std::chrono::milliseconds timeout)
+{
+    auto status = pending_request.result->wait(timeout);
+    if (HAILO_SUCCESS != status) {
+        // A late reply won't find the request, so the event can't be signalled after it is reused
+        remove_pending_request(pending_request.message_id);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    auto reply = pending_request.result->release();
+
+    std::unique_lock<std::mutex> lock(m_events_mutex);
+    m_events.erase(pending_request.message_id);
+    m_free_events.emplace_back(pending_request.result);
+    return reply;
+}
 
-    m_events.erase(header.message_id);
-    return event->release();
+Expected<std::shared_ptr<ResultEvent>> Client::acquire_result_event()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_events_mutex);
+        if (!m_free_events.empty()) {
+            auto event = m_free_events.back();
+            m_free_events.pop_back();
+            auto status = event->reset();
+            CHECK_SUCCESS(status);
+            return event;
+        }
+    }
+    return ResultEvent::create_shared();
 }
 
+void Client::remove_pending_request(uint32_t message_id)
+{
+    std::unique_lock<std::mutex> lock(m_events_mutex);
+    m_events.erase(message_id);
+}
 
 void Client::register_custom_reply(HailoRpcActionID action_id,
     std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback)
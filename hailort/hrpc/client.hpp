@@ -14,6 +14,7 @@
 #include <fcntl.h>
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include "rpc_connection.hpp"
 #include "hrpc_protocol/serializer.hpp"
@@ -33,12 +34,20 @@ public:
     Buffer &&release();
     hailo_status signal(Buffer &&value);
     hailo_status wait(std::chrono::milliseconds timeout);
+    hailo_status reset();
 
 private:
     Buffer m_value;
     EventPtr m_event;
 };
 
+// A request that was sent to the server, and whose reply wasn't received yet
+struct PendingRequest
+{
+    uint32_t message_id;
+    std::shared_ptr<ResultEvent> result;
+};
+
 class Client
 {
 public:
@@ -48,19 +57,43 @@ public:
     hailo_status connect();
     Expected<Buffer> execute_request(HailoRpcActionID action_id, const MemoryView &request,
         std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+
+    // Same as execute_request, split in two - send_request returns once the request is written, so several requests
+    // may be in flight on the connection at once. Each sent request must be waited for with wait_for_reply.
+    Expected<PendingRequest> send_request(HailoRpcActionID action_id, const MemoryView &request,
+        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+    Expected<Buffer> wait_for_reply(const PendingRequest &pending_request,
+        std::chrono::milliseconds timeout = REQUEST_TIMEOUT);
+
+    // Whether file descriptors (e.g. dmabufs) may be passed to the server over the connection
+    bool is_fd_passing_supported() const { return m_connection.is_fd_passing_supported(); }
+    // The format of the hot requests, as agreed on with the server when the vdevice was created
+    RpcMessageFormat get_hot_messages_format() const
+    {
+        return m_connection.is_flat_messages_enabled() ? RpcMessageFormat::FLAT : RpcMessageFormat::PROTOBUF;
+    }
+    void set_flat_messages_enabled(bool is_enabled) { m_connection.set_flat_messages_enabled(is_enabled); }
+
     void register_custom_reply(HailoRpcActionID action_id, std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback);
 
 protected:
     hailo_status message_loop();
+    Expected<std::shared_ptr<ResultEvent>> acquire_result_event();
+    void remove_pending_request(uint32_t message_id);
 
     bool is_running = true;
     std::shared_ptr<ConnectionContext> m_conn_context;
     RpcConnection m_connection;
     std::thread m_thread;
-    std::unordered_map<uint32_t, std::shared_ptr<ResultEvent>> m_events;
     std::unordered_map<HailoRpcActionID, std::function<hailo_status(const MemoryView&, RpcConnection)>> m_custom_callbacks;
     uint32_t m_messages_sent = 0;
+    // Serializes the writes to the connection
     std::mutex m_message_mutex;
+    // Guards m_events and m_free_events. Held only briefly, so the message loop never waits for a request being written.
+    std::mutex m_events_mutex;
+    std::unordered_map<uint32_t, std::shared_ptr<ResultEvent>> m_events;
+    // Events of completed requests, reused by the next requests
+    std::vector<std::shared_ptr<ResultEvent>> m_free_events;
 };
 
 } // namespace hrpc
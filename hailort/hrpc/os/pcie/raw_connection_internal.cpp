@@ -16,8 +16,22 @@
 // TODO: Remove this after we can choose ports in the driver
 #define PCIE_PORT (1213355091)
 
+// The credits of the streaming mode (the messages of each direction that may be in flight)
+#define PCIE_STREAMING_CREDITS_COUNT (16)
+
 using namespace hrpc;
 
+static PcieSessionStreamingParams get_streaming_params()
+{
+    PcieSessionStreamingParams params{};
+    auto message_size_env_var = get_env_variable(HAILO_PCIE_SESSION_STREAMING_MESSAGE_SIZE_ENV_VAR);
+    if (message_size_env_var) {
+        params.message_size = static_cast<size_t>(std::stoull(message_size_env_var.value()));
+        params.credits_count = PCIE_STREAMING_CREDITS_COUNT;
+    }
+    return params;
+}
+
 Expected<std::shared_ptr<ConnectionContext>> PcieConnectionContext::create_shared(bool is_accepting)
 {
     const auto max_size = PcieSession::max_transfer_size();
@@ -86,7 +100,7 @@ Expected<std::shared_ptr<RawConnection>> PcieRawConnection::accept()
     auto new_conn = make_shared_nothrow<PcieRawConnection>(m_context);
     CHECK_NOT_NULL_AS_EXPECTED(new_conn, HAILO_OUT_OF_HOST_MEMORY);
 
-    TRY(auto session, PcieSession::accept(m_context->driver(), PCIE_PORT));
+    TRY(auto session, PcieSession::accept(m_context->driver(), PCIE_PORT, get_streaming_params()));
     status = new_conn->set_session(std::move(session));
     CHECK_SUCCESS(status);
 
@@ -103,7 +117,7 @@ hailo_status PcieRawConnection::set_session(PcieSession &&session)
 
 hailo_status PcieRawConnection::connect()
 {
-    TRY(auto session, PcieSession::connect(m_context->driver(), PCIE_PORT));
+    TRY(auto session, PcieSession::connect(m_context->driver(), PCIE_PORT, get_streaming_params()));
     auto status = set_session(std::move(session));
     CHECK_SUCCESS(status);
 
@@ -116,6 +130,15 @@ hailo_status PcieRawConnection::write(const uint8_t *buffer, size_t size)
         return HAILO_SUCCESS;
     }
 
+    if (m_session->is_streaming()) {
+        // The session copies the buffer to (or from) its own buffers, so it isn't split here
+        auto status = m_session->write(buffer, size, m_timeout);
+        if (HAILO_STREAM_ABORT == status) {
+            return HAILO_COMMUNICATION_CLOSED;
+        }
+        return status;
+    }
+
     const auto alignment = OsUtils::get_dma_able_alignment();
     const auto max_size = PcieSession::max_transfer_size();
     bool is_aligned = ((reinterpret_cast<uintptr_t>(buffer) % alignment )== 0);
@@ -153,6 +176,15 @@ hailo_status PcieRawConnection::read(uint8_t *buffer, size_t size)
         return HAILO_SUCCESS;
     }
 
+    if (m_session->is_streaming()) {
+        // The session copies the buffer to (or from) its own buffers, so it isn't split here
+        auto status = m_session->read(buffer, size, m_timeout);
+        if (HAILO_STREAM_ABORT == status) {
+            return HAILO_COMMUNICATION_CLOSED;
+        }
+        return status;
+    }
+
     const auto alignment = OsUtils::get_dma_able_alignment();
     const auto max_size = PcieSession::max_transfer_size();
     bool is_aligned = ((reinterpret_cast<uintptr_t>(buffer) % alignment) == 0);
@@ -11,6 +11,7 @@
 
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <cstddef>
 #include <string>
 #include <unistd.h>
 #include <common/logger_macros.hpp>
@@ -19,6 +20,33 @@
 
 using namespace hrpc;
 
+#define SOCKET_PATH ("/tmp/unix_socket")
+// The abstract socket's name (sun_path starts with a null byte) - it isn't bound to a file, and is removed once closed
+#define ABSTRACT_SOCKET_NAME ("hailort_hrpc")
+// Opt-in for using an abstract unix socket instead of SOCKET_PATH. Must be set on both the client and the server.
+#define HAILO_HRPC_ABSTRACT_SOCKET_ENV_VAR ("HAILO_HRPC_ABSTRACT_SOCKET")
+
+static bool is_abstract_socket()
+{
+    static const bool is_abstract = is_env_variable_on(HAILO_HRPC_ABSTRACT_SOCKET_ENV_VAR);
+    return is_abstract;
+}
+
+static void fill_server_address(struct sockaddr_un &server_addr, socklen_t &server_addr_size)
+{
+    memset(&server_addr, 0, sizeof(server_addr));
+    server_addr.sun_family = AF_UNIX;
+    if (is_abstract_socket()) {
+        const std::string name = ABSTRACT_SOCKET_NAME;
+        memcpy(server_addr.sun_path + 1, name.c_str(), name.size());
+        server_addr_size = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name.size());
+    } else {
+        const std::string addr = SOCKET_PATH;
+        strncpy(server_addr.sun_path, addr.c_str(), addr.size());
+        server_addr_size = static_cast<socklen_t>(sizeof(server_addr));
+    }
+}
+
 Expected<std::shared_ptr<ConnectionContext>> OsConnectionContext::create_shared(bool is_accepting)
 {
     auto ptr = make_shared_nothrow<OsConnectionContext>(is_accepting);
@@ -35,13 +63,13 @@ Expected<std::shared_ptr<RawConnection>> OsRawConnection::create_shared(std::sha
         CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Socket creation error, errno = {}", errno);
 
         struct sockaddr_un server_addr;
-        memset(&server_addr, 0, sizeof(server_addr));
-        server_addr.sun_family = AF_UNIX;
-        std::string addr = "/tmp/unix_socket";
-        strncpy(server_addr.sun_path, addr.c_str(), addr.size());
+        socklen_t server_addr_size = 0;
+        fill_server_address(server_addr, server_addr_size);
 
-        unlink(addr.c_str());
-        int result = ::bind(fd, (struct sockaddr*)&server_addr, sizeof(server_addr));
+        if (!is_abstract_socket()) {
+            unlink(SOCKET_PATH);
+        }
+        int result = ::bind(fd, (struct sockaddr*)&server_addr, server_addr_size);
         CHECK_AS_EXPECTED(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Bind error, errno = {}", errno);
 
         result = ::listen(fd, 5);
@@ -73,13 +101,10 @@ Expected<std::shared_ptr<RawConnection>> OsRawConnection::accept()
 hailo_status OsRawConnection::connect()
 {
     struct sockaddr_un server_addr;
-    std::string addr = "/tmp/unix_socket";
-
-    memset(&server_addr, 0, sizeof(server_addr));
-    server_addr.sun_family = AF_UNIX;
-    strncpy(server_addr.sun_path, addr.c_str(), addr.size());
+    socklen_t server_addr_size = 0;
+    fill_server_address(server_addr, server_addr_size);
 
-    int result = ::connect(m_fd, (struct sockaddr*)&server_addr, sizeof(server_addr));
+    int result = ::connect(m_fd, (struct sockaddr*)&server_addr, server_addr_size);
     CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Connect error, errno = {}", errno);
 
     return HAILO_SUCCESS;
@@ -119,4 +144,82 @@ hailo_status OsRawConnection::close()
     CHECK(0 == result, HAILO_CLOSE_FAILURE, "Socket close failed, errno = {}", errno);
 
     return HAILO_SUCCESS;
-}
\ No newline at end of file
+}
+
+hailo_status OsRawConnection::write_fd(int fd)
+{
+    // The fd is sent as ancillary data of a single (dummy) byte, so the other side reads it at its place in the stream
+    uint8_t dummy_byte = 0;
+    struct iovec iov;
+    iov.iov_base = &dummy_byte;
+    iov.iov_len = sizeof(dummy_byte);
+
+    union {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    ssize_t result = 0;
+    do {
+        result = ::sendmsg(m_fd, &message, MSG_NOSIGNAL);
+    } while ((result < 0) && (EINTR == errno));
+    if ((result < 0) && (EPIPE == errno)) {
+        return HAILO_COMMUNICATION_CLOSED;
+    }
+    CHECK(result == sizeof(dummy_byte), HAILO_FILE_OPERATION_FAILURE, "Write fd error, errno = {}", errno);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<int> OsRawConnection::read_fd()
+{
+    uint8_t dummy_byte = 0;
+    struct iovec iov;
+    iov.iov_base = &dummy_byte;
+    iov.iov_len = sizeof(dummy_byte);
+
+    union {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    ssize_t result = 0;
+    do {
+        result = ::recvmsg(m_fd, &message, MSG_CMSG_CLOEXEC);
+    } while ((result < 0) && (EINTR == errno));
+    if (0 == result) {
+        return make_unexpected(HAILO_COMMUNICATION_CLOSED); // 0 means the communication is closed
+    }
+    CHECK_AS_EXPECTED(result == sizeof(dummy_byte), HAILO_FILE_OPERATION_FAILURE, "Read fd error, errno = {}", errno);
+    CHECK_AS_EXPECTED(0 == (message.msg_flags & MSG_CTRUNC), HAILO_FILE_OPERATION_FAILURE, "Read fd error, control data truncated");
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    CHECK_AS_EXPECTED((nullptr != cmsg) && (SOL_SOCKET == cmsg->cmsg_level) && (SCM_RIGHTS == cmsg->cmsg_type) &&
+        (CMSG_LEN(sizeof(int)) == cmsg->cmsg_len), HAILO_INTERNAL_FAILURE, "Expected to get an fd, but got none");
+
+    int fd = -1;
+    memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    return fd;
+}
@@ -43,6 +43,10 @@ public:
     virtual hailo_status read(uint8_t *buffer, size_t size) override;
     virtual hailo_status close() override;
 
+    virtual bool is_fd_passing_supported() const override { return true; }
+    virtual hailo_status write_fd(int fd) override;
+    virtual Expected<int> read_fd() override;
+
     OsRawConnection(int fd, std::shared_ptr<OsConnectionContext> context) : m_fd(fd), m_context(context) {}
 private:
     int m_fd;
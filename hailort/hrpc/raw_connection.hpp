@@ -13,6 +13,7 @@
 #include "hailo/expected.hpp"
 #include "vdma/pcie_session.hpp"
 
+#include <atomic>
 #include <memory>
 
 using namespace hailort;
@@ -49,8 +50,20 @@ public:
     virtual hailo_status read(uint8_t *buffer, size_t size) = 0;
     virtual hailo_status close() = 0;
 
+    // Passing file descriptors (e.g. dmabufs) to the other side of the connection is supported only by some connections.
+    virtual bool is_fd_passing_supported() const { return false; }
+    // The fd stays owned by the caller (the other side gets a duplicate of it)
+    virtual hailo_status write_fd(int /*fd*/) { return HAILO_NOT_SUPPORTED; }
+    // The returned fd is owned by the caller
+    virtual Expected<int> read_fd() { return make_unexpected(HAILO_NOT_SUPPORTED); }
+
+    // Whether the hot messages are sent in their flat format (see RpcMessageFormat), as both sides agreed on
+    bool is_flat_messages_enabled() const { return m_is_flat_messages_enabled; }
+    void set_flat_messages_enabled(bool is_enabled) { m_is_flat_messages_enabled = is_enabled; }
+
 protected:
     std::chrono::milliseconds m_timeout = std::chrono::milliseconds(HAILO_INFINITE);
+    std::atomic<bool> m_is_flat_messages_enabled{false};
 };
 
 } // namespace hrpc
@@ -71,6 +71,43 @@ hailo_status RpcConnection::read_buffer(MemoryView buffer)
     return HAILO_SUCCESS;
 }
 
+bool RpcConnection::is_fd_passing_supported() const
+{
+    return m_raw->is_fd_passing_supported();
+}
+
+bool RpcConnection::is_flat_messages_enabled() const
+{
+    return m_raw->is_flat_messages_enabled();
+}
+
+void RpcConnection::set_flat_messages_enabled(bool is_enabled)
+{
+    m_raw->set_flat_messages_enabled(is_enabled);
+}
+
+hailo_status RpcConnection::write_fd(int fd)
+{
+    auto status = m_raw->write_fd(fd);
+    if (HAILO_COMMUNICATION_CLOSED == status) {
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<int> RpcConnection::read_fd()
+{
+    auto fd = m_raw->read_fd();
+    if (HAILO_COMMUNICATION_CLOSED == fd.status()) {
+        return make_unexpected(fd.status());
+    }
+    CHECK_EXPECTED(fd);
+
+    return fd.release();
+}
+
 hailo_status RpcConnection::close()
 {
     if (m_raw) {
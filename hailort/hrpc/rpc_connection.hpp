@@ -43,6 +43,14 @@ public:
     hailo_status write_buffer(const MemoryView &buffer);
     hailo_status read_buffer(MemoryView buffer);
 
+    bool is_fd_passing_supported() const;
+    hailo_status write_fd(int fd);
+    Expected<int> read_fd();
+
+    // Shared by the copies of the connection
+    bool is_flat_messages_enabled() const;
+    void set_flat_messages_enabled(bool is_enabled);
+
     hailo_status close();
 
 private:
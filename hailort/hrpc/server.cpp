@@ -9,15 +9,18 @@
 
 #include "server.hpp"
 
+#include "common/os_utils.hpp"
+
 namespace hrpc
 {
 
 ServerContext::ServerContext(Server &server, RpcConnection connection) :
     m_server(server), m_connection(connection) {}
 
-hailo_status ServerContext::trigger_callback(uint32_t callback_id, hailo_status callback_status, std::function<hailo_status(RpcConnection)> write_buffers_callback)
+hailo_status ServerContext::trigger_callback(uint32_t callback_id, hailo_status callback_status,
+    std::function<hailo_status(RpcConnection)> write_buffers_callback, uint32_t frames_count)
 {
-    return m_server.trigger_callback(callback_id, m_connection, callback_status, write_buffers_callback);
+    return m_server.trigger_callback(callback_id, m_connection, callback_status, write_buffers_callback, frames_count);
 }
 
 RpcConnection &ServerContext::connection()
@@ -26,22 +29,125 @@ RpcConnection &ServerContext::connection()
 }
 
 void Dispatcher::register_action(HailoRpcActionID action_id,
-    std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)> action)
+    std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)> action, ActionThread thread)
 {
-    m_actions[action_id] = action;
+    m_actions[action_id] = Action{action, thread};
 }
 
-Expected<Buffer> Dispatcher::call_action(HailoRpcActionID action_id, const MemoryView &request, ServerContextPtr server_context)
+Expected<Buffer> Dispatcher::call_action(HailoRpcActionID action_id, const MemoryView &request, ServerContextPtr server_context) const
 {
-    if (m_actions.find(action_id) != m_actions.end()) {
-        return m_actions[action_id](request, server_context);
+    auto action = m_actions.find(action_id);
+    if (action != m_actions.end()) {
+        return action->second.function(request, server_context);
     }
     LOGGER__ERROR("Failed to find RPC action {}", action_id);
     return make_unexpected(HAILO_RPC_FAILED);
 }
 
+bool Dispatcher::is_run_on_connection_thread(HailoRpcActionID action_id) const
+{
+    auto action = m_actions.find(action_id);
+    // Unknown actions just fail, no need to pass them to the pool
+    return (action == m_actions.end()) || (ActionThread::CONNECTION == action->second.thread);
+}
+
+ActionsThreadPool::ActionsThreadPool(size_t threads_count) :
+    m_should_quit(false)
+{
+    m_threads.reserve(threads_count);
+    for (size_t i = 0; i < threads_count; i++) {
+        m_threads.emplace_back(&ActionsThreadPool::worker_thread, this);
+    }
+}
+
+ActionsThreadPool::~ActionsThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_quit = true;
+    }
+    m_cv.notify_all();
+
+    for (auto &thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+Expected<ActionsThreadPool::StrandPtr> ActionsThreadPool::create_strand()
+{
+    auto strand = make_shared_nothrow<Strand>();
+    CHECK_NOT_NULL_AS_EXPECTED(strand, HAILO_OUT_OF_HOST_MEMORY);
+    return strand;
+}
+
+hailo_status ActionsThreadPool::enqueue(StrandPtr strand, std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        CHECK(!m_should_quit, HAILO_INTERNAL_FAILURE, "Enqueueing an action while the threads pool is destroyed");
+        strand->tasks.emplace_back(std::move(task));
+        if (strand->is_scheduled) {
+            return HAILO_SUCCESS; // The strand's thread will run the task after the tasks before it
+        }
+        strand->is_scheduled = true;
+        m_scheduled_strands.emplace_back(strand);
+    }
+    m_cv.notify_one();
+
+    return HAILO_SUCCESS;
+}
+
+void ActionsThreadPool::wait_for_strand(StrandPtr strand)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_strand_done_cv.wait(lock, [&strand]() { return !strand->is_scheduled; });
+}
+
+void ActionsThreadPool::worker_thread()
+{
+    OsUtils::set_current_thread_name("HRPC_ACTIONS");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this]() { return m_should_quit || !m_scheduled_strands.empty(); });
+        if (m_should_quit) {
+            break;
+        }
+
+        auto strand = m_scheduled_strands.front();
+        m_scheduled_strands.pop_front();
+        auto task = std::move(strand->tasks.front());
+        strand->tasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        if (strand->tasks.empty()) {
+            strand->is_scheduled = false;
+            m_strand_done_cv.notify_all();
+        } else {
+            // Re-queued after the other strands, so a busy connection doesn't starve the others
+            m_scheduled_strands.emplace_back(strand);
+            m_cv.notify_one();
+        }
+    }
+}
+
 hailo_status Server::serve()
 {
+    size_t threads_count = DEFAULT_HRPC_SERVER_THREADS_COUNT;
+    auto threads_count_env_var = get_env_variable(HAILO_HRPC_SERVER_THREADS_COUNT_ENV_VAR);
+    if (threads_count_env_var) {
+        threads_count = static_cast<size_t>(std::stoul(threads_count_env_var.value()));
+    }
+    if (0 < threads_count) {
+        m_threads_pool = make_unique_nothrow<ActionsThreadPool>(threads_count);
+        CHECK_NOT_NULL(m_threads_pool, HAILO_OUT_OF_HOST_MEMORY);
+    }
+
     while (true) {
         TRY(auto client_connection, create_client_connection());
         auto th = std::thread([this, client_connection]() { serve_client(client_connection); });
@@ -67,38 +173,77 @@ hailo_status Server::serve_client(RpcConnection client_connection)
 {
     auto server_context = make_shared_nothrow<ServerContext>(*this, client_connection);
     CHECK_NOT_NULL(server_context, HAILO_OUT_OF_HOST_MEMORY);
+
+    ActionsThreadPool::StrandPtr strand = nullptr;
+    if (nullptr != m_threads_pool) {
+        TRY(strand, m_threads_pool->create_strand());
+    }
+    // The client's resources are released only once the actions already passed to the pool are done
+    auto cleanup = [this, &strand, client_connection] () {
+        if (nullptr != strand) {
+            m_threads_pool->wait_for_strand(strand);
+        }
+        cleanup_client_resources(client_connection);
+    };
+
     while (true) {
         rpc_message_header_t header;
         auto request = client_connection.read_message(header);
         if (HAILO_COMMUNICATION_CLOSED == request.status()) {
-            cleanup_client_resources(client_connection);
+            cleanup();
             break; // Client EP is disconnected, exit this loop
         }
         CHECK_EXPECTED_AS_STATUS(request);
 
         assert(header.action_id < static_cast<uint32_t>(HailoRpcActionID::MAX_VALUE));
-        TRY(auto reply, m_dispatcher.call_action(static_cast<HailoRpcActionID>(header.action_id), MemoryView(*request), server_context));
-        {
-            std::unique_lock<std::mutex> lock(m_write_mutex);
-            header.size = static_cast<uint32_t>(reply.size());
-
-            auto status = client_connection.write_message(header, MemoryView(reply));
-            if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
-                lock.unlock(); // We need to acquire this lock when releasing the client resources (trigger cb)
-                cleanup_client_resources(client_connection);
-                break; // Client EP is disconnected, exit this loop
-            }
+        const auto action_id = static_cast<HailoRpcActionID>(header.action_id);
+        if ((nullptr != strand) && !m_dispatcher.is_run_on_connection_thread(action_id)) {
+            auto request_ptr = make_shared_nothrow<Buffer>(request.release());
+            CHECK_NOT_NULL(request_ptr, HAILO_OUT_OF_HOST_MEMORY);
+            auto status = m_threads_pool->enqueue(strand, [this, header, request_ptr, server_context, client_connection] () {
+                // A disconnected client is handled by the connection's thread, once its read fails
+                auto status = call_action_and_reply(header, MemoryView(*request_ptr), server_context, client_connection);
+                if ((HAILO_SUCCESS != status) && (HAILO_COMMUNICATION_CLOSED != status)) {
+                    LOGGER__ERROR("Failed to handle RPC action {}, status = {}", header.action_id, status);
+                }
+            });
             CHECK_SUCCESS(status);
+            continue;
         }
+
+        auto status = call_action_and_reply(header, MemoryView(*request), server_context, client_connection);
+        if (HAILO_COMMUNICATION_CLOSED == status) {
+            cleanup();
+            break; // Client EP is disconnected, exit this loop
+        }
+        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
+hailo_status Server::call_action_and_reply(rpc_message_header_t header, const MemoryView &request, ServerContextPtr server_context,
+    RpcConnection client_connection)
+{
+    TRY(auto reply, m_dispatcher.call_action(static_cast<HailoRpcActionID>(header.action_id), request, server_context));
+
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    header.size = static_cast<uint32_t>(reply.size());
+
+    auto status = client_connection.write_message(header, MemoryView(reply));
+    if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
+        return HAILO_COMMUNICATION_CLOSED;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status Server::trigger_callback(uint32_t callback_id, RpcConnection connection, hailo_status callback_status,
-    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+    std::function<hailo_status(RpcConnection)> write_buffers_callback, uint32_t frames_count)
 {
-    TRY(auto reply, CallbackCalledSerializer::serialize_reply(callback_status, callback_id));
+    const auto format = connection.is_flat_messages_enabled() ? RpcMessageFormat::FLAT : RpcMessageFormat::PROTOBUF;
+    TRY(auto reply, CallbackCalledSerializer::serialize_reply(callback_status, callback_id, frames_count, format));
 
     std::unique_lock<std::mutex> lock(m_write_mutex);
     rpc_message_header_t header;
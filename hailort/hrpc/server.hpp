@@ -10,7 +10,10 @@
 
 #define _SERVER_HPP_
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <thread>
 
 #include "rpc_connection.hpp"
@@ -26,8 +29,9 @@ class ServerContext
 {
 public:
     ServerContext(Server &server, RpcConnection connection);
+    // Completes the callbacks [callback_id, callback_id + frames_count) with callback_status
     hailo_status trigger_callback(uint32_t callback_id, hailo_status callback_status,
-        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr, uint32_t frames_count = 1);
     RpcConnection &connection();
 
 private:
@@ -36,17 +40,73 @@ private:
 };
 using ServerContextPtr = std::shared_ptr<ServerContext>;
 
+// Amount of threads running the actions that aren't run on the connections' threads. 0 runs all the actions on the
+// connections' threads.
+#define HAILO_HRPC_SERVER_THREADS_COUNT_ENV_VAR ("HAILO_HRPC_SERVER_THREADS_COUNT")
+#define DEFAULT_HRPC_SERVER_THREADS_COUNT (4)
+
+enum class ActionThread
+{
+    // The action runs on the server's threads pool, so it doesn't block the next requests of the connection
+    POOL,
+    // The action runs on the connection's (reading) thread. Must be used by actions reading buffers from the connection
+    // (following their request), and fits short actions on the fast path.
+    CONNECTION,
+};
+
 class Dispatcher
 {
 public:
     Dispatcher() = default;
 
     void register_action(HailoRpcActionID action_id,
-        std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)> action);
-    Expected<Buffer> call_action(HailoRpcActionID action_id, const MemoryView &request, ServerContextPtr server_context);
+        std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)> action, ActionThread thread = ActionThread::POOL);
+    Expected<Buffer> call_action(HailoRpcActionID action_id, const MemoryView &request, ServerContextPtr server_context) const;
+    bool is_run_on_connection_thread(HailoRpcActionID action_id) const;
+
+private:
+    struct Action {
+        std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)> function;
+        ActionThread thread;
+    };
+    std::unordered_map<HailoRpcActionID, Action> m_actions;
+};
+
+// Runs the actions of the connections' requests on a fixed amount of threads. The actions of each strand (created per
+// connection) run one at a time, in the order they were enqueued, so the requests of a connection stay ordered while
+// the connection's thread goes on reading the next requests.
+class ActionsThreadPool final
+{
+public:
+    struct Strand {
+        std::deque<std::function<void()>> tasks;
+        // Whether the strand is queued to (or run by) a pool thread
+        bool is_scheduled = false;
+    };
+    using StrandPtr = std::shared_ptr<Strand>;
+
+    explicit ActionsThreadPool(size_t threads_count);
+    ~ActionsThreadPool();
+
+    ActionsThreadPool(const ActionsThreadPool &) = delete;
+    ActionsThreadPool &operator=(const ActionsThreadPool &) = delete;
+    ActionsThreadPool(ActionsThreadPool &&) = delete;
+    ActionsThreadPool &operator=(ActionsThreadPool &&) = delete;
+
+    Expected<StrandPtr> create_strand();
+    hailo_status enqueue(StrandPtr strand, std::function<void()> task);
+    // Returns once all the tasks enqueued to the strand are done
+    void wait_for_strand(StrandPtr strand);
 
 private:
-    std::unordered_map<HailoRpcActionID, std::function<Expected<Buffer>(const MemoryView&, ServerContextPtr)>> m_actions;
+    void worker_thread();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_strand_done_cv;
+    std::deque<StrandPtr> m_scheduled_strands;
+    bool m_should_quit;
+    std::vector<std::thread> m_threads;
 };
 
 class Server
@@ -65,12 +125,17 @@ protected:
 private:
     Expected<RpcConnection> create_client_connection();
     hailo_status serve_client(RpcConnection client_connection);
+    // Returns HAILO_COMMUNICATION_CLOSED if the reply couldn't be written because the client disconnected
+    hailo_status call_action_and_reply(rpc_message_header_t header, const MemoryView &request, ServerContextPtr server_context,
+        RpcConnection client_connection);
     hailo_status trigger_callback(uint32_t callback_id, RpcConnection connection, hailo_status callback_status,
-        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr, uint32_t frames_count = 1);
     virtual hailo_status cleanup_client_resources(RpcConnection client_connection) = 0;
 
     Dispatcher m_dispatcher;
     std::mutex m_write_mutex;
+    // nullptr if all the actions run on the connections' threads
+    std::unique_ptr<ActionsThreadPool> m_threads_pool;
 };
 
 } // namespace hrpc
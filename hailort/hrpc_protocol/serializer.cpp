@@ -12,6 +12,8 @@
 #include "hailo/hailort_common.hpp"
 #include "hailo/hailort_defaults.hpp"
 #include "common/utils.hpp"
+#include "utils/buffer_storage.hpp"
+#include "vdma/memory/dma_able_buffer.hpp"
 
 // https://github.com/protocolbuffers/protobuf/tree/master/cmake#notes-on-compiler-warnings
 #if defined(_MSC_VER)
@@ -29,9 +31,173 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <cstring>
+#include <mutex>
+#include <vector>
+
 namespace hailort
 {
 
+// Most messages are much smaller than this - bigger messages get a dedicated allocation
+static constexpr size_t POOLED_MESSAGE_BUFFER_SIZE = 4096;
+static constexpr size_t MAX_POOLED_MESSAGE_BUFFERS = 64;
+
+// Keeps the dma-able buffers of the serialized messages that were already sent, so serializing the next messages
+// doesn't allocate (and page-fault) a new dma-able buffer per message.
+class MessageBufferPool final
+{
+public:
+    static std::shared_ptr<MessageBufferPool> get_instance()
+    {
+        static auto instance = make_shared_nothrow<MessageBufferPool>();
+        return instance;
+    }
+
+    Expected<vdma::DmaAbleBufferPtr> acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free_buffers.empty()) {
+                auto buffer = m_free_buffers.back();
+                m_free_buffers.pop_back();
+                return buffer;
+            }
+        }
+        return vdma::DmaAbleBuffer::create_by_allocation(POOLED_MESSAGE_BUFFER_SIZE);
+    }
+
+    void release(vdma::DmaAbleBufferPtr buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free_buffers.size() < MAX_POOLED_MESSAGE_BUFFERS) {
+            m_free_buffers.emplace_back(std::move(buffer));
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<vdma::DmaAbleBufferPtr> m_free_buffers;
+};
+
+// Storage of a serialized message, returning its dma-able buffer to the pool once the message is destroyed.
+class PooledMessageStorage final : public BufferStorage
+{
+public:
+    PooledMessageStorage(vdma::DmaAbleBufferPtr dma_able_buffer, size_t message_size,
+            std::weak_ptr<MessageBufferPool> pool) :
+        m_dma_able_buffer(std::move(dma_able_buffer)),
+        m_message_size(message_size),
+        m_pool(std::move(pool))
+    {}
+
+    virtual ~PooledMessageStorage()
+    {
+        auto pool = m_pool.lock();
+        if (pool) {
+            pool->release(std::move(m_dma_able_buffer));
+        }
+    }
+
+    virtual size_t size() const override { return m_message_size; }
+    virtual void *user_address() override { return m_dma_able_buffer->user_address(); }
+    virtual Expected<void *> release() noexcept override { return make_unexpected(HAILO_INVALID_OPERATION); }
+    virtual Expected<vdma::DmaAbleBufferPtr> get_dma_able_buffer() override { return vdma::DmaAbleBufferPtr(m_dma_able_buffer); }
+
+private:
+    vdma::DmaAbleBufferPtr m_dma_able_buffer;
+    const size_t m_message_size;
+    std::weak_ptr<MessageBufferPool> m_pool;
+};
+
+static Expected<Buffer> create_message_buffer(size_t size)
+{
+    auto pool = MessageBufferPool::get_instance();
+    if ((0 == size) || (size > POOLED_MESSAGE_BUFFER_SIZE) || (nullptr == pool)) {
+        return Buffer::create(size, BufferStorageParams::create_dma());
+    }
+
+    TRY(auto dma_able_buffer, pool->acquire());
+    auto storage = make_shared_nothrow<PooledMessageStorage>(std::move(dma_able_buffer), size, pool);
+    CHECK_NOT_NULL_AS_EXPECTED(storage, HAILO_OUT_OF_HOST_MEMORY);
+
+    // The messages aren't looked up by their address, so there is no need to register their storage
+    return Buffer::create(storage, false);
+}
+
+// The flat messages start with this byte, which never starts a protobuf message (field number 0 is invalid) - so the
+// receivers tell the formats apart by the message itself.
+static constexpr uint8_t RPC_FLAT_MESSAGE_MARKER = 0;
+static constexpr uint8_t RPC_FLAT_MESSAGE_VERSION = 1;
+
+#pragma pack(push, 1)
+struct rpc_flat_message_header_t
+{
+    uint8_t marker;
+    uint8_t version;
+    uint16_t reserved;
+};
+
+struct rpc_flat_run_async_request_t
+{
+    rpc_flat_message_header_t header;
+    rpc_object_handle_t configured_infer_model_handle;
+    rpc_object_handle_t infer_model_handle;
+    rpc_object_handle_t callback_handle;
+    uint32_t frames_count;
+    // Followed by dma_buffer_edges_count bytes, non zero for each edge bound to a dmabuf
+    uint32_t dma_buffer_edges_count;
+};
+
+struct rpc_flat_callback_called_reply_t
+{
+    rpc_flat_message_header_t header;
+    uint32_t status;
+    rpc_object_handle_t callback_handle;
+    uint32_t frames_count;
+};
+#pragma pack(pop)
+
+static bool is_flat_message(const MemoryView &serialized_message)
+{
+    return (0 < serialized_message.size()) && (RPC_FLAT_MESSAGE_MARKER == serialized_message.data()[0]);
+}
+
+// The message is copied out, as the serialized message isn't necessarily aligned
+template<typename T>
+static Expected<T> read_flat_message(const MemoryView &serialized_message, const char *message_name)
+{
+    CHECK_AS_EXPECTED(serialized_message.size() >= sizeof(T), HAILO_RPC_FAILED,
+        "Failed to de-serialize '{}', flat message size {} is smaller than {}", message_name, serialized_message.size(), sizeof(T));
+
+    T message;
+    std::memcpy(&message, serialized_message.data(), sizeof(message));
+    CHECK_AS_EXPECTED(RPC_FLAT_MESSAGE_VERSION == message.header.version, HAILO_RPC_FAILED,
+        "Failed to de-serialize '{}', unsupported flat message version {}", message_name, message.header.version);
+    return message;
+}
+
+static rpc_flat_message_header_t create_flat_message_header()
+{
+    rpc_flat_message_header_t header{};
+    header.marker = RPC_FLAT_MESSAGE_MARKER;
+    header.version = RPC_FLAT_MESSAGE_VERSION;
+    return header;
+}
+
+template<typename T>
+static Expected<Buffer> serialize_message(const T &message, const char *message_name)
+{
+    // ByteSizeLong caches the size, so it is calculated only once per message
+    const auto message_size = message.ByteSizeLong();
+    TRY(auto serialized_message, create_message_buffer(message_size));
+
+    const auto end = message.SerializeWithCachedSizesToArray(serialized_message.data());
+    CHECK_AS_EXPECTED(static_cast<size_t>(end - serialized_message.data()) == message_size,
+        HAILO_RPC_FAILED, "Failed to serialize '{}'", message_name);
+
+    return serialized_message;
+}
+
 Expected<Buffer> CreateVDeviceSerializer::serialize_request(const hailo_vdevice_params_t &params)
 {
     VDevice_Create_Request request;
@@ -39,17 +205,12 @@ Expected<Buffer> CreateVDeviceSerializer::serialize_request(const hailo_vdevice_
     auto proto_params = request.mutable_params();
     proto_params->set_scheduling_algorithm(params.scheduling_algorithm);
     proto_params->set_group_id(params.group_id == nullptr ? "" : std::string(params.group_id));
+    request.set_supports_flat_messages(true);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateVDevice'");
-
-    return serialized_request;
+    return serialize_message(request, "CreateVDevice");
 }
 
-Expected<hailo_vdevice_params_t> CreateVDeviceSerializer::deserialize_request(const MemoryView &serialized_request)
+Expected<std::tuple<hailo_vdevice_params_t, bool>> CreateVDeviceSerializer::deserialize_request(const MemoryView &serialized_request)
 {
     VDevice_Create_Request request;
 
@@ -65,33 +226,30 @@ Expected<hailo_vdevice_params_t> CreateVDeviceSerializer::deserialize_request(co
         multi_process_service_flag
     };
 
-    return res;
+    return std::make_tuple(res, request.supports_flat_messages());
 }
 
-Expected<Buffer> CreateVDeviceSerializer::serialize_reply(hailo_status status, rpc_object_handle_t vdevice_handle)
+Expected<Buffer> CreateVDeviceSerializer::serialize_reply(hailo_status status, rpc_object_handle_t vdevice_handle,
+    bool use_flat_messages)
 {
     VDevice_Create_Reply reply;
 
     reply.set_status(status);
     auto proto_vdevice_handle = reply.mutable_vdevice_handle();
     proto_vdevice_handle->set_id(vdevice_handle);
+    reply.set_use_flat_messages(use_flat_messages);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateVDevice'");
-
-    return serialized_reply;
+    return serialize_message(reply, "CreateVDevice");
 }
 
-Expected<std::tuple<hailo_status, rpc_object_handle_t>> CreateVDeviceSerializer::deserialize_reply(const MemoryView &serialized_reply)
+Expected<std::tuple<hailo_status, rpc_object_handle_t, bool>> CreateVDeviceSerializer::deserialize_reply(const MemoryView &serialized_reply)
 {
     VDevice_Create_Reply reply;
 
     CHECK_AS_EXPECTED(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to de-serialize 'CreateVDevice'");
 
-    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.vdevice_handle().id());
+    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.vdevice_handle().id(), reply.use_flat_messages());
 }
 
 Expected<Buffer> DestroyVDeviceSerializer::serialize_request(rpc_object_handle_t vdevice_handle)
@@ -101,12 +259,7 @@ Expected<Buffer> DestroyVDeviceSerializer::serialize_request(rpc_object_handle_t
     auto proto_vdevice_handle= request.mutable_vdevice_handle();
     proto_vdevice_handle->set_id(vdevice_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyVDevice'");
-
-    return serialized_request;
+    return serialize_message(request, "DestroyVDevice");
 }
 
 Expected<rpc_object_handle_t> DestroyVDeviceSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -124,12 +277,7 @@ Expected<Buffer> DestroyVDeviceSerializer::serialize_reply(hailo_status status)
     VDevice_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyVDevice'");
-
-    return serialized_reply;
+    return serialize_message(reply, "DestroyVDevice");
 }
 
 hailo_status DestroyVDeviceSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -151,12 +299,7 @@ Expected<Buffer> CreateInferModelSerializer::serialize_request(rpc_object_handle
 
     request.set_hef_size(hef_size);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateVInferModel'");
-
-    return serialized_request;
+    return serialize_message(request, "CreateVInferModel");
 }
 
 Expected<std::tuple<rpc_object_handle_t, uint64_t>> CreateInferModelSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -177,12 +320,7 @@ Expected<Buffer> CreateInferModelSerializer::serialize_reply(hailo_status status
     auto proto_infer_model_handle = reply.mutable_infer_model_handle();
     proto_infer_model_handle->set_id(infer_model_handle);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateVInferModel'");
-
-    return serialized_reply;
+    return serialize_message(reply, "CreateVInferModel");
 }
 
 Expected<std::tuple<hailo_status, rpc_object_handle_t>> CreateInferModelSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -202,12 +340,7 @@ Expected<Buffer> DestroyInferModelSerializer::serialize_request(rpc_object_handl
     auto proto_infer_model_handle = request.mutable_infer_model_handle();
     proto_infer_model_handle->set_id(infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyInferModel'");
-
-    return serialized_request;
+    return serialize_message(request, "DestroyInferModel");
 }
 
 Expected<rpc_object_handle_t> DestroyInferModelSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -225,12 +358,7 @@ Expected<Buffer> DestroyInferModelSerializer::serialize_reply(hailo_status statu
     InferModel_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyInferModel'");
-
-    return serialized_reply;
+    return serialize_message(reply, "DestroyInferModel");
 }
 
 hailo_status DestroyInferModelSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -278,13 +406,9 @@ Expected<Buffer> CreateConfiguredInferModelSerializer::serialize_request(rpc_cre
     request.set_batch_size(static_cast<uint32_t>(params.batch_size));
     request.set_power_mode(static_cast<uint32_t>(params.power_mode));
     request.set_latency_flag(static_cast<uint32_t>(params.latency_flag));
+    request.set_supports_compact_nms_outputs(params.supports_compact_nms_outputs);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateConfiguredInferModel'");
-
-    return serialized_request;
+    return serialize_message(request, "CreateConfiguredInferModel");
 }
 
 Expected<rpc_create_configured_infer_model_request_params_t> CreateConfiguredInferModelSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -323,12 +447,13 @@ Expected<rpc_create_configured_infer_model_request_params_t> CreateConfiguredInf
     request_params.batch_size = static_cast<uint16_t>(request.batch_size());
     request_params.power_mode = static_cast<hailo_power_mode_t>(request.power_mode());
     request_params.latency_flag = static_cast<hailo_latency_measurement_flags_t>(request.latency_flag());
+    request_params.supports_compact_nms_outputs = request.supports_compact_nms_outputs();
 
     return request_params;
 }
 
 Expected<Buffer> CreateConfiguredInferModelSerializer::serialize_reply(hailo_status status, rpc_object_handle_t configured_infer_handle,
-    uint32_t async_queue_size)
+    uint32_t async_queue_size, const std::vector<std::string> &compact_outputs)
 {
     InferModel_CreateConfiguredInferModel_Reply reply;
 
@@ -336,16 +461,14 @@ Expected<Buffer> CreateConfiguredInferModelSerializer::serialize_reply(hailo_sta
     auto proto_configured_infer_model_handle = reply.mutable_configured_infer_model_handle();
     proto_configured_infer_model_handle->set_id(configured_infer_handle);
     reply.set_async_queue_size(async_queue_size);
+    for (const auto &output_name : compact_outputs) {
+        reply.add_compact_outputs(output_name);
+    }
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CreateConfiguredInferModel'");
-
-    return serialized_reply;
+    return serialize_message(reply, "CreateConfiguredInferModel");
 }
 
-Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t>> CreateConfiguredInferModelSerializer::deserialize_reply(
+Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t, std::vector<std::string>>> CreateConfiguredInferModelSerializer::deserialize_reply(
     const MemoryView &serialized_reply)
 {
     InferModel_CreateConfiguredInferModel_Reply reply;
@@ -353,7 +476,9 @@ Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t>> CreateConfigur
     CHECK_AS_EXPECTED(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to de-serialize 'CreateConfiguredInferModel'");
 
-    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.configured_infer_model_handle().id(), reply.async_queue_size());
+    std::vector<std::string> compact_outputs(reply.compact_outputs().begin(), reply.compact_outputs().end());
+    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.configured_infer_model_handle().id(),
+        reply.async_queue_size(), std::move(compact_outputs));
 }
 
 Expected<Buffer> DestroyConfiguredInferModelSerializer::serialize_request(rpc_object_handle_t configured_infer_model_handle)
@@ -363,12 +488,7 @@ Expected<Buffer> DestroyConfiguredInferModelSerializer::serialize_request(rpc_ob
     auto proto_infer_model_handle = request.mutable_configured_infer_model_handle();
     proto_infer_model_handle->set_id(configured_infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyConfiguredInferModel'");
-
-    return serialized_request;
+    return serialize_message(request, "DestroyConfiguredInferModel");
 }
 
 Expected<rpc_object_handle_t> DestroyConfiguredInferModelSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -386,12 +506,7 @@ Expected<Buffer> DestroyConfiguredInferModelSerializer::serialize_reply(hailo_st
     ConfiguredInferModel_Destroy_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'DestroyConfiguredInferModel'");
-
-    return serialized_reply;
+    return serialize_message(reply, "DestroyConfiguredInferModel");
 }
 
 hailo_status DestroyConfiguredInferModelSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -413,12 +528,7 @@ Expected<Buffer> SetSchedulerTimeoutSerializer::serialize_request(rpc_object_han
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
     request.set_timeout(static_cast<uint32_t>(timeout.count()));
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerTimeout'");
-
-    return serialized_request;
+    return serialize_message(request, "SetSchedulerTimeout");
 }
 
 Expected<std::tuple<rpc_object_handle_t, std::chrono::milliseconds>> SetSchedulerTimeoutSerializer::deserialize_request(
@@ -437,12 +547,7 @@ Expected<Buffer> SetSchedulerTimeoutSerializer::serialize_reply(hailo_status sta
     ConfiguredInferModel_SetSchedulerTimeout_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerTimeout'");
-
-    return serialized_reply;
+    return serialize_message(reply, "SetSchedulerTimeout");
 }
 
 hailo_status SetSchedulerTimeoutSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -463,12 +568,7 @@ Expected<Buffer> SetSchedulerThresholdSerializer::serialize_request(rpc_object_h
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
     request.set_threshold(threshold);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerThreshold'");
-
-    return serialized_request;
+    return serialize_message(request, "SetSchedulerThreshold");
 }
 
 Expected<std::tuple<rpc_object_handle_t, uint32_t>> SetSchedulerThresholdSerializer::deserialize_request(
@@ -487,12 +587,7 @@ Expected<Buffer> SetSchedulerThresholdSerializer::serialize_reply(hailo_status s
     ConfiguredInferModel_SetSchedulerThreshold_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerThreshold'");
-
-    return serialized_reply;
+    return serialize_message(reply, "SetSchedulerThreshold");
 }
 
 hailo_status SetSchedulerThresholdSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -513,12 +608,7 @@ Expected<Buffer> SetSchedulerPrioritySerializer::serialize_request(rpc_object_ha
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
     request.set_priority(priority);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerPriority'");
-
-    return serialized_request;
+    return serialize_message(request, "SetSchedulerPriority");
 }
 
 Expected<std::tuple<rpc_object_handle_t, uint32_t>> SetSchedulerPrioritySerializer::deserialize_request(
@@ -537,12 +627,7 @@ Expected<Buffer> SetSchedulerPrioritySerializer::serialize_reply(hailo_status st
     ConfiguredInferModel_SetSchedulerPriority_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'SetSchedulerPriority'");
-
-    return serialized_reply;
+    return serialize_message(reply, "SetSchedulerPriority");
 }
 
 hailo_status SetSchedulerPrioritySerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -562,12 +647,7 @@ Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_request(rpc_object
     auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'GetHwLatencyMeasurement'");
-
-    return serialized_request;
+    return serialize_message(request, "GetHwLatencyMeasurement");
 }
 
 Expected<rpc_object_handle_t> GetHwLatencyMeasurementSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -586,12 +666,7 @@ Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_reply(hailo_status
     reply.set_status(status);
     reply.set_avg_hw_latency(avg_hw_latency);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'GetHwLatencyMeasurement'");
-
-    return serialized_reply;
+    return serialize_message(reply, "GetHwLatencyMeasurement");
 }
 
 Expected<std::tuple<hailo_status, std::chrono::nanoseconds>> GetHwLatencyMeasurementSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -611,12 +686,7 @@ Expected<Buffer> ActivateSerializer::serialize_request(rpc_object_handle_t confi
     auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Activate'");
-
-    return serialized_request;
+    return serialize_message(request, "Activate");
 }
 
 Expected<rpc_object_handle_t> ActivateSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -634,12 +704,7 @@ Expected<Buffer> ActivateSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Activate_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Activate'");
-
-    return serialized_reply;
+    return serialize_message(reply, "Activate");
 }
 
 hailo_status ActivateSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -659,12 +724,7 @@ Expected<Buffer> DeactivateSerializer::serialize_request(rpc_object_handle_t con
     auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Deactivate'");
-
-    return serialized_request;
+    return serialize_message(request, "Deactivate");
 }
 
 Expected<rpc_object_handle_t> DeactivateSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -682,12 +742,7 @@ Expected<Buffer> DeactivateSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Deactivate_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Deactivate'");
-
-    return serialized_reply;
+    return serialize_message(reply, "Deactivate");
 }
 
 hailo_status DeactivateSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -707,12 +762,7 @@ Expected<Buffer> ShutdownSerializer::serialize_request(rpc_object_handle_t confi
     auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
     proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Shutdown'");
-
-    return serialized_request;
+    return serialize_message(request, "Shutdown");
 }
 
 Expected<rpc_object_handle_t> ShutdownSerializer::deserialize_request(const MemoryView &serialized_request)
@@ -730,12 +780,7 @@ Expected<Buffer> ShutdownSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_Shutdown_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'Shutdown'");
-
-    return serialized_reply;
+    return serialize_message(reply, "Shutdown");
 }
 
 hailo_status ShutdownSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -748,9 +793,56 @@ hailo_status ShutdownSerializer::deserialize_reply(const MemoryView &serialized_
     return static_cast<hailo_status>(reply.status());
 }
 
+static Expected<Buffer> serialize_flat_run_async_request(rpc_object_handle_t configured_infer_model_handle,
+    rpc_object_handle_t infer_model_handle, rpc_object_handle_t callback_handle, uint32_t frames_count,
+    const std::vector<bool> &dma_buffer_edges)
+{
+    rpc_flat_run_async_request_t request{};
+    request.header = create_flat_message_header();
+    request.configured_infer_model_handle = configured_infer_model_handle;
+    request.infer_model_handle = infer_model_handle;
+    request.callback_handle = callback_handle;
+    request.frames_count = frames_count;
+    request.dma_buffer_edges_count = static_cast<uint32_t>(dma_buffer_edges.size());
+
+    TRY(auto serialized_request, create_message_buffer(sizeof(request) + dma_buffer_edges.size()));
+    std::memcpy(serialized_request.data(), &request, sizeof(request));
+    auto edges = serialized_request.data() + sizeof(request);
+    for (size_t i = 0; i < dma_buffer_edges.size(); i++) {
+        edges[i] = dma_buffer_edges[i] ? 1 : 0;
+    }
+
+    return serialized_request;
+}
+
+static Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t, uint32_t, std::vector<bool>>>
+    deserialize_flat_run_async_request(const MemoryView &serialized_request)
+{
+    TRY(const auto request, read_flat_message<rpc_flat_run_async_request_t>(serialized_request, "RunAsync"));
+    CHECK_AS_EXPECTED(serialized_request.size() == (sizeof(request) + request.dma_buffer_edges_count), HAILO_RPC_FAILED,
+        "Failed to de-serialize 'RunAsync', flat message size {} doesn't fit its {} dmabuf edges", serialized_request.size(),
+        request.dma_buffer_edges_count);
+
+    const auto edges = serialized_request.data() + sizeof(request);
+    std::vector<bool> dma_buffer_edges(request.dma_buffer_edges_count);
+    for (size_t i = 0; i < dma_buffer_edges.size(); i++) {
+        dma_buffer_edges[i] = (0 != edges[i]);
+    }
+
+    const uint32_t frames_count = (0 == request.frames_count) ? 1 : request.frames_count;
+    return std::make_tuple(request.configured_infer_model_handle, request.infer_model_handle, request.callback_handle,
+        frames_count, std::move(dma_buffer_edges));
+}
+
 Expected<Buffer> RunAsyncSerializer::serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
-    rpc_object_handle_t callback_handle)
+    rpc_object_handle_t callback_handle, uint32_t frames_count, const std::vector<bool> &dma_buffer_edges,
+    RpcMessageFormat format)
 {
+    if (RpcMessageFormat::FLAT == format) {
+        return serialize_flat_run_async_request(configured_infer_model_handle, infer_model_handle, callback_handle,
+            frames_count, dma_buffer_edges);
+    }
+
     ConfiguredInferModel_AsyncInfer_Request request;
 
     auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
@@ -761,25 +853,30 @@ Expected<Buffer> RunAsyncSerializer::serialize_request(rpc_object_handle_t confi
 
     auto proto_cb_handle = request.mutable_callback_handle();
     proto_cb_handle->set_id(callback_handle);
+    request.set_frames_count(frames_count);
+    for (const auto is_dma_buffer : dma_buffer_edges) {
+        request.add_dma_buffer_edges(is_dma_buffer);
+    }
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
-
-    return serialized_request;
+    return serialize_message(request, "RunAsync");
 }
 
-Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t>> RunAsyncSerializer::deserialize_request(
-    const MemoryView &serialized_request)
+Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t, uint32_t, std::vector<bool>>>
+    RunAsyncSerializer::deserialize_request(const MemoryView &serialized_request)
 {
+    if (is_flat_message(serialized_request)) {
+        return deserialize_flat_run_async_request(serialized_request);
+    }
+
     ConfiguredInferModel_AsyncInfer_Request request;
 
     CHECK_AS_EXPECTED(request.ParseFromArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
         HAILO_RPC_FAILED, "Failed to de-serialize 'RunAsync'");
 
+    const uint32_t frames_count = (0 == request.frames_count()) ? 1 : request.frames_count();
+    std::vector<bool> dma_buffer_edges(request.dma_buffer_edges().begin(), request.dma_buffer_edges().end());
     return std::make_tuple(request.configured_infer_model_handle().id(), request.infer_model_handle().id(),
-        request.callback_handle().id());
+        request.callback_handle().id(), frames_count, std::move(dma_buffer_edges));
 }
 
 Expected<Buffer> RunAsyncSerializer::serialize_reply(hailo_status status)
@@ -787,12 +884,7 @@ Expected<Buffer> RunAsyncSerializer::serialize_reply(hailo_status status)
     ConfiguredInferModel_AsyncInfer_Reply reply;
     reply.set_status(status);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
-
-    return serialized_reply;
+    return serialize_message(reply, "RunAsync");
 }
 
 hailo_status RunAsyncSerializer::deserialize_reply(const MemoryView &serialized_reply)
@@ -805,30 +897,46 @@ hailo_status RunAsyncSerializer::deserialize_reply(const MemoryView &serialized_
     return static_cast<hailo_status>(reply.status());
 }
 
-Expected<Buffer> CallbackCalledSerializer::serialize_reply(hailo_status status, rpc_object_handle_t callback_handle)
+Expected<Buffer> CallbackCalledSerializer::serialize_reply(hailo_status status, rpc_object_handle_t callback_handle,
+    uint32_t frames_count, RpcMessageFormat format)
 {
+    if (RpcMessageFormat::FLAT == format) {
+        rpc_flat_callback_called_reply_t reply{};
+        reply.header = create_flat_message_header();
+        reply.status = status;
+        reply.callback_handle = callback_handle;
+        reply.frames_count = frames_count;
+
+        TRY(auto serialized_reply, create_message_buffer(sizeof(reply)));
+        std::memcpy(serialized_reply.data(), &reply, sizeof(reply));
+        return serialized_reply;
+    }
+
     CallbackCalled_Reply reply;
 
     reply.set_status(status);
     auto proto_callback_handle = reply.mutable_callback_handle();
     proto_callback_handle->set_id(callback_handle);
+    reply.set_frames_count(frames_count);
 
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CallbackCalled'");
-
-    return serialized_reply;
+    return serialize_message(reply, "CallbackCalled");
 }
 
-Expected<std::tuple<hailo_status, rpc_object_handle_t>> CallbackCalledSerializer::deserialize_reply(const MemoryView &serialized_reply)
+Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t>> CallbackCalledSerializer::deserialize_reply(const MemoryView &serialized_reply)
 {
+    if (is_flat_message(serialized_reply)) {
+        TRY(const auto reply, read_flat_message<rpc_flat_callback_called_reply_t>(serialized_reply, "CallbackCalled"));
+        const uint32_t frames_count = (0 == reply.frames_count) ? 1 : reply.frames_count;
+        return std::make_tuple(static_cast<hailo_status>(reply.status), reply.callback_handle, frames_count);
+    }
+
     CallbackCalled_Reply reply;
 
     CHECK_AS_EXPECTED(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to de-serialize 'CallbackCalled'");
 
-    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.callback_handle().id());
+    const uint32_t frames_count = (0 == reply.frames_count()) ? 1 : reply.frames_count();
+    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.callback_handle().id(), frames_count);
 }
 
 } /* namespace hailort */
@@ -16,6 +16,7 @@
 
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 namespace hailort
 {
@@ -46,6 +47,14 @@ enum class HailoRpcActionID {
     MAX_VALUE,
 };
 
+// The format of the messages sent per frame (ConfiguredInferModel_AsyncInfer_Request and CallbackCalled_Reply).
+// The flat format is a fixed layout that is copied as is, instead of being serialized and parsed. It is used only once
+// both sides of the connection agreed on it (on VDEVICE__CREATE), and receivers accept both formats.
+enum class RpcMessageFormat {
+    PROTOBUF,
+    FLAT,
+};
+
 using rpc_object_handle_t = uint32_t;
 struct rpc_stream_params_t
 {
@@ -66,6 +75,7 @@ struct rpc_create_configured_infer_model_request_params_t
     uint16_t batch_size;
     hailo_power_mode_t power_mode;
     hailo_latency_measurement_flags_t latency_flag;
+    bool supports_compact_nms_outputs;
 };
 
 class CreateVDeviceSerializer
@@ -73,11 +83,15 @@ class CreateVDeviceSerializer
 public:
     CreateVDeviceSerializer() = delete;
 
+    // The request advertises the support of the flat format of the hot messages
     static Expected<Buffer> serialize_request(const hailo_vdevice_params_t &params);
-    static Expected<hailo_vdevice_params_t> deserialize_request(const MemoryView &serialized_request);
+    // Returns (params, supports_flat_messages)
+    static Expected<std::tuple<hailo_vdevice_params_t, bool>> deserialize_request(const MemoryView &serialized_request);
 
-    static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t vdevice_handle = INVALID_HANDLE_ID);
-    static Expected<std::tuple<hailo_status, rpc_object_handle_t>> deserialize_reply(const MemoryView &serialized_reply);
+    static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t vdevice_handle = INVALID_HANDLE_ID,
+        bool use_flat_messages = false);
+    // Returns (status, vdevice_handle, use_flat_messages)
+    static Expected<std::tuple<hailo_status, rpc_object_handle_t, bool>> deserialize_reply(const MemoryView &serialized_reply);
 };
 
 class DestroyVDeviceSerializer
@@ -125,8 +139,9 @@ public:
     static Expected<rpc_create_configured_infer_model_request_params_t> deserialize_request(const MemoryView &serialized_request);
 
     static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t configured_infer_handle = INVALID_HANDLE_ID,
-        uint32_t async_queue_size = 0);
-    static Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t>> deserialize_reply(const MemoryView &serialized_reply);
+        uint32_t async_queue_size = 0, const std::vector<std::string> &compact_outputs = {});
+    static Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t, std::vector<std::string>>> deserialize_reply(
+        const MemoryView &serialized_reply);
 };
 
 class DestroyConfiguredInferModelSerializer
@@ -230,9 +245,14 @@ class RunAsyncSerializer
 public:
     RunAsyncSerializer() = delete;
 
+    // The request's frames use the callback handles [callback_handle, callback_handle + frames_count).
+    // dma_buffer_edges marks the edges passed as dmabuf fds (see ConfiguredInferModel_AsyncInfer_Request), empty if none.
     static Expected<Buffer> serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
-        rpc_object_handle_t callback_handle);
-    static Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t>> deserialize_request(const MemoryView &serialized_request);
+        rpc_object_handle_t callback_handle, uint32_t frames_count = 1, const std::vector<bool> &dma_buffer_edges = {},
+        RpcMessageFormat format = RpcMessageFormat::PROTOBUF);
+    // Returns (configured_infer_model_handle, infer_model_handle, callback_handle, frames_count, dma_buffer_edges)
+    static Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t, uint32_t, std::vector<bool>>>
+        deserialize_request(const MemoryView &serialized_request);
 
     static Expected<Buffer> serialize_reply(hailo_status status);
     static hailo_status deserialize_reply(const MemoryView &serialized_reply);
@@ -243,8 +263,10 @@ class CallbackCalledSerializer
 public:
     CallbackCalledSerializer() = delete;
 
-    static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t callback_handle = INVALID_HANDLE_ID);
-    static Expected<std::tuple<hailo_status, rpc_object_handle_t>> deserialize_reply(const MemoryView &serialized_reply);
+    static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t callback_handle = INVALID_HANDLE_ID,
+        uint32_t frames_count = 1, RpcMessageFormat format = RpcMessageFormat::PROTOBUF);
+    // Returns (status, callback_handle, frames_count)
+    static Expected<std::tuple<hailo_status, rpc_object_handle_t, uint32_t>> deserialize_reply(const MemoryView &serialized_reply);
 };
 
 
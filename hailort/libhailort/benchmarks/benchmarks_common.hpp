@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file benchmarks_common.hpp
+ * @brief Utilities shared by the micro benchmarks
+ **/
+
+#ifndef _HAILO_BENCHMARKS_COMMON_HPP_
+#define _HAILO_BENCHMARKS_COMMON_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/hailort_common.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+namespace hailort
+{
+namespace benchmarks
+{
+
+// The data is random but the same on each run, so that the runs are comparable
+static const uint32_t BENCHMARKS_SEED = 0x4a11;
+
+#define BENCHMARK_CHECK_SUCCESS(state, status, message)         \
+    do {                                                        \
+        if (HAILO_SUCCESS != (status)) {                        \
+            (state).SkipWithError(message);                     \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+inline hailo_3d_image_shape_t make_shape(int64_t height, int64_t width, int64_t features)
+{
+    return hailo_3d_image_shape_t{static_cast<uint32_t>(height), static_cast<uint32_t>(width), static_cast<uint32_t>(features)};
+}
+
+inline hailo_format_t make_format(hailo_format_type_t type, hailo_format_order_t order)
+{
+    return hailo_format_t{type, order, HAILO_FORMAT_FLAGS_NONE};
+}
+
+inline hailo_quant_info_t make_quant_info(float32_t qp_zp, float32_t qp_scale)
+{
+    return hailo_quant_info_t{qp_zp, qp_scale, 0, 255};
+}
+
+inline std::vector<uint8_t> random_buffer(size_t size)
+{
+    std::mt19937 generator(BENCHMARKS_SEED);
+    std::uniform_int_distribution<uint32_t> distribution(0, UINT8_MAX);
+    std::vector<uint8_t> buffer(size);
+    for (auto &value : buffer) {
+        value = static_cast<uint8_t>(distribution(generator));
+    }
+    return buffer;
+}
+
+inline std::vector<float32_t> random_float_buffer(size_t elements_count, float32_t min_value, float32_t max_value)
+{
+    std::mt19937 generator(BENCHMARKS_SEED);
+    std::uniform_real_distribution<float32_t> distribution(min_value, max_value);
+    std::vector<float32_t> buffer(elements_count);
+    for (auto &value : buffer) {
+        value = distribution(generator);
+    }
+    return buffer;
+}
+
+// Returns a frame of random values of the given type (floats between 0 and 1, any value for the integer types)
+inline std::vector<uint8_t> random_frame(size_t frame_size, hailo_format_type_t format_type)
+{
+    if (HAILO_FORMAT_TYPE_FLOAT32 != format_type) {
+        return random_buffer(frame_size);
+    }
+
+    const auto values = random_float_buffer(frame_size / sizeof(float32_t), 0.0f, 1.0f);
+    std::vector<uint8_t> frame(frame_size);
+    std::memcpy(frame.data(), values.data(), values.size() * sizeof(float32_t));
+    return frame;
+}
+
+} /* namespace benchmarks */
+} /* namespace hailort */
+
+#endif /* _HAILO_BENCHMARKS_COMMON_HPP_ */
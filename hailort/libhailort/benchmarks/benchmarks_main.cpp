@@ -0,0 +1,15 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file benchmarks_main.cpp
+ * @brief Entry point of hailort_benchmarks - micro benchmarks of the host side processing, which don't need a device.
+ *
+ * Run with --benchmark_filter=<regex> to run some of the benchmarks, and with --benchmark_out=<file> to save the results
+ * (e.g. for comparing two versions with the compare.py tool of Google Benchmark).
+ **/
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
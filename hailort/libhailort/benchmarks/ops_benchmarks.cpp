@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file ops_benchmarks.cpp
+ * @brief Benchmarks of the post-process ops of net_flow.
+ *
+ * The NMS ops run on the layers of a 640x640 model with 80 classes. The argument of those benchmarks is the amount of
+ * candidates - the entries passing the score threshold (all the other entries are background), which determines the
+ * load of the NMS.
+ **/
+
+#include "benchmarks_common.hpp"
+
+#include "net_flow/ops/yolov5_post_process.hpp"
+#include "net_flow/ops/yolov8_post_process.hpp"
+#include "net_flow/ops/softmax_post_process.hpp"
+#include "net_flow/ops/argmax_post_process.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+namespace hailort
+{
+namespace benchmarks
+{
+
+using namespace net_flow;
+
+static const uint32_t NMS_IMAGE_SIZE = 640;
+static const uint32_t NMS_CLASSES_COUNT = 80;
+static const std::vector<uint32_t> NMS_STRIDES = {8, 16, 32};
+static const hailo_quant_info_t NMS_QUANT_INFO = make_quant_info(0.0f, 1.0f / 255.0f);
+static const std::string NMS_OUTPUT_NAME = "nms";
+
+static void nms_args(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->ArgName("candidates");
+    for (const auto candidates_count : {0, 10, 100, 1000}) {
+        benchmark->Arg(candidates_count);
+    }
+}
+
+static NmsPostProcessConfig nms_config()
+{
+    NmsPostProcessConfig config{};
+    config.nms_score_th = 0.3;
+    config.nms_iou_th = 0.6;
+    config.max_proposals_per_class = 100;
+    config.number_of_classes = NMS_CLASSES_COUNT;
+    return config;
+}
+
+static BufferMetaData nms_input_metadata(uint32_t stride, uint32_t features)
+{
+    const auto shape = make_shape(NMS_IMAGE_SIZE / stride, NMS_IMAGE_SIZE / stride, features);
+    return BufferMetaData{shape, shape, make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW), NMS_QUANT_INFO};
+}
+
+static std::unordered_map<std::string, BufferMetaData> nms_outputs_metadata()
+{
+    return {{NMS_OUTPUT_NAME, BufferMetaData{{}, {}, make_format(HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_HAILO_NMS),
+        make_quant_info(0.0f, 1.0f)}}};
+}
+
+/**
+ * Fills an NHCW layer holding entries of entry_size features (shape.features / entry_size entries per cell), with random
+ * values besides the scores (the features from scores_index on), which are zeroed. Then sets the scores of
+ * candidates_count random entries (the objectness if there is one, and the score of a random class) to the maximum.
+ */
+static std::vector<uint8_t> nms_layer(const hailo_3d_image_shape_t &shape, uint32_t entry_size, uint32_t scores_index,
+    bool has_objectness, size_t candidates_count, std::mt19937 &generator)
+{
+    auto layer = random_buffer(shape.height * shape.width * shape.features);
+    const uint32_t entries_per_cell = shape.features / entry_size;
+    const auto value_index = [&shape](uint32_t row, uint32_t col, uint32_t feature) {
+        return (row * shape.width * shape.features) + (feature * shape.width) + col;
+    };
+
+    for (uint32_t row = 0; row < shape.height; row++) {
+        for (uint32_t col = 0; col < shape.width; col++) {
+            for (uint32_t entry = 0; entry < entries_per_cell; entry++) {
+                for (uint32_t feature = scores_index; feature < entry_size; feature++) {
+                    layer[value_index(row, col, (entry * entry_size) + feature)] = 0;
+                }
+            }
+        }
+    }
+
+    std::vector<uint32_t> entries(shape.height * shape.width * entries_per_cell);
+    std::iota(entries.begin(), entries.end(), 0);
+    std::shuffle(entries.begin(), entries.end(), generator);
+    const uint32_t classes_index = has_objectness ? (scores_index + 1) : scores_index;
+    std::uniform_int_distribution<uint32_t> class_distribution(classes_index, entry_size - 1);
+    for (size_t i = 0; i < std::min(candidates_count, entries.size()); i++) {
+        const auto cell = entries[i] / entries_per_cell;
+        const auto entry_start = (entries[i] % entries_per_cell) * entry_size;
+        const auto row = cell / shape.width;
+        const auto col = cell % shape.width;
+        if (has_objectness) {
+            layer[value_index(row, col, entry_start + scores_index)] = UINT8_MAX;
+        }
+        layer[value_index(row, col, entry_start + class_distribution(generator))] = UINT8_MAX;
+    }
+
+    return layer;
+}
+
+static void run_op(benchmark::State &state, Op &op, const std::map<std::string, std::vector<uint8_t>> &inputs_buffers,
+    size_t output_size)
+{
+    std::map<std::string, MemoryView> inputs;
+    for (const auto &input : inputs_buffers) {
+        inputs.emplace(input.first, MemoryView(const_cast<uint8_t*>(input.second.data()), input.second.size()));
+    }
+    std::vector<uint8_t> output_buffer(output_size);
+    std::map<std::string, MemoryView> outputs = {
+        {op.outputs_metadata().begin()->first, MemoryView(output_buffer.data(), output_buffer.size())}
+    };
+
+    for (auto _ : state) {
+        auto status = op.execute(inputs, outputs);
+        BENCHMARK_CHECK_SUCCESS(state, status, "Failed executing the op");
+        benchmark::DoNotOptimize(output_buffer.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+static void yolov5(benchmark::State &state)
+{
+    // Each entry is x, y, w, h, the objectness and the classes' scores
+    static const uint32_t OBJECTNESS_INDEX = 4;
+    static const uint32_t ENTRY_SIZE = OBJECTNESS_INDEX + 1 + NMS_CLASSES_COUNT;
+    static const uint32_t ANCHORS_COUNT = 3;
+    static const std::vector<std::vector<int>> ANCHORS = {
+        {10, 13, 16, 30, 33, 23}, {30, 61, 62, 45, 59, 119}, {116, 90, 156, 198, 373, 326}
+    };
+
+    const auto candidates_count = static_cast<size_t>(state.range(0));
+    std::mt19937 generator(BENCHMARKS_SEED);
+    std::unordered_map<std::string, BufferMetaData> inputs_metadata;
+    std::map<std::string, std::vector<uint8_t>> inputs_buffers;
+    YoloPostProcessConfig yolo_config{};
+    yolo_config.image_height = NMS_IMAGE_SIZE;
+    yolo_config.image_width = NMS_IMAGE_SIZE;
+    for (size_t i = 0; i < NMS_STRIDES.size(); i++) {
+        const auto name = "yolov5_output_" + std::to_string(i);
+        const auto metadata = nms_input_metadata(NMS_STRIDES[i], ANCHORS_COUNT * ENTRY_SIZE);
+        inputs_metadata.emplace(name, metadata);
+        yolo_config.anchors.emplace(name, ANCHORS[i]);
+        inputs_buffers.emplace(name, nms_layer(metadata.shape, ENTRY_SIZE, OBJECTNESS_INDEX, true,
+            candidates_count / NMS_STRIDES.size(), generator));
+    }
+
+    auto metadata = Yolov5OpMetadata::create(inputs_metadata, nms_outputs_metadata(), nms_config(), yolo_config, "benchmark");
+    BENCHMARK_CHECK_SUCCESS(state, metadata.status(), "Failed creating the YOLOv5 metadata");
+    auto yolov5_metadata = std::static_pointer_cast<Yolov5OpMetadata>(metadata.release());
+    auto op = YOLOv5PostProcessOp::create(yolov5_metadata);
+    BENCHMARK_CHECK_SUCCESS(state, op.status(), "Failed creating the YOLOv5 op");
+
+    const auto output_size = HailoRTCommon::get_nms_host_frame_size(yolov5_metadata->nms_info(),
+        nms_outputs_metadata().begin()->second.format);
+    run_op(state, *op.value(), inputs_buffers, output_size);
+}
+
+static void yolov8(benchmark::State &state)
+{
+    static const uint32_t REGRESSION_FEATURES = 64;
+
+    const auto candidates_count = static_cast<size_t>(state.range(0));
+    std::mt19937 generator(BENCHMARKS_SEED);
+    std::unordered_map<std::string, BufferMetaData> inputs_metadata;
+    std::map<std::string, std::vector<uint8_t>> inputs_buffers;
+    Yolov8PostProcessConfig yolov8_config{};
+    yolov8_config.image_height = NMS_IMAGE_SIZE;
+    yolov8_config.image_width = NMS_IMAGE_SIZE;
+    for (size_t i = 0; i < NMS_STRIDES.size(); i++) {
+        const auto reg_name = "yolov8_reg_" + std::to_string(i);
+        const auto cls_name = "yolov8_cls_" + std::to_string(i);
+        const auto reg_metadata = nms_input_metadata(NMS_STRIDES[i], REGRESSION_FEATURES);
+        const auto cls_metadata = nms_input_metadata(NMS_STRIDES[i], NMS_CLASSES_COUNT);
+        inputs_metadata.emplace(reg_name, reg_metadata);
+        inputs_metadata.emplace(cls_name, cls_metadata);
+        yolov8_config.reg_to_cls_inputs.emplace_back(Yolov8MatchingLayersNames{reg_name, cls_name, NMS_STRIDES[i]});
+
+        const auto &reg_shape = reg_metadata.shape;
+        inputs_buffers.emplace(reg_name, random_buffer(reg_shape.height * reg_shape.width * reg_shape.features));
+        // The classification layer has no objectness - each class is a score
+        inputs_buffers.emplace(cls_name, nms_layer(cls_metadata.shape, NMS_CLASSES_COUNT, 0, false,
+            candidates_count / NMS_STRIDES.size(), generator));
+    }
+
+    auto metadata = Yolov8OpMetadata::create(inputs_metadata, nms_outputs_metadata(), nms_config(), yolov8_config, "benchmark");
+    BENCHMARK_CHECK_SUCCESS(state, metadata.status(), "Failed creating the YOLOv8 metadata");
+    auto yolov8_metadata = std::static_pointer_cast<Yolov8OpMetadata>(metadata.release());
+    auto op = YOLOV8PostProcessOp::create(yolov8_metadata);
+    BENCHMARK_CHECK_SUCCESS(state, op.status(), "Failed creating the YOLOv8 op");
+
+    const auto output_size = HailoRTCommon::get_nms_host_frame_size(yolov8_metadata->nms_info(),
+        nms_outputs_metadata().begin()->second.format);
+    run_op(state, *op.value(), inputs_buffers, output_size);
+}
+
+static void softmax(benchmark::State &state, hailo_format_order_t format_order)
+{
+    const auto shape = make_shape(state.range(0), state.range(1), state.range(2));
+    const auto format = make_format(HAILO_FORMAT_TYPE_FLOAT32, format_order);
+    const auto quant_info = make_quant_info(0.0f, 1.0f);
+
+    auto metadata = SoftmaxOpMetadata::create({{"softmax_input", BufferMetaData{shape, shape, format, quant_info}}},
+        {{"softmax_output", BufferMetaData{shape, shape, format, quant_info}}}, "benchmark");
+    BENCHMARK_CHECK_SUCCESS(state, metadata.status(), "Failed creating the softmax metadata");
+    auto op = SoftmaxPostProcessOp::create(std::static_pointer_cast<SoftmaxOpMetadata>(metadata.release()));
+    BENCHMARK_CHECK_SUCCESS(state, op.status(), "Failed creating the softmax op");
+
+    const size_t frame_size = shape.height * shape.width * shape.features * sizeof(float32_t);
+    // Logits of a classifier are small, positive and negative
+    const auto logits = random_float_buffer(frame_size / sizeof(float32_t), -8.0f, 8.0f);
+    std::vector<uint8_t> input(frame_size);
+    std::memcpy(input.data(), logits.data(), frame_size);
+    run_op(state, *op.value(), {{"softmax_input", input}}, frame_size);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.height * shape.width * shape.features));
+}
+
+static void argmax(benchmark::State &state, hailo_format_type_t output_type)
+{
+    const auto input_shape = make_shape(state.range(0), state.range(1), state.range(2));
+    const auto output_shape = make_shape(state.range(0), state.range(1), 1);
+    const auto quant_info = make_quant_info(0.0f, 1.0f);
+    const auto output_format = make_format(output_type, HAILO_FORMAT_ORDER_NHW);
+
+    auto metadata = ArgmaxOpMetadata::create({{"argmax_input", BufferMetaData{input_shape, input_shape,
+            make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW), quant_info}}},
+        {{"argmax_output", BufferMetaData{output_shape, output_shape, output_format, quant_info}}}, "benchmark");
+    BENCHMARK_CHECK_SUCCESS(state, metadata.status(), "Failed creating the argmax metadata");
+    auto op = ArgmaxPostProcessOp::create(std::static_pointer_cast<ArgmaxOpMetadata>(metadata.release()));
+    BENCHMARK_CHECK_SUCCESS(state, op.status(), "Failed creating the argmax op");
+
+    auto input = random_buffer(input_shape.height * input_shape.width * input_shape.features);
+    const size_t output_size = output_shape.height * output_shape.width * HailoRTCommon::get_format_data_bytes(output_format);
+    run_op(state, *op.value(), {{"argmax_input", input}}, output_size);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+}
+
+BENCHMARK(yolov5)->Apply(nms_args);
+BENCHMARK(yolov8)->Apply(nms_args);
+// A classifier's output (NC), and a per-pixel softmax (NHWC)
+BENCHMARK_CAPTURE(softmax, nc, HAILO_FORMAT_ORDER_NC)->ArgNames({"h", "w", "f"})->Args({1, 1, 1000})->Args({1, 1, 21843});
+BENCHMARK_CAPTURE(softmax, nhwc, HAILO_FORMAT_ORDER_NHWC)->ArgNames({"h", "w", "f"})->Args({128, 128, 21});
+// Segmentation outputs
+BENCHMARK_CAPTURE(argmax, uint8, HAILO_FORMAT_TYPE_UINT8)->ArgNames({"h", "w", "f"})->Args({256, 256, 21})->Args({512, 1024, 19});
+BENCHMARK_CAPTURE(argmax, float32, HAILO_FORMAT_TYPE_FLOAT32)->ArgNames({"h", "w", "f"})->Args({512, 1024, 19});
+
+} /* namespace benchmarks */
+} /* namespace hailort */
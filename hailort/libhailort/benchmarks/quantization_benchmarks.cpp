@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file quantization_benchmarks.cpp
+ * @brief Benchmarks of the (de)quantization paths of Quantization. The argument of each benchmark is the elements count.
+ **/
+
+#include "benchmarks_common.hpp"
+
+#include "hailo/quantization.hpp"
+
+#include <array>
+
+
+namespace hailort
+{
+namespace benchmarks
+{
+
+static const hailo_quant_info_t QUANT_INFO = make_quant_info(12.0f, 0.0235f);
+// The scale and zero point of a layer that isn't quantized (the values are only converted)
+static const hailo_quant_info_t IDENTITY_QUANT_INFO = make_quant_info(0.0f, 1.0f);
+
+static void quantization_args(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->ArgName("elements");
+    // An output layer, a 640x640x3 frame and a 1080p frame
+    benchmark->Arg(80 * 80 * 64);
+    benchmark->Arg(640 * 640 * 3);
+    benchmark->Arg(1920 * 1080 * 3);
+}
+
+template<typename Q>
+static void dequantize_output_buffer_impl(benchmark::State &state, hailo_quant_info_t quant_info)
+{
+    const auto elements_count = static_cast<uint32_t>(state.range(0));
+    auto src = random_buffer(elements_count * sizeof(Q));
+    std::vector<float32_t> dst(elements_count);
+
+    for (auto _ : state) {
+        Quantization::dequantize_output_buffer<float32_t, Q>(reinterpret_cast<Q*>(src.data()), dst.data(),
+            elements_count, quant_info);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements_count));
+}
+
+template<typename Q>
+static void dequantize_output_buffer_in_place_impl(benchmark::State &state, hailo_quant_info_t quant_info)
+{
+    const auto elements_count = static_cast<uint32_t>(state.range(0));
+    const auto src = random_buffer(elements_count * sizeof(Q));
+    std::vector<float32_t> buffer(elements_count);
+
+    for (auto _ : state) {
+        // The quantized values are copied to the start of the buffer on each iteration (not measured)
+        state.PauseTiming();
+        std::memcpy(buffer.data(), src.data(), src.size());
+        state.ResumeTiming();
+
+        Quantization::dequantize_output_buffer_in_place<float32_t, Q>(buffer.data(), elements_count, quant_info);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements_count));
+}
+
+static void dequantize_output_buffer_by_lut(benchmark::State &state)
+{
+    const auto elements_count = static_cast<uint32_t>(state.range(0));
+    auto src = random_buffer(elements_count);
+    std::vector<float32_t> dst(elements_count);
+    std::array<float32_t, Quantization::DEQUANTIZATION_LUT_SIZE> lut{};
+    Quantization::create_dequantization_lut(QUANT_INFO, lut.data());
+
+    for (auto _ : state) {
+        Quantization::dequantize_output_buffer_by_lut(src.data(), dst.data(), elements_count, lut.data());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements_count));
+}
+
+template<typename Q>
+static void quantize_input_buffer_impl(benchmark::State &state, hailo_quant_info_t quant_info)
+{
+    const auto elements_count = static_cast<uint32_t>(state.range(0));
+    auto src = random_float_buffer(elements_count, 0.0f, 1.0f);
+    std::vector<Q> dst(elements_count);
+
+    for (auto _ : state) {
+        Quantization::quantize_input_buffer<float32_t, Q>(src.data(), dst.data(), elements_count, quant_info);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements_count));
+}
+
+// BENCHMARK_CAPTURE can't take a template, so the quantized type is passed as an argument
+static void dequantize_output_buffer(benchmark::State &state, hailo_format_type_t type, hailo_quant_info_t quant_info)
+{
+    if (HAILO_FORMAT_TYPE_UINT8 == type) {
+        dequantize_output_buffer_impl<uint8_t>(state, quant_info);
+    } else {
+        dequantize_output_buffer_impl<uint16_t>(state, quant_info);
+    }
+}
+
+static void dequantize_output_buffer_in_place(benchmark::State &state, hailo_format_type_t type, hailo_quant_info_t quant_info)
+{
+    if (HAILO_FORMAT_TYPE_UINT8 == type) {
+        dequantize_output_buffer_in_place_impl<uint8_t>(state, quant_info);
+    } else {
+        dequantize_output_buffer_in_place_impl<uint16_t>(state, quant_info);
+    }
+}
+
+static void quantize_input_buffer(benchmark::State &state, hailo_format_type_t type, hailo_quant_info_t quant_info)
+{
+    if (HAILO_FORMAT_TYPE_UINT8 == type) {
+        quantize_input_buffer_impl<uint8_t>(state, quant_info);
+    } else {
+        quantize_input_buffer_impl<uint16_t>(state, quant_info);
+    }
+}
+
+BENCHMARK_CAPTURE(dequantize_output_buffer, uint8, HAILO_FORMAT_TYPE_UINT8, QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(dequantize_output_buffer, uint8_identity, HAILO_FORMAT_TYPE_UINT8, IDENTITY_QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(dequantize_output_buffer, uint16, HAILO_FORMAT_TYPE_UINT16, QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(dequantize_output_buffer_in_place, uint8, HAILO_FORMAT_TYPE_UINT8, QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(dequantize_output_buffer_in_place, uint16, HAILO_FORMAT_TYPE_UINT16, QUANT_INFO)->Apply(quantization_args);
+BENCHMARK(dequantize_output_buffer_by_lut)->Apply(quantization_args);
+BENCHMARK_CAPTURE(quantize_input_buffer, uint8, HAILO_FORMAT_TYPE_UINT8, QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(quantize_input_buffer, uint8_identity, HAILO_FORMAT_TYPE_UINT8, IDENTITY_QUANT_INFO)->Apply(quantization_args);
+BENCHMARK_CAPTURE(quantize_input_buffer, uint16, HAILO_FORMAT_TYPE_UINT16, QUANT_INFO)->Apply(quantization_args);
+
+} /* namespace benchmarks */
+} /* namespace hailort */
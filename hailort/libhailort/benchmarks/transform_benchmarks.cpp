@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_benchmarks.cpp
+ * @brief Benchmarks of the input and output transform contexts - each of the reorders, with and without (de)quantization.
+ *
+ * The arguments of each benchmark are the frame's height, width and features, and the max threads count of the context.
+ **/
+
+#include "benchmarks_common.hpp"
+
+#include "hailo/transform.hpp"
+
+
+namespace hailort
+{
+namespace benchmarks
+{
+
+static const hailo_quant_info_t TRANSFORM_QUANT_INFO = make_quant_info(0.0f, 1.0f / 255.0f);
+
+static void transform_args(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->ArgNames({"h", "w", "f", "threads"});
+    // A classification input, a detection input and a large (multi-tile) frame
+    benchmark->Args({224, 224, 3, 1});
+    benchmark->Args({640, 640, 3, 1});
+    benchmark->Args({1080, 1920, 8, 1});
+    benchmark->Args({1080, 1920, 8, 4});
+    // Typical output layers
+    benchmark->Args({80, 80, 64, 1});
+    benchmark->Args({20, 20, 256, 1});
+    benchmark->UseRealTime();
+}
+
+static void input_transform(benchmark::State &state, hailo_format_t src_format, hailo_format_t dst_format)
+{
+    const auto shape = make_shape(state.range(0), state.range(1), state.range(2));
+    const auto max_threads_count = static_cast<uint32_t>(state.range(3));
+
+    auto transform_context = InputTransformContext::create(shape, src_format, shape, dst_format, {TRANSFORM_QUANT_INFO},
+        max_threads_count);
+    BENCHMARK_CHECK_SUCCESS(state, transform_context.status(), "Failed creating the input transform context");
+
+    auto src = random_frame(transform_context.value()->get_src_frame_size(), src_format.type);
+    std::vector<uint8_t> dst(transform_context.value()->get_dst_frame_size());
+
+    for (auto _ : state) {
+        auto status = transform_context.value()->transform(MemoryView(src.data(), src.size()),
+            MemoryView(dst.data(), dst.size()));
+        BENCHMARK_CHECK_SUCCESS(state, status, "Failed transforming the frame");
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size()));
+}
+
+static void output_transform(benchmark::State &state, hailo_format_t src_format, hailo_format_t dst_format)
+{
+    const auto shape = make_shape(state.range(0), state.range(1), state.range(2));
+    const auto max_threads_count = static_cast<uint32_t>(state.range(3));
+
+    auto transform_context = OutputTransformContext::create(shape, src_format, shape, dst_format, {TRANSFORM_QUANT_INFO},
+        hailo_nms_info_t{}, max_threads_count);
+    BENCHMARK_CHECK_SUCCESS(state, transform_context.status(), "Failed creating the output transform context");
+
+    auto src = random_frame(transform_context.value()->get_src_frame_size(), src_format.type);
+    std::vector<uint8_t> dst(transform_context.value()->get_dst_frame_size());
+
+    for (auto _ : state) {
+        auto status = transform_context.value()->transform(MemoryView(src.data(), src.size()),
+            MemoryView(dst.data(), dst.size()));
+        BENCHMARK_CHECK_SUCCESS(state, status, "Failed transforming the frame");
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size()));
+}
+
+// Reorders only (the types of the src and the dst are the same)
+BENCHMARK_CAPTURE(input_transform, nhwc_to_nhcw_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nhwc_to_nhwc_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nhcw_to_nhcw_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nchw_to_nhcw_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NCHW), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nhwc_to_fcr_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_FCR))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nhwc_to_f8cr_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_F8CR))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(input_transform, nhwc_to_nhcw_uint16,
+    make_format(HAILO_FORMAT_TYPE_UINT16, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT16, HAILO_FORMAT_ORDER_NHCW))
+    ->Apply(transform_args);
+// Quantization and reorder
+BENCHMARK_CAPTURE(input_transform, nhwc_float32_to_nhcw_uint8,
+    make_format(HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW))
+    ->Apply(transform_args);
+
+// Reorders only
+BENCHMARK_CAPTURE(output_transform, nhcw_to_nhwc_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(output_transform, nhwc_to_nhwc_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(output_transform, f8cr_to_nhwc_uint8,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_F8CR), make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(output_transform, nhcw_to_nhwc_uint16,
+    make_format(HAILO_FORMAT_TYPE_UINT16, HAILO_FORMAT_ORDER_NHCW), make_format(HAILO_FORMAT_TYPE_UINT16, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+// Reorder and de-quantization
+BENCHMARK_CAPTURE(output_transform, nhcw_uint8_to_nhwc_float32,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW), make_format(HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(output_transform, nhcw_uint16_to_nhwc_float32,
+    make_format(HAILO_FORMAT_TYPE_UINT16, HAILO_FORMAT_ORDER_NHCW), make_format(HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+BENCHMARK_CAPTURE(output_transform, f8cr_uint8_to_nhwc_float32,
+    make_format(HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_F8CR), make_format(HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC))
+    ->Apply(transform_args);
+
+} /* namespace benchmarks */
+} /* namespace hailort */
@@ -37,6 +37,8 @@ GType gst_scheduling_algorithm_get_type (void)
         static GEnumValue algorithm_types[] = {
             { HAILO_SCHEDULING_ALGORITHM_NONE,         "Scheduler is not active", "HAILO_SCHEDULING_ALGORITHM_NONE" },
             { HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,  "Round robin",             "HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN" },
+            { HAILO_SCHEDULING_ALGORITHM_DEADLINE,     "Earliest deadline first", "HAILO_SCHEDULING_ALGORITHM_DEADLINE" },
+            { HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE,   "Weighted fair share",     "HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE" },
             { HAILO_SCHEDULING_ALGORITHM_MAX_ENUM,     NULL,                      NULL },
         };
 
@@ -59,6 +61,7 @@ GType gst_hailo_format_type_get_type (void)
             { HAILO_FORMAT_TYPE_UINT8,    "uint8",    "HAILO_FORMAT_TYPE_UINT8"},
             { HAILO_FORMAT_TYPE_UINT16,   "uint16",   "HAILO_FORMAT_TYPE_UINT16"},
             { HAILO_FORMAT_TYPE_FLOAT32,  "float32",  "HAILO_FORMAT_TYPE_FLOAT32"},
+            { HAILO_FORMAT_TYPE_FLOAT16,  "float16",  "HAILO_FORMAT_TYPE_FLOAT16"},
             { HAILO_FORMAT_TYPE_MAX_ENUM,  NULL,      NULL },
         };
 
@@ -68,6 +71,24 @@ GType gst_hailo_format_type_get_type (void)
     return format_type_enum;
 }
 
+GType gst_hailo_leaky_get_type (void)
+{
+    static GType leaky_type = 0;
+
+    if (!leaky_type) {
+        static GEnumValue leaky_types[] = {
+            { GST_HAILO_LEAKY_NONE,        "Not leaky (back-pressure upstream)",                    "no" },
+            { GST_HAILO_LEAKY_UPSTREAM,    "Leaky on upstream (drop the new buffers)",              "upstream" },
+            { GST_HAILO_LEAKY_DOWNSTREAM,  "Leaky on downstream (drop the oldest output buffers)",  "downstream" },
+            { 0,                           NULL,                                                    NULL },
+        };
+
+        leaky_type = g_enum_register_static ("GstHailoLeaky", leaky_types);
+    }
+
+    return leaky_type;
+}
+
 bool do_versions_match(GstElement *self)
 {
     hailo_version_t libhailort_version = {};
@@ -87,4 +108,64 @@ bool do_versions_match(GstElement *self)
         return false;
     }
     return true;
-}
\ No newline at end of file
+}
+
+const gchar *gst_hailo_get_format_string(const InferModel::InferStream &input)
+{
+    switch (input.format().order) {
+    case HAILO_FORMAT_ORDER_RGB4:
+    case HAILO_FORMAT_ORDER_NHWC:
+        if (input.shape().features == RGBA_FEATURES_SIZE) {
+            return "RGBA";
+        }
+        if (input.shape().features == GRAY8_FEATURES_SIZE) {
+            return "GRAY8";
+        }
+        /* Fallthrough */
+    case HAILO_FORMAT_ORDER_NHCW:
+    case HAILO_FORMAT_ORDER_FCR:
+    case HAILO_FORMAT_ORDER_F8CR:
+        if (input.shape().features == GRAY8_FEATURES_SIZE) {
+            return "GRAY8";
+        }
+        CHECK(RGB_FEATURES_SIZE == input.shape().features, nullptr,
+            "Features of input %s is not %d for RGB format! (features=%d)", input.name().c_str(), RGB_FEATURES_SIZE,
+            input.shape().features);
+        return "RGB";
+    case HAILO_FORMAT_ORDER_YUY2:
+        CHECK(YUY2_FEATURES_SIZE == input.shape().features, nullptr,
+            "Features of input %s is not %d for YUY2 format! (features=%d)", input.name().c_str(), YUY2_FEATURES_SIZE,
+            input.shape().features);
+        return "YUY2";
+    case HAILO_FORMAT_ORDER_NV12:
+        CHECK(NV12_FEATURES_SIZE == input.shape().features, nullptr,
+            "Features of input %s is not %d for NV12 format! (features=%d)", input.name().c_str(), NV12_FEATURES_SIZE,
+            input.shape().features);
+        return "NV12";
+    case HAILO_FORMAT_ORDER_NV21:
+        CHECK(NV21_FEATURES_SIZE == input.shape().features, nullptr,
+            "Features of input %s is not %d for NV21 format! (features=%d)", input.name().c_str(), NV21_FEATURES_SIZE,
+            input.shape().features);
+        return "NV21";
+    case HAILO_FORMAT_ORDER_I420:
+        CHECK(I420_FEATURES_SIZE == input.shape().features, nullptr,
+            "Features of input %s is not %d for I420 format! (features=%d)", input.name().c_str(), I420_FEATURES_SIZE,
+            input.shape().features);
+        return "I420";
+    default:
+        ERROR("Input %s has an unsupported format order! order = %d\n", input.name().c_str(), input.format().order);
+        return nullptr;
+    }
+}
+
+uint32_t gst_hailo_get_height_by_order(uint32_t original_height, hailo_format_order_t order)
+{
+    switch (order) {
+    case HAILO_FORMAT_ORDER_NV12:
+    case HAILO_FORMAT_ORDER_NV21:
+        return original_height * 2;
+    default:
+        break;
+    }
+    return original_height;
+}
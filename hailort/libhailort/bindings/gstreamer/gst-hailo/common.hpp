@@ -22,6 +22,7 @@
 
 #include "hailo/device.hpp"
 #include "hailo/network_group.hpp"
+#include "hailo/infer_model.hpp"
 #include "hailo/vstream.hpp"
 
 #pragma GCC diagnostic push
@@ -278,6 +279,21 @@ GType gst_scheduling_algorithm_get_type (void);
 #define GST_TYPE_HAILO_FORMAT_TYPE (gst_hailo_format_type_get_type ())
 GType gst_hailo_format_type_get_type (void);
 
+// Which buffers an element drops when it can't keep up, instead of back-pressuring upstream (same as the values of queue's leaky)
+typedef enum {
+    GST_HAILO_LEAKY_NONE,
+    GST_HAILO_LEAKY_UPSTREAM,
+    GST_HAILO_LEAKY_DOWNSTREAM,
+} GstHailoLeaky;
+
+#define GST_TYPE_HAILO_LEAKY (gst_hailo_leaky_get_type ())
+GType gst_hailo_leaky_get_type (void);
+
 bool do_versions_match(GstElement *self);
 
+// Returns the name of the GStreamer video format of the given input, or nullptr if the input's format isn't supported
+const gchar *gst_hailo_get_format_string(const InferModel::InferStream &input);
+// Returns the height of the GStreamer frame of an input, by the height of its shape and its format order
+uint32_t gst_hailo_get_height_by_order(uint32_t original_height, hailo_format_order_t order);
+
 #endif /* _GST_HAILO_COMMON_HPP_ */
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#include "gsthailo_buffer_pool.hpp"
+
+#include <gst/allocators/gstdmabuf.h>
+
+
+G_DEFINE_TYPE (GstHailoBufferPool, gst_hailo_buffer_pool, GST_TYPE_BUFFER_POOL);
+
+
+static GstFlowReturn gst_hailo_buffer_pool_alloc_buffer(GstBufferPool *pool, GstBuffer **buffer, GstBufferPoolAcquireParams *params)
+{
+    GstHailoBufferPool *hailo_pool = GST_HAILO_BUFFER_POOL(pool);
+    GstFlowReturn ret = GST_BUFFER_POOL_CLASS(gst_hailo_buffer_pool_parent_class)->alloc_buffer(pool, buffer, params);
+    if (GST_FLOW_OK != ret) {
+        return ret;
+    }
+
+    GstMemory *memory = gst_buffer_peek_memory(*buffer, 0);
+    GstHailoBufferPoolMapping mapping = {nullptr, -1, gst_buffer_get_size(*buffer)};
+
+    std::unique_lock<std::mutex> lock(hailo_pool->mutex);
+    if (nullptr == hailo_pool->vdevice) {
+        return GST_FLOW_OK;
+    }
+
+    auto status = HAILO_SUCCESS;
+    if (gst_is_dmabuf_memory(memory)) {
+        mapping.fd = gst_dmabuf_memory_get_fd(memory);
+        status = hailo_pool->vdevice->dma_map_dmabuf(mapping.fd, mapping.size, hailo_pool->direction);
+    } else {
+        GstMapInfo info;
+        if (!gst_memory_map(memory, &info, GST_MAP_READ)) {
+            ERROR("Failed mapping a buffer of the pool\n");
+            gst_buffer_unref(*buffer);
+            return GST_FLOW_ERROR;
+        }
+        // The memories of GstHailoAllocator wrap their data, so the address stays valid after unmapping
+        mapping.address = info.data;
+        gst_memory_unmap(memory, &info);
+        status = hailo_pool->vdevice->dma_map(mapping.address, mapping.size, hailo_pool->direction);
+    }
+    if (HAILO_SUCCESS != status) {
+        ERROR("DMA mapping a buffer of the pool has failed, status = %d\n", status);
+        gst_buffer_unref(*buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    hailo_pool->mappings[*buffer] = mapping;
+    return GST_FLOW_OK;
+}
+
+static void gst_hailo_buffer_pool_free_buffer(GstBufferPool *pool, GstBuffer *buffer)
+{
+    GstHailoBufferPool *hailo_pool = GST_HAILO_BUFFER_POOL(pool);
+    {
+        std::unique_lock<std::mutex> lock(hailo_pool->mutex);
+        auto mapping_iter = hailo_pool->mappings.find(buffer);
+        if (hailo_pool->mappings.end() != mapping_iter) {
+            const auto &mapping = mapping_iter->second;
+            if (nullptr != hailo_pool->vdevice) {
+                auto status = (-1 != mapping.fd) ?
+                    hailo_pool->vdevice->dma_unmap_dmabuf(mapping.fd, mapping.size, hailo_pool->direction) :
+                    hailo_pool->vdevice->dma_unmap(mapping.address, mapping.size, hailo_pool->direction);
+                if (HAILO_SUCCESS != status) {
+                    ERROR("DMA unmapping a buffer of the pool has failed, status = %d\n", status);
+                }
+            }
+            hailo_pool->mappings.erase(mapping_iter);
+        }
+    }
+
+    GST_BUFFER_POOL_CLASS(gst_hailo_buffer_pool_parent_class)->free_buffer(pool, buffer);
+}
+
+static void gst_hailo_buffer_pool_class_init(GstHailoBufferPoolClass *klass)
+{
+    GstBufferPoolClass *buffer_pool_class = GST_BUFFER_POOL_CLASS(klass);
+
+    buffer_pool_class->alloc_buffer = gst_hailo_buffer_pool_alloc_buffer;
+    buffer_pool_class->free_buffer = gst_hailo_buffer_pool_free_buffer;
+}
+
+static void gst_hailo_buffer_pool_init(GstHailoBufferPool *pool)
+{
+    pool->vdevice = nullptr;
+    pool->direction = HAILO_DMA_BUFFER_DIRECTION_D2H;
+    pool->mappings = std::unordered_map<GstBuffer*, GstHailoBufferPoolMapping>();
+}
+
+GstBufferPool *gst_hailo_buffer_pool_new(VDevice &vdevice, hailo_dma_buffer_direction_t direction)
+{
+    GstHailoBufferPool *pool = GST_HAILO_BUFFER_POOL(g_object_new(GST_TYPE_HAILO_BUFFER_POOL, nullptr));
+    gst_object_ref_sink(pool);
+    pool->vdevice = &vdevice;
+    pool->direction = direction;
+    return GST_BUFFER_POOL(pool);
+}
+
+void gst_hailo_buffer_pool_release_vdevice(GstHailoBufferPool *pool)
+{
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    pool->vdevice = nullptr;
+}
+
+GstHailoTensorMeta *gst_hailo_buffer_pool_get_tensor_meta(GstBuffer *buffer)
+{
+    GstHailoTensorMeta *tensor_meta = GST_TENSOR_META_GET(buffer);
+    if (nullptr == tensor_meta) {
+        tensor_meta = GST_TENSOR_META_ADD(buffer);
+        GST_META_FLAG_SET(&tensor_meta->meta, GST_META_FLAG_POOLED);
+    }
+    return tensor_meta;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _GST_HAILO_BUFFER_POOL_HPP_
+#define _GST_HAILO_BUFFER_POOL_HPP_
+
+#include "common.hpp"
+#include "metadata/tensor_meta.hpp"
+#include "hailo/vdevice.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace hailort;
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_HAILO_BUFFER_POOL (gst_hailo_buffer_pool_get_type())
+#define GST_HAILO_BUFFER_POOL(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), GST_TYPE_HAILO_BUFFER_POOL, GstHailoBufferPool))
+#define GST_HAILO_BUFFER_POOL_CLASS(klass) (G_TYPE_CHECK_CLASS_CAST ((klass), GST_TYPE_HAILO_BUFFER_POOL, GstHailoBufferPoolClass))
+#define GST_IS_HAILO_BUFFER_POOL(obj) (G_TYPE_CHECK_INSTANCE_TYPE ((obj), GST_TYPE_HAILO_BUFFER_POOL))
+#define GST_IS_HAILO_BUFFER_POOL_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE ((klass), GST_TYPE_HAILO_BUFFER_POOL))
+
+struct GstHailoBufferPoolMapping
+{
+    void *address;
+    int fd;
+    size_t size;
+};
+
+/**
+ * A buffer pool whose buffers are DMA mapped to a vdevice once, when they are allocated (the minimum amount of buffers
+ * on the pool's activation), and stay mapped while they are reused - so the transfers to the buffers don't map them.
+ * Supports the memories of GstHailoAllocator (mapped by address) and of GstHailoDmabufAllocator (mapped by fd).
+ */
+struct GstHailoBufferPool
+{
+    GstBufferPool parent;
+
+    std::mutex mutex;
+    // Null once released by gst_hailo_buffer_pool_release_vdevice (the mappings are then released with the vdevice)
+    VDevice *vdevice;
+    hailo_dma_buffer_direction_t direction;
+    std::unordered_map<GstBuffer*, GstHailoBufferPoolMapping> mappings;
+};
+
+struct GstHailoBufferPoolClass
+{
+    GstBufferPoolClass parent;
+};
+
+GType gst_hailo_buffer_pool_get_type(void);
+
+GstBufferPool *gst_hailo_buffer_pool_new(VDevice &vdevice, hailo_dma_buffer_direction_t direction);
+
+/**
+ * Detaches the pool from its vdevice, which is about to be released. Buffers freed afterwards aren't unmapped again.
+ */
+void gst_hailo_buffer_pool_release_vdevice(GstHailoBufferPool *pool);
+
+/**
+ * Returns the tensor meta of a buffer of the pool. The meta is added on the first use of the buffer as pooled,
+ * so it is kept (and not re-allocated) while the buffer is reused.
+ */
+GstHailoTensorMeta *gst_hailo_buffer_pool_get_tensor_meta(GstBuffer *buffer);
+
+G_END_DECLS
+
+#endif /* _GST_HAILO_BUFFER_POOL_HPP_ */
@@ -0,0 +1,643 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#include "gsthailomuxnet.hpp"
+#include "metadata/tensor_meta.hpp"
+#include "hailo/hailort_common.hpp"
+#include "hailo/hailort_defaults.hpp"
+
+#define MUXNET_WAIT_FOR_ASYNC_READY_TIMEOUT (std::chrono::milliseconds(10000))
+
+enum
+{
+    PROP_0,
+    PROP_HEF_PATH,
+    PROP_BATCH_SIZE,
+    PROP_DEVICE_COUNT,
+    PROP_VDEVICE_GROUP_ID,
+    PROP_SCHEDULING_ALGORITHM,
+    PROP_MULTI_PROCESS_SERVICE,
+};
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE("sink_%u", GST_PAD_SINK, GST_PAD_REQUEST, GST_STATIC_CAPS_ANY);
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE("src_%u", GST_PAD_SRC, GST_PAD_SOMETIMES, GST_STATIC_CAPS_ANY);
+
+G_DEFINE_TYPE (GstHailoMuxNet, gst_hailomuxnet, GST_TYPE_ELEMENT);
+
+static hailo_status gst_hailomuxnet_init_infer_model(GstHailoMuxNet *self)
+{
+    auto vdevice_params = HailoRTDefaults::get_vdevice_params();
+    if (self->props.m_device_count.was_changed()) {
+        vdevice_params.device_count = self->props.m_device_count.get();
+    }
+    if (self->props.m_vdevice_group_id.was_changed()) {
+        vdevice_params.group_id = self->props.m_vdevice_group_id.get().c_str();
+    }
+    if (self->props.m_scheduling_algorithm.was_changed()) {
+        vdevice_params.scheduling_algorithm = self->props.m_scheduling_algorithm.get();
+    }
+    if (self->props.m_multi_process_service.was_changed()) {
+        vdevice_params.multi_process_service = self->props.m_multi_process_service.get();
+        CHECK(self->props.m_scheduling_algorithm.get() != HAILO_SCHEDULING_ALGORITHM_NONE, HAILO_INVALID_OPERATION,
+            "To use multi-process-service please set scheduling-algorithm to a value other than 'none'");
+    }
+
+    TRY(self->vdevice, VDevice::create(vdevice_params));
+    TRY(self->infer_model, self->vdevice->create_infer_model(self->props.m_hef_path.get()));
+    CHECK(self->infer_model->inputs().size() == 1, HAILO_INVALID_OPERATION,
+        "hailomuxnet supports models with a single input (the model has %zu inputs)", self->infer_model->inputs().size());
+
+    return HAILO_SUCCESS;
+}
+
+static Expected<GstBufferPool*> gst_hailomuxnet_create_buffer_pool(GstHailoMuxNet *self, size_t frame_size)
+{
+    // The output buffers are DMA mapped once, when the pool allocates them
+    GstBufferPool *pool = gst_hailo_buffer_pool_new(*self->vdevice, HAILO_DMA_BUFFER_DIRECTION_D2H);
+
+    GstStructure *config = gst_buffer_pool_get_config(pool);
+    gst_buffer_pool_config_set_params(config, nullptr, static_cast<guint>(frame_size), MUXNET_MIN_OUTPUTS_POOL_SIZE,
+        MUXNET_MAX_OUTPUTS_POOL_SIZE);
+    gst_buffer_pool_config_set_allocator(config, GST_ALLOCATOR(self->allocator), nullptr);
+
+    gboolean result = gst_buffer_pool_set_config(pool, config);
+    CHECK_AS_EXPECTED(result, HAILO_INTERNAL_FAILURE, "Could not set config buffer pool");
+
+    result = gst_buffer_pool_set_active(pool, TRUE);
+    CHECK_AS_EXPECTED(result, HAILO_INTERNAL_FAILURE, "Could not set buffer pool as active");
+
+    return pool;
+}
+
+static void gst_hailomuxnet_start_push_thread(GstHailoMuxNet *self)
+{
+    self->is_push_thread_running = true;
+    self->push_thread = std::thread([self] () {
+        while (true) {
+            HailoMuxNetFrame frame = {};
+            {
+                std::unique_lock<std::mutex> lock(self->push_queue_mutex);
+                self->push_queue_cv.wait(lock, [self] () {
+                    return !self->push_queue.empty() || !self->is_push_thread_running;
+                });
+                if (!self->is_push_thread_running) {
+                    break;
+                }
+                frame = self->push_queue.front();
+                self->push_queue.pop();
+            }
+
+            GstFlowReturn ret = gst_pad_push(frame.stream->srcpad, frame.buffer);
+            if ((GST_FLOW_OK != ret) && (GST_FLOW_FLUSHING != ret) && (GST_FLOW_EOS != ret) && (GST_FLOW_NOT_LINKED != ret)) {
+                ERROR("gst_pad_push failed on stream %u with status = %d\n", frame.stream->index, ret);
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(self->push_queue_mutex);
+                frame.stream->ongoing_frames--;
+            }
+            self->push_queue_cv.notify_all();
+        }
+    });
+}
+
+static hailo_status gst_hailomuxnet_configure(GstHailoMuxNet *self)
+{
+    if (self->is_configured) {
+        return HAILO_SUCCESS;
+    }
+
+    if (nullptr == self->infer_model) {
+        auto status = gst_hailomuxnet_init_infer_model(self);
+        CHECK_SUCCESS(status);
+    }
+
+    self->infer_model->set_batch_size(self->props.m_batch_size.get());
+    // In RGB formats, Gstreamer is padding each row to 4.
+    if (self->infer_model->input()->format().order == HAILO_FORMAT_ORDER_NHWC) {
+        self->infer_model->input()->set_format_order(HAILO_FORMAT_ORDER_RGB4);
+    }
+
+    TRY(auto configured_infer_model, self->infer_model->configure());
+    auto ptr = make_shared_nothrow<ConfiguredInferModel>(std::move(configured_infer_model));
+    CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
+    self->configured_infer_model = ptr;
+
+    if (HAILO_SCHEDULING_ALGORITHM_NONE == self->props.m_scheduling_algorithm.get()) {
+        auto status = self->configured_infer_model->activate();
+        CHECK_SUCCESS(status);
+    }
+
+    TRY(self->infer_bindings, self->configured_infer_model->create_bindings());
+
+    gchar *parent_name = gst_object_get_name(GST_OBJECT(self));
+    gchar *name = g_strconcat(parent_name, ":hailo_allocator", NULL);
+    g_free(parent_name);
+    self->allocator = GST_HAILO_ALLOCATOR(g_object_new(GST_TYPE_HAILO_ALLOCATOR, "name", name, NULL));
+    gst_object_ref_sink(self->allocator);
+    g_free(name);
+
+    for (auto &output : self->infer_model->outputs()) {
+        TRY(self->output_buffer_pools[output.name()], gst_hailomuxnet_create_buffer_pool(self, output.get_frame_size()));
+    }
+
+    TRY(const auto vstream_infos, self->infer_model->hef().get_output_vstream_infos());
+    for (const auto &vstream_info : vstream_infos) {
+        self->output_vstream_infos[vstream_info.name] = vstream_info;
+    }
+
+    gst_hailomuxnet_start_push_thread(self);
+
+    self->is_configured = true;
+    return HAILO_SUCCESS;
+}
+
+static hailo_status gst_hailomuxnet_free(GstHailoMuxNet *self)
+{
+    for (auto &name_pool_pair : self->output_buffer_pools) {
+        gst_buffer_pool_set_flushing(name_pool_pair.second, TRUE);
+    }
+
+    std::unique_lock<std::mutex> lock(self->infer_mutex);
+    self->configured_infer_model.reset();
+    self->infer_model.reset();
+    // The buffers of the pools (also the ones still held downstream) are unmapped with the vdevice
+    for (auto &name_pool_pair : self->output_buffer_pools) {
+        gst_hailo_buffer_pool_release_vdevice(GST_HAILO_BUFFER_POOL(name_pool_pair.second));
+    }
+    self->vdevice.reset();
+
+    {
+        std::unique_lock<std::mutex> push_queue_lock(self->push_queue_mutex);
+        self->is_push_thread_running = false;
+    }
+    self->push_queue_cv.notify_all();
+    if (self->push_thread.joinable()) {
+        self->push_thread.join();
+    }
+
+    while (!self->push_queue.empty()) {
+        gst_buffer_unref(self->push_queue.front().buffer);
+        self->push_queue.pop();
+    }
+
+    if (nullptr != self->input_caps) {
+        gst_caps_unref(self->input_caps);
+        self->input_caps = nullptr;
+    }
+
+    for (auto &name_pool_pair : self->output_buffer_pools) {
+        gboolean result = gst_buffer_pool_set_active(name_pool_pair.second, FALSE);
+        CHECK(result, HAILO_INTERNAL_FAILURE, "Could not release buffer pool");
+        gst_object_unref(name_pool_pair.second);
+    }
+    self->output_buffer_pools.clear();
+
+    if (nullptr != self->allocator) {
+        gst_object_unref(self->allocator);
+        self->allocator = nullptr;
+    }
+
+    self->is_configured = false;
+    return HAILO_SUCCESS;
+}
+
+static Expected<std::unordered_map<std::string, HailoMuxNetTensor>> gst_hailomuxnet_fill_output_bindings(GstHailoMuxNet *self)
+{
+    std::unordered_map<std::string, HailoMuxNetTensor> tensors;
+    for (auto &output : self->infer_model->outputs()) {
+        GstBuffer *output_buffer = nullptr;
+        GstFlowReturn flow_result = gst_buffer_pool_acquire_buffer(self->output_buffer_pools[output.name()], &output_buffer, nullptr);
+        if (GST_FLOW_FLUSHING == flow_result) {
+            return make_unexpected(HAILO_STREAM_ABORT);
+        }
+        CHECK_AS_EXPECTED(GST_FLOW_OK == flow_result, HAILO_INTERNAL_FAILURE, "Acquire buffer failed! flow status = %d", flow_result);
+
+        GstMapInfo buffer_info;
+        gboolean result = gst_buffer_map(output_buffer, &buffer_info, GST_MAP_WRITE);
+        CHECK_AS_EXPECTED(result, HAILO_INTERNAL_FAILURE, "Failed mapping buffer!");
+
+        auto status = self->infer_bindings.output(output.name())->set_buffer(MemoryView(buffer_info.data, buffer_info.size));
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        tensors[output.name()] = {output_buffer, buffer_info};
+    }
+    return tensors;
+}
+
+static Expected<hailo_pix_buffer_t> gst_hailomuxnet_construct_pix_buffer(GstHailoMuxNet *self, GstBuffer *buffer)
+{
+    GstVideoFrame frame;
+    auto result = gst_video_frame_map(&frame, &self->input_frame_info, buffer,
+        static_cast<GstMapFlags>(GST_MAP_READ | GST_VIDEO_FRAME_MAP_FLAG_NO_REF));
+    CHECK_AS_EXPECTED(result, HAILO_INTERNAL_FAILURE, "gst_video_frame_map failed!");
+
+    hailo_pix_buffer_t pix_buffer = {};
+    pix_buffer.index = 0;
+    pix_buffer.number_of_planes = GST_VIDEO_INFO_N_PLANES(&frame.info);
+    pix_buffer.memory_type = HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR;
+
+    for (uint32_t plane_index = 0; plane_index < pix_buffer.number_of_planes; plane_index++) {
+        pix_buffer.planes[plane_index].bytes_used = GST_VIDEO_INFO_PLANE_STRIDE(&frame.info, plane_index) * GST_VIDEO_INFO_COMP_HEIGHT(&frame.info, plane_index);
+        pix_buffer.planes[plane_index].plane_size = GST_VIDEO_INFO_PLANE_STRIDE(&frame.info, plane_index) * GST_VIDEO_INFO_COMP_HEIGHT(&frame.info, plane_index);
+        pix_buffer.planes[plane_index].user_ptr = GST_VIDEO_FRAME_PLANE_DATA(&frame, plane_index);
+    }
+
+    gst_video_frame_unmap(&frame);
+    return pix_buffer;
+}
+
+static hailo_status gst_hailomuxnet_async_infer(GstHailoMuxNet *self, HailoMuxNetStream *stream, GstBuffer *buffer)
+{
+    TRY(const auto pix_buffer, gst_hailomuxnet_construct_pix_buffer(self, buffer));
+    auto status = self->infer_bindings.input()->set_pix_buffer(pix_buffer);
+    CHECK_SUCCESS(status);
+
+    auto tensors = gst_hailomuxnet_fill_output_bindings(self);
+    if (HAILO_STREAM_ABORT == tensors.status()) {
+        gst_buffer_unref(buffer);
+        return HAILO_SUCCESS;
+    }
+    CHECK_EXPECTED_AS_STATUS(tensors);
+
+    status = self->configured_infer_model->wait_for_async_ready(MUXNET_WAIT_FOR_ASYNC_READY_TIMEOUT);
+    CHECK_SUCCESS(status);
+
+    {
+        std::unique_lock<std::mutex> lock(self->push_queue_mutex);
+        stream->ongoing_frames++;
+    }
+
+    TRY(auto job, self->configured_infer_model->run_async(self->infer_bindings,
+        [self, stream, buffer, tensors = tensors.release()] (const AsyncInferCompletionInfo &/*completion_info*/) {
+            for (auto &output : self->infer_model->outputs()) {
+                auto info = tensors.at(output.name());
+                gst_buffer_unmap(info.buffer, &info.buffer_info);
+
+                GstHailoTensorMeta *buffer_meta = gst_hailo_buffer_pool_get_tensor_meta(info.buffer);
+                buffer_meta->info = self->output_vstream_infos[output.name()];
+
+                (void)gst_buffer_add_parent_buffer_meta(buffer, info.buffer);
+                gst_buffer_unref(info.buffer);
+            }
+
+            // The frame is routed back to the src pad of the stream it came from
+            {
+                std::unique_lock<std::mutex> lock(self->push_queue_mutex);
+                self->push_queue.push({stream, buffer});
+            }
+            self->push_queue_cv.notify_all();
+        }));
+    job.detach();
+
+    return HAILO_SUCCESS;
+}
+
+static GstFlowReturn gst_hailomuxnet_chain(GstPad *pad, GstObject *parent, GstBuffer *buffer)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(parent);
+    auto stream = static_cast<HailoMuxNetStream*>(gst_pad_get_element_private(pad));
+    std::unique_lock<std::mutex> lock(self->infer_mutex);
+
+    if (self->did_critical_failure_happen) {
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    auto status = gst_hailomuxnet_configure(self);
+    if (HAILO_SUCCESS != status) {
+        self->did_critical_failure_happen = true;
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    // The output tensors are attached to the buffer as metas, so it must be writable (in most cases this is a shallow copy)
+    buffer = gst_buffer_make_writable(buffer);
+    if (nullptr == buffer) {
+        ERROR("Failed to make buffer writable!\n");
+        return GST_FLOW_ERROR;
+    }
+
+    status = gst_hailomuxnet_async_infer(self, stream, buffer);
+    if (HAILO_SUCCESS != status) {
+        return GST_FLOW_ERROR;
+    }
+
+    return GST_FLOW_OK;
+}
+
+static GstCaps *gst_hailomuxnet_get_caps(GstHailoMuxNet *self)
+{
+    std::unique_lock<std::mutex> lock(self->infer_mutex);
+    if (self->did_critical_failure_happen) {
+        return nullptr;
+    }
+
+    if (nullptr != self->input_caps) {
+        return gst_caps_copy(self->input_caps);
+    }
+
+    if (nullptr == self->infer_model) {
+        auto status = gst_hailomuxnet_init_infer_model(self);
+        if (HAILO_SUCCESS != status) {
+            self->did_critical_failure_happen = true;
+            return nullptr;
+        }
+    }
+
+    auto input = self->infer_model->input();
+    if (!input) {
+        ERROR("Getting input has failed with status = %d\n", input.status());
+        return nullptr;
+    }
+
+    const gchar *format = gst_hailo_get_format_string(input.value());
+    if (nullptr == format) {
+        return nullptr;
+    }
+
+    // All the streams share the model, so they all share its input caps
+    GstCaps *new_caps = gst_caps_new_simple("video/x-raw",
+        "format", G_TYPE_STRING, format,
+        "width", G_TYPE_INT, input->shape().width,
+        "height", G_TYPE_INT, gst_hailo_get_height_by_order(input->shape().height, input->format().order),
+        nullptr);
+
+    if (!gst_video_info_from_caps(&self->input_frame_info, new_caps)) {
+        ERROR("gst_video_info_from_caps failed\n");
+        gst_caps_unref(new_caps);
+        return nullptr;
+    }
+
+    self->input_caps = new_caps;
+    return gst_caps_copy(new_caps);
+}
+
+static gboolean gst_hailomuxnet_handle_sink_query(GstPad *pad, GstObject *parent, GstQuery *query)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(parent);
+    switch (GST_QUERY_TYPE(query)) {
+    case GST_QUERY_CAPS:
+    {
+        GstCaps *caps = gst_hailomuxnet_get_caps(self);
+        if (nullptr == caps) {
+            return FALSE;
+        }
+        gst_query_set_caps_result(query, caps);
+        gst_caps_unref(caps);
+        return TRUE;
+    }
+    case GST_QUERY_ALLOCATION:
+    {
+        // We implement this to make sure buffers are contiguous in memory
+        gst_query_add_allocation_meta(query, GST_VIDEO_META_API_TYPE, NULL);
+        return gst_pad_query_default(pad, parent, query);
+    }
+    default:
+        return gst_pad_query_default(pad, parent, query);
+    }
+}
+
+static void gst_hailomuxnet_wait_for_stream_frames(GstHailoMuxNet *self, HailoMuxNetStream *stream)
+{
+    std::unique_lock<std::mutex> lock(self->push_queue_mutex);
+    self->push_queue_cv.wait(lock, [self, stream] () {
+        return (0 == stream->ongoing_frames) || !self->is_push_thread_running;
+    });
+}
+
+static gboolean gst_hailomuxnet_sink_event(GstPad *pad, GstObject *parent, GstEvent *event)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(parent);
+    auto stream = static_cast<HailoMuxNetStream*>(gst_pad_get_element_private(pad));
+
+    // The events of each stream are forwarded to its own src pad. EOS is pushed only after the stream's frames,
+    // since the other streams keep the model busy.
+    if (GST_EVENT_TYPE(event) == GST_EVENT_EOS) {
+        gst_hailomuxnet_wait_for_stream_frames(self, stream);
+    }
+    return gst_pad_push_event(stream->srcpad, event);
+}
+
+static GstPad *gst_hailomuxnet_request_new_pad(GstElement *element, GstPadTemplate *templ, const gchar */*name*/,
+    const GstCaps */*caps*/)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(element);
+    std::unique_lock<std::mutex> lock(self->streams_mutex);
+
+    auto stream = make_unique_nothrow<HailoMuxNetStream>();
+    if (nullptr == stream) {
+        ERROR("Failed allocating a stream\n");
+        return nullptr;
+    }
+    stream->index = self->next_stream_index++;
+    stream->ongoing_frames = 0;
+
+    gchar *sinkpad_name = g_strdup_printf("sink_%u", stream->index);
+    stream->sinkpad = gst_pad_new_from_template(templ, sinkpad_name);
+    g_free(sinkpad_name);
+    gst_pad_set_element_private(stream->sinkpad, stream.get());
+    gst_pad_set_chain_function(stream->sinkpad, gst_hailomuxnet_chain);
+    gst_pad_set_query_function(stream->sinkpad, gst_hailomuxnet_handle_sink_query);
+    gst_pad_set_event_function(stream->sinkpad, GST_DEBUG_FUNCPTR(gst_hailomuxnet_sink_event));
+
+    gchar *srcpad_name = g_strdup_printf("src_%u", stream->index);
+    stream->srcpad = gst_pad_new_from_static_template(&src_template, srcpad_name);
+    g_free(srcpad_name);
+    gst_pad_set_element_private(stream->srcpad, stream.get());
+
+    // The src pad is added first, so it can be linked once the sink pad is
+    gst_element_add_pad(element, stream->srcpad);
+    gst_element_add_pad(element, stream->sinkpad);
+
+    GstPad *sinkpad = stream->sinkpad;
+    self->streams[stream->index] = std::move(stream);
+    return sinkpad;
+}
+
+static void gst_hailomuxnet_release_pad(GstElement *element, GstPad *pad)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(element);
+    std::unique_lock<std::mutex> lock(self->streams_mutex);
+
+    auto stream = static_cast<HailoMuxNetStream*>(gst_pad_get_element_private(pad));
+    auto stream_iter = self->streams.find(stream->index);
+    if (self->streams.end() == stream_iter) {
+        return;
+    }
+
+    // The stream's frames still in flight are pushed on its src pad before it is removed
+    gst_hailomuxnet_wait_for_stream_frames(self, stream);
+    gst_element_remove_pad(element, stream->sinkpad);
+    gst_element_remove_pad(element, stream->srcpad);
+    self->streams.erase(stream_iter);
+}
+
+static GstStateChangeReturn gst_hailomuxnet_change_state(GstElement *element, GstStateChange transition)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(element);
+    if (GST_STATE_CHANGE_PAUSED_TO_READY == transition) {
+        // This will wakeup any blocking calls to acquire an output buffer
+        for (auto &name_pool_pair : self->output_buffer_pools) {
+            gst_buffer_pool_set_flushing(name_pool_pair.second, TRUE);
+        }
+    }
+
+    GstStateChangeReturn ret = GST_ELEMENT_CLASS(gst_hailomuxnet_parent_class)->change_state(element, transition);
+    if (GST_STATE_CHANGE_FAILURE == ret) {
+        return ret;
+    }
+
+    if (GST_STATE_CHANGE_READY_TO_NULL == transition) {
+        auto status = gst_hailomuxnet_free(self);
+        if (HAILO_SUCCESS != status) {
+            return GST_STATE_CHANGE_FAILURE;
+        }
+    }
+
+    return ret;
+}
+
+static void gst_hailomuxnet_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(object);
+    if (self->is_configured || (nullptr != self->infer_model)) {
+        g_warning("The network was already configured so changing %s will not take place!", pspec->name);
+        return;
+    }
+
+    switch (property_id) {
+    case PROP_HEF_PATH:
+        self->props.m_hef_path = g_value_get_string(value);
+        break;
+    case PROP_BATCH_SIZE:
+        self->props.m_batch_size = static_cast<guint16>(g_value_get_uint(value));
+        break;
+    case PROP_DEVICE_COUNT:
+        self->props.m_device_count = static_cast<guint16>(g_value_get_uint(value));
+        break;
+    case PROP_VDEVICE_GROUP_ID:
+        self->props.m_vdevice_group_id = g_value_get_string(value);
+        break;
+    case PROP_SCHEDULING_ALGORITHM:
+        self->props.m_scheduling_algorithm = static_cast<hailo_scheduling_algorithm_t>(g_value_get_enum(value));
+        break;
+    case PROP_MULTI_PROCESS_SERVICE:
+        self->props.m_multi_process_service = g_value_get_boolean(value);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+static void gst_hailomuxnet_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec)
+{
+    GstHailoMuxNet *self = GST_HAILOMUXNET(object);
+    switch (property_id) {
+    case PROP_HEF_PATH:
+        g_value_set_string(value, self->props.m_hef_path.get().c_str());
+        break;
+    case PROP_BATCH_SIZE:
+        g_value_set_uint(value, self->props.m_batch_size.get());
+        break;
+    case PROP_DEVICE_COUNT:
+        g_value_set_uint(value, self->props.m_device_count.get());
+        break;
+    case PROP_VDEVICE_GROUP_ID:
+        g_value_set_string(value, self->props.m_vdevice_group_id.get().c_str());
+        break;
+    case PROP_SCHEDULING_ALGORITHM:
+        g_value_set_enum(value, self->props.m_scheduling_algorithm.get());
+        break;
+    case PROP_MULTI_PROCESS_SERVICE:
+        g_value_set_boolean(value, self->props.m_multi_process_service.get());
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+static void gst_hailomuxnet_class_init(GstHailoMuxNetClass *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+    GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
+
+    gst_element_class_add_pad_template(element_class, gst_static_pad_template_get(&sink_template));
+    gst_element_class_add_pad_template(element_class, gst_static_pad_template_get(&src_template));
+    element_class->change_state = gst_hailomuxnet_change_state;
+    element_class->request_new_pad = gst_hailomuxnet_request_new_pad;
+    element_class->release_pad = gst_hailomuxnet_release_pad;
+
+    gst_element_class_set_static_metadata(element_class,
+        "hailomuxnet element", "Hailo/Network",
+        "Configure a single Hailo Network and time-multiplex many streams onto it. "
+            "Each requested sink pad (sink_%u) is a stream, and its inferred buffers (with the output tensors as metas) are pushed "
+            "on the matching src pad (src_%u). Unlike using a hailonet per stream, the streams share one configured model, "
+            "so the scheduler doesn't switch between them. The network must have a single input, and all the streams must have its caps.",
+        PLUGIN_AUTHOR);
+
+    gobject_class->set_property = gst_hailomuxnet_set_property;
+    gobject_class->get_property = gst_hailomuxnet_get_property;
+    g_object_class_install_property(gobject_class, PROP_HEF_PATH,
+        g_param_spec_string("hef-path", "HEF Path Location", "Location of the HEF file to read", nullptr,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+        g_param_spec_uint("batch-size", "Inference Batch", "How many frame to send in one batch (the frames of a batch may be of different streams)",
+            MIN_GSTREAMER_BATCH_SIZE, MAX_GSTREAMER_BATCH_SIZE, HAILO_DEFAULT_BATCH_SIZE,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_DEVICE_COUNT,
+        g_param_spec_uint("device-count", "Number of devices to use", "Number of physical devices to use.", HAILO_DEFAULT_DEVICE_COUNT,
+            std::numeric_limits<uint16_t>::max(), HAILO_DEFAULT_DEVICE_COUNT, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_VDEVICE_GROUP_ID,
+        g_param_spec_string("vdevice-group-id",
+            "VDevice Group ID to share vdevices across elements",
+            "Used to share VDevices across different hailomuxnet and hailonet instances", HAILO_DEFAULT_VDEVICE_GROUP_ID,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SCHEDULING_ALGORITHM,
+        g_param_spec_enum("scheduling-algorithm", "Scheduling policy for automatic network group switching", "Controls the Model Scheduler algorithm of HailoRT. "
+            "Gets values from the enum GstHailoSchedulingAlgorithms. When set to HAILO_SCHEDULING_ALGORITHM_NONE, the network is activated once configured.",
+            GST_TYPE_SCHEDULING_ALGORITHM, HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_MULTI_PROCESS_SERVICE,
+        g_param_spec_boolean("multi-process-service", "Should run over HailoRT service", "Controls wether to run HailoRT over its service. "
+            "To use this property, the service should be active and scheduling-algorithm should be set. Defaults to false.",
+            HAILO_DEFAULT_MULTI_PROCESS_SERVICE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+}
+
+static void gst_hailomuxnet_init(GstHailoMuxNet *self)
+{
+    if (!do_versions_match(GST_ELEMENT(self))) {
+        return;
+    }
+
+    self->props = HailoMuxNetProperties();
+    self->streams = std::map<guint, std::unique_ptr<HailoMuxNetStream>>();
+    self->next_stream_index = 0;
+    self->vdevice = nullptr;
+    self->input_caps = nullptr;
+    self->is_configured = false;
+    self->did_critical_failure_happen = false;
+    self->allocator = nullptr;
+    self->output_buffer_pools = std::unordered_map<std::string, GstBufferPool*>();
+    self->output_vstream_infos = std::unordered_map<std::string, hailo_vstream_info_t>();
+    self->push_queue = std::queue<HailoMuxNetFrame>();
+    self->is_push_thread_running = false;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _GST_HAILOMUXNET_HPP_
+#define _GST_HAILOMUXNET_HPP_
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <gst/gst.h>
+#pragma GCC diagnostic pop
+
+#include <gst/video/video.h>
+
+#include "hailo/infer_model.hpp"
+#include "common.hpp"
+#include "gsthailo_allocator.hpp"
+#include "gsthailo_buffer_pool.hpp"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+
+using namespace hailort;
+
+G_BEGIN_DECLS
+
+#define MUXNET_MIN_OUTPUTS_POOL_SIZE (MAX_GSTREAMER_BATCH_SIZE)
+#define MUXNET_MAX_OUTPUTS_POOL_SIZE (MAX_GSTREAMER_BATCH_SIZE * 4)
+
+struct HailoMuxNetProperties final
+{
+public:
+    HailoMuxNetProperties() : m_hef_path(""), m_batch_size(HAILO_DEFAULT_BATCH_SIZE), m_device_count(0), m_vdevice_group_id(""),
+        m_scheduling_algorithm(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN), m_multi_process_service(HAILO_DEFAULT_MULTI_PROCESS_SERVICE)
+    {}
+
+    HailoElemStringProperty m_hef_path;
+    HailoElemProperty<guint16> m_batch_size;
+    HailoElemProperty<guint16> m_device_count;
+    HailoElemStringProperty m_vdevice_group_id;
+    HailoElemProperty<hailo_scheduling_algorithm_t> m_scheduling_algorithm;
+    HailoElemProperty<gboolean> m_multi_process_service;
+};
+
+// A stream multiplexed onto the model - a request sink pad and its src pad
+struct HailoMuxNetStream final
+{
+    guint index;
+    GstPad *sinkpad;
+    GstPad *srcpad;
+    // Frames of the stream that were received and not pushed yet, guarded by the push queue mutex
+    uint32_t ongoing_frames;
+};
+
+struct HailoMuxNetTensor final
+{
+    GstBuffer *buffer;
+    GstMapInfo buffer_info;
+};
+
+struct HailoMuxNetFrame final
+{
+    HailoMuxNetStream *stream;
+    GstBuffer *buffer;
+};
+
+typedef struct _GstHailoMuxNet {
+    GstElement element;
+    HailoMuxNetProperties props;
+
+    std::mutex streams_mutex;
+    std::map<guint, std::unique_ptr<HailoMuxNetStream>> streams;
+    guint next_stream_index;
+
+    std::unique_ptr<VDevice> vdevice;
+    std::shared_ptr<InferModel> infer_model;
+    std::shared_ptr<ConfiguredInferModel> configured_infer_model;
+    ConfiguredInferModel::Bindings infer_bindings;
+    GstCaps *input_caps;
+    GstVideoInfo input_frame_info;
+    bool is_configured;
+    bool did_critical_failure_happen;
+    // Serializes the frames of all the streams onto the model
+    std::mutex infer_mutex;
+
+    GstHailoAllocator *allocator;
+    std::unordered_map<std::string, GstBufferPool*> output_buffer_pools;
+    std::unordered_map<std::string, hailo_vstream_info_t> output_vstream_infos;
+
+    // Inferred frames, pushed on the src pads of their streams by the push thread
+    std::queue<HailoMuxNetFrame> push_queue;
+    std::mutex push_queue_mutex;
+    std::condition_variable push_queue_cv;
+    std::thread push_thread;
+    bool is_push_thread_running;
+} GstHailoMuxNet;
+
+typedef struct _GstHailoMuxNetClass {
+    GstElementClass parent_class;
+} GstHailoMuxNetClass;
+
+#define GST_TYPE_HAILOMUXNET (gst_hailomuxnet_get_type())
+#define GST_HAILOMUXNET(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_HAILOMUXNET,GstHailoMuxNet))
+#define GST_HAILOMUXNET_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_HAILOMUXNET,GstHailoMuxNetClass))
+#define GST_IS_HAILOMUXNET(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_HAILOMUXNET))
+#define GST_IS_HAILOMUXNET_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_HAILOMUXNET))
+
+GType gst_hailomuxnet_get_type (void);
+
+G_END_DECLS
+
+#endif /* _GST_HAILOMUXNET_HPP_ */
@@ -53,6 +53,10 @@ enum
     PROP_MULTI_PROCESS_SERVICE,
     PROP_PASS_THROUGH,
     PROP_FORCE_WRITABLE,
+    PROP_DMABUF_INPUT,
+    PROP_LEAKY,
+    PROP_SUBMIT_BURST_SIZE,
+    PROP_SUBMIT_BURST_TIMEOUT_MS,
 
     // Deprecated
     PROP_VDEVICE_KEY,
@@ -65,6 +69,21 @@ G_DEFINE_TYPE (GstHailoNet, gst_hailonet, GST_TYPE_ELEMENT);
 
 static std::atomic_uint32_t hailonet_count(0);
 
+static hailo_status gst_hailonet_submit_burst(GstHailoNet *self);
+
+// Holds the mapping of an imported dmabuf, as the qdata of the dmabuf's GstMemory
+struct HailoNetInputDmabufMappingRef final
+{
+    std::shared_ptr<HailoNetInputDmabufMappings> mappings;
+    int fd;
+    size_t size;
+};
+
+static GQuark gst_hailonet_input_dmabuf_mapping_quark()
+{
+    return g_quark_from_static_string("GstHailoNetInputDmabufMapping");
+}
+
 static bool gst_hailo_should_use_dma_buffers()
 {
     const char *env = g_getenv(GST_HAILO_USE_DMA_BUFFER_ENV_VAR);
@@ -79,6 +98,11 @@ static hailo_status gst_hailonet_deconfigure(GstHailoNet *self)
     }
 
     std::unique_lock<std::mutex> lock(self->infer_mutex);
+    // The frames of the current burst already hold their output buffers, so they are inferred rather than dropped
+    auto status = gst_hailonet_submit_burst(self);
+    if (HAILO_SUCCESS != status) {
+        ERROR("Submitting the pending frames failed with status = %d\n", status);
+    }
     self->configured_infer_model.reset();
     self->is_configured = false;
     return HAILO_SUCCESS;
@@ -94,9 +118,39 @@ static void gst_hailonet_unref_input_caps(GstHailoNet *self)
 
 static hailo_status gst_hailonet_free(GstHailoNet *self)
 {
+    {
+        std::unique_lock<std::mutex> lock(self->infer_mutex);
+        self->is_burst_timeout_thread_running = false;
+    }
+    self->burst_cv.notify_all();
+
+    if (self->burst_timeout_thread.joinable()) {
+        self->burst_timeout_thread.join();
+    }
+
     std::unique_lock<std::mutex> lock(self->infer_mutex);
+    self->burst_bindings.clear();
+    self->burst_tensors.clear();
     self->configured_infer_model.reset();
     self->infer_model.reset();
+
+    if (nullptr != self->input_dmabuf_mappings) {
+        // The dmabufs may outlive the vdevice, so their mappings are released here (and not when their memories are freed)
+        std::unique_lock<std::mutex> mappings_lock(self->input_dmabuf_mappings->mutex);
+        for (const auto &fd_size_pair : self->input_dmabuf_mappings->mapped_fds) {
+            auto status = self->vdevice->dma_unmap_dmabuf(fd_size_pair.first, fd_size_pair.second, HAILO_DMA_BUFFER_DIRECTION_H2D);
+            if (HAILO_SUCCESS != status) {
+                ERROR("Unmapping input dmabuf %d failed with status = %d\n", fd_size_pair.first, status);
+            }
+        }
+        self->input_dmabuf_mappings->mapped_fds.clear();
+        self->input_dmabuf_mappings->vdevice = nullptr;
+    }
+    self->input_dmabuf_mappings.reset();
+    // The buffers of the pools (also the ones still held downstream) are unmapped with the vdevice
+    for (auto &name_pool_pair : self->output_buffer_pools) {
+        gst_hailo_buffer_pool_release_vdevice(GST_HAILO_BUFFER_POOL(name_pool_pair.second));
+    }
     self->vdevice.reset();
 
     {
@@ -234,7 +288,8 @@ static hailo_status gst_hailonet_set_scheduler_params(GstHailoNet *self, std::sh
 
 static Expected<GstBufferPool*> gst_hailonet_create_buffer_pool(GstHailoNet *self, size_t frame_size)
 {
-    GstBufferPool *pool = gst_buffer_pool_new();
+    // The output buffers are DMA mapped once, when the pool allocates them
+    GstBufferPool *pool = gst_hailo_buffer_pool_new(*self->vdevice, HAILO_DMA_BUFFER_DIRECTION_D2H);
 
     GstStructure *config = gst_buffer_pool_get_config(pool);
     gst_buffer_pool_config_set_params(config, nullptr, static_cast<guint>(frame_size), self->props.m_outputs_min_pool_size.get(),
@@ -359,14 +414,62 @@ static void gst_hailonet_init_allocator(GstHailoNet *self)
     g_free(name);
 }
 
+static void gst_hailonet_start_burst_timeout_thread(GstHailoNet *self)
+{
+    const auto timeout = std::chrono::milliseconds(self->props.m_submit_burst_timeout_ms.get());
+    self->is_burst_timeout_thread_running = true;
+    self->burst_timeout_thread = std::thread([self, timeout] () {
+        std::unique_lock<std::mutex> lock(self->infer_mutex);
+        while (self->is_burst_timeout_thread_running) {
+            self->burst_cv.wait(lock, [self] () {
+                return !self->burst_tensors.empty() || !self->is_burst_timeout_thread_running;
+            });
+            if (!self->is_burst_timeout_thread_running) {
+                break;
+            }
+
+            // A full burst is submitted by the chain function, before the timeout expires
+            const auto burst_start_time = self->burst_start_time;
+            const auto is_burst_submitted = self->burst_cv.wait_until(lock, burst_start_time + timeout, [self, burst_start_time] () {
+                return self->burst_tensors.empty() || (burst_start_time != self->burst_start_time) ||
+                    !self->is_burst_timeout_thread_running;
+            });
+            if (!is_burst_submitted) {
+                auto status = gst_hailonet_submit_burst(self);
+                if (HAILO_SUCCESS != status) {
+                    ERROR("Submitting a partial burst failed with status = %d\n", status);
+                    self->did_critical_failure_happen = true;
+                }
+            }
+        }
+    });
+}
+
 static hailo_status gst_hailonet_allocate_infer_resources(GstHailoNet *self)
 {
-    TRY(self->infer_bindings, self->configured_infer_model->create_bindings());
+    TRY(const auto async_queue_size, self->configured_infer_model->get_async_queue_size());
+    self->async_queue_size = async_queue_size;
+    const auto burst_size = self->props.m_submit_burst_size.get();
+    CHECK(burst_size <= async_queue_size, HAILO_INVALID_OPERATION,
+        "submit-burst-size (%u) must not be larger than the async queue size of the network (%zu)", burst_size, async_queue_size);
+
+    // Each frame of a burst is bound by its own bindings, as the bindings of a frame are set before the burst is submitted
+    self->burst_bindings.clear();
+    for (guint i = 0; i < burst_size; i++) {
+        TRY(auto bindings, self->configured_infer_model->create_bindings());
+        self->burst_bindings.emplace_back(std::move(bindings));
+    }
+    self->infer_bindings = self->burst_bindings[0];
+    self->burst_tensors.clear();
+    self->burst_tensors.reserve(burst_size);
 
     self->output_buffer_pools = std::unordered_map<std::string, GstBufferPool*>();
     self->output_vstream_infos = std::unordered_map<std::string, hailo_vstream_info_t>();
 
-    TRY(const auto async_queue_size, self->configured_infer_model->get_async_queue_size());
+    self->input_dmabuf_mappings = make_shared_nothrow<HailoNetInputDmabufMappings>();
+    CHECK_NOT_NULL(self->input_dmabuf_mappings, HAILO_OUT_OF_HOST_MEMORY);
+    self->input_dmabuf_mappings->vdevice = self->vdevice.get();
+
     self->input_queue = gst_queue_array_new(static_cast<guint>(async_queue_size));
     self->thread_queue = gst_queue_array_new(static_cast<guint>(async_queue_size));
     self->is_thread_running = true;
@@ -406,6 +509,10 @@ static hailo_status gst_hailonet_allocate_infer_resources(GstHailoNet *self)
         self->output_vstream_infos[vstream_info.name] = vstream_info;
     }
 
+    if ((1 < burst_size) && (0 < self->props.m_submit_burst_timeout_ms.get())) {
+        gst_hailonet_start_burst_timeout_thread(self);
+    }
+
     return HAILO_SUCCESS;
 }
 
@@ -579,6 +686,30 @@ static void gst_hailonet_set_property(GObject *object, guint property_id, const
     case PROP_FORCE_WRITABLE:
         self->props.m_should_force_writable = g_value_get_boolean(value);
         break;
+    case PROP_DMABUF_INPUT:
+        if (nullptr != self->input_caps) {
+            g_warning("The input caps were already set so changing the dmabuf-input property will not take place!");
+            break;
+        }
+        self->props.m_dmabuf_input = g_value_get_boolean(value);
+        break;
+    case PROP_LEAKY:
+        self->props.m_leaky = static_cast<GstHailoLeaky>(g_value_get_enum(value));
+        break;
+    case PROP_SUBMIT_BURST_SIZE:
+        if (self->is_configured) {
+            g_warning("The network was already configured so changing the submit burst size will not take place!");
+            break;
+        }
+        self->props.m_submit_burst_size = g_value_get_uint(value);
+        break;
+    case PROP_SUBMIT_BURST_TIMEOUT_MS:
+        if (self->is_configured) {
+            g_warning("The network was already configured so changing the submit burst timeout will not take place!");
+            break;
+        }
+        self->props.m_submit_burst_timeout_ms = g_value_get_uint(value);
+        break;
     case PROP_OUTPUTS_MIN_POOL_SIZE:
         if (self->is_configured) {
             g_warning("The network has already been configured, the output's minimum pool size cannot be changed!");
@@ -723,6 +854,18 @@ static void gst_hailonet_get_property(GObject *object, guint property_id, GValue
     case PROP_FORCE_WRITABLE:
         g_value_set_boolean(value, self->props.m_should_force_writable.get());
         break;
+    case PROP_DMABUF_INPUT:
+        g_value_set_boolean(value, self->props.m_dmabuf_input.get());
+        break;
+    case PROP_LEAKY:
+        g_value_set_enum(value, self->props.m_leaky.get());
+        break;
+    case PROP_SUBMIT_BURST_SIZE:
+        g_value_set_uint(value, self->props.m_submit_burst_size.get());
+        break;
+    case PROP_SUBMIT_BURST_TIMEOUT_MS:
+        g_value_set_uint(value, self->props.m_submit_burst_timeout_ms.get());
+        break;
     case PROP_OUTPUTS_MIN_POOL_SIZE:
         g_value_set_uint(value, self->props.m_outputs_min_pool_size.get());
         break;
@@ -839,6 +982,34 @@ static void gst_hailonet_class_init(GstHailoNetClass *klass)
             "But in some cases (when the buffer is marked as not shared - see gst_buffer_copy documentation), it will do a deep copy."
             "By default, the hailonet element will not force the input buffer to be writable and will raise an error when the buffer is read-only.", false,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_DMABUF_INPUT,
+        g_param_spec_boolean("dmabuf-input", "DMABuf input", "Controls whether the sink pad prefers caps with the memory:DMABuf feature. "
+            "Input buffers backed by dmabufs (one per plane) are passed to the device by their fds without being mapped, and each dmabuf "
+            "is DMA mapped once - regardless of this property. Setting it to true lets upstream elements (e.g. v4l2src, decoders) "
+            "negotiate dmabufs. The downstream elements should accept memory:DMABuf caps as well, since the buffers are passed on. "
+            "Defaults to false.", false,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_LEAKY,
+        g_param_spec_enum("leaky", "Leaky",
+            "Controls whether buffers are dropped instead of back-pressuring upstream, so live pipelines keep a bounded latency. "
+            "upstream - a new buffer is dropped when the device is saturated (all the frames of the async queue are in flight) "
+            "or when the output queue would be full. downstream - the oldest inferred buffer is dropped when the output queue is full "
+            "(outputs-max-pool-size), so a slow downstream doesn't block the device; a saturated device still blocks. "
+            "Each dropped buffer is reported by an upstream QoS event and a QoS message. Defaults to no.",
+            GST_TYPE_HAILO_LEAKY, GST_HAILO_LEAKY_NONE,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SUBMIT_BURST_SIZE,
+        g_param_spec_uint("submit-burst-size", "Submit Burst Size",
+            "How many incoming buffers to aggregate before submitting them to the device together. "
+            "Unlike batch-size, which sets the device-side batch, this sets how many frames are handed to HailoRT at once - "
+            "e.g. when the buffers of several streams are funneled into a single hailonet. "
+            "Must not be larger than the async queue size of the network. Defaults to 1 (each buffer is submitted on its own).",
+            1, MAX_SUBMIT_BURST_SIZE, DEFAULT_SUBMIT_BURST_SIZE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SUBMIT_BURST_TIMEOUT_MS,
+        g_param_spec_uint("submit-burst-timeout-ms", "Submit Burst Timeout (ms)",
+            "The maximum time in milliseconds the first buffer of a burst waits for the burst to fill up, after which the partial burst is submitted. "
+            "0 means no timeout (a burst is submitted only once it is full, on EOS or on flush). Relevant only when submit-burst-size is larger than 1.",
+            0, std::numeric_limits<uint32_t>::max(), DEFAULT_SUBMIT_BURST_TIMEOUT_MS, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
     g_object_class_install_property(gobject_class, PROP_SCHEDULING_ALGORITHM,
         g_param_spec_enum("scheduling-algorithm", "Scheduling policy for automatic network group switching", "Controls the Model Scheduler algorithm of HailoRT. "
@@ -908,19 +1079,66 @@ static void gst_hailonet_class_init(GstHailoNetClass *klass)
     );
 }
 
+static bool gst_hailonet_is_thread_queue_full(GstHailoNet *self, uint32_t buffers_count)
+{
+    bool is_unlimited_pool_not_empty = (self->props.m_outputs_max_pool_size.get() == 0) && (buffers_count < MAX_OUTPUTS_POOL_SIZE);
+    bool is_pool_empty = buffers_count < self->props.m_outputs_max_pool_size.get();
+    return !(is_unlimited_pool_not_empty || is_pool_empty);
+}
+
+// Drops a buffer instead of blocking, reporting it upstream by a QoS event and to the application by a QoS message
+static void gst_hailonet_drop_buffer(GstHailoNet *self, GstBuffer *buffer)
+{
+    const auto dropped = ++self->dropped_buffers_count;
+    const guint64 processed = self->processed_buffers_count;
+    const auto timestamp = GST_BUFFER_PTS(buffer);
+    const auto duration = GST_BUFFER_DURATION(buffer);
+    gst_buffer_unref(buffer);
+
+    // The proportion is how much faster the buffers come than they are processed
+    const gdouble proportion = (0 == processed) ? 1.0 : (static_cast<gdouble>(processed + dropped) / static_cast<gdouble>(processed));
+    if (GST_CLOCK_TIME_IS_VALID(timestamp)) {
+        (void)gst_pad_push_event(self->sinkpad, gst_event_new_qos(GST_QOS_TYPE_OVERFLOW, proportion, 0, timestamp));
+    }
+
+    GstMessage *message = gst_message_new_qos(GST_OBJECT(self), FALSE, GST_CLOCK_TIME_NONE, GST_CLOCK_TIME_NONE, timestamp, duration);
+    gst_message_set_qos_stats(message, GST_FORMAT_BUFFERS, processed, dropped);
+    (void)gst_element_post_message(GST_ELEMENT(self), message);
+}
+
 static void gst_hailonet_push_buffer_to_thread(GstHailoNet *self, GstBuffer *buffer)
 {
+    GstBuffer *dropped_buffer = nullptr;
     {
         std::unique_lock<std::mutex> lock(self->thread_queue_mutex);
-        self->thread_cv.wait(lock, [self] () {
-            bool is_unlimited_pool_not_empty = (self->props.m_outputs_max_pool_size.get() == 0) && (self->buffers_in_thread_queue < MAX_OUTPUTS_POOL_SIZE);
-            bool is_pool_empty = self->buffers_in_thread_queue < self->props.m_outputs_max_pool_size.get();
-            return is_unlimited_pool_not_empty || is_pool_empty;
-        });
+        if ((GST_HAILO_LEAKY_DOWNSTREAM == self->props.m_leaky.get()) && gst_hailonet_is_thread_queue_full(self, self->buffers_in_thread_queue)) {
+            // The oldest buffer is dropped, so a slow downstream doesn't hold back the completions of the device
+            dropped_buffer = static_cast<GstBuffer*>(gst_queue_array_pop_head(self->thread_queue));
+            self->buffers_in_thread_queue--;
+        } else {
+            self->thread_cv.wait(lock, [self] () {
+                return !gst_hailonet_is_thread_queue_full(self, self->buffers_in_thread_queue);
+            });
+        }
         gst_queue_array_push_tail(self->thread_queue, buffer);
         self->buffers_in_thread_queue++;
     }
     self->thread_cv.notify_all();
+
+    if (nullptr != dropped_buffer) {
+        gst_hailonet_drop_buffer(self, dropped_buffer);
+    }
+}
+
+// Returns whether a new frame would have to wait - for the device (all the frames of the async queue are in flight) or
+// for the thread queue (the frames in flight would fill it up)
+static bool gst_hailonet_is_saturated(GstHailoNet *self)
+{
+    const auto frames_count = self->ongoing_frames + static_cast<uint32_t>(self->burst_tensors.size()) + 1;
+    if (frames_count > self->async_queue_size) {
+        return true;
+    }
+    return gst_hailonet_is_thread_queue_full(self, self->buffers_in_thread_queue + frames_count - 1);
 }
 
 // TODO: This function should be refactored. It does many unrelated things and the user need to know that he should unmap the buffer
@@ -1085,48 +1303,79 @@ static hailo_status gst_hailonet_fill_single_input_binding(GstHailoNet *self, ha
     return HAILO_SUCCESS;
 }
 
-static hailo_status gst_hailonet_call_run_async(GstHailoNet *self, const std::unordered_map<std::string, TensorInfo> &tensors)
+static hailo_status gst_hailonet_submit_burst(GstHailoNet *self)
 {
-    auto status = self->configured_infer_model->wait_for_async_ready(WAIT_FOR_ASYNC_READY_TIMEOUT);
+    if (self->burst_tensors.empty()) {
+        return HAILO_SUCCESS;
+    }
+
+    auto tensors_per_frame = std::move(self->burst_tensors);
+    self->burst_tensors.clear();
+    self->infer_bindings = self->burst_bindings[0];
+    const auto frames_count = static_cast<uint32_t>(tensors_per_frame.size());
+
+    auto status = self->configured_infer_model->wait_for_async_ready(WAIT_FOR_ASYNC_READY_TIMEOUT, frames_count);
     CHECK_SUCCESS(status);
 
     {
         std::unique_lock<std::mutex> lock(self->flush_mutex);
-        self->ongoing_frames++;
+        self->ongoing_frames += frames_count;
     }
 
-    TRY(auto job, self->configured_infer_model->run_async(self->infer_bindings, [self, tensors] (const AsyncInferCompletionInfo &/*completion_info*/) {
-        GstBuffer *buffer = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(self->input_queue_mutex);
-            buffer = static_cast<GstBuffer*>(gst_queue_array_pop_head(self->input_queue));
-            gst_hailonet_handle_buffer_events(self, buffer);
-        }
+    const std::vector<ConfiguredInferModel::Bindings> bindings(self->burst_bindings.begin(),
+        self->burst_bindings.begin() + frames_count);
+    TRY(auto job, self->configured_infer_model->run_async(bindings, [self, tensors_per_frame] (const AsyncInferCompletionInfo &/*completion_info*/) {
+        // The frames of a burst complete together, and are pushed in the order they were received
+        for (const auto &tensors : tensors_per_frame) {
+            GstBuffer *buffer = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(self->input_queue_mutex);
+                buffer = static_cast<GstBuffer*>(gst_queue_array_pop_head(self->input_queue));
+                gst_hailonet_handle_buffer_events(self, buffer);
+            }
 
-        for (auto &output : self->infer_model->outputs()) {
-            auto info = tensors.at(output.name());
-            gst_buffer_unmap(info.buffer, &info.buffer_info);
+            for (auto &output : self->infer_model->outputs()) {
+                auto info = tensors.at(output.name());
+                gst_buffer_unmap(info.buffer, &info.buffer_info);
 
-            GstHailoTensorMeta *buffer_meta = GST_TENSOR_META_ADD(info.buffer);
-            buffer_meta->info = self->output_vstream_infos[output.name()];
+                GstHailoTensorMeta *buffer_meta = gst_hailo_buffer_pool_get_tensor_meta(info.buffer);
+                buffer_meta->info = self->output_vstream_infos[output.name()];
 
-            (void)gst_buffer_add_parent_buffer_meta(buffer, info.buffer);
-            gst_buffer_unref(info.buffer);
-        }
+                (void)gst_buffer_add_parent_buffer_meta(buffer, info.buffer);
+                gst_buffer_unref(info.buffer);
+            }
 
-        {
-            std::unique_lock<std::mutex> lock(self->flush_mutex);
-            self->ongoing_frames--;
-        }
-        self->flush_cv.notify_all();
+            {
+                std::unique_lock<std::mutex> lock(self->flush_mutex);
+                self->ongoing_frames--;
+            }
+            self->flush_cv.notify_all();
 
-        gst_hailonet_push_buffer_to_thread(self, buffer);
+            gst_hailonet_push_buffer_to_thread(self, buffer);
+        }
     }));
     job.detach();
 
     return HAILO_SUCCESS;
 }
 
+static hailo_status gst_hailonet_call_run_async(GstHailoNet *self, std::unordered_map<std::string, TensorInfo> &&tensors)
+{
+    self->burst_tensors.emplace_back(std::move(tensors));
+    if (self->burst_bindings.size() == self->burst_tensors.size()) {
+        return gst_hailonet_submit_burst(self);
+    }
+
+    // The next frame is bound by the next bindings of the burst
+    self->infer_bindings = self->burst_bindings[self->burst_tensors.size()];
+    if (1 == self->burst_tensors.size()) {
+        self->burst_start_time = std::chrono::steady_clock::now();
+        self->burst_cv.notify_all();
+    }
+
+    return HAILO_SUCCESS;
+}
+
 static hailo_status gst_hailonet_async_infer_multi_input(GstHailoNet *self, GstBuffer *buffer)
 {
     if (gst_hailo_should_use_dma_buffers()) {
@@ -1146,7 +1395,7 @@ static hailo_status gst_hailonet_async_infer_multi_input(GstHailoNet *self, GstB
     }
     CHECK_EXPECTED_AS_STATUS(tensors); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
-    status = gst_hailonet_call_run_async(self, tensors.value());
+    status = gst_hailonet_call_run_async(self, tensors.release());
     CHECK_SUCCESS(status);
     return HAILO_SUCCESS;
 }
@@ -1165,14 +1414,114 @@ static hailo_status gst_hailonet_async_infer_single_input(GstHailoNet *self, Gst
     }
     CHECK_EXPECTED_AS_STATUS(tensors); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
-    status = gst_hailonet_call_run_async(self, tensors.value());
+    status = gst_hailonet_call_run_async(self, tensors.release());
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
 }
 
+static void gst_hailonet_release_input_dmabuf_mapping(gpointer data)
+{
+    auto mapping_ref = static_cast<HailoNetInputDmabufMappingRef*>(data);
+    {
+        auto &mappings = mapping_ref->mappings;
+        std::unique_lock<std::mutex> lock(mappings->mutex);
+        if ((nullptr != mappings->vdevice) && (1 == mappings->mapped_fds.erase(mapping_ref->fd))) {
+            auto status = mappings->vdevice->dma_unmap_dmabuf(mapping_ref->fd, mapping_ref->size, HAILO_DMA_BUFFER_DIRECTION_H2D);
+            if (HAILO_SUCCESS != status) {
+                ERROR("Unmapping input dmabuf %d failed with status = %d\n", mapping_ref->fd, status);
+            }
+        }
+    }
+    delete mapping_ref;
+}
+
+// Maps the dmabuf of the given memory for the inputs, if it isn't mapped yet
+static hailo_status gst_hailonet_map_input_dmabuf(GstHailoNet *self, GstMemory *memory)
+{
+    auto mapping_ref = static_cast<HailoNetInputDmabufMappingRef*>(
+        gst_mini_object_get_qdata(GST_MINI_OBJECT(memory), gst_hailonet_input_dmabuf_mapping_quark()));
+    if ((nullptr != mapping_ref) && (mapping_ref->mappings == self->input_dmabuf_mappings)) {
+        return HAILO_SUCCESS;
+    }
+
+    const int fd = gst_dmabuf_memory_get_fd(memory);
+    CHECK(fd != -1, HAILO_INTERNAL_FAILURE, "Failed to get FD from GstMemory!");
+    const size_t size = gst_memory_get_sizes(memory, nullptr, nullptr);
+
+    {
+        std::unique_lock<std::mutex> lock(self->input_dmabuf_mappings->mutex);
+        auto status = self->vdevice->dma_map_dmabuf(fd, size, HAILO_DMA_BUFFER_DIRECTION_H2D);
+        CHECK_SUCCESS(status, "Mapping input dmabuf %d failed, status = %d", fd, status);
+        self->input_dmabuf_mappings->mapped_fds[fd] = size;
+    }
+
+    auto new_mapping_ref = new (std::nothrow) HailoNetInputDmabufMappingRef{self->input_dmabuf_mappings, fd, size};
+    CHECK_NOT_NULL(new_mapping_ref, HAILO_OUT_OF_HOST_MEMORY);
+    // Replacing a mapping of a previous vdevice releases it (it is no longer mapped)
+    gst_mini_object_set_qdata(GST_MINI_OBJECT(memory), gst_hailonet_input_dmabuf_mapping_quark(), new_mapping_ref,
+        gst_hailonet_release_input_dmabuf_mapping);
+
+    return HAILO_SUCCESS;
+}
+
+// Returns a pix buffer of the buffer's dmabufs, or HAILO_NOT_SUPPORTED if the planes of the buffer can't be passed by fd
+// (a dmabuf fd is passed without an offset, so each plane must start a memory of its own)
+static Expected<hailo_pix_buffer_t> gst_hailonet_construct_dmabuf_pix_buffer(GstHailoNet *self, GstBuffer *buffer)
+{
+    GstVideoMeta *video_meta = gst_buffer_get_video_meta(buffer);
+    const auto number_of_planes = GST_VIDEO_INFO_N_PLANES(&self->input_frame_info);
+    if (number_of_planes > MAX_NUMBER_OF_PLANES) {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
+    hailo_pix_buffer_t pix_buffer = {};
+    pix_buffer.index = 0;
+    pix_buffer.number_of_planes = number_of_planes;
+    pix_buffer.memory_type = HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF;
+
+    for (uint32_t plane_index = 0; plane_index < number_of_planes; plane_index++) {
+        const gsize offset = (nullptr != video_meta) ? video_meta->offset[plane_index] :
+            GST_VIDEO_INFO_PLANE_OFFSET(&self->input_frame_info, plane_index);
+        const gint stride = (nullptr != video_meta) ? video_meta->stride[plane_index] :
+            GST_VIDEO_INFO_PLANE_STRIDE(&self->input_frame_info, plane_index);
+        const auto plane_size = static_cast<uint32_t>(stride * GST_VIDEO_INFO_COMP_HEIGHT(&self->input_frame_info, plane_index));
+
+        guint memory_index = 0;
+        guint memories_count = 0;
+        gsize skip = 0;
+        // The planes may share a dmabuf (e.g. a v4l2 NV12 frame), each at its own offset
+        if (!gst_buffer_find_memory(buffer, offset, plane_size, &memory_index, &memories_count, &skip) ||
+            (1 != memories_count)) {
+            return make_unexpected(HAILO_NOT_SUPPORTED);
+        }
+        GstMemory *memory = gst_buffer_peek_memory(buffer, memory_index);
+        if (!gst_is_dmabuf_memory(memory)) {
+            return make_unexpected(HAILO_NOT_SUPPORTED);
+        }
+
+        auto status = gst_hailonet_map_input_dmabuf(self, memory);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        pix_buffer.planes[plane_index].bytes_used = plane_size;
+        pix_buffer.planes[plane_index].plane_size = plane_size;
+        pix_buffer.planes[plane_index].fd = gst_dmabuf_memory_get_fd(memory);
+        pix_buffer.planes[plane_index].offset = static_cast<uint32_t>(memory->offset + skip);
+    }
+
+    return pix_buffer;
+}
+
 static Expected<hailo_pix_buffer_t> gst_hailonet_construct_pix_buffer(GstHailoNet *self, GstBuffer *buffer)
 {
+    if (gst_is_dmabuf_memory(gst_buffer_peek_memory(buffer, 0))) {
+        auto pix_buffer = gst_hailonet_construct_dmabuf_pix_buffer(self, buffer);
+        if (HAILO_NOT_SUPPORTED != pix_buffer.status()) {
+            return pix_buffer;
+        }
+        // Otherwise the dmabufs are mapped to the memory and passed by their addresses
+    }
+
     GstVideoFrame frame;
     auto result = gst_video_frame_map(&frame, &self->input_frame_info, buffer,
         static_cast<GstMapFlags>(GST_MAP_READ | GST_VIDEO_FRAME_MAP_FLAG_NO_REF));
@@ -1220,6 +1569,12 @@ static GstFlowReturn gst_hailonet_chain(GstPad * /*pad*/, GstObject * parent, Gs
         }
     }
 
+    if ((GST_HAILO_LEAKY_UPSTREAM == self->props.m_leaky.get()) && gst_hailonet_is_saturated(self)) {
+        gst_hailonet_drop_buffer(self, buffer);
+        return GST_FLOW_OK;
+    }
+    self->processed_buffers_count++;
+
     if (self->props.m_input_from_meta.get()) {
         auto status = gst_hailonet_async_infer_multi_input(self, buffer);
         if (HAILO_SUCCESS != status) {
@@ -1277,66 +1632,6 @@ static hailo_status gst_hailonet_init_infer_model(GstHailoNet * self)
     return HAILO_SUCCESS;
 }
 
-static const gchar *gst_hailonet_get_format_string(const InferModel::InferStream &input)
-{
-    switch (input.format().order) {
-    case HAILO_FORMAT_ORDER_RGB4:
-    case HAILO_FORMAT_ORDER_NHWC:
-        if (input.shape().features == RGBA_FEATURES_SIZE) {
-            return "RGBA";
-        }
-        if (input.shape().features == GRAY8_FEATURES_SIZE) {
-            return "GRAY8";
-        }
-        /* Fallthrough */
-    case HAILO_FORMAT_ORDER_NHCW:
-    case HAILO_FORMAT_ORDER_FCR:
-    case HAILO_FORMAT_ORDER_F8CR:
-        if (input.shape().features == GRAY8_FEATURES_SIZE) {
-            return "GRAY8";
-        }
-        CHECK(RGB_FEATURES_SIZE == input.shape().features, nullptr,
-            "Features of input %s is not %d for RGB format! (features=%d)", input.name().c_str(), RGB_FEATURES_SIZE,
-            input.shape().features);
-        return "RGB";
-    case HAILO_FORMAT_ORDER_YUY2:
-        CHECK(YUY2_FEATURES_SIZE == input.shape().features, nullptr,
-            "Features of input %s is not %d for YUY2 format! (features=%d)", input.name().c_str(), YUY2_FEATURES_SIZE,
-            input.shape().features);
-        return "YUY2";
-    case HAILO_FORMAT_ORDER_NV12:
-        CHECK(NV12_FEATURES_SIZE == input.shape().features, nullptr,
-            "Features of input %s is not %d for NV12 format! (features=%d)", input.name().c_str(), NV12_FEATURES_SIZE,
-            input.shape().features);
-        return "NV12";
-    case HAILO_FORMAT_ORDER_NV21:
-        CHECK(NV21_FEATURES_SIZE == input.shape().features, nullptr,
-            "Features of input %s is not %d for NV21 format! (features=%d)", input.name().c_str(), NV21_FEATURES_SIZE,
-            input.shape().features);
-        return "NV21";
-    case HAILO_FORMAT_ORDER_I420:
-        CHECK(I420_FEATURES_SIZE == input.shape().features, nullptr,
-            "Features of input %s is not %d for I420 format! (features=%d)", input.name().c_str(), I420_FEATURES_SIZE,
-            input.shape().features);
-        return "I420";
-    default:
-        ERROR("Input %s has an unsupported format order! order = %d\n", input.name().c_str(), input.format().order);
-        return nullptr;
-    }
-}
-
-static uint32_t get_height_by_order(uint32_t original_height, hailo_format_order_t order)
-{
-    switch (order) {
-    case HAILO_FORMAT_ORDER_NV12:
-    case HAILO_FORMAT_ORDER_NV21:
-        return original_height * 2;
-    default:
-        break;
-    }
-    return original_height;
-}
-
 static GstCaps *gst_hailonet_get_caps(GstHailoNet *self)
 {
     if (self->did_critical_failure_happen) {
@@ -1370,7 +1665,7 @@ static GstCaps *gst_hailonet_get_caps(GstHailoNet *self)
         return nullptr;
     }
 
-    const gchar *format = gst_hailonet_get_format_string(input.value());
+    const gchar *format = gst_hailo_get_format_string(input.value());
     if (nullptr == format) {
         return nullptr;
     }
@@ -1378,7 +1673,7 @@ static GstCaps *gst_hailonet_get_caps(GstHailoNet *self)
     GstCaps *new_caps = gst_caps_new_simple("video/x-raw",
         "format", G_TYPE_STRING, format,
         "width", G_TYPE_INT, input->shape().width,
-        "height", G_TYPE_INT, get_height_by_order(input->shape().height, input->format().order),
+        "height", G_TYPE_INT, gst_hailo_get_height_by_order(input->shape().height, input->format().order),
         nullptr);
 
     if (!gst_video_info_from_caps(&self->input_frame_info, new_caps)) {
@@ -1386,6 +1681,14 @@ static GstCaps *gst_hailonet_get_caps(GstHailoNet *self)
         return nullptr;
     }
 
+    if (self->props.m_dmabuf_input.get()) {
+        // The DMABuf caps come first, so they are preferred in the negotiation
+        GstCaps *dmabuf_caps = gst_caps_copy(new_caps);
+        gst_caps_set_features(dmabuf_caps, 0, gst_caps_features_new(GST_CAPS_FEATURE_MEMORY_DMABUF, nullptr));
+        gst_caps_append(dmabuf_caps, new_caps);
+        new_caps = dmabuf_caps;
+    }
+
     std::unique_lock<std::mutex> lock(self->input_caps_mutex);
     gst_hailonet_unref_input_caps(self);
     self->input_caps = new_caps;
@@ -1421,6 +1724,13 @@ static gboolean gst_hailonet_sink_event(GstPad *pad, GstObject *parent, GstEvent
 {
     GstHailoNet *self = GST_HAILONET(parent);
     if (GST_EVENT_TYPE(event) == GST_EVENT_EOS) {
+        {
+            std::unique_lock<std::mutex> lock(self->infer_mutex);
+            auto status = gst_hailonet_submit_burst(self);
+            if (HAILO_SUCCESS != status) {
+                ERROR("Submitting the last burst failed with status = %d\n", status);
+            }
+        }
         self->has_got_eos = true;
         return gst_pad_push_event(self->srcpad, event);
     }
@@ -1434,6 +1744,14 @@ static gboolean gst_hailonet_sink_event(GstPad *pad, GstObject *parent, GstEvent
 
 static void gst_hailonet_flush_callback(GstHailoNet *self, gpointer /*data*/)
 {
+    {
+        std::unique_lock<std::mutex> lock(self->infer_mutex);
+        auto status = gst_hailonet_submit_burst(self);
+        if (HAILO_SUCCESS != status) {
+            ERROR("Submitting the pending frames failed with status = %d\n", status);
+        }
+    }
+
     std::unique_lock<std::mutex> lock(self->flush_mutex);
     self->flush_cv.wait(lock, [self] () {
         return 0 == self->ongoing_frames;
@@ -1467,9 +1785,15 @@ static void gst_hailonet_init(GstHailoNet *self)
     self->is_configured = false;
     self->has_called_activate = false;
     self->ongoing_frames = 0;
+    self->async_queue_size = 0;
+    self->processed_buffers_count = 0;
+    self->dropped_buffers_count = 0;
+    self->is_burst_timeout_thread_running = false;
     self->did_critical_failure_happen = false;
     self->events_queue_per_buffer = std::unordered_map<GstBuffer*, std::queue<GstEvent*>>();
     self->curr_event_queue = std::queue<GstEvent*>();
+    self->burst_bindings = std::vector<ConfiguredInferModel::Bindings>();
+    self->burst_tensors = std::vector<std::unordered_map<std::string, TensorInfo>>();
 
     g_signal_connect(self, "flush", G_CALLBACK(gst_hailonet_flush_callback), nullptr);
 
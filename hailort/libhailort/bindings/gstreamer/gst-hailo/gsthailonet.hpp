@@ -31,12 +31,15 @@
 #include "hailo/infer_model.hpp"
 #include "common.hpp"
 #include "gsthailo_allocator.hpp"
+#include "gsthailo_buffer_pool.hpp"
 #include "gsthailo_dmabuf_allocator.hpp"
 
+#include <chrono>
 #include <queue>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace hailort;
 
@@ -45,6 +48,19 @@ G_BEGIN_DECLS
 #define MIN_OUTPUTS_POOL_SIZE (MAX_GSTREAMER_BATCH_SIZE)
 #define MAX_OUTPUTS_POOL_SIZE (MAX_GSTREAMER_BATCH_SIZE * 4)
 
+#define DEFAULT_SUBMIT_BURST_SIZE (1)
+#define MAX_SUBMIT_BURST_SIZE (MAX_GSTREAMER_BATCH_SIZE)
+#define DEFAULT_SUBMIT_BURST_TIMEOUT_MS (10)
+
+// The DMA mappings of the upstream dmabufs imported as inputs (by fd), mapped once per dmabuf.
+// A mapping is released when the GstMemory of its dmabuf is freed, or when the element frees the vdevice (vdevice is then null).
+struct HailoNetInputDmabufMappings final
+{
+    std::mutex mutex;
+    VDevice *vdevice;
+    std::unordered_map<int, size_t> mapped_fds;
+};
+
 struct HailoNetProperties final
 {
 public:
@@ -55,7 +71,8 @@ public:
         m_scheduler_threshold(HAILO_DEFAULT_SCHEDULER_THRESHOLD), m_scheduler_priority(HAILO_SCHEDULER_PRIORITY_NORMAL),
         m_input_format_type(HAILO_FORMAT_TYPE_AUTO), m_output_format_type(HAILO_FORMAT_TYPE_AUTO),
         m_nms_score_threshold(0), m_nms_iou_threshold(0), m_nms_max_proposals_per_class(0), m_input_from_meta(false),
-        m_no_transform(false), m_multi_process_service(HAILO_DEFAULT_MULTI_PROCESS_SERVICE), m_should_force_writable(false),
+        m_no_transform(false), m_multi_process_service(HAILO_DEFAULT_MULTI_PROCESS_SERVICE), m_should_force_writable(false), m_dmabuf_input(false), m_leaky(GST_HAILO_LEAKY_NONE),
+        m_submit_burst_size(DEFAULT_SUBMIT_BURST_SIZE), m_submit_burst_timeout_ms(DEFAULT_SUBMIT_BURST_TIMEOUT_MS),
         m_vdevice_key(DEFAULT_VDEVICE_KEY)
     {}
 
@@ -81,11 +98,20 @@ public:
     HailoElemProperty<gboolean> m_no_transform;
     HailoElemProperty<gboolean> m_multi_process_service;
     HailoElemProperty<gboolean> m_should_force_writable;
+    HailoElemProperty<gboolean> m_dmabuf_input;
+    HailoElemProperty<GstHailoLeaky> m_leaky;
+    HailoElemProperty<guint> m_submit_burst_size;
+    HailoElemProperty<guint32> m_submit_burst_timeout_ms;
 
     // Deprecated
     HailoElemProperty<guint32> m_vdevice_key;
 };
 
+struct TensorInfo {
+    GstBuffer *buffer;
+    GstMapInfo buffer_info;
+};
+
 typedef struct _GstHailoNet {
     GstElement element;
     GstPad *sinkpad;
@@ -112,13 +138,27 @@ typedef struct _GstHailoNet {
     bool is_configured;
     std::mutex infer_mutex;
 
+    // The frames of the current submission burst (see the submit-burst-size property), guarded by infer_mutex.
+    // The n-th frame of a burst is bound by burst_bindings[n], and infer_bindings refers to the bindings of the next frame.
+    std::vector<ConfiguredInferModel::Bindings> burst_bindings;
+    std::vector<std::unordered_map<std::string, TensorInfo>> burst_tensors;
+    std::chrono::steady_clock::time_point burst_start_time;
+    std::thread burst_timeout_thread;
+    std::condition_variable burst_cv;
+    bool is_burst_timeout_thread_running;
+
     bool has_called_activate;
     std::atomic_uint32_t ongoing_frames;
+    size_t async_queue_size;
+    // Counters of the QoS reported when buffers are dropped (see the leaky property)
+    std::atomic<guint64> processed_buffers_count;
+    std::atomic<guint64> dropped_buffers_count;
     std::condition_variable flush_cv;
     std::mutex flush_mutex;
     std::mutex input_caps_mutex;
 
     GstVideoInfo input_frame_info;
+    std::shared_ptr<HailoNetInputDmabufMappings> input_dmabuf_mappings;
 
     GstHailoAllocator *allocator;
     GstHailoDmabufAllocator *dmabuf_allocator;
@@ -134,11 +174,6 @@ typedef struct _GstHailoNetClass {
   GstElementClass parent_class;
 } GstHailoNetClass;
 
-struct TensorInfo {
-    GstBuffer *buffer;
-    GstMapInfo buffer_info;
-};
-
 #define GST_TYPE_HAILONET (gst_hailonet_get_type())
 #define GST_HAILONET(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_HAILONET,GstHailoNet))
@@ -21,6 +21,7 @@
 #include "sync_gst_hailosend.hpp"
 #include "sync_gst_hailorecv.hpp"
 #include "gsthailonet.hpp"
+#include "gsthailomuxnet.hpp"
 #include "gsthailodevicestats.hpp"
 #include "metadata/tensor_meta.hpp"
 
@@ -33,7 +34,8 @@ static gboolean plugin_init(GstPlugin *plugin)
         gst_element_register(plugin, "hailodevicestats", GST_RANK_PRIMARY, GST_TYPE_HAILODEVICESTATS) &&
         gst_element_register(nullptr, "hailosend", GST_RANK_PRIMARY, GST_TYPE_HAILOSEND) &&
         gst_element_register(nullptr, "hailorecv", GST_RANK_PRIMARY, GST_TYPE_HAILORECV) &&
-        gst_element_register(plugin, "hailonet", GST_RANK_PRIMARY, GST_TYPE_HAILONET);
+        gst_element_register(plugin, "hailonet", GST_RANK_PRIMARY, GST_TYPE_HAILONET) &&
+        gst_element_register(plugin, "hailomuxnet", GST_RANK_PRIMARY, GST_TYPE_HAILOMUXNET);
 }
 
 GST_PLUGIN_DEFINE(GST_VERSION_MAJOR, GST_VERSION_MINOR, hailo, "hailo gstreamer plugin", plugin_init, VERSION,
@@ -1,4 +1,6 @@
 from enum import Enum, IntEnum
+import asyncio
+import itertools
 import signal
 import struct
 
@@ -27,7 +29,8 @@ from hailo_platform.pyhailort._pyhailort import (TemperatureInfo, # noqa F401
                                                  MipiClockSelection, MipiIspImageInOrder,
                                                  MipiIspImageOutDataType, IspLightFrequency,
                                                  BootSource, HailoSocketDefs, Endianness,
-                                                 MipiInputStreamParams, SensorConfigTypes)
+                                                 MipiInputStreamParams, SensorConfigTypes,
+                                                 DmaBufferDirection)
 
 BBOX_PARAMS = _pyhailort.HailoRTDefaults.BBOX_PARAMS()
 HAILO_DEFAULT_ETH_CONTROL_PORT = _pyhailort.HailoRTDefaults.HAILO_DEFAULT_ETH_CONTROL_PORT()
@@ -604,6 +607,27 @@ class ConfiguredNetwork(object):
     def get_sorted_output_names(self):
         return self._configured_network.get_sorted_output_names()
 
+    def create_post_process_ops(self, output_format_type=FormatType.AUTO, threads_count=1):
+        """Create the post-process ops of the network group (NMS, softmax, argmax), to be run standalone over raw
+        outputs (e.g. read from the output streams).
+
+        Args:
+            output_format_type (:class:`~hailo_platform.pyhailort.pyhailort.FormatType`, optional): The format type of
+                the ops' outputs. Default is AUTO (the default type of each op).
+            threads_count (int, optional): The number of threads the frames of each execution are split between.
+                Default is 1.
+
+        Returns:
+            list of :class:`PostProcessOp`: The ops of the network group.
+        """
+        output_format = _pyhailort.HailoFormat()
+        output_format.type = output_format_type
+        output_format.order = FormatOrder.AUTO
+        output_format.flags = _pyhailort.FormatFlags.NONE
+        with ExceptionWrapper():
+            cpp_ops = self._configured_network.create_post_process_ops(output_format, threads_count)
+        return [PostProcessOp(cpp_op) for cpp_op in cpp_ops]
+
     def get_input_vstream_infos(self, network_name=None):
         """Get input vstreams information.
 
@@ -833,6 +857,67 @@ class ActivatedNetwork(object):
             return self._activated_network.get_intermediate_buffer(src_context_index, src_stream_index)
 
 
+class PostProcessOp(object):
+    """A post-process op of a network group, running over raw output buffers. Created by
+    :func:`ConfiguredNetwork.create_post_process_ops`.
+    The op runs natively, without the GIL."""
+
+    def __init__(self, post_process_op):
+        self._post_process_op = post_process_op
+
+    @property
+    def name(self):
+        return self._post_process_op.name()
+
+    @property
+    def input_names(self):
+        """list of str: The names of the op's inputs (the output streams it runs on)."""
+        return self._post_process_op.get_input_names()
+
+    def get_input_frame_size(self, input_name):
+        """Get the size of a frame of an input, in bytes."""
+        with ExceptionWrapper():
+            return self._post_process_op.get_input_frame_size(input_name)
+
+    def get_input_format(self, input_name):
+        """Get the format of an input, as the op expects it."""
+        with ExceptionWrapper():
+            return self._post_process_op.get_input_format(input_name)
+
+    def get_output_vstream_info(self):
+        """Get the info of the op's output."""
+        with ExceptionWrapper():
+            return self._post_process_op.get_output_vstream_info()
+
+    def execute(self, input_data, output_buffer=None):
+        """Run the op over a batch of frames.
+
+        Args:
+            input_data (dict of :obj:`numpy.ndarray`): The raw frames of each input, by input name. The first dimension
+                of each array is the number of frames.
+            output_buffer (:obj:`numpy.ndarray`, optional): A buffer for the outputs, reused between calls. If not given,
+                a buffer is allocated.
+
+        Returns:
+            :obj:`numpy.ndarray`: The raw outputs, of shape ``[frames_count, output_frame_size / item_size]`` (NMS
+            outputs may be converted by :class:`HailoRTTransformUtils`).
+        """
+        frames_count = InferVStreams._get_number_of_frames(input_data)
+        for name in input_data:
+            if not input_data[name].flags.c_contiguous:
+                input_data[name] = numpy.asarray(input_data[name], order='C')
+
+        with ExceptionWrapper():
+            output_frame_size = self._post_process_op.get_output_frame_size()
+            output_dtype = _pyhailort.get_dtype(self._post_process_op.get_output_vstream_info().format.type)
+        if output_buffer is None:
+            output_buffer = numpy.empty([frames_count, output_frame_size // output_dtype.itemsize], dtype=output_dtype)
+
+        with ExceptionWrapper():
+            self._post_process_op.execute(input_data, output_buffer, frames_count)
+        return output_buffer
+
+
 class InferVStreams(object):
     """Pipeline that allows to call blocking inference, to be used as a context manager."""
 
@@ -868,6 +953,7 @@ class InferVStreams(object):
         self._hw_time = None
         self._network_name_to_outputs = InferVStreams._get_network_to_outputs_mapping(configured_net_group)
         self._input_name_to_network_name = InferVStreams._get_input_name_to_network_mapping(configured_net_group)
+        self._sessions = []
 
     @staticmethod
     def _get_input_name_to_network_mapping(configured_net_group):
@@ -980,6 +1066,22 @@ class InferVStreams(object):
         self._total_time = time.perf_counter() - time_before_infer_calcs
         return output_buffers
 
+    def create_session(self, batch_size=1, slots_count=2):
+        """Create a session for repeated inference, reusing preallocated input and output buffers.
+
+        Args:
+            batch_size (int, optional): The number of frames of each inference. Default is 1.
+            slots_count (int, optional): The number of buffer slots of the session, used in turn by
+                :func:`InferVStreamsSession.infer`. The outputs of a slot are valid until the slot is used again.
+                Default is 2.
+
+        Returns:
+            :class:`InferVStreamsSession`: The session, valid as long as the pipeline is.
+        """
+        session = InferVStreamsSession(self, batch_size, slots_count)
+        self._sessions.append(session)
+        return session
+
     def get_hw_time(self):
         """Get the hardware device operation time it took to run inference over the last batch.
 
@@ -1089,10 +1191,89 @@ class InferVStreams(object):
         return self._infer_pipeline.set_nms_max_accumulated_mask_size(max_accumulated_mask_size)
 
     def __exit__(self, *args):
+        for session in self._sessions:
+            session._release()
+        self._sessions = []
         self._infer_pipeline.release()
         return False
 
 
+class InferVStreamsSession(object):
+    """Repeated inference over preallocated buffers, created by :func:`InferVStreams.create_session`.
+
+    The inputs and outputs of each slot are allocated and bound once, so an inference creates no arrays or dicts.
+    The slots are used in turn, so the outputs of an inference may be processed (e.g. on another thread) while the
+    next inferences run.
+
+    Note:
+        The output buffers are returned raw, as written by the vstreams - NMS outputs aren't converted (see
+        :class:`HailoRTTransformUtils`).
+    """
+
+    class Slot(object):
+        """Buffers of one inference of the session."""
+
+        def __init__(self, inputs, outputs, cpp_slot):
+            self._inputs = inputs
+            self._outputs = outputs
+            self._cpp_slot = cpp_slot
+
+        @property
+        def inputs(self):
+            """dict of :obj:`numpy.ndarray`: The input buffers of the slot, by input name, to be filled before infer."""
+            return self._inputs
+
+        @property
+        def outputs(self):
+            """dict of :obj:`numpy.ndarray`: The output buffers of the slot, by output name."""
+            return self._outputs
+
+    def __init__(self, infer_vstreams, batch_size, slots_count):
+        if slots_count < 1:
+            raise HailoRTException("slots_count must be positive, got {}".format(slots_count))
+
+        input_names = list(infer_vstreams._input_vstreams_params.keys())
+        self._slots = []
+        for _ in range(slots_count):
+            inputs = {}
+            for name in input_names:
+                with ExceptionWrapper():
+                    shape = infer_vstreams._infer_pipeline.get_shape(name)
+                    dtype = infer_vstreams._infer_pipeline.get_host_dtype(name)
+                inputs[name] = numpy.empty([batch_size] + list(shape), dtype=dtype)
+            outputs, _ = infer_vstreams._make_output_buffers_and_infos(inputs, batch_size)
+            with ExceptionWrapper():
+                cpp_slot = infer_vstreams._infer_pipeline.create_slot(inputs, outputs, batch_size)
+            self._slots.append(self.Slot(inputs, outputs, cpp_slot))
+        self._next_slot_index = 0
+
+    def next_slot(self):
+        """Returns the slot of the next inference, whose inputs are to be filled before calling :func:`infer`.
+
+        Returns:
+            :class:`InferVStreamsSession.Slot`: The slot.
+        """
+        return self._slots[self._next_slot_index]
+
+    def infer(self):
+        """Run inference over the next slot, and advance to the following one. The GIL is released during the inference.
+
+        Returns:
+            :class:`InferVStreamsSession.Slot`: The inferred slot, holding the outputs.
+        """
+        if not self._slots:
+            raise HailoRTInvalidOperationException("The session was released")
+
+        slot = self._slots[self._next_slot_index]
+        with ExceptionWrapper():
+            slot._cpp_slot.infer()
+        self._next_slot_index = (self._next_slot_index + 1) % len(self._slots)
+        return slot
+
+    def _release(self):
+        self._slots = []
+
+
 class HailoDetection(object):
     """Represents Hailo detection information"""
 
@@ -2624,6 +2805,68 @@ class AsyncInferCompletionInfo:
         return self._exception
 
 
+class AsyncInferCompletionQueue:
+    """
+    Queue of completed async infer jobs, an alternative to a per-job callback.
+    The completions are pushed by HailoRT's threads without acquiring the GIL, and drained by the user in batches
+    (by :func:`poll`, or by :func:`poll_async` from an asyncio event loop).
+
+    Note:
+        The buffers of a job are kept alive until its completion is drained from the queue.
+    """
+
+    def __init__(self):
+        self._completion_queue = _pyhailort.AsyncInferCompletionQueue()
+        self._job_ids = itertools.count()
+        # job id -> (user data, buffers of the job)
+        self._jobs = {}
+
+    def _add_job(self, user_data, buffers):
+        job_id = next(self._job_ids)
+        self._jobs[job_id] = (user_data, buffers)
+        return job_id
+
+    def poll(self, max_items=0, timeout_ms=0):
+        """
+        Pops the completions of the async infer jobs that are done.
+
+        Args:
+            max_items (int, optional): The maximum amount of completions to pop. Default is 0 (all of the completions).
+            timeout_ms (int, optional): Amount of time to wait for a completion, if there are none, in milliseconds. Default is 0.
+
+        Returns:
+            list of tuple(object, :class:`AsyncInferCompletionInfo`): The user data passed to
+            :func:`~hailo_platform.pyhailort.pyhailort.ConfiguredInferModel.run_async` and the completion info, per job.
+            Empty if no job was completed in the given timeout.
+        """
+        with ExceptionWrapper():
+            completions = self._completion_queue.poll(max_items, timedelta(milliseconds=timeout_ms))
+
+        results = []
+        for job_id, error_code in completions:
+            user_data, _ = self._jobs.pop(job_id)
+            cpp_cb_exception = ExceptionWrapper.create_exception_from_status(error_code) if error_code else None
+            results.append((user_data, AsyncInferCompletionInfo(cpp_cb_exception)))
+        return results
+
+    async def poll_async(self, max_items=0, timeout_ms=1000):
+        """
+        Awaitable version of :func:`poll`. The wait is done on the default executor of the running event loop.
+
+        Args:
+            max_items (int, optional): The maximum amount of completions to pop. Default is 0 (all of the completions).
+            timeout_ms (int, optional): Amount of time to wait for a completion, if there are none, in milliseconds. Default is 1000.
+
+        Returns:
+            list of tuple(object, :class:`AsyncInferCompletionInfo`): See :func:`poll`.
+        """
+        loop = asyncio.get_running_loop()
+        return await loop.run_in_executor(None, self.poll, max_items, timeout_ms)
+
+    def __len__(self):
+        return self._completion_queue.size()
+
+
 class InferModel:
     """
     Contains all of the necessary information for configuring the network for inference.
@@ -2914,6 +3157,9 @@ class ConfiguredInferModel:
         Passing an instance of :class:`ConfiguredInferModel` to a different process is not supported and would lead to an undefined behavior.
     """
 
+    # The alignment of the output buffers written directly by the device (HailoRTCommon::DMA_ABLE_ALIGNMENT_READ_HW_LIMITATION)
+    OUTPUT_BUFFER_ALIGNMENT = 4096
+
     @dataclass
     class NmsTransformationInfo:
         """
@@ -3204,6 +3450,27 @@ class ConfiguredInferModel:
 
         return bindings
 
+    @staticmethod
+    def create_aligned_buffer(shape, dtype=numpy.uint8):
+        """
+        Allocates a buffer aligned to the device's DMA requirements, to be set as an output buffer of a Bindings object.
+        Outputs of aligned buffers are written directly by the device, while outputs of unaligned buffers are written
+        to a staging buffer and copied to the user's buffer once the inference is done.
+
+        Args:
+            shape (list[int]): The shape of the buffer, e.g. :func:`~hailo_platform.pyhailort.pyhailort.InferModel.InferStream.shape`.
+            dtype (numpy.dtype, optional): The data type of the buffer. Default is uint8.
+
+        Returns:
+            :obj:`numpy.array`: The aligned buffer (uninitialized).
+        """
+        dtype = numpy.dtype(dtype)
+        size = int(numpy.prod(shape)) * dtype.itemsize
+        storage = numpy.empty(size + ConfiguredInferModel.OUTPUT_BUFFER_ALIGNMENT, dtype=numpy.uint8)
+        offset = -storage.ctypes.data % ConfiguredInferModel.OUTPUT_BUFFER_ALIGNMENT
+        # The view keeps a reference to the storage, so the storage lives as long as the buffer
+        return storage[offset:offset + size].view(dtype).reshape(shape)
+
     def wait_for_async_ready(self, timeout_ms=1000, frames_count=1):
         """
         Waits until the model is ready to launch a new asynchronous inference operation.
@@ -3237,7 +3504,7 @@ class ConfiguredInferModel:
             job = self.run_async(bindings)
             job.wait(timeout)
 
-    def run_async(self, bindings, callback=None):
+    def run_async(self, bindings, callback=None, completion_queue=None, user_data=None):
         """
         Launches an asynchronous inference operation with the provided bindings.
 
@@ -3249,6 +3516,10 @@ class ConfiguredInferModel:
                 (:class:`AsyncInferCompletionInfo`) holding the information about the async job. If the async job was
                 unsuccessful, the info parameter will hold an exception method that will raise an exception. The
                 callback must accept a 'completion_info' keyword argument
+            completion_queue (:class:`AsyncInferCompletionQueue`, optional): A queue the job's completion will be pushed to,
+                instead of calling a callback. Useful for high frame rates, as no GIL is acquired per job by HailoRT's
+                threads. Can't be used together with a callback.
+            user_data (object, optional): Returned with the job's completion from the completion queue.
 
         Note:
             As a standard, callbacks should be executed as quickly as possible.
@@ -3267,6 +3538,23 @@ class ConfiguredInferModel:
                 buffers.append(b.input(name).get_buffer())
             for name in self._output_names:
                 buffers.append(b.output(name).get_buffer(None))
+
+        if completion_queue is not None:
+            if callback is not None:
+                raise HailoRTInvalidOperationException("run_async accepts either a callback or a completion queue")
+
+            # the completion queue keeps the buffers alive until the completion is drained
+            job_id = completion_queue._add_job(user_data, buffers)
+            try:
+                with ExceptionWrapper():
+                    cpp_job = self._configured_infer_model.run_async_with_completion_queue(
+                        [b.get() for b in bindings], completion_queue._completion_queue, job_id
+                    )
+            except Exception:
+                completion_queue._jobs.pop(job_id, None)
+                raise
+            return AsyncInferJob(cpp_job)
+
         self._buffer_guards.append(buffers)
 
         def callback_wrapper(error_code):
@@ -3523,6 +3811,28 @@ class VDevice(object):
         with ExceptionWrapper():
             return self._vdevice.get_physical_devices_ids()
 
+    def create_dma_buffer(self, shape, dtype=numpy.uint8, direction=DmaBufferDirection.BOTH):
+        """
+        Allocates a DMA-able buffer mapped to the vdevice, to be used as an input or output buffer (e.g. by
+        :func:`~hailo_platform.pyhailort.pyhailort.ConfiguredInferModel.Bindings.InferStream.set_buffer`).
+        The device accesses the buffer directly, without an extra copy or a mapping per inference.
+
+        Args:
+            shape (list[int]): The shape of the buffer.
+            dtype (numpy.dtype, optional): The data type of the buffer. Default is uint8.
+            direction (:class:`~hailo_platform.pyhailort.pyhailort.DmaBufferDirection`, optional): The direction of the
+                mapping - H2D for inputs, D2H for outputs. Default is BOTH.
+
+        Returns:
+            :obj:`numpy.array`: The buffer (uninitialized). It is unmapped once released, or with the vdevice.
+        """
+        dtype = numpy.dtype(dtype)
+        size = int(numpy.prod(shape)) * dtype.itemsize
+        with ExceptionWrapper():
+            dma_buffer = self._vdevice.create_dma_buffer(size, direction)
+        # The array holds a reference to the dma buffer, keeping it mapped as long as the array (or one of its views) lives
+        return numpy.frombuffer(dma_buffer, dtype=dtype).reshape(shape)
+
     def create_infer_model(self, hef_source, network_name=""):
         """
         Creates the infer model from an hef.
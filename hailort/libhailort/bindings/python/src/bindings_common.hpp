@@ -33,6 +33,8 @@ public:
             return "uint16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "float32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "float16";
         default:
             throw HailoRTStatusException("Invalid format type.");
         }
@@ -9,7 +9,9 @@
 #include "infer_model_api.hpp"
 #include "bindings_common.hpp"
 #include "hailo/infer_model.hpp"
+#include "hailo/hailort_common.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
@@ -257,6 +259,31 @@ AsyncInferJobWrapper ConfiguredInferModelWrapper::run_async(
         };
     }
 
+    return launch_async(user_bindings, cb, is_callback_done);
+}
+
+AsyncInferJobWrapper ConfiguredInferModelWrapper::run_async_with_completion_queue(
+    std::vector<ConfiguredInferModelBindingsWrapper> &user_bindings,
+    std::shared_ptr<AsyncInferCompletionQueueWrapper> completion_queue, uint64_t job_id)
+{
+    auto is_callback_done_expected = Event::create_shared(Event::State::not_signalled);
+    VALIDATE_EXPECTED(is_callback_done_expected);
+    auto is_callback_done = is_callback_done_expected.release();
+
+    // the completion is pushed from libhailort's thread, without acquiring the GIL. python drains the queue
+    auto cb = [completion_queue, job_id, is_callback_done](const AsyncInferCompletionInfo &info)
+    {
+        completion_queue->push(job_id, info.status);
+        is_callback_done->signal();
+    };
+
+    return launch_async(user_bindings, cb, is_callback_done);
+}
+
+AsyncInferJobWrapper ConfiguredInferModelWrapper::launch_async(
+    std::vector<ConfiguredInferModelBindingsWrapper> &user_bindings,
+    std::function<void(const AsyncInferCompletionInfo &info)> cb, EventPtr is_callback_done)
+{
     std::vector<ConfiguredInferModel::Bindings> bindings;
     std::transform(user_bindings.begin(), user_bindings.end(), std::back_inserter(bindings),
         [](ConfiguredInferModelBindingsWrapper &wrapper) { return wrapper.get(); });
@@ -273,6 +300,12 @@ AsyncInferJobWrapper ConfiguredInferModelWrapper::run_async(
             auto buffer = stream->get_buffer();
             VALIDATE_EXPECTED(buffer);
 
+            // Aligned user buffers are written directly by the device, only unaligned ones are staged (and copied back
+            // once the job is done)
+            if (0 == (reinterpret_cast<uintptr_t>(buffer->data()) % HailoRTCommon::DMA_ABLE_ALIGNMENT_READ_HW_LIMITATION)) {
+                continue;
+            }
+
             user_output_buffers.push_back(buffer->data());
 
             auto aligned_buffer = Buffer::create_shared(buffer->size(), BufferStorageParams::create_dma());
@@ -376,6 +409,37 @@ void AsyncInferJobWrapper::wait(std::chrono::milliseconds timeout)
     VALIDATE_STATUS(status);
 }
 
+void AsyncInferCompletionQueueWrapper::push(uint64_t job_id, hailo_status status)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completions.emplace(job_id, static_cast<int>(status));
+    }
+    m_cv.notify_one();
+}
+
+std::vector<AsyncInferCompletionQueueWrapper::Completion> AsyncInferCompletionQueueWrapper::poll(size_t max_items,
+    std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait_for(lock, timeout, [this](){ return !m_completions.empty(); });
+
+    const auto count = (0 == max_items) ? m_completions.size() : std::min(max_items, m_completions.size());
+    std::vector<Completion> completions;
+    completions.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        completions.emplace_back(m_completions.front());
+        m_completions.pop();
+    }
+    return completions;
+}
+
+size_t AsyncInferCompletionQueueWrapper::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completions.size();
+}
+
 void InferModelWrapper::bind(py::module &m)
 {
     py::class_<
@@ -414,6 +478,8 @@ void ConfiguredInferModelWrapper::bind(py::module &m)
         // Releasing the GIL before calling run_async will allow the callbacks already registered to be called.
         // * callbacks will be called from another thread, and will acquire the GIL by themselves
         .def("run_async", &ConfiguredInferModelWrapper::run_async, py::call_guard<py::gil_scoped_release>())
+        .def("run_async_with_completion_queue", &ConfiguredInferModelWrapper::run_async_with_completion_queue,
+            py::call_guard<py::gil_scoped_release>())
         .def("set_scheduler_timeout", &ConfiguredInferModelWrapper::set_scheduler_timeout)
         .def("set_scheduler_threshold", &ConfiguredInferModelWrapper::set_scheduler_threshold)
         .def("set_scheduler_priority", &ConfiguredInferModelWrapper::set_scheduler_priority)
@@ -475,3 +541,16 @@ void AsyncInferJobWrapper::bind(py::module &m)
         .def("wait", &AsyncInferJobWrapper::wait, py::call_guard<py::gil_scoped_release>())
         ;
 }
+
+void AsyncInferCompletionQueueWrapper::bind(py::module &m)
+{
+    py::class_<
+        AsyncInferCompletionQueueWrapper, std::shared_ptr<AsyncInferCompletionQueueWrapper>
+    >(m, "AsyncInferCompletionQueue")
+        .def(py::init<>())
+        // poll may block until a completion is pushed, so the GIL is released while waiting (the completions are
+        // converted to python objects after the GIL is re-acquired)
+        .def("poll", &AsyncInferCompletionQueueWrapper::poll, py::call_guard<py::gil_scoped_release>())
+        .def("size", &AsyncInferCompletionQueueWrapper::size)
+        ;
+}
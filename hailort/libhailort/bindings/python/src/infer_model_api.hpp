@@ -14,7 +14,9 @@
 #include "hailo/event.hpp"
 #include "hailo/infer_model.hpp"
 #include "utils.hpp"
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <pybind11/numpy.h>
 #include <thread>
 #include <vector>
@@ -27,6 +29,7 @@ class ConfiguredInferModelBindingsWrapper;
 class ConfiguredInferModelBindingsInferStreamWrapper;
 class InferModelInferStreamWrapper;
 class AsyncInferJobWrapper;
+class AsyncInferCompletionQueueWrapper;
 
 using AsyncInferCallBack = std::function<void(const int)>;
 using AsyncInferCallBackAndStatus = std::pair<AsyncInferCallBack, AsyncInferCompletionInfo>;
@@ -100,6 +103,9 @@ public:
     AsyncInferJobWrapper run_async(
         std::vector<ConfiguredInferModelBindingsWrapper> &bindings,
         AsyncInferCallBack pythonic_cb);
+    AsyncInferJobWrapper run_async_with_completion_queue(
+        std::vector<ConfiguredInferModelBindingsWrapper> &bindings,
+        std::shared_ptr<AsyncInferCompletionQueueWrapper> completion_queue, uint64_t job_id);
     void set_scheduler_timeout(const std::chrono::milliseconds &timeout);
     void set_scheduler_threshold(uint32_t threshold);
     void set_scheduler_priority(uint8_t priority);
@@ -110,6 +116,8 @@ public:
 
 private:
     void execute_callbacks();
+    AsyncInferJobWrapper launch_async(std::vector<ConfiguredInferModelBindingsWrapper> &user_bindings,
+        std::function<void(const AsyncInferCompletionInfo &info)> cb, EventPtr is_callback_done);
 
     ConfiguredInferModel m_configured_infer_model;
     std::mutex m_queue_mutex;
@@ -190,6 +198,26 @@ private:
     EventPtr m_is_callback_done;
 };
 
+// Completions of async infer jobs, pushed by libhailort's threads without the GIL and drained by python in batches.
+// Each completion is the job id given to run_async and the job's status.
+class AsyncInferCompletionQueueWrapper final
+{
+public:
+    using Completion = std::pair<uint64_t, int>;
+
+    void push(uint64_t job_id, hailo_status status);
+    // Waits up to timeout for a completion, and pops up to max_items completions (all of them if max_items is 0)
+    std::vector<Completion> poll(size_t max_items, std::chrono::milliseconds timeout);
+    size_t size();
+
+    static void bind(py::module &m);
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::queue<Completion> m_completions;
+};
+
 }
 
 #endif /* INFER_MODEL_API_HPP_ */
@@ -31,6 +31,10 @@ void ConfiguredNetworkGroupWrapper::bind(py::module &m)
         .def("update_cache_offset", &ConfiguredNetworkGroupWrapper::update_cache_offset)
         .def("get_networks_names", &ConfiguredNetworkGroupWrapper::get_networks_names)
         .def("get_sorted_output_names", &ConfiguredNetworkGroupWrapper::get_sorted_output_names)
+        .def("create_post_process_ops", [](ConfiguredNetworkGroupWrapper &self, const hailo_format_t &output_format,
+            size_t threads_count) {
+            return PostProcessOpWrapper::create_all(self.get(), output_format, threads_count);
+        })
         .def("get_input_vstream_infos", &ConfiguredNetworkGroupWrapper::get_input_vstream_infos)
         .def("get_output_vstream_infos", &ConfiguredNetworkGroupWrapper::get_output_vstream_infos)
         .def("get_all_vstream_infos", &ConfiguredNetworkGroupWrapper::get_all_vstream_infos)
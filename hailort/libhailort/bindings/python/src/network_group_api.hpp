@@ -12,6 +12,7 @@
 
 #include "utils.hpp"
 #include "vstream_api.hpp"
+#include "post_process_op_api.hpp"
 
 #include "common/fork_support.hpp"
 
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file post_process_op_api.cpp
+ * @brief Defines binding to the standalone post-process ops usage over Python.
+ **/
+
+#include "post_process_op_api.hpp"
+#include "bindings_common.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+
+namespace hailort
+{
+
+std::vector<PostProcessOpWrapperPtr> PostProcessOpWrapper::create_all(ConfiguredNetworkGroup &network_group,
+    const hailo_format_t &output_format, size_t threads_count)
+{
+    if (0 == threads_count) {
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+
+    auto ops_metadata = network_group.get_ops_metadata();
+    VALIDATE_EXPECTED(ops_metadata);
+
+    std::vector<PostProcessOpWrapperPtr> results;
+    for (const auto &op_metadata : ops_metadata.value()) {
+        std::vector<std::shared_ptr<PostProcessOp>> ops;
+        for (size_t i = 0; i < threads_count; i++) {
+            auto op = PostProcessOp::create(op_metadata, output_format);
+            VALIDATE_EXPECTED(op);
+            ops.emplace_back(op.release());
+        }
+        results.emplace_back(std::make_shared<PostProcessOpWrapper>(std::move(ops)));
+    }
+    return results;
+}
+
+std::string PostProcessOpWrapper::name() const
+{
+    return m_ops[0]->name();
+}
+
+std::vector<std::string> PostProcessOpWrapper::get_input_names() const
+{
+    return m_ops[0]->get_input_names();
+}
+
+size_t PostProcessOpWrapper::get_input_frame_size(const std::string &input_name) const
+{
+    auto frame_size = m_ops[0]->get_input_frame_size(input_name);
+    VALIDATE_EXPECTED(frame_size);
+    return frame_size.release();
+}
+
+hailo_format_t PostProcessOpWrapper::get_input_format(const std::string &input_name) const
+{
+    auto format = m_ops[0]->get_input_format(input_name);
+    VALIDATE_EXPECTED(format);
+    return format.release();
+}
+
+hailo_vstream_info_t PostProcessOpWrapper::get_output_vstream_info() const
+{
+    auto vstream_info = m_ops[0]->get_output_vstream_info();
+    VALIDATE_EXPECTED(vstream_info);
+    return vstream_info.release();
+}
+
+size_t PostProcessOpWrapper::get_output_frame_size() const
+{
+    auto frame_size = m_ops[0]->get_output_frame_size();
+    VALIDATE_EXPECTED(frame_size);
+    return frame_size.release();
+}
+
+void PostProcessOpWrapper::execute(std::map<std::string, py::array> inputs, py::array output, size_t frames_count)
+{
+    // The arrays are accessed while holding the GIL, the frames are processed without it
+    std::map<std::string, std::pair<uint8_t*, size_t>> input_frames;
+    for (const auto &input_name : get_input_names()) {
+        if (inputs.end() == inputs.find(input_name)) {
+            std::cerr << "Missing input " << input_name << " of op " << name() << std::endl;
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        auto &input = inputs.at(input_name);
+        const auto frame_size = get_input_frame_size(input_name);
+        if (static_cast<size_t>(input.nbytes()) < (frame_size * frames_count)) {
+            std::cerr << "Input " << input_name << " of op " << name() << " holds less than " << frames_count << " frames" << std::endl;
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        input_frames.emplace(input_name, std::make_pair(static_cast<uint8_t*>(input.mutable_data()), frame_size));
+    }
+    const auto output_frame_size = get_output_frame_size();
+    if (static_cast<size_t>(output.nbytes()) < (output_frame_size * frames_count)) {
+        std::cerr << "Output of op " << name() << " holds less than " << frames_count << " frames" << std::endl;
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+    auto output_data = static_cast<uint8_t*>(output.mutable_data());
+
+    auto execute_frames = [&input_frames, output_data, output_frame_size](PostProcessOp &op, size_t first_frame, size_t end_frame)
+    {
+        for (size_t frame = first_frame; frame < end_frame; frame++) {
+            std::map<std::string, MemoryView> frame_inputs;
+            for (const auto &input : input_frames) {
+                frame_inputs.emplace(input.first, MemoryView(input.second.first + (frame * input.second.second), input.second.second));
+            }
+            auto status = op.execute(frame_inputs, MemoryView(output_data + (frame * output_frame_size), output_frame_size));
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
+        }
+        return HAILO_SUCCESS;
+    };
+
+    auto status = HAILO_SUCCESS;
+    {
+        py::gil_scoped_release release;
+
+        const auto threads_count = std::min(m_ops.size(), frames_count);
+        std::vector<hailo_status> statuses(threads_count, HAILO_SUCCESS);
+        std::vector<std::thread> threads;
+        // The current thread runs the first chunk of frames
+        for (size_t i = 1; i < threads_count; i++) {
+            threads.emplace_back([this, &statuses, &execute_frames, i, threads_count, frames_count]() {
+                statuses[i] = execute_frames(*m_ops[i], (frames_count * i) / threads_count,
+                    (frames_count * (i + 1)) / threads_count);
+            });
+        }
+        if (0 < threads_count) {
+            statuses[0] = execute_frames(*m_ops[0], 0, frames_count / threads_count);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        for (const auto thread_status : statuses) {
+            if (HAILO_SUCCESS != thread_status) {
+                status = thread_status;
+                break;
+            }
+        }
+    }
+    VALIDATE_STATUS(status);
+}
+
+void PostProcessOpWrapper::bind(py::module &m)
+{
+    py::class_<PostProcessOpWrapper, PostProcessOpWrapperPtr>(m, "PostProcessOp")
+        .def("name", &PostProcessOpWrapper::name)
+        .def("get_input_names", &PostProcessOpWrapper::get_input_names)
+        .def("get_input_frame_size", &PostProcessOpWrapper::get_input_frame_size)
+        .def("get_input_format", &PostProcessOpWrapper::get_input_format)
+        .def("get_output_vstream_info", &PostProcessOpWrapper::get_output_vstream_info)
+        .def("get_output_frame_size", &PostProcessOpWrapper::get_output_frame_size)
+        .def("execute", &PostProcessOpWrapper::execute)
+        ;
+}
+
+} /* namespace hailort */
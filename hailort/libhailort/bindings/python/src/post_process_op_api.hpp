@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file post_process_op_api.hpp
+ * @brief Defines binding to the standalone post-process ops usage over Python.
+ **/
+
+#ifndef _HAILO_POST_PROCESS_OP_API_HPP_
+#define _HAILO_POST_PROCESS_OP_API_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/network_group.hpp"
+#include "hailo/post_process_op.hpp"
+
+#include "utils.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+class PostProcessOpWrapper;
+using PostProcessOpWrapperPtr = std::shared_ptr<PostProcessOpWrapper>;
+
+// A post-process op of a network group, running over numpy arrays. The frames of a call are split between several
+// instances of the op (one per thread), each running on its own thread without the GIL.
+class PostProcessOpWrapper final
+{
+public:
+    static std::vector<PostProcessOpWrapperPtr> create_all(ConfiguredNetworkGroup &network_group,
+        const hailo_format_t &output_format, size_t threads_count);
+
+    PostProcessOpWrapper(std::vector<std::shared_ptr<PostProcessOp>> &&ops) : m_ops(std::move(ops)) {}
+
+    std::string name() const;
+    std::vector<std::string> get_input_names() const;
+    size_t get_input_frame_size(const std::string &input_name) const;
+    hailo_format_t get_input_format(const std::string &input_name) const;
+    hailo_vstream_info_t get_output_vstream_info() const;
+    size_t get_output_frame_size() const;
+    // The arrays hold frames_count frames each, one after the other
+    void execute(std::map<std::string, py::array> inputs, py::array output, size_t frames_count);
+
+    static void bind(py::module &m);
+
+private:
+    std::vector<std::shared_ptr<PostProcessOp>> m_ops;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_POST_PROCESS_OP_API_HPP_ */
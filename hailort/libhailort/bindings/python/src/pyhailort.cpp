@@ -19,6 +19,7 @@ using namespace std;
 #include "network_group_api.hpp"
 #include "device_api.hpp"
 #include "quantization_api.hpp"
+#include "post_process_op_api.hpp"
 
 #include "utils.hpp"
 
@@ -476,6 +477,12 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("D2H", HAILO_D2H_STREAM)
         ;
 
+    py::enum_<hailo_dma_buffer_direction_t>(m, "DmaBufferDirection")
+        .value("H2D", HAILO_DMA_BUFFER_DIRECTION_H2D)
+        .value("D2H", HAILO_DMA_BUFFER_DIRECTION_D2H)
+        .value("BOTH", HAILO_DMA_BUFFER_DIRECTION_BOTH)
+        ;
+
     py::class_<hailo_3d_image_shape_t>(m, "ImageShape")
         .def(py::init<>())
         .def(py::init<const uint32_t, const uint32_t, const uint32_t>())
@@ -534,6 +541,7 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("UINT8", HAILO_FORMAT_TYPE_UINT8)
         .value("UINT16", HAILO_FORMAT_TYPE_UINT16)
         .value("FLOAT32", HAILO_FORMAT_TYPE_FLOAT32)
+        .value("FLOAT16", HAILO_FORMAT_TYPE_FLOAT16, "Supported only for outputs.")
         ;
 
     py::enum_<hailo_format_order_t>(m, "FormatOrder")
@@ -831,6 +839,13 @@ PYBIND11_MODULE(_pyhailort, m) {
     py::enum_<hailo_scheduling_algorithm_t>(m, "SchedulingAlgorithm")
         .value("NONE", HAILO_SCHEDULING_ALGORITHM_NONE)
         .value("ROUND_ROBIN", HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN)
+        .value("DEADLINE", HAILO_SCHEDULING_ALGORITHM_DEADLINE)
+        .value("FAIR_SHARE", HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE)
+    ;
+
+    py::enum_<hailo_interrupts_wait_mode_t>(m, "InterruptsWaitMode")
+        .value("BLOCKING", HAILO_INTERRUPTS_WAIT_MODE_BLOCKING)
+        .value("ADAPTIVE_POLLING", HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING)
     ;
 
     py::class_<VDeviceParamsWrapper>(m, "VDeviceParams")
@@ -891,6 +906,94 @@ PYBIND11_MODULE(_pyhailort, m) {
                 params.orig_params.multi_process_service = multi_process_service;
             }
         )
+        .def_property("interrupts_wait_mode",
+            [](const VDeviceParamsWrapper& params) -> hailo_interrupts_wait_mode_t {
+                return params.orig_params.interrupts_wait_mode;
+            },
+            [](VDeviceParamsWrapper& params, hailo_interrupts_wait_mode_t interrupts_wait_mode) {
+                params.orig_params.interrupts_wait_mode = interrupts_wait_mode;
+            }
+        )
+        .def_property("interrupts_polling_idle_budget_us",
+            [](const VDeviceParamsWrapper& params) -> uint32_t {
+                return params.orig_params.interrupts_polling_idle_budget_us;
+            },
+            [](VDeviceParamsWrapper& params, uint32_t interrupts_polling_idle_budget_us) {
+                params.orig_params.interrupts_polling_idle_budget_us = interrupts_polling_idle_budget_us;
+            }
+        )
+        .def_property("user_buffers_mapping_cache_size",
+            [](const VDeviceParamsWrapper& params) -> uint64_t {
+                return params.orig_params.user_buffers_mapping_cache_size;
+            },
+            [](VDeviceParamsWrapper& params, uint64_t user_buffers_mapping_cache_size) {
+                params.orig_params.user_buffers_mapping_cache_size = user_buffers_mapping_cache_size;
+            }
+        )
+        .def_property("transfer_launcher_workers_count",
+            [](const VDeviceParamsWrapper& params) -> uint32_t {
+                return params.orig_params.transfer_launcher_workers_count;
+            },
+            [](VDeviceParamsWrapper& params, uint32_t transfer_launcher_workers_count) {
+                params.orig_params.transfer_launcher_workers_count = transfer_launcher_workers_count;
+            }
+        )
+        .def_property("transfer_launcher_cpu_affinity_mask",
+            [](const VDeviceParamsWrapper& params) -> uint64_t {
+                return params.orig_params.transfer_launcher_cpu_affinity_mask;
+            },
+            [](VDeviceParamsWrapper& params, uint64_t transfer_launcher_cpu_affinity_mask) {
+                params.orig_params.transfer_launcher_cpu_affinity_mask = transfer_launcher_cpu_affinity_mask;
+            }
+        )
+        .def_property("numa_node",
+            [](const VDeviceParamsWrapper& params) -> int32_t {
+                return params.orig_params.numa_node;
+            },
+            [](VDeviceParamsWrapper& params, int32_t numa_node) {
+                params.orig_params.numa_node = numa_node;
+            }
+        )
+        .def_property("scheduler_cpu_affinity_mask",
+            [](const VDeviceParamsWrapper& params) -> uint64_t {
+                return params.orig_params.scheduler_cpu_affinity_mask;
+            },
+            [](VDeviceParamsWrapper& params, uint64_t scheduler_cpu_affinity_mask) {
+                params.orig_params.scheduler_cpu_affinity_mask = scheduler_cpu_affinity_mask;
+            }
+        )
+        .def_property("interrupts_cpu_affinity_mask",
+            [](const VDeviceParamsWrapper& params) -> uint64_t {
+                return params.orig_params.interrupts_cpu_affinity_mask;
+            },
+            [](VDeviceParamsWrapper& params, uint64_t interrupts_cpu_affinity_mask) {
+                params.orig_params.interrupts_cpu_affinity_mask = interrupts_cpu_affinity_mask;
+            }
+        )
+        .def_property("threads_realtime_priority",
+            [](const VDeviceParamsWrapper& params) -> uint32_t {
+                return params.orig_params.threads_realtime_priority;
+            },
+            [](VDeviceParamsWrapper& params, uint32_t threads_realtime_priority) {
+                params.orig_params.threads_realtime_priority = threads_realtime_priority;
+            }
+        )
+        .def_property("multi_device_pipelining",
+            [](const VDeviceParamsWrapper& params) -> bool {
+                return params.orig_params.multi_device_pipelining;
+            },
+            [](VDeviceParamsWrapper& params, bool multi_device_pipelining) {
+                params.orig_params.multi_device_pipelining = multi_device_pipelining;
+            }
+        )
+        .def_property("allow_devices_hot_plug",
+            [](const VDeviceParamsWrapper& params) -> bool {
+                return params.orig_params.allow_devices_hot_plug;
+            },
+            [](VDeviceParamsWrapper& params, bool allow_devices_hot_plug) {
+                params.orig_params.allow_devices_hot_plug = allow_devices_hot_plug;
+            }
+        )
         .def_static("default", []() {
             auto orig_params = HailoRTDefaults::get_vdevice_params();
             orig_params.scheduling_algorithm = HAILO_SCHEDULING_ALGORITHM_NONE;
@@ -1178,6 +1281,7 @@ PYBIND11_MODULE(_pyhailort, m) {
         ;
 
     ActivatedAppContextManagerWrapper::bind(m);
+    AsyncInferCompletionQueueWrapper::bind(m);
     AsyncInferJobWrapper::bind(m);
     ConfiguredInferModelBindingsInferStreamWrapper::bind(m);
     ConfiguredInferModelBindingsWrapper::bind(m);
@@ -1188,12 +1292,15 @@ PYBIND11_MODULE(_pyhailort, m) {
     InferModelInferStreamWrapper::bind(m);
     InferModelWrapper::bind(m);
     InferVStreamsWrapper::bind(m);
+    InferVStreamsSlotWrapper::bind(m);
     InputVStreamWrapper::bind(m);
     InputVStreamsWrapper::bind(m);
     NetworkRateLimiter::bind(m);
     OutputVStreamWrapper::bind(m);
     OutputVStreamsWrapper::bind(m);
+    PostProcessOpWrapper::bind(m);
     VDeviceWrapper::bind(m);
+    DmaBufferWrapper::bind(m);
 
     std::stringstream version;
     version << HAILORT_MAJOR_VERSION << "." << HAILORT_MINOR_VERSION << "." << HAILORT_REVISION_VERSION;
@@ -34,3 +34,33 @@ InferModelWrapper VDeviceWrapper::create_infer_model_from_buffer(const py::bytes
 
     return InferModelWrapper(infer_model.release(), m_is_using_service);
 }
+
+std::shared_ptr<DmaBufferWrapper> DmaBufferWrapper::create(VDeviceWrapperPtr vdevice, size_t size,
+    hailo_dma_buffer_direction_t direction)
+{
+    auto buffer = Buffer::create_shared(size, BufferStorageParams::create_dma());
+    VALIDATE_EXPECTED(buffer);
+    auto buffer_ptr = buffer.release();
+
+    vdevice->dma_map(buffer_ptr->data(), buffer_ptr->size(), direction);
+    return std::make_shared<DmaBufferWrapper>(std::move(vdevice), std::move(buffer_ptr), direction);
+}
+
+DmaBufferWrapper::~DmaBufferWrapper()
+{
+    auto status = m_vdevice->dma_unmap(m_buffer->data(), m_buffer->size(), m_direction);
+    if (HAILO_SUCCESS != status) {
+        std::cerr << "Failed unmapping dma buffer, status " << status << std::endl;
+    }
+}
+
+void DmaBufferWrapper::bind(py::module &m)
+{
+    py::class_<DmaBufferWrapper, std::shared_ptr<DmaBufferWrapper>>(m, "DmaBuffer", py::buffer_protocol())
+        .def_buffer([](DmaBufferWrapper &self) -> py::buffer_info {
+            return py::buffer_info(self.m_buffer->data(), sizeof(uint8_t), py::format_descriptor<uint8_t>::format(),
+                static_cast<py::ssize_t>(self.m_buffer->size()));
+        })
+        .def("size", &DmaBufferWrapper::size)
+        ;
+}
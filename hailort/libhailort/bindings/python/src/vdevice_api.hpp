@@ -17,6 +17,7 @@
 #include "hailo/hef.hpp"
 #include "hailo/vdevice.hpp"
 #include "hailo/hailort_common.hpp"
+#include "hailo/buffer.hpp"
 
 #include <iostream>
 #include <memory>
@@ -44,6 +45,30 @@ struct VDeviceParamsWrapper {
 class VDeviceWrapper;
 using VDeviceWrapperPtr = std::shared_ptr<VDeviceWrapper>;
 
+// A DMA-able buffer mapped to the vdevice on creation (and unmapped on destruction), exposed with the buffer protocol
+class DmaBufferWrapper final {
+public:
+    static std::shared_ptr<DmaBufferWrapper> create(VDeviceWrapperPtr vdevice, size_t size,
+        hailo_dma_buffer_direction_t direction);
+
+    DmaBufferWrapper(VDeviceWrapperPtr vdevice, BufferPtr buffer, hailo_dma_buffer_direction_t direction) :
+        m_vdevice(std::move(vdevice)), m_buffer(std::move(buffer)), m_direction(direction)
+    {}
+    ~DmaBufferWrapper();
+
+    DmaBufferWrapper(const DmaBufferWrapper &) = delete;
+    DmaBufferWrapper &operator=(const DmaBufferWrapper &) = delete;
+
+    size_t size() const { return m_buffer->size(); }
+
+    static void bind(py::module &m);
+
+private:
+    VDeviceWrapperPtr m_vdevice;
+    BufferPtr m_buffer;
+    hailo_dma_buffer_direction_t m_direction;
+};
+
 class VDeviceWrapper {
 public:
     static VDeviceWrapperPtr create(const hailo_vdevice_params_t &params)
@@ -132,6 +157,24 @@ public:
         m_vdevice.reset();
     }
 
+    void dma_map(void *address, size_t size, hailo_dma_buffer_direction_t direction)
+    {
+        if (!m_vdevice) {
+            THROW_STATUS_ERROR(HAILO_INVALID_OPERATION);
+        }
+        auto status = m_vdevice->dma_map(address, size, direction);
+        VALIDATE_STATUS(status);
+    }
+
+    // The mappings are released with the vdevice, so there is nothing to unmap after release()
+    hailo_status dma_unmap(void *address, size_t size, hailo_dma_buffer_direction_t direction)
+    {
+        if (!m_vdevice) {
+            return HAILO_SUCCESS;
+        }
+        return m_vdevice->dma_unmap(address, size, direction);
+    }
+
     InferModelWrapper create_infer_model_from_file(const std::string &hef_path, const std::string &network_name);
     InferModelWrapper create_infer_model_from_buffer(const py::bytes &buffer, const std::string &network_name);
 
@@ -147,6 +190,9 @@ public:
             .def("release", &VDeviceWrapper::release)
             .def("create_infer_model_from_file", &VDeviceWrapper::create_infer_model_from_file)
             .def("create_infer_model_from_buffer", &VDeviceWrapper::create_infer_model_from_buffer)
+            .def("create_dma_buffer", [](VDeviceWrapperPtr self, size_t size, hailo_dma_buffer_direction_t direction) {
+                return DmaBufferWrapper::create(self, size, direction);
+            })
             ;
     }
 
@@ -325,6 +325,47 @@ void InferVStreamsWrapper::infer(std::map<std::string, py::array> input_data, st
     VALIDATE_STATUS(status);
 }
 
+InferVStreamsSlotWrapper InferVStreamsWrapper::create_slot(std::map<std::string, py::array> input_data,
+    std::map<std::string, py::array> output_data, size_t batch_size)
+{
+    if (!m_infer_pipeline) {
+        THROW_STATUS_ERROR(HAILO_INVALID_OPERATION);
+    }
+    return InferVStreamsSlotWrapper(m_infer_pipeline, std::move(input_data), std::move(output_data), batch_size);
+}
+
+InferVStreamsSlotWrapper::InferVStreamsSlotWrapper(std::shared_ptr<InferVStreams> infer_pipeline,
+    std::map<std::string, py::array> input_data, std::map<std::string, py::array> output_data, size_t batch_size) :
+    m_infer_pipeline(std::move(infer_pipeline)),
+    m_input_arrays(std::move(input_data)),
+    m_output_arrays(std::move(output_data)),
+    m_batch_size(batch_size)
+{
+    for (auto &name_pair : m_input_arrays) {
+        m_input_views.emplace(name_pair.first, MemoryView(name_pair.second.mutable_data(),
+            static_cast<size_t>(name_pair.second.nbytes())));
+    }
+
+    for (auto &name_pair : m_output_arrays) {
+        m_output_views.emplace(name_pair.first, MemoryView(name_pair.second.mutable_data(),
+            static_cast<size_t>(name_pair.second.nbytes())));
+    }
+}
+
+void InferVStreamsSlotWrapper::infer()
+{
+    hailo_status status = m_infer_pipeline->infer(m_input_views, m_output_views, m_batch_size);
+    VALIDATE_STATUS(status);
+}
+
+void InferVStreamsSlotWrapper::bind(py::module &m)
+{
+    py::class_<InferVStreamsSlotWrapper>(m, "InferVStreamsSlot")
+    // The views are bound on creation, so infer doesn't touch any python object and may run without the GIL
+    .def("infer", &InferVStreamsSlotWrapper::infer, py::call_guard<py::gil_scoped_release>())
+    ;
+}
+
 py::dtype InferVStreamsWrapper::get_host_dtype(const std::string &stream_name)
 {
     auto input = m_infer_pipeline->get_input_by_name(stream_name);
@@ -407,6 +448,7 @@ void InferVStreamsWrapper::bind(py::module &m)
     .def("get_shape", &InferVStreamsWrapper::get_shape)
     .def("get_user_buffer_format", &InferVStreamsWrapper::get_user_buffer_format)
     .def("infer", &InferVStreamsWrapper::infer)
+    .def("create_slot", &InferVStreamsWrapper::create_slot)
     .def("release",  [](InferVStreamsWrapper &self, py::args) { self.release(); })
     .def("set_nms_score_threshold", [](InferVStreamsWrapper &self, float32_t threshold)
     {
@@ -101,6 +101,25 @@ private:
 #endif
 };
 
+// Input and output buffers of an inference, bound once and reused by repeated infer calls
+class InferVStreamsSlotWrapper final
+{
+public:
+    InferVStreamsSlotWrapper(std::shared_ptr<InferVStreams> infer_pipeline, std::map<std::string, py::array> input_data,
+        std::map<std::string, py::array> output_data, size_t batch_size);
+    void infer();
+    static void bind(py::module &m);
+
+private:
+    std::shared_ptr<InferVStreams> m_infer_pipeline;
+    // The arrays are held so the views stay valid as long as the slot
+    std::map<std::string, py::array> m_input_arrays;
+    std::map<std::string, py::array> m_output_arrays;
+    std::map<std::string, MemoryView> m_input_views;
+    std::map<std::string, MemoryView> m_output_views;
+    size_t m_batch_size;
+};
+
 class InferVStreamsWrapper final
 {
 public:
@@ -109,6 +128,8 @@ public:
         const std::map<std::string, hailo_vstream_params_t> &output_vstreams_params);
     void infer(std::map<std::string, py::array> input_data, std::map<std::string, py::array> output_data,
         size_t batch_size);
+    InferVStreamsSlotWrapper create_slot(std::map<std::string, py::array> input_data,
+        std::map<std::string, py::array> output_data, size_t batch_size);
     py::dtype get_host_dtype(const std::string &stream_name);
     hailo_format_t get_user_buffer_format(const std::string &stream_name);
     std::vector<size_t> get_shape(const std::string &stream_name);
@@ -36,6 +36,8 @@ struct HAILORTAPI BufferStorageParams
 public:
 
     static BufferStorageParams create_dma();
+    // Dma buffer backed by huge pages (if available), reducing the mapping time and IOMMU pressure of large buffers.
+    static BufferStorageParams create_dma_huge_pages();
     // Defaults to heap params
     BufferStorageParams();
 
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file custom_post_process_op.hpp
+ * @brief A user defined post-process op, run by the inference pipeline of an InferModel.
+ **/
+
+#ifndef _HAILO_CUSTOM_POST_PROCESS_OP_HPP_
+#define _HAILO_CUSTOM_POST_PROCESS_OP_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/buffer.hpp"
+#include "hailo/expected.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+/** The info of an input or of the output of a CustomPostProcessOp */
+struct HAILORTAPI CustomPostProcessOpBufferInfo
+{
+    /** The name of the buffer - the name of the model's output for the op's inputs */
+    std::string name;
+
+    /** The shape of a frame of the buffer */
+    hailo_3d_image_shape_t shape;
+
+    /** The format of the buffer */
+    hailo_format_t format;
+
+    /** The quantization info of the buffer. Not relevant for ::HAILO_FORMAT_TYPE_FLOAT32 buffers */
+    hailo_quant_info_t quant_info;
+};
+
+/*!
+ * \class CustomPostProcessOp
+ * \brief A post-process op implemented by the user, added to an InferModel by InferModel::add_custom_post_process_op().
+ *
+ * The op runs in the inference pipeline, like the post-process ops of the HEF: once all of the op's inputs of a frame
+ * were read from the device (and transformed to the formats of the inputs), execute() is called with the input frames,
+ * and writes the output frame to a buffer of the pipeline, which is then copied to the user's output buffer.
+ *
+ * \note execute() is called from the pipeline's threads, one frame at a time.
+ */
+class HAILORTAPI CustomPostProcessOp
+{
+public:
+    virtual ~CustomPostProcessOp() = default;
+
+    /**
+     * Validates the op's inputs and returns the info of the op's output. Called once, when the op is added to an
+     * InferModel.
+     *
+     * @param[in] inputs_infos      The infos of the op's inputs, in the order they were passed to
+     *                              InferModel::add_custom_post_process_op().
+     *
+     * @return Upon success, returns the info of the output. The name of the output is the name of the InferModel's
+     *  output the op creates, and the output's format must not contain auto fields. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     */
+    virtual Expected<CustomPostProcessOpBufferInfo> get_output_info(
+        const std::vector<CustomPostProcessOpBufferInfo> &inputs_infos) = 0;
+
+    /**
+     * Runs the op over a single frame.
+     *
+     * @param[in] inputs        A map between the names of the op's inputs and the frames of the inputs.
+     * @param[in] output        The buffer the output frame is written to, of the frame size of the output.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error, which fails the
+     *  inference of the frame.
+     */
+    virtual hailo_status execute(const std::map<std::string, MemoryView> &inputs, MemoryView output) = 0;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_CUSTOM_POST_PROCESS_OP_HPP_ */
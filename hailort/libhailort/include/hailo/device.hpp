@@ -446,6 +446,34 @@ public:
      */
     Expected<hailo_chip_temperature_info_t> get_chip_temperature();
 
+    /**
+     * Starts sampling the device's power consumption and temperature in the background. The samples are kept in a
+     * ring buffer, read by get_telemetry_samples().
+     *
+     * @param[in] sampling_period       The time between samples. Must be at least 100 milliseconds.
+     * @param[in] max_samples_count     The size of the ring buffer - once it's full, the oldest samples are dropped.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The power is measured by the firmware's long power measurement (on ::HAILO_MEASUREMENT_BUFFER_INDEX_0),
+     *       which averages the sensor's values between samples, so each sample costs a couple of controls regardless
+     *       of the sensor's rate. The long power measurement must not be used while the telemetry sampling runs.
+     */
+    virtual hailo_status start_telemetry(std::chrono::milliseconds sampling_period, size_t max_samples_count) = 0;
+
+    /**
+     * Reads the telemetry samples taken since the previous call, oldest first.
+     *
+     * @return Upon success, returns a vector of ::hailo_telemetry_sample_t. Otherwise, returns a ::hailo_status error.
+     * @note Returns ::HAILO_INVALID_OPERATION if the telemetry sampling wasn't started.
+     */
+    virtual Expected<std::vector<hailo_telemetry_sample_t>> get_telemetry_samples() = 0;
+
+    /**
+     * Stops the telemetry sampling started by start_telemetry(). Samples that weren't read are dropped.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    virtual hailo_status stop_telemetry() = 0;
+
     /**
      * Reset device.
      * 
@@ -465,6 +493,9 @@ public:
      * @param[in] notification_id       The ID of the notification.
      * @param[in] opaque                User specific data.
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The callbacks are called on a callbacks thread, one after the other. If the environment variable
+     *       HAILO_NOTIFICATION_CALLBACK_THREAD_PER_ID is set, the callbacks of each notification ID are called on
+     *       their own thread, so callbacks of different IDs may be called concurrently.
      */
     virtual hailo_status set_notification_callback(const NotificationCallback &func, hailo_notification_id_t notification_id,
         void *opaque) = 0;
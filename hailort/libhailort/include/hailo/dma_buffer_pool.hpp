@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dma_buffer_pool.hpp
+ * @brief A pool of physically continuous dma buffers, shared between the device and other consumers (e.g. the ISP).
+ *
+ * The buffers are allocated from the CMA heap and mapped to the device once, when the pool is created. They are
+ * exported as dmabufs, so a camera pipeline may capture straight into them (e.g. v4l2 buffers imported with
+ * V4L2_MEMORY_DMABUF), and a captured frame is inferred from the same buffer - without copies, and without any
+ * allocation or mapping at runtime.
+ **/
+
+#ifndef _HAILO_DMA_BUFFER_POOL_HPP_
+#define _HAILO_DMA_BUFFER_POOL_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/vdevice.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace hailort
+{
+
+class DmaBufferPoolImpl;
+
+/*!
+ * \class DmaBufferPool
+ * \brief A fixed set of physically continuous dmabufs, recycled with acquire() and release().
+ *
+ * \note Supported on Linux, where the CMA heap is available (/dev/dma_heap/linux,cma).
+ */
+class HAILORTAPI DmaBufferPool final
+{
+public:
+    /**
+     * Allocates the buffers of the pool, and maps them to @a vdevice.
+     *
+     * @param[in] vdevice           The VDevice the buffers are inferred with. Must outlive the pool.
+     * @param[in] buffer_size       The size of each buffer.
+     * @param[in] buffers_count     The amount of buffers.
+     * @param[in] direction         The direction the buffers are mapped in (::HAILO_DMA_BUFFER_DIRECTION_H2D for
+     *                              input frames).
+     * @return Upon success, returns Expected of a shared pointer to the pool. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     */
+    static Expected<std::shared_ptr<DmaBufferPool>> create(VDevice &vdevice, size_t buffer_size, size_t buffers_count,
+        hailo_dma_buffer_direction_t direction);
+
+    /**
+     * Unmaps and frees the buffers. Must not be called while a buffer is in use (by the device or by another consumer).
+     */
+    ~DmaBufferPool();
+
+    size_t buffer_size() const;
+    size_t buffers_count() const;
+
+    /**
+     * @return The dmabuf of the buffer at @a index (e.g. to register all of the buffers with the ISP up front).
+     */
+    Expected<hailo_dma_buffer_t> get_buffer(size_t index) const;
+
+    /**
+     * Takes a free buffer out of the pool, waiting for one to be released if all are in use.
+     *
+     * @param[in] timeout   The maximum time to wait for a free buffer.
+     * @return Upon success, returns Expected of the index of the buffer. Otherwise, returns Unexpected of
+     *  ::hailo_status error (::HAILO_TIMEOUT if no buffer was released in time).
+     */
+    Expected<size_t> acquire(std::chrono::milliseconds timeout);
+
+    /**
+     * Returns the buffer at @a index to the pool (e.g. once the inference of its frame is done).
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status release(size_t index);
+
+    DmaBufferPool(std::unique_ptr<DmaBufferPoolImpl> pimpl);
+    DmaBufferPool(const DmaBufferPool &) = delete;
+    DmaBufferPool &operator=(const DmaBufferPool &) = delete;
+
+private:
+    std::unique_ptr<DmaBufferPoolImpl> m_pimpl;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_DMA_BUFFER_POOL_HPP_ */
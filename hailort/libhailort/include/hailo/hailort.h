@@ -59,8 +59,16 @@ extern "C" {
 #define HAILO_DEFAULT_VSTREAM_QUEUE_SIZE (2)
 #define HAILO_DEFAULT_VSTREAM_TIMEOUT_MS (10000)
 #define HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS (10000)
+#define HAILO_DEFAULT_DEVICE_REMOVAL_TIMEOUT_MS (10000)
 #define HAILO_DEFAULT_ASYNC_INFER_QUEUE_SIZE (2)
 #define HAILO_DEFAULT_DEVICE_COUNT (1)
+#define HAILO_DEFAULT_INTERRUPTS_POLLING_IDLE_BUDGET_US (1000)
+#define HAILO_DEFAULT_TRANSFER_LAUNCHER_WORKERS_COUNT (1)
+/** Place the memory and threads of each device on the NUMA node the device is attached to */
+#define HAILO_NUMA_NODE_AUTO (-1)
+/** Disable the NUMA aware placement */
+#define HAILO_NUMA_NODE_NONE (-2)
+#define HAILO_MAX_THREADS_REALTIME_PRIORITY (99)
 
 #define HAILO_SOC_ID_LENGTH (32)
 #define HAILO_ETH_MAC_LENGTH (6)
@@ -74,6 +82,10 @@ extern "C" {
 #define HAILO_SCHEDULER_PRIORITY_NORMAL (16)
 #define HAILO_SCHEDULER_PRIORITY_MAX (31)
 #define HAILO_SCHEDULER_PRIORITY_MIN (0)
+#define HAILO_SCHEDULER_SHARE_DEFAULT (1)
+#define HAILO_SCHEDULER_ALL_DEVICES_MASK (UINT64_MAX)
+#define HAILO_SCHEDULER_NO_PINNED_DEVICE (UINT32_MAX)
+#define HAILO_SCHEDULER_BURST_SIZE_DEFAULT (0)
 
 #define MAX_NUMBER_OF_PLANES (4)
 #define NUMBER_OF_PLANES_NV12_NV21 (2)
@@ -170,6 +182,9 @@ typedef uint16_t nms_bbox_counter_t;
     HAILO_STATUS__X(82, HAILO_QUEUE_IS_FULL                           /*!< Cannot push more items into the queue */)\
     HAILO_STATUS__X(83, HAILO_DMA_MAPPING_ALREADY_EXISTS              /*!< DMA mapping already exists */)\
     HAILO_STATUS__X(84, HAILO_CANT_MEET_BUFFER_REQUIREMENTS           /*!< can't meet buffer requirements */)\
+    HAILO_STATUS__X(85, HAILO_FRAME_DROPPED                           /*!< The frame was dropped by the scheduler overload policy */)\
+    HAILO_STATUS__X(86, HAILO_FRAME_CANCELLED                         /*!< The frame was cancelled before it was sent to the device */)\
+    HAILO_STATUS__X(87, HAILO_FRAME_EXPIRED                           /*!< The frame wasn't sent to the device before its deadline */)\
 
 typedef enum {
 #define HAILO_STATUS__X(value, name) name = value,
@@ -228,6 +243,12 @@ typedef struct _hailo_input_vstream *hailo_input_vstream;
 /** Output virtual stream */
 typedef struct _hailo_output_vstream *hailo_output_vstream;
 
+/** Model to be configured for asynchronous inference (including the post-processing of the model) */
+typedef struct _hailo_infer_model *hailo_infer_model;
+
+/** Configured infer model that can be used to perform an asynchronous inference */
+typedef struct _hailo_configured_infer_model *hailo_configured_infer_model;
+
 /** Enum that represents the type of devices that would be measured */
 typedef enum hailo_dvm_options_e {
     /** VDD_CORE DVM */
@@ -385,11 +406,63 @@ typedef enum hailo_scheduling_algorithm_e {
     HAILO_SCHEDULING_ALGORITHM_NONE = 0,
     /** Round Robin */
     HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,
+    /**
+     * Earliest deadline first - network groups with a deadline (see hailo_set_scheduler_deadline()) are chosen by the
+     * deadline of their oldest pending request. Network groups without a deadline are chosen as in
+     * ::HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN, when no network group with a deadline is ready.
+     */
+    HAILO_SCHEDULING_ALGORITHM_DEADLINE,
+    /**
+     * Weighted fair share - network groups of the same priority get device time in proportion to their share (see
+     * hailo_set_scheduler_share()). The device time each network group consumed is measured, and the ready network
+     * group that consumed the least device time relative to its share is chosen.
+     */
+    HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE,
 
     /** Max enum value to maintain ABI Integrity */
     HAILO_SCHEDULING_ALGORITHM_MAX_ENUM = HAILO_MAX_ENUM
 } hailo_scheduling_algorithm_t;
 
+/** Scheduler overload policy - what the scheduler does with a new frame of a network group that already has the max
+ *  amount of pending frames (see hailo_set_scheduler_overload_policy()) */
+typedef enum hailo_scheduler_overload_policy_e {
+    /** The frame is queued (once the async queue of the network group is full, sending frames waits) */
+    HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE = 0,
+    /** The oldest pending frame is dropped (it is completed with ::HAILO_FRAME_DROPPED), and the new frame is queued */
+    HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_OLDEST,
+    /** The new frame is dropped (it is completed with ::HAILO_FRAME_DROPPED) */
+    HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_NEWEST,
+    /** The new frame is rejected (it is completed with ::HAILO_QUEUE_IS_FULL) */
+    HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT,
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_SCHEDULER_OVERLOAD_POLICY_MAX_ENUM = HAILO_MAX_ENUM
+} hailo_scheduler_overload_policy_t;
+
+/** Frames shed by the scheduler overload policy of a network group */
+typedef struct {
+    /** Frames completed with ::HAILO_FRAME_DROPPED */
+    uint64_t dropped_frames;
+    /** Frames completed with ::HAILO_QUEUE_IS_FULL */
+    uint64_t rejected_frames;
+} hailo_scheduler_overload_stats_t;
+
+/** Method used by the vDMA interrupts thread to wait for transfers completion */
+typedef enum hailo_interrupts_wait_mode_e {
+    /** The interrupts thread blocks in the driver until an interrupt arrives */
+    HAILO_INTERRUPTS_WAIT_MODE_BLOCKING = 0,
+    /**
+     * The interrupts thread busy-polls the driver for pending interrupts, trading a CPU core for lower completion
+     * latency. After @a interrupts_polling_idle_budget_us without any interrupt, the thread blocks until the next
+     * interrupt and then resumes polling. Falls back to ::HAILO_INTERRUPTS_WAIT_MODE_BLOCKING if the driver doesn't
+     * support polling.
+     */
+    HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING,
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_INTERRUPTS_WAIT_MODE_MAX_ENUM = HAILO_MAX_ENUM
+} hailo_interrupts_wait_mode_t;
+
 /** Virtual device parameters */
 typedef struct {
     /**
@@ -410,6 +483,81 @@ typedef struct {
     const char *group_id;
     /** Flag specifies whether to create the VDevice in HailoRT service or not. Defaults to false */
     bool multi_process_service;
+    /** The method used to wait for vDMA interrupts. Defaults to ::HAILO_INTERRUPTS_WAIT_MODE_BLOCKING */
+    hailo_interrupts_wait_mode_t interrupts_wait_mode;
+    /**
+     * Used only with ::HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING - time (in microseconds) the interrupts thread
+     * keeps polling without any interrupt before blocking. Defaults to ::HAILO_DEFAULT_INTERRUPTS_POLLING_IDLE_BUDGET_US
+     */
+    uint32_t interrupts_polling_idle_budget_us;
+    /**
+     * Maximum amount of bytes of user buffers and dmabufs (that weren't mapped using dma_map/dma_map_dmabuf) whose
+     * mappings are kept alive after their transfers are done, so buffers that are reused won't be mapped again on each
+     * transfer. When the budget is exceeded, the least recently used mapping is unmapped. Defaults to 0 (cache
+     * disabled).
+     * @note A cached buffer stays mapped after its transfer is done, hence it must not be freed while the VDevice is
+     *       alive.
+     */
+    uint64_t user_buffers_mapping_cache_size;
+    /**
+     * Amount of threads (per device) launching transfers that couldn't be launched on the user's thread (e.g. when the
+     * stream's descriptors list is full). The streams are distributed between the threads.
+     * Defaults to ::HAILO_DEFAULT_TRANSFER_LAUNCHER_WORKERS_COUNT
+     */
+    uint32_t transfer_launcher_workers_count;
+    /**
+     * Bitmask of the CPUs the transfer launcher threads are pinned to - thread i is pinned to the i-th CPU set in the
+     * mask. Defaults to 0 (the threads are not pinned).
+     */
+    uint64_t transfer_launcher_cpu_affinity_mask;
+    /**
+     * NUMA node on which the DMA buffers and the threads serving the devices (interrupts, transfer launcher and
+     * scheduler threads) are placed. ::HAILO_NUMA_NODE_AUTO uses the node each device is attached to,
+     * ::HAILO_NUMA_NODE_NONE disables the placement, any other value places all devices on the given node.
+     * Defaults to ::HAILO_NUMA_NODE_AUTO
+     * @note Supported only on Linux.
+     */
+    int32_t numa_node;
+    /**
+     * Bitmask of the CPUs the scheduler thread may run on. Defaults to 0 (the thread is placed by @a numa_node).
+     */
+    uint64_t scheduler_cpu_affinity_mask;
+    /**
+     * Bitmask of the CPUs the interrupts threads (one per device) may run on. Defaults to 0 (the threads are placed
+     * by @a numa_node).
+     */
+    uint64_t interrupts_cpu_affinity_mask;
+    /**
+     * If not 0, the scheduler, interrupts and transfer launcher threads run with a real-time (FIFO) scheduling
+     * policy at the given priority (up to ::HAILO_MAX_THREADS_REALTIME_PRIORITY), so frames are not delayed by other threads preempting them.
+     * Defaults to 0 (the threads use the default scheduling policy).
+     * @note On Linux, requires the CAP_SYS_NICE capability (or a suitable RLIMIT_RTPRIO). If the priority can't be
+     *       set, a warning is printed and the threads keep the default policy.
+     */
+    uint32_t threads_realtime_priority;
+    /**
+     * If true, the network groups configured on the VDevice are placed on consecutive devices (each network group is
+     * pinned to a single device, the next network group to the next device, and so on), so a model split into chained
+     * network groups (e.g. a model too large for a single context) runs as a pipeline across the devices - each device
+     * inferring another frame, instead of switching between the network groups on a single device.
+     * The intermediate tensors pass through the host - the outputs of a network group are sent by the application to
+     * the inputs of the next one.
+     * Defaults to false.
+     * @note Supported only when the scheduler is enabled.
+     * @note The placement overrides the scheduler device affinity and sticky placement of the network groups, and may
+     *       be changed afterwards using hailo_set_scheduler_device_affinity().
+     */
+    bool multi_device_pipelining;
+    /**
+     * If true, physical devices may be added to (and removed from) the VDevice while it is running, using
+     * hailo_vdevice_add_device() and hailo_vdevice_remove_device(). The HEFs of the configured network groups are kept
+     * (sharing the parsed HEF of the user's ::hailo_hef), so the network groups can be configured on added devices.
+     * Defaults to false.
+     * @note Supported only when the scheduler is enabled, and not together with @a multi_device_pipelining.
+     * @note An HEF created from a memory buffer (e.g. using hailo_create_hef_buffer()) must stay valid for as long as
+     *       devices may be added.
+     */
+    bool allow_devices_hot_plug;
 } hailo_vdevice_params_t;
 
 /** Device architecture */
@@ -551,6 +699,12 @@ typedef enum {
     /** Data format type float32_t - used only on host side (Translated in the quantization process) */
     HAILO_FORMAT_TYPE_FLOAT32               = 3,
 
+    /**
+     * Data format type float16 (IEEE 754 half precision, stored as uint16_t) - used only on host side, for de-quantized
+     * outputs (Translated in the de-quantization process). See Quantization::float16_to_float32.
+     */
+    HAILO_FORMAT_TYPE_FLOAT16               = 4,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_TYPE_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_format_type_t;
@@ -738,6 +892,25 @@ typedef enum {
      */
     HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK         = 20,
 
+    /**
+     * NMS_BY_SCORE format - the detections of all of the classes, sorted by their scores (from the highest).
+     *
+     * - Host side
+     *      \code
+     *      struct (packed) {
+     *          uint16_t detections_count;
+     *          hailo_detection_t[detections_count];
+     *      };
+     *      \endcode
+     *
+     *      At most ::hailo_nms_shape_t.max_bboxes_total detections are returned, so the frame is much smaller than
+     *      the ::HAILO_FORMAT_ORDER_HAILO_NMS frame of models with many classes.
+     *      The host format type supported ::HAILO_FORMAT_TYPE_FLOAT32.
+     *
+     * - Not used for device side
+     */
+    HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE               = 21,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_ORDER_MAX_ENUM             = HAILO_MAX_ENUM
 } hailo_format_order_t;
@@ -841,6 +1014,7 @@ typedef enum {
     HAILO_BUFFER_FLAGS_NONE         = 0,            /*!< No flags - heap allocated buffer */
     HAILO_BUFFER_FLAGS_DMA          = 1 << 0,       /*!< Buffer is mapped to DMA (will be page aligned implicitly) */
     HAILO_BUFFER_FLAGS_CONTINUOUS   = 1 << 1,       /*!< Buffer is physically continuous (will be page aligned implicitly) */
+    HAILO_BUFFER_FLAGS_HUGE_PAGES   = 1 << 2,       /*!< Used with ::HAILO_BUFFER_FLAGS_DMA - buffer is backed by huge pages if available (the allocation is rounded up to the huge page size) */
 
     /** Max enum value to maintain ABI Integrity */
     HAILO_BUFFER_FLAGS_MAX_ENUM     = HAILO_MAX_ENUM
@@ -907,6 +1081,9 @@ typedef struct {
      * - On Windows user-mode rate limiting (via a token-bucket) is used:
      *   - User-mode rate limiting is designed to consistently keep the stream at the desired rate, however fluctuations will occur.
      *     This member parameter provides an upper bound on the bandwidth at which the stream will operate.
+     * - If the environment variable HAILO_ETH_ADAPTIVE_RATE_CONTROL is set, user-mode rate limiting is used on all
+     *   platforms, and the rate is adapted by the data lost on the device's output streams (timeouts, missing sync
+     *   packets): it's decreased on losses, and increased back up to this member's rate while frames are read cleanly.
      */
     uint32_t rate_limit_bytes_per_sec;
 
@@ -1138,6 +1315,18 @@ typedef enum {
    HAILO_STREAM_INTERFACE_MAX_ENUM = HAILO_MAX_ENUM
 } hailo_stream_interface_t;
 
+/**
+ * vDMA interrupts coalescing parameters. Instead of raising an interrupt on each transfer completion, an interrupt is
+ * raised after @a max_transfers transfers, or @a timeout_us after a transfer without interrupt was launched - whichever
+ * comes first.
+ */
+typedef struct {
+    /** Maximum number of transfers completed per interrupt. 0 or 1 disable coalescing (interrupt on each transfer) */
+    uint32_t max_transfers;
+    /** Maximum time in microseconds a completed transfer waits for an interrupt. Must not be 0 if coalescing is enabled */
+    uint32_t timeout_us;
+} hailo_stream_interrupts_coalescing_params_t;
+
 /** Hailo stream parameters */
 typedef struct {
     hailo_stream_interface_t stream_interface;
@@ -1152,6 +1341,11 @@ typedef struct {
         hailo_integrated_output_stream_params_t integrated_output_params;
         hailo_eth_output_stream_params_t eth_output_params;
     };
+    /**
+     * Interrupts coalescing of the stream's vDMA channel. Relevant only for ::HAILO_STREAM_INTERFACE_PCIE and
+     * ::HAILO_STREAM_INTERFACE_INTEGRATED. Defaults to disabled.
+     */
+    hailo_stream_interrupts_coalescing_params_t interrupts_coalescing;
 } hailo_stream_parameters_t;
 
 /** Hailo stream parameters per stream_name */
@@ -1232,6 +1426,9 @@ typedef struct {
         void *user_ptr;
         int fd;
     };
+    /** The offset of the plane in its dma buffer (::HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF only), so the planes of a frame
+     *  may share a single dma buffer. Ignored for ::HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR. */
+    uint32_t offset;
 } hailo_pix_buffer_plane_t;
 
 /** image buffer */
@@ -1299,6 +1496,11 @@ typedef struct {
      *  The default value is (`input_image_size` * 2)
      */
     uint32_t max_accumulated_mask_size;
+    /** Maximum amount of bboxes of all of the classes together.
+     *  Used only with 'HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE' format order.
+     *  0 means (`number_of_classes` * `max_bboxes_per_class`)
+     */
+    uint32_t max_bboxes_total;
 } hailo_nms_shape_t;
 
 #pragma pack(push, 1)
@@ -1351,6 +1553,18 @@ typedef struct {
     */
     uint8_t *mask;
 } hailo_detection_with_byte_mask_t;
+
+/** A detection of the ::HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE format */
+typedef struct {
+    /** Detection's box coordinates */
+    hailo_rectangle_t box;
+
+    /** Detection's score */
+    float32_t score;
+
+    /** Detection's class id */
+    uint16_t class_id;
+} hailo_detection_t;
 #pragma pack(pop)
 
 /**
@@ -1409,6 +1623,34 @@ typedef struct {
  */
 typedef void (*hailo_stream_read_async_callback_t)(const hailo_stream_read_async_completion_info_t *info);
 
+/**
+ * Completion info struct passed to the ::hailo_infer_async_callback_t after the asynchronous inference is done or has
+ * failed.
+ */
+typedef struct {
+    /**
+     * Status of the asynchronous inference:
+     *  - ::HAILO_SUCCESS - The inference is complete.
+     *  - Any other ::hailo_status on unexpected errors.
+     */
+    hailo_status status;
+
+    /**
+     * Index of the inference, in the order the inferences of the ::hailo_configured_infer_model were launched
+     * (starting from 0). Each frame of a multiple-bindings inference is counted, and the sequence number of the whole
+     * request is the sequence number of its first frame.
+     */
+    uint64_t sequence_number;
+
+    /** User specific data. Can be used as a context for the callback. */
+    void *opaque;
+} hailo_infer_async_completion_info_t;
+
+/**
+ * Asynchronous inference complete callback prototype.
+ */
+typedef void (*hailo_infer_async_callback_t)(const hailo_infer_async_completion_info_t *info);
+
 /**
  * Input or output stream information. In case of multiple inputs or outputs, each one has
  * its own stream.
@@ -1741,6 +1983,18 @@ typedef struct {
     uint16_t sample_count;
 } hailo_chip_temperature_info_t;
 
+/** A sample of the device's telemetry, taken by the telemetry sampling (see Device::start_telemetry) */
+typedef struct {
+    /** The time the sample was taken, in milliseconds since the epoch */
+    uint64_t timestamp_ms;
+    /** The average power consumption of the chip since the previous sample, in Watts */
+    float32_t power_watts;
+    /** Temperature in Celsius of the first internal temperature sensor (TS) */
+    float32_t ts0_temperature;
+    /** Temperature in Celsius of the second internal temperature sensor (TS) */
+    float32_t ts1_temperature;
+} hailo_telemetry_sample_t;
+
 typedef struct {
     float32_t temperature_threshold;
     float32_t hysteresis_temperature_threshold;
@@ -1774,6 +2028,17 @@ typedef struct {
     hailo_stream_raw_buffer_t raw_buffer;
 } hailo_stream_raw_buffer_by_name_t;
 
+/** The buffers of a single frame of an asynchronous inference, of all the inputs and outputs of the model */
+typedef struct {
+    /** The input buffers, by the names of the inputs */
+    const hailo_stream_raw_buffer_by_name_t *inputs;
+    size_t inputs_count;
+
+    /** The output buffers, by the names of the outputs */
+    const hailo_stream_raw_buffer_by_name_t *outputs;
+    size_t outputs_count;
+} hailo_infer_bindings_t;
+
 typedef struct {
     float64_t avg_hw_latency_ms;
 } hailo_latency_measurement_result_t;
@@ -2391,6 +2656,36 @@ HAILORTAPI hailo_status hailo_get_physical_devices(hailo_vdevice vdevice, hailo_
 HAILORTAPI hailo_status hailo_vdevice_get_physical_devices_ids(hailo_vdevice vdevice, hailo_device_id_t *devices_ids,
     size_t *number_of_devices);
 
+/**
+ * Adds the physical device @a device_id to a running vdevice. The network groups configured on the vdevice are
+ * configured on the added device, and the scheduler starts sending frames to it once they are.
+ *
+ * @param[in] vdevice       A ::hailo_vdevice object to add the device to.
+ * @param[in] device_id     The id of the device to add.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Supported only if the vdevice was created with hailo_vdevice_params_t::allow_devices_hot_plug set.
+ * @note The added device takes the lowest device index that isn't used by another device of the vdevice (see
+ *       hailo_set_scheduler_device_affinity()). Buffers mapped using hailo_vdevice_dma_map() before the device was
+ *       added are mapped on it on each transfer.
+ */
+HAILORTAPI hailo_status hailo_vdevice_add_device(hailo_vdevice vdevice, const hailo_device_id_t *device_id);
+
+/**
+ * Removes the physical device @a device_id from a running vdevice. The scheduler stops sending frames to the device,
+ * and waits up to @a timeout_ms for the frames in flight on it to be done before releasing it. Frames that are still in
+ * flight after the timeout are aborted (completed with ::HAILO_STREAM_ABORT). The frames queued on the vdevice are
+ * sent to the other devices.
+ *
+ * @param[in] vdevice       A ::hailo_vdevice object to remove the device from.
+ * @param[in] device_id     The id of the device to remove.
+ * @param[in] timeout_ms    The time to wait for the frames in flight on the device, in milliseconds.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Supported only if the vdevice was created with hailo_vdevice_params_t::allow_devices_hot_plug set.
+ * @note The last device of the vdevice can't be removed.
+ */
+HAILORTAPI hailo_status hailo_vdevice_remove_device(hailo_vdevice vdevice, const hailo_device_id_t *device_id,
+    uint32_t timeout_ms);
+
 /**
  * Release an open vdevice.
  * 
@@ -2924,7 +3219,8 @@ HAILORTAPI hailo_status hailo_get_latency_measurement(hailo_configured_network_g
  * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
  * @note The new time period will be measured after the previous time the scheduler allocated run time to this network group.
  * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
- * @note The default timeout is 0ms.
+ * @note The default timeout is 0ms. If neither a timeout nor a threshold are set, HailoRT chooses the timeout based on
+ *       the measured time of switching to the network group (see hailo_set_scheduler_threshold()).
  * @note Currently, setting the timeout for a specific network is not supported.
  * @note The timeout may be ignored to prevent idle time from the device.
  */
@@ -2943,6 +3239,9 @@ HAILORTAPI hailo_status hailo_set_scheduler_timeout(hailo_configured_network_gro
  * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
  * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
  * @note The default threshold is 0, which means HailoRT will apply an automatic heuristic to choose the threshold.
+ *       The heuristic measures the time of switching to the network group and the device time per frame, and chooses
+ *       the amount of frames for which the switch is amortized (bounded by the batch size and by the deadline, if set).
+ *       The heuristic can be disabled by setting the environment variable HAILO_DISABLE_SCHEDULER_COST_MODEL=1.
  * @note Currently, setting the threshold for a specific network is not supported.
  * @note The threshold may be ignored to prevent idle time from the device.
  */
@@ -2966,6 +3265,170 @@ HAILORTAPI hailo_status hailo_set_scheduler_threshold(hailo_configured_network_g
 HAILORTAPI hailo_status hailo_set_scheduler_priority(hailo_configured_network_group configured_network_group,
     uint8_t priority, const char *network_name);
 
+/**
+ * Sets the latency deadline of the network - the maximum time a request should wait from the time it is sent until the
+ * scheduler runs it.
+ * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE, the scheduler chooses the network whose oldest
+ * pending request is closest to missing its deadline.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler deadline.
+ * @param[in]  deadline_ms                  Deadline in milliseconds. 0 means the network has no deadline.
+ * @param[in]  network_name                 Network name for which to set the deadline.
+ *                                          If NULL is passed, the deadline will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE.
+ * @note A network with a deadline is considered ready once it has a pending request (the threshold and timeout are
+ *       not checked).
+ * @note The default deadline is 0ms.
+ * @note Currently, setting the deadline for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_deadline(hailo_configured_network_group configured_network_group,
+    uint32_t deadline_ms, const char *network_name);
+
+/**
+ * Sets the share of the network in the device time.
+ * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE, ready networks with the same priority get
+ * device time in proportion to their shares (e.g. a network with share 2 gets twice the device time of a network with
+ * share 1, as long as both have pending requests).
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler share.
+ * @param[in]  share                        Share of the network. Must be larger than 0.
+ * @param[in]  network_name                 Network name for which to set the share.
+ *                                          If NULL is passed, the share will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE.
+ * @note The default share is HAILO_SCHEDULER_SHARE_DEFAULT.
+ * @note Higher priority networks are still chosen before lower priority networks (see hailo_set_scheduler_priority()).
+ * @note Currently, setting the share for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_share(hailo_configured_network_group configured_network_group,
+    uint32_t share, const char *network_name);
+
+/**
+ * Sets the devices on which the scheduler may run the network.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler device affinity.
+ * @param[in]  device_mask                  Bit i of the mask refers to the i-th device of the vdevice (in the order
+ *                                          of hailo_get_physical_devices_ids()). Must contain at least one device of
+ *                                          the vdevice.
+ * @param[in]  network_name                 Network name for which to set the device affinity.
+ *                                          If NULL is passed, the device affinity will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note The default device mask is HAILO_SCHEDULER_ALL_DEVICES_MASK.
+ * @note Currently, setting the device affinity for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_device_affinity(hailo_configured_network_group configured_network_group,
+    uint64_t device_mask, const char *network_name);
+
+/**
+ * Sets the sticky placement policy of the network. A sticky network that is loaded on one of the devices is not loaded
+ * on another device, unless that device has nothing else to run. This avoids reconfiguring devices when more networks
+ * than devices share a vdevice.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the sticky placement policy.
+ * @param[in]  is_sticky                    Whether the network is sticky.
+ * @param[in]  network_name                 Network name for which to set the policy.
+ *                                          If NULL is passed, the policy will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note By default networks are not sticky.
+ * @note Currently, setting the policy for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_sticky_placement(hailo_configured_network_group configured_network_group,
+    bool is_sticky, const char *network_name);
+
+/**
+ * Pins the network to a device of the vdevice - the device runs only the network, which streams to it without the
+ * scheduling decisions between bursts (as if the device was dedicated to it), while the other networks are scheduled
+ * on the other devices of the vdevice.
+ *
+ * @param[in]  configured_network_group     NetworkGroup to pin.
+ * @param[in]  device_index                 Index of the device in the vdevice (in the order of
+ *                                          hailo_get_physical_devices_ids()), or HAILO_SCHEDULER_NO_PINNED_DEVICE to
+ *                                          unpin the network.
+ * @param[in]  network_name                 Network name to pin.
+ *                                          If NULL is passed, all the networks in the network group are pinned.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error (::HAILO_INVALID_OPERATION
+ *         if the device is pinned to another network).
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note A pinned network runs only on its device, regardless of its device affinity.
+ * @note Currently, pinning a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_pinned_device(hailo_configured_network_group configured_network_group,
+    uint32_t device_index, const char *network_name);
+
+/**
+ * Sets the bounds of the scheduler burst size of the network - the amount of frames the network keeps streaming to a
+ * device before the scheduler considers switching to another network. Within the bounds, the burst size adapts to the
+ * observed queue depth and frames inter-arrival time of the network.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler burst size bounds.
+ * @param[in]  min_burst_size               Minimum burst size (frames).
+ * @param[in]  max_burst_size               Maximum burst size (frames). Must be equal or greater than @a min_burst_size.
+ * @param[in]  network_name                 Network name for which to set the burst size bounds.
+ *                                          If NULL is passed, the bounds will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note Passing HAILO_SCHEDULER_BURST_SIZE_DEFAULT as both bounds restores the default (fixed) burst size.
+ * @note The burst size of a network configured with a batch size greater than 1 on a multi-context HEF is its batch
+ *       size, so setting its bounds isn't supported.
+ * @note Currently, setting the burst size bounds for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_burst_size_bounds(hailo_configured_network_group configured_network_group,
+    uint32_t min_burst_size, uint32_t max_burst_size, const char *network_name);
+
+/**
+ * Sets the batch size the scheduler runs the network with, without re-configuring it. The resources of the network
+ * are allocated for the batch size it was configured with, so any batch size up to it may be set.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler batch size.
+ * @param[in]  batch_size                   Batch size - between 1 and the batch size the network group was configured with.
+ * @param[in]  network_name                 Network name for which to set the batch size.
+ *                                          If NULL is passed, the batch size will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note Supported only for networks configured with a batch size greater than 1 on a multi-context HEF.
+ * @note The new batch size applies from the next time the scheduler switches to the network.
+ * @note Currently, setting the batch size for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_batch_size(hailo_configured_network_group configured_network_group,
+    uint16_t batch_size, const char *network_name);
+
+/**
+ * Sets the scheduler overload policy of the network - what the scheduler does with a new frame when the network
+ * already has @a max_pending_frames frames waiting to be sent to a device. For live streams, shedding stale frames
+ * bounds the end-to-end latency when the devices fall behind.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to set the scheduler overload policy.
+ * @param[in]  policy                       The overload policy.
+ * @param[in]  max_pending_frames           Frames that may wait to be sent to a device before the policy applies.
+ *                                          Ignored for ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE, otherwise must be
+ *                                          greater than 0.
+ * @param[in]  network_name                 Network name for which to set the overload policy.
+ *                                          If NULL is passed, the policy will be set for all the networks in the network group.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note The default policy is ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE.
+ * @note Currently, setting the overload policy for a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_set_scheduler_overload_policy(hailo_configured_network_group configured_network_group,
+    hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames, const char *network_name);
+
+/**
+ * Gets the amount of frames shed by the scheduler overload policy of the network.
+ *
+ * @param[in]  configured_network_group     NetworkGroup for which to get the stats.
+ * @param[out] stats                        The frames shed so far.
+ * @param[in]  network_name                 Network name for which to get the stats.
+ *                                          If NULL is passed, the stats of all the networks in the network group are returned.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+ * @note Currently, getting the stats of a specific network is not supported.
+ */
+HAILORTAPI hailo_status hailo_get_scheduler_overload_stats(hailo_configured_network_group configured_network_group,
+    hailo_scheduler_overload_stats_t *stats, const char *network_name);
+
 /** @} */ // end of group_network_group_functions
 
 /** @defgroup group_buffer_functions Buffer functions
@@ -3286,6 +3749,32 @@ HAILORTAPI hailo_status hailo_stream_wait_for_async_output_ready(hailo_output_st
 HAILORTAPI hailo_status hailo_stream_wait_for_async_input_ready(hailo_input_stream stream, size_t transfer_size,
     uint32_t timeout_ms);
 
+/**
+ * Gets a handle that is signaled while the stream is ready to launch a new ::hailo_stream_read_raw_buffer_async
+ * operation (i.e. while ::hailo_stream_wait_for_async_output_ready wouldn't block). On Linux, the handle is an eventfd
+ * that is readable (POLLIN) while the stream is ready, so it can be polled (e.g. with epoll) with other fds.
+ *
+ * @param[in]  stream           A ::hailo_output_stream object.
+ * @param[out] handle           The handle. It is owned by the stream, and must only be waited on.
+ *
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_stream_get_async_output_ready_handle(hailo_output_stream stream,
+    underlying_handle_t *handle);
+
+/**
+ * Gets a handle that is signaled while the stream is ready to launch a new ::hailo_stream_write_raw_buffer_async
+ * operation (i.e. while ::hailo_stream_wait_for_async_input_ready wouldn't block). On Linux, the handle is an eventfd
+ * that is readable (POLLIN) while the stream is ready, so it can be polled (e.g. with epoll) with other fds.
+ *
+ * @param[in]  stream           A ::hailo_input_stream object.
+ * @param[out] handle           The handle. It is owned by the stream, and must only be waited on.
+ *
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_stream_get_async_input_ready_handle(hailo_input_stream stream,
+    underlying_handle_t *handle);
+
 /**
  * Returns the maximum amount of frames that can be simultaneously read from the stream (by
  * ::hailo_stream_read_raw_buffer_async calls) before any one of the read operations is complete, as signified by
@@ -4006,6 +4495,211 @@ HAILORTAPI hailo_status hailo_infer(hailo_configured_network_group configured_ne
 
 /** @} */ // end of group_vstream_functions
 
+/** @defgroup group_infer_model_functions Infer model functions
+ *  @{
+ */
+
+/**
+ * Creates an infer model from an HEF file, to be configured on @a vdevice.
+ *
+ * @param[in]  vdevice              A ::hailo_vdevice object. Must outlive the infer model.
+ * @param[in]  hef_path             A path of an HEF file.
+ * @param[in]  network_name         The name of the network (or network group) to infer. If NULL is passed, the only
+ *                                  network group in the HEF is addressed.
+ * @param[out] infer_model          A pointer to a ::hailo_infer_model that receives the infer model.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note The infer model must be released with ::hailo_release_infer_model.
+ */
+HAILORTAPI hailo_status hailo_create_infer_model(hailo_vdevice vdevice, const char *hef_path, const char *network_name,
+    hailo_infer_model *infer_model);
+
+/**
+ * Creates an infer model from an HEF buffer, to be configured on @a vdevice.
+ *
+ * @param[in]  vdevice              A ::hailo_vdevice object. Must outlive the infer model.
+ * @param[in]  hef_buffer           A pointer to a buffer containing the HEF file.
+ * @param[in]  hef_buffer_size      The size of @a hef_buffer.
+ * @param[in]  network_name         The name of the network (or network group) to infer. If NULL is passed, the only
+ *                                  network group in the HEF is addressed.
+ * @param[out] infer_model          A pointer to a ::hailo_infer_model that receives the infer model.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note The HEF buffer must be maintained until the infer model is configured.
+ */
+HAILORTAPI hailo_status hailo_create_infer_model_from_buffer(hailo_vdevice vdevice, const void *hef_buffer,
+    size_t hef_buffer_size, const char *network_name, hailo_infer_model *infer_model);
+
+/**
+ * Releases an infer model created by ::hailo_create_infer_model or ::hailo_create_infer_model_from_buffer.
+ * The models configured from it are not affected.
+ *
+ * @param[in] infer_model           A ::hailo_infer_model object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_release_infer_model(hailo_infer_model infer_model);
+
+/**
+ * Gets the names of the inputs of the infer model.
+ *
+ * @param[in]    infer_model        A ::hailo_infer_model object.
+ * @param[out]   names              A pointer to an array of string pointers that receives the names. The strings are
+ *                                  owned by the infer model, and are valid until it is released.
+ * @param[inout] names_count        As input - the maximum amount of entries in @a names.
+ *                                  As output - the actual amount of entries written if the function returns with
+ *                                  ::HAILO_SUCCESS or the amount of entries needed if the function returns
+ *                                  ::HAILO_INSUFFICIENT_BUFFER.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, if the array is insufficient to hold the names, returns
+ *  ::HAILO_INSUFFICIENT_BUFFER. In any other case, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_input_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count);
+
+/**
+ * Gets the names of the outputs of the infer model.
+ *
+ * @param[in]    infer_model        A ::hailo_infer_model object.
+ * @param[out]   names              A pointer to an array of string pointers that receives the names. The strings are
+ *                                  owned by the infer model, and are valid until it is released.
+ * @param[inout] names_count        As input - the maximum amount of entries in @a names.
+ *                                  As output - the actual amount of entries written if the function returns with
+ *                                  ::HAILO_SUCCESS or the amount of entries needed if the function returns
+ *                                  ::HAILO_INSUFFICIENT_BUFFER.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, if the array is insufficient to hold the names, returns
+ *  ::HAILO_INSUFFICIENT_BUFFER. In any other case, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_output_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count);
+
+/**
+ * Gets the size of a frame of an input or an output of the infer model (in its current format).
+ *
+ * @param[in]  infer_model          A ::hailo_infer_model object.
+ * @param[in]  name                 The name of the input or the output.
+ * @param[out] frame_size           The size of a frame, in bytes.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size);
+
+/**
+ * Sets the format type of an input or an output of the infer model (e.g. ::HAILO_FORMAT_TYPE_FLOAT32 for the
+ * de-quantized outputs).
+ *
+ * @param[in] infer_model           A ::hailo_infer_model object.
+ * @param[in] name                  The name of the input or the output.
+ * @param[in] format_type           The format type.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before the infer model is configured.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_format_type(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t format_type);
+
+/**
+ * Sets the batch size of the infer model.
+ *
+ * @param[in] infer_model           A ::hailo_infer_model object.
+ * @param[in] batch_size            The batch size (::HAILO_DEFAULT_BATCH_SIZE for the default one).
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before the infer model is configured.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_batch_size(hailo_infer_model infer_model, uint16_t batch_size);
+
+/**
+ * Configures the infer model on its vdevice.
+ *
+ * @param[in]  infer_model              A ::hailo_infer_model object.
+ * @param[out] configured_infer_model   A pointer to a ::hailo_configured_infer_model that receives the configured
+ *                                      infer model.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note The configured infer model must be released with ::hailo_release_configured_infer_model.
+ */
+HAILORTAPI hailo_status hailo_configure_infer_model(hailo_infer_model infer_model,
+    hailo_configured_infer_model *configured_infer_model);
+
+/**
+ * Releases a configured infer model. Inferences still in flight are aborted - to have them completed, wait for their
+ * callbacks before releasing.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_release_configured_infer_model(hailo_configured_infer_model configured_infer_model);
+
+/**
+ * Waits until the configured infer model is ready to launch a new asynchronous inference of @a frames_count frames.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[in] timeout_ms                Amount of time to wait until the model is ready, in milliseconds.
+ * @param[in] frames_count              The amount of frames (bindings) of the next inference.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, if @a timeout_ms has passed and the model is not ready,
+ *  returns ::HAILO_TIMEOUT. In any other case, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_wait_for_async_ready(
+    hailo_configured_infer_model configured_infer_model, uint32_t timeout_ms, uint32_t frames_count);
+
+/**
+ * Gets a handle that is signaled while the configured infer model is ready to launch a new asynchronous inference of
+ * a single frame (i.e. while ::hailo_configured_infer_model_wait_for_async_ready wouldn't block). On Linux, the handle
+ * is an eventfd that is readable (POLLIN) while the model is ready, so it can be polled (e.g. with epoll) with other
+ * fds.
+ *
+ * @param[in]  configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[out] handle                    The handle. It is owned by the model, and must only be waited on.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_get_async_ready_handle(
+    hailo_configured_infer_model configured_infer_model, underlying_handle_t *handle);
+
+/**
+ * Launches an asynchronous inference of one or more frames, each with its own bindings.
+ * The completion of all of the frames is notified through a single call of @a callback.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[in] bindings                  An array of the bindings of the frames.
+ * @param[in] bindings_count            The amount of entries in @a bindings.
+ * @param[in] callback                  The function to be called upon completion of the inference.
+ * @param[in] opaque                    User specific data, passed to @a callback.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error (and @a callback is not
+ *  called).
+ * @note The buffers must be kept intact until the inference is completed. For best performance, they should be
+ *  mapped to the vdevice (see ::hailo_vdevice_dma_map_buffer).
+ * @note @a callback should execute as quickly as possible.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_run_async(hailo_configured_infer_model configured_infer_model,
+    const hailo_infer_bindings_t *bindings, size_t bindings_count, hailo_infer_async_callback_t callback, void *opaque);
+
+/**
+ * Registers a ring of bindings, launched later by their index with ::hailo_configured_infer_model_run_async_registered.
+ * The buffers are looked up by name and validated once, here, so launching registered bindings doesn't cost either.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[in] bindings                  An array of the bindings to register. Replaces the bindings registered before.
+ * @param[in] bindings_count            The amount of entries in @a bindings.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must not be called while registered bindings are in flight.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_register_bindings(
+    hailo_configured_infer_model configured_infer_model, const hailo_infer_bindings_t *bindings,
+    size_t bindings_count);
+
+/**
+ * Launches an asynchronous inference of a single frame, with bindings registered by
+ * ::hailo_configured_infer_model_register_bindings.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[in] bindings_index            The index of the bindings, in the array they were registered with.
+ * @param[in] callback                  The function to be called upon completion of the inference.
+ * @param[in] opaque                    User specific data, passed to @a callback.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error (and @a callback is not
+ *  called).
+ * @note The buffers must be kept intact until the inference is completed.
+ * @note @a callback should execute as quickly as possible.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_run_async_registered(
+    hailo_configured_infer_model configured_infer_model, size_t bindings_index, hailo_infer_async_callback_t callback,
+    void *opaque);
+
+/** @} */ // end of group_infer_model_functions
+
 /** @defgroup multi_network_functions multi network functions
  *  @{
  */
@@ -31,5 +31,12 @@
 #include "hailo/quantization.hpp"
 #include "hailo/hailort_defaults.hpp"
 #include "hailo/dma_mapped_buffer.hpp"
+#include "hailo/post_process_op.hpp"
+#include "hailo/custom_post_process_op.hpp"
+#include "hailo/infer_cascade.hpp"
+#include "hailo/infer_completion_queue.hpp"
+#include "hailo/infer_model_coroutine.hpp"
+#include "hailo/infer_model_broker.hpp"
+#include "hailo/dma_buffer_pool.hpp"
 
 #endif /* _HAILORT_HPP_ */
@@ -36,6 +36,7 @@ public:
         "Mismatch bbox params size");
     static const uint32_t BBOX_PARAMS = sizeof(hailo_bbox_t) / sizeof(uint16_t);
     static const uint32_t DETECTION_WITH_BYTE_MASK_SIZE = sizeof(hailo_detection_with_byte_mask_t);
+    static const uint32_t DETECTION_SIZE = sizeof(hailo_detection_t);
     static const uint32_t MAX_DEFUSED_LAYER_COUNT = 9;
     static const size_t HW_DATA_ALIGNMENT = 8;
     static const uint32_t MUX_INFO_COUNT = 32;
@@ -120,7 +121,7 @@ public:
     {
         if (type == HAILO_FORMAT_TYPE_FLOAT32) {
             return 4;
-        } else if (type == HAILO_FORMAT_TYPE_UINT16) {
+        } else if ((type == HAILO_FORMAT_TYPE_UINT16) || (type == HAILO_FORMAT_TYPE_FLOAT16)) {
             return 2;
         } else if (type == HAILO_FORMAT_TYPE_UINT8) {
             return 1;
@@ -164,6 +165,8 @@ public:
             return "UINT16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "FLOAT32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "FLOAT16";
         case HAILO_FORMAT_TYPE_AUTO:
             return "AUTO";
         default:
@@ -250,6 +253,8 @@ public:
             return "YYYYUV";
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
             return "HAILO NMS WITH BYTE MASK";
+        case HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE:
+            return "HAILO NMS BY SCORE";
         default:
             return "Nan";
         }
@@ -302,6 +307,30 @@ public:
         return frame_size;
     }
 
+    /**
+     * Gets the maximum amount of detections of a `HAILO_NMS_BY_SCORE` frame by nms_shape.
+     *
+     * @param[in] nms_shape             The NMS shape to get the amount from.
+     * @return The maximum amount of detections in a HAILO_NMS_BY_SCORE frame.
+     */
+    static constexpr uint32_t get_nms_by_score_max_detections(const hailo_nms_shape_t &nms_shape)
+    {
+        return ((0 == nms_shape.max_bboxes_total) ||
+                (nms_shape.max_bboxes_total > (nms_shape.number_of_classes * nms_shape.max_bboxes_per_class))) ?
+            (nms_shape.number_of_classes * nms_shape.max_bboxes_per_class) : nms_shape.max_bboxes_total;
+    }
+
+    /**
+     * Gets `HAILO_NMS_BY_SCORE` host frame size in bytes by nms_shape.
+     *
+     * @param[in] nms_shape             The NMS shape to get size from.
+     * @return The HAILO_NMS_BY_SCORE host frame size.
+     */
+    static constexpr uint32_t get_nms_by_score_host_frame_size(const hailo_nms_shape_t &nms_shape)
+    {
+        return static_cast<uint32_t>(sizeof(uint16_t)) + (get_nms_by_score_max_detections(nms_shape) * DETECTION_SIZE);
+    }
+
     /**
      * Gets NMS hw frame size in bytes by nms info.
      *
@@ -411,7 +440,8 @@ public:
 
     static constexpr bool is_nms(const hailo_format_order_t &order)
     {
-        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order));
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == order));
     }
 
     // TODO HRT-10073: change to supported features list
@@ -425,6 +455,8 @@ public:
     static Expected<hailo_device_id_t> to_device_id(const std::string &device_id);
     static Expected<std::vector<hailo_device_id_t>> to_device_ids_vector(const std::vector<std::string> &device_ids_str);
     static Expected<hailo_pix_buffer_t> as_hailo_pix_buffer(MemoryView memory_view, hailo_format_order_t order);
+    // The planes of a dma buffer holding a whole frame - the planes are dmabuf planes at their offsets in the buffer
+    static Expected<hailo_pix_buffer_t> as_hailo_pix_buffer(hailo_dma_buffer_t dma_buffer, hailo_format_order_t order);
 
     static bool is_power_measurement_supported(const hailo_device_architecture_t &hw_arch);
     static bool is_current_measurement_supported(const hailo_device_architecture_t &hw_arch);
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_cascade.hpp
+ * @brief Runs a detector -> crop -> classifier cascade of two models.
+ **/
+
+#ifndef _HAILO_INFER_CASCADE_HPP_
+#define _HAILO_INFER_CASCADE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/buffer.hpp"
+#include "hailo/expected.hpp"
+#include "hailo/infer_model.hpp"
+#include "hailo/vdevice.hpp"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+class InferCascadeImpl;
+
+/** Parameters of an InferCascade */
+struct HAILORTAPI InferCascadeParams
+{
+    InferCascadeParams();
+
+    /** Detections with a lower score aren't classified (and aren't returned) */
+    float32_t score_threshold;
+
+    /** Maximum amount of detections classified on each frame - the detections with the highest scores are chosen */
+    uint32_t max_crops_per_frame;
+
+    /** Maximum amount of frames in the cascade at a time. The buffers of the cascade are allocated for this amount */
+    uint32_t max_frames_in_flight;
+};
+
+/** A detection of a frame inferred by an InferCascade, and the outputs of the classifier on its crop */
+struct HAILORTAPI InferCascadeDetection
+{
+    /** Index of the class of the detection, in the NMS output of the detector */
+    uint32_t class_index;
+
+    /** The bounding box of the detection, normalized to the detector's input frame */
+    hailo_bbox_float32_t bbox;
+
+    /**
+     * The outputs of the classifier on the crop of the detection, by the names of the classifier's outputs.
+     * @note The buffers are owned by the cascade, and are valid only until the completion callback returns.
+     */
+    std::map<std::string, MemoryView> classifier_outputs;
+};
+
+/** Context passed to the callback of InferCascade::run_async once a frame went through the whole cascade */
+struct HAILORTAPI InferCascadeCompletionInfo
+{
+    /** Status of the frame's inference (of the detector, and of the classifier on all of the frame's crops) */
+    hailo_status status;
+
+    /** The detections of the frame. Empty if @a status isn't ::HAILO_SUCCESS */
+    std::vector<InferCascadeDetection> detections;
+};
+
+/*!
+ * \class InferCascade
+ * \brief A cascade of a detector model, whose NMS output drives a crop and resize of the input frame, and a classifier
+ * model inferring the crops in batches.
+ *
+ * The frames never leave the cascade between the models: the detector's output, the crops and the classifier's
+ * outputs are kept in buffers allocated once and mapped to the vdevice, and each frame's crops are sent to the
+ * classifier as a single multiple-bindings inference.
+ *
+ * The detector must have a single input and a single NMS output, and the classifier a single input with the same
+ * amount of features as the detector's input. The inputs of both models are set to ::HAILO_FORMAT_TYPE_UINT8
+ * ::HAILO_FORMAT_ORDER_NHWC frames, and the detector's output to ::HAILO_FORMAT_TYPE_FLOAT32
+ * ::HAILO_FORMAT_ORDER_HAILO_NMS. The rest of the models' parameters (batch size, classifier output formats, NMS
+ * thresholds) are taken from the InferModels, and may be set before creating the cascade.
+ *
+ * \note The crops are resized on the host.
+ */
+class HAILORTAPI InferCascade final {
+public:
+    using Callback = std::function<void(const InferCascadeCompletionInfo &)>;
+
+    /**
+     * Configures the models and creates the cascade.
+     *
+     * @param[in] vdevice       The vdevice the models were created from. The buffers of the cascade are mapped to it.
+     * @param[in] detector      The detector model. Must not be configured yet.
+     * @param[in] classifier    The classifier model. Must not be configured yet.
+     * @param[in] params        The parameters of the cascade.
+     *
+     * @return Upon success, returns the cascade. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note The vdevice must outlive the cascade.
+     */
+    static Expected<std::shared_ptr<InferCascade>> create(VDevice &vdevice, std::shared_ptr<InferModel> detector,
+        std::shared_ptr<InferModel> classifier, const InferCascadeParams &params = InferCascadeParams());
+
+    InferCascade(const InferCascade &) = delete;
+    InferCascade &operator=(const InferCascade &) = delete;
+    ~InferCascade();
+
+    /**
+     * Waits until the cascade is ready to get a new frame.
+     *
+     * @param[in] timeout       Amount of time to wait until the cascade is ready.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+     *           - If @a timeout has passed and the cascade is not ready, returns ::HAILO_TIMEOUT.
+     *           - In any other error case, returns ::hailo_status error.
+     */
+    hailo_status wait_for_async_ready(std::chrono::milliseconds timeout);
+
+    /**
+     * Launches the cascade on a frame. The completion is notified through the provided callback function, once the
+     * classifier inferred all of the frame's crops.
+     *
+     * @param[in] input         The frame - of the detector's input frame size.
+     * @param[in] callback      The function to be called upon completion.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. If the cascade isn't ready (see wait_for_async_ready()), returns
+     *  ::HAILO_QUEUE_IS_FULL. Otherwise, returns a ::hailo_status error.
+     * @note The frame is cropped after the detector is done with it, so @a input should be kept intact until
+     *  @a callback is called.
+     */
+    hailo_status run_async(MemoryView input, Callback callback);
+
+    /**
+     * Waits for the ongoing frames and shuts the cascade (and its models) down. After calling this method, the cascade
+     * is no longer usable.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status shutdown();
+
+    InferCascade(std::shared_ptr<InferCascadeImpl> pimpl);
+
+private:
+    std::shared_ptr<InferCascadeImpl> m_pimpl;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_CASCADE_HPP_ */
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_completion_queue.hpp
+ * @brief A queue the completions of asynchronous inferences are posted to, as an alternative to handling them in
+ * completion callbacks.
+ **/
+
+#ifndef _HAILO_INFER_COMPLETION_QUEUE_HPP_
+#define _HAILO_INFER_COMPLETION_QUEUE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/event.hpp"
+#include "hailo/infer_model.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace hailort
+{
+
+class AsyncInferCompletionQueueImpl;
+
+/** A completion of an asynchronous inference, popped from an AsyncInferCompletionQueue */
+struct HAILORTAPI AsyncInferCompletion
+{
+    /** Status of the inference, as passed to a completion callback */
+    hailo_status status;
+
+    /** Sequence number of the inference, as passed to a completion callback */
+    uint64_t sequence_number;
+
+    /** The value passed to AsyncInferCompletionQueue::callback() when the inference was launched */
+    uint64_t user_data;
+
+    /** Start time of the inference's input transfers, as passed to a completion callback */
+    std::chrono::steady_clock::time_point h2d_start_time;
+
+    /** Completion time of the inference's output transfers, as passed to a completion callback */
+    std::chrono::steady_clock::time_point d2h_complete_time;
+};
+
+/*!
+ * \class AsyncInferCompletionQueue
+ * \brief A bounded, lock-free queue the completions of asynchronous inferences are posted to.
+ *
+ * Instead of handling a completion in the callback, which is called from a thread of libhailort, the callback
+ * returned by callback() is passed to ConfiguredInferModel::run_async() (or to run_async_registered()), and only
+ * posts the completion to the queue. The completions are then handled by the user's thread, either by polling
+ * (try_pop()), by blocking (pop()), or by an event loop waiting on get_waitable_handle().
+ *
+ * \note The queue may be shared by any amount of ConfiguredInferModels, and may be popped from any amount of threads.
+ * \note The capacity of the queue should be at least the amount of inferences in flight at a time (the sum of
+ *  ConfiguredInferModel::get_async_queue_size() of the models posting to it), otherwise completions may be dropped
+ *  (see get_dropped_count()).
+ */
+class HAILORTAPI AsyncInferCompletionQueue final
+{
+public:
+    /**
+     * Creates an AsyncInferCompletionQueue.
+     *
+     * @param[in] capacity      The maximum amount of completions in the queue. Rounded up to a power of 2.
+     * @return Upon success, returns Expected of a shared pointer to the queue. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     */
+    static Expected<std::shared_ptr<AsyncInferCompletionQueue>> create(size_t capacity);
+
+    /**
+     * Returns a completion callback posting the completions to the queue, to be passed to
+     * ConfiguredInferModel::run_async().
+     *
+     * @param[in] user_data     A value identifying the inference, returned in AsyncInferCompletion::user_data.
+     * @note The callback holds the queue, so the queue stays valid until all inferences launched with its callbacks
+     *  are done.
+     */
+    std::function<void(const AsyncInferCompletionInfo &completion_info)> callback(uint64_t user_data = 0);
+
+    /**
+     * Pops a completion from the queue, waiting for one to be posted if the queue is empty.
+     *
+     * @param[in] timeout       The maximum time to wait for a completion.
+     * @return Upon success, returns Expected of the completion. If no completion was posted before the timeout,
+     *  returns Unexpected of ::HAILO_TIMEOUT. Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    Expected<AsyncInferCompletion> pop(std::chrono::milliseconds timeout);
+
+    /**
+     * Pops a completion from the queue, without waiting.
+     *
+     * @return Upon success, returns Expected of the completion. If the queue is empty, returns Unexpected of
+     *  ::HAILO_TIMEOUT. Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    Expected<AsyncInferCompletion> try_pop();
+
+    /**
+     * Returns a handle signaled while the queue isn't empty, for waiting on the queue with other handles of an event
+     * loop (an eventfd on Linux, to be added to epoll/poll for reading).
+     *
+     * @note The handle must only be waited on. Once it is signaled, the completions are popped with try_pop() until it
+     *  returns ::HAILO_TIMEOUT - reading the handle directly would lose completions.
+     */
+    underlying_waitable_handle_t get_waitable_handle();
+
+    /**
+     * @return The amount of completions dropped since the queue was created, since they were posted while the queue
+     *  was full.
+     */
+    size_t get_dropped_count() const;
+
+    AsyncInferCompletionQueue(std::shared_ptr<AsyncInferCompletionQueueImpl> pimpl);
+    AsyncInferCompletionQueue(const AsyncInferCompletionQueue &) = delete;
+    AsyncInferCompletionQueue &operator=(const AsyncInferCompletionQueue &) = delete;
+
+private:
+    std::shared_ptr<AsyncInferCompletionQueueImpl> m_pimpl;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_COMPLETION_QUEUE_HPP_ */
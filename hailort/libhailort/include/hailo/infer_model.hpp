@@ -13,12 +13,17 @@
 #include "hailo/network_group.hpp"
 #include "hailo/hef.hpp"
 #include "hailo/vdevice.hpp"
+#include "hailo/runtime_statistics.hpp"
+#include "hailo/custom_post_process_op.hpp"
+
+#include <chrono>
 
 /** hailort namespace */
 namespace hailort
 {
 
 class AsyncInferJobBase;
+class ConfigureInferModelJobImpl;
 class ConfiguredInferModelBase;
 class AsyncInferRunnerImpl;
 
@@ -49,6 +54,17 @@ public:
      **/
     void detach();
 
+    /**
+     * Cancels the job, if its frame wasn't sent to the device yet - the frame is then dropped, and the job is
+     * completed with ::HAILO_FRAME_CANCELLED. A frame already sent to the device is completed as usual.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS (the cancellation is requested, and the job is completed either
+     *  way). If the job can't be cancelled, returns ::HAILO_NOT_SUPPORTED.
+     * @note Supported for jobs of a single-bindings ConfiguredInferModel::run_async(), when the model is run by the
+     *  scheduler (the frames are dropped when the scheduler dequeues them).
+     **/
+    hailo_status cancel();
+
 private:
     friend class AsyncInferJobBase;
 
@@ -209,6 +225,45 @@ public:
      */
     hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count = 1);
 
+    /**
+     * Returns a handle that is signaled while the model is ready to launch a new asynchronous inference operation
+     * (i.e. while wait_for_async_ready() with a single frame wouldn't block), so the readiness of many models can be
+     * polled from a single thread. On Linux, the handle is an eventfd that is readable (POLLIN) while the model is
+     * ready - it can be added to an epoll set. The handle is also signaled once the model's pipeline fails, so the
+     * next run_async() returns the error.
+     *
+     * @return Upon success, returns Expected of the handle. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note The handle is owned by the model and is valid as long as the model exists. It must only be waited on -
+     *       reading, writing or closing it breaks the model's readiness signaling.
+     * @note Bulk operations (see InferPriority) may still have to wait for the bulk frames limit.
+     */
+    Expected<underlying_waitable_handle_t> get_async_ready_handle();
+
+    /** Priority of an asynchronous inference operation within the model - see set_bulk_frames_limit() */
+    enum class InferPriority
+    {
+        /** Latency sensitive operations (e.g. live frames). The default priority */
+        INTERACTIVE,
+        /** Throughput oriented operations (e.g. re-processing), which yield to the interactive ones */
+        BULK,
+    };
+
+    /**
+     * Waits until the model is ready to launch a new asynchronous inference operation of the given priority.
+     * Interactive operations are ready once the model is ready (see wait_for_async_ready()). Bulk operations are ready
+     * once the model is ready, the bulk operations in flight are under the bulk frames limit, and no interactive
+     * operation is waiting - so a waiting interactive operation gets the next free place in the model's queue first.
+     *
+     * @param[in] timeout           Amount of time to wait until the model is ready in milliseconds.
+     * @param[in] frames_count      The count of buffers you intent to infer in the next request.
+     * @param[in] priority          The priority of the next request.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+     *           - If @a timeout has passed and the model is not ready, returns ::HAILO_TIMEOUT.
+     *           - In any other error case, returns ::hailo_status error.
+     */
+    hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count, InferPriority priority);
+
     /**
      * Activates hailo device inner-resources for inference.
      *
@@ -250,6 +305,41 @@ public:
     Expected<AsyncInferJob> run_async(Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
 
+    /**
+     * Launches an asynchronous inference operation of the given priority with the provided bindings.
+     * The completion of the operation is notified through the provided callback function.
+     *
+     * @param[in] bindings           The bindings for the inputs and outputs of the model.
+     * @param[in] priority           The priority of the operation. A bulk operation must first be waited for by
+     *                               wait_for_async_ready() with InferPriority::BULK.
+     * @param[in] callback           The function to be called upon completion of the asynchronous inference operation.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error, and the interface shuts down completly.
+     * @note InferPriority::INTERACTIVE is the same as run_async() without a priority.
+     * @note The bindings' buffers should be kept intact until the async job is completed
+     */
+    Expected<AsyncInferJob> run_async(Bindings bindings, InferPriority priority,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
+    /**
+     * Launches an asynchronous inference operation with the provided bindings, which is dropped if it isn't sent to
+     * the device before its deadline. The completion of the operation is notified through the provided callback
+     * function - a dropped operation is completed with ::HAILO_FRAME_EXPIRED.
+     *
+     * @param[in] bindings           The bindings for the inputs and outputs of the model.
+     * @param[in] deadline           The maximum time from the launch until the operation is sent to the device.
+     * @param[in] callback           The function to be called upon completion of the asynchronous inference operation.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error, and the interface shuts down completly.
+     * @note Supported when the model is run by the scheduler (the operations are dropped when the scheduler dequeues
+     *  them). Not supported over the multi-process service or HRPC.
+     * @note The bindings' buffers should be kept intact until the async job is completed
+     */
+    Expected<AsyncInferJob> run_async(Bindings bindings, std::chrono::milliseconds deadline,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
     /**
      * Launches an asynchronous inference operation with the provided bindings.
      * The completion of the operation is notified through the provided callback function.
@@ -265,6 +355,37 @@ public:
     Expected<AsyncInferJob> run_async(const std::vector<Bindings> &bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
 
+    /**
+     * Registers a ring of bindings, launched later by their index with run_async_registered().
+     *
+     * The buffers of the bindings are validated and resolved to the inference pipeline once, here, so launching a
+     * registered bindings doesn't look its buffers up by name, nor validate them again.
+     *
+     * @param[in] bindings           The bindings to register. Replaces the bindings registered before.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The buffers are taken from the bindings when they are registered - setting new buffers to the bindings
+     *  afterwards doesn't affect the registered bindings.
+     * @note For best performance, the buffers should be mapped to the vdevice (see VDevice::dma_map()).
+     * @note Must not be called while registered bindings are in flight.
+     */
+    hailo_status register_bindings(const std::vector<Bindings> &bindings);
+
+    /**
+     * Launches an asynchronous inference operation with bindings registered by register_bindings().
+     * The completion of the operation is notified through the provided callback function.
+     *
+     * @param[in] bindings_index     The index of the bindings, in the vector passed to register_bindings().
+     * @param[in] callback           The function to be called upon completion of the asynchronous inference operation.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error, and the interface shuts down completly.
+     * @note @a callback should execute as quickly as possible.
+     * @note The bindings' buffers should be kept intact until the async job is completed
+     */
+    Expected<AsyncInferJob> run_async_registered(size_t bindings_index,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
     /**
     * @return Upon success, returns Expected of LatencyMeasurementResult object containing the output latency result.
     *  Otherwise, returns Unexpected of ::hailo_status error.
@@ -292,7 +413,8 @@ public:
      *
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
      * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
-     * @note The default threshold is 1.
+     * @note By default, the threshold (and the timeout, if not set) is chosen by HailoRT based on the measured time of
+     *  switching to the network group and the device time per frame (see hailo_set_scheduler_threshold()).
      * @note If at least one send request has been sent, but the threshold is not reached within a set time period (e.g. timeout - see
      *  hailo_set_scheduler_timeout()), the scheduler will consider the network ready regardless.
      */
@@ -311,12 +433,376 @@ public:
      */
     hailo_status set_scheduler_priority(uint8_t priority);
 
+    /**
+     * Sets the latency deadline of the model - the maximum time a request should wait from the time it is sent until
+     * the scheduler runs it.
+     * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE, the scheduler chooses the model whose
+     * oldest pending request is closest to missing its deadline.
+     *
+     * @param[in]  deadline             Deadline in milliseconds. 0 means the model has no deadline.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE.
+     * @note The default deadline is 0ms.
+     */
+    hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline);
+
+    /**
+     * Sets the share of the model in the device time.
+     * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE, ready models with the same priority
+     * get device time in proportion to their shares.
+     *
+     * @param[in]  share                Share of the model. Must be larger than 0.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE.
+     * @note The default share is HAILO_SCHEDULER_SHARE_DEFAULT.
+     */
+    hailo_status set_scheduler_share(uint32_t share);
+
+    /**
+     * Sets the devices on which the scheduler may run the model.
+     *
+     * @param[in]  device_mask          Bit i of the mask refers to the i-th device of the vdevice (in the order of
+     *                                  VDevice::get_physical_devices_ids()). Must contain at least one device of the vdevice.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note The default device mask is HAILO_SCHEDULER_ALL_DEVICES_MASK.
+     */
+    hailo_status set_scheduler_device_affinity(uint64_t device_mask);
+
+    /**
+     * Sets the sticky placement policy of the model. A sticky model that is loaded on one of the devices is not loaded
+     * on another device, unless that device has nothing else to run.
+     *
+     * @param[in]  is_sticky            Whether the model is sticky.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note By default models are not sticky.
+     */
+    hailo_status set_scheduler_sticky_placement(bool is_sticky);
+
+    /**
+     * Pins the model to a device of the vdevice - the device runs only the model, which streams to it without the
+     * scheduling decisions between bursts (dedicated device latency), while the other models are scheduled on the
+     * other devices of the vdevice.
+     *
+     * @param[in]  device_index         Index of the device (in the order of VDevice::get_physical_devices_ids()), or
+     *                                  HAILO_SCHEDULER_NO_PINNED_DEVICE to unpin the model.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     *         (::HAILO_INVALID_OPERATION if the device is pinned to another model).
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note A pinned model runs only on its device, regardless of its device affinity.
+     */
+    hailo_status set_scheduler_pinned_device(uint32_t device_index);
+
+    /**
+     * Sets the bounds of the scheduler burst size of the model - the amount of frames the model keeps streaming to a
+     * device before the scheduler considers switching to another model. Within the bounds, the burst size adapts to
+     * the observed queue depth and frames inter-arrival time of the model.
+     *
+     * @param[in]  min_burst_size       Minimum burst size (frames).
+     * @param[in]  max_burst_size       Maximum burst size (frames). Must be equal or greater than @a min_burst_size.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note Passing HAILO_SCHEDULER_BURST_SIZE_DEFAULT as both bounds restores the default (fixed) burst size.
+     * @note The burst size of a model configured with a batch size greater than 1 on a multi-context HEF is its batch
+     *       size, so setting its bounds isn't supported.
+     */
+    hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size);
+
+    /**
+     * Sets the batch size the scheduler runs the model with, without re-configuring it - e.g. for trading latency
+     * (small batches) for throughput (large batches) as the load changes. The resources of the model are allocated for
+     * the batch size set by InferModel::set_batch_size, so any batch size up to it may be set.
+     *
+     * @param[in]  batch_size           Batch size - between 1 and the batch size the model was configured with.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note Supported only for models configured with a batch size greater than 1 on a multi-context HEF.
+     * @note The new batch size applies from the next time the scheduler switches to the model.
+     */
+    hailo_status set_scheduler_batch_size(uint16_t batch_size);
+
+    /**
+     * Sets the scheduler overload policy of the model - what the scheduler does with a new frame when the model
+     * already has @a max_pending_frames frames waiting to be sent to a device. Shed frames are completed with
+     * ::HAILO_FRAME_DROPPED (or ::HAILO_QUEUE_IS_FULL, for ::HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT).
+     *
+     * @param[in]  policy               The overload policy.
+     * @param[in]  max_pending_frames   Frames that may wait to be sent to a device before the policy applies. Ignored
+     *                                  for ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE, otherwise must be greater than 0.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note The default policy is ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE.
+     */
+    hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames);
+
+    /**
+     * @return Upon success, returns Expected of the amount of frames shed by the scheduler overload policy of the model.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     */
+    Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats();
+
+    /**
+     * @return Upon success, returns Expected of the latency breakdown of each element of the model's infer pipeline -
+     *  the processing time of the element, and the time frames waited in the element's queue.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note The latency is measured only if ::HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY was set using
+     *  InferModel::set_pipeline_elements_stats_flags. Elements without measurements are not returned.
+     */
+    Expected<std::vector<PipelineElementLatencyResults>> get_pipeline_elements_latency();
+
     /**
      * @return Upon success, returns Expected of a the number of inferences that can be queued simultaneously for execution.
      *  Otherwise, returns Unexpected of ::hailo_status error.
      */
     Expected<size_t> get_async_queue_size();
 
+    /**
+     * @return Upon success, returns Expected of the maximum async queue size of the model (see
+     *  set_async_queue_size()), derived from the limits of its streams. Otherwise, returns Unexpected of ::hailo_status
+     *  error.
+     */
+    Expected<size_t> get_max_async_queue_size();
+
+    /**
+     * Sets the number of inferences that can be queued simultaneously for execution (see wait_for_async_ready() and
+     * get_async_queue_size()). A shorter queue keeps less frames waiting in the model, lowering the latency of each
+     * frame - as long as the queue is deep enough to keep the device busy (see tune_async_queue_size()).
+     *
+     * @param[in]  queue_size           The async queue size. Must be greater than 0, and at most
+     *                                  get_max_async_queue_size().
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The queue of the model can't be deeper than get_max_async_queue_size(), which is the default.
+     * @note The limit of the bulk operations (see set_bulk_frames_limit()) is lowered to the queue size if it is
+     *       deeper.
+     * @note Not supported over the multi-process service or HRPC.
+     */
+    hailo_status set_async_queue_size(size_t queue_size);
+
+    /**
+     * Finds the shortest async queue that achieves the peak throughput of the model, and sets it (see
+     * set_async_queue_size()). Each queue size, from 1 up to get_max_async_queue_size(), is measured by running
+     * asynchronous inferences of the given bindings for the given duration.
+     *
+     * @param[in]  bindings             The bindings to infer while measuring. The outputs are overwritten.
+     * @param[in]  measurement_duration The duration of the measurement of each queue size.
+     * @param[in]  min_throughput_ratio The throughput the chosen queue size must achieve, relative to the peak
+     *                                  throughput. Must be in (0, 1].
+     *
+     * @return Upon success, returns Expected of the chosen async queue size. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     * @note Must be called when there are no ongoing asynchronous inference operations, and while no other thread
+     *       uses the model - the measurement needs the whole model.
+     * @note Not supported over the multi-process service or HRPC.
+     */
+    Expected<size_t> tune_async_queue_size(Bindings bindings,
+        std::chrono::milliseconds measurement_duration = std::chrono::milliseconds(500),
+        float32_t min_throughput_ratio = 0.95f);
+
+    /**
+     * Runs asynchronous inferences of the given bindings and waits for them, so the one-time costs of the first frames
+     * (page faults in the scratch buffers of the pipeline, waking the pipeline's threads, the first transfers of
+     * each buffer) are paid before the first real frame.
+     *
+     * @param[in]  bindings             The bindings to infer. The outputs are overwritten.
+     * @param[in]  frames_count         The amount of frames to infer. 0 means get_async_queue_size() frames.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Must be called when the model is ready for inference (activated, if the scheduler is disabled), before
+     *       the real frames are launched.
+     * @note See also InferModel::set_host_buffers_locked.
+     */
+    hailo_status warm_up(Bindings bindings, uint32_t frames_count = 0);
+
+    /**
+     * The output buffers of an inference launched with run_async_loaned(), by output name. Each buffer belongs to the
+     * model and is loaned to the user - it returns to the model's pool once its last copy is destroyed.
+     */
+    using LoanedOutputs = std::unordered_map<std::string, std::shared_ptr<MemoryView>>;
+
+    /**
+     * Allocates the pools of output buffers that run_async_loaned() loans to the user - @a buffers_count buffers of
+     * each output. Replaces the pools allocated before (buffers loaned from them stay valid until they are returned).
+     *
+     * @param[in]  buffers_count        The amount of buffers of each output. Should be at least the async queue size
+     *                                  (see get_async_queue_size()), plus the amount of frames the user holds at a time.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Must not be called while run_async_loaned() is called by another thread.
+     */
+    hailo_status allocate_loaned_outputs(size_t buffers_count);
+
+    /**
+     * Launches an asynchronous inference like run_async(), with the outputs written to buffers of the model's pools
+     * (see allocate_loaned_outputs()) - the user allocates no output buffer, and the outputs aren't copied. The
+     * buffers are handed to @a callback, which may keep them (e.g. pass them to another thread) for as long as needed.
+     *
+     * @param[in]  bindings             The input buffers of the inference. Its output buffers are set to the loaned
+     *                                  buffers.
+     * @param[in]  callback             The function to call once the inference is completed, with the loaned buffers of
+     *                                  the outputs.
+     *
+     * @return Upon success, returns Expected of an AsyncInferJob object. Otherwise, returns Unexpected of
+     *  ::hailo_status error (::HAILO_QUEUE_IS_FULL if all of the buffers of an output are loaned).
+     * @note The loaned buffers must be returned before the VDevice is released.
+     */
+    Expected<AsyncInferJob> run_async_loaned(Bindings bindings,
+        std::function<void(const AsyncInferCompletionInfo &, LoanedOutputs &&)> callback);
+
+    /** Order in which the callbacks of the asynchronous inference operations are called - see set_completion_order() */
+    enum class CompletionOrder
+    {
+        /** In the order the operations were launched */
+        IN_ORDER,
+        /** As soon as each operation is completed */
+        OUT_OF_ORDER,
+        /** As soon as each operation is completed, once the operations launched more than max_skew operations before it
+         *  are completed */
+        BOUNDED_SKEW,
+    };
+
+    /**
+     * Sets the order in which the callbacks of the asynchronous inference operations are called.
+     * When the model runs on multiple devices, an operation completed by a fast device waits by default for the
+     * operations launched before it, that may run on a slower device. Users who don't need the order can get each
+     * operation as soon as it is completed, and match the completions to the operations by
+     * AsyncInferCompletionInfo::sequence_number.
+     *
+     * @param[in]  order                The completion order.
+     * @param[in]  max_skew             The amount of earlier operations an operation may overtake. Used only for
+     *                                  CompletionOrder::BOUNDED_SKEW, and must be greater than 0.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Supported only when the outputs of the model are written by the device directly to the bindings' buffers
+     *       (no transformation or post-process runs on the host), otherwise returns ::HAILO_INVALID_OPERATION.
+     * @note Must be called when there are no ongoing asynchronous inference operations.
+     * @note The default order is CompletionOrder::IN_ORDER.
+     */
+    hailo_status set_completion_order(CompletionOrder order, uint32_t max_skew = 0);
+
+    /**
+     * Sets the maximum amount of bulk asynchronous inference operations (see InferPriority::BULK) in flight at a time.
+     * The operations in flight are served in the order they were launched, so an interactive operation waits at most
+     * for the bulk operations in flight - limiting them keeps the latency of the interactive operations low while bulk
+     * operations fill the rest of the model's time.
+     *
+     * @param[in]  max_bulk_frames      The maximum amount of bulk operations in flight. Must be greater than 0, and
+     *                                  at most get_async_queue_size().
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note By default, bulk operations may fill the whole queue of the model.
+     * @note Not supported over the multi-process service or HRPC.
+     */
+    hailo_status set_bulk_frames_limit(uint32_t max_bulk_frames);
+
+    /**
+     * Enables skipping the inference of frames whose inputs are (almost) the same as the inputs of the last inferred
+     * frame - e.g. the frames of a static camera. A skipped frame is completed with a copy of the outputs of the last
+     * inferred frame, without reaching the device, so the device's time is left to the frames that changed.
+     * The frames are compared by the mean absolute difference of the bytes of their inputs, against the inputs of the
+     * last inferred frame (not the previous frame), so slow changes are inferred once they add up.
+     *
+     * @param[in]  max_mean_difference  A frame is skipped if the mean absolute difference of its input bytes is at most
+     *                                  this value (0 skips identical frames only). Must not be negative.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Applies to frames launched with run_async() (or run_async_loaned()) whose buffers are all set as
+     *       MemoryView. Other frames are always inferred.
+     * @note The callback of a skipped frame is called by the thread calling run_async(), before it returns, with
+     *       AsyncInferCompletionInfo::is_skipped set. It is called after the callback of the frame whose outputs it
+     *       gets, so the completion order is kept.
+     * @note While enabled, the inputs (and the outputs) of the inferred frames are copied, for comparing the next
+     *       frames.
+     * @note Not supported over the multi-process service or HRPC.
+     */
+    hailo_status enable_temporal_skip(float32_t max_mean_difference);
+
+    /**
+     * Disables skipping frames (see enable_temporal_skip()), and releases the kept copies of the inputs and outputs.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status disable_temporal_skip();
+
+    /** Format of the graph returned by get_pipeline_graph() */
+    enum class PipelineGraphFormat
+    {
+        /** Graphviz DOT */
+        DOT,
+        JSON,
+    };
+
+    /**
+     * @return Upon success, returns Expected of the graph of the model's infer pipeline - its elements, the links
+     *  between them, the occupancy of each element's buffer pool and each element's FPS.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @param[in] format    The format of the returned graph.
+     * @note The graph is a snapshot of the pipeline when called, so it may be called repeatedly while inferring to
+     *  find the element the pipeline is blocked on (the element without free buffers).
+     * @note The FPS is measured only if ::HAILO_PIPELINE_ELEM_STATS_MEASURE_FPS was set using
+     *  InferModel::set_pipeline_elements_stats_flags.
+     */
+    Expected<std::string> get_pipeline_graph(PipelineGraphFormat format);
+
+    /**
+     * Recovers the model after an error (e.g. a transfer timeout or a device error notification), without configuring
+     * it again: the model's channels are deactivated (canceling its transfers in flight), and it is activated again -
+     * by the scheduler before its next frames, or here if it was activated with activate().
+     * The frames in flight complete with an error, and the frames queued to the scheduler are inferred once the
+     * model is active again. If the error shut the host pipeline down, the pipeline is built again as well - while
+     * the model stays configured on the device.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     *         (::HAILO_TIMEOUT if the frames in flight weren't completed in time).
+     * @note Must not be called while another thread calls run_async() or wait_for_async_ready().
+     * @note Bindings registered with register_bindings() must be registered again, if the pipeline was built again.
+     */
+    hailo_status recover();
+
+    /**
+     * Prepares the model to be shared with processes forked after this call (e.g. the workers of a pre-fork server),
+     * so the model is configured once - by the parent process - instead of by each of the workers.
+     * The model's host pipeline is released, and is built again by after_fork_in_parent() and after_fork_in_child(),
+     * so each process gets its own pipeline threads and queues, while the processes share the configured model (and
+     * its core-op) in the HailoRT service.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     *         (::HAILO_INVALID_OPERATION if frames are in flight).
+     * @note Supported for models configured on a VDevice created with multi_process_service and the model scheduler,
+     *       whose VDevice::before_fork() is called before this method.
+     * @note The model must not be used until after_fork_in_parent() (or after_fork_in_child()) is called.
+     */
+    hailo_status before_fork();
+
+    /**
+     * Builds the model's host pipeline again in the parent process, after fork (see before_fork()).
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     * @note VDevice::after_fork_in_parent() must be called before this method.
+     * @note Bindings registered with register_bindings() must be registered again.
+     */
+    hailo_status after_fork_in_parent();
+
+    /**
+     * Builds the model's host pipeline in the child process, after fork (see before_fork()). The child's frames are
+     * queued to the model scheduler on its own, as the frames of any other client of the model.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     * @note VDevice::after_fork_in_child() must be called before this method.
+     * @note Bindings registered with register_bindings() must be registered again.
+     */
+    hailo_status after_fork_in_child();
+
     /**
      * Shuts the inference down. After calling this method, the model is no longer usable.
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
@@ -342,7 +828,18 @@ struct HAILORTAPI AsyncInferCompletionInfo
      *
      * @param[in] _status The status of the inference operation.
      */
-    AsyncInferCompletionInfo(hailo_status _status) : status(_status)
+    AsyncInferCompletionInfo(hailo_status _status) : status(_status), sequence_number(0), is_skipped(false)
+    {
+    }
+
+    /**
+     * Constructor for AsyncInferCompletionInfo.
+     *
+     * @param[in] _status The status of the inference operation.
+     * @param[in] _sequence_number The sequence number of the inference operation.
+     */
+    AsyncInferCompletionInfo(hailo_status _status, uint64_t _sequence_number) :
+        status(_status), sequence_number(_sequence_number), is_skipped(false)
     {
     }
 
@@ -352,6 +849,96 @@ struct HAILORTAPI AsyncInferCompletionInfo
      * - Any other ::hailo_status on unexpected errors.
      */
     hailo_status status;
+
+    /**
+     * Index of the asynchronous inference operation, in the order the operations of the ConfiguredInferModel were
+     * launched (starting from 0). Each frame of a multiple-bindings run_async() is an operation of its own, and the
+     * sequence number of the whole request is the sequence number of its first frame.
+     */
+    uint64_t sequence_number;
+
+    /**
+     * The time (of the host's steady clock) the first input transfer of the operation was launched to the device.
+     * The clock's epoch (a default time_point) if it wasn't recorded - the operation wasn't sent to the device, or it
+     * was run with multiple bindings or with registered bindings.
+     */
+    std::chrono::steady_clock::time_point h2d_start_time;
+
+    /**
+     * The time (of the host's steady clock) the last output transfer of the operation was completed by the device,
+     * as seen by the interrupt handling. Recorded (or not) along with ::h2d_start_time.
+     */
+    std::chrono::steady_clock::time_point d2h_complete_time;
+
+    /**
+     * Whether the inference of the operation was skipped, and its outputs are a copy of the outputs of an earlier
+     * operation (see ConfiguredInferModel::enable_temporal_skip()).
+     */
+    bool is_skipped;
+};
+
+/*! Asynchronous configuration of an InferModel - see InferModel::configure_async. */
+class HAILORTAPI ConfigureInferModelJob
+{
+public:
+    ConfigureInferModelJob() = default;
+    ~ConfigureInferModelJob();
+
+    ConfigureInferModelJob(const ConfigureInferModelJob &other) = delete;
+    ConfigureInferModelJob &operator=(const ConfigureInferModelJob &other) = delete;
+    ConfigureInferModelJob(ConfigureInferModelJob &&other) = default;
+    ConfigureInferModelJob &operator=(ConfigureInferModelJob &&other) = default;
+
+    /**
+     * Waits for the configuration to finish.
+     *
+     * @param[in] timeout The maximum time to wait.
+     *
+     * @return Upon success, returns Expected of the ConfiguredInferModel. If the configuration didn't finish within the
+     *  timeout, returns Unexpected of ::HAILO_TIMEOUT (and wait() may be called again). Otherwise, returns Unexpected
+     *  of the ::hailo_status error the configuration failed with.
+     **/
+    Expected<ConfiguredInferModel> wait(std::chrono::milliseconds timeout);
+
+private:
+    friend class InferModelBase;
+
+    ConfigureInferModelJob(std::shared_ptr<ConfigureInferModelJobImpl> pimpl);
+    std::shared_ptr<ConfigureInferModelJobImpl> m_pimpl;
+};
+
+/** Parameters of the resize of an input's frames by the infer pipeline - see InferModel::InferStream::set_resize() */
+struct HAILORTAPI InputResizeParams
+{
+    InputResizeParams();
+
+    /** Width of the source frames, in pixels */
+    uint32_t src_width;
+
+    /** Height of the source frames, in pixels */
+    uint32_t src_height;
+
+    /**
+     * Order of the source frames:
+     *  - ::HAILO_FORMAT_ORDER_NHWC - Frames with the features of the input (e.g. RGB).
+     *  - ::HAILO_FORMAT_ORDER_NV12 - Frames converted to RGB (BT.601) while resized. Supported for inputs with 3 features.
+     */
+    hailo_format_order_t src_order;
+
+    /** Region of the source frame that is resized, in pixels. A @a crop_width or @a crop_height of 0 means the whole frame. */
+    uint32_t crop_x;
+    uint32_t crop_y;
+    uint32_t crop_width;
+    uint32_t crop_height;
+
+    /**
+     * If true, the aspect ratio of the region is kept (letterbox) - the region is resized to fit the input's shape,
+     * centered, and the rest of the frame is filled with @a padding_value.
+     */
+    bool keep_aspect_ratio;
+
+    /** Value of the padding pixels, used when @a keep_aspect_ratio is true */
+    uint8_t padding_value;
 };
 
 /**
@@ -362,6 +949,17 @@ struct HAILORTAPI AsyncInferCompletionInfo
 class HAILORTAPI InferModel
 {
 public:
+    /** Stages of the configuration of an InferModel, reported by configure_async() */
+    enum class ConfigureStage
+    {
+        /** Configuring the network group on the device(s) - HEF processing, buffers allocation and device controls */
+        CONFIGURING_NETWORK_GROUP,
+        /** Creating the infer pipeline on the host */
+        CREATING_INFER_PIPELINE,
+    };
+
+    using ConfigureProgressCallback = std::function<void(ConfigureStage stage)>;
+
     virtual ~InferModel() = default;
 
     /**
@@ -392,6 +990,17 @@ public:
          */
         size_t get_frame_size() const;
 
+        /**
+         * Allocates a buffer of a frame of the stream (see get_frame_size()), which is transferred to or from the
+         * device without copies - its address is aligned to the system page size (which the descriptors' pages are
+         * aligned to), and its allocated size is a multiple of the page size, covering the whole last page.
+         *
+         * @return Upon success, returns Expected of the buffer. Otherwise, returns Unexpected of ::hailo_status error.
+         * @note Unaligned buffers are copied through bounce buffers by the streams, which is logged as a warning on the
+         *  first such frame of each stream.
+         */
+        Expected<Buffer> allocate_buffer() const;
+
         /**
          * @return upon success, an Expected of hailo_nms_shape_t, the NMS shape for the stream.
          *  Otherwise, returns Unexpected of ::hailo_status error.
@@ -460,6 +1069,49 @@ public:
          */
         void set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+        /**
+         * Set a limit for the maximum number of boxes of all of the classes together, used by the
+         * ::HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE format order - only the boxes with the highest scores are returned.
+         *
+         * @note: The output buffer frame size is set by this limit, so it's much smaller than the
+         * ::HAILO_FORMAT_ORDER_HAILO_NMS frame size of models with many classes.
+         *
+         * @param[in] max_proposals_total NMS max proposals of all of the classes to set.
+         */
+        void set_nms_max_proposals_total(uint32_t max_proposals_total);
+
+        /**
+         * Set the classes whose boxes are returned. The boxes of the rest of the classes are dropped (in the
+         * ::HAILO_FORMAT_ORDER_HAILO_NMS format order, their classes have no boxes).
+         *
+         * @param[in] classes          Indices of the classes to return (as in the output). Empty means all of the classes.
+         */
+        void set_nms_classes_filter(const std::vector<uint32_t> &classes);
+
+        /**
+         * Set vDMA interrupts coalescing for the stream. Instead of an interrupt on each transfer, an interrupt is raised
+         * once every @a max_transfers transfers, or @a timeout after a transfer was completed - whichever comes first.
+         * Reduces the interrupts rate at the cost of completion latency, useful mostly on high batch sizes.
+         *
+         * @param[in] max_transfers     Maximum number of transfers per interrupt. 0 or 1 disable coalescing.
+         * @param[in] timeout           Maximum time a completed transfer waits for an interrupt.
+         * @note Ignored if the driver doesn't support interrupts coalescing, or if HW latency measurement is enabled.
+         */
+        void set_interrupts_coalescing(uint32_t max_transfers, std::chrono::microseconds timeout);
+
+        /**
+         * Sets the infer pipeline to crop and resize (bilinear) the frames of the input, so frames of any resolution
+         * (e.g. the camera's native resolution) may be inferred without resizing them beforehand.
+         * The frames set to the input's buffers are of the source shape (see get_frame_size()), and the resized frames
+         * are of the input's shape and format - whose type and order are set to ::HAILO_FORMAT_TYPE_UINT8 and
+         * ::HAILO_FORMAT_ORDER_NHWC.
+         *
+         * @param[in] params            The parameters of the resize.
+         * @note Supported only for inputs, and not for multi-planar inputs.
+         * @note The resize runs on the host.
+         */
+        void set_resize(const InputResizeParams &params);
+
     private:
         friend class InferModelBase;
         friend class InferModelHrpcClient;
@@ -468,6 +1120,9 @@ public:
         float32_t nms_iou_threshold() const;
         uint32_t nms_max_proposals_per_class() const;
         uint32_t nms_max_accumulated_mask_size() const;
+        uint32_t nms_max_proposals_total() const;
+        const std::vector<uint32_t> &nms_classes_filter() const;
+        bool is_resized() const;
 
         class Impl;
         InferStream(std::shared_ptr<Impl> pimpl);
@@ -508,6 +1163,28 @@ public:
      */
     virtual void set_hw_latency_measurement_flags(hailo_latency_measurement_flags_t latency) = 0;
 
+    /**
+     * Sets the statistics collected by the elements of the infer pipeline.
+     * see ::hailo_pipeline_elem_stats_flags_t for more information.
+     *
+     * @param[in] flags      The new pipeline elements statistics flags to be set.
+     * @note The latency breakdown of the elements is queried using ConfiguredInferModel::get_pipeline_elements_latency.
+     */
+    virtual void set_pipeline_elements_stats_flags(hailo_pipeline_elem_stats_flags_t flags) = 0;
+
+    /**
+     * Sets whether the host buffers allocated by the model's infer pipeline are faulted in and locked in RAM (mlock on
+     * posix, VirtualLock on windows) when the model is configured - so the first frames, and the frames after an idle
+     * period, don't page fault on them.
+     *
+     * @param[in] locked      Whether the buffers are locked. Defaults to false.
+     * @note The configuration fails if the buffers exceed the process's locked memory limit (RLIMIT_MEMLOCK on linux).
+     * @note The buffers of the elements' scratch memory (e.g. of the transformations) are faulted in by the first
+     *       frames - see ConfiguredInferModel::warm_up.
+     * @note Ignored over HRPC, where the pipeline runs on the device.
+     */
+    virtual void set_host_buffers_locked(bool locked) = 0;
+
     /**
      * Configures the InferModel object. Also checks the validity of the configuration's formats.
      *
@@ -517,6 +1194,19 @@ public:
      */
     virtual Expected<ConfiguredInferModel> configure() = 0;
 
+    /**
+     * Configures the InferModel object on a separate thread, so the caller isn't blocked while the model is configured
+     * (e.g. for serving other models meanwhile).
+     *
+     * @param[in] progress_callback     Optional callback called (on the configuring thread) when the configuration
+     *                                  reaches each of its stages.
+     * @return Upon success, returns Expected of ConfigureInferModelJob, whose wait() returns the ConfiguredInferModel.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note InferModel can be configured once.
+     * @note The InferModel must outlive the job. The job's destructor blocks until the configuration finishes.
+     */
+    virtual Expected<ConfigureInferModelJob> configure_async(ConfigureProgressCallback progress_callback = nullptr) = 0;
+
     /**
      * Returns the single input's InferStream object.
      *
@@ -571,6 +1261,25 @@ public:
      */
     virtual const std::vector<std::string> &get_output_names() const = 0;
 
+    /**
+     * Adds a custom post-process op, run by the inference pipeline over some of the model's outputs.
+     *
+     * The outputs @a input_names are replaced by a single output - the output of @a op, named and shaped by
+     * CustomPostProcessOp::get_output_info(). The op's inputs are the frames of the outputs in their current formats
+     * (see InferStream::set_format_type() and InferStream::set_format_order()), so the formats should be set before
+     * adding the op.
+     *
+     * @param[in] input_names           The names of the outputs the op runs on.
+     * @param[in] op                    The op.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Must be called before configure().
+     * @note The outputs must be plain outputs of the model - outputs of the HEF's post-process ops (e.g. NMS), demuxed
+     *  outputs and outputs of other custom ops aren't supported.
+     * @note Not supported when working with the service, or with a remote device.
+     */
+    virtual hailo_status add_custom_post_process_op(const std::vector<std::string> &input_names,
+        std::shared_ptr<CustomPostProcessOp> op) = 0;
+
     virtual Expected<ConfiguredInferModel> configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes = {},
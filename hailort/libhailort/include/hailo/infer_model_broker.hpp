@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_model_broker.hpp
+ * @brief Sharing a ConfiguredInferModel with other processes over shared memory, without the HailoRT service.
+ *
+ * The process owning the model (the one that configured it) creates an InferModelBroker, which places the input and
+ * output buffers of a set of slots in a named shared memory object. Other processes connect to it with an
+ * InferModelBrokerClient, fill the inputs of a slot in place, and submit it to the owner through lock-free queues in
+ * the shared memory - no frame is serialized or copied between the processes.
+ **/
+
+#ifndef _HAILO_INFER_MODEL_BROKER_HPP_
+#define _HAILO_INFER_MODEL_BROKER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+#include "hailo/infer_model.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace hailort
+{
+
+class InferModelBrokerImpl;
+class InferModelBrokerClientImpl;
+
+/*!
+ * \class InferModelBroker
+ * \brief Serves a ConfiguredInferModel to other processes, connected with InferModelBrokerClient.
+ *
+ * The broker runs the inferences submitted by the clients on the model, in the order they are submitted (its thread
+ * is the only one launching inferences on behalf of the clients, so the model's scheduling stays in this process).
+ *
+ * \note Supported on Linux and QNX.
+ * \note The model must not be shut down while the broker exists.
+ */
+class HAILORTAPI InferModelBroker final
+{
+public:
+    /**
+     * Creates a broker for @a configured_infer_model, and starts serving its clients.
+     *
+     * @param[in] infer_model               The InferModel @a configured_infer_model was configured from (its inputs and
+     *                                      outputs define the buffers of the slots).
+     * @param[in] configured_infer_model    The model to serve.
+     * @param[in] name                      The name of the shared memory object, used by the clients to connect (e.g.
+     *                                      "/hailo_yolo_broker").
+     * @param[in] slots_count               The amount of slots (frames that can be filled or in flight at a time, by
+     *                                      all of the clients together).
+     * @return Upon success, returns Expected of a unique pointer to the broker. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     */
+    static Expected<std::unique_ptr<InferModelBroker>> create(InferModel &infer_model,
+        ConfiguredInferModel configured_infer_model, const std::string &name, size_t slots_count);
+
+    /**
+     * Stops serving - the clients' pending and later operations fail with ::HAILO_COMMUNICATION_CLOSED. The
+     * inferences already launched are completed.
+     */
+    ~InferModelBroker();
+
+    InferModelBroker(std::shared_ptr<InferModelBrokerImpl> pimpl);
+    InferModelBroker(const InferModelBroker &) = delete;
+    InferModelBroker &operator=(const InferModelBroker &) = delete;
+
+private:
+    std::shared_ptr<InferModelBrokerImpl> m_pimpl;
+};
+
+/*!
+ * \class InferModelBrokerClient
+ * \brief A connection to an InferModelBroker of another process.
+ *
+ * A frame is inferred by acquiring a slot, filling its input buffers (see get_input_buffer()), submitting it and
+ * waiting for it, then reading its output buffers and releasing it. infer() does all of these, copying from and to the
+ * user's buffers.
+ *
+ * \note A slot belongs to the client that acquired it until it is released. The slots of a client that exits without
+ *  releasing them are lost to the other clients.
+ */
+class HAILORTAPI InferModelBrokerClient final
+{
+public:
+    /** Index of a slot of the broker */
+    using Slot = uint32_t;
+
+    /**
+     * Connects to the broker named @a name.
+     *
+     * @param[in] name      The name the broker was created with.
+     * @return Upon success, returns Expected of a unique pointer to the client. Otherwise, returns Unexpected of
+     *  ::hailo_status error.
+     */
+    static Expected<std::unique_ptr<InferModelBrokerClient>> connect(const std::string &name);
+
+    /**
+     * Acquires a free slot, waiting for one if all of the slots are used.
+     *
+     * @param[in] timeout   The maximum time to wait for a free slot.
+     * @return Upon success, returns Expected of the slot. Otherwise, returns Unexpected of ::hailo_status error
+     *  (::HAILO_TIMEOUT if no slot was freed in time).
+     */
+    Expected<Slot> acquire_slot(std::chrono::milliseconds timeout);
+
+    /**
+     * @return The buffer of the input @a name in @a slot, in the shared memory. Filled before submit() is called.
+     */
+    Expected<MemoryView> get_input_buffer(Slot slot, const std::string &name);
+
+    /**
+     * @return The buffer of the output @a name in @a slot, in the shared memory. Valid once wait() returned.
+     */
+    Expected<MemoryView> get_output_buffer(Slot slot, const std::string &name);
+
+    /**
+     * Submits @a slot to the broker, to run an inference on its inputs.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status submit(Slot slot);
+
+    /**
+     * Waits until the inference of @a slot is done.
+     *
+     * @param[in] slot      A submitted slot.
+     * @param[in] timeout   The maximum time to wait.
+     * @return Returns the status of the inference, ::HAILO_TIMEOUT if it isn't done in time, or another
+     *  ::hailo_status error.
+     */
+    hailo_status wait(Slot slot, std::chrono::milliseconds timeout);
+
+    /**
+     * Returns @a slot to the broker's free slots.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error (a submitted slot can
+     *  be released only once wait() returned).
+     */
+    hailo_status release_slot(Slot slot);
+
+    /**
+     * Infers a single frame (acquires a slot, copies @a inputs into it, submits it, waits for it, copies its outputs
+     * to @a outputs and releases it).
+     *
+     * @param[in] inputs        A mapping of input name to its frame.
+     * @param[in] outputs       A mapping of output name to the buffer its frame is copied into.
+     * @param[in] timeout       The maximum time to wait for a free slot, and for the inference.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status infer(const std::map<std::string, MemoryView> &inputs, const std::map<std::string, MemoryView> &outputs,
+        std::chrono::milliseconds timeout);
+
+    InferModelBrokerClient(std::shared_ptr<InferModelBrokerClientImpl> pimpl);
+    InferModelBrokerClient(const InferModelBrokerClient &) = delete;
+    InferModelBrokerClient &operator=(const InferModelBrokerClient &) = delete;
+
+private:
+    std::shared_ptr<InferModelBrokerClientImpl> m_pimpl;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_MODEL_BROKER_HPP_ */
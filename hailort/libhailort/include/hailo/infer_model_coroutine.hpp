@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_model_coroutine.hpp
+ * @brief C++20 coroutine support for asynchronous inference - an asynchronous inference that can be awaited with
+ * co_await.
+ *
+ * The header is header-only, and is empty unless it is compiled with coroutines support (libhailort itself is built
+ * with C++14, so the header doesn't affect its ABI).
+ **/
+
+#ifndef _HAILO_INFER_MODEL_COROUTINE_HPP_
+#define _HAILO_INFER_MODEL_COROUTINE_HPP_
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define HAILO_INFER_MODEL_COROUTINES_SUPPORTED
+#endif
+#endif
+
+#if defined(HAILO_INFER_MODEL_COROUTINES_SUPPORTED)
+
+#include "hailo/hailort.h"
+#include "hailo/infer_model.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace hailort
+{
+
+/**
+ * An executor resuming the coroutines awaiting an AsyncInferAwaitable - called once the inference is completed, from
+ * the thread completing it. An empty executor resumes the coroutine on that thread.
+ */
+using AsyncInferResumeExecutor = std::function<void(std::coroutine_handle<>)>;
+
+/*!
+ * \class AsyncInferAwaitable
+ * \brief An asynchronous inference of a ConfiguredInferModel, launched when it is awaited with co_await. The
+ * co_await returns the AsyncInferCompletionInfo of the inference once it is completed.
+ *
+ * The coroutine doesn't block while the inference is in flight - it is suspended, and resumed by the executor once
+ * the inference is completed (or if it failed to launch).
+ *
+ * \note Launching the inference waits (up to the ready timeout) until the model is ready for it (see
+ *  ConfiguredInferModel::wait_for_async_ready()). To never block, keep at most
+ *  ConfiguredInferModel::get_async_queue_size() inferences of the model awaited at a time.
+ * \note The bindings' buffers should be kept intact until the co_await returns.
+ */
+class AsyncInferAwaitable final
+{
+public:
+    AsyncInferAwaitable(ConfiguredInferModel &configured_infer_model, ConfiguredInferModel::Bindings bindings,
+        AsyncInferResumeExecutor executor, std::chrono::milliseconds ready_timeout) :
+            m_configured_infer_model(configured_infer_model), m_bindings(std::move(bindings)),
+            m_executor(std::move(executor)), m_ready_timeout(ready_timeout), m_state(std::make_shared<State>())
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        auto status = m_configured_infer_model.wait_for_async_ready(m_ready_timeout);
+        if (HAILO_SUCCESS != status) {
+            m_state->info = AsyncInferCompletionInfo(status);
+            return false;
+        }
+
+        // Once the inference is launched, the coroutine may be resumed (and this awaitable destroyed) by another
+        // thread at any time, so only locals are used from here on
+        auto state = m_state;
+        auto executor = m_executor;
+        auto job = m_configured_infer_model.run_async(m_bindings,
+            [state, executor, handle](const AsyncInferCompletionInfo &completion_info) {
+                if (state->claimed.exchange(true)) {
+                    return;
+                }
+                state->info = completion_info;
+                if (executor) {
+                    executor(handle);
+                } else {
+                    handle.resume();
+                }
+            });
+        if (!job) {
+            if (state->claimed.exchange(true)) {
+                // The callback was called anyway, and resumes the coroutine
+                return true;
+            }
+            state->info = AsyncInferCompletionInfo(job.status());
+            return false;
+        }
+
+        // The completion is reported to the coroutine, so the job's destructor must not wait for it
+        job->detach();
+        return true;
+    }
+
+    AsyncInferCompletionInfo await_resume() const noexcept
+    {
+        return m_state->info;
+    }
+
+private:
+    struct State
+    {
+        State() : claimed(false), info(HAILO_UNINITIALIZED) {}
+
+        // Set by whoever resumes the coroutine - the completion callback, or a failed launch
+        std::atomic<bool> claimed;
+        AsyncInferCompletionInfo info;
+    };
+
+    ConfiguredInferModel &m_configured_infer_model;
+    ConfiguredInferModel::Bindings m_bindings;
+    AsyncInferResumeExecutor m_executor;
+    std::chrono::milliseconds m_ready_timeout;
+    std::shared_ptr<State> m_state;
+};
+
+/**
+ * Returns an asynchronous inference of @a configured_infer_model, to be awaited with co_await:
+ * @code
+ * auto completion_info = co_await infer_async(configured_infer_model, bindings, executor);
+ * @endcode
+ *
+ * @param[in] configured_infer_model    The model to infer. Must outlive the co_await.
+ * @param[in] bindings                  The bindings for the inputs and outputs of the model.
+ * @param[in] executor                  Resumes the coroutine once the inference is completed. An empty executor
+ *                                      resumes the coroutine on libhailort's thread completing the inference, in
+ *                                      which case the coroutine should return to awaiting as quickly as possible.
+ * @param[in] ready_timeout             The maximum time to wait until the model is ready for the inference.
+ *
+ * @return The awaitable. Awaiting it returns the AsyncInferCompletionInfo of the inference - the status is a
+ *  ::hailo_status error if the inference failed, or if it failed to launch.
+ */
+inline AsyncInferAwaitable infer_async(ConfiguredInferModel &configured_infer_model,
+    ConfiguredInferModel::Bindings bindings, AsyncInferResumeExecutor executor = {},
+    std::chrono::milliseconds ready_timeout = std::chrono::milliseconds(HAILO_INFINITE))
+{
+    return AsyncInferAwaitable(configured_infer_model, std::move(bindings), std::move(executor), ready_timeout);
+}
+
+} /* namespace hailort */
+
+#endif /* defined(HAILO_INFER_MODEL_COROUTINES_SUPPORTED) */
+
+#endif /* _HAILO_INFER_MODEL_COROUTINE_HPP_ */
@@ -17,6 +17,8 @@
 namespace hailort
 {
 
+class InferVStreamsWorkers;
+
 /*! Pipeline used to run inference */
 // TODO: HRT-3157 - Fix doc after multi-network support.
 class HAILORTAPI InferVStreams final
@@ -56,6 +58,30 @@ public:
     hailo_status infer(const std::map<std::string, MemoryView>& input_data,
                        std::map<std::string, MemoryView>& output_data, size_t frames_count);
 
+    /**
+     * Launches an inference on dataset @a input_data, without waiting for it to end. The inferences launched are run in
+     * order by worker threads kept for this object (one per vstream), so the writing of the next dataset may overlap the
+     * reading of the previous one's outputs - calling this function in a loop keeps the pipeline busy between datasets.
+     *
+     * @param[in] input_data                    A mapping of vstream name to MemoryView containing input dataset for inference.
+     * @param[out] output_data                  A mapping of vstream name to MemoryView to be filled with the inference output data.
+     * @param[in] frames_count                  The amount of inferred frames.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The same notes of infer() apply.
+     * @note The buffers of @a input_data and @a output_data must be kept intact until wait_for_infers() returns.
+     */
+    hailo_status launch_infer(const std::map<std::string, MemoryView> &input_data,
+        const std::map<std::string, MemoryView> &output_data, size_t frames_count);
+
+    /**
+     * Waits for all of the inferences launched by launch_infer() to end.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns the ::hailo_status error of the first inference
+     *         that failed since the last call (the inferences launched after a failure are skipped).
+     */
+    hailo_status wait_for_infers();
+
     /**
      * Get InputVStream by name.
      *
@@ -133,7 +159,8 @@ public:
         m_is_scheduled(std::move(other.m_is_scheduled)),
         m_network_name_to_input_count(std::move(other.m_network_name_to_input_count)),
         m_network_name_to_output_count(std::move(other.m_network_name_to_output_count)),
-        m_batch_size(std::move(other.m_batch_size))
+        m_batch_size(std::move(other.m_batch_size)),
+        m_workers(std::move(other.m_workers))
         {};
 private:
     InferVStreams(std::vector<InputVStream> &&inputs, std::vector<OutputVStream> &&outputs, bool is_multi_context,
@@ -144,6 +171,7 @@ private:
                                          const std::map<std::string, MemoryView>& outputs_name_mem_view_map,
                                          size_t frames_count);
     hailo_status verify_frames_count(size_t frames_count);
+    Expected<std::shared_ptr<InferVStreamsWorkers>> get_workers();
 
     std::vector<InputVStream> m_inputs;
     std::vector<OutputVStream> m_outputs;
@@ -152,6 +180,9 @@ private:
     std::map<std::string, size_t> m_network_name_to_input_count;
     std::map<std::string, size_t> m_network_name_to_output_count;
     uint16_t m_batch_size;
+    // Runs the reads/writes of the vstreams, created on the first inference. Declared last, so the workers are stopped
+    // before the vstreams are destroyed.
+    std::shared_ptr<InferVStreamsWorkers> m_workers;
 };
 
 } /* namespace hailort */
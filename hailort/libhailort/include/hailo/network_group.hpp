@@ -43,6 +43,10 @@ struct BufferRepresentation {
         MemoryView view;
         hailo_dma_buffer_t dma_buffer;
     };
+    // For BufferType::DMA_BUFFER - the data is the dma_buffer_transfer_size bytes at dma_buffer_offset of the dmabuf
+    // (e.g. a plane of a frame). If dma_buffer_transfer_size is 0, the data is the whole dmabuf.
+    size_t dma_buffer_offset;
+    size_t dma_buffer_transfer_size;
 };
 
 using NamedBuffersCallbacks = std::unordered_map<std::string, std::pair<BufferRepresentation, std::function<void(hailo_status)>>>;
@@ -70,6 +74,8 @@ using OutputStreamWithParamsVector = std::vector<std::pair<std::shared_ptr<Outpu
 /** Latency measurement result info */
 struct LatencyMeasurementResult {
     std::chrono::nanoseconds avg_hw_latency;
+    /** The HW latency percentiles (count is 0 when not available). Of the slowest network when measured over several networks */
+    LatencyHistogramResults hw_latency_histogram;
 };
 
 struct HwInferResults {
@@ -80,6 +86,23 @@ struct HwInferResults {
     float32_t fps;
     float32_t BW_Gbps;
 };
+
+/** Contents and offsets of the caches of a network group (e.g. the KV caches of a single session) */
+struct CacheSnapshot {
+    hailo_cache_info_t cache_info;
+    // Cache id -> cache content
+    std::map<uint32_t, Buffer> cache_buffers;
+};
+
+/** Durations of the stages of a network group's configuration on the device(s) */
+struct ConfigureStagesDurations {
+    // Allocating the boundary channels' and the internal buffers
+    std::chrono::microseconds buffers_allocation;
+    // Building the contexts' resources (the config buffers, the CCWs and the action lists)
+    std::chrono::microseconds resources_building;
+    // Sending the network group's header and the contexts' action lists to the firmware
+    std::chrono::microseconds firmware_upload;
+};
 /*@}*/
 
 using src_context_t = uint16_t;
@@ -387,7 +410,8 @@ public:
      *                                  If not passed, the threshold will be set for all the networks in the network group.
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
      * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
-     * @note The default threshold is 1.
+     * @note By default, the threshold (and the timeout, if not set) is chosen by HailoRT based on the measured time of
+     *  switching to the network group and the device time per frame (see hailo_set_scheduler_threshold()).
      * @note If at least one send request has been sent, but the threshold is not reached within a set time period (e.g. timeout - see
      *  hailo_set_scheduler_timeout()), the scheduler will consider the network ready regardless.
      * @note Currently, setting the threshold for a specific network is not supported.
@@ -409,6 +433,142 @@ public:
      */
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name="") = 0;
 
+    /**
+     * Sets the latency deadline of the network - the maximum time a request should wait from the time it is sent until
+     * the scheduler runs it.
+     * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE, the scheduler chooses the network whose
+     * oldest pending request is closest to missing its deadline.
+     *
+     * @param[in]  deadline             Deadline in milliseconds. 0 means the network has no deadline.
+     * @param[in]  network_name         Network name for which to set the deadline.
+     *                                  If not passed, the deadline will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_DEADLINE.
+     * @note The default deadline is 0ms.
+     * @note Currently, setting the deadline for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name="") = 0;
+
+    /**
+     * Sets the share of the network in the device time.
+     * When the scheduling algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE, ready networks with the same priority
+     * get device time in proportion to their shares.
+     *
+     * @param[in]  share                Share of the network. Must be larger than 0.
+     * @param[in]  network_name         Network name for which to set the share.
+     *                                  If not passed, the share will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is ::HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE.
+     * @note The default share is HAILO_SCHEDULER_SHARE_DEFAULT.
+     * @note Currently, setting the share for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name="") = 0;
+
+    /**
+     * Sets the devices on which the scheduler may run the network.
+     *
+     * @param[in]  device_mask          Bit i of the mask refers to the i-th device of the vdevice (in the order of
+     *                                  VDevice::get_physical_devices_ids()). Must contain at least one device of the vdevice.
+     * @param[in]  network_name         Network name for which to set the device affinity.
+     *                                  If not passed, the device affinity will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note The default device mask is HAILO_SCHEDULER_ALL_DEVICES_MASK.
+     * @note Currently, setting the device affinity for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name="") = 0;
+
+    /**
+     * Sets the sticky placement policy of the network. A sticky network that is loaded on one of the devices is not
+     * loaded on another device, unless that device has nothing else to run.
+     *
+     * @param[in]  is_sticky            Whether the network is sticky.
+     * @param[in]  network_name         Network name for which to set the policy.
+     *                                  If not passed, the policy will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note By default networks are not sticky.
+     * @note Currently, setting the policy for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name="") = 0;
+
+    /**
+     * Pins the network to a device of the vdevice - the device runs only the network, which streams to it without the
+     * scheduling decisions between bursts, while the other networks are scheduled on the other devices of the vdevice.
+     *
+     * @param[in]  device_index         Index of the device (in the order of VDevice::get_physical_devices_ids()), or
+     *                                  HAILO_SCHEDULER_NO_PINNED_DEVICE to unpin the network.
+     * @param[in]  network_name         Network name to pin.
+     *                                  If not passed, all the networks in the network group are pinned.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error
+     *         (::HAILO_INVALID_OPERATION if the device is pinned to another network).
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note A pinned network runs only on its device, regardless of its device affinity.
+     * @note Currently, pinning a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name="") = 0;
+
+    /**
+     * Sets the bounds of the scheduler burst size of the network - the amount of frames the network keeps streaming
+     * to a device before the scheduler considers switching to another network. Within the bounds, the burst size
+     * adapts to the observed queue depth and frames inter-arrival time of the network.
+     *
+     * @param[in]  min_burst_size       Minimum burst size (frames).
+     * @param[in]  max_burst_size       Maximum burst size (frames). Must be equal or greater than @a min_burst_size.
+     * @param[in]  network_name         Network name for which to set the burst size bounds.
+     *                                  If not passed, the bounds will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note Passing HAILO_SCHEDULER_BURST_SIZE_DEFAULT as both bounds restores the default (fixed) burst size.
+     * @note Currently, setting the burst size bounds for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name="") = 0;
+
+    /**
+     * Sets the batch size the scheduler runs the network with, without re-configuring it. The resources of the network
+     * are allocated for the batch size it was configured with, so any batch size up to it may be set.
+     *
+     * @param[in]  batch_size           Batch size - between 1 and the batch size the network group was configured with.
+     * @param[in]  network_name         Network name for which to set the batch size.
+     *                                  If not passed, the batch size will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note Supported only for networks configured with a batch size greater than 1 on a multi-context HEF.
+     * @note The new batch size applies from the next time the scheduler switches to the network.
+     * @note Currently, setting the batch size for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name="") = 0;
+
+    /**
+     * Sets the scheduler overload policy of the network - what the scheduler does with a new frame when the network
+     * already has @a max_pending_frames frames waiting to be sent to a device. Shed frames are completed with
+     * ::HAILO_FRAME_DROPPED (or ::HAILO_QUEUE_IS_FULL, for ::HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT).
+     *
+     * @param[in]  policy               The overload policy.
+     * @param[in]  max_pending_frames   Frames that may wait to be sent to a device before the policy applies. Ignored
+     *                                  for ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE, otherwise must be greater than 0.
+     * @param[in]  network_name         Network name for which to set the overload policy.
+     *                                  If not passed, the policy will be set for all the networks in the network group.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note The default policy is ::HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE.
+     * @note Currently, setting the overload policy for a specific network is not supported.
+     */
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name="") = 0;
+
+    /**
+     * @param[in]  network_name         Network name for which to get the stats.
+     *                                  If not passed, the stats of all the networks in the network group are returned.
+     * @return Upon success, returns Expected of the amount of frames shed by the scheduler overload policy of the
+     *  network. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note Using this function is only allowed when scheduling_algorithm is not ::HAILO_SCHEDULING_ALGORITHM_NONE.
+     * @note Currently, getting the stats of a specific network is not supported.
+     */
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name="") = 0;
+
     /**
      * @return Is the network group multi-context or not.
      */
@@ -421,6 +581,11 @@ public:
 
     virtual AccumulatorPtr get_activation_time_accumulator() const = 0;
     virtual AccumulatorPtr get_deactivation_time_accumulator() const = 0;
+    /**
+     * @return The durations of the stages of the network group's configuration (summed over the devices of a vdevice).
+     * @note Not supported when working with HailoRT Service.
+     */
+    virtual Expected<ConfigureStagesDurations> get_configure_stages_durations() const;
 
     virtual Expected<std::vector<InputVStream>> create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params) = 0;
     virtual Expected<std::vector<OutputVStream>> create_output_vstreams(const std::map<std::string, hailo_vstream_params_t> &outputs_params) = 0;
@@ -453,10 +618,17 @@ public:
     virtual hailo_status set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold) = 0;
     virtual hailo_status set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class) = 0;
     virtual hailo_status set_nms_max_accumulated_mask_size(const std::string &edge_name, uint32_t max_accumulated_mask_size) = 0;
+    virtual hailo_status set_nms_max_bboxes_total(const std::string &edge_name, uint32_t max_bboxes_total) = 0;
+    virtual hailo_status set_nms_classes_filter(const std::string &edge_name, const std::vector<uint32_t> &classes) = 0;
 
     virtual hailo_status init_cache(uint32_t read_offset, int32_t write_offset_delta) = 0;
     virtual Expected<hailo_cache_info_t> get_cache_info() const = 0;
     virtual hailo_status update_cache_offset(int32_t offset_delta_bytes) = 0;
+    // Copies the caches (and their offsets) to host memory, so they may later be restored by restore_caches (e.g. when
+    // switching between sessions). Must not be called while inferring.
+    virtual Expected<CacheSnapshot> snapshot_caches() = 0;
+    // Overrides the caches (and their offsets) with a snapshot taken by snapshot_caches. Must not be called while inferring.
+    virtual hailo_status restore_caches(const CacheSnapshot &snapshot) = 0;
 
 protected:
     ConfiguredNetworkGroup();
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file post_process_op.hpp
+ * @brief Runs a network group's post-process op standalone, outside of the inference pipelines.
+ **/
+
+#ifndef _HAILO_POST_PROCESS_OP_HPP_
+#define _HAILO_POST_PROCESS_OP_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/buffer.hpp"
+#include "hailo/expected.hpp"
+#include "hailo/network_group.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+namespace net_flow
+{
+class Op;
+}
+
+/*!
+ * \class PostProcessOp
+ * \brief A post-process op of a network group (NMS of the YOLO/SSD decoders, softmax or argmax), running on host
+ * buffers.
+ *
+ * The ops run in the inference pipelines (vstreams, InferModel) are also usable on their own, for example over raw
+ * outputs read from the output streams. Each op is created from the op's metadata, returned by
+ * ConfiguredNetworkGroup::get_ops_metadata().
+ *
+ * \note An op is not thread safe - ops running concurrently should be created for each thread.
+ */
+class HAILORTAPI PostProcessOp final {
+public:
+    /**
+     * Creates a standalone post-process op.
+     *
+     * @param op_metadata       The metadata of the op, returned by ConfiguredNetworkGroup::get_ops_metadata(). The
+     *                          metadata is copied, so later changes to the network group's metadata (e.g. the NMS
+     *                          thresholds) don't affect the op.
+     * @param output_format     The format of the op's output. Auto fields are set by the op's type.
+     *
+     * @return Upon success, returns the op. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note IoU ops aren't supported.
+     */
+    static Expected<std::shared_ptr<PostProcessOp>> create(const net_flow::PostProcessOpMetadataPtr &op_metadata,
+        const hailo_format_t &output_format);
+
+    PostProcessOp(const PostProcessOp &) = delete;
+    PostProcessOp &operator=(const PostProcessOp &) = delete;
+
+    /**
+     * @return The name of the op.
+     */
+    std::string name() const;
+
+    /**
+     * @return The names of the op's inputs (the names of the output streams the op runs on).
+     */
+    std::vector<std::string> get_input_names() const;
+
+    /**
+     * @return The size of a frame of the input @a input_name, in bytes.
+     */
+    Expected<size_t> get_input_frame_size(const std::string &input_name) const;
+
+    /**
+     * @return The format of the input @a input_name, as the op expects it.
+     */
+    Expected<hailo_format_t> get_input_format(const std::string &input_name) const;
+
+    /**
+     * @return The info of the op's output (its name, shape or NMS shape, and format).
+     */
+    Expected<hailo_vstream_info_t> get_output_vstream_info() const;
+
+    /**
+     * @return The size of a frame of the op's output, in bytes.
+     */
+    Expected<size_t> get_output_frame_size() const;
+
+    /**
+     * Runs the op over a single frame.
+     *
+     * @param[in] inputs        A map between the names of the op's inputs and the frames of the inputs.
+     * @param[in] output        The buffer the output frame is written to, of get_output_frame_size() bytes.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    hailo_status execute(const std::map<std::string, MemoryView> &inputs, MemoryView output);
+
+    PostProcessOp(std::shared_ptr<net_flow::Op> op, const hailo_vstream_info_t &output_vstream_info);
+
+private:
+    std::shared_ptr<net_flow::Op> m_op;
+    hailo_vstream_info_t m_output_vstream_info;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_POST_PROCESS_OP_HPP_ */
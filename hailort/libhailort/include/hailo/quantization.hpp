@@ -15,6 +15,7 @@
 
 #include <math.h>
 #include <fenv.h>
+#include <string.h>
 
 static const float32_t INVALID_QP_VALUE = 0;
 
@@ -130,6 +131,26 @@ public:
         }
     }
 
+    /**
+     * De-quantize in place the output buffer pointed by @a dst_ptr starting from @a offset from data type @a Q to float16
+     * (::HAILO_FORMAT_TYPE_FLOAT16).
+     *
+     * @param[inout] dst_ptr                A pointer to the buffer to be de-quantized.
+     * @param[in] offset                    The offset in @a dst_ptr array to start from.
+     * @param[in] buffer_elements_count     The number of elements in @a dst_ptr array.
+     * @param[in] qp_zp                     Quantization zero point.
+     * @param[in] qp_scale                  Quantization scale.
+     */
+    template <typename Q>
+    static void dequantize_output_buffer_to_float16_in_place(uint16_t *dst_ptr, uint32_t offset,
+        uint32_t buffer_elements_count, float32_t qp_zp, float32_t qp_scale)
+    {
+        for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
+            dst_ptr[offset + i] = float32_to_float16(
+                dequantize_output<float32_t, Q>(*((Q*)dst_ptr + offset + i), qp_zp, qp_scale));
+        }
+    }
+
     /**
      * Quantize input buffer pointed by @a src_ptr of data type @a T, into the buffer pointed by @a dst_ptr of data type @a Q.
      * 
@@ -229,6 +250,129 @@ public:
         return (T)((number - qp_zp) * qp_scale);
     }
 
+    /** The number of entries in a de-quantization lookup table - one for each of the possible uint8 values. */
+    static const uint32_t DEQUANTIZATION_LUT_SIZE = 256;
+
+    /**
+     * Fills @a lut with the de-quantized values of all the possible uint8 values, so that @a lut[i] is the de-quantized
+     * value of i.
+     *
+     * @param[in] quant_info               Quantization info.
+     * @param[out] lut                     A pointer to a lookup table of ::DEQUANTIZATION_LUT_SIZE elements.
+     */
+    template <typename T>
+    static inline void create_dequantization_lut(const hailo_quant_info_t &quant_info, T *lut)
+    {
+        for (uint32_t i = 0; i < DEQUANTIZATION_LUT_SIZE; i++) {
+            lut[i] = dequantize_output<T, uint8_t>(static_cast<uint8_t>(i), quant_info);
+        }
+    }
+
+    /**
+     * De-quantize the uint8 output buffer pointed by @a src_ptr into the buffer pointed by @a dst_ptr of data type @a T,
+     * using a lookup table created by create_dequantization_lut().
+     *
+     * @param[in] src_ptr                   A pointer to the buffer containing the data that will be de-quantized.
+     * @param[out] dst_ptr                  A pointer to the buffer that will contain the output de-quantized data.
+     * @param[in] buffer_elements_count     The number of elements in @a src_ptr and @a dst_ptr arrays.
+     * @param[in] lut                       A pointer to a lookup table of ::DEQUANTIZATION_LUT_SIZE elements.
+     */
+    template <typename T>
+    static inline void dequantize_output_buffer_by_lut(const uint8_t *src_ptr, T *dst_ptr, uint32_t buffer_elements_count,
+        const T *lut)
+    {
+        for (uint32_t i = 0; i < buffer_elements_count; i++) {
+            dst_ptr[i] = lut[src_ptr[i]];
+        }
+    }
+
+    /**
+     * Converts @a number to float16 (IEEE 754 half precision, as stored in a ::HAILO_FORMAT_TYPE_FLOAT16 buffer),
+     * rounding to nearest even. Numbers out of the float16 range are converted to infinity.
+     *
+     * @param[in] number                   The value to be converted.
+     *
+     * @return Returns the bits of the float16 value.
+     */
+    static inline uint16_t float32_to_float16(float32_t number)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &number, sizeof(bits));
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+        const uint32_t abs_bits = bits & 0x7FFFFFFF;
+
+        if (abs_bits >= 0x7F800000) {
+            // Infinity, or a (quiet) NaN
+            return static_cast<uint16_t>(sign | 0x7C00 | ((abs_bits > 0x7F800000) ? 0x200 : 0));
+        }
+        if (abs_bits >= 0x477FF000) {
+            // Rounds to 65520 or above (the max float16 is 65504)
+            return static_cast<uint16_t>(sign | 0x7C00);
+        }
+        if (abs_bits <= 0x33000000) {
+            // Rounds to zero (up to 2^-25 - half of the min float16 subnormal)
+            return sign;
+        }
+
+        uint32_t result = 0;
+        uint32_t remainder = 0;
+        uint32_t half = 0;
+        if (abs_bits < 0x38800000) {
+            // A float16 subnormal (below 2^-14) - in units of 2^-24
+            const uint32_t shift = 126 - (abs_bits >> 23);
+            const uint32_t mantissa = (abs_bits & 0x7FFFFF) | 0x800000;
+            result = mantissa >> shift;
+            remainder = mantissa & ((1u << shift) - 1);
+            half = 1u << (shift - 1);
+        } else {
+            // Re-bias the exponent (127 -> 15) and drop the 13 low mantissa bits
+            result = (abs_bits - 0x38000000) >> 13;
+            remainder = abs_bits & 0x1FFF;
+            half = 0x1000;
+        }
+        // A carry to the exponent is the correct rounding as well
+        if ((remainder > half) || ((remainder == half) && (result & 1))) {
+            result++;
+        }
+        return static_cast<uint16_t>(sign | result);
+    }
+
+    /**
+     * Converts the float16 @a number (IEEE 754 half precision, as stored in a ::HAILO_FORMAT_TYPE_FLOAT16 buffer) to
+     * float32.
+     *
+     * @param[in] number                   The bits of the float16 value.
+     *
+     * @return Returns the float32 value of @a number.
+     */
+    static inline float32_t float16_to_float32(uint16_t number)
+    {
+        const uint32_t sign = static_cast<uint32_t>(number & 0x8000) << 16;
+        const uint32_t exponent = (number >> 10) & 0x1F;
+        uint32_t mantissa = number & 0x3FF;
+
+        uint32_t bits = 0;
+        if (0x1F == exponent) {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        } else if (0 != exponent) {
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        } else if (0 != mantissa) {
+            // A subnormal - normalized for float32
+            uint32_t float_exponent = 113;
+            while (0 == (mantissa & 0x400)) {
+                mantissa <<= 1;
+                float_exponent--;
+            }
+            bits = sign | (float_exponent << 23) | ((mantissa & 0x3FF) << 13);
+        } else {
+            bits = sign;
+        }
+
+        float32_t result = 0;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
     static inline float32_t clip(float32_t n, float32_t limval_min, float32_t limval_max)
     {
         if (n >= limval_max) {
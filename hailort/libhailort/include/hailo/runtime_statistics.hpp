@@ -15,6 +15,7 @@
 
 #include <type_traits>
 #include <memory>
+#include <string>
 
 /** hailort namespace */
 namespace hailort
@@ -190,6 +191,31 @@ private:
 };
 using AccumulatorPtr = std::shared_ptr<Accumulator<double>>;
 
+/*! Latency percentiles collected by a latency histogram. All durations are in milliseconds. */
+struct LatencyHistogramResults
+{
+    /** Number of measurements added to the histogram */
+    size_t count = 0;
+    double min_ms = 0;
+    double mean_ms = 0;
+    double p50_ms = 0;
+    double p90_ms = 0;
+    double p99_ms = 0;
+    double p999_ms = 0;
+    double max_ms = 0;
+};
+
+/*! Latency breakdown of a single pipeline element */
+struct PipelineElementLatencyResults
+{
+    /** The name of the pipeline element */
+    std::string element_name;
+    /** Time spent by the element processing a frame (not measured for queue elements) */
+    LatencyHistogramResults processing_time;
+    /** Time a frame waited in the element's queue before being processed (measured for queue elements only) */
+    LatencyHistogramResults wait_time;
+};
+
 } /* namespace hailort */
 
 #endif /* _HAILO_RUNTIME_STATISTICS_HPP_ */
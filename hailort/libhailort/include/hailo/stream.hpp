@@ -154,6 +154,19 @@ public:
      */
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout);
 
+    /**
+     * Returns a handle that is signaled while the stream is ready to launch a new write_async() operation (i.e. while
+     * wait_for_async_ready() wouldn't block), so the readiness can be polled with other handles. On Linux, the handle
+     * is an eventfd that is readable (POLLIN) while the stream is ready - it can be added to an epoll set.
+     * The handle is also signaled once the stream is aborted or deactivated, so the pending operation fails fast.
+     *
+     * @return Upon success, returns Expected of the handle. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note The handle is owned by the stream and is valid as long as the stream exists. It must only be waited
+     *       on - reading, writing or closing it breaks the stream's readiness signaling.
+     * @note As with wait_for_async_ready(), the stream can't be used with the sync API afterwards.
+     */
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle();
+
     /**
      * Returns the maximum amount of frames that can be simultaneously written to the stream (by write_async() calls)
      * before any one of the write operations is complete, as signified by @a user_callback being called.
@@ -473,6 +486,19 @@ public:
      */
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout);
 
+    /**
+     * Returns a handle that is signaled while the stream is ready to launch a new read_async() operation (i.e. while
+     * wait_for_async_ready() wouldn't block), so the readiness can be polled with other handles. On Linux, the handle
+     * is an eventfd that is readable (POLLIN) while the stream is ready - it can be added to an epoll set.
+     * The handle is also signaled once the stream is aborted or deactivated, so the pending operation fails fast.
+     *
+     * @return Upon success, returns Expected of the handle. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note The handle is owned by the stream and is valid as long as the stream exists. It must only be waited
+     *       on - reading, writing or closing it breaks the stream's readiness signaling.
+     * @note As with wait_for_async_ready(), the stream can't be used with the sync API afterwards.
+     */
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle();
+
     /**
      * Returns the maximum amount of frames that can be simultaneously read from the stream (by read_async() calls)
      * before any one of the read operations is complete, as signified  by @a user_callback being called.
@@ -38,12 +38,16 @@ public:
      * @param[in] dst_format               The format of the dst buffer that receives the transformed data.
      * @param[in] dst_quant_infos          A vector of ::hailo_quant_info_t object containing quantization information per feature.
      *                                     Might also contain a vector with a single ::hailo_quant_info_t object.
+     * @param[in] max_threads_count        The maximum amount of threads transforming a frame. Large frames are split into
+     *                                     tiles of rows, transformed in parallel on a thread pool shared by all the transform
+     *                                     contexts. 1 (the default) transforms the frames on the calling thread only.
      * @return Upon success, returns Expected of a pointer to InputTransformContext.
      *         Otherwise, returns Unexpected of ::hailo_status error.
      */
     static Expected<std::unique_ptr<InputTransformContext>> create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos);
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos,
+        uint32_t max_threads_count = 1);
 
     /**
      * Creates input transform_context.
@@ -153,11 +157,14 @@ public:
     virtual std::string description() const;
 
 private:
+    using ReorderFunc = hailo_status (*)(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+        hailo_3d_image_shape_t dst_image_shape);
+
     InputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer &&quant_buffer,
         Buffer &&transpose_buffer, const bool should_quantize, const bool should_transpose, const bool should_reorder,
-        const bool should_pad_periph);
+        const bool should_pad_periph, ReorderFunc reorder_func, uint32_t max_threads_count);
 
     inline MemoryView quant_buffer() {
         return MemoryView(m_quant_buffer);
@@ -183,6 +190,10 @@ private:
     const bool m_should_transpose;
     const bool m_should_reorder;
     const bool m_should_pad_periph;
+    // Whether the frames are quantized and reordered row by row (see quantize_and_reorder_input_by_rows)
+    const bool m_should_quantize_and_reorder_by_rows;
+    const ReorderFunc m_reorder_func;
+    const uint32_t m_max_threads_count;
 
     Buffer m_quant_buffer;
     Buffer m_transpose_buffer;
@@ -208,12 +219,17 @@ public:
      * @param[in] dst_quant_infos          A vector of ::hailo_quant_info_t object containing quantization information per feature.
      *                                     Might also contain a vector with a single ::hailo_quant_info_t object.
      * @param[in] nms_info                 A ::hailo_nms_info_t object containing nms information.
+     * @param[in] max_threads_count        The maximum amount of threads transforming a frame. Large frames are split into
+     *                                     tiles of rows, transformed in parallel on a thread pool shared by all the transform
+     *                                     contexts. 1 (the default) transforms the frames on the calling thread only.
+     *                                     Ignored for NMS outputs.
      * @return Upon success, returns Expected of a pointer to OutputTransformContext.
      *         Otherwise, returns Unexpected of ::hailo_status error.
      */
     static Expected<std::unique_ptr<OutputTransformContext>> create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info);
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info,
+        uint32_t max_threads_count = 1);
 
     /**
      * Creates output transform_context.
@@ -339,6 +355,28 @@ protected:
     const bool m_should_pad_periph;
 };
 
+/*! Chunks of a demuxed edge inside a muxed frame */
+struct HAILORTAPI DemuxStridedRegion
+{
+    /** Offset of the first chunk from the start of the muxed frame (in bytes) */
+    size_t offset;
+    /** Size of each chunk (in bytes) */
+    size_t chunk_size;
+    /** Distance between the starts of two consecutive chunks (in bytes) */
+    size_t stride;
+    /** Amount of chunks */
+    size_t chunks_count;
+};
+
+/*! Location of the data of a demuxed edge inside a muxed frame */
+struct HAILORTAPI DemuxEdgeView
+{
+    /** The edge's stream info */
+    hailo_stream_info_t edge_info;
+    /** The edge's data (as written by OutputDemuxer::transform_demux) is the concatenation of the chunks of the regions, in order */
+    std::vector<DemuxStridedRegion> regions;
+};
+
 /*! Object used to demux muxed stream */
 class HAILORTAPI OutputDemuxer {
 public:
@@ -382,6 +420,15 @@ public:
      */
     virtual hailo_status transform_demux(const MemoryView src, std::vector<MemoryView> &raw_buffers) = 0;
 
+    /**
+     * Returns where the data of each edge is found inside a muxed frame, so consumers that handle strided data may read
+     * the edges directly from the muxed frame, instead of copying them with transform_demux().
+     * The views don't depend on the frame's content, so the same views describe all the frames of the stream.
+     * 
+     * @return The edges views, in the order returned from the function 'get_edges_stream_info()'.
+     */
+    virtual const std::vector<DemuxEdgeView> &get_edges_views() const = 0;
+
     const size_t src_frame_size;
 
 protected:
@@ -16,12 +16,33 @@
 #include "hailo/network_group.hpp"
 #include "hailo/device.hpp"
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 
 /** hailort namespace */
 namespace hailort
 {
 
 class InferModel;
+class InferModelBase;
+class AsyncPipelineExecutor;
+class HostMemoryAccountant;
+
+/** The host memory allocated for one of the models configured on a VDevice */
+struct HAILORTAPI HostMemoryUsage
+{
+    /** The name of the model (the name of its network group) */
+    std::string owner;
+    /** Regular host memory, in bytes */
+    size_t heap_size = 0;
+    /** Host memory allocated for DMA transfers to/from the device, in bytes */
+    size_t dma_size = 0;
+};
+
 /*! Represents a bundle of physical devices. */
 class HAILORTAPI VDevice
 {
@@ -106,6 +127,35 @@ public:
      */
     virtual Expected<std::vector<std::string>> get_physical_devices_ids() const = 0;
 
+    /**
+     * Adds the physical device @a device_id to the running vdevice. The network groups configured on the vdevice are
+     * configured on the added device, and the scheduler starts sending frames to it once they are.
+     *
+     * @param[in] device_id     The id of the device to add.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Supported only if the vdevice was created with hailo_vdevice_params_t::allow_devices_hot_plug set.
+     * @note The added device takes the lowest device index that isn't used by another device of the vdevice (see
+     *       ConfiguredNetworkGroup::set_scheduler_device_affinity()). Buffers mapped using dma_map() before the device
+     *       was added are mapped on it on each transfer.
+     */
+    virtual hailo_status add_device(const std::string &device_id);
+
+    /**
+     * Removes the physical device @a device_id from the running vdevice. The scheduler stops sending frames to the
+     * device, and waits up to @a timeout for the frames in flight on it to be done before releasing it. Frames that are
+     * still in flight after the timeout are aborted (completed with ::HAILO_STREAM_ABORT). The frames queued on the
+     * vdevice are sent to the other devices.
+     *
+     * @param[in] device_id     The id of the device to remove.
+     * @param[in] timeout       The time to wait for the frames in flight on the device.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Supported only if the vdevice was created with hailo_vdevice_params_t::allow_devices_hot_plug set.
+     * @note The last device of the vdevice can't be removed. The devices returned by get_physical_devices() before
+     *       the removal must not be used once it is done.
+     */
+    virtual hailo_status remove_device(const std::string &device_id,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(HAILO_DEFAULT_DEVICE_REMOVAL_TIMEOUT_MS));
+
     /**
      * Gets the stream's default interface.
      *
@@ -207,6 +257,29 @@ public:
      */
     virtual hailo_status dma_unmap_dmabuf(int dmabuf_fd, size_t size, hailo_dma_buffer_direction_t direction) = 0;
 
+    /**
+     * Sets a budget for the host memory allocated for the models configured on this vdevice through InferModel::configure.
+     * A model is configured with smaller buffer pools (i.e. a shorter async queue - see
+     * ConfiguredInferModel::get_async_queue_size()) if its default pools don't fit in the budget, and its configuration
+     * fails with ::HAILO_OUT_OF_HOST_MEMORY if not even the smallest pools fit.
+     *
+     * @param[in] budget    The budget in bytes, for all of the models together. 0 means unlimited (the default).
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The budget doesn't affect models that are already configured. The memory mapped by the driver for the
+     *       descriptors lists, and user buffers mapped with dma_map(), are not accounted.
+     */
+    hailo_status set_host_memory_budget(size_t budget);
+
+    /**
+     * Returns the host memory currently allocated for each of the models configured on this vdevice through
+     * InferModel::configure.
+     *
+     * @return Upon success, returns Expected of a vector of HostMemoryUsage, one per model.
+     *         Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    Expected<std::vector<HostMemoryUsage>> get_host_memory_usage();
+
     virtual hailo_status before_fork();
     virtual hailo_status after_fork_in_parent();
     virtual hailo_status after_fork_in_child();
@@ -222,6 +295,24 @@ public:
 
 protected:
     VDevice() = default;
+
+private:
+    friend class InferModelBase;
+
+    // Returns the executor running the async pipelines of the infer models configured on this vdevice (created on the
+    // first call), or nullptr if the executor is disabled.
+    Expected<std::shared_ptr<AsyncPipelineExecutor>> get_async_pipeline_executor();
+
+    // Returns the accountant of the host memory allocated for the infer models configured on this vdevice (created on
+    // the first call)
+    Expected<std::shared_ptr<HostMemoryAccountant>> get_host_memory_accountant();
+
+    std::mutex m_async_pipeline_executor_mutex;
+    std::shared_ptr<AsyncPipelineExecutor> m_async_pipeline_executor;
+    bool m_is_async_pipeline_executor_created = false;
+
+    std::mutex m_host_memory_accountant_mutex;
+    std::shared_ptr<HostMemoryAccountant> m_host_memory_accountant;
 };
 
 } /* namespace hailort */
@@ -54,6 +54,17 @@ public:
      */
     hailo_status write(const hailo_pix_buffer_t &buffer);
 
+    /**
+     * Writes the frames in @a buffers to hailo device, one frame per buffer.
+     * The vstream activation is validated once for the whole batch, rather than once per frame.
+     *
+     * @param[in] buffers           The buffers containing the data to be sent to device. Each buffer holds a single
+     *                              frame, with the format and shape described in write().
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note On failure, some of the frames may have already been sent.
+     */
+    hailo_status write_batch(const std::vector<MemoryView> &buffers);
+
     /**
      * Flushes the vstream pipeline buffers. This will block until the vstream pipeline is clear.
      *
@@ -218,6 +229,19 @@ public:
      */
     hailo_status read(MemoryView buffer);
 
+    /**
+     * Reads frames from hailo device into @a buffers, one frame per buffer.
+     * The buffers are handed to the vstream pipeline together, so the frames are read back-to-back without waiting for
+     * the user between frames.
+     *
+     * @param[in] buffers           The buffers to read data into. Each buffer holds a single frame, with the format and
+     *                              shape described in read().
+     * @param[in] timeout           The time to wait for all the frames to be read.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note On failure, the vstream should be cleared (see clear()) before reading from it again.
+     */
+    hailo_status read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout);
+
     /**
      * Clears the vstreams' pipeline buffers.
      *
@@ -370,6 +394,19 @@ public:
      */
     hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+    /**
+     * Changes the format of the buffers returned by the vstream (e.g. its format type or order), without rebuilding the
+     * vstream pipeline. The frames read after this call are returned in the new format, and the frames that were
+     * already read from the device but not yet returned to the user are not lost.
+     *
+     * @param[in] user_buffer_format    The new user buffer format. Its type and order must not be AUTO.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note This function must not be called while a read is in progress.
+     * This function will fail in cases where the output vstream doesn't transform the frames on the CPU.
+     * The frame size of the vstream may change - get_frame_size() should be called after this function.
+     */
+    hailo_status set_user_buffer_format(const hailo_format_t &user_buffer_format);
+
 
     bool is_aborted();
 
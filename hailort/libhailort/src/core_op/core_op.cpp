@@ -27,6 +27,26 @@
 namespace hailort
 {
 
+// The inputs are indexed first and then the outputs, each by the order of their names
+static std::map<std::string, size_t> get_stream_indices(const ConfigureNetworkParams &config_params)
+{
+    size_t inputs_count = 0;
+    for (const auto &stream_params : config_params.stream_params_by_name) {
+        if (HAILO_H2D_STREAM == stream_params.second.direction) {
+            inputs_count++;
+        }
+    }
+
+    std::map<std::string, size_t> stream_indices;
+    size_t input_index = 0;
+    size_t output_index = inputs_count;
+    for (const auto &stream_params : config_params.stream_params_by_name) {
+        const bool is_input = (HAILO_H2D_STREAM == stream_params.second.direction);
+        stream_indices.emplace(stream_params.first, is_input ? input_index++ : output_index++);
+    }
+    return stream_indices;
+}
+
 CoreOp::CoreOp(
     const ConfigureNetworkParams &config_params, std::shared_ptr<CoreOpMetadata> metadata,
     ActiveCoreOpHolder &active_core_op_holder, hailo_status &status, bool is_scheduled) :
@@ -36,7 +56,8 @@ CoreOp::CoreOp(
         m_activation_time_accumulator(),
         m_deactivation_time_accumulator(),
         m_metadata(metadata),
-        m_vdevice_core_op_handle(INVALID_CORE_OP_HANDLE)
+        m_vdevice_core_op_handle(INVALID_CORE_OP_HANDLE),
+        m_stream_indices(get_stream_indices(config_params))
 {
     if (!is_scheduled) {
         auto event = Event::create_shared(Event::State::not_signalled);
@@ -73,6 +94,29 @@ Expected<std::chrono::nanoseconds> get_latency(LatencyMeterPtr &latency_meter, b
     return hw_latency;
 }
 
+static void merge_latency_histogram(LatencyMeasurementResult &result, LatencyMeterPtr &latency_meter)
+{
+    // Must be read before the latency, which may clear the histogram
+    auto histogram = latency_meter->get_latency_histogram();
+    if (!histogram) {
+        return;
+    }
+
+    auto &merged = result.hw_latency_histogram;
+    if (0 == merged.count) {
+        merged = histogram.value();
+        return;
+    }
+    merged.count += histogram->count;
+    merged.min_ms = std::min(merged.min_ms, histogram->min_ms);
+    merged.mean_ms = std::max(merged.mean_ms, histogram->mean_ms);
+    merged.p50_ms = std::max(merged.p50_ms, histogram->p50_ms);
+    merged.p90_ms = std::max(merged.p90_ms, histogram->p90_ms);
+    merged.p99_ms = std::max(merged.p99_ms, histogram->p99_ms);
+    merged.p999_ms = std::max(merged.p999_ms, histogram->p999_ms);
+    merged.max_ms = std::max(merged.max_ms, histogram->max_ms);
+}
+
 /* Network group base functions */
 Expected<LatencyMeasurementResult> CoreOp::get_latency_measurement(const std::string &network_name)
 {
@@ -88,6 +132,7 @@ Expected<LatencyMeasurementResult> CoreOp::get_latency_measurement(const std::st
         std::chrono::nanoseconds latency_sum(0);
         uint32_t measurements_count = 0;
         for (auto &latency_meter_pair : *latency_meters.get()) {
+            merge_latency_histogram(result, latency_meter_pair.second);
             auto hw_latency = get_latency(latency_meter_pair.second, clear);
             if (HAILO_NOT_AVAILABLE == hw_latency.status()) {
                 continue;
@@ -106,6 +151,7 @@ Expected<LatencyMeasurementResult> CoreOp::get_latency_measurement(const std::st
             LOGGER__DEBUG("No latency measurements was found for network {}", network_name);
             return make_unexpected(HAILO_NOT_FOUND);
         }
+        merge_latency_histogram(result, latency_meters->at(network_name));
         TRY_WITH_ACCEPTABLE_STATUS(HAILO_NOT_AVAILABLE, const auto hw_latency,
             get_latency(latency_meters->at(network_name), clear));
 
@@ -388,6 +434,12 @@ Expected<Buffer> CoreOp::get_intermediate_buffer(const IntermediateBufferKey &)
     return make_unexpected(HAILO_NOT_SUPPORTED);
 }
 
+Expected<ConfigureStagesDurations> CoreOp::get_configure_stages_durations() const
+{
+    LOGGER__ERROR("Getting the configure stages durations is not supported for this core op");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 Expected<Buffer> CoreOp::get_cache_buffer(uint32_t)
 {
     LOGGER__ERROR("Getting cache buffer is not supported for this core op");
@@ -400,6 +452,12 @@ Expected<std::map<uint32_t, Buffer>> CoreOp::get_cache_buffers()
     return make_unexpected(HAILO_NOT_SUPPORTED);
 }
 
+hailo_status CoreOp::write_cache_buffers(const std::map<uint32_t, Buffer> &)
+{
+    LOGGER__ERROR("Writing cache buffers is not supported for this core op");
+    return HAILO_NOT_SUPPORTED;
+}
+
 hailo_status CoreOp::wrap_streams_for_remote_process()
 {
     for (auto &input_stream_pair : m_input_streams) {
@@ -442,21 +500,35 @@ hailo_status CoreOp::infer_async(InferRequest &&request)
     state->callbacks_left = request.transfers.size();
     state->status = HAILO_SUCCESS; // Success oriented, on any failure, modify this
 
-    auto transfers_copy = request.transfers;
-    auto status = infer_async_impl(transfers_copy, state, request.callback);
+    auto transfers_copy = std::move(request.transfers);
+    size_t launched_count = 0;
+    auto status = infer_async_impl(transfers_copy, launched_count, state, request.callback);
     if (HAILO_SUCCESS != status) {
-        // infer_async_impl remove all launched transfers from transfer_copy. Here, we finish all callbacks left
-        for (auto &transfer : transfers_copy) {
-            transfer.second.callback(status);
+        // The transfers after the launched ones weren't launched. Here, we finish all callbacks left
+        for (size_t i = launched_count; i < transfers_copy.size(); i++) {
+            transfers_copy[i].callback(status);
         }
         // Note: See `CoreOp::infer_async` docs
         return HAILO_SUCCESS;
     }
-    assert(transfers_copy.empty());
+    assert(launched_count == transfers_copy.size());
 
     return HAILO_SUCCESS;
 }
 
+Expected<size_t> CoreOp::get_stream_index(const std::string &stream_name) const
+{
+    auto stream_index = m_stream_indices.find(stream_name);
+    CHECK_AS_EXPECTED(m_stream_indices.end() != stream_index, HAILO_NOT_FOUND, "Stream {} not found in core op {}",
+        stream_name, name());
+    return Expected<size_t>(stream_index->second);
+}
+
+size_t CoreOp::get_streams_count() const
+{
+    return m_config_params.stream_params_by_name.size();
+}
+
 bool CoreOp::is_multi_context() const
 {
     return m_metadata->supported_features().multi_context;
@@ -507,43 +579,45 @@ Expected<std::shared_ptr<InputStreamBase>> CoreOp::create_input_stream_from_conf
     return input_stream;
 }
 
-hailo_status CoreOp::infer_async_impl(std::unordered_map<std::string, TransferRequest> &transfers,
+hailo_status CoreOp::infer_async_impl(std::vector<TransferRequest> &transfers, size_t &launched_count,
     std::shared_ptr<OngoingInferState> state, TransferDoneCallback done_callback)
 {
-    for ( auto &name_to_transfer : transfers) {
-        name_to_transfer.second.callback = wrap_user_callback(std::move(name_to_transfer.second.callback), state, done_callback);
+    for (auto &transfer : transfers) {
+        transfer.callback = wrap_user_callback(std::move(transfer.callback), state, done_callback);
     }
 
+    launched_count = 0;
     for (auto &input : m_input_streams) {
-        auto transfer = transfers.find(input.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", input.second->name());
-
-        CHECK(input.second->get_frame_size() == transfer->second.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
-            "for input '{}', passed buffer size is {} (expected {})", input.first, transfer->second.get_total_transfer_size(),
+        auto &transfer = transfers[launched_count];
+        CHECK(input.second->get_frame_size() == transfer.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
+            "for input '{}', passed buffer size is {} (expected {})", input.first, transfer.get_total_transfer_size(),
             input.second->get_frame_size());
 
-        auto status = input.second->write_async(TransferRequest{transfer->second});
+        // The transfer is kept until it is launched, since a failed launch doesn't call its callback
+        auto status = input.second->write_async(transfer.copy());
         if (HAILO_STREAM_ABORT == status) {
             return status;
         }
         CHECK_SUCCESS(status);
-        transfers.erase(transfer);
+        // The launched stream holds its own copy, the callback captures are released along with it
+        transfer = TransferRequest();
+        launched_count++;
     }
 
     for (auto &output : m_output_streams) {
-        auto transfer = transfers.find(output.second->name());
-        CHECK(transfer != transfers.end(), HAILO_INTERNAL_FAILURE, "Invalid stream {}", output.second->name());
-
-        CHECK(output.second->get_frame_size() == transfer->second.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
-            "for output '{}', passed buffer size is {} (expected {})", output.first, transfer->second.get_total_transfer_size(),
+        auto &transfer = transfers[launched_count];
+        CHECK(output.second->get_frame_size() == transfer.get_total_transfer_size(), HAILO_INVALID_ARGUMENT,
+            "for output '{}', passed buffer size is {} (expected {})", output.first, transfer.get_total_transfer_size(),
             output.second->get_frame_size());
 
-        auto status = output.second->read_async(TransferRequest{transfer->second});
+        auto status = output.second->read_async(transfer.copy());
         if (HAILO_STREAM_ABORT == status) {
             return status;
         }
         CHECK_SUCCESS(status);
-        transfers.erase(transfer);
+        // The launched stream holds its own copy, the callback captures are released along with it
+        transfer = TransferRequest();
+        launched_count++;
     }
 
     return HAILO_SUCCESS;
@@ -65,6 +65,18 @@ public:
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout, const std::string &network_name) = 0;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold, const std::string &network_name) = 0;
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) = 0;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) = 0;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) = 0;
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() = 0;
 
     virtual Expected<InputStreamRefVector> get_input_streams_by_network(const std::string &network_name="");
@@ -101,8 +113,11 @@ public:
     bool is_default_batch_size() const;
 
     virtual Expected<Buffer> get_intermediate_buffer(const IntermediateBufferKey &key);
+    virtual Expected<ConfigureStagesDurations> get_configure_stages_durations() const;
     virtual Expected<Buffer> get_cache_buffer(uint32_t cache_id);
     virtual Expected<std::map<uint32_t, Buffer>> get_cache_buffers();
+    // Overrides the content of the given caches (cache id -> content)
+    virtual hailo_status write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers);
 
     hailo_status wrap_streams_for_remote_process();
 
@@ -111,6 +126,12 @@ public:
 
     Expected<size_t> get_async_max_queue_size() const;
 
+    // The streams are indexed by their order in m_input_streams followed by m_output_streams (both are sorted by name,
+    // and are created from stream_params_by_name), so the transfers of an InferRequest are addressed by index.
+    // The index is resolved once (e.g. when the stream is created), and is the same in all the core ops of a vdevice.
+    Expected<size_t> get_stream_index(const std::string &stream_name) const;
+    size_t get_streams_count() const;
+
     /**
      * The function returns `HAILO_SUCCESS` if at least one of the writes or reads happened.
      * This assures that all the callbacks will be called: The callbacks per transfer and the `infer_request` callback.
@@ -119,7 +140,7 @@ public:
      * Neither the transfers callbacks nor the `infer_request` callback.
      *
      */
-    hailo_status infer_async(InferRequest &&request);
+    virtual hailo_status infer_async(InferRequest &&request);
 
     virtual bool has_caches() const = 0;
     virtual Expected<uint32_t> get_cache_read_size() const = 0;
@@ -163,9 +184,9 @@ private:
     };
 
     // Launch write_async/read_async on all streams with wrapped callback.
-    // We remove all transfer that was launched successfully from transfers in order to call those callback
-    // with HAILO_STREAM_ABORT status on the case of a failure.
-    hailo_status infer_async_impl(std::unordered_map<std::string, TransferRequest> &transfers,
+    // The transfers are launched by the order of their index, launched_count is the amount of transfers that were
+    // launched successfully - in order to call the callbacks of the rest with the failure status.
+    hailo_status infer_async_impl(std::vector<TransferRequest> &transfers, size_t &launched_count,
         std::shared_ptr<OngoingInferState> state,
          TransferDoneCallback done_callback);
     TransferDoneCallback wrap_user_callback(TransferDoneCallback &&original_callback,
@@ -180,6 +201,8 @@ private:
     AccumulatorPtr m_deactivation_time_accumulator;
     std::shared_ptr<CoreOpMetadata> m_metadata;
     vdevice_core_op_handle_t m_vdevice_core_op_handle;
+    // The index of each stream (see get_stream_index)
+    const std::map<std::string, size_t> m_stream_indices;
 
     Expected<std::shared_ptr<InputStreamBase>> create_vdma_input_stream(Device &device, const std::string &stream_name,
         const LayerInfo &layer_info, const hailo_stream_parameters_t &stream_params);
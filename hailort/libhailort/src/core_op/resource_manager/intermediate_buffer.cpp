@@ -41,19 +41,12 @@ Expected<IntermediateBuffer> IntermediateBuffer::create(HailoRTDriver &driver, u
         d2h_channel_id, streaming_type));
 
     if (streaming_type == StreamingType::BURST) {
-        // We have max_batch_size transfers, so we program them one by one. The last transfer should report interrupt
-        // to the device.
-        size_t desc_acc_offset = 0;
-        size_t buffer_acc_offset = 0;
-        for (uint16_t i = 0; i < max_batch_size; i++) {
-            const auto last_desc_interrupts_domain = ((max_batch_size - 1) == i) ?
-                InterruptsDomain::DEVICE : InterruptsDomain::NONE;
-            TRY(const auto desc_count_local, edge_layer_ptr->program_descriptors(transfer_size,
-                last_desc_interrupts_domain, desc_acc_offset, buffer_acc_offset),
-                "Failed to program descs for inter context channels. Given max_batch_size is too big.");
-            desc_acc_offset += desc_count_local;
-            buffer_acc_offset += (desc_count_local * edge_layer_ptr->desc_page_size());
-        }
+        // We have max_batch_size transfers, programmed back to back (with a single driver call). The last transfer
+        // should report interrupt to the device.
+        TRY(const auto desc_count_local, edge_layer_ptr->program_transfers_descriptors(transfer_size, max_batch_size,
+            InterruptsDomain::DEVICE),
+            "Failed to program descs for inter context channels. Given max_batch_size is too big.");
+        (void)desc_count_local;
     } else {
         // Program all descriptors, no need for interrupt.
         const auto interrupts_domain = InterruptsDomain::NONE;
@@ -152,9 +145,10 @@ Expected<std::unique_ptr<vdma::VdmaEdgeLayer>> IntermediateBuffer::create_sg_edg
     static const auto DONT_FORCE_DEFAULT_PAGE_SIZE = false;
     static const auto FORCE_BATCH_SIZE = true;
     static const auto IS_VDMA_ALIGNED_BUFFER = true;
+    const auto is_huge_pages_backed = vdma::SgBuffer::should_use_huge_pages_for_internal_buffers();
     TRY(const auto buffer_requirements, vdma::BufferSizesRequirements::get_buffer_requirements_single_transfer(
         vdma::VdmaBuffer::Type::SCATTER_GATHER, driver.desc_max_page_size(), batch_size, batch_size, transfer_size,
-        is_circular, DONT_FORCE_DEFAULT_PAGE_SIZE, FORCE_BATCH_SIZE, IS_VDMA_ALIGNED_BUFFER));
+        is_circular, DONT_FORCE_DEFAULT_PAGE_SIZE, FORCE_BATCH_SIZE, IS_VDMA_ALIGNED_BUFFER, is_huge_pages_backed));
     const auto desc_page_size = buffer_requirements.desc_page_size();
     const auto descs_count = buffer_requirements.descs_count();
     const auto buffer_size = buffer_requirements.buffer_size();
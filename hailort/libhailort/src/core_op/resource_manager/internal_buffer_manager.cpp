@@ -20,6 +20,7 @@
 
 
 #include <numeric>
+#include <algorithm>
 
 namespace hailort
 {
@@ -166,7 +167,8 @@ hailo_status InternalBufferManager::add_config_buffer_info(const uint16_t contex
 Expected<std::shared_ptr<vdma::VdmaBuffer>> InternalBufferManager::create_intermediate_sg_buffer(
     const size_t buffer_size)
 {
-    TRY(auto buffer, vdma::SgBuffer::create(m_driver, buffer_size, HailoRTDriver::DmaDirection::BOTH));
+    TRY(auto buffer, vdma::SgBuffer::create(m_driver, buffer_size, HailoRTDriver::DmaDirection::BOTH,
+        vdma::SgBuffer::should_use_huge_pages_for_internal_buffers()));
 
     auto buffer_ptr = make_shared_nothrow<vdma::SgBuffer>(std::move(buffer));
     CHECK_NOT_NULL_AS_EXPECTED(buffer_ptr, HAILO_OUT_OF_HOST_MEMORY);
@@ -189,10 +191,70 @@ Expected<std::shared_ptr<vdma::VdmaBuffer>> InternalBufferManager::create_interm
 Expected<std::shared_ptr<vdma::VdmaBuffer>> InternalBufferManager::create_intermediate_buffer(
     vdma::VdmaBuffer::Type &buffer_type, const size_t buffer_size)
 {
-    if (vdma::VdmaBuffer::Type::CONTINUOUS == buffer_type) {
-        return create_intermediate_ccb_buffer(buffer_size);
+    const auto create_buffer = [this, buffer_type, buffer_size]() -> Expected<std::shared_ptr<vdma::VdmaBuffer>> {
+        if (vdma::VdmaBuffer::Type::CONTINUOUS == buffer_type) {
+            return create_intermediate_ccb_buffer(buffer_size);
+        }
+        return create_intermediate_sg_buffer(buffer_size);
+    };
+
+    if (!SharedInternalBuffersPool::should_share_internal_buffers()) {
+        return create_buffer();
+    }
+
+    // The core-op's edge layers may not alias each other
+    std::vector<std::shared_ptr<vdma::VdmaBuffer>> used_buffers;
+    used_buffers.reserve(m_edge_layer_to_buffer_map.size());
+    for (const auto &edge_layer_buffer : m_edge_layer_to_buffer_map) {
+        used_buffers.emplace_back(edge_layer_buffer.second.buffer);
     }
-    return create_intermediate_sg_buffer(buffer_size);
+
+    return SharedInternalBuffersPool::get_instance().acquire(m_driver, buffer_type, buffer_size, used_buffers,
+        create_buffer);
+}
+
+SharedInternalBuffersPool &SharedInternalBuffersPool::get_instance()
+{
+    static SharedInternalBuffersPool instance;
+    return instance;
+}
+
+bool SharedInternalBuffersPool::should_share_internal_buffers()
+{
+    static const bool share_internal_buffers = (nullptr != std::getenv(SHARE_INTERNAL_BUFFERS_ENV_VAR));
+    return share_internal_buffers;
+}
+
+Expected<std::shared_ptr<vdma::VdmaBuffer>> SharedInternalBuffersPool::acquire(HailoRTDriver &driver,
+    vdma::VdmaBuffer::Type buffer_type, size_t buffer_size,
+    const std::vector<std::shared_ptr<vdma::VdmaBuffer>> &excluded_buffers,
+    const std::function<Expected<std::shared_ptr<vdma::VdmaBuffer>>()> &create_buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &device_buffers = m_buffers_per_device[&driver];
+    device_buffers.erase(std::remove_if(device_buffers.begin(), device_buffers.end(),
+        [](const std::weak_ptr<vdma::VdmaBuffer> &buffer) { return buffer.expired(); }), device_buffers.end());
+
+    std::shared_ptr<vdma::VdmaBuffer> best_fit_buffer = nullptr;
+    for (const auto &weak_buffer : device_buffers) {
+        auto buffer = weak_buffer.lock();
+        if ((nullptr == buffer) || (buffer->type() != buffer_type) || (buffer->size() < buffer_size) ||
+                (excluded_buffers.end() != std::find(excluded_buffers.begin(), excluded_buffers.end(), buffer))) {
+            continue;
+        }
+        if ((nullptr == best_fit_buffer) || (buffer->size() < best_fit_buffer->size())) {
+            best_fit_buffer = buffer;
+        }
+    }
+
+    if (nullptr != best_fit_buffer) {
+        LOGGER__DEBUG("Sharing internal buffer of size {} for a buffer of size {}", best_fit_buffer->size(), buffer_size);
+        return best_fit_buffer;
+    }
+
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_OUT_OF_HOST_CMA_MEMORY, auto buffer, create_buffer());
+    device_buffers.emplace_back(buffer);
+    return buffer;
 }
 
 void InternalBufferManager::print_execution_results(const BufferPlanReport &default_planner_report,
@@ -201,8 +263,9 @@ void InternalBufferManager::print_execution_results(const BufferPlanReport &defa
     if (!default_planner_meet_requirements) {
         LOGGER__INFO("Default Internal buffer planner failed to meet requirements");
     } else {
-        LOGGER__INFO("Planned internal buffer memory: CMA memory {}, user memory {}. memory to edge layer usage factor is {}",
-            default_planner_report.cma_memory, default_planner_report.user_memory, default_planner_report.memory_utilization_factor);
+        LOGGER__INFO("Planned internal buffer memory: CMA memory {}, user memory {} (lower bound {}). memory to edge layer usage factor is {}",
+            default_planner_report.cma_memory, default_planner_report.user_memory, default_planner_report.lower_bound_memory,
+            default_planner_report.memory_utilization_factor);
     }
 
     auto default_plan_executed = (default_planner_report.cma_memory == executed_buffers_report.cma_memory) &&
@@ -22,11 +22,39 @@
 #include "vdma/memory/vdma_buffer.hpp"
 #include "internal_buffer_planner.hpp"
 
+#include <functional>
+#include <mutex>
+
 
 namespace hailort
 {
 
 #define MAX_EDGE_LAYERS_PER_CONTEXT (20)
+#define SHARE_INTERNAL_BUFFERS_ENV_VAR ("HAILO_SHARE_INTERNAL_BUFFERS_BETWEEN_CORE_OPS")
+
+// Internal buffers shared by the core-ops configured on the same device. Only one core-op is activated on a device at a
+// time, and the content of the inter-context and ddr buffers doesn't outlive the batch it was written in, so the
+// core-ops may alias each other's buffers. Used only if SHARE_INTERNAL_BUFFERS_ENV_VAR is set.
+class SharedInternalBuffersPool final
+{
+public:
+    static SharedInternalBuffersPool &get_instance();
+    static bool should_share_internal_buffers();
+
+    // Returns the smallest buffer of the device with the given type and at least buffer_size bytes that isn't one of
+    // excluded_buffers (the buffers the core-op already uses), creating a new one if there's none.
+    Expected<std::shared_ptr<vdma::VdmaBuffer>> acquire(HailoRTDriver &driver, vdma::VdmaBuffer::Type buffer_type,
+        size_t buffer_size, const std::vector<std::shared_ptr<vdma::VdmaBuffer>> &excluded_buffers,
+        const std::function<Expected<std::shared_ptr<vdma::VdmaBuffer>>()> &create_buffer);
+
+private:
+    SharedInternalBuffersPool() = default;
+
+    std::mutex m_mutex;
+    // The buffers are released once no core-op uses them
+    std::map<const HailoRTDriver*, std::vector<std::weak_ptr<vdma::VdmaBuffer>>> m_buffers_per_device;
+};
+
 
 class InternalBufferManager final
 {
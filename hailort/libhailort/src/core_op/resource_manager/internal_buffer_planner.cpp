@@ -11,11 +11,17 @@
   **/
 
 #include "vdma/memory/buffer_requirements.hpp"
+#include "vdma/memory/sg_buffer.hpp"
 #include "internal_buffer_planner.hpp"
 
 #include <numeric>
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <string>
 
 constexpr size_t NAIVE_PLANNING_EDGE_LAYER_OFFSET = 0;
+constexpr size_t MAX_CACHED_BUFFER_PLANNINGS = 64;
 
 // Macro that check status. If status is HAILO_CANT_MEET_BUFFER_REQUIREMENTS, return without printing error to the prompt.
 #define CHECK_STATUS_CANT_MEET_REQUIREMENTS(status) if (HAILO_CANT_MEET_BUFFER_REQUIREMENTS == status) {return make_unexpected(status);} CHECK_SUCCESS(status);
@@ -97,6 +103,7 @@ Expected<InternalBufferPlanning> InternalBufferPlanner::create_naive_buffer_plan
                 buffer_type,
                 buffer_requirements.buffer_size(),
                 buffer_requirements.buffer_size(),
+                buffer_requirements.buffer_size(),
                 edge_layer_offsets,
                 plan_edge_layer_infos});
     }
@@ -123,10 +130,13 @@ Expected<vdma::BufferSizesRequirements> InternalBufferPlanner::return_buffer_req
     static const auto FORCE_BATCH_SIZE = true;
     static const auto IS_VDMA_ALIGNED_BUFFER = true;
     const auto is_circular = (LayerType::DDR == edge_layer.type);
+    // Must match the requirements IntermediateBuffer uses for the edge layer
+    const auto is_huge_pages_backed = (vdma::VdmaBuffer::Type::SCATTER_GATHER == buffer_type) &&
+        (LayerType::CFG != edge_layer.type) && vdma::SgBuffer::should_use_huge_pages_for_internal_buffers();
     auto buffer_requirements = vdma::BufferSizesRequirements::get_buffer_requirements_single_transfer(
         buffer_type, max_page_size, edge_layer.max_transfers_in_batch,
         edge_layer.max_transfers_in_batch, edge_layer.transfer_size, is_circular, DONT_FORCE_DEFAULT_PAGE_SIZE,
-        FORCE_BATCH_SIZE, IS_VDMA_ALIGNED_BUFFER);
+        FORCE_BATCH_SIZE, IS_VDMA_ALIGNED_BUFFER, is_huge_pages_backed);
     return buffer_requirements;
 }
 
@@ -173,8 +183,9 @@ size_t InternalBufferPlanner::find_new_buffer_offset(const ContextBufferUsageSeg
     const auto aligned_max_size =  DIV_ROUND_UP(max_size, buffer_offset_alignment) * buffer_offset_alignment;
     for (auto it = unified_buffers.begin(); it != unified_buffers.end(); ++it) {
         const auto aligned_end_of_buffer =  DIV_ROUND_UP((it->offset + it->size), buffer_offset_alignment) * buffer_offset_alignment;
-        // Calculate the gap between the current buffer and the next buffer
-        size_t gap = ((it + 1 != unified_buffers.end()) ? ((it + 1)->offset) : (max_size)) - aligned_end_of_buffer;
+        // Calculate the gap between the current buffer and the next buffer (none if the aligned end passes it)
+        const size_t next_buffer_offset = (it + 1 != unified_buffers.end()) ? ((it + 1)->offset) : (max_size);
+        const size_t gap = (next_buffer_offset > aligned_end_of_buffer) ? (next_buffer_offset - aligned_end_of_buffer) : 0;
 
         // If the gap is large enough to hold the new buffer, insert the new buffer there
         if (gap >= new_buffer_size) {
@@ -186,6 +197,30 @@ size_t InternalBufferPlanner::find_new_buffer_offset(const ContextBufferUsageSeg
     return aligned_max_size;
 }
 
+size_t InternalBufferPlanner::find_best_fit_buffer_offset(const ContextBufferUsageSegments& unified_buffers,
+    size_t new_buffer_size, uint16_t buffer_offset_alignment)
+{
+    // Go over the gaps between the (sorted and merged) used segments, and take the smallest gap the new buffer fits in.
+    // If it fits in none, it's placed after the last segment.
+    size_t gap_start = 0;
+    size_t best_fit_offset = 0;
+    size_t best_fit_gap_size = std::numeric_limits<size_t>::max();
+    for (const auto &segment : unified_buffers) {
+        if (segment.offset >= gap_start) {
+            const auto gap_size = segment.offset - gap_start;
+            if ((gap_size >= new_buffer_size) && (gap_size < best_fit_gap_size)) {
+                best_fit_gap_size = gap_size;
+                best_fit_offset = gap_start;
+            }
+        }
+        const auto aligned_end_of_segment = DIV_ROUND_UP(segment.offset + segment.size, buffer_offset_alignment) *
+            buffer_offset_alignment;
+        gap_start = std::max(gap_start, aligned_end_of_segment);
+    }
+
+    return (std::numeric_limits<size_t>::max() != best_fit_gap_size) ? best_fit_offset : gap_start;
+}
+
 std::vector<BufferUsageSegment> InternalBufferPlanner::build_availibility_map(
     const std::vector<ContextBufferUsageSegments> &context_buffer_usage_vector, uint16_t start_context, uint16_t end_context)
 {
@@ -242,22 +277,18 @@ hailo_status InternalBufferPlanner::add_edge_layer_to_planning(
     return HAILO_SUCCESS;
 }
 
-Expected<InternalBufferPlanning> InternalBufferPlanner::create_single_buffer_planning(
-    const std::map<EdgeLayerKey, EdgeLayerInfo> &sg_edge_layers, size_t number_of_contexts,
+Expected<BufferPlan> InternalBufferPlanner::create_first_fit_buffer_plan(
+    const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layers, size_t number_of_contexts,
     const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size)
 {
-    InternalBufferPlanning buffer_planning;
-    // Trying to reserve one buffer only.
-    buffer_planning.reserve(1);
     // Allocate plan for one buffer
-    BufferPlan buffer_plan;
-    // Buffer type is SG
+    BufferPlan buffer_plan{};
     buffer_plan.buffer_type = buffer_type;
     // Init buffer with size 0
     buffer_plan.buffer_size = 0;
     buffer_plan.total_edge_layer_size = 0;
 
-    auto sorted_edge_layer_vector = sort_edge_layers_by_size(sg_edge_layers);
+    auto sorted_edge_layer_vector = sort_edge_layers_by_size(edge_layers);
     std::vector<std::vector<BufferUsageSegment>> context_buffer_usage_vector(number_of_contexts);
 
     for (auto &edge_layer : sorted_edge_layer_vector) {
@@ -265,8 +296,99 @@ Expected<InternalBufferPlanning> InternalBufferPlanner::create_single_buffer_pla
         CHECK_STATUS_CANT_MEET_REQUIREMENTS(status);
     }
 
-    // Update buffer planning
-    buffer_planning.emplace_back(buffer_plan);
+    return buffer_plan;
+}
+
+Expected<BufferPlan> InternalBufferPlanner::create_best_fit_buffer_plan(
+    const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layers, size_t number_of_contexts,
+    const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size)
+{
+    struct PlannedEdgeLayer {
+        std::pair<EdgeLayerKey, EdgeLayerInfo> edge_layer;
+        size_t size;
+        uint16_t alignment;
+    };
+
+    std::vector<PlannedEdgeLayer> planned_edge_layers;
+    planned_edge_layers.reserve(edge_layers.size());
+    for (const auto &edge_layer : edge_layers) {
+        TRY_WITH_ACCEPTABLE_STATUS(HAILO_CANT_MEET_BUFFER_REQUIREMENTS, const auto buffer_requirements,
+            return_buffer_requirements(edge_layer.second, buffer_type, max_page_size));
+        planned_edge_layers.emplace_back(PlannedEdgeLayer{edge_layer, buffer_requirements.buffer_size(),
+            buffer_requirements.desc_page_size()});
+    }
+
+    // Best fit decreasing - place the biggest buffers first (the ones used in more contexts first between buffers of the
+    // same size), each in the smallest gap it fits in during its contexts.
+    std::sort(planned_edge_layers.begin(), planned_edge_layers.end(),
+        [](const PlannedEdgeLayer &a, const PlannedEdgeLayer &b) {
+            if (a.size != b.size) {
+                return a.size > b.size;
+            }
+            const auto a_contexts_count = a.edge_layer.second.end_context - a.edge_layer.second.start_context;
+            const auto b_contexts_count = b.edge_layer.second.end_context - b.edge_layer.second.start_context;
+            if (a_contexts_count != b_contexts_count) {
+                return a_contexts_count > b_contexts_count;
+            }
+            return a.edge_layer.first < b.edge_layer.first;
+        });
+
+    BufferPlan buffer_plan{};
+    buffer_plan.buffer_type = buffer_type;
+    buffer_plan.buffer_size = 0;
+    buffer_plan.total_edge_layer_size = 0;
+
+    std::vector<std::vector<BufferUsageSegment>> context_buffer_usage_vector(number_of_contexts);
+    for (const auto &planned_edge_layer : planned_edge_layers) {
+        const auto &edge_layer = planned_edge_layer.edge_layer;
+        const auto start_context = edge_layer.second.start_context;
+        const auto end_context = edge_layer.second.end_context;
+        const auto buffer_map = build_availibility_map(context_buffer_usage_vector, start_context, end_context);
+        const auto buffer_offset = find_best_fit_buffer_offset(buffer_map, planned_edge_layer.size,
+            planned_edge_layer.alignment);
+
+        buffer_plan.buffer_size = std::max(buffer_offset + planned_edge_layer.size, buffer_plan.buffer_size);
+        buffer_plan.total_edge_layer_size += planned_edge_layer.size;
+        buffer_plan.edge_layer_offsets.emplace_back(edge_layer.first, buffer_offset);
+        buffer_plan.edge_layer_infos.emplace(edge_layer.first, edge_layer.second);
+
+        update_buffer_to_context_map(context_buffer_usage_vector, start_context, end_context, buffer_offset,
+            planned_edge_layer.size);
+    }
+
+    // The edge layers used in the same context can't overlap
+    std::vector<size_t> context_used_sizes(number_of_contexts, 0);
+    for (const auto &planned_edge_layer : planned_edge_layers) {
+        for (auto context_index = planned_edge_layer.edge_layer.second.start_context;
+                context_index <= planned_edge_layer.edge_layer.second.end_context; context_index++) {
+            context_used_sizes[context_index] += planned_edge_layer.size;
+        }
+    }
+    buffer_plan.lower_bound_buffer_size = context_used_sizes.empty() ? 0 :
+        *std::max_element(context_used_sizes.begin(), context_used_sizes.end());
+
+    return buffer_plan;
+}
+
+Expected<InternalBufferPlanning> InternalBufferPlanner::create_single_buffer_planning(
+    const std::map<EdgeLayerKey, EdgeLayerInfo> &sg_edge_layers, size_t number_of_contexts,
+    const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size)
+{
+    // Neither placement order is always better, so both plans are made and the smaller one is taken (the first fit plan
+    // on a tie, as it was the only planning before).
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_CANT_MEET_BUFFER_REQUIREMENTS, auto first_fit_plan,
+        create_first_fit_buffer_plan(sg_edge_layers, number_of_contexts, buffer_type, max_page_size));
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_CANT_MEET_BUFFER_REQUIREMENTS, auto best_fit_plan,
+        create_best_fit_buffer_plan(sg_edge_layers, number_of_contexts, buffer_type, max_page_size));
+
+    LOGGER__DEBUG("Planned buffer of {} bytes with first fit, {} bytes with best fit (lower bound is {} bytes)",
+        first_fit_plan.buffer_size, best_fit_plan.buffer_size, best_fit_plan.lower_bound_buffer_size);
+
+    const auto lower_bound_buffer_size = best_fit_plan.lower_bound_buffer_size;
+    InternalBufferPlanning buffer_planning;
+    buffer_planning.emplace_back((best_fit_plan.buffer_size < first_fit_plan.buffer_size) ?
+        std::move(best_fit_plan) : std::move(first_fit_plan));
+    buffer_planning.back().lower_bound_buffer_size = lower_bound_buffer_size;
 
     return buffer_planning;
 }
@@ -304,17 +426,84 @@ Expected<InternalBufferPlanning> InternalBufferPlanner::create_optimized_buffer_
     return buffer_planning;
 }
 
+template<typename T>
+static void append_to_planning_key(std::string &key, const T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The planning key is built from plain values");
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// The key holds all the planning's arguments (and not a hash of them), so equal keys always mean equal plannings
+static std::string get_planning_key(const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layer_infos,
+    InternalBufferPlanner::Type plan_type, HailoRTDriver::DmaType dma_type, uint16_t max_page_size,
+    size_t number_of_contexts)
+{
+    std::string key;
+    append_to_planning_key(key, plan_type);
+    append_to_planning_key(key, dma_type);
+    append_to_planning_key(key, max_page_size);
+    append_to_planning_key(key, number_of_contexts);
+    for (const auto &edge_layer : edge_layer_infos) {
+        append_to_planning_key(key, edge_layer.first.first);
+        append_to_planning_key(key, edge_layer.first.second);
+        append_to_planning_key(key, edge_layer.second.type);
+        append_to_planning_key(key, edge_layer.second.transfer_size);
+        append_to_planning_key(key, edge_layer.second.max_transfers_in_batch);
+        append_to_planning_key(key, edge_layer.second.start_context);
+        append_to_planning_key(key, edge_layer.second.end_context);
+        append_to_planning_key(key, edge_layer.second.reuse_buffer);
+    }
+    return key;
+}
+
 Expected<InternalBufferPlanning> InternalBufferPlanner::create_buffer_planning(
     const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layer_infos, Type plan_type,
     HailoRTDriver::DmaType dma_type, uint16_t max_page_size, size_t number_of_contexts)
 {
-    static const bool FORCE_SG_BUFFER_TYPE = true;
     // Force plan by user flag
     if (nullptr != std::getenv("HAILO_FORCE_NAIVE_PER_BUFFER_TYPE_ALOCATION")) {
         LOGGER__INFO("Forced buffer planning of type 'NAIVE_PER_BUFFER_TYPE.");
         plan_type = Type::NAIVE_PER_BUFFER_TYPE;
     }
 
+    // Plannings that can't meet the requirements are kept as well, so the next planner type is tried right away
+    struct CachedPlanning {
+        hailo_status status;
+        InternalBufferPlanning planning;
+    };
+    static std::mutex cache_mutex;
+    static std::map<std::string, CachedPlanning> cache;
+
+    const auto key = get_planning_key(edge_layer_infos, plan_type, dma_type, max_page_size, number_of_contexts);
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto cached_planning = cache.find(key);
+        if (cache.end() != cached_planning) {
+            if (HAILO_SUCCESS != cached_planning->second.status) {
+                return make_unexpected(cached_planning->second.status);
+            }
+            return InternalBufferPlanning(cached_planning->second.planning);
+        }
+    }
+
+    auto buffer_planning = create_buffer_planning_impl(edge_layer_infos, plan_type, dma_type, max_page_size,
+        number_of_contexts);
+    if (buffer_planning || (HAILO_CANT_MEET_BUFFER_REQUIREMENTS == buffer_planning.status())) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (cache.size() >= MAX_CACHED_BUFFER_PLANNINGS) {
+            cache.clear();
+        }
+        cache.emplace(key, CachedPlanning{buffer_planning.status(),
+            buffer_planning ? buffer_planning.value() : InternalBufferPlanning()});
+    }
+    return buffer_planning;
+}
+
+Expected<InternalBufferPlanning> InternalBufferPlanner::create_buffer_planning_impl(
+    const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layer_infos, Type plan_type,
+    HailoRTDriver::DmaType dma_type, uint16_t max_page_size, size_t number_of_contexts)
+{
+    static const bool FORCE_SG_BUFFER_TYPE = true;
     switch (plan_type) {
     case Type::SINGLE_BUFFER_PER_BUFFER_TYPE:
         return create_optimized_buffer_planning(edge_layer_infos, dma_type, max_page_size, number_of_contexts);
@@ -335,8 +524,10 @@ BufferPlanReport InternalBufferPlanner::report_planning_info(const InternalBuffe
     report.cma_memory = 0;
     report.user_memory = 0;
     report.edge_layer_size = 0;
+    report.lower_bound_memory = 0;
 
     for (const auto &buffer_plan : buffer_planning) {
+        report.lower_bound_memory += buffer_plan.lower_bound_buffer_size;
         if (vdma::VdmaBuffer::Type::CONTINUOUS == buffer_plan.buffer_type) {
             report.cma_memory += buffer_plan.buffer_size;
         } else {
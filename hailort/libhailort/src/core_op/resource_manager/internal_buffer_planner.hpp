@@ -44,6 +44,8 @@ struct BufferPlan {
     vdma::VdmaBuffer::Type buffer_type;
     size_t buffer_size;
     size_t total_edge_layer_size;
+    // The largest total size of the edge layers used in a single context - no planning of the buffer can be smaller
+    size_t lower_bound_buffer_size;
     std::vector<std::pair<EdgeLayerKey, size_t>> edge_layer_offsets;
     std::map<EdgeLayerKey, EdgeLayerInfo> edge_layer_infos;
 };
@@ -52,6 +54,7 @@ struct BufferPlanReport {
     size_t cma_memory;
     size_t user_memory;
     size_t edge_layer_size;
+    size_t lower_bound_memory;
     float memory_utilization_factor;
 };
 
@@ -82,6 +85,8 @@ public:
     };
 
     // Planning functions
+    // The planning depends only on its arguments, so the plannings of recent edge layers are kept and returned again
+    // when configuring the same core-op (e.g. on each model switch).
     static Expected<InternalBufferPlanning> create_buffer_planning(
         const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layer_infos, Type plan_type,
         HailoRTDriver::DmaType dma_type, uint16_t max_page_size, size_t number_of_contexts);
@@ -102,6 +107,10 @@ public:
 
 private:
 
+    static Expected<InternalBufferPlanning> create_buffer_planning_impl(
+        const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layer_infos, Type plan_type,
+        HailoRTDriver::DmaType dma_type, uint16_t max_page_size, size_t number_of_contexts);
+
     // Helper functions
     static bool should_edge_layer_use_ccb(const LayerType &layer_type, HailoRTDriver::DmaType dma_type,
         bool force_sg_type_buffer);
@@ -118,6 +127,8 @@ private:
         ContextBufferUsageSegments& combined, const ContextBufferUsageSegments& added_buffers);
     static size_t find_new_buffer_offset(const ContextBufferUsageSegments& unified_buffers, size_t new_buffer_size,
         uint16_t buffer_offset_alignment);
+    static size_t find_best_fit_buffer_offset(const ContextBufferUsageSegments& unified_buffers, size_t new_buffer_size,
+        uint16_t buffer_offset_alignment);
     static std::vector<BufferUsageSegment> build_availibility_map(
         const std::vector<ContextBufferUsageSegments> &context_buffer_usage_vector, uint16_t start_context, uint16_t end_context);
     static hailo_status add_edge_layer_to_planning(const std::pair<EdgeLayerKey, EdgeLayerInfo> &edge_layer,
@@ -125,6 +136,12 @@ private:
         const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size);
 
 
+    static Expected<BufferPlan> create_first_fit_buffer_plan(
+        const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layers, size_t number_of_contexts,
+        const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size);
+    static Expected<BufferPlan> create_best_fit_buffer_plan(
+        const std::map<EdgeLayerKey, EdgeLayerInfo> &edge_layers, size_t number_of_contexts,
+        const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size);
     static Expected<InternalBufferPlanning> create_single_buffer_planning(
         const std::map<EdgeLayerKey, EdgeLayerInfo> &sg_edge_layers, size_t number_of_contexts,
         const vdma::VdmaBuffer::Type buffer_type, uint16_t max_page_size);
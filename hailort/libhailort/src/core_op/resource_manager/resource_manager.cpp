@@ -276,8 +276,14 @@ ResourcesManager::ResourcesManager(VdmaDevice &vdma_device, HailoRTDriver &drive
     m_config_channels_ids(std::move(config_channels_ids)),
     m_hw_only_boundary_buffers(),
     m_internal_buffer_manager(std::move(internal_buffer_manager)),
-    m_action_list_buffer_builder(std::move(action_list_buffer_builder))
-{}
+    m_action_list_buffer_builder(std::move(action_list_buffer_builder)),
+    m_configure_stages_durations()
+{
+    // add_new_context returns references into m_contexts_resources, which must stay valid while the next contexts are
+    // added (the ResourcesManagerBuilder adds all the dynamic contexts before filling them)
+    m_contexts_resources.reserve(m_core_op_metadata->dynamic_contexts().size() +
+        CONTROL_PROTOCOL__CONTEXT_SWITCH_NUMBER_OF_NON_DYNAMIC_CONTEXTS);
+}
 
 ResourcesManager::ResourcesManager(ResourcesManager &&other) noexcept :
     m_contexts_resources(std::move(other.m_contexts_resources)),
@@ -299,7 +305,8 @@ ResourcesManager::ResourcesManager(ResourcesManager &&other) noexcept :
     m_config_channels_ids(std::move(other.m_config_channels_ids)),
     m_hw_only_boundary_buffers(std::move(other.m_hw_only_boundary_buffers)),
     m_internal_buffer_manager(std::move(other.m_internal_buffer_manager)),
-    m_action_list_buffer_builder(std::move(other.m_action_list_buffer_builder))
+    m_action_list_buffer_builder(std::move(other.m_action_list_buffer_builder)),
+    m_configure_stages_durations(other.m_configure_stages_durations)
 {}
 
 hailo_status ResourcesManager::fill_infer_features(CONTROL_PROTOCOL__application_header_t &app_header)
@@ -473,7 +480,13 @@ hailo_status ResourcesManager::create_boundary_vdma_channel(const LayerInfo &lay
 
     TRY(auto vdma_transfer_launcher, m_vdma_device.get_vdma_transfer_launcher());
     TRY(auto channel, vdma::BoundaryChannel::create(m_driver, channel_id, channel_direction, std::move(desc_list),
-        vdma_transfer_launcher.get(), ongoing_transfers, pending_transfers, layer_info.name, latency_meter));
+        vdma_transfer_launcher.get(), ongoing_transfers, pending_transfers, layer_info.name, latency_meter,
+        m_vdma_device.get_mapped_buffers_cache()));
+
+    const auto stream_params = m_config_params.stream_params_by_name.find(layer_info.name);
+    if (stream_params != m_config_params.stream_params_by_name.end()) {
+        CHECK_SUCCESS(channel->set_interrupts_coalescing(stream_params->second.interrupts_coalescing));
+    }
 
     m_boundary_channels.add_channel(std::move(channel));
     return HAILO_SUCCESS;
@@ -643,6 +656,28 @@ Expected<std::map<uint32_t, Buffer>> ResourcesManager::read_cache_buffers()
     return result;
 }
 
+hailo_status ResourcesManager::write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers)
+{
+    auto &cache_buffers_map = m_cache_manager->get_cache_buffers();
+    // All the caches are validated first, so a bad snapshot won't leave the caches partially overridden
+    for (const auto &cache_buffer : cache_buffers) {
+        auto cache_buffer_it = cache_buffers_map.find(cache_buffer.first);
+        CHECK(std::end(cache_buffers_map) != cache_buffer_it, HAILO_NOT_FOUND,
+            "Failed to find cache buffer for cache_id {}", cache_buffer.first);
+        CHECK(cache_buffer.second.size() == cache_buffer_it->second.cache_size(), HAILO_INVALID_ARGUMENT,
+            "Invalid size {} for cache_id {} (expected {})", cache_buffer.second.size(), cache_buffer.first,
+            cache_buffer_it->second.cache_size());
+    }
+
+    for (const auto &cache_buffer : cache_buffers) {
+        auto status = cache_buffers_map.at(cache_buffer.first).write_entire_cache(MemoryView::create_const(
+            cache_buffer.second.data(), cache_buffer.second.size()));
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status ResourcesManager::configure()
 {
     CHECK(!m_is_configured, HAILO_INTERNAL_FAILURE, "Can't configure the same core-op twice");
@@ -195,6 +195,7 @@ public:
     Expected<Buffer> read_intermediate_buffer(const IntermediateBufferKey &key);
     Expected<Buffer> read_cache_buffer(uint32_t cache_id);
     Expected<std::map<uint32_t, Buffer>> read_cache_buffers();
+    hailo_status write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers);
 
     hailo_status configure();
     hailo_status enable_state_machine(uint16_t dynamic_batch_size,
@@ -240,6 +241,17 @@ public:
         return m_is_activated;
     }
 
+    // Set by the ResourcesManagerBuilder, which runs the stages of the configuration
+    void set_configure_stages_durations(const ConfigureStagesDurations &durations)
+    {
+        m_configure_stages_durations = durations;
+    }
+
+    const ConfigureStagesDurations &get_configure_stages_durations() const
+    {
+        return m_configure_stages_durations;
+    }
+
 private:
     hailo_status fill_infer_features(CONTROL_PROTOCOL__application_header_t &app_header);
     hailo_status fill_validation_features(CONTROL_PROTOCOL__application_header_t &app_header);
@@ -274,6 +286,7 @@ private:
     std::vector<std::shared_ptr<vdma::MappedBuffer>> m_hw_only_boundary_buffers;
     std::shared_ptr<InternalBufferManager> m_internal_buffer_manager;
     std::shared_ptr<ActionListBufferBuilder> m_action_list_buffer_builder;
+    ConfigureStagesDurations m_configure_stages_durations;
 
     ResourcesManager(VdmaDevice &vdma_device, HailoRTDriver &driver,
         ChannelAllocator &&channel_allocator, const ConfigureNetworkParams config_params,
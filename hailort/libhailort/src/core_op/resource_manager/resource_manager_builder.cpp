@@ -12,6 +12,9 @@
 #include "periph_calculator.hpp"
 #include "hef/hef_internal.hpp"
 #include "common/file_utils.hpp"
+#include "transform/transform_thread_pool.hpp"
+
+#include <algorithm>
 
 namespace hailort
 {
@@ -577,16 +580,53 @@ static std::set<std::pair<uint32_t, uint32_t>> get_indexes_of_action_type(
     return result;
 }
 
+// Writes the CCWs of the given actions into their config buffers. Unless pre-fetch is supported, the descriptors of each
+// write are programmed right after it - the amount of descriptors programmed for each WriteDataCcw action is returned
+// (in the actions' order), for fetching them in the action list.
+static Expected<std::vector<uint32_t>> write_ccws_to_config_buffers(
+    const std::vector<ContextSwitchConfigActionPtr> &configuration_actions, std::vector<ConfigBuffer> &config_resources,
+    bool support_pre_fetch)
+{
+    std::vector<uint32_t> ccws_desc_counts;
+    for (const auto &configuration_action : configuration_actions) {
+        if (ContextSwitchConfigAction::Type::WriteDataCcw != configuration_action->get_type()) {
+            continue;
+        }
+
+        auto &write_ccw_action = *static_cast<WriteDataCcwAction*>(configuration_action.get());
+        const auto config_stream_index = write_ccw_action.config_stream_index();
+        assert(config_stream_index < config_resources.size());
+        auto status = write_ccw_action.write_to_config_buffer(config_resources[config_stream_index], support_pre_fetch);
+        CHECK_SUCCESS(status);
+
+        uint32_t desc_count = 0;
+        if (!support_pre_fetch) {
+            TRY(desc_count, config_resources[config_stream_index].program_descriptors());
+        }
+        ccws_desc_counts.emplace_back(desc_count);
+    }
+
+    return ccws_desc_counts;
+}
+
+static bool supports_concurrent_ccws_writes(const std::vector<ContextSwitchConfigActionPtr> &configuration_actions)
+{
+    return std::all_of(configuration_actions.begin(), configuration_actions.end(),
+        [](const ContextSwitchConfigActionPtr &action) {
+            return (ContextSwitchConfigAction::Type::WriteDataCcw != action->get_type()) ||
+                static_cast<const WriteDataCcwAction&>(*action).supports_concurrent_writes();
+        });
+}
+
 static hailo_status push_fetch_config_actions(
     ConfigBuffer &config_resources, uint8_t config_stream_index,
-    uint16_t total_ccw_bursts, bool support_pre_fetch,
+    uint16_t total_ccw_bursts, bool support_pre_fetch, uint32_t desc_count,
     std::vector<ContextSwitchConfigActionPtr> &processed_configuration_actions)
 {
     if (support_pre_fetch) {
         TRY(const auto action, AddCcwBurstAction::create(config_stream_index, total_ccw_bursts));
         processed_configuration_actions.emplace_back(std::move(action));
     } else {
-        TRY(const auto desc_count, config_resources.program_descriptors());
         TRY(const auto action, FetchCfgChannelDescriptorsAction::create(config_resources.channel_id(), desc_count));
         processed_configuration_actions.emplace_back(std::move(action));
     }
@@ -594,26 +634,6 @@ static hailo_status push_fetch_config_actions(
     return HAILO_SUCCESS;
 }
 
-static hailo_status proccess_write_ccw_action(ContextSwitchConfigActionPtr &configuration_action,
-    std::vector<ConfigBuffer> &config_resources,
-    const bool support_pre_fetch,
-    std::vector<ContextSwitchConfigActionPtr> &processed_configuration_actions)
-{
-    assert(ContextSwitchConfigAction::Type::WriteDataCcw == configuration_action->get_type());
-    auto &write_ccw_action = *static_cast<WriteDataCcwAction*>(configuration_action.get());
-
-    const auto config_stream_index = write_ccw_action.config_stream_index();
-    assert(config_stream_index < config_resources.size());
-    auto status = write_ccw_action.write_to_config_buffer(config_resources[config_stream_index], support_pre_fetch);
-    CHECK_SUCCESS(status);
-
-    status = push_fetch_config_actions(config_resources[config_stream_index], config_stream_index,
-        write_ccw_action.total_ccw_burst(), support_pre_fetch, processed_configuration_actions);
-    CHECK_SUCCESS(status);
-
-    return HAILO_SUCCESS;
-}
-
 static Expected<uint8_t> find_dummy_stream(const LayerInfo &layer_info, const ContextResources &context_resources,
     const bool is_null_shmifo_supported)
 {
@@ -807,16 +827,24 @@ static hailo_status proccess_trigger_new_data_input_action(const HEFHwArch &hw_a
 }
 
 // At the end of each consecutive group of WriteDataCcwAction, a FetchCfgChannelDescriptorsAction is added.
+// Replaces the WriteDataCcw actions (already written by write_ccws_to_config_buffers) with the actions fetching them
 static hailo_status add_fetch_config_actions(std::vector<ContextSwitchConfigActionPtr> &configuration_actions,
-    std::vector<ConfigBuffer> &config_resources, bool support_pre_fetch)
+    std::vector<ConfigBuffer> &config_resources, bool support_pre_fetch, const std::vector<uint32_t> &ccws_desc_counts)
 {
     std::vector<ContextSwitchConfigActionPtr> processed_configuration_actions;
+    size_t ccw_index = 0;
     for (uint32_t action_index = 0; action_index < configuration_actions.size(); action_index++) {
         auto &configuration_action = configuration_actions[action_index];
         if (ContextSwitchConfigAction::Type::WriteDataCcw == configuration_action->get_type()) {
-            auto status = proccess_write_ccw_action(configuration_action, config_resources,
-                support_pre_fetch, processed_configuration_actions);
+            const auto &write_ccw_action = *static_cast<WriteDataCcwAction*>(configuration_action.get());
+            const auto config_stream_index = write_ccw_action.config_stream_index();
+            assert(config_stream_index < config_resources.size());
+            assert(ccw_index < ccws_desc_counts.size());
+            auto status = push_fetch_config_actions(config_resources[config_stream_index], config_stream_index,
+                write_ccw_action.total_ccw_burst(), support_pre_fetch, ccws_desc_counts[ccw_index],
+                processed_configuration_actions);
             CHECK_SUCCESS(status);
+            ccw_index++;
         } else {
             // Add the current action
             processed_configuration_actions.emplace_back(configuration_action);
@@ -983,7 +1011,7 @@ static hailo_status add_edge_layer_end_of_context_actions(const ContextResources
 static hailo_status fill_context_recipes_for_multi_context(const HEFHwArch &hw_arch,
     ContextResources &context_resources, ResourcesManager &resources_manager,
     uint16_t context_index, const CoreOpMetadata &core_op_metadata, const ContextMetadata &context_metadata,
-    bool is_single_context, bool is_last_context, bool caches_in_use)
+    bool is_single_context, bool is_last_context, bool caches_in_use, const std::vector<uint32_t> &ccws_desc_counts)
 {
     hailo_status status = HAILO_UNINITIALIZED;
 
@@ -995,7 +1023,8 @@ static hailo_status fill_context_recipes_for_multi_context(const HEFHwArch &hw_a
     std::vector<ContextSwitchConfigActionPtr> actions = context_metadata.get_actions();
 
     const auto support_pre_fetch = HailoRTCommon::is_hailo1x_device_type(DeviceBase::hef_arch_to_device_arch(hw_arch));
-    status = add_fetch_config_actions(actions, context_resources.get_config_buffers(), support_pre_fetch);
+    status = add_fetch_config_actions(actions, context_resources.get_config_buffers(), support_pre_fetch,
+        ccws_desc_counts);
     CHECK_SUCCESS(status);
 
     status = handle_edge_layer_activation_actions(hw_arch, actions, core_op_metadata, resources_manager,
@@ -1270,7 +1299,10 @@ static hailo_status fill_preliminary_config_recepies_for_multi_context(const HEF
     std::vector<ContextSwitchConfigActionPtr> actions = preliminary_context.get_actions();
 
     const auto support_pre_fetch = HailoRTCommon::is_hailo1x_device_type(DeviceBase::hef_arch_to_device_arch(hw_arch));
-    auto status = add_fetch_config_actions(actions, context_resources.get_config_buffers(), support_pre_fetch);
+    TRY(const auto ccws_desc_counts, write_ccws_to_config_buffers(actions, context_resources.get_config_buffers(),
+        support_pre_fetch));
+    auto status = add_fetch_config_actions(actions, context_resources.get_config_buffers(), support_pre_fetch,
+        ccws_desc_counts);
     CHECK_SUCCESS(status);
 
     if (resources_manager.get_supported_features().preliminary_run_asap) {
@@ -1304,6 +1336,7 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
             core_op_metadata->core_op_name(), network_params.first, HAILO_MAX_BATCH_SIZE);
     }
 
+    const auto buffers_allocation_start = std::chrono::steady_clock::now();
     TRY(auto resources_manager, ResourcesManager::create(device, driver, config_params, cache_manager,
         core_op_metadata, current_core_op_index));
 
@@ -1315,6 +1348,7 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
 
     status = resources_manager.fill_internal_buffers_info();
     CHECK_SUCCESS_AS_EXPECTED(status);
+    const auto resources_building_start = std::chrono::steady_clock::now();
 
     // No allocation of edge layers in the activation context. No need for context index here
     auto INVLID_CONTEXT_INDEX = static_cast<uint16_t>(UINT16_MAX);
@@ -1348,20 +1382,51 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
         "Caches are in use but the network is single context");
 
     const auto num_dynamic_contexts = core_op_metadata->dynamic_contexts().size();
+    std::vector<std::reference_wrapper<ContextResources>> dynamic_contexts;
+    dynamic_contexts.reserve(num_dynamic_contexts);
     for (size_t context_index = 0; context_index < num_dynamic_contexts; context_index++) {
         const auto &context_metadata = core_op_metadata->dynamic_contexts()[context_index];
         TRY(auto new_context, resources_manager.add_new_context(CONTROL_PROTOCOL__CONTEXT_SWITCH_CONTEXT_TYPE_DYNAMIC,
             static_cast<uint16_t>(FIRST_DYNAMIC_CONTEXT_INDEX + context_index), context_metadata.config_buffers_info()));
+        dynamic_contexts.emplace_back(new_context);
+    }
+
+    // Each context has its own config buffers, so the contexts' CCWs are written (and their descriptors programmed) in
+    // parallel. The rest of the contexts' resources are allocated from the resources manager, so they're filled by order.
+    const auto support_pre_fetch = HailoRTCommon::is_hailo1x_device_type(DeviceBase::hef_arch_to_device_arch(hw_arch));
+    const auto supports_concurrent_writes = std::all_of(core_op_metadata->dynamic_contexts().begin(),
+        core_op_metadata->dynamic_contexts().end(), [](const ContextMetadata &context_metadata) {
+            return supports_concurrent_ccws_writes(context_metadata.get_actions());
+        });
+    std::vector<std::vector<uint32_t>> ccws_desc_counts(num_dynamic_contexts);
+    status = TransformThreadPool::get_instance().run(num_dynamic_contexts,
+        supports_concurrent_writes ? num_dynamic_contexts : 1,
+        [&](size_t context_index) -> hailo_status {
+            TRY(ccws_desc_counts[context_index], write_ccws_to_config_buffers(
+                core_op_metadata->dynamic_contexts()[context_index].get_actions(),
+                dynamic_contexts[context_index].get().get_config_buffers(), support_pre_fetch));
+            return HAILO_SUCCESS;
+        });
+    CHECK_SUCCESS_AS_EXPECTED(status);
 
+    for (size_t context_index = 0; context_index < num_dynamic_contexts; context_index++) {
+        const auto &context_metadata = core_op_metadata->dynamic_contexts()[context_index];
         const auto is_last_context = (context_index == (num_dynamic_contexts - 1));
-        status = fill_context_recipes_for_multi_context(hw_arch, new_context.get(), resources_manager,
-            static_cast<uint16_t>(context_index), *core_op_metadata, context_metadata, is_single_context,
-            is_last_context, caches_in_use);
+        status = fill_context_recipes_for_multi_context(hw_arch, dynamic_contexts[context_index].get(),
+            resources_manager, static_cast<uint16_t>(context_index), *core_op_metadata, context_metadata,
+            is_single_context, is_last_context, caches_in_use, ccws_desc_counts[context_index]);
         CHECK_SUCCESS_AS_EXPECTED(status);
     }
 
+    const auto firmware_upload_start = std::chrono::steady_clock::now();
     status = resources_manager.configure();
     CHECK_SUCCESS_AS_EXPECTED(status);
+    const auto firmware_upload_end = std::chrono::steady_clock::now();
+
+    resources_manager.set_configure_stages_durations(ConfigureStagesDurations{
+        std::chrono::duration_cast<std::chrono::microseconds>(resources_building_start - buffers_allocation_start),
+        std::chrono::duration_cast<std::chrono::microseconds>(firmware_upload_start - resources_building_start),
+        std::chrono::duration_cast<std::chrono::microseconds>(firmware_upload_end - firmware_upload_start)});
 
     auto resources_manager_ptr = make_shared_nothrow<ResourcesManager>(std::move(resources_manager));
     CHECK_NOT_NULL_AS_EXPECTED(resources_manager_ptr, HAILO_OUT_OF_HOST_MEMORY);
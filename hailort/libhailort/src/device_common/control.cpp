@@ -13,6 +13,7 @@
 #include "hailo/hailort_common.hpp"
 #include "hef/core_op_metadata.hpp"
 #include "device_common/control.hpp"
+#include "device_common/device_internal.hpp"
 #include "hw_consts.hpp"
 #include "utils/soc_utils/partial_cluster_reader.hpp"
 
@@ -560,78 +561,32 @@ Expected<CONTROL_PROTOCOL__hw_consts_t> Control::get_hw_consts(Device &device)
     return Expected<CONTROL_PROTOCOL__hw_consts_t>(response.hw_consts);
 }
 
-hailo_status Control::write_memory_chunk(Device &device, uint32_t address, const uint8_t *data, uint32_t chunk_size)
-{
-    hailo_status status = HAILO_UNINITIALIZED;
-    HAILO_COMMON_STATUS_t common_status = HAILO_COMMON_STATUS__UNINITIALIZED;
-    CONTROL_PROTOCOL__request_t request = {};
-    size_t request_size = 0;
-    uint8_t response_buffer[RESPONSE_MAX_BUFFER_SIZE] = {};
-    size_t response_size = RESPONSE_MAX_BUFFER_SIZE;
-    CONTROL_PROTOCOL__response_header_t *header = NULL;
-    CONTROL_PROTOCOL__payload_t *payload = NULL;
-
-    /* Validate arguments */
-    ASSERT(NULL != data);
-
-    /* Validate chunk size is valid */
-    ASSERT(CONTROL__MAX_WRITE_MEMORY_CHUNK_SIZE >= chunk_size);
-    ASSERT(0 != chunk_size);
-
-    common_status = CONTROL_PROTOCOL__pack_write_memory_request(&request, &request_size, device.get_control_sequence(), address, data, chunk_size);
-    status = (HAILO_COMMON_STATUS__SUCCESS == common_status) ? HAILO_SUCCESS : HAILO_INTERNAL_FAILURE;
-    if (HAILO_SUCCESS != status) {
-        goto exit;
-    }
-
-    status = device.fw_interact((uint8_t*)(&request), request_size, (uint8_t*)&response_buffer, &response_size);
-    if (HAILO_SUCCESS != status) {
-        goto exit;
-    }
-
-    /* Parse response */
-    status = parse_and_validate_response(response_buffer, (uint32_t)(response_size), &header, &payload,
-            &request, device);
-    if (HAILO_SUCCESS != status) {
-        goto exit;
-    }
-
-    status = HAILO_SUCCESS;
-exit:
-    return status;
-}
-
 hailo_status Control::write_memory(Device &device, uint32_t address, const uint8_t *data, uint32_t data_length)
 {
-    hailo_status status = HAILO_UNINITIALIZED;
-
-    uint32_t current_write_address = address;
-    const uint8_t* current_data_address = data;
-    uint32_t chunk_size = CONTROL__MAX_WRITE_MEMORY_CHUNK_SIZE;
-    uint32_t number_of_chunks = data_length / chunk_size;
-    uint32_t data_chunk_leftover = data_length % chunk_size;
+    const uint32_t chunk_size = CONTROL__MAX_WRITE_MEMORY_CHUNK_SIZE;
+    const size_t number_of_chunks = (static_cast<size_t>(data_length) + chunk_size - 1) / chunk_size;
 
     /* Validate arguments */
     CHECK_ARG_NOT_NULL(data);
 
-    if (data_length >= chunk_size) {
-        for (size_t i = 0; i < number_of_chunks; i++ ) {
-            /* Write current memory chunk */
-            status = write_memory_chunk(device, current_write_address, current_data_address, chunk_size);
-            CHECK_SUCCESS(status);
-
-            current_write_address += chunk_size;
-            current_data_address += chunk_size;
-        }
-    }
-
-    if (data_chunk_leftover > 0) {
-        /* Write leftover */
-        status = write_memory_chunk(device, current_write_address, current_data_address, data_chunk_leftover);
-        CHECK_SUCCESS(status);
-    }
-
-    return HAILO_SUCCESS;
+    // The chunks are written to different addresses, so they don't depend on each other's order and may be pipelined
+    auto pack_request = [address, data, data_length, chunk_size](size_t index, uint32_t sequence,
+        CONTROL_PROTOCOL__request_t &request, size_t &request_size) {
+        const uint32_t offset = static_cast<uint32_t>(index) * chunk_size;
+        const uint32_t current_chunk_size = std::min(chunk_size, data_length - offset);
+        const auto common_status = CONTROL_PROTOCOL__pack_write_memory_request(&request, &request_size, sequence,
+            address + offset, data + offset, current_chunk_size);
+        return (HAILO_COMMON_STATUS__SUCCESS == common_status) ? HAILO_SUCCESS : HAILO_INTERNAL_FAILURE;
+    };
+    auto handle_response = [&device](size_t /* index */, CONTROL_PROTOCOL__request_t &request, uint8_t *response_buffer,
+        size_t response_size) {
+        CONTROL_PROTOCOL__response_header_t *header = NULL;
+        CONTROL_PROTOCOL__payload_t *payload = NULL;
+        return parse_and_validate_response(response_buffer, (uint32_t)(response_size), &header, &payload, &request,
+            device);
+    };
+
+    return static_cast<DeviceBase&>(device).fw_interact_pipelined(number_of_chunks, pack_request, handle_response);
 }
 
 hailo_status Control::read_memory_chunk(Device &device, uint32_t address, uint8_t *data, uint32_t chunk_size)
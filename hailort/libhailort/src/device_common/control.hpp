@@ -396,7 +396,6 @@ public:
     static Expected<uint32_t> get_partial_clusters_layout_bitmap(Device &device);
 
 private:
-    static hailo_status write_memory_chunk(Device &device, uint32_t address, const uint8_t *data, uint32_t chunk_size);
     static hailo_status read_memory_chunk(Device &device, uint32_t address, uint8_t *data, uint32_t chunk_size);
     static hailo_status read_user_config_chunk(Device &device, uint32_t read_offset, uint32_t read_length,
         uint8_t *buffer, uint32_t *actual_read_data_length);
@@ -8,6 +8,12 @@
 
 #include "d2h_event_queue.hpp"
 
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstdlib>
+
 namespace hailort
 {
 
@@ -35,4 +41,96 @@ void D2hEventQueue::clear()
     m_queue = std::queue<D2H_EVENT_MESSAGE_t>();
 }
 
+D2hCallbacksDispatcher::D2hCallbacksDispatcher(InvokeCallbackFunc invoke_callback) :
+    m_invoke_callback(std::move(invoke_callback)),
+    m_thread_per_id(nullptr != std::getenv(HAILO_NOTIFICATION_CALLBACK_THREAD_PER_ID_ENV_VAR)),
+    m_is_stopped(false)
+{}
+
+D2hCallbacksDispatcher::~D2hCallbacksDispatcher()
+{
+    stop();
+}
+
+void D2hCallbacksDispatcher::dispatch(const hailo_notification_t &notification)
+{
+    assert((0 <= notification.id) && (HAILO_NOTIFICATION_ID_COUNT > notification.id));
+    const size_t thread_index = m_thread_per_id ? static_cast<size_t>(notification.id) : 0;
+
+    CallbacksThread *callbacks_thread = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_threads_mutex);
+        if (m_is_stopped) {
+            return;
+        }
+
+        auto &thread_ptr = m_callbacks_threads[thread_index];
+        if (nullptr == thread_ptr) {
+            thread_ptr = make_unique_nothrow<CallbacksThread>();
+            if (nullptr == thread_ptr) {
+                LOGGER__ERROR("Failed to allocate notification callbacks thread, notification {} is dropped",
+                    static_cast<int>(notification.id));
+                return;
+            }
+            auto &new_thread = *thread_ptr;
+            new_thread.thread = std::thread([this, &new_thread]() { callbacks_thread_main(new_thread); });
+        }
+        callbacks_thread = thread_ptr.get();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(callbacks_thread->mutex);
+        if (MAX_PENDING_NOTIFICATIONS <= callbacks_thread->pending_notifications.size()) {
+            LOGGER__WARNING("Too many notifications are pending for their callbacks, dropping the oldest one");
+            callbacks_thread->pending_notifications.pop();
+        }
+        callbacks_thread->pending_notifications.push(notification);
+    }
+    callbacks_thread->cv.notify_one();
+}
+
+void D2hCallbacksDispatcher::stop()
+{
+    std::lock_guard<std::mutex> lock(m_threads_mutex);
+    m_is_stopped = true;
+
+    for (auto &callbacks_thread : m_callbacks_threads) {
+        if (nullptr == callbacks_thread) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> thread_lock(callbacks_thread->mutex);
+            callbacks_thread->should_stop = true;
+        }
+        callbacks_thread->cv.notify_one();
+        if (callbacks_thread->thread.joinable()) {
+            callbacks_thread->thread.join();
+        }
+        callbacks_thread.reset();
+    }
+}
+
+void D2hCallbacksDispatcher::callbacks_thread_main(CallbacksThread &callbacks_thread)
+{
+    OsUtils::set_current_thread_name("NOTIFY_CB");
+    while (true) {
+        hailo_notification_t notification{};
+        {
+            std::unique_lock<std::mutex> lock(callbacks_thread.mutex);
+            callbacks_thread.cv.wait(lock, [&callbacks_thread]() {
+                return callbacks_thread.should_stop || !callbacks_thread.pending_notifications.empty();
+            });
+            if (callbacks_thread.should_stop) {
+                return;
+            }
+            notification = callbacks_thread.pending_notifications.front();
+            callbacks_thread.pending_notifications.pop();
+        }
+
+        // Called without the lock, so the callback can't block the dispatching of the following notifications
+        m_invoke_callback(notification);
+    }
+}
+
 } /* namespace hailort */
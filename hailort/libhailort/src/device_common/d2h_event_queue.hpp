@@ -10,10 +10,16 @@
 #ifndef HAILO_D2H_EVENT_QUEUE_HPP_
 #define HAILO_D2H_EVENT_QUEUE_HPP_
 
+#include "hailo/hailort.h"
+
 #include "utils/thread_safe_queue.hpp"
 
 #include "d2h_events.h"
 
+#include <array>
+#include <functional>
+#include <thread>
+
 
 namespace hailort
 {
@@ -38,6 +44,51 @@ protected:
     std::condition_variable m_queue_not_empty;
 };
 
+// If set, the callbacks of each notification id run on their own thread (so callbacks of different ids may run
+// concurrently). Otherwise, all the callbacks run on a single callbacks thread, one after the other.
+#define HAILO_NOTIFICATION_CALLBACK_THREAD_PER_ID_ENV_VAR ("HAILO_NOTIFICATION_CALLBACK_THREAD_PER_ID")
+
+// Runs the notification callbacks on callback threads, so a slow callback doesn't delay the processing of the
+// following notifications (e.g. the health monitor ones, which shut down the core ops). The callbacks threads are
+// created on the first notification dispatched to them.
+class D2hCallbacksDispatcher final {
+public:
+    // Looks up the callback of the notification and calls it
+    using InvokeCallbackFunc = std::function<void(const hailo_notification_t &notification)>;
+
+    explicit D2hCallbacksDispatcher(InvokeCallbackFunc invoke_callback);
+    ~D2hCallbacksDispatcher();
+
+    D2hCallbacksDispatcher(const D2hCallbacksDispatcher &) = delete;
+    D2hCallbacksDispatcher &operator=(const D2hCallbacksDispatcher &) = delete;
+
+    void dispatch(const hailo_notification_t &notification);
+
+    // Stops the callbacks threads, dropping the notifications that weren't handled yet
+    void stop();
+
+    // A stuck callback shouldn't make the queue grow without a limit - the oldest notifications are dropped
+    static const size_t MAX_PENDING_NOTIFICATIONS = 1024;
+
+private:
+    struct CallbacksThread {
+        std::queue<hailo_notification_t> pending_notifications;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool should_stop = false;
+        std::thread thread;
+    };
+
+    void callbacks_thread_main(CallbacksThread &callbacks_thread);
+
+    const InvokeCallbackFunc m_invoke_callback;
+    const bool m_thread_per_id;
+
+    std::mutex m_threads_mutex;
+    bool m_is_stopped;
+    std::array<std::unique_ptr<CallbacksThread>, HAILO_NOTIFICATION_ID_COUNT> m_callbacks_threads;
+};
+
 
 } /* namespace hailort */
 
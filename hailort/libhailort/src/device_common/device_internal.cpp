@@ -24,6 +24,9 @@ DeviceBase::DeviceBase(Type type) :
     Device::Device(type),
     m_d2h_notification_queue(),
     m_d2h_notification_thread(),
+    m_d2h_callbacks_dispatcher([this](const hailo_notification_t &notification) {
+        invoke_notification_callback(notification);
+    }),
     m_notif_fetch_thread_params(make_shared_nothrow<NotificationThreadSharedParams>()),
     m_d2h_callbacks{{0,0}},
     m_callbacks_lock(),
@@ -81,6 +84,28 @@ hailo_status DeviceBase::reset(hailo_reset_device_mode_t mode)
     return reset_impl(reset_type);
 }
 
+hailo_status DeviceBase::fw_interact_pipelined(size_t controls_count, const PackControlRequestFunc &pack_request,
+    const HandleControlResponseFunc &handle_response)
+{
+    for (size_t i = 0; i < controls_count; i++) {
+        CONTROL_PROTOCOL__request_t request = {};
+        size_t request_size = 0;
+        uint8_t response_buffer[RESPONSE_MAX_BUFFER_SIZE] = {};
+        size_t response_size = RESPONSE_MAX_BUFFER_SIZE;
+
+        auto status = pack_request(i, m_control_sequence, request, request_size);
+        CHECK_SUCCESS(status);
+
+        status = fw_interact((uint8_t*)(&request), request_size, (uint8_t*)&response_buffer, &response_size);
+        CHECK_SUCCESS(status);
+
+        status = handle_response(i, request, response_buffer, response_size);
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status DeviceBase::set_notification_callback(const NotificationCallback &func, hailo_notification_id_t notification_id, void *opaque)
 {
     CHECK((0 <= notification_id) && (HAILO_NOTIFICATION_ID_COUNT > notification_id), HAILO_INVALID_ARGUMENT,
@@ -108,6 +133,28 @@ hailo_status DeviceBase::remove_notification_callback(hailo_notification_id_t no
     return HAILO_SUCCESS;
 }
 
+hailo_status DeviceBase::start_telemetry(std::chrono::milliseconds sampling_period, size_t max_samples_count)
+{
+    const std::lock_guard<std::mutex> lock(m_telemetry_mutex);
+    CHECK(nullptr == m_telemetry, HAILO_INVALID_OPERATION, "Telemetry sampling is already running");
+    TRY(m_telemetry, DeviceTelemetry::create(*this, sampling_period, max_samples_count));
+    return HAILO_SUCCESS;
+}
+
+Expected<std::vector<hailo_telemetry_sample_t>> DeviceBase::get_telemetry_samples()
+{
+    const std::lock_guard<std::mutex> lock(m_telemetry_mutex);
+    CHECK_AS_EXPECTED(nullptr != m_telemetry, HAILO_INVALID_OPERATION, "Telemetry sampling wasn't started");
+    return m_telemetry->pop_samples();
+}
+
+hailo_status DeviceBase::stop_telemetry()
+{
+    const std::lock_guard<std::mutex> lock(m_telemetry_mutex);
+    m_telemetry.reset();
+    return HAILO_SUCCESS;
+}
+
 void DeviceBase::activate_notifications(const std::string &device_id)
 {
     this->start_d2h_notification_thread(device_id);
@@ -534,6 +581,8 @@ void DeviceBase::stop_d2h_notification_thread()
         m_d2h_notification_queue.push(TERMINATE);
         m_d2h_notification_thread.join();
     }
+    // Called after the processing thread is joined, so no more notifications are dispatched
+    m_d2h_callbacks_dispatcher.stop();
 }
 
 void DeviceBase::d2h_notification_thread_main(const std::string &device_id)
@@ -569,24 +618,38 @@ void DeviceBase::d2h_notification_thread_main(const std::string &device_id)
             continue;
         }
 
-        std::shared_ptr<NotificationCallback> callback_func = nullptr;
-        void *callback_opaque = nullptr;
         {
             const std::lock_guard<std::mutex> lock(m_callbacks_lock);
-            callback_func = m_d2h_callbacks[hailo_notification_id].func;
-            callback_opaque = m_d2h_callbacks[hailo_notification_id].opaque;
-            // m_callbacks_lock is freed here because user can call to a function in the callback that will
-            // try to acquire it as well - resulting in a dead lock. I did not used recursive_mutex
-            // because of the overhead
+            if (nullptr == m_d2h_callbacks[hailo_notification_id].func) {
+                continue;
+            }
         }
 
-        if (nullptr != callback_func) {
-            callback_notification.id = hailo_notification_id;
-            callback_notification.sequence = notification.header.sequence;
-            static_assert(sizeof(callback_notification.body) == sizeof(notification.message_parameters), "D2H notification size mismatch");
-            memcpy(&callback_notification.body, &notification.message_parameters, sizeof(notification.message_parameters));
-            (*callback_func)(*this, callback_notification, callback_opaque);
-        }
+        callback_notification.id = hailo_notification_id;
+        callback_notification.sequence = notification.header.sequence;
+        static_assert(sizeof(callback_notification.body) == sizeof(notification.message_parameters), "D2H notification size mismatch");
+        memcpy(&callback_notification.body, &notification.message_parameters, sizeof(notification.message_parameters));
+        m_d2h_callbacks_dispatcher.dispatch(callback_notification);
+    }
+}
+
+void DeviceBase::invoke_notification_callback(const hailo_notification_t &notification)
+{
+    // The callback is fetched only when it's invoked, so a callback removed while its notifications were pending
+    // isn't called
+    std::shared_ptr<NotificationCallback> callback_func = nullptr;
+    void *callback_opaque = nullptr;
+    {
+        const std::lock_guard<std::mutex> lock(m_callbacks_lock);
+        callback_func = m_d2h_callbacks[notification.id].func;
+        callback_opaque = m_d2h_callbacks[notification.id].opaque;
+        // m_callbacks_lock is freed here because user can call to a function in the callback that will
+        // try to acquire it as well - resulting in a dead lock. I did not used recursive_mutex
+        // because of the overhead
+    }
+
+    if (nullptr != callback_func) {
+        (*callback_func)(*this, notification, callback_opaque);
     }
 }
 
@@ -23,10 +23,12 @@
 #include "hailo/hailort.h"
 
 #include "d2h_event_queue.hpp"
+#include "device_telemetry.hpp"
 
 #include "firmware_header.h"
 #include "firmware_header_utils.h"
 #include "control_protocol.h"
+#include <functional>
 #include <thread>
 
 
@@ -75,6 +77,9 @@ public:
     virtual hailo_status reset(hailo_reset_device_mode_t mode) override;
     virtual hailo_status set_notification_callback(const NotificationCallback &func, hailo_notification_id_t notification_id, void *opaque) override;
     virtual hailo_status remove_notification_callback(hailo_notification_id_t notification_id) override;
+    virtual hailo_status start_telemetry(std::chrono::milliseconds sampling_period, size_t max_samples_count) override;
+    virtual Expected<std::vector<hailo_telemetry_sample_t>> get_telemetry_samples() override;
+    virtual hailo_status stop_telemetry() override;
     virtual void activate_notifications(const std::string &device_id);
     virtual void start_notification_fetch_thread(D2hEventQueue *write_queue);
     virtual hailo_status stop_notification_fetch_thread();
@@ -100,6 +105,18 @@ public:
     virtual hailo_status erase_user_config() override;
     static hailo_device_architecture_t hef_arch_to_device_arch(HEFHwArch hef_arch);
 
+    // Packs the request of the control at index, with the given sequence
+    using PackControlRequestFunc = std::function<hailo_status(size_t index, uint32_t sequence,
+        CONTROL_PROTOCOL__request_t &request, size_t &request_size)>;
+    // Handles the response of the control at index
+    using HandleControlResponseFunc = std::function<hailo_status(size_t index, CONTROL_PROTOCOL__request_t &request,
+        uint8_t *response_buffer, size_t response_size)>;
+
+    // Runs controls_count controls. Devices that support it keep several requests outstanding at once; by default the
+    // controls are run one after the other. The responses are handled in the requests order.
+    virtual hailo_status fw_interact_pipelined(size_t controls_count, const PackControlRequestFunc &pack_request,
+        const HandleControlResponseFunc &handle_response);
+
     virtual Expected<hailo_device_architecture_t> get_architecture() const override
     {
         // FW is always up if we got here (device implementations's ctor would fail otherwise)
@@ -132,7 +149,12 @@ protected:
     
     D2hEventQueue m_d2h_notification_queue;
     std::thread m_d2h_notification_thread;
+    // Notification callbacks run on their own threads, so they don't hold back the processing of the notifications
+    D2hCallbacksDispatcher m_d2h_callbacks_dispatcher;
     std::thread m_notification_fetch_thread;
+    // Must be stopped (by stop_telemetry) in the destructors of the derived classes, as it sends controls
+    std::unique_ptr<DeviceTelemetry> m_telemetry;
+    std::mutex m_telemetry_mutex;
     std::shared_ptr<NotificationThreadSharedParams> m_notif_fetch_thread_params;
 
 private:
@@ -149,6 +171,7 @@ private:
     hailo_status store_sensor_control_buffers(const std::vector<SENSOR_CONFIG__operation_cfg_t> &control_buffers, uint32_t section_index, hailo_sensor_types_t sensor_type,
         uint32_t reset_config_size, uint16_t config_height, uint16_t config_width, uint16_t config_fps, const std::string &config_name);
     virtual void notification_fetch_thread(std::shared_ptr<NotificationThreadSharedParams> params);
+    void invoke_notification_callback(const hailo_notification_t &notification);
     Expected<firmware_type_t> get_fw_type();
 
     typedef struct {
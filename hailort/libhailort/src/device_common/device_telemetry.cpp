@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file device_telemetry.cpp
+ * @brief Samples the power consumption and temperature of a device in the background
+ **/
+
+#include "device_telemetry.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include "utils/profiler/tracer_macros.hpp"
+
+namespace hailort
+{
+
+// The sampling uses its own power measurement buffer, averaged by the firmware between the samples
+static const hailo_measurement_buffer_index_t TELEMETRY_POWER_MEASUREMENT_BUFFER_INDEX = HAILO_MEASUREMENT_BUFFER_INDEX_0;
+
+constexpr std::chrono::milliseconds DeviceTelemetry::MIN_SAMPLING_PERIOD;
+
+Expected<std::unique_ptr<DeviceTelemetry>> DeviceTelemetry::create(Device &device,
+    std::chrono::milliseconds sampling_period, size_t max_samples_count)
+{
+    CHECK_AS_EXPECTED(sampling_period >= MIN_SAMPLING_PERIOD, HAILO_INVALID_ARGUMENT,
+        "Telemetry sampling period must be at least {}ms (got {}ms)", MIN_SAMPLING_PERIOD.count(), sampling_period.count());
+    CHECK_AS_EXPECTED(0 < max_samples_count, HAILO_INVALID_ARGUMENT, "Telemetry max samples count must be positive");
+
+    auto status = device.stop_power_measurement();
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed to stop the previous power measurement");
+    status = device.set_power_measurement(TELEMETRY_POWER_MEASUREMENT_BUFFER_INDEX, HAILO_DVM_OPTIONS_AUTO,
+        HAILO_POWER_MEASUREMENT_TYPES__POWER);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed to set the telemetry power measurement");
+    status = device.start_power_measurement(HAILO_DEFAULT_INIT_AVERAGING_FACTOR, HAILO_DEFAULT_INIT_SAMPLING_PERIOD_US);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed to start the telemetry power measurement");
+
+    auto telemetry = make_unique_nothrow<DeviceTelemetry>(device, sampling_period, max_samples_count);
+    if (nullptr == telemetry) {
+        (void)device.stop_power_measurement();
+        LOGGER__ERROR("Failed to allocate device telemetry");
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+    return telemetry;
+}
+
+DeviceTelemetry::DeviceTelemetry(Device &device, std::chrono::milliseconds sampling_period, size_t max_samples_count) :
+    m_device(device),
+    m_sampling_period(sampling_period),
+    m_max_samples_count(max_samples_count),
+    m_should_stop(false),
+    m_sampling_thread([this]() {
+        OsUtils::set_current_thread_name("TELEMETRY");
+        sampling_thread_main();
+    })
+{}
+
+DeviceTelemetry::~DeviceTelemetry()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_sampling_thread.joinable()) {
+        m_sampling_thread.join();
+    }
+
+    auto status = m_device.stop_power_measurement();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__WARNING("Failed to stop the telemetry power measurement, status {}", status);
+    }
+}
+
+std::vector<hailo_telemetry_sample_t> DeviceTelemetry::pop_samples()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<hailo_telemetry_sample_t> samples(m_samples.begin(), m_samples.end());
+    m_samples.clear();
+    return samples;
+}
+
+void DeviceTelemetry::sampling_thread_main()
+{
+    auto next_sample_time = std::chrono::steady_clock::now() + m_sampling_period;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_cv.wait_until(lock, next_sample_time, [this]() { return m_should_stop; })) {
+                return;
+            }
+        }
+        // Scheduled by the previous sample time, so the samples don't drift by the time the controls take
+        next_sample_time += m_sampling_period;
+
+        auto sample = take_sample();
+        if (!sample) {
+            LOGGER__WARNING("Failed to take a telemetry sample of device {}, status {}", m_device.get_dev_id(),
+                sample.status());
+            continue;
+        }
+
+        TRACE(DeviceTelemetryTrace, m_device.get_dev_id(), sample->power_watts, sample->ts0_temperature,
+            sample->ts1_temperature);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_max_samples_count <= m_samples.size()) {
+            m_samples.pop_front();
+        }
+        m_samples.push_back(sample.release());
+    }
+}
+
+Expected<hailo_telemetry_sample_t> DeviceTelemetry::take_sample()
+{
+    hailo_telemetry_sample_t sample{};
+
+    TRY(const auto power_data, m_device.get_power_measurement(TELEMETRY_POWER_MEASUREMENT_BUFFER_INDEX, true));
+    TRY(const auto temperature, m_device.get_chip_temperature());
+
+    sample.timestamp_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    sample.power_watts = power_data.average_value;
+    sample.ts0_temperature = temperature.ts0_temperature;
+    sample.ts1_temperature = temperature.ts1_temperature;
+    return sample;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file device_telemetry.hpp
+ * @brief Samples the power consumption and temperature of a device in the background
+ **/
+
+#ifndef _HAILO_DEVICE_TELEMETRY_HPP_
+#define _HAILO_DEVICE_TELEMETRY_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/device.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+class DeviceTelemetry final {
+public:
+    static constexpr std::chrono::milliseconds MIN_SAMPLING_PERIOD = std::chrono::milliseconds(100);
+
+    static Expected<std::unique_ptr<DeviceTelemetry>> create(Device &device, std::chrono::milliseconds sampling_period,
+        size_t max_samples_count);
+
+    DeviceTelemetry(Device &device, std::chrono::milliseconds sampling_period, size_t max_samples_count);
+    ~DeviceTelemetry();
+
+    DeviceTelemetry(const DeviceTelemetry &) = delete;
+    DeviceTelemetry &operator=(const DeviceTelemetry &) = delete;
+
+    // Returns the samples taken since the previous call, oldest first
+    std::vector<hailo_telemetry_sample_t> pop_samples();
+
+private:
+    void sampling_thread_main();
+    Expected<hailo_telemetry_sample_t> take_sample();
+
+    Device &m_device;
+    const std::chrono::milliseconds m_sampling_period;
+    const size_t m_max_samples_count;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_should_stop;
+    std::deque<hailo_telemetry_sample_t> m_samples;
+
+    std::thread m_sampling_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_DEVICE_TELEMETRY_HPP_ */
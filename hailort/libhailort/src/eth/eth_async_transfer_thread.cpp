@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file eth_async_transfer_thread.cpp
+ * @brief Async transfers over the sync transfer function of an ethernet stream.
+ **/
+
+#include "eth/eth_async_transfer_thread.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+
+namespace hailort
+{
+
+constexpr size_t EthernetAsyncTransferThread::DEFAULT_MAX_QUEUE_SIZE;
+
+Expected<std::unique_ptr<EthernetAsyncTransferThread>> EthernetAsyncTransferThread::create(
+    const std::string &stream_name, Direction direction, size_t frame_size, TransferFunction transfer_function,
+    size_t max_queue_size)
+{
+    CHECK_AS_EXPECTED(0 < max_queue_size, HAILO_INVALID_ARGUMENT, "Invalid max queue size for {}", stream_name);
+    TRY(auto staging_buffer, Buffer::create(frame_size));
+
+    auto result = make_unique_nothrow<EthernetAsyncTransferThread>(stream_name, direction, std::move(staging_buffer),
+        std::move(transfer_function), max_queue_size);
+    CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
+    return result;
+}
+
+EthernetAsyncTransferThread::EthernetAsyncTransferThread(const std::string &stream_name, Direction direction,
+    Buffer &&staging_buffer, TransferFunction transfer_function, size_t max_queue_size) :
+    m_stream_name(stream_name),
+    m_direction(direction),
+    m_staging_buffer(std::move(staging_buffer)),
+    m_transfer_function(std::move(transfer_function)),
+    m_max_queue_size(max_queue_size),
+    m_ongoing_transfers(0),
+    m_should_stop(false),
+    m_thread([this]() { thread_main(); })
+{}
+
+EthernetAsyncTransferThread::~EthernetAsyncTransferThread()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_should_stop = true;
+    }
+    m_cv.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    cancel_pending_transfers(HAILO_STREAM_ABORT);
+}
+
+hailo_status EthernetAsyncTransferThread::wait_for_ready(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const auto is_ready = m_cv.wait_for(lock, timeout,
+        [this]() { return m_should_stop || (m_ongoing_transfers < m_max_queue_size); });
+    CHECK(is_ready, HAILO_TIMEOUT, "Got HAILO_TIMEOUT while waiting for async transfer of {}", m_stream_name);
+    if (m_should_stop) {
+        return HAILO_STREAM_ABORT;
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status EthernetAsyncTransferThread::launch_transfer(TransferRequest &&transfer_request)
+{
+    CHECK(!transfer_request.transfer_buffers.empty(), HAILO_INVALID_ARGUMENT, "TransferRequest is empty");
+    for (const auto &transfer_buffer : transfer_request.transfer_buffers) {
+        CHECK(TransferBufferType::MEMORYVIEW == transfer_buffer.type(), HAILO_NOT_SUPPORTED,
+            "Ethernet streams don't support dmabuf transfers");
+    }
+    CHECK(transfer_request.get_total_transfer_size() == m_staging_buffer.size(), HAILO_INVALID_ARGUMENT,
+        "Transfer size {} of {} must be the frame size {}", transfer_request.get_total_transfer_size(), m_stream_name,
+        m_staging_buffer.size());
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_should_stop) {
+            return HAILO_STREAM_ABORT;
+        }
+        if (m_ongoing_transfers >= m_max_queue_size) {
+            return HAILO_QUEUE_IS_FULL;
+        }
+        m_pending_transfers.emplace_back(std::move(transfer_request));
+        m_ongoing_transfers++;
+    }
+    m_cv.notify_all();
+
+    return HAILO_SUCCESS;
+}
+
+void EthernetAsyncTransferThread::cancel_pending_transfers(hailo_status status)
+{
+    std::deque<TransferRequest> canceled_transfers;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        canceled_transfers.swap(m_pending_transfers);
+        m_ongoing_transfers -= canceled_transfers.size();
+    }
+    m_cv.notify_all();
+
+    // The callbacks are called without the lock, since they may launch new transfers
+    for (auto &transfer_request : canceled_transfers) {
+        transfer_request.callback(status);
+    }
+}
+
+void EthernetAsyncTransferThread::thread_main()
+{
+    while (true) {
+        TransferRequest transfer_request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_should_stop || !m_pending_transfers.empty(); });
+            if (m_should_stop) {
+                return;
+            }
+            transfer_request = std::move(m_pending_transfers.front());
+            m_pending_transfers.pop_front();
+        }
+
+        const auto status = transfer(transfer_request);
+        if ((HAILO_SUCCESS != status) && (HAILO_STREAM_ABORT != status)) {
+            LOGGER__ERROR("Async transfer of {} failed with status {}", m_stream_name, status);
+        }
+
+        // The transfer stops being ongoing before the callback, so the callback can launch the next transfer
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ongoing_transfers--;
+        }
+        m_cv.notify_all();
+        transfer_request.callback(status);
+    }
+}
+
+hailo_status EthernetAsyncTransferThread::transfer(TransferRequest &transfer_request)
+{
+    auto &transfer_buffers = transfer_request.transfer_buffers;
+    if ((1 == transfer_buffers.size()) && (0 == transfer_buffers[0].offset())) {
+        TRY(auto base_buffer, transfer_buffers[0].base_buffer());
+        if (base_buffer.size() == transfer_buffers[0].size()) {
+            // A single continuous buffer - transferred as is
+            return m_transfer_function(base_buffer);
+        }
+    }
+
+    if (Direction::H2D == m_direction) {
+        size_t offset = 0;
+        for (auto &transfer_buffer : transfer_buffers) {
+            CHECK_SUCCESS(transfer_buffer.copy_to(MemoryView(m_staging_buffer.data() + offset, transfer_buffer.size())));
+            offset += transfer_buffer.size();
+        }
+        return m_transfer_function(MemoryView(m_staging_buffer));
+    }
+
+    const auto status = m_transfer_function(MemoryView(m_staging_buffer));
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+    size_t offset = 0;
+    for (auto &transfer_buffer : transfer_buffers) {
+        CHECK_SUCCESS(transfer_buffer.copy_from(MemoryView(m_staging_buffer.data() + offset, transfer_buffer.size())));
+        offset += transfer_buffer.size();
+    }
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
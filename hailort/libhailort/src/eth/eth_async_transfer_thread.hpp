@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file eth_async_transfer_thread.hpp
+ * @brief Async transfers over the sync transfer function of an ethernet stream.
+ **/
+
+#ifndef _HAILO_ETH_ASYNC_TRANSFER_THREAD_HPP_
+#define _HAILO_ETH_ASYNC_TRANSFER_THREAD_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include "stream_common/transfer_common.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+namespace hailort
+{
+
+// Runs the async transfers of an ethernet stream on a dedicated thread, one after the other, using the stream's sync
+// transfer function (the UDP socket is blocking, and a single stream's datagrams must be sent/received in order, so a
+// single transfer thread per stream is enough). The callback of each transfer is called from the thread once the
+// transfer is done.
+class EthernetAsyncTransferThread final {
+public:
+    // Transfers a whole frame (writes it for input streams, reads it for output streams)
+    using TransferFunction = std::function<hailo_status(MemoryView)>;
+
+    static constexpr size_t DEFAULT_MAX_QUEUE_SIZE = 16;
+
+    enum class Direction {
+        H2D,
+        D2H
+    };
+
+    static Expected<std::unique_ptr<EthernetAsyncTransferThread>> create(const std::string &stream_name,
+        Direction direction, size_t frame_size, TransferFunction transfer_function, size_t max_queue_size);
+
+    EthernetAsyncTransferThread(const std::string &stream_name, Direction direction, Buffer &&staging_buffer,
+        TransferFunction transfer_function, size_t max_queue_size);
+    ~EthernetAsyncTransferThread();
+
+    EthernetAsyncTransferThread(const EthernetAsyncTransferThread &) = delete;
+    EthernetAsyncTransferThread &operator=(const EthernetAsyncTransferThread &) = delete;
+
+    size_t max_queue_size() const { return m_max_queue_size; }
+
+    // Waits until a transfer can be launched
+    hailo_status wait_for_ready(std::chrono::milliseconds timeout);
+
+    // Queues the transfer, fails with HAILO_QUEUE_IS_FULL if max_queue_size transfers are ongoing
+    hailo_status launch_transfer(TransferRequest &&transfer_request);
+
+    // Completes all the queued transfers (that weren't started yet) with the given status
+    void cancel_pending_transfers(hailo_status status);
+
+private:
+    void thread_main();
+    hailo_status transfer(TransferRequest &transfer_request);
+
+    const std::string m_stream_name;
+    const Direction m_direction;
+    // Used for requests which aren't a single continuous buffer (e.g. a frame split into several buffers)
+    Buffer m_staging_buffer;
+    TransferFunction m_transfer_function;
+    const size_t m_max_queue_size;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<TransferRequest> m_pending_transfers;
+    // Pending transfers and the transfer running on the thread
+    size_t m_ongoing_transfers;
+    bool m_should_stop;
+
+    std::thread m_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_ETH_ASYNC_TRANSFER_THREAD_HPP_ */
@@ -45,6 +45,65 @@ hailo_status EthernetDevice::fw_interact_impl(uint8_t *request_buffer, size_t re
     return m_control_udp.fw_interact(request_buffer, request_size, response_buffer, response_size, m_control_sequence);
 }
 
+size_t EthernetDevice::get_pipelined_controls_window()
+{
+    static const size_t window = []() -> size_t {
+        auto window_env_var = get_env_variable(HAILO_ETH_PIPELINED_CONTROLS_WINDOW_ENV_VAR);
+        if (!window_env_var) {
+            return 1;
+        }
+        return std::max(static_cast<size_t>(std::stoul(window_env_var.value())), static_cast<size_t>(1));
+    }();
+    return window;
+}
+
+hailo_status EthernetDevice::fw_interact_pipelined(size_t controls_count, const PackControlRequestFunc &pack_request,
+    const HandleControlResponseFunc &handle_response)
+{
+    const auto window = get_pipelined_controls_window();
+    if ((1 == window) || !m_is_control_version_supported) {
+        return DeviceBase::fw_interact_pipelined(controls_count, pack_request, handle_response);
+    }
+
+    std::vector<CONTROL_PROTOCOL__request_t> requests(window);
+    std::vector<std::array<uint8_t, RESPONSE_MAX_BUFFER_SIZE>> responses_buffers(window);
+    for (size_t window_start = 0; window_start < controls_count; window_start += window) {
+        const auto window_size = std::min(window, controls_count - window_start);
+
+        std::vector<MemoryView> requests_views;
+        std::vector<MemoryView> responses_views;
+        std::vector<size_t> response_sizes;
+        std::vector<uint32_t> sequences;
+        for (size_t i = 0; i < window_size; i++) {
+            // Same sequences as a series of fw_interact calls (see increment_control_sequence)
+            const auto sequence = static_cast<uint32_t>((static_cast<uint64_t>(m_control_sequence) + i) %
+                CONTROL__MAX_SEQUENCE);
+            size_t request_size = 0;
+            auto status = pack_request(window_start + i, sequence, requests[i], request_size);
+            CHECK_SUCCESS(status);
+
+            requests_views.emplace_back(MemoryView::create_const(&requests[i], request_size));
+            responses_views.emplace_back(MemoryView(responses_buffers[i].data(), responses_buffers[i].size()));
+            response_sizes.emplace_back(responses_buffers[i].size());
+            sequences.emplace_back(sequence);
+        }
+
+        auto status = m_control_udp.fw_interact_pipelined(requests_views, responses_views, response_sizes, sequences);
+        // Always increment sequence
+        for (size_t i = 0; i < window_size; i++) {
+            increment_control_sequence();
+        }
+        CHECK_SUCCESS(status);
+
+        for (size_t i = 0; i < window_size; i++) {
+            status = handle_response(window_start + i, requests[i], responses_buffers[i].data(), response_sizes[i]);
+            CHECK_SUCCESS(status);
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status EthernetDevice::wait_for_wakeup()
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -110,8 +169,15 @@ Expected<std::unique_ptr<EthernetDevice>> EthernetDevice::create(const std::stri
 EthernetDevice::EthernetDevice(const hailo_eth_device_info_t &device_info, Udp &&control_udp, hailo_status &status) :
     DeviceBase::DeviceBase(Device::Type::ETH),
     m_device_info(device_info),
-    m_control_udp(std::move(control_udp))
+    m_control_udp(std::move(control_udp)),
+    m_rate_controller(make_shared_nothrow<EthernetRateController>())
 {
+    if (nullptr == m_rate_controller) {
+        LOGGER__ERROR("Failed to allocate the rate controller");
+        status = HAILO_OUT_OF_HOST_MEMORY;
+        return;
+    }
+
     char ip_buffer[INET_ADDRSTRLEN];
     status = Socket::ntop(AF_INET, &(device_info.device_address.sin_addr), ip_buffer, INET_ADDRSTRLEN);
     if (HAILO_SUCCESS != status) {
@@ -141,6 +207,14 @@ EthernetDevice::EthernetDevice(const hailo_eth_device_info_t &device_info, Udp &
     status = HAILO_SUCCESS;
 }
 
+EthernetDevice::~EthernetDevice()
+{
+    auto status = stop_telemetry();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__WARNING("Failed to stop telemetry sampling, status {}", status);
+    }
+}
+
 Expected<size_t> EthernetDevice::read_log(MemoryView &buffer, hailo_cpu_id_t cpu_id)
 {
     (void) buffer;
@@ -17,19 +17,29 @@
 
 #include "device_common/device_internal.hpp"
 #include "eth/udp.hpp"
+#include "eth/eth_rate_controller.hpp"
 #include "eth/hcp_config_core_op.hpp"
 
 
 namespace hailort
 {
 
+// If set to a window size > 1, bulk controls are pipelined - up to this number of requests are sent before waiting
+// for their responses. Only controls that don't depend on each other's order are pipelined (e.g. the memory writes of
+// the core op config), since requests that are sent again (after a lost response) may arrive after later ones.
+#define HAILO_ETH_PIPELINED_CONTROLS_WINDOW_ENV_VAR ("HAILO_ETH_PIPELINED_CONTROLS_WINDOW")
+
 class EthernetDevice : public DeviceBase {
 public:
+    virtual ~EthernetDevice();
+
     virtual hailo_status fw_interact_impl(uint8_t *request_buffer, size_t request_size,
         uint8_t *response_buffer, size_t *response_size, hailo_cpu_id_t cpu_id) override;
     virtual Expected<size_t> read_log(MemoryView &buffer, hailo_cpu_id_t cpu_id) override;
     virtual hailo_status wait_for_wakeup() override;
     virtual void increment_control_sequence() override;
+    virtual hailo_status fw_interact_pipelined(size_t controls_count, const PackControlRequestFunc &pack_request,
+        const HandleControlResponseFunc &handle_response) override;
     virtual void shutdown_core_ops() override;
     virtual hailo_reset_device_mode_t get_default_reset_mode() override;
     virtual hailo_status reset_impl(CONTROL_PROTOCOL__reset_type_t reset_type) override;
@@ -58,6 +68,7 @@ public:
     static Expected<std::unique_ptr<EthernetDevice>> create(const hailo_eth_device_info_t &device_info);
     static Expected<std::unique_ptr<EthernetDevice>> create(const std::string &ip_addr);
     hailo_eth_device_info_t get_device_info() const;
+    std::shared_ptr<EthernetRateController> get_rate_controller() const { return m_rate_controller; }
     virtual const char* get_dev_id() const override;
 
 protected:
@@ -69,10 +80,13 @@ private:
     EthernetDevice(const hailo_eth_device_info_t &device_info, Udp &&control_udp, hailo_status &status);
     Expected<ConfiguredNetworkGroupVector> create_networks_group_vector(Hef &hef, const NetworkGroupsParamsMap &configure_params);
     Expected<std::vector<WriteMemoryInfo>> create_core_op_metadata(Hef &hef, const std::string &core_op_name, uint32_t partial_clusters_layout_bitmap);
+    static size_t get_pipelined_controls_window();
 
     const hailo_eth_device_info_t m_device_info;
     std::string m_device_id;
     Udp m_control_udp;
+    // Shared by the device's streams, see EthernetRateController
+    std::shared_ptr<EthernetRateController> m_rate_controller;
     // TODO - HRT-13234, move to DeviceBase
     std::vector<std::shared_ptr<CoreOp>> m_core_ops;
     std::vector<std::shared_ptr<ConfiguredNetworkGroup>> m_network_groups; // TODO: HRT-9547 - Remove when ConfiguredNetworkGroup will be kept in global context
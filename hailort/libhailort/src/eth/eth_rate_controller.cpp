@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file eth_rate_controller.cpp
+ * @brief Closed-loop rate control of the rate limited ethernet input streams of a device.
+ **/
+
+#include "eth/eth_rate_controller.hpp"
+
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace hailort
+{
+
+constexpr double EthernetRateController::MIN_RATE_FACTOR;
+constexpr double EthernetRateController::ADDITIVE_INCREASE;
+constexpr double EthernetRateController::MULTIPLICATIVE_DECREASE;
+constexpr std::chrono::milliseconds EthernetRateController::DECREASE_COOLDOWN;
+
+EthernetRateController::EthernetRateController() :
+    m_rate_factor(1.0),
+    m_last_decrease_time()
+{}
+
+bool EthernetRateController::is_enabled()
+{
+    static const bool is_enabled = (nullptr != std::getenv(HAILO_ETH_ADAPTIVE_RATE_CONTROL_ENV_VAR));
+    return is_enabled;
+}
+
+double EthernetRateController::get_rate(uint32_t max_rate_bytes_per_sec) const
+{
+    return m_rate_factor.load() * static_cast<double>(max_rate_bytes_per_sec);
+}
+
+void EthernetRateController::report_frame_success()
+{
+    // Cheap check first, so clean reads at the max rate don't take the lock
+    if (1.0 <= m_rate_factor.load()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_rate_factor = std::min(1.0, m_rate_factor.load() + ADDITIVE_INCREASE);
+}
+
+void EthernetRateController::report_frame_loss()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    if ((now - m_last_decrease_time) < DECREASE_COOLDOWN) {
+        return;
+    }
+    m_last_decrease_time = now;
+
+    const auto rate_factor = std::max(MIN_RATE_FACTOR, m_rate_factor.load() * MULTIPLICATIVE_DECREASE);
+    m_rate_factor = rate_factor;
+    LOGGER__INFO("Ethernet data was lost, decreasing the input streams rate to {:.3f} of their max rate", rate_factor);
+}
+
+} /* namespace hailort */
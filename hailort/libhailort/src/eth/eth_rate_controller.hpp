@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file eth_rate_controller.hpp
+ * @brief Closed-loop rate control of the rate limited ethernet input streams of a device.
+ **/
+
+#ifndef _HAILO_ETH_RATE_CONTROLLER_HPP_
+#define _HAILO_ETH_RATE_CONTROLLER_HPP_
+
+#include "hailo/hailort.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+
+namespace hailort
+{
+
+// If set, rate limited input streams (rate_limit_bytes_per_sec != 0) are limited by a token bucket whose rate is adapted
+// by the device's EthernetRateController (on all platforms, instead of "Traffic Control" on linux). The configured rate
+// is then the max rate of the stream.
+#define HAILO_ETH_ADAPTIVE_RATE_CONTROL_ENV_VAR ("HAILO_ETH_ADAPTIVE_RATE_CONTROL")
+
+// AIMD (additive increase, multiplicative decrease) controller of the rate of the input streams, fed by the output
+// streams of the same device. Lost data (timeouts, missing sync packets or missing bytes) seen by the output streams
+// scales the rates of the inputs down, and each frame read cleanly scales them back up towards the configured rates.
+// The controller holds a factor in [MIN_RATE_FACTOR, 1] applied to the configured rate of each input stream.
+// Thread safe - the factor is read by the input streams while the output streams update it.
+class EthernetRateController final {
+public:
+    EthernetRateController();
+
+    EthernetRateController(const EthernetRateController &) = delete;
+    EthernetRateController &operator=(const EthernetRateController &) = delete;
+
+    static bool is_enabled();
+
+    // Returns the current rate of a stream whose configured (max) rate is max_rate_bytes_per_sec
+    double get_rate(uint32_t max_rate_bytes_per_sec) const;
+
+    void report_frame_success();
+    void report_frame_loss();
+
+    static constexpr double MIN_RATE_FACTOR = 1.0 / 16;
+    static constexpr double ADDITIVE_INCREASE = 1.0 / 64;
+    static constexpr double MULTIPLICATIVE_DECREASE = 0.75;
+    // Losses seen by several output streams (or several frames of a batch) at once are caused by the same burst, so
+    // the rate is decreased at most once in this period
+    static constexpr std::chrono::milliseconds DECREASE_COOLDOWN = std::chrono::milliseconds(100);
+
+private:
+    std::atomic<double> m_rate_factor;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_last_decrease_time;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_ETH_RATE_CONTROLLER_HPP_ */
@@ -43,6 +43,9 @@ typedef struct hailo_output_sync_packet_t {
 
 EthernetInputStream::~EthernetInputStream()
 {
+    // The thread transfers through the stream, so it's stopped first
+    m_async_transfer_thread.reset();
+
     if (m_is_stream_activated) {
         auto status = this->deactivate_stream();
         if (HAILO_SUCCESS != status) {
@@ -78,6 +81,10 @@ hailo_status EthernetInputStream::deactivate_stream()
 
     m_is_stream_activated = false;
 
+    if (nullptr != m_async_transfer_thread) {
+        m_async_transfer_thread->cancel_pending_transfers(HAILO_STREAM_ABORT);
+    }
+
     status = Control::close_stream(m_device, m_dataflow_manager_id, true);
     CHECK_SUCCESS(status);
 
@@ -143,6 +150,25 @@ Expected<size_t> EthernetInputStream::sync_write_raw_buffer(const MemoryView &bu
     return size;
 }
 
+Expected<size_t> EthernetInputStream::sync_write_raw_buffer_batch(const MemoryView &buffer)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+
+    status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED, "Trying to write on stream before its network_group is activated");
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    size_t size = buffer.size();
+    status = m_udp.send_batch(buffer.data(), &size, this->configuration.use_dataflow_padding, this->configuration.max_payload_size);
+    if (HAILO_STREAM_ABORT == status) {
+        LOGGER__INFO("Udp send_batch was aborted!");
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS_AS_EXPECTED(status, "{} (H2D) failed with status={}", name(), status);
+
+    return size;
+}
+
 hailo_status EthernetInputStream::write_impl(const MemoryView &buffer)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -191,7 +217,7 @@ hailo_status EthernetInputStream::eth_stream__write_with_remainder(const void *b
     while (offset < offset_end_without_remainder) {
         transfer_size = offset_end_without_remainder - offset;
         TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto bytes_written,
-            sync_write_raw_buffer(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size)));
+            sync_write_raw_buffer_batch(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size)));
         offset += bytes_written;
     }
     if (0 < remainder_size) {
@@ -211,12 +237,20 @@ EthernetInputStreamRateLimited::EthernetInputStreamRateLimited(Device &device, U
 {}
 
 TokenBucketEthernetInputStream::TokenBucketEthernetInputStream(Device &device, Udp &&udp,
-    EventPtr &&core_op_activated_event, uint32_t rate_bytes_per_sec, const LayerInfo &layer_info, hailo_status &status) :
+    EventPtr &&core_op_activated_event, uint32_t rate_bytes_per_sec, const LayerInfo &layer_info, hailo_status &status,
+    std::shared_ptr<EthernetRateController> rate_controller) :
     EthernetInputStreamRateLimited::EthernetInputStreamRateLimited(device, std::move(udp),
         std::move(core_op_activated_event), rate_bytes_per_sec, layer_info, status),
-    token_bucket()
+    token_bucket(),
+    m_rate_controller(std::move(rate_controller))
 {}
 
+double TokenBucketEthernetInputStream::get_rate() const
+{
+    return (nullptr != m_rate_controller) ? m_rate_controller->get_rate(rate_bytes_per_sec) :
+        static_cast<double>(rate_bytes_per_sec);
+}
+
 hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(const void *buffer, size_t offset, size_t size, size_t remainder_size) {
     size_t transfer_size = 0;
     size_t offset_end_without_remainder = offset + size - remainder_size;
@@ -225,7 +259,7 @@ hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(co
     static_assert(MAX_CONSUME_SIZE <= BURST_SIZE, "We are asking to consume more bytes than the size of the token bucket, this will fail");
 
     while (offset < offset_end_without_remainder) {
-        (void)token_bucket.consumeWithBorrowAndWait(MAX_CONSUME_SIZE, rate_bytes_per_sec, BURST_SIZE);
+        (void)token_bucket.consumeWithBorrowAndWait(MAX_CONSUME_SIZE, get_rate(), BURST_SIZE);
     
         transfer_size = offset_end_without_remainder - offset;
         TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto bytes_written,
@@ -235,7 +269,7 @@ hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(co
     if (0 < remainder_size) {
         // We don't static_assert that "remainder_size <= BURST_SIZE", so the call could fail in theory.
         // However, since remainder_size is modulo MAX_UDP_PAYLOAD_SIZE and BURST_SIZE == MAX_UDP_PAYLOAD_SIZE, it should be smaller.
-        (void)token_bucket.consumeWithBorrowAndWait(static_cast<double>(remainder_size), rate_bytes_per_sec, BURST_SIZE);
+        (void)token_bucket.consumeWithBorrowAndWait(static_cast<double>(remainder_size), get_rate(), BURST_SIZE);
 
         TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto bytes_written,
             sync_write_raw_buffer(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, remainder_size)));
@@ -359,6 +393,12 @@ Expected<std::unique_ptr<EthernetInputStream>> EthernetInputStream::create(Devic
         local_stream = std::unique_ptr<EthernetInputStream>(
             new (std::nothrow) EthernetInputStream(device, std::move(udp), std::move(core_op_activated_event), edge_layer, status));
         CHECK_SUCCESS_AS_EXPECTED(status);
+    } else if (EthernetRateController::is_enabled()) {
+        local_stream = std::unique_ptr<EthernetInputStream>(
+            new (std::nothrow) TokenBucketEthernetInputStream(device, std::move(udp),
+            std::move(core_op_activated_event), params.rate_limit_bytes_per_sec, edge_layer, status,
+            eth_device->get_rate_controller()));
+        CHECK_SUCCESS_AS_EXPECTED(status);
     } else {
 #ifdef _MSC_VER
         // TODO: Add factory class
@@ -419,9 +459,62 @@ hailo_status EthernetInputStream::abort_impl()
     return m_udp.abort();
 }
 
+hailo_status EthernetInputStream::set_buffer_mode(StreamBufferMode buffer_mode)
+{
+    CHECK(StreamBufferMode::NOT_SET != buffer_mode, HAILO_INVALID_ARGUMENT, "Can't set buffer mode to NOT_SET");
+    if (m_buffer_mode == buffer_mode) {
+        return HAILO_SUCCESS;
+    }
+    CHECK(StreamBufferMode::NOT_SET == m_buffer_mode, HAILO_INVALID_OPERATION, "Buffer mode of {} was already set",
+        name());
+
+    if (StreamBufferMode::NOT_OWNING == buffer_mode) {
+        TRY(m_async_transfer_thread, EthernetAsyncTransferThread::create(name(),
+            EthernetAsyncTransferThread::Direction::H2D, get_frame_size(),
+            [this](MemoryView buffer) { return write_impl(buffer); },
+            EthernetAsyncTransferThread::DEFAULT_MAX_QUEUE_SIZE));
+    }
+
+    m_buffer_mode = buffer_mode;
+    return HAILO_SUCCESS;
+}
+
+hailo_status EthernetInputStream::write_async(TransferRequest &&transfer_request)
+{
+    CHECK(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "write_async on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    CHECK(m_is_stream_activated, HAILO_STREAM_NOT_ACTIVATED, "Stream {} is not activated", name());
+    return m_async_transfer_thread->launch_transfer(std::move(transfer_request));
+}
+
+hailo_status EthernetInputStream::wait_for_async_ready(size_t /* transfer_size */, std::chrono::milliseconds timeout)
+{
+    CHECK(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "wait_for_async_ready on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    return m_async_transfer_thread->wait_for_ready(timeout);
+}
+
+Expected<size_t> EthernetInputStream::get_async_max_queue_size() const
+{
+    CHECK_AS_EXPECTED(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "get_async_max_queue_size on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    return m_async_transfer_thread->max_queue_size();
+}
+
+hailo_status EthernetInputStream::cancel_pending_transfers()
+{
+    if (nullptr != m_async_transfer_thread) {
+        m_async_transfer_thread->cancel_pending_transfers(HAILO_STREAM_ABORT);
+    }
+    return HAILO_SUCCESS;
+}
+
 /** Output stream **/
 EthernetOutputStream::~EthernetOutputStream()
 {
+    // The thread transfers through the stream, so it's stopped first
+    m_async_transfer_thread.reset();
+
     if (m_is_stream_activated) {
         auto status = this->deactivate_stream();
         if (HAILO_SUCCESS != status) {
@@ -440,6 +533,10 @@ hailo_status EthernetOutputStream::deactivate_stream()
 
     m_is_stream_activated = false;
 
+    if (nullptr != m_async_transfer_thread) {
+        m_async_transfer_thread->cancel_pending_transfers(HAILO_STREAM_ABORT);
+    }
+
     status = Control::close_stream(m_device, m_dataflow_manager_id, false);
     CHECK_SUCCESS(status);
 
@@ -493,7 +590,7 @@ hailo_status EthernetOutputStream::read_all_no_sync(void *buffer, size_t offset,
     while (offset < offset_end) {
         transfer_size = offset_end - offset;
         MemoryView buffer_view(static_cast<uint8_t*>(buffer) + offset, transfer_size);
-        TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, auto bytes_read, this->sync_read_raw_buffer(buffer_view));
+        TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, auto bytes_read, this->sync_read_raw_buffer_batch(buffer_view));
         offset += bytes_read;
     }
 
@@ -632,6 +729,11 @@ hailo_status EthernetOutputStream::read_impl(MemoryView buffer)
     } else {
         status = this->read_all_no_sync(buffer.data(), 0, buffer.size());
     }
+    if ((HAILO_TIMEOUT == status) || (HAILO_INVALID_FRAME == status)) {
+        m_rate_controller->report_frame_loss();
+    } else if (HAILO_SUCCESS == status) {
+        m_rate_controller->report_frame_success();
+    }
     if (HAILO_STREAM_ABORT == status) {
         LOGGER__INFO("read was aborted!");
         return status;
@@ -659,6 +761,74 @@ Expected<size_t> EthernetOutputStream::sync_read_raw_buffer(MemoryView &buffer)
     return buffer_size;
 }
 
+Expected<size_t> EthernetOutputStream::sync_read_raw_buffer_batch(MemoryView &buffer)
+{
+    auto status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED,
+        "Trying to read on stream before its network_group is activated");
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    auto buffer_size = buffer.size();
+    status = m_udp.recv_batch(buffer.data(), &buffer_size, this->configuration.max_payload_size);
+    if (HAILO_STREAM_ABORT == status) {
+        LOGGER__INFO("Udp recv_batch was aborted!");
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS_AS_EXPECTED(status, "{} (D2H) failed with status={}", name(), status);
+
+    return buffer_size;
+}
+
+hailo_status EthernetOutputStream::set_buffer_mode(StreamBufferMode buffer_mode)
+{
+    CHECK(StreamBufferMode::NOT_SET != buffer_mode, HAILO_INVALID_ARGUMENT, "Can't set buffer mode to NOT_SET");
+    if (m_buffer_mode == buffer_mode) {
+        return HAILO_SUCCESS;
+    }
+    CHECK(StreamBufferMode::NOT_SET == m_buffer_mode, HAILO_INVALID_OPERATION, "Buffer mode of {} was already set",
+        name());
+
+    if (StreamBufferMode::NOT_OWNING == buffer_mode) {
+        TRY(m_async_transfer_thread, EthernetAsyncTransferThread::create(name(),
+            EthernetAsyncTransferThread::Direction::D2H, get_frame_size(),
+            [this](MemoryView buffer) { return read_impl(buffer); },
+            EthernetAsyncTransferThread::DEFAULT_MAX_QUEUE_SIZE));
+    }
+
+    m_buffer_mode = buffer_mode;
+    return HAILO_SUCCESS;
+}
+
+hailo_status EthernetOutputStream::read_async(TransferRequest &&transfer_request)
+{
+    CHECK(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "read_async on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    CHECK(m_is_stream_activated, HAILO_STREAM_NOT_ACTIVATED, "Stream {} is not activated", name());
+    return m_async_transfer_thread->launch_transfer(std::move(transfer_request));
+}
+
+hailo_status EthernetOutputStream::wait_for_async_ready(size_t /* transfer_size */, std::chrono::milliseconds timeout)
+{
+    CHECK(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "wait_for_async_ready on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    return m_async_transfer_thread->wait_for_ready(timeout);
+}
+
+Expected<size_t> EthernetOutputStream::get_async_max_queue_size() const
+{
+    CHECK_AS_EXPECTED(nullptr != m_async_transfer_thread, HAILO_INVALID_OPERATION,
+        "get_async_max_queue_size on {} is supported only for async streams (HAILO_STREAM_FLAGS_ASYNC)", name());
+    return m_async_transfer_thread->max_queue_size();
+}
+
+hailo_status EthernetOutputStream::cancel_pending_transfers()
+{
+    if (nullptr != m_async_transfer_thread) {
+        m_async_transfer_thread->cancel_pending_transfers(HAILO_STREAM_ABORT);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status EthernetOutputStream::fill_output_stream_ptr_with_info(const hailo_eth_output_stream_params_t &params, EthernetOutputStream *stream)
 {
     if ((HailoRTCommon::is_nms(stream->m_stream_info)) && (params.is_sync_enabled)) {
@@ -689,6 +859,7 @@ Expected<std::unique_ptr<EthernetOutputStream>> EthernetOutputStream::create(Dev
         edge_layer, std::move(udp), std::move(core_op_activated_event), status));
     CHECK((nullptr != local_stream), make_unexpected(HAILO_OUT_OF_HOST_MEMORY));
     CHECK_SUCCESS_AS_EXPECTED(status);
+    local_stream->m_rate_controller = eth_device->get_rate_controller();
 
     status = fill_output_stream_ptr_with_info(params, local_stream.get());
     CHECK_SUCCESS_AS_EXPECTED(status);
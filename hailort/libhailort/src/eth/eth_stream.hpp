@@ -18,6 +18,8 @@
 #include "hailo/event.hpp"
 
 #include "eth/token_bucket.hpp"
+#include "eth/eth_rate_controller.hpp"
+#include "eth/eth_async_transfer_thread.hpp"
 #include "eth/udp.hpp"
 #include "stream_common/stream_internal.hpp"
 
@@ -52,6 +54,8 @@ private:
     Udp m_udp;
     bool m_is_stream_activated;
     Device &m_device;
+    StreamBufferMode m_buffer_mode;
+    std::unique_ptr<EthernetAsyncTransferThread> m_async_transfer_thread;
 
     hailo_status eth_stream__config_input_sync_params(uint32_t frames_per_sync);
     hailo_status eth_stream__write_all_no_sync(const void *buffer, size_t offset, size_t size);
@@ -62,22 +66,25 @@ private:
 protected:
     virtual hailo_status eth_stream__write_with_remainder(const void *buffer, size_t offset, size_t size, size_t remainder_size);
     Expected<size_t> sync_write_raw_buffer(const MemoryView &buffer);
+    // Writes up to MAX_SOCKET_BATCH_SIZE packets in a single syscall
+    Expected<size_t> sync_write_raw_buffer_batch(const MemoryView &buffer);
     virtual hailo_status write_impl(const MemoryView &buffer) override;
 
 public:
     EthernetInputStream(Device &device, Udp &&udp, EventPtr &&core_op_activated_event, const LayerInfo &layer_info, hailo_status &status) :
-        InputStreamBase(layer_info, std::move(core_op_activated_event), status), m_udp(std::move(udp)), m_device(device) {}
+        InputStreamBase(layer_info, std::move(core_op_activated_event), status), m_udp(std::move(udp)), m_device(device),
+        m_buffer_mode(StreamBufferMode::NOT_SET) {}
     virtual ~EthernetInputStream();
 
     static Expected<std::unique_ptr<EthernetInputStream>> create(Device &device,
         const LayerInfo &edge_layer, const hailo_eth_input_stream_params_t &params, EventPtr core_op_activated_event);
 
-    virtual hailo_status set_buffer_mode(StreamBufferMode buffer_mode) override
-    {
-        CHECK(buffer_mode == StreamBufferMode::OWNING, HAILO_INVALID_ARGUMENT,
-            "Ethernet streams supports only sync api");
-        return HAILO_SUCCESS;
-    }
+    // In NOT_OWNING mode, the async transfers are run by a transfer thread over the sync write
+    virtual hailo_status set_buffer_mode(StreamBufferMode buffer_mode) override;
+    virtual hailo_status write_async(TransferRequest &&transfer_request) override;
+    virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<size_t> get_async_max_queue_size() const override;
+    virtual hailo_status cancel_pending_transfers() override;
 
     virtual hailo_status activate_stream() override;
     virtual hailo_status deactivate_stream() override;
@@ -107,13 +114,18 @@ private:
     //   consume more than MAX_UDP_PAYLOAD_SIZE tokens from the token bucket.
     static const uint32_t BURST_SIZE = MAX_UDP_PAYLOAD_SIZE;
     static const uint32_t MAX_CONSUME_SIZE = MAX_UDP_PAYLOAD_SIZE;
+    // If not null, adapts the rate (up to rate_bytes_per_sec)
+    std::shared_ptr<EthernetRateController> m_rate_controller;
+
+    double get_rate() const;
 
 protected:
     virtual hailo_status eth_stream__write_with_remainder(const void *buffer, size_t offset, size_t size, size_t remainder_size) override;
 
 public:
     TokenBucketEthernetInputStream(Device &device, Udp &&udp, EventPtr &&core_op_activated_event,
-        uint32_t rate_bytes_per_sec, const LayerInfo &layer_info, hailo_status &status);
+        uint32_t rate_bytes_per_sec, const LayerInfo &layer_info, hailo_status &status,
+        std::shared_ptr<EthernetRateController> rate_controller = nullptr);
     virtual ~TokenBucketEthernetInputStream() = default;
 };
 
@@ -144,6 +156,10 @@ private:
     Udp m_udp;
     bool m_is_stream_activated;
     Device &m_device;
+    // Fed with the lost frames, to adapt the rate of the device's input streams
+    std::shared_ptr<EthernetRateController> m_rate_controller;
+    StreamBufferMode m_buffer_mode;
+    std::unique_ptr<EthernetAsyncTransferThread> m_async_transfer_thread;
 
     EthernetOutputStream(Device &device, const LayerInfo &edge_layer, Udp &&udp, EventPtr &&core_op_activated_event, hailo_status &status) :
         OutputStreamBase(edge_layer, std::move(core_op_activated_event), status),
@@ -154,15 +170,16 @@ private:
         encountered_timeout(false),
         configuration(),
         m_udp(std::move(udp)),
-        m_device(device)
+        m_device(device),
+        m_buffer_mode(StreamBufferMode::NOT_SET)
     {}
 
-    virtual hailo_status set_buffer_mode(StreamBufferMode buffer_mode) override
-    {
-        CHECK(buffer_mode == StreamBufferMode::OWNING, HAILO_INVALID_ARGUMENT,
-            "Ethernet streams supports only sync api");
-        return HAILO_SUCCESS;
-    }
+    // In NOT_OWNING mode, the async transfers are run by a transfer thread over the sync read
+    virtual hailo_status set_buffer_mode(StreamBufferMode buffer_mode) override;
+    virtual hailo_status read_async(TransferRequest &&transfer_request) override;
+    virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<size_t> get_async_max_queue_size() const override;
+    virtual hailo_status cancel_pending_transfers() override;
 
     hailo_status read_impl(MemoryView buffer) override;
     hailo_status read_all_with_sync(void *buffer, size_t offset, size_t size);
@@ -180,6 +197,8 @@ public:
     virtual ~EthernetOutputStream();
 
     Expected<size_t> sync_read_raw_buffer(MemoryView &buffer);
+    // Reads up to MAX_SOCKET_BATCH_SIZE packets in a single syscall
+    Expected<size_t> sync_read_raw_buffer_batch(MemoryView &buffer);
 
     static Expected<std::unique_ptr<EthernetOutputStream>> create(Device &device, const LayerInfo &edge_layer,
         const hailo_eth_output_stream_params_t &params, EventPtr core_op_activated_event);
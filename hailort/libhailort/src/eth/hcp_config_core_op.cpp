@@ -45,6 +45,54 @@ hailo_status HcpConfigCoreOp::set_scheduler_priority(uint8_t /*priority*/, const
     return HAILO_INVALID_OPERATION;
 }
 
+hailo_status HcpConfigCoreOp::set_scheduler_deadline(const std::chrono::milliseconds &/*deadline*/,
+    const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_share(uint32_t /*share*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_device_affinity(uint64_t /*device_mask*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_sticky_placement(bool /*is_sticky*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_pinned_device(uint32_t /*device_index*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_burst_size_bounds(uint32_t /*min_burst_size*/, uint32_t /*max_burst_size*/,
+    const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_batch_size(uint16_t /*batch_size*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status HcpConfigCoreOp::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t /*policy*/,
+    uint32_t /*max_pending_frames*/, const std::string &/*network_name*/)
+{
+    return HAILO_INVALID_OPERATION;
+}
+
+Expected<hailo_scheduler_overload_stats_t> HcpConfigCoreOp::get_scheduler_overload_stats(const std::string &/*network_name*/)
+{
+    return make_unexpected(HAILO_INVALID_OPERATION);
+}
+
 Expected<std::shared_ptr<LatencyMetersMap>> HcpConfigCoreOp::get_latency_meters()
 {
     /* hcp does not support latnecy. return empty map */
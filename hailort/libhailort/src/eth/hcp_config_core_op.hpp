@@ -48,6 +48,18 @@ public:
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout, const std::string &network_name) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold, const std::string &network_name) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) override;
 
     virtual hailo_status activate_impl(uint16_t dynamic_batch_size) override;
     virtual hailo_status deactivate_impl() override;
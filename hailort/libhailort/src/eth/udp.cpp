@@ -18,6 +18,8 @@
 #include <stdint.h>
 #include <errno.h>
 #include <string.h>
+#include <array>
+#include <algorithm>
 
 
 namespace hailort
@@ -28,6 +30,8 @@ namespace hailort
 
 //initialize with padding
 uint8_t g_padded_buffer[MAX_UDP_PAYLOAD_SIZE] = {0,};
+// The padding prefixed to each datagram by send_batch
+static const uint8_t g_padding_bytes[PADDING_BYTES_SIZE] = {0,};
 
 hailo_status Udp::bind(struct in_addr host_ip, uint16_t host_port)
 {
@@ -69,6 +73,12 @@ Udp::Udp(struct in_addr device_ip, uint16_t device_port, struct in_addr host_ip,
         return;
     }
 
+    /* Adjust socket send buff size, so batches of datagrams are queued without blocking */
+    status = m_socket.set_send_buffer_size_max();
+    if (HAILO_SUCCESS != status) {
+        return;
+    }
+
     /* Set default value timeout */
     status = set_timeout(std::chrono::milliseconds(HAILO_DEFAULT_ETH_SCAN_TIMEOUT_MS));
     if (HAILO_SUCCESS != status) {
@@ -170,6 +180,84 @@ hailo_status Udp::recv(uint8_t *buffer, size_t *size)
     return HAILO_SUCCESS;
 }
 
+hailo_status Udp::send_batch(const uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size)
+{
+    std::array<MemoryView, MAX_SOCKET_BATCH_SIZE> datagrams{};
+    size_t datagrams_count = 0;
+    size_t datagrams_sent = 0;
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(buffer);
+    CHECK_ARG_NOT_NULL(size);
+
+    // Same segmentation as a sequence of send() calls
+    const size_t datagram_size = use_padding ?
+        (max_payload_size - PADDING_BYTES_SIZE - PADDING_ALIGN_BYTES) : max_payload_size;
+    size_t offset = 0;
+    while ((offset < *size) && (datagrams_count < MAX_SOCKET_BATCH_SIZE)) {
+        const auto current_size = std::min(datagram_size, *size - offset);
+        datagrams[datagrams_count++] = MemoryView::create_const(buffer + offset, current_size);
+        offset += current_size;
+    }
+
+    const auto prefix = use_padding ? MemoryView::create_const(g_padding_bytes, sizeof(g_padding_bytes)) : MemoryView();
+    auto status = m_socket.send_to_batch(datagrams.data(), datagrams_count, prefix, MSG_CONFIRM,
+        (const struct sockaddr *) &m_device_address, m_device_address_length, &datagrams_sent);
+    if (HAILO_STREAM_ABORT == status) {
+        LOGGER__INFO("Socket send_to_batch was aborted!");
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    size_t number_of_sent_bytes = 0;
+    for (size_t i = 0; i < datagrams_sent; i++) {
+        number_of_sent_bytes += datagrams[i].size();
+    }
+    *size = number_of_sent_bytes;
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status Udp::recv_batch(uint8_t *buffer, size_t *size, size_t max_payload_size)
+{
+    std::array<MemoryView, MAX_SOCKET_BATCH_SIZE> datagrams{};
+    std::array<size_t, MAX_SOCKET_BATCH_SIZE> bytes_received{};
+    size_t datagrams_count = 0;
+    size_t datagrams_received = 0;
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(buffer);
+    CHECK_ARG_NOT_NULL(size);
+
+    const size_t datagram_size = std::min(max_payload_size, static_cast<size_t>(MAX_UDP_PAYLOAD_SIZE));
+    size_t offset = 0;
+    while ((offset < *size) && (datagrams_count < MAX_SOCKET_BATCH_SIZE)) {
+        const auto current_size = std::min(datagram_size, *size - offset);
+        datagrams[datagrams_count++] = MemoryView(buffer + offset, current_size);
+        offset += current_size;
+    }
+
+    auto status = m_socket.recv_from_batch(datagrams.data(), datagrams_count, 0, (struct sockaddr *) &m_device_address,
+        m_device_address_length, bytes_received.data(), &datagrams_received);
+    if (HAILO_STREAM_ABORT == status) {
+        LOGGER__INFO("Socket recv_from_batch was aborted!");
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    // Datagrams shorter than their slot leave holes, so the following datagrams are moved back
+    size_t number_of_received_bytes = 0;
+    for (size_t i = 0; i < datagrams_received; i++) {
+        if (datagrams[i].data() != (buffer + number_of_received_bytes)) {
+            memmove(buffer + number_of_received_bytes, datagrams[i].data(), bytes_received[i]);
+        }
+        number_of_received_bytes += bytes_received[i];
+    }
+    *size = number_of_received_bytes;
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status Udp::abort()
 {
     return m_socket.abort();
@@ -274,6 +362,74 @@ hailo_status Udp::fw_interact(uint8_t *request_buffer, size_t request_size, uint
     return HAILO_SUCCESS;
 }
 
+hailo_status Udp::fw_interact_pipelined(const std::vector<MemoryView> &requests, std::vector<MemoryView> &responses,
+    std::vector<size_t> &response_sizes, const std::vector<uint32_t> &expected_sequences)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+    HAILO_COMMON_STATUS_t common_status = HAILO_COMMON_STATUS__UNINITIALIZED;
+    uint8_t receive_buffer[MAX_UDP_PAYLOAD_SIZE] = {};
+
+    /* Validate arguments */
+    CHECK((requests.size() == responses.size()) && (requests.size() == response_sizes.size()) &&
+        (requests.size() == expected_sequences.size()), HAILO_INVALID_ARGUMENT, "Mismatching pipelined controls sizes");
+
+    std::vector<bool> is_answered(requests.size(), false);
+    size_t answered_count = 0;
+
+    for (size_t attempt_number = 0; attempt_number < m_max_number_of_attempts; ++attempt_number) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            if (is_answered[i]) {
+                continue;
+            }
+            size_t request_size = requests[i].size();
+            status = send(const_cast<uint8_t*>(requests[i].data()), &request_size, false, MAX_UDP_PAYLOAD_SIZE);
+            CHECK_SUCCESS(status);
+            CHECK(requests[i].size() == request_size, HAILO_ETH_FAILURE,
+                "Did not send all data at UDP__fw_interact_pipelined. Expected to send: {}, actually sent: {}",
+                requests[i].size(), request_size);
+        }
+
+        while (answered_count < requests.size()) {
+            size_t received_size = sizeof(receive_buffer);
+            status = recv(receive_buffer, &received_size);
+            if ((HAILO_ETH_RECV_FAILURE == status) || (HAILO_TIMEOUT == status)) {
+                break;
+            }
+            CHECK_SUCCESS(status);
+
+            uint32_t received_sequence = 0;
+            common_status = CONTROL_PROTOCOL__get_sequence_from_response_buffer(receive_buffer, received_size,
+                &received_sequence);
+            status = (HAILO_COMMON_STATUS__SUCCESS == common_status) ? HAILO_SUCCESS : HAILO_INTERNAL_FAILURE;
+            CHECK_SUCCESS(status);
+
+            const auto found = std::find(expected_sequences.begin(), expected_sequences.end(), received_sequence);
+            const auto index = static_cast<size_t>(std::distance(expected_sequences.begin(), found));
+            if ((expected_sequences.end() == found) || is_answered[index]) {
+                LOGGER__WARNING("Invalid sequence received ({}). Discarding it.", received_sequence);
+                continue;
+            }
+
+            CHECK(received_size <= response_sizes[index], HAILO_ETH_FAILURE,
+                "Control response of size {} is larger than its buffer ({})", received_size, response_sizes[index]);
+            memcpy(responses[index].data(), receive_buffer, received_size);
+            response_sizes[index] = received_size;
+            is_answered[index] = true;
+            answered_count++;
+        }
+
+        if (answered_count == requests.size()) {
+            return HAILO_SUCCESS;
+        }
+        LOGGER__WARN("{} of {} pipelined control responses were not received, sending them again. "
+            "Attempt number: {} (zero indexed)", requests.size() - answered_count, requests.size(), attempt_number);
+    }
+
+    LOGGER__ERROR("{} of {} pipelined control responses were not received", requests.size() - answered_count,
+        requests.size());
+    return HAILO_ETH_FAILURE;
+}
+
 hailo_status Udp::set_max_number_of_attempts(uint8_t max_number_of_attempts)
 {
     /* Validate arguments */
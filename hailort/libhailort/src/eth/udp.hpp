@@ -15,6 +15,8 @@
 
 #include "common/socket.hpp"
 
+#include <vector>
+
 
 namespace hailort
 {
@@ -30,11 +32,23 @@ public:
     hailo_status set_timeout(const std::chrono::milliseconds timeout_ms);
     hailo_status send(uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size);
     hailo_status recv(uint8_t *buffer, size_t *size);
+    // Sends the buffer as up to MAX_SOCKET_BATCH_SIZE datagrams of max_payload_size (excluding the padding) in a single
+    // syscall (where supported). size is updated to the number of bytes sent (excluding the padding).
+    hailo_status send_batch(const uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size);
+    // Receives up to MAX_SOCKET_BATCH_SIZE datagrams of at most max_payload_size into the buffer in a single syscall
+    // (where supported), waiting only for the first one. The datagrams are stored contiguously, and size is updated to
+    // the number of bytes received.
+    hailo_status recv_batch(uint8_t *buffer, size_t *size, size_t max_payload_size);
     hailo_status abort();
     hailo_status has_data(bool log_timeouts_in_debug = false);
     hailo_status fw_interact(uint8_t *request_buffer, size_t request_size, uint8_t *response_buffer,
         size_t *response_size, uint32_t expected_sequence);
     hailo_status set_max_number_of_attempts(uint8_t max_number_of_attempts);
+    // Sends all the requests before waiting for their responses (matched by expected_sequences), so several controls
+    // are outstanding at once. Requests whose response wasn't received are sent again, up to the max number of
+    // attempts. response_sizes holds the sizes of the responses buffers, and is updated to the received sizes.
+    hailo_status fw_interact_pipelined(const std::vector<MemoryView> &requests, std::vector<MemoryView> &responses,
+        std::vector<size_t> &response_sizes, const std::vector<uint32_t> &expected_sequences);
 
     UDP__sockaddr_in_t m_host_address;
     socklen_t m_host_address_length;
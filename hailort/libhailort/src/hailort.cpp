@@ -22,6 +22,7 @@
 #include "hailo/network_rate_calculator.hpp"
 #include "hailo/inference_pipeline.hpp"
 #include "hailo/quantization.hpp"
+#include "hailo/infer_model.hpp"
 
 #include "common/compiler_extensions_compat.hpp"
 #include "common/os_utils.hpp"
@@ -1086,6 +1087,97 @@ hailo_status hailo_set_scheduler_priority(hailo_configured_network_group configu
     return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_priority(priority, network_name_str);
 }
 
+hailo_status hailo_set_scheduler_deadline(hailo_configured_network_group configured_network_group, uint32_t deadline_ms,
+    const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_deadline(
+        std::chrono::milliseconds(deadline_ms), network_name_str);
+}
+
+hailo_status hailo_set_scheduler_share(hailo_configured_network_group configured_network_group, uint32_t share,
+    const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_share(share, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_device_affinity(hailo_configured_network_group configured_network_group,
+    uint64_t device_mask, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_device_affinity(
+        device_mask, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_sticky_placement(hailo_configured_network_group configured_network_group,
+    bool is_sticky, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_sticky_placement(
+        is_sticky, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_pinned_device(hailo_configured_network_group configured_network_group,
+    uint32_t device_index, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_pinned_device(
+        device_index, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_burst_size_bounds(hailo_configured_network_group configured_network_group,
+    uint32_t min_burst_size, uint32_t max_burst_size, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_burst_size_bounds(
+        min_burst_size, max_burst_size, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_batch_size(hailo_configured_network_group configured_network_group,
+    uint16_t batch_size, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_batch_size(
+        batch_size, network_name_str);
+}
+
+hailo_status hailo_set_scheduler_overload_policy(hailo_configured_network_group configured_network_group,
+    hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    return (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->set_scheduler_overload_policy(
+        policy, max_pending_frames, network_name_str);
+}
+
+hailo_status hailo_get_scheduler_overload_stats(hailo_configured_network_group configured_network_group,
+    hailo_scheduler_overload_stats_t *stats, const char *network_name)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+    CHECK_ARG_NOT_NULL(stats);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+    TRY(*stats, (reinterpret_cast<ConfiguredNetworkGroup*>(configured_network_group))->get_scheduler_overload_stats(
+        network_name_str));
+    return HAILO_SUCCESS;
+}
+
 hailo_status hailo_allocate_buffer(size_t size, const hailo_buffer_parameters_t *allocation_params, void **buffer_out)
 {
     CHECK_ARG_NOT_NULL(allocation_params);
@@ -1284,6 +1376,34 @@ hailo_status hailo_stream_wait_for_async_input_ready(hailo_input_stream stream,
     return (reinterpret_cast<InputStream*>(stream))->wait_for_async_ready(transfer_size, std::chrono::milliseconds(timeout_ms));
 }
 
+template<typename StreamType>
+static hailo_status get_async_ready_handle(StreamType &stream, underlying_handle_t *handle)
+{
+#if defined(__QNX__)
+    (void)stream;
+    (void)handle;
+    LOGGER__ERROR("Async ready handles are not supported on QNX");
+    return HAILO_NOT_SUPPORTED;
+#else
+    TRY(*handle, stream.get_async_ready_handle());
+    return HAILO_SUCCESS;
+#endif
+}
+
+hailo_status hailo_stream_get_async_output_ready_handle(hailo_output_stream stream, underlying_handle_t *handle)
+{
+    CHECK_ARG_NOT_NULL(stream);
+    CHECK_ARG_NOT_NULL(handle);
+    return get_async_ready_handle(*reinterpret_cast<OutputStream*>(stream), handle);
+}
+
+hailo_status hailo_stream_get_async_input_ready_handle(hailo_input_stream stream, underlying_handle_t *handle)
+{
+    CHECK_ARG_NOT_NULL(stream);
+    CHECK_ARG_NOT_NULL(handle);
+    return get_async_ready_handle(*reinterpret_cast<InputStream*>(stream), handle);
+}
+
 hailo_status hailo_output_stream_get_async_max_queue_size(hailo_output_stream stream, size_t *queue_size)
 {
     CHECK_ARG_NOT_NULL(stream);
@@ -2460,6 +2580,23 @@ hailo_status hailo_vdevice_get_physical_devices_ids(hailo_vdevice vdevice, hailo
     return HAILO_SUCCESS;
 }
 
+hailo_status hailo_vdevice_add_device(hailo_vdevice vdevice, const hailo_device_id_t *device_id)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(device_id);
+
+    return (reinterpret_cast<VDevice *>(vdevice))->add_device(device_id->id);
+}
+
+hailo_status hailo_vdevice_remove_device(hailo_vdevice vdevice, const hailo_device_id_t *device_id,
+    uint32_t timeout_ms)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(device_id);
+
+    return (reinterpret_cast<VDevice *>(vdevice))->remove_device(device_id->id, std::chrono::milliseconds(timeout_ms));
+}
+
 hailo_status hailo_release_vdevice(hailo_vdevice vdevice_ptr)
 {
     CHECK_ARG_NOT_NULL(vdevice_ptr);
@@ -2514,6 +2651,277 @@ hailo_status hailo_infer(hailo_configured_network_group network_group,
     return HAILO_SUCCESS;
 }
 
+/* Infer model API functions */
+// The C handles of the infer model API (the C++ objects are held by value or by shared pointer, so they are wrapped)
+struct _hailo_infer_model {
+    std::shared_ptr<InferModel> infer_model;
+};
+
+struct _hailo_configured_infer_model {
+    // The infer model is kept alive for as long as it is configured
+    std::shared_ptr<InferModel> infer_model;
+    ConfiguredInferModel configured_infer_model;
+};
+
+static hailo_status create_infer_model_handle(Expected<std::shared_ptr<InferModel>> &&infer_model,
+    hailo_infer_model *infer_model_out)
+{
+    CHECK_EXPECTED_AS_STATUS(infer_model);
+
+    auto handle = new (std::nothrow) _hailo_infer_model{infer_model.release()};
+    CHECK_NOT_NULL(handle, HAILO_OUT_OF_HOST_MEMORY);
+
+    *infer_model_out = handle;
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_create_infer_model(hailo_vdevice vdevice, const char *hef_path, const char *network_name,
+    hailo_infer_model *infer_model)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(hef_path);
+    CHECK_ARG_NOT_NULL(infer_model);
+
+    return create_infer_model_handle(
+        reinterpret_cast<VDevice*>(vdevice)->create_infer_model(hef_path, get_name_as_str(network_name)), infer_model);
+}
+
+hailo_status hailo_create_infer_model_from_buffer(hailo_vdevice vdevice, const void *hef_buffer,
+    size_t hef_buffer_size, const char *network_name, hailo_infer_model *infer_model)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(hef_buffer);
+    CHECK_ARG_NOT_NULL(infer_model);
+
+    return create_infer_model_handle(reinterpret_cast<VDevice*>(vdevice)->create_infer_model(
+        MemoryView::create_const(hef_buffer, hef_buffer_size), get_name_as_str(network_name)), infer_model);
+}
+
+hailo_status hailo_release_infer_model(hailo_infer_model infer_model)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    delete infer_model;
+    return HAILO_SUCCESS;
+}
+
+static hailo_status copy_names_to_array(const std::vector<std::string> &names_vec, const char **names,
+    size_t *names_count)
+{
+    const auto max_entries = *names_count;
+    *names_count = names_vec.size();
+    CHECK(names_vec.size() <= max_entries, HAILO_INSUFFICIENT_BUFFER,
+        "The given buffer is too small to contain all names. There are {} names, given buffer size is {}",
+        names_vec.size(), max_entries);
+
+    for (size_t i = 0; i < names_vec.size(); i++) {
+        names[i] = names_vec[i].c_str();
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_get_input_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(names);
+    CHECK_ARG_NOT_NULL(names_count);
+
+    return copy_names_to_array(infer_model->infer_model->get_input_names(), names, names_count);
+}
+
+hailo_status hailo_infer_model_get_output_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(names);
+    CHECK_ARG_NOT_NULL(names_count);
+
+    return copy_names_to_array(infer_model->infer_model->get_output_names(), names, names_count);
+}
+
+// The names of the inputs and the outputs are unique, so a stream is looked up in both
+static Expected<InferModel::InferStream> get_infer_model_stream(InferModel &infer_model, const std::string &name)
+{
+    const auto &input_names = infer_model.get_input_names();
+    if (std::find(input_names.begin(), input_names.end(), name) != input_names.end()) {
+        return infer_model.input(name);
+    }
+    return infer_model.output(name);
+}
+
+hailo_status hailo_infer_model_get_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(frame_size);
+
+    TRY(const auto stream, get_infer_model_stream(*infer_model->infer_model, name));
+    *frame_size = stream.get_frame_size();
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_set_format_type(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t format_type)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+
+    TRY(auto stream, get_infer_model_stream(*infer_model->infer_model, name));
+    stream.set_format_type(format_type);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_set_batch_size(hailo_infer_model infer_model, uint16_t batch_size)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+
+    infer_model->infer_model->set_batch_size(batch_size);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configure_infer_model(hailo_infer_model infer_model,
+    hailo_configured_infer_model *configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+
+    TRY(auto configured, infer_model->infer_model->configure());
+    auto handle = new (std::nothrow) _hailo_configured_infer_model{infer_model->infer_model, std::move(configured)};
+    CHECK_NOT_NULL(handle, HAILO_OUT_OF_HOST_MEMORY);
+
+    *configured_infer_model = handle;
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_release_configured_infer_model(hailo_configured_infer_model configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    delete configured_infer_model;
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_wait_for_async_ready(
+    hailo_configured_infer_model configured_infer_model, uint32_t timeout_ms, uint32_t frames_count)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+
+    return configured_infer_model->configured_infer_model.wait_for_async_ready(
+        std::chrono::milliseconds(timeout_ms), frames_count);
+}
+
+hailo_status hailo_configured_infer_model_get_async_ready_handle(
+    hailo_configured_infer_model configured_infer_model, underlying_handle_t *handle)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(handle);
+
+    return get_async_ready_handle(configured_infer_model->configured_infer_model, handle);
+}
+
+static std::string get_raw_buffer_name(const hailo_stream_raw_buffer_by_name_t &raw_buffer)
+{
+    // The name may fill the whole array, without a NULL terminator
+    return std::string(raw_buffer.name, strnlen(raw_buffer.name, HAILO_MAX_STREAM_NAME_SIZE));
+}
+
+static Expected<ConfiguredInferModel::Bindings> create_infer_bindings(ConfiguredInferModel &configured_infer_model,
+    const hailo_infer_bindings_t &c_bindings)
+{
+    CHECK_AS_EXPECTED((0 == c_bindings.inputs_count) || (nullptr != c_bindings.inputs), HAILO_INVALID_ARGUMENT,
+        "Bindings inputs must not be NULL");
+    CHECK_AS_EXPECTED((0 == c_bindings.outputs_count) || (nullptr != c_bindings.outputs), HAILO_INVALID_ARGUMENT,
+        "Bindings outputs must not be NULL");
+
+    TRY(auto bindings, configured_infer_model.create_bindings());
+    for (size_t i = 0; i < c_bindings.inputs_count; i++) {
+        const auto &raw_buffer = c_bindings.inputs[i];
+        TRY(auto stream, bindings.input(get_raw_buffer_name(raw_buffer)));
+        CHECK_SUCCESS_AS_EXPECTED(stream.set_buffer(MemoryView(raw_buffer.raw_buffer.buffer,
+            raw_buffer.raw_buffer.size)));
+    }
+    for (size_t i = 0; i < c_bindings.outputs_count; i++) {
+        const auto &raw_buffer = c_bindings.outputs[i];
+        TRY(auto stream, bindings.output(get_raw_buffer_name(raw_buffer)));
+        CHECK_SUCCESS_AS_EXPECTED(stream.set_buffer(MemoryView(raw_buffer.raw_buffer.buffer,
+            raw_buffer.raw_buffer.size)));
+    }
+    return bindings;
+}
+
+static Expected<std::vector<ConfiguredInferModel::Bindings>> create_infer_bindings(
+    ConfiguredInferModel &configured_infer_model, const hailo_infer_bindings_t *c_bindings, size_t bindings_count)
+{
+    std::vector<ConfiguredInferModel::Bindings> bindings;
+    bindings.reserve(bindings_count);
+    for (size_t i = 0; i < bindings_count; i++) {
+        TRY(auto frame_bindings, create_infer_bindings(configured_infer_model, c_bindings[i]));
+        bindings.emplace_back(std::move(frame_bindings));
+    }
+    return bindings;
+}
+
+static std::function<void(const AsyncInferCompletionInfo &)> wrap_c_user_callback(
+    hailo_infer_async_callback_t callback, void *opaque)
+{
+    return [callback, opaque](const AsyncInferCompletionInfo &completion_info) {
+        hailo_infer_async_completion_info_t c_completion_info{};
+        c_completion_info.status = completion_info.status;
+        c_completion_info.sequence_number = completion_info.sequence_number;
+        c_completion_info.opaque = opaque;
+        callback(&c_completion_info);
+    };
+}
+
+hailo_status hailo_configured_infer_model_run_async(hailo_configured_infer_model configured_infer_model,
+    const hailo_infer_bindings_t *bindings, size_t bindings_count, hailo_infer_async_callback_t callback, void *opaque)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(bindings);
+    CHECK_ARG_NOT_NULL(callback);
+    CHECK(0 < bindings_count, HAILO_INVALID_ARGUMENT, "At least one bindings must be given");
+
+    auto &configured = configured_infer_model->configured_infer_model;
+    if (1 == bindings_count) {
+        // The single bindings launch is the cheaper one (no vector of bindings)
+        TRY(auto frame_bindings, create_infer_bindings(configured, bindings[0]));
+        TRY(auto job, configured.run_async(std::move(frame_bindings), wrap_c_user_callback(callback, opaque)));
+        job.detach();
+        return HAILO_SUCCESS;
+    }
+
+    TRY(const auto bindings_vec, create_infer_bindings(configured, bindings, bindings_count));
+    TRY(auto job, configured.run_async(bindings_vec, wrap_c_user_callback(callback, opaque)));
+    job.detach();
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_register_bindings(
+    hailo_configured_infer_model configured_infer_model, const hailo_infer_bindings_t *bindings,
+    size_t bindings_count)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(bindings);
+
+    auto &configured = configured_infer_model->configured_infer_model;
+    TRY(const auto bindings_vec, create_infer_bindings(configured, bindings, bindings_count));
+    return configured.register_bindings(bindings_vec);
+}
+
+hailo_status hailo_configured_infer_model_run_async_registered(
+    hailo_configured_infer_model configured_infer_model, size_t bindings_index, hailo_infer_async_callback_t callback,
+    void *opaque)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(callback);
+
+    TRY(auto job, configured_infer_model->configured_infer_model.run_async_registered(bindings_index,
+        wrap_c_user_callback(callback, opaque)));
+    job.detach();
+    return HAILO_SUCCESS;
+}
+/* End of infer model API functions */
+
 /* Multi network API functions */
 static hailo_status convert_network_infos_vector_to_array(std::vector<hailo_network_info_t> &&network_infos_vec, 
     hailo_network_info_t *network_infos, size_t *number_of_networks)
@@ -372,6 +372,17 @@ hailo_vdevice_params_t HailoRTDefaults::get_vdevice_params()
     params.device_ids = nullptr;
     params.group_id = HAILO_DEFAULT_VDEVICE_GROUP_ID;
     params.multi_process_service = false;
+    params.interrupts_wait_mode = HAILO_INTERRUPTS_WAIT_MODE_BLOCKING;
+    params.interrupts_polling_idle_budget_us = HAILO_DEFAULT_INTERRUPTS_POLLING_IDLE_BUDGET_US;
+    params.user_buffers_mapping_cache_size = 0;
+    params.transfer_launcher_workers_count = HAILO_DEFAULT_TRANSFER_LAUNCHER_WORKERS_COUNT;
+    params.transfer_launcher_cpu_affinity_mask = 0;
+    params.numa_node = HAILO_NUMA_NODE_AUTO;
+    params.scheduler_cpu_affinity_mask = 0;
+    params.interrupts_cpu_affinity_mask = 0;
+    params.threads_realtime_priority = 0;
+    params.multi_device_pipelining = false;
+    params.allow_devices_hot_plug = false;
     return params;
 }
 
@@ -197,6 +197,11 @@ hailo_status WriteDataCcwActionByBuffer::write_to_config_buffer(ConfigBuffer& co
     return HAILO_SUCCESS;
 }
 
+bool WriteDataCcwActionByBuffer::supports_concurrent_writes() const
+{
+    return true;
+}
+
 Expected<ContextSwitchConfigActionPtr> WriteDataCcwAction::create(std::vector<ccw_write_ptr_t> &&ccw_write_ptrs, uint8_t config_stream_index,
     uint16_t total_ccw_burst, std::shared_ptr<SeekableBytesReader> hef_reader)
 {
@@ -275,6 +280,11 @@ hailo_status WriteDataCcwAction::write_to_config_buffer(ConfigBuffer& config_buf
     return HAILO_SUCCESS;
 }
 
+bool WriteDataCcwAction::supports_concurrent_writes() const
+{
+    return m_hef_reader->supports_concurrent_reads();
+}
+
 Expected<ContextSwitchConfigActionPtr> AddCcwBurstAction::create(uint8_t config_stream_index, uint16_t ccw_bursts)
 {
     auto result = ContextSwitchConfigActionPtr(new (std::nothrow) AddCcwBurstAction(config_stream_index, ccw_bursts));
@@ -184,6 +184,8 @@ public:
     virtual size_t size() const { return m_size; }
     virtual uint8_t config_stream_index() const { return m_config_stream_index; }
     virtual hailo_status write_to_config_buffer(ConfigBuffer& config_buffer, bool should_support_pre_fetch);
+    // Whether write_to_config_buffer may be called while other actions (of the same HEF) write to other config buffers
+    virtual bool supports_concurrent_writes() const;
     uint16_t total_ccw_burst() const { return m_total_ccw_burst; }
 
 protected:
@@ -210,6 +212,7 @@ public:
 
     virtual size_t size() const override { return m_data.size(); }
     virtual hailo_status write_to_config_buffer(ConfigBuffer& config_buffer, bool should_support_pre_fetch) override;
+    virtual bool supports_concurrent_writes() const override;
 
 private:
     WriteDataCcwActionByBuffer(Buffer &&data, uint8_t config_stream_index,
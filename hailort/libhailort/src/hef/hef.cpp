@@ -106,6 +106,7 @@ static std::string get_shape_str(const hailo_vstream_info_t &vstream_info)
     {
     case HAILO_FORMAT_ORDER_HAILO_NMS:
     case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
+    case HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE:
         return HailoRTCommon::get_format_type_str(vstream_info.format.type) + ", " + HailoRTCommon::get_format_order_str(vstream_info.format.order) +
             "(number of classes: " + std::to_string(vstream_info.nms_shape.number_of_classes) +
             ", maximum bounding boxes per class: " + std::to_string(vstream_info.nms_shape.max_bboxes_per_class) +
@@ -177,6 +178,37 @@ Hef::Hef(std::unique_ptr<Impl> pimpl) :
     pimpl(std::move(pimpl))
 {}
 
+Hef::Impl::Impl(const Impl &other) :
+    m_header(other.m_header),
+    m_included_features(other.m_included_features),
+    m_supported_features(other.m_supported_features),
+    m_groups(other.m_groups),
+    m_core_ops_per_group(other.m_core_ops_per_group),
+    m_post_process_ops_metadata_per_group(other.m_post_process_ops_metadata_per_group),
+    m_hef_extensions(other.m_hef_extensions),
+    m_hef_optional_extensions(other.m_hef_optional_extensions),
+    m_supported_extensions_bitset(other.m_supported_extensions_bitset),
+    m_hef_version(other.m_hef_version),
+    m_md5(),
+    m_crc(other.m_crc),
+    m_hef_reader(other.m_hef_reader),
+    m_parsed_proto(other.m_parsed_proto),
+#ifdef HAILO_SUPPORT_MULTI_PROCESS
+    m_hef_buffer(),
+    m_mapped_hef_reader(other.m_mapped_hef_reader),
+#endif // HAILO_SUPPORT_MULTI_PROCESS
+    m_network_group_metadata(other.m_network_group_metadata)
+{
+    memcpy(m_md5, other.m_md5, sizeof(m_md5));
+}
+
+Expected<Hef> Hef::Impl::share() const
+{
+    auto impl = std::unique_ptr<Impl>(new (std::nothrow) Impl(*this));
+    CHECK_NOT_NULL_AS_EXPECTED(impl, HAILO_OUT_OF_HOST_MEMORY);
+    return Hef(std::move(impl));
+}
+
 Expected<std::vector<hailo_stream_info_t>> Hef::get_input_stream_infos(const std::string &name) const
 {
     TRY(const auto network_pair, pimpl->get_network_group_and_network_name(name));
@@ -435,6 +467,7 @@ void Hef::Impl::clear_hef_buffer()
 {
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
     m_hef_buffer = Buffer();
+    m_mapped_hef_reader.reset();
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 }
 
@@ -476,9 +509,40 @@ hailo_status Hef::Impl::fill_core_ops_and_networks_metadata(uint32_t hef_version
     return HAILO_SUCCESS;
 }
 
+Expected<std::shared_ptr<MappedFileReader>> MappedFileReader::create(const std::string &file_path)
+{
+    TRY(auto mapping, MmapBuffer<uint8_t>::create_file_map_read_only(file_path));
+
+    auto reader = make_shared_nothrow<MappedFileReader>(std::move(mapping));
+    CHECK_NOT_NULL_AS_EXPECTED(reader, HAILO_OUT_OF_HOST_MEMORY);
+
+    return reader;
+}
+
+// The mapped address doesn't change when the mapping is moved, so the view may be taken before moving it
+MappedFileReader::MappedFileReader(MmapBuffer<uint8_t> &&mapping) :
+    BufferReader(MemoryView(mapping.address(), mapping.size())),
+    m_mapping(std::move(mapping))
+{}
+
 // TODO HRT-13920: remove duplications between parse_hef_file and parse_hef_memview
 hailo_status Hef::Impl::parse_hef_file(const std::string &hef_path)
 {
+    // Parsing the mapped file saves reading (and holding) the whole file in memory - only the header and the protobuf
+    // message are read while parsing, and the CCWs are read from the mapping when a core-op is configured.
+    auto mapped_hef_reader = MappedFileReader::create(hef_path);
+    if (mapped_hef_reader) {
+        auto status = parse_hef_buffer(mapped_hef_reader.value()->get_memview(), mapped_hef_reader.value());
+        CHECK_SUCCESS(status);
+#ifdef HAILO_SUPPORT_MULTI_PROCESS
+        m_mapped_hef_reader = mapped_hef_reader.release();
+#endif // HAILO_SUPPORT_MULTI_PROCESS
+
+        TRACE(HefLoadedTrace, hef_path, m_header.sdk_version(), m_md5);
+        return HAILO_SUCCESS;
+    }
+    LOGGER__DEBUG("Mapping HEF file {} failed with status {}, reading it instead", hef_path, mapped_hef_reader.status());
+
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
     TRY(m_hef_buffer, read_binary_file(hef_path));
 #endif // HAILO_SUPPORT_MULTI_PROCESS
@@ -548,13 +612,32 @@ hailo_status Hef::Impl::parse_hef_file(const std::string &hef_path)
 hailo_status Hef::Impl::parse_hef_memview_internal(const size_t proto_size, const uint8_t *proto_buffer, const uint32_t hef_version,
     std::shared_ptr<SeekableBytesReader> hef_reader, size_t ccws_offset)
 {
-    ProtoHEFHef hef_message;
-    auto rb = hef_message.ParseFromArray(proto_buffer, static_cast<int>(proto_size));
-    CHECK(rb, HAILO_INVALID_HEF, "Failed parsing HEF buffer");
-    auto status = transfer_protobuf_field_ownership(hef_message);
-    CHECK_SUCCESS(status);
+    ParsedHefProtoCache::Key proto_md5{};
+    if (HEADER_VERSION_0 == hef_version) {
+        // The MD5 of V0 HEFs was already calculated on the protobuf message
+        std::copy(std::begin(m_md5), std::end(m_md5), proto_md5.begin());
+    } else {
+        MD5_SUM_t calculated_md5 = {};
+        auto status = calc_buffer_md5(proto_buffer, proto_size, calculated_md5);
+        CHECK_SUCCESS(status);
+        std::copy(std::begin(calculated_md5), std::end(calculated_md5), proto_md5.begin());
+    }
 
-    status = fill_core_ops_and_networks_metadata(hef_version, hef_reader, ccws_offset);
+    auto &parsed_proto_cache = ParsedHefProtoCache::get_instance();
+    auto parsed_proto = parsed_proto_cache.get(proto_md5);
+    if (nullptr != parsed_proto) {
+        init_parsed_proto(parsed_proto);
+    } else {
+        ProtoHEFHef hef_message;
+        auto rb = hef_message.ParseFromArray(proto_buffer, static_cast<int>(proto_size));
+        CHECK(rb, HAILO_INVALID_HEF, "Failed parsing HEF buffer");
+        auto status = transfer_protobuf_field_ownership(hef_message);
+        CHECK_SUCCESS(status);
+
+        parsed_proto_cache.add(proto_md5, m_parsed_proto);
+    }
+
+    auto status = fill_core_ops_and_networks_metadata(hef_version, hef_reader, ccws_offset);
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -568,13 +651,19 @@ hailo_status Hef::Impl::parse_hef_memview(const MemoryView &hef_memview)
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
     TRY(auto hef_reader, SeekableBytesReader::create_reader(hef_memview));
+    return parse_hef_buffer(hef_memview, hef_reader);
+}
+
+// hef_reader reads from hef_memview, and is kept for reading the CCWs when a core-op is configured
+hailo_status Hef::Impl::parse_hef_buffer(const MemoryView &hef_memview, std::shared_ptr<SeekableBytesReader> hef_reader)
+{
     m_hef_reader = hef_reader;
 
+    CHECK(hef_memview.size() >= sizeof(hef__header_t), HAILO_INVALID_HEF, "Invalid HEF header");
+
     TRY(auto hef_header, parse_hef_header_before_distinct(hef_reader));
     init_hef_version(hef_header.version);
 
-    CHECK(hef_memview.size() >= sizeof(hef__header_t), HAILO_INVALID_HEF, "Invalid HEF header");
-
     size_t ccws_offset = 0; // Relevant only for HEADER_VERSION_1
 
     if (HEADER_VERSION_0 == hef_header.version) {
@@ -873,37 +962,78 @@ void Hef::Impl::fill_core_ops()
 
 hailo_status Hef::Impl::transfer_protobuf_field_ownership(ProtoHEFHef &hef_message)
 {
-    m_groups.reserve(hef_message.network_groups().size());
+    auto parsed_proto = make_shared_nothrow<ParsedHefProto>();
+    CHECK_NOT_NULL(parsed_proto, HAILO_OUT_OF_HOST_MEMORY);
+
+    parsed_proto->groups.reserve(hef_message.network_groups().size());
     while (!hef_message.network_groups().empty()) {
         // We pass the ownership from protobuf to shared_ptr (it'll call delete when the refcount drops to 0)
         // Note: Protobuf messages are allocated with new
         const auto network_group = hef_message.mutable_network_groups()->ReleaseLast();
         CHECK(nullptr != network_group, HAILO_INTERNAL_FAILURE, "Null network group found while parsing HEF; Unexpected");
-        m_groups.emplace_back(network_group);
+        parsed_proto->groups.emplace_back(network_group);
     }
 
-    m_hef_extensions.reserve(hef_message.extensions().size());
+    parsed_proto->extensions.reserve(hef_message.extensions().size());
     for (const auto &extension : hef_message.extensions()) {
-        m_hef_extensions.emplace_back(extension);
+        parsed_proto->extensions.emplace_back(extension);
     }
 
-    m_header.CopyFrom(hef_message.header());
-    m_included_features.CopyFrom(hef_message.included_features());
+    parsed_proto->header.CopyFrom(hef_message.header());
+    parsed_proto->included_features.CopyFrom(hef_message.included_features());
 
-    m_hef_optional_extensions.reserve(hef_message.optional_extensions().size());
+    parsed_proto->optional_extensions.reserve(hef_message.optional_extensions().size());
     for (const auto &optional_extension : hef_message.optional_extensions()) {
-        m_hef_optional_extensions.emplace_back(optional_extension);
+        parsed_proto->optional_extensions.emplace_back(optional_extension);
     }
 
+    init_parsed_proto(parsed_proto);
+    return HAILO_SUCCESS;
+}
+
+void Hef::Impl::init_parsed_proto(std::shared_ptr<ParsedHefProto> parsed_proto)
+{
+    m_groups = parsed_proto->groups;
+    m_hef_extensions = parsed_proto->extensions;
+    m_header.CopyFrom(parsed_proto->header);
+    m_included_features.CopyFrom(parsed_proto->included_features);
+    m_hef_optional_extensions = parsed_proto->optional_extensions;
+
     m_supported_features = get_supported_features(m_header, m_hef_extensions, m_included_features,
         m_hef_optional_extensions);
 
-    return HAILO_SUCCESS;
+    m_parsed_proto = parsed_proto;
+}
+
+ParsedHefProtoCache &ParsedHefProtoCache::get_instance()
+{
+    static ParsedHefProtoCache instance;
+    return instance;
+}
+
+std::shared_ptr<ParsedHefProto> ParsedHefProtoCache::get(const Key &key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = m_entries.find(key);
+    return (m_entries.end() != entry) ? entry->second.lock() : nullptr;
+}
+
+void ParsedHefProtoCache::add(const Key &key, std::shared_ptr<ParsedHefProto> parsed_proto)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Drop the entries of the contents no Hef holds anymore
+    for (auto entry = m_entries.begin(); entry != m_entries.end();) {
+        entry = entry->second.expired() ? m_entries.erase(entry) : std::next(entry);
+    }
+    m_entries[key] = parsed_proto;
 }
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 const MemoryView Hef::Impl::get_hef_memview()
 {
+    if (nullptr != m_mapped_hef_reader) {
+        return m_mapped_hef_reader->get_memview();
+    }
     return MemoryView(m_hef_buffer);
 }
 #endif // HAILO_SUPPORT_MULTI_PROCESS
@@ -40,12 +40,16 @@
 #include "device_common/control_protocol.hpp"
 
 #include "common/file_utils.hpp"
+#include "os/mmap_buffer.hpp"
 
 #include "control_protocol.h"
 #include <functional>
 #include <bitset>
 #include <memory>
 #include <fstream>
+#include <array>
+#include <map>
+#include <mutex>
 
 extern "C" {
 #include "md5.h"
@@ -112,6 +116,50 @@ struct ProtoHEFCoreOpMock {
     std::vector<std::shared_ptr<ProtoHEFPartialCoreOpMock>> partial_core_ops;
 };
 
+// Reader over a HEF file mapped to memory. The context switch actions read the CCWs through it when the core-op is
+// configured (possibly after the Hef was released), so it owns the mapping.
+class MappedFileReader final : public BufferReader
+{
+public:
+    static Expected<std::shared_ptr<MappedFileReader>> create(const std::string &file_path);
+
+    MappedFileReader(MmapBuffer<uint8_t> &&mapping);
+
+private:
+    MmapBuffer<uint8_t> m_mapping;
+};
+
+// The protobuf content of a parsed HEF. It isn't modified after parsing, so Hefs with the same content share it.
+struct ParsedHefProto final
+{
+    ProtoHEFHeader header;
+    ProtoHEFIncludedFeatures included_features;
+    std::vector<ProtoHEFNetworkGroupPtr> groups;
+    std::vector<ProtoHEFExtension> extensions;
+    std::vector<ProtoHEFOptionalExtension> optional_extensions;
+};
+
+// Maps the MD5 of a HEF's protobuf message to its parsed content, for as long as some Hef holds it - so recreating a Hef
+// with the same content (e.g. on each VDevice::create_infer_model, or by each client of the service) skips parsing the
+// protobuf message. The metadata (CoreOpMetadata, ops metadata) is still built per Hef, as it's updated when configured.
+class ParsedHefProtoCache final
+{
+public:
+    using Key = std::array<uint8_t, sizeof(MD5_SUM_t)>;
+
+    static ParsedHefProtoCache &get_instance();
+
+    // Returns nullptr if there's no Hef holding the content
+    std::shared_ptr<ParsedHefProto> get(const Key &key);
+    void add(const Key &key, std::shared_ptr<ParsedHefProto> parsed_proto);
+
+private:
+    ParsedHefProtoCache() = default;
+
+    std::mutex m_mutex;
+    std::map<Key, std::weak_ptr<ParsedHefProto>> m_entries;
+};
+
 #pragma pack(push, 1)
 // TODO HRT-13921: change structure of hef header types
 
@@ -253,6 +301,13 @@ public:
     static Expected<Impl> create(const std::string &hef_path);
     static Expected<Impl> create(const MemoryView &hef_buffer);
 
+    Impl(Impl &&) = default;
+
+    // Returns a Hef sharing the parsed HEF (and the reader its CCWs are read by) with this one, so the HEF's core ops
+    // can be configured again after the user's Hef is gone (e.g. on a device added to a vdevice later on).
+    // Note: If this Hef was created from a memory buffer, the buffer must stay valid while the returned Hef is used.
+    Expected<Hef> share() const;
+
     const std::vector<ProtoHEFNetworkGroupPtr>& network_groups() const;
     const std::vector<ProtoHEFCoreOpMock>& core_ops(const std::string &net_group_name) const;
     const NetworkGroupMetadata network_group_metadata(const std::string &net_group_name) const;
@@ -398,15 +453,19 @@ public:
 private:
     Impl(const std::string &hef_path, hailo_status &status);
     Impl(const MemoryView &hef_memview, hailo_status &status);
+    // Copies everything but the HEF buffer (see share)
+    Impl(const Impl &other);
 
     hailo_status parse_hef_file(const std::string &hef_path);
     hailo_status parse_hef_memview(const MemoryView &hef_memview);
+    hailo_status parse_hef_buffer(const MemoryView &hef_memview, std::shared_ptr<SeekableBytesReader> hef_reader);
     hailo_status parse_hef_memview_internal(const size_t proto_size, const uint8_t *proto_buffer, const uint32_t hef_version,
         std::shared_ptr<SeekableBytesReader> hef_reader, size_t ccws_offset);
     Expected<hef__header_t> parse_hef_header_before_distinct(std::shared_ptr<SeekableBytesReader> hef_reader);
     hailo_status fill_v1_hef_header(hef__header_t &hef_header, std::shared_ptr<SeekableBytesReader> hef_reader);
     hailo_status fill_core_ops_and_networks_metadata(uint32_t hef_version, std::shared_ptr<SeekableBytesReader> hef_reader, size_t ccws_offset);
     hailo_status transfer_protobuf_field_ownership(ProtoHEFHef &hef_message);
+    void init_parsed_proto(std::shared_ptr<ParsedHefProto> parsed_proto);
     void fill_core_ops();
     hailo_status fill_networks_metadata(uint32_t hef_version, std::shared_ptr<SeekableBytesReader> hef_reader, size_t ccws_offset);
     void fill_extensions_bitset();
@@ -456,9 +515,13 @@ private:
     MD5_SUM_t m_md5;
     uint32_t m_crc;
     std::shared_ptr<SeekableBytesReader> m_hef_reader;
+    // Owns the protobuf messages m_groups point to (m_core_ops_per_group refers into them)
+    std::shared_ptr<ParsedHefProto> m_parsed_proto;
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
     Buffer m_hef_buffer;
+    // Set instead of m_hef_buffer when the HEF file is mapped
+    std::shared_ptr<MappedFileReader> m_mapped_hef_reader;
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
     std::map<std::string, NetworkGroupMetadata> m_network_group_metadata; // Key is NG name
@@ -136,6 +136,13 @@ hailo_status MipiInputStream::write_impl(const MemoryView &buffer)
     return HAILO_INVALID_OPERATION;
 }
 
+hailo_status MipiInputStream::write_async(TransferRequest &&transfer_request)
+{
+    (void)transfer_request;
+    LOGGER__ERROR("Mipi input stream {} is fed by the sensor, frames can't be written to it", name());
+    return HAILO_INVALID_OPERATION;
+}
+
 Expected<std::unique_ptr<MipiInputStream>> MipiInputStream::create(Device &device,
     const LayerInfo &edge_layer, const hailo_mipi_input_stream_params_t &params,
     EventPtr core_op_activated_event)
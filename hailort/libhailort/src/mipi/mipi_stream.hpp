@@ -44,13 +44,16 @@ public:
         EventPtr core_op_activated_event);
     virtual ~MipiInputStream();
 
+    // The frames go from the sensor straight to the device, so no host buffer is involved in either mode. Accepting
+    // NOT_OWNING lets a MIPI-fed core op be configured with async streams, so its outputs are read with the async API.
     virtual hailo_status set_buffer_mode(StreamBufferMode buffer_mode) override
     {
-        CHECK(buffer_mode == StreamBufferMode::OWNING, HAILO_INVALID_ARGUMENT,
-            "Mipi streams supports only sync api");
+        (void)buffer_mode;
         return HAILO_SUCCESS;
     }
 
+    virtual hailo_status write_async(TransferRequest &&transfer_request) override;
+
     virtual hailo_status activate_stream() override;
     virtual hailo_status deactivate_stream() override;
     virtual hailo_stream_interface_t get_interface() const override { return HAILO_STREAM_INTERFACE_MIPI; }
@@ -62,11 +62,10 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
         },
         {
             // NHCW x FLOAT32
-            // We don't support input_format_type to be float32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, float32_t>
         }
     },
     {
@@ -94,10 +93,10 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
         },
         {
             // NHWC x FLOAT32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, float32_t>
         }
     },
     {
@@ -125,11 +124,10 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
         },
         {
             // NC x FLOAT32
-            // We don't support input_format_type to be float32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NC_to_N<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, float32_t>
         }
     },
     {
@@ -157,11 +155,10 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
         },
         {
             // F8CR x FLOAT32
-            // We don't support input_format_type to be float32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<float32_t, float32_t>
         }
     }
 };
@@ -257,11 +254,14 @@ hailo_status ArgmaxOpMetadata::validate_format_info()
         HAILO_INVALID_OPERATION, "Argmax op is not supported for input format order ({}) and output format order ({})",
         HailoRTCommon::get_format_order_str(input_metadata.format.order),
         HailoRTCommon::get_format_order_str(output_metadata.format.order));
+    CHECK(input_metadata.shape.features <= OpKernels::ARGMAX_MAX_FEATURES, HAILO_INVALID_OPERATION,
+        "Argmax op supports up to {} features (got {})", OpKernels::ARGMAX_MAX_FEATURES, input_metadata.shape.features);
     CHECK((
-        (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) || (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16)),
-        HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be either {} or {}",
+        (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) || (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) ||
+        (input_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32)),
+        HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be either {}, {} or {}",
         HailoRTCommon::get_format_type_str(input_metadata.format.type), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8),
-        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16));
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
 
     return HAILO_SUCCESS;
 }
@@ -6,7 +6,7 @@
  * @file argmax_post_process.hpp
  * @brief: Argmax op perform argmax op as described: https://www.tensorflow.org/api_docs/python/tf/math/argmax
  * A few notes:
- *  - Support only on features axis
+ *  - Support only on features axis, and up to OpKernels::ARGMAX_MAX_FEATURES features
  *  - Support only on NHWC, NHCW and NC input data order
   *  - In case of 2 maximal values - the lower index one will be given.
  **/
@@ -18,8 +18,11 @@
 #include "hailo/hailort.h"
 #include "net_flow/ops/op.hpp"
 #include "net_flow/ops_metadata/argmax_op_metadata.hpp"
+#include "net_flow/ops/op_kernels.hpp"
+#include "transform/transpose_kernels.hpp"
 #include "common/utils.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace hailort
@@ -29,7 +32,10 @@ namespace net_flow
 
 #define ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS (4)
 #define ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES (4)
-#define F8CR_FEATURES_IN_CHUNK (8)
+#define F8CR_FEATURES_IN_CHUNK (8u)
+// The argmax is computed over tiles of pixels of a row, and in NHWC over groups of channels of the tile
+#define ARGMAX_TILE_PIXELS (128u)
+#define ARGMAX_TILE_CHANNELS (16u)
 
 typedef hailo_status (*ArgmaxFunction)(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
     const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs);
@@ -42,6 +48,35 @@ private:
         : Op(static_cast<std::shared_ptr<OpMetadata>>(metadata))
     {}
 
+    // Updates the argmax of a tile of pixels (of count pixels, each channels_count channels from first_channel at
+    // pixels + (pixel * pixel_stride)) by transposing the channels into tile. The tile's maximums are initialized by
+    // its first channel.
+    template<typename SrcType>
+    static void update_argmax_tile(const SrcType *pixels, size_t pixel_stride, uint32_t channels_count,
+        uint32_t first_channel, uint32_t count, SrcType *tile, SrcType *max_values, uint16_t *max_indices)
+    {
+        TransposeKernels::transpose(pixels, pixel_stride, tile, ARGMAX_TILE_PIXELS, count, channels_count);
+        uint32_t c = 0;
+        if (0 == first_channel) {
+            std::copy(tile, tile + count, max_values);
+            std::fill(max_indices, max_indices + count, static_cast<uint16_t>(0));
+            c = 1;
+        }
+        for (; c < channels_count; c++) {
+            OpKernels::argmax_update(tile + (c * ARGMAX_TILE_PIXELS), max_values, max_indices,
+                static_cast<uint16_t>(first_channel + c), count);
+        }
+    }
+
+    template<typename DstType>
+    static void write_argmax_tile(const uint16_t *max_indices, DstType *dst, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = static_cast<DstType>(max_indices[i]);
+        }
+    }
+
+    // Each channel of a row is contiguous, so the maximums of a tile are updated by the channels one after the other
     template<typename SrcType, typename DstType>
     static hailo_status NHCW_to_NHW_feature_axis(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
@@ -50,23 +85,21 @@ private:
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
+        SrcType max_values[ARGMAX_TILE_PIXELS];
+        uint16_t max_indices[ARGMAX_TILE_PIXELS];
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
             const SrcType *src_row = src_ptr + (r * src_row_size);
             DstType *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + w;
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
+            for (uint32_t w = 0; w < input_metadata.shape.width; w += ARGMAX_TILE_PIXELS) {
+                const auto count = std::min(ARGMAX_TILE_PIXELS, input_metadata.shape.width - w);
+                std::copy(src_row + w, src_row + w + count, max_values);
+                std::fill(max_indices, max_indices + count, static_cast<uint16_t>(0));
                 for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
-                    offset_in_row += input_metadata.padded_shape.width;
-                    const auto &current_value = *offset_in_row;
-                    if (current_value > max_value) {
-                        max_index = static_cast<DstType>(c);
-                        max_value = current_value;
-                    }
+                    OpKernels::argmax_update(src_row + (c * input_metadata.padded_shape.width) + w, max_values,
+                        max_indices, static_cast<uint16_t>(c), count);
                 }
-                dst_row[w] = max_index;
+                write_argmax_tile(max_indices, dst_row + w, count);
             }
         }
         return HAILO_SUCCESS;
@@ -80,22 +113,23 @@ private:
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
+        const auto features = input_metadata.shape.features;
+        const auto pixel_stride = input_metadata.padded_shape.features;
+        SrcType tile[ARGMAX_TILE_CHANNELS * ARGMAX_TILE_PIXELS];
+        SrcType max_values[ARGMAX_TILE_PIXELS];
+        uint16_t max_indices[ARGMAX_TILE_PIXELS];
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
             const SrcType *src_row = src_ptr + (r * src_row_size);
             DstType *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + (w * input_metadata.padded_shape.features);
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
-                for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
-                    const auto &current_value = *(offset_in_row + c);
-                    if (current_value > max_value) {
-                        max_index = static_cast<DstType>(c);
-                        max_value = current_value;
-                    }
+            for (uint32_t w = 0; w < input_metadata.shape.width; w += ARGMAX_TILE_PIXELS) {
+                const auto count = std::min(ARGMAX_TILE_PIXELS, input_metadata.shape.width - w);
+                const SrcType *pixels = src_row + (w * pixel_stride);
+                for (uint32_t c = 0; c < features; c += ARGMAX_TILE_CHANNELS) {
+                    update_argmax_tile(pixels + c, pixel_stride, std::min(ARGMAX_TILE_CHANNELS, features - c), c, count,
+                        tile, max_values, max_indices);
                 }
-                dst_row[w] = max_index;
+                write_argmax_tile(max_indices, dst_row + w, count);
             }
         }
         return HAILO_SUCCESS;
@@ -109,9 +143,9 @@ private:
         auto src_ptr = (SrcType*)inputs.begin()->second.data();
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         DstType max_index = 0;
-        SrcType max_value = 0;
+        SrcType max_value = *src_ptr;
 
-        for (uint32_t c = 0; c < input_metadata.shape.features; c++) {
+        for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
             const auto &current_value = *(src_ptr + c);
             if (current_value > max_value) {
                 max_index = static_cast<DstType>(c);
@@ -130,28 +164,24 @@ private:
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
-        const auto num_of_eight_channels_chunks = input_metadata.padded_shape.features / F8CR_FEATURES_IN_CHUNK;
+        const auto features = input_metadata.shape.features;
         const auto eight_channels_x_width_size = input_metadata.padded_shape.width * F8CR_FEATURES_IN_CHUNK;
+        SrcType tile[F8CR_FEATURES_IN_CHUNK * ARGMAX_TILE_PIXELS];
+        SrcType max_values[ARGMAX_TILE_PIXELS];
+        uint16_t max_indices[ARGMAX_TILE_PIXELS];
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
             const SrcType *src_row = src_ptr + (r * src_row_size);
             DstType *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + (w * F8CR_FEATURES_IN_CHUNK);
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
-                for (uint32_t channel_chunk_id = 0; channel_chunk_id < num_of_eight_channels_chunks; channel_chunk_id++) {
-                    const SrcType *offset_in_column = offset_in_row + (eight_channels_x_width_size * channel_chunk_id);
-                    uint32_t num_of_channels_in_chunk = ((channel_chunk_id + 1 == num_of_eight_channels_chunks) ? (input_metadata.shape.features % F8CR_FEATURES_IN_CHUNK) : F8CR_FEATURES_IN_CHUNK );
-                    for (uint32_t c = 0; c < num_of_channels_in_chunk; c++) {
-                        const auto &current_value = *(offset_in_column + c);
-                        if (current_value > max_value) {
-                            max_index = static_cast<DstType>(c + F8CR_FEATURES_IN_CHUNK * channel_chunk_id);
-                            max_value = current_value;
-                        }
-                    }
+            for (uint32_t w = 0; w < input_metadata.shape.width; w += ARGMAX_TILE_PIXELS) {
+                const auto count = std::min(ARGMAX_TILE_PIXELS, input_metadata.shape.width - w);
+                for (uint32_t c = 0; c < features; c += F8CR_FEATURES_IN_CHUNK) {
+                    const SrcType *pixels = src_row + ((c / F8CR_FEATURES_IN_CHUNK) * eight_channels_x_width_size) +
+                        (w * F8CR_FEATURES_IN_CHUNK);
+                    update_argmax_tile(pixels, F8CR_FEATURES_IN_CHUNK, std::min(F8CR_FEATURES_IN_CHUNK, features - c), c,
+                        count, tile, max_values, max_indices);
                 }
-                dst_row[w] = max_index;
+                write_argmax_tile(max_indices, dst_row + w, count);
             }
         }
         return HAILO_SUCCESS;
@@ -167,7 +197,7 @@ public:
 
     // A 3D array of argmax functions to call:
     // 1st dim represent the data format order
-    // 2nd dim represent the input data type (only uint8 or uint16 are valid)
+    // 2nd dim represent the input data type (uint8, uint16 or float32)
     // 3rd dim represent the output data type
     // Note: Assumption here the ordering of the enum hailo_format_type_t doesn't change
     static ArgmaxFunction m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES];
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file custom_post_process.cpp
+ * @brief: Runs a custom post-process op, implemented by the user (see CustomPostProcessOp), as a net-flow op
+ **/
+
+#include "custom_post_process.hpp"
+#include "hailo/hailort.h"
+#include "hailo/hailort_common.hpp"
+
+#include "common/utils.hpp"
+
+namespace hailort
+{
+namespace net_flow
+{
+
+Expected<std::shared_ptr<OpMetadata>> CustomOpMetadata::create(const std::unordered_map<std::string, BufferMetaData> &inputs_metadata,
+    const std::unordered_map<std::string, BufferMetaData> &outputs_metadata, const std::string &network_name,
+    std::shared_ptr<CustomPostProcessOp> custom_op)
+{
+    CHECK_AS_EXPECTED(nullptr != custom_op, HAILO_INVALID_ARGUMENT, "Custom post-process op must not be null");
+    CHECK_AS_EXPECTED(outputs_metadata.size() == CUSTOM_NUMBER_OF_DSTS, HAILO_INVALID_ARGUMENT,
+        "Custom post-process op must have a single output");
+
+    const auto name = fmt::format("Custom-Post-Process-{}", outputs_metadata.begin()->first);
+    auto op_metadata = std::shared_ptr<CustomOpMetadata>(new (std::nothrow) CustomOpMetadata(inputs_metadata, outputs_metadata,
+        name, network_name, custom_op));
+    CHECK_AS_EXPECTED(op_metadata != nullptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    auto status = op_metadata->validate_params();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    return std::shared_ptr<OpMetadata>(std::move(op_metadata));
+}
+
+std::string CustomOpMetadata::get_op_description()
+{
+    auto config_info = fmt::format("{} Op, Name: {}, Inputs: {}", OpMetadata::get_operation_type_str(m_type), m_name,
+        m_inputs_metadata.size());
+    return config_info;
+}
+
+hailo_status CustomOpMetadata::validate_params()
+{
+    CHECK(!m_inputs_metadata.empty(), HAILO_INVALID_ARGUMENT, "Custom post-process op {} must have inputs", m_name);
+    assert(m_outputs_metadata.size() == CUSTOM_NUMBER_OF_DSTS);
+
+    CHECK_SUCCESS(validate_format_info());
+
+    const auto &output_metadata = m_outputs_metadata.begin()->second;
+    CHECK((0 != output_metadata.shape.height) && (0 != output_metadata.shape.width) && (0 != output_metadata.shape.features),
+        HAILO_INVALID_ARGUMENT, "The output shape of custom post-process op {} must not be empty", m_name);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status CustomOpMetadata::validate_format_info()
+{
+    for (const auto &input_metadata : m_inputs_metadata) {
+        CHECK((HAILO_FORMAT_TYPE_AUTO != input_metadata.second.format.type) &&
+            (HAILO_FORMAT_ORDER_AUTO != input_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+            "The format of input {} of custom post-process op {} must not be auto", input_metadata.first, m_name);
+    }
+
+    // The output frame size is taken from its shape, so NMS outputs (whose frame size depends on the NMS shape) aren't
+    // supported
+    const auto &output_format = m_outputs_metadata.begin()->second.format;
+    CHECK((HAILO_FORMAT_TYPE_AUTO != output_format.type) && (HAILO_FORMAT_ORDER_AUTO != output_format.order),
+        HAILO_INVALID_ARGUMENT, "The output format of custom post-process op {} must not be auto", m_name);
+    CHECK(!HailoRTCommon::is_nms(output_format.order), HAILO_INVALID_ARGUMENT,
+        "The output format order {} of custom post-process op {} is not supported",
+        HailoRTCommon::get_format_order_str(output_format.order), m_name);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<hailo_vstream_info_t> CustomOpMetadata::get_output_vstream_info()
+{
+    CHECK_AS_EXPECTED((m_outputs_metadata.size() == 1), HAILO_INVALID_OPERATION, "{} has more than 1 output", m_name);
+    const auto &output_name = m_outputs_metadata.begin()->first;
+    const auto &output_metadata = m_outputs_metadata.begin()->second;
+    CHECK_AS_EXPECTED(output_name.length() < HAILO_MAX_STREAM_NAME_SIZE, HAILO_INVALID_ARGUMENT,
+        "The output name {} of {} is too long", output_name, m_name);
+
+    hailo_vstream_info_t vstream_info{};
+    strncpy(vstream_info.name, output_name.c_str(), output_name.length() + 1);
+    strncpy(vstream_info.network_name, m_network_name.c_str(), m_network_name.length() + 1);
+    vstream_info.direction = HAILO_D2H_STREAM;
+    vstream_info.format = output_metadata.format;
+    vstream_info.shape = output_metadata.shape;
+    vstream_info.quant_info = output_metadata.quant_info;
+
+    return vstream_info;
+}
+
+Expected<std::shared_ptr<Op>> CustomPostProcessOpAdapter::create(std::shared_ptr<CustomOpMetadata> metadata)
+{
+    auto status = metadata->validate_format_info();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    const auto &output_metadata = metadata->outputs_metadata().begin()->second;
+    const auto output_frame_size = HailoRTCommon::get_frame_size(output_metadata.shape, output_metadata.format);
+
+    auto op = std::shared_ptr<CustomPostProcessOpAdapter>(new (std::nothrow) CustomPostProcessOpAdapter(metadata, output_frame_size));
+    CHECK_AS_EXPECTED(op != nullptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    return std::shared_ptr<Op>(std::move(op));
+}
+
+hailo_status CustomPostProcessOpAdapter::execute(const std::map<std::string, MemoryView> &inputs,
+    std::map<std::string, MemoryView> &outputs)
+{
+    CHECK(1 == outputs.size(), HAILO_INTERNAL_FAILURE);
+    auto output = outputs.begin()->second;
+    CHECK(output.size() >= m_output_frame_size, HAILO_INVALID_ARGUMENT,
+        "The output buffer of {} is too small ({} bytes, expected {})", get_name(), output.size(), m_output_frame_size);
+
+    // The output buffers of the pipeline may be larger than a frame, but the op gets exactly a frame
+    return m_custom_op->execute(inputs, MemoryView(output.data(), m_output_frame_size));
+}
+
+} /* namespace net_flow */
+} /* namespace hailort */
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file custom_post_process.hpp
+ * @brief: Runs a custom post-process op, implemented by the user (see CustomPostProcessOp), as a net-flow op
+ **/
+
+#ifndef _HAILO_CUSTOM_POST_PROCESS_HPP_
+#define _HAILO_CUSTOM_POST_PROCESS_HPP_
+
+#include "hailo/hailort.h"
+#include "net_flow/ops/op.hpp"
+#include "net_flow/ops_metadata/custom_op_metadata.hpp"
+
+namespace hailort
+{
+namespace net_flow
+{
+
+class CustomPostProcessOpAdapter : public Op
+{
+public:
+    static Expected<std::shared_ptr<Op>> create(std::shared_ptr<CustomOpMetadata> metadata);
+
+    hailo_status execute(const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs) override;
+
+private:
+    CustomPostProcessOpAdapter(std::shared_ptr<CustomOpMetadata> metadata, size_t output_frame_size)
+        : Op(static_cast<std::shared_ptr<OpMetadata>>(metadata)),
+          m_custom_op(metadata->custom_op()),
+          m_output_frame_size(output_frame_size)
+    {}
+
+    std::shared_ptr<CustomPostProcessOp> m_custom_op;
+    size_t m_output_frame_size;
+};
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_CUSTOM_POST_PROCESS_HPP_ */
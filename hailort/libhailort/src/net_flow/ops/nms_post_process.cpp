@@ -10,6 +10,9 @@
  **/
 
 #include "net_flow/ops/nms_post_process.hpp"
+#include "transform/transform_thread_pool.hpp"
+
+#include <numeric>
 
 namespace hailort
 {
@@ -38,8 +41,10 @@ std::string NmsOpMetadata::get_op_description()
 hailo_status NmsOpMetadata::validate_format_info()
 {
     for (const auto& output_metadata : m_outputs_metadata) {
-        CHECK(HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT, "The given output format order {} is not supported, "
-            "should be HAILO_FORMAT_ORDER_HAILO_NMS", HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+        CHECK((HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == output_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+            "The given output format order {} is not supported, should be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE",
+            HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
 
         CHECK(HAILO_FORMAT_TYPE_FLOAT32 == output_metadata.second.format.type, HAILO_INVALID_ARGUMENT, "The given output format type {} is not supported, "
             "should be HAILO_FORMAT_TYPE_FLOAT32", HailoRTCommon::get_format_type_str(output_metadata.second.format.type));
@@ -85,6 +90,15 @@ std::string NmsOpMetadata::get_nms_config_description()
     if (m_nms_config.background_removal) {
         config_info += fmt::format(", Background removal index: {}", m_nms_config.background_removal_index);
     }
+    if (0 != m_nms_config.max_proposals_total) {
+        config_info += fmt::format(", Max bboxes total: {}", m_nms_config.max_proposals_total);
+    }
+    if (!m_nms_config.classes_filter.empty()) {
+        config_info += ", Classes filter:";
+        for (const auto class_index : m_nms_config.classes_filter) {
+            config_info += fmt::format(" {}", class_index);
+        }
+    }
     return config_info;
 }
 
@@ -103,40 +117,137 @@ float NmsPostProcessOp::compute_iou(const hailo_bbox_float32_t &box_1, const hai
     return (intersection / union_area);
 }
 
+// The boxes of all the classes in a struct-of-arrays layout, bucketed by class (and sorted by score in each class), so an
+// IoU of a box with all the boxes following it in its class is computed in a loop the compiler can vectorize.
+struct ClassesBoxes final
+{
+    explicit ClassesBoxes(size_t boxes_count) :
+        detections_indices(boxes_count), x_min(boxes_count), y_min(boxes_count), x_max(boxes_count),
+        y_max(boxes_count), area(boxes_count), is_removed(boxes_count, 0)
+    {}
+
+    std::vector<size_t> detections_indices;
+    std::vector<float32_t> x_min;
+    std::vector<float32_t> y_min;
+    std::vector<float32_t> x_max;
+    std::vector<float32_t> y_max;
+    std::vector<float32_t> area;
+    std::vector<uint8_t> is_removed;
+};
+
+// Marks the boxes in [box_index + 1, class_end) that overlap the box at box_index as removed. Computes the same as
+// compute_iou(), without branches.
+static void remove_boxes_overlapping_box(ClassesBoxes &boxes, size_t box_index, size_t class_end, double iou_th)
+{
+    const auto box_x_min = boxes.x_min[box_index];
+    const auto box_y_min = boxes.y_min[box_index];
+    const auto box_x_max = boxes.x_max[box_index];
+    const auto box_y_max = boxes.y_max[box_index];
+    const auto box_area = boxes.area[box_index];
+    const auto *x_min = boxes.x_min.data();
+    const auto *y_min = boxes.y_min.data();
+    const auto *x_max = boxes.x_max.data();
+    const auto *y_max = boxes.y_max.data();
+    const auto *area = boxes.area.data();
+    auto *is_removed = boxes.is_removed.data();
+
+    for (size_t i = box_index + 1; i < class_end; i++) {
+        const float overlap_area_width = std::min(box_x_max, x_max[i]) - std::max(box_x_min, x_min[i]);
+        const float overlap_area_height = std::min(box_y_max, y_max[i]) - std::max(box_y_min, y_min[i]);
+        const float intersection = overlap_area_width * overlap_area_height;
+        const float union_area = (box_area + area[i] - intersection);
+        const bool is_overlapping = (overlap_area_width > 0.0f) & (overlap_area_height > 0.0f) &
+            ((intersection / union_area) >= iou_th);
+        is_removed[i] = static_cast<uint8_t>(is_removed[i] | static_cast<uint8_t>(is_overlapping));
+    }
+}
+
 void NmsPostProcessOp::remove_overlapping_boxes(std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count,
-    double iou_th)
+    double iou_th, uint32_t max_detections_per_class)
 {
     std::sort(detections.begin(), detections.end(),
-            [](DetectionBbox a, DetectionBbox b)
+            [](const DetectionBbox &a, const DetectionBbox &b)
             { return a.m_bbox.score > b.m_bbox.score; });
 
+    // Bucket the detections by class (a box is compared only to the boxes of its own class). The detections that were
+    // already removed are skipped.
+    const auto classes_count = classes_detections_count.size();
+    std::vector<size_t> classes_offsets(classes_count + 1, 0);
+    for (const auto &detection : detections) {
+        if (detection.m_bbox.score != REMOVED_CLASS_SCORE) {
+            assert(detection.m_class_id < classes_count);
+            classes_offsets[detection.m_class_id + 1]++;
+        }
+    }
+    std::partial_sum(classes_offsets.begin(), classes_offsets.end(), classes_offsets.begin());
+
+    ClassesBoxes boxes(classes_offsets.back());
+    std::vector<size_t> next_box_indices(classes_offsets.begin(), classes_offsets.end() - 1);
     for (size_t i = 0; i < detections.size(); i++) {
-        if (detections[i].m_bbox.score == REMOVED_CLASS_SCORE) {
-            // Detection overlapped with a higher score detection
+        const auto &detection = detections[i];
+        if (detection.m_bbox.score == REMOVED_CLASS_SCORE) {
             continue;
         }
+        const auto box_index = next_box_indices[detection.m_class_id]++;
+        const auto &bbox = detection.m_bbox;
+        boxes.detections_indices[box_index] = i;
+        boxes.x_min[box_index] = bbox.x_min;
+        boxes.y_min[box_index] = bbox.y_min;
+        boxes.x_max[box_index] = bbox.x_max;
+        boxes.y_max[box_index] = bbox.y_max;
+        boxes.area[box_index] = (bbox.y_max - bbox.y_min) * (bbox.x_max - bbox.x_min);
+    }
+
+    for (size_t class_index = 0; class_index < classes_count; class_index++) {
+        const auto class_begin = classes_offsets[class_index];
+        const auto class_end = classes_offsets[class_index + 1];
 
-        for (size_t j = i + 1; j < detections.size(); j++) {
-            if (detections[j].m_bbox.score == REMOVED_CLASS_SCORE) {
+        uint32_t kept_boxes_count = 0;
+        for (size_t i = class_begin; i < class_end; i++) {
+            if (boxes.is_removed[i]) {
                 // Detection overlapped with a higher score detection
                 continue;
             }
 
-            if (detections[i].m_class_id == detections[j].m_class_id
-                    && (compute_iou(detections[i].m_bbox, detections[j].m_bbox) >= iou_th)) {
-                // Remove detections[j] if the iou is higher then the threshold
-                detections[j].m_bbox.score = REMOVED_CLASS_SCORE;
-                assert(detections[i].m_class_id < classes_detections_count.size());
-                assert(classes_detections_count[detections[j].m_class_id] > 0);
-                classes_detections_count[detections[j].m_class_id]--;
+            kept_boxes_count++;
+            if (max_detections_per_class == kept_boxes_count) {
+                // The class' remaining detections have lower scores, so they will be ignored anyway
+                break;
             }
+            remove_boxes_overlapping_box(boxes, i, class_end, iou_th);
+        }
+
+        for (size_t i = class_begin; i < class_end; i++) {
+            if (boxes.is_removed[i]) {
+                detections[boxes.detections_indices[i]].m_bbox.score = REMOVED_CLASS_SCORE;
+                assert(classes_detections_count[class_index] > 0);
+                classes_detections_count[class_index]--;
+            }
+        }
+    }
+}
+
+// Zeroes the detections count of the classes that aren't in nms_config.classes_filter, so their detections are skipped
+static void apply_classes_filter(std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+{
+    if (nms_config.classes_filter.empty()) {
+        return;
+    }
+
+    std::vector<uint32_t> filtered_classes_detections_count(classes_detections_count.size(), 0);
+    for (const auto class_index : nms_config.classes_filter) {
+        if (class_index < classes_detections_count.size()) {
+            filtered_classes_detections_count[class_index] = classes_detections_count[class_index];
         }
     }
+    classes_detections_count = std::move(filtered_classes_detections_count);
 }
 
 void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
     std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
 {
+    apply_classes_filter(classes_detections_count, nms_config);
+
     // Calculate the number of detections before each class, to help us later calculate the buffer_offset for it's detections.
     std::vector<uint32_t> num_of_detections_before(nms_config.number_of_classes, 0);
     uint32_t ignored_detections_count = 0;
@@ -185,10 +296,114 @@ void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vec
     }
 }
 
+void NmsPostProcessOp::fill_nms_by_score_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+{
+    apply_classes_filter(classes_detections_count, nms_config);
+    for (auto &class_detections_count : classes_detections_count) {
+        class_detections_count = std::min(class_detections_count, nms_config.max_proposals_per_class);
+    }
+
+    hailo_nms_shape_t nms_shape{};
+    nms_shape.number_of_classes = nms_config.number_of_classes;
+    nms_shape.max_bboxes_per_class = nms_config.max_proposals_per_class;
+    nms_shape.max_bboxes_total = nms_config.max_proposals_total;
+    const auto max_detections = std::min(HailoRTCommon::get_nms_by_score_max_detections(nms_shape),
+        static_cast<uint32_t>(UINT16_MAX));
+    assert((sizeof(uint16_t) + (max_detections * sizeof(hailo_detection_t))) <= buffer.size());
+
+    // The detections vector is sorted by score, so the first detections kept are the top detections of all of the classes
+    auto dst = buffer.data() + sizeof(uint16_t);
+    uint16_t detections_count = 0;
+    for (const auto &detection : detections) {
+        if (detections_count == max_detections) {
+            break;
+        }
+        if ((REMOVED_CLASS_SCORE == detection.m_bbox.score) || (0 == classes_detections_count[detection.m_class_id])) {
+            // Detection overlapped with a higher score detection, its class is filtered out, or the class already has
+            // max_proposals_per_class detections
+            continue;
+        }
+
+        hailo_detection_t nms_detection{};
+        nms_detection.box.y_min = detection.m_bbox.y_min;
+        nms_detection.box.x_min = detection.m_bbox.x_min;
+        nms_detection.box.y_max = detection.m_bbox.y_max;
+        nms_detection.box.x_max = detection.m_bbox.x_max;
+        nms_detection.score = detection.m_bbox.score;
+        nms_detection.class_id = static_cast<uint16_t>(detection.m_class_id);
+        memcpy(dst, &nms_detection, sizeof(nms_detection));
+        dst += sizeof(nms_detection);
+        detections_count++;
+        classes_detections_count[detection.m_class_id]--;
+    }
+    memcpy(buffer.data(), &detections_count, sizeof(detections_count));
+}
+
+void NmsPostProcessOp::fill_nms_output_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+    hailo_format_order_t format_order)
+{
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == format_order) {
+        fill_nms_by_score_format_buffer(buffer, detections, classes_detections_count, nms_config);
+    } else {
+        fill_nms_format_buffer(buffer, detections, classes_detections_count, nms_config);
+    }
+}
+
+uint32_t NmsPostProcessOp::get_max_threads_count()
+{
+    auto max_threads_count_env_var = get_env_variable(POST_PROCESS_MAX_THREADS_ENV_VAR);
+    if (!max_threads_count_env_var) {
+        return 1;
+    }
+    return std::max(static_cast<uint32_t>(std::stoul(max_threads_count_env_var.value())), static_cast<uint32_t>(1));
+}
+
+hailo_status NmsPostProcessOp::extract_branches_detections(size_t branches_count,
+    const ExtractBranchDetectionsFunc &extract_branch_detections)
+{
+    if ((1 == m_max_threads_count) || (branches_count <= 1)) {
+        for (size_t branch_index = 0; branch_index < branches_count; branch_index++) {
+            auto status = extract_branch_detections(branch_index, m_detections, m_classes_detections_count);
+            CHECK_SUCCESS(status);
+        }
+        return HAILO_SUCCESS;
+    }
+
+    m_branches_detections.resize(branches_count);
+    m_branches_classes_detections_count.resize(branches_count);
+    for (size_t branch_index = 0; branch_index < branches_count; branch_index++) {
+        m_branches_detections[branch_index].clear();
+        m_branches_classes_detections_count[branch_index].assign(m_classes_detections_count.size(), 0);
+    }
+
+    auto status = TransformThreadPool::get_instance().run(branches_count, m_max_threads_count,
+        [this, &extract_branch_detections](size_t branch_index) {
+            return extract_branch_detections(branch_index, m_branches_detections[branch_index],
+                m_branches_classes_detections_count[branch_index]);
+        });
+    CHECK_SUCCESS(status);
+
+    for (size_t branch_index = 0; branch_index < branches_count; branch_index++) {
+        auto &branch_detections = m_branches_detections[branch_index];
+        m_detections.insert(m_detections.end(), std::make_move_iterator(branch_detections.begin()),
+            std::make_move_iterator(branch_detections.end()));
+        const auto &branch_classes_detections_count = m_branches_classes_detections_count[branch_index];
+        for (size_t class_index = 0; class_index < m_classes_detections_count.size(); class_index++) {
+            m_classes_detections_count[class_index] += branch_classes_detections_count[class_index];
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status NmsPostProcessOp::hailo_nms_format(MemoryView dst_view)
 {
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_nms_metadata->nms_config().nms_iou_th);
-    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_nms_metadata->nms_config().nms_iou_th,
+        m_nms_metadata->nms_config().max_proposals_per_class);
+    fill_nms_output_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config(),
+        m_nms_metadata->outputs_metadata().begin()->second.format.order);
     return HAILO_SUCCESS;
 }
 
@@ -227,6 +442,7 @@ Expected<hailo_vstream_info_t> NmsOpMetadata::get_output_vstream_info()
 
     vstream_info.nms_shape.max_bboxes_per_class = nms_config().max_proposals_per_class;
     vstream_info.nms_shape.number_of_classes = nms_config().number_of_classes;
+    vstream_info.nms_shape.max_bboxes_total = nms_config().max_proposals_total;
     if (nms_config().background_removal) {
         vstream_info.nms_shape.number_of_classes--;
     }
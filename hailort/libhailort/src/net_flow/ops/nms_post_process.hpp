@@ -24,6 +24,9 @@
 #include "net_flow/ops/op.hpp"
 #include "net_flow/ops_metadata/nms_op_metadata.hpp"
 
+#include <array>
+#include <functional>
+
 
 namespace hailort
 {
@@ -35,6 +38,9 @@ namespace net_flow
 #define INVALID_NMS_SCORE (std::numeric_limits<float32_t>::max())
 #define INVALID_NMS_CONFIG (-1)
 
+// The amount of threads (including the calling thread) the detections of an op's branches may be extracted on
+#define POST_PROCESS_MAX_THREADS_ENV_VAR ("HAILO_POST_PROCESS_MAX_THREADS")
+
 inline bool operator==(const hailo_bbox_float32_t &first, const hailo_bbox_float32_t &second) {
     return first.y_min == second.y_min && first.x_min == second.x_min && first.y_max == second.y_max && first.x_max == second.x_max && first.score == second.score;
 }
@@ -126,11 +132,15 @@ public:
     /**
      * Removes overlapping boxes in @a detections by setting the class confidence to zero.
      *
-     * @param[in] detections            A vector of @a DetectionBbox containing the detections boxes after ::extract_detections() function.
+     * @param[in] detections                A vector of @a DetectionBbox containing the detections boxes after ::extract_detections() function.
+     * @param[in] max_detections_per_class  Once that many boxes of a class survive, the class' remaining boxes aren't
+     *                                      checked, as only the top @a max_detections_per_class boxes of each class
+     *                                      are outputted anyway (the skipped boxes are not removed).
      *
     */
     static void remove_overlapping_boxes(std::vector<DetectionBbox> &detections,
-        std::vector<uint32_t> &classes_detections_count, double nms_iou_th);
+        std::vector<uint32_t> &classes_detections_count, double nms_iou_th,
+        uint32_t max_detections_per_class = std::numeric_limits<uint32_t>::max());
 
     template<typename DstType = float32_t, typename SrcType>
     DstType dequantize_and_sigmoid(SrcType number, hailo_quant_info_t quant_info)
@@ -196,11 +206,29 @@ public:
     static void fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
         std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
 
+    /*
+    * Fills the detections of all of the classes (up to nms_config.max_proposals_total), sorted by score. The layout is
+    *       \code
+    *       struct (packed) {
+    *           uint16_t detections_count;
+    *           hailo_detection_t detections[detections_count];
+    *       };
+    *       \endcode
+    */
+    static void fill_nms_by_score_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
+
+    // Fills the buffer by the fill function of the given output format order
+    static void fill_nms_output_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+        hailo_format_order_t format_order);
+
 protected:
     NmsPostProcessOp(std::shared_ptr<NmsOpMetadata> metadata)
         : Op(static_cast<PostProcessOpMetadataPtr>(metadata))
         , m_classes_detections_count(metadata->nms_config().number_of_classes, 0)
         , m_nms_metadata(metadata)
+        , m_max_threads_count(get_max_threads_count())
     {
         m_detections.reserve(metadata->nms_config().max_proposals_per_class * metadata->nms_config().number_of_classes);
     }
@@ -213,9 +241,11 @@ protected:
         m_classes_detections_count.assign(m_nms_metadata->nms_config().number_of_classes, 0);
     }
 
-    template<typename DstType = float32_t, typename SrcType>
+    // decode_score is called with each class' quantized score, and returns its de-quantized (and sigmoid-ed if needed)
+    // value - e.g. a QuantizedValueDecoder.
+    template<typename DstType = float32_t, typename SrcType, typename ScoreDecoder>
     std::pair<uint32_t, float32_t> get_max_class(const SrcType *data, uint32_t entry_idx, uint32_t classes_start_index,
-        float32_t objectness, hailo_quant_info_t quant_info, uint32_t width)
+        float32_t objectness, const ScoreDecoder &decode_score, uint32_t width)
     {
         auto const &nms_config = m_nms_metadata->nms_config();
         std::pair<uint32_t, float32_t> max_id_score_pair;
@@ -235,7 +265,7 @@ protected:
             }
 
             auto class_entry_idx = entry_idx + ((classes_start_index + class_index) * width);
-            auto class_confidence = dequantize_and_sigmoid<DstType, SrcType>(data[class_entry_idx], quant_info);
+            DstType class_confidence = decode_score(data[class_entry_idx]);
             auto class_score = class_confidence * objectness;
             if (class_score > max_id_score_pair.second) {
                 max_id_score_pair.first = class_id;
@@ -245,13 +275,113 @@ protected:
         return max_id_score_pair;
     }
 
+    /**
+     * Fills @a max_scores[i] with the maximum quantized class score of the i'th entry of a row, for classes data in NHCW
+     * order (@a classes_data points to the first class of the row's first entry).
+     * The classes are scanned one at a time over contiguous memory, so the compiler vectorizes the scan. Together with
+     * QuantizedValueDecoder::is_monotonic() it allows skipping the entries with no class passing the score threshold
+     * while de-quantizing a single value per entry.
+     */
+    template<typename SrcType>
+    static void get_max_quantized_scores(const SrcType *classes_data, uint32_t classes_count, uint32_t entries_count,
+        uint32_t padded_width, SrcType *max_scores)
+    {
+        std::fill(max_scores, max_scores + entries_count, std::numeric_limits<SrcType>::lowest());
+        for (uint32_t class_index = 0; class_index < classes_count; class_index++) {
+            const SrcType *class_data = classes_data + (class_index * padded_width);
+            for (uint32_t i = 0; i < entries_count; i++) {
+                max_scores[i] = std::max(max_scores[i], class_data[i]);
+            }
+        }
+    }
+
     hailo_status hailo_nms_format(MemoryView dst_view);
 
+    using ExtractBranchDetectionsFunc = std::function<hailo_status(size_t branch_index,
+        std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count)>;
+
+    /**
+     * Extracts the detections of all the op's branches (e.g. the outputs of each stride) into @a m_detections and
+     * @a m_classes_detections_count, by calling @a extract_branch_detections for each branch.
+     * If POST_PROCESS_MAX_THREADS_ENV_VAR allows it, the branches are extracted in parallel into separate vectors, which
+     * are then merged in the branches order - so the result is the same as extracting the branches one after the other.
+     */
+    hailo_status extract_branches_detections(size_t branches_count, const ExtractBranchDetectionsFunc &extract_branch_detections);
+
     std::vector<DetectionBbox> m_detections;
     std::vector<uint32_t> m_classes_detections_count;
 private:
+    static uint32_t get_max_threads_count();
+
     std::shared_ptr<NmsOpMetadata> m_nms_metadata;
+    const uint32_t m_max_threads_count;
+    // Used for extracting the branches in parallel (kept between frames to save the allocations)
+    std::vector<std::vector<DetectionBbox>> m_branches_detections;
+    std::vector<std::vector<uint32_t>> m_branches_classes_detections_count;
+
+};
+
+/**
+ * De-quantizes the values of a single layer, and applies sigmoid on the results if needed.
+ */
+template<typename DstType, typename SrcType>
+class QuantizedValueDecoder final
+{
+public:
+    QuantizedValueDecoder(const hailo_quant_info_t &quant_info, bool should_sigmoid) :
+        m_quant_info(quant_info),
+        m_should_sigmoid(should_sigmoid)
+    {}
+
+    DstType operator()(SrcType number) const
+    {
+        auto dequantized_val = Quantization::dequantize_output<DstType, SrcType>(number, m_quant_info);
+        return m_should_sigmoid ? NmsPostProcessOp::sigmoid(dequantized_val) : dequantized_val;
+    }
+
+    // Whether a larger quantized value never decodes to a smaller value, meaning the maximal decoded value of a few values
+    // is the decoded value of the maximal quantized value. The rounding of std::exp isn't guaranteed to be monotonic, so
+    // decoding with sigmoid isn't considered monotonic.
+    bool is_monotonic() const
+    {
+        return (m_quant_info.qp_scale > 0) && !m_should_sigmoid;
+    }
+
+private:
+    const hailo_quant_info_t m_quant_info;
+    const bool m_should_sigmoid;
+};
+
+/**
+ * An uint8 value has only 256 possible values, so the decoded values of all of them are computed once (when creating the
+ * decoder), and decoding a value is a single table lookup.
+ */
+template<typename DstType>
+class QuantizedValueDecoder<DstType, uint8_t> final
+{
+public:
+    QuantizedValueDecoder(const hailo_quant_info_t &quant_info, bool should_sigmoid)
+    {
+        Quantization::create_dequantization_lut<DstType>(quant_info, m_lut.data());
+        if (should_sigmoid) {
+            for (auto &value : m_lut) {
+                value = NmsPostProcessOp::sigmoid(value);
+            }
+        }
+    }
 
+    DstType operator()(uint8_t number) const
+    {
+        return m_lut[number];
+    }
+
+    bool is_monotonic() const
+    {
+        return std::is_sorted(m_lut.begin(), m_lut.end());
+    }
+
+private:
+    std::array<DstType, Quantization::DEQUANTIZATION_LUT_SIZE> m_lut;
 };
 
 }
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file op_kernels.hpp
+ * @brief Vectorized kernels of the argmax and softmax ops (using SSE2 on x86_64 and NEON on aarch64).
+ *
+ * The argmax is computed over tiles of pixels: the values of each channel are contiguous in the tile (either by the
+ * input's order, or after transposing the tile), so the running maximum of all of the tile's pixels is updated by each
+ * channel at once.
+ **/
+
+#ifndef _HAILO_OP_KERNELS_HPP_
+#define _HAILO_OP_KERNELS_HPP_
+
+#include "hailo/hailort.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define HAILO_OP_SSE2_KERNELS
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define HAILO_OP_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+
+namespace hailort
+{
+namespace net_flow
+{
+
+class OpKernels final
+{
+public:
+    // The argmax indices are tracked as uint16
+    static const uint32_t ARGMAX_MAX_FEATURES = (UINT16_MAX + 1);
+
+    // For each i < count, if values[i] > max_values[i], sets max_values[i] to values[i] and max_indices[i] to index.
+    template<typename T>
+    static void argmax_update(const T *values, T *max_values, uint16_t *max_indices, uint16_t index, uint32_t count)
+    {
+        argmax_update_scalar(values, max_values, max_indices, index, 0, count);
+    }
+
+    // dst[i] = exp(src[i]), for non positive src elements (the elements are clamped to EXP_MIN_INPUT). src and dst may
+    // be the same buffer.
+    static void exp_non_positive(const float32_t *src, float32_t *dst, uint32_t count)
+    {
+        uint32_t i = 0;
+#if defined(HAILO_OP_SSE2_KERNELS)
+        for (; (i + 4) <= count; i += 4) {
+            _mm_storeu_ps(dst + i, exp_non_positive_sse2(_mm_loadu_ps(src + i)));
+        }
+#elif defined(HAILO_OP_NEON_KERNELS)
+        for (; (i + 4) <= count; i += 4) {
+            vst1q_f32(dst + i, exp_non_positive_neon(vld1q_f32(src + i)));
+        }
+#endif
+        for (; i < count; i++) {
+            dst[i] = exp_non_positive_scalar(src[i]);
+        }
+    }
+
+private:
+    OpKernels() = default;
+
+    // exp(x) = 2^n * 2^f, where n = round(x * log2(e)) and |f| <= 0.5. 2^f is approximated by its Taylor polynomial,
+    // and 2^n is built directly in the exponent bits. The relative error is below 1e-5 (mostly of rounding x * log2(e)).
+    // The inputs are clamped so 2^n is a normal float.
+    static constexpr float32_t EXP_MIN_INPUT = -87.0f;
+    static constexpr float32_t LOG2_E = 1.44269504f;
+    static constexpr float32_t EXP2_C1 = 0.693147181f;
+    static constexpr float32_t EXP2_C2 = 0.240226507f;
+    static constexpr float32_t EXP2_C3 = 0.0555041087f;
+    static constexpr float32_t EXP2_C4 = 0.00961812911f;
+    static constexpr float32_t EXP2_C5 = 0.00133335581f;
+    static constexpr float32_t EXP2_C6 = 0.000154035304f;
+
+    template<typename T>
+    static void argmax_update_scalar(const T *values, T *max_values, uint16_t *max_indices, uint16_t index,
+        uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; i++) {
+            if (values[i] > max_values[i]) {
+                max_values[i] = values[i];
+                max_indices[i] = index;
+            }
+        }
+    }
+
+    static float32_t exp_non_positive_scalar(float32_t x)
+    {
+        const auto t = std::max(x, static_cast<float32_t>(EXP_MIN_INPUT)) * LOG2_E;
+        const auto n = static_cast<int>(std::lrint(t));
+        const auto f = t - static_cast<float32_t>(n);
+        const auto p = 1.0f + (f * (EXP2_C1 + (f * (EXP2_C2 + (f * (EXP2_C3 + (f * (EXP2_C4 + (f * (EXP2_C5 +
+            (f * EXP2_C6)))))))))));
+        return std::ldexp(p, n);
+    }
+
+#if defined(HAILO_OP_SSE2_KERNELS)
+    static __m128 exp_non_positive_sse2(__m128 x)
+    {
+        const auto t = _mm_mul_ps(_mm_max_ps(x, _mm_set1_ps(EXP_MIN_INPUT)), _mm_set1_ps(LOG2_E));
+        const auto n = _mm_cvtps_epi32(t); // Rounds to nearest
+        const auto f = _mm_sub_ps(t, _mm_cvtepi32_ps(n));
+        auto p = _mm_set1_ps(EXP2_C6);
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(EXP2_C5));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(EXP2_C4));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(EXP2_C3));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(EXP2_C2));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(EXP2_C1));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.0f));
+        const auto exp2_n = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23));
+        return _mm_mul_ps(p, exp2_n);
+    }
+
+    static __m128i blend_sse2(__m128i mask, __m128i if_set, __m128i if_clear)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, if_set), _mm_andnot_si128(mask, if_clear));
+    }
+#elif defined(HAILO_OP_NEON_KERNELS)
+    static float32x4_t exp_non_positive_neon(float32x4_t x)
+    {
+        const auto t = vmulq_f32(vmaxq_f32(x, vdupq_n_f32(EXP_MIN_INPUT)), vdupq_n_f32(LOG2_E));
+        const auto n = vcvtnq_s32_f32(t);
+        const auto f = vsubq_f32(t, vcvtq_f32_s32(n));
+        auto p = vdupq_n_f32(EXP2_C6);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C5), p, f);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C4), p, f);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C3), p, f);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C2), p, f);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C1), p, f);
+        p = vmlaq_f32(vdupq_n_f32(1.0f), p, f);
+        const auto exp2_n = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n, vdupq_n_s32(127)), 23));
+        return vmulq_f32(p, exp2_n);
+    }
+#endif
+};
+
+#if defined(HAILO_OP_SSE2_KERNELS)
+
+template<>
+inline void OpKernels::argmax_update<uint8_t>(const uint8_t *values, uint8_t *max_values, uint16_t *max_indices,
+    uint16_t index, uint32_t count)
+{
+    const auto index_vector = _mm_set1_epi16(static_cast<int16_t>(index));
+    const auto all_ones = _mm_set1_epi8(-1);
+    uint32_t i = 0;
+    for (; (i + 16) <= count; i += 16) {
+        const auto current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(max_values + i));
+        const auto new_max = _mm_max_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)), current);
+        const auto greater = _mm_andnot_si128(_mm_cmpeq_epi8(new_max, current), all_ones);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(max_values + i), new_max);
+
+        // Each byte of the mask is duplicated to the matching uint16 index
+        auto indices = reinterpret_cast<__m128i*>(max_indices + i);
+        _mm_storeu_si128(indices, blend_sse2(_mm_unpacklo_epi8(greater, greater), index_vector, _mm_loadu_si128(indices)));
+        _mm_storeu_si128(indices + 1,
+            blend_sse2(_mm_unpackhi_epi8(greater, greater), index_vector, _mm_loadu_si128(indices + 1)));
+    }
+    argmax_update_scalar(values, max_values, max_indices, index, i, count);
+}
+
+template<>
+inline void OpKernels::argmax_update<uint16_t>(const uint16_t *values, uint16_t *max_values, uint16_t *max_indices,
+    uint16_t index, uint32_t count)
+{
+    const auto index_vector = _mm_set1_epi16(static_cast<int16_t>(index));
+    // SSE2 compares int16 only, so both sides are biased to the signed range
+    const auto bias = _mm_set1_epi16(INT16_MIN);
+    uint32_t i = 0;
+    for (; (i + 8) <= count; i += 8) {
+        const auto current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(max_values + i));
+        const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        const auto greater = _mm_cmpgt_epi16(_mm_xor_si128(value, bias), _mm_xor_si128(current, bias));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(max_values + i), blend_sse2(greater, value, current));
+        auto indices = reinterpret_cast<__m128i*>(max_indices + i);
+        _mm_storeu_si128(indices, blend_sse2(greater, index_vector, _mm_loadu_si128(indices)));
+    }
+    argmax_update_scalar(values, max_values, max_indices, index, i, count);
+}
+
+#elif defined(HAILO_OP_NEON_KERNELS)
+
+template<>
+inline void OpKernels::argmax_update<uint8_t>(const uint8_t *values, uint8_t *max_values, uint16_t *max_indices,
+    uint16_t index, uint32_t count)
+{
+    const auto index_vector = vdupq_n_u16(index);
+    uint32_t i = 0;
+    for (; (i + 16) <= count; i += 16) {
+        const auto current = vld1q_u8(max_values + i);
+        const auto value = vld1q_u8(values + i);
+        const auto greater = vreinterpretq_s8_u8(vcgtq_u8(value, current));
+        vst1q_u8(max_values + i, vmaxq_u8(value, current));
+
+        // The mask is sign extended to the matching uint16 indices
+        const auto greater_low = vreinterpretq_u16_s16(vmovl_s8(vget_low_s8(greater)));
+        const auto greater_high = vreinterpretq_u16_s16(vmovl_s8(vget_high_s8(greater)));
+        vst1q_u16(max_indices + i, vbslq_u16(greater_low, index_vector, vld1q_u16(max_indices + i)));
+        vst1q_u16(max_indices + i + 8, vbslq_u16(greater_high, index_vector, vld1q_u16(max_indices + i + 8)));
+    }
+    argmax_update_scalar(values, max_values, max_indices, index, i, count);
+}
+
+template<>
+inline void OpKernels::argmax_update<uint16_t>(const uint16_t *values, uint16_t *max_values, uint16_t *max_indices,
+    uint16_t index, uint32_t count)
+{
+    const auto index_vector = vdupq_n_u16(index);
+    uint32_t i = 0;
+    for (; (i + 8) <= count; i += 8) {
+        const auto current = vld1q_u16(max_values + i);
+        const auto value = vld1q_u16(values + i);
+        const auto greater = vcgtq_u16(value, current);
+        vst1q_u16(max_values + i, vmaxq_u16(value, current));
+        vst1q_u16(max_indices + i, vbslq_u16(greater, index_vector, vld1q_u16(max_indices + i)));
+    }
+    argmax_update_scalar(values, max_values, max_indices, index, i, count);
+}
+
+#endif
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_OP_KERNELS_HPP_ */
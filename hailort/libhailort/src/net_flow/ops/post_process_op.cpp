@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file post_process_op.cpp
+ * @brief Runs a network group's post-process op standalone, outside of the inference pipelines.
+ **/
+
+#include "hailo/post_process_op.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include "net_flow/ops/ssd_post_process.hpp"
+#include "net_flow/ops/yolox_post_process.hpp"
+#include "net_flow/ops/yolov8_post_process.hpp"
+#include "net_flow/ops/yolov8_bbox_only_post_process.hpp"
+#include "net_flow/ops/yolov5_post_process.hpp"
+#include "net_flow/ops/yolov5_bbox_only_post_process.hpp"
+#include "net_flow/ops/yolov5_seg_post_process.hpp"
+#include "net_flow/ops/argmax_post_process.hpp"
+#include "net_flow/ops/softmax_post_process.hpp"
+
+
+namespace hailort
+{
+
+// The metadata is copied, as the ops update it by the requested output format
+template<typename OpMetadataType>
+static Expected<std::shared_ptr<OpMetadataType>> copy_op_metadata(const net_flow::PostProcessOpMetadataPtr &op_metadata)
+{
+    auto metadata = std::dynamic_pointer_cast<OpMetadataType>(op_metadata);
+    CHECK_AS_EXPECTED(nullptr != metadata, HAILO_INVALID_ARGUMENT, "Unexpected metadata type of op {}",
+        op_metadata->get_name());
+
+    auto metadata_copy = make_shared_nothrow<OpMetadataType>(*metadata);
+    CHECK_NOT_NULL_AS_EXPECTED(metadata_copy, HAILO_OUT_OF_HOST_MEMORY);
+    return metadata_copy;
+}
+
+static Expected<std::shared_ptr<net_flow::Op>> create_nms_op(const net_flow::PostProcessOpMetadataPtr &op_metadata,
+    const hailo_format_t &output_format)
+{
+    auto nms_metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
+    CHECK_AS_EXPECTED(nullptr != nms_metadata, HAILO_INVALID_ARGUMENT, "Op {} has no NMS metadata", op_metadata->get_name());
+    const auto bbox_only = nms_metadata->nms_config().bbox_only;
+    const auto expanded_output_format = net_flow::NmsOpMetadata::expand_output_format_autos_by_op_type(output_format,
+        op_metadata->type(), bbox_only);
+
+    net_flow::PostProcessOpMetadataPtr metadata_copy;
+    switch (op_metadata->type()) {
+    case net_flow::OperationType::YOLOX:
+    {
+        TRY(metadata_copy, copy_op_metadata<net_flow::YoloxOpMetadata>(op_metadata));
+        break;
+    }
+    case net_flow::OperationType::YOLOV8:
+    {
+        if (bbox_only) {
+            TRY(metadata_copy, copy_op_metadata<net_flow::Yolov8BboxOnlyOpMetadata>(op_metadata));
+        } else {
+            TRY(metadata_copy, copy_op_metadata<net_flow::Yolov8OpMetadata>(op_metadata));
+        }
+        break;
+    }
+    case net_flow::OperationType::YOLOV5:
+    {
+        if (bbox_only) {
+            TRY(metadata_copy, copy_op_metadata<net_flow::Yolov5BboxOnlyOpMetadata>(op_metadata));
+        } else {
+            TRY(metadata_copy, copy_op_metadata<net_flow::Yolov5OpMetadata>(op_metadata));
+        }
+        break;
+    }
+    case net_flow::OperationType::YOLOV5SEG:
+    {
+        TRY(metadata_copy, copy_op_metadata<net_flow::Yolov5SegOpMetadata>(op_metadata));
+        break;
+    }
+    case net_flow::OperationType::SSD:
+    {
+        TRY(metadata_copy, copy_op_metadata<net_flow::SSDOpMetadata>(op_metadata));
+        break;
+    }
+    default:
+        LOGGER__ERROR("Op {} of type {} isn't supported standalone", op_metadata->get_name(),
+            net_flow::OpMetadata::get_operation_type_str(op_metadata->type()));
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
+    auto updated_outputs_metadata = metadata_copy->outputs_metadata();
+    CHECK_AS_EXPECTED(1 == updated_outputs_metadata.size(), HAILO_INVALID_OPERATION, "Op {} must have a single output",
+        metadata_copy->get_name());
+    updated_outputs_metadata.begin()->second.format = expanded_output_format;
+    metadata_copy->set_outputs_metadata(updated_outputs_metadata);
+    CHECK_SUCCESS_AS_EXPECTED(metadata_copy->validate_format_info());
+
+    switch (metadata_copy->type()) {
+    case net_flow::OperationType::YOLOX:
+        return net_flow::YOLOXPostProcessOp::create(std::dynamic_pointer_cast<net_flow::YoloxOpMetadata>(metadata_copy));
+    case net_flow::OperationType::YOLOV8:
+        if (bbox_only) {
+            return net_flow::YOLOv8BboxOnlyPostProcessOp::create(
+                std::dynamic_pointer_cast<net_flow::Yolov8BboxOnlyOpMetadata>(metadata_copy));
+        }
+        return net_flow::YOLOV8PostProcessOp::create(std::dynamic_pointer_cast<net_flow::Yolov8OpMetadata>(metadata_copy));
+    case net_flow::OperationType::YOLOV5:
+        if (bbox_only) {
+            return net_flow::YOLOv5BboxOnlyPostProcessOp::create(
+                std::dynamic_pointer_cast<net_flow::Yolov5BboxOnlyOpMetadata>(metadata_copy));
+        }
+        return net_flow::YOLOv5PostProcessOp::create(std::dynamic_pointer_cast<net_flow::Yolov5OpMetadata>(metadata_copy));
+    case net_flow::OperationType::YOLOV5SEG:
+        return net_flow::Yolov5SegPostProcess::create(std::dynamic_pointer_cast<net_flow::Yolov5SegOpMetadata>(metadata_copy));
+    case net_flow::OperationType::SSD:
+        return net_flow::SSDPostProcessOp::create(std::dynamic_pointer_cast<net_flow::SSDOpMetadata>(metadata_copy));
+    default:
+        return make_unexpected(HAILO_INTERNAL_FAILURE);
+    }
+}
+
+static Expected<std::shared_ptr<net_flow::Op>> create_argmax_op(const net_flow::PostProcessOpMetadataPtr &op_metadata,
+    const hailo_format_t &output_format)
+{
+    TRY(auto metadata, copy_op_metadata<net_flow::ArgmaxOpMetadata>(op_metadata));
+
+    const auto op_input_format = metadata->inputs_metadata().begin()->second.format;
+    auto updated_outputs_metadata = metadata->outputs_metadata();
+    updated_outputs_metadata.begin()->second.format =
+        net_flow::ArgmaxOpMetadata::expand_output_format_autos(output_format, op_input_format);
+    metadata->set_outputs_metadata(updated_outputs_metadata);
+    CHECK_SUCCESS_AS_EXPECTED(metadata->validate_format_info());
+
+    return net_flow::ArgmaxPostProcessOp::create(metadata);
+}
+
+static Expected<std::shared_ptr<net_flow::Op>> create_softmax_op(const net_flow::PostProcessOpMetadataPtr &op_metadata,
+    const hailo_format_t &output_format)
+{
+    TRY(auto metadata, copy_op_metadata<net_flow::SoftmaxOpMetadata>(op_metadata));
+
+    // As in the pipelines, the input of the softmax is in the format of its output (the outputs stream is transformed
+    // before the op)
+    const auto op_input_format = metadata->inputs_metadata().begin()->second.format;
+    const auto output_format_expanded = net_flow::SoftmaxOpMetadata::expand_output_format_autos(output_format, op_input_format);
+    auto updated_inputs_metadata = metadata->inputs_metadata();
+    updated_inputs_metadata.begin()->second.format = output_format_expanded;
+    auto updated_outputs_metadata = metadata->outputs_metadata();
+    updated_outputs_metadata.begin()->second.format = output_format_expanded;
+    metadata->set_outputs_metadata(updated_outputs_metadata);
+    metadata->set_inputs_metadata(updated_inputs_metadata);
+    CHECK_SUCCESS_AS_EXPECTED(metadata->validate_format_info());
+
+    return net_flow::SoftmaxPostProcessOp::create(metadata);
+}
+
+Expected<std::shared_ptr<PostProcessOp>> PostProcessOp::create(const net_flow::PostProcessOpMetadataPtr &op_metadata,
+    const hailo_format_t &output_format)
+{
+    CHECK_ARG_NOT_NULL_AS_EXPECTED(op_metadata);
+
+    std::shared_ptr<net_flow::Op> op;
+    switch (op_metadata->type()) {
+    case net_flow::OperationType::ARGMAX:
+    {
+        TRY(op, create_argmax_op(op_metadata, output_format));
+        break;
+    }
+    case net_flow::OperationType::SOFTMAX:
+    {
+        TRY(op, create_softmax_op(op_metadata, output_format));
+        break;
+    }
+    default:
+    {
+        TRY(op, create_nms_op(op_metadata, output_format));
+        break;
+    }
+    }
+
+    TRY(const auto output_vstream_info, op->metadata()->get_output_vstream_info());
+    auto result = make_shared_nothrow<PostProcessOp>(std::move(op), output_vstream_info);
+    CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
+    return result;
+}
+
+PostProcessOp::PostProcessOp(std::shared_ptr<net_flow::Op> op, const hailo_vstream_info_t &output_vstream_info) :
+    m_op(std::move(op)),
+    m_output_vstream_info(output_vstream_info)
+{}
+
+std::string PostProcessOp::name() const
+{
+    return m_op->get_name();
+}
+
+std::vector<std::string> PostProcessOp::get_input_names() const
+{
+    const auto names = m_op->metadata()->get_input_names();
+    return std::vector<std::string>(names.begin(), names.end());
+}
+
+Expected<size_t> PostProcessOp::get_input_frame_size(const std::string &input_name) const
+{
+    const auto &inputs_metadata = m_op->inputs_metadata();
+    CHECK_AS_EXPECTED(contains(inputs_metadata, input_name), HAILO_NOT_FOUND, "Op {} has no input {}", name(), input_name);
+    const auto &input_metadata = inputs_metadata.at(input_name);
+
+    // The softmax runs on the transformed stream, other ops run on the stream's data as is (with its padding)
+    const auto &shape = (net_flow::OperationType::SOFTMAX == m_op->metadata()->type()) ?
+        input_metadata.shape : input_metadata.padded_shape;
+    return static_cast<size_t>(HailoRTCommon::get_frame_size(shape, input_metadata.format));
+}
+
+Expected<hailo_format_t> PostProcessOp::get_input_format(const std::string &input_name) const
+{
+    const auto &inputs_metadata = m_op->inputs_metadata();
+    CHECK_AS_EXPECTED(contains(inputs_metadata, input_name), HAILO_NOT_FOUND, "Op {} has no input {}", name(), input_name);
+    return hailo_format_t(inputs_metadata.at(input_name).format);
+}
+
+Expected<hailo_vstream_info_t> PostProcessOp::get_output_vstream_info() const
+{
+    return hailo_vstream_info_t(m_output_vstream_info);
+}
+
+Expected<size_t> PostProcessOp::get_output_frame_size() const
+{
+    return static_cast<size_t>(HailoRTCommon::get_frame_size(m_output_vstream_info, m_output_vstream_info.format));
+}
+
+hailo_status PostProcessOp::execute(const std::map<std::string, MemoryView> &inputs, MemoryView output)
+{
+    for (const auto &input_name : get_input_names()) {
+        CHECK(contains(inputs, input_name), HAILO_INVALID_ARGUMENT, "Missing input {} of op {}", input_name, name());
+        TRY(const auto input_frame_size, get_input_frame_size(input_name));
+        CHECK(inputs.at(input_name).size() >= input_frame_size, HAILO_INVALID_ARGUMENT,
+            "Input {} of op {} is too small (size {}, frame size {})", input_name, name(), inputs.at(input_name).size(),
+            input_frame_size);
+    }
+    TRY(const auto output_frame_size, get_output_frame_size());
+    CHECK(output.size() >= output_frame_size, HAILO_INVALID_ARGUMENT,
+        "Output of op {} is too small (size {}, frame size {})", name(), output.size(), output_frame_size);
+
+    std::map<std::string, MemoryView> outputs = {{m_output_vstream_info.name, output}};
+    return m_op->execute(inputs, outputs);
+}
+
+} /* namespace hailort */
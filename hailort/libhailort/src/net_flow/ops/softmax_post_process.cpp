@@ -12,22 +12,6 @@
 #include "hailo/hailort_common.hpp"
 #include "hailo/hailort_defaults.hpp"
 
-#if defined(_MSC_VER)
-#pragma warning(push)
-#pragma warning(disable: 4244 4267 4127)
-#else
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-#pragma GCC diagnostic ignored "-Wclass-memaccess"
-#endif
-#include <Eigen/Dense>
-#if defined(_MSC_VER)
-#pragma warning(pop)
-#else
-#pragma GCC diagnostic pop
-#endif
-
 #include "common/utils.hpp"
 
 #include <limits>
@@ -52,27 +36,15 @@ hailo_status SoftmaxPostProcessOp::execute_not_supported(const BufferMetaData &i
 
 hailo_status SoftmaxPostProcessOp::softmax(float32_t *src, float32_t *dst, size_t num_of_elements)
 {
-    // Create an Eigen Matrix view for src and dst
-    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, 1>> src_eigen(src, num_of_elements);
-    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, 1>> dst_eigen(dst, num_of_elements);
-
-    src_eigen = src_eigen.array().exp(); // Compute exponentials in place
-
-    assert(!src_eigen.hasNaN()); // Checks if any element in the array is NaN (Not a Number)
-
-    float sum_exp = src_eigen.sum(); // Compute the sum of exponentials
-
-    assert(0.0f != sum_exp); // Checks for division by zero
-    dst_eigen = src_eigen / sum_exp; // Perform softmax operation
-
+    softmax_pixels(src, dst, 1, static_cast<uint32_t>(num_of_elements), 1.0f);
     return HAILO_SUCCESS;
 }
 
 SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES]
 {
     // Currently supported on:
-    // NC, float_32 to NC, float_32
-    // NHWC, float_32 to NHWC, float_32
+    // NC, uint8/uint16/float_32 to NC, float_32
+    // NHWC, uint8/uint16/float_32 to NHWC, float_32
     {
         {
             // NHWC x AUTO
@@ -84,26 +56,24 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
         },
         {
             // NHWC x UINT8
-            // We don't support input_format_type to be UINT8
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<uint8_t>
         },
         {
             // NHWC x UINT16
-            // We don't support input_format_type to be UINT16
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<uint16_t>
         },
         {
             // NHWC x FLOAT32
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
-            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, float32_t>
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t>
         }
     },
     {
@@ -117,26 +87,24 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
         },
         {
             // NC x UINT8
-            // We don't support input_format_type to be UINT8
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NC_to_NC<uint8_t>
         },
         {
             // NC x UINT16
-            // We don't support input_format_type to be UINT16
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
-            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
+            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NC_to_NC<uint16_t>
         },
         {
             // NC x FLOAT32
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
-            SoftmaxPostProcessOp::NC_to_NC<float32_t, float32_t>,
+            SoftmaxPostProcessOp::NC_to_NC<float32_t>
         }
     }
 };
@@ -217,9 +185,11 @@ hailo_status SoftmaxOpMetadata::validate_format_info()
         HailoRTCommon::get_format_order_str(input_metadata.format.order),
         HailoRTCommon::get_format_order_str(output_metadata.format.order));
 
-    CHECK(input_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32,
-        HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be {}",
+    CHECK((input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) || (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) ||
+        (input_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32),
+        HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be either {}, {} or {}",
         HailoRTCommon::get_format_type_str(input_metadata.format.type),
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16),
         HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
     CHECK(output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32,
         HAILO_INVALID_OPERATION, "The given output format type {} is not valid, should be {}",
@@ -8,6 +8,7 @@
  * A few notes:
  *  - Support only on features axis
  *  - Support only on NHWC and NC input data order
+ *  - Support uint8, uint16 (de-quantized by the op) and float32 inputs, and float32 outputs
  **/
 
 #ifndef _HAILO_SOFTMAX_POST_PROCESS_HPP_
@@ -16,10 +17,14 @@
 #include "hailo/hailort.h"
 #include "net_flow/ops/op.hpp"
 #include "net_flow/ops_metadata/softmax_op_metadata.hpp"
+#include "net_flow/ops/op_kernels.hpp"
 
 #include "common/utils.hpp"
 #include "hailo/quantization.hpp"
 
+#include <algorithm>
+#include <type_traits>
+
 namespace hailort
 {
 namespace net_flow
@@ -39,37 +44,70 @@ private:
         : Op(static_cast<std::shared_ptr<OpMetadata>>(metadata))
     {}
 
-    template<typename src_type = float32_t, typename dst_type = float32_t>
+    // The scale the input is de-quantized by (the softmax doesn't depend on the zero point)
+    template<typename SrcType>
+    static float32_t get_dequantize_scale(const BufferMetaData &input_metadata)
+    {
+        return std::is_same<SrcType, float32_t>::value ? 1.0f : input_metadata.quant_info.qp_scale;
+    }
+
+    // Softmax of count pixels of features contiguous elements each. The maximum of each pixel is subtracted before the
+    // exp (which doesn't change the softmax), so exp never overflows, and the exp of all of the pixels is computed in a
+    // single vectorized pass.
+    template<typename SrcType>
+    static void softmax_pixels(const SrcType *src, float32_t *dst, uint32_t count, uint32_t features, float32_t qp_scale)
+    {
+        for (uint32_t p = 0; p < count; p++) {
+            const SrcType *src_pixel = src + (p * features);
+            float32_t *dst_pixel = dst + (p * features);
+            const auto max_value = static_cast<float32_t>(*std::max_element(src_pixel, src_pixel + features));
+            for (uint32_t c = 0; c < features; c++) {
+                dst_pixel[c] = (static_cast<float32_t>(src_pixel[c]) - max_value) * qp_scale;
+            }
+        }
+
+        OpKernels::exp_non_positive(dst, dst, count * features);
+
+        for (uint32_t p = 0; p < count; p++) {
+            float32_t *dst_pixel = dst + (p * features);
+            float32_t sum_exp = 0;
+            for (uint32_t c = 0; c < features; c++) {
+                sum_exp += dst_pixel[c];
+            }
+            // The maximal element's exp is 1, so the sum is at least 1
+            const auto inverse_sum_exp = 1.0f / sum_exp;
+            for (uint32_t c = 0; c < features; c++) {
+                dst_pixel[c] *= inverse_sum_exp;
+            }
+        }
+    }
+
+    // Each row is computed at once (the input isn't padded, so the pixels of a row are contiguous)
+    template<typename SrcType>
     static hailo_status NHWC_to_NHWC_feature_axis(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
-        auto src_ptr = (dst_type*)inputs.begin()->second.data();
-        auto dst_ptr = (src_type*)outputs.begin()->second.data();
+        auto src_ptr = (SrcType*)inputs.begin()->second.data();
+        auto dst_ptr = (float32_t*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.shape.width * input_metadata.shape.features;
         const auto dst_row_size = output_metadata.shape.width * output_metadata.shape.features;
-        const auto src_width_size = input_metadata.shape.features;
-        const auto dst_width_size = output_metadata.shape.features;
+        const auto qp_scale = get_dequantize_scale<SrcType>(input_metadata);
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) { // H axis - rows
-            dst_type *src_row = src_ptr + (r * src_row_size);
-            src_type *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) { // W axis - coloums
-                dst_type *src_col = src_row + (w * src_width_size);
-                src_type *dst_col = dst_row + (w * dst_width_size);
-                softmax(src_col, dst_col, input_metadata.shape.features);
-            }
+            softmax_pixels(src_ptr + (r * src_row_size), dst_ptr + (r * dst_row_size), input_metadata.shape.width,
+                input_metadata.shape.features, qp_scale);
         }
         return HAILO_SUCCESS;
     }
 
-    template<typename src_type = float32_t, typename dst_type = float32_t>
+    template<typename SrcType>
     static hailo_status NC_to_NC(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
         (void) output_metadata;
-        auto src_ptr = (src_type*)inputs.begin()->second.data();
-        auto dst_ptr = (dst_type*)outputs.begin()->second.data();
-        softmax(src_ptr, dst_ptr, input_metadata.shape.features);
+        auto src_ptr = (SrcType*)inputs.begin()->second.data();
+        auto dst_ptr = (float32_t*)outputs.begin()->second.data();
+        softmax_pixels(src_ptr, dst_ptr, 1, input_metadata.shape.features, get_dequantize_scale<SrcType>(input_metadata));
         return HAILO_SUCCESS;
     }
 
@@ -83,7 +121,7 @@ private:
 
         // A 3D array of softmax functions to call:
         // 1st dim represent the data format order (NHWC and NC are supported)
-        // 2nd dim represent the input data type (only float_32 is supported)
+        // 2nd dim represent the input data type (uint8, uint16 and float_32 are supported)
         // 3rd dim represent the output data type (only float_32 is supported)
         static SoftmaxFunction m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES];
 
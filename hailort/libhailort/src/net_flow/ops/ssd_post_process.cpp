@@ -110,6 +110,24 @@ Expected<std::shared_ptr<Op>> SSDPostProcessOp::create(std::shared_ptr<SSDOpMeta
     return std::shared_ptr<Op>(std::move(op));
 }
 
+SSDPostProcessOp::AnchorsCenters SSDPostProcessOp::create_anchors_centers(const hailo_3d_image_shape_t &shape)
+{
+    AnchorsCenters anchors_centers;
+    auto anchor_w_stride = 1.0f / static_cast<float32_t>(shape.width);
+    auto anchor_h_stride = 1.0f / static_cast<float32_t>(shape.height);
+    auto anchor_w_offset = 0.5f * anchor_w_stride;
+    auto anchor_h_offset = 0.5f * anchor_h_stride;
+    anchors_centers.x_centers.reserve(shape.width);
+    for (uint32_t col = 0; col < shape.width; col++) {
+        anchors_centers.x_centers.push_back(static_cast<float32_t>(col) * anchor_w_stride + anchor_w_offset);
+    }
+    anchors_centers.y_centers.reserve(shape.height);
+    for (uint32_t row = 0; row < shape.height; row++) {
+        anchors_centers.y_centers.push_back(static_cast<float32_t>(row) * anchor_h_stride + anchor_h_offset);
+    }
+    return anchors_centers;
+}
+
 hailo_status SSDPostProcessOp::execute(const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
 {
     CHECK(inputs.size() == m_metadata->ssd_config().anchors.size(), HAILO_INVALID_ARGUMENT,
@@ -138,20 +156,9 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
 
     assert(contains(inputs_metadata, reg_input_name));
     assert(contains(inputs_metadata, cls_input_name));
-    const auto &reg_shape = inputs_metadata.at(reg_input_name).shape;
     const auto &reg_padded_shape = inputs_metadata.at(reg_input_name).padded_shape;
     const auto &cls_padded_shape = inputs_metadata.at(cls_input_name).padded_shape;
 
-    const uint32_t X_INDEX = ssd_config.tx_index;
-    const uint32_t Y_INDEX = ssd_config.ty_index;
-    const uint32_t W_INDEX = ssd_config.tw_index;
-    const uint32_t H_INDEX = ssd_config.th_index;
-
-    const uint32_t X_OFFSET = X_INDEX * reg_padded_shape.width;
-    const uint32_t Y_OFFSET = Y_INDEX * reg_padded_shape.width;
-    const uint32_t W_OFFSET = W_INDEX * reg_padded_shape.width;
-    const uint32_t H_OFFSET = H_INDEX * reg_padded_shape.width;
-
     // Each layer anchors vector is structured as {w,h} pairs.
     // For example, if we have a vector of size 6 (default SSD vector) then we have 3 anchors for this layer.
     assert(contains(ssd_config.anchors, reg_input_name));
@@ -176,59 +183,26 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
     CHECK(buffer_size == cls_buffer.size(), HAILO_INVALID_ARGUMENT,
         "Failed to extract_detections, cls {} buffer_size should be {}, but is {}", cls_input_name, buffer_size, cls_buffer.size());
 
-    auto reg_row_size = reg_padded_shape.width * reg_padded_shape.features;
-    auto cls_row_size = cls_padded_shape.width * cls_padded_shape.features;
-    for (uint32_t row = 0; row < reg_shape.height; row++) {
-        for (uint32_t col = 0; col < reg_shape.width; col++) {
-            for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
-                auto reg_idx = (reg_row_size * row) + col + ((anchor * reg_entry_size) * reg_padded_shape.width);
-                auto cls_idx = (cls_row_size * row) + col + ((anchor * cls_entry_size) * cls_padded_shape.width);
-                const auto &wa = layer_anchors[anchor * 2];
-                const auto &ha = layer_anchors[anchor * 2 + 1];
-                auto anchor_w_stride = 1.0f / static_cast<float32_t>(reg_shape.width);
-                auto anchor_h_stride = 1.0f / static_cast<float32_t>(reg_shape.height);
-                auto anchor_w_offset = 0.5f * anchor_w_stride;
-                auto anchor_h_offset = 0.5f * anchor_h_stride;
-                auto xcenter_a = static_cast<float32_t>(col) * anchor_w_stride + anchor_w_offset;
-                auto ycenter_a = static_cast<float32_t>(row) * anchor_h_stride + anchor_h_offset;
-                // Decode bboxes
-                if (inputs_metadata.at(reg_input_name).format.type == HAILO_FORMAT_TYPE_UINT8) {
-                    auto status = extract_bbox_detections<float32_t, uint8_t>(
-                        reg_input_name, cls_input_name,
-                        reg_buffer, cls_buffer,
-                        reg_idx + X_OFFSET,
-                        reg_idx + Y_OFFSET,
-                        reg_idx + W_OFFSET,
-                        reg_idx + H_OFFSET,
-                        cls_idx, wa, ha, xcenter_a, ycenter_a);
-                    CHECK_SUCCESS(status);
-                } else if (inputs_metadata.at(reg_input_name).format.type == HAILO_FORMAT_TYPE_UINT16) {
-                    auto status = extract_bbox_detections<float32_t, uint16_t>(
-                        reg_input_name, cls_input_name,
-                        reg_buffer, cls_buffer,
-                        reg_idx + X_OFFSET,
-                        reg_idx + Y_OFFSET,
-                        reg_idx + W_OFFSET,
-                        reg_idx + H_OFFSET,
-                        cls_idx, wa, ha, xcenter_a, ycenter_a);
-                    CHECK_SUCCESS(status);
-                } else if (inputs_metadata.at(reg_input_name).format.type == HAILO_FORMAT_TYPE_FLOAT32) {
-                    // For testing - TODO: HRT-9341 - Remove after generator tests are in, and return error.
-                    auto status = extract_bbox_detections<float32_t, float32_t>(
-                        reg_input_name, cls_input_name,
-                        reg_buffer, cls_buffer,
-                        reg_idx + X_OFFSET,
-                        reg_idx + Y_OFFSET,
-                        reg_idx + W_OFFSET,
-                        reg_idx + H_OFFSET,
-                        cls_idx, wa, ha, xcenter_a, ycenter_a);
-                    CHECK_SUCCESS(status);
-                } else {
-                    CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "SSD post-process received invalid reg input type: {}",
-                        inputs_metadata.at(reg_input_name).format.type);
-                }
-            }
-        }
+    assert(contains(m_anchors_centers, reg_input_name));
+    const auto &anchors_centers = m_anchors_centers.at(reg_input_name);
+    const auto &reg_metadata = inputs_metadata.at(reg_input_name);
+    const auto &cls_metadata = inputs_metadata.at(cls_input_name);
+    if (reg_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
+        auto status = extract_layer_detections<float32_t, uint8_t>(reg_metadata, cls_metadata, layer_anchors,
+            anchors_centers, reg_buffer, cls_buffer);
+        CHECK_SUCCESS(status);
+    } else if (reg_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
+        auto status = extract_layer_detections<float32_t, uint16_t>(reg_metadata, cls_metadata, layer_anchors,
+            anchors_centers, reg_buffer, cls_buffer);
+        CHECK_SUCCESS(status);
+    } else if (reg_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) {
+        // For testing - TODO: HRT-9341 - Remove after generator tests are in, and return error.
+        auto status = extract_layer_detections<float32_t, float32_t>(reg_metadata, cls_metadata, layer_anchors,
+            anchors_centers, reg_buffer, cls_buffer);
+        CHECK_SUCCESS(status);
+    } else {
+        CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "SSD post-process received invalid reg input type: {}",
+            reg_metadata.format.type);
     }
 
     return HAILO_SUCCESS;
@@ -34,20 +34,43 @@ public:
     static const uint32_t DEFAULT_W_OFFSET_IDX = 3;
 
 private:
+    // The centers of a layer's anchors are the centers of the layer's grid cells - the same for all of the anchors of a
+    // cell, and the same for every frame. They are computed once, when the op is created.
+    struct AnchorsCenters {
+        std::vector<float32_t> x_centers; // By column
+        std::vector<float32_t> y_centers; // By row
+    };
+    static AnchorsCenters create_anchors_centers(const hailo_3d_image_shape_t &shape);
+
     SSDPostProcessOp(std::shared_ptr<SSDOpMetadata> metadata)
         : NmsPostProcessOp(static_cast<std::shared_ptr<NmsOpMetadata>>(metadata))
         , m_metadata(metadata)
-    {}
+    {
+        for (const auto &reg_to_cls : m_metadata->ssd_config().reg_to_cls_inputs) {
+            assert(contains(m_metadata->inputs_metadata(), reg_to_cls.first));
+            m_anchors_centers.emplace(reg_to_cls.first,
+                create_anchors_centers(m_metadata->inputs_metadata().at(reg_to_cls.first).shape));
+        }
+    }
     std::shared_ptr<SSDOpMetadata> m_metadata;
+    // By the reg input name
+    std::unordered_map<std::string, AnchorsCenters> m_anchors_centers;
+    // The max class score of each anchor of a row (kept between frames to save the allocation)
+    std::vector<uint8_t> m_max_scores;
 
     template<typename DstType = float32_t, typename SrcType>
-    void extract_bbox_classes(const hailo_bbox_float32_t &dims_bbox, SrcType *cls_data, const BufferMetaData &cls_metadata, uint32_t cls_index)
+    void extract_bbox_classes(const hailo_bbox_float32_t &dims_bbox, const SrcType *cls_data, const BufferMetaData &cls_metadata, uint32_t cls_index)
     {
         const auto &nms_config = m_metadata->nms_config();
         if (nms_config.cross_classes) {
             // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
-            auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_index, 0, 1,
-                cls_metadata.quant_info, cls_metadata.padded_shape.width);
+            // The classes are decoded once per anchor, so building a lookup table per call isn't worth it
+            const auto &quant_info = cls_metadata.quant_info;
+            auto decode_score = [this, &quant_info](SrcType number) {
+                return dequantize_and_sigmoid<DstType, SrcType>(number, quant_info);
+            };
+            auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_index, 0, 1, decode_score,
+                cls_metadata.padded_shape.width);
             auto bbox = dims_bbox;
             bbox.score = max_id_score_pair.second;
             if (max_id_score_pair.second >= nms_config.nms_score_th) {
@@ -85,22 +108,17 @@ private:
     }
 
     template<typename DstType = float32_t, typename SrcType>
-    hailo_status extract_bbox_detections(const std::string &reg_input_name, const std::string &cls_input_name,
-        const MemoryView &reg_buffer, const MemoryView &cls_buffer,
-        uint64_t x_index, uint64_t y_index, uint64_t w_index, uint64_t h_index,
-        uint32_t cls_index, float32_t wa, float32_t ha, float32_t xcenter_a, float32_t ycenter_a)
+    hailo_bbox_float32_t decode_bbox(const SrcType *reg_data, uint32_t reg_idx, const BufferMetaData &reg_metadata,
+        float32_t wa, float32_t ha, float32_t xcenter_a, float32_t ycenter_a)
     {
-        const auto &inputs_metadata = m_metadata->inputs_metadata();
         const auto &ssd_config = m_metadata->ssd_config();
-        assert(contains(inputs_metadata, reg_input_name));
-        const auto &shape = inputs_metadata.at(reg_input_name).shape;
-        const auto &reg_quant_info = inputs_metadata.at(reg_input_name).quant_info;
-        SrcType *reg_data = (SrcType*)reg_buffer.data();
-        auto *cls_data = cls_buffer.data();
-        auto tx = Quantization::dequantize_output<DstType, SrcType>(reg_data[x_index], reg_quant_info);
-        auto ty = Quantization::dequantize_output<DstType, SrcType>(reg_data[y_index], reg_quant_info);
-        auto tw = Quantization::dequantize_output<DstType, SrcType>(reg_data[w_index], reg_quant_info);
-        auto th = Quantization::dequantize_output<DstType, SrcType>(reg_data[h_index], reg_quant_info);
+        const auto &shape = reg_metadata.shape;
+        const auto &reg_quant_info = reg_metadata.quant_info;
+        const auto reg_width = reg_metadata.padded_shape.width;
+        auto tx = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + (ssd_config.tx_index * reg_width)], reg_quant_info);
+        auto ty = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + (ssd_config.ty_index * reg_width)], reg_quant_info);
+        auto tw = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + (ssd_config.tw_index * reg_width)], reg_quant_info);
+        auto th = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + (ssd_config.th_index * reg_width)], reg_quant_info);
         tx /= static_cast<float32_t>(ssd_config.centers_scale_factor);
         ty /= static_cast<float32_t>(ssd_config.centers_scale_factor);
         tw /= static_cast<float32_t>(ssd_config.bbox_dimensions_scale_factor);
@@ -122,18 +140,76 @@ private:
             x_max = Quantization::clip(x_max, 0, static_cast<float32_t>(shape.width-1));
             y_max = Quantization::clip(y_max, 0, static_cast<float32_t>(shape.height-1));
         }
-        hailo_bbox_float32_t dims_bbox{y_min, x_min, y_max, x_max, 0};
-        assert(contains(inputs_metadata, cls_input_name));
-        const auto &cls_metadata = inputs_metadata.at(cls_input_name);
+        return hailo_bbox_float32_t{static_cast<float32_t>(y_min), static_cast<float32_t>(x_min),
+            static_cast<float32_t>(y_max), static_cast<float32_t>(x_max), 0};
+    }
+
+    template<typename DstType = float32_t, typename RegType, typename ClsType>
+    void extract_layer_detections(const BufferMetaData &reg_metadata, const BufferMetaData &cls_metadata,
+        const std::vector<float32_t> &layer_anchors, const AnchorsCenters &anchors_centers,
+        const RegType *reg_data, const ClsType *cls_data)
+    {
+        const auto &nms_config = m_metadata->nms_config();
+        const auto &reg_shape = reg_metadata.shape;
+        const auto &reg_padded_shape = reg_metadata.padded_shape;
+        const auto &cls_padded_shape = cls_metadata.padded_shape;
+        const size_t num_of_anchors = (layer_anchors.size() / 2);
+        static const uint32_t reg_entry_size = 4;
+        const uint32_t cls_entry_size = nms_config.number_of_classes;
+        const auto reg_row_size = reg_padded_shape.width * reg_padded_shape.features;
+        const auto cls_row_size = cls_padded_shape.width * cls_padded_shape.features;
+
+        // Most of the anchors are background - filter them by their max class score, before decoding their boxes.
+        // The scores are decoded as extract_bbox_classes decodes them (sigmoid-ed only with cross classes), and the
+        // max score may be of the background class, so the filter never drops an anchor extract_bbox_classes would keep.
+        const QuantizedValueDecoder<DstType, ClsType> decoder(cls_metadata.quant_info,
+            nms_config.cross_classes && should_sigmoid());
+        const bool should_filter_by_max_score = (nms_config.nms_score_th > 0) && decoder.is_monotonic();
+        m_max_scores.resize(should_filter_by_max_score ? (num_of_anchors * reg_shape.width * sizeof(ClsType)) : 0);
+        auto max_scores = reinterpret_cast<ClsType*>(m_max_scores.data());
+
+        for (uint32_t row = 0; row < reg_shape.height; row++) {
+            if (should_filter_by_max_score) {
+                for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
+                    auto anchor_classes_idx = (cls_row_size * row) + ((anchor * cls_entry_size) * cls_padded_shape.width);
+                    get_max_quantized_scores(cls_data + anchor_classes_idx, nms_config.number_of_classes,
+                        reg_shape.width, cls_padded_shape.width, max_scores + (anchor * reg_shape.width));
+                }
+            }
+            const auto ycenter_a = anchors_centers.y_centers[row];
+            for (uint32_t col = 0; col < reg_shape.width; col++) {
+                for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
+                    if (should_filter_by_max_score &&
+                        (decoder(max_scores[(anchor * reg_shape.width) + col]) < nms_config.nms_score_th)) {
+                        continue;
+                    }
+                    auto reg_idx = (reg_row_size * row) + col + ((anchor * reg_entry_size) * reg_padded_shape.width);
+                    auto cls_idx = (cls_row_size * row) + col + ((anchor * cls_entry_size) * cls_padded_shape.width);
+                    const auto dims_bbox = decode_bbox<DstType, RegType>(reg_data, reg_idx, reg_metadata,
+                        layer_anchors[anchor * 2], layer_anchors[anchor * 2 + 1], anchors_centers.x_centers[col],
+                        ycenter_a);
+                    extract_bbox_classes<DstType, ClsType>(dims_bbox, cls_data, cls_metadata, cls_idx);
+                }
+            }
+        }
+    }
+
+    template<typename DstType = float32_t, typename RegType>
+    hailo_status extract_layer_detections(const BufferMetaData &reg_metadata, const BufferMetaData &cls_metadata,
+        const std::vector<float32_t> &layer_anchors, const AnchorsCenters &anchors_centers,
+        const MemoryView &reg_buffer, const MemoryView &cls_buffer)
+    {
+        const auto *reg_data = reinterpret_cast<const RegType*>(reg_buffer.data());
+        const auto *cls_data = cls_buffer.data();
         if (cls_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
-            extract_bbox_classes<DstType, uint8_t>(dims_bbox, (uint8_t*)cls_data, cls_metadata,
-                cls_index);
+            extract_layer_detections<DstType, RegType, uint8_t>(reg_metadata, cls_metadata, layer_anchors,
+                anchors_centers, reg_data, reinterpret_cast<const uint8_t*>(cls_data));
         } else if (cls_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
-            extract_bbox_classes<DstType, uint16_t>(dims_bbox, (uint16_t*)cls_data, cls_metadata,
-                cls_index);
+            extract_layer_detections<DstType, RegType, uint16_t>(reg_metadata, cls_metadata, layer_anchors,
+                anchors_centers, reg_data, reinterpret_cast<const uint16_t*>(cls_data));
         } else if (cls_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) {
-            extract_bbox_classes<DstType, float32_t>(dims_bbox, (float32_t*)cls_data, cls_metadata,
-                cls_index);
+            extract_layer_detections<DstType, RegType, float32_t>(reg_metadata, cls_metadata, layer_anchors,
+                anchors_centers, reg_data, reinterpret_cast<const float32_t*>(cls_data));
         } else {
             CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "SSD post-process received invalid cls input type: {}",
                 cls_metadata.format.type);
@@ -40,15 +40,14 @@ private:
     static const uint32_t YOLOV5_BBOX_ONLY_BBOXES_INDEX = 0;
 
     template<typename DstType = float32_t, typename SrcType>
-    void add_classes_scores(hailo_quant_info_t &quant_info, DstType* dst_data, size_t &next_bbox_output_offset,
+    void add_classes_scores(const QuantizedValueDecoder<DstType, SrcType> &decoder, DstType* dst_data, size_t &next_bbox_output_offset,
         SrcType* src_data, uint32_t entry_idx, uint32_t class_start_idx, uint32_t padded_width)
     {
         const auto &nms_config = m_metadata->nms_config();
 
         for (uint32_t class_index = 0; class_index < nms_config.number_of_classes; class_index++) {
             auto class_entry_idx = entry_idx + ((class_start_idx + class_index) * padded_width);
-            auto class_confidence = dequantize_and_sigmoid<DstType, SrcType>(
-            src_data[class_entry_idx], quant_info);
+            auto class_confidence = decoder(src_data[class_entry_idx]);
             dst_data[next_bbox_output_offset++] = class_confidence;
         }
     }
@@ -75,18 +74,19 @@ private:
 
         auto input_row_size = padded_shape.width * padded_shape.features;
         SrcType *input_data = (SrcType*)input_buffer.data();
+        const QuantizedValueDecoder<DstType, SrcType> decoder(quant_info, should_sigmoid());
         for (uint32_t row = 0; row < shape.height; row++) {
             for (uint32_t col = 0; col < shape.width; col++) {
                 for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
                     auto entry_idx = (input_row_size * row) + col + ((anchor * entry_size) * padded_shape.width);
-                    auto objectness = dequantize_and_sigmoid<DstType, SrcType>(input_data[entry_idx + OBJECTNESS_OFFSET], quant_info);
+                    auto objectness = decoder(input_data[entry_idx + OBJECTNESS_OFFSET]);
                     auto bbox = decode_bbox(input_data, entry_idx, X_OFFSET, Y_OFFSET, W_OFFSET, H_OFFSET, 
-                        quant_info, anchor, layer_anchors, col, row, shape);
+                        decoder, anchor, layer_anchors, col, row, shape);
                     memcpy(&dst_ptr[next_bbox_output_offset], &bbox, sizeof(hailo_bbox_float32_t) - sizeof(DstType)); // copy y_min, x_min, y_max, x_max
                     next_bbox_output_offset += (sizeof(hailo_bbox_float32_t) / sizeof(float32_t)) - 1;
                     dst_ptr[next_bbox_output_offset++] = objectness;
 
-                    add_classes_scores(quant_info, dst_ptr, next_bbox_output_offset, input_data, entry_idx,
+                    add_classes_scores(decoder, dst_ptr, next_bbox_output_offset, input_data, entry_idx,
                         CLASSES_START_INDEX, padded_shape.width);
                 }
             }
@@ -76,23 +76,24 @@ hailo_status YOLOv5PostProcessOp::execute(const std::map<std::string, MemoryView
             yolo_config.anchors.size(), inputs.size());
 
     clear_before_frame();
-    for (const auto &name_to_input : inputs) {
-        hailo_status status = HAILO_UNINITIALIZED;
-        auto &name = name_to_input.first;
-        assert(contains(inputs_metadata, name));
-        auto &input_metadata = inputs_metadata.at(name);
-        assert(contains(yolo_config.anchors, name));
-        if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
-            status = extract_detections<float32_t, uint8_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
-        } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
-            status = extract_detections<float32_t, uint16_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
-        } else {
-            CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "YOLO post-process received invalid input type {}", input_metadata.format.type);
-        }
-        CHECK_SUCCESS(status);
-    }
+    auto status = extract_branches_detections(inputs.size(),
+        [&](size_t branch_index, std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count) {
+            const auto &name_to_input = *std::next(inputs.begin(), branch_index);
+            auto &name = name_to_input.first;
+            assert(contains(inputs_metadata, name));
+            auto &input_metadata = inputs_metadata.at(name);
+            assert(contains(yolo_config.anchors, name));
+            if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
+                return extract_detections<float32_t, uint8_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
+                    input_metadata.padded_shape, yolo_config.anchors.at(name), detections, classes_detections_count);
+            } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
+                return extract_detections<float32_t, uint16_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
+                    input_metadata.padded_shape, yolo_config.anchors.at(name), detections, classes_detections_count);
+            }
+            LOGGER__ERROR("YOLO post-process received invalid input type {}", input_metadata.format.type);
+            return HAILO_INVALID_ARGUMENT;
+        });
+    CHECK_SUCCESS(status);
 
     // TODO: Add support for TF_FORMAT_ORDER
     return hailo_nms_format(outputs.begin()->second);
@@ -51,20 +51,21 @@ protected:
 
     template<typename DstType = float32_t, typename SrcType>
     hailo_bbox_float32_t decode_bbox(SrcType* data, uint32_t entry_idx, const uint32_t X_OFFSET, const uint32_t Y_OFFSET,
-        const uint32_t W_OFFSET, const uint32_t H_OFFSET, hailo_quant_info_t quant_info, uint32_t anchor,
-        const std::vector<int> &layer_anchors, uint32_t col, uint32_t row, hailo_3d_image_shape_t shape)
+        const uint32_t W_OFFSET, const uint32_t H_OFFSET, const QuantizedValueDecoder<DstType, SrcType> &decoder,
+        uint32_t anchor, const std::vector<int> &layer_anchors, uint32_t col, uint32_t row, hailo_3d_image_shape_t shape)
     {
-        auto tx = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + X_OFFSET], quant_info);
-        auto ty = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + Y_OFFSET], quant_info);
-        auto tw = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + W_OFFSET], quant_info);
-        auto th = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + H_OFFSET], quant_info);
+        auto tx = decoder(data[entry_idx + X_OFFSET]);
+        auto ty = decoder(data[entry_idx + Y_OFFSET]);
+        auto tw = decoder(data[entry_idx + W_OFFSET]);
+        auto th = decoder(data[entry_idx + H_OFFSET]);
         return decode(tx, ty, tw, th, layer_anchors[anchor * 2], layer_anchors[anchor * 2 + 1], col, row,
             shape.width, shape.height);
     }
 
     template<typename DstType = float32_t, typename SrcType>
     void check_threshold_and_add_detection(hailo_bbox_float32_t bbox, hailo_quant_info_t &quant_info,
-        uint32_t class_index, SrcType* data, uint32_t entry_idx, uint32_t padded_width, DstType objectness)
+        uint32_t class_index, SrcType* data, uint32_t entry_idx, uint32_t padded_width, DstType objectness,
+        std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count)
     {
         const auto &nms_config = m_metadata->nms_config();
         const auto &yolov5_config = m_metadata->yolov5_config();
@@ -79,37 +80,37 @@ protected:
                     mask_coefficients[i] = (Quantization::dequantize_output<DstType, SrcType>(
                         data[coeffs_offset], quant_info) * objectness);
                 }
-                m_detections.emplace_back(DetectionBbox(bbox, static_cast<uint16_t>(class_index), std::move(mask_coefficients),
+                detections.emplace_back(DetectionBbox(bbox, static_cast<uint16_t>(class_index), std::move(mask_coefficients),
                     yolov5_config.image_height, yolov5_config.image_width));
             } else {
-                m_detections.emplace_back(DetectionBbox(bbox, class_index));
+                detections.emplace_back(DetectionBbox(bbox, class_index));
             }
-            m_classes_detections_count[class_index]++;
+            classes_detections_count[class_index]++;
         }
     }
 
     template<typename DstType = float32_t, typename SrcType>
-    void decode_classes_scores(hailo_bbox_float32_t &bbox,
-        hailo_quant_info_t &quant_info, SrcType* data, uint32_t entry_idx, uint32_t class_start_idx,
-        DstType objectness, uint32_t padded_width)
+    void decode_classes_scores(hailo_bbox_float32_t &bbox, hailo_quant_info_t &quant_info,
+        const QuantizedValueDecoder<DstType, SrcType> &decoder, SrcType* data, uint32_t entry_idx, uint32_t class_start_idx,
+        DstType objectness, uint32_t padded_width, std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count)
     {
         const auto &nms_config = m_metadata->nms_config();
 
         if (nms_config.cross_classes) {
             // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
-            auto max_id_score_pair = get_max_class<DstType, SrcType>(data, entry_idx, class_start_idx, objectness, quant_info, padded_width);
+            auto max_id_score_pair = get_max_class<DstType, SrcType>(data, entry_idx, class_start_idx, objectness, decoder, padded_width);
             bbox.score = max_id_score_pair.second;
             check_threshold_and_add_detection(bbox, quant_info, max_id_score_pair.first,
-                data, entry_idx, padded_width, objectness);
+                data, entry_idx, padded_width, objectness, detections, classes_detections_count);
         }
         else {
             for (uint32_t class_index = 0; class_index < nms_config.number_of_classes; class_index++) {
                 auto class_entry_idx = entry_idx + ((class_start_idx + class_index) * padded_width);
-                auto class_confidence = dequantize_and_sigmoid<DstType, SrcType>(
-                    data[class_entry_idx], quant_info);
+                auto class_confidence = decoder(data[class_entry_idx]);
                 bbox.score = class_confidence * objectness;
                 check_threshold_and_add_detection(bbox, quant_info, class_index,
-                    data, entry_idx, padded_width, objectness);
+                    data, entry_idx, padded_width, objectness, detections, classes_detections_count);
             }
         }
     }
@@ -122,13 +123,16 @@ protected:
      * @param[in] shape                         Shape corresponding to the @a buffer layer.
      * @param[in] layer_anchors                 The layer anchors corresponding to layer receiving the @a buffer.
      *                                          Each anchor is structured as {width, height} pairs.
+     * @param[out] detections                   The extracted detections are added to this vector.
+     * @param[out] classes_detections_count     The count of each class' extracted detections is added to this vector.
      *
      * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
     */
     template<typename DstType = float32_t, typename SrcType>
     hailo_status extract_detections(const MemoryView &buffer, hailo_quant_info_t quant_info,
         hailo_3d_image_shape_t shape, hailo_3d_image_shape_t padded_shape,
-        const std::vector<int> &layer_anchors)
+        const std::vector<int> &layer_anchors, std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count)
     {
         const uint32_t X_OFFSET = X_INDEX * padded_shape.width;
         const uint32_t Y_OFFSET = Y_INDEX * padded_shape.width;
@@ -149,20 +153,38 @@ protected:
 
         auto row_size = padded_shape.width * padded_shape.features;
         SrcType *data = (SrcType*)buffer.data();
+        const QuantizedValueDecoder<DstType, SrcType> decoder(quant_info, should_sigmoid());
+
+        // Most of the entries are background - filter them by their max class score, before decoding their boxes.
+        // A non-positive threshold passes any score, so the filter is used only for a positive one.
+        const bool should_filter_by_max_score = (nms_config.nms_score_th > 0) && decoder.is_monotonic();
+        std::vector<SrcType> max_scores(should_filter_by_max_score ? (num_of_anchors * shape.width) : 0);
+
         for (uint32_t row = 0; row < shape.height; row++) {
+            if (should_filter_by_max_score) {
+                for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
+                    auto anchor_classes_idx = (row_size * row) + ((anchor * entry_size + CLASSES_START_INDEX) * padded_shape.width);
+                    get_max_quantized_scores(data + anchor_classes_idx, nms_config.number_of_classes, shape.width,
+                        padded_shape.width, max_scores.data() + (anchor * shape.width));
+                }
+            }
             for (uint32_t col = 0; col < shape.width; col++) {
                 for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
                     auto entry_idx = (row_size * row) + col + ((anchor * entry_size) * padded_shape.width);
-                    auto objectness = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + OBJECTNESS_OFFSET], quant_info);
+                    auto objectness = decoder(data[entry_idx + OBJECTNESS_OFFSET]);
                     if (objectness < nms_config.nms_score_th) {
                         continue;
                     }
+                    if (should_filter_by_max_score &&
+                        ((decoder(max_scores[(anchor * shape.width) + col]) * objectness) < nms_config.nms_score_th)) {
+                        continue;
+                    }
 
                     auto bbox = decode_bbox(data, entry_idx, X_OFFSET, Y_OFFSET, W_OFFSET, H_OFFSET,
-                        quant_info, anchor, layer_anchors, col, row, shape);
+                        decoder, anchor, layer_anchors, col, row, shape);
 
-                    decode_classes_scores(bbox, quant_info, data, entry_idx,
-                        CLASSES_START_INDEX, objectness, padded_shape.width);
+                    decode_classes_scores(bbox, quant_info, decoder, data, entry_idx,
+                        CLASSES_START_INDEX, objectness, padded_shape.width, detections, classes_detections_count);
                 }
             }
         }
@@ -19,6 +19,7 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
 #endif
+// The implementation of stb_image_resize is compiled here, for all of its users (e.g. the infer cascade)
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "stb_image_resize.h"
 #include <Eigen/Dense>
@@ -119,21 +120,17 @@ Expected<std::shared_ptr<Op>> Yolov5SegPostProcess::create(std::shared_ptr<Yolov
     TRY(auto mask_mult_result_buffer,
         Buffer::create(proto_layer_metadata.shape.height * proto_layer_metadata.shape.width * sizeof(float32_t)));
 
-    const auto image_size = static_cast<uint32_t>(metadata->yolov5_config().image_width) * static_cast<uint32_t>(metadata->yolov5_config().image_height);
-    TRY(auto resized_buffer, Buffer::create(image_size * sizeof(float32_t)));
-
     auto op = std::shared_ptr<Yolov5SegPostProcess>(new (std::nothrow) Yolov5SegPostProcess(std::move(metadata),
-        std::move(mask_mult_result_buffer), std::move(resized_buffer), std::move(transformed_proto_buffer)));
+        std::move(mask_mult_result_buffer), std::move(transformed_proto_buffer)));
     CHECK_NOT_NULL_AS_EXPECTED(op, HAILO_OUT_OF_HOST_MEMORY);
 
     return std::shared_ptr<Op>(std::move(op));
 }
 
 Yolov5SegPostProcess::Yolov5SegPostProcess(std::shared_ptr<Yolov5SegOpMetadata> metadata,
-    Buffer &&mask_mult_result_buffer, Buffer &&resized_mask, Buffer &&transformed_proto_buffer)
+    Buffer &&mask_mult_result_buffer, Buffer &&transformed_proto_buffer)
     : YOLOv5PostProcessOp(static_cast<std::shared_ptr<Yolov5OpMetadata>>(metadata)), m_metadata(metadata),
     m_mask_mult_result_buffer(std::move(mask_mult_result_buffer)),
-    m_resized_mask_to_image_dim(std::move(resized_mask)),
     m_transformed_proto_buffer(std::move(transformed_proto_buffer))
 {}
 
@@ -167,15 +164,16 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
         assert(contains(yolo_config.anchors, name));
         if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
             status = extract_detections<float32_t, uint8_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), m_detections, m_classes_detections_count);
         } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
             status = extract_detections<float32_t, uint16_t>(name_to_input.second, input_metadata.quant_info, input_metadata.shape,
-                input_metadata.padded_shape, yolo_config.anchors.at(name));
+                input_metadata.padded_shape, yolo_config.anchors.at(name), m_detections, m_classes_detections_count);
         }
         CHECK_SUCCESS(status);
     }
 
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_metadata->nms_config().nms_iou_th);
+    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_metadata->nms_config().nms_iou_th,
+        m_metadata->nms_config().max_proposals_per_class);
     auto status = fill_nms_with_byte_mask_format(outputs.begin()->second);
     CHECK_SUCCESS(status);
 
@@ -187,53 +185,91 @@ uint32_t Yolov5SegPostProcess::get_entry_size()
     return (CLASSES_START_INDEX + m_metadata->nms_config().number_of_classes + MASK_COEFFICIENT_SIZE);
 }
 
-void Yolov5SegPostProcess::mult_mask_vector_and_proto_matrix(const DetectionBbox &detection)
+void Yolov5SegPostProcess::fill_proto_samples(uint32_t mask_start, uint32_t mask_size, float32_t image_size,
+    uint32_t proto_size, std::vector<ProtoSample> &samples)
+{
+    // The centers of the image and proto pixels are aligned and the edges are clamped - as the triangle filter of
+    // stb_image_resize upscaling the proto layer to the image
+    const auto scale = static_cast<float32_t>(proto_size) / image_size;
+    const auto last_position = static_cast<float32_t>(proto_size - 1);
+    samples.resize(mask_size);
+    for (uint32_t i = 0; i < mask_size; i++) {
+        const auto position = std::min(std::max(((static_cast<float32_t>(mask_start + i) + 0.5f) * scale) - 0.5f, 0.0f),
+            last_position);
+        samples[i].first = static_cast<uint32_t>(position);
+        samples[i].second = std::min(samples[i].first + 1, proto_size - 1);
+        samples[i].second_weight = position - static_cast<float32_t>(samples[i].first);
+    }
+}
+
+void Yolov5SegPostProcess::mult_mask_vector_and_proto_matrix(const DetectionBbox &detection, uint32_t region_x,
+    uint32_t region_y, uint32_t region_width, uint32_t region_height)
 {
-    static auto shape = get_proto_layer_shape();
-    static uint32_t proto_mat_cols = shape.height * shape.width;
+    const auto &shape = get_proto_layer_shape();
+    const auto proto_mat_cols = shape.height * shape.width;
 
     Eigen::Map<Eigen::Matrix<float, MASK_COEFFICIENT_SIZE, Eigen::Dynamic, Eigen::RowMajor>> proto_layer(
         (float32_t*)m_transformed_proto_buffer.data(), MASK_COEFFICIENT_SIZE, proto_mat_cols);
-
     Eigen_Vector32f coefficients(detection.m_coefficients.data());
-    auto mult_result = (coefficients.transpose() * proto_layer);
 
-    Eigen::Map<Eigen::Matrix<float, VECTOR_DIM, Eigen::Dynamic, Eigen::RowMajor>> result(
-        (float32_t*)m_mask_mult_result_buffer.data(), VECTOR_DIM, proto_mat_cols);
-    result = 1.0f / (1.0f + (-1*mult_result).array().exp());
+    // Each row of the region is contiguous in the proto layer, so it is multiplied as a block (vectorized by Eigen)
+    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> result(
+        (float32_t*)m_mask_mult_result_buffer.data(), region_height, region_width);
+    for (uint32_t row = 0; row < region_height; row++) {
+        result.row(row).noalias() = coefficients.transpose() *
+            proto_layer.block(0, ((region_y + row) * shape.width) + region_x, MASK_COEFFICIENT_SIZE, region_width);
+    }
+    result = 1.0f / (1.0f + (-1*result).array().exp());
 }
 
 hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
 {
     auto &yolov5_config = m_metadata->yolov5_config();
     auto mask_threshold = m_metadata->yolov5seg_config().mask_threshold;
-
-    // Based on Bilinear interpolation algorithm
-    // TODO: HRT-11734 - Improve performance by resizing only the mask part if possible
-    auto proto_layer_shape = get_proto_layer_shape();
-    float32_t* resized_mask_to_image_dim_ptr = (float32_t*)m_resized_mask_to_image_dim.data();
-    stbir_resize_float_generic((float32_t*)m_mask_mult_result_buffer.data(), proto_layer_shape.width,
-        proto_layer_shape.height, 0, resized_mask_to_image_dim_ptr, static_cast<uint32_t>(yolov5_config.image_width),
-        static_cast<uint32_t>(yolov5_config.image_height), 0, 1, STBIR_ALPHA_CHANNEL_NONE, 0,
-        STBIR_EDGE_CLAMP, STBIR_FILTER_TRIANGLE, STBIR_COLORSPACE_LINEAR, NULL);
+    const auto &proto_layer_shape = get_proto_layer_shape();
+    const auto image_width = static_cast<uint32_t>(yolov5_config.image_width);
+    const auto image_height = static_cast<uint32_t>(yolov5_config.image_height);
 
     auto x_min = static_cast<uint32_t>(MAX(std::ceil(detection.m_bbox.x_min * yolov5_config.image_width), 0.0f));
-    auto x_max = static_cast<uint32_t>(MIN(std::ceil(detection.m_bbox.x_max * yolov5_config.image_width), yolov5_config.image_width));
     auto y_min = static_cast<uint32_t>(MAX(std::ceil(detection.m_bbox.y_min * yolov5_config.image_height), 0.0f));
-    auto y_max = static_cast<uint32_t>(MIN(std::ceil(detection.m_bbox.y_max * yolov5_config.image_height), yolov5_config.image_height));
     auto box_width = detection.get_bbox_width(yolov5_config.image_width);
+    auto box_height = detection.get_bbox_height(yolov5_config.image_height);
 
+    // The mask pixels outside of the image are 0
     uint8_t *dst_mask = (uint8_t*)(buffer.data() + buffer_offset);
-    for (uint32_t i = y_min; i <= y_max; i++) {
-        for (uint32_t j = x_min; j <= x_max; j++) {
-            auto image_mask_idx = (i * static_cast<uint32_t>(yolov5_config.image_width)) + j;
-            auto cropped_mask_idx = ((i-y_min) * box_width) + (j-x_min);
-
-            if (resized_mask_to_image_dim_ptr[image_mask_idx] > mask_threshold) {
-                dst_mask[cropped_mask_idx] = 1;
-            } else {
-                dst_mask[cropped_mask_idx] = 0;
-            }
+    memset(dst_mask, 0, static_cast<size_t>(box_width) * box_height);
+    const auto mask_width = std::min(box_width, image_width - std::min(x_min, image_width));
+    const auto mask_height = std::min(box_height, image_height - std::min(y_min, image_height));
+    if ((0 == mask_width) || (0 == mask_height)) {
+        return HAILO_SUCCESS;
+    }
+
+    // Instead of resizing the whole proto layer to the image (based on Bilinear interpolation algorithm), only the
+    // proto pixels under the bbox are computed, and sampled directly into the byte mask
+    fill_proto_samples(x_min, mask_width, yolov5_config.image_width, proto_layer_shape.width, m_mask_columns_samples);
+    fill_proto_samples(y_min, mask_height, yolov5_config.image_height, proto_layer_shape.height, m_mask_rows_samples);
+    const auto region_x = m_mask_columns_samples.front().first;
+    const auto region_y = m_mask_rows_samples.front().first;
+    const auto region_width = m_mask_columns_samples.back().second - region_x + 1;
+    const auto region_height = m_mask_rows_samples.back().second - region_y + 1;
+    mult_mask_vector_and_proto_matrix(detection, region_x, region_y, region_width, region_height);
+
+    const auto *region = (const float32_t*)m_mask_mult_result_buffer.data();
+    for (uint32_t i = 0; i < mask_height; i++) {
+        const auto &row_sample = m_mask_rows_samples[i];
+        const auto *first_row = region + ((row_sample.first - region_y) * region_width);
+        const auto *second_row = region + ((row_sample.second - region_y) * region_width);
+        auto *dst_row = dst_mask + (i * box_width);
+        for (uint32_t j = 0; j < mask_width; j++) {
+            const auto &column_sample = m_mask_columns_samples[j];
+            const auto first_column = column_sample.first - region_x;
+            const auto second_column = column_sample.second - region_x;
+            const auto top = first_row[first_column] +
+                ((first_row[second_column] - first_row[first_column]) * column_sample.second_weight);
+            const auto bottom = second_row[first_column] +
+                ((second_row[second_column] - second_row[first_column]) * column_sample.second_weight);
+            const auto value = top + ((bottom - top) * row_sample.second_weight);
+            dst_row[j] = (value > mask_threshold) ? 1 : 0;
         }
     }
 
@@ -242,7 +278,6 @@ hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detec
 
 hailo_status Yolov5SegPostProcess::calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
 {
-    mult_mask_vector_and_proto_matrix(detection);
     auto status = crop_and_copy_mask(detection, buffer, buffer_offset);
     CHECK_SUCCESS(status);
 
@@ -73,11 +73,24 @@ public:
     }
 
 private:
+    // Bilinear sample of a mask pixel on one axis of the proto layer - interpolated between the proto pixels first and
+    // second, with a weight of second_weight for second
+    struct ProtoSample {
+        uint32_t first;
+        uint32_t second;
+        float32_t second_weight;
+    };
+
     Yolov5SegPostProcess(std::shared_ptr<Yolov5SegOpMetadata> metadata, Buffer &&mask_mult_result_buffer,
-        Buffer &&resized_mask, Buffer &&transformed_proto_buffer);
+        Buffer &&transformed_proto_buffer);
 
     hailo_status fill_nms_with_byte_mask_format(MemoryView &buffer);
-    void mult_mask_vector_and_proto_matrix(const DetectionBbox &detection);
+    static void fill_proto_samples(uint32_t mask_start, uint32_t mask_size, float32_t image_size, uint32_t proto_size,
+        std::vector<ProtoSample> &samples);
+    // Multiplies the mask coefficients only by the region of the proto layer the mask is sampled from (of region_width
+    // columns and region_height rows from region_x, region_y), and applies sigmoid on the result
+    void mult_mask_vector_and_proto_matrix(const DetectionBbox &detection, uint32_t region_x, uint32_t region_y,
+        uint32_t region_width, uint32_t region_height);
 
     hailo_status calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
     hailo_status crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
@@ -87,7 +100,8 @@ private:
 
     std::shared_ptr<Yolov5SegOpMetadata> m_metadata;
     Buffer m_mask_mult_result_buffer;
-    Buffer m_resized_mask_to_image_dim;
+    std::vector<ProtoSample> m_mask_columns_samples;
+    std::vector<ProtoSample> m_mask_rows_samples;
 
     Buffer m_transformed_proto_buffer;
 };
@@ -59,6 +59,8 @@ private:
 
         SrcType *reg_data = (SrcType*)reg_buffer.data();
         SrcType *cls_data = (SrcType*)cls_buffer.data();
+        const QuantizedValueDecoder<DstType, SrcType> reg_decoder(reg_quant_info, false);
+        const QuantizedValueDecoder<DstType, SrcType> cls_decoder(cls_quant_info, false);
 
         for (uint32_t row = 0; row < cls_shape.height; row++) {
             for (uint32_t col = 0; col < cls_shape.width; col++) {
@@ -66,7 +68,7 @@ private:
 
                 assert(contains(m_d_matrix, layers_names.reg));
                 auto &d_matrix = m_d_matrix.at(layers_names.reg);
-                auto bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_quant_info,
+                auto bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_decoder,
                                                         (SrcType*)reg_data, d_matrix); // we don't pass confidence here
                 memcpy(&dst_ptr[next_bbox_output_offset], &bbox, sizeof(hailo_rectangle_t)); // copy y_min, x_min, y_max, x_max
                 next_bbox_output_offset += sizeof(hailo_rectangle_t) / sizeof(float32_t);
@@ -74,8 +76,7 @@ private:
                 // copy class confidence for each of the classes
                 for (uint32_t curr_class_idx = 0; curr_class_idx < nms_config.number_of_classes; curr_class_idx++) {
                     auto class_entry_idx = cls_idx + (curr_class_idx * cls_padded_shape.width);
-                    auto class_confidence = Quantization::dequantize_output<DstType, SrcType>(
-                        cls_data[class_entry_idx], cls_quant_info);
+                    auto class_confidence = cls_decoder(cls_data[class_entry_idx]);
                     dst_ptr[next_bbox_output_offset++] = class_confidence;
                 }
             }
@@ -97,25 +97,25 @@ hailo_status YOLOV8PostProcessOp::execute(const std::map<std::string, MemoryView
     const auto &inputs_metadata = m_metadata->inputs_metadata();
 
     clear_before_frame();
-    for (const auto &reg_to_cls_name : yolov8_config.reg_to_cls_inputs) {
-        hailo_status status = HAILO_UNINITIALIZED;
-        assert(contains(inputs, reg_to_cls_name.cls));
-        assert(contains(inputs, reg_to_cls_name.reg));
-
-        auto &input_metadata = inputs_metadata.at(reg_to_cls_name.reg);
-
-        if (HAILO_FORMAT_TYPE_UINT8 == input_metadata.format.type) {
-            status = extract_detections<float32_t, uint8_t>(reg_to_cls_name, inputs.at(reg_to_cls_name.reg),
-                inputs.at(reg_to_cls_name.cls), reg_to_cls_name.stride);
-        } else if (HAILO_FORMAT_TYPE_UINT16 == input_metadata.format.type) {
-            status = extract_detections<float32_t, uint16_t>(reg_to_cls_name, inputs.at(reg_to_cls_name.reg),
-                inputs.at(reg_to_cls_name.cls), reg_to_cls_name.stride);
-        } else {
-            CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "YOLO post-process received invalid input type {}", input_metadata.format.type);
-        }
-
-        CHECK_SUCCESS(status);
-    }
+    auto status = extract_branches_detections(yolov8_config.reg_to_cls_inputs.size(),
+        [&](size_t branch_index, std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count) {
+            const auto &reg_to_cls_name = yolov8_config.reg_to_cls_inputs[branch_index];
+            assert(contains(inputs, reg_to_cls_name.cls));
+            assert(contains(inputs, reg_to_cls_name.reg));
+
+            auto &input_metadata = inputs_metadata.at(reg_to_cls_name.reg);
+
+            if (HAILO_FORMAT_TYPE_UINT8 == input_metadata.format.type) {
+                return extract_detections<float32_t, uint8_t>(reg_to_cls_name, inputs.at(reg_to_cls_name.reg),
+                    inputs.at(reg_to_cls_name.cls), reg_to_cls_name.stride, detections, classes_detections_count);
+            } else if (HAILO_FORMAT_TYPE_UINT16 == input_metadata.format.type) {
+                return extract_detections<float32_t, uint16_t>(reg_to_cls_name, inputs.at(reg_to_cls_name.reg),
+                    inputs.at(reg_to_cls_name.cls), reg_to_cls_name.stride, detections, classes_detections_count);
+            }
+            LOGGER__ERROR("YOLO post-process received invalid input type {}", input_metadata.format.type);
+            return HAILO_INVALID_ARGUMENT;
+        });
+    CHECK_SUCCESS(status);
     return hailo_nms_format(outputs.begin()->second);
 }
 
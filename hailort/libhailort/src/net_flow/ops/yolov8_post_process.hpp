@@ -33,7 +33,7 @@ protected:
     std::unordered_map<std::string, std::vector<std::vector<float32_t>>> m_d_matrix; // Holds the values from which we compute those distances
     YOLOV8PostProcessOp(std::shared_ptr<Yolov8OpMetadata> metadata)
         : NmsPostProcessOp(static_cast<std::shared_ptr<NmsOpMetadata>>(metadata))
-        , m_metadata(metadata), m_d_values_matrix(NUM_OF_D_VALUES)
+        , m_metadata(metadata)
     {
         for (const auto &input_metadata : m_metadata->inputs_metadata()) {
             m_d_matrix[input_metadata.first] = std::vector<std::vector<float32_t>>(NUM_OF_D_VALUES,
@@ -43,7 +43,7 @@ protected:
 
     template<typename DstType = float32_t, typename SrcType>
     hailo_bbox_float32_t get_bbox(uint32_t row, uint32_t col, uint32_t stride, const hailo_3d_image_shape_t &reg_padded_shape,
-        const hailo_3d_image_shape_t &reg_shape, const hailo_quant_info_t &reg_quant_info, SrcType *reg_data,
+        const hailo_3d_image_shape_t &reg_shape, const QuantizedValueDecoder<DstType, SrcType> &reg_decoder, SrcType *reg_data,
         std::vector<std::vector<DstType>> &d_matrix, DstType class_confidence = 0)
     {
         auto reg_row_size = reg_padded_shape.width * reg_padded_shape.features; // should be the padded values - we use it to get to the relevant row
@@ -54,7 +54,7 @@ protected:
         // For example - reshape from 64 to 4X16 - 4 vectors of 16 values
         for (uint32_t feature = 0; feature < reg_shape.features; feature++) {
             auto &tmp_vector = d_matrix.at(feature / (reg_shape.features / NUM_OF_D_VALUES));
-            tmp_vector[feature % (reg_shape.features / NUM_OF_D_VALUES)] = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + feature*reg_feature_size], reg_quant_info);
+            tmp_vector[feature % (reg_shape.features / NUM_OF_D_VALUES)] = reg_decoder(reg_data[reg_idx + feature*reg_feature_size]);
         }
 
         // Performing softmax operation on each of the vectors
@@ -65,15 +65,17 @@ protected:
 
         // Performing dot product on each vector
         // (A, B, C, ..., F, G) -> 0*A + 1*B + 2*C + ... + 14*F + 15*G
+        // Holds the values of the bbox boundaries distances from the stride's center
+        std::array<float32_t, NUM_OF_D_VALUES> d_values;
         for (uint32_t vector_index = 0; vector_index < NUM_OF_D_VALUES; vector_index++) {
-            m_d_values_matrix[vector_index] = dot_product(d_matrix.at(vector_index));
+            d_values[vector_index] = dot_product(d_matrix.at(vector_index));
         }
 
         // The decode function extract x_min, y_min, x_max, y_max from d1, d2, d3, d4
-        const auto &d1 = m_d_values_matrix.at(0);
-        const auto &d2 = m_d_values_matrix.at(1);
-        const auto &d3 = m_d_values_matrix.at(2);
-        const auto &d4 = m_d_values_matrix.at(3);
+        const auto &d1 = d_values[0];
+        const auto &d2 = d_values[1];
+        const auto &d3 = d_values[2];
+        const auto &d4 = d_values[3];
         auto bbox = decode(d1, d2, d3, d4, col, row, stride);
         bbox.score = class_confidence;
         return bbox;
@@ -103,15 +105,13 @@ protected:
     }
 
 private:
-    std::vector<float32_t> m_d_values_matrix;  // Holds the values of the bbox boundaries distances from the stride's center
-
     static const uint32_t CLASSES_START_INDEX = 0;
     static const uint32_t NO_OBJECTNESS = 1;
     static const uint32_t NUM_OF_D_VALUES = 4;
 
     template<typename DstType = float32_t, typename SrcType>
     hailo_status extract_detections(const Yolov8MatchingLayersNames &layers_names, const MemoryView &reg_buffer, const MemoryView &cls_buffer,
-        uint32_t stride)
+        uint32_t stride, std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count)
     {
         const auto &inputs_metadata = m_metadata->inputs_metadata();
         const auto &nms_config = m_metadata->nms_config();
@@ -133,39 +133,59 @@ private:
 
         SrcType *reg_data = (SrcType*)reg_buffer.data();
         SrcType *cls_data = (SrcType*)cls_buffer.data();
+        const QuantizedValueDecoder<DstType, SrcType> reg_decoder(reg_quant_info, false);
+        const QuantizedValueDecoder<DstType, SrcType> cls_decoder(cls_quant_info, should_sigmoid());
+
+        // Most of the entries are background - filter them by their max class score, before decoding any of their values.
+        // A non-positive threshold passes any score, so the filter is used only for a positive one.
+        const bool should_filter_by_max_score = (nms_config.nms_score_th > 0) && cls_decoder.is_monotonic();
+        std::vector<SrcType> max_scores(should_filter_by_max_score ? cls_shape.width : 0);
 
         for (uint32_t row = 0; row < cls_shape.height; row++) {
+            if (should_filter_by_max_score) {
+                get_max_quantized_scores(cls_data + (cls_row_size * row) + (CLASSES_START_INDEX * cls_padded_shape.width),
+                    nms_config.number_of_classes, cls_shape.width, cls_padded_shape.width, max_scores.data());
+            }
             for (uint32_t col = 0; col < cls_shape.width; col++) {
+                if (should_filter_by_max_score && (cls_decoder(max_scores[col]) < nms_config.nms_score_th)) {
+                    continue;
+                }
+
                 auto cls_idx = (cls_row_size * row) + col;
 
                 if (nms_config.cross_classes) {
                     // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
                     auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_idx, CLASSES_START_INDEX,
-                        NO_OBJECTNESS, cls_quant_info, cls_padded_shape.width);
+                        NO_OBJECTNESS, cls_decoder, cls_padded_shape.width);
                     if (max_id_score_pair.second >= nms_config.nms_score_th) {
                         // If passes threshold - get the relevant bbox and add this detection
                         assert(contains(m_d_matrix, layers_names.reg));
                         auto &d_matrix = m_d_matrix.at(layers_names.reg);
-                        auto bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_quant_info,
+                        auto bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_decoder,
                                                                 (SrcType*)reg_data, d_matrix, max_id_score_pair.second);
-                        m_detections.emplace_back(DetectionBbox(bbox, max_id_score_pair.first));
-                        m_classes_detections_count[max_id_score_pair.first]++;
+                        detections.emplace_back(DetectionBbox(bbox, max_id_score_pair.first));
+                        classes_detections_count[max_id_score_pair.first]++;
                     }
                 }
                 else {
                     // No optimization - it's possible that a specific bbox will hold more then 1 class
+                    bool is_bbox_decoded = false;
+                    hailo_bbox_float32_t bbox{};
                     for (uint32_t curr_class_idx = 0; curr_class_idx < nms_config.number_of_classes; curr_class_idx++) {
                         auto class_entry_idx = cls_idx + (curr_class_idx * cls_padded_shape.width);
-                        auto class_confidence = Quantization::dequantize_output<DstType, SrcType>(
-                            cls_data[class_entry_idx], cls_quant_info);
+                        auto class_confidence = cls_decoder(cls_data[class_entry_idx]);
                         if (class_confidence >= nms_config.nms_score_th) {
-                            // If passes threshold - get the relevant bbox and add this detection
-                            assert(contains(m_d_matrix, layers_names.reg));
-                            auto &d_matrix = m_d_matrix.at(layers_names.reg);
-                            auto bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_quant_info,
-                                                                    (SrcType*)reg_data, d_matrix, class_confidence);
-                            m_detections.emplace_back(DetectionBbox(bbox, curr_class_idx));
-                            m_classes_detections_count[curr_class_idx]++;
+                            // If passes threshold - get the relevant bbox (once for all the entry's classes) and add this detection
+                            if (!is_bbox_decoded) {
+                                assert(contains(m_d_matrix, layers_names.reg));
+                                auto &d_matrix = m_d_matrix.at(layers_names.reg);
+                                bbox = get_bbox<DstType, SrcType>(row, col, stride, reg_padded_shape, reg_shape, reg_decoder,
+                                                                    (SrcType*)reg_data, d_matrix);
+                                is_bbox_decoded = true;
+                            }
+                            bbox.score = class_confidence;
+                            detections.emplace_back(DetectionBbox(bbox, curr_class_idx));
+                            classes_detections_count[curr_class_idx]++;
                         }
                     }
                 }
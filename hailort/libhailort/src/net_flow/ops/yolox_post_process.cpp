@@ -107,25 +107,25 @@ hailo_status YOLOXPostProcessOp::execute(const std::map<std::string, MemoryView>
     const auto &inputs_metadata = m_metadata->inputs_metadata();
     
     clear_before_frame();
-    for (const auto &layers_names_triplet : yolox_config.input_names) {
-        hailo_status status = HAILO_UNINITIALIZED;
-        assert(contains(inputs, layers_names_triplet.cls));
-        assert(contains(inputs, layers_names_triplet.obj));
-        assert(contains(inputs, layers_names_triplet.reg));
-
-        auto &input_metadata = inputs_metadata.at(layers_names_triplet.reg);
-        if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
-            status = extract_detections<float32_t, uint8_t>(layers_names_triplet, inputs.at(layers_names_triplet.reg), inputs.at(layers_names_triplet.cls),
-                inputs.at(layers_names_triplet.obj));
-        } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
-            status = extract_detections<float32_t, uint16_t>(layers_names_triplet, inputs.at(layers_names_triplet.reg), inputs.at(layers_names_triplet.cls),
-                inputs.at(layers_names_triplet.obj));
-        } else {
-            CHECK_SUCCESS(HAILO_INVALID_ARGUMENT, "YOLO post-process received invalid input type {}", input_metadata.format.type);
-        }
-
-        CHECK_SUCCESS(status);
-    }
+    auto status = extract_branches_detections(yolox_config.input_names.size(),
+        [&](size_t branch_index, std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count) {
+            const auto &layers_names_triplet = yolox_config.input_names[branch_index];
+            assert(contains(inputs, layers_names_triplet.cls));
+            assert(contains(inputs, layers_names_triplet.obj));
+            assert(contains(inputs, layers_names_triplet.reg));
+
+            auto &input_metadata = inputs_metadata.at(layers_names_triplet.reg);
+            if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
+                return extract_detections<float32_t, uint8_t>(layers_names_triplet, inputs.at(layers_names_triplet.reg),
+                    inputs.at(layers_names_triplet.cls), inputs.at(layers_names_triplet.obj), detections, classes_detections_count);
+            } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
+                return extract_detections<float32_t, uint16_t>(layers_names_triplet, inputs.at(layers_names_triplet.reg),
+                    inputs.at(layers_names_triplet.cls), inputs.at(layers_names_triplet.obj), detections, classes_detections_count);
+            }
+            LOGGER__ERROR("YOLO post-process received invalid input type {}", input_metadata.format.type);
+            return HAILO_INVALID_ARGUMENT;
+        });
+    CHECK_SUCCESS(status);
 
     return hailo_nms_format(outputs.begin()->second);
 }
@@ -36,7 +36,7 @@ private:
 
     template<typename DstType = float32_t, typename SrcType>
     hailo_status extract_detections(const YoloxMatchingLayersNames &layers_names, const MemoryView &reg_buffer, const MemoryView &cls_buffer,
-        const MemoryView &obj_buffer)
+        const MemoryView &obj_buffer, std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count)
     {
         const auto &inputs_metadata = m_metadata->inputs_metadata();
         const auto &nms_config = m_metadata->nms_config();
@@ -92,16 +92,29 @@ private:
         SrcType *reg_data = (SrcType*)reg_buffer.data();
         SrcType *obj_data = (SrcType*)obj_buffer.data();
         SrcType *cls_data = (SrcType*)cls_buffer.data();
+        const QuantizedValueDecoder<DstType, SrcType> obj_decoder(obj_quant_info, should_sigmoid());
+        const QuantizedValueDecoder<DstType, SrcType> cls_decoder(cls_quant_info, should_sigmoid());
 
+        // Most of the entries are background - filter them by their max class score, before decoding their boxes.
+        // A non-positive threshold passes any score, so the filter is used only for a positive one.
+        const bool should_filter_by_max_score = (nms_config.nms_score_th > 0) && cls_decoder.is_monotonic();
+        std::vector<SrcType> max_scores(should_filter_by_max_score ? reg_shape.width : 0);
 
         for (uint32_t row = 0; row < reg_shape.height; row++) {
+            if (should_filter_by_max_score) {
+                get_max_quantized_scores(cls_data + (cls_row_size * row) + (CLASSES_START_INDEX * cls_padded_shape.width),
+                    nms_config.number_of_classes, reg_shape.width, cls_padded_shape.width, max_scores.data());
+            }
             for (uint32_t col = 0; col < reg_shape.width; col++) {
                 auto obj_idx = (obj_row_size * row) + col;
-                auto objectness = Quantization::dequantize_output<DstType, SrcType>(obj_data[obj_idx], obj_quant_info);
+                auto objectness = obj_decoder(obj_data[obj_idx]);
 
                 if (objectness < nms_config.nms_score_th) {
                     continue;
                 }
+                if (should_filter_by_max_score && ((cls_decoder(max_scores[col]) * objectness) < nms_config.nms_score_th)) {
+                    continue;
+                }
 
                 auto reg_idx = (reg_row_size * row) + col;
                 auto cls_idx = (cls_row_size * row) + col;
@@ -114,23 +127,22 @@ private:
 
                 if (nms_config.cross_classes) {
                     // Pre-NMS optimization. If NMS checks IoU over different classes, only the maximum class is relevant
-                    auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_idx, CLASSES_START_INDEX, objectness, cls_quant_info, cls_padded_shape.width);
+                    auto max_id_score_pair = get_max_class<DstType, SrcType>(cls_data, cls_idx, CLASSES_START_INDEX, objectness, cls_decoder, cls_padded_shape.width);
                     bbox.score = max_id_score_pair.second;
                     if (max_id_score_pair.second >= nms_config.nms_score_th) {
-                        m_detections.emplace_back(DetectionBbox(bbox, max_id_score_pair.first));
-                        m_classes_detections_count[max_id_score_pair.first]++;
+                        detections.emplace_back(DetectionBbox(bbox, max_id_score_pair.first));
+                        classes_detections_count[max_id_score_pair.first]++;
                     }
                 }
                 else {
                     for (uint32_t curr_class_idx = 0; curr_class_idx < nms_config.number_of_classes; curr_class_idx++) {
                         auto class_entry_idx = cls_idx + (curr_class_idx * cls_padded_shape.width);
-                        auto class_confidence = Quantization::dequantize_output<DstType, SrcType>(
-                            cls_data[class_entry_idx], cls_quant_info);
+                        auto class_confidence = cls_decoder(cls_data[class_entry_idx]);
                         auto class_score = class_confidence * objectness;
                         if (class_score >= nms_config.nms_score_th) {
                             bbox.score = class_score;
-                            m_detections.emplace_back(DetectionBbox(bbox, curr_class_idx));
-                            m_classes_detections_count[curr_class_idx]++;
+                            detections.emplace_back(DetectionBbox(bbox, curr_class_idx));
+                            classes_detections_count[curr_class_idx]++;
                         }
                     }
                 }
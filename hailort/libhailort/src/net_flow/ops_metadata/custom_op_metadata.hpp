@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file custom_op_metadata.hpp
+ * @brief: Metadata of a custom post-process op, implemented by the user
+ *
+ **/
+
+#ifndef _HAILO_CUSTOM_OP_METADATA_HPP_
+#define _HAILO_CUSTOM_OP_METADATA_HPP_
+
+#include "hailo/custom_post_process_op.hpp"
+#include "net_flow/ops_metadata/op_metadata.hpp"
+
+#include <memory>
+
+namespace hailort
+{
+namespace net_flow
+{
+
+constexpr std::size_t CUSTOM_NUMBER_OF_DSTS {1};
+
+class CustomOpMetadata : public OpMetadata
+{
+public:
+    static Expected<std::shared_ptr<OpMetadata>> create(const std::unordered_map<std::string, BufferMetaData> &inputs_metadata,
+                                                        const std::unordered_map<std::string, BufferMetaData> &outputs_metadata,
+                                                        const std::string &network_name,
+                                                        std::shared_ptr<CustomPostProcessOp> custom_op);
+    std::string get_op_description() override;
+    hailo_status validate_format_info() override;
+
+    virtual Expected<hailo_vstream_info_t> get_output_vstream_info() override;
+
+    std::shared_ptr<CustomPostProcessOp> custom_op() { return m_custom_op; }
+
+private:
+    CustomOpMetadata(const std::unordered_map<std::string, BufferMetaData> &inputs_metadata,
+                     const std::unordered_map<std::string, BufferMetaData> &outputs_metadata,
+                     const std::string &name, const std::string &network_name,
+                     std::shared_ptr<CustomPostProcessOp> custom_op)
+        : OpMetadata(inputs_metadata, outputs_metadata, name, network_name, OperationType::CUSTOM),
+          m_custom_op(custom_op)
+    {}
+
+    hailo_status validate_params() override;
+
+    std::shared_ptr<CustomPostProcessOp> m_custom_op;
+};
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_CUSTOM_OP_METADATA_HPP_ */
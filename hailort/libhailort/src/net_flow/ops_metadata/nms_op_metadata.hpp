@@ -46,6 +46,13 @@ struct NmsPostProcessConfig
 
     // Indicates whether only the bbox decoding is being done
     bool bbox_only = false;
+
+    // Maximum amount of bboxes of all of the classes together, used only by the HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE
+    // output. 0 means (number_of_classes * max_proposals_per_class).
+    uint32_t max_proposals_total = 0;
+
+    // The classes whose detections are outputted (by their index in the output). Empty means all of the classes.
+    std::vector<uint32_t> classes_filter;
 };
 
 static const float32_t REMOVED_CLASS_SCORE = 0.0f;
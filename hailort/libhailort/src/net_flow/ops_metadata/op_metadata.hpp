@@ -35,7 +35,8 @@ enum class OperationType {
     SSD,
     SOFTMAX,
     ARGMAX,
-    IOU
+    IOU,
+    CUSTOM
 };
 
 class OpMetadata
@@ -89,6 +90,8 @@ public:
             return "ARGMAX";
         case OperationType::IOU:
             return "IOU";
+        case OperationType::CUSTOM:
+            return "CUSTOM";
         default:
             return "Nan";
         }
@@ -8,6 +8,7 @@
  **/
 
 #include <iostream>
+#include <limits>
 
 #include "common/utils.hpp"
 #include "common/os_utils.hpp"
@@ -150,13 +151,15 @@ bool AsyncPipeline::is_multi_planar()
 
 Expected<std::shared_ptr<AsyncInferRunnerImpl>> AsyncInferRunnerImpl::create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout)
+    const uint32_t timeout, std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor,
+    hailo_pipeline_elem_stats_flags_t elem_stats_flags, const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params,
+    size_t max_buffer_pool_size)
 {
     auto pipeline_status = make_shared_nothrow<std::atomic<hailo_status>>(HAILO_SUCCESS);
     CHECK_AS_EXPECTED(nullptr != pipeline_status, HAILO_OUT_OF_HOST_MEMORY);
 
-    TRY(auto async_pipeline,
-        AsyncPipelineBuilder::create_pipeline(net_group, inputs_formats, outputs_formats, timeout, pipeline_status));
+    TRY(auto async_pipeline, AsyncPipelineBuilder::create_pipeline(net_group, inputs_formats, outputs_formats, timeout,
+        pipeline_status, async_pipeline_executor, elem_stats_flags, inputs_resize_params, max_buffer_pool_size));
 
     auto async_infer_runner_ptr = make_shared_nothrow<AsyncInferRunnerImpl>(std::move(async_pipeline), pipeline_status);
     CHECK_NOT_NULL_AS_EXPECTED(async_infer_runner_ptr, HAILO_OUT_OF_HOST_MEMORY);
@@ -164,6 +167,11 @@ Expected<std::shared_ptr<AsyncInferRunnerImpl>> AsyncInferRunnerImpl::create(std
     auto status = async_infer_runner_ptr->start_pipeline();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
+    // The elements' stats are collected only when the frames go through them
+    if ((HAILO_PIPELINE_ELEM_STATS_NONE == elem_stats_flags) && !is_env_variable_on(DISABLE_DIRECT_ASYNC_INFER_ENV_VAR)) {
+        async_infer_runner_ptr->resolve_direct_streams(net_group);
+    }
+
     return async_infer_runner_ptr;
 }
 
@@ -171,8 +179,28 @@ AsyncInferRunnerImpl::AsyncInferRunnerImpl(std::shared_ptr<AsyncPipeline> async_
     m_async_pipeline(async_pipeline),
     m_is_activated(false),
     m_is_aborted(false),
-    m_pipeline_status(pipeline_status)
-{}
+    m_pipeline_status(pipeline_status),
+    m_max_ongoing_frames_count(std::numeric_limits<size_t>::max()),
+    m_pushed_frames_count(0)
+{
+    for (const auto &element : m_async_pipeline->get_pipeline()) {
+        auto pool = element->get_buffer_pool();
+        if (nullptr != pool) {
+            m_max_ongoing_frames_count = std::min(m_max_ongoing_frames_count, pool->max_capacity());
+        }
+    }
+
+    for (const auto &entry_element : m_async_pipeline->get_entry_elements()) {
+        m_input_names.push_back(entry_element.first);
+        m_entry_elements.push_back(entry_element.second);
+    }
+    for (const auto &last_element : m_async_pipeline->get_last_elements()) {
+        m_output_names.push_back(last_element.first);
+        m_last_elements.push_back(last_element.second);
+    }
+    m_frame_inputs.resize(m_entry_elements.size());
+    m_frame_outputs.resize(m_last_elements.size());
+}
 
 AsyncInferRunnerImpl::~AsyncInferRunnerImpl()
 {
@@ -240,46 +268,295 @@ Expected<bool> AsyncInferRunnerImpl::can_push_buffers(uint32_t frames_count)
     return true;
 }
 
-hailo_status AsyncInferRunnerImpl::set_buffers(std::unordered_map<std::string, PipelineBuffer> &inputs,
-    std::unordered_map<std::string, PipelineBuffer> &outputs)
+size_t AsyncInferRunnerImpl::get_max_ongoing_frames_count() const
 {
-    for (auto &last_element : m_async_pipeline->get_last_elements()) {
+    return m_max_ongoing_frames_count;
+}
+
+bool AsyncInferRunnerImpl::are_outputs_written_by_hw() const
+{
+    auto async_hw_element = m_async_pipeline->get_async_hw_element();
+    const auto &last_elements = m_async_pipeline->get_last_elements();
+    if (async_hw_element->sources().size() != last_elements.size()) {
+        return false;
+    }
+
+    for (auto &source : async_hw_element->sources()) {
+        const auto &next_element = source.next()->element();
+        const bool is_last_element = std::any_of(last_elements.begin(), last_elements.end(),
+            [&next_element](const std::pair<const std::string, std::shared_ptr<PipelineElement>> &name_element_pair) {
+                return name_element_pair.second.get() == &next_element;
+            });
+        if (!is_last_element) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool AsyncInferRunnerImpl::is_direct() const
+{
+    return !m_direct_stream_names.empty();
+}
+
+void AsyncInferRunnerImpl::resolve_direct_streams(std::shared_ptr<ConfiguredNetworkGroup> net_group)
+{
+    if (!are_outputs_written_by_hw()) {
+        return;
+    }
+
+    auto async_hw_element = m_async_pipeline->get_async_hw_element();
+    std::unordered_map<std::string, std::string> stream_names;
+    std::unordered_map<std::string, DirectPlanesStreams> planes_streams;
+    for (auto &entry_element : m_async_pipeline->get_entry_elements()) {
+        auto next_pad = entry_element.second->sources()[0].next();
+        if (nullptr == next_pad) {
+            return;
+        }
+        // No element between the entry element and the hw element - the input is sent to the HW as it is
+        if (&next_pad->element() == async_hw_element.get()) {
+            stream_names[entry_element.first] = async_hw_element->get_sink_name_to_stream_name().at(next_pad->name());
+            continue;
+        }
+
+        // A multi-planar input - the planes are split, and each plane is queued to the HW as it is
+        auto planes_splitter = dynamic_cast<PixBufferElement*>(&next_pad->element());
+        if (nullptr == planes_splitter) {
+            return;
+        }
+        DirectPlanesStreams input_planes_streams{planes_splitter->order(), {}};
+        for (auto &plane_source : planes_splitter->sources()) {
+            auto plane_pad = plane_source.next();
+            if ((nullptr == plane_pad) || (nullptr == dynamic_cast<AsyncPushQueueElement*>(&plane_pad->element()))) {
+                return;
+            }
+            auto hw_pad = plane_pad->element().sources()[0].next();
+            if ((nullptr == hw_pad) || (&hw_pad->element() != async_hw_element.get())) {
+                return;
+            }
+            input_planes_streams.stream_names.push_back(async_hw_element->get_sink_name_to_stream_name().at(hw_pad->name()));
+        }
+        planes_streams[entry_element.first] = std::move(input_planes_streams);
+    }
+
+    const auto &last_elements = m_async_pipeline->get_last_elements();
+    for (auto &source : async_hw_element->sources()) {
+        const auto &next_element = source.next()->element();
+        auto last_element = std::find_if(last_elements.begin(), last_elements.end(),
+            [&next_element](const std::pair<const std::string, std::shared_ptr<PipelineElement>> &name_element_pair) {
+                return name_element_pair.second.get() == &next_element;
+            });
+        assert(last_elements.end() != last_element);
+        stream_names[last_element->first] = async_hw_element->get_source_name_to_stream_name().at(source.name());
+    }
+
+    if ((stream_names.size() + planes_streams.size()) != (m_async_pipeline->get_entry_elements().size() + last_elements.size())) {
+        return;
+    }
+
+    LOGGER__INFO("No element runs on the frames on the host - they are sent to the streams directly");
+    m_direct_stream_names = std::move(stream_names);
+    m_direct_planes_streams = std::move(planes_streams);
+    m_direct_net_group = net_group;
+}
+
+hailo_status AsyncInferRunnerImpl::add_direct_buffer(NamedBuffersCallbacks &named_buffers_callbacks, const std::string &name,
+    const RegisteredBindingsBuffer &buffer, const TransferDoneCallbackAsyncInfer &transfer_done)
+{
+    if (contains(m_direct_planes_streams, name)) {
+        return add_direct_planes_buffers(named_buffers_callbacks, name, buffer, transfer_done);
+    }
+
+    BufferRepresentation buffer_representation{};
+    switch (buffer.type) {
+    case BufferType::VIEW:
+        buffer_representation.buffer_type = BufferType::VIEW;
+        buffer_representation.view = buffer.view;
+        break;
+    case BufferType::DMA_BUFFER:
+        buffer_representation.buffer_type = BufferType::DMA_BUFFER;
+        buffer_representation.dma_buffer = buffer.dma_buffer;
+        break;
+    case BufferType::PIX_BUFFER:
+    {
+        // The model isn't multi-planar (the pipeline would have split the planes), so the frame is the single plane
+        const auto &pix_buffer = buffer.pix_buffer;
+        CHECK(1 == pix_buffer.number_of_planes, HAILO_INVALID_OPERATION,
+            "HEF was compiled for single input layer, while trying to pass non-contiguous planes buffers.");
+        if (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == pix_buffer.memory_type) {
+            buffer_representation.buffer_type = BufferType::DMA_BUFFER;
+            buffer_representation.dma_buffer = DmaBufferUtils::get_plane_dma_buffer(pix_buffer, 0);
+            buffer_representation.dma_buffer_offset = pix_buffer.planes[0].offset;
+            buffer_representation.dma_buffer_transfer_size = pix_buffer.planes[0].plane_size;
+        } else if (HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type) {
+            buffer_representation.buffer_type = BufferType::VIEW;
+            buffer_representation.view = MemoryView(pix_buffer.planes[0].user_ptr, pix_buffer.planes[0].bytes_used);
+        } else {
+            LOGGER__ERROR("Buffer type Pix buffer supports only memory of types USERPTR or DMABUF.");
+            return HAILO_INVALID_OPERATION;
+        }
+        break;
+    }
+    default:
+        LOGGER__ERROR("Couldnt find buffer for '{}'", name);
+        return HAILO_NOT_FOUND;
+    }
+
+    named_buffers_callbacks.emplace(m_direct_stream_names.at(name), std::make_pair(buffer_representation, transfer_done));
+    return HAILO_SUCCESS;
+}
+
+// Calls the callback of a multi-planar input once the transfers of all of its planes are done
+class PlanesTransfersDone final
+{
+public:
+    PlanesTransfersDone(uint32_t planes_count, const TransferDoneCallbackAsyncInfer &transfer_done) :
+        m_remaining_planes(planes_count), m_status(HAILO_SUCCESS), m_transfer_done(transfer_done)
+    {}
+
+    void plane_done(hailo_status status)
+    {
+        if (HAILO_SUCCESS != status) {
+            m_status = status;
+        }
+        if (1 == m_remaining_planes.fetch_sub(1)) {
+            m_transfer_done(m_status.load());
+        }
+    }
+
+private:
+    std::atomic<uint32_t> m_remaining_planes;
+    std::atomic<hailo_status> m_status;
+    TransferDoneCallbackAsyncInfer m_transfer_done;
+};
+
+hailo_status AsyncInferRunnerImpl::add_direct_planes_buffers(NamedBuffersCallbacks &named_buffers_callbacks,
+    const std::string &name, const RegisteredBindingsBuffer &buffer, const TransferDoneCallbackAsyncInfer &transfer_done)
+{
+    const auto &planes_streams = m_direct_planes_streams.at(name);
+
+    // The planes are split as the pipeline splits them - a frame in a single buffer is split at the planes' offsets
+    hailo_pix_buffer_t pix_buffer{};
+    switch (buffer.type) {
+    case BufferType::VIEW:
+    {
+        TRY(pix_buffer, HailoRTCommon::as_hailo_pix_buffer(buffer.view, planes_streams.order));
+        break;
+    }
+    case BufferType::DMA_BUFFER:
+    {
+        TRY(pix_buffer, HailoRTCommon::as_hailo_pix_buffer(buffer.dma_buffer, planes_streams.order));
+        break;
+    }
+    case BufferType::PIX_BUFFER:
+        pix_buffer = buffer.pix_buffer;
+        break;
+    default:
+        LOGGER__ERROR("Couldnt find buffer for '{}'", name);
+        return HAILO_NOT_FOUND;
+    }
+    CHECK(pix_buffer.number_of_planes == planes_streams.stream_names.size(), HAILO_INVALID_ARGUMENT,
+        "number of planes in the pix buffer ({}) doesn't match the order ({})", pix_buffer.number_of_planes,
+        planes_streams.stream_names.size());
+
+    auto planes_done = make_shared_nothrow<PlanesTransfersDone>(pix_buffer.number_of_planes, transfer_done);
+    CHECK_NOT_NULL(planes_done, HAILO_OUT_OF_HOST_MEMORY);
+    for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
+        const auto &plane = pix_buffer.planes[i];
+        BufferRepresentation buffer_representation{};
+        if (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == pix_buffer.memory_type) {
+            buffer_representation.buffer_type = BufferType::DMA_BUFFER;
+            buffer_representation.dma_buffer = DmaBufferUtils::get_plane_dma_buffer(pix_buffer, i);
+            buffer_representation.dma_buffer_offset = plane.offset;
+            buffer_representation.dma_buffer_transfer_size = plane.plane_size;
+        } else if (HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type) {
+            buffer_representation.buffer_type = BufferType::VIEW;
+            buffer_representation.view = MemoryView(plane.user_ptr, plane.bytes_used);
+        } else {
+            LOGGER__ERROR("Buffer type Pix buffer supports only memory of types USERPTR or DMABUF.");
+            return HAILO_INVALID_OPERATION;
+        }
+
+        named_buffers_callbacks.emplace(planes_streams.stream_names[i], std::make_pair(buffer_representation,
+            [planes_done](hailo_status status) { planes_done->plane_done(status); }));
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferRunnerImpl::launch_direct(const NamedBuffersCallbacks &named_buffers_callbacks, InferRequestControlPtr control)
+{
+    auto net_group = m_direct_net_group.lock();
+    CHECK(nullptr != net_group, HAILO_INTERNAL_FAILURE, "The network group was released mid inference");
+
+    // The transfers' callbacks complete the frame, as the pipeline buffers' callbacks do
+    auto net_group_base = (nullptr != control) ? std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(net_group) : nullptr;
+    if (nullptr != net_group_base) {
+        return net_group_base->infer_async(named_buffers_callbacks, [](hailo_status){}, control);
+    }
+    return net_group->infer_async(named_buffers_callbacks, [](hailo_status){});
+}
+
+hailo_status AsyncInferRunnerImpl::lock_host_buffers()
+{
+    size_t locked_pools_count = 0;
+    for (const auto &element : m_async_pipeline->get_pipeline()) {
+        auto pool = element->get_buffer_pool();
+        // The pools of user buffers own no memory
+        if ((nullptr != pool) && !pool->is_holding_user_buffers()) {
+            CHECK_SUCCESS(pool->lock_buffers(), "Failed to lock the buffers of {}", element->name());
+            locked_pools_count++;
+        }
+    }
+    LOGGER__INFO("Locked the buffers of {} buffer pools", locked_pools_count);
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferRunnerImpl::set_buffers(std::vector<PipelineBuffer> &inputs, std::vector<PipelineBuffer> &outputs)
+{
+    assert((inputs.size() == m_entry_elements.size()) && (outputs.size() == m_last_elements.size()));
+    for (size_t i = 0; i < m_last_elements.size(); i++) {
         // TODO: handle the non-recoverable case where one buffer is enqueued successfully and the second isn't (HRT-11783)
-        auto status = last_element.second->enqueue_execution_buffer(std::move(outputs.at(last_element.first)));
+        auto status = m_last_elements[i]->enqueue_execution_buffer(std::move(outputs[i]));
         CHECK_SUCCESS(status);
     }
 
-    for (auto &entry_element : m_async_pipeline->get_entry_elements()) {
-        entry_element.second->sinks()[0].run_push_async(std::move(inputs.at(entry_element.first)));
+    m_pushed_frames_count++;
+    for (size_t i = 0; i < m_entry_elements.size(); i++) {
+        m_entry_elements[i]->sinks()[0].run_push_async(std::move(inputs[i]));
     }
 
     return HAILO_SUCCESS;
 }
 
-void AsyncInferRunnerImpl::set_pix_buffer_inputs(std::unordered_map<std::string, PipelineBuffer> &inputs, hailo_pix_buffer_t pix_buffer,
-    TransferDoneCallbackAsyncInfer input_done, const std::string &input_name)
+PipelineBuffer AsyncInferRunnerImpl::create_pix_buffer_input(hailo_pix_buffer_t pix_buffer, TransferDoneCallbackAsyncInfer input_done)
 {
     if (1 == pix_buffer.number_of_planes) {
         if (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == pix_buffer.memory_type) {
-            hailo_dma_buffer_t dma_buffer = {pix_buffer.planes[0].fd, pix_buffer.planes[0].plane_size};
-            inputs[input_name] = PipelineBuffer(dma_buffer, input_done);
+            auto dma_buffer = std::make_shared<DmaBufferPipelineData>(DmaBufferUtils::get_plane_dma_buffer(pix_buffer, 0),
+                pix_buffer.planes[0].offset, pix_buffer.planes[0].plane_size);
+            const bool is_user_buffer = true;
+            const bool should_measure = false;
+            return PipelineBuffer(std::move(dma_buffer), input_done, HAILO_SUCCESS, is_user_buffer, BufferPoolWeakPtr(),
+                should_measure);
         } else if (HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type) {
-            inputs[input_name] = PipelineBuffer(MemoryView(pix_buffer.planes[0].user_ptr, pix_buffer.planes[0].bytes_used), input_done);
+            return PipelineBuffer(MemoryView(pix_buffer.planes[0].user_ptr, pix_buffer.planes[0].bytes_used), input_done);
         } else {
             LOGGER__ERROR("Buffer type Pix buffer supports only memory of types USERPTR or DMABUF.");
-            inputs[input_name] = PipelineBuffer(HAILO_INVALID_OPERATION, input_done);
+            return PipelineBuffer(HAILO_INVALID_OPERATION, input_done);
         }
     } else if (m_async_pipeline->is_multi_planar()) {
         // If model is multi-planar
-        inputs[input_name] = PipelineBuffer(pix_buffer, input_done);
+        return PipelineBuffer(pix_buffer, input_done);
     } else {
         // Other cases - return error, as on async flow we do not support copy to new buffer
         LOGGER__ERROR("HEF was compiled for single input layer, while trying to pass non-contiguous planes buffers.");
-        inputs[input_name] = PipelineBuffer(HAILO_INVALID_OPERATION, input_done);
+        return PipelineBuffer(HAILO_INVALID_OPERATION, input_done);
     }
 }
 
-hailo_status AsyncInferRunnerImpl::run(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done)
+hailo_status AsyncInferRunnerImpl::run(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done,
+    InferRequestControlPtr control)
 {
     std::unique_lock<std::mutex> lock(m_mutex);
     hailo_status status = m_async_pipeline->get_pipeline_status()->load();
@@ -288,56 +565,255 @@ hailo_status AsyncInferRunnerImpl::run(ConfiguredInferModel::Bindings &bindings,
     TRY(auto are_pools_ready, can_push_buffers(1));
     CHECK(are_pools_ready, HAILO_QUEUE_IS_FULL, "Can't handle infer request since a queue in the pipeline is full.");
 
-    std::unordered_map<std::string, PipelineBuffer> outputs;
+    return push_bindings(bindings, transfer_done, control);
+}
 
-    for (auto &last_element : m_async_pipeline->get_last_elements()) {
-        auto buff_type = bindings.output(last_element.first)->m_pimpl->get_type();
+hailo_status AsyncInferRunnerImpl::run_frames(std::vector<ConfiguredInferModel::Bindings> &bindings,
+    std::vector<TransferDoneCallbackAsyncInfer> &transfers_done)
+{
+    assert(bindings.size() == transfers_done.size());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    hailo_status status = m_async_pipeline->get_pipeline_status()->load();
+    CHECK_SUCCESS(status, "Can't handle infer request since Pipeline status is {}.", status);
+
+    // The whole batch is checked at once, so either all of its frames are pushed or none of them is
+    TRY(auto are_pools_ready, can_push_buffers(static_cast<uint32_t>(bindings.size())));
+    CHECK(are_pools_ready, HAILO_QUEUE_IS_FULL, "Can't handle infer request of {} frames since a queue in the pipeline is full.",
+        bindings.size());
+
+    for (size_t i = 0; i < bindings.size(); i++) {
+        status = push_bindings(bindings[i], std::move(transfers_done[i]));
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferRunnerImpl::push_bindings(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done,
+    InferRequestControlPtr control)
+{
+    // Each buffer holds a copy of the callback - sharing it (instead of copying its captures) keeps the copies
+    // small enough to not be allocated.
+    auto shared_transfer_done = make_shared_nothrow<TransferDoneCallbackAsyncInfer>(std::move(transfer_done));
+    CHECK_NOT_NULL(shared_transfer_done, HAILO_OUT_OF_HOST_MEMORY);
+    transfer_done = [shared_transfer_done](hailo_status status) { (*shared_transfer_done)(status); };
+
+    if (is_direct()) {
+        NamedBuffersCallbacks named_buffers_callbacks;
+        for (const auto &input_name : m_input_names) {
+            TRY(auto stream, bindings.input(input_name));
+            TRY(const auto buffer, resolve_bindings_buffer(stream), "Couldnt find input buffer for '{}'", input_name);
+            CHECK_SUCCESS(add_direct_buffer(named_buffers_callbacks, input_name, buffer, transfer_done));
+        }
+        for (const auto &output_name : m_output_names) {
+            TRY(auto stream, bindings.output(output_name));
+            TRY(const auto buffer, resolve_bindings_buffer(stream), "Couldnt find output buffer for '{}'", output_name);
+            CHECK(BufferType::PIX_BUFFER != buffer.type, HAILO_NOT_SUPPORTED, "pix_buffer isn't supported for outputs in '{}'",
+                output_name);
+            CHECK_SUCCESS(add_direct_buffer(named_buffers_callbacks, output_name, buffer, transfer_done));
+        }
+        return launch_direct(named_buffers_callbacks, std::move(control));
+    }
+
+    auto status = fill_frame_buffers(bindings, transfer_done);
+    if (HAILO_SUCCESS != status) {
+        release_frame_buffers();
+        return status;
+    }
+
+    if (nullptr != control) {
+        auto async_hw_element = m_async_pipeline->get_async_hw_element();
+        assert(nullptr != async_hw_element);
+        async_hw_element->set_infer_request_control(m_pushed_frames_count, std::move(control));
+    }
+
+    status = set_buffers(m_frame_inputs, m_frame_outputs);
+    // TODO: (HRT-14283) If set_buffers fails after a buffer is enqueued, the buffer's CB will be called - and might call user's CB
+    release_frame_buffers();
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferRunnerImpl::fill_frame_buffers(ConfiguredInferModel::Bindings &bindings,
+    const TransferDoneCallbackAsyncInfer &transfer_done)
+{
+    for (size_t i = 0; i < m_output_names.size(); i++) {
+        const auto &output_name = m_output_names[i];
+        TRY(auto stream, bindings.output(output_name));
         bool is_user_buffer = true;
-        if (BufferType::DMA_BUFFER == buff_type) {
-            TRY(auto dma_buffer, bindings.output(last_element.first)->get_dma_buffer(), "Couldnt find output buffer for '{}'", last_element.first);
-            outputs[last_element.first] = PipelineBuffer(dma_buffer, transfer_done, HAILO_SUCCESS, is_user_buffer);
+        if (BufferType::DMA_BUFFER == stream.m_pimpl->get_type()) {
+            TRY(auto dma_buffer, stream.get_dma_buffer(), "Couldnt find output buffer for '{}'", output_name);
+            m_frame_outputs[i] = PipelineBuffer(dma_buffer, transfer_done, HAILO_SUCCESS, is_user_buffer);
         } else {
-            TRY(auto buffer, bindings.output(last_element.first)->get_buffer(), "Couldnt find output buffer for '{}'", last_element.first);
-            outputs[last_element.first] = PipelineBuffer(buffer, transfer_done, HAILO_SUCCESS, is_user_buffer);
+            TRY(auto buffer, stream.get_buffer(), "Couldnt find output buffer for '{}'", output_name);
+            m_frame_outputs[i] = PipelineBuffer(buffer, transfer_done, HAILO_SUCCESS, is_user_buffer);
         }
     }
 
-    std::unordered_map<std::string, PipelineBuffer> inputs;
-    for (auto &entry_element : m_async_pipeline->get_entry_elements()) {
-        auto buff_type = bindings.input(entry_element.first)->m_pimpl->get_type();
+    for (size_t i = 0; i < m_input_names.size(); i++) {
+        const auto &input_name = m_input_names[i];
+        TRY(auto stream, bindings.input(input_name));
 
-        switch (buff_type) {
+        switch (stream.m_pimpl->get_type()) {
         case BufferType::VIEW:
         {
-            TRY(auto buffer, bindings.input(entry_element.first)->get_buffer(), "Couldnt find input buffer for '{}'", entry_element.first);
-            inputs[entry_element.first] = PipelineBuffer(buffer, transfer_done);
+            TRY(auto buffer, stream.get_buffer(), "Couldnt find input buffer for '{}'", input_name);
+            m_frame_inputs[i] = PipelineBuffer(buffer, transfer_done);
             break;
         }
         case BufferType::DMA_BUFFER:
         {
-            TRY(auto dma_buffer, bindings.input(entry_element.first)->get_dma_buffer(), "Couldnt find input buffer for '{}'", entry_element.first);
-            inputs[entry_element.first] = PipelineBuffer(dma_buffer, transfer_done);
+            TRY(auto dma_buffer, stream.get_dma_buffer(), "Couldnt find input buffer for '{}'", input_name);
+            m_frame_inputs[i] = PipelineBuffer(dma_buffer, transfer_done);
             break;
         }
         case BufferType::PIX_BUFFER:
         {
-            TRY(auto pix_buffer, bindings.input(entry_element.first)->get_pix_buffer(), "Couldnt find input buffer for '{}'", entry_element.first);
-
-            set_pix_buffer_inputs(inputs, pix_buffer, transfer_done, entry_element.first);
+            TRY(auto pix_buffer, stream.get_pix_buffer(), "Couldnt find input buffer for '{}'", input_name);
+            m_frame_inputs[i] = create_pix_buffer_input(pix_buffer, transfer_done);
             break;
         }
 
         default:
-            CHECK(false, HAILO_NOT_FOUND, "Couldnt find input buffer for '{}'", entry_element.first);
+            CHECK(false, HAILO_NOT_FOUND, "Couldnt find input buffer for '{}'", input_name);
         }
     }
 
-    status = set_buffers(inputs, outputs);
-    // TODO: (HRT-14283) If set_buffers fails after a buffer is enqueued, the buffer's CB will be called - and might call user's CB
-    CHECK_SUCCESS(status);
     return HAILO_SUCCESS;
 }
 
+void AsyncInferRunnerImpl::release_frame_buffers()
+{
+    // The buffers that weren't pushed are destroyed here (and not when they are overridden by the next frame), so their
+    // callbacks are called now
+    for (auto &buffer : m_frame_inputs) {
+        PipelineBuffer released(std::move(buffer));
+    }
+    for (auto &buffer : m_frame_outputs) {
+        PipelineBuffer released(std::move(buffer));
+    }
+}
+
+Expected<RegisteredBindingsBuffer> AsyncInferRunnerImpl::resolve_bindings_buffer(ConfiguredInferModel::Bindings::InferStream stream)
+{
+    RegisteredBindingsBuffer buffer{};
+    buffer.type = stream.m_pimpl->get_type();
+    switch (buffer.type) {
+    case BufferType::VIEW:
+    {
+        TRY(buffer.view, stream.get_buffer());
+        break;
+    }
+    case BufferType::PIX_BUFFER:
+    {
+        TRY(buffer.pix_buffer, stream.get_pix_buffer());
+        break;
+    }
+    case BufferType::DMA_BUFFER:
+    {
+        TRY(buffer.dma_buffer, stream.get_dma_buffer());
+        break;
+    }
+    default:
+        LOGGER__ERROR("Bindings buffer was not set");
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    return buffer;
+}
+
+hailo_status AsyncInferRunnerImpl::register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    std::vector<std::vector<RegisteredBindingsBuffer>> registered_inputs;
+    std::vector<std::vector<RegisteredBindingsBuffer>> registered_outputs;
+    registered_inputs.reserve(bindings.size());
+    registered_outputs.reserve(bindings.size());
+    for (auto current_bindings : bindings) {
+        std::vector<RegisteredBindingsBuffer> inputs;
+        inputs.reserve(m_input_names.size());
+        for (const auto &input_name : m_input_names) {
+            TRY(auto stream, current_bindings.input(input_name));
+            TRY(auto buffer, resolve_bindings_buffer(stream), "Couldnt find input buffer for '{}'", input_name);
+            inputs.push_back(buffer);
+        }
+
+        std::vector<RegisteredBindingsBuffer> outputs;
+        outputs.reserve(m_output_names.size());
+        for (const auto &output_name : m_output_names) {
+            TRY(auto stream, current_bindings.output(output_name));
+            TRY(auto buffer, resolve_bindings_buffer(stream), "Couldnt find output buffer for '{}'", output_name);
+            CHECK((BufferType::VIEW == buffer.type) || (BufferType::DMA_BUFFER == buffer.type), HAILO_NOT_SUPPORTED,
+                "pix_buffer isn't supported for outputs in '{}'", output_name);
+            outputs.push_back(buffer);
+        }
+
+        registered_inputs.push_back(std::move(inputs));
+        registered_outputs.push_back(std::move(outputs));
+    }
+
+    m_registered_inputs = std::move(registered_inputs);
+    m_registered_outputs = std::move(registered_outputs);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferRunnerImpl::run_registered(size_t bindings_index, TransferDoneCallbackAsyncInfer transfer_done)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    hailo_status status = m_async_pipeline->get_pipeline_status()->load();
+    CHECK_SUCCESS(status, "Can't handle infer request since Pipeline status is {}.", status);
+    CHECK(bindings_index < m_registered_inputs.size(), HAILO_INVALID_ARGUMENT,
+        "Bindings index {} is out of range, {} bindings were registered", bindings_index, m_registered_inputs.size());
+
+    TRY(auto are_pools_ready, can_push_buffers(1));
+    CHECK(are_pools_ready, HAILO_QUEUE_IS_FULL, "Can't handle infer request since a queue in the pipeline is full.");
+
+    auto shared_transfer_done = make_shared_nothrow<TransferDoneCallbackAsyncInfer>(std::move(transfer_done));
+    CHECK_NOT_NULL(shared_transfer_done, HAILO_OUT_OF_HOST_MEMORY);
+    transfer_done = [shared_transfer_done](hailo_status status) { (*shared_transfer_done)(status); };
+
+    const auto &outputs = m_registered_outputs[bindings_index];
+    const auto &inputs = m_registered_inputs[bindings_index];
+    if (is_direct()) {
+        NamedBuffersCallbacks named_buffers_callbacks;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            CHECK_SUCCESS(add_direct_buffer(named_buffers_callbacks, m_input_names[i], inputs[i], transfer_done));
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            CHECK_SUCCESS(add_direct_buffer(named_buffers_callbacks, m_output_names[i], outputs[i], transfer_done));
+        }
+        return launch_direct(named_buffers_callbacks, nullptr);
+    }
+
+    for (size_t i = 0; i < outputs.size(); i++) {
+        bool is_user_buffer = true;
+        m_frame_outputs[i] = (BufferType::DMA_BUFFER == outputs[i].type) ?
+            PipelineBuffer(outputs[i].dma_buffer, transfer_done, HAILO_SUCCESS, is_user_buffer) :
+            PipelineBuffer(outputs[i].view, transfer_done, HAILO_SUCCESS, is_user_buffer);
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        switch (inputs[i].type) {
+        case BufferType::DMA_BUFFER:
+            m_frame_inputs[i] = PipelineBuffer(inputs[i].dma_buffer, transfer_done);
+            break;
+        case BufferType::PIX_BUFFER:
+            m_frame_inputs[i] = create_pix_buffer_input(inputs[i].pix_buffer, transfer_done);
+            break;
+        default:
+            m_frame_inputs[i] = PipelineBuffer(inputs[i].view, transfer_done);
+            break;
+        }
+    }
+
+    status = set_buffers(m_frame_inputs, m_frame_outputs);
+    release_frame_buffers();
+    return status;
+}
+
 void AsyncInferRunnerImpl::add_element_to_pipeline(std::shared_ptr<PipelineElement> pipeline_element)
 {
     m_async_pipeline->add_element_to_pipeline(pipeline_element);
@@ -378,6 +854,29 @@ std::string AsyncInferRunnerImpl::get_pipeline_description() const
     return pipeline_str.str();
 }
 
+std::vector<PipelineElementLatencyResults> AsyncInferRunnerImpl::get_pipeline_elements_latency() const
+{
+    std::vector<PipelineElementLatencyResults> results;
+    for (const auto &element : get_pipeline()) {
+        auto processing_time_histogram = element->get_latency_histogram();
+        auto wait_time_histogram = element->get_wait_time_histogram();
+        if ((nullptr == processing_time_histogram) && (nullptr == wait_time_histogram)) {
+            continue;
+        }
+
+        PipelineElementLatencyResults element_results{};
+        element_results.element_name = element->name();
+        if (nullptr != processing_time_histogram) {
+            element_results.processing_time = processing_time_histogram->get_results();
+        }
+        if (nullptr != wait_time_histogram) {
+            element_results.wait_time = wait_time_histogram->get_results();
+        }
+        results.emplace_back(std::move(element_results));
+    }
+    return results;
+}
+
 hailo_status AsyncInferRunnerImpl::get_pipeline_status() const
 {
     return m_pipeline_status->load();
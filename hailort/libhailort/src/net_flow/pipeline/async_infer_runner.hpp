@@ -20,6 +20,10 @@
 namespace hailort
 {
 
+// If set, the frames always go through the pipeline, even when it doesn't run any element on them (see
+// AsyncInferRunnerImpl::is_direct)
+#define DISABLE_DIRECT_ASYNC_INFER_ENV_VAR ("HAILO_DISABLE_DIRECT_ASYNC_INFER")
+
 class AsyncPipeline
 {
 public:
@@ -54,12 +58,26 @@ private:
     bool m_is_multi_planar;
 };
 
+// A buffer of Bindings registered by AsyncInferRunnerImpl::register_bindings - the buffer is resolved once, when the
+// Bindings are registered
+struct RegisteredBindingsBuffer
+{
+    BufferType type;
+    MemoryView view;
+    hailo_pix_buffer_t pix_buffer;
+    hailo_dma_buffer_t dma_buffer;
+};
+
 class AsyncInferRunnerImpl
 {
 public:
     static Expected<std::shared_ptr<AsyncInferRunnerImpl>> create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-        const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS);
+        const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS,
+        std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor = nullptr,
+        hailo_pipeline_elem_stats_flags_t elem_stats_flags = HAILO_PIPELINE_ELEM_STATS_NONE,
+        const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params = {},
+        size_t max_buffer_pool_size = std::numeric_limits<size_t>::max());
     AsyncInferRunnerImpl(AsyncInferRunnerImpl &&) = delete;
     AsyncInferRunnerImpl(const AsyncInferRunnerImpl &) = delete;
     AsyncInferRunnerImpl &operator=(AsyncInferRunnerImpl &&) = delete;
@@ -67,13 +85,38 @@ public:
     virtual ~AsyncInferRunnerImpl();
     AsyncInferRunnerImpl(std::shared_ptr<AsyncPipeline> async_pipeline, std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
 
-    hailo_status run(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done);
-    hailo_status set_buffers(std::unordered_map<std::string, PipelineBuffer> &inputs,
-        std::unordered_map<std::string, PipelineBuffer> &outputs);
+    // The frame's infer request is sent with the given control (if any), so it may be dropped before it is sent to the
+    // device (see InferRequestControl)
+    hailo_status run(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done,
+        InferRequestControlPtr control = nullptr);
+    // Pushes the frames of all of the bindings under a single lock, if the pipeline has room for all of them (otherwise
+    // returns HAILO_QUEUE_IS_FULL, without pushing any frame). transfers_done[i] is the callback of bindings[i].
+    hailo_status run_frames(std::vector<ConfiguredInferModel::Bindings> &bindings,
+        std::vector<TransferDoneCallbackAsyncInfer> &transfers_done);
+
+    // Resolves the buffers of each of the bindings to the pipeline's entry and last elements, so run_registered() pushes
+    // the buffers of a registered bindings without looking them up by name. Replaces the bindings registered before.
+    hailo_status register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings);
+    hailo_status run_registered(size_t bindings_index, TransferDoneCallbackAsyncInfer transfer_done);
+    // inputs[i] is pushed to the i-th entry element (see m_entry_elements), and outputs[i] is enqueued to the i-th
+    // last element (see m_last_elements)
+    hailo_status set_buffers(std::vector<PipelineBuffer> &inputs, std::vector<PipelineBuffer> &outputs);
 
     void abort();
 
     Expected<bool> can_push_buffers(uint32_t frames_count);
+    // Returns the amount of frames that may be in flight without any element blocking on a buffer acquisition (each
+    // frame in flight holds a buffer of each pool in the pipeline, until its callback is called).
+    size_t get_max_ongoing_frames_count() const;
+    // Whether the outputs of the hw element are written directly to the user's buffers (no element runs on the outputs
+    // on the host), so the frames don't have to be completed in order.
+    bool are_outputs_written_by_hw() const;
+    // Whether the frames are sent to the streams of the network group directly, bypassing the pipeline - when no element
+    // runs on the inputs or the outputs on the host, the entry and last elements are only hops between the user's
+    // buffers and the hw element.
+    bool is_direct() const;
+    // Locks the buffers allocated by the pipeline's buffer pools (see BufferPool::lock_buffers)
+    hailo_status lock_host_buffers();
 
     void add_element_to_pipeline(std::shared_ptr<PipelineElement> pipeline_element);
     void add_entry_element(std::shared_ptr<PipelineElement> pipeline_element, const std::string &input_name);
@@ -86,19 +129,64 @@ public:
     std::string get_pipeline_description() const;
     hailo_status get_pipeline_status() const;
     std::shared_ptr<AsyncPipeline> get_async_pipeline() const;
+    // Latency breakdown of the elements measuring latency (see HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY)
+    std::vector<PipelineElementLatencyResults> get_pipeline_elements_latency() const;
 
 protected:
+    // Pushes the buffers of a single frame. m_mutex must be held.
+    hailo_status push_bindings(ConfiguredInferModel::Bindings &bindings, TransferDoneCallbackAsyncInfer transfer_done,
+        InferRequestControlPtr control = nullptr);
+    // Sets the buffers of the bindings to m_frame_inputs and m_frame_outputs
+    hailo_status fill_frame_buffers(ConfiguredInferModel::Bindings &bindings, const TransferDoneCallbackAsyncInfer &transfer_done);
+    void release_frame_buffers();
     hailo_status start_pipeline();
     hailo_status stop_pipeline();
 
-    void set_pix_buffer_inputs(std::unordered_map<std::string, PipelineBuffer> &inputs, hailo_pix_buffer_t userptr_pix_buffer,
-        TransferDoneCallbackAsyncInfer input_done, const std::string &input_name);
+    PipelineBuffer create_pix_buffer_input(hailo_pix_buffer_t pix_buffer, TransferDoneCallbackAsyncInfer input_done);
+    static Expected<RegisteredBindingsBuffer> resolve_bindings_buffer(ConfiguredInferModel::Bindings::InferStream stream);
+
+    // Enables the direct path (see is_direct) if each entry element is linked to the hw element, and each output of the
+    // hw element is linked to a last element
+    void resolve_direct_streams(std::shared_ptr<ConfiguredNetworkGroup> net_group);
+    hailo_status add_direct_buffer(NamedBuffersCallbacks &named_buffers_callbacks, const std::string &name,
+        const RegisteredBindingsBuffer &buffer, const TransferDoneCallbackAsyncInfer &transfer_done);
+    hailo_status add_direct_planes_buffers(NamedBuffersCallbacks &named_buffers_callbacks, const std::string &name,
+        const RegisteredBindingsBuffer &buffer, const TransferDoneCallbackAsyncInfer &transfer_done);
+    hailo_status launch_direct(const NamedBuffersCallbacks &named_buffers_callbacks, InferRequestControlPtr control);
 
     std::shared_ptr<AsyncPipeline> m_async_pipeline;
     volatile bool m_is_activated;
     volatile bool m_is_aborted;
     std::shared_ptr<std::atomic<hailo_status>> m_pipeline_status;
     std::mutex m_mutex;
+    size_t m_max_ongoing_frames_count;
+    // The amount of frames pushed to the pipeline (see AsyncHwElement::set_infer_request_control)
+    uint64_t m_pushed_frames_count;
+
+    // The entry and last elements of the pipeline (and their input and output names), resolved once so the frames'
+    // buffers are addressed by index instead of by name
+    std::vector<std::shared_ptr<PipelineElement>> m_entry_elements;
+    std::vector<std::shared_ptr<PipelineElement>> m_last_elements;
+    std::vector<std::string> m_input_names;
+    std::vector<std::string> m_output_names;
+    // The buffers of the frame being pushed - in the order of the elements. Reused by all the frames (guarded by m_mutex).
+    std::vector<PipelineBuffer> m_frame_inputs;
+    std::vector<PipelineBuffer> m_frame_outputs;
+
+    // The buffers of each of the registered bindings - in the order of the elements
+    std::vector<std::vector<RegisteredBindingsBuffer>> m_registered_inputs;
+    std::vector<std::vector<RegisteredBindingsBuffer>> m_registered_outputs;
+
+    // The stream of each input and output name, when the frames bypass the pipeline (empty otherwise)
+    std::unordered_map<std::string, std::string> m_direct_stream_names;
+    // The streams of the planes of each multi-planar input (in the order of the planes), when the frames bypass the
+    // pipeline - each plane is sent to its stream as it is
+    struct DirectPlanesStreams {
+        hailo_format_order_t order;
+        std::vector<std::string> stream_names;
+    };
+    std::unordered_map<std::string, DirectPlanesStreams> m_direct_planes_streams;
+    std::weak_ptr<ConfiguredNetworkGroup> m_direct_net_group;
 };
 
 } /* namespace hailort */
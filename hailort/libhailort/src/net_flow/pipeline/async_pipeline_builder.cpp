@@ -17,6 +17,7 @@
 #include "net_flow/ops/softmax_post_process.hpp"
 #include "net_flow/ops/yolox_post_process.hpp"
 #include "net_flow/ops/ssd_post_process.hpp"
+#include "net_flow/ops/custom_post_process.hpp"
 #include "net_flow/pipeline/vstream_builder.hpp"
 #include <algorithm>
 
@@ -71,7 +72,8 @@ Expected<std::unordered_map<std::string, hailo_format_t>> AsyncPipelineBuilder::
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline)
+    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline,
+    const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params)
 {
     TRY(const auto vstream_names, net_group->get_vstream_names_from_stream_name(*stream_names.begin()));
     CHECK(vstream_names.size() == 1, HAILO_NOT_SUPPORTED, "low level stream must have exactly 1 user input");
@@ -89,6 +91,9 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
     last_element_connected_to_pipeline = entry_queue_elem;
 
     bool is_multi_planar = (stream_names.size() > 1);
+    const auto is_resized = contains(inputs_resize_params, vstream_name);
+    CHECK(!(is_multi_planar && is_resized), HAILO_NOT_SUPPORTED, "Resize of the multi-planar input {} isn't supported",
+        vstream_name);
     if (is_multi_planar) {
         async_pipeline->set_as_multi_planar();
         const auto &vstream_order = inputs_formats.at(vstream_name).order;
@@ -127,6 +132,25 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
             src_format, input_stream_info.hw_shape, input_stream_info.format,
             std::vector<hailo_quant_info_t>(1, input_stream_info.quant_info))); // Inputs always have single quant_info
 
+        if (is_resized) {
+            TRY(auto resize_elem, ResizeElement::create(inputs_resize_params.at(vstream_name), input_stream_info.shape,
+                PipelineObject::create_element_name("ResizeEl", stream_name, input_stream_info.index),
+                async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+            async_pipeline->add_element_to_pipeline(resize_elem);
+            CHECK_SUCCESS(PipelinePad::link_pads(last_element_connected_to_pipeline, resize_elem));
+
+            // The resized frames are transformed by the PreInferElement, or sent to the HW as they are
+            const auto resized_frame_size = should_transform ?
+                HailoRTCommon::get_frame_size(input_stream_info.shape, src_format) : input_stream_info.hw_frame_size;
+            is_empty = false;
+            interacts_with_hw = !should_transform;
+            TRY(auto resize_queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_resize",
+                stream_name, input_stream_info.index), async_pipeline, resized_frame_size, is_empty, interacts_with_hw,
+                resize_elem));
+            CHECK_SUCCESS(PipelinePad::link_pads(resize_elem, resize_queue_elem));
+            last_element_connected_to_pipeline = resize_queue_elem;
+        }
+
         if (should_transform) {
             TRY(auto pre_infer_elem, PreInferElement::create(input_stream_info.shape, src_format,
                 input_stream_info.hw_shape, input_stream_info.format, { input_stream_info.quant_info },
@@ -151,14 +175,14 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-    std::shared_ptr<AsyncPipeline> async_pipeline)
+    std::shared_ptr<AsyncPipeline> async_pipeline, const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params)
 {
     for(const auto &input : inputs_formats) {
         TRY(const auto stream_names_under_vstream,
             net_group->get_stream_names_from_vstream_name(input.first));
 
         auto status = create_pre_async_hw_elements_per_input(net_group, stream_names_under_vstream, inputs_formats,
-            named_stream_infos, async_pipeline);
+            named_stream_infos, async_pipeline, inputs_resize_params);
         CHECK_SUCCESS(status);
     }
     return HAILO_SUCCESS;
@@ -169,13 +193,8 @@ Expected<std::shared_ptr<PostInferElement>> AsyncPipelineBuilder::add_post_infer
     const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const std::vector<hailo_quant_info_t> &dst_quant_infos,
     std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index)
 {
-    auto pre_transform_frame_size = (HailoRTCommon::is_nms(src_format.order)) ?
-        HailoRTCommon::get_nms_hw_frame_size(nms_info) : HailoRTCommon::get_periph_frame_size(src_image_shape, src_format);
-    auto is_empty = false;
-    auto interacts_with_hw = true;
-    TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl", final_elem->name(),
-        static_cast<uint8_t>(final_elem_source_index)), async_pipeline, pre_transform_frame_size, is_empty, interacts_with_hw,
-        final_elem, final_elem_source_index));
+    TRY(auto queue_elem, add_pre_post_infer_queue_element(nms_info, async_pipeline, src_image_shape, src_format, final_elem,
+        final_elem_source_index));
 
     TRY(auto post_infer_elem, PostInferElement::create(src_image_shape, src_format, dst_image_shape, output_format,
         dst_quant_infos, nms_info, PipelineObject::create_element_name("PostInferEl",
@@ -188,6 +207,87 @@ Expected<std::shared_ptr<PostInferElement>> AsyncPipelineBuilder::add_post_infer
     return post_infer_elem;
 }
 
+Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPipelineBuilder::add_pre_post_infer_queue_element(const hailo_nms_info_t &nms_info,
+    std::shared_ptr<AsyncPipeline> async_pipeline, const hailo_3d_image_shape_t &src_image_shape, const hailo_format_t &src_format,
+    std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index)
+{
+    auto pre_transform_frame_size = (HailoRTCommon::is_nms(src_format.order)) ?
+        HailoRTCommon::get_nms_hw_frame_size(nms_info) : HailoRTCommon::get_periph_frame_size(src_image_shape, src_format);
+    auto is_empty = false;
+    auto interacts_with_hw = true;
+    return add_push_queue_element(PipelineObject::create_element_name("PushQEl", final_elem->name(),
+        static_cast<uint8_t>(final_elem_source_index)), async_pipeline, pre_transform_frame_size, is_empty, interacts_with_hw,
+        final_elem, final_elem_source_index);
+}
+
+Expected<std::shared_ptr<FusedFilterElement>> AsyncPipelineBuilder::add_fused_iou_element(std::shared_ptr<AsyncPipeline> async_pipeline,
+    const hailo_format_t &output_format, const hailo_stream_info_t &output_stream_info, const std::vector<hailo_quant_info_t> &stream_quant_infos,
+    const net_flow::PostProcessOpMetadataPtr &iou_op_metadata)
+{
+    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(iou_op_metadata);
+    assert(nullptr != metadata);
+
+    const auto build_params = async_pipeline->get_build_params();
+    auto async_hw_elem = async_pipeline->get_async_hw_element();
+    const auto &output_stream_name = output_stream_info.name;
+
+    TRY(auto queue_elem, add_pre_post_infer_queue_element(output_stream_info.nms_info, async_pipeline, output_stream_info.hw_shape,
+        output_stream_info.format, async_hw_elem));
+
+    // The device's frames are transformed to HAILO_NMS frames, and only the last stage fills the user's format order
+    auto nms_format = output_format;
+    nms_format.order = HAILO_FORMAT_ORDER_HAILO_NMS;
+
+    // The stages are the elements of the unfused IoU flow, without the queues between them. The detections are passed
+    // between the last stages as metadata, so their scratch buffers are empty.
+    TRY(auto post_infer_elem, PostInferElement::create(output_stream_info.hw_shape, output_stream_info.format,
+        output_stream_info.shape, nms_format, stream_quant_infos, output_stream_info.nms_info,
+        PipelineObject::create_element_name("PostInferEl", async_hw_elem->name(), 0), build_params,
+        PipelineDirection::PUSH, async_pipeline));
+    TRY(auto nms_to_detections_elem, ConvertNmsToDetectionsElement::create(metadata->nms_info(),
+        PipelineObject::create_element_name("NmsFormatToDetectionsEl", output_stream_name, output_stream_info.index),
+        build_params, PipelineDirection::PUSH, async_pipeline));
+    TRY(auto remove_overlapping_bboxes_elem, RemoveOverlappingBboxesElement::create(metadata->nms_config(),
+        PipelineObject::create_element_name("RemoveOverlappingBboxesEl", output_stream_name, output_stream_info.index),
+        build_params, PipelineDirection::PUSH, async_pipeline));
+    TRY(auto fill_nms_format_elem, FillNmsFormatElement::create(metadata->nms_config(), output_format.order,
+        PipelineObject::create_element_name("FillNmsFormatEl", output_stream_name, output_stream_info.index),
+        build_params, PipelineDirection::PUSH, async_pipeline));
+
+    CHECK_SUCCESS_AS_EXPECTED(apply_nms_filters(*post_infer_elem, metadata->nms_config()));
+    remove_overlapping_bboxes_elem->set_in_place(should_run_in_place(*remove_overlapping_bboxes_elem));
+
+    std::vector<std::shared_ptr<FilterElement>> stages = { post_infer_elem, nms_to_detections_elem,
+        remove_overlapping_bboxes_elem, fill_nms_format_elem };
+    const auto post_transform_frame_size = HailoRTCommon::get_nms_host_frame_size(output_stream_info.nms_info, nms_format);
+    const std::vector<size_t> intermediate_frame_sizes = { post_transform_frame_size, 0, 0 };
+
+    TRY(auto fused_elem, FusedFilterElement::create(std::move(stages), intermediate_frame_sizes,
+        PipelineObject::create_element_name("FusedIouEl", output_stream_name, output_stream_info.index), build_params,
+        PipelineDirection::PUSH, async_pipeline));
+
+    async_pipeline->add_element_to_pipeline(fused_elem);
+
+    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(queue_elem, fused_elem));
+    return fused_elem;
+}
+
+bool AsyncPipelineBuilder::should_run_in_place(const FilterElement &element)
+{
+    return element.is_in_place_capable() && !is_env_variable_on(DISABLE_IN_PLACE_PIPELINE_ELEMENTS_ENV_VAR);
+}
+
+hailo_status AsyncPipelineBuilder::apply_nms_filters(PostInferElement &post_infer_element,
+    const net_flow::NmsPostProcessConfig &nms_config)
+{
+    // A zero threshold keeps all the bboxes the device passed
+    if (nms_config.nms_score_th > 0) {
+        auto status = post_infer_element.set_nms_score_threshold(static_cast<float32_t>(nms_config.nms_score_th));
+        CHECK_SUCCESS(status);
+    }
+    return post_infer_element.set_nms_classes_filter(nms_config.classes_filter);
+}
+
 Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPipelineBuilder::add_push_queue_element(const std::string &queue_name, std::shared_ptr<AsyncPipeline> async_pipeline,
     size_t frame_size, bool is_empty, bool interacts_with_hw, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index, bool is_entry)
 {
@@ -246,6 +346,7 @@ Expected<std::shared_ptr<FillNmsFormatElement>> AsyncPipelineBuilder::add_fill_n
     assert(nullptr != metadata);
 
     TRY(auto fill_nms_format_element, FillNmsFormatElement::create(metadata->nms_config(),
+        metadata->outputs_metadata().begin()->second.format.order,
         PipelineObject::create_element_name(element_name, output_stream_name, stream_index),
         async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
 
@@ -429,12 +530,6 @@ hailo_status AsyncPipelineBuilder::add_softmax_flow(std::shared_ptr<AsyncPipelin
     TRY(auto post_infer_elem, add_post_infer_element(output_format_expanded, {}, async_pipeline, stream_info.hw_shape, stream_info.format,
         stream_info.shape, stream_quant_infos, async_pipeline->get_async_hw_element(), hw_async_elem_index));
 
-    auto is_empty = false;
-    auto interacts_with_hw = false;
-    const auto post_transform_frame_size = HailoRTCommon::get_frame_size(stream_info.shape, output_format_expanded);
-    TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_softmax", async_pipeline->get_async_hw_element()->name(),
-        static_cast<uint8_t>(hw_async_elem_index)), async_pipeline, post_transform_frame_size, is_empty, interacts_with_hw, post_infer_elem));
-
     // Updating metadata according to user request
     // Currently softmax only supports inputs to be float32 and order NHWC or NC
     auto updated_inputs_metadata = softmax_op_metadata.get()->inputs_metadata();
@@ -451,12 +546,24 @@ hailo_status AsyncPipelineBuilder::add_softmax_flow(std::shared_ptr<AsyncPipelin
     TRY(auto softmax_element, SoftmaxPostProcessElement::create(softmax_op,
         PipelineObject::create_element_name("SoftmaxPPEl", stream_name, stream_info.index),
         async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+    softmax_element->set_in_place(should_run_in_place(*softmax_element));
+
+    // When the softmax runs in-place, the post-infer element writes straight to the user's buffers, so the queue
+    // between them passes the user's buffers on and has no buffers of its own.
+    auto is_empty = softmax_element->is_in_place();
+    auto interacts_with_hw = false;
+    const auto post_transform_frame_size = HailoRTCommon::get_frame_size(stream_info.shape, output_format_expanded);
+    TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_softmax", async_pipeline->get_async_hw_element()->name(),
+        static_cast<uint8_t>(hw_async_elem_index)), async_pipeline, post_transform_frame_size, is_empty, interacts_with_hw, post_infer_elem));
 
     async_pipeline->add_element_to_pipeline(softmax_element);
     CHECK_SUCCESS(PipelinePad::link_pads(queue_elem, softmax_element));
 
     TRY(auto last_async_element, add_last_async_element(async_pipeline, updated_output_format.first, post_transform_frame_size,
         softmax_element));
+    if (softmax_element->is_in_place()) {
+        post_infer_elem->set_output_buffer_pool(last_async_element->get_buffer_pool());
+    }
 
     return HAILO_SUCCESS;
 }
@@ -505,6 +612,70 @@ hailo_status AsyncPipelineBuilder::add_argmax_flow(std::shared_ptr<AsyncPipeline
     return HAILO_SUCCESS;
 }
 
+hailo_status AsyncPipelineBuilder::add_custom_op_flow(std::shared_ptr<AsyncPipeline> async_pipeline, const std::vector<std::string> &output_streams_names,
+    const std::pair<std::string, hailo_format_t> &output_format, const net_flow::PostProcessOpMetadataPtr &custom_op_metadata,
+    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos)
+{
+    auto metadata = std::dynamic_pointer_cast<net_flow::CustomOpMetadata>(custom_op_metadata);
+    assert(nullptr != metadata);
+
+    const auto &op_output_metadata = metadata->outputs_metadata().begin()->second;
+    CHECK(((HAILO_FORMAT_TYPE_AUTO == output_format.second.type) || (op_output_metadata.format.type == output_format.second.type)) &&
+        ((HAILO_FORMAT_ORDER_AUTO == output_format.second.order) || (op_output_metadata.format.order == output_format.second.order)),
+        HAILO_INVALID_ARGUMENT, "The format of output {} must be the output format of custom post-process op {}",
+        output_format.first, metadata->get_name());
+
+    TRY(auto custom_op, net_flow::CustomPostProcessOpAdapter::create(metadata));
+    TRY(auto custom_op_elem,
+        NmsPostProcessMuxElement::create(custom_op, PipelineObject::create_element_name("CustomPPMuxEl", custom_op->get_name(), 0),
+            async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+    async_pipeline->add_element_to_pipeline(custom_op_elem);
+
+    for (uint32_t i = 0; i < output_streams_names.size(); ++i) {
+        const auto &curr_stream_name = output_streams_names[i];
+        CHECK(contains(named_stream_infos, curr_stream_name), HAILO_INTERNAL_FAILURE);
+        const auto &curr_stream_info = named_stream_infos.at(curr_stream_name);
+        CHECK(contains(metadata->inputs_metadata(), curr_stream_name), HAILO_INTERNAL_FAILURE);
+        const auto &op_input_format = metadata->inputs_metadata().at(curr_stream_name).format;
+
+        TRY(const auto source_id,
+            async_pipeline->get_async_hw_element()->get_source_index_from_output_stream_name(curr_stream_name));
+
+        // TODO (HRT-11078): Fix multi qp for PP
+        auto stream_quant_infos = std::vector<hailo_quant_info_t>(1, curr_stream_info.quant_info);
+        TRY(const auto should_transform_input, should_transform(curr_stream_info, stream_quant_infos, op_input_format));
+
+        // The inputs are transformed to the formats the op was added with, the same way they would have been
+        // transformed as the model's outputs
+        auto is_empty = false;
+        std::shared_ptr<AsyncPushQueueElement> input_queue_elem = nullptr;
+        if (should_transform_input) {
+            TRY(auto post_infer_elem, add_post_infer_element(op_input_format, {}, async_pipeline, curr_stream_info.hw_shape,
+                curr_stream_info.format, curr_stream_info.shape, stream_quant_infos, async_pipeline->get_async_hw_element(),
+                source_id));
+            auto interacts_with_hw = false;
+            const auto post_transform_frame_size = HailoRTCommon::get_frame_size(curr_stream_info.shape, op_input_format);
+            TRY(input_queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_custom",
+                curr_stream_info.name, curr_stream_info.index), async_pipeline, post_transform_frame_size, is_empty,
+                interacts_with_hw, post_infer_elem));
+        } else {
+            auto interacts_with_hw = true;
+            TRY(input_queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_custom",
+                curr_stream_info.name, curr_stream_info.index), async_pipeline, curr_stream_info.hw_frame_size, is_empty,
+                interacts_with_hw, async_pipeline->get_async_hw_element(), source_id));
+        }
+
+        CHECK_SUCCESS(PipelinePad::link_pads(input_queue_elem, custom_op_elem, 0, i));
+        custom_op_elem->add_sink_name(curr_stream_name);
+    }
+
+    const auto post_transform_frame_size = HailoRTCommon::get_frame_size(op_output_metadata.shape, op_output_metadata.format);
+    TRY(auto last_async_element, add_last_async_element(async_pipeline, output_format.first, post_transform_frame_size,
+        custom_op_elem));
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status AsyncPipelineBuilder::add_nms_flow(std::shared_ptr<AsyncPipeline> async_pipeline, const std::vector<std::string> &output_streams_names,
     const std::pair<std::string, hailo_format_t> &output_format, const std::shared_ptr<hailort::net_flow::Op> &nms_op,
     const hailo_vstream_info_t &vstream_info, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos)
@@ -520,7 +691,7 @@ hailo_status AsyncPipelineBuilder::add_nms_flow(std::shared_ptr<AsyncPipeline> a
         "NMS output format type must be HAILO_FORMAT_TYPE_FLOAT32");
     if(!nms_op_metadata->nms_config().bbox_only){
         CHECK(HailoRTCommon::is_nms(output_format.second.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -610,13 +781,29 @@ hailo_status AsyncPipelineBuilder::add_iou_flow( std::shared_ptr<AsyncPipeline>
     // TODO (HRT-11078): Fix multi qp for PP
     auto stream_quant_infos = std::vector<hailo_quant_info_t>(1, output_stream_info.quant_info); //output_stream_base->get_quant_infos();
 
-    TRY(auto post_infer_element, add_post_infer_element(output_format.second, output_stream_info.nms_info,
+    TRY(const auto output_vstream_info, iou_op_metadata->get_output_vstream_info());
+    const auto final_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, output_format.second);
+
+    if (!is_env_variable_on(DISABLE_PIPELINE_ELEMENTS_FUSION_ENV_VAR)) {
+        TRY(auto fused_iou_element, add_fused_iou_element(async_pipeline, output_format.second, output_stream_info,
+            stream_quant_infos, iou_op_metadata));
+        TRY(auto last_async_element, add_last_async_element(async_pipeline, output_format.first, final_frame_size, fused_iou_element));
+        return HAILO_SUCCESS;
+    }
+
+    // The device's frames are transformed to HAILO_NMS frames, and only the last element fills the user's format order
+    auto nms_format = output_format.second;
+    nms_format.order = HAILO_FORMAT_ORDER_HAILO_NMS;
+    TRY(auto post_infer_element, add_post_infer_element(nms_format, output_stream_info.nms_info,
         async_pipeline, output_stream_info.hw_shape, output_stream_info.format, output_stream_info.shape, stream_quant_infos,
         async_pipeline->get_async_hw_element()));
+    auto iou_metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(iou_op_metadata);
+    assert(nullptr != iou_metadata);
+    CHECK_SUCCESS(apply_nms_filters(*post_infer_element, iou_metadata->nms_config()));
 
     auto is_empty = false;
     auto interacts_with_hw = false;
-    const auto post_transform_frame_size = HailoRTCommon::get_nms_host_frame_size(output_stream_info.nms_info, output_format.second);
+    const auto post_transform_frame_size = HailoRTCommon::get_nms_host_frame_size(output_stream_info.nms_info, nms_format);
     TRY(auto pre_nms_convert_queue_element,
         add_push_queue_element(PipelineObject::create_element_name("PushQEl_pre_nms_convert", output_stream_name,
             output_stream_info.index), async_pipeline, post_transform_frame_size, is_empty, interacts_with_hw, post_infer_element));
@@ -632,18 +819,18 @@ hailo_status AsyncPipelineBuilder::add_iou_flow( std::shared_ptr<AsyncPipeline>
     TRY(auto remove_overlapping_bboxes_element,
         add_remove_overlapping_bboxes_element(async_pipeline, output_stream_name, output_stream_info.index,
             "RemoveOverlappingBboxesEl", iou_op_metadata, pre_remove_overlapping_bboxes_element_queue_element));
+    remove_overlapping_bboxes_element->set_in_place(should_run_in_place(*remove_overlapping_bboxes_element));
 
+    // An in-place element passes its input buffers on, so the queue after it has no buffers of its own
     TRY(auto pre_fill_nms_format_element_queue_element,
         add_push_queue_element(PipelineObject::create_element_name("PushQEl_pre_fill_nms_format",
-            output_stream_name, output_stream_info.index), async_pipeline, 0, is_empty, interacts_with_hw, remove_overlapping_bboxes_element));
+            output_stream_name, output_stream_info.index), async_pipeline, 0, remove_overlapping_bboxes_element->is_in_place(),
+            interacts_with_hw, remove_overlapping_bboxes_element));
 
     TRY(auto fill_nms_format_element,
         add_fill_nms_format_element(async_pipeline, output_stream_name, output_stream_info.index,
             "FillNmsFormatEl", iou_op_metadata, pre_fill_nms_format_element_queue_element));
 
-    TRY(const auto output_vstream_info, iou_op_metadata->get_output_vstream_info());
-    const auto final_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, output_format.second);
-
     TRY(auto last_async_element,
         add_last_async_element(async_pipeline, output_format.first, final_frame_size, fill_nms_format_element));
 
@@ -752,6 +939,9 @@ hailo_status AsyncPipelineBuilder::add_ops_flows(std::shared_ptr<AsyncPipeline>
     case net_flow::OperationType::SOFTMAX:
         return add_softmax_flow(async_pipeline, output_streams_names, output_format, op_metadata, named_stream_infos);
 
+    case net_flow::OperationType::CUSTOM:
+        return add_custom_op_flow(async_pipeline, output_streams_names, output_format, op_metadata, named_stream_infos);
+
     default:
         LOGGER__ERROR("op type {} of op {} is not in any of the supported post process OP types", net_flow::OpMetadata::get_operation_type_str(op_metadata->type()), op_metadata->get_name());
         return HAILO_INVALID_OPERATION;
@@ -846,7 +1036,9 @@ hailo_status AsyncPipelineBuilder::create_post_async_hw_elements(std::shared_ptr
 Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout, std::shared_ptr<std::atomic<hailo_status>> pipeline_status)
+    const uint32_t timeout, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+    std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor, hailo_pipeline_elem_stats_flags_t elem_stats_flags,
+    const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params, size_t max_buffer_pool_size)
 {
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> entry_elements;
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> last_elements;
@@ -856,10 +1048,12 @@ Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(s
     // Buffer pool sizes for pipeline elements should be:
     // * The minimum of the maximum queue size of all LL streams (input and output) - for edge elements
     // * HAILO_DEFAULT_ASYNC_INFER_QUEUE_SIZE - for internal elements
-    TRY(build_params.buffer_pool_size_edges, net_group->get_min_buffer_pool_size());
+    // Both are limited by max_buffer_pool_size (e.g. for fitting the pipeline in a host memory budget)
+    TRY(const auto min_buffer_pool_size, net_group->get_min_buffer_pool_size());
+    build_params.buffer_pool_size_edges = std::min(min_buffer_pool_size, max_buffer_pool_size);
     build_params.buffer_pool_size_internal = std::min(static_cast<uint32_t>(build_params.buffer_pool_size_edges),
         static_cast<uint32_t>(HAILO_DEFAULT_ASYNC_INFER_QUEUE_SIZE));
-    build_params.elem_stats_flags = HAILO_PIPELINE_ELEM_STATS_NONE;
+    build_params.elem_stats_flags = elem_stats_flags;
     build_params.vstream_stats_flags = HAILO_VSTREAM_STATS_NONE;
 
     TRY(auto async_pipeline, AsyncPipeline::create_shared());
@@ -877,17 +1071,18 @@ Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(s
     TRY(build_params.shutdown_event, Event::create_shared(Event::State::not_signalled));
     build_params.pipeline_status = pipeline_status;
     build_params.timeout = std::chrono::milliseconds(timeout);
+    build_params.executor = async_pipeline_executor;
 
     async_pipeline->set_build_params(build_params);
 
     TRY(auto async_hw_elem, AsyncHwElement::create(named_stream_infos, build_params.timeout,
         build_params.elem_stats_flags, "AsyncHwEl", build_params.pipeline_status, net_group,
-        PipelineDirection::PUSH, async_pipeline));
+        build_params.buffer_pool_size_edges, PipelineDirection::PUSH, async_pipeline));
     async_pipeline->add_element_to_pipeline(async_hw_elem);
     async_pipeline->set_async_hw_element(async_hw_elem);
 
     hailo_status status = create_pre_async_hw_elements(net_group, input_expanded_format, named_stream_infos,
-        async_pipeline);
+        async_pipeline, inputs_resize_params);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     status = create_post_async_hw_elements(net_group, output_expanded_format, outputs_original_formats, named_stream_infos,
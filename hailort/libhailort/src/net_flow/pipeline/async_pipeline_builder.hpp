@@ -19,6 +19,10 @@
 namespace hailort
 {
 
+// If set, adjacent filter elements are separated by queues (each running on its own) instead of being fused
+#define DISABLE_PIPELINE_ELEMENTS_FUSION_ENV_VAR ("HAILO_DISABLE_PIPELINE_ELEMENTS_FUSION")
+// If set, in-place capable filter elements always write their output to a buffer of their own
+#define DISABLE_IN_PLACE_PIPELINE_ELEMENTS_ENV_VAR ("HAILO_DISABLE_IN_PLACE_PIPELINE_ELEMENTS")
 
 class AsyncPipelineBuilder final
 {
@@ -28,7 +32,11 @@ public:
     static Expected<std::shared_ptr<AsyncPipeline>> create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
         const std::unordered_map<std::string, hailo_format_t> &outputs_formats, const uint32_t timeout,
-        std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
+        std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+        std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor = nullptr,
+        hailo_pipeline_elem_stats_flags_t elem_stats_flags = HAILO_PIPELINE_ELEM_STATS_NONE,
+        const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params = {},
+        size_t max_buffer_pool_size = std::numeric_limits<size_t>::max());
 
     static Expected<std::unordered_map<std::string, hailo_format_t>> expand_auto_input_formats(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
@@ -39,10 +47,11 @@ public:
 
     static hailo_status create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-        std::shared_ptr<AsyncPipeline> async_pipeline);
+        std::shared_ptr<AsyncPipeline> async_pipeline, const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params = {});
     static hailo_status create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
+        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline,
+        const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params = {});
     static hailo_status create_post_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &expanded_outputs_formats, std::unordered_map<std::string, hailo_format_t> &original_outputs_formats,
         const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
@@ -53,6 +62,9 @@ public:
     static hailo_status add_softmax_flow(std::shared_ptr<AsyncPipeline> async_pipeline, const std::vector<std::string> &output_streams_names,
         const std::pair<std::string, hailo_format_t> &output_format, const net_flow::PostProcessOpMetadataPtr &softmax_op_metadata,
         const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
+    static hailo_status add_custom_op_flow(std::shared_ptr<AsyncPipeline> async_pipeline, const std::vector<std::string> &output_streams_names,
+        const std::pair<std::string, hailo_format_t> &output_format, const net_flow::PostProcessOpMetadataPtr &custom_op_metadata,
+        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
     static hailo_status add_ops_flows(std::shared_ptr<AsyncPipeline> async_pipeline, const std::pair<std::string, hailo_format_t> &output_format,
         net_flow::PostProcessOpMetadataPtr &op_metadata, const std::vector<std::string> &output_streams_names,
         const std::vector<hailo_vstream_info_t> &vstreams_infos, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos);
@@ -76,6 +88,16 @@ public:
         std::shared_ptr<AsyncPipeline> async_pipeline, const hailo_3d_image_shape_t &src_image_shape, const hailo_format_t &src_format,
         const hailo_3d_image_shape_t &dst_image_shape, const std::vector<hailo_quant_info_t> &dst_quant_infos,
         std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
+    static Expected<std::shared_ptr<AsyncPushQueueElement>> add_pre_post_infer_queue_element(const hailo_nms_info_t &nms_info,
+        std::shared_ptr<AsyncPipeline> async_pipeline, const hailo_3d_image_shape_t &src_image_shape, const hailo_format_t &src_format,
+        std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
+    // Adds the IoU flow elements as a single FusedFilterElement (without the queues between them)
+    static Expected<std::shared_ptr<FusedFilterElement>> add_fused_iou_element(std::shared_ptr<AsyncPipeline> async_pipeline,
+        const hailo_format_t &output_format, const hailo_stream_info_t &output_stream_info,
+        const std::vector<hailo_quant_info_t> &stream_quant_infos, const net_flow::PostProcessOpMetadataPtr &iou_op_metadata);
+    static bool should_run_in_place(const FilterElement &element);
+    // Filters the HW NMS bboxes by the op's score threshold and classes filter before they are de-quantized
+    static hailo_status apply_nms_filters(PostInferElement &post_infer_element, const net_flow::NmsPostProcessConfig &nms_config);
     static Expected<std::shared_ptr<LastAsyncElement>> add_last_async_element(std::shared_ptr<AsyncPipeline> async_pipeline,
         const std::string &output_format_name, size_t frame_size, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
     static Expected<std::shared_ptr<AsyncPushQueueElement>> add_push_queue_element(const std::string &queue_name, std::shared_ptr<AsyncPipeline> async_pipeline,
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file async_pipeline_executor.cpp
+ * @brief Implementation of the async pipeline executor
+ **/
+
+#include "net_flow/pipeline/async_pipeline_executor.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/logger_macros.hpp"
+
+
+namespace hailort
+{
+
+// The worker running on the current thread (if the current thread is a worker)
+static thread_local AsyncPipelineExecutor *s_current_executor = nullptr;
+static thread_local size_t s_current_worker_index = 0;
+
+Expected<std::shared_ptr<AsyncPipelineExecutor>> AsyncPipelineExecutor::create_shared()
+{
+    if (is_env_variable_on(DISABLE_ASYNC_PIPELINE_EXECUTOR_ENV_VAR)) {
+        LOGGER__INFO("Async pipeline executor is disabled, each queue element runs its own thread");
+        return std::shared_ptr<AsyncPipelineExecutor>(nullptr);
+    }
+
+    size_t max_workers_count = DEFAULT_MAX_WORKERS_COUNT;
+    auto max_workers_count_env_var = get_env_variable(ASYNC_PIPELINE_EXECUTOR_MAX_THREADS_ENV_VAR);
+    if (max_workers_count_env_var) {
+        max_workers_count = std::stoul(max_workers_count_env_var.value());
+    }
+
+    return create_shared(max_workers_count);
+}
+
+Expected<std::shared_ptr<AsyncPipelineExecutor>> AsyncPipelineExecutor::create_shared(size_t max_workers_count)
+{
+    CHECK_AS_EXPECTED(max_workers_count > 0, HAILO_INVALID_ARGUMENT,
+        "Async pipeline executor max workers count must be larger than 0");
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto executor = make_shared_nothrow<AsyncPipelineExecutor>(max_workers_count, status);
+    CHECK_NOT_NULL_AS_EXPECTED(executor, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating async pipeline executor");
+    return executor;
+}
+
+AsyncPipelineExecutor::AsyncPipelineExecutor(size_t max_workers_count, hailo_status &status) :
+    m_workers(),
+    m_started_workers_count(0),
+    m_next_worker_index(0),
+    m_pending_tasks_count(0),
+    m_sleeping_workers_count(0),
+    m_pending_wakeups_count(0),
+    m_should_quit(false)
+{
+    m_workers.reserve(max_workers_count);
+    for (size_t i = 0; i < max_workers_count; i++) {
+        auto worker = make_unique_nothrow<Worker>();
+        if (nullptr == worker) {
+            LOGGER__ERROR("Failed allocating async pipeline executor worker");
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        m_workers.emplace_back(std::move(worker));
+    }
+
+    // The first worker is started upfront, the others are started once all workers are busy.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    start_worker();
+    status = HAILO_SUCCESS;
+}
+
+AsyncPipelineExecutor::~AsyncPipelineExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_quit = true;
+    }
+    m_cv.notify_all();
+
+    for (size_t i = 0; i < m_started_workers_count; i++) {
+        auto &thread = m_workers[i]->thread;
+        if (!thread.joinable()) {
+            continue;
+        }
+
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // The last reference was released by a task, the worker exits once the task returns.
+            s_current_executor = nullptr;
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+
+    for (size_t i = 0; i < m_started_workers_count; i++) {
+        if (!m_workers[i]->tasks.empty()) {
+            LOGGER__WARNING("Async pipeline executor is destroyed with {} pending tasks", m_workers[i]->tasks.size());
+        }
+    }
+}
+
+void AsyncPipelineExecutor::execute(Task &&task)
+{
+    const auto worker_index = get_target_worker();
+    {
+        std::lock_guard<std::mutex> lock(m_workers[worker_index]->mutex);
+        m_workers[worker_index]->tasks.emplace_back(std::move(task));
+    }
+    m_pending_tasks_count++;
+
+    bool should_notify = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_sleeping_workers_count > 0) {
+            // Claiming the worker, so another task executed before it wakes up won't count on it.
+            m_sleeping_workers_count--;
+            m_pending_wakeups_count++;
+            should_notify = true;
+        } else if (m_started_workers_count < m_workers.size()) {
+            // All workers are busy (they may be blocked downstream) - the task must not wait for them.
+            start_worker();
+        }
+    }
+
+    if (should_notify) {
+        m_cv.notify_one();
+    }
+}
+
+size_t AsyncPipelineExecutor::get_target_worker()
+{
+    if (this == s_current_executor) {
+        return s_current_worker_index;
+    }
+    return m_next_worker_index++ % m_started_workers_count;
+}
+
+void AsyncPipelineExecutor::start_worker()
+{
+    const size_t worker_index = m_started_workers_count;
+    assert(worker_index < m_workers.size());
+    m_workers[worker_index]->thread = std::thread([this, worker_index]() { worker_thread(worker_index); });
+    m_started_workers_count++;
+}
+
+bool AsyncPipelineExecutor::try_pop_task(size_t worker_index, Task &task)
+{
+    // Own tasks first, then steal from the other workers
+    const size_t workers_count = m_started_workers_count;
+    for (size_t i = 0; i < workers_count; i++) {
+        auto &worker = *m_workers[(worker_index + i) % workers_count];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void AsyncPipelineExecutor::worker_thread(size_t worker_index)
+{
+    OsUtils::set_current_thread_name("HRT_PIPE_" + std::to_string(worker_index));
+    s_current_executor = this;
+    s_current_worker_index = worker_index;
+
+    while (true) {
+        Task task;
+        if (try_pop_task(worker_index, task)) {
+            m_pending_tasks_count--;
+            task();
+            if (this != s_current_executor) {
+                // The executor was destroyed by the task
+                return;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_should_quit) {
+            break;
+        }
+        if (m_pending_tasks_count > 0) {
+            // A task was pushed after the deques were checked
+            continue;
+        }
+
+        m_sleeping_workers_count++;
+        m_cv.wait(lock, [this]() { return m_should_quit || (m_pending_wakeups_count > 0); });
+        if (m_should_quit) {
+            break;
+        }
+        m_pending_wakeups_count--;
+    }
+
+    s_current_executor = nullptr;
+}
+
+} /* namespace hailort */
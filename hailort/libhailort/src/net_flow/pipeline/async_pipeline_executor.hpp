@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file async_pipeline_executor.hpp
+ * @brief Work-stealing thread pool running the queue elements of the async pipelines of a VDevice.
+ *
+ * Each worker has its own tasks deque. Tasks executed from a worker are pushed to its own deque (so the following
+ * elements of a pipeline keep running on the same thread), other tasks are distributed between the workers, and an
+ * idle worker steals tasks from the other workers deques.
+ * Workers are created on demand - a new worker is created only if no worker is idle when a task is executed (up to
+ * the maximum workers count), so the amount of threads follows the amount of elements running concurrently rather
+ * than the amount of elements.
+ * Note: The executor doesn't order the tasks - an element has to make sure that at most one of its tasks is executed at
+ *       a time.
+ **/
+
+#ifndef _HAILO_ASYNC_PIPELINE_EXECUTOR_HPP_
+#define _HAILO_ASYNC_PIPELINE_EXECUTOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace hailort
+{
+
+#define DISABLE_ASYNC_PIPELINE_EXECUTOR_ENV_VAR ("HAILO_DISABLE_ASYNC_PIPELINE_EXECUTOR")
+#define ASYNC_PIPELINE_EXECUTOR_MAX_THREADS_ENV_VAR ("HAILO_ASYNC_PIPELINE_EXECUTOR_MAX_THREADS")
+
+class AsyncPipelineExecutor final
+{
+public:
+    using Task = std::function<void()>;
+
+    static constexpr size_t DEFAULT_MAX_WORKERS_COUNT = 64;
+
+    // Returns nullptr if the executor is disabled (each queue element runs its own thread).
+    static Expected<std::shared_ptr<AsyncPipelineExecutor>> create_shared();
+    static Expected<std::shared_ptr<AsyncPipelineExecutor>> create_shared(size_t max_workers_count);
+
+    AsyncPipelineExecutor(size_t max_workers_count, hailo_status &status);
+    ~AsyncPipelineExecutor();
+
+    AsyncPipelineExecutor(const AsyncPipelineExecutor &) = delete;
+    AsyncPipelineExecutor &operator=(const AsyncPipelineExecutor &) = delete;
+    AsyncPipelineExecutor(AsyncPipelineExecutor &&) = delete;
+    AsyncPipelineExecutor &operator=(AsyncPipelineExecutor &&) = delete;
+
+    void execute(Task &&task);
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    void worker_thread(size_t worker_index);
+    bool try_pop_task(size_t worker_index, Task &task);
+    // Returns the worker the task is pushed to.
+    size_t get_target_worker();
+    // m_mutex must be held.
+    void start_worker();
+
+    // The workers are allocated on creation and their threads are started on demand, so m_workers is never resized
+    // while the workers access it.
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<size_t> m_started_workers_count;
+    std::atomic<size_t> m_next_worker_index;
+    std::atomic<size_t> m_pending_tasks_count;
+
+    // Guards the sleeping workers bookkeeping
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    size_t m_sleeping_workers_count;
+    // Sleeping workers that were claimed by execute() and haven't woken up yet
+    size_t m_pending_wakeups_count;
+    bool m_should_quit;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_ASYNC_PIPELINE_EXECUTOR_HPP_ */
@@ -25,6 +25,9 @@ Expected<OutputBindingsOnStack> OutputBindingsOnStack::create(ConfiguredInferMod
     std::unordered_map<std::string, InferStreamOnStack> output_streams;
     for (const auto &output_name : outputs_names) {
         TRY(auto output, bindings.output(output_name));
+        if (BufferType::DMA_BUFFER == ConfiguredInferModelBase::get_infer_stream_buffer_type(output)) {
+            continue;
+        }
         TRY(auto buffer, output.get_buffer());
         output_streams.emplace(output_name, InferStreamOnStack(buffer));
     }
@@ -54,31 +57,50 @@ hailo_status AsyncInferJobHrpcClient::wait(std::chrono::milliseconds timeout)
     return m_event->wait(timeout);
 }
 
-CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names) :
-    m_outputs_names(outputs_names)
+CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names,
+    const std::vector<std::string> &compact_outputs_names) :
+    m_outputs_names(outputs_names),
+    m_compact_outputs_names(compact_outputs_names.begin(), compact_outputs_names.end())
 {
     client->register_custom_reply(HailoRpcActionID::CALLBACK_CALLED,
     [this, &outputs_names] (const MemoryView &serialized_reply, hrpc::RpcConnection connection) -> hailo_status {
         TRY(auto tuple, CallbackCalledSerializer::deserialize_reply(serialized_reply));
 
         auto callback_status = std::get<0>(tuple);
-        auto callback_handle_id = std::get<1>(tuple);
+        auto first_callback_handle_id = std::get<1>(tuple);
+        auto frames_count = std::get<2>(tuple);
 
         {
             std::unique_lock<std::mutex> lock(m_mutex);
-            CHECK(contains(m_callbacks, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
-            m_callbacks_status[callback_handle_id] = callback_status;
-
-            if (HAILO_SUCCESS == callback_status) {
-                CHECK(contains(m_bindings, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
-                for (const auto &output_name : outputs_names) {
-                    TRY(auto buffer, m_bindings.at(callback_handle_id).output(output_name)->get_buffer());
-                    auto status = connection.read_buffer(buffer);
-                    // TODO: Errors here should be unrecoverable (HRT-14275)
-                    CHECK_SUCCESS(status);
+            // The message completes the frames' callbacks, followed by the outputs of the frames (frame after frame)
+            for (uint32_t i = 0; i < frames_count; i++) {
+                const callback_id_t callback_handle_id = first_callback_handle_id + i;
+                CHECK(contains(m_callbacks, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
+                m_callbacks_status[callback_handle_id] = callback_status;
+
+                if (HAILO_SUCCESS == callback_status) {
+                    CHECK(contains(m_bindings, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
+                    for (const auto &output_name : outputs_names) {
+                        if (!m_bindings.at(callback_handle_id).has_output(output_name)) {
+                            continue; // Bound to a dmabuf, already written by the server
+                        }
+                        TRY(auto buffer, m_bindings.at(callback_handle_id).output(output_name)->get_buffer());
+                        if (contains(m_compact_outputs_names, output_name)) {
+                            // Only the valid prefix of the frame is received, the rest of the buffer isn't used
+                            uint32_t valid_size = 0;
+                            auto status = connection.read_buffer(MemoryView(&valid_size, sizeof(valid_size)));
+                            CHECK_SUCCESS(status);
+                            CHECK(valid_size <= buffer.size(), HAILO_INTERNAL_FAILURE,
+                                "Got {} bytes of output {}, larger than its frame ({} bytes)", valid_size, output_name, buffer.size());
+                            buffer = MemoryView(buffer.data(), valid_size);
+                        }
+                        auto status = connection.read_buffer(buffer);
+                        // TODO: Errors here should be unrecoverable (HRT-14275)
+                        CHECK_SUCCESS(status);
+                    }
                 }
+                m_callbacks_queue.push(callback_handle_id);
             }
-            m_callbacks_queue.push(callback_handle_id);
         }
 
         m_cv.notify_one();
@@ -112,7 +134,8 @@ CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::
                 m_callbacks_status.erase(callback_id);
                 m_bindings.erase(callback_id);
             }
-            AsyncInferCompletionInfo info(info_status);
+            // The callback ids of the model are consecutive, starting from 1
+            AsyncInferCompletionInfo info(info_status, static_cast<uint64_t>(callback_id - 1));
             cb(info);
         }
     });
@@ -228,20 +251,112 @@ hailo_status ConfiguredInferModelHrpcClient::wait_for_async_ready(std::chrono::m
 Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async(ConfiguredInferModel::Bindings bindings,
     std::function<void(const AsyncInferCompletionInfo &)> callback)
 {
-    auto async_job = run_async_impl(bindings, callback);
-    if (HAILO_SUCCESS != async_job.status()) {
+    auto async_jobs = run_async_impl({bindings}, callback);
+    if (HAILO_SUCCESS != async_jobs.status()) {
         shutdown();
-        return make_unexpected(async_job.status());
+        return make_unexpected(async_jobs.status());
     }
-    return async_job.release();
+    return AsyncInferJobBase::create(async_jobs->at(0));
 }
 
-Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(ConfiguredInferModel::Bindings bindings,
-    std::function<void(const AsyncInferCompletionInfo &)> callback)
+hailo_status ConfiguredInferModelHrpcClient::run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback)
+{
+    // The frames are sent in requests of up to MAX_FRAMES_PER_RUN_ASYNC_REQUEST frames, each completed by a single
+    // callback message
+    for (size_t first_frame = 0; first_frame < bindings.size(); first_frame += MAX_FRAMES_PER_RUN_ASYNC_REQUEST) {
+        const auto last_frame = std::min(first_frame + MAX_FRAMES_PER_RUN_ASYNC_REQUEST, bindings.size());
+        std::vector<ConfiguredInferModel::Bindings> request_bindings(bindings.begin() + first_frame,
+            bindings.begin() + last_frame);
+        TRY(auto async_jobs, run_async_impl(request_bindings, frame_done_callback));
+        (void)async_jobs;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+Expected<std::vector<bool>> ConfiguredInferModelHrpcClient::get_dma_buffer_edges(
+    std::vector<ConfiguredInferModel::Bindings> &bindings)
 {
-    CHECK_SUCCESS_AS_EXPECTED(validate_bindings(bindings));
+    std::vector<bool> dma_buffer_edges;
+    bool has_dma_buffers = false;
+    for (auto &frame_bindings : bindings) {
+        for (const auto &input_vstream : m_input_vstream_infos) {
+            TRY(auto input, frame_bindings.input(input_vstream.name));
+            const auto is_dma_buffer = (BufferType::DMA_BUFFER == ConfiguredInferModelBase::get_infer_stream_buffer_type(input));
+            dma_buffer_edges.push_back(is_dma_buffer);
+            has_dma_buffers |= is_dma_buffer;
+        }
+        for (const auto &output_vstream : m_output_vstream_infos) {
+            TRY(auto output, frame_bindings.output(output_vstream.name));
+            const auto is_dma_buffer = (BufferType::DMA_BUFFER == ConfiguredInferModelBase::get_infer_stream_buffer_type(output));
+            dma_buffer_edges.push_back(is_dma_buffer);
+            has_dma_buffers |= is_dma_buffer;
+        }
+    }
+
+    if (!has_dma_buffers) {
+        dma_buffer_edges.clear();
+    }
+    return dma_buffer_edges;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::write_frame(hrpc::RpcConnection connection,
+    ConfiguredInferModel::Bindings &bindings)
+{
+    for (const auto &input_vstream : m_input_vstream_infos) {
+        TRY(auto input, bindings.input(input_vstream.name));
+        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
+        switch(buffer_type) {
+        case BufferType::VIEW:
+        {
+            TRY(auto buffer, input.get_buffer());
+            auto status = connection.write_buffer(MemoryView(buffer));
+            CHECK_SUCCESS(status);
+            break;
+        }
+        case BufferType::PIX_BUFFER:
+        {
+            TRY(auto pix_buffer, input.get_pix_buffer());
+            for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
+                auto status = connection.write_buffer(MemoryView(pix_buffer.planes[i].user_ptr, pix_buffer.planes[i].bytes_used));
+                CHECK_SUCCESS(status);
+            }
+            break;
+        }
+        case BufferType::DMA_BUFFER:
+        {
+            TRY(auto dma_buffer, input.get_dma_buffer());
+            auto status = connection.write_fd(dma_buffer.fd);
+            CHECK_SUCCESS(status);
+            break;
+        }
+        default:
+            LOGGER__CRITICAL("Unknown buffer type");
+            return HAILO_INTERNAL_FAILURE;
+        }
+    }
+
+    for (const auto &output_vstream : m_output_vstream_infos) {
+        TRY(auto output, bindings.output(output_vstream.name));
+        if (BufferType::DMA_BUFFER == ConfiguredInferModelBase::get_infer_stream_buffer_type(output)) {
+            TRY(auto dma_buffer, output.get_dma_buffer());
+            auto status = connection.write_fd(dma_buffer.fd);
+            CHECK_SUCCESS(status);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+Expected<std::vector<std::shared_ptr<AsyncInferJobHrpcClient>>> ConfiguredInferModelHrpcClient::run_async_impl(
+    std::vector<ConfiguredInferModel::Bindings> bindings, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    for (const auto &frame_bindings : bindings) {
+        CHECK_SUCCESS_AS_EXPECTED(validate_bindings(frame_bindings));
+    }
+    const auto frames_count = static_cast<uint32_t>(bindings.size());
+
     std::unique_lock<std::mutex> lock(m_infer_mutex);
-    m_callbacks_counter++;
     auto callback_wrapper = [this, callback] (const AsyncInferCompletionInfo &info) {
         {
             std::unique_lock<std::mutex> transfers_lock(m_ongoing_transfers_mutex);
@@ -253,55 +368,48 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(Configure
         }
     };
 
-    TRY(auto job_ptr, m_callbacks_queue->register_callback(m_callbacks_counter, bindings, callback_wrapper));
-
-    TRY(auto request, RunAsyncSerializer::serialize_request(m_handle_id, m_infer_model_handle_id,
-        m_callbacks_counter));
+    // The frames use consecutive callback ids, starting from first_callback_id
+    const callback_id_t first_callback_id = m_callbacks_counter + 1;
+    std::vector<std::shared_ptr<AsyncInferJobHrpcClient>> jobs;
+    jobs.reserve(frames_count);
+    for (const auto &frame_bindings : bindings) {
+        m_callbacks_counter++;
+        TRY(auto job_ptr, m_callbacks_queue->register_callback(m_callbacks_counter, frame_bindings, callback_wrapper));
+        jobs.emplace_back(job_ptr);
+    }
 
     auto client = m_client.lock();
     CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto serialized_result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+
+    TRY(auto dma_buffer_edges, get_dma_buffer_edges(bindings));
+    CHECK_AS_EXPECTED(dma_buffer_edges.empty() || client->is_fd_passing_supported(), HAILO_NOT_SUPPORTED,
+        "DMA_BUFFER is supported in HRPC only over unix sockets (HAILO_FORCE_SOCKET_COM=1)");
+
+    TRY(auto request, RunAsyncSerializer::serialize_request(m_handle_id, m_infer_model_handle_id,
+        first_callback_id, frames_count, dma_buffer_edges, client->get_hot_messages_format()));
+    TRY(auto pending_request, client->send_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
         MemoryView(request), [this, &bindings] (hrpc::RpcConnection connection) -> hailo_status {
-        for (const auto &input_vstream : m_input_vstream_infos) {
-            TRY(auto input, bindings.input(input_vstream.name));
-            auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
-            switch(buffer_type) {
-            case BufferType::VIEW:
-            {
-                TRY(auto buffer, input.get_buffer());
-                auto status = connection.write_buffer(MemoryView(buffer));
-                CHECK_SUCCESS(status);
-                break;
-            }
-            case BufferType::PIX_BUFFER:
-            {
-                TRY(auto pix_buffer, input.get_pix_buffer());
-                for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
-                    auto status = connection.write_buffer(MemoryView(pix_buffer.planes[i].user_ptr, pix_buffer.planes[i].bytes_used));
-                    CHECK_SUCCESS(status);
-                }
-                break;
-            }
-            case BufferType::DMA_BUFFER:
-                LOGGER__CRITICAL("DMA_BUFFER is not supported in HRPC");
-                return HAILO_NOT_IMPLEMENTED;
-            default:
-                LOGGER__CRITICAL("Unknown buffer type");
-                return HAILO_INTERNAL_FAILURE;
-            }
+        for (auto &frame_bindings : bindings) {
+            auto status = write_frame(connection, frame_bindings);
+            CHECK_SUCCESS(status);
         }
         return HAILO_SUCCESS;
     }));
-    auto status = RunAsyncSerializer::deserialize_reply(MemoryView(serialized_result));
-    CHECK_SUCCESS_AS_EXPECTED(status);
 
+    // Counted as soon as they are sent, as the server may finish the transfers before the reply is read
     {
         std::unique_lock<std::mutex> transfers_lock(m_ongoing_transfers_mutex);
-        m_ongoing_transfers++;
+        m_ongoing_transfers += frames_count;
     }
 
-    return AsyncInferJobBase::create(job_ptr);
+    // Once the request is written, the next run_async may be sent while waiting for this one's reply
+    lock.unlock();
+    TRY(auto serialized_result, client->wait_for_reply(pending_request));
+    auto status = RunAsyncSerializer::deserialize_reply(MemoryView(serialized_result));
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    return jobs;
 }
 
 hailo_status ConfiguredInferModelHrpcClient::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
@@ -340,6 +448,68 @@ hailo_status ConfiguredInferModelHrpcClient::set_scheduler_priority(uint8_t prio
     return HAILO_SUCCESS;
 }
 
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_deadline(const std::chrono::milliseconds &/*deadline*/)
+{
+    LOGGER__ERROR("Setting scheduler's deadline is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_share(uint32_t /*share*/)
+{
+    LOGGER__ERROR("Setting scheduler's share is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_device_affinity(uint64_t /*device_mask*/)
+{
+    LOGGER__ERROR("Setting scheduler's device affinity is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_sticky_placement(bool /*is_sticky*/)
+{
+    LOGGER__ERROR("Setting scheduler's sticky placement is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_pinned_device(uint32_t /*device_index*/)
+{
+    LOGGER__ERROR("Setting scheduler's pinned device is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_burst_size_bounds(uint32_t /*min_burst_size*/,
+    uint32_t /*max_burst_size*/)
+{
+    LOGGER__ERROR("Setting scheduler's burst size bounds is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_batch_size(uint16_t /*batch_size*/)
+{
+    LOGGER__ERROR("Setting scheduler's batch size is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelHrpcClient::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t /*policy*/,
+    uint32_t /*max_pending_frames*/)
+{
+    LOGGER__ERROR("Setting scheduler's overload policy is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<hailo_scheduler_overload_stats_t> ConfiguredInferModelHrpcClient::get_scheduler_overload_stats()
+{
+    LOGGER__ERROR("Getting scheduler's overload stats is not supported on remote devices");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<std::vector<PipelineElementLatencyResults>> ConfiguredInferModelHrpcClient::get_pipeline_elements_latency()
+{
+    LOGGER__ERROR("Getting pipeline elements latency is not supported on remote devices");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 Expected<LatencyMeasurementResult> ConfiguredInferModelHrpcClient::get_hw_latency_measurement()
 {
     TRY(auto serialized_request, GetHwLatencyMeasurementSerializer::serialize_request(m_handle_id));
@@ -394,6 +564,22 @@ Expected<size_t> ConfiguredInferModelHrpcClient::get_async_queue_size()
     return queue_size;
 }
 
+hailo_status ConfiguredInferModelHrpcClient::set_completion_order(ConfiguredInferModel::CompletionOrder order,
+    uint32_t max_skew)
+{
+    (void)order;
+    (void)max_skew;
+    LOGGER__ERROR("Setting the completion order is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<std::string> ConfiguredInferModelHrpcClient::get_pipeline_graph(ConfiguredInferModel::PipelineGraphFormat format)
+{
+    (void)format;
+    LOGGER__ERROR("Getting the pipeline graph is not supported on remote devices");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 hailo_status ConfiguredInferModelHrpcClient::validate_bindings(ConfiguredInferModel::Bindings bindings)
 {
     for (const auto &input_vstream : m_input_vstream_infos) {
@@ -467,6 +653,12 @@ hailo_status ConfiguredInferModelHrpcClient::validate_bindings(ConfiguredInferMo
     return HAILO_SUCCESS;
 }
 
+hailo_status ConfiguredInferModelHrpcClient::recover()
+{
+    LOGGER__ERROR("Recovering a model is not supported on remote devices");
+    return HAILO_NOT_SUPPORTED;
+}
+
 hailo_status ConfiguredInferModelHrpcClient::shutdown()
 {
     TRY(auto serialized_request, ShutdownSerializer::serialize_request(m_handle_id));
@@ -19,6 +19,10 @@ namespace hailort
 
 using callback_id_t = uint32_t;
 
+// Frames of a multiple-bindings run_async sent in one request (and completed by one callback message). Bounded, as the
+// server holds the buffers of all of the request's frames until the whole request is done.
+static constexpr size_t MAX_FRAMES_PER_RUN_ASYNC_REQUEST = 4;
+
 class InferStreamOnStack final
 {
 public:
@@ -29,6 +33,7 @@ private:
     MemoryView m_buffer;
 };
 
+// The outputs read back from the server (the outputs bound to dmabufs are written by the server directly, so they aren't kept)
 class OutputBindingsOnStack final
 {
 public:
@@ -36,6 +41,7 @@ public:
         const std::vector<std::string> &outputs_names);
     Expected<InferStreamOnStack> output();
     Expected<InferStreamOnStack> output(const std::string &name);
+    bool has_output(const std::string &name) const { return contains(m_output_streams, name); }
 
 private:
     OutputBindingsOnStack(std::unordered_map<std::string, InferStreamOnStack> &&output_streams) :
@@ -58,7 +64,9 @@ private:
 class CallbacksQueue
 {
 public:
-    CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names);
+    // The compact outputs are received as their valid bytes only, preceded by their size (see NmsFrameUtils)
+    CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names,
+        const std::vector<std::string> &compact_outputs_names = {});
     ~CallbacksQueue();
 
     CallbacksQueue(const CallbacksQueue &other) = delete;
@@ -72,6 +80,7 @@ public:
 
 private:
     const std::vector<std::string> m_outputs_names;
+    const std::unordered_set<std::string> m_compact_outputs_names;
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<callback_id_t> m_callbacks_queue;
@@ -116,21 +125,42 @@ public:
 
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback) override;
+    virtual hailo_status run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback) override;
 
     virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() override;
 
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline) override;
+    virtual hailo_status set_scheduler_share(uint32_t share) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats() override;
+    virtual Expected<std::vector<PipelineElementLatencyResults>> get_pipeline_elements_latency() override;
 
     virtual Expected<size_t> get_async_queue_size() override;
+    virtual hailo_status set_completion_order(ConfiguredInferModel::CompletionOrder order, uint32_t max_skew) override;
+    virtual Expected<std::string> get_pipeline_graph(ConfiguredInferModel::PipelineGraphFormat format) override;
 
+    virtual hailo_status recover() override;
     virtual hailo_status shutdown() override;
 
 private:
     virtual hailo_status validate_bindings(ConfiguredInferModel::Bindings bindings);
-    Expected<AsyncInferJob> run_async_impl(ConfiguredInferModel::Bindings bindings,
-        std::function<void(const AsyncInferCompletionInfo &)> callback);
+    // Sends the frames in a single request, returning a job per frame
+    Expected<std::vector<std::shared_ptr<AsyncInferJobHrpcClient>>> run_async_impl(
+        std::vector<ConfiguredInferModel::Bindings> bindings, std::function<void(const AsyncInferCompletionInfo &)> callback);
+    // Writes the frame's inputs, followed by the fds of its outputs bound to dmabufs
+    hailo_status write_frame(hrpc::RpcConnection connection, ConfiguredInferModel::Bindings &bindings);
+    // Returns which edges are bound to dmabufs, in the order of ConfiguredInferModel_AsyncInfer_Request (empty if none is)
+    Expected<std::vector<bool>> get_dma_buffer_edges(std::vector<ConfiguredInferModel::Bindings> &bindings);
 
     std::weak_ptr<hrpc::Client> m_client;
     rpc_object_handle_t m_handle_id;
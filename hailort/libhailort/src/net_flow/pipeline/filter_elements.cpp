@@ -9,6 +9,7 @@
 
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "net_flow/pipeline/filter_elements.hpp"
+#include "transform/transform_internal.hpp"
 
 namespace hailort
 {
@@ -18,7 +19,9 @@ FilterElement::FilterElement(const std::string &name, DurationCollector &&durati
                              PipelineDirection pipeline_direction,
                              std::chrono::milliseconds timeout, std::shared_ptr<AsyncPipeline> async_pipeline) :
     IntermediateElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, async_pipeline),
-    m_timeout(timeout)
+    m_timeout(timeout),
+    m_output_buffer_pool(nullptr),
+    m_is_in_place(false)
 {}
 
 hailo_status FilterElement::run_push(PipelineBuffer &&buffer, const PipelinePad &/*sink*/)
@@ -44,7 +47,13 @@ void FilterElement::run_push_async(PipelineBuffer &&buffer, const PipelinePad &/
 {
     assert(m_pipeline_direction == PipelineDirection::PUSH);
     if (HAILO_SUCCESS != buffer.action_status()) {
-        auto pool = next_pad().element().get_buffer_pool();
+        if (m_is_in_place) {
+            // The input buffer takes the place of the output buffer
+            next_pad().run_push_async(std::move(buffer));
+            return;
+        }
+
+        auto pool = get_output_buffer_pool();
         assert(pool);
 
         auto buffer_from_pool = pool->get_available_buffer(PipelineBuffer(), m_timeout);
@@ -83,6 +92,35 @@ PipelinePad &FilterElement::next_pad_upstream()
     return *m_sinks[0].prev();
 }
 
+BufferPoolPtr FilterElement::get_output_buffer_pool()
+{
+    if (nullptr != m_output_buffer_pool) {
+        return m_output_buffer_pool;
+    }
+    return next_pad_downstream().element().get_buffer_pool();
+}
+
+void FilterElement::set_output_buffer_pool(BufferPoolPtr output_buffer_pool)
+{
+    m_output_buffer_pool = output_buffer_pool;
+}
+
+bool FilterElement::is_in_place_capable() const
+{
+    return false;
+}
+
+void FilterElement::set_in_place(bool is_in_place)
+{
+    assert(!is_in_place || is_in_place_capable());
+    m_is_in_place = is_in_place;
+}
+
+bool FilterElement::is_in_place() const
+{
+    return m_is_in_place;
+}
+
 Expected<std::shared_ptr<PreInferElement>> PreInferElement::create(const hailo_3d_image_shape_t &src_image_shape, const hailo_format_t &src_format,
     const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos,
     const std::string &name, std::chrono::milliseconds timeout, hailo_pipeline_elem_stats_flags_t elem_flags,
@@ -90,7 +128,7 @@ Expected<std::shared_ptr<PreInferElement>> PreInferElement::create(const hailo_3
 {
     TRY(auto transform_context,
         InputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format,
-            dst_quant_infos), "Failed Creating InputTransformContext");
+            dst_quant_infos, TransformContextUtils::get_pipeline_max_threads_count()), "Failed Creating InputTransformContext");
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
 
     auto pre_infer_elem_ptr = make_shared_nothrow<PreInferElement>(std::move(transform_context),
@@ -154,7 +192,7 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     }
 
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto transformed_buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -189,6 +227,293 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     return transformed_buffer.release();
 }
 
+#define RESIZE_WEIGHT_BITS (8)
+#define RESIZE_WEIGHT_ONE (1 << RESIZE_WEIGHT_BITS)
+// Rounding of a pixel interpolated on both axes (weighted twice)
+#define RESIZE_ROUNDING (1 << ((2 * RESIZE_WEIGHT_BITS) - 1))
+
+// A crop of 0 width (or height) is the whole frame
+static InputResizeParams expand_resize_crop(const InputResizeParams &params)
+{
+    auto expanded_params = params;
+    if ((0 == params.crop_width) || (0 == params.crop_height)) {
+        expanded_params.crop_x = 0;
+        expanded_params.crop_y = 0;
+        expanded_params.crop_width = params.src_width;
+        expanded_params.crop_height = params.src_height;
+    }
+    return expanded_params;
+}
+
+hailo_status ResizeElement::validate_params(const InputResizeParams &params, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    CHECK((params.src_width > 0) && (params.src_height > 0), HAILO_INVALID_ARGUMENT,
+        "Invalid resize source shape {}x{}", params.src_width, params.src_height);
+    CHECK((HAILO_FORMAT_ORDER_NHWC == params.src_order) || (HAILO_FORMAT_ORDER_NV12 == params.src_order),
+        HAILO_INVALID_ARGUMENT, "Resize of {} frames isn't supported", HailoRTCommon::get_format_order_str(params.src_order));
+    if (HAILO_FORMAT_ORDER_NV12 == params.src_order) {
+        CHECK(3 == dst_image_shape.features, HAILO_INVALID_ARGUMENT,
+            "Resize of NV12 frames is supported for inputs with 3 features (the input has {})", dst_image_shape.features);
+        CHECK((0 == (params.src_width % 2)) && (0 == (params.src_height % 2)), HAILO_INVALID_ARGUMENT,
+            "The shape of NV12 frames must be even (got {}x{})", params.src_width, params.src_height);
+    }
+
+    const auto crop = expand_resize_crop(params);
+    CHECK((static_cast<uint64_t>(crop.crop_x) + crop.crop_width <= crop.src_width) &&
+        (static_cast<uint64_t>(crop.crop_y) + crop.crop_height <= crop.src_height), HAILO_INVALID_ARGUMENT,
+        "Resize crop ({},{} {}x{}) exceeds the source frame ({}x{})", crop.crop_x, crop.crop_y, crop.crop_width,
+        crop.crop_height, crop.src_width, crop.src_height);
+
+    return HAILO_SUCCESS;
+}
+
+size_t ResizeElement::get_src_frame_size(const InputResizeParams &params, uint32_t features)
+{
+    const auto pixels_count = static_cast<size_t>(params.src_width) * params.src_height;
+    // NV12 - a Y plane followed by an interleaved UV plane of half the width and height
+    return (HAILO_FORMAT_ORDER_NV12 == params.src_order) ? ((pixels_count * 3) / 2) : (pixels_count * features);
+}
+
+Expected<std::shared_ptr<ResizeElement>> ResizeElement::create(const InputResizeParams &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate_params(params, dst_image_shape));
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+
+    auto pipeline_status = build_params.pipeline_status;
+    auto resize_elem_ptr = make_shared_nothrow<ResizeElement>(expand_resize_crop(params), dst_image_shape, name,
+        build_params.timeout, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != resize_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", resize_elem_ptr->description());
+
+    return resize_elem_ptr;
+}
+
+ResizeElement::ResizeElement(const InputResizeParams &params, const hailo_3d_image_shape_t &dst_image_shape,
+    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+    std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+    std::shared_ptr<AsyncPipeline> async_pipeline) :
+    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
+    m_params(params),
+    m_dst_image_shape(dst_image_shape),
+    m_dst_x(0),
+    m_dst_y(0),
+    m_dst_width(dst_image_shape.width),
+    m_dst_height(dst_image_shape.height)
+{
+    if (m_params.keep_aspect_ratio) {
+        const auto scale = std::min(static_cast<double>(dst_image_shape.width) / m_params.crop_width,
+            static_cast<double>(dst_image_shape.height) / m_params.crop_height);
+        m_dst_width = std::min(dst_image_shape.width,
+            std::max(1u, static_cast<uint32_t>(std::lround(m_params.crop_width * scale))));
+        m_dst_height = std::min(dst_image_shape.height,
+            std::max(1u, static_cast<uint32_t>(std::lround(m_params.crop_height * scale))));
+        m_dst_x = (dst_image_shape.width - m_dst_width) / 2;
+        m_dst_y = (dst_image_shape.height - m_dst_height) / 2;
+    }
+
+    m_x_samples = create_axis_samples(m_params.crop_width, m_dst_width);
+    m_y_samples = create_axis_samples(m_params.crop_height, m_dst_height);
+    m_row_buffer.resize(static_cast<size_t>(m_params.crop_width) * dst_image_shape.features);
+}
+
+std::vector<ResizeElement::AxisSample> ResizeElement::create_axis_samples(uint32_t src_size, uint32_t dst_size)
+{
+    std::vector<AxisSample> samples(dst_size);
+    const auto scale = static_cast<float32_t>(src_size) / static_cast<float32_t>(dst_size);
+    const auto last_position = static_cast<float32_t>(src_size - 1);
+    for (uint32_t i = 0; i < dst_size; i++) {
+        // The centers of the source and destination pixels are aligned
+        const auto position = std::min(std::max(((static_cast<float32_t>(i) + 0.5f) * scale) - 0.5f, 0.0f), last_position);
+        const auto first = static_cast<uint32_t>(position);
+        samples[i].first = first;
+        samples[i].second = std::min(first + 1, src_size - 1);
+        samples[i].second_weight = static_cast<uint32_t>(std::lround((position - static_cast<float32_t>(first)) * RESIZE_WEIGHT_ONE));
+    }
+    return samples;
+}
+
+void ResizeElement::resize_nhwc(const uint8_t *src, uint8_t *dst)
+{
+    const auto channels = m_dst_image_shape.features;
+    const auto src_stride = static_cast<size_t>(m_params.src_width) * channels;
+    const auto dst_stride = static_cast<size_t>(m_dst_image_shape.width) * channels;
+    const auto crop_row_size = static_cast<size_t>(m_params.crop_width) * channels;
+    const auto *crop = src + (m_params.crop_y * src_stride) + (static_cast<size_t>(m_params.crop_x) * channels);
+    auto *row_buffer = m_row_buffer.data();
+
+    for (uint32_t y = 0; y < m_dst_height; y++) {
+        const auto &y_sample = m_y_samples[y];
+        const auto *first_row = crop + (y_sample.first * src_stride);
+        const auto *second_row = crop + (y_sample.second * src_stride);
+        const auto first_weight = RESIZE_WEIGHT_ONE - y_sample.second_weight;
+        const auto second_weight = y_sample.second_weight;
+        // The vertical pass runs over contiguous rows, so the compiler vectorizes it
+        for (size_t i = 0; i < crop_row_size; i++) {
+            row_buffer[i] = (first_row[i] * first_weight) + (second_row[i] * second_weight);
+        }
+
+        auto *dst_row = dst + ((m_dst_y + y) * dst_stride) + (static_cast<size_t>(m_dst_x) * channels);
+        for (uint32_t x = 0; x < m_dst_width; x++) {
+            const auto &x_sample = m_x_samples[x];
+            const auto *first_pixel = row_buffer + (x_sample.first * channels);
+            const auto *second_pixel = row_buffer + (x_sample.second * channels);
+            for (uint32_t c = 0; c < channels; c++) {
+                const auto value = (first_pixel[c] * (RESIZE_WEIGHT_ONE - x_sample.second_weight)) +
+                    (second_pixel[c] * x_sample.second_weight);
+                dst_row[(x * channels) + c] = static_cast<uint8_t>((value + RESIZE_ROUNDING) >> (2 * RESIZE_WEIGHT_BITS));
+            }
+        }
+    }
+}
+
+static inline uint8_t clamp_to_uint8(int32_t value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+void ResizeElement::resize_nv12(const uint8_t *src, uint8_t *dst)
+{
+    const auto src_stride = static_cast<size_t>(m_params.src_width);
+    const auto dst_stride = static_cast<size_t>(m_dst_image_shape.width) * 3;
+    const auto *crop = src + (m_params.crop_y * src_stride) + m_params.crop_x;
+    // The UV plane has half the rows, each with width / 2 interleaved UV pairs (so the same stride)
+    const auto *uv_plane = src + (src_stride * m_params.src_height);
+    auto *row_buffer = m_row_buffer.data();
+
+    for (uint32_t y = 0; y < m_dst_height; y++) {
+        const auto &y_sample = m_y_samples[y];
+        const auto *first_row = crop + (y_sample.first * src_stride);
+        const auto *second_row = crop + (y_sample.second * src_stride);
+        const auto first_weight = RESIZE_WEIGHT_ONE - y_sample.second_weight;
+        const auto second_weight = y_sample.second_weight;
+        for (size_t i = 0; i < m_params.crop_width; i++) {
+            row_buffer[i] = (first_row[i] * first_weight) + (second_row[i] * second_weight);
+        }
+
+        // The chroma is subsampled, so it is taken from the nearest UV pair
+        const auto *uv_row = uv_plane + (((m_params.crop_y + y_sample.first) / 2) * src_stride);
+        auto *dst_row = dst + ((m_dst_y + y) * dst_stride) + (static_cast<size_t>(m_dst_x) * 3);
+        for (uint32_t x = 0; x < m_dst_width; x++) {
+            const auto &x_sample = m_x_samples[x];
+            const auto luma = ((row_buffer[x_sample.first] * (RESIZE_WEIGHT_ONE - x_sample.second_weight)) +
+                (row_buffer[x_sample.second] * x_sample.second_weight) + RESIZE_ROUNDING) >> (2 * RESIZE_WEIGHT_BITS);
+            const auto *uv = uv_row + (((m_params.crop_x + x_sample.first) / 2) * 2);
+
+            // BT.601, limited range
+            const auto c = (static_cast<int32_t>(luma) - 16) * 298;
+            const auto d = static_cast<int32_t>(uv[0]) - 128;
+            const auto e = static_cast<int32_t>(uv[1]) - 128;
+            dst_row[(x * 3) + 0] = clamp_to_uint8((c + (409 * e) + 128) >> 8);
+            dst_row[(x * 3) + 1] = clamp_to_uint8((c - (100 * d) - (208 * e) + 128) >> 8);
+            dst_row[(x * 3) + 2] = clamp_to_uint8((c + (516 * d) + 128) >> 8);
+        }
+    }
+}
+
+void ResizeElement::fill_padding(uint8_t *dst) const
+{
+    if ((m_dst_width == m_dst_image_shape.width) && (m_dst_height == m_dst_image_shape.height)) {
+        return;
+    }
+
+    const auto channels = m_dst_image_shape.features;
+    const auto dst_stride = static_cast<size_t>(m_dst_image_shape.width) * channels;
+    const auto left_padding_size = static_cast<size_t>(m_dst_x) * channels;
+    const auto right_padding_size = static_cast<size_t>(m_dst_image_shape.width - m_dst_x - m_dst_width) * channels;
+    for (uint32_t y = 0; y < m_dst_image_shape.height; y++) {
+        auto *dst_row = dst + (y * dst_stride);
+        if ((y < m_dst_y) || (y >= (m_dst_y + m_dst_height))) {
+            memset(dst_row, m_params.padding_value, dst_stride);
+        } else {
+            memset(dst_row, m_params.padding_value, left_padding_size);
+            memset(dst_row + dst_stride - right_padding_size, m_params.padding_value, right_padding_size);
+        }
+    }
+}
+
+Expected<PipelineBuffer> ResizeElement::run_pull(PipelineBuffer &&/*optional*/, const PipelinePad &/*source*/)
+{
+    LOGGER__ERROR("ResizeElement does not support run_pull operation");
+    return make_unexpected(HAILO_INVALID_OPERATION);
+}
+
+PipelinePad &ResizeElement::next_pad()
+{
+    // Note: The next elem to be run is downstream from this elem (i.e. buffers are pushed)
+    return *m_sources[0].next();
+}
+
+std::string ResizeElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name() << " | Resize " << m_params.src_width << "x" << m_params.src_height << " " <<
+        HailoRTCommon::get_format_order_str(m_params.src_order) << ", crop (" << m_params.crop_x << "," << m_params.crop_y <<
+        " " << m_params.crop_width << "x" << m_params.crop_height << ") -> " << m_dst_image_shape.width << "x" <<
+        m_dst_image_shape.height << "x" << m_dst_image_shape.features;
+    if (m_params.keep_aspect_ratio) {
+        element_description << ", letterbox " << m_dst_width << "x" << m_dst_height;
+    }
+    element_description << ")";
+    return element_description.str();
+}
+
+Expected<PipelineBuffer> ResizeElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    if (PipelineBuffer::Type::FLUSH == input.get_type()) {
+        return std::move(input);
+    }
+
+    auto pool = get_output_buffer_pool();
+    assert(pool);
+
+    auto resized_buffer = pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == resized_buffer.status()) {
+        return make_unexpected(resized_buffer.status());
+    }
+
+    if (!resized_buffer) {
+        input.set_action_status(resized_buffer.status());
+    }
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != resized_buffer.status(), HAILO_TIMEOUT,
+        "{} (H2D) failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, m_timeout.count());
+    CHECK_EXPECTED(resized_buffer);
+
+    TRY(auto dst, resized_buffer->as_view(BufferProtection::WRITE));
+    TRY(auto src, input.as_view(BufferProtection::READ));
+
+    auto status = HAILO_SUCCESS;
+    const auto src_frame_size = get_src_frame_size(m_params, m_dst_image_shape.features);
+    if (src.size() < src_frame_size) {
+        LOGGER__ERROR("{} got a frame of {} bytes, expected {} bytes", name(), src.size(), src_frame_size);
+        status = HAILO_INVALID_ARGUMENT;
+    } else {
+        assert(dst.size() >= HailoRTCommon::get_shape_size(m_dst_image_shape));
+        m_duration_collector.start_measurement();
+        fill_padding(dst.data());
+        if (HAILO_FORMAT_ORDER_NV12 == m_params.src_order) {
+            resize_nv12(src.data(), dst.data());
+        } else {
+            resize_nhwc(src.data(), dst.data());
+        }
+        m_duration_collector.complete_measurement();
+    }
+
+    input.set_action_status(status);
+    resized_buffer->set_action_status(status);
+
+    auto metadata = input.get_metadata();
+
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    // Note: The latency to be measured starts as the input buffer is sent to the InputVStream (via write())
+    resized_buffer->set_metadata_start_time(metadata.get_start_time());
+
+    return resized_buffer.release();
+}
+
 Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> ConvertNmsToDetectionsElement::create(
     const hailo_nms_info_t &nms_info, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
     std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout,
@@ -238,7 +563,7 @@ PipelinePad &ConvertNmsToDetectionsElement::next_pad()
 Expected<PipelineBuffer> ConvertNmsToDetectionsElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -267,12 +592,12 @@ Expected<PipelineBuffer> ConvertNmsToDetectionsElement::action(PipelineBuffer &&
 }
 
 Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const net_flow::NmsPostProcessConfig nms_config,
-    const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+    hailo_format_order_t format_order, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
 
-    auto fill_nms_format_element = make_shared_nothrow<FillNmsFormatElement>(std::move(nms_config),
+    auto fill_nms_format_element = make_shared_nothrow<FillNmsFormatElement>(std::move(nms_config), format_order,
         name, std::move(duration_collector), std::move(pipeline_status), timeout, pipeline_direction, async_pipeline);
     CHECK_AS_EXPECTED(nullptr != fill_nms_format_element, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -282,18 +607,20 @@ Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(con
 }
 
 Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const net_flow::NmsPostProcessConfig nms_config,
-    const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction,
+    hailo_format_order_t format_order, const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction,
     std::shared_ptr<AsyncPipeline> async_pipeline)
 {
-    return FillNmsFormatElement::create(nms_config, name, build_params.elem_stats_flags,
+    return FillNmsFormatElement::create(nms_config, format_order, name, build_params.elem_stats_flags,
         build_params.pipeline_status, build_params.timeout, pipeline_direction, async_pipeline);
 }
 
-FillNmsFormatElement::FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name,
+FillNmsFormatElement::FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config,
+    hailo_format_order_t format_order, const std::string &name,
     DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_nms_config(std::move(nms_config))
+    m_nms_config(std::move(nms_config)),
+    m_format_order(format_order)
 {}
 
 hailo_status FillNmsFormatElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
@@ -314,7 +641,7 @@ PipelinePad &FillNmsFormatElement::next_pad()
 Expected<PipelineBuffer> FillNmsFormatElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer_expected = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -335,8 +662,8 @@ Expected<PipelineBuffer> FillNmsFormatElement::action(PipelineBuffer &&input, Pi
 
     auto detections = input.get_metadata().get_additional_data<IouPipelineData>();
     TRY(auto dst, buffer.as_view(BufferProtection::WRITE));
-    net_flow::NmsPostProcessOp::fill_nms_format_buffer(dst, detections->m_detections, detections->m_detections_classes_count,
-        m_nms_config);
+    net_flow::NmsPostProcessOp::fill_nms_output_buffer(dst, detections->m_detections, detections->m_detections_classes_count,
+        m_nms_config, m_format_order);
 
     m_duration_collector.complete_measurement();
 
@@ -350,11 +677,12 @@ Expected<std::shared_ptr<PostInferElement>> PostInferElement::create(const hailo
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     TRY(auto transform_context, OutputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format,
-        dst_quant_infos, nms_info), "Failed creating OutputTransformContext");
+        dst_quant_infos, nms_info, TransformContextUtils::get_pipeline_max_threads_count()),
+        "Failed creating OutputTransformContext");
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
 
-    auto post_infer_elem_ptr = make_shared_nothrow<PostInferElement>(std::move(transform_context), name,
-        std::move(duration_collector), std::move(pipeline_status), timeout, pipeline_direction, async_pipeline);
+    auto post_infer_elem_ptr = make_shared_nothrow<PostInferElement>(std::move(transform_context), src_image_shape,
+        src_format, dst_image_shape, dst_quant_infos, nms_info, name, std::move(duration_collector), std::move(pipeline_status), timeout, pipeline_direction, async_pipeline);
     CHECK_AS_EXPECTED(nullptr != post_infer_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     LOGGER__INFO("Created {}", post_infer_elem_ptr->description());
@@ -383,11 +711,20 @@ Expected<std::shared_ptr<PostInferElement>> PostInferElement::create(const hailo
         build_params.timeout, pipeline_direction, async_pipeline);
 }
 
-PostInferElement::PostInferElement(std::unique_ptr<OutputTransformContext> &&transform_context, const std::string &name,
+PostInferElement::PostInferElement(std::unique_ptr<OutputTransformContext> &&transform_context,
+    const hailo_3d_image_shape_t &src_image_shape, const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
+    const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info, const std::string &name,
     DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_transform_context(std::move(transform_context))
+    m_transform_context(std::move(transform_context)),
+    m_src_image_shape(src_image_shape),
+    m_src_format(src_format),
+    m_dst_image_shape(dst_image_shape),
+    m_dst_quant_infos(dst_quant_infos),
+    m_nms_info(nms_info),
+    m_is_nms_score_threshold_set(false),
+    m_nms_score_threshold(0)
 {}
 
 Expected<PipelineBuffer> PostInferElement::run_pull(PipelineBuffer &&optional, const PipelinePad &source)
@@ -415,15 +752,77 @@ PipelinePad &PostInferElement::next_pad()
 
 std::string PostInferElement::description() const
 {
+    std::lock_guard<std::mutex> lock(m_transform_context_mutex);
     std::stringstream element_description;
     element_description << "(" << this->name() << " | " << m_transform_context->description() << ")";
     return element_description.str();
 }
 
+hailo_status PostInferElement::set_user_buffer_format(const hailo_format_t &user_buffer_format)
+{
+    // Creating the new context before taking the lock, so the frames transformation isn't blocked meanwhile
+    TRY(auto transform_context, OutputTransformContext::create(m_src_image_shape, m_src_format, m_dst_image_shape,
+        user_buffer_format, m_dst_quant_infos, m_nms_info, TransformContextUtils::get_pipeline_max_threads_count()),
+        "Failed creating OutputTransformContext");
+
+    {
+        std::lock_guard<std::mutex> lock(m_transform_context_mutex);
+        auto status = apply_nms_filters(*transform_context);
+        CHECK_SUCCESS(status);
+        m_transform_context = std::move(transform_context);
+    }
+
+    LOGGER__INFO("Replaced the transform context of {}", description());
+    return HAILO_SUCCESS;
+}
+
+hailo_status PostInferElement::set_nms_score_threshold(float32_t threshold)
+{
+    std::lock_guard<std::mutex> lock(m_transform_context_mutex);
+    auto nms_transform_context = dynamic_cast<NMSOutputTransformContext*>(m_transform_context.get());
+    CHECK(nullptr != nms_transform_context, HAILO_INVALID_OPERATION,
+        "{} transforms no HW NMS output, can't set its NMS score threshold", name());
+
+    auto status = nms_transform_context->set_score_threshold(threshold);
+    CHECK_SUCCESS(status);
+
+    m_is_nms_score_threshold_set = true;
+    m_nms_score_threshold = threshold;
+    return HAILO_SUCCESS;
+}
+
+hailo_status PostInferElement::set_nms_classes_filter(const std::vector<uint32_t> &classes_filter)
+{
+    std::lock_guard<std::mutex> lock(m_transform_context_mutex);
+    auto nms_transform_context = dynamic_cast<NMSOutputTransformContext*>(m_transform_context.get());
+    CHECK(nullptr != nms_transform_context, HAILO_INVALID_OPERATION,
+        "{} transforms no HW NMS output, can't set its NMS classes filter", name());
+
+    auto status = nms_transform_context->set_classes_filter(classes_filter);
+    CHECK_SUCCESS(status);
+
+    m_nms_classes_filter = classes_filter;
+    return HAILO_SUCCESS;
+}
+
+hailo_status PostInferElement::apply_nms_filters(OutputTransformContext &transform_context)
+{
+    auto nms_transform_context = dynamic_cast<NMSOutputTransformContext*>(&transform_context);
+    if (nullptr == nms_transform_context) {
+        return HAILO_SUCCESS;
+    }
+
+    if (m_is_nms_score_threshold_set) {
+        auto status = nms_transform_context->set_score_threshold(m_nms_score_threshold);
+        CHECK_SUCCESS(status);
+    }
+    return nms_transform_context->set_classes_filter(m_nms_classes_filter);
+}
+
 Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -442,9 +841,13 @@ Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, Pipeli
     TRY(auto src, input.as_view(BufferProtection::READ));
     TRY(auto dst, buffer->as_view(BufferProtection::WRITE));
 
-    m_duration_collector.start_measurement();
-    const auto status = m_transform_context->transform(src, dst);
-    m_duration_collector.complete_measurement();
+    hailo_status status = HAILO_UNINITIALIZED;
+    {
+        std::lock_guard<std::mutex> lock(m_transform_context_mutex);
+        m_duration_collector.start_measurement();
+        status = m_transform_context->transform(src, dst);
+        m_duration_collector.complete_measurement();
+    }
 
     input.set_action_status(status);
     buffer->set_action_status(status);
@@ -510,8 +913,14 @@ std::string RemoveOverlappingBboxesElement::description() const
 
 Expected<PipelineBuffer> RemoveOverlappingBboxesElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
+    auto detections_pipeline_data = input.get_metadata().get_additional_data<IouPipelineData>();
+    if (m_is_in_place) {
+        remove_overlapping_boxes(*detections_pipeline_data);
+        return std::move(input);
+    }
+
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -525,18 +934,21 @@ Expected<PipelineBuffer> RemoveOverlappingBboxesElement::action(PipelineBuffer &
     CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status()); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
     buffer->set_metadata_start_time(input.get_metadata().get_start_time());
-    buffer->set_additional_data(input.get_metadata().get_additional_data<IouPipelineData>());
-
-    m_duration_collector.start_measurement();
-    auto detections_pipeline_data = input.get_metadata().get_additional_data<IouPipelineData>();
+    buffer->set_additional_data(detections_pipeline_data);
 
-    net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections_pipeline_data->m_detections,
-        detections_pipeline_data->m_detections_classes_count, m_nms_config.nms_iou_th);
-    m_duration_collector.complete_measurement();
+    remove_overlapping_boxes(*detections_pipeline_data);
 
     return buffer.release();
 }
 
+void RemoveOverlappingBboxesElement::remove_overlapping_boxes(IouPipelineData &detections_pipeline_data)
+{
+    m_duration_collector.start_measurement();
+    net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections_pipeline_data.m_detections,
+        detections_pipeline_data.m_detections_classes_count, m_nms_config.nms_iou_th);
+    m_duration_collector.complete_measurement();
+}
+
 Expected<std::shared_ptr<ArgmaxPostProcessElement>> ArgmaxPostProcessElement::create(std::shared_ptr<net_flow::Op> argmax_op,
     const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
@@ -563,7 +975,9 @@ ArgmaxPostProcessElement::ArgmaxPostProcessElement(std::shared_ptr<net_flow::Op>
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction,
     std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_argmax_op(argmax_op)
+    m_argmax_op(argmax_op),
+    m_inputs({{argmax_op->inputs_metadata().begin()->first, MemoryView()}}),
+    m_outputs({{argmax_op->outputs_metadata().begin()->first, MemoryView()}})
 {}
 
 Expected<PipelineBuffer> ArgmaxPostProcessElement::run_pull(PipelineBuffer &&optional, const PipelinePad &source)
@@ -598,7 +1012,7 @@ std::string ArgmaxPostProcessElement::description() const
 Expected<PipelineBuffer> ArgmaxPostProcessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -611,18 +1025,11 @@ Expected<PipelineBuffer> ArgmaxPostProcessElement::action(PipelineBuffer &&input
     }
     CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status()); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
-    std::map<std::string, MemoryView> inputs;
-    std::map<std::string, MemoryView> outputs;
-    auto &input_name = m_argmax_op->inputs_metadata().begin()->first;
-    auto &output_name = m_argmax_op->outputs_metadata().begin()->first;
+    TRY(m_inputs.begin()->second, input.as_view(BufferProtection::READ));
+    TRY(m_outputs.begin()->second, buffer->as_view(BufferProtection::WRITE));
 
-    TRY(auto src, input.as_view(BufferProtection::READ));
-    TRY(auto dst, buffer->as_view(BufferProtection::WRITE));
-
-    inputs.insert({input_name, src});
-    outputs.insert({output_name, dst});
     m_duration_collector.start_measurement();
-    auto post_process_result = m_argmax_op->execute(inputs, outputs);
+    auto post_process_result = m_argmax_op->execute(m_inputs, m_outputs);
     m_duration_collector.complete_measurement();
 
     input.set_action_status(post_process_result);
@@ -658,7 +1065,9 @@ SoftmaxPostProcessElement::SoftmaxPostProcessElement(std::shared_ptr<net_flow::O
     DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
-    m_softmax_op(softmax_op)
+    m_softmax_op(softmax_op),
+    m_inputs({{softmax_op->inputs_metadata().begin()->first, MemoryView()}}),
+    m_outputs({{softmax_op->outputs_metadata().begin()->first, MemoryView()}})
 {}
 
 Expected<PipelineBuffer> SoftmaxPostProcessElement::run_pull(PipelineBuffer &&optional, const PipelinePad &source)
@@ -690,10 +1099,38 @@ std::string SoftmaxPostProcessElement::description() const
     return element_description.str();
 }
 
+bool SoftmaxPostProcessElement::is_in_place_capable() const
+{
+    // Softmax is calculated per element, so it can be written over its input when the frames are of the same size
+    const auto &input_metadata = m_softmax_op->inputs_metadata().begin()->second;
+    const auto &output_metadata = m_softmax_op->outputs_metadata().begin()->second;
+    return HailoRTCommon::get_frame_size(input_metadata.shape, input_metadata.format) ==
+        HailoRTCommon::get_frame_size(output_metadata.shape, output_metadata.format);
+}
+
+hailo_status SoftmaxPostProcessElement::execute(const MemoryView &src, const MemoryView &dst)
+{
+    m_inputs.begin()->second = src;
+    m_outputs.begin()->second = dst;
+    m_duration_collector.start_measurement();
+    auto post_process_result = m_softmax_op->execute(m_inputs, m_outputs);
+    m_duration_collector.complete_measurement();
+    return post_process_result;
+}
+
 Expected<PipelineBuffer> SoftmaxPostProcessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
+    if (m_is_in_place) {
+        // The buffer was filled by the element upstream (and mapped for writing if it is a dma buffer)
+        TRY(auto view, input.as_view(BufferProtection::WRITE));
+        auto post_process_result = execute(view, view);
+        input.set_action_status(post_process_result);
+        CHECK_SUCCESS_AS_EXPECTED(post_process_result);
+        return std::move(input);
+    }
+
     // Buffers are always taken from the next-pad-downstream
-    auto pool = next_pad_downstream().element().get_buffer_pool();
+    auto pool = get_output_buffer_pool();
     assert(pool);
 
     auto buffer = pool->get_available_buffer(std::move(optional), m_timeout);
@@ -706,19 +1143,10 @@ Expected<PipelineBuffer> SoftmaxPostProcessElement::action(PipelineBuffer &&inpu
     }
     CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status()); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
-    std::map<std::string, MemoryView> inputs;
-    std::map<std::string, MemoryView> outputs;
-    auto &input_name = m_softmax_op->inputs_metadata().begin()->first;
-    auto &output_name = m_softmax_op->outputs_metadata().begin()->first;
-
     TRY(auto src, input.as_view(BufferProtection::READ));
     TRY(auto dst, buffer->as_view(BufferProtection::WRITE));
 
-    inputs.insert({input_name, src});
-    outputs.insert({output_name, dst});
-    m_duration_collector.start_measurement();
-    auto post_process_result = m_softmax_op->execute(inputs, outputs);
-    m_duration_collector.complete_measurement();
+    auto post_process_result = execute(src, dst);
 
     input.set_action_status(post_process_result);
     buffer->set_action_status(post_process_result);
@@ -766,4 +1194,84 @@ Expected<PipelineBuffer> CopyBufferElement::action(PipelineBuffer &&input, Pipel
     return std::move(optional);
 }
 
+Expected<std::shared_ptr<FusedFilterElement>> FusedFilterElement::create(std::vector<std::shared_ptr<FilterElement>> &&stages,
+    const std::vector<size_t> &intermediate_frame_sizes, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    CHECK_AS_EXPECTED(!stages.empty(), HAILO_INVALID_ARGUMENT, "FusedFilterElement {} must have at least one stage", name);
+    CHECK_AS_EXPECTED(intermediate_frame_sizes.size() == (stages.size() - 1), HAILO_INVALID_ARGUMENT,
+        "FusedFilterElement {} got {} intermediate frame sizes for {} stages", name, intermediate_frame_sizes.size(), stages.size());
+
+    for (size_t i = 0; i < intermediate_frame_sizes.size(); i++) {
+        if (stages[i]->is_in_place()) {
+            // The stage passes its input buffer on to the next stage
+            continue;
+        }
+
+        // The next stage is done with a buffer before the stage runs again, so a single buffer is enough
+        TRY(auto scratch_pool, BufferPool::create(intermediate_frame_sizes[i], 1, build_params.shutdown_event,
+            build_params.elem_stats_flags, build_params.vstream_stats_flags));
+        stages[i]->set_output_buffer_pool(scratch_pool);
+    }
+
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+    auto pipeline_status = build_params.pipeline_status;
+    auto fused_elem_ptr = make_shared_nothrow<FusedFilterElement>(std::move(stages), name, std::move(duration_collector),
+        std::move(pipeline_status), build_params.timeout, pipeline_direction, async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != fused_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", fused_elem_ptr->description());
+
+    return fused_elem_ptr;
+}
+
+FusedFilterElement::FusedFilterElement(std::vector<std::shared_ptr<FilterElement>> &&stages, const std::string &name,
+    DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+    std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
+    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
+    m_stages(std::move(stages))
+{}
+
+PipelinePad &FusedFilterElement::next_pad()
+{
+    if (PipelineDirection::PUSH == m_pipeline_direction){
+        return *m_sources[0].next();
+    }
+    return *m_sinks[0].prev();
+}
+
+std::string FusedFilterElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name() << " | Stages:";
+    for (const auto &stage : m_stages) {
+        element_description << " " << stage->description();
+    }
+    element_description << ")";
+    return element_description.str();
+}
+
+Expected<PipelineBuffer> FusedFilterElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    auto &last_stage = m_stages.back();
+    if (nullptr == last_stage->m_output_buffer_pool) {
+        // The element is linked by now, the last stage takes its buffers from the next element downstream
+        last_stage->set_output_buffer_pool(get_output_buffer_pool());
+    }
+
+    return run_stages(0, std::move(input), std::move(optional));
+}
+
+Expected<PipelineBuffer> FusedFilterElement::run_stages(size_t stage_index, PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    if ((m_stages.size() - 1) == stage_index) {
+        return m_stages[stage_index]->action(std::move(input), std::move(optional));
+    }
+
+    // The stage output is returned to its scratch pool once the following stages are done with it
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_SHUTDOWN_EVENT_SIGNALED, auto output,
+        m_stages[stage_index]->action(std::move(input), PipelineBuffer()));
+    return run_stages(stage_index + 1, std::move(output), std::move(optional));
+}
+
 } /* namespace hailort */
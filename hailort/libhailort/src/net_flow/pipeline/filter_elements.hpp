@@ -10,6 +10,7 @@
 #ifndef _HAILO_FILTER_ELEMENTS_HPP_
 #define _HAILO_FILTER_ELEMENTS_HPP_
 
+#include "hailo/infer_model.hpp"
 #include "net_flow/pipeline/pipeline_internal.hpp"
 
 namespace hailort
@@ -28,14 +29,32 @@ public:
     virtual void run_push_async(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
 
+    // An element is in-place capable if its output frame is the same size as its input frame, and its action can
+    // write the output over the input. When running in-place, the action passes the input buffer on downstream instead
+    // of taking an output buffer from the pool, so the pool downstream doesn't need buffers of its own.
+    // Note: Running in-place is enabled by the pipeline builder, only where the input buffer may be written to and
+    //       passed on (e.g. not over the user's input buffers, and not into an element expecting the user's buffers).
+    virtual bool is_in_place_capable() const;
+    void set_in_place(bool is_in_place);
+    bool is_in_place() const;
+
+    // The pool the action takes its output buffers from - the pool of the next element downstream, unless set
+    // otherwise by the pipeline builder (e.g. for the stages of a FusedFilterElement).
+    void set_output_buffer_pool(BufferPoolPtr output_buffer_pool);
+
 protected:
     // The optional buffer functions as an output buffer that the user can write to instead of acquiring a new buffer
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) = 0;
 
     PipelinePad &next_pad_downstream();
     PipelinePad &next_pad_upstream();
+    BufferPoolPtr get_output_buffer_pool();
 
     std::chrono::milliseconds m_timeout;
+    BufferPoolPtr m_output_buffer_pool;
+    bool m_is_in_place;
+
+    friend class FusedFilterElement;
 };
 
 class PreInferElement : public FilterElement
@@ -70,6 +89,59 @@ private:
     std::unique_ptr<InputTransformContext> m_transform_context;
 };
 
+// Crops and resizes (bilinear) the user's frames of an input to the input's shape, optionally keeping the aspect ratio
+// (letterbox). NV12 frames are converted to RGB on the way. The resized frames are uint8 NHWC frames of the input's
+// shape, transformed to the HW format (if needed) by the PreInferElement after it.
+class ResizeElement : public FilterElement
+{
+public:
+    static Expected<std::shared_ptr<ResizeElement>> create(const InputResizeParams &params,
+        const hailo_3d_image_shape_t &dst_image_shape, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    ResizeElement(const InputResizeParams &params, const hailo_3d_image_shape_t &dst_image_shape, const std::string &name,
+        std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+        std::shared_ptr<AsyncPipeline> async_pipeline);
+    virtual ~ResizeElement() = default;
+
+    static hailo_status validate_params(const InputResizeParams &params, const hailo_3d_image_shape_t &dst_image_shape);
+    // Size of the source frames (of the user's buffers)
+    static size_t get_src_frame_size(const InputResizeParams &params, uint32_t features);
+
+    virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
+    virtual PipelinePad &next_pad() override;
+    virtual std::string description() const override;
+
+protected:
+    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
+
+private:
+    // Source pixel and weight of a destination pixel on one axis - the pixel is interpolated between the source pixels
+    // first and second (relative to the crop), with a weight of second_weight (out of RESIZE_WEIGHT_ONE) for second
+    struct AxisSample {
+        uint32_t first;
+        uint32_t second;
+        uint32_t second_weight;
+    };
+    static std::vector<AxisSample> create_axis_samples(uint32_t src_size, uint32_t dst_size);
+
+    void resize_nhwc(const uint8_t *src, uint8_t *dst);
+    void resize_nv12(const uint8_t *src, uint8_t *dst);
+    void fill_padding(uint8_t *dst) const;
+
+    const InputResizeParams m_params;
+    const hailo_3d_image_shape_t m_dst_image_shape;
+    // Region of the destination frame the crop is resized into - the rest of the frame is padding
+    uint32_t m_dst_x;
+    uint32_t m_dst_y;
+    uint32_t m_dst_width;
+    uint32_t m_dst_height;
+    std::vector<AxisSample> m_x_samples;
+    std::vector<AxisSample> m_y_samples;
+    // A row of the crop interpolated vertically, before the horizontal interpolation
+    std::vector<uint32_t> m_row_buffer;
+};
+
 class RemoveOverlappingBboxesElement : public FilterElement
 {
 public:
@@ -88,6 +160,8 @@ public:
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
+    // The detections are filtered in the input's metadata
+    virtual bool is_in_place_capable() const override { return true; }
 
     virtual hailo_status set_nms_iou_threshold(float32_t threshold)
     {
@@ -99,6 +173,8 @@ protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
+    void remove_overlapping_boxes(IouPipelineData &detections_pipeline_data);
+
     net_flow::NmsPostProcessConfig m_nms_config;
 };
 
@@ -122,7 +198,9 @@ public:
         const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info, const std::string &name,
         const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    PostInferElement(std::unique_ptr<OutputTransformContext> &&transform_context, const std::string &name,
+    PostInferElement(std::unique_ptr<OutputTransformContext> &&transform_context, const hailo_3d_image_shape_t &src_image_shape,
+        const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
+        const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info, const std::string &name,
         DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
         std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
     virtual ~PostInferElement() = default;
@@ -131,11 +209,35 @@ public:
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
 
+    // Replaces the transform context, the frames transformed after this call are in the new format.
+    virtual hailo_status set_user_buffer_format(const hailo_format_t &user_buffer_format) override;
+
+    // Supported only for HW NMS outputs - the bboxes are filtered while their scores are still quantized
+    virtual hailo_status set_nms_score_threshold(float32_t threshold) override;
+    hailo_status set_nms_classes_filter(const std::vector<uint32_t> &classes_filter);
+
 protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
+    // Must be called with m_transform_context_mutex held (or before the context is published)
+    hailo_status apply_nms_filters(OutputTransformContext &transform_context);
+
+    // Guards m_transform_context, which may be replaced while frames are transformed
+    mutable std::mutex m_transform_context_mutex;
     std::unique_ptr<OutputTransformContext> m_transform_context;
+
+    // Used for recreating the transform context
+    const hailo_3d_image_shape_t m_src_image_shape;
+    const hailo_format_t m_src_format;
+    const hailo_3d_image_shape_t m_dst_image_shape;
+    const std::vector<hailo_quant_info_t> m_dst_quant_infos;
+    const hailo_nms_info_t m_nms_info;
+
+    // Re-applied to the transform context once it is replaced. Guarded by m_transform_context_mutex.
+    bool m_is_nms_score_threshold_set;
+    float32_t m_nms_score_threshold;
+    std::vector<uint32_t> m_nms_classes_filter;
 };
 
 class ConvertNmsToDetectionsElement : public FilterElement
@@ -165,14 +267,17 @@ private:
 class FillNmsFormatElement : public FilterElement
 {
 public:
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config,
+        hailo_format_order_t format_order, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::chrono::milliseconds timeout, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const net_flow::NmsPostProcessConfig nms_config,
+        hailo_format_order_t format_order, const std::string &name,
         const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
-    FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name, DurationCollector &&duration_collector,
+    FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, hailo_format_order_t format_order,
+        const std::string &name, DurationCollector &&duration_collector,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, std::chrono::milliseconds timeout,
         PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
     virtual ~FillNmsFormatElement() = default;
@@ -190,6 +295,8 @@ protected:
 
 private:
     net_flow::NmsPostProcessConfig m_nms_config;
+    // HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE
+    const hailo_format_order_t m_format_order;
 };
 
 class ArgmaxPostProcessElement : public FilterElement
@@ -217,6 +324,9 @@ protected:
 
 private:
     std::shared_ptr<net_flow::Op> m_argmax_op;
+    // The op's input and output (keyed by their names), created once and only pointed at each frame's buffers
+    std::map<std::string, MemoryView> m_inputs;
+    std::map<std::string, MemoryView> m_outputs;
 };
 
 class SoftmaxPostProcessElement : public FilterElement
@@ -239,12 +349,18 @@ public:
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
+    virtual bool is_in_place_capable() const override;
 
 protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
+    hailo_status execute(const MemoryView &src, const MemoryView &dst);
+
     std::shared_ptr<net_flow::Op> m_softmax_op;
+    // The op's input and output (keyed by their names), created once and only pointed at each frame's buffers
+    std::map<std::string, MemoryView> m_inputs;
+    std::map<std::string, MemoryView> m_outputs;
 };
 
 class CopyBufferElement : public FilterElement
@@ -261,7 +377,32 @@ protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 };
 
+// Runs a chain of filter elements one after the other on the same thread, instead of separating them with queues.
+// Each stage writes its output to a single scratch buffer which is read by the next stage right away (while it is
+// still in the cache), and only the last stage takes its output buffer from the next element downstream.
+// Note: The stages are not linked to other elements - the element is linked instead of them.
+class FusedFilterElement : public FilterElement
+{
+public:
+    // intermediate_frame_sizes[i] is the output frame size of stages[i] (one for each stage except the last one)
+    static Expected<std::shared_ptr<FusedFilterElement>> create(std::vector<std::shared_ptr<FilterElement>> &&stages,
+        const std::vector<size_t> &intermediate_frame_sizes, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    FusedFilterElement(std::vector<std::shared_ptr<FilterElement>> &&stages, const std::string &name,
+        DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+        std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
+    virtual ~FusedFilterElement() = default;
+    virtual PipelinePad &next_pad() override;
+    virtual std::string description() const override;
 
+protected:
+    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
+
+private:
+    Expected<PipelineBuffer> run_stages(size_t stage_index, PipelineBuffer &&input, PipelineBuffer &&optional);
+
+    std::vector<std::shared_ptr<FilterElement>> m_stages;
+};
 
 } /* namespace hailort */
 
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file frame_difference_kernels.cpp
+ * @brief Implementation of the vectorized frame difference kernels
+ **/
+
+#include "net_flow/pipeline/frame_difference_kernels.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+// The x86 kernels are compiled with target attributes (so the library itself doesn't require AVX), and chosen at runtime
+// according to the CPU. On aarch64 NEON is always available.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAILO_FRAME_DIFFERENCE_X86_KERNELS
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define HAILO_FRAME_DIFFERENCE_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+
+namespace hailort
+{
+
+static uint64_t sum_abs_difference_scalar(const uint8_t *frame, const uint8_t *other_frame, size_t size)
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < size; i++) {
+        sum += static_cast<uint64_t>((frame[i] > other_frame[i]) ? (frame[i] - other_frame[i]) :
+            (other_frame[i] - frame[i]));
+    }
+    return sum;
+}
+
+#ifdef HAILO_FRAME_DIFFERENCE_X86_KERNELS
+
+__attribute__((target("avx2")))
+static uint64_t sum_abs_difference_avx2(const uint8_t *frame, const uint8_t *other_frame, size_t size)
+{
+    static const size_t BLOCK_SIZE = 32;
+    // _mm256_sad_epu8 sums the differences of each 8 bytes into a 64 bit lane
+    auto sums = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; (i + BLOCK_SIZE) <= size; i += BLOCK_SIZE) {
+        const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(frame + i));
+        const auto other_values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other_frame + i));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(values, other_values));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sums);
+    const auto sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    return sum + sum_abs_difference_scalar(frame + i, other_frame + i, size - i);
+}
+
+#endif /* HAILO_FRAME_DIFFERENCE_X86_KERNELS */
+
+#ifdef HAILO_FRAME_DIFFERENCE_NEON_KERNELS
+
+static uint64_t sum_abs_difference_neon(const uint8_t *frame, const uint8_t *other_frame, size_t size)
+{
+    static const size_t BLOCK_SIZE = 16;
+    // Each uint16 lane accumulates 2 differences per block, so the lanes are widened before they can overflow
+    static const size_t BLOCKS_PER_WIDENING = 128;
+    auto sums = vdupq_n_u64(0);
+
+    size_t i = 0;
+    while ((i + BLOCK_SIZE) <= size) {
+        auto partial_sums = vdupq_n_u16(0);
+        for (size_t block = 0; (block < BLOCKS_PER_WIDENING) && ((i + BLOCK_SIZE) <= size); block++, i += BLOCK_SIZE) {
+            partial_sums = vpadalq_u8(partial_sums, vabdq_u8(vld1q_u8(frame + i), vld1q_u8(other_frame + i)));
+        }
+        sums = vpadalq_u32(sums, vpaddlq_u16(partial_sums));
+    }
+
+    const auto sum = vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1);
+    return sum + sum_abs_difference_scalar(frame + i, other_frame + i, size - i);
+}
+
+#endif /* HAILO_FRAME_DIFFERENCE_NEON_KERNELS */
+
+static FrameDifferenceKernels choose_kernels()
+{
+#if defined(HAILO_FRAME_DIFFERENCE_X86_KERNELS)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {"avx2", sum_abs_difference_avx2};
+    }
+#elif defined(HAILO_FRAME_DIFFERENCE_NEON_KERNELS)
+    return {"neon", sum_abs_difference_neon};
+#endif
+
+    return {"scalar", sum_abs_difference_scalar};
+}
+
+const FrameDifferenceKernels &FrameDifferenceKernels::get()
+{
+    static const FrameDifferenceKernels kernels = []() {
+        const auto chosen_kernels = choose_kernels();
+        LOGGER__DEBUG("Using {} frame difference kernels", chosen_kernels.name);
+        return chosen_kernels;
+    }();
+    return kernels;
+}
+
+} /* namespace hailort */
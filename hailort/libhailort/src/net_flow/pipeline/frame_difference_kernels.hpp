@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file frame_difference_kernels.hpp
+ * @brief Vectorized kernels measuring the difference between two frames, selected once according to the host CPU.
+ *
+ * The kernels compute exactly what the scalar kernel computes, so choosing a kernel doesn't change the results.
+ **/
+
+#ifndef _HAILO_FRAME_DIFFERENCE_KERNELS_HPP_
+#define _HAILO_FRAME_DIFFERENCE_KERNELS_HPP_
+
+#include "hailo/hailort.h"
+
+
+namespace hailort
+{
+
+struct FrameDifferenceKernels final
+{
+    // Returns the sum of the absolute differences between the bytes of the frames (each of size bytes)
+    using SumAbsDifferenceFunc = uint64_t (*)(const uint8_t *frame, const uint8_t *other_frame, size_t size);
+
+    // Returns the kernels matching the host CPU. The kernels are chosen on the first call.
+    static const FrameDifferenceKernels &get();
+
+    const char *name;
+    SumAbsDifferenceFunc sum_abs_difference;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FRAME_DIFFERENCE_KERNELS_HPP_ */
@@ -0,0 +1,631 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_cascade.cpp
+ * @brief Runs a detector -> crop -> classifier cascade of two models.
+ *
+ * The detector's callback (called on the pipeline threads) only passes the frame to the cascade thread, which parses
+ * the detections, crops them into the classifier's input buffers and launches the classifier on all of the crops.
+ * The frame is completed by the callback of the classifier's last inference.
+ **/
+
+#include "hailo/infer_cascade.hpp"
+#include "hailo/hailort_common.hpp"
+#include "hailo/dma_mapped_buffer.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4244 4267 4127)
+#else
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include "net_flow/ops/stb_image_resize.h"
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#else
+#pragma GCC diagnostic pop
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace hailort
+{
+
+#define INFER_CASCADE_DEFAULT_MAX_CROPS_PER_FRAME (16)
+#define INFER_CASCADE_DEFAULT_MAX_FRAMES_IN_FLIGHT (4)
+static const std::chrono::milliseconds INFER_CASCADE_SHUTDOWN_TIMEOUT(HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+static const std::chrono::milliseconds INFER_CASCADE_CLASSIFIER_READY_TIMEOUT(HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+
+InferCascadeParams::InferCascadeParams() :
+    score_threshold(0.0f),
+    max_crops_per_frame(INFER_CASCADE_DEFAULT_MAX_CROPS_PER_FRAME),
+    max_frames_in_flight(INFER_CASCADE_DEFAULT_MAX_FRAMES_IN_FLIGHT)
+{}
+
+class InferCascadeImpl final {
+public:
+    static Expected<std::shared_ptr<InferCascadeImpl>> create(VDevice &vdevice, std::shared_ptr<InferModel> detector,
+        std::shared_ptr<InferModel> classifier, const InferCascadeParams &params);
+
+    InferCascadeImpl(std::shared_ptr<InferModel> detector, std::shared_ptr<InferModel> classifier,
+        ConfiguredInferModel configured_detector, ConfiguredInferModel configured_classifier,
+        const InferCascadeParams &params, const hailo_3d_image_shape_t &detector_input_shape,
+        const hailo_3d_image_shape_t &classifier_input_shape, const hailo_nms_shape_t &nms_shape,
+        size_t classifier_queue_size);
+    ~InferCascadeImpl();
+
+    hailo_status wait_for_async_ready(std::chrono::milliseconds timeout);
+    hailo_status run_async(MemoryView input, InferCascade::Callback callback);
+    hailo_status shutdown();
+
+private:
+    // A frame in the cascade. Guarded by m_mutex while the frame is free, owned by the thread handling it otherwise.
+    struct Frame {
+        MemoryView input;
+        InferCascade::Callback callback;
+        InferCascadeCompletionInfo completion_info;
+        std::vector<size_t> crops;
+        // The classifier's inferences of the frame that are not done yet, guarded by m_mutex
+        size_t pending_classifications;
+    };
+
+    hailo_status allocate_buffers(VDevice &vdevice);
+    hailo_status launch_detector(size_t frame_index);
+    void release_frame(size_t frame_index);
+    void worker_thread_main();
+    void on_frame_detected(size_t frame_index, hailo_status status);
+    hailo_status classify_frame(size_t frame_index);
+    std::vector<InferCascadeDetection> parse_detections(size_t frame_index) const;
+    hailo_status crop_detection(const MemoryView &input, const hailo_bbox_float32_t &bbox, size_t crop_index);
+    void on_classifications_done(size_t frame_index, hailo_status status, size_t classifications_count);
+    void complete_frame(size_t frame_index);
+
+    std::shared_ptr<InferModel> m_detector;
+    std::shared_ptr<InferModel> m_classifier;
+    ConfiguredInferModel m_configured_detector;
+    ConfiguredInferModel m_configured_classifier;
+    const InferCascadeParams m_params;
+    const hailo_3d_image_shape_t m_detector_input_shape;
+    const hailo_3d_image_shape_t m_classifier_input_shape;
+    const hailo_nms_shape_t m_nms_shape;
+    const size_t m_classifier_queue_size;
+
+    // Buffers of all the frames (or crops) of each edge, sliced to page aligned slots and mapped once on creation
+    Buffer m_detector_outputs;
+    size_t m_detector_output_slot_size;
+    Buffer m_crops;
+    size_t m_crop_slot_size;
+    std::map<std::string, Buffer> m_classifier_outputs;
+    std::map<std::string, size_t> m_classifier_output_slot_sizes;
+    std::map<std::string, size_t> m_classifier_output_frame_sizes;
+    std::vector<DmaMappedBuffer> m_mappings;
+
+    std::vector<ConfiguredInferModel::Bindings> m_detector_bindings;
+    std::vector<ConfiguredInferModel::Bindings> m_classifier_bindings;
+
+    std::mutex m_mutex;
+    std::condition_variable m_frames_cv;
+    std::vector<Frame> m_frames;
+    std::queue<size_t> m_free_frames;
+    std::queue<size_t> m_free_crops;
+    bool m_is_running;
+
+    // Frames the detector is done with, and the status of the detector on each of them
+    std::queue<std::pair<size_t, hailo_status>> m_detected_frames;
+    std::condition_variable m_worker_cv;
+    bool m_is_worker_running;
+    std::thread m_worker_thread;
+};
+
+static hailo_status validate_nhwc_uint8_input(InferModel &model, const char *model_role,
+    hailo_3d_image_shape_t &shape)
+{
+    CHECK(1 == model.inputs().size(), HAILO_INVALID_ARGUMENT, "The {} of a cascade must have a single input (has {})",
+        model_role, model.inputs().size());
+    TRY(auto input, model.input());
+    input.set_format_type(HAILO_FORMAT_TYPE_UINT8);
+    input.set_format_order(HAILO_FORMAT_ORDER_NHWC);
+    shape = input.shape();
+    return HAILO_SUCCESS;
+}
+
+Expected<std::shared_ptr<InferCascadeImpl>> InferCascadeImpl::create(VDevice &vdevice,
+    std::shared_ptr<InferModel> detector, std::shared_ptr<InferModel> classifier, const InferCascadeParams &params)
+{
+    CHECK_ARG_NOT_NULL_AS_EXPECTED(detector);
+    CHECK_ARG_NOT_NULL_AS_EXPECTED(classifier);
+    CHECK_AS_EXPECTED(params.max_crops_per_frame > 0, HAILO_INVALID_ARGUMENT,
+        "max_crops_per_frame of a cascade must be greater than 0");
+    CHECK_AS_EXPECTED(params.max_frames_in_flight > 0, HAILO_INVALID_ARGUMENT,
+        "max_frames_in_flight of a cascade must be greater than 0");
+
+    hailo_3d_image_shape_t detector_input_shape = {};
+    CHECK_SUCCESS_AS_EXPECTED(validate_nhwc_uint8_input(*detector, "detector", detector_input_shape));
+    hailo_3d_image_shape_t classifier_input_shape = {};
+    CHECK_SUCCESS_AS_EXPECTED(validate_nhwc_uint8_input(*classifier, "classifier", classifier_input_shape));
+    CHECK_AS_EXPECTED(detector_input_shape.features == classifier_input_shape.features, HAILO_INVALID_ARGUMENT,
+        "The inputs of the detector and the classifier of a cascade must have the same features (detector {}, classifier {})",
+        detector_input_shape.features, classifier_input_shape.features);
+
+    CHECK_AS_EXPECTED(1 == detector->outputs().size(), HAILO_INVALID_ARGUMENT,
+        "The detector of a cascade must have a single output (has {})", detector->outputs().size());
+    TRY(auto detector_output, detector->output());
+    CHECK_AS_EXPECTED(detector_output.is_nms(), HAILO_INVALID_ARGUMENT,
+        "The output {} of the detector of a cascade must be an NMS output", detector_output.name());
+    detector_output.set_format_type(HAILO_FORMAT_TYPE_FLOAT32);
+    detector_output.set_format_order(HAILO_FORMAT_ORDER_HAILO_NMS);
+    TRY(const auto nms_shape, detector_output.get_nms_shape());
+
+    TRY(auto configured_detector, detector->configure());
+    TRY(auto configured_classifier, classifier->configure());
+    TRY(const auto classifier_queue_size, configured_classifier.get_async_queue_size());
+
+    auto cascade = make_shared_nothrow<InferCascadeImpl>(detector, classifier, configured_detector,
+        configured_classifier, params, detector_input_shape, classifier_input_shape, nms_shape, classifier_queue_size);
+    CHECK_NOT_NULL_AS_EXPECTED(cascade, HAILO_OUT_OF_HOST_MEMORY);
+
+    CHECK_SUCCESS_AS_EXPECTED(cascade->allocate_buffers(vdevice));
+    cascade->m_worker_thread = std::thread([cascade_ptr = cascade.get()]() { cascade_ptr->worker_thread_main(); });
+
+    return cascade;
+}
+
+InferCascadeImpl::InferCascadeImpl(std::shared_ptr<InferModel> detector, std::shared_ptr<InferModel> classifier,
+    ConfiguredInferModel configured_detector, ConfiguredInferModel configured_classifier,
+    const InferCascadeParams &params, const hailo_3d_image_shape_t &detector_input_shape,
+    const hailo_3d_image_shape_t &classifier_input_shape, const hailo_nms_shape_t &nms_shape,
+    size_t classifier_queue_size) :
+        m_detector(std::move(detector)),
+        m_classifier(std::move(classifier)),
+        m_configured_detector(std::move(configured_detector)),
+        m_configured_classifier(std::move(configured_classifier)),
+        m_params(params),
+        m_detector_input_shape(detector_input_shape),
+        m_classifier_input_shape(classifier_input_shape),
+        m_nms_shape(nms_shape),
+        m_classifier_queue_size(classifier_queue_size),
+        m_detector_output_slot_size(0),
+        m_crop_slot_size(0),
+        m_frames(params.max_frames_in_flight),
+        m_is_running(true),
+        m_is_worker_running(true)
+{}
+
+InferCascadeImpl::~InferCascadeImpl()
+{
+    auto status = shutdown();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed to shutdown the cascade, status = {}", status);
+    }
+}
+
+hailo_status InferCascadeImpl::allocate_buffers(VDevice &vdevice)
+{
+    const auto page_size = OsUtils::get_page_size();
+    const size_t frames_count = m_params.max_frames_in_flight;
+    const size_t crops_count = frames_count * m_params.max_crops_per_frame;
+
+    TRY(auto detector_output, m_detector->output());
+    m_detector_output_slot_size = HailoRTCommon::align_to(detector_output.get_frame_size(), page_size);
+    TRY(m_detector_outputs, Buffer::create(m_detector_output_slot_size * frames_count, BufferStorageParams::create_dma()));
+    TRY(auto detector_outputs_mapping, DmaMappedBuffer::create(vdevice, m_detector_outputs.data(),
+        m_detector_outputs.size(), HAILO_DMA_BUFFER_DIRECTION_D2H));
+    m_mappings.emplace_back(std::move(detector_outputs_mapping));
+
+    TRY(auto classifier_input, m_classifier->input());
+    const auto crop_frame_size = classifier_input.get_frame_size();
+    m_crop_slot_size = HailoRTCommon::align_to(crop_frame_size, page_size);
+    TRY(m_crops, Buffer::create(m_crop_slot_size * crops_count, BufferStorageParams::create_dma()));
+    TRY(auto crops_mapping, DmaMappedBuffer::create(vdevice, m_crops.data(), m_crops.size(),
+        HAILO_DMA_BUFFER_DIRECTION_H2D));
+    m_mappings.emplace_back(std::move(crops_mapping));
+
+    for (const auto &output : m_classifier->outputs()) {
+        const auto frame_size = output.get_frame_size();
+        const auto slot_size = HailoRTCommon::align_to(frame_size, page_size);
+        TRY(auto buffer, Buffer::create(slot_size * crops_count, BufferStorageParams::create_dma()));
+        TRY(auto mapping, DmaMappedBuffer::create(vdevice, buffer.data(), buffer.size(), HAILO_DMA_BUFFER_DIRECTION_D2H));
+        m_mappings.emplace_back(std::move(mapping));
+        m_classifier_output_frame_sizes[output.name()] = frame_size;
+        m_classifier_output_slot_sizes[output.name()] = slot_size;
+        m_classifier_outputs.emplace(output.name(), std::move(buffer));
+    }
+
+    // The bindings of each slot point at the slot's buffers for the whole life of the cascade
+    for (size_t frame_index = 0; frame_index < frames_count; frame_index++) {
+        TRY(auto bindings, m_configured_detector.create_bindings());
+        TRY(auto output, bindings.output());
+        CHECK_SUCCESS(output.set_buffer(MemoryView(m_detector_outputs.data() + (frame_index * m_detector_output_slot_size),
+            detector_output.get_frame_size())));
+        m_detector_bindings.emplace_back(std::move(bindings));
+        m_free_frames.push(frame_index);
+    }
+
+    for (size_t crop_index = 0; crop_index < crops_count; crop_index++) {
+        TRY(auto bindings, m_configured_classifier.create_bindings());
+        TRY(auto input, bindings.input());
+        CHECK_SUCCESS(input.set_buffer(MemoryView(m_crops.data() + (crop_index * m_crop_slot_size), crop_frame_size)));
+        for (auto &output_buffer : m_classifier_outputs) {
+            const auto &name = output_buffer.first;
+            TRY(auto output, bindings.output(name));
+            CHECK_SUCCESS(output.set_buffer(MemoryView(output_buffer.second.data() +
+                (crop_index * m_classifier_output_slot_sizes.at(name)), m_classifier_output_frame_sizes.at(name))));
+        }
+        m_classifier_bindings.emplace_back(std::move(bindings));
+        m_free_crops.push(crop_index);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferCascadeImpl::wait_for_async_ready(std::chrono::milliseconds timeout)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(m_is_running, HAILO_INVALID_OPERATION, "The cascade was shut down");
+        const auto is_ready = m_frames_cv.wait_for(lock, timeout, [this]() {
+            return !m_is_running || !m_free_frames.empty();
+        });
+        if (!is_ready) {
+            return HAILO_TIMEOUT;
+        }
+        CHECK(m_is_running, HAILO_INVALID_OPERATION, "The cascade was shut down");
+    }
+
+    return m_configured_detector.wait_for_async_ready(timeout);
+}
+
+hailo_status InferCascadeImpl::run_async(MemoryView input, InferCascade::Callback callback)
+{
+    TRY(auto detector_input, m_detector->input());
+    CHECK(input.size() >= detector_input.get_frame_size(), HAILO_INVALID_ARGUMENT,
+        "The input of the cascade is too small (size {}, frame size {})", input.size(), detector_input.get_frame_size());
+
+    size_t frame_index = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(m_is_running, HAILO_INVALID_OPERATION, "The cascade was shut down");
+        CHECK(!m_free_frames.empty(), HAILO_QUEUE_IS_FULL, "The cascade has {} frames in flight",
+            m_params.max_frames_in_flight);
+        frame_index = m_free_frames.front();
+        m_free_frames.pop();
+    }
+
+    auto &frame = m_frames[frame_index];
+    frame.input = input;
+    frame.callback = std::move(callback);
+    frame.completion_info = InferCascadeCompletionInfo{HAILO_SUCCESS, {}};
+    frame.pending_classifications = 0;
+
+    auto status = launch_detector(frame_index);
+    if (HAILO_SUCCESS != status) {
+        release_frame(frame_index);
+        return status;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferCascadeImpl::launch_detector(size_t frame_index)
+{
+    auto &bindings = m_detector_bindings[frame_index];
+    TRY(auto input, bindings.input());
+    CHECK_SUCCESS(input.set_buffer(m_frames[frame_index].input));
+
+    TRY(auto job, m_configured_detector.run_async(bindings, [this, frame_index](const AsyncInferCompletionInfo &info) {
+        on_frame_detected(frame_index, info.status);
+    }));
+    job.detach();
+
+    return HAILO_SUCCESS;
+}
+
+void InferCascadeImpl::release_frame(size_t frame_index)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto &frame = m_frames[frame_index];
+        for (const auto crop_index : frame.crops) {
+            m_free_crops.push(crop_index);
+        }
+        frame.crops.clear();
+        frame.callback = nullptr;
+        frame.completion_info.detections.clear();
+        m_free_frames.push(frame_index);
+    }
+    m_frames_cv.notify_all();
+}
+
+void InferCascadeImpl::on_frame_detected(size_t frame_index, hailo_status status)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_detected_frames.emplace(frame_index, status);
+    }
+    m_worker_cv.notify_one();
+}
+
+void InferCascadeImpl::worker_thread_main()
+{
+    OsUtils::set_current_thread_name("INFER_CASCADE");
+    while (true) {
+        std::pair<size_t, hailo_status> detected_frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_worker_cv.wait(lock, [this]() { return !m_is_worker_running || !m_detected_frames.empty(); });
+            if (m_detected_frames.empty()) {
+                return;
+            }
+            detected_frame = m_detected_frames.front();
+            m_detected_frames.pop();
+        }
+
+        const auto frame_index = detected_frame.first;
+        auto status = detected_frame.second;
+        if (HAILO_SUCCESS == status) {
+            status = classify_frame(frame_index);
+        }
+        if (HAILO_SUCCESS != status) {
+            if (HAILO_STREAM_ABORT != status) {
+                LOGGER__ERROR("Cascade failed on frame, status = {}", status);
+            }
+            m_frames[frame_index].completion_info.status = status;
+            complete_frame(frame_index);
+        }
+    }
+}
+
+std::vector<InferCascadeDetection> InferCascadeImpl::parse_detections(size_t frame_index) const
+{
+    // HAILO_FORMAT_ORDER_HAILO_NMS - for each class, a float32 bboxes count followed by the class's bboxes
+    std::vector<InferCascadeDetection> detections;
+    const auto *data = m_detector_outputs.data() + (frame_index * m_detector_output_slot_size);
+    for (uint32_t class_index = 0; class_index < m_nms_shape.number_of_classes; class_index++) {
+        float32_t bboxes_count = 0;
+        memcpy(&bboxes_count, data, sizeof(bboxes_count));
+        data += sizeof(bboxes_count);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(bboxes_count); i++) {
+            InferCascadeDetection detection{};
+            memcpy(&detection.bbox, data, sizeof(detection.bbox));
+            data += sizeof(detection.bbox);
+            if (detection.bbox.score >= m_params.score_threshold) {
+                detection.class_index = class_index;
+                detections.emplace_back(std::move(detection));
+            }
+        }
+    }
+
+    if (detections.size() > m_params.max_crops_per_frame) {
+        std::partial_sort(detections.begin(), detections.begin() + m_params.max_crops_per_frame, detections.end(),
+            [](const InferCascadeDetection &a, const InferCascadeDetection &b) { return a.bbox.score > b.bbox.score; });
+        detections.resize(m_params.max_crops_per_frame);
+    }
+    return detections;
+}
+
+static uint32_t to_pixel(float32_t normalized_coordinate, uint32_t size)
+{
+    const auto clamped = std::min(std::max(normalized_coordinate, 0.0f), 1.0f);
+    return static_cast<uint32_t>(clamped * static_cast<float32_t>(size));
+}
+
+hailo_status InferCascadeImpl::crop_detection(const MemoryView &input, const hailo_bbox_float32_t &bbox,
+    size_t crop_index)
+{
+    const auto width = m_detector_input_shape.width;
+    const auto height = m_detector_input_shape.height;
+    const auto channels = m_detector_input_shape.features;
+
+    // Degenerate bboxes are cropped as a single pixel
+    const auto x_min = std::min(to_pixel(bbox.x_min, width), width - 1);
+    const auto y_min = std::min(to_pixel(bbox.y_min, height), height - 1);
+    const auto x_max = std::max(x_min + 1, to_pixel(bbox.x_max, width));
+    const auto y_max = std::max(y_min + 1, to_pixel(bbox.y_max, height));
+
+    const auto input_stride = width * channels;
+    const auto *crop_start = input.data() + (y_min * input_stride) + (x_min * channels);
+    auto *crop_buffer = m_crops.data() + (crop_index * m_crop_slot_size);
+    const auto result = stbir_resize_uint8(crop_start, static_cast<int>(x_max - x_min), static_cast<int>(y_max - y_min),
+        static_cast<int>(input_stride), crop_buffer, static_cast<int>(m_classifier_input_shape.width),
+        static_cast<int>(m_classifier_input_shape.height), 0, static_cast<int>(channels));
+    CHECK(1 == result, HAILO_INTERNAL_FAILURE, "Failed to resize the cascade crop");
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferCascadeImpl::classify_frame(size_t frame_index)
+{
+    auto &frame = m_frames[frame_index];
+    frame.completion_info.detections = parse_detections(frame_index);
+    auto &detections = frame.completion_info.detections;
+    if (detections.empty()) {
+        complete_frame(frame_index);
+        return HAILO_SUCCESS;
+    }
+
+    {
+        // A free crop always exists - the crops are allocated for max_crops_per_frame crops of each frame in flight
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(m_free_crops.size() >= detections.size(), HAILO_INTERNAL_FAILURE, "No free crops in the cascade");
+        for (size_t i = 0; i < detections.size(); i++) {
+            frame.crops.push_back(m_free_crops.front());
+            m_free_crops.pop();
+        }
+    }
+
+    std::vector<ConfiguredInferModel::Bindings> bindings;
+    bindings.reserve(detections.size());
+    for (size_t i = 0; i < detections.size(); i++) {
+        const auto crop_index = frame.crops[i];
+        CHECK_SUCCESS(crop_detection(frame.input, detections[i].bbox, crop_index));
+        for (auto &output_buffer : m_classifier_outputs) {
+            const auto &name = output_buffer.first;
+            detections[i].classifier_outputs.emplace(name, MemoryView(output_buffer.second.data() +
+                (crop_index * m_classifier_output_slot_sizes.at(name)), m_classifier_output_frame_sizes.at(name)));
+        }
+        bindings.emplace_back(m_classifier_bindings[crop_index]);
+    }
+
+    // The crops are sent in as few inferences as the classifier's queue allows
+    const auto classifications_count = (bindings.size() + m_classifier_queue_size - 1) / m_classifier_queue_size;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        frame.pending_classifications = classifications_count;
+    }
+
+    for (size_t i = 0; i < classifications_count; i++) {
+        const auto first = i * m_classifier_queue_size;
+        const auto last = std::min(first + m_classifier_queue_size, bindings.size());
+        const std::vector<ConfiguredInferModel::Bindings> batch(bindings.begin() + first, bindings.begin() + last);
+
+        auto status = m_configured_classifier.wait_for_async_ready(INFER_CASCADE_CLASSIFIER_READY_TIMEOUT,
+            static_cast<uint32_t>(batch.size()));
+        if (HAILO_SUCCESS == status) {
+            auto job = m_configured_classifier.run_async(batch, [this, frame_index](const AsyncInferCompletionInfo &info) {
+                on_classifications_done(frame_index, info.status, 1);
+            });
+            if (job) {
+                job->detach();
+                continue;
+            }
+            status = job.status();
+        }
+
+        // The inferences that weren't launched are done with the failure
+        LOGGER__ERROR("Failed to launch the classifier of the cascade, status = {}", status);
+        on_classifications_done(frame_index, status, classifications_count - i);
+        break;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+void InferCascadeImpl::on_classifications_done(size_t frame_index, hailo_status status, size_t classifications_count)
+{
+    auto &frame = m_frames[frame_index];
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if ((HAILO_SUCCESS != status) && (HAILO_SUCCESS == frame.completion_info.status)) {
+            frame.completion_info.status = status;
+        }
+        assert(frame.pending_classifications >= classifications_count);
+        frame.pending_classifications -= classifications_count;
+        if (0 != frame.pending_classifications) {
+            return;
+        }
+    }
+
+    complete_frame(frame_index);
+}
+
+void InferCascadeImpl::complete_frame(size_t frame_index)
+{
+    auto &frame = m_frames[frame_index];
+    if (HAILO_SUCCESS != frame.completion_info.status) {
+        frame.completion_info.detections.clear();
+    }
+    if (frame.callback) {
+        frame.callback(frame.completion_info);
+    }
+    release_frame(frame_index);
+}
+
+hailo_status InferCascadeImpl::shutdown()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_is_running) {
+            return HAILO_SUCCESS;
+        }
+        m_is_running = false;
+    }
+    m_frames_cv.notify_all();
+
+    auto status = HAILO_SUCCESS;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const auto are_frames_done = m_frames_cv.wait_for(lock, INFER_CASCADE_SHUTDOWN_TIMEOUT, [this]() {
+            return m_free_frames.size() == m_frames.size();
+        });
+        if (!are_frames_done) {
+            LOGGER__ERROR("Timeout waiting for the frames of the cascade ({} frames in flight)",
+                m_frames.size() - m_free_frames.size());
+            status = HAILO_TIMEOUT;
+        }
+    }
+
+    // Aborts the frames left (if any), whose callbacks are called by the cascade thread before it stops
+    auto shutdown_status = m_configured_detector.shutdown();
+    if (HAILO_SUCCESS != shutdown_status) {
+        LOGGER__ERROR("Failed to shutdown the detector of the cascade, status = {}", shutdown_status);
+        status = shutdown_status;
+    }
+    shutdown_status = m_configured_classifier.shutdown();
+    if (HAILO_SUCCESS != shutdown_status) {
+        LOGGER__ERROR("Failed to shutdown the classifier of the cascade, status = {}", shutdown_status);
+        status = shutdown_status;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_worker_running = false;
+    }
+    m_worker_cv.notify_all();
+    if (m_worker_thread.joinable()) {
+        m_worker_thread.join();
+    }
+
+    return status;
+}
+
+Expected<std::shared_ptr<InferCascade>> InferCascade::create(VDevice &vdevice, std::shared_ptr<InferModel> detector,
+    std::shared_ptr<InferModel> classifier, const InferCascadeParams &params)
+{
+    TRY(auto pimpl, InferCascadeImpl::create(vdevice, std::move(detector), std::move(classifier), params));
+    auto cascade = make_shared_nothrow<InferCascade>(std::move(pimpl));
+    CHECK_NOT_NULL_AS_EXPECTED(cascade, HAILO_OUT_OF_HOST_MEMORY);
+    return cascade;
+}
+
+InferCascade::InferCascade(std::shared_ptr<InferCascadeImpl> pimpl) :
+    m_pimpl(std::move(pimpl))
+{}
+
+InferCascade::~InferCascade()
+{
+    if (m_pimpl) {
+        auto status = m_pimpl->shutdown();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to shutdown the cascade, status = {}", status);
+        }
+    }
+}
+
+hailo_status InferCascade::wait_for_async_ready(std::chrono::milliseconds timeout)
+{
+    return m_pimpl->wait_for_async_ready(timeout);
+}
+
+hailo_status InferCascade::run_async(MemoryView input, Callback callback)
+{
+    return m_pimpl->run_async(input, std::move(callback));
+}
+
+hailo_status InferCascade::shutdown()
+{
+    return m_pimpl->shutdown();
+}
+
+} /* namespace hailort */
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_completion_queue.cpp
+ * @brief A queue the completions of asynchronous inferences are posted to.
+ *
+ * The completions are kept in a bounded MPMC ring (each cell holds a sequence number, telling whether it is free for
+ * the producer of its position or ready for the consumer of its position), so the pipeline threads never block on
+ * each other or on the user's threads. A semaphore counts the completions in the ring - its handle is the one the
+ * user waits on.
+ **/
+
+#include "hailo/infer_completion_queue.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+// Completions are tiny, so the ring is never the memory concern - the minimum only saves resizing for small models
+#define ASYNC_INFER_COMPLETION_QUEUE_MIN_CAPACITY (16)
+#define ASYNC_INFER_COMPLETION_QUEUE_MAX_CAPACITY (1 << 20)
+
+class AsyncInferCompletionQueueImpl final
+{
+public:
+    static Expected<std::shared_ptr<AsyncInferCompletionQueueImpl>> create(size_t capacity)
+    {
+        CHECK_AS_EXPECTED((0 < capacity) && (capacity <= ASYNC_INFER_COMPLETION_QUEUE_MAX_CAPACITY),
+            HAILO_INVALID_ARGUMENT, "Invalid completion queue capacity {} (must be between 1 and {})", capacity,
+            ASYNC_INFER_COMPLETION_QUEUE_MAX_CAPACITY);
+        TRY(auto semaphore, Semaphore::create_shared(0));
+
+        const auto ring_size = get_nearest_powerof_2(static_cast<uint32_t>(capacity),
+            ASYNC_INFER_COMPLETION_QUEUE_MIN_CAPACITY);
+        auto queue = make_shared_nothrow<AsyncInferCompletionQueueImpl>(ring_size, semaphore);
+        CHECK_NOT_NULL_AS_EXPECTED(queue, HAILO_OUT_OF_HOST_MEMORY);
+        return queue;
+    }
+
+    AsyncInferCompletionQueueImpl(uint32_t ring_size, SemaphorePtr semaphore) :
+        m_cells(ring_size), m_mask(ring_size - 1), m_semaphore(semaphore), m_enqueue_pos(0), m_dequeue_pos(0),
+        m_dropped_count(0)
+    {
+        for (size_t i = 0; i < m_cells.size(); i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(const AsyncInferCompletion &completion)
+    {
+        if (!try_enqueue(completion)) {
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            LOGGER__ERROR("Completion queue is full, dropping the completion of inference {} (status {})",
+                completion.sequence_number, completion.status);
+            return;
+        }
+
+        auto status = m_semaphore->signal();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to signal the completion queue, status = {}", status);
+        }
+    }
+
+    Expected<AsyncInferCompletion> pop(std::chrono::milliseconds timeout)
+    {
+        // A successful wait reserves a completion in the ring for this thread
+        auto status = m_semaphore->wait(timeout);
+        if (HAILO_TIMEOUT == status) {
+            return make_unexpected(status);
+        }
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        AsyncInferCompletion completion{};
+        while (!try_dequeue(completion)) {
+            // The completion at the head was reserved by a producer that didn't write it yet (while a later one was
+            // already written and signaled), so it is about to be ready
+            std::this_thread::yield();
+        }
+        return completion;
+    }
+
+    underlying_waitable_handle_t get_waitable_handle()
+    {
+        return m_semaphore->get_underlying_handle();
+    }
+
+    size_t get_dropped_count() const
+    {
+        return m_dropped_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        AsyncInferCompletion completion;
+    };
+
+    bool try_enqueue(const AsyncInferCompletion &completion)
+    {
+        auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto &cell = m_cells[pos & m_mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (0 == diff) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.completion = completion;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The cell still holds the completion of the previous lap
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_dequeue(AsyncInferCompletion &completion)
+    {
+        auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto &cell = m_cells[pos & m_mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    completion = cell.completion;
+                    cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<Cell> m_cells;
+    const size_t m_mask;
+    SemaphorePtr m_semaphore;
+    std::atomic<size_t> m_enqueue_pos;
+    std::atomic<size_t> m_dequeue_pos;
+    std::atomic<size_t> m_dropped_count;
+};
+
+Expected<std::shared_ptr<AsyncInferCompletionQueue>> AsyncInferCompletionQueue::create(size_t capacity)
+{
+    TRY(auto pimpl, AsyncInferCompletionQueueImpl::create(capacity));
+    auto queue = make_shared_nothrow<AsyncInferCompletionQueue>(std::move(pimpl));
+    CHECK_NOT_NULL_AS_EXPECTED(queue, HAILO_OUT_OF_HOST_MEMORY);
+    return queue;
+}
+
+AsyncInferCompletionQueue::AsyncInferCompletionQueue(std::shared_ptr<AsyncInferCompletionQueueImpl> pimpl) :
+    m_pimpl(std::move(pimpl))
+{}
+
+std::function<void(const AsyncInferCompletionInfo &completion_info)> AsyncInferCompletionQueue::callback(
+    uint64_t user_data)
+{
+    auto pimpl = m_pimpl;
+    return [pimpl, user_data](const AsyncInferCompletionInfo &completion_info) {
+        pimpl->push(AsyncInferCompletion{completion_info.status, completion_info.sequence_number, user_data,
+            completion_info.h2d_start_time, completion_info.d2h_complete_time});
+    };
+}
+
+Expected<AsyncInferCompletion> AsyncInferCompletionQueue::pop(std::chrono::milliseconds timeout)
+{
+    return m_pimpl->pop(timeout);
+}
+
+Expected<AsyncInferCompletion> AsyncInferCompletionQueue::try_pop()
+{
+    return m_pimpl->pop(std::chrono::milliseconds(0));
+}
+
+underlying_waitable_handle_t AsyncInferCompletionQueue::get_waitable_handle()
+{
+    return m_pimpl->get_waitable_handle();
+}
+
+size_t AsyncInferCompletionQueue::get_dropped_count() const
+{
+    return m_pimpl->get_dropped_count();
+}
+
+} /* namespace hailort */
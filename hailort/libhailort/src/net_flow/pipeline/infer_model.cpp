@@ -8,12 +8,20 @@
  **/
 
 #include "common/utils.hpp"
+#include "common/os_utils.hpp"
 #include "hailo/hailort_common.hpp"
 #include "hailo/vdevice.hpp"
 #include "hailo/infer_model.hpp"
 #include "hef/hef_internal.hpp"
 #include "net_flow/pipeline/infer_model_internal.hpp"
+#include "net_flow/ops_metadata/custom_op_metadata.hpp"
 #include "net_flow/pipeline/async_infer_runner.hpp"
+#include "net_flow/pipeline/pipeline_graph.hpp"
+#include "net_flow/pipeline/frame_difference_kernels.hpp"
+#include "network_group/network_group_internal.hpp"
+#include "vdevice/vdevice_core_op.hpp"
+#include "vdevice/callback_reorder_queue.hpp"
+#include "utils/host_memory_accountant.hpp"
 
 
 #define WAIT_FOR_ASYNC_IN_DTOR_TIMEOUT (std::chrono::milliseconds(10000))
@@ -38,6 +46,10 @@ hailo_format_t InferModelBase::InferStream::Impl::format() const
 
 size_t InferModelBase::InferStream::Impl::get_frame_size() const
 {
+    if (m_is_resized) {
+        // The user's frames are the source frames of the resize
+        return ResizeElement::get_src_frame_size(m_resize_params, m_vstream_info.shape.features);
+    }
     return HailoRTCommon::get_frame_size(m_vstream_info, m_user_buffer_format);
 }
 
@@ -92,6 +104,33 @@ void InferModelBase::InferStream::Impl::set_nms_max_accumulated_mask_size(uint32
     m_vstream_info.nms_shape.max_accumulated_mask_size = max_accumulated_mask_size;
 }
 
+void InferModelBase::InferStream::Impl::set_nms_max_proposals_total(uint32_t max_proposals_total)
+{
+    m_nms_max_proposals_total = max_proposals_total;
+    m_vstream_info.nms_shape.max_bboxes_total = max_proposals_total;
+}
+
+void InferModelBase::InferStream::Impl::set_nms_classes_filter(const std::vector<uint32_t> &classes)
+{
+    m_nms_classes_filter = classes;
+}
+
+void InferModelBase::InferStream::Impl::set_interrupts_coalescing(uint32_t max_transfers,
+    std::chrono::microseconds timeout)
+{
+    m_interrupts_coalescing.max_transfers = max_transfers;
+    m_interrupts_coalescing.timeout_us = static_cast<uint32_t>(timeout.count());
+}
+
+void InferModelBase::InferStream::Impl::set_resize(const InputResizeParams &params)
+{
+    m_is_resized = true;
+    m_resize_params = params;
+    // The format of the resized frames
+    m_user_buffer_format.type = HAILO_FORMAT_TYPE_UINT8;
+    m_user_buffer_format.order = HAILO_FORMAT_ORDER_NHWC;
+}
+
 float32_t InferModelBase::InferStream::Impl::nms_score_threshold() const
 {
     return m_nms_score_threshold;
@@ -112,6 +151,28 @@ uint32_t InferModelBase::InferStream::Impl::nms_max_accumulated_mask_size() cons
     return m_nms_max_accumulated_mask_size;
 }
 
+uint32_t InferModelBase::InferStream::Impl::nms_max_proposals_total() const
+{
+    return m_nms_max_proposals_total;
+}
+
+const std::vector<uint32_t> &InferModelBase::InferStream::Impl::nms_classes_filter() const
+{
+    return m_nms_classes_filter;
+}
+
+InputResizeParams::InputResizeParams() :
+    src_width(0),
+    src_height(0),
+    src_order(HAILO_FORMAT_ORDER_NHWC),
+    crop_x(0),
+    crop_y(0),
+    crop_width(0),
+    crop_height(0),
+    keep_aspect_ratio(false),
+    padding_value(0)
+{}
+
 InferModelBase::InferStream::InferStream(std::shared_ptr<InferModelBase::InferStream::Impl> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -136,6 +197,12 @@ size_t InferModelBase::InferStream::get_frame_size() const
     return m_pimpl->get_frame_size();
 }
 
+Expected<Buffer> InferModelBase::InferStream::allocate_buffer() const
+{
+    // Dma storage is allocated by whole pages (mmap on linux, VirtualAlloc on windows)
+    return Buffer::create(get_frame_size(), BufferStorageParams::create_dma());
+}
+
 Expected<hailo_nms_shape_t> InferModelBase::InferStream::get_nms_shape() const
 {
     return m_pimpl->get_nms_shape();
@@ -181,6 +248,26 @@ void InferModelBase::InferStream::set_nms_max_accumulated_mask_size(uint32_t max
     m_pimpl->set_nms_max_accumulated_mask_size(max_accumulated_mask_size);
 }
 
+void InferModelBase::InferStream::set_nms_max_proposals_total(uint32_t max_proposals_total)
+{
+    m_pimpl->set_nms_max_proposals_total(max_proposals_total);
+}
+
+void InferModelBase::InferStream::set_nms_classes_filter(const std::vector<uint32_t> &classes)
+{
+    m_pimpl->set_nms_classes_filter(classes);
+}
+
+void InferModelBase::InferStream::set_interrupts_coalescing(uint32_t max_transfers, std::chrono::microseconds timeout)
+{
+    m_pimpl->set_interrupts_coalescing(max_transfers, timeout);
+}
+
+void InferModelBase::InferStream::set_resize(const InputResizeParams &params)
+{
+    m_pimpl->set_resize(params);
+}
+
 float32_t InferModelBase::InferStream::nms_score_threshold() const
 {
     return m_pimpl->nms_score_threshold();
@@ -201,6 +288,21 @@ uint32_t InferModelBase::InferStream::nms_max_accumulated_mask_size() const
     return m_pimpl->nms_max_accumulated_mask_size();
 }
 
+uint32_t InferModelBase::InferStream::nms_max_proposals_total() const
+{
+    return m_pimpl->nms_max_proposals_total();
+}
+
+const std::vector<uint32_t> &InferModelBase::InferStream::nms_classes_filter() const
+{
+    return m_pimpl->nms_classes_filter();
+}
+
+bool InferModelBase::InferStream::is_resized() const
+{
+    return m_pimpl->m_is_resized;
+}
+
 Expected<std::shared_ptr<InferModelBase>> InferModelBase::create(VDevice &vdevice, const std::string &hef_path)
 {
     TRY(auto hef, Hef::create(hef_path));
@@ -228,7 +330,9 @@ Expected<std::shared_ptr<InferModelBase>> InferModelBase::create(VDevice &vdevic
 InferModelBase::InferModelBase(VDevice &vdevice, Hef &&hef, std::unordered_map<std::string, InferModelBase::InferStream> &&inputs,
         std::unordered_map<std::string, InferModelBase::InferStream> &&outputs)
     : m_vdevice(vdevice), m_hef(std::move(hef)), m_inputs(std::move(inputs)), m_outputs(std::move(outputs)),
-    m_config_params(HailoRTDefaults::get_configure_params())
+    m_config_params(HailoRTDefaults::get_configure_params()),
+    m_pipeline_elements_stats_flags(HAILO_PIPELINE_ELEM_STATS_NONE),
+    m_are_host_buffers_locked(false)
 {
     m_inputs_vector.reserve(m_inputs.size());
     m_input_names.reserve(m_inputs.size());
@@ -254,7 +358,10 @@ InferModelBase::InferModelBase(InferModelBase &&other) :
     m_outputs_vector(std::move(other.m_outputs_vector)),
     m_input_names(std::move(other.m_input_names)),
     m_output_names(std::move(other.m_output_names)),
-    m_config_params(std::move(other.m_config_params))
+    m_config_params(std::move(other.m_config_params)),
+    m_pipeline_elements_stats_flags(other.m_pipeline_elements_stats_flags),
+    m_are_host_buffers_locked(other.m_are_host_buffers_locked),
+    m_custom_ops_metadata(std::move(other.m_custom_ops_metadata))
 {
 }
 
@@ -278,8 +385,65 @@ void InferModelBase::set_hw_latency_measurement_flags(hailo_latency_measurement_
     m_config_params.latency = latency;
 }
 
+void InferModelBase::set_pipeline_elements_stats_flags(hailo_pipeline_elem_stats_flags_t flags)
+{
+    m_pipeline_elements_stats_flags = flags;
+}
+
+void InferModelBase::set_host_buffers_locked(bool locked)
+{
+    m_are_host_buffers_locked = locked;
+}
+
+hailo_status InferModelBase::update_interrupts_coalescing_params(NetworkGroupsParamsMap &configure_params)
+{
+    for (const auto &infer_streams : { std::cref(m_inputs), std::cref(m_outputs) }) {
+        for (const auto &name_stream_pair : infer_streams.get()) {
+            const auto &coalescing = name_stream_pair.second.m_pimpl->m_interrupts_coalescing;
+            if (coalescing.max_transfers <= 1) {
+                continue;
+            }
+
+            TRY(const auto stream_names, m_hef.get_stream_names_from_vstream_name(name_stream_pair.first));
+            for (auto &network_group_name_params_pair : configure_params) {
+                for (const auto &stream_name : stream_names) {
+                    auto &stream_params_by_name = network_group_name_params_pair.second.stream_params_by_name;
+                    if (contains(stream_params_by_name, stream_name)) {
+                        stream_params_by_name.at(stream_name).interrupts_coalescing = coalescing;
+                    }
+                }
+            }
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 Expected<ConfiguredInferModel> InferModelBase::configure()
 {
+    return configure_with_progress(nullptr);
+}
+
+Expected<ConfigureInferModelJob> InferModelBase::configure_async(ConfigureProgressCallback progress_callback)
+{
+    TRY(auto job_pimpl, ConfigureInferModelJobImpl::create([this, progress_callback]() {
+        return configure_with_progress(progress_callback);
+    }));
+    return ConfigureInferModelJob(job_pimpl);
+}
+
+Expected<ConfiguredInferModel> InferModelBase::configure_with_progress(const ConfigureProgressCallback &progress_callback)
+{
+    if (progress_callback) {
+        progress_callback(ConfigureStage::CONFIGURING_NETWORK_GROUP);
+    }
+
+    // The host memory allocated from here on is accounted to the model (the scope is ended once the model is configured)
+    TRY(auto host_memory_accountant, m_vdevice.get().get_host_memory_accountant());
+    const auto network_groups_names = m_hef.get_network_groups_names();
+    HostMemoryAccountingScope host_memory_accounting_scope(host_memory_accountant,
+        network_groups_names.empty() ? std::string() : network_groups_names[0]);
+
     auto configure_params = m_vdevice.get().create_configure_params(m_hef);
     CHECK_EXPECTED(configure_params);
 
@@ -296,6 +460,9 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         network_group_name_params_pair.second.latency = m_config_params.latency;
     }
 
+    auto status = update_interrupts_coalescing_params(configure_params.value());
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
     auto network_groups = m_vdevice.get().configure(m_hef, configure_params.value());
     CHECK_EXPECTED(network_groups);
 
@@ -308,20 +475,39 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         "Trying to configure a model with a batch={} bigger than internal_queue_size={}, which is not supported. Try using a smaller batch.",
             m_config_params.batch_size, internal_queue_size);
 
+    if (!m_custom_ops_metadata.empty()) {
+        auto network_group_base = std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(network_groups.value()[0]);
+        CHECK_AS_EXPECTED(nullptr != network_group_base, HAILO_NOT_SUPPORTED,
+            "Custom post-process ops are not supported when working with the service");
+        for (const auto &op_metadata : m_custom_ops_metadata) {
+            CHECK_SUCCESS_AS_EXPECTED(network_group_base->add_post_process_op(op_metadata));
+        }
+    }
+
     std::unordered_map<std::string, hailo_format_t> inputs_formats;
     std::unordered_map<std::string, hailo_format_t> outputs_formats;
     std::unordered_map<std::string, size_t> inputs_frame_sizes;
     std::unordered_map<std::string, size_t> outputs_frame_sizes;
+    std::unordered_map<std::string, InputResizeParams> inputs_resize_params;
 
     auto input_vstream_infos = network_groups.value()[0]->get_input_vstream_infos();
     CHECK_EXPECTED(input_vstream_infos);
 
     for (const auto &vstream_info : input_vstream_infos.value()) {
         assert(contains(m_inputs, std::string(vstream_info.name)));
+        const auto &input_pimpl = m_inputs.at(vstream_info.name).m_pimpl;
         inputs_formats[vstream_info.name] = m_inputs.at(vstream_info.name).format();
         inputs_frame_sizes[vstream_info.name] = m_inputs.at(vstream_info.name).get_frame_size();
+        if (input_pimpl->m_is_resized) {
+            CHECK_SUCCESS_AS_EXPECTED(ResizeElement::validate_params(input_pimpl->m_resize_params, vstream_info.shape));
+            inputs_resize_params[vstream_info.name] = input_pimpl->m_resize_params;
+        }
     }
 
+    CHECK_AS_EXPECTED(std::none_of(m_outputs.begin(), m_outputs.end(), [](const auto &output_pair) {
+        return output_pair.second.m_pimpl->m_is_resized;
+    }), HAILO_INVALID_OPERATION, "Resize was set for output");
+
     auto output_vstream_infos = network_groups.value()[0]->get_output_vstream_infos();
     CHECK_EXPECTED(output_vstream_infos);
 
@@ -335,7 +521,9 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         return ((input_pair.second.m_pimpl->m_nms_score_threshold == INVALID_NMS_CONFIG) &&
                 (input_pair.second.m_pimpl->m_nms_iou_threshold == INVALID_NMS_CONFIG) &&
                 (input_pair.second.m_pimpl->m_nms_max_accumulated_mask_size == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
-                (input_pair.second.m_pimpl->m_nms_max_proposals_per_class == static_cast<uint32_t>(INVALID_NMS_CONFIG)));
+                (input_pair.second.m_pimpl->m_nms_max_proposals_per_class == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
+                (input_pair.second.m_pimpl->m_nms_max_proposals_total == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
+                input_pair.second.m_pimpl->m_nms_classes_filter.empty());
     }), HAILO_INVALID_OPERATION, "NMS config was changed for input");
 
     for (const auto &output_pair : m_outputs) {
@@ -343,7 +531,9 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         if ((output_pair.second.m_pimpl->m_nms_score_threshold == INVALID_NMS_CONFIG) &&
             (output_pair.second.m_pimpl->m_nms_iou_threshold == INVALID_NMS_CONFIG) &&
             (output_pair.second.m_pimpl->m_nms_max_accumulated_mask_size == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
-            (output_pair.second.m_pimpl->m_nms_max_proposals_per_class == static_cast<uint32_t>(INVALID_NMS_CONFIG))) {
+            (output_pair.second.m_pimpl->m_nms_max_proposals_per_class == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
+            (output_pair.second.m_pimpl->m_nms_max_proposals_total == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
+            output_pair.second.m_pimpl->m_nms_classes_filter.empty()) {
                 continue;
             }
         if (output_pair.second.m_pimpl->m_nms_score_threshold != INVALID_NMS_CONFIG) {
@@ -362,18 +552,53 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
             auto status = network_groups.value()[0]->set_nms_max_accumulated_mask_size(edge_name, output_pair.second.m_pimpl->m_nms_max_accumulated_mask_size);
             CHECK_SUCCESS_AS_EXPECTED(status);
         }
+        if (output_pair.second.m_pimpl->m_nms_max_proposals_total != static_cast<uint32_t>(INVALID_NMS_CONFIG)) {
+            auto status = network_groups.value()[0]->set_nms_max_bboxes_total(edge_name, output_pair.second.m_pimpl->m_nms_max_proposals_total);
+            CHECK_SUCCESS_AS_EXPECTED(status);
+        }
+        if (!output_pair.second.m_pimpl->m_nms_classes_filter.empty()) {
+            auto status = network_groups.value()[0]->set_nms_classes_filter(edge_name, output_pair.second.m_pimpl->m_nms_classes_filter);
+            CHECK_SUCCESS_AS_EXPECTED(status);
+        }
     }
 
-    auto configured_infer_model_pimpl = ConfiguredInferModelImpl::create(network_groups.value()[0], inputs_formats, outputs_formats,
-        get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes);
-    CHECK_EXPECTED(configured_infer_model_pimpl);
+    if (progress_callback) {
+        progress_callback(ConfigureStage::CREATING_INFER_PIPELINE);
+    }
+
+    TRY(auto async_pipeline_executor, m_vdevice.get().get_async_pipeline_executor());
+
+    // If the pipeline doesn't fit in the host memory budget, its buffer pools are halved (down to a single batch) until
+    // it does - a shorter async queue is preferred over failing the configuration
+    size_t max_buffer_pool_size = internal_queue_size;
+    std::shared_ptr<ConfiguredInferModelImpl> configured_infer_model_pimpl;
+    while (nullptr == configured_infer_model_pimpl) {
+        auto expected_pimpl = ConfiguredInferModelImpl::create(network_groups.value()[0], inputs_formats,
+            outputs_formats, get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes,
+            async_pipeline_executor, inputs_resize_params, m_pipeline_elements_stats_flags,
+            HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, max_buffer_pool_size);
+        if (expected_pimpl) {
+            configured_infer_model_pimpl = expected_pimpl.release();
+        } else if ((HAILO_OUT_OF_HOST_MEMORY == expected_pimpl.status()) && host_memory_accountant->has_budget() &&
+            (max_buffer_pool_size > m_config_params.batch_size)) {
+            max_buffer_pool_size = std::max(max_buffer_pool_size / 2, static_cast<size_t>(m_config_params.batch_size));
+            LOGGER__WARNING("Infer pipeline of {} doesn't fit in the host memory budget, retrying with buffer pools of {} frames",
+                network_groups.value()[0]->name(), max_buffer_pool_size);
+        } else {
+            return make_unexpected(expected_pimpl.status());
+        }
+    }
+
+    if (m_are_host_buffers_locked) {
+        CHECK_SUCCESS_AS_EXPECTED(configured_infer_model_pimpl->lock_host_buffers());
+    }
 
     // The hef buffer is being used only when working with the service.
     // TODO HRT-12636 - Besides clearing the hef buffer, clear also unnecessary members of Hef object.
     // After HRT-12636 is done - The user can configure an infer model only once, with or without the service.
     m_hef.pimpl->clear_hef_buffer();
 
-    return ConfiguredInferModel(configured_infer_model_pimpl.release());
+    return ConfiguredInferModel(configured_infer_model_pimpl);
 }
 
 Expected<ConfiguredInferModel> InferModelBase::configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
@@ -458,6 +683,71 @@ const std::vector<std::string> &InferModelBase::get_output_names() const
     return m_output_names;
 }
 
+hailo_status InferModelBase::add_custom_post_process_op(const std::vector<std::string> &input_names,
+    std::shared_ptr<CustomPostProcessOp> op)
+{
+    CHECK(nullptr != op, HAILO_INVALID_ARGUMENT, "Custom post-process op must not be null");
+    CHECK(!input_names.empty(), HAILO_INVALID_ARGUMENT, "Custom post-process op must have inputs");
+
+    std::vector<CustomPostProcessOpBufferInfo> inputs_infos;
+    std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
+    for (const auto &input_name : input_names) {
+        CHECK(contains(m_outputs, input_name), HAILO_NOT_FOUND,
+            "Output {} not found (it may already be an input of another custom post-process op)", input_name);
+        CHECK(!contains(inputs_metadata, input_name), HAILO_INVALID_ARGUMENT,
+            "Output {} was given more than once", input_name);
+        const auto &output = m_outputs.at(input_name);
+
+        // The op runs on a single stream of the HW for each input, with no post-process op of the HEF
+        CHECK(!output.is_nms(), HAILO_NOT_SUPPORTED, "Custom post-process op over the NMS output {} is not supported", input_name);
+        TRY(const auto stream_names, m_hef.get_stream_names_from_vstream_name(input_name));
+        CHECK((1 == stream_names.size()) && (input_name == stream_names[0]), HAILO_NOT_SUPPORTED,
+            "Custom post-process op over output {} is not supported (the output isn't a stream of the model)", input_name);
+
+        CustomPostProcessOpBufferInfo input_info{};
+        input_info.name = input_name;
+        input_info.shape = output.shape();
+        input_info.format = output.format();
+        // TODO (HRT-11078): Fix multi qp for PP
+        input_info.quant_info = output.get_quant_infos()[0];
+        inputs_infos.push_back(input_info);
+
+        net_flow::BufferMetaData input_metadata = {input_info.shape, input_info.shape, input_info.format, input_info.quant_info};
+        inputs_metadata.insert({input_name, input_metadata});
+    }
+
+    TRY(const auto output_info, op->get_output_info(inputs_infos));
+    CHECK(!contains(m_outputs, output_info.name) && !contains(m_inputs, output_info.name), HAILO_INVALID_ARGUMENT,
+        "The output name {} of the custom post-process op is already used by the model", output_info.name);
+
+    std::unordered_map<std::string, net_flow::BufferMetaData> outputs_metadata;
+    net_flow::BufferMetaData output_metadata = {output_info.shape, output_info.shape, output_info.format, output_info.quant_info};
+    outputs_metadata.insert({output_info.name, output_metadata});
+
+    const std::string network_name = m_outputs.at(input_names[0]).m_pimpl->m_vstream_info.network_name;
+    TRY(auto op_metadata, net_flow::CustomOpMetadata::create(inputs_metadata, outputs_metadata, network_name, op));
+    TRY(const auto vstream_info, op_metadata->get_output_vstream_info());
+
+    auto pimpl = make_shared_nothrow<InferModel::InferStream::Impl>(vstream_info);
+    CHECK_NOT_NULL(pimpl, HAILO_OUT_OF_HOST_MEMORY);
+
+    for (const auto &input_name : input_names) {
+        m_outputs.erase(input_name);
+    }
+    m_outputs.emplace(output_info.name, InferModel::InferStream(pimpl));
+
+    m_outputs_vector.clear();
+    m_output_names.clear();
+    for (const auto &pair : m_outputs) {
+        m_outputs_vector.push_back(pair.second);
+        m_output_names.push_back(pair.first);
+    }
+
+    m_custom_ops_metadata.push_back(op_metadata);
+
+    return HAILO_SUCCESS;
+}
+
 Expected<std::unordered_map<std::string, InferModel::InferStream>> InferModelBase::create_infer_stream_inputs(Hef &hef)
 {
     auto input_vstream_infos = hef.get_input_vstream_infos();
@@ -517,6 +807,17 @@ hailo_status ConfiguredInferModel::wait_for_async_ready(std::chrono::millisecond
     return m_pimpl->wait_for_async_ready(timeout, frames_count);
 }
 
+hailo_status ConfiguredInferModel::wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count,
+    InferPriority priority)
+{
+    return m_pimpl->wait_for_async_ready(timeout, frames_count, priority);
+}
+
+Expected<underlying_waitable_handle_t> ConfiguredInferModel::get_async_ready_handle()
+{
+    return m_pimpl->get_async_ready_handle();
+}
+
 hailo_status ConfiguredInferModel::activate()
 {
     return m_pimpl->activate();
@@ -544,6 +845,47 @@ Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bi
     return async_infer_job.release();
 }
 
+Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bindings bindings, InferPriority priority,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto async_infer_job = m_pimpl->run_async(bindings, priority, callback);
+    if (HAILO_SUCCESS != async_infer_job.status()) {
+        shutdown();
+        return make_unexpected(async_infer_job.status());
+    }
+
+    return async_infer_job.release();
+}
+
+Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bindings bindings,
+    std::chrono::milliseconds deadline, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto async_infer_job = m_pimpl->run_async(bindings, deadline, callback);
+    if (HAILO_SUCCESS != async_infer_job.status()) {
+        shutdown();
+        return make_unexpected(async_infer_job.status());
+    }
+
+    return async_infer_job.release();
+}
+
+hailo_status ConfiguredInferModel::register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings)
+{
+    return m_pimpl->register_bindings(bindings);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModel::run_async_registered(size_t bindings_index,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto async_infer_job = m_pimpl->run_async_registered(bindings_index, callback);
+    if (HAILO_SUCCESS != async_infer_job.status()) {
+        shutdown();
+        return make_unexpected(async_infer_job.status());
+    }
+
+    return async_infer_job.release();
+}
+
 Expected<LatencyMeasurementResult> ConfiguredInferModel::get_hw_latency_measurement()
 {
     return m_pimpl->get_hw_latency_measurement();
@@ -564,161 +906,668 @@ hailo_status ConfiguredInferModel::set_scheduler_priority(uint8_t priority)
     return m_pimpl->set_scheduler_priority(priority);
 }
 
-Expected<size_t> ConfiguredInferModel::get_async_queue_size()
+hailo_status ConfiguredInferModel::set_scheduler_deadline(const std::chrono::milliseconds &deadline)
 {
-    return m_pimpl->get_async_queue_size();
+    return m_pimpl->set_scheduler_deadline(deadline);
 }
 
-hailo_status ConfiguredInferModel::shutdown()
+hailo_status ConfiguredInferModel::set_scheduler_share(uint32_t share)
 {
-    return m_pimpl->shutdown();
+    return m_pimpl->set_scheduler_share(share);
 }
 
-Expected<AsyncInferJob> ConfiguredInferModel::run_async(const std::vector<ConfiguredInferModel::Bindings> &bindings,
-    std::function<void(const AsyncInferCompletionInfo &)> callback)
+hailo_status ConfiguredInferModel::set_scheduler_device_affinity(uint64_t device_mask)
 {
-    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(bindings.size()));
-    if (nullptr == job_pimpl) {
-        shutdown();
-        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
-    }
-
-    auto transfer_done = [bindings, job_pimpl, callback](const AsyncInferCompletionInfo &completion_info) {
-        bool should_call_callback = ConfiguredInferModelBase::get_stream_done(completion_info.status, job_pimpl);
-        if (should_call_callback) {
-            AsyncInferCompletionInfo final_completion_info(ConfiguredInferModelBase::get_completion_status(job_pimpl));
-            callback(final_completion_info);
-            ConfiguredInferModelBase::mark_callback_done(job_pimpl);
-        }
-    };
-
-    for (const auto &binding : bindings) {
-        TRY(auto partial_job, run_async(binding, transfer_done));
-        partial_job.detach();
-    }
+    return m_pimpl->set_scheduler_device_affinity(device_mask);
+}
 
-    return AsyncInferJobImpl::create(job_pimpl);
+hailo_status ConfiguredInferModel::set_scheduler_sticky_placement(bool is_sticky)
+{
+    return m_pimpl->set_scheduler_sticky_placement(is_sticky);
 }
 
-Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelBase::create_bindings(
-    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
-    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&outputs)
+hailo_status ConfiguredInferModel::set_scheduler_pinned_device(uint32_t device_index)
 {
-    return ConfiguredInferModel::Bindings(std::move(inputs), std::move(outputs));
+    return m_pimpl->set_scheduler_pinned_device(device_index);
 }
 
-Expected<ConfiguredInferModel::Bindings::InferStream> ConfiguredInferModelBase::create_infer_stream(
-    const hailo_vstream_info_t &vstream_info)
+hailo_status ConfiguredInferModel::set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size)
 {
-    auto pimpl = make_shared_nothrow<ConfiguredInferModel::Bindings::InferStream::Impl>(vstream_info);
-    CHECK_NOT_NULL_AS_EXPECTED(pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    return m_pimpl->set_scheduler_burst_size_bounds(min_burst_size, max_burst_size);
+}
 
-    ConfiguredInferModel::Bindings::InferStream stream(pimpl);
-    return stream;
+hailo_status ConfiguredInferModel::set_scheduler_batch_size(uint16_t batch_size)
+{
+    return m_pimpl->set_scheduler_batch_size(batch_size);
 }
 
-BufferType ConfiguredInferModelBase::get_infer_stream_buffer_type(ConfiguredInferModel::Bindings::InferStream stream)
+hailo_status ConfiguredInferModel::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+    uint32_t max_pending_frames)
 {
-    return stream.m_pimpl->get_type();
+    return m_pimpl->set_scheduler_overload_policy(policy, max_pending_frames);
 }
 
-bool ConfiguredInferModelBase::get_stream_done(hailo_status status, std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+Expected<hailo_scheduler_overload_stats_t> ConfiguredInferModel::get_scheduler_overload_stats()
 {
-    return job_pimpl->stream_done(status);
+    return m_pimpl->get_scheduler_overload_stats();
 }
 
-hailo_status ConfiguredInferModelBase::get_completion_status(std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+Expected<std::vector<PipelineElementLatencyResults>> ConfiguredInferModel::get_pipeline_elements_latency()
 {
-    return job_pimpl->completion_status();
+    return m_pimpl->get_pipeline_elements_latency();
 }
 
-void ConfiguredInferModelBase::mark_callback_done(std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+Expected<size_t> ConfiguredInferModel::get_async_queue_size()
 {
-    job_pimpl->mark_callback_done();
+    return m_pimpl->get_async_queue_size();
 }
 
-hailo_status ConfiguredInferModelBase::run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout)
+Expected<std::string> ConfiguredInferModel::get_pipeline_graph(PipelineGraphFormat format)
 {
-    auto job = run_async(bindings, [] (const AsyncInferCompletionInfo &) {});
-    CHECK_EXPECTED_AS_STATUS(job);
+    return m_pimpl->get_pipeline_graph(format);
+}
 
-    auto status = job->wait(timeout);
-    CHECK_SUCCESS(status);
+hailo_status ConfiguredInferModel::set_completion_order(CompletionOrder order, uint32_t max_skew)
+{
+    return m_pimpl->set_completion_order(order, max_skew);
+}
 
-    return HAILO_SUCCESS;
+Expected<size_t> ConfiguredInferModel::get_max_async_queue_size()
+{
+    return m_pimpl->get_max_async_queue_size();
 }
 
-Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
-    const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-    const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
-    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
-    const uint32_t timeout)
+hailo_status ConfiguredInferModel::set_async_queue_size(size_t queue_size)
 {
-    auto async_infer_runner = AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, timeout);
-    CHECK_EXPECTED(async_infer_runner);
+    return m_pimpl->set_async_queue_size(queue_size);
+}
 
-    auto &hw_elem = async_infer_runner.value()->get_async_pipeline()->get_async_hw_element();
-    for (auto &pool : hw_elem->get_hw_interacted_buffer_pools_h2d()) {
-        if (!pool->is_holding_user_buffers()) {
-            CHECK_SUCCESS_AS_EXPECTED(pool->map_to_vdevice(vdevice, HAILO_DMA_BUFFER_DIRECTION_H2D));
-        }
-    }
-    for (auto &pool : hw_elem->get_hw_interacted_buffer_pools_d2h()) {
-        if (!pool->is_holding_user_buffers()) {
-            CHECK_SUCCESS_AS_EXPECTED(pool->map_to_vdevice(vdevice, HAILO_DMA_BUFFER_DIRECTION_D2H));
-        }
-    }
+Expected<size_t> ConfiguredInferModel::tune_async_queue_size(Bindings bindings,
+    std::chrono::milliseconds measurement_duration, float32_t min_throughput_ratio)
+{
+    return m_pimpl->tune_async_queue_size(bindings, measurement_duration, min_throughput_ratio);
+}
 
-    auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(net_group, async_infer_runner.release(),
-        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes);
-    CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+hailo_status ConfiguredInferModel::warm_up(Bindings bindings, uint32_t frames_count)
+{
+    return m_pimpl->warm_up(bindings, frames_count);
+}
 
-    return configured_infer_model_pimpl;
+hailo_status ConfiguredInferModel::allocate_loaned_outputs(size_t buffers_count)
+{
+    return m_pimpl->allocate_loaned_outputs(buffers_count);
 }
 
-Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::create_for_ut(std::shared_ptr<ConfiguredNetworkGroup> net_group,
-    std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
-    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes)
+Expected<AsyncInferJob> ConfiguredInferModel::run_async_loaned(Bindings bindings,
+    std::function<void(const AsyncInferCompletionInfo &, LoanedOutputs &&)> callback)
 {
-    auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(net_group, async_infer_runner,
-        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes);
-    CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    return m_pimpl->run_async_loaned(bindings, callback);
+}
 
-    return configured_infer_model_pimpl;
+hailo_status ConfiguredInferModel::set_bulk_frames_limit(uint32_t max_bulk_frames)
+{
+    return m_pimpl->set_bulk_frames_limit(max_bulk_frames);
 }
 
-ConfiguredInferModelImpl::ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng,
-    std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
-    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes) :
-    ConfiguredInferModelBase(inputs_frame_sizes, outputs_frame_sizes),
-    m_cng(cng), m_async_infer_runner(async_infer_runner), m_ongoing_parallel_transfers(0), m_input_names(input_names), m_output_names(output_names)
+hailo_status ConfiguredInferModel::enable_temporal_skip(float32_t max_mean_difference)
 {
+    return m_pimpl->enable_temporal_skip(max_mean_difference);
 }
 
-ConfiguredInferModelImpl::~ConfiguredInferModelImpl()
+hailo_status ConfiguredInferModel::disable_temporal_skip()
 {
-    shutdown();
+    return m_pimpl->disable_temporal_skip();
 }
 
-Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelImpl::create_bindings()
+hailo_status ConfiguredInferModel::recover()
 {
-    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> inputs;
-    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> outputs;
+    return m_pimpl->recover();
+}
 
-    auto cng = m_cng.lock();
-    CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
+hailo_status ConfiguredInferModel::before_fork()
+{
+    return m_pimpl->before_fork();
+}
 
-    auto input_vstream_infos = cng->get_input_vstream_infos();
-    CHECK_EXPECTED(input_vstream_infos);
+hailo_status ConfiguredInferModel::after_fork_in_parent()
+{
+    return m_pimpl->after_fork_in_parent();
+}
 
-    for (const auto &vstream_info : input_vstream_infos.value()) {
-        TRY(auto stream, ConfiguredInferModelBase::create_infer_stream(vstream_info));
-        inputs.emplace(vstream_info.name, std::move(stream));
-    }
+hailo_status ConfiguredInferModel::after_fork_in_child()
+{
+    return m_pimpl->after_fork_in_child();
+}
 
-    auto output_vstream_infos = cng->get_output_vstream_infos();
-    CHECK_EXPECTED(output_vstream_infos);
+hailo_status ConfiguredInferModel::shutdown()
+{
+    return m_pimpl->shutdown();
+}
+
+Expected<AsyncInferJob> ConfiguredInferModel::run_async(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(bindings.size()));
+    if (nullptr == job_pimpl) {
+        shutdown();
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    // The frames may be completed out of order (see set_completion_order), so the first frame is the one with the
+    // smallest sequence number
+    auto first_sequence_number = make_shared_nothrow<std::atomic<uint64_t>>(std::numeric_limits<uint64_t>::max());
+    if (nullptr == first_sequence_number) {
+        shutdown();
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    auto transfer_done = [bindings, job_pimpl, callback, first_sequence_number](const AsyncInferCompletionInfo &completion_info) {
+        auto current_first = first_sequence_number->load();
+        while ((completion_info.sequence_number < current_first) &&
+            !first_sequence_number->compare_exchange_weak(current_first, completion_info.sequence_number)) {}
+
+        bool should_call_callback = ConfiguredInferModelBase::get_stream_done(completion_info.status, job_pimpl);
+        if (should_call_callback) {
+            AsyncInferCompletionInfo final_completion_info(ConfiguredInferModelBase::get_completion_status(job_pimpl),
+                first_sequence_number->load());
+            callback(final_completion_info);
+            ConfiguredInferModelBase::mark_callback_done(job_pimpl);
+        }
+    };
+
+    auto status = m_pimpl->run_async_frames(bindings, transfer_done);
+    if (HAILO_SUCCESS != status) {
+        shutdown();
+        return make_unexpected(status);
+    }
+
+    return AsyncInferJobImpl::create(job_pimpl);
+}
+
+hailo_status ConfiguredInferModelBase::run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback)
+{
+    for (const auto &binding : bindings) {
+        TRY(auto partial_job, run_async(binding, frame_done_callback));
+        partial_job.detach();
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelBase::wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count,
+    ConfiguredInferModel::InferPriority /*priority*/)
+{
+    return wait_for_async_ready(timeout, frames_count);
+}
+
+Expected<underlying_waitable_handle_t> ConfiguredInferModelBase::get_async_ready_handle()
+{
+    LOGGER__ERROR("get_async_ready_handle is not supported for this model");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async(ConfiguredInferModel::Bindings bindings,
+    ConfiguredInferModel::InferPriority /*priority*/, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    return run_async(bindings, callback);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async(ConfiguredInferModel::Bindings /*bindings*/,
+    std::chrono::milliseconds /*deadline*/, std::function<void(const AsyncInferCompletionInfo &)> /*callback*/)
+{
+    LOGGER__ERROR("Inference deadlines are not supported for this model");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<size_t> ConfiguredInferModelBase::get_max_async_queue_size()
+{
+    return get_async_queue_size();
+}
+
+hailo_status ConfiguredInferModelBase::set_async_queue_size(size_t /*queue_size*/)
+{
+    LOGGER__ERROR("Setting the async queue size is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+// Inferring a frame never takes this long, so a timeout means the model is stuck
+#define ASYNC_QUEUE_TUNING_TIMEOUT (std::chrono::milliseconds(10000))
+#define WARM_UP_TIMEOUT (std::chrono::milliseconds(10000))
+
+// Runs asynchronous inferences of bindings for the given duration (keeping the queue full), and returns the throughput
+// in frames per second
+static Expected<float64_t> measure_async_throughput(ConfiguredInferModelBase &configured_infer_model,
+    ConfiguredInferModel::Bindings bindings, size_t queue_size, std::chrono::milliseconds duration)
+{
+    struct MeasurementState {
+        std::atomic<size_t> completed_frames;
+        std::atomic<int> status;
+    };
+    auto state = make_shared_nothrow<MeasurementState>();
+    CHECK_NOT_NULL_AS_EXPECTED(state, HAILO_OUT_OF_HOST_MEMORY);
+    state->completed_frames = 0;
+    state->status = HAILO_SUCCESS;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    while ((std::chrono::steady_clock::now() - start_time) < duration) {
+        CHECK_SUCCESS_AS_EXPECTED(configured_infer_model.wait_for_async_ready(ASYNC_QUEUE_TUNING_TIMEOUT, 1));
+        TRY(auto job, configured_infer_model.run_async(bindings, [state](const AsyncInferCompletionInfo &completion_info) {
+            if (HAILO_SUCCESS == completion_info.status) {
+                state->completed_frames++;
+            } else {
+                int expected_status = HAILO_SUCCESS;
+                state->status.compare_exchange_strong(expected_status, completion_info.status);
+            }
+        }));
+        job.detach();
+    }
+
+    // The whole queue is free once all of the frames in flight are completed
+    CHECK_SUCCESS_AS_EXPECTED(configured_infer_model.wait_for_async_ready(ASYNC_QUEUE_TUNING_TIMEOUT,
+        static_cast<uint32_t>(queue_size)));
+    const auto elapsed_time = std::chrono::duration<float64_t>(std::chrono::steady_clock::now() - start_time);
+    CHECK_SUCCESS_AS_EXPECTED(static_cast<hailo_status>(state->status.load()), "Inference failed while measuring the throughput");
+
+    return static_cast<float64_t>(state->completed_frames.load()) / elapsed_time.count();
+}
+
+Expected<size_t> ConfiguredInferModelBase::tune_async_queue_size(ConfiguredInferModel::Bindings bindings,
+    std::chrono::milliseconds measurement_duration, float32_t min_throughput_ratio)
+{
+    CHECK_AS_EXPECTED((0 < min_throughput_ratio) && (min_throughput_ratio <= 1), HAILO_INVALID_ARGUMENT,
+        "Invalid throughput ratio {} (must be in (0, 1])", min_throughput_ratio);
+    CHECK_AS_EXPECTED(0 < measurement_duration.count(), HAILO_INVALID_ARGUMENT, "Measurement duration must not be 0");
+    TRY(const auto max_queue_size, get_max_async_queue_size());
+    TRY(const auto original_queue_size, get_async_queue_size());
+
+    std::map<size_t, float64_t> throughputs;
+    auto measure = [&](size_t queue_size) -> hailo_status {
+        auto status = set_async_queue_size(queue_size);
+        CHECK_SUCCESS(status);
+        auto throughput = measure_async_throughput(*this, bindings, queue_size, measurement_duration);
+        CHECK_EXPECTED_AS_STATUS(throughput);
+        LOGGER__INFO("Async queue size {}: {:.2f} FPS", queue_size, throughput.value());
+        throughputs[queue_size] = throughput.release();
+        return HAILO_SUCCESS;
+    };
+
+    // The throughput grows with the queue size until the device is kept busy, so the sizes are first measured in
+    // powers of 2, and then the sizes between the first size that reaches the peak and the size before it
+    auto status = HAILO_SUCCESS;
+    for (size_t queue_size = 1; (HAILO_SUCCESS == status) && (queue_size < max_queue_size); queue_size *= 2) {
+        status = measure(queue_size);
+    }
+    if (HAILO_SUCCESS == status) {
+        status = measure(max_queue_size);
+    }
+
+    size_t chosen_queue_size = max_queue_size;
+    if (HAILO_SUCCESS == status) {
+        float64_t peak_throughput = 0;
+        for (const auto &throughput : throughputs) {
+            peak_throughput = std::max(peak_throughput, throughput.second);
+        }
+        const auto required_throughput = peak_throughput * min_throughput_ratio;
+
+        size_t previous_queue_size = 0;
+        for (const auto &throughput : throughputs) {
+            if (throughput.second >= required_throughput) {
+                chosen_queue_size = throughput.first;
+                break;
+            }
+            previous_queue_size = throughput.first;
+        }
+
+        for (size_t queue_size = previous_queue_size + 1; (HAILO_SUCCESS == status) && (queue_size < chosen_queue_size);
+                queue_size++) {
+            status = measure(queue_size);
+            if ((HAILO_SUCCESS == status) && (throughputs[queue_size] >= required_throughput)) {
+                chosen_queue_size = queue_size;
+            }
+        }
+    }
+
+    if (HAILO_SUCCESS != status) {
+        // Best effort - the failure of the measurement is the one returned
+        (void)set_async_queue_size(original_queue_size);
+        return make_unexpected(status);
+    }
+
+    CHECK_SUCCESS_AS_EXPECTED(set_async_queue_size(chosen_queue_size));
+    LOGGER__INFO("Async queue size tuned to {} (of {})", chosen_queue_size, max_queue_size);
+
+    return chosen_queue_size;
+}
+
+hailo_status ConfiguredInferModelBase::warm_up(ConfiguredInferModel::Bindings bindings, uint32_t frames_count)
+{
+    TRY(const auto queue_size, get_async_queue_size());
+    if (0 == frames_count) {
+        frames_count = static_cast<uint32_t>(queue_size);
+    }
+
+    auto warm_up_status = make_shared_nothrow<std::atomic<int>>(HAILO_SUCCESS);
+    CHECK_NOT_NULL(warm_up_status, HAILO_OUT_OF_HOST_MEMORY);
+    for (uint32_t i = 0; i < frames_count; i++) {
+        CHECK_SUCCESS(wait_for_async_ready(WARM_UP_TIMEOUT, 1));
+        TRY(auto job, run_async(bindings, [warm_up_status](const AsyncInferCompletionInfo &completion_info) {
+            int expected_status = HAILO_SUCCESS;
+            warm_up_status->compare_exchange_strong(expected_status, completion_info.status);
+        }));
+        job.detach();
+    }
+
+    // The whole queue is free once all of the frames are completed
+    CHECK_SUCCESS(wait_for_async_ready(WARM_UP_TIMEOUT, static_cast<uint32_t>(queue_size)));
+    CHECK_SUCCESS(static_cast<hailo_status>(warm_up_status->load()), "Inference failed while warming up");
+    LOGGER__INFO("Warmed up with {} frames", frames_count);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<std::shared_ptr<LoanedBuffersPool>> LoanedBuffersPool::create(size_t buffer_size, size_t buffers_count)
+{
+    std::vector<BufferPtr> buffers;
+    buffers.reserve(buffers_count);
+    for (size_t i = 0; i < buffers_count; i++) {
+        // Page aligned (as the output buffers should be), so the buffers are transferred to without bounce buffers
+        TRY(auto buffer, Buffer::create_shared(buffer_size, BufferStorageParams::create_dma()));
+        buffers.emplace_back(std::move(buffer));
+    }
+
+    auto pool = make_shared_nothrow<LoanedBuffersPool>(std::move(buffers));
+    CHECK_NOT_NULL_AS_EXPECTED(pool, HAILO_OUT_OF_HOST_MEMORY);
+    return pool;
+}
+
+LoanedBuffersPool::LoanedBuffersPool(std::vector<BufferPtr> &&buffers) :
+    m_buffers(std::move(buffers))
+{
+    m_views.reserve(m_buffers.size());
+    m_free_indices.reserve(m_buffers.size());
+    for (size_t i = 0; i < m_buffers.size(); i++) {
+        m_views.emplace_back(*m_buffers[i]);
+        m_free_indices.push_back(m_buffers.size() - i - 1);
+    }
+}
+
+Expected<std::shared_ptr<MemoryView>> LoanedBuffersPool::loan()
+{
+    // The loan holds the pool, and gives the buffer back once the last copy of the view is destroyed
+    struct Loan {
+        Loan(std::shared_ptr<LoanedBuffersPool> pool, size_t index) : pool(std::move(pool)), index(index) {}
+        ~Loan() { pool->give_back(index); }
+        std::shared_ptr<LoanedBuffersPool> pool;
+        const size_t index;
+    };
+
+    size_t index = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK_AS_EXPECTED(!m_free_indices.empty(), HAILO_QUEUE_IS_FULL, "All of the {} loaned buffers are held",
+            m_buffers.size());
+        index = m_free_indices.back();
+        m_free_indices.pop_back();
+    }
+
+    auto loan = make_shared_nothrow<Loan>(shared_from_this(), index);
+    if (nullptr == loan) {
+        give_back(index);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+    // Aliasing the loan, so the view is valid for as long as the loan is held
+    return std::shared_ptr<MemoryView>(loan, &m_views[index]);
+}
+
+void LoanedBuffersPool::give_back(size_t index)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_free_indices.push_back(index);
+}
+
+hailo_status ConfiguredInferModelBase::allocate_loaned_outputs(size_t buffers_count)
+{
+    CHECK(0 < buffers_count, HAILO_INVALID_ARGUMENT, "Loaned buffers count must be greater than 0");
+
+    std::unordered_map<std::string, std::shared_ptr<LoanedBuffersPool>> pools;
+    for (const auto &output_frame_size : m_outputs_frame_sizes) {
+        TRY(pools[output_frame_size.first], LoanedBuffersPool::create(output_frame_size.second, buffers_count),
+            "Failed to allocate the loaned buffers of {}", output_frame_size.first);
+    }
+    m_loaned_outputs_pools = std::move(pools);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async_loaned(ConfiguredInferModel::Bindings bindings,
+    std::function<void(const AsyncInferCompletionInfo &, ConfiguredInferModel::LoanedOutputs &&)> callback)
+{
+    CHECK_AS_EXPECTED(!m_loaned_outputs_pools.empty(), HAILO_INVALID_OPERATION,
+        "The loaned outputs weren't allocated (see allocate_loaned_outputs)");
+
+    // Shared by the callback (std::function must be copyable). If the frame isn't launched, the buffers are returned
+    // once it is destroyed.
+    auto loaned_outputs = make_shared_nothrow<ConfiguredInferModel::LoanedOutputs>();
+    CHECK_NOT_NULL_AS_EXPECTED(loaned_outputs, HAILO_OUT_OF_HOST_MEMORY);
+    for (auto &pool : m_loaned_outputs_pools) {
+        TRY(auto buffer, pool.second->loan(), "Failed to loan a buffer of {}", pool.first);
+        TRY(auto output, bindings.output(pool.first));
+        CHECK_SUCCESS_AS_EXPECTED(output.set_buffer(*buffer));
+        loaned_outputs->emplace(pool.first, std::move(buffer));
+    }
+
+    return run_async(bindings, [loaned_outputs, callback](const AsyncInferCompletionInfo &completion_info) {
+        callback(completion_info, std::move(*loaned_outputs));
+    });
+}
+
+hailo_status ConfiguredInferModelBase::set_bulk_frames_limit(uint32_t /*max_bulk_frames*/)
+{
+    LOGGER__ERROR("Limiting the bulk frames is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::enable_temporal_skip(float32_t /*max_mean_difference*/)
+{
+    LOGGER__ERROR("Skipping frames is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::disable_temporal_skip()
+{
+    LOGGER__ERROR("Skipping frames is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::before_fork()
+{
+    LOGGER__ERROR("Sharing the model with forked processes is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::after_fork_in_parent()
+{
+    LOGGER__ERROR("Sharing the model with forked processes is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::after_fork_in_child()
+{
+    LOGGER__ERROR("Sharing the model with forked processes is not supported for this model");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredInferModelBase::register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings)
+{
+    for (const auto &current_bindings : bindings) {
+        CHECK_SUCCESS(validate_bindings(current_bindings));
+    }
+    m_registered_bindings = bindings;
+
+    return HAILO_SUCCESS;
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async_registered(size_t bindings_index,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    CHECK_AS_EXPECTED(bindings_index < m_registered_bindings.size(), HAILO_INVALID_ARGUMENT,
+        "Bindings index {} is out of range, {} bindings were registered", bindings_index, m_registered_bindings.size());
+
+    return run_async(m_registered_bindings[bindings_index], callback);
+}
+
+Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelBase::create_bindings(
+    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
+    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&outputs)
+{
+    return ConfiguredInferModel::Bindings(std::move(inputs), std::move(outputs));
+}
+
+Expected<ConfiguredInferModel::Bindings::InferStream> ConfiguredInferModelBase::create_infer_stream(
+    const hailo_vstream_info_t &vstream_info)
+{
+    auto pimpl = make_shared_nothrow<ConfiguredInferModel::Bindings::InferStream::Impl>(vstream_info);
+    CHECK_NOT_NULL_AS_EXPECTED(pimpl, HAILO_OUT_OF_HOST_MEMORY);
+
+    ConfiguredInferModel::Bindings::InferStream stream(pimpl);
+    return stream;
+}
+
+BufferType ConfiguredInferModelBase::get_infer_stream_buffer_type(ConfiguredInferModel::Bindings::InferStream stream)
+{
+    return stream.m_pimpl->get_type();
+}
+
+bool ConfiguredInferModelBase::get_stream_done(hailo_status status, std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+{
+    return job_pimpl->stream_done(status);
+}
+
+hailo_status ConfiguredInferModelBase::get_completion_status(std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+{
+    return job_pimpl->completion_status();
+}
+
+void ConfiguredInferModelBase::mark_callback_done(std::shared_ptr<AsyncInferJobImpl> job_pimpl)
+{
+    job_pimpl->mark_callback_done();
+}
+
+hailo_status ConfiguredInferModelBase::run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout)
+{
+    auto job = run_async(bindings, [] (const AsyncInferCompletionInfo &) {});
+    CHECK_EXPECTED_AS_STATUS(job);
+
+    auto status = job->wait(timeout);
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+// Each frame in flight holds a job and an infer request control. The jobs may outlive their frames (until the user
+// releases them), so the pool holds twice the frames in flight.
+static Expected<std::shared_ptr<TransientObjectPool>> create_transient_objects_pool(AsyncInferRunnerImpl &async_infer_runner)
+{
+    static const size_t OBJECTS_PER_FRAME = 2;
+    return TransientObjectPool::create(2 * OBJECTS_PER_FRAME * async_infer_runner.get_max_ongoing_frames_count());
+}
+
+Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
+    const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
+    const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+    const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
+    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
+    std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor,
+    const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params,
+    hailo_pipeline_elem_stats_flags_t elem_stats_flags, const uint32_t timeout, size_t max_buffer_pool_size)
+{
+    // The VDevice outlives its configured models, and the net group is owned by the model
+    std::weak_ptr<ConfiguredNetworkGroup> weak_net_group = net_group;
+    auto async_infer_runner_factory = [weak_net_group, inputs_formats, outputs_formats, timeout, async_pipeline_executor,
+        elem_stats_flags, inputs_resize_params, max_buffer_pool_size, &vdevice]()
+        -> Expected<std::shared_ptr<AsyncInferRunnerImpl>> {
+        auto net_group = weak_net_group.lock();
+        CHECK_NOT_NULL_AS_EXPECTED(net_group, HAILO_INTERNAL_FAILURE);
+
+        TRY(auto async_infer_runner, AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, timeout,
+            async_pipeline_executor, elem_stats_flags, inputs_resize_params, max_buffer_pool_size));
+
+        auto &hw_elem = async_infer_runner->get_async_pipeline()->get_async_hw_element();
+        for (auto &pool : hw_elem->get_hw_interacted_buffer_pools_h2d()) {
+            if (!pool->is_holding_user_buffers()) {
+                CHECK_SUCCESS_AS_EXPECTED(pool->map_to_vdevice(vdevice, HAILO_DMA_BUFFER_DIRECTION_H2D));
+            }
+        }
+        for (auto &pool : hw_elem->get_hw_interacted_buffer_pools_d2h()) {
+            if (!pool->is_holding_user_buffers()) {
+                CHECK_SUCCESS_AS_EXPECTED(pool->map_to_vdevice(vdevice, HAILO_DMA_BUFFER_DIRECTION_D2H));
+            }
+        }
+        return async_infer_runner;
+    };
+
+    TRY(auto async_infer_runner, async_infer_runner_factory());
+    TRY(auto transient_objects_pool, create_transient_objects_pool(*async_infer_runner));
+    auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(net_group, async_infer_runner,
+        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes, transient_objects_pool);
+    CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    configured_infer_model_pimpl->m_async_infer_runner_factory = std::move(async_infer_runner_factory);
+    configured_infer_model_pimpl->m_is_using_pipeline_executor = (nullptr != async_pipeline_executor);
+
+    return configured_infer_model_pimpl;
+}
+
+Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::create_for_ut(std::shared_ptr<ConfiguredNetworkGroup> net_group,
+    std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
+    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes)
+{
+    TRY(auto transient_objects_pool, create_transient_objects_pool(*async_infer_runner));
+    auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(net_group, async_infer_runner,
+        input_names, output_names, inputs_frame_sizes, outputs_frame_sizes, transient_objects_pool);
+    CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+
+    return configured_infer_model_pimpl;
+}
+
+ConfiguredInferModelImpl::ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng,
+    std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
+    const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
+    std::shared_ptr<TransientObjectPool> transient_objects_pool) :
+    ConfiguredInferModelBase(inputs_frame_sizes, outputs_frame_sizes),
+    m_cng(cng), m_async_infer_runner(async_infer_runner), m_ongoing_parallel_transfers(0),
+    m_async_queue_size_limit(std::numeric_limits<size_t>::max()), m_ongoing_bulk_frames(0),
+    m_bulk_frames_limit(static_cast<uint32_t>(async_infer_runner->get_max_ongoing_frames_count())),
+    m_waiting_interactive_frames(0), m_next_sequence_number(0), m_input_names(input_names), m_output_names(output_names),
+    m_transient_objects_pool(transient_objects_pool), m_are_host_buffers_locked(false), m_is_using_pipeline_executor(false),
+    m_is_temporal_skip_enabled(false), m_temporal_skip_max_mean_difference(0), m_is_reference_frame_valid(false),
+    m_reference_sequence_number(0), m_are_cached_outputs_valid(false)
+{
+}
+
+ConfiguredInferModelImpl::~ConfiguredInferModelImpl()
+{
+    shutdown();
+}
+
+Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelImpl::create_bindings()
+{
+    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> inputs;
+    std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> outputs;
+
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
+
+    auto input_vstream_infos = cng->get_input_vstream_infos();
+    CHECK_EXPECTED(input_vstream_infos);
+
+    for (const auto &vstream_info : input_vstream_infos.value()) {
+        TRY(auto stream, ConfiguredInferModelBase::create_infer_stream(vstream_info));
+        inputs.emplace(vstream_info.name, std::move(stream));
+    }
+
+    auto output_vstream_infos = cng->get_output_vstream_infos();
+    CHECK_EXPECTED(output_vstream_infos);
 
     for (const auto &vstream_info : output_vstream_infos.value()) {
         TRY(auto stream, ConfiguredInferModelBase::create_infer_stream(vstream_info));
@@ -731,9 +1580,35 @@ Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelImpl::create_bindin
 
 hailo_status ConfiguredInferModelImpl::wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count)
 {
+    return wait_for_async_ready(timeout, frames_count, ConfiguredInferModel::InferPriority::INTERACTIVE);
+}
+
+hailo_status ConfiguredInferModelImpl::wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count,
+    ConfiguredInferModel::InferPriority priority)
+{
+    // Each frame in flight holds a credit until its callback is called, so the producer is throttled by the frames
+    // completion rate. Frames that got a credit never block inside the pipeline (e.g. when one of the outputs is
+    // consumed slower than the others), since every pool has a free buffer for them.
     std::unique_lock<std::mutex> lock(m_mutex);
+    const auto max_ongoing_frames_count = get_max_ongoing_frames_count();
+    CHECK(frames_count <= max_ongoing_frames_count, HAILO_INVALID_ARGUMENT,
+        "Waiting for {} frames is not supported, the async queue size is {}", frames_count, max_ongoing_frames_count);
+
+    const bool is_bulk = (ConfiguredInferModel::InferPriority::BULK == priority);
+    CHECK(!is_bulk || (frames_count <= m_bulk_frames_limit), HAILO_INVALID_ARGUMENT,
+        "Waiting for {} bulk frames is not supported, the bulk frames limit is {}", frames_count, m_bulk_frames_limit);
+
+    if (!is_bulk) {
+        m_waiting_interactive_frames += frames_count;
+    }
     hailo_status status = HAILO_SUCCESS;
-    bool was_successful = m_cv.wait_for(lock, timeout, [this, frames_count, &status] () -> bool {
+    bool was_successful = m_cv.wait_for(lock, timeout, [this, frames_count, max_ongoing_frames_count, is_bulk, &status] () -> bool {
+        if ((m_ongoing_parallel_transfers + frames_count) > max_ongoing_frames_count) {
+            return false;
+        }
+        if (is_bulk && ((0 != m_waiting_interactive_frames) || ((m_ongoing_bulk_frames + frames_count) > m_bulk_frames_limit))) {
+            return false;
+        }
         auto pools_are_ready = m_async_infer_runner->can_push_buffers(frames_count);
         if (HAILO_SUCCESS != pools_are_ready.status()) {
             status = pools_are_ready.status();
@@ -741,15 +1616,55 @@ hailo_status ConfiguredInferModelImpl::wait_for_async_ready(std::chrono::millise
         }
         return pools_are_ready.release();
     });
+    if (!is_bulk) {
+        m_waiting_interactive_frames -= frames_count;
+        lock.unlock();
+        // The bulk frames waiting behind this frame may go on (or keep waiting for its place to be free)
+        m_cv.notify_all();
+    }
     CHECK_SUCCESS(status);
 
-    CHECK(was_successful, HAILO_TIMEOUT, "Got timeout in `wait_for_async_ready`");
+    if (!was_successful) {
+        // Timeouts tend to repeat on every frame once the device stalls
+        LOGGER__ERROR_RATE_LIMITED("Got timeout in `wait_for_async_ready`");
+        return HAILO_TIMEOUT;
+    }
 
     return HAILO_SUCCESS;
 }
 
+Expected<underlying_waitable_handle_t> ConfiguredInferModelImpl::get_async_ready_handle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (nullptr == m_async_ready_event) {
+        TRY(m_async_ready_event, ReadyEvent::create(false));
+        update_async_ready_event();
+    }
+    return m_async_ready_event->get_underlying_handle();
+}
+
+void ConfiguredInferModelImpl::update_async_ready_event()
+{
+    if (nullptr == m_async_ready_event) {
+        return;
+    }
+
+    // A single interactive frame is ready once it has a credit (see wait_for_async_ready). A failed pipeline is
+    // reported as ready, so the error is returned by the next run_async.
+    const bool is_ready = (m_ongoing_parallel_transfers < get_max_ongoing_frames_count()) ||
+        (HAILO_SUCCESS != m_async_infer_runner->get_pipeline_status());
+    auto status = m_async_ready_event->update(is_ready);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed updating the async ready event of the model, status {}", status);
+    }
+}
+
 hailo_status ConfiguredInferModelImpl::shutdown()
 {
+    if (nullptr == m_async_infer_runner) {
+        // The pipeline was released by before_fork, and wasn't built again
+        return deactivate();
+    }
     m_async_infer_runner->abort();
     std::unique_lock<std::mutex> lock(m_mutex);
     m_cv.wait_for(lock, WAIT_FOR_ASYNC_IN_DTOR_TIMEOUT, [this] () -> bool {
@@ -759,126 +1674,547 @@ hailo_status ConfiguredInferModelImpl::shutdown()
     return deactivate();
 }
 
+hailo_status ConfiguredInferModelImpl::recover()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+    auto cng_base = std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(cng);
+    CHECK(nullptr != cng_base, HAILO_NOT_SUPPORTED, "Recovering a model is not supported over the multi-process service");
+    auto core_op = std::dynamic_pointer_cast<VDeviceCoreOp>(cng_base->get_core_op());
+    CHECK_NOT_NULL(core_op, HAILO_INTERNAL_FAILURE);
+
+    // Deactivating the core op resets its channels and cancels its transfers in flight. When scheduled, it is activated
+    // again by the scheduler, which then goes on with its queued infer requests.
+    const bool was_activated = (nullptr != m_ang);
+    if (cng->is_scheduled()) {
+        CHECK_SUCCESS(core_op->recover());
+    } else {
+        m_ang = nullptr;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const bool were_frames_completed = m_cv.wait_for(lock, WAIT_FOR_ASYNC_IN_DTOR_TIMEOUT, [this] () -> bool {
+            return m_ongoing_parallel_transfers == 0;
+        });
+        CHECK(were_frames_completed, HAILO_TIMEOUT, "Recovering the model failed, {} frames in flight weren't completed",
+            m_ongoing_parallel_transfers);
+    }
+
+    // A failed frame shuts the host pipeline down (see AsyncPipeline::shutdown), so it is built again for the core op
+    // that is still configured.
+    if (HAILO_SUCCESS != m_async_infer_runner->get_pipeline_status()) {
+        CHECK(nullptr != m_async_infer_runner_factory, HAILO_NOT_SUPPORTED,
+            "The pipeline of the model was shut down, and can't be built again");
+        LOGGER__WARNING("Building the pipeline of {} again, after it was shut down with status {}", cng->name(),
+            m_async_infer_runner->get_pipeline_status());
+        CHECK_SUCCESS(rebuild_pipeline());
+    }
+
+    if (was_activated) {
+        CHECK_SUCCESS(activate());
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::rebuild_pipeline()
+{
+    TRY(auto async_infer_runner, m_async_infer_runner_factory());
+    if (m_are_host_buffers_locked) {
+        CHECK_SUCCESS(async_infer_runner->lock_host_buffers());
+    }
+    TRY(auto transient_objects_pool, create_transient_objects_pool(*async_infer_runner));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_async_infer_runner = async_infer_runner;
+    m_transient_objects_pool = transient_objects_pool;
+    update_async_ready_event();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::before_fork()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+    // The configured network group is shared through the service (each process dups its handle), while the host
+    // pipeline is built by each process
+    CHECK(nullptr == std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(cng), HAILO_NOT_SUPPORTED,
+        "Sharing a model with forked processes is supported over the multi-process service only");
+    CHECK(cng->is_scheduled(), HAILO_INVALID_OPERATION,
+        "Sharing a model with forked processes is supported with the model scheduler only");
+    CHECK(!m_is_using_pipeline_executor, HAILO_NOT_SUPPORTED,
+        "Sharing a model with forked processes is not supported with a shared pipeline executor");
+    CHECK(nullptr != m_async_infer_runner_factory, HAILO_NOT_SUPPORTED,
+        "The pipeline of the model can't be built again after fork");
+
+    std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(0 == m_ongoing_parallel_transfers, HAILO_INVALID_OPERATION,
+            "Can't fork while {} frames of the model are in flight", m_ongoing_parallel_transfers);
+        // The pipeline threads aren't copied to the child, so the pipeline is released before fork (and built again
+        // by both processes afterwards)
+        async_infer_runner = std::move(m_async_infer_runner);
+        m_transient_objects_pool.reset();
+    }
+    async_infer_runner.reset();
+
+    return cng->before_fork();
+}
+
+hailo_status ConfiguredInferModelImpl::after_fork_in_parent()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+    CHECK_SUCCESS(cng->after_fork_in_parent());
+
+    return rebuild_pipeline();
+}
+
+hailo_status ConfiguredInferModelImpl::after_fork_in_child()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+    // Dups the network group's handle for the child's pid, so the child uses the model configured by its parent
+    CHECK_SUCCESS(cng->after_fork_in_child());
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ongoing_parallel_transfers = 0;
+        m_ongoing_bulk_frames = 0;
+        m_waiting_interactive_frames = 0;
+    }
+
+    return rebuild_pipeline();
+}
+
 hailo_status ConfiguredInferModelImpl::activate()
 {
     auto cng = m_cng.lock();
     CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
 
-    auto activated_ng = cng->activate();
-    CHECK_EXPECTED_AS_STATUS(activated_ng);
+    auto activated_ng = cng->activate();
+    CHECK_EXPECTED_AS_STATUS(activated_ng);
+
+    m_ang = activated_ng.release();
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::deactivate()
+{
+    m_ang = nullptr;
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::validate_bindings(ConfiguredInferModel::Bindings bindings)
+{
+    for (const auto &input_name : m_input_names) {
+        TRY(auto input, bindings.input(input_name));
+        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
+        switch (buffer_type) {
+            case BufferType::VIEW:
+            {
+                auto buffer = input.get_buffer();
+                CHECK_EXPECTED_AS_STATUS(buffer);
+                CHECK(buffer->size() == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
+                    "Input buffer size {} is different than expected {} for input '{}'", buffer->size(), m_inputs_frame_sizes.at(input_name), input_name);
+                break;
+            }
+            case BufferType::PIX_BUFFER:
+            {
+                auto buffer = input.get_pix_buffer();
+                CHECK_EXPECTED_AS_STATUS(buffer);
+                size_t buffer_size = 0;
+                for (size_t i = 0 ; i < buffer->number_of_planes ; i++) {
+                    buffer_size += buffer->planes[i].bytes_used;
+                }
+                CHECK(buffer_size == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
+                    "Input buffer size {} is different than expected {} for input '{}'", buffer_size, m_inputs_frame_sizes.at(input_name), input_name);
+                break;
+            }
+            case BufferType::DMA_BUFFER:
+            {
+                auto buffer = input.get_dma_buffer();
+                CHECK_EXPECTED_AS_STATUS(buffer);
+                CHECK(buffer->size == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
+                    "Input buffer size {} is different than expected {} for input '{}'", buffer->size, m_inputs_frame_sizes.at(input_name), input_name);
+                break;
+            }
+            default:
+                CHECK(false, HAILO_NOT_FOUND, "Couldnt find input buffer for '{}'", input_name);
+        }
+    }
+    for (const auto &output_name : m_output_names) {
+        TRY(auto output, bindings.output(output_name));
+        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(output);
+        switch (buffer_type) {
+            case BufferType::VIEW:
+            {
+                auto buffer = output.get_buffer();
+                CHECK_EXPECTED_AS_STATUS(buffer);
+                CHECK(buffer->size() == m_outputs_frame_sizes.at(output_name), HAILO_INVALID_OPERATION,
+                    "Output buffer size {} is different than expected {} for output '{}'", buffer->size(), m_outputs_frame_sizes.at(output_name), output_name);
+                break;
+            }
+            case BufferType::PIX_BUFFER:
+            {
+                CHECK(false, HAILO_NOT_SUPPORTED, "pix_buffer isn't supported for outputs in '{}'", output_name);
+                break;
+            }
+            case BufferType::DMA_BUFFER:
+            {
+                auto buffer = output.get_dma_buffer();
+                CHECK_EXPECTED_AS_STATUS(buffer);
+                CHECK(buffer->size == m_outputs_frame_sizes.at(output_name), HAILO_INVALID_OPERATION,
+                    "Output buffer size {} is different than expected {} for out '{}'", buffer->size, m_outputs_frame_sizes.at(output_name), output_name);
+                break;
+            }
+            default:
+                CHECK(false, HAILO_NOT_FOUND, "Couldnt find output buffer for '{}'", output_name);
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+TransferDoneCallbackAsyncInfer ConfiguredInferModelImpl::create_transfer_done_callback(std::shared_ptr<AsyncInferJobImpl> job_pimpl,
+    std::function<void(const AsyncInferCompletionInfo &)> callback, uint64_t sequence_number)
+{
+    return [this, job_pimpl, callback, sequence_number](hailo_status status) {
+        bool should_call_callback = ConfiguredInferModelBase::get_stream_done(status, job_pimpl);
+        if (should_call_callback) {
+            auto final_status = (m_async_infer_runner->get_pipeline_status() == HAILO_SUCCESS) ?
+                ConfiguredInferModelBase::get_completion_status(job_pimpl) : m_async_infer_runner->get_pipeline_status();
+
+            AsyncInferCompletionInfo completion_info(final_status, sequence_number);
+            const auto &control = job_pimpl->get_infer_request_control();
+            if (nullptr != control) {
+                completion_info.h2d_start_time = control->get_h2d_start_time();
+                completion_info.d2h_complete_time = control->get_d2h_complete_time();
+            }
+            callback(completion_info);
+            ConfiguredInferModelBase::mark_callback_done(job_pimpl);
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_ongoing_parallel_transfers--;
+                update_async_ready_event();
+            }
+            m_cv.notify_all();
+        }
+    };
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel::Bindings bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    // Every job gets a control, so it can be cancelled
+    auto control = make_pooled_shared<InferRequestControl>(m_transient_objects_pool);
+    CHECK_NOT_NULL_AS_EXPECTED(control, HAILO_OUT_OF_HOST_MEMORY);
+
+    return run_async_with_control(bindings, callback, control);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel::Bindings bindings,
+    std::chrono::milliseconds deadline, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto control = make_pooled_shared<InferRequestControl>(m_transient_objects_pool,
+        InferRequestControl::Clock::now() + deadline);
+    CHECK_NOT_NULL_AS_EXPECTED(control, HAILO_OUT_OF_HOST_MEMORY);
+
+    return run_async_with_control(bindings, callback, control);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async_with_control(ConfiguredInferModel::Bindings bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> callback, InferRequestControlPtr control)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate_bindings(bindings));
+
+    auto job_pimpl = make_pooled_shared<AsyncInferJobImpl>(m_transient_objects_pool,
+        static_cast<uint32_t>(m_input_names.size() + m_output_names.size()));
+    CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    job_pimpl->set_infer_request_control(control);
+
+    TransferDoneCallbackAsyncInfer skipped_frame_done = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const auto sequence_number = m_next_sequence_number++;
+        auto frame_callback = callback;
+        if (m_is_temporal_skip_enabled) {
+            if (try_skip_frame(bindings)) {
+                auto skipped_callback = [callback](const AsyncInferCompletionInfo &completion_info) {
+                    auto skipped_completion_info = completion_info;
+                    skipped_completion_info.is_skipped = true;
+                    callback(skipped_completion_info);
+                };
+                skipped_frame_done = create_transfer_done_callback(job_pimpl, skipped_callback, sequence_number);
+                m_ongoing_parallel_transfers++;
+                update_async_ready_event();
+            } else {
+                CHECK_SUCCESS_AS_EXPECTED(set_reference_frame(bindings, sequence_number));
+                frame_callback = [this, bindings, callback, sequence_number](const AsyncInferCompletionInfo &completion_info) mutable {
+                    const auto is_cached = (HAILO_SUCCESS == completion_info.status) &&
+                        (HAILO_SUCCESS == cache_outputs(bindings, sequence_number));
+                    callback(completion_info);
+                    if (is_cached) {
+                        // The next frames get the cached outputs once this frame's callback was called
+                        std::unique_lock<std::mutex> cache_lock(m_mutex);
+                        m_are_cached_outputs_valid = (m_reference_sequence_number == sequence_number);
+                    }
+                };
+            }
+        }
+
+        if (nullptr == skipped_frame_done) {
+            // The bindings are kept alive until the frame is done
+            auto frame_done = create_transfer_done_callback(job_pimpl, frame_callback, sequence_number);
+            TransferDoneCallbackAsyncInfer transfer_done = [bindings, frame_done](hailo_status status) {
+                frame_done(status);
+            };
+
+            auto status = m_async_infer_runner->run(bindings, transfer_done, control);
+            CHECK_SUCCESS_AS_EXPECTED(status);
+            m_ongoing_parallel_transfers++;
+            update_async_ready_event();
+        }
+    }
+    m_cv.notify_all();
+
+    if (nullptr != skipped_frame_done) {
+        // The frame is done once all of its transfers are done, none of them reaches the device
+        for (size_t i = 0; i < (m_input_names.size() + m_output_names.size()); i++) {
+            skipped_frame_done(HAILO_SUCCESS);
+        }
+    }
+
+    return AsyncInferJobImpl::create(job_pimpl);
+}
+
+bool ConfiguredInferModelImpl::try_skip_frame(ConfiguredInferModel::Bindings &bindings)
+{
+    if (!m_is_reference_frame_valid || !m_are_cached_outputs_valid) {
+        return false;
+    }
+
+    uint64_t difference_sum = 0;
+    size_t compared_size = 0;
+    const auto &kernels = FrameDifferenceKernels::get();
+    for (const auto &input_name : m_input_names) {
+        auto input = bindings.input(input_name);
+        if (!input || (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(input.value()))) {
+            return false;
+        }
+        auto buffer = input->get_buffer();
+        if (!buffer) {
+            return false;
+        }
+        const auto &reference = m_reference_inputs.at(input_name);
+        difference_sum += kernels.sum_abs_difference(buffer->data(), reference.data(), reference.size());
+        compared_size += reference.size();
+    }
+    if ((0 == compared_size) ||
+        ((static_cast<float64_t>(difference_sum) / static_cast<float64_t>(compared_size)) > m_temporal_skip_max_mean_difference)) {
+        return false;
+    }
+
+    std::vector<MemoryView> output_buffers;
+    output_buffers.reserve(m_output_names.size());
+    for (const auto &output_name : m_output_names) {
+        auto output = bindings.output(output_name);
+        if (!output || (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(output.value()))) {
+            return false;
+        }
+        auto buffer = output->get_buffer();
+        if (!buffer) {
+            return false;
+        }
+        output_buffers.emplace_back(buffer.release());
+    }
+    for (size_t i = 0; i < m_output_names.size(); i++) {
+        const auto &cached_output = m_cached_outputs.at(m_output_names[i]);
+        memcpy(output_buffers[i].data(), cached_output.data(), cached_output.size());
+    }
+
+    return true;
+}
+
+hailo_status ConfiguredInferModelImpl::set_reference_frame(ConfiguredInferModel::Bindings &bindings, uint64_t sequence_number)
+{
+    // The outputs of the previous reference frame don't match the new reference
+    m_reference_sequence_number = sequence_number;
+    m_are_cached_outputs_valid = false;
+    m_is_reference_frame_valid = false;
+
+    for (const auto &input_name : m_input_names) {
+        TRY(auto input, bindings.input(input_name));
+        if (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(input)) {
+            // Frames of other buffer types aren't compared
+            return HAILO_SUCCESS;
+        }
+        TRY(auto buffer, input.get_buffer());
+        auto reference = m_reference_inputs.find(input_name);
+        if (m_reference_inputs.end() == reference) {
+            TRY(auto reference_buffer, Buffer::create(buffer.size()));
+            reference = m_reference_inputs.emplace(input_name, std::move(reference_buffer)).first;
+        }
+        memcpy(reference->second.data(), buffer.data(), buffer.size());
+    }
+    m_is_reference_frame_valid = true;
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::cache_outputs(ConfiguredInferModel::Bindings &bindings, uint64_t sequence_number)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_is_temporal_skip_enabled || !m_is_reference_frame_valid || (m_reference_sequence_number != sequence_number)) {
+        // A later frame is the reference already
+        return HAILO_NOT_AVAILABLE;
+    }
+
+    for (const auto &output_name : m_output_names) {
+        TRY(auto output, bindings.output(output_name));
+        if (BufferType::VIEW != ConfiguredInferModelBase::get_infer_stream_buffer_type(output)) {
+            return HAILO_NOT_AVAILABLE;
+        }
+        TRY(auto buffer, output.get_buffer());
+        auto cached_output = m_cached_outputs.find(output_name);
+        if (m_cached_outputs.end() == cached_output) {
+            TRY(auto cached_buffer, Buffer::create(buffer.size()));
+            cached_output = m_cached_outputs.emplace(output_name, std::move(cached_buffer)).first;
+        }
+        memcpy(cached_output->second.data(), buffer.data(), buffer.size());
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::enable_temporal_skip(float32_t max_mean_difference)
+{
+    CHECK(max_mean_difference >= 0, HAILO_INVALID_ARGUMENT, "The max mean difference of skipped frames must not be negative");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_temporal_skip_max_mean_difference = max_mean_difference;
+    if (!m_is_temporal_skip_enabled) {
+        // The frames inferred before are not kept, the next frame is the first reference
+        m_is_temporal_skip_enabled = true;
+        m_is_reference_frame_valid = false;
+        m_are_cached_outputs_valid = false;
+    }
 
-    m_ang = activated_ng.release();
     return HAILO_SUCCESS;
 }
 
-hailo_status ConfiguredInferModelImpl::deactivate()
+hailo_status ConfiguredInferModelImpl::disable_temporal_skip()
 {
-    m_ang = nullptr;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_is_temporal_skip_enabled = false;
+    m_is_reference_frame_valid = false;
+    m_are_cached_outputs_valid = false;
+    m_reference_inputs.clear();
+    m_cached_outputs.clear();
 
     return HAILO_SUCCESS;
 }
 
-hailo_status ConfiguredInferModelImpl::validate_bindings(ConfiguredInferModel::Bindings bindings)
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel::Bindings bindings,
+    ConfiguredInferModel::InferPriority priority, std::function<void(const AsyncInferCompletionInfo &)> callback)
 {
-    for (const auto &input_name : m_input_names) {
-        TRY(auto input, bindings.input(input_name));
-        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
-        switch (buffer_type) {
-            case BufferType::VIEW:
-            {
-                auto buffer = input.get_buffer();
-                CHECK_EXPECTED_AS_STATUS(buffer);
-                CHECK(buffer->size() == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
-                    "Input buffer size {} is different than expected {} for input '{}'", buffer->size(), m_inputs_frame_sizes.at(input_name), input_name);
-                break;
-            }
-            case BufferType::PIX_BUFFER:
-            {
-                auto buffer = input.get_pix_buffer();
-                CHECK_EXPECTED_AS_STATUS(buffer);
-                size_t buffer_size = 0;
-                for (size_t i = 0 ; i < buffer->number_of_planes ; i++) {
-                    buffer_size += buffer->planes[i].bytes_used;
-                }
-                CHECK(buffer_size == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
-                    "Input buffer size {} is different than expected {} for input '{}'", buffer_size, m_inputs_frame_sizes.at(input_name), input_name);
-                break;
-            }
-            case BufferType::DMA_BUFFER:
-            {
-                auto buffer = input.get_dma_buffer();
-                CHECK_EXPECTED_AS_STATUS(buffer);
-                CHECK(buffer->size == m_inputs_frame_sizes.at(input_name), HAILO_INVALID_OPERATION,
-                    "Input buffer size {} is different than expected {} for input '{}'", buffer->size, m_inputs_frame_sizes.at(input_name), input_name);
-                break;
-            }
-            default:
-                CHECK(false, HAILO_NOT_FOUND, "Couldnt find input buffer for '{}'", input_name);
+    if (ConfiguredInferModel::InferPriority::INTERACTIVE == priority) {
+        return run_async(bindings, callback);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK_AS_EXPECTED(m_ongoing_bulk_frames < m_bulk_frames_limit, HAILO_QUEUE_IS_FULL,
+            "Can't launch a bulk frame, {} bulk frames are already in flight", m_ongoing_bulk_frames);
+        m_ongoing_bulk_frames++;
+    }
+
+    auto bulk_frame_done = [this, callback](const AsyncInferCompletionInfo &completion_info) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ongoing_bulk_frames--;
         }
+        // m_cv is notified once the frame's credit is returned as well
+        callback(completion_info);
+    };
+    auto job = run_async(bindings, bulk_frame_done);
+    if (!job) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ongoing_bulk_frames--;
     }
-    for (const auto &output_name : m_output_names) {
-        TRY(auto output, bindings.output(output_name));
-        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(output);
-        switch (buffer_type) {
-            case BufferType::VIEW:
-            {
-                auto buffer = output.get_buffer();
-                CHECK_EXPECTED_AS_STATUS(buffer);
-                CHECK(buffer->size() == m_outputs_frame_sizes.at(output_name), HAILO_INVALID_OPERATION,
-                    "Output buffer size {} is different than expected {} for output '{}'", buffer->size(), m_outputs_frame_sizes.at(output_name), output_name);
-                break;
-            }
-            case BufferType::PIX_BUFFER:
-            {
-                CHECK(false, HAILO_NOT_SUPPORTED, "pix_buffer isn't supported for outputs in '{}'", output_name);
-                break;
-            }
-            case BufferType::DMA_BUFFER:
-            {
-                auto buffer = output.get_dma_buffer();
-                CHECK_EXPECTED_AS_STATUS(buffer);
-                CHECK(buffer->size == m_outputs_frame_sizes.at(output_name), HAILO_INVALID_OPERATION,
-                    "Output buffer size {} is different than expected {} for out '{}'", buffer->size, m_outputs_frame_sizes.at(output_name), output_name);
-                break;
-            }
-            default:
-                CHECK(false, HAILO_NOT_FOUND, "Couldnt find output buffer for '{}'", output_name);
+    return job;
+}
+
+hailo_status ConfiguredInferModelImpl::run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+    std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback)
+{
+    for (const auto &frame_bindings : bindings) {
+        CHECK_SUCCESS(validate_bindings(frame_bindings));
+    }
+
+    const auto transfers_count = static_cast<uint32_t>(m_input_names.size() + m_output_names.size());
+    std::vector<ConfiguredInferModel::Bindings> frames_bindings(bindings);
+    std::vector<TransferDoneCallbackAsyncInfer> transfers_done;
+    transfers_done.reserve(bindings.size());
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const auto first_sequence_number = m_next_sequence_number;
+        for (size_t i = 0; i < bindings.size(); i++) {
+            auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(transfers_count);
+            CHECK_NOT_NULL(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+            auto frame_done = create_transfer_done_callback(job_pimpl, frame_done_callback, first_sequence_number + i);
+            const auto &current_bindings = bindings[i];
+            transfers_done.emplace_back([current_bindings, frame_done](hailo_status status) {
+                frame_done(status);
+            });
         }
+
+        auto status = m_async_infer_runner->run_frames(frames_bindings, transfers_done);
+        CHECK_SUCCESS(status);
+        m_next_sequence_number += bindings.size();
+        m_ongoing_parallel_transfers += static_cast<uint32_t>(bindings.size());
+        update_async_ready_event();
     }
+    m_cv.notify_all();
 
     return HAILO_SUCCESS;
 }
 
-Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel::Bindings bindings,
-    std::function<void(const AsyncInferCompletionInfo &)> callback)
+hailo_status ConfiguredInferModelImpl::register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings)
 {
-    CHECK_SUCCESS_AS_EXPECTED(validate_bindings(bindings));
+    for (const auto &current_bindings : bindings) {
+        CHECK_SUCCESS(validate_bindings(current_bindings));
+    }
 
-    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(m_input_names.size() + m_output_names.size()));
-    CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(0 == m_ongoing_parallel_transfers, HAILO_INVALID_OPERATION,
+        "Can't register bindings while {} frames are in flight", m_ongoing_parallel_transfers);
+    CHECK_SUCCESS(m_async_infer_runner->register_bindings(bindings));
+    m_registered_bindings = bindings;
 
-    TransferDoneCallbackAsyncInfer transfer_done = [this, bindings, job_pimpl, callback](hailo_status status) {
-        bool should_call_callback = ConfiguredInferModelBase::get_stream_done(status, job_pimpl);
-        if (should_call_callback) {
-            auto final_status = (m_async_infer_runner->get_pipeline_status() == HAILO_SUCCESS) ?
-                ConfiguredInferModelBase::get_completion_status(job_pimpl) : m_async_infer_runner->get_pipeline_status();
+    return HAILO_SUCCESS;
+}
 
-            AsyncInferCompletionInfo completion_info(final_status);
-            callback(completion_info);
-            ConfiguredInferModelBase::mark_callback_done(job_pimpl);
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_ongoing_parallel_transfers--;
-            }
-            m_cv.notify_all();
-        }
-    };
+Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async_registered(size_t bindings_index,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(m_input_names.size() + m_output_names.size()));
+    CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
 
     {
         std::unique_lock<std::mutex> lock(m_mutex);
-        auto status = m_async_infer_runner->run(bindings, transfer_done);
+        const auto sequence_number = m_next_sequence_number++;
+        // The registered bindings are owned by m_registered_bindings, so the callback doesn't have to keep them alive
+        auto transfer_done = create_transfer_done_callback(job_pimpl, callback, sequence_number);
+
+        auto status = m_async_infer_runner->run_registered(bindings_index, transfer_done);
         CHECK_SUCCESS_AS_EXPECTED(status);
         m_ongoing_parallel_transfers++;
+        update_async_ready_event();
     }
     m_cv.notify_all();
 
@@ -917,12 +2253,200 @@ hailo_status ConfiguredInferModelImpl::set_scheduler_priority(uint8_t priority)
     return cng->set_scheduler_priority(priority);
 }
 
+hailo_status ConfiguredInferModelImpl::set_scheduler_deadline(const std::chrono::milliseconds &deadline)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_deadline(deadline);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_share(uint32_t share)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_share(share);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_device_affinity(uint64_t device_mask)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_device_affinity(device_mask);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_sticky_placement(bool is_sticky)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_sticky_placement(is_sticky);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_pinned_device(uint32_t device_index)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_pinned_device(device_index);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_burst_size_bounds(min_burst_size, max_burst_size);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_batch_size(uint16_t batch_size)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_batch_size(batch_size);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+    uint32_t max_pending_frames)
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->set_scheduler_overload_policy(policy, max_pending_frames);
+}
+
+hailo_status ConfiguredInferModelImpl::set_completion_order(ConfiguredInferModel::CompletionOrder order, uint32_t max_skew)
+{
+    uint64_t callbacks_max_skew = CallbackReorderQueue::IN_ORDER_MAX_SKEW;
+    switch (order) {
+    case ConfiguredInferModel::CompletionOrder::IN_ORDER:
+        break;
+    case ConfiguredInferModel::CompletionOrder::OUT_OF_ORDER:
+        callbacks_max_skew = CallbackReorderQueue::OUT_OF_ORDER_MAX_SKEW;
+        break;
+    case ConfiguredInferModel::CompletionOrder::BOUNDED_SKEW:
+        CHECK(max_skew > 0, HAILO_INVALID_ARGUMENT, "The max skew of a bounded skew completion order must be greater than 0");
+        callbacks_max_skew = max_skew;
+        break;
+    default:
+        LOGGER__ERROR("Invalid completion order {}", static_cast<int>(order));
+        return HAILO_INVALID_ARGUMENT;
+    }
+
+    // The host elements of the pipeline (transformations, post-process) pair the frames of the outputs by their order,
+    // so frames may be completed out of order only if the device writes them directly to the bindings' buffers.
+    CHECK((CallbackReorderQueue::IN_ORDER_MAX_SKEW == callbacks_max_skew) || m_async_infer_runner->are_outputs_written_by_hw(),
+        HAILO_INVALID_OPERATION,
+        "Completion order may be relaxed only if the outputs are not transformed or post-processed on the host");
+
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
+    auto cng_base = std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(cng);
+    CHECK(nullptr != cng_base, HAILO_NOT_SUPPORTED, "Setting the completion order is not supported over the multi-process service");
+    auto core_op = std::dynamic_pointer_cast<VDeviceCoreOp>(cng_base->get_core_op());
+    CHECK_NOT_NULL(core_op, HAILO_INTERNAL_FAILURE);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(0 == m_ongoing_parallel_transfers, HAILO_INVALID_OPERATION,
+        "Completion order can't be set while there are ongoing inferences ({})", m_ongoing_parallel_transfers);
+    core_op->set_callbacks_max_skew(callbacks_max_skew);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::set_bulk_frames_limit(uint32_t max_bulk_frames)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const auto max_ongoing_frames_count = get_max_ongoing_frames_count();
+        CHECK((0 < max_bulk_frames) && (max_bulk_frames <= max_ongoing_frames_count), HAILO_INVALID_ARGUMENT,
+            "Invalid bulk frames limit {} (must be between 1 and the async queue size {})", max_bulk_frames,
+            max_ongoing_frames_count);
+        m_bulk_frames_limit = max_bulk_frames;
+    }
+    m_cv.notify_all();
+
+    return HAILO_SUCCESS;
+}
+
+size_t ConfiguredInferModelImpl::get_max_ongoing_frames_count() const
+{
+    return std::min(m_async_infer_runner->get_max_ongoing_frames_count(), m_async_queue_size_limit);
+}
+
+Expected<hailo_scheduler_overload_stats_t> ConfiguredInferModelImpl::get_scheduler_overload_stats()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->get_scheduler_overload_stats();
+}
+
+Expected<std::vector<PipelineElementLatencyResults>> ConfiguredInferModelImpl::get_pipeline_elements_latency()
+{
+    return m_async_infer_runner->get_pipeline_elements_latency();
+}
+
 Expected<size_t> ConfiguredInferModelImpl::get_async_queue_size()
+{
+    TRY(const auto max_queue_size, get_max_async_queue_size());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto queue_size = std::min(max_queue_size, m_async_queue_size_limit);
+    return queue_size;
+}
+
+Expected<size_t> ConfiguredInferModelImpl::get_max_async_queue_size()
 {
     auto cng = m_cng.lock();
     CHECK_NOT_NULL(cng, HAILO_INTERNAL_FAILURE);
 
-    return cng->get_min_buffer_pool_size();
+    // The pipeline's pools may be smaller than the streams' queues (e.g. if they were limited by a host memory budget)
+    TRY(const auto min_buffer_pool_size, cng->get_min_buffer_pool_size());
+    size_t max_async_queue_size = std::min(min_buffer_pool_size, m_async_infer_runner->get_max_ongoing_frames_count());
+    return max_async_queue_size;
+}
+
+hailo_status ConfiguredInferModelImpl::set_async_queue_size(size_t queue_size)
+{
+    TRY(const auto max_queue_size, get_max_async_queue_size());
+    CHECK((0 < queue_size) && (queue_size <= max_queue_size), HAILO_INVALID_ARGUMENT,
+        "Invalid async queue size {} (must be between 1 and {})", queue_size, max_queue_size);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // The default limit is kept when the whole queue is set, so the other limits of the pipeline still apply
+        m_async_queue_size_limit = (max_queue_size == queue_size) ? std::numeric_limits<size_t>::max() : queue_size;
+        m_bulk_frames_limit = std::min(m_bulk_frames_limit, static_cast<uint32_t>(get_max_ongoing_frames_count()));
+        update_async_ready_event();
+    }
+    // A deeper queue may free waiting frames
+    m_cv.notify_all();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredInferModelImpl::lock_host_buffers()
+{
+    CHECK_SUCCESS(m_async_infer_runner->lock_host_buffers());
+    m_are_host_buffers_locked = true;
+    return HAILO_SUCCESS;
+}
+
+Expected<std::string> ConfiguredInferModelImpl::get_pipeline_graph(ConfiguredInferModel::PipelineGraphFormat format)
+{
+    switch (format) {
+    case ConfiguredInferModel::PipelineGraphFormat::DOT:
+        return PipelineGraph::to_dot(m_async_infer_runner->get_pipeline());
+    case ConfiguredInferModel::PipelineGraphFormat::JSON:
+        return PipelineGraph::to_json(m_async_infer_runner->get_pipeline());
+    default:
+        LOGGER__ERROR("Invalid pipeline graph format {}", static_cast<int>(format));
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
 }
 
 AsyncInferJob::AsyncInferJob(std::shared_ptr<AsyncInferJobBase> pimpl) : m_pimpl(pimpl), m_should_wait_in_dtor(true)
@@ -971,6 +2495,76 @@ void AsyncInferJob::detach()
     m_should_wait_in_dtor = false;
 }
 
+hailo_status AsyncInferJob::cancel()
+{
+    CHECK(nullptr != m_pimpl, HAILO_INVALID_OPERATION, "Can't cancel an empty job");
+    return m_pimpl->cancel();
+}
+
+ConfigureInferModelJob::ConfigureInferModelJob(std::shared_ptr<ConfigureInferModelJobImpl> pimpl) :
+    m_pimpl(pimpl)
+{}
+
+ConfigureInferModelJob::~ConfigureInferModelJob() = default;
+
+Expected<ConfiguredInferModel> ConfigureInferModelJob::wait(std::chrono::milliseconds timeout)
+{
+    CHECK_NOT_NULL_AS_EXPECTED(m_pimpl, HAILO_INVALID_OPERATION);
+    return m_pimpl->wait(timeout);
+}
+
+Expected<std::shared_ptr<ConfigureInferModelJobImpl>> ConfigureInferModelJobImpl::create(ConfigureFunc &&configure_func)
+{
+    auto job = make_shared_nothrow<ConfigureInferModelJobImpl>();
+    CHECK_NOT_NULL_AS_EXPECTED(job, HAILO_OUT_OF_HOST_MEMORY);
+
+    // The thread is joined by the job's d'tor, so it may refer to the job
+    job->m_thread = std::thread(&ConfigureInferModelJobImpl::configure_thread, job.get(), std::move(configure_func));
+    return job;
+}
+
+ConfigureInferModelJobImpl::ConfigureInferModelJobImpl() :
+    m_is_done(false),
+    m_status(HAILO_UNINITIALIZED)
+{}
+
+ConfigureInferModelJobImpl::~ConfigureInferModelJobImpl()
+{
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void ConfigureInferModelJobImpl::configure_thread(const ConfigureFunc &configure_func)
+{
+    OsUtils::set_current_thread_name("HRT_CONFIGURE");
+
+    auto configured_infer_model = configure_func();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_status = configured_infer_model.status();
+        if (configured_infer_model) {
+            m_configured_infer_model = configured_infer_model.release();
+        }
+        m_is_done = true;
+    }
+    m_cv.notify_all();
+}
+
+Expected<ConfiguredInferModel> ConfigureInferModelJobImpl::wait(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool was_successful = m_cv.wait_for(lock, timeout, [this] () -> bool {
+        return m_is_done;
+    });
+    CHECK_AS_EXPECTED(was_successful, HAILO_TIMEOUT, "Waiting for the infer model configuration has failed with timeout ({}ms)",
+        timeout.count());
+    CHECK_SUCCESS_AS_EXPECTED(m_status, "Failed configuring the infer model");
+
+    auto configured_infer_model = m_configured_infer_model;
+    return configured_infer_model;
+}
+
 AsyncInferJob AsyncInferJobBase::create(std::shared_ptr<AsyncInferJobBase> base)
 {
     return AsyncInferJob(base);
@@ -993,6 +2587,20 @@ hailo_status AsyncInferJobImpl::wait(std::chrono::milliseconds timeout)
     return HAILO_SUCCESS;
 }
 
+hailo_status AsyncInferJobImpl::cancel()
+{
+    CHECK(nullptr != m_infer_request_control, HAILO_NOT_SUPPORTED, "This job can't be cancelled");
+    m_infer_request_control->cancel();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncInferJobBase::cancel()
+{
+    LOGGER__ERROR("This job can't be cancelled");
+    return HAILO_NOT_SUPPORTED;
+}
+
 bool AsyncInferJobImpl::stream_done(const hailo_status &status)
 {
     bool should_call_callback = false;
@@ -0,0 +1,601 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file infer_model_broker.cpp
+ * @brief Sharing a ConfiguredInferModel with other processes over shared memory.
+ *
+ * The shared memory object starts with a BrokerHeader (the layout of the slots, the queues and the state of each
+ * slot), followed by the buffers of the slots. A slot moves between:
+ *  FREE (in the free queue) -> ACQUIRED (by a client, filling its inputs) -> SUBMITTED (in the submitted queue, or in
+ *  flight) -> DONE (the status is set, the client reads the outputs) -> FREE.
+ * The queues are bounded MPMC rings (like the ring of AsyncInferCompletionQueue) with room for all of the slots, so
+ * pushing never waits - only the consumers wait, on a futex of the queue.
+ **/
+
+#include "hailo/infer_model_broker.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+#include "common/os_utils.hpp"
+#include "common/fork_support.hpp"
+#include "common/shared_memory_buffer.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace hailort
+{
+
+#define INFER_MODEL_BROKER_MAGIC (0x52424D48) // "HMBR"
+#define INFER_MODEL_BROKER_VERSION (1)
+#define INFER_MODEL_BROKER_MAX_SLOTS (64)
+#define INFER_MODEL_BROKER_MAX_EDGES (32)
+
+// The broker waits for the model to be ready for the next submitted slot up to this timeout, then fails the slot
+static const std::chrono::milliseconds INFER_MODEL_BROKER_READY_TIMEOUT(10000);
+
+static_assert(2 == ATOMIC_INT_LOCK_FREE, "The broker's atomics must be lock free, as they are shared between processes");
+
+// Maps any point in time in the (possibly infinite) timeout to the remaining time
+class BrokerDeadline final
+{
+public:
+    explicit BrokerDeadline(std::chrono::milliseconds timeout) :
+        m_is_infinite(HAILO_INFINITE_TIMEOUT == timeout),
+        m_deadline(std::chrono::steady_clock::now() + (m_is_infinite ? std::chrono::milliseconds(0) : timeout))
+    {}
+
+    // Returns HAILO_INFINITE_TIMEOUT for an infinite deadline, and 0 once the deadline passed
+    std::chrono::milliseconds remaining() const
+    {
+        if (m_is_infinite) {
+            return HAILO_INFINITE_TIMEOUT;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= m_deadline) {
+            return std::chrono::milliseconds(0);
+        }
+        // Rounded up, so the last wait doesn't spin with a zero timeout
+        return std::chrono::duration_cast<std::chrono::milliseconds>(m_deadline - now) + std::chrono::milliseconds(1);
+    }
+
+private:
+    const bool m_is_infinite;
+    const std::chrono::steady_clock::time_point m_deadline;
+};
+
+class SharedSlotQueue final
+{
+public:
+    SharedSlotQueue() : m_enqueue_pos(0), m_dequeue_pos(0)
+    {
+        for (uint32_t i = 0; i < INFER_MODEL_BROKER_MAX_SLOTS; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Never fails while the queue holds each slot at most once (the ring has room for all of the slots)
+    bool try_push(uint32_t slot)
+    {
+        auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto &cell = m_cells[pos & MASK];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<int32_t>(sequence - pos);
+            if (0 == diff) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.slot = slot;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    m_pushed_futex.notify();
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(uint32_t &slot)
+    {
+        auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto &cell = m_cells[pos & MASK];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<int32_t>(sequence - (pos + 1));
+            if (0 == diff) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot = cell.slot;
+                    cell.sequence.store(pos + MASK + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    hailo_status pop(uint32_t &slot, std::chrono::milliseconds timeout, const std::atomic<uint32_t> &is_closed)
+    {
+        const BrokerDeadline deadline(timeout);
+        while (true) {
+            // The sequence is read before trying, so a push after the try won't be missed
+            const auto sequence = m_pushed_futex.sequence();
+            if (0 != is_closed.load()) {
+                return HAILO_COMMUNICATION_CLOSED;
+            }
+            if (try_pop(slot)) {
+                return HAILO_SUCCESS;
+            }
+
+            const auto remaining = deadline.remaining();
+            if (0 == remaining.count()) {
+                return HAILO_TIMEOUT;
+            }
+            m_pushed_futex.wait(sequence, remaining);
+        }
+    }
+
+    void wake_all()
+    {
+        m_pushed_futex.notify();
+    }
+
+private:
+    static const uint32_t MASK = INFER_MODEL_BROKER_MAX_SLOTS - 1;
+    static_assert(0 == (INFER_MODEL_BROKER_MAX_SLOTS & MASK), "The queue's size must be a power of 2");
+
+    struct Cell {
+        std::atomic<uint32_t> sequence;
+        uint32_t slot;
+    };
+
+    Cell m_cells[INFER_MODEL_BROKER_MAX_SLOTS];
+    std::atomic<uint32_t> m_enqueue_pos;
+    std::atomic<uint32_t> m_dequeue_pos;
+    SharedFutex m_pushed_futex;
+};
+
+enum class BrokerSlotState : uint32_t {
+    FREE = 0,
+    ACQUIRED,
+    SUBMITTED,
+    DONE
+};
+
+struct BrokerSlot {
+    BrokerSlot() : state(static_cast<uint32_t>(BrokerSlotState::FREE)), status(HAILO_UNINITIALIZED) {}
+
+    std::atomic<uint32_t> state;
+    // The status of the inference, valid once the state is DONE
+    std::atomic<uint32_t> status;
+    SharedFutex done_futex;
+};
+
+struct BrokerEdge {
+    char name[HAILO_MAX_STREAM_NAME_SIZE];
+    uint64_t frame_size;
+    // Offset of the edge's buffer in a slot
+    uint64_t offset;
+    uint32_t is_input;
+};
+
+struct BrokerHeader {
+    BrokerHeader() : magic(0), version(0), header_size(0), slots_count(0), edges_count(0), slot_size(0),
+        slots_offset(0), total_size(0), is_closed(0), edges()
+    {}
+
+    uint32_t magic;
+    uint32_t version;
+    // Clients built with another layout are refused
+    uint32_t header_size;
+    uint32_t slots_count;
+    uint32_t edges_count;
+    uint64_t slot_size;
+    uint64_t slots_offset;
+    uint64_t total_size;
+    std::atomic<uint32_t> is_closed;
+    BrokerEdge edges[INFER_MODEL_BROKER_MAX_EDGES];
+    SharedSlotQueue free_slots;
+    SharedSlotQueue submitted_slots;
+    BrokerSlot slots[INFER_MODEL_BROKER_MAX_SLOTS];
+};
+
+static uint8_t *get_slot_address(SharedMemoryBuffer &shared_memory, const BrokerHeader &header, uint32_t slot)
+{
+    return static_cast<uint8_t*>(shared_memory.user_address()) + header.slots_offset + (slot * header.slot_size);
+}
+
+static Expected<const BrokerEdge*> find_edge(const BrokerHeader &header, const std::string &name, bool is_input)
+{
+    for (uint32_t i = 0; i < header.edges_count; i++) {
+        const auto &edge = header.edges[i];
+        if ((is_input == (0 != edge.is_input)) && (name == edge.name)) {
+            return &edge;
+        }
+    }
+
+    LOGGER__ERROR("The broker's model has no {} named {}", is_input ? "input" : "output", name);
+    return make_unexpected(HAILO_NOT_FOUND);
+}
+
+class InferModelBrokerImpl final
+{
+public:
+    static Expected<std::shared_ptr<InferModelBrokerImpl>> create(InferModel &infer_model,
+        ConfiguredInferModel configured_infer_model, const std::string &name, size_t slots_count)
+    {
+#ifndef HAILO_IS_FORK_SUPPORTED
+        (void)infer_model;
+        (void)configured_infer_model;
+        (void)name;
+        (void)slots_count;
+        LOGGER__ERROR("InferModelBroker is not supported on this platform");
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+#else
+        CHECK_AS_EXPECTED((0 < slots_count) && (slots_count <= INFER_MODEL_BROKER_MAX_SLOTS), HAILO_INVALID_ARGUMENT,
+            "Invalid slots count {} (must be between 1 and {})", slots_count, INFER_MODEL_BROKER_MAX_SLOTS);
+        const auto &input_names = infer_model.get_input_names();
+        const auto &output_names = infer_model.get_output_names();
+        CHECK_AS_EXPECTED((input_names.size() + output_names.size()) <= INFER_MODEL_BROKER_MAX_EDGES,
+            HAILO_NOT_SUPPORTED, "InferModelBroker supports models with up to {} inputs and outputs",
+            INFER_MODEL_BROKER_MAX_EDGES);
+
+        // Each buffer is page aligned, so it may be mapped for DMA
+        const auto page_size = OsUtils::get_page_size();
+        BrokerHeader layout;
+        uint64_t slot_size = 0;
+        auto add_edges = [&](const std::vector<std::string> &names, bool is_input) -> hailo_status {
+            for (const auto &edge_name : names) {
+                CHECK(edge_name.size() < HAILO_MAX_STREAM_NAME_SIZE, HAILO_INVALID_ARGUMENT, "Name {} is too long",
+                    edge_name);
+                TRY(auto stream, is_input ? infer_model.input(edge_name) : infer_model.output(edge_name));
+                auto &edge = layout.edges[layout.edges_count++];
+                std::strncpy(edge.name, edge_name.c_str(), sizeof(edge.name) - 1);
+                edge.frame_size = stream.get_frame_size();
+                edge.offset = slot_size;
+                edge.is_input = is_input ? 1 : 0;
+                slot_size += ((edge.frame_size + page_size - 1) / page_size) * page_size;
+            }
+            return HAILO_SUCCESS;
+        };
+        CHECK_SUCCESS_AS_EXPECTED(add_edges(input_names, true));
+        CHECK_SUCCESS_AS_EXPECTED(add_edges(output_names, false));
+
+        const auto slots_offset = ((sizeof(BrokerHeader) + page_size - 1) / page_size) * page_size;
+        const auto total_size = slots_offset + (slots_count * slot_size);
+        TRY(auto shared_memory, SharedMemoryBuffer::create_shared(name, static_cast<size_t>(total_size)));
+
+        auto header = new (shared_memory->user_address()) BrokerHeader();
+        header->header_size = static_cast<uint32_t>(sizeof(BrokerHeader));
+        header->slots_count = static_cast<uint32_t>(slots_count);
+        header->edges_count = layout.edges_count;
+        header->slot_size = slot_size;
+        header->slots_offset = slots_offset;
+        header->total_size = total_size;
+        std::memcpy(header->edges, layout.edges, sizeof(layout.edges));
+        for (uint32_t slot = 0; slot < header->slots_count; slot++) {
+            header->free_slots.try_push(slot);
+        }
+
+        auto broker = make_shared_nothrow<InferModelBrokerImpl>(configured_infer_model, shared_memory, *header);
+        CHECK_NOT_NULL_AS_EXPECTED(broker, HAILO_OUT_OF_HOST_MEMORY);
+
+        // The clients may connect only once the header is complete
+        std::atomic_thread_fence(std::memory_order_release);
+        header->version = INFER_MODEL_BROKER_VERSION;
+        header->magic = INFER_MODEL_BROKER_MAGIC;
+
+        broker->m_thread = std::thread([broker_ptr = broker.get()]() { broker_ptr->serve(); });
+        return broker;
+#endif
+    }
+
+    InferModelBrokerImpl(ConfiguredInferModel configured_infer_model, SharedMemoryBufferPtr shared_memory,
+        BrokerHeader &header) :
+        m_configured_infer_model(configured_infer_model), m_shared_memory(shared_memory), m_header(header)
+    {}
+
+    ~InferModelBrokerImpl()
+    {
+        m_header.is_closed = 1;
+        m_header.free_slots.wake_all();
+        m_header.submitted_slots.wake_all();
+        for (uint32_t slot = 0; slot < m_header.slots_count; slot++) {
+            m_header.slots[slot].done_futex.notify();
+        }
+
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    InferModelBrokerImpl(const InferModelBrokerImpl &) = delete;
+    InferModelBrokerImpl &operator=(const InferModelBrokerImpl &) = delete;
+    InferModelBrokerImpl(InferModelBrokerImpl &&) = delete;
+    InferModelBrokerImpl &operator=(InferModelBrokerImpl &&) = delete;
+
+private:
+    void serve()
+    {
+        OsUtils::set_current_thread_name("INFER_BROKER");
+
+        while (true) {
+            uint32_t slot = 0;
+            auto status = m_header.submitted_slots.pop(slot, HAILO_INFINITE_TIMEOUT, m_header.is_closed);
+            if (HAILO_COMMUNICATION_CLOSED == status) {
+                return;
+            }
+            if (HAILO_SUCCESS != status) {
+                LOGGER__ERROR("InferModelBroker failed waiting for submitted slots, status = {}", status);
+                return;
+            }
+            if (slot >= m_header.slots_count) {
+                LOGGER__ERROR("InferModelBroker got an invalid slot {}", slot);
+                continue;
+            }
+
+            status = launch(slot);
+            if (HAILO_SUCCESS != status) {
+                complete(m_header, slot, status);
+            }
+        }
+    }
+
+    hailo_status launch(uint32_t slot)
+    {
+        TRY(auto bindings, m_configured_infer_model.create_bindings());
+        auto slot_address = get_slot_address(*m_shared_memory, m_header, slot);
+        for (uint32_t i = 0; i < m_header.edges_count; i++) {
+            const auto &edge = m_header.edges[i];
+            const auto buffer = MemoryView(slot_address + edge.offset, static_cast<size_t>(edge.frame_size));
+            if (0 != edge.is_input) {
+                TRY(auto input, bindings.input(edge.name));
+                CHECK_SUCCESS(input.set_buffer(buffer));
+            } else {
+                TRY(auto output, bindings.output(edge.name));
+                CHECK_SUCCESS(output.set_buffer(buffer));
+            }
+        }
+
+        CHECK_SUCCESS(m_configured_infer_model.wait_for_async_ready(INFER_MODEL_BROKER_READY_TIMEOUT));
+
+        // The callback holds the shared memory, since the broker may be destroyed before the inference is done
+        auto shared_memory = m_shared_memory;
+        auto &header = m_header;
+        TRY(auto job, m_configured_infer_model.run_async(bindings,
+            [shared_memory, &header, slot](const AsyncInferCompletionInfo &completion_info) {
+                complete(header, slot, completion_info.status);
+            }));
+        job.detach();
+
+        return HAILO_SUCCESS;
+    }
+
+    static void complete(BrokerHeader &header, uint32_t slot, hailo_status status)
+    {
+        auto &broker_slot = header.slots[slot];
+        broker_slot.status = static_cast<uint32_t>(status);
+        broker_slot.state = static_cast<uint32_t>(BrokerSlotState::DONE);
+        broker_slot.done_futex.notify();
+    }
+
+    ConfiguredInferModel m_configured_infer_model;
+    SharedMemoryBufferPtr m_shared_memory;
+    BrokerHeader &m_header;
+    std::thread m_thread;
+};
+
+class InferModelBrokerClientImpl final
+{
+public:
+    static Expected<std::shared_ptr<InferModelBrokerClientImpl>> connect(const std::string &name)
+    {
+#ifndef HAILO_IS_FORK_SUPPORTED
+        (void)name;
+        LOGGER__ERROR("InferModelBrokerClient is not supported on this platform");
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+#else
+        // The header tells the size of the whole object
+        TRY(auto header_memory, SharedMemoryBuffer::open_shared(name, sizeof(BrokerHeader)));
+        const auto &header = *static_cast<const BrokerHeader*>(header_memory->user_address());
+        CHECK_AS_EXPECTED(INFER_MODEL_BROKER_MAGIC == header.magic, HAILO_NOT_AVAILABLE,
+            "Shared memory {} isn't an InferModelBroker (or the broker isn't ready yet)", name);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        CHECK_AS_EXPECTED((INFER_MODEL_BROKER_VERSION == header.version) && (sizeof(BrokerHeader) == header.header_size),
+            HAILO_INVALID_OPERATION, "InferModelBroker {} was created by an incompatible version of libhailort", name);
+
+        TRY(auto shared_memory, SharedMemoryBuffer::open_shared(name, static_cast<size_t>(header.total_size)));
+        auto client = make_shared_nothrow<InferModelBrokerClientImpl>(shared_memory);
+        CHECK_NOT_NULL_AS_EXPECTED(client, HAILO_OUT_OF_HOST_MEMORY);
+        return client;
+#endif
+    }
+
+    explicit InferModelBrokerClientImpl(SharedMemoryBufferPtr shared_memory) :
+        m_shared_memory(shared_memory), m_header(*static_cast<BrokerHeader*>(shared_memory->user_address()))
+    {}
+
+    Expected<InferModelBrokerClient::Slot> acquire_slot(std::chrono::milliseconds timeout)
+    {
+        uint32_t slot = 0;
+        auto status = m_header.free_slots.pop(slot, timeout, m_header.is_closed);
+        if (HAILO_TIMEOUT == status) {
+            return make_unexpected(status);
+        }
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        m_header.slots[slot].state = static_cast<uint32_t>(BrokerSlotState::ACQUIRED);
+        return InferModelBrokerClient::Slot(slot);
+    }
+
+    Expected<MemoryView> get_buffer(InferModelBrokerClient::Slot slot, const std::string &name, bool is_input)
+    {
+        CHECK_SUCCESS_AS_EXPECTED(check_slot_state(slot, BrokerSlotState::ACQUIRED, BrokerSlotState::DONE));
+        TRY(auto edge, find_edge(m_header, name, is_input));
+        return MemoryView(get_slot_address(*m_shared_memory, m_header, slot) + edge->offset,
+            static_cast<size_t>(edge->frame_size));
+    }
+
+    hailo_status submit(InferModelBrokerClient::Slot slot)
+    {
+        CHECK_SUCCESS(check_slot_state(slot, BrokerSlotState::ACQUIRED, BrokerSlotState::DONE));
+        CHECK(0 == m_header.is_closed.load(), HAILO_COMMUNICATION_CLOSED, "InferModelBroker is closed");
+
+        m_header.slots[slot].state = static_cast<uint32_t>(BrokerSlotState::SUBMITTED);
+        CHECK(m_header.submitted_slots.try_push(slot), HAILO_INTERNAL_FAILURE, "InferModelBroker queue is full");
+        return HAILO_SUCCESS;
+    }
+
+    hailo_status wait(InferModelBrokerClient::Slot slot, std::chrono::milliseconds timeout)
+    {
+        CHECK(slot < m_header.slots_count, HAILO_INVALID_ARGUMENT, "Invalid slot {}", slot);
+        auto &broker_slot = m_header.slots[slot];
+        const BrokerDeadline deadline(timeout);
+        while (true) {
+            const auto sequence = broker_slot.done_futex.sequence();
+            if (static_cast<uint32_t>(BrokerSlotState::DONE) == broker_slot.state.load()) {
+                return static_cast<hailo_status>(broker_slot.status.load());
+            }
+            CHECK(static_cast<uint32_t>(BrokerSlotState::SUBMITTED) == broker_slot.state.load(),
+                HAILO_INVALID_OPERATION, "Slot {} wasn't submitted", slot);
+            if (0 != m_header.is_closed.load()) {
+                return HAILO_COMMUNICATION_CLOSED;
+            }
+
+            const auto remaining = deadline.remaining();
+            if (0 == remaining.count()) {
+                return HAILO_TIMEOUT;
+            }
+            broker_slot.done_futex.wait(sequence, remaining);
+        }
+    }
+
+    hailo_status release_slot(InferModelBrokerClient::Slot slot)
+    {
+        CHECK_SUCCESS(check_slot_state(slot, BrokerSlotState::ACQUIRED, BrokerSlotState::DONE));
+
+        m_header.slots[slot].state = static_cast<uint32_t>(BrokerSlotState::FREE);
+        CHECK(m_header.free_slots.try_push(slot), HAILO_INTERNAL_FAILURE, "InferModelBroker free queue is full");
+        return HAILO_SUCCESS;
+    }
+
+private:
+    hailo_status check_slot_state(InferModelBrokerClient::Slot slot, BrokerSlotState state1, BrokerSlotState state2)
+    {
+        CHECK(slot < m_header.slots_count, HAILO_INVALID_ARGUMENT, "Invalid slot {}", slot);
+        const auto state = m_header.slots[slot].state.load();
+        CHECK((static_cast<uint32_t>(state1) == state) || (static_cast<uint32_t>(state2) == state),
+            HAILO_INVALID_OPERATION, "Slot {} isn't held by the client (state {})", slot, state);
+        return HAILO_SUCCESS;
+    }
+
+    SharedMemoryBufferPtr m_shared_memory;
+    BrokerHeader &m_header;
+};
+
+Expected<std::unique_ptr<InferModelBroker>> InferModelBroker::create(InferModel &infer_model,
+    ConfiguredInferModel configured_infer_model, const std::string &name, size_t slots_count)
+{
+    TRY(auto pimpl, InferModelBrokerImpl::create(infer_model, configured_infer_model, name, slots_count));
+    auto broker = make_unique_nothrow<InferModelBroker>(std::move(pimpl));
+    CHECK_NOT_NULL_AS_EXPECTED(broker, HAILO_OUT_OF_HOST_MEMORY);
+    return broker;
+}
+
+InferModelBroker::InferModelBroker(std::shared_ptr<InferModelBrokerImpl> pimpl) :
+    m_pimpl(std::move(pimpl))
+{}
+
+InferModelBroker::~InferModelBroker() = default;
+
+Expected<std::unique_ptr<InferModelBrokerClient>> InferModelBrokerClient::connect(const std::string &name)
+{
+    TRY(auto pimpl, InferModelBrokerClientImpl::connect(name));
+    auto client = make_unique_nothrow<InferModelBrokerClient>(std::move(pimpl));
+    CHECK_NOT_NULL_AS_EXPECTED(client, HAILO_OUT_OF_HOST_MEMORY);
+    return client;
+}
+
+InferModelBrokerClient::InferModelBrokerClient(std::shared_ptr<InferModelBrokerClientImpl> pimpl) :
+    m_pimpl(std::move(pimpl))
+{}
+
+Expected<InferModelBrokerClient::Slot> InferModelBrokerClient::acquire_slot(std::chrono::milliseconds timeout)
+{
+    return m_pimpl->acquire_slot(timeout);
+}
+
+Expected<MemoryView> InferModelBrokerClient::get_input_buffer(Slot slot, const std::string &name)
+{
+    return m_pimpl->get_buffer(slot, name, true);
+}
+
+Expected<MemoryView> InferModelBrokerClient::get_output_buffer(Slot slot, const std::string &name)
+{
+    return m_pimpl->get_buffer(slot, name, false);
+}
+
+hailo_status InferModelBrokerClient::submit(Slot slot)
+{
+    return m_pimpl->submit(slot);
+}
+
+hailo_status InferModelBrokerClient::wait(Slot slot, std::chrono::milliseconds timeout)
+{
+    return m_pimpl->wait(slot, timeout);
+}
+
+hailo_status InferModelBrokerClient::release_slot(Slot slot)
+{
+    return m_pimpl->release_slot(slot);
+}
+
+hailo_status InferModelBrokerClient::infer(const std::map<std::string, MemoryView> &inputs,
+    const std::map<std::string, MemoryView> &outputs, std::chrono::milliseconds timeout)
+{
+    const BrokerDeadline deadline(timeout);
+    TRY(const auto slot, acquire_slot(timeout));
+
+    auto status = [&]() -> hailo_status {
+        for (const auto &input : inputs) {
+            TRY(auto buffer, get_input_buffer(slot, input.first));
+            CHECK(buffer.size() == input.second.size(), HAILO_INVALID_ARGUMENT,
+                "Input {} buffer size {} doesn't match the frame size {}", input.first, input.second.size(), buffer.size());
+            std::memcpy(buffer.data(), input.second.data(), buffer.size());
+        }
+
+        CHECK_SUCCESS(submit(slot));
+        auto wait_status = wait(slot, deadline.remaining());
+        if (HAILO_TIMEOUT == wait_status) {
+            // The slot is still in flight, so it's waited for (without a timeout) before it is released
+            LOGGER__ERROR("Timeout waiting for the inference of slot {}", slot);
+            (void)wait(slot, HAILO_INFINITE_TIMEOUT);
+            return wait_status;
+        }
+        CHECK_SUCCESS(wait_status);
+
+        for (const auto &output : outputs) {
+            TRY(auto buffer, get_output_buffer(slot, output.first));
+            CHECK(buffer.size() == output.second.size(), HAILO_INVALID_ARGUMENT,
+                "Output {} buffer size {} doesn't match the frame size {}", output.first, output.second.size(), buffer.size());
+            // The map holds views of the user's buffers, which are written through a copy of the view
+            auto user_buffer = output.second;
+            std::memcpy(user_buffer.data(), buffer.data(), buffer.size());
+        }
+        return HAILO_SUCCESS;
+    }();
+
+    auto release_status = release_slot(slot);
+    CHECK_SUCCESS(status);
+    return release_status;
+}
+
+} /* namespace hailort */
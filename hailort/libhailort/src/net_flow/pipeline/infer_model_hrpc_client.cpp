@@ -66,8 +66,13 @@ InferModelHrpcClient::~InferModelHrpcClient()
 
 Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
 {
+    CHECK_AS_EXPECTED(m_custom_ops_metadata.empty(), HAILO_NOT_SUPPORTED,
+        "Custom post-process ops aren't supported over the service");
+
     rpc_create_configured_infer_model_request_params_t request_params;
     for (const auto &input : m_inputs) {
+        CHECK_AS_EXPECTED(!input.second.is_resized(), HAILO_NOT_SUPPORTED,
+            "Resize of input {} isn't supported over the service", input.first);
         rpc_stream_params_t current_stream_params;
         current_stream_params.format_order = static_cast<uint32_t>(input.second.format().order);
         current_stream_params.format_type = static_cast<uint32_t>(input.second.format().type);
@@ -80,6 +85,9 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
     }
 
     for (const auto &output : m_outputs) {
+        CHECK_AS_EXPECTED((output.second.nms_max_proposals_total() == static_cast<uint32_t>(INVALID_NMS_CONFIG)) &&
+            output.second.nms_classes_filter().empty(), HAILO_NOT_SUPPORTED,
+            "NMS max proposals total and classes filter of output {} aren't supported over the service", output.first);
         rpc_stream_params_t current_stream_params;
         current_stream_params.format_order = static_cast<uint32_t>(output.second.format().order);
         current_stream_params.format_type = static_cast<uint32_t>(output.second.format().type);
@@ -96,6 +104,7 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
     request_params.latency_flag = m_config_params.latency;
     request_params.infer_model_handle = m_handle;
     request_params.vdevice_handle = m_vdevice_handle;
+    request_params.supports_compact_nms_outputs = true;
 
     TRY(auto request, CreateConfiguredInferModelSerializer::serialize_request(request_params));
     auto client = m_client.lock();
@@ -107,6 +116,7 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
     CHECK_SUCCESS_AS_EXPECTED(std::get<0>(tuple));
     auto configured_infer_handle = std::get<1>(tuple);
     auto async_queue_size = std::get<2>(tuple);
+    const auto &compact_outputs_names = std::get<3>(tuple);
 
     std::unordered_map<std::string, size_t> inputs_frame_sizes;
     std::unordered_map<std::string, size_t> outputs_frame_sizes;
@@ -117,7 +127,7 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
         outputs_frame_sizes.emplace(output.second.name(), output.second.get_frame_size());
     }
 
-    auto callbacks_queue = make_unique_nothrow<CallbacksQueue>(client, m_output_names);
+    auto callbacks_queue = make_unique_nothrow<CallbacksQueue>(client, m_output_names, compact_outputs_names);
     CHECK_NOT_NULL_AS_EXPECTED(callbacks_queue, HAILO_OUT_OF_HOST_MEMORY);
 
     TRY(auto input_vstream_infos, m_hef.get_input_vstream_infos());
@@ -131,6 +141,15 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
     return ConfiguredInferModelBase::create(cim_client_ptr);
 }
 
+Expected<ConfiguredInferModel> InferModelHrpcClient::configure_with_progress(const ConfigureProgressCallback &progress_callback)
+{
+    // The server configures the network group and creates the infer pipeline in a single request
+    if (progress_callback) {
+        progress_callback(ConfigureStage::CONFIGURING_NETWORK_GROUP);
+    }
+    return configure();
+}
+
 Expected<ConfiguredInferModel> InferModelHrpcClient::configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
     const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
     const std::unordered_map<std::string, size_t> inputs_frame_sizes,
@@ -43,6 +43,9 @@ public:
         const std::unordered_map<std::string, size_t> outputs_frame_sizes = {},
         std::shared_ptr<ConfiguredNetworkGroup> net_group = nullptr) override;
 
+protected:
+    virtual Expected<ConfiguredInferModel> configure_with_progress(const ConfigureProgressCallback &progress_callback) override;
+
 private:
     std::weak_ptr<hrpc::Client> m_client;
     uint32_t m_handle;
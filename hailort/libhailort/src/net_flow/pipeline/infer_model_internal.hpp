@@ -18,6 +18,8 @@
 #include "net_flow/pipeline/async_infer_runner.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
 #include "hrpc/client.hpp"
+#include "utils/transient_object_pool.hpp"
+#include "common/event_internal.hpp"
 
 namespace hailort
 {
@@ -62,7 +64,10 @@ public:
     virtual void set_batch_size(uint16_t batch_size) override;
     virtual void set_power_mode(hailo_power_mode_t power_mode) override;
     virtual void set_hw_latency_measurement_flags(hailo_latency_measurement_flags_t latency) override;
+    virtual void set_pipeline_elements_stats_flags(hailo_pipeline_elem_stats_flags_t flags) override;
+    virtual void set_host_buffers_locked(bool locked) override;
     virtual Expected<ConfiguredInferModel> configure() override;
+    virtual Expected<ConfigureInferModelJob> configure_async(ConfigureProgressCallback progress_callback) override;
     virtual Expected<InferStream> input() override;
     virtual Expected<InferStream> output() override;
     virtual Expected<InferStream> input(const std::string &name) override;
@@ -71,6 +76,8 @@ public:
     virtual const std::vector<InferStream> &outputs() const override;
     virtual const std::vector<std::string> &get_input_names() const override;
     virtual const std::vector<std::string> &get_output_names() const override;
+    virtual hailo_status add_custom_post_process_op(const std::vector<std::string> &input_names,
+        std::shared_ptr<CustomPostProcessOp> op) override;
 
     virtual Expected<ConfiguredInferModel> configure_for_ut(std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
@@ -79,7 +86,11 @@ public:
         std::shared_ptr<ConfiguredNetworkGroup> net_group = nullptr) override;
 
 protected:
+    // configure(), reporting the configuration stages to progress_callback (if not null)
+    virtual Expected<ConfiguredInferModel> configure_with_progress(const ConfigureProgressCallback &progress_callback);
+
     static Expected<std::unordered_map<std::string, InferModel::InferStream>> create_infer_stream_inputs(Hef &hef);
+    hailo_status update_interrupts_coalescing_params(NetworkGroupsParamsMap &configure_params);
     static Expected<std::unordered_map<std::string, InferModel::InferStream>> create_infer_stream_outputs(Hef &hef);
 
     std::reference_wrapper<VDevice> m_vdevice;
@@ -91,6 +102,10 @@ protected:
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
     ConfigureNetworkParams m_config_params;
+    hailo_pipeline_elem_stats_flags_t m_pipeline_elements_stats_flags;
+    bool m_are_host_buffers_locked;
+    // Added to the network group on each configure
+    std::vector<net_flow::PostProcessOpMetadataPtr> m_custom_ops_metadata;
 };
 
 class InferModel::InferStream::Impl
@@ -98,7 +113,8 @@ class InferModel::InferStream::Impl
 public:
     Impl(const hailo_vstream_info_t &vstream_info) : m_vstream_info(vstream_info), m_user_buffer_format(vstream_info.format),
         m_nms_score_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)), m_nms_iou_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)),
-        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG))
+        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG)),
+        m_nms_max_proposals_total(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_interrupts_coalescing{}, m_is_resized(false)
     {
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_NONE; // Init user's format flags to NONE for transposed models
     }
@@ -117,11 +133,17 @@ public:
     void set_nms_iou_threshold(float32_t threshold);
     void set_nms_max_proposals_per_class(uint32_t max_proposals_per_class);
     void set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
+    void set_nms_max_proposals_total(uint32_t max_proposals_total);
+    void set_nms_classes_filter(const std::vector<uint32_t> &classes);
+    void set_interrupts_coalescing(uint32_t max_transfers, std::chrono::microseconds timeout);
+    void set_resize(const InputResizeParams &params);
 
     float32_t nms_score_threshold() const;
     float32_t nms_iou_threshold() const;
     uint32_t nms_max_proposals_per_class() const;
     uint32_t nms_max_accumulated_mask_size() const;
+    uint32_t nms_max_proposals_total() const;
+    const std::vector<uint32_t> &nms_classes_filter() const;
 
 private:
     friend class InferModel;
@@ -135,6 +157,41 @@ private:
     float32_t m_nms_iou_threshold;
     uint32_t m_nms_max_proposals_per_class;
     uint32_t m_nms_max_accumulated_mask_size;
+    uint32_t m_nms_max_proposals_total;
+    // Empty means all of the classes
+    std::vector<uint32_t> m_nms_classes_filter;
+    hailo_stream_interrupts_coalescing_params_t m_interrupts_coalescing;
+    bool m_is_resized;
+    InputResizeParams m_resize_params;
+};
+
+class ConfigureInferModelJobImpl final
+{
+public:
+    using ConfigureFunc = std::function<Expected<ConfiguredInferModel>()>;
+
+    // Runs configure_func on a new thread
+    static Expected<std::shared_ptr<ConfigureInferModelJobImpl>> create(ConfigureFunc &&configure_func);
+
+    ConfigureInferModelJobImpl();
+    ~ConfigureInferModelJobImpl();
+
+    ConfigureInferModelJobImpl(const ConfigureInferModelJobImpl &) = delete;
+    ConfigureInferModelJobImpl &operator=(const ConfigureInferModelJobImpl &) = delete;
+    ConfigureInferModelJobImpl(ConfigureInferModelJobImpl &&) = delete;
+    ConfigureInferModelJobImpl &operator=(ConfigureInferModelJobImpl &&) = delete;
+
+    Expected<ConfiguredInferModel> wait(std::chrono::milliseconds timeout);
+
+private:
+    void configure_thread(const ConfigureFunc &configure_func);
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_is_done;
+    hailo_status m_status;
+    ConfiguredInferModel m_configured_infer_model;
+    std::thread m_thread;
 };
 
 class AsyncInferJobBase
@@ -143,6 +200,8 @@ public:
     static AsyncInferJob create(std::shared_ptr<AsyncInferJobBase> base);
     virtual ~AsyncInferJobBase() = default;
     virtual hailo_status wait(std::chrono::milliseconds timeout) = 0;
+    // By default jobs can't be cancelled
+    virtual hailo_status cancel();
 };
 
 class AsyncInferJobImpl : public AsyncInferJobBase
@@ -150,6 +209,11 @@ class AsyncInferJobImpl : public AsyncInferJobBase
 public:
     AsyncInferJobImpl(uint32_t streams_count);
     virtual hailo_status wait(std::chrono::milliseconds timeout) override;
+    virtual hailo_status cancel() override;
+
+    // The control of the job's infer request - the job can be cancelled only if it has one
+    void set_infer_request_control(InferRequestControlPtr control) { m_infer_request_control = std::move(control); }
+    const InferRequestControlPtr &get_infer_request_control() const { return m_infer_request_control; }
 
 private:
     friend class ConfiguredInferModelBase;
@@ -163,6 +227,27 @@ private:
     std::atomic_uint32_t m_ongoing_transfers;
     bool m_callback_called;
     hailo_status m_job_completion_status;
+    InferRequestControlPtr m_infer_request_control;
+};
+
+// The output buffers loaned by ConfiguredInferModel::run_async_loaned - each loaned buffer holds a reference to the pool,
+// and returns to it once it is released by the user
+class LoanedBuffersPool final : public std::enable_shared_from_this<LoanedBuffersPool>
+{
+public:
+    static Expected<std::shared_ptr<LoanedBuffersPool>> create(size_t buffer_size, size_t buffers_count);
+    LoanedBuffersPool(std::vector<BufferPtr> &&buffers);
+
+    // Returns HAILO_QUEUE_IS_FULL if all of the buffers are loaned
+    Expected<std::shared_ptr<MemoryView>> loan();
+
+private:
+    void give_back(size_t index);
+
+    std::vector<BufferPtr> m_buffers;
+    std::vector<MemoryView> m_views;
+    std::mutex m_mutex;
+    std::vector<size_t> m_free_indices;
 };
 
 /*
@@ -182,17 +267,68 @@ public:
     virtual ~ConfiguredInferModelBase() = default;
     virtual Expected<ConfiguredInferModel::Bindings> create_bindings() = 0;
     virtual hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count = 1) = 0;
+    // By default the priority is ignored - only ConfiguredInferModelImpl keeps the bulk frames apart
+    virtual hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count,
+        ConfiguredInferModel::InferPriority priority);
+    // By default a ready handle isn't supported
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle();
     virtual hailo_status activate() = 0;
     virtual hailo_status deactivate() = 0;
     virtual hailo_status run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout);
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK) = 0;
+    virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
+        ConfiguredInferModel::InferPriority priority, std::function<void(const AsyncInferCompletionInfo &)> callback);
+    // By default deadlines aren't supported
+    virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds deadline,
+        std::function<void(const AsyncInferCompletionInfo &)> callback);
+    // Launches the frames of a multiple-bindings run_async, calling frame_done_callback once per frame. By default each
+    // frame is launched with its own run_async.
+    virtual hailo_status run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback);
+    // By default the registered bindings are kept as is, and each is launched with run_async
+    virtual hailo_status register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings);
+    virtual Expected<AsyncInferJob> run_async_registered(size_t bindings_index,
+        std::function<void(const AsyncInferCompletionInfo &)> callback);
     virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() = 0;
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) = 0;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) = 0;
     virtual hailo_status set_scheduler_priority(uint8_t priority) = 0;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline) = 0;
+    virtual hailo_status set_scheduler_share(uint32_t share) = 0;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask) = 0;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky) = 0;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index) = 0;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size) = 0;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size) = 0;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames) = 0;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats() = 0;
+    virtual Expected<std::vector<PipelineElementLatencyResults>> get_pipeline_elements_latency() = 0;
     virtual Expected<size_t> get_async_queue_size() = 0;
+    // By default the queue size can't be set, so the maximum is the queue size
+    virtual Expected<size_t> get_max_async_queue_size();
+    virtual hailo_status set_async_queue_size(size_t queue_size);
+    // Measures the throughput of each queue size (using the virtual async API, so it works for every implementation
+    // that can set the queue size)
+    Expected<size_t> tune_async_queue_size(ConfiguredInferModel::Bindings bindings,
+        std::chrono::milliseconds measurement_duration, float32_t min_throughput_ratio);
+    // Runs the frames using the virtual async API, so it works for every implementation
+    hailo_status warm_up(ConfiguredInferModel::Bindings bindings, uint32_t frames_count);
+    // Sets the outputs of the bindings to loaned buffers, and runs them using the virtual async API
+    hailo_status allocate_loaned_outputs(size_t buffers_count);
+    Expected<AsyncInferJob> run_async_loaned(ConfiguredInferModel::Bindings bindings,
+        std::function<void(const AsyncInferCompletionInfo &, ConfiguredInferModel::LoanedOutputs &&)> callback);
+    virtual hailo_status set_completion_order(ConfiguredInferModel::CompletionOrder order, uint32_t max_skew) = 0;
+    virtual hailo_status set_bulk_frames_limit(uint32_t max_bulk_frames);
+    virtual hailo_status enable_temporal_skip(float32_t max_mean_difference);
+    virtual hailo_status disable_temporal_skip();
+    virtual Expected<std::string> get_pipeline_graph(ConfiguredInferModel::PipelineGraphFormat format) = 0;
+    virtual hailo_status recover() = 0;
     virtual hailo_status shutdown() = 0;
+    virtual hailo_status before_fork();
+    virtual hailo_status after_fork_in_parent();
+    virtual hailo_status after_fork_in_child();
 
     static Expected<ConfiguredInferModel::Bindings> create_bindings(
         std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
@@ -209,6 +345,8 @@ private:
 protected:
     std::unordered_map<std::string, size_t> m_inputs_frame_sizes;
     std::unordered_map<std::string, size_t> m_outputs_frame_sizes;
+    std::vector<ConfiguredInferModel::Bindings> m_registered_bindings;
+    std::unordered_map<std::string, std::shared_ptr<LoanedBuffersPool>> m_loaned_outputs_pools;
 
 };
 
@@ -219,24 +357,66 @@ public:
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
-        const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+        std::shared_ptr<AsyncPipelineExecutor> async_pipeline_executor,
+        const std::unordered_map<std::string, InputResizeParams> &inputs_resize_params,
+        hailo_pipeline_elem_stats_flags_t elem_stats_flags = HAILO_PIPELINE_ELEM_STATS_NONE,
+        const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS,
+        size_t max_buffer_pool_size = std::numeric_limits<size_t>::max());
 
     ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng, std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
-        const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes);
+        const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
+        std::shared_ptr<TransientObjectPool> transient_objects_pool);
     ~ConfiguredInferModelImpl();
     virtual Expected<ConfiguredInferModel::Bindings> create_bindings() override;
     virtual hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count) override;
+    virtual hailo_status wait_for_async_ready(std::chrono::milliseconds timeout, uint32_t frames_count,
+        ConfiguredInferModel::InferPriority priority) override;
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle() override;
     virtual hailo_status activate() override;
     virtual hailo_status deactivate() override;
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback) override;
+    virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
+        ConfiguredInferModel::InferPriority priority, std::function<void(const AsyncInferCompletionInfo &)> callback) override;
+    virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds deadline,
+        std::function<void(const AsyncInferCompletionInfo &)> callback) override;
+    // Launches all of the frames at once (see AsyncInferRunnerImpl::run_frames)
+    virtual hailo_status run_async_frames(const std::vector<ConfiguredInferModel::Bindings> &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> frame_done_callback) override;
+    virtual hailo_status register_bindings(const std::vector<ConfiguredInferModel::Bindings> &bindings) override;
+    virtual Expected<AsyncInferJob> run_async_registered(size_t bindings_index,
+        std::function<void(const AsyncInferCompletionInfo &)> callback) override;
     virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() override;
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline) override;
+    virtual hailo_status set_scheduler_share(uint32_t share) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats() override;
+    virtual Expected<std::vector<PipelineElementLatencyResults>> get_pipeline_elements_latency() override;
     virtual Expected<size_t> get_async_queue_size() override;
+    virtual Expected<size_t> get_max_async_queue_size() override;
+    virtual hailo_status set_async_queue_size(size_t queue_size) override;
+    virtual hailo_status set_completion_order(ConfiguredInferModel::CompletionOrder order, uint32_t max_skew) override;
+    virtual hailo_status set_bulk_frames_limit(uint32_t max_bulk_frames) override;
+    virtual hailo_status enable_temporal_skip(float32_t max_mean_difference) override;
+    virtual hailo_status disable_temporal_skip() override;
+    virtual Expected<std::string> get_pipeline_graph(ConfiguredInferModel::PipelineGraphFormat format) override;
+    virtual hailo_status recover() override;
     virtual hailo_status shutdown() override;
+    virtual hailo_status before_fork() override;
+    virtual hailo_status after_fork_in_parent() override;
+    virtual hailo_status after_fork_in_child() override;
+    // See InferModel::set_host_buffers_locked
+    hailo_status lock_host_buffers();
 
     static Expected<std::shared_ptr<ConfiguredInferModelImpl>> create_for_ut(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
@@ -244,15 +424,60 @@ public:
 
 private:
     virtual hailo_status validate_bindings(ConfiguredInferModel::Bindings bindings);
+    // The frames that can be in flight at a time (m_mutex should be locked)
+    size_t get_max_ongoing_frames_count() const;
+    // Updates m_async_ready_event with the current readiness of the model (m_mutex should be locked)
+    void update_async_ready_event();
+    Expected<AsyncInferJob> run_async_with_control(ConfiguredInferModel::Bindings bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> callback, InferRequestControlPtr control);
+    // The callback of the transfers of a frame - calls callback once all of the frame's transfers are done
+    TransferDoneCallbackAsyncInfer create_transfer_done_callback(std::shared_ptr<AsyncInferJobImpl> job_pimpl,
+        std::function<void(const AsyncInferCompletionInfo &)> callback, uint64_t sequence_number);
+    // Builds the host pipeline again (with m_async_infer_runner_factory), for the core op that is still configured
+    hailo_status rebuild_pipeline();
+    // Whether the frame can be skipped (see ConfiguredInferModel::enable_temporal_skip) - if so, the cached outputs are
+    // copied to the bindings' outputs (m_mutex should be locked)
+    bool try_skip_frame(ConfiguredInferModel::Bindings &bindings);
+    // The frame is inferred, and its inputs are kept as the reference of the next frames (m_mutex should be locked)
+    hailo_status set_reference_frame(ConfiguredInferModel::Bindings &bindings, uint64_t sequence_number);
+    // Copies the outputs of the frame to the cache, if it's still the reference frame
+    hailo_status cache_outputs(ConfiguredInferModel::Bindings &bindings, uint64_t sequence_number);
 
     std::weak_ptr<ConfiguredNetworkGroup> m_cng;
     std::unique_ptr<ActivatedNetworkGroup> m_ang;
     std::shared_ptr<AsyncInferRunnerImpl> m_async_infer_runner;
     uint32_t m_ongoing_parallel_transfers;
+    // The limit set by set_async_queue_size (the frames in flight are limited by the pipeline as well)
+    size_t m_async_queue_size_limit;
+    // The bulk frames (see ConfiguredInferModel::InferPriority) in flight, and the maximum amount of them
+    uint32_t m_ongoing_bulk_frames;
+    uint32_t m_bulk_frames_limit;
+    // Interactive frames waiting in wait_for_async_ready - the bulk frames wait until there are none
+    uint32_t m_waiting_interactive_frames;
+    // Sequence number of the next inference (see AsyncInferCompletionInfo::sequence_number)
+    uint64_t m_next_sequence_number;
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    // Created on the first get_async_ready_handle call (nullptr until then)
+    std::unique_ptr<ReadyEvent> m_async_ready_event;
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
+    // The per-frame objects (the jobs and their infer request controls) are allocated from here
+    std::shared_ptr<TransientObjectPool> m_transient_objects_pool;
+    // Builds the host pipeline of the model again, once it was shut down by an error (see recover)
+    std::function<Expected<std::shared_ptr<AsyncInferRunnerImpl>>()> m_async_infer_runner_factory;
+    bool m_are_host_buffers_locked;
+    // The pipeline's threads are shared with other models (see AsyncPipelineExecutor), so it can't be forked
+    bool m_is_using_pipeline_executor;
+    // See ConfiguredInferModel::enable_temporal_skip. The reference frame is the last inferred frame, the cached
+    // outputs are its outputs - valid once its callback was called.
+    bool m_is_temporal_skip_enabled;
+    float32_t m_temporal_skip_max_mean_difference;
+    bool m_is_reference_frame_valid;
+    uint64_t m_reference_sequence_number;
+    std::unordered_map<std::string, Buffer> m_reference_inputs;
+    bool m_are_cached_outputs_valid;
+    std::unordered_map<std::string, Buffer> m_cached_outputs;
 };
 
 } /* namespace hailort */
@@ -16,12 +16,122 @@
 #include "network_group/network_group_internal.hpp"
 #include "core_op/resource_manager/resource_manager.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 
 namespace hailort
 {
 
+// A thread per vstream, kept for the lifetime of the InferVStreams, so an inference doesn't create threads. The tasks of
+// each worker are run in order, and a failed task skips the tasks queued after it until wait_for_all() is called.
+class InferVStreamsWorkers final
+{
+public:
+    using Task = std::function<hailo_status()>;
+
+    static Expected<std::shared_ptr<InferVStreamsWorkers>> create(size_t workers_count)
+    {
+        auto workers = make_shared_nothrow<InferVStreamsWorkers>(workers_count);
+        CHECK_NOT_NULL_AS_EXPECTED(workers, HAILO_OUT_OF_HOST_MEMORY);
+        return workers;
+    }
+
+    explicit InferVStreamsWorkers(size_t workers_count) :
+        m_queues(workers_count), m_pending_tasks_count(0), m_status(HAILO_SUCCESS), m_should_quit(false)
+    {
+        m_threads.reserve(workers_count);
+        for (size_t i = 0; i < workers_count; i++) {
+            m_threads.emplace_back(&InferVStreamsWorkers::worker_thread, this, i);
+        }
+    }
+
+    ~InferVStreamsWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_should_quit = true;
+        }
+        m_tasks_cv.notify_all();
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    InferVStreamsWorkers(const InferVStreamsWorkers &) = delete;
+    InferVStreamsWorkers &operator=(const InferVStreamsWorkers &) = delete;
+    InferVStreamsWorkers(InferVStreamsWorkers &&) = delete;
+    InferVStreamsWorkers &operator=(InferVStreamsWorkers &&) = delete;
+
+    void submit(size_t worker_index, Task &&task)
+    {
+        assert(worker_index < m_queues.size());
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queues[worker_index].emplace_back(std::move(task));
+            m_pending_tasks_count++;
+        }
+        m_tasks_cv.notify_all();
+    }
+
+    hailo_status wait_for_all()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this]() { return 0 == m_pending_tasks_count; });
+
+        const auto status = m_status;
+        m_status = HAILO_SUCCESS;
+        return status;
+    }
+
+private:
+    void worker_thread(size_t worker_index)
+    {
+        OsUtils::set_current_thread_name("INFER_VSTREAMS");
+
+        auto &queue = m_queues[worker_index];
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_tasks_cv.wait(lock, [this, &queue]() { return m_should_quit || !queue.empty(); });
+            if (m_should_quit) {
+                return;
+            }
+
+            auto task = std::move(queue.front());
+            queue.pop_front();
+            if (HAILO_SUCCESS == m_status) {
+                lock.unlock();
+                const auto status = task();
+                lock.lock();
+
+                // An aborted stream isn't an error of the inference (see infer())
+                if ((HAILO_SUCCESS != status) && (HAILO_STREAM_ABORT != status) && (HAILO_SUCCESS == m_status)) {
+                    LOGGER__ERROR("Inference failed with status {}", status);
+                    m_status = status;
+                }
+            }
+
+            m_pending_tasks_count--;
+            if (0 == m_pending_tasks_count) {
+                m_done_cv.notify_all();
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_tasks_cv;
+    std::condition_variable m_done_cv;
+    std::vector<std::deque<Task>> m_queues;
+    size_t m_pending_tasks_count;
+    // The status of the first failed task since the last wait_for_all()
+    hailo_status m_status;
+    bool m_should_quit;
+    std::vector<std::thread> m_threads;
+};
+
 InferVStreams::InferVStreams(std::vector<InputVStream> &&inputs, std::vector<OutputVStream> &&outputs, bool is_multi_context,
     bool is_scheduled, uint16_t batch_size) :
     m_inputs(std::move(inputs)),
@@ -193,6 +303,15 @@ Expected<InferVStreams> InferVStreams::create(ConfiguredNetworkGroup &net_group,
 
 hailo_status InferVStreams::infer(const std::map<std::string, MemoryView>& input_data,
     std::map<std::string, MemoryView>& output_data, size_t frames_count)
+{
+    auto status = launch_infer(input_data, output_data, frames_count);
+    CHECK_SUCCESS(status);
+
+    return wait_for_infers();
+}
+
+hailo_status InferVStreams::launch_infer(const std::map<std::string, MemoryView> &input_data,
+    const std::map<std::string, MemoryView> &output_data, size_t frames_count)
 {
     auto status = verify_network_inputs_and_outputs(input_data, output_data);
     CHECK_SUCCESS(status);
@@ -203,65 +322,64 @@ hailo_status InferVStreams::infer(const std::map<std::string, MemoryView>& input
     status = verify_frames_count(frames_count);
     CHECK_SUCCESS(status);
 
-    std::vector<AsyncThreadPtr<hailo_status>> results;
-
-    // Launch async read/writes
-    for (auto &input_name_to_data_pair : input_data) {
-        auto input_vstream_exp = get_input_by_name(input_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(input_vstream_exp);
-        auto &input_vstream = input_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&input_vstream, &input_name_to_data_pair, frames_count]() -> hailo_status {
-                const auto &input_buffer = input_name_to_data_pair.second;
-                for (uint32_t i = 0; i < frames_count; i++) {
-                    const size_t offset = i * input_vstream.get_frame_size();
-                    auto status = input_vstream.write(MemoryView::create_const(
-                        input_buffer.data() + offset,
-                        input_vstream.get_frame_size()));
-                    if (HAILO_STREAM_ABORT == status) {
-                        LOGGER__DEBUG("Input stream was aborted!");
-                        return status;
-                    }
-                    CHECK_SUCCESS(status);
+    TRY(auto workers, get_workers());
+
+    // Launch async read/writes - the workers of the inputs are followed by the workers of the outputs
+    for (const auto &input_name_to_data_pair : input_data) {
+        TRY(auto input_vstream_ref, get_input_by_name(input_name_to_data_pair.first));
+        auto &input_vstream = input_vstream_ref.get();
+        const auto worker_index = static_cast<size_t>(&input_vstream - m_inputs.data());
+        const auto input_buffer = input_name_to_data_pair.second;
+        workers->submit(worker_index, [&input_vstream, input_buffer, frames_count]() -> hailo_status {
+            for (uint32_t i = 0; i < frames_count; i++) {
+                const size_t offset = i * input_vstream.get_frame_size();
+                auto status = input_vstream.write(MemoryView::create_const(
+                    input_buffer.data() + offset,
+                    input_vstream.get_frame_size()));
+                if (HAILO_STREAM_ABORT == status) {
+                    LOGGER__DEBUG("Input stream was aborted!");
+                    return status;
                 }
-                return HAILO_SUCCESS;
+                CHECK_SUCCESS(status);
             }
-        ));
+            return HAILO_SUCCESS;
+        });
     }
-    for (auto &output_name_to_data_pair : output_data) {
-        auto output_vstream_exp = get_output_by_name(output_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(output_vstream_exp);
-        auto &output_vstream = output_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&output_vstream, &output_name_to_data_pair, frames_count]() {
-                for (size_t i = 0; i < frames_count; i++) {
-                    auto status = output_vstream.read(MemoryView(output_name_to_data_pair.second.data() + i * output_vstream.get_frame_size(), output_vstream.get_frame_size()));
-                    if (HAILO_SUCCESS != status) {
-                        return status;
-                    }
+    for (const auto &output_name_to_data_pair : output_data) {
+        TRY(auto output_vstream_ref, get_output_by_name(output_name_to_data_pair.first));
+        auto &output_vstream = output_vstream_ref.get();
+        const auto worker_index = m_inputs.size() + static_cast<size_t>(&output_vstream - m_outputs.data());
+        auto output_buffer = output_name_to_data_pair.second;
+        workers->submit(worker_index, [&output_vstream, output_buffer, frames_count]() mutable {
+            for (size_t i = 0; i < frames_count; i++) {
+                auto status = output_vstream.read(MemoryView(output_buffer.data() + i * output_vstream.get_frame_size(), output_vstream.get_frame_size()));
+                if (HAILO_SUCCESS != status) {
+                    return status;
                 }
-                return HAILO_SUCCESS;
             }
-        ));
+            return HAILO_SUCCESS;
+        });
     }
 
-    // Wait for all results
-    auto error_status = HAILO_SUCCESS;
-    for (auto& result : results) {
-        status = result->get();
-        if (HAILO_STREAM_ABORT == status) {
-            continue;
-        }
-        if (HAILO_SUCCESS != status) {
-            error_status = status;
-            LOGGER__ERROR("Failed waiting for threads with status {}", error_status);
-        }
-    }
-    if (HAILO_SUCCESS != error_status) {
-        return error_status;
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferVStreams::wait_for_infers()
+{
+    if (nullptr == m_workers) {
+        // No inference was launched
+        return HAILO_SUCCESS;
     }
 
-    return HAILO_SUCCESS;
+    return m_workers->wait_for_all();
+}
+
+Expected<std::shared_ptr<InferVStreamsWorkers>> InferVStreams::get_workers()
+{
+    if (nullptr == m_workers) {
+        TRY(m_workers, InferVStreamsWorkers::create(m_inputs.size() + m_outputs.size()));
+    }
+    return std::shared_ptr<InferVStreamsWorkers>(m_workers);
 }
 
 hailo_status InferVStreams::verify_memory_view_size(const std::map<std::string, MemoryView>& inputs_name_mem_view_map,
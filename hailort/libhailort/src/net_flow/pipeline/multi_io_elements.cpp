@@ -9,6 +9,7 @@
 
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "net_flow/pipeline/multi_io_elements.hpp"
+#include "utils/dma_buffer_utils.hpp"
 
 namespace hailort
 {
@@ -91,8 +92,17 @@ void BaseMuxElement::run_push_async(PipelineBuffer &&buffer, const PipelinePad &
         }
         if (input_buffers_size == m_sink_name_to_index.size()) { // Last sink to set its buffer
             for (auto &input_buffer : m_input_buffers) {
-                if (HAILO_SUCCESS != input_buffer.second.action_status()) {
-                    handle_non_recoverable_async_error(input_buffer.second.action_status());
+                const auto action_status = input_buffer.second.action_status();
+                if ((HAILO_FRAME_DROPPED == action_status) || (HAILO_QUEUE_IS_FULL == action_status) ||
+                    (HAILO_FRAME_CANCELLED == action_status) || (HAILO_FRAME_EXPIRED == action_status)) {
+                    // The frame was shed by the scheduler overload policy (or dropped by its issuer before it was
+                    // sent) - only this inference fails.
+                    push_shed_frame(action_status);
+                    m_input_buffers.clear();
+                    return;
+                }
+                if (HAILO_SUCCESS != action_status) {
+                    handle_non_recoverable_async_error(action_status);
                     m_input_buffers.clear();
                     m_barrier->terminate();
                     return;
@@ -116,6 +126,22 @@ void BaseMuxElement::run_push_async(PipelineBuffer &&buffer, const PipelinePad &
     }
 }
 
+void BaseMuxElement::push_shed_frame(hailo_status shed_status)
+{
+    auto pool = m_next_pads[0]->element().get_buffer_pool();
+    assert(pool);
+
+    auto buffer_from_pool = pool->get_available_buffer(PipelineBuffer(), m_timeout);
+    if (HAILO_SUCCESS != buffer_from_pool.status()) {
+        handle_non_recoverable_async_error(buffer_from_pool.status());
+        m_barrier->terminate();
+        return;
+    }
+
+    buffer_from_pool->set_action_status(shed_status);
+    m_next_pads[0]->run_push_async(buffer_from_pool.release());
+}
+
 Expected<PipelineBuffer> BaseMuxElement::run_pull(PipelineBuffer &&optional, const PipelinePad &/*source*/)
 {
     CHECK_AS_EXPECTED(m_pipeline_direction == PipelineDirection::PULL, HAILO_INVALID_OPERATION,
@@ -185,16 +211,15 @@ NmsPostProcessMuxElement::NmsPostProcessMuxElement(std::shared_ptr<net_flow::Op>
     std::shared_ptr<AsyncPipeline> async_pipeline, hailo_status &status) :
     BaseMuxElement(nms_op->inputs_metadata().size(), name, timeout, std::move(duration_collector), std::move(pipeline_status),
         pipeline_direction, async_pipeline, status),
-    m_nms_op(nms_op)
+    m_nms_op(nms_op),
+    m_outputs({{"", MemoryView()}}) // TODO: fill with correct name
 {}
 
 Expected<PipelineBuffer> NmsPostProcessMuxElement::action(std::vector<PipelineBuffer> &&input_buffers, PipelineBuffer &&optional)
 {
-    std::map<std::string, MemoryView> inputs;
-    std::map<std::string, MemoryView> outputs;
+    assert(input_buffers.size() == m_sinks_inputs.size());
     for (size_t i = 0; i < input_buffers.size(); ++i) {
-        TRY(auto src, input_buffers[i].as_view(BufferProtection::READ));
-        inputs.insert({m_sinks_names[i], src});
+        TRY(*m_sinks_inputs[i], input_buffers[i].as_view(BufferProtection::READ));
     }
     auto pool = next_pad_downstream().element().get_buffer_pool();
     assert(pool);
@@ -210,11 +235,10 @@ Expected<PipelineBuffer> NmsPostProcessMuxElement::action(std::vector<PipelineBu
         }
     }
     CHECK_EXPECTED(acquired_buffer);
-    TRY(auto dst, acquired_buffer->as_view(BufferProtection::WRITE));
-    outputs.insert({"", dst}); // TODO: fill with correct name
+    TRY(m_outputs.begin()->second, acquired_buffer->as_view(BufferProtection::WRITE));
     m_duration_collector.start_measurement();
 
-    auto post_process_result = m_nms_op->execute(inputs, outputs);
+    auto post_process_result = m_nms_op->execute(m_inputs, m_outputs);
     m_duration_collector.complete_measurement();
 
     for (auto &input : input_buffers) {
@@ -739,16 +763,19 @@ Expected<std::vector<PipelineBuffer>> PixBufferElement::action(PipelineBuffer &&
                         }
                     });
             } else if (HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF == input_pix_buffer.memory_type) {
-                hailo_dma_buffer_t dma_buffer;
-                dma_buffer.fd = input_pix_buffer.planes[i].fd;
-                dma_buffer.size = input_pix_buffer.planes[i].plane_size;
+                // The planes may share a dmabuf, each at its own offset
+                auto dma_buffer = std::make_shared<DmaBufferPipelineData>(
+                    DmaBufferUtils::get_plane_dma_buffer(input_pix_buffer, i), input_pix_buffer.planes[i].offset,
+                    input_pix_buffer.planes[i].plane_size);
                 TransferDoneCallbackAsyncInfer exec_done = [input_ptr = shared_input_buff](hailo_status status) {
                     if (HAILO_SUCCESS != status) {
                         input_ptr->set_action_status(status);
                     }};
                 hailo_status action_status = HAILO_SUCCESS;
                 BufferPoolPtr pool = m_sources[i].next()->element().get_buffer_pool();
-                outputs.emplace_back(PipelineBuffer(dma_buffer, exec_done, action_status, pool->is_holding_user_buffers(), pool));
+                const bool should_measure = false;
+                outputs.emplace_back(PipelineBuffer(std::move(dma_buffer), exec_done, action_status,
+                    pool->is_holding_user_buffers(), pool, should_measure));
             } else {
                 return make_unexpected(HAILO_INVALID_ARGUMENT);
             }
@@ -762,18 +789,15 @@ Expected<std::vector<PipelineBuffer>> PixBufferElement::action(PipelineBuffer &&
 Expected<std::shared_ptr<AsyncHwElement>> AsyncHwElement::create(const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
     std::chrono::milliseconds timeout, hailo_pipeline_elem_stats_flags_t elem_flags, const std::string &name,
     std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<ConfiguredNetworkGroup> net_group,
-    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+    size_t buffer_pool_size, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     auto duration_collector = DurationCollector::create(elem_flags);
     CHECK_EXPECTED(duration_collector);
 
-    auto min_buffer_pool_size = net_group->get_min_buffer_pool_size();
-    CHECK_EXPECTED(min_buffer_pool_size);
-
     auto status = HAILO_UNINITIALIZED;
     auto elem_ptr = make_shared_nothrow<AsyncHwElement>(named_stream_infos, timeout, name,
         duration_collector.release(), std::move(pipeline_status), pipeline_direction, async_pipeline, net_group,
-        min_buffer_pool_size.release(), status);
+        buffer_pool_size, status);
     CHECK_AS_EXPECTED(nullptr != elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -790,7 +814,9 @@ AsyncHwElement::AsyncHwElement(const std::unordered_map<std::string, hailo_strea
         PipelineElementInternal(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, async_pipeline),
         m_timeout(timeout),
         m_net_group(net_group),
-        m_max_ongoing_transfers(max_ongoing_transfers)
+        m_max_ongoing_transfers(max_ongoing_transfers),
+        m_next_frame_index(0),
+        m_infer_request_controls_count(0)
 {
     uint32_t sinks_count = 0;
     uint32_t sources_count = 0;
@@ -839,8 +865,26 @@ void AsyncHwElement::handle_error_in_hw_async_elem(hailo_status error_status)
     return;
 }
 
+void AsyncHwElement::set_infer_request_control(uint64_t frame_index, InferRequestControlPtr control)
+{
+    std::unique_lock<std::mutex> lock(m_infer_request_controls_mutex);
+    m_infer_request_controls.emplace_back(frame_index, std::move(control));
+    m_infer_request_controls_count++;
+}
+
 void AsyncHwElement::action()
 {
+    const auto frame_index = m_next_frame_index++;
+    InferRequestControlPtr control = nullptr;
+    if (0 != m_infer_request_controls_count.load()) {
+        std::unique_lock<std::mutex> lock(m_infer_request_controls_mutex);
+        if (!m_infer_request_controls.empty() && (frame_index == m_infer_request_controls.front().first)) {
+            control = std::move(m_infer_request_controls.front().second);
+            m_infer_request_controls.pop_front();
+            m_infer_request_controls_count--;
+        }
+    }
+
     // Assuming m_input_buffers is full (has a valid buffer for all sinks)
     for (auto &input_buffer : m_input_buffers) {
         if (HAILO_SUCCESS != input_buffer.second.action_status()) {
@@ -894,6 +938,8 @@ void AsyncHwElement::action()
             auto dma_buffer = buffer_shared->get_metadata().get_additional_data<DmaBufferPipelineData>();
             buffer_representation.buffer_type = BufferType::DMA_BUFFER;
             buffer_representation.dma_buffer = dma_buffer->m_dma_buffer;
+            buffer_representation.dma_buffer_offset = dma_buffer->m_offset;
+            buffer_representation.dma_buffer_transfer_size = dma_buffer->m_size;
         } else {
             handle_non_recoverable_async_error(HAILO_INVALID_ARGUMENT);
             m_input_buffers.clear();
@@ -923,6 +969,8 @@ void AsyncHwElement::action()
             auto dma_buffer = output_buffer.second->get_metadata().get_additional_data<DmaBufferPipelineData>();
             buffer_representation.buffer_type = BufferType::DMA_BUFFER;
             buffer_representation.dma_buffer = dma_buffer->m_dma_buffer;
+            buffer_representation.dma_buffer_offset = dma_buffer->m_offset;
+            buffer_representation.dma_buffer_transfer_size = dma_buffer->m_size;
         } else {
             handle_non_recoverable_async_error(HAILO_INVALID_ARGUMENT);
             m_input_buffers.clear();
@@ -959,7 +1007,12 @@ void AsyncHwElement::action()
         return;
     }
 
-    status = cng->infer_async(named_buffers_callbacks, [](hailo_status){});
+    auto cng_base = (nullptr != control) ? std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(cng) : nullptr;
+    if (nullptr != cng_base) {
+        status = cng_base->infer_async(named_buffers_callbacks, [](hailo_status){}, control);
+    } else {
+        status = cng->infer_async(named_buffers_callbacks, [](hailo_status){});
+    }
     if (HAILO_SUCCESS != status ) {
         handle_non_recoverable_async_error(status);
         m_input_buffers.clear();
@@ -1057,6 +1110,16 @@ hailo_status AsyncHwElement::execute_terminate(hailo_status error_status)
     return HAILO_SUCCESS;
 }
 
+const std::unordered_map<std::string, std::string> &AsyncHwElement::get_sink_name_to_stream_name() const
+{
+    return m_sink_name_to_stream_name;
+}
+
+const std::unordered_map<std::string, std::string> &AsyncHwElement::get_source_name_to_stream_name() const
+{
+    return m_source_name_to_stream_name;
+}
+
 std::vector<std::shared_ptr<BufferPool>> AsyncHwElement::get_hw_interacted_buffer_pools_h2d()
 {
     std::vector<std::shared_ptr<BufferPool>> res;
@@ -11,6 +11,9 @@
 #define _HAILO_MULTI_IO_ELEMENTS_HPP_
 
 #include "net_flow/ops_metadata/yolov5_seg_op_metadata.hpp"
+#include "stream_common/transfer_common.hpp"
+
+#include <deque>
 
 namespace hailort
 {
@@ -41,6 +44,8 @@ protected:
     std::chrono::milliseconds m_timeout;
 
 private:
+    void push_shed_frame(hailo_status shed_status);
+
     std::mutex m_mutex;
     std::unordered_map<std::string, uint32_t> m_sink_name_to_index;
     std::unordered_map<std::string, PipelineBuffer> m_input_buffers;
@@ -73,6 +78,7 @@ public:
     void add_sink_name(const std::string &name) // TODO: remove this (HRT-8875)
     {
         m_sinks_names.push_back(name);
+        m_sinks_inputs.push_back(&m_inputs[name]);
     }
 
     std::shared_ptr<net_flow::Op> get_op() { return m_nms_op; }
@@ -119,6 +125,11 @@ protected:
 private:
     std::shared_ptr<net_flow::Op> m_nms_op;
     std::vector<std::string> m_sinks_names; // TODO: remove this (HRT-8875)
+    // The op's inputs and output, created once and only pointed at each frame's buffers. m_sinks_inputs[i] is the input
+    // of the i-th sink (the map's nodes are never moved).
+    std::map<std::string, MemoryView> m_inputs;
+    std::map<std::string, MemoryView> m_outputs;
+    std::vector<MemoryView*> m_sinks_inputs;
 };
 
 class NmsMuxElement : public BaseMuxElement
@@ -219,6 +230,8 @@ public:
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, hailo_format_order_t order,
         std::shared_ptr<AsyncPipeline> async_pipeline);
 
+    hailo_format_order_t order() const { return m_order; }
+
 protected:
     virtual Expected<std::vector<PipelineBuffer>> action(PipelineBuffer &&input);
     hailo_format_order_t m_order;
@@ -231,8 +244,8 @@ public:
     static Expected<std::shared_ptr<AsyncHwElement>> create(const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
         std::chrono::milliseconds timeout, hailo_pipeline_elem_stats_flags_t elem_flags, const std::string &name,
         std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
-        std::shared_ptr<ConfiguredNetworkGroup> net_group, PipelineDirection pipeline_direction = PipelineDirection::PUSH,
-        std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+        std::shared_ptr<ConfiguredNetworkGroup> net_group, size_t buffer_pool_size,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
     AsyncHwElement(const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::chrono::milliseconds timeout,
         const std::string &name, DurationCollector &&duration_collector,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
@@ -252,6 +265,15 @@ public:
     std::vector<BufferPoolPtr> get_hw_interacted_buffer_pools_h2d();
     std::vector<BufferPoolPtr> get_hw_interacted_buffer_pools_d2h();
 
+    // The name of the stream of each of the sink (input) and source (output) pads, by the name of the pad
+    const std::unordered_map<std::string, std::string> &get_sink_name_to_stream_name() const;
+    const std::unordered_map<std::string, std::string> &get_source_name_to_stream_name() const;
+
+    // Sets the control of the infer request of a frame, by the index of the frame (the amount of frames pushed to the
+    // pipeline before it). The frames reach the element in order, so the control is matched to the frame by its index.
+    // Must be called in the frames order, before the frame is pushed to the pipeline.
+    void set_infer_request_control(uint64_t frame_index, InferRequestControlPtr control);
+
 protected:
     virtual std::vector<PipelinePad*> execution_pads() override;
     virtual hailo_status execute_terminate(hailo_status error_status) override;
@@ -270,6 +292,13 @@ private:
     std::unordered_map<std::string, uint32_t> m_source_name_to_index;
     std::unordered_map<std::string, uint32_t> m_sink_name_to_index;
     BarrierPtr m_barrier;
+
+    // Index of the next frame to be launched, and the controls of the frames that have one (most frames don't, so
+    // the queue is looked at only while it isn't empty)
+    uint64_t m_next_frame_index;
+    std::mutex m_infer_request_controls_mutex;
+    std::deque<std::pair<uint64_t, InferRequestControlPtr>> m_infer_request_controls;
+    std::atomic<size_t> m_infer_request_controls_count;
 };
 
 
@@ -25,7 +25,8 @@ namespace hailort
 {
 
 PipelineBuffer::Metadata::Metadata(PipelineTimePoint start_time) :
-    m_start_time(start_time)
+    m_start_time(start_time),
+    m_enqueue_time()
 {}
 
 PipelineBuffer::Metadata::Metadata() :
@@ -42,6 +43,16 @@ void PipelineBuffer::Metadata::set_start_time(PipelineTimePoint val)
     m_start_time = val;
 }
 
+PipelineTimePoint PipelineBuffer::Metadata::get_enqueue_time() const
+{
+    return m_enqueue_time;
+}
+
+void PipelineBuffer::Metadata::set_enqueue_time(PipelineTimePoint val)
+{
+    m_enqueue_time = val;
+}
+
 PipelineBuffer::PipelineBuffer(Type type) :
     m_type(type),
     m_view(),
@@ -50,72 +61,94 @@ PipelineBuffer::PipelineBuffer(Type type) :
     m_is_user_buffer(false),
     m_should_call_exec_done(true),
     m_action_status(HAILO_SUCCESS),
-    m_buffer_type(BufferType::UNINITIALIZED)
+    m_buffer_type(BufferType::UNINITIALIZED),
+    m_dma_buffer_data(nullptr),
+    m_dma_buffer_protection(BufferProtection::NONE)
 {
 }
 
-PipelineBuffer::PipelineBuffer(hailo_status action_status, const TransferDoneCallbackAsyncInfer &exec_done) :
+PipelineBuffer::PipelineBuffer(hailo_status action_status, TransferDoneCallbackAsyncInfer exec_done) :
     m_type(Type::DATA),
     m_view(),
-    m_exec_done(exec_done),
+    m_exec_done(std::move(exec_done)),
     m_metadata(),
     m_is_user_buffer(false),
     m_should_call_exec_done(true),
     m_action_status(action_status),
-    m_buffer_type(BufferType::UNINITIALIZED)
+    m_buffer_type(BufferType::UNINITIALIZED),
+    m_dma_buffer_data(nullptr),
+    m_dma_buffer_protection(BufferProtection::NONE)
 {
 }
 
-PipelineBuffer::PipelineBuffer(MemoryView view, const TransferDoneCallbackAsyncInfer &exec_done, hailo_status action_status,
+PipelineBuffer::PipelineBuffer(MemoryView view, TransferDoneCallbackAsyncInfer exec_done, hailo_status action_status,
     bool is_user_buffer, BufferPoolWeakPtr pool, bool should_measure) :
     m_type(Type::DATA),
     m_pool(pool),
     m_view(view),
+    m_exec_done(std::move(exec_done)),
     m_metadata(Metadata(add_timestamp(should_measure))),
     m_is_user_buffer(is_user_buffer),
     m_should_call_exec_done(true),
     m_action_status(action_status),
-    m_buffer_type(BufferType::VIEW)
+    m_buffer_type(BufferType::VIEW),
+    m_dma_buffer_data(nullptr),
+    m_dma_buffer_protection(BufferProtection::NONE)
 {
-    m_exec_done = [pool = m_pool, mem_view = m_view, is_user_buffer = m_is_user_buffer, exec_done = exec_done](hailo_status status){
-        exec_done(status);
-        if (auto buffer_pool = pool.lock()) {
-            return_buffer_to_pool(buffer_pool, mem_view, is_user_buffer);
-        }
-    };
 }
 
-PipelineBuffer::PipelineBuffer(hailo_pix_buffer_t buffer, const TransferDoneCallbackAsyncInfer &exec_done) :
+PipelineBuffer::PipelineBuffer(hailo_pix_buffer_t buffer, TransferDoneCallbackAsyncInfer exec_done) :
     m_type(Type::DATA),
     m_view(),
-    m_exec_done(exec_done),
+    m_exec_done(std::move(exec_done)),
     m_metadata(),
     m_is_user_buffer(false),
     m_should_call_exec_done(true),
     m_action_status(HAILO_SUCCESS),
-    m_buffer_type(BufferType::PIX_BUFFER)
+    m_buffer_type(BufferType::PIX_BUFFER),
+    m_dma_buffer_data(nullptr),
+    m_dma_buffer_protection(BufferProtection::NONE)
 {
     set_additional_data(std::make_shared<PixBufferPipelineData>(buffer));
 }
 
-PipelineBuffer::PipelineBuffer(hailo_dma_buffer_t dma_buffer, const TransferDoneCallbackAsyncInfer &exec_done, hailo_status action_status,
+PipelineBuffer::PipelineBuffer(hailo_dma_buffer_t dma_buffer, TransferDoneCallbackAsyncInfer exec_done, hailo_status action_status,
     bool is_user_buffer, BufferPoolWeakPtr pool, bool should_measure) :
+    PipelineBuffer(std::make_shared<DmaBufferPipelineData>(dma_buffer), std::move(exec_done), action_status, is_user_buffer,
+        pool, should_measure)
+{}
+
+PipelineBuffer::PipelineBuffer(std::shared_ptr<DmaBufferPipelineData> dma_buffer_data, TransferDoneCallbackAsyncInfer exec_done,
+    hailo_status action_status, bool is_user_buffer, BufferPoolWeakPtr pool, bool should_measure) :
     m_type(Type::DATA),
     m_pool(pool),
     m_view(),
+    m_exec_done(std::move(exec_done)),
     m_metadata(Metadata(add_timestamp(should_measure))),
     m_is_user_buffer(is_user_buffer),
     m_should_call_exec_done(true),
     m_action_status(action_status),
-    m_buffer_type(BufferType::DMA_BUFFER)
+    m_buffer_type(BufferType::DMA_BUFFER),
+    m_dma_buffer_data(std::move(dma_buffer_data)),
+    m_dma_buffer_protection(BufferProtection::NONE)
 {
-    set_additional_data(std::make_shared<DmaBufferPipelineData>(dma_buffer));
-    m_exec_done = [pool = m_pool, dma_buffer = get_metadata().get_additional_data<DmaBufferPipelineData>(), is_user_buffer = m_is_user_buffer, exec_done = exec_done](hailo_status status){
-        exec_done(status);
-        if (auto buffer_pool = pool.lock()) {
-            return_buffer_to_pool(buffer_pool, dma_buffer->m_dma_buffer, is_user_buffer);
-        }
-    };
+    set_additional_data(m_dma_buffer_data);
+}
+
+PipelineBuffer::PipelineBuffer(std::shared_ptr<DmaBufferPipelineData> dma_buffer_data, BufferPoolWeakPtr pool, bool should_measure) :
+    m_type(Type::DATA),
+    m_pool(pool),
+    m_view(),
+    m_exec_done([](hailo_status){}),
+    m_metadata(Metadata(add_timestamp(should_measure))),
+    m_is_user_buffer(false),
+    m_should_call_exec_done(true),
+    m_action_status(HAILO_SUCCESS),
+    m_buffer_type(BufferType::DMA_BUFFER),
+    m_dma_buffer_data(std::move(dma_buffer_data)),
+    m_dma_buffer_protection(BufferProtection::NONE)
+{
+    set_additional_data(m_dma_buffer_data);
 }
 
 PipelineBuffer::PipelineBuffer(PipelineBuffer &&other) :
@@ -127,7 +160,9 @@ PipelineBuffer::PipelineBuffer(PipelineBuffer &&other) :
     m_is_user_buffer(std::move(other.m_is_user_buffer)),
     m_should_call_exec_done(std::exchange(other.m_should_call_exec_done, false)),
     m_action_status(std::move(other.m_action_status)),
-    m_buffer_type(other.m_buffer_type)
+    m_buffer_type(other.m_buffer_type),
+    m_dma_buffer_data(std::move(other.m_dma_buffer_data)),
+    m_dma_buffer_protection(std::exchange(other.m_dma_buffer_protection, BufferProtection::NONE))
 {}
 
 PipelineBuffer &PipelineBuffer::operator=(PipelineBuffer &&other)
@@ -141,13 +176,15 @@ PipelineBuffer &PipelineBuffer::operator=(PipelineBuffer &&other)
     m_should_call_exec_done = std::exchange(other.m_should_call_exec_done, false);
     m_action_status = std::move(other.m_action_status);
     m_buffer_type = std::move(other.m_buffer_type);
+    m_dma_buffer_data = std::move(other.m_dma_buffer_data);
+    m_dma_buffer_protection = std::exchange(other.m_dma_buffer_protection, BufferProtection::NONE);
     return *this;
 }
 
 PipelineBuffer::~PipelineBuffer()
 {
     if (m_should_call_exec_done) {
-        m_exec_done(action_status());
+        complete(action_status());
     }
 }
 
@@ -165,7 +202,7 @@ size_t PipelineBuffer::size() const
 {
     if (BufferType::DMA_BUFFER == m_buffer_type) {
         auto dma_buffer = get_metadata().get_additional_data<DmaBufferPipelineData>();
-        return dma_buffer->m_dma_buffer.size;
+        return dma_buffer->m_size;
     } else if (BufferType::PIX_BUFFER == m_buffer_type) {
         auto pix_buffer = get_metadata().get_additional_data<PixBufferPipelineData>();
         size_t size = 0;
@@ -199,7 +236,7 @@ PipelineBuffer::Type PipelineBuffer::get_type() const
     return m_type;
 }
 
-PipelineBuffer::Metadata PipelineBuffer::get_metadata() const
+const PipelineBuffer::Metadata &PipelineBuffer::get_metadata() const
 {
     return m_metadata;
 }
@@ -214,6 +251,16 @@ Expected<hailo_pix_buffer_t> PipelineBuffer::as_hailo_pix_buffer(hailo_format_or
     auto pix_buffer = get_metadata().get_additional_data<PixBufferPipelineData>();
 
     if (nullptr == pix_buffer) {
+        if (BufferType::DMA_BUFFER == m_buffer_type) {
+            // The planes are taken from the dmabuf at their offsets, so they're sent to the device without mapping the
+            // dmabuf to the host
+            const hailo_dma_buffer_t frame_dma_buffer{m_dma_buffer_data->m_dma_buffer.fd, m_dma_buffer_data->m_size};
+            TRY(auto dma_pix_buffer, HailoRTCommon::as_hailo_pix_buffer(frame_dma_buffer, order));
+            for (uint32_t i = 0; i < dma_pix_buffer.number_of_planes; i++) {
+                dma_pix_buffer.planes[i].offset += static_cast<uint32_t>(m_dma_buffer_data->m_offset);
+            }
+            return dma_pix_buffer;
+        }
         TRY(auto mem_view, as_view(BufferProtection::READ));
         return HailoRTCommon::as_hailo_pix_buffer(mem_view, order);
     } else {
@@ -245,6 +292,11 @@ void PipelineBuffer::set_metadata_start_time(PipelineTimePoint val)
     m_metadata.set_start_time(val);
 }
 
+void PipelineBuffer::set_metadata_enqueue_time(PipelineTimePoint val)
+{
+    m_metadata.set_enqueue_time(val);
+}
+
 PipelineTimePoint PipelineBuffer::add_timestamp(bool should_measure)
 {
     return should_measure ? std::chrono::steady_clock::now() : PipelineTimePoint{};
@@ -265,14 +317,15 @@ void PipelineBuffer::return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_pt
     }
 }
 
-void PipelineBuffer::return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_ptr, hailo_dma_buffer_t dma_buffer, bool is_user_buffer)
+void PipelineBuffer::return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_ptr,
+    std::shared_ptr<DmaBufferPipelineData> dma_buffer_data, bool is_user_buffer)
 {
     if (is_user_buffer) {
         return;
     }
 
     if (auto buffer_pool_ptr = buffer_pool_weak_ptr.lock() ) {
-        auto pipeline_buffer = PipelineBuffer(dma_buffer, [](hailo_status){}, HAILO_SUCCESS, false, buffer_pool_ptr, buffer_pool_ptr->should_measure_vstream_latency());
+        auto pipeline_buffer = PipelineBuffer(std::move(dma_buffer_data), buffer_pool_ptr, buffer_pool_ptr->should_measure_vstream_latency());
         hailo_status status = buffer_pool_ptr->return_buffer_to_pool(std::move(pipeline_buffer));
         if (HAILO_SUCCESS != status) {
             LOGGER__CRITICAL("Releasing buffer in buffer pool failed! status = {}", status);
@@ -292,18 +345,11 @@ void PipelineBuffer::set_action_status(hailo_status status)
 
 hailo_status PipelineBuffer::set_dma_buf_as_memview(BufferProtection dma_buffer_protection)
 {
-    auto dma_buffer = get_metadata().get_additional_data<DmaBufferPipelineData>();
-
-    TRY(m_view, DmaBufferUtils::mmap_dma_buffer(dma_buffer->m_dma_buffer, dma_buffer_protection));
-
-    m_exec_done = [mem_view=m_view, exec_done=m_exec_done, dma_buffer, dma_buffer_protection](hailo_status status) {
-        auto mumap_status = DmaBufferUtils::munmap_dma_buffer(dma_buffer->m_dma_buffer, mem_view, dma_buffer_protection);
-        if (HAILO_SUCCESS != mumap_status) {
-            LOGGER__ERROR("Failed to unmap dma buffer");
-            status = HAILO_FILE_OPERATION_FAILURE;
-        }
-        exec_done(status);
-    };
+    assert(nullptr != m_dma_buffer_data);
+    // The whole dmabuf is mapped, and the view is of its data
+    TRY(auto mapped_view, DmaBufferUtils::mmap_dma_buffer(m_dma_buffer_data->m_dma_buffer, dma_buffer_protection));
+    m_view = MemoryView(mapped_view.data() + m_dma_buffer_data->m_offset, m_dma_buffer_data->m_size);
+    m_dma_buffer_protection = dma_buffer_protection;
 
     m_buffer_type = BufferType::VIEW;
     return HAILO_SUCCESS;
@@ -312,44 +358,72 @@ hailo_status PipelineBuffer::set_dma_buf_as_memview(BufferProtection dma_buffer_
 void PipelineBuffer::call_exec_done()
 {
     if (m_should_call_exec_done) {
-        m_exec_done(action_status());
+        complete(action_status());
         m_should_call_exec_done = false;
     }
 }
 
+void PipelineBuffer::complete(hailo_status status)
+{
+    if (BufferProtection::NONE != m_dma_buffer_protection) {
+        const auto &dma_buffer = m_dma_buffer_data->m_dma_buffer;
+        const auto mapped_view = MemoryView(m_view.data() - m_dma_buffer_data->m_offset, dma_buffer.size);
+        auto mumap_status = DmaBufferUtils::munmap_dma_buffer(dma_buffer, mapped_view, m_dma_buffer_protection);
+        if (HAILO_SUCCESS != mumap_status) {
+            LOGGER__ERROR("Failed to unmap dma buffer");
+            status = HAILO_FILE_OPERATION_FAILURE;
+        }
+        m_dma_buffer_protection = BufferProtection::NONE;
+    }
+
+    m_exec_done(status);
+
+    if (m_pool.expired()) {
+        return;
+    }
+    if (nullptr != m_dma_buffer_data) {
+        return_buffer_to_pool(m_pool, m_dma_buffer_data, m_is_user_buffer);
+    } else {
+        return_buffer_to_pool(m_pool, m_view, m_is_user_buffer);
+    }
+}
+
 Expected<BufferPoolPtr> BufferPool::create(size_t buffer_size, size_t buffer_count, EventPtr shutdown_event,
                                            hailo_pipeline_elem_stats_flags_t elem_flags, hailo_vstream_stats_flags_t vstream_flags,
                                            bool is_empty, bool is_dma_able)
 {
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((elem_flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
+        queue_size_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("queue_size");
         CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
     const bool measure_vstream_latency = (vstream_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0;
 
     TRY(auto pipeline_buffers_queue, SpscQueue<PipelineBuffer>::create(buffer_count, shutdown_event, BUFFER_POOL_DEFAULT_QUEUE_TIMEOUT));
 
+    // Counts the free allocated buffers (the pools of user buffers count their buffers using pipeline_buffers_queue)
+    TRY(auto free_buffers_sema, Semaphore::create_shared(0));
+
     std::vector<Buffer> buffers;
     buffers.reserve(buffer_count);
 
     auto buffer_pool_ptr = make_shared_nothrow<BufferPool>(buffer_size, is_empty, measure_vstream_latency, std::move(buffers),
-        std::move(pipeline_buffers_queue), std::move(queue_size_accumulator), buffer_count);
+        std::move(pipeline_buffers_queue), std::move(free_buffers_sema), shutdown_event, std::move(queue_size_accumulator),
+        buffer_count);
     CHECK_AS_EXPECTED(nullptr != buffer_pool_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     if (!is_empty) {
         for (size_t i = 0; i < buffer_count; i++) {
-            BufferStorageParams buffer_storage_params;
-            if (is_dma_able) {
-                buffer_storage_params = BufferStorageParams::create_dma();
-            }
-            auto buffer = Buffer::create(buffer_size, buffer_storage_params);
+            // The buffers are always page aligned (and therefore cache line aligned), so two buffers never share a cache
+            // line, and the buffers may be dma mapped without being copied (is_dma_able only states they're likely to).
+            (void)is_dma_able;
+            auto buffer = Buffer::create(buffer_size, BufferStorageParams::create_dma());
             CHECK_EXPECTED(buffer);
 
             auto pipeline_buffer = PipelineBuffer(MemoryView(buffer.value()), [](hailo_status){}, HAILO_SUCCESS, false, buffer_pool_ptr,
                 buffer_pool_ptr->m_measure_vstream_latency);
 
-            auto status = buffer_pool_ptr->enqueue_buffer(std::move(pipeline_buffer));
+            auto status = buffer_pool_ptr->push_free_buffer(std::move(pipeline_buffer));
             CHECK_SUCCESS_AS_EXPECTED(status);
 
             buffer_pool_ptr->m_buffers.emplace_back(buffer.release());
@@ -360,17 +434,34 @@ Expected<BufferPoolPtr> BufferPool::create(size_t buffer_size, size_t buffer_cou
 }
 
 BufferPool::BufferPool(size_t buffer_size, bool is_holding_user_buffers, bool measure_vstream_latency, std::vector<Buffer> &&buffers,
-        SpscQueue<PipelineBuffer> &&pipeline_buffers_queue, AccumulatorPtr &&queue_size_accumulator,
-        size_t max_buffer_count) :
+        SpscQueue<PipelineBuffer> &&pipeline_buffers_queue, SemaphorePtr &&free_buffers_sema, EventPtr shutdown_event,
+        AccumulatorPtr &&queue_size_accumulator, size_t max_buffer_count) :
     m_buffer_size(buffer_size),
     m_is_holding_user_buffers(is_holding_user_buffers),
     m_max_buffer_count(max_buffer_count),
     m_measure_vstream_latency(measure_vstream_latency),
     m_buffers(std::move(buffers)),
+    m_locked_buffers_count(0),
     m_pipeline_buffers_queue(std::move(pipeline_buffers_queue)),
+    m_free_buffers_count(0),
+    m_free_buffers_sema(std::move(free_buffers_sema)),
+    m_free_buffers_sema_or_shutdown(m_free_buffers_sema, shutdown_event),
     m_queue_size_accumulator(std::move(queue_size_accumulator)),
     m_is_already_running(false)
 {
+    if (!m_is_holding_user_buffers) {
+        m_free_buffers.reserve(max_buffer_count);
+    }
+}
+
+BufferPool::~BufferPool()
+{
+    for (size_t i = 0; i < m_locked_buffers_count; i++) {
+        auto status = OsUtils::unlock_memory(m_buffers[i].data(), m_buffers[i].size());
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed to unlock a buffer of the pool, status = {}", status);
+        }
+    }
 }
 
 size_t BufferPool::buffer_size()
@@ -413,6 +504,9 @@ size_t BufferPool::max_capacity()
 
 size_t BufferPool::num_of_buffers_in_pool()
 {
+    if (!m_is_holding_user_buffers) {
+        return m_free_buffers_count.load();
+    }
     return m_pipeline_buffers_queue.size_approx();
 }
 
@@ -428,10 +522,11 @@ Expected<PipelineBuffer> BufferPool::acquire_buffer(std::chrono::milliseconds ti
     std::unique_lock<std::mutex> lock(m_dequeue_mutex);
 
     if (nullptr != m_queue_size_accumulator) {
-        m_queue_size_accumulator->add_data_point(static_cast<double>(m_pipeline_buffers_queue.size_approx()));
+        m_queue_size_accumulator->add_data_point(static_cast<double>(num_of_buffers_in_pool()));
     }
 
-    auto pipeline_buffer = m_pipeline_buffers_queue.dequeue(timeout, ignore_shutdown_event);
+    auto pipeline_buffer = m_is_holding_user_buffers ? m_pipeline_buffers_queue.dequeue(timeout, ignore_shutdown_event) :
+        pop_free_buffer(timeout, ignore_shutdown_event);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == pipeline_buffer.status()) {
         return make_unexpected(pipeline_buffer.status());
     }
@@ -473,11 +568,43 @@ Expected<PipelineBuffer> BufferPool::get_available_buffer(PipelineBuffer &&optio
 
 hailo_status BufferPool::return_buffer_to_pool(PipelineBuffer &&pipeline_buffer)
 {
+    if (!m_is_holding_user_buffers) {
+        return push_free_buffer(std::move(pipeline_buffer));
+    }
+
     std::unique_lock<std::mutex> lock(m_enqueue_mutex);
     // This can be called after the shutdown event was signaled so we ignore it here
     return m_pipeline_buffers_queue.enqueue(std::move(pipeline_buffer), true);
 }
 
+hailo_status BufferPool::push_free_buffer(PipelineBuffer &&pipeline_buffer)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_free_buffers_mutex);
+        CHECK(m_free_buffers.size() < m_max_buffer_count, HAILO_INTERNAL_FAILURE, "Buffer pool is already full");
+        m_free_buffers.emplace_back(std::move(pipeline_buffer));
+        m_free_buffers_count = m_free_buffers.size();
+    }
+    // Signaling without the shutdown event, since the buffers may be returned after shutdown
+    return m_free_buffers_sema->signal();
+}
+
+Expected<PipelineBuffer> BufferPool::pop_free_buffer(std::chrono::milliseconds timeout, bool ignore_shutdown_event)
+{
+    const auto wait_result = ignore_shutdown_event ? m_free_buffers_sema->wait(timeout) :
+        m_free_buffers_sema_or_shutdown.wait(timeout);
+    if (HAILO_SUCCESS != wait_result) {
+        return make_unexpected(wait_result);
+    }
+
+    std::lock_guard<std::mutex> lock(m_free_buffers_mutex);
+    assert(!m_free_buffers.empty());
+    auto pipeline_buffer = std::move(m_free_buffers.back());
+    m_free_buffers.pop_back();
+    m_free_buffers_count = m_free_buffers.size();
+    return pipeline_buffer;
+}
+
 hailo_status BufferPool::map_to_vdevice(VDevice &vdevice, hailo_dma_buffer_direction_t direction)
 {
     for (auto &buff : m_buffers) {
@@ -488,10 +615,21 @@ hailo_status BufferPool::map_to_vdevice(VDevice &vdevice, hailo_dma_buffer_direc
     return HAILO_SUCCESS;
 }
 
+hailo_status BufferPool::lock_buffers()
+{
+    for (size_t i = m_locked_buffers_count; i < m_buffers.size(); i++) {
+        CHECK_SUCCESS(OsUtils::lock_memory(m_buffers[i].data(), m_buffers[i].size()));
+        m_locked_buffers_count++;
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status BufferPool::set_buffer_size(uint32_t buffer_size)
 {
     std::unique_lock<std::mutex> lock(m_buffer_size_mutex);
-    CHECK(!m_is_already_running, HAILO_INVALID_OPERATION,
+    // A pool of user buffers owns no memory, so its buffer size can be changed as long as it holds no buffers
+    const bool is_empty_user_buffers_pool = m_is_holding_user_buffers && (0 == num_of_buffers_in_pool());
+    CHECK(!m_is_already_running || is_empty_user_buffers_pool, HAILO_INVALID_OPERATION,
         "Setting buffer size of pool size after starting inference in not allowed");
 
     m_buffer_size = buffer_size;
@@ -502,31 +640,36 @@ Expected<DurationCollector> DurationCollector::create(hailo_pipeline_elem_stats_
     uint32_t num_frames_before_collection_start)
 {
     AccumulatorPtr latency_accumulator = nullptr;
+    LatencyHistogramPtr latency_histogram = nullptr;
     const auto measure_latency = should_measure_latency(flags);
     if (measure_latency) {
-        latency_accumulator = make_shared_nothrow<FullAccumulator<double>>("latency");
+        latency_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("latency");
         CHECK_AS_EXPECTED(nullptr != latency_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+
+        latency_histogram = make_shared_nothrow<LatencyHistogram>();
+        CHECK_AS_EXPECTED(nullptr != latency_histogram, HAILO_OUT_OF_HOST_MEMORY);
     }
 
     AccumulatorPtr average_fps_accumulator = nullptr;
     const auto measure_average_fps = should_measure_average_fps(flags);
     if (measure_average_fps) {
-        average_fps_accumulator = make_shared_nothrow<AverageFPSAccumulator<double>>("fps");
+        average_fps_accumulator = make_shared_nothrow<ShardedAverageFPSAccumulator<double>>("fps");
         CHECK_AS_EXPECTED(nullptr != average_fps_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
     return DurationCollector(measure_latency, measure_average_fps, std::move(latency_accumulator),
-        std::move(average_fps_accumulator), num_frames_before_collection_start);
+        std::move(average_fps_accumulator), std::move(latency_histogram), num_frames_before_collection_start);
 }
 
 DurationCollector::DurationCollector(bool measure_latency, bool measure_average_fps,
                                       AccumulatorPtr &&latency_accumulator, AccumulatorPtr &&average_fps_accumulator,
-                                      uint32_t num_frames_before_collection_start) :
+                                      LatencyHistogramPtr &&latency_histogram, uint32_t num_frames_before_collection_start) :
     m_measure_latency(measure_latency),
     m_measure_average_fps(measure_average_fps),
     m_measure(m_measure_latency || m_measure_average_fps),
     m_latency_accumulator(std::move(latency_accumulator)),
     m_average_fps_accumulator(std::move(average_fps_accumulator)),
+    m_latency_histogram(std::move(latency_histogram)),
     m_start(),
     m_count(0),
     m_num_frames_before_collection_start(num_frames_before_collection_start)
@@ -552,10 +695,11 @@ void DurationCollector::complete_measurement()
         return;
     }
 
-    const auto duration_sec = std::chrono::duration_cast<std::chrono::duration<double>>(
-        std::chrono::steady_clock::now() - m_start).count();
+    const auto duration = std::chrono::steady_clock::now() - m_start;
+    const auto duration_sec = std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
     if (m_measure_latency) {
         m_latency_accumulator->add_data_point(duration_sec);
+        m_latency_histogram->record(duration);
     }
 
     if (m_measure_average_fps) {
@@ -573,6 +717,11 @@ AccumulatorPtr DurationCollector::get_average_fps_accumulator()
     return m_average_fps_accumulator;
 }
 
+LatencyHistogramPtr DurationCollector::get_latency_histogram()
+{
+    return m_latency_histogram;
+}
+
 bool DurationCollector::should_measure_latency(hailo_pipeline_elem_stats_flags_t flags)
 {
     return (flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY) != 0;
@@ -796,6 +945,11 @@ AccumulatorPtr PipelineElement::get_latency_accumulator()
     return m_duration_collector.get_latency_accumulator();
 }
 
+LatencyHistogramPtr PipelineElement::get_latency_histogram()
+{
+    return m_duration_collector.get_latency_histogram();
+}
+
 bool PipelineElement::is_terminating_element()
 {
     return m_is_terminating_element;
@@ -806,6 +960,11 @@ std::vector<AccumulatorPtr> PipelineElement::get_queue_size_accumulators()
     return std::vector<AccumulatorPtr>();
 }
 
+LatencyHistogramPtr PipelineElement::get_wait_time_histogram()
+{
+    return nullptr;
+}
+
 std::vector<PipelinePad> &PipelineElement::sinks()
 {
     return m_sinks;
@@ -18,6 +18,7 @@
 #include "net_flow/ops/nms_post_process.hpp"
 #include "hailo/network_group.hpp"
 #include "utils/thread_safe_queue.hpp"
+#include "common/runtime_statistics_internal.hpp"
 
 #include <memory>
 #include <thread>
@@ -74,8 +75,13 @@ struct PixBufferPipelineData : AdditionalData
 
 struct DmaBufferPipelineData : AdditionalData
 {
-    DmaBufferPipelineData(const hailo_dma_buffer_t &buffer) : m_dma_buffer(buffer) {};
+    DmaBufferPipelineData(const hailo_dma_buffer_t &buffer) : DmaBufferPipelineData(buffer, 0, buffer.size) {};
+    DmaBufferPipelineData(const hailo_dma_buffer_t &buffer, size_t offset, size_t size) :
+        m_dma_buffer(buffer), m_offset(offset), m_size(size) {};
     hailo_dma_buffer_t m_dma_buffer;
+    // The data is the m_size bytes at m_offset of the dmabuf (e.g. a plane of a frame)
+    size_t m_offset;
+    size_t m_size;
 };
 
 class BufferPool;
@@ -101,15 +107,20 @@ public:
 
         void set_start_time(PipelineTimePoint val);
 
-        void set_additional_data(std::shared_ptr<AdditionalData> data) { m_additional_data = data;}
+        // The time the buffer was enqueued to a queue element (set only when the queue measures its wait time)
+        PipelineTimePoint get_enqueue_time() const;
+        void set_enqueue_time(PipelineTimePoint val);
+
+        void set_additional_data(std::shared_ptr<AdditionalData> data) { m_additional_data = std::move(data);}
         template <typename T>
-        std::shared_ptr<T> get_additional_data() {
+        std::shared_ptr<T> get_additional_data() const {
             return std::static_pointer_cast<T>(m_additional_data);
         }
 
     private:
         std::shared_ptr<AdditionalData> m_additional_data;
         PipelineTimePoint m_start_time;
+        PipelineTimePoint m_enqueue_time;
     };
 
     enum class Type {
@@ -121,12 +132,17 @@ public:
     // Creates an empty PipelineBuffer (with no buffer/memory view)
     PipelineBuffer(Type type);
     // TODO HRT-12185: remove the option to pass a lambda as a parameter and save it as a member since it increases the memory consumption Significantly
-    PipelineBuffer(hailo_status action_status = HAILO_SUCCESS, const TransferDoneCallbackAsyncInfer &exec_done = [](hailo_status){});
-    PipelineBuffer(MemoryView view, const TransferDoneCallbackAsyncInfer &exec_done = [](hailo_status){}, hailo_status action_status = HAILO_SUCCESS,
+    // Note: exec_done is copied into the buffer - a callback shared by several buffers should capture only a shared_ptr
+    //       to its state, so it is copied without being allocated.
+    PipelineBuffer(hailo_status action_status = HAILO_SUCCESS, TransferDoneCallbackAsyncInfer exec_done = [](hailo_status){});
+    PipelineBuffer(MemoryView view, TransferDoneCallbackAsyncInfer exec_done = [](hailo_status){}, hailo_status action_status = HAILO_SUCCESS,
         bool is_user_buffer = true, BufferPoolWeakPtr pool = BufferPoolWeakPtr(), bool should_measure = false);
-    PipelineBuffer(hailo_pix_buffer_t buffer, const TransferDoneCallbackAsyncInfer &exec_done = [](hailo_status){});
-    PipelineBuffer(hailo_dma_buffer_t dma_buffer, const TransferDoneCallbackAsyncInfer &exec_done = [](hailo_status){},
+    PipelineBuffer(hailo_pix_buffer_t buffer, TransferDoneCallbackAsyncInfer exec_done = [](hailo_status){});
+    PipelineBuffer(hailo_dma_buffer_t dma_buffer, TransferDoneCallbackAsyncInfer exec_done = [](hailo_status){},
         hailo_status action_status = HAILO_SUCCESS, bool is_user_buffer = true, BufferPoolWeakPtr pool = BufferPoolWeakPtr(), bool should_measure = false);
+    // A buffer of a part of a dma buffer (see DmaBufferPipelineData)
+    PipelineBuffer(std::shared_ptr<DmaBufferPipelineData> dma_buffer_data, TransferDoneCallbackAsyncInfer exec_done,
+        hailo_status action_status, bool is_user_buffer, BufferPoolWeakPtr pool, bool should_measure);
 
     ~PipelineBuffer();
 
@@ -141,8 +157,9 @@ public:
     Expected<MemoryView> as_view(BufferProtection dma_buffer_protection);
     Expected<hailo_pix_buffer_t> as_hailo_pix_buffer(hailo_format_order_t order = HAILO_FORMAT_ORDER_AUTO);
     Type get_type() const;
-    Metadata get_metadata() const;
+    const Metadata &get_metadata() const;
     void set_metadata_start_time(PipelineTimePoint val);
+    void set_metadata_enqueue_time(PipelineTimePoint val);
     void set_additional_data(std::shared_ptr<AdditionalData> data) { m_metadata.set_additional_data(data);}
     hailo_status action_status();
     void set_action_status(hailo_status status);
@@ -150,6 +167,13 @@ public:
     BufferType get_buffer_type() const;
 
 private:
+    // Used for recycling a pool dma buffer, reusing its dma buffer data
+    PipelineBuffer(std::shared_ptr<DmaBufferPipelineData> dma_buffer_data, BufferPoolWeakPtr pool, bool should_measure);
+
+    // Calls m_exec_done, then unmaps the buffer (if it was mapped by as_view) and returns it to its pool (if it has one).
+    // Done by the buffer itself rather than by wrapping m_exec_done, so no callback is allocated per frame.
+    void complete(hailo_status status);
+
     Type m_type;
     BufferPoolWeakPtr m_pool;
     MemoryView m_view;
@@ -159,10 +183,15 @@ private:
     bool m_should_call_exec_done;
     hailo_status m_action_status;
     BufferType m_buffer_type;
+    // The dma buffer returned to the pool (nullptr if the buffer is not a dma buffer)
+    std::shared_ptr<DmaBufferPipelineData> m_dma_buffer_data;
+    // The protection the dma buffer is mapped with by as_view (NONE if it wasn't mapped)
+    BufferProtection m_dma_buffer_protection;
 
     static PipelineTimePoint add_timestamp(bool should_measure);
     static void return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_ptr, MemoryView mem_view, bool is_user_buffer);
-    static void return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_ptr, hailo_dma_buffer_t dma_buffer, bool is_user_buffer);
+    static void return_buffer_to_pool(BufferPoolWeakPtr buffer_pool_weak_ptr, std::shared_ptr<DmaBufferPipelineData> dma_buffer_data,
+        bool is_user_buffer);
     hailo_status set_dma_buf_as_memview(BufferProtection dma_buffer_protection);
 };
 
@@ -174,8 +203,9 @@ public:
         bool dma_able = false);
 
     BufferPool(size_t buffer_size, bool is_holding_user_buffers, bool measure_vstream_latency, std::vector<Buffer> &&buffers,
-        SpscQueue<PipelineBuffer> &&pipeline_buffers_queue, AccumulatorPtr &&queue_size_accumulator, size_t max_buffer_count);
-    virtual ~BufferPool() = default;
+        SpscQueue<PipelineBuffer> &&pipeline_buffers_queue, SemaphorePtr &&free_buffers_sema, EventPtr shutdown_event,
+        AccumulatorPtr &&queue_size_accumulator, size_t max_buffer_count);
+    virtual ~BufferPool();
 
     size_t buffer_size();
     hailo_status enqueue_buffer(PipelineBuffer &&pipeline_buffer);
@@ -189,9 +219,14 @@ public:
     bool is_holding_user_buffers();
 
     hailo_status map_to_vdevice(VDevice &vdevice, hailo_dma_buffer_direction_t direction);
+    // Faults in and locks the pages of the allocated buffers, so the first frames don't page fault on them (the
+    // buffers are unlocked when the pool is destroyed)
+    hailo_status lock_buffers();
     hailo_status set_buffer_size(uint32_t buffer_size);
 private:
     hailo_status return_buffer_to_pool(PipelineBuffer &&pipeline_buffer);
+    hailo_status push_free_buffer(PipelineBuffer &&pipeline_buffer);
+    Expected<PipelineBuffer> pop_free_buffer(std::chrono::milliseconds timeout, bool ignore_shutdown_event);
 
     std::atomic<size_t> m_buffer_size;
     bool m_is_holding_user_buffers;
@@ -208,7 +243,21 @@ private:
     // to the mapping objects.
     std::vector<hailort::DmaMappedBuffer> m_dma_mapped_buffers;
 
+    // The amount of buffers (from the start of m_buffers) locked by lock_buffers
+    size_t m_locked_buffers_count;
+
+    // The user buffers are handed out in the order they were enqueued (FIFO), using m_pipeline_buffers_queue.
     SpscQueue<PipelineBuffer> m_pipeline_buffers_queue;
+
+    // The allocated buffers are interchangeable, so the most recently returned buffer is handed out first (LIFO) - it
+    // was just processed, so it's likely still in the cache of the core running this part of the pipeline.
+    // m_free_buffers is reserved to the pool size on creation, so pushing a buffer never allocates.
+    std::mutex m_free_buffers_mutex;
+    std::vector<PipelineBuffer> m_free_buffers;
+    std::atomic<size_t> m_free_buffers_count;
+    SemaphorePtr m_free_buffers_sema;
+    WaitOrShutdown m_free_buffers_sema_or_shutdown;
+
     AccumulatorPtr m_queue_size_accumulator;
     // we have enqueue and dequeue mutex to allow mpmc
     std::mutex m_enqueue_mutex;
@@ -242,11 +291,13 @@ public:
     AccumulatorPtr get_latency_accumulator();
     // average_fps_accumulator will measure fps in seconds^-1
     AccumulatorPtr get_average_fps_accumulator();
+    // latency_histogram holds the percentiles of the latency (nullptr if latency isn't measured)
+    LatencyHistogramPtr get_latency_histogram();
 
 private:
     DurationCollector(bool measure_latency, bool measure_average_fps,
                       AccumulatorPtr &&latency_accumulator, AccumulatorPtr &&average_fps_accumulator,
-                      uint32_t num_frames_before_collection_start);
+                      LatencyHistogramPtr &&latency_histogram, uint32_t num_frames_before_collection_start);
     static bool should_measure_latency(hailo_pipeline_elem_stats_flags_t flags);
     static bool should_measure_average_fps(hailo_pipeline_elem_stats_flags_t flags);
 
@@ -255,6 +306,7 @@ private:
     const bool m_measure;
     AccumulatorPtr m_latency_accumulator;
     AccumulatorPtr m_average_fps_accumulator;
+    LatencyHistogramPtr m_latency_histogram;
     PipelineTimePoint m_start;
     size_t m_count;
     const size_t m_num_frames_before_collection_start;
@@ -366,8 +418,11 @@ public:
     hailo_status clear_abort();
     AccumulatorPtr get_fps_accumulator();
     AccumulatorPtr get_latency_accumulator();
+    LatencyHistogramPtr get_latency_histogram();
     bool is_terminating_element();
     virtual std::vector<AccumulatorPtr> get_queue_size_accumulators();
+    // Histogram of the time frames wait in the element before being processed (nullptr if not measured)
+    virtual LatencyHistogramPtr get_wait_time_histogram();
     std::vector<PipelinePad> &sinks();
     std::vector<PipelinePad> &sources();
     const std::vector<PipelinePad> &sinks() const;
@@ -402,6 +457,11 @@ public:
         return HAILO_INVALID_OPERATION;
     }
 
+    // Overriden by elements transforming the frames to the user buffer format
+    virtual hailo_status set_user_buffer_format(const hailo_format_t &/*user_buffer_format*/) {
+        return HAILO_INVALID_OPERATION;
+    }
+
     virtual BufferPoolPtr get_buffer_pool() const
     {
         // This method should be overriden by element with local pools
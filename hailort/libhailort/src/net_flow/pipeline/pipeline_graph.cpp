@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file pipeline_graph.cpp
+ * @brief Implementation of the pipeline graph export
+ **/
+
+#include "net_flow/pipeline/pipeline_graph.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+
+namespace hailort
+{
+
+std::vector<PipelineGraph::ElementSnapshot> PipelineGraph::snapshot(const std::vector<std::shared_ptr<PipelineElement>> &pipeline)
+{
+    std::vector<ElementSnapshot> elements;
+    elements.reserve(pipeline.size());
+    for (const auto &element : pipeline) {
+        if (nullptr == element) {
+            continue;
+        }
+
+        ElementSnapshot element_snapshot{};
+        element_snapshot.name = element->name();
+        element_snapshot.description = element->description();
+        for (const auto &source : element->sources()) {
+            if (nullptr != source.next()) {
+                element_snapshot.next_elements.emplace_back(source.next()->element().name());
+            }
+        }
+
+        auto pool = element->get_buffer_pool();
+        if (nullptr != pool) {
+            element_snapshot.has_buffer_pool = true;
+            element_snapshot.pool_capacity = pool->max_capacity();
+            element_snapshot.pool_free_buffers = pool->num_of_buffers_in_pool();
+            element_snapshot.pool_holds_user_buffers = pool->is_holding_user_buffers();
+        }
+
+        auto fps_accumulator = element->get_fps_accumulator();
+        if (nullptr != fps_accumulator) {
+            auto fps = fps_accumulator->mean();
+            if (fps) {
+                element_snapshot.has_fps = true;
+                element_snapshot.fps = fps.value();
+            }
+        }
+
+        elements.emplace_back(std::move(element_snapshot));
+    }
+    return elements;
+}
+
+std::string PipelineGraph::escape(const std::string &str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        default:
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string PipelineGraph::to_dot(const std::vector<std::shared_ptr<PipelineElement>> &pipeline)
+{
+    std::stringstream dot;
+    dot << std::fixed << std::setprecision(2);
+    dot << "digraph pipeline {\n";
+    dot << "    rankdir=LR;\n";
+    dot << "    node [shape=box];\n";
+
+    const auto elements = snapshot(pipeline);
+    for (const auto &element : elements) {
+        dot << "    \"" << escape(element.name) << "\" [label=\"" << escape(element.description);
+        if (element.has_buffer_pool) {
+            dot << "\\nfree buffers: " << element.pool_free_buffers << "/" << element.pool_capacity;
+        }
+        if (element.has_fps) {
+            dot << "\\nfps: " << element.fps;
+        }
+        dot << "\"";
+        // An element without free buffers blocks the elements before it - highlighting it as the likely bottleneck (a
+        // pool of user buffers is empty when the user didn't provide buffers yet, so it's not highlighted)
+        if (element.has_buffer_pool && !element.pool_holds_user_buffers && (0 == element.pool_free_buffers)) {
+            dot << ", color=red";
+        }
+        dot << "];\n";
+    }
+
+    for (const auto &element : elements) {
+        for (const auto &next_element : element.next_elements) {
+            dot << "    \"" << escape(element.name) << "\" -> \"" << escape(next_element) << "\";\n";
+        }
+    }
+
+    dot << "}\n";
+    return dot.str();
+}
+
+std::string PipelineGraph::to_json(const std::vector<std::shared_ptr<PipelineElement>> &pipeline)
+{
+    std::stringstream json;
+    json << "{\"elements\": [";
+
+    const auto elements = snapshot(pipeline);
+    for (size_t i = 0; i < elements.size(); i++) {
+        const auto &element = elements[i];
+        json << ((0 == i) ? "" : ", ");
+        json << "{\"name\": \"" << escape(element.name) << "\", \"description\": \"" << escape(element.description) << "\"";
+        json << ", \"next_elements\": [";
+        for (size_t j = 0; j < element.next_elements.size(); j++) {
+            json << ((0 == j) ? "" : ", ") << "\"" << escape(element.next_elements[j]) << "\"";
+        }
+        json << "]";
+        if (element.has_buffer_pool) {
+            json << ", \"buffer_pool\": {\"capacity\": " << element.pool_capacity << ", \"free_buffers\": " <<
+                element.pool_free_buffers << ", \"holds_user_buffers\": " << (element.pool_holds_user_buffers ? "true" : "false") << "}";
+        }
+        if (element.has_fps) {
+            json << ", \"fps\": " << element.fps;
+        }
+        json << "}";
+    }
+
+    json << "]}";
+    return json.str();
+}
+
+} /* namespace hailort */
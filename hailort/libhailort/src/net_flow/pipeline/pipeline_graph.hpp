@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file pipeline_graph.hpp
+ * @brief Exports the graph of a running pipeline (elements, links and statistics) as DOT or JSON.
+ **/
+
+#ifndef _HAILO_PIPELINE_GRAPH_HPP_
+#define _HAILO_PIPELINE_GRAPH_HPP_
+
+#include "net_flow/pipeline/pipeline.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+class PipelineGraph final
+{
+public:
+    // The graph is a snapshot of the pipeline state when called, so it may be called repeatedly while the pipeline runs.
+    static std::string to_dot(const std::vector<std::shared_ptr<PipelineElement>> &pipeline);
+    static std::string to_json(const std::vector<std::shared_ptr<PipelineElement>> &pipeline);
+
+private:
+    PipelineGraph() = default;
+
+    struct ElementSnapshot
+    {
+        std::string name;
+        std::string description;
+        // Names of the elements linked to the element's sources
+        std::vector<std::string> next_elements;
+        bool has_buffer_pool;
+        size_t pool_capacity;
+        size_t pool_free_buffers;
+        bool pool_holds_user_buffers;
+        // Valid if the element measures its FPS (see HAILO_PIPELINE_ELEM_STATS_MEASURE_FPS)
+        bool has_fps;
+        double fps;
+    };
+
+    static std::vector<ElementSnapshot> snapshot(const std::vector<std::shared_ptr<PipelineElement>> &pipeline);
+    static std::string escape(const std::string &str);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_PIPELINE_GRAPH_HPP_ */
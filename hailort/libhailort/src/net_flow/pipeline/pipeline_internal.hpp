@@ -13,6 +13,7 @@
 #include "net_flow/pipeline/pipeline.hpp"
 
 #include "common/barrier.hpp"
+#include "net_flow/pipeline/async_pipeline_executor.hpp"
 
 namespace hailort
 {
@@ -28,6 +29,8 @@ struct ElementBuildParams
     size_t buffer_pool_size_edges;
     hailo_pipeline_elem_stats_flags_t elem_stats_flags;
     hailo_vstream_stats_flags_t vstream_stats_flags;
+    // If not nullptr, the queue elements run on the executor instead of running their own threads.
+    std::shared_ptr<AsyncPipelineExecutor> executor;
 };
 
 class PipelineElementInternal : public PipelineElement
@@ -23,8 +23,19 @@ Expected<SpscQueue<PipelineBuffer>> BaseQueueElement::create_queue(size_t queue_
     return queue.release();
 }
 
+Expected<LatencyHistogramPtr> BaseQueueElement::create_wait_time_histogram(hailo_pipeline_elem_stats_flags_t flags)
+{
+    LatencyHistogramPtr wait_time_histogram = nullptr;
+    if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY) != 0) {
+        wait_time_histogram = make_shared_nothrow<LatencyHistogram>();
+        CHECK_AS_EXPECTED(nullptr != wait_time_histogram, HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return wait_time_histogram;
+}
+
 BaseQueueElement::BaseQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event, const std::string &name,
-    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
     std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
     PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     IntermediateElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, async_pipeline),
@@ -35,6 +46,7 @@ BaseQueueElement::BaseQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPool
     m_activation_event(std::move(activation_event)),
     m_deactivation_event(std::move(deactivation_event)),
     m_queue_size_accumulator(std::move(queue_size_accumulator)),
+    m_wait_time_histogram(std::move(wait_time_histogram)),
     m_pool(buffer_pool)
 {}
 
@@ -111,6 +123,27 @@ std::vector<AccumulatorPtr> BaseQueueElement::get_queue_size_accumulators()
     return {m_queue_size_accumulator};
 }
 
+LatencyHistogramPtr BaseQueueElement::get_wait_time_histogram()
+{
+    return m_wait_time_histogram;
+}
+
+void BaseQueueElement::mark_enqueue_time(PipelineBuffer &buffer)
+{
+    if (nullptr != m_wait_time_histogram) {
+        buffer.set_metadata_enqueue_time(std::chrono::steady_clock::now());
+    }
+}
+
+void BaseQueueElement::record_wait_time(const PipelineBuffer &buffer)
+{
+    if ((nullptr == m_wait_time_histogram) || (PipelineBuffer::Type::DATA != buffer.get_type())) {
+        return;
+    }
+
+    m_wait_time_histogram->record(std::chrono::steady_clock::now() - buffer.get_metadata().get_enqueue_time());
+}
+
 hailo_status BaseQueueElement::execute_activate()
 {
     auto status = m_shutdown_event->reset();
@@ -240,15 +273,18 @@ Expected<std::shared_ptr<PushQueueElement>> PushQueueElement::create(const std::
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
+        queue_size_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("queue_size");
         CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
+    auto wait_time_histogram = BaseQueueElement::create_wait_time_histogram(flags);
+    CHECK_EXPECTED(wait_time_histogram);
+
     auto buffer_pool = BufferPool::create(frame_size, queue_size, shutdown_event, flags, vs_flags);
     CHECK_EXPECTED(buffer_pool);
 
     auto queue_ptr = make_shared_nothrow<PushQueueElement>(queue.release(), buffer_pool.release(), shutdown_event, name, timeout,
-        duration_collector.release(), std::move(queue_size_accumulator), std::move(pipeline_status),
+        duration_collector.release(), std::move(queue_size_accumulator), wait_time_histogram.release(), std::move(pipeline_status),
         activation_event.release(), deactivation_event.release(), async_pipeline, true);
     CHECK_AS_EXPECTED(nullptr != queue_ptr, HAILO_OUT_OF_HOST_MEMORY, "Creating PushQueueElement {} failed!", name);
 
@@ -267,10 +303,10 @@ Expected<std::shared_ptr<PushQueueElement>> PushQueueElement::create(const std::
 }
 
 PushQueueElement::PushQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event, const std::string &name,
-    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
     std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
     std::shared_ptr<AsyncPipeline> async_pipeline, bool should_start_thread) :
-    BaseQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator),
+    BaseQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator), std::move(wait_time_histogram),
         std::move(pipeline_status), std::move(activation_event), std::move(deactivation_event), PipelineDirection::PUSH, async_pipeline)
 {
     if (should_start_thread) {
@@ -295,6 +331,7 @@ hailo_status PushQueueElement::run_push(PipelineBuffer &&buffer, const PipelineP
     if (nullptr != m_queue_size_accumulator) {
         m_queue_size_accumulator->add_data_point(static_cast<double>(m_queue.size_approx()));
     }
+    mark_enqueue_time(buffer);
     status = m_queue.enqueue(std::move(buffer), m_timeout);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
         auto queue_thread_status = pipeline_status();
@@ -352,6 +389,7 @@ hailo_status PushQueueElement::run_in_thread()
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
     CHECK_EXPECTED_AS_STATUS(buffer);
+    record_wait_time(buffer.value());
 
     // Return if deactivated
     if (PipelineBuffer::Type::DEACTIVATE == buffer->get_type()) {
@@ -383,7 +421,8 @@ hailo_status PushQueueElement::run_in_thread()
 Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPushQueueElement::create(const std::string &name, std::chrono::milliseconds timeout,
     size_t queue_size, size_t frame_size, bool is_empty, bool interacts_with_hw, hailo_pipeline_elem_stats_flags_t flags,
     hailo_vstream_stats_flags_t vstream_stats_flags, EventPtr shutdown_event,
-    std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<AsyncPipeline> async_pipeline, bool is_entry)
+    std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<AsyncPipeline> async_pipeline, bool is_entry,
+    std::shared_ptr<AsyncPipelineExecutor> executor)
 {
     if (is_entry) {
         // Multiplying by 2 to ensure dual-buffering when edge-element is the bottleneck
@@ -405,16 +444,19 @@ Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPushQueueElement::create(c
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
+        queue_size_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("queue_size");
         CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
+    auto wait_time_histogram = BaseQueueElement::create_wait_time_histogram(flags);
+    CHECK_EXPECTED(wait_time_histogram);
+
     auto buffer_pool = BufferPool::create(frame_size, queue_size, shutdown_event, flags, vstream_stats_flags, is_empty, interacts_with_hw);
     CHECK_EXPECTED(buffer_pool);
 
     auto queue_ptr = make_shared_nothrow<AsyncPushQueueElement>(queue.release(), buffer_pool.release(),
-        shutdown_event, name, timeout, duration_collector.release(), std::move(queue_size_accumulator),
-        std::move(pipeline_status), activation_event.release(), deactivation_event.release(), async_pipeline);
+        shutdown_event, name, timeout, duration_collector.release(), std::move(queue_size_accumulator), wait_time_histogram.release(),
+        std::move(pipeline_status), activation_event.release(), deactivation_event.release(), async_pipeline, executor);
     CHECK_AS_EXPECTED(nullptr != queue_ptr, HAILO_OUT_OF_HOST_MEMORY, "Creating PushQueueElement {} failed!", name);
 
     LOGGER__INFO("Created {}", queue_ptr->description());
@@ -429,19 +471,28 @@ Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPushQueueElement::create(c
     auto queue_size = (interacts_with_hw) ? build_params.buffer_pool_size_edges : build_params.buffer_pool_size_internal;
     return AsyncPushQueueElement::create(name, build_params.timeout, queue_size, frame_size, is_empty, interacts_with_hw,
         build_params.elem_stats_flags, build_params.vstream_stats_flags, build_params.shutdown_event, build_params.pipeline_status, async_pipeline,
-        is_entry);
+        is_entry, build_params.executor);
 }
 
 AsyncPushQueueElement::AsyncPushQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event,
-    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,  AccumulatorPtr &&queue_size_accumulator,
+    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,  AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
     std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
-    std::shared_ptr<AsyncPipeline> async_pipeline) :
-    PushQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator),
-        std::move(pipeline_status), std::move(activation_event), std::move(deactivation_event), async_pipeline, false)
+    std::shared_ptr<AsyncPipeline> async_pipeline, std::shared_ptr<AsyncPipelineExecutor> executor) :
+    PushQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator), std::move(wait_time_histogram),
+        std::move(pipeline_status), std::move(activation_event), std::move(deactivation_event), async_pipeline, false),
+    m_executor(executor),
+    m_is_task_scheduled(false),
+    m_task_thread_id()
 {
     start_thread();
 }
 
+AsyncPushQueueElement::~AsyncPushQueueElement()
+{
+    // PushQueueElement dtor calls stop_thread as well, but the virtual call won't reach this class from there.
+    stop_thread();
+}
+
 void AsyncPushQueueElement::run_push_async(PipelineBuffer &&buffer, const PipelinePad &/*sink*/)
 {
     // We do not measure duration for Q elements
@@ -449,15 +500,26 @@ void AsyncPushQueueElement::run_push_async(PipelineBuffer &&buffer, const Pipeli
         m_queue_size_accumulator->add_data_point(static_cast<double>(m_queue.size_approx()));
     }
 
+    mark_enqueue_time(buffer);
     auto status = m_queue.enqueue(std::move(buffer), m_timeout);
     if (HAILO_SUCCESS != status && HAILO_SHUTDOWN_EVENT_SIGNALED != status) {
         handle_non_recoverable_async_error(status);
         stop_thread();
+        return;
+    }
+
+    if ((HAILO_SUCCESS == status) && (nullptr != m_executor)) {
+        schedule_task();
     }
 }
 
 void AsyncPushQueueElement::start_thread()
 {
+    if (nullptr != m_executor) {
+        // The frames are pushed by executor tasks, scheduled when frames are queued.
+        return;
+    }
+
     m_thread = std::thread([this] () {
         OsUtils::set_current_thread_name(thread_name());
         while (m_is_thread_running.load()) {
@@ -483,15 +545,92 @@ hailo_status AsyncPushQueueElement::run_push(PipelineBuffer &&/*buffer*/, const
     return HAILO_INVALID_OPERATION;
 }
 
+void AsyncPushQueueElement::stop_thread()
+{
+    if (nullptr == m_executor) {
+        PushQueueElement::stop_thread();
+        return;
+    }
+
+    m_shutdown_event->signal();
+
+    std::unique_lock<std::mutex> lock(m_task_mutex);
+    m_is_thread_running = false;
+    if (std::this_thread::get_id() == m_task_thread_id) {
+        // Called by the element's own task (e.g. on pipeline shutdown) - it exits once it returns here.
+        return;
+    }
+    m_task_cv.wait(lock, [this]() { return !m_is_task_scheduled; });
+}
+
+void AsyncPushQueueElement::schedule_task()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_task_mutex);
+        if (m_is_task_scheduled || !m_is_thread_running) {
+            return;
+        }
+        m_is_task_scheduled = true;
+    }
+    m_executor->execute([this]() { run_task(); });
+}
+
+void AsyncPushQueueElement::run_task()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_task_mutex);
+        m_task_thread_id = std::this_thread::get_id();
+    }
+
+    for (size_t i = 0; (i < MAX_FRAMES_PER_TASK) && m_is_thread_running; i++) {
+        if (HAILO_SUCCESS != m_pipeline_status->load()) {
+            LOGGER__INFO("Element {} is not running anymore", name());
+            m_is_thread_running = false;
+            break;
+        }
+
+        // Not waiting - the task is scheduled again once a frame is queued
+        auto buffer = m_queue.dequeue(std::chrono::milliseconds(0));
+        if (HAILO_TIMEOUT == buffer.status()) {
+            break;
+        }
+
+        auto status = push_dequeued_buffer(std::move(buffer));
+        if (HAILO_SUCCESS != status) {
+            handle_non_recoverable_async_error(status);
+            m_is_thread_running = false;
+            break;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(m_task_mutex);
+    m_task_thread_id = std::thread::id();
+    // A frame queued while the task was running may have skipped scheduling, hence checking the queue again.
+    if (m_is_thread_running && (m_queue.size_approx() > 0)) {
+        lock.unlock();
+        m_executor->execute([this]() { run_task(); });
+        return;
+    }
+
+    // Once the flag is cleared, stop_thread may return and the element may be destroyed.
+    m_is_task_scheduled = false;
+    m_task_cv.notify_all();
+}
+
 hailo_status AsyncPushQueueElement::run_in_thread()
 {
-    auto buffer = m_queue.dequeue(INIFINITE_TIMEOUT());
+    return push_dequeued_buffer(m_queue.dequeue(INIFINITE_TIMEOUT()));
+}
+
+hailo_status AsyncPushQueueElement::push_dequeued_buffer(Expected<PipelineBuffer> &&buffer)
+{
     auto buffer_status = buffer.status();
     switch (buffer_status) {
     case HAILO_SHUTDOWN_EVENT_SIGNALED:
         break;
 
     case HAILO_SUCCESS:
+        record_wait_time(buffer.value());
         // Return if deactivated
         if (PipelineBuffer::Type::DEACTIVATE == buffer->get_type()) {
             hailo_status status = m_shutdown_event->signal();
@@ -529,6 +668,8 @@ hailo_status AsyncPushQueueElement::execute_deactivate()
              LOGGER__ERROR("enqueue() in element {} failed, got status = {}", name(), status);
              return status;
         }
+    } else if (nullptr != m_executor) {
+        schedule_task();
     }
 
     return HAILO_SUCCESS;
@@ -598,15 +739,18 @@ Expected<std::shared_ptr<PullQueueElement>> PullQueueElement::create(const std::
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
+        queue_size_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("queue_size");
         CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
+    auto wait_time_histogram = BaseQueueElement::create_wait_time_histogram(flags);
+    CHECK_EXPECTED(wait_time_histogram);
+
     auto buffer_pool = BufferPool::create(frame_size, queue_size, shutdown_event, flags, vstream_stats_flags);
     CHECK_EXPECTED(buffer_pool);
 
     auto queue_ptr = make_shared_nothrow<PullQueueElement>(queue.release(), buffer_pool.release(), shutdown_event,
-        name, timeout, duration_collector.release(), std::move(queue_size_accumulator), std::move(pipeline_status),
+        name, timeout, duration_collector.release(), std::move(queue_size_accumulator), wait_time_histogram.release(), std::move(pipeline_status),
         activation_event.release(), deactivation_event.release());
     CHECK_AS_EXPECTED(nullptr != queue_ptr, HAILO_OUT_OF_HOST_MEMORY, "Creating PullQueueElement {} failed!", name);
 
@@ -623,9 +767,9 @@ Expected<std::shared_ptr<PullQueueElement>> PullQueueElement::create(const std::
 }
 
 PullQueueElement::PullQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event,
-    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+    const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
     std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event) :
-    BaseQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator),
+    BaseQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector), std::move(queue_size_accumulator), std::move(wait_time_histogram),
         std::move(pipeline_status), std::move(activation_event), std::move(deactivation_event), PipelineDirection::PULL, nullptr)
 {
     start_thread();
@@ -663,6 +807,7 @@ Expected<PipelineBuffer> PullQueueElement::run_pull(PipelineBuffer &&optional, c
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
     CHECK_EXPECTED(output);
+    record_wait_time(output.value());
 
     return output;
 }
@@ -704,6 +849,7 @@ hailo_status PullQueueElement::run_in_thread()
         m_queue_size_accumulator->add_data_point(static_cast<double>(m_queue.size_approx()));
     }
 
+    mark_enqueue_time(buffer.value());
     hailo_status status = m_queue.enqueue(buffer.release(), INIFINITE_TIMEOUT());
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
         LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
@@ -722,7 +868,7 @@ Expected<std::shared_ptr<UserBufferQueueElement>> UserBufferQueueElement::create
     CHECK_EXPECTED(shutdown_event_exp);
     auto shutdown_event = shutdown_event_exp.release();
 
-    const auto queue_size = 1;
+    const auto queue_size = MAX_PENDING_USER_BUFFERS;
     auto pending_buffer_queue = BaseQueueElement::create_queue(queue_size, shutdown_event);
     CHECK_EXPECTED(pending_buffer_queue);
 
@@ -738,10 +884,13 @@ Expected<std::shared_ptr<UserBufferQueueElement>> UserBufferQueueElement::create
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
+        queue_size_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("queue_size");
         CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
+    // The user buffers are dequeued right after being enqueued, so the wait time isn't measured
+    LatencyHistogramPtr wait_time_histogram = nullptr;
+
     auto is_empty = true; // UserBufferQueue always holds user buffers, therefore its created empty
     auto is_dma_able = false;
     auto buffer_pool = BufferPool::create(frame_size, queue_size, shutdown_event, flags, vstream_stats_flags, is_empty, is_dma_able);
@@ -749,7 +898,7 @@ Expected<std::shared_ptr<UserBufferQueueElement>> UserBufferQueueElement::create
 
     auto queue_ptr = make_shared_nothrow<UserBufferQueueElement>(pending_buffer_queue.release(),
         buffer_pool.release(), shutdown_event, name, timeout, duration_collector.release(),
-        std::move(queue_size_accumulator), std::move(pipeline_status), activation_event.release(),
+        std::move(queue_size_accumulator), std::move(wait_time_histogram), std::move(pipeline_status), activation_event.release(),
         deactivation_event.release());
     CHECK_AS_EXPECTED(nullptr != queue_ptr, HAILO_OUT_OF_HOST_MEMORY, "Creating UserBufferQueueElement {} failed!", name);
 
@@ -767,35 +916,58 @@ Expected<std::shared_ptr<UserBufferQueueElement>> UserBufferQueueElement::create
 
 UserBufferQueueElement::UserBufferQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool,
     EventPtr shutdown_event, const std::string &name, std::chrono::milliseconds timeout,
-    DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+    DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
     Event &&activation_event, Event &&deactivation_event) :
     PullQueueElement(std::move(queue), buffer_pool, shutdown_event, name, timeout, std::move(duration_collector),
-        std::move(queue_size_accumulator), std::move(pipeline_status), std::move(activation_event),
+        std::move(queue_size_accumulator), std::move(wait_time_histogram), std::move(pipeline_status), std::move(activation_event),
         std::move(deactivation_event))
 {}
 
 Expected<PipelineBuffer> UserBufferQueueElement::run_pull(PipelineBuffer &&optional, const PipelinePad &/*source*/)
 {
     CHECK_AS_EXPECTED(optional, HAILO_INVALID_ARGUMENT, "Optional buffer must be valid in {}!", name());
+    auto user_buffer_data = optional.data();
 
-    hailo_status status = m_pool->enqueue_buffer(std::move(optional));
+    auto status = enqueue_user_buffer(std::move(optional));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
-        LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    auto output = m_queue.dequeue(m_timeout);
+    auto output = dequeue_user_buffer(m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == output.status()) {
+        return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
+    }
+    CHECK_EXPECTED(output);
+
+    CHECK_AS_EXPECTED(output->data() == user_buffer_data, HAILO_INTERNAL_FAILURE, "The buffer received in {} was not the same as the user buffer!", name());
+    return output;
+}
+
+hailo_status UserBufferQueueElement::enqueue_user_buffer(PipelineBuffer &&user_buffer)
+{
+    hailo_status status = m_pool->enqueue_buffer(std::move(user_buffer));
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
+        LOGGER__INFO("Shutdown event was signaled in enqueue of queue element {}!", name());
+        return HAILO_SHUTDOWN_EVENT_SIGNALED;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<PipelineBuffer> UserBufferQueueElement::dequeue_user_buffer(std::chrono::milliseconds timeout)
+{
+    auto output = m_queue.dequeue(timeout);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == output.status()) {
         LOGGER__INFO("Shutdown event was signaled in dequeue of queue element {}!", name());
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
 
     CHECK_AS_EXPECTED(HAILO_TIMEOUT != output.status(), HAILO_TIMEOUT, "{} (D2H) failed with status={} (timeout={}ms)",
-        name(), HAILO_TIMEOUT, m_timeout.count());
+        name(), HAILO_TIMEOUT, timeout.count());
     CHECK_EXPECTED(output);
 
-    CHECK_AS_EXPECTED(output->data() == optional.data(), HAILO_INTERNAL_FAILURE, "The buffer received in {} was not the same as the user buffer!", name());
     return output;
 }
 
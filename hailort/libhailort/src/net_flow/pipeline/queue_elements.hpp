@@ -32,10 +32,12 @@ public:
 
 protected:
     static Expected<SpscQueue<PipelineBuffer>> create_queue(size_t queue_size, EventPtr shutdown_event);
+    // Returns nullptr if the latency isn't measured
+    static Expected<LatencyHistogramPtr> create_wait_time_histogram(hailo_pipeline_elem_stats_flags_t flags);
     BaseQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool,
         EventPtr shutdown_event, const std::string &name,
         std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
-        AccumulatorPtr &&queue_size_accumulator, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+        AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
         Event &&activation_event, Event &&deactivation_event,
         PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
 
@@ -54,6 +56,11 @@ protected:
     virtual void stop_thread();
 
     virtual std::vector<AccumulatorPtr> get_queue_size_accumulators() override;
+    virtual LatencyHistogramPtr get_wait_time_histogram() override;
+
+    // Called on enqueue and on dequeue of a buffer, measuring the time the buffer waited in the queue
+    void mark_enqueue_time(PipelineBuffer &buffer);
+    void record_wait_time(const PipelineBuffer &buffer);
 
     virtual hailo_status run_in_thread() = 0;
     virtual std::string thread_name() = 0;
@@ -66,6 +73,7 @@ protected:
     Event m_activation_event;
     Event m_deactivation_event;
     AccumulatorPtr m_queue_size_accumulator;
+    LatencyHistogramPtr m_wait_time_histogram;
     BufferPoolPtr m_pool;
 };
 
@@ -80,7 +88,7 @@ public:
         size_t frame_size, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
     PushQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event, const std::string &name,
-        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
         std::shared_ptr<AsyncPipeline> async_pipeline, bool should_start_thread);
     virtual ~PushQueueElement();
@@ -103,13 +111,15 @@ public:
     static Expected<std::shared_ptr<AsyncPushQueueElement>> create(const std::string &name, std::chrono::milliseconds timeout,
         size_t queue_size, size_t frame_size, bool is_empty, bool interacts_with_hw, hailo_pipeline_elem_stats_flags_t flags,
         hailo_vstream_stats_flags_t vstream_stats_flags, EventPtr shutdown_event,
-        std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<AsyncPipeline> async_pipeline, bool is_entry = false);
+        std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<AsyncPipeline> async_pipeline, bool is_entry = false,
+        std::shared_ptr<AsyncPipelineExecutor> executor = nullptr);
     static Expected<std::shared_ptr<AsyncPushQueueElement>> create(const std::string &name, const ElementBuildParams &build_params,
         size_t frame_size, bool is_empty, bool interacts_with_hw, std::shared_ptr<AsyncPipeline> async_pipeline, bool is_entry = false);
     AsyncPushQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event, const std::string &name,
-        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
-        std::shared_ptr<AsyncPipeline> async_pipeline);
+        std::shared_ptr<AsyncPipeline> async_pipeline, std::shared_ptr<AsyncPipelineExecutor> executor);
+    virtual ~AsyncPushQueueElement();
 
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual void run_push_async(PipelineBuffer &&buffer, const PipelinePad &sink) override;
@@ -120,9 +130,27 @@ protected:
     virtual hailo_status run_in_thread() override;
     virtual std::string thread_name() override { return "ASYNC_PUSH_Q"; };
     virtual void start_thread() override;
+    virtual void stop_thread() override;
     virtual hailo_status execute_terminate(hailo_status error_status);
     virtual hailo_status execute_post_deactivate(bool should_clear_abort) override;
     virtual hailo_status execute_deactivate() override;
+
+private:
+    // Frames pushed by a single executor task, so other elements get to run on the worker in between.
+    static constexpr size_t MAX_FRAMES_PER_TASK = 16;
+
+    hailo_status push_dequeued_buffer(Expected<PipelineBuffer> &&buffer);
+
+    // When running on the executor, at most one task of the element is executed at a time (keeping the order of the
+    // frames). The task pushes the queued frames downstream, and is scheduled again if frames are left in the queue.
+    void schedule_task();
+    void run_task();
+
+    std::shared_ptr<AsyncPipelineExecutor> m_executor;
+    std::mutex m_task_mutex;
+    std::condition_variable m_task_cv;
+    bool m_is_task_scheduled;
+    std::thread::id m_task_thread_id;
 };
 
 class PullQueueElement : public BaseQueueElement
@@ -134,7 +162,7 @@ public:
     static Expected<std::shared_ptr<PullQueueElement>> create(const std::string &name, const hailo_vstream_params_t &vstream_params,
         size_t frame_size, std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
     PullQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool, EventPtr shutdown_event, const std::string &name,
-        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
+        std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event);
     virtual ~PullQueueElement();
 
@@ -152,6 +180,10 @@ protected:
 class UserBufferQueueElement : public PullQueueElement
 {
 public:
+    // Amount of user buffers that may be pending in the element at once (more than one only when frames are read in
+    // batches, see OutputVStream::read_batch).
+    static constexpr size_t MAX_PENDING_USER_BUFFERS = 16;
+
     static Expected<std::shared_ptr<UserBufferQueueElement>> create(const std::string &name, std::chrono::milliseconds timeout,
         hailo_pipeline_elem_stats_flags_t flags, hailo_vstream_stats_flags_t vstream_stats_flags,
         size_t frame_size, std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
@@ -159,12 +191,17 @@ public:
         size_t frame_size, std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
     UserBufferQueueElement(SpscQueue<PipelineBuffer> &&queue, BufferPoolPtr buffer_pool,
         EventPtr shutdown_event, const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
-        AccumulatorPtr &&queue_size_accumulator, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event,
+        AccumulatorPtr &&queue_size_accumulator, LatencyHistogramPtr &&wait_time_histogram, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event,
         Event &&deactivation_event);
 
     virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
     hailo_status set_buffer_pool_buffer_size(uint32_t frame_size);
 
+    // Hands a user buffer to the element (the element thread fills the pending user buffers in order).
+    hailo_status enqueue_user_buffer(PipelineBuffer &&user_buffer);
+    // Returns the oldest pending user buffer once it was filled.
+    Expected<PipelineBuffer> dequeue_user_buffer(std::chrono::milliseconds timeout);
+
 virtual std::vector<AccumulatorPtr> get_queue_size_accumulators() override;
 
 protected:
@@ -328,6 +328,11 @@ hailo_status InputVStream::write(const hailo_pix_buffer_t &buffer)
     return m_vstream->write(std::move(MemoryView(data_ptr, planes_total_size)));
 }
 
+hailo_status InputVStream::write_batch(const std::vector<MemoryView> &buffers)
+{
+    return m_vstream->write_batch(buffers);
+}
+
 hailo_status InputVStream::flush()
 {
     return m_vstream->flush();
@@ -493,6 +498,11 @@ hailo_status OutputVStream::read(MemoryView buffer)
     return m_vstream->read(std::move(buffer));
 }
 
+hailo_status OutputVStream::read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout)
+{
+    return m_vstream->read_batch(buffers, timeout);
+}
+
 hailo_status OutputVStream::clear(std::vector<OutputVStream> &vstreams)
 {
     for (auto &vstream : vstreams) {
@@ -646,6 +656,11 @@ hailo_status OutputVStream::set_nms_max_accumulated_mask_size(uint32_t max_accum
     return m_vstream->set_nms_max_accumulated_mask_size(max_accumulated_mask_size);
 }
 
+hailo_status OutputVStream::set_user_buffer_format(const hailo_format_t &user_buffer_format)
+{
+    return m_vstream->set_user_buffer_format(user_buffer_format);
+}
+
 OutputVStream::OutputVStream(std::shared_ptr<OutputVStreamInternal> vstream) : m_vstream(std::move(vstream)) {}
 
 std::map<std::string, AccumulatorPtr> get_pipeline_accumulators_by_type(
@@ -759,7 +774,7 @@ InputVStreamImpl::~InputVStreamImpl()
     (void)stop_vstream();
 }
 
-hailo_status InputVStreamImpl::write(const MemoryView &buffer)
+hailo_status InputVStreamImpl::check_activated()
 {
     if (nullptr != m_core_op_activated_event) {
         CHECK(m_is_activated, HAILO_VSTREAM_PIPELINE_NOT_ACTIVATED, "Failed to write buffer! Virtual stream {} is not activated!", name());
@@ -768,6 +783,34 @@ hailo_status InputVStreamImpl::write(const MemoryView &buffer)
             "Trying to write to vstream {} before its network group is activated", name());
     }
 
+    return HAILO_SUCCESS;
+}
+
+hailo_status InputVStreamImpl::write(const MemoryView &buffer)
+{
+    auto status = check_activated();
+    CHECK_SUCCESS(status);
+
+    return write_frame(buffer);
+}
+
+hailo_status InputVStreamImpl::write_batch(const std::vector<MemoryView> &buffers)
+{
+    auto status = check_activated();
+    CHECK_SUCCESS(status);
+
+    for (const auto &buffer : buffers) {
+        status = write_frame(buffer);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status InputVStreamImpl::write_frame(const MemoryView &buffer)
+{
     assert(1 == m_entry_element->sinks().size());
     auto status = m_entry_element->sinks()[0].run_push(PipelineBuffer(buffer, [](hailo_status){}, HAILO_SUCCESS, false, BufferPoolWeakPtr(), m_measure_pipeline_latency));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
@@ -849,7 +892,8 @@ Expected<std::shared_ptr<InputVStreamClient>> InputVStreamClient::create(VStream
 
 InputVStreamClient::InputVStreamClient(std::unique_ptr<HailoRtRpcClient> client, VStreamIdentifier &&identifier, hailo_format_t &&user_buffer_format,
     hailo_vstream_info_t &&info) :
-        m_client(std::move(client)), m_identifier(std::move(identifier)), m_user_buffer_format(user_buffer_format), m_info(info) {}
+        m_client(std::move(client)), m_identifier(std::move(identifier)), m_user_buffer_format(user_buffer_format), m_info(info),
+        m_shared_memory(nullptr), m_is_shared_memory_disabled(is_env_variable_on(HAILO_DISABLE_SERVICE_SHARED_MEMORY_ENV_VAR)) {}
 
 InputVStreamClient::~InputVStreamClient()
 {
@@ -859,8 +903,31 @@ InputVStreamClient::~InputVStreamClient()
     }
 }
 
+static SharedMemoryBufferPtr create_vstream_shared_memory(const VStreamIdentifier &identifier, bool is_input, size_t size)
+{
+    const auto name = fmt::format("/hailort_vstream_{}_{}_{}", OsUtils::get_curr_pid(), is_input ? "in" : "out",
+        identifier.m_vstream_handle);
+    auto shared_memory = SharedMemoryBuffer::create_shared(name, size);
+    if (!shared_memory) {
+        LOGGER__WARNING("Failed to create shared memory for vstream (status={}), the frames will be sent inside the rpc messages",
+            shared_memory.status());
+        return nullptr;
+    }
+    return shared_memory.release();
+}
+
 hailo_status InputVStreamClient::write(const MemoryView &buffer)
 {
+    if (!m_is_shared_memory_disabled && (nullptr == m_shared_memory)) {
+        m_shared_memory = create_vstream_shared_memory(m_identifier, true, buffer.size());
+        m_is_shared_memory_disabled = (nullptr == m_shared_memory);
+    }
+
+    if ((nullptr != m_shared_memory) && (buffer.size() <= m_shared_memory->size())) {
+        std::memcpy(m_shared_memory->user_address(), buffer.data(), buffer.size());
+        return m_client->InputVStream_write(m_identifier, *m_shared_memory, buffer.size());
+    }
+
     return m_client->InputVStream_write(m_identifier, buffer);
 }
 
@@ -869,6 +936,18 @@ hailo_status InputVStreamClient::write(const hailo_pix_buffer_t &buffer)
     return m_client->InputVStream_write(m_identifier, buffer);
 }
 
+hailo_status InputVStreamClient::write_batch(const std::vector<MemoryView> &buffers)
+{
+    for (const auto &buffer : buffers) {
+        auto status = write(buffer);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status InputVStreamClient::flush()
 {
     return m_client->InputVStream_flush(m_identifier);
@@ -1003,6 +1082,9 @@ hailo_status InputVStreamClient::after_fork_in_parent()
 
 hailo_status InputVStreamClient::after_fork_in_child()
 {
+    // The shared memory belongs to the parent process (the service identifies it by the parent's pid), the child
+    // creates its own one on its first frame
+    m_shared_memory.reset();
     return create_client();
 }
 
@@ -1112,7 +1194,7 @@ OutputVStreamImpl::~OutputVStreamImpl()
     (void)stop_vstream();
 }
 
-hailo_status OutputVStreamImpl::read(MemoryView buffer)
+hailo_status OutputVStreamImpl::check_activated()
 {
     if (nullptr != m_core_op_activated_event) {
         CHECK(m_is_activated, HAILO_VSTREAM_PIPELINE_NOT_ACTIVATED, "read() failed! Virtual stream {} is not activated!", name());
@@ -1124,6 +1206,91 @@ hailo_status OutputVStreamImpl::read(MemoryView buffer)
         CHECK_SUCCESS(status);
     }
 
+    return HAILO_SUCCESS;
+}
+
+hailo_status OutputVStreamImpl::read(MemoryView buffer)
+{
+    auto status = check_activated();
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    return read_frame(buffer);
+}
+
+hailo_status OutputVStreamImpl::read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout)
+{
+    for (const auto &buffer : buffers) {
+        CHECK(buffer.size() == get_frame_size(), HAILO_INVALID_ARGUMENT,
+            "read_batch() failed! Buffer size ({}) is different than the frame size of vstream {} ({})", buffer.size(), name(),
+            get_frame_size());
+    }
+
+    auto status = check_activated();
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    auto user_buffer_queue = std::dynamic_pointer_cast<UserBufferQueueElement>(m_entry_element);
+    if (nullptr != user_buffer_queue) {
+        return read_batch_to_user_buffer_queue(*user_buffer_queue, buffers, timeout);
+    }
+
+    // The entry element fills a single user buffer at a time, so the frames are read one by one.
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (auto &buffer : buffers) {
+        CHECK((HAILO_INFINITE == timeout.count()) || (std::chrono::steady_clock::now() <= deadline), HAILO_TIMEOUT,
+            "read_batch() of vstream {} failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, timeout.count());
+        status = read_frame(buffer);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status OutputVStreamImpl::read_batch_to_user_buffer_queue(UserBufferQueueElement &user_buffer_queue,
+    std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout)
+{
+    // Keeping up to MAX_PENDING_USER_BUFFERS buffers in the element, so its thread fills the next buffer right after the
+    // previous one (instead of waiting for the next read).
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    size_t enqueued_count = 0;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        while ((enqueued_count < buffers.size()) && ((enqueued_count - i) < UserBufferQueueElement::MAX_PENDING_USER_BUFFERS)) {
+            auto status = user_buffer_queue.enqueue_user_buffer(PipelineBuffer(buffers[enqueued_count], [](hailo_status){},
+                HAILO_SUCCESS, false, BufferPoolWeakPtr(), m_measure_pipeline_latency));
+            if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
+                LOGGER__INFO("Receiving to VStream was shutdown!");
+                return m_pipeline_status->load();
+            }
+            CHECK_SUCCESS(status);
+            enqueued_count++;
+        }
+
+        auto remaining_timeout = timeout;
+        if (HAILO_INFINITE != timeout.count()) {
+            remaining_timeout = std::max(std::chrono::milliseconds(0),
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()));
+        }
+
+        auto recv_buffer = user_buffer_queue.dequeue_user_buffer(remaining_timeout);
+        if (HAILO_SHUTDOWN_EVENT_SIGNALED == recv_buffer.status()) {
+            LOGGER__INFO("Receiving to VStream was shutdown!");
+            return m_pipeline_status->load();
+        }
+        CHECK_EXPECTED_AS_STATUS(recv_buffer);
+        CHECK(recv_buffer->data() == buffers[i].data(), HAILO_INTERNAL_FAILURE,
+            "The buffer received in vstream {} was not the same as the user buffer!", name());
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status OutputVStreamImpl::read_frame(MemoryView buffer)
+{
     assert(1 == m_entry_element->sources().size());
     auto recv_buffer = m_entry_element->sources()[0].run_pull(PipelineBuffer(buffer, [](hailo_status){},  HAILO_SUCCESS, false, BufferPoolWeakPtr(), m_measure_pipeline_latency));
     auto status = recv_buffer.status();
@@ -1214,6 +1381,37 @@ hailo_status OutputVStreamImpl::set_nms_max_accumulated_mask_size(uint32_t max_a
     return HAILO_SUCCESS;
 }
 
+hailo_status OutputVStreamImpl::set_user_buffer_format(const hailo_format_t &user_buffer_format)
+{
+    CHECK((HAILO_FORMAT_TYPE_AUTO != user_buffer_format.type) && (HAILO_FORMAT_ORDER_AUTO != user_buffer_format.order),
+        HAILO_INVALID_ARGUMENT, "User buffer format of {} must not be AUTO", name());
+
+    auto user_buffer_queue_element = std::dynamic_pointer_cast<UserBufferQueueElement>(m_entry_element);
+    CHECK(nullptr != user_buffer_queue_element, HAILO_INVALID_OPERATION, "Unable to set user buffer format in {}", name());
+
+    // The user buffers are filled only while a read is in progress, so no frame is transformed while the format is
+    // changed. Frames waiting upstream are still in the device format, and are transformed to the new format once read.
+    auto status = HAILO_INVALID_OPERATION; // Assuming there is no valid element
+    for (auto &elem : m_pipeline) {
+        auto elem_status = elem->set_user_buffer_format(user_buffer_format);
+        if (HAILO_SUCCESS == elem_status) {
+            status = elem_status;
+        } else if (HAILO_INVALID_OPERATION != elem_status) {
+            return elem_status;
+        }
+    }
+    CHECK_SUCCESS(status, "Unable to set user buffer format in {}", name());
+
+    const auto prev_frame_size = get_frame_size();
+    m_vstream_params.user_buffer_format = user_buffer_format;
+    if (get_frame_size() != prev_frame_size) {
+        status = user_buffer_queue_element->set_buffer_pool_buffer_size(static_cast<uint32_t>(get_frame_size()));
+        CHECK_SUCCESS(status, "Failed to update buffer size in {}", name());
+    }
+
+    return HAILO_SUCCESS;
+}
+
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 Expected<std::shared_ptr<OutputVStreamClient>> OutputVStreamClient::create(const VStreamIdentifier &&identifier)
 {
@@ -1237,7 +1435,8 @@ Expected<std::shared_ptr<OutputVStreamClient>> OutputVStreamClient::create(const
 
 OutputVStreamClient::OutputVStreamClient(std::unique_ptr<HailoRtRpcClient> client, const VStreamIdentifier &&identifier, hailo_format_t &&user_buffer_format,
     hailo_vstream_info_t &&info) :
-        m_client(std::move(client)), m_identifier(std::move(identifier)), m_user_buffer_format(user_buffer_format), m_info(info) {}
+        m_client(std::move(client)), m_identifier(std::move(identifier)), m_user_buffer_format(user_buffer_format), m_info(info),
+        m_shared_memory(nullptr), m_is_shared_memory_disabled(is_env_variable_on(HAILO_DISABLE_SERVICE_SHARED_MEMORY_ENV_VAR)) {}
 
 OutputVStreamClient::~OutputVStreamClient()
 {
@@ -1249,9 +1448,39 @@ OutputVStreamClient::~OutputVStreamClient()
 
 hailo_status OutputVStreamClient::read(MemoryView buffer)
 {
+    if (!m_is_shared_memory_disabled && (nullptr == m_shared_memory)) {
+        m_shared_memory = create_vstream_shared_memory(m_identifier, false, buffer.size());
+        m_is_shared_memory_disabled = (nullptr == m_shared_memory);
+    }
+
+    if ((nullptr != m_shared_memory) && (buffer.size() <= m_shared_memory->size())) {
+        auto status = m_client->OutputVStream_read(m_identifier, *m_shared_memory, buffer.size());
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+        std::memcpy(buffer.data(), m_shared_memory->user_address(), buffer.size());
+        return HAILO_SUCCESS;
+    }
+
     return m_client->OutputVStream_read(m_identifier, buffer);
 }
 
+hailo_status OutputVStreamClient::read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout)
+{
+    // The service reads a single frame per request
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (auto &buffer : buffers) {
+        CHECK((HAILO_INFINITE == timeout.count()) || (std::chrono::steady_clock::now() <= deadline), HAILO_TIMEOUT,
+            "read_batch() of vstream {} failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, timeout.count());
+        auto status = read(buffer);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status OutputVStreamClient::abort()
 {
     auto expected_client = HailoRtRpcClientUtils::create_client();
@@ -1371,6 +1600,9 @@ hailo_status OutputVStreamClient::after_fork_in_parent()
 
 hailo_status OutputVStreamClient::after_fork_in_child()
 {
+    // The shared memory belongs to the parent process (the service identifies it by the parent's pid), the child
+    // creates its own one on its first frame
+    m_shared_memory.reset();
     return create_client();
 }
 
@@ -1430,6 +1662,12 @@ hailo_status OutputVStreamClient::set_nms_max_accumulated_mask_size(uint32_t max
     return HAILO_SUCCESS;
 }
 
+hailo_status OutputVStreamClient::set_user_buffer_format(const hailo_format_t &/*user_buffer_format*/)
+{
+    LOGGER__ERROR("set_user_buffer_format is not supported when using multi-process service");
+    return HAILO_NOT_SUPPORTED;
+}
+
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> VStreamsBuilder::create_vstreams(
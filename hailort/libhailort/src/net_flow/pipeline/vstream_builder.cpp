@@ -268,12 +268,16 @@ Expected<std::vector<OutputVStream>> VStreamsBuilderUtils::create_output_post_pr
     hw_read_queue_element->get()->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_element.value(), hw_read_queue_element.value()));
 
+    // The device's frames are transformed to HAILO_NMS frames, and only the last element fills the user's format order
+    auto nms_vstream_params = vstream_params;
+    nms_vstream_params.user_buffer_format.order = HAILO_FORMAT_ORDER_HAILO_NMS;
     auto post_infer_element = add_post_infer_element(output_stream, pipeline_status, elements,
-        "PostInferEl", vstream_params);
+        "PostInferEl", nms_vstream_params);
     CHECK_EXPECTED(post_infer_element);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_queue_element.value(), post_infer_element.value()));
 
-    auto post_transform_frame_size = HailoRTCommon::get_nms_host_frame_size(output_stream->get_info().nms_info, vstream_params.user_buffer_format);
+    auto post_transform_frame_size = HailoRTCommon::get_nms_host_frame_size(output_stream->get_info().nms_info,
+        nms_vstream_params.user_buffer_format);
     auto pre_nms_convert_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQEl_pre_nms_convert",
         vstream_params, post_transform_frame_size);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_element.value(), pre_nms_convert_queue_element.value()));
@@ -297,7 +301,7 @@ Expected<std::vector<OutputVStream>> VStreamsBuilderUtils::create_output_post_pr
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(remove_overlapping_bboxes_element.value(), pre_fill_nms_format_element_queue_element.value()));
 
     auto fill_nms_format_element = add_fill_nms_format_element(output_stream, elements, "FillNmsFormatEl",
-        iou_op_metadata, build_params);
+        iou_op_metadata, vstream_params.user_buffer_format.order, build_params);
     CHECK_EXPECTED(fill_nms_format_element);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_fill_nms_format_element_queue_element.value(), fill_nms_format_element.value()));
 
@@ -738,12 +742,12 @@ Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> VStreamsBuilderUtils::
 
 Expected<std::shared_ptr<FillNmsFormatElement>> VStreamsBuilderUtils::add_fill_nms_format_element(std::shared_ptr<OutputStreamBase> &output_stream,
         std::vector<std::shared_ptr<PipelineElement>> &elements, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-        const ElementBuildParams &build_params)
+        hailo_format_order_t format_order, const ElementBuildParams &build_params)
 {
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    auto fill_nms_format_element = FillNmsFormatElement::create(metadata->nms_config(),
+    auto fill_nms_format_element = FillNmsFormatElement::create(metadata->nms_config(), format_order,
         PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
         build_params);
     CHECK_EXPECTED(fill_nms_format_element);
@@ -1176,7 +1180,7 @@ hailo_status VStreamsBuilderUtils::add_nms_post_process(OutputStreamPtrVector &o
 
     if (!op_metadata->nms_config().bbox_only) {
         CHECK(HailoRTCommon::is_nms(vstreams_params.user_buffer_format.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -1287,7 +1291,7 @@ Expected<AccumulatorPtr> VStreamsBuilderUtils::create_pipeline_latency_accumulat
     AccumulatorPtr pipeline_latency_accumulator = nullptr;
     const auto measure_latency = ((vstreams_params.vstream_stats_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0);
     if (measure_latency) {
-        pipeline_latency_accumulator = make_shared_nothrow<FullAccumulator<double>>("latency");
+        pipeline_latency_accumulator = make_shared_nothrow<ShardedFullAccumulator<double>>("latency");
         CHECK_AS_EXPECTED(nullptr != pipeline_latency_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
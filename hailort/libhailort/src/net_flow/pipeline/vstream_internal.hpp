@@ -43,6 +43,7 @@
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 #include "service/hailort_rpc_client.hpp"
+#include "common/shared_memory_buffer.hpp"
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 
@@ -121,6 +122,7 @@ public:
 
     virtual hailo_status write(const MemoryView &buffer) = 0;
     virtual hailo_status write(const hailo_pix_buffer_t &buffer) = 0;
+    virtual hailo_status write_batch(const std::vector<MemoryView> &buffers) = 0;
     virtual hailo_status flush() = 0;
     virtual bool is_multi_planar() const = 0;
 
@@ -149,12 +151,14 @@ public:
 
 
     virtual hailo_status read(MemoryView buffer) = 0;
+    virtual hailo_status read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout) = 0;
     virtual std::string get_pipeline_description() const override;
 
     virtual hailo_status set_nms_score_threshold(float32_t threshold) = 0;
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) = 0;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) = 0;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) = 0;
+    virtual hailo_status set_user_buffer_format(const hailo_format_t &user_buffer_format) = 0;
 
 protected:
     OutputVStreamInternal(const hailo_vstream_info_t &vstream_info, const std::vector<hailo_quant_info_t> &quant_infos, const hailo_vstream_params_t &vstream_params,
@@ -180,6 +184,7 @@ public:
 
     virtual hailo_status write(const MemoryView &buffer) override;
     virtual hailo_status write(const hailo_pix_buffer_t &buffer) override;
+    virtual hailo_status write_batch(const std::vector<MemoryView> &buffers) override;
     virtual hailo_status flush() override;
     virtual bool is_multi_planar() const override;
 
@@ -189,6 +194,9 @@ private:
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, AccumulatorPtr pipeline_latency_accumulator,
         EventPtr core_op_activated_event, hailo_status &output_status);
 
+    hailo_status check_activated();
+    hailo_status write_frame(const MemoryView &buffer);
+
     bool m_is_multi_planar;
 };
 
@@ -207,20 +215,31 @@ public:
     virtual ~OutputVStreamImpl();
 
     virtual hailo_status read(MemoryView buffer) override;
+    virtual hailo_status read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout) override;
 
     virtual hailo_status set_nms_score_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status set_user_buffer_format(const hailo_format_t &user_buffer_format) override;
 
 private:
     OutputVStreamImpl(const hailo_vstream_info_t &vstream_info, const std::vector<hailo_quant_info_t> &quant_infos, const hailo_vstream_params_t &vstream_params,
         std::shared_ptr<PipelineElement> pipeline_entry, std::vector<std::shared_ptr<PipelineElement>> &&pipeline,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, AccumulatorPtr pipeline_latency_accumulator,
         EventPtr core_op_activated_event, hailo_status &output_status);
+
+    hailo_status check_activated();
+    hailo_status read_frame(MemoryView buffer);
+    hailo_status read_batch_to_user_buffer_queue(UserBufferQueueElement &user_buffer_queue, std::vector<MemoryView> &buffers,
+        std::chrono::milliseconds timeout);
 };
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
+// Disables passing the frames of multi-process vstreams through shared memory (the frames are sent inside the rpc
+// messages instead)
+#define HAILO_DISABLE_SERVICE_SHARED_MEMORY_ENV_VAR ("HAILO_DISABLE_SERVICE_SHARED_MEMORY")
+
 class InputVStreamClient : public InputVStreamInternal
 {
 public:
@@ -233,6 +252,7 @@ public:
 
     virtual hailo_status write(const MemoryView &buffer) override;
     virtual hailo_status write(const hailo_pix_buffer_t &buffer) override;
+    virtual hailo_status write_batch(const std::vector<MemoryView> &buffers) override;
     virtual hailo_status flush() override;
     virtual bool is_multi_planar() const override;
 
@@ -264,6 +284,10 @@ private:
     VStreamIdentifier m_identifier;
     hailo_format_t m_user_buffer_format;
     hailo_vstream_info_t m_info;
+    // The frames are passed to the service through this shared memory (created on the first frame). nullptr if it
+    // can't be used, in which case the frames are sent inside the rpc messages.
+    SharedMemoryBufferPtr m_shared_memory;
+    bool m_is_shared_memory_disabled;
 };
 
 class OutputVStreamClient : public OutputVStreamInternal
@@ -277,6 +301,7 @@ public:
     virtual ~OutputVStreamClient();
 
     virtual hailo_status read(MemoryView buffer);
+    virtual hailo_status read_batch(std::vector<MemoryView> &buffers, std::chrono::milliseconds timeout) override;
 
     virtual hailo_status abort() override;
     virtual hailo_status resume() override;
@@ -301,6 +326,7 @@ public:
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status set_user_buffer_format(const hailo_format_t &user_buffer_format) override;
 
 private:
     OutputVStreamClient(std::unique_ptr<HailoRtRpcClient> client, const VStreamIdentifier &&identifier, hailo_format_t &&user_buffer_format,
@@ -312,6 +338,10 @@ private:
     VStreamIdentifier m_identifier;
     hailo_format_t m_user_buffer_format;
     hailo_vstream_info_t m_info;
+    // The frames are passed to the service through this shared memory (created on the first frame). nullptr if it
+    // can't be used, in which case the frames are sent inside the rpc messages.
+    SharedMemoryBufferPtr m_shared_memory;
+    bool m_is_shared_memory_disabled;
 };
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
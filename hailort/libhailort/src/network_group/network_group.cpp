@@ -128,6 +128,12 @@ Expected<std::shared_ptr<ConfiguredNetworkGroup>> ConfiguredNetworkGroup::duplic
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 }
 
+Expected<ConfigureStagesDurations> ConfiguredNetworkGroup::get_configure_stages_durations() const
+{
+    LOGGER__ERROR("`get_configure_stages_durations()` is not supported when working with HailoRT Service!");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 Expected<uint32_t> ConfiguredNetworkGroup::get_client_handle() const
 {
     LOGGER__ERROR("`get_client_handle()` is valid only when working with HailoRT Service!");
@@ -341,6 +347,35 @@ Expected<std::shared_ptr<net_flow::NmsOpMetadata>> ConfiguredNetworkGroupBase::g
     return nms_metadata;
 }
 
+hailo_status ConfiguredNetworkGroupBase::add_post_process_op(net_flow::PostProcessOpMetadataPtr op_metadata)
+{
+    CHECK(1 == op_metadata->outputs_metadata().size(), HAILO_INVALID_ARGUMENT, "Op {} must have a single output",
+        op_metadata->get_name());
+    const auto &output_name = op_metadata->outputs_metadata().begin()->first;
+
+    auto &sorted_output_names = m_network_group_metadata.m_sorted_output_names;
+    CHECK(!contains(sorted_output_names, output_name), HAILO_INVALID_ARGUMENT,
+        "The output {} of op {} is already an output of the network group", output_name, op_metadata->get_name());
+
+    auto output_position = sorted_output_names.end();
+    for (const auto &input_name : op_metadata->get_input_names()) {
+        for (auto &existing_op : m_network_group_metadata.m_ops_metadata) {
+            CHECK(!contains(existing_op->get_input_names(), input_name), HAILO_INVALID_ARGUMENT,
+                "The input {} of op {} is already an input of op {}", input_name, op_metadata->get_name(),
+                existing_op->get_name());
+        }
+        const auto input_position = std::find(sorted_output_names.begin(), sorted_output_names.end(), input_name);
+        CHECK(sorted_output_names.end() != input_position, HAILO_NOT_FOUND,
+            "The input {} of op {} isn't an output of the network group", input_name, op_metadata->get_name());
+        output_position = std::min(output_position, input_position);
+    }
+
+    sorted_output_names.insert(output_position, output_name);
+    m_network_group_metadata.m_ops_metadata.push_back(op_metadata);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status ConfiguredNetworkGroupBase::set_nms_score_threshold(const std::string &edge_name, float32_t nms_score_threshold)
 {
     auto expected_nms_op_metadata = get_nms_meta_data(edge_name);
@@ -378,6 +413,29 @@ hailo_status ConfiguredNetworkGroupBase::set_nms_max_accumulated_mask_size(const
     return HAILO_SUCCESS;
 }
 
+hailo_status ConfiguredNetworkGroupBase::set_nms_max_bboxes_total(const std::string &edge_name, uint32_t max_bboxes_total)
+{
+    TRY(auto nms_op_metadata, get_nms_meta_data(edge_name));
+    CHECK(max_bboxes_total <= UINT16_MAX, HAILO_INVALID_ARGUMENT,
+        "Failed to `set_nms_max_bboxes_total` for `{}`. Max bboxes total must be at most {}", edge_name, UINT16_MAX);
+    nms_op_metadata->nms_config().max_proposals_total = max_bboxes_total;
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConfiguredNetworkGroupBase::set_nms_classes_filter(const std::string &edge_name, const std::vector<uint32_t> &classes)
+{
+    TRY(auto nms_op_metadata, get_nms_meta_data(edge_name));
+    auto &nms_config = nms_op_metadata->nms_config();
+    const auto classes_count = nms_config.background_removal ? (nms_config.number_of_classes - 1) : nms_config.number_of_classes;
+    for (const auto class_index : classes) {
+        CHECK(class_index < classes_count, HAILO_INVALID_ARGUMENT,
+            "Failed to `set_nms_classes_filter` for `{}`. Class {} is out of range (the output has {} classes)",
+            edge_name, class_index, classes_count);
+    }
+    nms_config.classes_filter = classes;
+    return HAILO_SUCCESS;
+}
+
 ConfiguredNetworkGroupBase::ConfiguredNetworkGroupBase(
     const ConfigureNetworkParams &config_params, std::vector<std::shared_ptr<CoreOp>> &&core_ops,
     NetworkGroupMetadata &&metadata) :
@@ -652,6 +710,18 @@ AccumulatorPtr ConfiguredNetworkGroupBase::get_deactivation_time_accumulator() c
     return get_core_op()->get_deactivation_time_accumulator();
 }
 
+Expected<ConfigureStagesDurations> ConfiguredNetworkGroupBase::get_configure_stages_durations() const
+{
+    ConfigureStagesDurations durations{};
+    for (const auto &core_op : m_core_ops) {
+        TRY(const auto core_op_durations, core_op->get_configure_stages_durations());
+        durations.buffers_allocation += core_op_durations.buffers_allocation;
+        durations.resources_building += core_op_durations.resources_building;
+        durations.firmware_upload += core_op_durations.firmware_upload;
+    }
+    return durations;
+}
+
 static hailo_vstream_params_t expand_vstream_params_autos(const hailo_stream_info_t &stream_info,
     const hailo_vstream_params_t &vstream_params)
 {
@@ -808,16 +878,38 @@ Expected<size_t> ConfiguredNetworkGroupBase::get_min_buffer_pool_size()
 hailo_status ConfiguredNetworkGroupBase::infer_async(const NamedBuffersCallbacks &named_buffers_callbacks,
     const std::function<void(hailo_status)> &infer_request_done_cb)
 {
+    return infer_async(named_buffers_callbacks, infer_request_done_cb, nullptr);
+}
+
+hailo_status ConfiguredNetworkGroupBase::infer_async(const NamedBuffersCallbacks &named_buffers_callbacks,
+    const std::function<void(hailo_status)> &infer_request_done_cb, InferRequestControlPtr control)
+{
+    auto core_op = get_core_op();
+    CHECK(named_buffers_callbacks.size() == core_op->get_streams_count(), HAILO_INVALID_ARGUMENT,
+        "infer_async expects a buffer for each of the {} streams, got {} buffers", core_op->get_streams_count(),
+        named_buffers_callbacks.size());
+
     InferRequest infer_request{};
+    infer_request.control = control;
+    infer_request.transfers.resize(named_buffers_callbacks.size());
     for (auto &named_buffer_callback : named_buffers_callbacks) {
         const auto &name = named_buffer_callback.first;
         const auto &callback = named_buffer_callback.second.second;
+        TRY(const auto stream_index, core_op->get_stream_index(name));
+        auto &transfer = infer_request.transfers[stream_index];
+        CHECK(transfer.transfer_buffers.empty(), HAILO_INVALID_ARGUMENT, "infer_async got more than one buffer for {}", name);
         if (BufferType::VIEW == named_buffer_callback.second.first.buffer_type) {
             const auto &buffer = named_buffer_callback.second.first.view;
-            infer_request.transfers.emplace(name, TransferRequest{buffer, callback});
+            transfer = TransferRequest{buffer, callback};
+            transfer.control = control;
         } else if (BufferType::DMA_BUFFER == named_buffer_callback.second.first.buffer_type) {
-            const auto &dma_buffer = named_buffer_callback.second.first.dma_buffer;
-            infer_request.transfers.emplace(name, TransferRequest{dma_buffer, callback});
+            const auto &buffer_representation = named_buffer_callback.second.first;
+            const auto &dma_buffer = buffer_representation.dma_buffer;
+            const auto transfer_size = (0 == buffer_representation.dma_buffer_transfer_size) ? dma_buffer.size :
+                buffer_representation.dma_buffer_transfer_size;
+            transfer = TransferRequest{
+                TransferBuffer(dma_buffer, transfer_size, buffer_representation.dma_buffer_offset), callback};
+            transfer.control = control;
         } else {
             LOGGER__ERROR("infer_async does not support buffers with type {}", named_buffer_callback.second.first.buffer_type);
             return HAILO_INVALID_ARGUMENT;
@@ -837,7 +929,7 @@ hailo_status ConfiguredNetworkGroupBase::infer_async(const NamedBuffersCallbacks
 
     increase_ongoing_callbacks(); // Increase before lunch, as the cb may be called before we got the chance to increase the counter
     std::unique_lock<std::mutex> lock(m_mutex);
-    auto status = get_core_op()->infer_async(std::move(infer_request));
+    auto status = core_op->infer_async(std::move(infer_request));
     if (status != HAILO_SUCCESS) {
         // If we got error in `infer_async()`, then the callbacks will not be called.
         decrease_ongoing_callbacks();
@@ -889,4 +981,26 @@ hailo_status ConfiguredNetworkGroupBase::update_cache_offset(int32_t offset_delt
     return m_core_ops[0]->update_cache_offset(offset_delta_bytes);
 }
 
+Expected<CacheSnapshot> ConfiguredNetworkGroupBase::snapshot_caches()
+{
+    CHECK(m_core_ops.size() == 1, HAILO_INVALID_OPERATION,
+        "snapshot_caches() is not supported for multi core-op network groups");
+
+    TRY(auto cache_info, m_core_ops[0]->get_cache_info());
+    TRY(auto cache_buffers, m_core_ops[0]->get_cache_buffers());
+    return CacheSnapshot{cache_info, std::move(cache_buffers)};
+}
+
+hailo_status ConfiguredNetworkGroupBase::restore_caches(const CacheSnapshot &snapshot)
+{
+    CHECK(m_core_ops.size() == 1, HAILO_INVALID_OPERATION,
+        "restore_caches() is not supported for multi core-op network groups");
+
+    auto status = m_core_ops[0]->write_cache_buffers(snapshot.cache_buffers);
+    CHECK_SUCCESS(status);
+
+    // Reprograms the caches to the snapshot's offsets
+    return m_core_ops[0]->init_cache(snapshot.cache_info.current_read_offset, snapshot.cache_info.write_offset_delta);
+}
+
 } /* namespace hailort */
@@ -51,6 +51,14 @@ using op_name_t = std::string;
 #define HAILORT_AUTO_UPDATE_CACHE_OFFSET_ENV_VAR "HAILORT_AUTO_UPDATE_CACHE_OFFSET"
 #define HAILORT_AUTO_UPDATE_CACHE_OFFSET_ENV_VAR_DEFAULT "default"
 #define HAILORT_AUTO_UPDATE_CACHE_OFFSET_ENV_VAR_DISABLED "disabled"
+// If set to "1", update_cache_offset only accumulates the offset delta, and the accumulated delta is applied (with a
+// single signal to the fw) right before the next infer request of the core-op is launched
+#define HAILORT_DEFER_CACHE_OFFSET_UPDATES_ENV_VAR "HAILORT_DEFER_CACHE_OFFSET_UPDATES"
+// If set to "1", manually deactivating a core-op (of a device that isn't scheduled) stops only its host resources.
+// The core-op is left enabled on the fw until the next activation on the device, which then switches to the next
+// core-op with a single fw control (as the scheduler does), instead of resetting the state machine and enabling it.
+// Not applied on integrated devices, which reset the nn-core on every switch anyway.
+#define HAILORT_FAST_MANUAL_SWITCH_ENV_VAR "HAILORT_FAST_MANUAL_SWITCH"
 
 class ConfiguredNetworkGroupBase : public ConfiguredNetworkGroup
 {
@@ -107,6 +115,7 @@ public:
     virtual Expected<std::vector<hailo_vstream_info_t>> get_all_vstream_infos(const std::string &network_name="") const override;
     virtual AccumulatorPtr get_activation_time_accumulator() const override;
     virtual AccumulatorPtr get_deactivation_time_accumulator() const override;
+    virtual Expected<ConfigureStagesDurations> get_configure_stages_durations() const override;
 
     virtual bool is_multi_context() const override;
     virtual const ConfigureNetworkParams get_config_params() const override;
@@ -180,6 +189,54 @@ public:
         return get_core_op()->set_scheduler_priority(priority, network_name);
     }
 
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_deadline(deadline, network_name);
+    }
+
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_share(share, network_name);
+    }
+
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_device_affinity(device_mask, network_name);
+    }
+
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_sticky_placement(is_sticky, network_name);
+    }
+
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_pinned_device(device_index, network_name);
+    }
+
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_burst_size_bounds(min_burst_size, max_burst_size, network_name);
+    }
+
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_batch_size(batch_size, network_name);
+    }
+
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) override
+    {
+        return get_core_op()->set_scheduler_overload_policy(policy, max_pending_frames, network_name);
+    }
+
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) override
+    {
+        return get_core_op()->get_scheduler_overload_stats(network_name);
+    }
+
     std::vector<std::shared_ptr<CoreOp>> &get_core_ops()
     {
         return m_core_ops;
@@ -192,6 +249,9 @@ public:
 
     virtual hailo_status infer_async(const NamedBuffersCallbacks &named_buffers_callbacks,
         const std::function<void(hailo_status)> &infer_request_done_cb) override;
+    // The infer request (and all of its transfers) is sent with the given control (see InferRequestControl)
+    hailo_status infer_async(const NamedBuffersCallbacks &named_buffers_callbacks,
+        const std::function<void(hailo_status)> &infer_request_done_cb, InferRequestControlPtr control);
 
     virtual Expected<std::unique_ptr<LayerInfo>> get_layer_info(const std::string &stream_name) override;
     virtual Expected<std::vector<net_flow::PostProcessOpMetadataPtr>> get_ops_metadata() override;
@@ -201,12 +261,21 @@ public:
     virtual hailo_status set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold) override;
     virtual hailo_status set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(const std::string &edge_name, uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status set_nms_max_bboxes_total(const std::string &edge_name, uint32_t max_bboxes_total) override;
+    virtual hailo_status set_nms_classes_filter(const std::string &edge_name, const std::vector<uint32_t> &classes) override;
 
     Expected<std::shared_ptr<net_flow::NmsOpMetadata>> get_nms_meta_data(const std::string &edge_name);
 
+    // Adds a post-process op that isn't part of the HEF (e.g. a custom op added to an InferModel) over some of the
+    // network group's outputs. The op's inputs are no longer outputs of the network group, and the op's output is
+    // ordered in place of the first input.
+    hailo_status add_post_process_op(net_flow::PostProcessOpMetadataPtr op_metadata);
+
     virtual hailo_status init_cache(uint32_t read_offset, int32_t write_offset_delta) override;
     virtual Expected<hailo_cache_info_t> get_cache_info() const override;
     virtual hailo_status update_cache_offset(int32_t offset_delta_bytes) override;
+    virtual Expected<CacheSnapshot> snapshot_caches() override;
+    virtual hailo_status restore_caches(const CacheSnapshot &snapshot) override;
 
 private:
     ConfiguredNetworkGroupBase(const ConfigureNetworkParams &config_params,
@@ -288,6 +357,18 @@ public:
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout, const std::string &network_name) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold, const std::string &network_name) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) override;
 
     virtual AccumulatorPtr get_activation_time_accumulator() const override;
     virtual AccumulatorPtr get_deactivation_time_accumulator() const override;
@@ -337,10 +418,14 @@ public:
     virtual hailo_status set_nms_iou_threshold(const std::string &edge_name, float32_t iou_threshold) override;
     virtual hailo_status set_nms_max_bboxes_per_class(const std::string &edge_name, uint32_t max_bboxes_per_class) override;
     virtual hailo_status set_nms_max_accumulated_mask_size(const std::string &edge_name, uint32_t max_accumulated_mask_size) override;
+    virtual hailo_status set_nms_max_bboxes_total(const std::string &edge_name, uint32_t max_bboxes_total) override;
+    virtual hailo_status set_nms_classes_filter(const std::string &edge_name, const std::vector<uint32_t> &classes) override;
 
     virtual hailo_status init_cache(uint32_t read_offset, int32_t write_offset_delta) override;
     virtual Expected<hailo_cache_info_t> get_cache_info() const override;
     virtual hailo_status update_cache_offset(int32_t offset_delta_bytes) override;
+    virtual Expected<CacheSnapshot> snapshot_caches() override;
+    virtual hailo_status restore_caches(const CacheSnapshot &snapshot) override;
 
 private:
     ConfiguredNetworkGroupClient(NetworkGroupIdentifier &&identifier, const std::string &network_group_name);
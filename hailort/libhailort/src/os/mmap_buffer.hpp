@@ -18,13 +18,21 @@
 #include "common/utils.hpp"
 #include "os/file_descriptor.hpp"
 
+#include <string>
+
 namespace hailort
 {
 
 class MmapBufferImpl final {
 public:
     static Expected<MmapBufferImpl> create_shared_memory(size_t length);
+    // Same as create_shared_memory, but the memory is backed by huge pages (if available). The mapped length is
+    // rounded up to the huge page size.
+    static Expected<MmapBufferImpl> create_shared_memory_huge_pages(size_t length);
     static Expected<MmapBufferImpl> create_file_map(size_t length, FileDescriptor &file, uintptr_t offset);
+    // Maps the whole file (opened by path) as read-only, private memory. The pages are read from the file only when
+    // accessed, and are backed by the file (so the kernel can drop them under memory pressure).
+    static Expected<MmapBufferImpl> create_file_map_read_only(const std::string &file_path);
 
 #if defined(__QNX__)
     static Expected<MmapBufferImpl> create_file_map_nocache(size_t length, FileDescriptor &file, uintptr_t offset);
@@ -88,6 +96,13 @@ public:
         return MmapBuffer<T>(std::move(mmap.release()));
     }
 
+    static Expected<MmapBuffer<T>> create_shared_memory_huge_pages(size_t length)
+    {
+        auto mmap = MmapBufferImpl::create_shared_memory_huge_pages(length);
+        CHECK_EXPECTED(mmap);
+        return MmapBuffer<T>(std::move(mmap.release()));
+    }
+
     static Expected<MmapBuffer<T>> create_file_map(size_t length, FileDescriptor &file, uintptr_t offset)
     {
         auto mmap = MmapBufferImpl::create_file_map(length, file, offset);
@@ -95,6 +110,13 @@ public:
         return MmapBuffer<T>(std::move(mmap.release()));
     }
 
+    static Expected<MmapBuffer<T>> create_file_map_read_only(const std::string &file_path)
+    {
+        auto mmap = MmapBufferImpl::create_file_map_read_only(file_path);
+        CHECK_EXPECTED(mmap);
+        return MmapBuffer<T>(mmap.release());
+    }
+
 #if defined(__QNX__)
     static Expected<MmapBuffer<T>> create_file_map_nocache(size_t length, FileDescriptor &file, uintptr_t offset)
     {
@@ -8,17 +8,142 @@
  **/
 #include <sys/mman.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <linux/dma-buf.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <list>
+#include <mutex>
 
 
 #include "hailo/hailort.h"
 #include "hailo/event.hpp"
 #include "common/utils.hpp"
+#include "hailo/hailort_dma-heap.h"
 #include "utils/dma_buffer_utils.hpp"
 
 namespace hailort
 {
 
+#define HAILO_DMABUF_MMAP_CACHE_SIZE_ENV_VAR ("HAILO_DMABUF_MMAP_CACHE_SIZE")
+static const size_t DEFAULT_DMABUF_MMAP_CACHE_SIZE = 32;
+#define CMA_DMA_HEAP_PATH ("/dev/dma_heap/linux,cma")
+
+// Keeps the mmaps of the recently used dmabufs, so buffers that are reused on each frame (e.g. v4l2 or gpu buffers)
+// are not mmapped and munmapped on each access. Since fds can be reused after the dmabuf is closed, the mappings are
+// validated using the dmabuf inode.
+// Note: A cached mapping keeps a reference to the dmabuf, hence the memory is freed only when the mapping is evicted.
+class DmaBufMmapCache final
+{
+public:
+    static DmaBufMmapCache &get_instance()
+    {
+        static DmaBufMmapCache instance;
+        return instance;
+    }
+
+    ~DmaBufMmapCache()
+    {
+        for (const auto &entry : m_entries) {
+            munmap(entry.address, entry.size);
+        }
+    }
+
+    Expected<void*> acquire(hailo_dma_buffer_t dma_buffer, int prot)
+    {
+        if (0 == m_max_entries) {
+            return mmap_dma_buffer(dma_buffer, prot);
+        }
+
+        struct stat dma_buffer_stat{};
+        CHECK_AS_EXPECTED(0 == fstat(dma_buffer.fd, &dma_buffer_stat), HAILO_INVALID_ARGUMENT,
+            "Failed to fstat dma buffer fd {}, errno {}", dma_buffer.fd, errno);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if ((it->fd == dma_buffer.fd) && (it->inode == dma_buffer_stat.st_ino) && (it->size == dma_buffer.size) &&
+                (it->prot == prot)) {
+                it->users_count++;
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                return Expected<void*>(it->address);
+            }
+
+            if ((it->fd == dma_buffer.fd) && (it->inode != dma_buffer_stat.st_ino) && (0 == it->users_count)) {
+                // The fd was closed and reused for another dmabuf.
+                munmap(it->address, it->size);
+                it = m_entries.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        TRY(auto address, mmap_dma_buffer(dma_buffer, prot));
+        m_entries.emplace_front(Entry{dma_buffer.fd, dma_buffer_stat.st_ino, dma_buffer.size, prot, address, 1});
+        evict_unused_entries();
+        return address;
+    }
+
+    // Returns false if the address isn't cached (so the caller should munmap it).
+    bool release(void *address)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto &entry : m_entries) {
+            if (entry.address == address) {
+                assert(entry.users_count > 0);
+                entry.users_count--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Entry {
+        int fd;
+        ino_t inode;
+        size_t size;
+        int prot;
+        void *address;
+        size_t users_count;
+    };
+
+    DmaBufMmapCache() :
+        m_max_entries(DEFAULT_DMABUF_MMAP_CACHE_SIZE)
+    {
+        auto cache_size_env_var = get_env_variable(HAILO_DMABUF_MMAP_CACHE_SIZE_ENV_VAR);
+        if (cache_size_env_var) {
+            m_max_entries = std::stoul(cache_size_env_var.value());
+        }
+    }
+
+    static Expected<void*> mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, int prot)
+    {
+        void* dma_buf_ptr = mmap(NULL, dma_buffer.size, prot, MAP_SHARED, dma_buffer.fd, 0);
+        CHECK_AS_EXPECTED(MAP_FAILED != dma_buf_ptr, HAILO_INTERNAL_FAILURE, "Failed to run mmap on DMA buffer");
+        return dma_buf_ptr;
+    }
+
+    // Assumes that m_mutex is locked!
+    void evict_unused_entries()
+    {
+        // Least recently used entries are at the back. Entries in use are kept even if the cache is full.
+        auto it = m_entries.end();
+        while ((m_entries.size() > m_max_entries) && (it != m_entries.begin())) {
+            it--;
+            if (0 == it->users_count) {
+                munmap(it->address, it->size);
+                it = m_entries.erase(it);
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    // Most recently used entry is at the front.
+    std::list<Entry> m_entries;
+    size_t m_max_entries;
+};
+
 Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection)
 {
     int prot = 0;
@@ -33,13 +158,17 @@ Expected<MemoryView> DmaBufferUtils::mmap_dma_buffer(hailo_dma_buffer_t dma_buff
         return make_unexpected(HAILO_INVALID_ARGUMENT);
     }
 
-    void* dma_buf_ptr = mmap(NULL, dma_buffer.size, prot, MAP_SHARED, dma_buffer.fd, 0);
-    CHECK_AS_EXPECTED(MAP_FAILED != dma_buf_ptr, HAILO_INTERNAL_FAILURE, "Failed to run mmap on DMA buffer");
+    TRY(auto dma_buf_ptr, DmaBufMmapCache::get_instance().acquire(dma_buffer, prot));
 
     struct dma_buf_sync sync = {
         .flags = dma_buf_sync_flags,
     };
     auto err = ioctl(dma_buffer.fd, DMA_BUF_IOCTL_SYNC, &sync);
+    if (0 != err) {
+        if (!DmaBufMmapCache::get_instance().release(dma_buf_ptr)) {
+            munmap(dma_buf_ptr, dma_buffer.size);
+        }
+    }
     CHECK_AS_EXPECTED(0 == err, HAILO_INTERNAL_FAILURE, "Failed to run DMA_BUF_IOCTL_SYNC on FD, size: {}, fd: {}, address: {}, errno {}", dma_buffer.size,
         dma_buffer.fd, static_cast<void*>(dma_buf_ptr), err);
 
@@ -64,6 +193,11 @@ hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, Me
     auto err = ioctl(dma_buffer.fd, DMA_BUF_IOCTL_SYNC, &sync);
     CHECK(0 == err, HAILO_INTERNAL_FAILURE, "Failed to run DMA_BUF_IOCTL_SYNC ioctl, errno {}", err);
 
+    if (DmaBufMmapCache::get_instance().release(dma_buffer_memview.data())) {
+        // The mapping is kept in the cache
+        return HAILO_SUCCESS;
+    }
+
     err = munmap(static_cast<void*>(dma_buffer_memview.data()), dma_buffer.size);
     CHECK(0 == err, HAILO_INTERNAL_FAILURE, "Failed to munmap dma buffer, size: {}, fd: {}, address: {}, errno {}", dma_buffer.size, dma_buffer.fd,
         static_cast<void*>(dma_buffer_memview.data()), err);
@@ -71,4 +205,39 @@ hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, Me
     return HAILO_SUCCESS;
 }
 
+// The heap is opened once, and kept open for the lifetime of the process
+static Expected<int> get_cma_dma_heap_fd()
+{
+    static std::mutex mutex;
+    static int heap_fd = -1;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (-1 == heap_fd) {
+        heap_fd = open(CMA_DMA_HEAP_PATH, O_RDWR | O_CLOEXEC);
+        CHECK_AS_EXPECTED(-1 != heap_fd, HAILO_NOT_AVAILABLE, "Failed to open {}, errno {}", CMA_DMA_HEAP_PATH, errno);
+    }
+    return Expected<int>(heap_fd);
+}
+
+Expected<hailo_dma_buffer_t> DmaBufferUtils::allocate_dma_heap_buffer(size_t size)
+{
+    TRY(const auto heap_fd, get_cma_dma_heap_fd());
+
+    struct dma_heap_allocation_data heap_data = {};
+    heap_data.len = size;
+    heap_data.fd_flags = O_RDWR | O_CLOEXEC;
+    auto err = ioctl(heap_fd, DMA_HEAP_IOCTL_ALLOC, &heap_data);
+    CHECK_AS_EXPECTED(0 == err, HAILO_OUT_OF_HOST_CMA_MEMORY, "Failed to allocate {} bytes from {}, errno {}", size,
+        CMA_DMA_HEAP_PATH, errno);
+
+    return hailo_dma_buffer_t{static_cast<int>(heap_data.fd), size};
+}
+
+hailo_status DmaBufferUtils::free_dma_heap_buffer(hailo_dma_buffer_t dma_buffer)
+{
+    CHECK(0 == close(dma_buffer.fd), HAILO_CLOSE_FAILURE, "Failed to close dma buffer fd {}, errno {}", dma_buffer.fd,
+        errno);
+    return HAILO_SUCCESS;
+}
+
 } /* namespace hailort */
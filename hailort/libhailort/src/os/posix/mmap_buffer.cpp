@@ -8,11 +8,14 @@
  **/
 
 #include "os/mmap_buffer.hpp"
+#include "hailo/hailort_common.hpp"
 #include "vdma/driver/hailort_driver.hpp"
 #include "hailo_ioctl_common.h"
 #include <sys/ioctl.h>
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <errno.h>
 
 #if defined(__linux__)
@@ -42,6 +45,35 @@ Expected<MmapBufferImpl> MmapBufferImpl::create_shared_memory(size_t length)
     return MmapBufferImpl(address, length);
 }
 
+Expected<MmapBufferImpl> MmapBufferImpl::create_shared_memory_huge_pages(size_t length)
+{
+#if defined(__linux__) && defined(MAP_HUGETLB) && defined(MAP_HUGE_2MB)
+    static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    const auto aligned_length = HailoRTCommon::align_to(length, HUGE_PAGE_SIZE);
+
+    // First try the hugetlbfs pool (available only if huge pages were reserved, i.e. vm.nr_hugepages > 0).
+    void *address = mmap(nullptr, aligned_length, PROT_WRITE | PROT_READ,
+        MAP_ANONYMOUS | MAP_SHARED | MAP_HUGETLB | MAP_HUGE_2MB,
+        INVALID_FD, /*offset=*/ 0);
+    if (INVALID_ADDR != address) {
+        return MmapBufferImpl(address, aligned_length);
+    }
+    LOGGER__INFO("Failed to allocate {} bytes from the huge pages pool (errno {}), using transparent huge pages",
+        aligned_length, errno);
+
+    // Fallback to transparent huge pages. madvise is only a hint - if THP is disabled the memory is backed by normal
+    // pages.
+    auto result = create_shared_memory(aligned_length);
+    CHECK_EXPECTED(result);
+    if (0 != madvise(result->address(), aligned_length, MADV_HUGEPAGE)) {
+        LOGGER__WARNING("madvise(MADV_HUGEPAGE) failed with errno {}, using normal pages", errno);
+    }
+    return result;
+#else
+    return create_shared_memory(length);
+#endif /* defined(__linux__) && defined(MAP_HUGETLB) && defined(MAP_HUGE_2MB) */
+}
+
 Expected<MmapBufferImpl> MmapBufferImpl::create_file_map(size_t length, FileDescriptor &file, uintptr_t offset)
 {
     void *address = mmap(nullptr, length, PROT_WRITE | PROT_READ, MAP_SHARED, file, (off_t)offset);
@@ -49,6 +81,24 @@ Expected<MmapBufferImpl> MmapBufferImpl::create_file_map(size_t length, FileDesc
     return MmapBufferImpl(address, length);
 }
 
+Expected<MmapBufferImpl> MmapBufferImpl::create_file_map_read_only(const std::string &file_path)
+{
+    // The mapping stays valid after the file is closed
+    FileDescriptor file(open(file_path.c_str(), O_RDONLY | O_CLOEXEC));
+    CHECK_AS_EXPECTED(INVALID_FD != file, HAILO_OPEN_FILE_FAILURE, "Failed to open file {} with errno:{}", file_path, errno);
+
+    struct stat file_stat{};
+    CHECK_AS_EXPECTED(0 == fstat(file, &file_stat), HAILO_FILE_OPERATION_FAILURE,
+        "Failed to stat file {} with errno:{}", file_path, errno);
+    CHECK_AS_EXPECTED(file_stat.st_size > 0, HAILO_FILE_OPERATION_FAILURE, "Can't map the empty file {}", file_path);
+    const auto length = static_cast<size_t>(file_stat.st_size);
+
+    void *address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, /*offset=*/ 0);
+    CHECK_AS_EXPECTED(INVALID_ADDR != address, HAILO_FILE_OPERATION_FAILURE, "Failed to mmap file {} with errno:{}",
+        file_path, errno);
+    return MmapBufferImpl(address, length);
+}
+
 #if defined(__QNX__)
 Expected<MmapBufferImpl> MmapBufferImpl::create_file_map_nocache(size_t length, FileDescriptor &file, uintptr_t offset)
 {
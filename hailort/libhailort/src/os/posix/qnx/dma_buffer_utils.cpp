@@ -26,4 +26,14 @@ hailo_status DmaBufferUtils::munmap_dma_buffer(hailo_dma_buffer_t /*dma_buffer*/
     return HAILO_NOT_IMPLEMENTED;
 }
 
+Expected<hailo_dma_buffer_t> DmaBufferUtils::allocate_dma_heap_buffer(size_t /*size*/)
+{
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+hailo_status DmaBufferUtils::free_dma_heap_buffer(hailo_dma_buffer_t /*dma_buffer*/)
+{
+    return HAILO_NOT_IMPLEMENTED;
+}
+
 } /* namespace hailort */
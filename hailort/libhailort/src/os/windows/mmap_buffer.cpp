@@ -20,12 +20,25 @@ Expected<MmapBufferImpl> MmapBufferImpl::create_shared_memory(size_t)
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<MmapBufferImpl> MmapBufferImpl::create_shared_memory_huge_pages(size_t)
+{
+    LOGGER__ERROR("Creating shared memory is not implemented on windows");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
 Expected<MmapBufferImpl> MmapBufferImpl::create_file_map(size_t, FileDescriptor &, uintptr_t )
 {
     LOGGER__ERROR("Creating file mapping is not implemented on windows");
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<MmapBufferImpl> MmapBufferImpl::create_file_map_read_only(const std::string &)
+{
+    // Not an error - the callers fall back to reading the file
+    LOGGER__DEBUG("Creating file mapping is not implemented on windows");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
 hailo_status MmapBufferImpl::unmap()
 {
     LOGGER__ERROR("Unmapping is not implemented on windows");
@@ -8,9 +8,11 @@
  **/
 
 #include "common/utils.hpp"
+#include "common/os_utils.hpp"
 
 #include "hef/hef_internal.hpp"
 #include "hailort_rpc_client.hpp"
+#include "utils/profiler/tracer_macros.hpp"
 #include "net_flow/ops_metadata/yolov8_op_metadata.hpp"
 #include "net_flow/ops_metadata/yolov8_bbox_only_op_metadata.hpp"
 #include "net_flow/ops_metadata/yolox_op_metadata.hpp"
@@ -272,11 +274,13 @@ Expected<std::vector<uint32_t>> HailoRtRpcClient::VDevice_configure(const VDevic
     return networks_handles;
 }
 
-Expected<ProtoCallbackIdentifier> HailoRtRpcClient::VDevice_get_callback_id(const VDeviceIdentifier &identifier)
+Expected<std::vector<ProtoCallbackIdentifier>> HailoRtRpcClient::VDevice_get_callback_ids(const VDeviceIdentifier &identifier,
+    uint32_t max_callbacks_count)
 {
     VDevice_get_callback_id_Request request;
     auto proto_identifier = request.mutable_identifier();
     VDevice_convert_identifier_to_proto(identifier, proto_identifier);
+    request.set_max_callbacks_count(max_callbacks_count);
 
     VDevice_get_callback_id_Reply reply;
     grpc::ClientContext context;
@@ -287,8 +291,52 @@ Expected<ProtoCallbackIdentifier> HailoRtRpcClient::VDevice_get_callback_id(cons
         return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
     }
     CHECK_SUCCESS_AS_EXPECTED(static_cast<hailo_status>(reply.status()));
-    auto cb_id = reply.callback_id();
-    return cb_id;
+    std::vector<ProtoCallbackIdentifier> cb_ids(reply.callback_ids().begin(), reply.callback_ids().end());
+    return cb_ids;
+}
+
+hailo_status HailoRtRpcClient::VDevice_get_callback_ids_stream(const VDeviceIdentifier &identifier, uint32_t max_callbacks_count,
+    std::function<hailo_status(const ProtoCallbackIdentifier&)> callback_handler)
+{
+    VDevice_get_callback_id_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    VDevice_convert_identifier_to_proto(identifier, proto_identifier);
+    request.set_max_callbacks_count(max_callbacks_count);
+
+    grpc::ClientContext context;
+    auto reader = m_stub->VDevice_get_callback_ids_stream(&context, request);
+    CHECK_NOT_NULL(reader, HAILO_OUT_OF_HOST_MEMORY);
+
+    // The service ends the stream after a reply with a failure status (HAILO_SHUTDOWN_EVENT_SIGNALED once the listener
+    // is finished)
+    hailo_status result = HAILO_RPC_FAILED;
+    VDevice_get_callback_id_Reply reply;
+    while (reader->Read(&reply)) {
+        assert(reply.status() < HAILO_STATUS_COUNT);
+        result = static_cast<hailo_status>(reply.status());
+        if (HAILO_SUCCESS != result) {
+            continue;
+        }
+
+        for (const auto &cb_id : reply.callback_ids()) {
+            result = callback_handler(cb_id);
+            if (HAILO_SUCCESS != result) {
+                break;
+            }
+        }
+        if (HAILO_SUCCESS != result) {
+            context.TryCancel();
+            break;
+        }
+    }
+
+    grpc::Status status = reader->Finish();
+    if ((HAILO_SUCCESS != result) && (HAILO_RPC_FAILED != result)) {
+        return result; // Either the listener was finished, or callback_handler failed (the stream is cancelled)
+    }
+    CHECK_GRPC_STATUS(status);
+
+    return result;
 }
 
 hailo_status HailoRtRpcClient::VDevice_finish_callback_listener(const VDeviceIdentifier &identifier)
@@ -1488,9 +1536,14 @@ hailo_status HailoRtRpcClient::ConfiguredNetworkGroup_infer_async(const NetworkG
         proto_transfer_buffers->Add(std::move(proto_transfer_request));
     }
     request.set_infer_request_done_cb_idx(infer_request_done_cb);
+    const auto trace_id = generate_frame_trace_id();
+    request.set_trace_id(trace_id);
+    const auto send_time_ns = get_frame_trace_time_ns();
+    request.set_client_send_time_ns(send_time_ns);
 
     ClientContextWithTimeout context;
     grpc::Status status = m_stub->ConfiguredNetworkGroup_infer_async(&context, request, &reply);
+    TRACE(ServiceFrameStageTrace, trace_id, "client_request", get_frame_trace_time_ns() - send_time_ns);
     assert(reply.status() < HAILO_STATUS_COUNT);
     if (reply.status() == HAILO_STREAM_ABORT) {
         return static_cast<hailo_status>(reply.status());
@@ -1566,6 +1619,60 @@ hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &ident
     auto proto_identifier = request.mutable_identifier();
     VStream_convert_identifier_to_proto(identifier, proto_identifier);
     request.set_size(static_cast<uint32_t>(buffer.size()));
+    request.set_supports_compact_nms(true);
+
+    ClientContextWithTimeout context;
+    OutputVStream_read_Reply reply;
+    grpc::Status status = m_stub->OutputVStream_read(&context, request, &reply);
+    CHECK_GRPC_STATUS(status);
+    assert(reply.status() < HAILO_STATUS_COUNT);
+    if (reply.status() == HAILO_STREAM_ABORT) {
+        return static_cast<hailo_status>(reply.status());
+    }
+    CHECK_SUCCESS(static_cast<hailo_status>(reply.status()));
+    // NMS frames are received compactly - only their valid prefix is sent, the rest of the buffer isn't used
+    CHECK(reply.data().size() <= buffer.size(), HAILO_RPC_FAILED, "Got {} bytes of a {} bytes frame",
+        reply.data().size(), buffer.size());
+    memcpy(buffer.data(), reply.data().data(), reply.data().size());
+    return HAILO_SUCCESS;
+}
+
+static void SharedMemoryBuffer_convert_to_proto(const SharedMemoryBuffer &shared_memory, size_t frame_size,
+    ProtoSharedMemoryBuffer *proto_shared_memory)
+{
+    proto_shared_memory->set_name(shared_memory.name());
+    proto_shared_memory->set_pid(OsUtils::get_curr_pid());
+    proto_shared_memory->set_size(static_cast<uint32_t>(frame_size));
+}
+
+hailo_status HailoRtRpcClient::InputVStream_write(const VStreamIdentifier &identifier, const SharedMemoryBuffer &shared_memory,
+    size_t frame_size)
+{
+    InputVStream_write_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    VStream_convert_identifier_to_proto(identifier, proto_identifier);
+    SharedMemoryBuffer_convert_to_proto(shared_memory, frame_size, request.mutable_shared_memory());
+
+    ClientContextWithTimeout context;
+    InputVStream_write_Reply reply;
+    grpc::Status status = m_stub->InputVStream_write(&context, request, &reply);
+    CHECK_GRPC_STATUS(status);
+    assert(reply.status() < HAILO_STATUS_COUNT);
+    if (reply.status() == HAILO_STREAM_ABORT) {
+        return static_cast<hailo_status>(reply.status());
+    }
+    CHECK_SUCCESS(static_cast<hailo_status>(reply.status()));
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &identifier, const SharedMemoryBuffer &shared_memory,
+    size_t frame_size)
+{
+    OutputVStream_read_Request request;
+    auto proto_identifier = request.mutable_identifier();
+    VStream_convert_identifier_to_proto(identifier, proto_identifier);
+    request.set_size(static_cast<uint32_t>(frame_size));
+    SharedMemoryBuffer_convert_to_proto(shared_memory, frame_size, request.mutable_shared_memory());
 
     ClientContextWithTimeout context;
     OutputVStream_read_Reply reply;
@@ -1576,7 +1683,6 @@ hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &ident
         return static_cast<hailo_status>(reply.status());
     }
     CHECK_SUCCESS(static_cast<hailo_status>(reply.status()));
-    memcpy(buffer.data(), reply.data().data(), buffer.size());
     return HAILO_SUCCESS;
 }
 
@@ -14,6 +14,7 @@
 #include "hailo/expected.hpp"
 #include "hailo/device.hpp"
 #include "rpc/rpc_definitions.hpp"
+#include "common/shared_memory_buffer.hpp"
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -60,7 +61,13 @@ public:
     Expected<std::vector<std::unique_ptr<Device>>> VDevice_get_physical_devices(const VDeviceIdentifier &identifier);
     Expected<hailo_stream_interface_t> VDevice_get_default_streams_interface(const VDeviceIdentifier &identifier);
     Expected<std::vector<uint32_t>> VDevice_configure(const VDeviceIdentifier &identifier, const Hef &hef, uint32_t pid, const NetworkGroupsParamsMap &configure_params={});
-    Expected<ProtoCallbackIdentifier> VDevice_get_callback_id(const VDeviceIdentifier &identifier);
+    // Waits for a callback, and returns all the callbacks ready (up to max_callbacks_count)
+    Expected<std::vector<ProtoCallbackIdentifier>> VDevice_get_callback_ids(const VDeviceIdentifier &identifier,
+        uint32_t max_callbacks_count);
+    // Passes the callbacks to callback_handler (in order) as they are ready, until the callbacks listener is finished
+    // (returns HAILO_SHUTDOWN_EVENT_SIGNALED) or callback_handler fails.
+    hailo_status VDevice_get_callback_ids_stream(const VDeviceIdentifier &identifier, uint32_t max_callbacks_count,
+        std::function<hailo_status(const ProtoCallbackIdentifier&)> callback_handler);
     hailo_status VDevice_finish_callback_listener(const VDeviceIdentifier &identifier);
 
     Expected<uint32_t> ConfiguredNetworkGroup_dup_handle(const NetworkGroupIdentifier &identifier, uint32_t pid);
@@ -119,6 +126,11 @@ public:
     hailo_status InputVStream_write(const VStreamIdentifier &identifier, const MemoryView &buffer);
     hailo_status InputVStream_write(const VStreamIdentifier &identifier, const hailo_pix_buffer_t &buffer);
     hailo_status OutputVStream_read(const VStreamIdentifier &identifier, MemoryView buffer);
+    // Same as InputVStream_write/OutputVStream_read, passing the frame (of frame_size bytes) through the shared memory
+    hailo_status InputVStream_write(const VStreamIdentifier &identifier, const SharedMemoryBuffer &shared_memory,
+        size_t frame_size);
+    hailo_status OutputVStream_read(const VStreamIdentifier &identifier, const SharedMemoryBuffer &shared_memory,
+        size_t frame_size);
     Expected<size_t> InputVStream_get_frame_size(const VStreamIdentifier &identifier);
     Expected<size_t> OutputVStream_get_frame_size(const VStreamIdentifier &identifier);
 
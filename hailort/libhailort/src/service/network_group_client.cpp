@@ -16,6 +16,7 @@
 #include "network_group/network_group_internal.hpp"
 #include "net_flow/pipeline/vstream_builder.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
+#include "utils/profiler/tracer_macros.hpp"
 #include "rpc_client_utils.hpp"
 
 
@@ -306,6 +307,68 @@ hailo_status ConfiguredNetworkGroupClient::set_scheduler_priority(uint8_t priori
     return m_client->ConfiguredNetworkGroup_set_scheduler_priority(m_identifier, priority, network_name);
 }
 
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_deadline(const std::chrono::milliseconds &/*deadline*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's deadline is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_share(uint32_t /*share*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's share is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_device_affinity(uint64_t /*device_mask*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's device affinity is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_sticky_placement(bool /*is_sticky*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's sticky placement is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_pinned_device(uint32_t /*device_index*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's pinned device is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_burst_size_bounds(uint32_t /*min_burst_size*/,
+    uint32_t /*max_burst_size*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's burst size bounds is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_batch_size(uint16_t /*batch_size*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's batch size is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t /*policy*/,
+    uint32_t /*max_pending_frames*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's overload policy is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<hailo_scheduler_overload_stats_t> ConfiguredNetworkGroupClient::get_scheduler_overload_stats(
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Getting scheduler's overload stats is not supported when working with the service");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 AccumulatorPtr ConfiguredNetworkGroupClient::get_activation_time_accumulator() const
 {
     LOGGER__ERROR("ConfiguredNetworkGroup::get_activation_time_accumulator function is not supported when using multi-process service");
@@ -428,6 +491,20 @@ hailo_status ConfiguredNetworkGroupClient::set_nms_max_accumulated_mask_size(con
     return m_client->ConfiguredNetworkGroup_set_nms_max_accumulated_mask_size(m_identifier, edge_name, max_accumulated_mask_size);
 }
 
+hailo_status ConfiguredNetworkGroupClient::set_nms_max_bboxes_total(const std::string &/*edge_name*/,
+    uint32_t /*max_bboxes_total*/)
+{
+    LOGGER__ERROR("Setting NMS max bboxes total is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status ConfiguredNetworkGroupClient::set_nms_classes_filter(const std::string &/*edge_name*/,
+    const std::vector<uint32_t> &/*classes*/)
+{
+    LOGGER__ERROR("Setting NMS classes filter is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
 // TODO: support kv-cache over service (HRT-13968)
 hailo_status ConfiguredNetworkGroupClient::init_cache(uint32_t /* read_offset */, int32_t /* write_offset_delta */)
 {
@@ -444,6 +521,16 @@ hailo_status ConfiguredNetworkGroupClient::update_cache_offset(int32_t /* offset
     return HAILO_NOT_IMPLEMENTED;
 }
 
+Expected<CacheSnapshot> ConfiguredNetworkGroupClient::snapshot_caches()
+{
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+hailo_status ConfiguredNetworkGroupClient::restore_caches(const CacheSnapshot &/* snapshot */)
+{
+    return HAILO_NOT_IMPLEMENTED;
+}
+
 hailo_status ConfiguredNetworkGroupClient::execute_callback(const ProtoCallbackIdentifier &cb_id)
 {
     if (cb_id.cb_type() == CALLBACK_TYPE_TRANSFER) {
@@ -480,6 +567,8 @@ hailo_status ConfiguredNetworkGroupClient::execute_infer_request_callback(const
         cb = m_infer_request_idx_to_callbacks.at(cb_id.cb_idx());
         m_infer_request_idx_to_callbacks.erase(cb_id.cb_idx());
     }
+    TRACE(ServiceFrameStageTrace, cb_id.trace_id(), "callback_delivery",
+        get_frame_trace_time_ns() - cb_id.service_enqueue_time_ns());
     cb(static_cast<hailo_status>(cb_id.status()));
 
     return HAILO_SUCCESS;
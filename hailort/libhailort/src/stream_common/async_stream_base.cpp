@@ -50,6 +50,7 @@ hailo_status AsyncInputStreamBase::abort_impl()
     {
         std::lock_guard<std::mutex> lock(m_stream_mutex);
         m_is_aborted = true;
+        update_async_ready_event();
     }
     m_has_ready_buffer.notify_all();
     return HAILO_SUCCESS;
@@ -60,6 +61,7 @@ hailo_status AsyncInputStreamBase::clear_abort_impl()
     {
         std::lock_guard<std::mutex> lock(m_stream_mutex);
         m_is_aborted = false;
+        update_async_ready_event();
     }
 
     return HAILO_SUCCESS;
@@ -136,7 +138,8 @@ hailo_status AsyncInputStreamBase::write_impl(const MemoryView &user_buffer)
 
     return call_write_async_impl(TransferRequest(std::move(stream_buffer),
         [this, stream_buffer](hailo_status) {
-            std::unique_lock<std::mutex> lock(m_stream_mutex);
+            // No lock is needed - the buffer pool supports a concurrent enqueue (from the completion thread) and
+            // dequeue (from the user thread).
             auto enqueue_status = m_buffer_pool->enqueue(TransferBuffer{stream_buffer});
             if (HAILO_SUCCESS != enqueue_status) {
                 LOGGER__ERROR("Failed enqueue stream buffer {}", enqueue_status);
@@ -164,6 +167,36 @@ hailo_status AsyncInputStreamBase::wait_for_async_ready(size_t transfer_size, st
     });
 }
 
+Expected<underlying_waitable_handle_t> AsyncInputStreamBase::get_async_ready_handle()
+{
+    auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unique_lock<std::mutex> lock(m_stream_mutex);
+    if (nullptr == m_async_ready_event) {
+        TRY(m_async_ready_event, ReadyEvent::create(is_async_ready()));
+    }
+    return m_async_ready_event->get_underlying_handle();
+}
+
+bool AsyncInputStreamBase::is_async_ready() const
+{
+    // Matches the wait in wait_for_async_ready
+    return m_is_aborted || !m_is_stream_activated || is_ready_for_transfer();
+}
+
+void AsyncInputStreamBase::update_async_ready_event()
+{
+    if (nullptr == m_async_ready_event) {
+        return;
+    }
+
+    auto status = m_async_ready_event->update(is_async_ready());
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed updating the async ready event of stream {}, status {}", name(), status);
+    }
+}
+
 hailo_status AsyncInputStreamBase::write_async(TransferRequest &&transfer_request)
 {
     auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
@@ -194,6 +227,7 @@ hailo_status AsyncInputStreamBase::activate_stream()
     }
 
     m_is_stream_activated = true;
+    update_async_ready_event();
 
     return HAILO_SUCCESS;
 }
@@ -216,6 +250,7 @@ hailo_status AsyncInputStreamBase::deactivate_stream()
         }
 
         m_is_stream_activated = false;
+        update_async_ready_event();
     }
     m_has_ready_buffer.notify_all();
 
@@ -230,6 +265,7 @@ hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&trans
         {
             std::lock_guard<std::mutex> lock(m_stream_mutex);
             m_ongoing_transfers--;
+            update_async_ready_event();
         }
 
         m_has_ready_buffer.notify_all();
@@ -243,6 +279,7 @@ hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&trans
     CHECK_SUCCESS(status);
 
     m_ongoing_transfers++;
+    update_async_ready_event();
 
     return HAILO_SUCCESS;
 }
@@ -272,6 +309,7 @@ hailo_status AsyncOutputStreamBase::abort_impl()
     {
         std::lock_guard<std::mutex> lock(m_stream_mutex);
         m_is_aborted = true;
+        update_async_ready_event();
     }
     m_has_ready_buffer.notify_all();
     return HAILO_SUCCESS;
@@ -282,6 +320,7 @@ hailo_status AsyncOutputStreamBase::clear_abort_impl()
     {
         std::lock_guard<std::mutex> lock(m_stream_mutex);
         m_is_aborted = false;
+        update_async_ready_event();
     }
     return HAILO_SUCCESS;
 }
@@ -300,6 +339,36 @@ hailo_status AsyncOutputStreamBase::wait_for_async_ready(size_t transfer_size, s
     });
 }
 
+Expected<underlying_waitable_handle_t> AsyncOutputStreamBase::get_async_ready_handle()
+{
+    auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unique_lock<std::mutex> lock(m_stream_mutex);
+    if (nullptr == m_async_ready_event) {
+        TRY(m_async_ready_event, ReadyEvent::create(is_async_ready()));
+    }
+    return m_async_ready_event->get_underlying_handle();
+}
+
+bool AsyncOutputStreamBase::is_async_ready() const
+{
+    // Matches the wait in wait_for_async_ready
+    return m_is_aborted || !m_is_stream_activated || is_ready_for_transfer();
+}
+
+void AsyncOutputStreamBase::update_async_ready_event()
+{
+    if (nullptr == m_async_ready_event) {
+        return;
+    }
+
+    auto status = m_async_ready_event->update(is_async_ready());
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed updating the async ready event of stream {}, status {}", name(), status);
+    }
+}
+
 Expected<size_t> AsyncOutputStreamBase::get_async_max_queue_size() const
 {
     return get_max_ongoing_transfers();
@@ -329,6 +398,7 @@ hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&trans
         {
             std::lock_guard<std::mutex> lock(m_stream_mutex);
             m_ongoing_transfers--;
+            update_async_ready_event();
         }
 
         m_has_ready_buffer.notify_all();
@@ -341,6 +411,7 @@ hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&trans
     CHECK_SUCCESS(status);
 
     m_ongoing_transfers++;
+    update_async_ready_event();
 
     return HAILO_SUCCESS;
 }
@@ -363,6 +434,7 @@ hailo_status AsyncOutputStreamBase::activate_stream()
     }
 
     m_is_stream_activated = true;
+    update_async_ready_event();
     return HAILO_SUCCESS;
 }
 
@@ -384,6 +456,7 @@ hailo_status AsyncOutputStreamBase::deactivate_stream()
             LOGGER__ERROR("Failed to stop stream with status {}", deactivate_status);
             status = deactivate_status;
         }
+        update_async_ready_event();
     }
     m_has_ready_buffer.notify_all();
 
@@ -17,6 +17,7 @@
 #include "queued_stream_buffer_pool.hpp"
 
 #include "utils/thread_safe_queue.hpp"
+#include "common/event_internal.hpp"
 
 namespace hailort
 {
@@ -36,6 +37,7 @@ public:
 
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle() override;
     virtual hailo_status write_async(TransferRequest &&transfer_request) override;
 
     virtual hailo_status write_impl(const MemoryView &buffer) override;
@@ -58,6 +60,9 @@ private:
 
     bool is_ready_for_transfer() const;
     bool is_ready_for_dequeue() const;
+    // m_stream_mutex must be locked
+    bool is_async_ready() const;
+    void update_async_ready_event();
 
     template<typename Pred>
     hailo_status cv_wait_for(std::unique_lock<std::mutex> &lock, std::chrono::milliseconds timeout, Pred &&pred)
@@ -79,7 +84,7 @@ private:
             }
         );
         if (!wait_done) {
-            LOGGER__ERROR("Got HAILO_TIMEOUT while waiting for input stream buffer {}", name());
+            LOGGER__ERROR_RATE_LIMITED("Got HAILO_TIMEOUT while waiting for input stream buffer {}", name());
             return HAILO_TIMEOUT;
         } else if (HAILO_SUCCESS != status) {
             LOGGER__TRACE("Waiting for stream buffer exit with {}", status);
@@ -101,6 +106,9 @@ private:
 
     // Conditional variable that is use to check if we have some buffer in m_buffer_pool ready to be written to.
     std::condition_variable m_has_ready_buffer;
+
+    // Created on the first get_async_ready_handle call (nullptr until then)
+    std::unique_ptr<ReadyEvent> m_async_ready_event;
 };
 
 
@@ -113,6 +121,7 @@ public:
     virtual hailo_status set_timeout(std::chrono::milliseconds timeout) override;
 
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<underlying_waitable_handle_t> get_async_ready_handle() override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status read_async(TransferRequest &&transfer_request) override;
 
@@ -138,6 +147,9 @@ private:
     hailo_status call_read_async_impl(TransferRequest &&transfer_request);
 
     bool is_ready_for_transfer() const;
+    // m_stream_mutex must be locked
+    bool is_async_ready() const;
+    void update_async_ready_event();
 
     // Prepare transfers ahead for future reads. This function will launch transfers until the channel queue is filled.
     hailo_status prepare_all_transfers();
@@ -164,7 +176,7 @@ private:
             }
         );
         if (!wait_done) {
-            LOGGER__ERROR("Got HAILO_TIMEOUT while waiting for output stream buffer {}", name());
+            LOGGER__ERROR_RATE_LIMITED("Got HAILO_TIMEOUT while waiting for output stream buffer {}", name());
             return HAILO_TIMEOUT;
         } else if (HAILO_SUCCESS != status) {
             LOGGER__TRACE("Waiting for stream buffer exit with {}", status);
@@ -190,6 +202,9 @@ private:
 
     // Conditional variable that is use to check if we have some pending buffer ready to be read.
     std::condition_variable m_has_ready_buffer;
+
+    // Created on the first get_async_ready_handle call (nullptr until then)
+    std::unique_ptr<ReadyEvent> m_async_ready_event;
 };
 
 
@@ -44,6 +44,9 @@
  *    can be in the following burst) and then assume the rest of the burst is padding (and in debug we verify that). NOTE: currently this mode is not
  *    supported in the sdk.
  *
+ * In all of the burst modes, each burst is scanned for the delimeters/padding in bulk, and each run of bboxes between
+ * them is moved to the user buffer at once.
+ *
  **/
 
 #include "nms_stream.hpp"
@@ -52,106 +55,125 @@
 #include "common/os_utils.hpp"
 #include "stream_common/queued_stream_buffer_pool.hpp"
 #include "utils/profiler/tracer_macros.hpp"
+#include "utils/dma_buffer_utils.hpp"
 
 namespace hailort
 {
 
-static void finish_reading_burst_update_state(NMSBurstState *burst_state, bool *can_stop_reading_burst, size_t *burst_index)
+static inline uint64_t load_bbox(const uint8_t *bboxes, size_t index)
 {
-    *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER;
-    *burst_index = (*burst_index + 1);
-    *can_stop_reading_burst = true;
+    // The bboxes are aligned to nms_bbox_counter_t only (as they follow the counters in the user buffer)
+    uint64_t bbox = 0;
+    memcpy(&bbox, bboxes + (index * sizeof(bbox)), sizeof(bbox));
+    return bbox;
 }
 
-// Function that implements the state machine of the 3 different nms burst modes based on the value of the current bbox and the current state.
-hailo_status NMSStreamReader::advance_state_machine(NMSBurstState *burst_state, const uint64_t current_bbox,
-    const hailo_nms_burst_type_t burst_type, const uint32_t num_classes, size_t *num_delimeters_received,
-    bool *can_stop_reading_burst, const size_t burst_offset, const size_t burst_size, size_t *burst_index)
+static inline bool is_nms_marker(uint64_t bbox)
 {
-    switch(current_bbox) {
-        // This is also case for Hailo8 padding - seeing as they are same value
-        case NMS_DELIMITER:
-        {
-            // If we are in hailo8 per class mode - if we are in state waiting for delimeter - we received delimeter
-            // otherwise we must be in state waiting for padding - in which case we received padding.
-            if (HAILO_BURST_TYPE_H8_PER_CLASS == burst_type) {
-                CHECK_IN_DEBUG((NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == (*burst_state)) ||
-                    (NMSBurstState::NMS_BURST_STATE_WAITING_FOR_PADDING == (*burst_state)), HAILO_NMS_BURST_INVALID_DATA,
-                    "Invalid state, H8 NMS burst cannot receive delimeter while in state {}", (*burst_state));
-                // To differentiate from H8 padding - where we should not increment amount of delimeters found
-                if ((*burst_state) == NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER) {
-                    (*num_delimeters_received)++;
-                }
-#ifdef NDEBUG
-                // In hailo8 burst mode - if is in state waiting for delimeter and got delimeter - rest will be padding and can skip
-                if ((*burst_state) == NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER) {
-                    finish_reading_burst_update_state(burst_state, can_stop_reading_burst, burst_index);
-                    break;
-                }
-#endif
-                // In hailo8 mode after delimeter we expect padding until end of burst - seeing as h8 padding is same value
-                // Whether was in state wait for delimeter or state wait for padding - will always go to wait for padding until end of burst
-                *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_PADDING;
-                if (burst_offset == (burst_size - sizeof(current_bbox))) {
-                    finish_reading_burst_update_state(burst_state, can_stop_reading_burst, burst_index);
-                }
-                break;
+    // NMS_DELIMITER, NMS_IMAGE_DELIMITER and NMS_H15_PADDING are the 3 largest uint64 values
+    return (~bbox) <= (~NMS_H15_PADDING);
+}
 
-            } else if (HAILO_BURST_TYPE_H15_PER_CLASS == burst_type) {
-                CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == (*burst_state), HAILO_NMS_BURST_INVALID_DATA,
-                    "Invalid state, H15 Per class NMS burst cannot receive delimeter while in state {}", (*burst_state));
-                (*num_delimeters_received)++;
-                *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER;
-            } else {
-                CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == (*burst_state), HAILO_NMS_BURST_INVALID_DATA,
-                    "Invalid state, H15 Per Frame NMS burst cannot receive delimeter while in state {}", (*burst_state));
-                // in hailo15 per frame - if number of delimeter is same as num classes - we expect image delimeter next 
-                // otherwise expect another delimeter
-                (*num_delimeters_received)++;
-                if (num_classes == (*num_delimeters_received)) {
-                    *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER;
-                }
-            }
+// Returns the index of the first delimeter/padding in bboxes [begin, end), or end if there is none. The bboxes are
+// checked 4 at a time, so the runs of bboxes are scanned without a branch per bbox.
+static size_t find_nms_marker(const uint8_t *bboxes, size_t begin, size_t end)
+{
+    size_t i = begin;
+    for (; (i + 4) <= end; i += 4) {
+        if (is_nms_marker(load_bbox(bboxes, i)) | is_nms_marker(load_bbox(bboxes, i + 1)) |
+            is_nms_marker(load_bbox(bboxes, i + 2)) | is_nms_marker(load_bbox(bboxes, i + 3))) {
             break;
         }
+    }
+    for (; i < end; i++) {
+        if (is_nms_marker(load_bbox(bboxes, i))) {
+            return i;
+        }
+    }
+    return end;
+}
 
-        case NMS_IMAGE_DELIMITER:
-        {
-            CHECK_IN_DEBUG(HAILO_BURST_TYPE_H8_PER_CLASS != burst_type, HAILO_NMS_BURST_INVALID_DATA,
-                "Invalid state, H8 NMS burst cannot receive image delimeter");
-
-            CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER == (*burst_state), HAILO_NMS_BURST_INVALID_DATA,
-                "Invalid state, H15 NMS burst cannot receive image delimeter in state {}", (*burst_state));
-
-            // in both hailo15 per class and per frame - when receiving image delimeter we move to expecting padding
-            *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_PADDING;
-
+// The rest of a burst after its last delimeter/image delimeter is padding - validated in debug only
+static hailo_status validate_burst_padding(const uint8_t *burst, size_t begin, size_t end, hailo_nms_burst_type_t burst_type)
+{
 #ifdef NDEBUG
-            finish_reading_burst_update_state(burst_state, can_stop_reading_burst, burst_index);
+    (void)burst;
+    (void)begin;
+    (void)end;
+    (void)burst_type;
 #else
-            // Will only get to here in debug mode - if burst size is exactly max classes + 2 (1 for NMS_DELIMITER
-            // and another 1 for NMS_IMAGE_DELIMITER - (this is default for interrupt per frame)) - burst will have
-            // no padding at end and can finish reading burst now if is last bbox in burst
-            if (burst_offset == (burst_size - sizeof(current_bbox))) {
-                finish_reading_burst_update_state(burst_state, can_stop_reading_burst, burst_index);
-            }
+    // In Hailo-8 the padding is the same value as the delimeter
+    const auto padding = (HAILO_BURST_TYPE_H8_PER_CLASS == burst_type) ? NMS_DELIMITER : NMS_H15_PADDING;
+    for (size_t i = begin; i < end; i++) {
+        CHECK(padding == load_bbox(burst, i), HAILO_NMS_BURST_INVALID_DATA,
+            "Invalid NMS burst, expected padding {:x} at bbox {}, instead got {:x}", padding, i, load_bbox(burst, i));
+    }
 #endif // NDEBUG
-            break;
+    return HAILO_SUCCESS;
+}
+
+// Parses a single burst (see the explanation of the burst modes above) - the runs of bboxes between the delimeters are
+// found in bulk and moved to the user buffer as a whole.
+hailo_status NMSStreamReader::parse_burst(const uint8_t *burst, size_t bboxes_in_burst, hailo_nms_burst_type_t burst_type,
+    uint32_t num_classes, uint32_t max_bboxes_per_class, BurstsParseState &state)
+{
+    size_t index = 0;
+    while (index < bboxes_in_burst) {
+        const auto marker_index = find_nms_marker(burst, index, bboxes_in_burst);
+
+        const auto bboxes_count = marker_index - index;
+        CHECK((state.class_bboxes_count + bboxes_count) <= max_bboxes_per_class, HAILO_INTERNAL_FAILURE,
+            "Data read from the device for the current class was size {}, max size is {}",
+            state.class_bboxes_count + bboxes_count, max_bboxes_per_class);
+        // The user buffer is the buffer the bursts are read to, so the bboxes may overlap their destination
+        memmove(state.dst, burst + (index * sizeof(uint64_t)), bboxes_count * sizeof(uint64_t));
+        state.dst += bboxes_count * sizeof(uint64_t);
+        state.class_bboxes_count = static_cast<nms_bbox_counter_t>(state.class_bboxes_count + bboxes_count);
+
+        if (bboxes_in_burst == marker_index) {
+            // The class continues on the next burst
+            return HAILO_SUCCESS;
         }
 
-        case NMS_H15_PADDING:
-        {
-            if ((HAILO_BURST_TYPE_H15_PER_CLASS == burst_type) || (HAILO_BURST_TYPE_H15_PER_FRAME == burst_type)) {
-                CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_PADDING == (*burst_state), HAILO_NMS_BURST_INVALID_DATA,
-                    "Invalid state, H15 NMS burst cannot receive padding in state {}", (*burst_state));
+        const auto marker = load_bbox(burst, marker_index);
+        index = marker_index + 1;
+        switch (marker) {
+        case NMS_DELIMITER:
+            CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == state.burst_state,
+                HAILO_NMS_BURST_INVALID_DATA, "Invalid state, NMS burst cannot receive delimeter while in state {}",
+                state.burst_state);
+
+            // Fill in the amount of bboxes found for the class, and start the next class
+            *state.class_bboxes_count_ptr = state.class_bboxes_count;
+            state.class_bboxes_count_ptr = reinterpret_cast<nms_bbox_counter_t*>(state.dst);
+            state.class_bboxes_count = 0;
+            state.dst += sizeof(nms_bbox_counter_t);
+            state.delimeters_found++;
+
+            if (HAILO_BURST_TYPE_H8_PER_CLASS == burst_type) {
+                // In Hailo-8 the rest of the burst is padding
+                return validate_burst_padding(burst, index, bboxes_in_burst, burst_type);
             }
-            // In case of padding next state is wait for padding unless it is last padding of burst - then next state will be
-            // Wait for delimeter - will only get to this stage in debug - in release once image delimeter is read we ignore rest of
-            // burst seeing as it must be padding
-            if (burst_offset == (burst_size - sizeof(current_bbox))) {
-                finish_reading_burst_update_state(burst_state, can_stop_reading_burst, burst_index);
+            if ((HAILO_BURST_TYPE_H15_PER_CLASS == burst_type) || (num_classes == state.delimeters_found)) {
+                // The image delimeter follows (maybe in the next burst)
+                state.burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER;
             }
             break;
+        case NMS_IMAGE_DELIMITER:
+            CHECK_IN_DEBUG(HAILO_BURST_TYPE_H8_PER_CLASS != burst_type, HAILO_NMS_BURST_INVALID_DATA,
+                "Invalid state, H8 NMS burst cannot receive image delimeter");
+            CHECK_IN_DEBUG(NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER == state.burst_state,
+                HAILO_NMS_BURST_INVALID_DATA, "Invalid state, H15 NMS burst cannot receive image delimeter in state {}",
+                state.burst_state);
+
+            // The rest of the burst is padding
+            state.burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER;
+            return validate_burst_padding(burst, index, bboxes_in_burst, burst_type);
+        default:
+            // NMS_H15_PADDING is expected only after the image delimeter (which ends the parsing of the burst)
+            CHECK_IN_DEBUG(false, HAILO_NMS_BURST_INVALID_DATA, "Invalid state, H15 NMS burst cannot receive padding in state {}",
+                state.burst_state);
+            break;
         }
     }
 
@@ -217,11 +239,12 @@ hailo_status NMSStreamReader::read_nms_bbox_mode(OutputStreamBase &stream, void
 
 hailo_status NMSStreamReader::read_nms_burst_mode(OutputStreamBase &stream, void *buffer, size_t offset, size_t buffer_size)
 {
-    NMSBurstState burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER;
     const uint32_t bbox_size = stream.get_info().nms_info.bbox_size;
     const size_t burst_size = stream.get_layer_info().nms_info.burst_size * bbox_size;
     const hailo_nms_burst_type_t burst_type = stream.get_layer_info().nms_info.burst_type;
-    const auto num_expected_delimeters = stream.get_info().nms_info.chunks_per_frame * stream.get_info().nms_info.number_of_classes;
+    const auto num_classes = stream.get_info().nms_info.number_of_classes;
+    const auto max_bboxes_per_class = stream.get_info().nms_info.max_bboxes_per_class;
+    const auto num_expected_delimeters = stream.get_info().nms_info.chunks_per_frame * num_classes;
     // Transfer size if affected from if working in interrupt per burst or interrupt per frame
     const size_t transfer_size = LayerInfoUtils::get_nms_layer_transfer_size(stream.get_layer_info());
     const bool is_interrupt_per_frame = (transfer_size > burst_size);
@@ -234,70 +257,35 @@ hailo_status NMSStreamReader::read_nms_burst_mode(OutputStreamBase &stream, void
 
     // Start writing bboxes at offset sizeof(nms_bbox_counter_t) - because the first sizeof(nms_bbox_counter_t) will be
     // used to write amount of bboxes found for class 0 etc...
-    nms_bbox_counter_t class_bboxes_count = 0;
-    nms_bbox_counter_t* class_bboxes_count_ptr = (nms_bbox_counter_t*)(reinterpret_cast<uint8_t*>(buffer) + offset);
-    offset += sizeof(nms_bbox_counter_t);
+    BurstsParseState state{};
+    state.burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER;
+    state.class_bboxes_count_ptr = reinterpret_cast<nms_bbox_counter_t*>(static_cast<uint8_t*>(buffer) + offset);
+    state.dst = static_cast<uint8_t*>(buffer) + offset + sizeof(nms_bbox_counter_t);
 
-    // Counter of number of delimeters found in frame
-    size_t delimeters_found = 0;
     size_t burst_index = 0;
-    MemoryView current_burst;
-    while ((delimeters_found < num_expected_delimeters) || (NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER == burst_state)) {
-        // In interrupt per frame we read whole frame once (in first iteration) - then don't read in following loop iterations
-        // delimeters_found will always be 0 in first iteration - and in interrupt_per_frame will always be larger in following iterations
-        if (!is_interrupt_per_frame || (0 == delimeters_found)) {
-            assert(offset + transfer_size <= buffer_size);
-            current_burst = MemoryView(static_cast<uint8_t*>(buffer) + offset, transfer_size);
-            auto status = stream.read_impl(current_burst);
+    MemoryView current_transfer;
+    while ((state.delimeters_found < num_expected_delimeters) ||
+        (NMSBurstState::NMS_BURST_STATE_WAITING_FOR_IMAGE_DELIMETER == state.burst_state)) {
+        // In interrupt per frame we read the whole frame once, and then parse its bursts one after the other. Otherwise,
+        // each burst is read to the current position of the parsed frame.
+        if (!is_interrupt_per_frame || (0 == burst_index)) {
+            assert(static_cast<size_t>(state.dst - static_cast<uint8_t*>(buffer)) + transfer_size <= buffer_size);
+            current_transfer = MemoryView(state.dst, transfer_size);
+            auto status = stream.read_impl(current_transfer);
             if ((HAILO_STREAM_ABORT == status) || ((HAILO_STREAM_NOT_ACTIVATED == status))) {
                 return status;
             }
             CHECK_SUCCESS(status, "Failed reading nms burst");
         }
 
-        // Flag that marks if we can stop reading burst and continue to next burst
-        bool can_stop_reading_burst = false;
-        // Iterate through burst and copy relevant data to user buffer
-        for (size_t burst_offset = 0; burst_offset < burst_size; burst_offset += bbox_size) {
-            uint64_t current_bbox = 0;
-            if (is_interrupt_per_frame) {
-                assert((burst_index * burst_size) + burst_offset < transfer_size);
-                memcpy(&current_bbox, current_burst.data() + (burst_index * burst_size) + burst_offset,
-                    sizeof(current_bbox));
-            } else {
-                memcpy(&current_bbox, current_burst.data() + burst_offset, sizeof(current_bbox));
-            }
-
-            // If read delimeter - fill in information about num of bboxes found for the class (we also make sure that
-            //  It is in state NMS_BURST_STATE_WAITING_FOR_DELIMETER because in hailo8 padding is same value)
-            if ((NMS_DELIMITER == current_bbox) && (NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == burst_state)) {
-                *class_bboxes_count_ptr = class_bboxes_count;
-                class_bboxes_count_ptr = (nms_bbox_counter_t*)(reinterpret_cast<uint8_t*>(buffer) + offset);
-                class_bboxes_count = 0;
-                offset += sizeof(nms_bbox_counter_t);
-            }
-
-            // Received delimeter can stop reading burst because rest of burst is image delimeter then padding
-            if ((NMS_DELIMITER == current_bbox) || (NMS_IMAGE_DELIMITER == current_bbox) || (NMS_H15_PADDING == current_bbox)) {
-                auto status = advance_state_machine(&burst_state, current_bbox, burst_type, stream.get_info().nms_info.number_of_classes,
-                    &delimeters_found, &can_stop_reading_burst, burst_offset, burst_size, &burst_index);
-                CHECK_SUCCESS(status);
-
-                if (can_stop_reading_burst) {
-                    break;
-                }
-                continue;
-            }
-
-            class_bboxes_count++;
-            CHECK(class_bboxes_count <= stream.get_info().nms_info.max_bboxes_per_class, HAILO_INTERNAL_FAILURE,
-                "Data read from the device for the current class was size {}, max size is {}", class_bboxes_count,
-                stream.get_info().nms_info.max_bboxes_per_class);
-
-            // Copy bbox to correct location in buffer
-            memcpy((static_cast<uint8_t*>(buffer) + offset), &current_bbox, sizeof(current_bbox));
-            offset += bbox_size;
-        }
+        const auto burst_offset = is_interrupt_per_frame ? (burst_index * burst_size) : 0;
+        CHECK((burst_offset + burst_size) <= transfer_size, HAILO_NMS_BURST_INVALID_DATA,
+            "NMS frame has more bursts than expected ({} delimeters found, expected {})", state.delimeters_found,
+            num_expected_delimeters);
+        auto status = parse_burst(current_transfer.data() + burst_offset, burst_size / bbox_size, burst_type, num_classes,
+            max_bboxes_per_class, state);
+        CHECK_SUCCESS(status);
+        burst_index++;
     }
 
     return HAILO_SUCCESS;
@@ -357,7 +345,8 @@ Expected<std::unique_ptr<StreamBufferPool>> NmsOutputStream::allocate_buffer_poo
 {
     const size_t queue_size = m_reader_thread.get_max_ongoing_transfers();
     const BufferStorageParams heap_params{};
-    auto queued_pool = QueuedStreamBufferPool::create(queue_size, get_frame_size(), heap_params);
+    // The reader writes only the detections of each class, so the rest of the frame stays zeroed
+    auto queued_pool = QueuedStreamBufferPool::create(queue_size, get_frame_size(), heap_params, true);
     CHECK_EXPECTED(queued_pool);
 
     return std::unique_ptr<StreamBufferPool>(queued_pool.release());
@@ -372,8 +361,6 @@ hailo_status NmsOutputStream::read_async_impl(TransferRequest &&transfer_request
 {
     CHECK(1 == transfer_request.transfer_buffers.size(), HAILO_INVALID_OPERATION,
         "NMS Reader stream supports only 1 transfer buffer");
-    CHECK(TransferBufferType::MEMORYVIEW == transfer_request.transfer_buffers[0].type(), HAILO_INVALID_OPERATION,
-        "NMS stream doesn't support DMABUF buffer type");
     // Currently leave as transfer request - because nms reader uses transfer request queue
     // TODO HRT-12239: Chagge when support async read with any aligned void ptr
     return m_reader_thread.launch_transfer(std::move(transfer_request));
@@ -475,16 +462,13 @@ void NmsReaderThread::process_transfer_requests()
                 break;
             }
 
-            transfer_request = m_queue.front();
+            transfer_request = std::move(m_queue.front());
             m_queue.pop();
         }
 
         assert(1 == transfer_request.transfer_buffers.size());
         assert(0 == transfer_request.transfer_buffers[0].offset());
-        // TODO HRT-13827: Add support for nms stream read with dmabuf
-        auto buffer = transfer_request.transfer_buffers[0].base_buffer();
-        assert(buffer.has_value());
-        auto status = NMSStreamReader::read_nms(*m_base_stream, buffer.value().data(), 0, buffer.value().size(), m_stream_interface);
+        auto status = read_nms(transfer_request.transfer_buffers[0]);
 
         if ((HAILO_STREAM_NOT_ACTIVATED == status) || (HAILO_STREAM_ABORT == status)) {
             // On both deactivation/abort, we want to send HAILO_STREAM_ABORT since it is part of the callback
@@ -496,11 +480,29 @@ void NmsReaderThread::process_transfer_requests()
     }
 }
 
+hailo_status NmsReaderThread::read_nms(TransferBuffer &transfer_buffer)
+{
+    if (TransferBufferType::DMABUF == transfer_buffer.type()) {
+        // The nms is parsed directly into the dmabuf (no intermediate buffer)
+        TRY(const auto dmabuf, transfer_buffer.dmabuf());
+        TRY(auto dmabuf_view, DmaBufferUtils::mmap_dma_buffer(dmabuf, BufferProtection::WRITE));
+        const auto read_status = NMSStreamReader::read_nms(*m_base_stream, dmabuf_view.data() + transfer_buffer.offset(),
+            0, transfer_buffer.size(), m_stream_interface);
+        const auto munmap_status = DmaBufferUtils::munmap_dma_buffer(dmabuf, dmabuf_view, BufferProtection::WRITE);
+        CHECK_SUCCESS(munmap_status, "Failed to unmap dma buffer");
+        // Not using CHECK since abort/deactivation statuses are handled by the caller
+        return read_status;
+    }
+
+    TRY(auto buffer, transfer_buffer.base_buffer());
+    return NMSStreamReader::read_nms(*m_base_stream, buffer.data(), 0, buffer.size(), m_stream_interface);
+}
+
 void NmsReaderThread::cancel_pending_transfers()
 {
     std::unique_lock<std::mutex> lock(m_queue_mutex);
     while(!m_queue.empty()) {
-        auto transfer_request = m_queue.front();
+        auto transfer_request = std::move(m_queue.front());
         m_queue.pop();
         transfer_request.callback(HAILO_STREAM_ABORT);
     }
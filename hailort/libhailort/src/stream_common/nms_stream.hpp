@@ -38,10 +38,19 @@ public:
         hailo_stream_interface_t stream_interface);
 private:
     static hailo_status read_nms_bbox_mode(OutputStreamBase &stream, void *buffer, size_t offset);
+    // State of the parsing of a frame's bursts. The parsed frame is written to the buffer the bursts are read to, at dst
+    // (which never passes the parsed burst data).
+    struct BurstsParseState {
+        NMSBurstState burst_state;
+        size_t delimeters_found;
+        nms_bbox_counter_t class_bboxes_count;
+        nms_bbox_counter_t *class_bboxes_count_ptr;
+        uint8_t *dst;
+    };
+
     static hailo_status read_nms_burst_mode(OutputStreamBase &stream, void *buffer, size_t offset, size_t buffer_size);
-    static hailo_status advance_state_machine(NMSBurstState *burst_state, const uint64_t current_bbox,
-        const hailo_nms_burst_type_t burst_type, const uint32_t num_classes, size_t *num_delimeters_received,
-        bool *can_stop_reading_burst, const size_t burst_offset, const size_t burst_size, size_t *burst_index);
+    static hailo_status parse_burst(const uint8_t *burst, size_t bboxes_in_burst, hailo_nms_burst_type_t burst_type,
+        uint32_t num_classes, uint32_t max_bboxes_per_class, BurstsParseState &state);
 };
 
 class NmsReaderThread final {
@@ -64,6 +73,7 @@ private:
 
     void signal_thread_quit();
     void process_transfer_requests();
+    hailo_status read_nms(TransferBuffer &transfer_buffer);
 
     std::shared_ptr<OutputStreamBase> m_base_stream;
     const size_t m_queue_max_size;
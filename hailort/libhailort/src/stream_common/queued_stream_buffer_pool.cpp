@@ -12,12 +12,14 @@ namespace hailort
 {
 
 Expected<std::unique_ptr<QueuedStreamBufferPool>> QueuedStreamBufferPool::create(size_t max_queue_size, size_t buffer_size,
-    BufferStorageParams buffer_params)
+    BufferStorageParams buffer_params, bool should_zero_buffers)
 {
     std::vector<BufferPtr> storage;
     storage.reserve(max_queue_size);
     for (size_t i = 0; i < max_queue_size; i++) {
-        auto buffer = Buffer::create_shared(buffer_size, 0, buffer_params);
+        // Zeroing touches every page of the buffers at configure time, which is wasted when the transfers overwrite them
+        auto buffer = should_zero_buffers ? Buffer::create_shared(buffer_size, 0, buffer_params) :
+            Buffer::create_shared(buffer_size, buffer_params);
         CHECK_EXPECTED(buffer);
         storage.emplace_back(buffer.release());
     }
@@ -28,10 +30,14 @@ Expected<std::unique_ptr<QueuedStreamBufferPool>> QueuedStreamBufferPool::create
 }
 
 QueuedStreamBufferPool::QueuedStreamBufferPool(std::vector<BufferPtr> &&storage) :
-    m_storage(std::move(storage))
+    m_storage(std::move(storage)),
+    m_queue(m_storage.size())
 {
     for (auto buffer : m_storage) {
-        m_queue.push(MemoryView(*buffer));
+        // The queue was allocated with enough space for all buffers
+        const auto enqueued = m_queue.try_enqueue(MemoryView(*buffer));
+        assert(enqueued);
+        (void)enqueued;
     }
 }
 
@@ -51,10 +57,8 @@ hailo_status QueuedStreamBufferPool::dma_map(VDevice &vdevice, hailo_dma_buffer_
 
 Expected<TransferBuffer> QueuedStreamBufferPool::dequeue()
 {
-    CHECK_AS_EXPECTED(!m_queue.empty(), HAILO_INTERNAL_FAILURE, "QueuedStreamBufferPool is empty");
-
-    auto buffer = m_queue.front();
-    m_queue.pop();
+    MemoryView buffer;
+    CHECK_AS_EXPECTED(m_queue.try_dequeue(buffer), HAILO_INTERNAL_FAILURE, "QueuedStreamBufferPool is empty");
     return TransferBuffer(buffer);
 }
 
@@ -66,7 +70,8 @@ hailo_status QueuedStreamBufferPool::enqueue(TransferBuffer &&buffer_info)
     CHECK(base_buffer.data() == m_storage[m_next_enqueue_buffer_index]->data(), HAILO_INTERNAL_FAILURE,
         "Out of order enqueue for queued stream buffer pool");
 
-    m_queue.push(base_buffer);
+    // Never allocates, since at most max_queue_size buffers are in the queue.
+    CHECK(m_queue.try_enqueue(base_buffer), HAILO_INTERNAL_FAILURE, "QueuedStreamBufferPool is full");
     m_next_enqueue_buffer_index = (m_next_enqueue_buffer_index + 1) % (m_storage.size());
     return HAILO_SUCCESS;
 }
@@ -74,13 +79,13 @@ hailo_status QueuedStreamBufferPool::enqueue(TransferBuffer &&buffer_info)
 void QueuedStreamBufferPool::reset_pointers()
 {
     // First, clear all queued buffers (data may be lost, as required from reset_pointers).
-    while (!m_queue.empty()) {
-        m_queue.pop();
-    }
+    while (m_queue.pop()) {}
 
     // Now fill the buffers from the storage in the right order
     for (auto buffer : m_storage) {
-        m_queue.push(MemoryView(*buffer));
+        const auto enqueued = m_queue.try_enqueue(MemoryView(*buffer));
+        assert(enqueued);
+        (void)enqueued;
     }
     m_next_enqueue_buffer_index = 0;
 }
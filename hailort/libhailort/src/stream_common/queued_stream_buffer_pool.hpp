@@ -4,7 +4,7 @@
 **/
 /**
  * @file queued_stream_buffer_pool.hpp
- * @brief Simplest stream buffer pool, just using std::queue with max size for the buffers.
+ * @brief Simplest stream buffer pool, just using a lock-free SPSC queue with max size for the buffers.
  **/
 
 #ifndef _HAILO_QUEUED_STREAM_BUFFER_POOL_HPP_
@@ -12,16 +12,17 @@
 
 #include "stream_common/stream_buffer_pool.hpp"
 #include "hailo/dma_mapped_buffer.hpp"
-
-#include <queue>
+#include "utils/thread_safe_queue.hpp"
 
 namespace hailort
 {
 
 class QueuedStreamBufferPool : public StreamBufferPool {
 public:
+    // The buffers are left uninitialized, unless should_zero_buffers is set (for streams whose frames aren't fully
+    // written by each transfer).
     static Expected<std::unique_ptr<QueuedStreamBufferPool>> create(size_t max_queue_size, size_t buffer_size,
-        BufferStorageParams buffer_params);
+        BufferStorageParams buffer_params, bool should_zero_buffers = false);
 
     explicit QueuedStreamBufferPool(std::vector<BufferPtr> &&storage);
 
@@ -39,9 +40,10 @@ private:
     // Keeps mappings alive (only if dma_map was called).
     std::vector<DmaMappedBuffer> m_dma_mappings;
 
-    std::queue<MemoryView> m_queue;
+    // Single producer (enqueue) single consumer (dequeue) queue, allocated once with max_queue_size buffers.
+    moodycamel::ReaderWriterQueue<MemoryView> m_queue;
 
-    // Used for buffer enqueue order validation.
+    // Used for buffer enqueue order validation. Accessed only by the producer.
     size_t m_next_enqueue_buffer_index = 0;
 };
 
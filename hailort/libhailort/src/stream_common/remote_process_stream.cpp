@@ -33,8 +33,9 @@ Expected<std::unique_ptr<RemoteProcessBufferPool>> RemoteProcessBufferPool::crea
 
 RemoteProcessBufferPool::RemoteProcessBufferPool(hailo_stream_direction_t stream_direction, size_t frame_size,
     size_t queue_size, hailo_status &status) :
-        m_hw_buffers_queue(queue_size + 1),
-        m_host_buffers_queue(queue_size + 1)
+        m_hw_buffers_queue(queue_size),
+        m_host_buffers_queue(queue_size),
+        m_is_aborted(false)
 {
     // On H2D, the user will dequeue from user_buffers_queue, fill it and sent to the hw_buffers_queue.
     // On D2H, the read thread will dequeue from hw_buffers_pool, read into it and sent it to the user_buffers_queue.
@@ -55,7 +56,7 @@ RemoteProcessBufferPool::RemoteProcessBufferPool(hailo_stream_direction_t stream
         m_buffers_guard.emplace_back(buffer.release());
 
         auto buffer_view = MemoryView(*m_buffers_guard.back());
-        queue_to_fill.push_back(SharedBuffer{buffer_view, SharedBuffer::Type::DATA});
+        queue_to_fill.push(SharedBuffer{buffer_view, SharedBuffer::Type::DATA});
     }
 
     status = HAILO_SUCCESS;
@@ -63,78 +64,66 @@ RemoteProcessBufferPool::RemoteProcessBufferPool(hailo_stream_direction_t stream
 
 void RemoteProcessBufferPool::abort()
 {
-    {
-        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-        m_is_aborted = true;
-    }
-    m_cv.notify_all();
+    m_is_aborted = true;
+
+    // Wakes the consumers of both queues, so they see the abort
+    m_hw_buffers_queue.pushed_futex().notify();
+    m_host_buffers_queue.pushed_futex().notify();
 }
 
 void RemoteProcessBufferPool::clear_abort()
 {
-    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
     m_is_aborted = false;
 }
 
-Expected<RemoteProcessBufferPool::SharedBuffer> RemoteProcessBufferPool::dequeue_hw_buffer(
+Expected<size_t> RemoteProcessBufferPool::dequeue_hw_buffers(SharedBuffer *buffers, size_t max_count,
     std::chrono::milliseconds timeout)
 {
-    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-    auto status = cv_wait_for(lock, timeout, [this]() {
-        return !m_hw_buffers_queue.empty();
+    size_t count = 0;
+    auto status = wait_for(m_hw_buffers_queue, timeout, [this, buffers, max_count, &count]() {
+        count = m_hw_buffers_queue.pop(buffers, max_count);
+        return (0 != count);
     });
     if (HAILO_SUCCESS != status) {
         return make_unexpected(status);
     }
 
-    auto result = m_hw_buffers_queue.front();
-    m_hw_buffers_queue.pop_front();
-    return result;
+    return count;
 }
 
 hailo_status RemoteProcessBufferPool::enqueue_hw_buffer(SharedBuffer buffer)
 {
-    {
-        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-        CHECK(!m_hw_buffers_queue.full(), HAILO_INTERNAL_FAILURE, "HW buffer is full");
-        m_hw_buffers_queue.push_back(buffer);
-    }
-    m_cv.notify_one();
+    std::unique_lock<RecursiveSharedMutex> lock(m_user_mutex);
+    CHECK(m_hw_buffers_queue.push(buffer), HAILO_INTERNAL_FAILURE, "HW buffer is full");
     return HAILO_SUCCESS;
 }
 
 Expected<RemoteProcessBufferPool::SharedBuffer> RemoteProcessBufferPool::dequeue_host_buffer(
     std::chrono::milliseconds timeout)
 {
-    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-    auto status = cv_wait_for(lock, timeout, [this]() {
-        return !m_host_buffers_queue.empty();
+    std::unique_lock<RecursiveSharedMutex> lock(m_user_mutex);
+    SharedBuffer result{};
+    auto status = wait_for(m_host_buffers_queue, timeout, [this, &result]() {
+        return (1 == m_host_buffers_queue.pop(&result, 1));
     });
     if (HAILO_SUCCESS != status) {
         return make_unexpected(status);
     }
 
-    auto result = m_host_buffers_queue.front();
-    m_host_buffers_queue.pop_front();
     return result;
 }
 
 hailo_status RemoteProcessBufferPool::enqueue_host_buffer(SharedBuffer buffer)
 {
-    {
-        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-        CHECK(!m_host_buffers_queue.full(), HAILO_INTERNAL_FAILURE, "Host buffer is full");
-        m_host_buffers_queue.push_back(buffer);
-    }
-    m_cv.notify_one();
+    CHECK(m_host_buffers_queue.push(buffer), HAILO_INTERNAL_FAILURE, "Host buffer is full");
     return HAILO_SUCCESS;
 }
 
 hailo_status RemoteProcessBufferPool::wait_until_host_queue_full(std::chrono::milliseconds timeout)
 {
-    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-    return cv_wait_for(lock, timeout, [this]() {
-        return m_host_buffers_queue.full();
+    std::unique_lock<RecursiveSharedMutex> lock(m_user_mutex);
+    return wait_for(m_host_buffers_queue, timeout, [this]() {
+        return m_host_buffers_queue.size() == m_host_buffers_queue.capacity();
     });
 }
 
@@ -283,6 +272,8 @@ RemoteProcessInputStream::RemoteProcessInputStream(std::shared_ptr<InputStreamBa
         InputStreamBase(base_stream->get_layer_info(), base_stream->get_core_op_activated_event(), status),
         m_base_stream(base_stream),
         m_timeout(m_base_stream->get_timeout()),
+        m_pending_buffers_begin(0),
+        m_pending_buffers_end(0),
         m_wait_for_activation(m_base_stream->get_core_op_activated_event(), thread_stop_event)
 {
     if (HAILO_SUCCESS != status) {
@@ -317,6 +308,7 @@ RemoteProcessInputStream::RemoteProcessInputStream(std::shared_ptr<InputStreamBa
         return;
     }
     m_buffer_pool = buffer_pool.release();
+    m_pending_buffers.resize(m_buffer_pool->capacity());
 
     // Launch the thread
     m_write_thread = std::thread([this]() { run_write_thread(); });
@@ -350,17 +342,24 @@ void RemoteProcessInputStream::run_write_thread()
 
 hailo_status RemoteProcessInputStream::write_single_buffer()
 {
-    auto ready_buffer = m_buffer_pool->dequeue_hw_buffer(HAILO_INFINITE_TIMEOUT);
-    if (!ready_buffer) {
-        // Log on caller (if unexpected status)
-        return ready_buffer.status();
+    if (m_pending_buffers_begin == m_pending_buffers_end) {
+        // Take all of the buffers written by the user at once
+        auto count = m_buffer_pool->dequeue_hw_buffers(m_pending_buffers.data(), m_pending_buffers.size(),
+            HAILO_INFINITE_TIMEOUT);
+        if (!count) {
+            // Log on caller (if unexpected status)
+            return count.status();
+        }
+        m_pending_buffers_begin = 0;
+        m_pending_buffers_end = count.value();
     }
 
+    auto ready_buffer = m_pending_buffers[m_pending_buffers_begin++];
     hailo_status status = HAILO_UNINITIALIZED;
-    if (RemoteProcessBufferPool::SharedBuffer::Type::DATA == ready_buffer->type) {
-        status = m_base_stream->write(ready_buffer->buffer);
-    } else if (RemoteProcessBufferPool::SharedBuffer::Type::FLUSH == ready_buffer->type) {
-        ready_buffer->type = RemoteProcessBufferPool::SharedBuffer::Type::DATA; // clear flush mark.
+    if (RemoteProcessBufferPool::SharedBuffer::Type::DATA == ready_buffer.type) {
+        status = m_base_stream->write(ready_buffer.buffer);
+    } else if (RemoteProcessBufferPool::SharedBuffer::Type::FLUSH == ready_buffer.type) {
+        ready_buffer.type = RemoteProcessBufferPool::SharedBuffer::Type::DATA; // clear flush mark.
         status = m_base_stream->flush();
     } else {
         LOGGER__ERROR("Got invalid buffer type");
@@ -369,7 +368,7 @@ hailo_status RemoteProcessInputStream::write_single_buffer()
 
     if (HAILO_SUCCESS != status) {
         // If the read fails, we need to return the buffer to the host queue for later writes.
-        auto enqueue_status = m_buffer_pool->enqueue_host_buffer(*ready_buffer);
+        auto enqueue_status = m_buffer_pool->enqueue_host_buffer(ready_buffer);
         if (HAILO_SUCCESS != enqueue_status) {
             LOGGER__ERROR("Fail to enqueue buffer back after read was fail {}", enqueue_status);
             // continue
@@ -379,7 +378,7 @@ hailo_status RemoteProcessInputStream::write_single_buffer()
     }
 
     // buffer is now available
-    status = m_buffer_pool->enqueue_host_buffer(*ready_buffer);
+    status = m_buffer_pool->enqueue_host_buffer(ready_buffer);
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -500,6 +499,8 @@ RemoteProcessOutputStream::RemoteProcessOutputStream(std::shared_ptr<OutputStrea
         OutputStreamBase(base_stream->get_layer_info(), base_stream->get_core_op_activated_event(), status),
         m_base_stream(base_stream),
         m_timeout(m_base_stream->get_timeout()),
+        m_pending_buffers_begin(0),
+        m_pending_buffers_end(0),
         m_wait_for_activation(m_base_stream->get_core_op_activated_event(), thread_stop_event)
 {
     if (HAILO_SUCCESS != status) {
@@ -533,6 +534,7 @@ RemoteProcessOutputStream::RemoteProcessOutputStream(std::shared_ptr<OutputStrea
         return;
     }
     m_buffer_pool = buffer_pool.release();
+    m_pending_buffers.resize(m_buffer_pool->capacity());
 
 
     // Launch the thread
@@ -569,27 +571,29 @@ void RemoteProcessOutputStream::run_read_thread()
 
 hailo_status RemoteProcessOutputStream::read_single_buffer()
 {
-    auto ready_buffer = m_buffer_pool->dequeue_hw_buffer(HAILO_INFINITE_TIMEOUT);
-    if (!ready_buffer) {
-        // Log on caller (if unexpected status)
-        return ready_buffer.status();
+    if (m_pending_buffers_begin == m_pending_buffers_end) {
+        // Take all of the buffers released by the user at once
+        auto count = m_buffer_pool->dequeue_hw_buffers(m_pending_buffers.data(), m_pending_buffers.size(),
+            HAILO_INFINITE_TIMEOUT);
+        if (!count) {
+            // Log on caller (if unexpected status)
+            return count.status();
+        }
+        m_pending_buffers_begin = 0;
+        m_pending_buffers_end = count.value();
     }
 
-    assert(RemoteProcessBufferPool::SharedBuffer::Type::DATA == ready_buffer->type);
-    auto status = m_base_stream->read(ready_buffer->buffer);
+    const auto &ready_buffer = m_pending_buffers[m_pending_buffers_begin];
+    assert(RemoteProcessBufferPool::SharedBuffer::Type::DATA == ready_buffer.type);
+    auto status = m_base_stream->read(ready_buffer.buffer);
     if (HAILO_SUCCESS != status) {
-        // If the read fails, we need to return the buffer to the hw queue for later reads.
-        auto enqueue_status = m_buffer_pool->enqueue_hw_buffer(*ready_buffer);
-        if (HAILO_SUCCESS != enqueue_status) {
-            LOGGER__ERROR("Fail to enqueue buffer back after read was fail {}", enqueue_status);
-            // continue
-        }
-
+        // If the read fails, the buffer is kept pending for later reads.
         return status;
     }
 
     // buffer is now available
-    status = m_buffer_pool->enqueue_host_buffer(*ready_buffer);
+    status = m_buffer_pool->enqueue_host_buffer(ready_buffer);
+    m_pending_buffers_begin++;
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -18,10 +18,13 @@
 #include "stream_common/stream_internal.hpp"
 
 #include "common/utils.hpp"
-#include "common/circular_buffer.hpp"
 
 #include "hailo/buffer.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+
 namespace hailort
 {
 
@@ -39,14 +42,15 @@ public:
     };
 
     // We always use unique_ptr to make sure the buffer is allocated on shared memory.
-    // queue_size must be some (power-of-2 minus 1) in order to fit CircularArray.
     static Expected<std::unique_ptr<RemoteProcessBufferPool>> create(hailo_stream_direction_t stream_direction,
         size_t frame_size, size_t queue_size);
 
     RemoteProcessBufferPool(hailo_stream_direction_t stream_direction, size_t frame_size, size_t queue_size,
         hailo_status &status);
 
-    Expected<SharedBuffer> dequeue_hw_buffer(std::chrono::milliseconds timeout);
+    // Called by the stream's thread (on the parent process). Dequeues all of the ready buffers (up to max_count) at
+    // once, waiting only if there are none.
+    Expected<size_t> dequeue_hw_buffers(SharedBuffer *buffers, size_t max_count, std::chrono::milliseconds timeout);
     hailo_status enqueue_hw_buffer(SharedBuffer buffer);
 
     Expected<SharedBuffer> dequeue_host_buffer(std::chrono::milliseconds timeout);
@@ -62,47 +66,114 @@ public:
         return m_hw_buffers_queue.capacity();
     }
 
+    // Note: We use a fixed size array to avoid dynamic memory allocation, needed for shared memory.
+    static constexpr size_t BACKING_ARRAY_LENGTH = 1024;
+
 private:
 
+    // Single producer single consumer ring - each of the queues has a single side on the stream's thread, and a single
+    // side on the user's side (serialized by m_user_mutex). Only the consumer waits (for buffers to be pushed) - the
+    // producer wakes it only when it is actually sleeping, which happens only once the ring drained.
+    class BufferRing final {
+    public:
+        explicit BufferRing(size_t capacity) :
+            m_capacity(capacity), m_head(0), m_tail(0)
+        {
+            assert(capacity <= BACKING_ARRAY_LENGTH);
+        }
+
+        size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        size_t size() const
+        {
+            return m_tail.load() - m_head.load();
+        }
+
+        SharedFutex &pushed_futex()
+        {
+            return m_pushed_futex;
+        }
+
+        bool push(const SharedBuffer &buffer)
+        {
+            const auto tail = m_tail.load(std::memory_order_relaxed);
+            if ((tail - m_head.load(std::memory_order_acquire)) == m_capacity) {
+                return false;
+            }
+
+            m_buffers[tail % m_capacity] = buffer;
+            m_tail.store(tail + 1, std::memory_order_release);
+            m_pushed_futex.notify();
+            return true;
+        }
+
+        size_t pop(SharedBuffer *buffers, size_t max_count)
+        {
+            const auto head = m_head.load(std::memory_order_relaxed);
+            const auto count = std::min(max_count, m_tail.load(std::memory_order_acquire) - head);
+            for (size_t i = 0; i < count; i++) {
+                buffers[i] = m_buffers[(head + i) % m_capacity];
+            }
+            m_head.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+    private:
+        std::array<SharedBuffer, BACKING_ARRAY_LENGTH> m_buffers;
+        const size_t m_capacity;
+        // Indices grow monotonically (a slot is the index modulo the capacity). m_head is written only by the consumer and
+        // m_tail only by the producer.
+        std::atomic<size_t> m_head;
+        std::atomic<size_t> m_tail;
+        SharedFutex m_pushed_futex;
+    };
+
+    // Waits (as the consumer of ring) until cond is met
     template<typename CondFunc>
-    hailo_status cv_wait_for(std::unique_lock<RecursiveSharedMutex> &lock,
-        std::chrono::milliseconds timeout, CondFunc &&cond)
+    hailo_status wait_for(BufferRing &ring, std::chrono::milliseconds timeout, CondFunc &&cond)
     {
-        assert(lock.owns_lock());
-        bool done = m_cv.wait_for(lock, timeout, [this, cond]() {
-            if (m_is_aborted) {
-                return true;
+        const bool is_infinite = (HAILO_INFINITE_TIMEOUT == timeout);
+        const auto deadline = std::chrono::steady_clock::now() + (is_infinite ? std::chrono::milliseconds(0) : timeout);
+        while (true) {
+            // The sequence is read before checking the condition, so a push after the check won't be missed
+            const auto sequence = ring.pushed_futex().sequence();
+            if (m_is_aborted.load()) {
+                return HAILO_STREAM_ABORT;
+            }
+            if (cond()) {
+                return HAILO_SUCCESS;
             }
 
-            return cond();
-        });
-        CHECK(done, HAILO_TIMEOUT, "Timeout waiting on cond variable");
-        if (m_is_aborted) {
-            return HAILO_STREAM_ABORT;
+            auto remaining = HAILO_INFINITE_TIMEOUT;
+            if (!is_infinite) {
+                const auto now = std::chrono::steady_clock::now();
+                CHECK(now < deadline, HAILO_TIMEOUT, "Timeout waiting for remote process buffer");
+                // Rounded up, so the last wait doesn't spin with a zero timeout
+                remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) +
+                    std::chrono::milliseconds(1);
+            }
+            ring.pushed_futex().wait(sequence, remaining);
         }
-        return HAILO_SUCCESS;
     }
 
     // Guards memory allocation.
     std::vector<BufferPtr> m_buffers_guard;
 
-    // Note: We use a fixed size array to avoid dynamic memory allocation, needed for shared memory.
-    //       CircularArrays support working with sizes less than the backing array length.
-    static constexpr size_t BACKING_ARRAY_LENGTH = 1024;
-    using BufferQueue = CircularArray<SharedBuffer, IsNotPow2Tag, std::array<SharedBuffer, BACKING_ARRAY_LENGTH>>;
-
     // On input streams - buffers with user data, ready to be sent to the hw.
     // On output streams - buffers that are ready, the stream can receive into them.
-    BufferQueue m_hw_buffers_queue;
+    BufferRing m_hw_buffers_queue;
 
     // On input streams - buffers that are ready, the user can write into them.
     // On output streams - buffers with data from the hw, ready to be read by the user
-    BufferQueue m_host_buffers_queue;
+    BufferRing m_host_buffers_queue;
 
-    RecursiveSharedMutex m_mutex;
-    SharedConditionVariable m_cv;
+    // Serializes the user's side of the queues (which may be used by several threads/processes).
+    RecursiveSharedMutex m_user_mutex;
 
-    bool m_is_aborted;
+    std::atomic<bool> m_is_aborted;
 };
 
 
@@ -151,6 +222,11 @@ protected:
     // Store as unique_ptr to allow shared memory
     std::unique_ptr<RemoteProcessBufferPool> m_buffer_pool;
 
+    // The hw buffers dequeued at once by the write thread, written from m_pending_buffers_begin on.
+    std::vector<RemoteProcessBufferPool::SharedBuffer> m_pending_buffers;
+    size_t m_pending_buffers_begin;
+    size_t m_pending_buffers_end;
+
     WaitOrShutdown m_wait_for_activation;
 };
 
@@ -197,6 +273,11 @@ protected:
 
     std::unique_ptr<RemoteProcessBufferPool> m_buffer_pool;
 
+    // The hw buffers dequeued at once by the read thread, read into from m_pending_buffers_begin on.
+    std::vector<RemoteProcessBufferPool::SharedBuffer> m_pending_buffers;
+    size_t m_pending_buffers_begin;
+    size_t m_pending_buffers_end;
+
     WaitOrShutdown m_wait_for_activation;
 };
 
@@ -34,6 +34,12 @@ Expected<size_t> InputStream::get_async_max_queue_size() const
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<underlying_waitable_handle_t> InputStream::get_async_ready_handle()
+{
+    LOGGER__ERROR("get_async_ready_handle not implemented for sync API");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
 std::string InputStream::to_string() const
 {
     std::stringstream string_stream;
@@ -59,6 +65,12 @@ Expected<size_t> OutputStream::get_async_max_queue_size() const
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<underlying_waitable_handle_t> OutputStream::get_async_ready_handle()
+{
+    LOGGER__ERROR("get_async_ready_handle not implemented for sync API");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
 std::string OutputStream::to_string() const
 {
     std::stringstream string_stream;
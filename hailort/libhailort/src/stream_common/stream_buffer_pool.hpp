@@ -16,7 +16,9 @@
 namespace hailort
 {
 
-// This class is NOT thread safe. All function calls must be synchronized.
+// dequeue (and max_queue_size) may be called from one thread while enqueue is called from another thread (e.g. the user
+// thread dequeues buffers, and the interrupts thread enqueues them back once the transfer is done) without any lock.
+// Any other concurrent calls must be synchronized.
 class StreamBufferPool {
 public:
     virtual ~StreamBufferPool() = default;
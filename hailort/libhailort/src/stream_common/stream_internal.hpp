@@ -51,10 +51,8 @@ typedef struct hailo_mux_info_t{
     uint32_t row_counter;
     uint32_t rows_gcd;
     uint32_t offset;
-    uint32_t current_offset; // Current demuxing offset
     uint32_t successors_count;
     struct hailo_mux_info_t *successors[HailoRTCommon::MAX_MUX_PREDECESSORS];
-    void* buffer;
 } hailo_mux_info_t;
 
 
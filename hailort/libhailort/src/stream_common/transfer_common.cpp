@@ -22,11 +22,17 @@ TransferBuffer::TransferBuffer() :
 {}
 
 TransferBuffer::TransferBuffer(hailo_dma_buffer_t dmabuf) :
+    TransferBuffer(dmabuf, dmabuf.size, 0)
+{}
+
+TransferBuffer::TransferBuffer(hailo_dma_buffer_t dmabuf, size_t size, size_t offset) :
     m_dmabuf(dmabuf),
-    m_size(dmabuf.size),
-    m_offset(0),
+    m_size(size),
+    m_offset(offset),
     m_type(TransferBufferType::DMABUF)
-{}
+{
+    assert((m_offset + m_size) <= dmabuf.size);
+}
 
 TransferBuffer::TransferBuffer(MemoryView base_buffer, size_t size, size_t offset) :
     m_base_buffer(base_buffer),
@@ -50,11 +56,22 @@ Expected<MemoryView> TransferBuffer::base_buffer()
     return Expected<MemoryView>(m_base_buffer);
 }
 
-Expected<vdma::MappedBufferPtr> TransferBuffer::map_buffer(HailoRTDriver &driver, HailoRTDriver::DmaDirection direction)
+Expected<hailo_dma_buffer_t> TransferBuffer::dmabuf() const
+{
+    CHECK(TransferBufferType::DMABUF == m_type, HAILO_INTERNAL_FAILURE,
+        "dmabuf is supported only for DMABUF type TransferBuffer");
+
+    return Expected<hailo_dma_buffer_t>(m_dmabuf);
+}
+
+Expected<vdma::MappedBufferPtr> TransferBuffer::map_buffer(HailoRTDriver &driver, HailoRTDriver::DmaDirection direction,
+    vdma::MappedBuffersCache *mapped_buffers_cache)
 {
     CHECK_AS_EXPECTED(!m_mappings, HAILO_INTERNAL_FAILURE, "Buffer is already mapped");
     if (TransferBufferType::DMABUF == m_type) {
-        auto mapped_buffer = vdma::MappedBuffer::create_shared_from_dmabuf(m_dmabuf.fd, m_dmabuf.size, driver, direction);
+        auto mapped_buffer = (nullptr != mapped_buffers_cache) ?
+            mapped_buffers_cache->get_dmabuf_mapping(m_dmabuf, direction) :
+            vdma::MappedBuffer::create_shared_from_dmabuf(m_dmabuf.fd, m_dmabuf.size, driver, direction);
         CHECK_EXPECTED(mapped_buffer);
 
         m_mappings = mapped_buffer.value();
@@ -67,6 +84,12 @@ Expected<vdma::MappedBufferPtr> TransferBuffer::map_buffer(HailoRTDriver &driver
             auto dma_able_buffer_exp = storage->get()->get_dma_able_buffer();
             CHECK_EXPECTED(dma_able_buffer_exp);
             dma_able_buffer = dma_able_buffer_exp.release();
+        } else if (nullptr != mapped_buffers_cache) {
+            auto mapped_buffer = mapped_buffers_cache->get_mapping(m_base_buffer, direction);
+            CHECK_EXPECTED(mapped_buffer);
+
+            m_mappings = mapped_buffer.value();
+            return mapped_buffer;
         } else {
             auto dma_able_buffer_exp = vdma::DmaAbleBuffer::create_from_user_address(m_base_buffer.data(), m_base_buffer.size());
             CHECK_EXPECTED(dma_able_buffer_exp);
@@ -81,6 +104,26 @@ Expected<vdma::MappedBufferPtr> TransferBuffer::map_buffer(HailoRTDriver &driver
     }
 }
 
+hailo_status TransferBuffer::prefetch_mapping(vdma::MappedBuffersCache &mapped_buffers_cache,
+    HailoRTDriver::DmaDirection direction)
+{
+    if (TransferBufferType::DMABUF == m_type) {
+        TRY(auto mapped_buffer, mapped_buffers_cache.get_dmabuf_mapping(m_dmabuf, direction));
+        (void)mapped_buffer;
+        return HAILO_SUCCESS;
+    }
+
+    const auto storage_key = std::make_pair(m_base_buffer.data(), m_base_buffer.size());
+    if (BufferStorageResourceManager::get_resource(storage_key)) {
+        // Already mapped by the user
+        return HAILO_SUCCESS;
+    }
+
+    TRY(auto mapped_buffer, mapped_buffers_cache.get_mapping(m_base_buffer, direction));
+    (void)mapped_buffer;
+    return HAILO_SUCCESS;
+}
+
 hailo_status TransferBuffer::copy_to(MemoryView buffer)
 {
     CHECK(buffer.size() == m_size, HAILO_INTERNAL_FAILURE, "buffer size {} must be {}", buffer.size(), m_size);
@@ -135,4 +178,20 @@ std::pair<MemoryView, MemoryView> TransferBuffer::get_continuous_parts()
     }
 }
 
+std::vector<MemoryView> TransferBuffers::memory_views()
+{
+    std::vector<MemoryView> views;
+    for (auto &buffer : *this) {
+        if (TransferBufferType::MEMORYVIEW != buffer.type()) {
+            return {};
+        }
+        const auto continuous_parts = buffer.get_continuous_parts();
+        views.emplace_back(continuous_parts.first);
+        if (!continuous_parts.second.empty()) {
+            views.emplace_back(continuous_parts.second);
+        }
+    }
+    return views;
+}
+
 } /* namespace hailort */
@@ -15,8 +15,15 @@
 
 #include "vdma/driver/hailort_driver.hpp"
 #include "vdma/memory/mapped_buffer.hpp"
+#include "vdma/memory/mapped_buffers_cache.hpp"
 #include "common/os_utils.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
 namespace hailort
 {
 
@@ -32,14 +39,22 @@ public:
 
     TransferBuffer();
     TransferBuffer(hailo_dma_buffer_t dmabuf);
+    TransferBuffer(hailo_dma_buffer_t dmabuf, size_t size, size_t offset);
     TransferBuffer(MemoryView base_buffer);
     TransferBuffer(MemoryView base_buffer, size_t size, size_t offset);
 
     Expected<MemoryView> base_buffer();
+    Expected<hailo_dma_buffer_t> dmabuf() const;
     size_t offset() const { return m_offset; }
     size_t size() const { return m_size; }
 
-    Expected<vdma::MappedBufferPtr> map_buffer(HailoRTDriver &driver, HailoRTDriver::DmaDirection direction);
+    // If mapped_buffers_cache is given, user buffers mappings are taken from (and kept in) the cache.
+    Expected<vdma::MappedBufferPtr> map_buffer(HailoRTDriver &driver, HailoRTDriver::DmaDirection direction,
+        vdma::MappedBuffersCache *mapped_buffers_cache = nullptr);
+
+    // Maps the buffer into the cache (without keeping the mapping in this object), so a following map_buffer with the
+    // same cache won't need to map it. Buffers mapped by the user (using dma_map) are skipped.
+    hailo_status prefetch_mapping(vdma::MappedBuffersCache &mapped_buffers_cache, HailoRTDriver::DmaDirection direction);
 
     hailo_status copy_to(MemoryView buffer);
     hailo_status copy_from(const MemoryView buffer);
@@ -47,6 +62,8 @@ public:
     TransferBufferType type () const {return m_type;}
 
 private:
+    // Reads the continuous parts of the buffers
+    friend class TransferBuffers;
 
     bool is_wrap_around() const;
 
@@ -71,13 +88,138 @@ private:
     vdma::MappedBufferPtr m_mappings;
 };
 
+// The buffers of a transfer. Almost every transfer has 1-2 buffers (the user buffer, and maybe a bounce buffer for its
+// unaligned part), so they are kept inline - only transfers with more buffers allocate.
+class TransferBuffers final {
+public:
+    static constexpr size_t INLINE_CAPACITY = 2;
+
+    TransferBuffers() : m_size(0), m_is_inline(true) {}
+
+    size_t size() const { return m_size; }
+    bool empty() const { return 0 == m_size; }
+
+    TransferBuffer *begin() { return m_is_inline ? m_inline_buffers.data() : m_buffers.data(); }
+    TransferBuffer *end() { return begin() + m_size; }
+    const TransferBuffer *begin() const { return m_is_inline ? m_inline_buffers.data() : m_buffers.data(); }
+    const TransferBuffer *end() const { return begin() + m_size; }
+
+    TransferBuffer &operator[](size_t index) { return begin()[index]; }
+    const TransferBuffer &operator[](size_t index) const { return begin()[index]; }
+
+    // The continuous parts of the buffers, by their order. Empty if any of the buffers isn't a memory view (a dmabuf)
+    std::vector<MemoryView> memory_views();
+
+    void reserve(size_t capacity)
+    {
+        if (capacity > INLINE_CAPACITY) {
+            move_to_heap();
+            m_buffers.reserve(capacity);
+        }
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        if (m_is_inline && (INLINE_CAPACITY == m_size)) {
+            move_to_heap();
+        }
+
+        if (m_is_inline) {
+            m_inline_buffers[m_size] = TransferBuffer(std::forward<Args>(args)...);
+        } else {
+            m_buffers.emplace_back(std::forward<Args>(args)...);
+        }
+        m_size++;
+    }
+
+private:
+    void move_to_heap()
+    {
+        if (!m_is_inline) {
+            return;
+        }
+
+        m_buffers.reserve(INLINE_CAPACITY * 2);
+        for (size_t i = 0; i < m_size; i++) {
+            m_buffers.emplace_back(std::move(m_inline_buffers[i]));
+        }
+        m_is_inline = false;
+    }
+
+    std::array<TransferBuffer, INLINE_CAPACITY> m_inline_buffers;
+    std::vector<TransferBuffer> m_buffers;
+    size_t m_size;
+    bool m_is_inline;
+};
+
 // Internal function, wrapper to the user callbacks, accepts the callback status as an argument.
 using TransferDoneCallback = std::function<void(hailo_status)>;
 
+// Shared by the transfers of an infer request and by its issuer (e.g. an AsyncInferJob), so the issuer can drop the
+// request before it is sent to the device: once it is cancelled, or once its deadline passed. Only the scheduler checks
+// it, when the request is dequeued from the core op's queue.
+// The boundary channels also record on it when the request's first input transfer was launched and when its last
+// output transfer completed, so the issuer can report the frame's latency on the device.
+class InferRequestControl final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit InferRequestControl(Clock::time_point deadline = Clock::time_point::max()) :
+        m_is_cancelled(false), m_deadline(deadline), m_h2d_start_time(0), m_d2h_complete_time(0)
+    {}
+
+    void cancel() { m_is_cancelled.store(true); }
+
+    // Returns the status the request is dropped with, or HAILO_SUCCESS if the request should be sent
+    hailo_status get_drop_status(Clock::time_point now) const
+    {
+        if (m_is_cancelled.load()) {
+            return HAILO_FRAME_CANCELLED;
+        }
+        return (now > m_deadline) ? HAILO_FRAME_EXPIRED : HAILO_SUCCESS;
+    }
+
+    // Called on each input transfer once it is launched - only the first one is kept
+    void on_h2d_transfer_launched(Clock::time_point now)
+    {
+        Clock::rep unset = 0;
+        m_h2d_start_time.compare_exchange_strong(unset, now.time_since_epoch().count());
+    }
+
+    // Called on each output transfer once it is completed - the latest one is kept (the output channels complete
+    // independently of each other)
+    void on_d2h_transfer_completed(Clock::time_point now)
+    {
+        const auto now_count = now.time_since_epoch().count();
+        auto current = m_d2h_complete_time.load();
+        while ((current < now_count) && !m_d2h_complete_time.compare_exchange_weak(current, now_count)) {}
+    }
+
+    // The time_point is default (the clock's epoch) if no transfer was recorded
+    Clock::time_point get_h2d_start_time() const { return Clock::time_point(Clock::duration(m_h2d_start_time.load())); }
+    Clock::time_point get_d2h_complete_time() const { return Clock::time_point(Clock::duration(m_d2h_complete_time.load())); }
+
+private:
+    std::atomic<bool> m_is_cancelled;
+    const Clock::time_point m_deadline;
+    std::atomic<Clock::rep> m_h2d_start_time;
+    std::atomic<Clock::rep> m_d2h_complete_time;
+};
+using InferRequestControlPtr = std::shared_ptr<InferRequestControl>;
+
+// Move-only - a request is moved along the stream layers until it is launched (copying it would copy its callback).
 struct TransferRequest {
-    std::vector<TransferBuffer> transfer_buffers;
+    TransferBuffers transfer_buffers;
     TransferDoneCallback callback;
+    // The control of the infer request the transfer belongs to (may be null)
+    InferRequestControlPtr control;
     TransferRequest() = default;
+    TransferRequest(TransferRequest &&) = default;
+    TransferRequest &operator=(TransferRequest &&) = default;
+    TransferRequest(const TransferRequest &) = delete;
+    TransferRequest &operator=(const TransferRequest &) = delete;
     TransferRequest(TransferBuffer &&transfer_buffers_arg, const TransferDoneCallback &callback_arg):
         transfer_buffers(), callback(callback_arg)
     {
@@ -88,10 +230,18 @@ struct TransferRequest {
     {
         transfer_buffers.emplace_back(std::move(transfer_buffers_arg));
     }
-    TransferRequest(std::vector<TransferBuffer> &&transfer_buffers_arg, const TransferDoneCallback &callback_arg) :
+    TransferRequest(TransferBuffers &&transfer_buffers_arg, const TransferDoneCallback &callback_arg) :
         transfer_buffers(std::move(transfer_buffers_arg)), callback(callback_arg)
     {}
 
+    // An explicit copy, for callers that must keep the request in case launching it fails
+    TransferRequest copy() const
+    {
+        TransferRequest request(TransferBuffers(transfer_buffers), callback);
+        request.control = control;
+        return request;
+    }
+
     size_t get_total_transfer_size() const {
         size_t total_transfer_size = 0;
         for (size_t i = 0; i < transfer_buffers.size(); i++) {
@@ -111,12 +261,16 @@ struct TransferRequest {
     }
 };
 
+// Move-only, as its transfers
 struct InferRequest {
-    // Transfer for each stream
-    std::unordered_map<std::string, TransferRequest> transfers;
+    // Transfer for each stream, indexed by the stream's index in the core op (see CoreOp::get_stream_index)
+    std::vector<TransferRequest> transfers;
 
     // Callback to be called when all transfer finishes
     TransferDoneCallback callback;
+
+    // May be null (see InferRequestControl)
+    InferRequestControlPtr control;
 };
 
 } /* namespace hailort */
@@ -0,0 +1,544 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file quantization_kernels.cpp
+ * @brief Implementation of the vectorized quantization kernels
+ **/
+
+#include "transform/quantization_kernels.hpp"
+#include "hailo/quantization.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <limits>
+
+// The x86 kernels are compiled with target attributes (so the library itself doesn't require AVX), and chosen at runtime
+// according to the CPU. On aarch64 NEON is always available.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAILO_QUANTIZATION_X86_KERNELS
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define HAILO_QUANTIZATION_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+
+namespace hailort
+{
+
+/* Scalar kernels */
+
+template <typename Q>
+static void dequantize_in_place_scalar(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    Quantization::dequantize_output_buffer_in_place<float32_t, Q>(dst_ptr, offset, elements_count, qp_zp, qp_scale);
+}
+
+template <typename Q>
+static void dequantize_to_float16_in_place_scalar(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    Quantization::dequantize_output_buffer_to_float16_in_place<Q>(dst_ptr, offset, elements_count, qp_zp, qp_scale);
+}
+
+template <typename Q>
+static void quantize_scalar(const float32_t *src_ptr, Q *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    Quantization::quantize_input_buffer<float32_t, Q>(const_cast<float32_t*>(src_ptr), dst_ptr, elements_count, quant_info);
+}
+
+// The identity qp isn't clipped by Quantization::quantize_input_buffer, so the vectorized kernels clip it to the whole
+// float range instead.
+static void get_quantize_limits(const hailo_quant_info_t &quant_info, float32_t &limval_min, float32_t &limval_max)
+{
+    if (Quantization::is_identity_qp(quant_info)) {
+        limval_min = -std::numeric_limits<float32_t>::infinity();
+        limval_max = std::numeric_limits<float32_t>::infinity();
+    } else {
+        limval_min = quant_info.limvals_min;
+        limval_max = quant_info.limvals_max;
+    }
+}
+
+/*
+ * Notes on the in-place de-quantization:
+ * The Q elements are packed at the start of the buffer, and each float32 (or float16) element is written at a higher
+ * (or the same) address than its Q element. So the buffer is de-quantized from its end - each block is loaded before it is stored,
+ * and the stores of a block never reach the Q elements of the blocks before it.
+ */
+
+#ifdef HAILO_QUANTIZATION_X86_KERNELS
+
+/* AVX2 kernels */
+
+__attribute__((target("avx2")))
+static inline __m256 dequantize_avx2(__m256i values, __m256 qp_zp, __m256 qp_scale)
+{
+    return _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(values), qp_zp), qp_scale);
+}
+
+__attribute__((target("avx2")))
+static void dequantize_uint8_in_place_avx2(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm256_set1_ps(qp_zp);
+    const auto scale = _mm256_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, dequantize_avx2(values, zp, scale));
+    }
+    dequantize_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+__attribute__((target("avx2")))
+static void dequantize_uint16_in_place_avx2(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm256_set1_ps(qp_zp);
+    const auto scale = _mm256_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, dequantize_avx2(values, zp, scale));
+    }
+    dequantize_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+// Returns the 8 quantized values packed (with unsigned saturation) to uint16
+__attribute__((target("avx2")))
+static inline __m128i quantize_avx2(const float32_t *src_ptr, __m256 limval_min, __m256 limval_max, __m256 qp_zp,
+    __m256 qp_scale)
+{
+    auto values = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src_ptr), limval_min), limval_max);
+    values = _mm256_add_ps(_mm256_div_ps(values, qp_scale), qp_zp);
+    const auto rounded = _mm256_cvtps_epi32(_mm256_round_ps(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    return _mm_packus_epi32(_mm256_castsi256_si128(rounded), _mm256_extracti128_si256(rounded, 1));
+}
+
+__attribute__((target("avx2")))
+static void quantize_uint8_avx2(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = _mm256_set1_ps(limval_min);
+    const auto max = _mm256_set1_ps(limval_max);
+    const auto zp = _mm256_set1_ps(quant_info.qp_zp);
+    const auto scale = _mm256_set1_ps(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        const auto values = quantize_avx2(src_ptr + i, min, max, zp, scale);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + i), _mm_packus_epi16(values, values));
+    }
+    quantize_scalar<uint8_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+__attribute__((target("avx2")))
+static void quantize_uint16_avx2(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = _mm256_set1_ps(limval_min);
+    const auto max = _mm256_set1_ps(limval_max);
+    const auto zp = _mm256_set1_ps(quant_info.qp_zp);
+    const auto scale = _mm256_set1_ps(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + i), quantize_avx2(src_ptr + i, min, max, zp, scale));
+    }
+    quantize_scalar<uint16_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+/* AVX2 + F16C kernels - the float16 conversion rounds to nearest even, as Quantization::float32_to_float16 does */
+
+__attribute__((target("avx2,f16c")))
+static void dequantize_uint8_to_float16_in_place_avx2(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm256_set1_ps(qp_zp);
+    const auto scale = _mm256_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm256_cvtps_ph(dequantize_avx2(values, zp, scale), _MM_FROUND_TO_NEAREST_INT));
+    }
+    dequantize_to_float16_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+__attribute__((target("avx2,f16c")))
+static void dequantize_uint16_to_float16_in_place_avx2(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm256_set1_ps(qp_zp);
+    const auto scale = _mm256_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm256_cvtps_ph(dequantize_avx2(values, zp, scale), _MM_FROUND_TO_NEAREST_INT));
+    }
+    dequantize_to_float16_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+/* AVX-512 kernels */
+
+__attribute__((target("avx512f")))
+static inline __m512 dequantize_avx512(__m512i values, __m512 qp_zp, __m512 qp_scale)
+{
+    return _mm512_mul_ps(_mm512_sub_ps(_mm512_cvtepi32_ps(values), qp_zp), qp_scale);
+}
+
+__attribute__((target("avx512f")))
+static void dequantize_uint8_in_place_avx512(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm512_set1_ps(qp_zp);
+    const auto scale = _mm512_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm512_storeu_ps(dst + i, dequantize_avx512(values, zp, scale));
+    }
+    dequantize_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+__attribute__((target("avx512f")))
+static void dequantize_uint16_in_place_avx512(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm512_set1_ps(qp_zp);
+    const auto scale = _mm512_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, dequantize_avx512(values, zp, scale));
+    }
+    dequantize_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+// Returns the 16 quantized values, clamped to be non-negative (so they can be narrowed with unsigned saturation)
+__attribute__((target("avx512f")))
+static inline __m512i quantize_avx512(const float32_t *src_ptr, __m512 limval_min, __m512 limval_max, __m512 qp_zp,
+    __m512 qp_scale)
+{
+    auto values = _mm512_min_ps(_mm512_max_ps(_mm512_loadu_ps(src_ptr), limval_min), limval_max);
+    values = _mm512_add_ps(_mm512_div_ps(values, qp_scale), qp_zp);
+    const auto rounded = _mm512_cvtps_epi32(_mm512_roundscale_ps(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    return _mm512_max_epi32(rounded, _mm512_setzero_si512());
+}
+
+__attribute__((target("avx512f")))
+static void quantize_uint8_avx512(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = _mm512_set1_ps(limval_min);
+    const auto max = _mm512_set1_ps(limval_max);
+    const auto zp = _mm512_set1_ps(quant_info.qp_zp);
+    const auto scale = _mm512_set1_ps(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + i),
+            _mm512_cvtusepi32_epi8(quantize_avx512(src_ptr + i, min, max, zp, scale)));
+    }
+    quantize_scalar<uint8_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+__attribute__((target("avx512f")))
+static void quantize_uint16_avx512(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = _mm512_set1_ps(limval_min);
+    const auto max = _mm512_set1_ps(limval_max);
+    const auto zp = _mm512_set1_ps(quant_info.qp_zp);
+    const auto scale = _mm512_set1_ps(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_ptr + i),
+            _mm512_cvtusepi32_epi16(quantize_avx512(src_ptr + i, min, max, zp, scale)));
+    }
+    quantize_scalar<uint16_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+__attribute__((target("avx512f")))
+static void dequantize_uint8_to_float16_in_place_avx512(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm512_set1_ps(qp_zp);
+    const auto scale = _mm512_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+            _mm512_cvtps_ph(dequantize_avx512(values, zp, scale), _MM_FROUND_TO_NEAREST_INT));
+    }
+    dequantize_to_float16_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+__attribute__((target("avx512f")))
+static void dequantize_uint16_to_float16_in_place_avx512(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 16;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = _mm512_set1_ps(qp_zp);
+    const auto scale = _mm512_set1_ps(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        const auto values = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+            _mm512_cvtps_ph(dequantize_avx512(values, zp, scale), _MM_FROUND_TO_NEAREST_INT));
+    }
+    dequantize_to_float16_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+#endif /* HAILO_QUANTIZATION_X86_KERNELS */
+
+#ifdef HAILO_QUANTIZATION_NEON_KERNELS
+
+/* NEON kernels */
+
+static inline void dequantize_neon(uint16x8_t values, float32x4_t qp_zp, float32x4_t qp_scale, float32_t *dst_ptr)
+{
+    const auto low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(values)));
+    const auto high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(values)));
+    vst1q_f32(dst_ptr, vmulq_f32(vsubq_f32(low, qp_zp), qp_scale));
+    vst1q_f32(dst_ptr + 4, vmulq_f32(vsubq_f32(high, qp_zp), qp_scale));
+}
+
+// The float16 conversion rounds according to FPCR (to nearest even by default), as Quantization::float32_to_float16 does
+static inline void dequantize_to_float16_neon(uint16x8_t values, float32x4_t qp_zp, float32x4_t qp_scale,
+    uint16_t *dst_ptr)
+{
+    const auto low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(values)));
+    const auto high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(values)));
+    const auto low_f16 = vcvt_f16_f32(vmulq_f32(vsubq_f32(low, qp_zp), qp_scale));
+    const auto high_f16 = vcvt_f16_f32(vmulq_f32(vsubq_f32(high, qp_zp), qp_scale));
+    vst1q_u16(dst_ptr, vcombine_u16(vreinterpret_u16_f16(low_f16), vreinterpret_u16_f16(high_f16)));
+}
+
+static void dequantize_uint8_in_place_neon(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = vdupq_n_f32(qp_zp);
+    const auto scale = vdupq_n_f32(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        dequantize_neon(vmovl_u8(vld1_u8(src + i)), zp, scale, dst + i);
+    }
+    dequantize_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+static void dequantize_uint16_in_place_neon(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = vdupq_n_f32(qp_zp);
+    const auto scale = vdupq_n_f32(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        dequantize_neon(vld1q_u16(src + i), zp, scale, dst + i);
+    }
+    dequantize_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+static void dequantize_uint8_to_float16_in_place_neon(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint8_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = vdupq_n_f32(qp_zp);
+    const auto scale = vdupq_n_f32(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        dequantize_to_float16_neon(vmovl_u8(vld1_u8(src + i)), zp, scale, dst + i);
+    }
+    dequantize_to_float16_in_place_scalar<uint8_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+static void dequantize_uint16_to_float16_in_place_neon(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    const auto src = reinterpret_cast<const uint16_t*>(dst_ptr) + offset;
+    const auto dst = dst_ptr + offset;
+    const auto zp = vdupq_n_f32(qp_zp);
+    const auto scale = vdupq_n_f32(qp_scale);
+
+    uint32_t i = elements_count;
+    while (i >= BLOCK_SIZE) {
+        i -= BLOCK_SIZE;
+        dequantize_to_float16_neon(vld1q_u16(src + i), zp, scale, dst + i);
+    }
+    dequantize_to_float16_in_place_scalar<uint16_t>(dst_ptr, offset, i, qp_zp, qp_scale);
+}
+
+// Returns the 8 quantized values narrowed (with unsigned saturation) to uint16
+static inline uint16x8_t quantize_neon(const float32_t *src_ptr, float32x4_t limval_min, float32x4_t limval_max,
+    float32x4_t qp_zp, float32x4_t qp_scale)
+{
+    auto low = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr), limval_min), limval_max);
+    auto high = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr + 4), limval_min), limval_max);
+    low = vaddq_f32(vdivq_f32(low, qp_scale), qp_zp);
+    high = vaddq_f32(vdivq_f32(high, qp_scale), qp_zp);
+    // vcvtnq rounds to nearest, ties to even
+    return vcombine_u16(vqmovun_s32(vcvtnq_s32_f32(low)), vqmovun_s32(vcvtnq_s32_f32(high)));
+}
+
+static void quantize_uint8_neon(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = vdupq_n_f32(limval_min);
+    const auto max = vdupq_n_f32(limval_max);
+    const auto zp = vdupq_n_f32(quant_info.qp_zp);
+    const auto scale = vdupq_n_f32(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        vst1_u8(dst_ptr + i, vqmovn_u16(quantize_neon(src_ptr + i, min, max, zp, scale)));
+    }
+    quantize_scalar<uint8_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+static void quantize_uint16_neon(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static const uint32_t BLOCK_SIZE = 8;
+    float32_t limval_min = 0;
+    float32_t limval_max = 0;
+    get_quantize_limits(quant_info, limval_min, limval_max);
+    const auto min = vdupq_n_f32(limval_min);
+    const auto max = vdupq_n_f32(limval_max);
+    const auto zp = vdupq_n_f32(quant_info.qp_zp);
+    const auto scale = vdupq_n_f32(quant_info.qp_scale);
+
+    uint32_t i = 0;
+    for (; (i + BLOCK_SIZE) <= elements_count; i += BLOCK_SIZE) {
+        vst1q_u16(dst_ptr + i, quantize_neon(src_ptr + i, min, max, zp, scale));
+    }
+    quantize_scalar<uint16_t>(src_ptr + i, dst_ptr + i, elements_count - i, quant_info);
+}
+
+#endif /* HAILO_QUANTIZATION_NEON_KERNELS */
+
+static QuantizationKernels choose_kernels()
+{
+    const QuantizationKernels scalar_kernels = {"scalar", dequantize_in_place_scalar<uint8_t>,
+        dequantize_in_place_scalar<uint16_t>, quantize_scalar<uint8_t>, quantize_scalar<uint16_t>,
+        dequantize_to_float16_in_place_scalar<uint8_t>, dequantize_to_float16_in_place_scalar<uint16_t>};
+
+    if (is_env_variable_on(DISABLE_VECTORIZED_QUANTIZATION_ENV_VAR)) {
+        return scalar_kernels;
+    }
+
+#if defined(HAILO_QUANTIZATION_X86_KERNELS)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return {"avx512", dequantize_uint8_in_place_avx512, dequantize_uint16_in_place_avx512, quantize_uint8_avx512,
+            quantize_uint16_avx512, dequantize_uint8_to_float16_in_place_avx512,
+            dequantize_uint16_to_float16_in_place_avx512};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        // F16C is available on all of the CPUs with AVX2 in practice, but isn't implied by it
+        const auto has_f16c = __builtin_cpu_supports("f16c");
+        return {"avx2", dequantize_uint8_in_place_avx2, dequantize_uint16_in_place_avx2, quantize_uint8_avx2,
+            quantize_uint16_avx2,
+            has_f16c ? dequantize_uint8_to_float16_in_place_avx2 : dequantize_to_float16_in_place_scalar<uint8_t>,
+            has_f16c ? dequantize_uint16_to_float16_in_place_avx2 : dequantize_to_float16_in_place_scalar<uint16_t>};
+    }
+#elif defined(HAILO_QUANTIZATION_NEON_KERNELS)
+    return {"neon", dequantize_uint8_in_place_neon, dequantize_uint16_in_place_neon, quantize_uint8_neon,
+        quantize_uint16_neon, dequantize_uint8_to_float16_in_place_neon, dequantize_uint16_to_float16_in_place_neon};
+#endif
+
+    return scalar_kernels;
+}
+
+const QuantizationKernels &QuantizationKernels::get()
+{
+    static const QuantizationKernels kernels = []() {
+        const auto chosen_kernels = choose_kernels();
+        LOGGER__DEBUG("Using {} quantization kernels", chosen_kernels.name);
+        return chosen_kernels;
+    }();
+    return kernels;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file quantization_kernels.hpp
+ * @brief Vectorized uint8/uint16 <-> float32 (and uint8/uint16 -> float16) quantization kernels, selected once according
+ *        to the host CPU.
+ *
+ * The kernels compute exactly what the scalar functions in hailo/quantization.hpp compute (same operations in the same
+ * order, and round to nearest even), so choosing a kernel doesn't change the results.
+ **/
+
+#ifndef _HAILO_QUANTIZATION_KERNELS_HPP_
+#define _HAILO_QUANTIZATION_KERNELS_HPP_
+
+#include "hailo/hailort.h"
+
+
+namespace hailort
+{
+
+#define DISABLE_VECTORIZED_QUANTIZATION_ENV_VAR ("HAILO_DISABLE_VECTORIZED_QUANTIZATION")
+
+struct QuantizationKernels final
+{
+    // De-quantize in place elements_count elements of type Q, starting from offset (in elements) - same as
+    // Quantization::dequantize_output_buffer_in_place.
+    using DequantizeInPlaceFunc = void (*)(float32_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+        float32_t qp_zp, float32_t qp_scale);
+    // De-quantize in place elements_count elements of type Q to float16, starting from offset (in elements) - same as
+    // Quantization::dequantize_output_buffer_to_float16_in_place.
+    using DequantizeToFloat16InPlaceFunc = void (*)(uint16_t *dst_ptr, uint32_t offset, uint32_t elements_count,
+        float32_t qp_zp, float32_t qp_scale);
+    // Same as Quantization::quantize_input_buffer.
+    using QuantizeUint8Func = void (*)(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t elements_count,
+        const hailo_quant_info_t &quant_info);
+    using QuantizeUint16Func = void (*)(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t elements_count,
+        const hailo_quant_info_t &quant_info);
+
+    // Returns the kernels matching the host CPU (the scalar kernels if DISABLE_VECTORIZED_QUANTIZATION_ENV_VAR is set).
+    // The kernels are chosen on the first call.
+    static const QuantizationKernels &get();
+
+    const char *name;
+    DequantizeInPlaceFunc dequantize_uint8_in_place;
+    DequantizeInPlaceFunc dequantize_uint16_in_place;
+    QuantizeUint8Func quantize_uint8;
+    QuantizeUint16Func quantize_uint16;
+    DequantizeToFloat16InPlaceFunc dequantize_uint8_to_float16_in_place;
+    DequantizeToFloat16InPlaceFunc dequantize_uint16_to_float16_in_place;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_QUANTIZATION_KERNELS_HPP_ */
@@ -20,7 +20,11 @@
 #include "common/utils.hpp"
 
 #include "transform/transform_internal.hpp"
+#include "transform/transpose_kernels.hpp"
+#include "transform/transform_thread_pool.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <type_traits>
 #include <sstream>
 
@@ -30,6 +34,8 @@ namespace hailort
 
 #define RGB_FEATURES (3)
 #define F8CR_MIN_FEATURES_FOR_TRANSFORMATION (8)
+// Smaller frames are transformed on the calling thread only (waking the pool's threads costs more than it saves)
+#define MIN_FRAME_SIZE_FOR_TILED_TRANSFORM (1024 * 1024)
 
 
 Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream_direction_t stream_direction,
@@ -38,6 +44,9 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
     if (HAILO_H2D_STREAM == stream_direction) {
         CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != dst_format_type, HAILO_INVALID_ARGUMENT,
             "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT16 != src_format_type, HAILO_INVALID_ARGUMENT,
+            "src type cant be {} on input quantization (it is supported only for outputs)",
+            HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT16));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "src type is {}, while the model compiled for type {}. Input quantization is impossible with this src type.",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -48,8 +57,9 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
         }
         return ((src_format_type != HAILO_FORMAT_TYPE_AUTO) && (dst_format_type != src_format_type));
     } else {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != src_format_type, HAILO_INVALID_ARGUMENT,
-            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED((HAILO_FORMAT_TYPE_FLOAT32 != src_format_type) && (HAILO_FORMAT_TYPE_FLOAT16 != src_format_type),
+            HAILO_INVALID_ARGUMENT, "src type cant be {} on output de-quantization",
+            HailoRTCommon::get_format_type_str(src_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "The model compiled for type {}, while the dst type is {}. Output de-quantization is impossible to this dst type",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -177,6 +187,15 @@ std::string TransformContextUtils::make_pad_periph_description(hailo_3d_image_sh
     return reorder_description.str();
 }
 
+uint32_t TransformContextUtils::get_pipeline_max_threads_count()
+{
+    auto max_threads_count_env_var = get_env_variable(TRANSFORM_MAX_THREADS_ENV_VAR);
+    if (!max_threads_count_env_var) {
+        return 1;
+    }
+    return std::max(static_cast<uint32_t>(std::stoul(max_threads_count_env_var.value())), static_cast<uint32_t>(1));
+}
+
 std::string TransformContextUtils::make_transpose_description(hailo_3d_image_shape_t src_shape, hailo_3d_image_shape_t transposed_shape)
 {
     std::stringstream transpose_description;
@@ -408,20 +427,16 @@ void transform__h2d_NHWC_to_NHCW(const T *src_ptr, hailo_3d_image_shape_t *src_i
     uint32_t src_row_size = src_image_shape->width * src_image_shape->features;
     uint32_t dst_row_size = dst_image_shape->width * dst_image_shape->features;
 
-    size_t src_offset = 0;
     size_t dst_offset = 0;
     uint32_t pad_size = dst_image_shape->width - src_image_shape->width;
 
     /* transpose - switch width and channels */
     for (uint32_t r = 0; r < src_image_shape->height ; r++) {
-        for (uint32_t f = 0; f < src_image_shape->features; f++) {
-            for (uint32_t c = 0; c < src_image_shape->width; c++) {
-                src_offset = r * src_row_size + c * src_image_shape->features + f;
-                dst_offset = r * dst_row_size + f * dst_image_shape->width + c;
-                dst_ptr[dst_offset] = src_ptr[src_offset];
-            }
-            /* pad width to 8 elemnts */
-            if (pad_size != 0) {
+        TransposeKernels::transpose(src_ptr + (r * src_row_size), src_image_shape->features, dst_ptr + (r * dst_row_size),
+            dst_image_shape->width, src_image_shape->width, src_image_shape->features);
+        /* pad width to 8 elemnts */
+        if (pad_size != 0) {
+            for (uint32_t f = 0; f < src_image_shape->features; f++) {
                 dst_offset = r * dst_row_size + f * dst_image_shape->width + src_image_shape->width;
                 memset(dst_ptr + dst_offset, 0, pad_size * sizeof(T));
             }
@@ -470,15 +485,8 @@ void transform__d2h_NHCW_to_NHWC(const T *src_ptr, hailo_3d_image_shape_t *src_i
     const auto row_size_src = src_image_shape->width * src_image_shape->features;
     const auto row_size_dest = dst_image_shape->width * dst_image_shape->features;
     for (uint32_t r = 0; r < dst_image_shape->height ; r++) {
-        const auto row_offset_src = r * row_size_src;
-        const auto row_offset_dest = r * row_size_dest;
-        for (uint32_t c = 0; c < dst_image_shape->width; c++) {
-            const auto src_offset = row_offset_src + c;
-            const auto dest_offset = row_offset_dest + c * dst_image_shape->features;
-            for (uint32_t f = 0; f < dst_image_shape->features; f++) {
-                dst_ptr[dest_offset + f] = src_ptr[src_offset + f * src_image_shape->width];
-            }
-        }
+        TransposeKernels::transpose(src_ptr + (r * row_size_src), src_image_shape->width, dst_ptr + (r * row_size_dest),
+            dst_image_shape->features, dst_image_shape->features, dst_image_shape->width);
     }
 }
 
@@ -520,7 +528,11 @@ void transform__d2h_NC_to_NC(const T *src_ptr, T *dst_ptr, hailo_3d_image_shape_
     memcpy(dst_ptr, src_ptr, dst_image_shape->features * sizeof(T));
 }
 
-void transform__d2h_NMS(const uint8_t *src_ptr, uint8_t *dst_ptr, const hailo_nms_info_t &nms_info, std::vector<size_t> &chunk_offsets)
+// Merges the bboxes of all nms chunks per class, dropping the bboxes whose (quantized) score is below min_score and the
+// bboxes of the classes that aren't selected (all classes are selected if is_class_selected is empty).
+// Returns the number of uint16 elements written to dst_ptr.
+size_t transform__d2h_NMS(const uint8_t *src_ptr, uint8_t *dst_ptr, const hailo_nms_info_t &nms_info,
+    std::vector<size_t> &chunk_offsets, uint32_t min_score, const std::vector<bool> &is_class_selected)
 {
     /* Validate arguments */
     assert(NULL != src_ptr);
@@ -558,25 +570,37 @@ void transform__d2h_NMS(const uint8_t *src_ptr, uint8_t *dst_ptr, const hailo_nm
         *dst_bbox_counter = 0;
 
         dst_offset += sizeof(nms_bbox_counter_t);
+        const bool is_selected = is_class_selected.empty() || is_class_selected[class_index];
 
         for (size_t chunk_index = 0; chunk_index < nms_info.chunks_per_frame; chunk_index++) {
             // Add bbox from all chunks of current class
             src_offset = chunk_offsets[chunk_index];
             class_bboxes_count = *((nms_bbox_counter_t*)((uint8_t*)src_ptr + src_offset));
             assert(class_bboxes_count <= nms_info.max_bboxes_per_class);
-            *dst_bbox_counter = static_cast<nms_bbox_counter_t>(*dst_bbox_counter + class_bboxes_count);
 
             src_offset += sizeof(nms_bbox_counter_t);
+            if (!is_selected) {
+                chunk_offsets[chunk_index] = src_offset + (class_bboxes_count * bbox_size);
+                continue;
+            }
 
             for (bbox_index = 0; bbox_index < class_bboxes_count; bbox_index++) {
-                net_flow::NmsPostProcessOp::transform__parse_and_copy_bbox((hailo_bbox_t *)(dst_ptr + dst_offset), (uint64_t*)(src_ptr + src_offset));
+                // The score is compared while still quantized, so the dropped bboxes are never de-quantized
+                auto proposal = (uint64_t*)(src_ptr + src_offset);
                 src_offset += bbox_size;
+                if (((*proposal) >> 48) < min_score) {
+                    continue;
+                }
+                net_flow::NmsPostProcessOp::transform__parse_and_copy_bbox((hailo_bbox_t *)(dst_ptr + dst_offset), proposal);
                 dst_offset += sizeof(hailo_bbox_t);
+                (*dst_bbox_counter)++;
             }
 
             chunk_offsets[chunk_index] = src_offset;
         }
     }
+
+    return dst_offset / sizeof(uint16_t);
 }
 
 template<typename T>
@@ -614,30 +638,33 @@ void transform__h2d_F8CR(const T *src_ptr, hailo_3d_image_shape_t *src_image_sha
     ASSERT(NULL != dst_ptr);
     ASSERT(0 == (dst_image_shape->features % HailoRTCommon::HW_DATA_ALIGNMENT));
 
-    uint32_t src_row_size = src_image_shape->width * src_image_shape->features;
-    uint32_t dst_row_size = dst_image_shape->width * dst_image_shape->features;
-    uint32_t src_features = src_image_shape->features;
-    size_t src_offset = 0;
-    size_t dst_offset = 0;
+    const uint32_t src_row_size = src_image_shape->width * src_image_shape->features;
+    const uint32_t dst_row_size = dst_image_shape->width * dst_image_shape->features;
+    const uint32_t src_features = src_image_shape->features;
+    const uint32_t last_features = (src_features % static_cast<uint32_t>(HailoRTCommon::HW_DATA_ALIGNMENT));
+    const uint32_t full_features = src_features - last_features;
 
-    /* copy src data to dst, 8channels * width at a time, pad features to 8 elemnts */
+    /* copy src data to dst, 8channels * width at a time, pad features to 8 elemnts.
+       Each 8 features block is written to a contiguous dst chunk, so the columns are iterated in the inner loop. */
     for (uint32_t r = 0; r < src_image_shape->height ; r++) {
-        for (uint32_t c = 0; c < src_image_shape->width; c++) {
-            for (uint32_t f = 0; f < src_image_shape->features; f+=8) {
-                src_offset = r * src_row_size + c * src_image_shape->features + f;
-                dst_offset = r * dst_row_size + c * HailoRTCommon::HW_DATA_ALIGNMENT + f * dst_image_shape->width;
-                if (f + HailoRTCommon::HW_DATA_ALIGNMENT <= src_image_shape->features) {
-                    /* take 8 full features for each column and write them */
-                    memcpy(dst_ptr + dst_offset, src_ptr + src_offset, HailoRTCommon::HW_DATA_ALIGNMENT * sizeof(T));
-                }
-                else {
-                    /* take the last 8 or less features, pad features to 8 and write */
-                    auto last_features = (src_features % HailoRTCommon::HW_DATA_ALIGNMENT);
-                    auto remainder = (HailoRTCommon::HW_DATA_ALIGNMENT - last_features);
-                    memcpy(dst_ptr + dst_offset, src_ptr + src_offset, last_features * sizeof(T));
-                    dst_offset += last_features;
-                    memset(dst_ptr + dst_offset, 0, remainder * sizeof(T));
-                }
+        const T *src_row = src_ptr + (r * src_row_size);
+        T *dst_row = dst_ptr + (r * dst_row_size);
+        for (uint32_t f = 0; f < full_features; f += HailoRTCommon::HW_DATA_ALIGNMENT) {
+            const T *src = src_row + f;
+            T *dst = dst_row + (f * dst_image_shape->width);
+            for (uint32_t c = 0; c < src_image_shape->width; c++) {
+                /* take 8 full features for each column and write them */
+                std::copy_n(src + (c * src_features), HailoRTCommon::HW_DATA_ALIGNMENT, dst + (c * HailoRTCommon::HW_DATA_ALIGNMENT));
+            }
+        }
+        if (0 != last_features) {
+            /* take the last 8 or less features, pad features to 8 and write */
+            const T *src = src_row + full_features;
+            T *dst = dst_row + (full_features * dst_image_shape->width);
+            for (uint32_t c = 0; c < src_image_shape->width; c++) {
+                T *dst_column = dst + (c * HailoRTCommon::HW_DATA_ALIGNMENT);
+                std::copy_n(src + (c * src_features), last_features, dst_column);
+                std::fill_n(dst_column + last_features, HailoRTCommon::HW_DATA_ALIGNMENT - last_features, static_cast<T>(0));
             }
         }
     }
@@ -651,26 +678,30 @@ void transform__d2h_F8CR(const T *src_ptr, hailo_3d_image_shape_t *src_image_sha
     ASSERT(NULL != src_ptr);
     ASSERT(NULL != dst_ptr);
 
-    uint32_t src_row_size = src_image_shape->width * src_image_shape->features;
-    uint32_t dst_row_size = dst_image_shape->width * dst_image_shape->features;
-    uint32_t dst_features = dst_image_shape->features;
-    uint32_t src_offset = 0;
-    uint32_t dst_offset = 0;
+    const uint32_t src_row_size = src_image_shape->width * src_image_shape->features;
+    const uint32_t dst_row_size = dst_image_shape->width * dst_image_shape->features;
+    const uint32_t dst_features = dst_image_shape->features;
+    const uint32_t last_features = (dst_features % static_cast<uint32_t>(HailoRTCommon::HW_DATA_ALIGNMENT));
+    const uint32_t full_features = dst_features - last_features;
 
+    /* Each 8 features block is read from a contiguous src chunk, so the columns are iterated in the inner loop. */
     for (uint32_t r = 0; r < dst_image_shape->height ; r++) {
-        for (uint32_t c = 0; c < dst_image_shape->width; c++) {
-            for (uint32_t f = 0; f < dst_image_shape->features; f+=8) {
-                src_offset = r * src_row_size + c * static_cast<uint32_t>(HailoRTCommon::HW_DATA_ALIGNMENT) +
-                    f * src_image_shape->width;
-                dst_offset = r * dst_row_size + c * dst_image_shape->features + f;
-                if (f + HailoRTCommon::HW_DATA_ALIGNMENT <= dst_image_shape->features) {
-                    /* copy the first dst_image_features (which are aligned to 8)! */
-                    memcpy(dst_ptr + dst_offset, src_ptr + src_offset, HailoRTCommon::HW_DATA_ALIGNMENT * sizeof(T));
-                    }
-                else {
-                    /* copy the last 8 or less features, remove pad */
-                    memcpy(dst_ptr + dst_offset, src_ptr + src_offset, (dst_features % HailoRTCommon::HW_DATA_ALIGNMENT) * sizeof(T));
-                }
+        const T *src_row = src_ptr + (r * src_row_size);
+        T *dst_row = dst_ptr + (r * dst_row_size);
+        for (uint32_t f = 0; f < full_features; f += HailoRTCommon::HW_DATA_ALIGNMENT) {
+            const T *src = src_row + (f * src_image_shape->width);
+            T *dst = dst_row + f;
+            for (uint32_t c = 0; c < dst_image_shape->width; c++) {
+                /* copy the first dst_image_features (which are aligned to 8)! */
+                std::copy_n(src + (c * HailoRTCommon::HW_DATA_ALIGNMENT), HailoRTCommon::HW_DATA_ALIGNMENT, dst + (c * dst_features));
+            }
+        }
+        if (0 != last_features) {
+            /* copy the last 8 or less features, remove pad */
+            const T *src = src_row + (full_features * src_image_shape->width);
+            T *dst = dst_row + full_features;
+            for (uint32_t c = 0; c < dst_image_shape->width; c++) {
+                std::copy_n(src + (c * HailoRTCommon::HW_DATA_ALIGNMENT), last_features, dst + (c * dst_features));
             }
         }
     }
@@ -915,10 +946,12 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
             if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint8_t>((float32_t*)src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+                QuantizationKernels::get().quantize_uint8(static_cast<const float32_t*>(src_ptr), static_cast<uint8_t*>(quant_buffer),
+                    shape_size, m_dst_quant_infos[0]);
             }
             else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint16_t>((float32_t*)src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+                QuantizationKernels::get().quantize_uint16(static_cast<const float32_t*>(src_ptr), static_cast<uint16_t*>(quant_buffer),
+                    shape_size, m_dst_quant_infos[0]);
             }
             else {
                 return HAILO_INVALID_OPERATION;
@@ -947,17 +980,19 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
             /* if output layer is argmax - do not rescale */
             if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
                 if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+                    const auto dequantize_func = QuantizationKernels::get().dequantize_uint8_in_place;
                     if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
+                        dequantize_func((float32_t*)dst_ptr, 0, shape_size, m_dst_quant_infos[0].qp_zp, m_dst_quant_infos[0].qp_scale);
                     } else {
-                        dequantize_output_by_feature<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+                        dequantize_output_by_feature(dequantize_func, (float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
                     }
                 }
                 else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+                    const auto dequantize_func = QuantizationKernels::get().dequantize_uint16_in_place;
                     if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
+                        dequantize_func((float32_t*)dst_ptr, 0, shape_size, m_dst_quant_infos[0].qp_zp, m_dst_quant_infos[0].qp_scale);
                     } else {
-                        dequantize_output_by_feature<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+                        dequantize_output_by_feature(dequantize_func, (float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
                     }
                 }
                 else {
@@ -975,6 +1010,8 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
                 }
             }
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return dequantize_to_float16(static_cast<uint16_t*>(const_cast<void*>(dst_ptr)), shape_size);
         default:
             LOGGER__ERROR("Invalid dst-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -983,411 +1020,293 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
     return HAILO_SUCCESS;
 }
 
-hailo_status reorder_input_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format, 
-    void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format)
+/* Adapters of the reorder functions to ReorderFunc */
+template<typename T, void (*Reorder)(const T*, hailo_3d_image_shape_t*, T*, hailo_3d_image_shape_t*)>
+static hailo_status reorder_by_shape_ptrs(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
 {
-    if ((HAILO_FORMAT_ORDER_NHWC == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHCW == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NHWC_to_NHCW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NHWC_to_NHCW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+    Reorder(static_cast<const T*>(src_ptr), &src_image_shape, static_cast<T*>(dst_ptr), &dst_image_shape);
+    return HAILO_SUCCESS;
+}
 
-    if ((HAILO_FORMAT_ORDER_NHCW == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHCW == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NHCW_to_NHCW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NHCW_to_NHCW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T, hailo_status (*Reorder)(const T*, hailo_3d_image_shape_t*, T*, hailo_3d_image_shape_t*)>
+static hailo_status reorder_by_shape_ptrs_with_status(const void *src_ptr, hailo_3d_image_shape_t src_image_shape,
+    void *dst_ptr, hailo_3d_image_shape_t dst_image_shape)
+{
+    return Reorder(static_cast<const T*>(src_ptr), &src_image_shape, static_cast<T*>(dst_ptr), &dst_image_shape);
+}
 
-    if ((HAILO_FORMAT_ORDER_NHWC == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NHWC_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NHWC_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T, hailo_status (*Reorder)(const T*, const hailo_3d_image_shape_t&, T*, const hailo_3d_image_shape_t&)>
+static hailo_status reorder_by_shape_refs(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
+{
+    return Reorder(static_cast<const T*>(src_ptr), src_image_shape, static_cast<T*>(dst_ptr), dst_image_shape);
+}
 
-    if ((HAILO_FORMAT_ORDER_NC == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NC == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NC_to_NC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NC_to_NC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T>
+static hailo_status reorder__h2d_BAYER_RGB(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
+{
+    assert(1 == src_image_shape.features);
+    transform__h2d_NHWC_to_NHWC<T>(static_cast<const T*>(src_ptr), &src_image_shape, static_cast<T*>(dst_ptr), &dst_image_shape);
+    return HAILO_SUCCESS;
+}
 
-    if (((HAILO_FORMAT_ORDER_FCR == src_format.order) || (HAILO_FORMAT_ORDER_NHWC == src_format.order)) &&
-        (HAILO_FORMAT_ORDER_FCR == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_FCR<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_FCR<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T>
+static hailo_status reorder__h2d_YUY2_to_YUY2(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t /*dst_image_shape*/)
+{
+    return transform__h2d_YUY2_to_YUY2<T>(static_cast<const T*>(src_ptr), static_cast<T*>(dst_ptr),
+        HailoRTCommon::get_shape_size(src_image_shape));
+}
 
-    if (((HAILO_FORMAT_ORDER_F8CR == src_format.order) || (HAILO_FORMAT_ORDER_NHWC == src_format.order)) &&
-        (HAILO_FORMAT_ORDER_F8CR == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_F8CR<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_F8CR<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T>
+static hailo_status reorder__d2h_NC_to_NC(const void *src_ptr, hailo_3d_image_shape_t /*src_image_shape*/, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
+{
+    transform__d2h_NC_to_NC<T>(static_cast<const T*>(src_ptr), static_cast<T*>(dst_ptr), &dst_image_shape);
+    return HAILO_SUCCESS;
+}
 
-    if ((HAILO_FORMAT_ORDER_BAYER_RGB == src_format.order) &&
-        (HAILO_FORMAT_ORDER_BAYER_RGB == dst_format.order)) {
-        assert(1 == src_image_shape.features);
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NHWC_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NHWC_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T>
+static hailo_status reorder__d2h_BAYER_RGB(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
+{
+    assert((1 == src_image_shape.features) && (1 == dst_image_shape.features));
+    transform__d2h_BAYER_RGB<T>(static_cast<const T*>(src_ptr), &src_image_shape, static_cast<T*>(dst_ptr), &dst_image_shape);
+    return HAILO_SUCCESS;
+}
 
-    if ((HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB == src_format.order) &&
-        (HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB == dst_format.order)) {
-        assert(1 == src_image_shape.features);
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NHWC_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NHWC_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
-    }
+template<typename T>
+static hailo_status reorder__d2h_NHW_to_NCHW(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape)
+{
+    CHECK((src_image_shape.features == 1) && (dst_image_shape.features == 1), HAILO_INVALID_ARGUMENT,
+        "Invalid number of features. Expected 1, received hw: {}, user: {}",
+            src_image_shape.features, dst_image_shape.features);
+    // We call for transform__d2h_NHW_to_NHW function since NCHW is the same as NHW when the the image's features = 1.
+    transform__d2h_NHW_to_NHW<T>(static_cast<const T*>(src_ptr), &src_image_shape, static_cast<T*>(dst_ptr), &dst_image_shape);
+    return HAILO_SUCCESS;
+}
 
-    if ((HAILO_FORMAT_ORDER_NHWC == src_format.order) &&
-        (HAILO_FORMAT_ORDER_RGB888 == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                return transform__h2d_NHWC_to_RGB888<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                return transform__h2d_NHWC_to_RGB888<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
+/* Returns the reorder function from src_order to dst_order, or nullptr if the orders aren't supported. */
+template<typename T>
+static ReorderFunc get_input_reorder_func_by_type(hailo_format_order_t src_order, hailo_format_order_t dst_order)
+{
+    if ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_NHWC_to_NHCW<T>>;
     }
-
-    if ((HAILO_FORMAT_ORDER_NCHW == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHCW == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                return transform__h2d_NCHW_to_NHCW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                return transform__h2d_NCHW_to_NHCW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
+    if ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_NHCW_to_NHCW<T>>;
     }
-
-    if ((HAILO_FORMAT_ORDER_YUY2 == src_format.order) &&
-        (HAILO_FORMAT_ORDER_YUY2 == dst_format.order)) {
-        auto shape_size = HailoRTCommon::get_shape_size(src_image_shape);
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                return transform__h2d_YUY2_to_YUY2<uint8_t>((uint8_t*)src_ptr, (uint8_t*)dst_ptr, shape_size);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                return transform__h2d_YUY2_to_YUY2<uint16_t>((uint16_t*)src_ptr, (uint16_t*)dst_ptr, shape_size);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
+    if ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_NHWC_to_NHWC<T>>;
     }
-
-    if (((HAILO_FORMAT_ORDER_NV12 == src_format.order) &&
-               (HAILO_FORMAT_ORDER_HAILO_YYUV) == dst_format.order) ||
-               ((HAILO_FORMAT_ORDER_NV21 == src_format.order) &&
-               (HAILO_FORMAT_ORDER_HAILO_YYVU) == dst_format.order)) {
-        switch (src_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_NV12_to_NV12<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_NV12_to_NV12<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format {}", src_format.type);
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
+    if ((HAILO_FORMAT_ORDER_NC == src_order) && (HAILO_FORMAT_ORDER_NC == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_NC_to_NC<T>>;
     }
-
-    if (((HAILO_FORMAT_ORDER_I420 == src_format.order) &&
-               (HAILO_FORMAT_ORDER_HAILO_YYYYUV) == dst_format.order)) {
-        switch (src_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_I420_to_YYYYUV<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_I420_to_YYYYUV<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format {}", src_format.type);
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
+    if (((HAILO_FORMAT_ORDER_FCR == src_order) || (HAILO_FORMAT_ORDER_NHWC == src_order)) &&
+        (HAILO_FORMAT_ORDER_FCR == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_FCR<T>>;
     }
+    if (((HAILO_FORMAT_ORDER_F8CR == src_order) || (HAILO_FORMAT_ORDER_NHWC == src_order)) &&
+        (HAILO_FORMAT_ORDER_F8CR == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_F8CR<T>>;
+    }
+    if (((HAILO_FORMAT_ORDER_BAYER_RGB == src_order) && (HAILO_FORMAT_ORDER_BAYER_RGB == dst_order)) ||
+        ((HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB == src_order) && (HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB == dst_order))) {
+        return reorder__h2d_BAYER_RGB<T>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_RGB888 == dst_order)) {
+        return reorder_by_shape_ptrs_with_status<T, transform__h2d_NHWC_to_RGB888<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_NCHW == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) {
+        return reorder_by_shape_ptrs_with_status<T, transform__h2d_NCHW_to_NHCW<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_YUY2 == src_order) && (HAILO_FORMAT_ORDER_YUY2 == dst_order)) {
+        return reorder__h2d_YUY2_to_YUY2<T>;
+    }
+    if (((HAILO_FORMAT_ORDER_NV12 == src_order) && (HAILO_FORMAT_ORDER_HAILO_YYUV == dst_order)) ||
+        ((HAILO_FORMAT_ORDER_NV21 == src_order) && (HAILO_FORMAT_ORDER_HAILO_YYVU == dst_order))) {
+        return reorder_by_shape_ptrs<T, transform__h2d_NV12_to_NV12<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_I420 == src_order) && (HAILO_FORMAT_ORDER_HAILO_YYYYUV == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__h2d_I420_to_YYYYUV<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_RGB4 == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) {
+        return reorder_by_shape_refs<T, transform__h2d_RGB4_to_NHWC<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_RGB4 == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) {
+        return reorder_by_shape_refs<T, transform__h2d_RGB4_to_NHCW<T>>;
+    }
+    return nullptr;
+}
 
-    if ((HAILO_FORMAT_ORDER_RGB4 == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_RGB4_to_NHWC<uint8_t>((uint8_t*)src_ptr, src_image_shape, (uint8_t*)dst_ptr, dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_RGB4_to_NHWC<uint16_t>((uint16_t*)src_ptr, src_image_shape, (uint16_t*)dst_ptr, dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
+/* Returns the reorder function from src_format to dst_format, or nullptr if the formats aren't supported. */
+template<typename T>
+static ReorderFunc get_output_reorder_func_by_type(const hailo_format_t &src_format, const hailo_format_t &dst_format)
+{
+    const auto src_order = src_format.order;
+    const auto dst_order = dst_format.order;
+    if ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__d2h_NHCW_to_NHWC<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_NC == src_order) && (HAILO_FORMAT_ORDER_NC == dst_order)) {
+        return reorder__d2h_NC_to_NC<T>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHW == src_order) && (HAILO_FORMAT_ORDER_NHW == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__d2h_NHW_to_NHW<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_FCR == src_order) &&
+        ((HAILO_FORMAT_ORDER_FCR == dst_order) || (HAILO_FORMAT_ORDER_NHWC == dst_order))) {
+        return reorder_by_shape_ptrs<T, transform__d2h_NHWC_to_NHWC<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_F8CR == src_order) &&
+        ((HAILO_FORMAT_ORDER_F8CR == dst_order) || (HAILO_FORMAT_ORDER_NHWC == dst_order))) {
+        return reorder_by_shape_ptrs<T, transform__d2h_F8CR<T>>;
     }
+    if ((HAILO_FORMAT_ORDER_BAYER_RGB == src_order) && (HAILO_FORMAT_ORDER_BAYER_RGB == dst_order)) {
+        return reorder__d2h_BAYER_RGB<T>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NCHW == dst_order)) {
+        return reorder_by_shape_ptrs_with_status<T, TransformContextUtils::transform__d2h_NHCW_to_NCHW<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHW == src_order) && (HAILO_FORMAT_ORDER_NCHW == dst_order)) {
+        return reorder__d2h_NHW_to_NCHW<T>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NHW == dst_order) &&
+        (0 != (HAILO_FORMAT_FLAGS_HOST_ARGMAX & src_format.flags))) {
+        return reorder_by_shape_refs<T, transform__d2h_argmax_NHCW_to_NHW<T>>;
+    }
+    if ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) {
+        return reorder_by_shape_ptrs<T, transform__d2h_NHWC_to_NHWC<T>>;
+    }
+    return nullptr;
+}
 
-    if ((HAILO_FORMAT_ORDER_RGB4 == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHCW == dst_format.order)) {
-        switch (dst_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                transform__h2d_RGB4_to_NHCW<uint8_t>((uint8_t*)src_ptr, src_image_shape, (uint8_t*)dst_ptr, dst_image_shape);
-                break;
-            case HAILO_FORMAT_TYPE_UINT16:
-                transform__h2d_RGB4_to_NHCW<uint16_t>((uint16_t*)src_ptr, src_image_shape, (uint16_t*)dst_ptr, dst_image_shape);
-                break;
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-        }
-        return HAILO_SUCCESS;
+/* The reorder function of an input stream - src_format is the format after quantization (the YUV reorders are chosen by
+   the src type, the others by the dst type). */
+static Expected<ReorderFunc> get_input_reorder_func(const hailo_format_t &src_format, const hailo_format_t &dst_format)
+{
+    CHECK_AS_EXPECTED(nullptr != get_input_reorder_func_by_type<uint8_t>(src_format.order, dst_format.order),
+        HAILO_INVALID_OPERATION, "Unsupported input stream transformation from hailo_format_order_t {} to hailo_format_order_t {}",
+        HailoRTCommon::get_format_order_str(src_format.order), HailoRTCommon::get_format_order_str(dst_format.order));
+
+    const auto is_yuv = (HAILO_FORMAT_ORDER_NV12 == src_format.order) || (HAILO_FORMAT_ORDER_NV21 == src_format.order) ||
+        (HAILO_FORMAT_ORDER_I420 == src_format.order);
+    const auto format_type = is_yuv ? src_format.type : dst_format.type;
+    switch (format_type) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            return get_input_reorder_func_by_type<uint8_t>(src_format.order, dst_format.order);
+        case HAILO_FORMAT_TYPE_UINT16:
+            return get_input_reorder_func_by_type<uint16_t>(src_format.order, dst_format.order);
+        default:
+            LOGGER__ERROR("Invalid src-buffer's type format {}", format_type);
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
     }
+}
+
+static Expected<ReorderFunc> get_output_reorder_func(const hailo_format_t &src_format, const hailo_format_t &dst_format)
+{
+    CHECK_AS_EXPECTED(nullptr != get_output_reorder_func_by_type<uint8_t>(src_format, dst_format),
+        HAILO_INVALID_OPERATION, "Unsupported output stream transformation from hailo_format_order_t {} to hailo_format_order_t {}",
+        HailoRTCommon::get_format_order_str(src_format.order), HailoRTCommon::get_format_order_str(dst_format.order));
 
-    LOGGER__ERROR("Unsupported input stream transformation from hailo_format_order_t "
-        "{} to hailo_format_order_t {}", HailoRTCommon::get_format_order_str(src_format.order),
-        HailoRTCommon::get_format_order_str(dst_format.order));
-    return HAILO_INVALID_OPERATION;
+    switch (src_format.type) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            return get_output_reorder_func_by_type<uint8_t>(src_format, dst_format);
+        case HAILO_FORMAT_TYPE_UINT16:
+            return get_output_reorder_func_by_type<uint16_t>(src_format, dst_format);
+        default:
+            LOGGER__ERROR("Invalid src-buffer's type format {}", src_format.type);
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
 }
 
-hailo_status reorder_output_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format, 
-    void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format)
+/* Public funcs */
+/* Whether each row of the frame is reordered independently of the other rows (so a frame may be reordered row by row) */
+static bool is_row_wise_reorder(hailo_stream_direction_t direction, const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape, const hailo_format_t &dst_format)
 {
-    if ((HAILO_FORMAT_ORDER_NHCW == src_format.order) &&
-        (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
-        switch (src_format.type) {
+    if (src_image_shape.height != dst_image_shape.height) {
+        return false;
+    }
+
+    const auto src_order = src_format.order;
+    const auto dst_order = dst_format.order;
+    if (HAILO_H2D_STREAM == direction) {
+        return ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) ||
+            ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NHCW == dst_order)) ||
+            ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) ||
+            (((HAILO_FORMAT_ORDER_FCR == src_order) || (HAILO_FORMAT_ORDER_NHWC == src_order)) && (HAILO_FORMAT_ORDER_FCR == dst_order)) ||
+            (((HAILO_FORMAT_ORDER_F8CR == src_order) || (HAILO_FORMAT_ORDER_NHWC == src_order)) && (HAILO_FORMAT_ORDER_F8CR == dst_order));
+    }
+    return ((HAILO_FORMAT_ORDER_NHCW == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) ||
+        ((HAILO_FORMAT_ORDER_NHWC == src_order) && (HAILO_FORMAT_ORDER_NHWC == dst_order)) ||
+        ((HAILO_FORMAT_ORDER_FCR == src_order) && ((HAILO_FORMAT_ORDER_FCR == dst_order) || (HAILO_FORMAT_ORDER_NHWC == dst_order))) ||
+        ((HAILO_FORMAT_ORDER_F8CR == src_order) && ((HAILO_FORMAT_ORDER_F8CR == dst_order) || (HAILO_FORMAT_ORDER_NHWC == dst_order)));
+}
+
+/* Calls transform_rows on tiles of rows covering all the frame's rows. If max_threads_count > 1 and the frame is large,
+   the tiles are transformed in parallel on the transform thread pool. */
+static hailo_status transform_by_row_tiles(uint32_t rows_count, size_t frame_size, uint32_t max_threads_count,
+    const std::function<hailo_status(uint32_t rows_begin, uint32_t rows_end)> &transform_rows)
+{
+    const auto tiles_count = (frame_size >= MIN_FRAME_SIZE_FOR_TILED_TRANSFORM) ? std::min(max_threads_count, rows_count) : 1;
+    if (tiles_count <= 1) {
+        return transform_rows(0, rows_count);
+    }
+
+    return TransformThreadPool::get_instance().run(tiles_count, tiles_count, [&](size_t tile_index) {
+        const auto rows_begin = static_cast<uint32_t>((static_cast<uint64_t>(rows_count) * tile_index) / tiles_count);
+        const auto rows_end = static_cast<uint32_t>((static_cast<uint64_t>(rows_count) * (tile_index + 1)) / tiles_count);
+        return transform_rows(rows_begin, rows_end);
+    });
+}
+
+/* Quantizes and reorders the rows [rows_begin, rows_end) of the frame row by row - each row is quantized into the quant
+   buffer, and reordered from it while it's still cached, so the frame is read once and written once.
+   The rows are quantized into the part of the quant buffer matching rows_begin, so tiles of rows may be transformed in
+   parallel. */
+static hailo_status quantize_and_reorder_input_by_rows(const void *src_ptr, const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, void *quant_buffer, void *dst_ptr, const hailo_3d_image_shape_t &dst_image_shape,
+    const hailo_format_t &dst_format, const hailo_quant_info_t &quant_info, ReorderFunc reorder_func, uint32_t rows_begin,
+    uint32_t rows_end)
+{
+    auto src_row_shape = src_image_shape;
+    src_row_shape.height = 1;
+    auto dst_row_shape = dst_image_shape;
+    dst_row_shape.height = 1;
+    auto quantized_src_format = src_format;
+    quantized_src_format.type = dst_format.type;
+
+    const auto row_elements_count = HailoRTCommon::get_shape_size(src_row_shape);
+    const auto src_row_size = HailoRTCommon::get_frame_size(src_row_shape, src_format);
+    const auto dst_row_size = HailoRTCommon::get_frame_size(dst_row_shape, dst_format);
+    const auto quant_row_size = HailoRTCommon::get_frame_size(src_row_shape, quantized_src_format);
+    const auto &kernels = QuantizationKernels::get();
+    const auto quant_row = static_cast<uint8_t*>(quant_buffer) + (rows_begin * quant_row_size);
+
+    for (uint32_t r = rows_begin; r < rows_end; r++) {
+        const auto src_row = reinterpret_cast<const float32_t*>(static_cast<const uint8_t*>(src_ptr) + (r * src_row_size));
+        switch (dst_format.type) {
             case HAILO_FORMAT_TYPE_UINT8:
-                transform__d2h_NHCW_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
+                kernels.quantize_uint8(src_row, quant_row, row_elements_count, quant_info);
                 break;
             case HAILO_FORMAT_TYPE_UINT16:
-                transform__d2h_NHCW_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
+                kernels.quantize_uint16(src_row, reinterpret_cast<uint16_t*>(quant_row), row_elements_count, quant_info);
                 break;
             default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
+                return HAILO_INVALID_OPERATION;
         }
-    }
-    else if ((HAILO_FORMAT_ORDER_NC == src_format.order) &&
-            (HAILO_FORMAT_ORDER_NC == dst_format.order)) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_NC_to_NC<uint8_t>((uint8_t*)src_ptr, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_NC_to_NC<uint16_t>((uint16_t*)src_ptr, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    }
-    else if ((HAILO_FORMAT_ORDER_NHW == src_format.order) &&
-            (HAILO_FORMAT_ORDER_NHW == dst_format.order)) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_NHW_to_NHW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_NHW_to_NHW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    }
-    else if ((HAILO_FORMAT_ORDER_FCR == src_format.order) &&
-        ((HAILO_FORMAT_ORDER_FCR == dst_format.order) || (HAILO_FORMAT_ORDER_NHWC == dst_format.order))) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_NHWC_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_NHWC_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    }
-    else if ((HAILO_FORMAT_ORDER_F8CR == src_format.order) &&
-        ((HAILO_FORMAT_ORDER_F8CR == dst_format.order) || (HAILO_FORMAT_ORDER_NHWC == dst_format.order))) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_F8CR<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_F8CR<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    }
-    else if ((HAILO_FORMAT_ORDER_BAYER_RGB == src_format.order) &&
-        (HAILO_FORMAT_ORDER_BAYER_RGB == dst_format.order)) {
-            assert((1 == src_image_shape.features) && (1 == dst_image_shape.features));
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_BAYER_RGB<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_BAYER_RGB<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    } else if ((HAILO_FORMAT_ORDER_NHCW == src_format.order) &&
-               (HAILO_FORMAT_ORDER_NCHW) == dst_format.order) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    TransformContextUtils::transform__d2h_NHCW_to_NCHW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    TransformContextUtils::transform__d2h_NHCW_to_NCHW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    } else if ((HAILO_FORMAT_ORDER_NHW == src_format.order) &&
-               (HAILO_FORMAT_ORDER_NCHW) == dst_format.order) {
-
-            CHECK((src_image_shape.features == 1) && (dst_image_shape.features == 1), HAILO_INVALID_ARGUMENT,
-                "Invalid number of features. Expected 1, received hw: {}, user: {}",
-                    src_image_shape.features, dst_image_shape.features);
-            switch (src_format.type) {
-                // We call for transform__d2h_NHW_to_NHW function since NCHW is the same as NHW when the the image's features = 1.
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_NHW_to_NHW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_NHW_to_NHW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format");
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    } else if ((HAILO_FORMAT_ORDER_NHCW == src_format.order) &&
-               (HAILO_FORMAT_ORDER_NHW == dst_format.order)  &&
-               (0 != (HAILO_FORMAT_FLAGS_HOST_ARGMAX & src_format.flags)))  {
-            switch (src_format.type) {
-            case HAILO_FORMAT_TYPE_UINT8:
-                return transform__d2h_argmax_NHCW_to_NHW<uint8_t>((uint8_t*)src_ptr, src_image_shape, (uint8_t*)dst_ptr, dst_image_shape);
-            case HAILO_FORMAT_TYPE_UINT16:
-                return transform__d2h_argmax_NHCW_to_NHW<uint16_t>((uint16_t*)src_ptr, src_image_shape, (uint16_t*)dst_ptr, dst_image_shape);
-            default:
-                LOGGER__ERROR("Invalid src-buffer's type format");
-                return HAILO_INVALID_ARGUMENT;
-            }
-    } else if ((HAILO_FORMAT_ORDER_NHWC == src_format.order) &&
-               (HAILO_FORMAT_ORDER_NHWC) == dst_format.order) {
-            switch (src_format.type) {
-                case HAILO_FORMAT_TYPE_UINT8:
-                    transform__d2h_NHWC_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
-                    break;
-                case HAILO_FORMAT_TYPE_UINT16:
-                    transform__d2h_NHWC_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
-                    break;
-                default:
-                    LOGGER__ERROR("Invalid src-buffer's type format {}", src_format.type);
-                    return HAILO_INVALID_ARGUMENT;
-            }
-    } else {
-        LOGGER__ERROR("Unsupported output stream transformation from hailo_format_order_t "
-            "{} to hailo_format_order_t {}", HailoRTCommon::get_format_order_str(src_format.order),
-                HailoRTCommon::get_format_order_str(dst_format.order));
-        return HAILO_INVALID_OPERATION;
+
+        auto status = reorder_func(quant_row, src_row_shape, static_cast<uint8_t*>(dst_ptr) + (r * dst_row_size), dst_row_shape);
+        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
-/* Public funcs */
 hailo_status InputTransformContext::transform_inner(const void *src_ptr, void *quant_buffer, void *dst_ptr, 
     MemoryView transpose_buffer)
 {
@@ -1403,6 +1322,14 @@ hailo_status InputTransformContext::transform_inner(const void *src_ptr, void *q
         return HAILO_SUCCESS;
     }
 
+    if (m_should_quantize_and_reorder_by_rows) {
+        return transform_by_row_tiles(m_src_image_shape.height, m_src_frame_size, m_max_threads_count,
+            [&](uint32_t rows_begin, uint32_t rows_end) {
+                return quantize_and_reorder_input_by_rows(src_ptr, m_src_image_shape, m_src_format, quant_buffer, dst_ptr,
+                    m_dst_image_shape, m_dst_format, m_dst_quant_infos[0], m_reorder_func, rows_begin, rows_end);
+            });
+    }
+
     if (m_should_quantize) {
         /* If final step - output of this quant func is the dst_ptr */
         orig_dst_ptr = (m_should_transpose || m_should_reorder) ? quant_buffer : dst_ptr;
@@ -1441,14 +1368,89 @@ hailo_status InputTransformContext::transform_inner(const void *src_ptr, void *q
     }
 
     if (m_should_reorder){
-        auto status = reorder_input_stream(src_ptr, transposed_image_shape, quantized_src_format, dst_ptr, 
-            m_dst_image_shape, m_dst_format);
+        auto status = m_reorder_func(src_ptr, transposed_image_shape, dst_ptr, m_dst_image_shape);
         CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
+hailo_status FrameOutputTransformContext::dequantize_to_float16(uint16_t *dst_ptr, uint32_t elements_count)
+{
+    const auto &kernels = QuantizationKernels::get();
+    QuantizationKernels::DequantizeToFloat16InPlaceFunc dequantize_func = nullptr;
+    if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+        dequantize_func = kernels.dequantize_uint8_to_float16_in_place;
+    } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+        dequantize_func = kernels.dequantize_uint16_to_float16_in_place;
+    } else {
+        return HAILO_INVALID_OPERATION;
+    }
+
+    if (HAILO_FORMAT_ORDER_NHW == m_dst_format.order) {
+        /* if output layer is argmax - do not rescale (the identity qp only converts the values) */
+        dequantize_func(dst_ptr, 0, elements_count, 0, 1);
+    } else if (m_are_all_qps_the_same) {
+        dequantize_func(dst_ptr, 0, elements_count, m_dst_quant_infos[0].qp_zp, m_dst_quant_infos[0].qp_scale);
+    } else {
+        dequantize_output_by_feature(dequantize_func, dst_ptr, elements_count, m_quant_info_per_feature,
+            m_quant_infos_rep_count);
+    }
+    return HAILO_SUCCESS;
+}
+
+bool FrameOutputTransformContext::should_reorder_and_dequantize_by_rows() const
+{
+    if (!(m_should_quantize && m_should_reorder && !m_should_transpose) ||
+        ((HAILO_FORMAT_TYPE_FLOAT32 != m_dst_format.type) && (HAILO_FORMAT_TYPE_FLOAT16 != m_dst_format.type)) ||
+        ((HAILO_FORMAT_TYPE_UINT8 != m_src_format.type) && (HAILO_FORMAT_TYPE_UINT16 != m_src_format.type))) {
+        return false;
+    }
+
+    if (!is_row_wise_reorder(HAILO_D2H_STREAM, m_src_image_shape, m_src_format, m_dst_image_shape, m_dst_format)) {
+        return false;
+    }
+
+    // The qps per feature must repeat in each row
+    const auto row_elements_count = m_dst_image_shape.width * m_dst_image_shape.features;
+    return m_are_all_qps_the_same ||
+        (0 == (row_elements_count % (m_quant_info_per_feature.size() * m_quant_infos_rep_count)));
+}
+
+hailo_status FrameOutputTransformContext::reorder_and_dequantize_by_rows(const void *src_ptr, void *dst_ptr,
+    uint32_t rows_begin, uint32_t rows_end)
+{
+    auto src_row_shape = m_src_image_shape;
+    src_row_shape.height = 1;
+    auto dst_row_shape = m_dst_image_shape;
+    dst_row_shape.height = 1;
+
+    const auto row_elements_count = HailoRTCommon::get_shape_size(dst_row_shape);
+    const auto src_row_size = HailoRTCommon::get_frame_size(src_row_shape, m_src_format);
+    const auto dst_row_size = HailoRTCommon::get_frame_size(dst_row_shape, m_dst_format);
+    const auto dequantize_func = (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) ?
+        QuantizationKernels::get().dequantize_uint8_in_place : QuantizationKernels::get().dequantize_uint16_in_place;
+
+    for (uint32_t r = rows_begin; r < rows_end; r++) {
+        // The row is reordered to the start of its dst row, and de-quantized in place while it's still cached.
+        const auto dst_row = reinterpret_cast<float32_t*>(static_cast<uint8_t*>(dst_ptr) + (r * dst_row_size));
+        auto status = m_reorder_func(static_cast<const uint8_t*>(src_ptr) + (r * src_row_size), src_row_shape, dst_row,
+            dst_row_shape);
+        CHECK_SUCCESS(status);
+
+        if (HAILO_FORMAT_TYPE_FLOAT16 == m_dst_format.type) {
+            CHECK_SUCCESS(dequantize_to_float16(reinterpret_cast<uint16_t*>(dst_row), row_elements_count));
+        } else if (m_are_all_qps_the_same) {
+            dequantize_func(dst_row, 0, row_elements_count, m_dst_quant_infos[0].qp_zp, m_dst_quant_infos[0].qp_scale);
+        } else {
+            dequantize_output_by_feature(dequantize_func, dst_row, row_elements_count, m_quant_info_per_feature,
+                m_quant_infos_rep_count);
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, void *dst_ptr, MemoryView transpose_buffer)
 {
     hailo_format_t transposed_format = m_dst_format;
@@ -1466,6 +1468,13 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
         return HAILO_SUCCESS;
     }
 
+    if (m_should_reorder_and_dequantize_by_rows) {
+        return transform_by_row_tiles(m_dst_image_shape.height, m_dst_frame_size, m_max_threads_count,
+            [&](uint32_t rows_begin, uint32_t rows_end) {
+                return reorder_and_dequantize_by_rows(src_ptr, dst_ptr, rows_begin, rows_end);
+            });
+    }
+
     if (m_should_reorder) {
         if (m_should_transpose) {
             /* If user needs to reorder and transform - the output of the reorder is the transform buffer*/
@@ -1487,8 +1496,7 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
         } else {
             orig_dst_ptr = dst_ptr;
         }
-        auto status = reorder_output_stream(src_ptr, m_src_image_shape, m_src_format, orig_dst_ptr, transposed_image_shape, 
-            m_dst_format);
+        auto status = m_reorder_func(src_ptr, m_src_image_shape, orig_dst_ptr, transposed_image_shape);
         CHECK_SUCCESS(status);
     }
 
@@ -1515,45 +1523,6 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
 }
 
 
-hailo_status transform_demux_raw_frame(const void *src, uint32_t offset,
-    hailo_mux_info_t *mux_info, uint32_t mux_row_count)
-{
-    // This is a recursive function with a maximum depth of HailoRTCommon::MUX_INFO_COUNT.
-    hailo_status status = HAILO_UNINITIALIZED;
-    struct hailo_mux_info_t *predecessor = NULL;
-    uint32_t row_size = 0;
-
-    CHECK_ARG_NOT_NULL(src);
-
-    for (uint32_t i = 0; i < mux_row_count; i++) {
-        for (uint32_t j = 0; j < mux_info->successors_count; j++) {
-            predecessor = mux_info->successors[j];
-            row_size = predecessor->row_size;
-
-            if ((predecessor->info.is_mux) && (i < predecessor->rows_gcd)) {
-                status = transform_demux_raw_frame(src, offset, predecessor, predecessor->info.hw_shape.height / mux_info->rows_gcd);
-                CHECK_SUCCESS(status);                
-            }
-
-            if (!(predecessor->info.is_mux)) {
-                if (predecessor->row_counter < predecessor->info.shape.height) {
-                    memcpy((uint8_t*)predecessor->buffer + predecessor->current_offset, (uint8_t*)src + offset, row_size);
-                    predecessor->current_offset += row_size;
-                }
-                
-                predecessor->row_counter++;
-                if (predecessor->row_counter == (predecessor->info.hw_shape.height + 1)) {
-                    predecessor->row_counter = 0;
-                }
-            }
-            
-            offset += row_size;
-        }
-    }
-
-    return HAILO_SUCCESS;
-}
-
 hailo_status validate_input_transform_params(hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format,
     hailo_format_t dst_format)
 {
@@ -1674,10 +1643,11 @@ std::string InputTransformContext::description() const
 
 Expected<std::unique_ptr<InputTransformContext>> InputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
     const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos)
+    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, uint32_t max_threads_count)
 {
     auto status = validate_input_transform_params(src_image_shape, src_format, dst_format);
     CHECK_SUCCESS_AS_EXPECTED(status);
+    CHECK_AS_EXPECTED(max_threads_count > 0, HAILO_INVALID_ARGUMENT, "max_threads_count must be larger than 0");
 
     const auto internal_src_format = HailoRTDefaults::expand_auto_format(src_format, dst_format);
 
@@ -1688,7 +1658,8 @@ Expected<std::unique_ptr<InputTransformContext>> InputTransformContext::create(c
     auto should_quantize = TransformContextUtils::should_quantize(HAILO_H2D_STREAM, internal_src_format, dst_format);
     CHECK_EXPECTED(should_quantize);
     if (should_quantize.value()) {
-        auto expected_quant_buffer = Buffer::create(src_frame_size, 0);
+        // Fully overwritten by the quantization of each frame
+        auto expected_quant_buffer = Buffer::create(src_frame_size);
         CHECK_EXPECTED(expected_quant_buffer);
         quant_buffer = expected_quant_buffer.release();
     }
@@ -1705,9 +1676,20 @@ Expected<std::unique_ptr<InputTransformContext>> InputTransformContext::create(c
     auto should_reorder = TransformContextUtils::should_reorder(src_image_shape, internal_src_format, dst_image_shape, dst_format);
     auto should_pad_periph = TransformContextUtils::should_pad_periph(dst_image_shape, dst_format);
 
+    // The reorder function is chosen once here, rather than for each frame
+    ReorderFunc reorder_func = nullptr;
+    if (should_reorder) {
+        auto quantized_src_format = internal_src_format;
+        if (*should_quantize) {
+            quantized_src_format.type = dst_format.type;
+        }
+        TRY(reorder_func, get_input_reorder_func(quantized_src_format, dst_format));
+    }
+
     std::unique_ptr<InputTransformContext> transform_context(new (std::nothrow) InputTransformContext(src_frame_size, src_image_shape,
         internal_src_format, dst_frame_size, dst_image_shape, dst_format, dst_quant_infos, std::move(quant_buffer),
-        std::move(transpose_buffer), *should_quantize, should_transpose, should_reorder, should_pad_periph));
+        std::move(transpose_buffer), *should_quantize, should_transpose, should_reorder, should_pad_periph, reorder_func,
+        max_threads_count));
     CHECK_AS_EXPECTED(nullptr != transform_context, HAILO_OUT_OF_HOST_MEMORY);
 
     return transform_context;
@@ -1751,7 +1733,7 @@ InputTransformContext::InputTransformContext(size_t src_frame_size, const hailo_
     const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
     const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer &&quant_buffer,
     Buffer &&transpose_buffer,const bool should_quantize, const bool should_transpose, const bool should_reorder,
-    const bool should_pad_periph) :
+    const bool should_pad_periph, ReorderFunc reorder_func, uint32_t max_threads_count) :
         m_src_frame_size(src_frame_size),
         m_src_image_shape(src_image_shape),
         m_src_format(src_format),
@@ -1763,6 +1745,11 @@ InputTransformContext::InputTransformContext(size_t src_frame_size, const hailo_
         m_should_transpose(should_transpose),
         m_should_reorder(should_reorder),
         m_should_pad_periph(should_pad_periph),
+        m_should_quantize_and_reorder_by_rows(should_quantize && should_reorder && !should_transpose &&
+            (HAILO_FORMAT_TYPE_FLOAT32 == src_format.type) &&
+            is_row_wise_reorder(HAILO_H2D_STREAM, src_image_shape, src_format, dst_image_shape, dst_format)),
+        m_reorder_func(reorder_func),
+        m_max_threads_count(max_threads_count),
         m_quant_buffer(std::move(quant_buffer)),
         m_transpose_buffer(std::move(transpose_buffer))
 {}
@@ -1822,10 +1809,12 @@ bool OutputTransformContext::is_transformation_required(
 
 Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info)
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info,
+        uint32_t max_threads_count)
 {
     auto status = validate_output_transform_params(src_image_shape, src_format, dst_image_shape, dst_format);
     CHECK_SUCCESS_AS_EXPECTED(status);
+    CHECK_AS_EXPECTED(max_threads_count > 0, HAILO_INVALID_ARGUMENT, "max_threads_count must be larger than 0");
 
     if (dst_quant_infos.size() == 1) {
         CHECK_AS_EXPECTED(Quantization::is_qp_valid(dst_quant_infos.at(0)), HAILO_INVALID_ARGUMENT,
@@ -1836,7 +1825,8 @@ Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create
         return NMSOutputTransformContext::create(src_format, dst_format, dst_quant_infos, nms_info);
     }
 
-    return FrameOutputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format, dst_quant_infos);
+    return FrameOutputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format, dst_quant_infos,
+        max_threads_count);
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
@@ -1890,10 +1880,11 @@ OutputTransformContext::OutputTransformContext(size_t src_frame_size, const hail
 FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
     const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
     const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer&& transpose_buffer,
-    const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph) :
+    const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph,
+    ReorderFunc reorder_func, uint32_t max_threads_count) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize, 
             should_transpose, should_reorder, should_pad_periph), m_src_image_shape(src_image_shape), m_dst_image_shape(dst_image_shape), 
-            m_transpose_buffer(std::move(transpose_buffer))
+            m_transpose_buffer(std::move(transpose_buffer)), m_reorder_func(reorder_func), m_max_threads_count(max_threads_count)
 {
     // TODO: Add verification that quant infos size equals to features count (HRT-11052)
 
@@ -1938,11 +1929,13 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
         LOGGER__CRITICAL("Got unknown format order = {}", HailoRTCommon::get_format_order_str(dst_format.order));
         break;
     }
+
+    m_should_reorder_and_dequantize_by_rows = should_reorder_and_dequantize_by_rows();
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
     const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos)
+    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, uint32_t max_threads_count)
 {
     const auto internal_dst_format = HailoRTDefaults::expand_auto_format(dst_format, src_format);
 
@@ -1963,9 +1956,15 @@ Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::c
     auto should_reorder = TransformContextUtils::should_reorder(src_image_shape, src_format, dst_image_shape, internal_dst_format);
     auto should_pad_periph = TransformContextUtils::should_pad_periph(dst_image_shape, internal_dst_format);
 
+    // The reorder function is chosen once here, rather than for each frame
+    ReorderFunc reorder_func = nullptr;
+    if (should_reorder) {
+        TRY(reorder_func, get_output_reorder_func(src_format, internal_dst_format));
+    }
+
     std::unique_ptr<OutputTransformContext> frame_transform_context = std::make_unique<FrameOutputTransformContext>(src_frame_size,
         src_image_shape, src_format, dst_frame_size, dst_image_shape, internal_dst_format, dst_quant_infos, std::move(transpose_buffer),
-        *should_quantize, should_transpose, should_reorder, should_pad_periph);
+        *should_quantize, should_transpose, should_reorder, should_pad_periph, reorder_func, max_threads_count);
 
     CHECK_AS_EXPECTED(nullptr != frame_transform_context, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -1974,9 +1973,10 @@ Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::c
 
 NMSOutputTransformContext::NMSOutputTransformContext(size_t src_frame_size, const hailo_format_t &src_format, 
     size_t dst_frame_size, const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos,
-    const hailo_nms_info_t &nms_info, Buffer &&quant_buffer, const bool should_quantize, const bool should_transpose) :
+    const hailo_nms_info_t &nms_info, const bool should_quantize, const bool should_transpose) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize ,should_transpose, 
-        true, false), m_nms_info(nms_info), m_chunk_offsets(nms_info.chunks_per_frame, 0), m_quant_buffer(std::move(quant_buffer))
+        true, false), m_nms_info(nms_info), m_chunk_offsets(nms_info.chunks_per_frame, 0),
+        m_classes_bboxes_count(nms_info.number_of_classes, 0), m_min_score(0)
 {}
 
 Expected<std::unique_ptr<OutputTransformContext>> NMSOutputTransformContext::create(const hailo_format_t &src_format,
@@ -1997,21 +1997,13 @@ Expected<std::unique_ptr<OutputTransformContext>> NMSOutputTransformContext::cre
     const auto src_frame_size = HailoRTCommon::get_nms_hw_frame_size(nms_info);
     auto dst_frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, internal_dst_format);
 
-    Buffer quant_buffer;
     auto should_quantize = TransformContextUtils::should_quantize(HAILO_D2H_STREAM, src_format, internal_dst_format);
     CHECK_EXPECTED(should_quantize);
-    if (*should_quantize) {
-        dst_frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, internal_dst_format);
-        auto expected_nms_quant_buffer = Buffer::create(dst_frame_size, 0);
-        CHECK_EXPECTED(expected_nms_quant_buffer);
-        quant_buffer = expected_nms_quant_buffer.release();
-    }
 
     auto should_transpose = TransformContextUtils::should_transpose(src_format.flags, internal_dst_format.flags);
 
     std::unique_ptr<OutputTransformContext> nms_transform_context = std::make_unique<NMSOutputTransformContext>(src_frame_size,
-        src_format, dst_frame_size, internal_dst_format, dst_quant_infos, nms_info, std::move(quant_buffer),
-        *should_quantize, should_transpose);
+        src_format, dst_frame_size, internal_dst_format, dst_quant_infos, nms_info, *should_quantize, should_transpose);
     CHECK_AS_EXPECTED(nullptr != nms_transform_context, HAILO_OUT_OF_HOST_MEMORY);
 
     return nms_transform_context;
@@ -2041,22 +2033,84 @@ hailo_status NMSOutputTransformContext::transform(const MemoryView src, MemoryVi
 
     assert((HAILO_FORMAT_ORDER_HAILO_NMS == m_src_format.order) && (HAILO_FORMAT_ORDER_HAILO_NMS == m_dst_format.order));
 
-    auto shape_size = HailoRTCommon::get_nms_host_shape_size(m_nms_info);
-
     if ((HAILO_FORMAT_FLAGS_TRANSPOSED & m_src_format.flags) || (HAILO_FORMAT_FLAGS_TRANSPOSED & m_dst_format.flags)) {
         LOGGER__ERROR("NMS doesn't support transposed format");
         return HAILO_INVALID_OPERATION;
     }
 
-    auto dst_buffer = m_should_quantize ? m_quant_buffer.data() : dst.data();
-    transform__d2h_NMS(src.data(), dst_buffer, m_nms_info, m_chunk_offsets);
+    // The (filtered) uint16 frame is written to the start of dst - and is de-quantized in place, so only the bboxes
+    // that passed the filters are de-quantized
+    const auto elements_count = transform__d2h_NMS(src.data(), dst.data(), m_nms_info, m_chunk_offsets, m_min_score,
+        m_is_class_selected);
 
     if (m_should_quantize) {
         CHECK((HAILO_FORMAT_TYPE_FLOAT32 == m_dst_format.type) && (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type), HAILO_INTERNAL_FAILURE);
-        Quantization::dequantize_output_buffer_nms<float32_t, uint16_t>((uint16_t*)m_quant_buffer.data(),
-            (float32_t*)dst.data(), shape_size, m_dst_quant_infos[0], m_nms_info.number_of_classes); // TODO: Support NMS scale by feature (HRT-11052)
+        assert(elements_count <= HailoRTCommon::get_nms_host_shape_size(m_nms_info));
+
+        // The bboxes counters aren't quantized, so they are saved before the in place de-quantization overrides them
+        const auto src_elements = reinterpret_cast<const uint16_t*>(dst.data());
+        size_t offset = 0;
+        for (uint32_t class_index = 0; class_index < m_nms_info.number_of_classes; class_index++) {
+            m_classes_bboxes_count[class_index] = src_elements[offset];
+            offset += 1 + (HailoRTCommon::BBOX_PARAMS * m_classes_bboxes_count[class_index]);
+        }
+
+        QuantizationKernels::get().dequantize_uint16_in_place(reinterpret_cast<float32_t*>(dst.data()), 0,
+            static_cast<uint32_t>(elements_count), m_dst_quant_infos[0].qp_zp, m_dst_quant_infos[0].qp_scale); // TODO: Support NMS scale by feature (HRT-11052)
+
+        auto dst_elements = reinterpret_cast<float32_t*>(dst.data());
+        offset = 0;
+        for (uint32_t class_index = 0; class_index < m_nms_info.number_of_classes; class_index++) {
+            dst_elements[offset] = static_cast<float32_t>(m_classes_bboxes_count[class_index]);
+            offset += 1 + (HailoRTCommon::BBOX_PARAMS * m_classes_bboxes_count[class_index]);
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status NMSOutputTransformContext::set_score_threshold(float32_t threshold)
+{
+    const auto &quant_info = m_dst_quant_infos[0];
+    CHECK(!m_should_quantize || (quant_info.qp_scale > 0), HAILO_INVALID_OPERATION,
+        "Can't filter the NMS scores with qp_scale {}", quant_info.qp_scale);
+
+    // The smallest quantized score that de-quantizes to at least the threshold - so filtering the quantized scores
+    // keeps exactly the bboxes that filtering the de-quantized scores would have kept
+    auto dequantize = [this, &quant_info](uint32_t score) {
+        return m_should_quantize ? Quantization::dequantize_output<float32_t, uint16_t>(static_cast<uint16_t>(score), quant_info) :
+            static_cast<float32_t>(score);
+    };
+    uint32_t low = 0;
+    uint32_t high = static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1;
+    while (low < high) {
+        const auto mid = low + ((high - low) / 2);
+        if (dequantize(mid) >= threshold) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
     }
 
+    m_min_score = low;
+    return HAILO_SUCCESS;
+}
+
+hailo_status NMSOutputTransformContext::set_classes_filter(const std::vector<uint32_t> &classes_filter)
+{
+    if (classes_filter.empty()) {
+        m_is_class_selected.clear();
+        return HAILO_SUCCESS;
+    }
+
+    // Classes out of range are ignored, as in NmsPostProcessOp
+    std::vector<bool> is_class_selected(m_nms_info.number_of_classes, false);
+    for (const auto class_index : classes_filter) {
+        if (class_index < m_nms_info.number_of_classes) {
+            is_class_selected[class_index] = true;
+        }
+    }
+    m_is_class_selected = std::move(is_class_selected);
     return HAILO_SUCCESS;
 }
 
@@ -2116,6 +2170,12 @@ std::string NMSOutputTransformContext::description() const
             TransformContextUtils::make_quantization_description(m_src_format.type, m_dst_format.type, m_dst_quant_infos);
     }
 
+    if ((0 != m_min_score) || !m_is_class_selected.empty()) {
+        transform_description << " | filter: min_score " << m_min_score << ", classes " <<
+            (m_is_class_selected.empty() ? m_nms_info.number_of_classes :
+                static_cast<uint32_t>(std::count(m_is_class_selected.begin(), m_is_class_selected.end(), true)));
+    }
+
     return transform_description.str();
 }
 
@@ -2149,8 +2209,9 @@ Expected<OutputDemuxerBase> OutputDemuxerBase::create(size_t src_frame_size, con
 
     auto mux_infos = get_mux_infos_from_layer_info(layer_info);
     CHECK_EXPECTED(mux_infos);
+    auto edges_views = get_edges_views_from_mux_infos(mux_infos.value());
 
-    return OutputDemuxerBase(src_frame_size, mux_infos.release());
+    return OutputDemuxerBase(src_frame_size, mux_infos.release(), std::move(edges_views));
 }
 
 hailo_status OutputDemuxerBase::get_mux_info_from_layer_info_impl(hailo_mux_info_t &mux_info, const LayerInfo &layer_info,
@@ -2263,61 +2324,150 @@ Expected<std::vector<hailo_mux_info_t>> OutputDemuxerBase::get_mux_infos_from_la
     return res;
 }
 
-OutputDemuxerBase::OutputDemuxerBase(size_t src_frame_size, std::vector<hailo_mux_info_t> &&mux_infos) :
+std::vector<DemuxEdgeView> OutputDemuxerBase::get_edges_views_from_mux_infos(std::vector<hailo_mux_info_t> &mux_infos)
+{
+    std::vector<DemuxEdgeView> edges_views;
+    std::map<const hailo_mux_info_t*, size_t> edges_indices;
+    for (auto &mux_info : mux_infos) {
+        if (!mux_info.info.is_mux) {
+            mux_info.row_counter = 0;
+            edges_indices[&mux_info] = edges_views.size();
+            edges_views.emplace_back(DemuxEdgeView{mux_info.info, {}});
+        }
+    }
+
+    add_mux_rows_to_edges_views(0, mux_infos[0], mux_infos[0].rows_gcd, edges_indices, edges_views);
+    return edges_views;
+}
+
+void OutputDemuxerBase::add_mux_rows_to_edges_views(uint32_t offset, hailo_mux_info_t &mux_info, uint32_t mux_row_count,
+    const std::map<const hailo_mux_info_t*, size_t> &edges_indices, std::vector<DemuxEdgeView> &edges_views)
+{
+    // Walks over the rows of the muxed frame in the order they are muxed, and adds the rows of each edge to the edge's view.
+    // This is a recursive function with a maximum depth of HailoRTCommon::MUX_INFO_COUNT.
+    for (uint32_t i = 0; i < mux_row_count; i++) {
+        for (uint32_t j = 0; j < mux_info.successors_count; j++) {
+            auto &predecessor = *mux_info.successors[j];
+
+            if ((predecessor.info.is_mux) && (i < predecessor.rows_gcd)) {
+                add_mux_rows_to_edges_views(offset, predecessor, predecessor.info.hw_shape.height / mux_info.rows_gcd,
+                    edges_indices, edges_views);
+            }
+
+            if (!(predecessor.info.is_mux)) {
+                if (predecessor.row_counter < predecessor.info.shape.height) {
+                    add_chunk_to_regions(edges_views[edges_indices.at(&predecessor)].regions, offset, predecessor.row_size);
+                }
+
+                predecessor.row_counter++;
+                if (predecessor.row_counter == (predecessor.info.hw_shape.height + 1)) {
+                    predecessor.row_counter = 0;
+                }
+            }
+
+            offset += predecessor.row_size;
+        }
+    }
+}
+
+void OutputDemuxerBase::add_chunk_to_regions(std::vector<DemuxStridedRegion> &regions, size_t offset, size_t chunk_size)
+{
+    if (!regions.empty()) {
+        auto &last_region = regions.back();
+        if ((last_region.chunk_size == chunk_size) && (offset > last_region.offset)) {
+            if (1 == last_region.chunks_count) {
+                last_region.stride = offset - last_region.offset;
+                last_region.chunks_count++;
+                return;
+            }
+            if (offset == (last_region.offset + (last_region.chunks_count * last_region.stride))) {
+                last_region.chunks_count++;
+                return;
+            }
+        }
+    }
+
+    regions.emplace_back(DemuxStridedRegion{offset, chunk_size, chunk_size, 1});
+}
+
+void OutputDemuxerBase::copy_edge_from_mux(const uint8_t *src, const DemuxEdgeView &edge_view, uint8_t *dst)
+{
+    for (const auto &region : edge_view.regions) {
+        if (region.stride == region.chunk_size) {
+            const auto region_size = region.chunk_size * region.chunks_count;
+            memcpy(dst, src + region.offset, region_size);
+            dst += region_size;
+            continue;
+        }
+
+        const uint8_t *chunk = src + region.offset;
+        for (size_t i = 0; i < region.chunks_count; i++) {
+            memcpy(dst, chunk, region.chunk_size);
+            chunk += region.stride;
+            dst += region.chunk_size;
+        }
+    }
+}
+
+OutputDemuxerBase::OutputDemuxerBase(size_t src_frame_size, std::vector<hailo_mux_info_t> &&mux_infos,
+    std::vector<DemuxEdgeView> &&edges_views) :
         OutputDemuxer(src_frame_size),
-        m_mux_infos(std::move(mux_infos)) {}
+        m_mux_infos(std::move(mux_infos)),
+        m_edges_views(std::move(edges_views))
+{}
 
-hailo_status OutputDemuxerBase::transform_demux(const MemoryView src, std::vector<MemoryView> &raw_buffers)
+const std::vector<DemuxEdgeView> &OutputDemuxerBase::get_edges_views() const
 {
-    size_t raw_buffer_index = 0;
-    size_t total_mux_sizes = 0;
+    return m_edges_views;
+}
 
-    CHECK(raw_buffers.size() == get_edges_stream_info().size(), HAILO_INVALID_ARGUMENT,
-        "There is a missmatch between mux edges counts ({}) and raw_buffers_size ({})", get_edges_stream_info().size(),
+hailo_status OutputDemuxerBase::transform_demux(const MemoryView src, std::vector<MemoryView> &raw_buffers)
+{
+    CHECK_ARG_NOT_NULL(src.data());
+    CHECK(raw_buffers.size() == m_edges_views.size(), HAILO_INVALID_ARGUMENT,
+        "There is a missmatch between mux edges counts ({}) and raw_buffers_size ({})", m_edges_views.size(),
         raw_buffers.size());
 
-    // Reset the runtime offset
-    for (auto &mux_edge : m_mux_infos) {
-        if (!mux_edge.info.is_mux) {
-            mux_edge.buffer = (void*)((uintptr_t)raw_buffers[raw_buffer_index].data());
-            mux_edge.current_offset = 0;
-            mux_edge.row_counter = 0;
-            CHECK((mux_edge.info.hw_frame_size == raw_buffers[raw_buffer_index].size()), HAILO_INVALID_ARGUMENT,
-                "Expected buffer size of {}, got {}", mux_edge.info.hw_frame_size, raw_buffers[raw_buffer_index].size());
-            total_mux_sizes += mux_edge.info.hw_frame_size;
-            raw_buffer_index++;
-        }
+    size_t total_mux_sizes = 0;
+    for (size_t i = 0; i < m_edges_views.size(); i++) {
+        const auto &edge_info = m_edges_views[i].edge_info;
+        CHECK((edge_info.hw_frame_size == raw_buffers[i].size()), HAILO_INVALID_ARGUMENT,
+            "Expected buffer size of {}, got {}", edge_info.hw_frame_size, raw_buffers[i].size());
+        total_mux_sizes += edge_info.hw_frame_size;
     }
     CHECK(total_mux_sizes == src.size(), HAILO_INVALID_ARGUMENT,
         "src_size must be: {}, passed_size: {}", total_mux_sizes, src.size());
 
     // TODO: Optimization - Read directly to user raw buffers (in case of NO_TRANSFORM, INPLACE_TRANSFORM)
 
-    auto first_mux_info = m_mux_infos[0];
-    return transform_demux_raw_frame(src.data(), 0, &first_mux_info, first_mux_info.rows_gcd);
+    for (size_t i = 0; i < m_edges_views.size(); i++) {
+        copy_edge_from_mux(src.data(), m_edges_views[i], raw_buffers[i].data());
+    }
+
+    return HAILO_SUCCESS;
 }
 
 hailo_status OutputDemuxerBase::transform_demux(const MemoryView src, const std::map<std::string, MemoryView> &dst_ptrs)
 {
+    CHECK_ARG_NOT_NULL(src.data());
+
     size_t total_mux_sizes = 0;
-    // Reset the runtime offset
-    for (auto &mux_edge : m_mux_infos) {
-        if (!mux_edge.info.is_mux) {
-            auto name = std::string(mux_edge.info.name);
-            CHECK(contains(dst_ptrs, name), HAILO_INVALID_ARGUMENT, "edge name {} is not in dst_ptrs", name);
-            mux_edge.buffer = const_cast<void*>(reinterpret_cast<const void*>((dst_ptrs.at(name)).data()));
-            mux_edge.current_offset = 0;
-            mux_edge.row_counter = 0;
-            CHECK((mux_edge.info.hw_frame_size == (dst_ptrs.at(name)).size()), HAILO_INVALID_ARGUMENT,
-                "Expected buffer size of {}, got {}", mux_edge.info.hw_frame_size, (dst_ptrs.at(name)).size());
-            total_mux_sizes += mux_edge.info.hw_frame_size;
-        }
+    for (const auto &edge_view : m_edges_views) {
+        auto name = std::string(edge_view.edge_info.name);
+        CHECK(contains(dst_ptrs, name), HAILO_INVALID_ARGUMENT, "edge name {} is not in dst_ptrs", name);
+        CHECK((edge_view.edge_info.hw_frame_size == (dst_ptrs.at(name)).size()), HAILO_INVALID_ARGUMENT,
+            "Expected buffer size of {}, got {}", edge_view.edge_info.hw_frame_size, (dst_ptrs.at(name)).size());
+        total_mux_sizes += edge_view.edge_info.hw_frame_size;
     }
     CHECK(total_mux_sizes == src.size(), HAILO_INVALID_ARGUMENT, "src_size must be: {}, passed_size: {}",
         total_mux_sizes, src.size());
 
-    auto first_mux_info = m_mux_infos[0];
-    return transform_demux_raw_frame(src.data(), 0, &first_mux_info, first_mux_info.rows_gcd);
+    for (const auto &edge_view : m_edges_views) {
+        auto dst = dst_ptrs.at(std::string(edge_view.edge_info.name));
+        copy_edge_from_mux(src.data(), edge_view, dst.data());
+    }
+
+    return HAILO_SUCCESS;
 }
 
 } /* namespace hailort */
@@ -20,6 +20,7 @@
 
 #include "stream_common/stream_internal.hpp"
 #include "hef/layer_info.hpp"
+#include "transform/quantization_kernels.hpp"
 
 #include <map>
 #include <vector>
@@ -28,6 +29,13 @@
 namespace hailort
 {
 
+#define TRANSFORM_MAX_THREADS_ENV_VAR ("HAILO_TRANSFORM_MAX_THREADS")
+
+// Reorders a frame (or some of its rows) from the src format order to the dst format order. The function matching the
+// formats (orders and types) of a transform context is chosen when the context is created.
+using ReorderFunc = hailo_status (*)(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, void *dst_ptr,
+    hailo_3d_image_shape_t dst_image_shape);
+
 class HAILORTAPI TransformContextUtils final
 {
 public:
@@ -47,6 +55,9 @@ public:
                                                 hailo_format_order_t dst_order, hailo_3d_image_shape_t dst_shape);
     static std::string make_transpose_description(hailo_3d_image_shape_t original_shape, hailo_3d_image_shape_t transposed_shape);
     static std::string make_pad_periph_description(hailo_3d_image_shape_t src_shape, hailo_3d_image_shape_t dst_shape);
+    // The max threads count of the transform contexts created by the inference pipelines (TRANSFORM_MAX_THREADS_ENV_VAR,
+    // or 1 if it isn't set)
+    static uint32_t get_pipeline_max_threads_count();
 
     template<typename T>
     static hailo_status transform__d2h_NHCW_to_NCHW(
@@ -104,15 +115,25 @@ public:
 
     virtual hailo_status transform_demux(const MemoryView src, const std::map<std::string, MemoryView> &dst_ptrs) override;
     virtual hailo_status transform_demux(const MemoryView src, std::vector<MemoryView> &raw_buffers) override;
+    virtual const std::vector<DemuxEdgeView> &get_edges_views() const override;
 
 private:
-    OutputDemuxerBase(size_t src_frame_size, std::vector<hailo_mux_info_t> &&mux_infos);
+    OutputDemuxerBase(size_t src_frame_size, std::vector<hailo_mux_info_t> &&mux_infos,
+        std::vector<DemuxEdgeView> &&edges_views);
 
     static Expected<std::vector<hailo_mux_info_t>> get_mux_infos_from_layer_info(const LayerInfo &layer_info);
     static hailo_status get_mux_info_from_layer_info_impl(hailo_mux_info_t &mux_info, const LayerInfo &layer_info,
     uint32_t &offset, uint32_t height_ratio, std::vector<hailo_mux_info_t> &res, size_t &number_of_mux_infos);
+    static std::vector<DemuxEdgeView> get_edges_views_from_mux_infos(std::vector<hailo_mux_info_t> &mux_infos);
+    static void add_mux_rows_to_edges_views(uint32_t offset, hailo_mux_info_t &mux_info, uint32_t mux_row_count,
+        const std::map<const hailo_mux_info_t*, size_t> &edges_indices, std::vector<DemuxEdgeView> &edges_views);
+    static void add_chunk_to_regions(std::vector<DemuxStridedRegion> &regions, size_t offset, size_t chunk_size);
+    static void copy_edge_from_mux(const uint8_t *src, const DemuxEdgeView &edge_view, uint8_t *dst);
 
     std::vector<hailo_mux_info_t> m_mux_infos;
+    // The demuxing is done according to the edges views, computed once on creation (rather than walking the mux tree
+    // for each frame)
+    std::vector<DemuxEdgeView> m_edges_views;
 };
 
 struct QuantInfoForDequantize
@@ -128,30 +149,38 @@ class HAILORTAPI FrameOutputTransformContext final : public OutputTransformConte
 public:
     static Expected<std::unique_ptr<OutputTransformContext>> create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info);
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info, uint32_t max_threads_count);
 
     FrameOutputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info, Buffer&& transpose_buffer,
-        const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph);
+        const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph,
+        ReorderFunc reorder_func, uint32_t max_threads_count);
 
     hailo_status transform_inner(const void *src_ptr, void *dst_ptr, MemoryView transpose_buffer);
 
     hailo_status quantize_stream(const void *dst_ptr);
+    hailo_status dequantize_to_float16(uint16_t *dst_ptr, uint32_t elements_count);
 
 
     virtual hailo_status transform(const MemoryView src, MemoryView dst) override;
     virtual std::string description() const override;
 
 private:
-    template <typename T, typename Q>
-    static inline void dequantize_output_by_feature(T *dst_ptr, uint32_t buffer_elements_count,
-        const std::vector<QuantInfoForDequantize> &quant_infos, uint32_t repetition_count)
+    // Whether the frame may be reordered and de-quantized row by row (reading the src once and writing the dst once)
+    bool should_reorder_and_dequantize_by_rows() const;
+    hailo_status reorder_and_dequantize_by_rows(const void *src_ptr, void *dst_ptr, uint32_t rows_begin, uint32_t rows_end);
+
+    // T is float32_t or uint16_t (float16), with the matching kernel
+    template <typename T, typename DequantizeFunc>
+    static inline void dequantize_output_by_feature(DequantizeFunc dequantize_func,
+        T *dst_ptr, uint32_t buffer_elements_count, const std::vector<QuantInfoForDequantize> &quant_infos,
+        uint32_t repetition_count)
     {
         uint32_t elements_dequantized = 0;
         while (elements_dequantized < buffer_elements_count) {
             for (int32_t i = static_cast<int32_t>(quant_infos.size()) - 1; i >= 0; i--) {
-                Quantization::dequantize_output_buffer_in_place<T, Q>(dst_ptr, buffer_elements_count - repetition_count - elements_dequantized,
+                dequantize_func(dst_ptr, buffer_elements_count - repetition_count - elements_dequantized,
                     repetition_count, quant_infos[i].m_qp_zp, quant_infos[i].m_qp_scale);
                 elements_dequantized += repetition_count;
             }
@@ -164,6 +193,9 @@ private:
     bool m_are_all_qps_the_same;
     std::vector<QuantInfoForDequantize> m_quant_info_per_feature;
     uint32_t m_quant_infos_rep_count;
+    const ReorderFunc m_reorder_func;
+    bool m_should_reorder_and_dequantize_by_rows;
+    const uint32_t m_max_threads_count;
 };
 
 class HAILORTAPI NMSOutputTransformContext final : public OutputTransformContext
@@ -174,18 +206,29 @@ public:
 
     NMSOutputTransformContext(size_t src_frame_size, const hailo_format_t &src_format, size_t dst_frame_size,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info, const hailo_nms_info_t &nms_info, 
-        Buffer &&quant_buffer, const bool should_quantize, const bool should_transpose);
+        const bool should_quantize, const bool should_transpose);
 
     virtual hailo_status transform(const MemoryView src, MemoryView dst) override;
     virtual std::string description() const override;
 
+    // The bboxes are filtered while their scores are still quantized (while merging the nms chunks), so only the
+    // bboxes that pass the filters are de-quantized. Not thread safe - must not be called concurrently with transform.
+    hailo_status set_score_threshold(float32_t threshold);
+    // An empty filter selects all the classes
+    hailo_status set_classes_filter(const std::vector<uint32_t> &classes_filter);
+
 private:
 
     const hailo_nms_info_t m_nms_info;
 
     // For each chunk contains offset of current nms class. Used here in order to avoid run-time allocations
     std::vector<size_t> m_chunk_offsets;
-    Buffer m_quant_buffer;
+    // The bboxes count of each class, saved while de-quantizing the frame in place
+    std::vector<uint32_t> m_classes_bboxes_count;
+    // The quantized score threshold
+    uint32_t m_min_score;
+    // Empty if all the classes are selected
+    std::vector<bool> m_is_class_selected;
 };
 
 } /* namespace hailort */
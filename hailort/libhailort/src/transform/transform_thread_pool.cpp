@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_thread_pool.cpp
+ * @brief Implementation of the transform thread pool
+ **/
+
+#include "transform/transform_thread_pool.hpp"
+
+#include "common/os_utils.hpp"
+
+#include <algorithm>
+
+
+namespace hailort
+{
+
+TransformThreadPool &TransformThreadPool::get_instance()
+{
+    static TransformThreadPool instance;
+    return instance;
+}
+
+TransformThreadPool::TransformThreadPool() :
+    m_should_quit(false)
+{
+    // The calling thread runs tasks as well, so one thread less than the amount of cores is enough
+    const size_t cores_count = std::thread::hardware_concurrency();
+    const size_t threads_count = std::max(cores_count, static_cast<size_t>(2)) - 1;
+    m_threads.reserve(threads_count);
+    for (size_t i = 0; i < threads_count; i++) {
+        m_threads.emplace_back(&TransformThreadPool::worker_thread, this);
+    }
+}
+
+TransformThreadPool::~TransformThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_quit = true;
+    }
+    m_cv.notify_all();
+
+    for (auto &thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+hailo_status TransformThreadPool::run(size_t tasks_count, size_t max_threads_count, const Task &task)
+{
+    Job job{};
+    job.task = &task;
+    job.tasks_count = tasks_count;
+    job.next_task_index = 0;
+    job.status = HAILO_SUCCESS;
+    job.running_threads_count = 0;
+
+    const size_t threads_count = std::min(max_threads_count, tasks_count);
+    const size_t helpers_count = (threads_count > 1) ? std::min(threads_count - 1, m_threads.size()) : 0;
+    if (helpers_count > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending_jobs.insert(m_pending_jobs.end(), helpers_count, &job);
+        }
+        for (size_t i = 0; i < helpers_count; i++) {
+            m_cv.notify_one();
+        }
+    }
+
+    run_tasks(job);
+
+    // All the tasks were taken - the entries no pool thread took yet aren't needed anymore
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pending_jobs.erase(std::remove(m_pending_jobs.begin(), m_pending_jobs.end(), &job), m_pending_jobs.end());
+    job.done_cv.wait(lock, [&job]() { return 0 == job.running_threads_count; });
+
+    return job.status;
+}
+
+void TransformThreadPool::run_tasks(Job &job)
+{
+    while (HAILO_SUCCESS == job.status) {
+        const auto task_index = job.next_task_index++;
+        if (task_index >= job.tasks_count) {
+            break;
+        }
+
+        const auto status = (*job.task)(task_index);
+        if (HAILO_SUCCESS != status) {
+            auto expected_status = HAILO_SUCCESS;
+            job.status.compare_exchange_strong(expected_status, status);
+        }
+    }
+}
+
+void TransformThreadPool::worker_thread()
+{
+    OsUtils::set_current_thread_name("HRT_TRANSFORM");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this]() { return m_should_quit || !m_pending_jobs.empty(); });
+        if (m_should_quit) {
+            break;
+        }
+
+        auto &job = *m_pending_jobs.front();
+        m_pending_jobs.pop_front();
+        job.running_threads_count++;
+
+        lock.unlock();
+        run_tasks(job);
+        lock.lock();
+
+        job.running_threads_count--;
+        if (0 == job.running_threads_count) {
+            job.done_cv.notify_all();
+        }
+    }
+}
+
+} /* namespace hailort */
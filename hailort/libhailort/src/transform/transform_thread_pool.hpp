@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_thread_pool.hpp
+ * @brief Thread pool shared by all the transform contexts, used for splitting the transformation of a large frame into
+ *        tiles transformed in parallel.
+ *
+ * The calling thread takes part in running the tasks and returns only once all of them are done, so the tasks may
+ * refer to the caller's stack. The pool's threads are created on the first use.
+ **/
+
+#ifndef _HAILO_TRANSFORM_THREAD_POOL_HPP_
+#define _HAILO_TRANSFORM_THREAD_POOL_HPP_
+
+#include "hailo/hailort.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace hailort
+{
+
+class TransformThreadPool final
+{
+public:
+    using Task = std::function<hailo_status(size_t task_index)>;
+
+    static TransformThreadPool &get_instance();
+
+    ~TransformThreadPool();
+
+    TransformThreadPool(const TransformThreadPool &) = delete;
+    TransformThreadPool &operator=(const TransformThreadPool &) = delete;
+    TransformThreadPool(TransformThreadPool &&) = delete;
+    TransformThreadPool &operator=(TransformThreadPool &&) = delete;
+
+    // Runs task(0), ..., task(tasks_count - 1) on up to max_threads_count threads (including the calling thread), and
+    // returns once all the tasks are done. Returns the status of the first failed task (the tasks that didn't start yet
+    // are skipped once a task fails).
+    hailo_status run(size_t tasks_count, size_t max_threads_count, const Task &task);
+
+private:
+    struct Job {
+        const Task *task;
+        size_t tasks_count;
+        std::atomic<size_t> next_task_index;
+        std::atomic<hailo_status> status;
+        // Amount of pool threads running the job's tasks (guarded by m_mutex)
+        size_t running_threads_count;
+        std::condition_variable done_cv;
+    };
+
+    TransformThreadPool();
+
+    void worker_thread();
+    static void run_tasks(Job &job);
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // Each entry lets one more pool thread help in running the job.
+    std::deque<Job*> m_pending_jobs;
+    bool m_should_quit;
+    std::vector<std::thread> m_threads;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSFORM_THREAD_POOL_HPP_ */
@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transpose_kernels.hpp
+ * @brief Cache blocked 2D transposition, used by the NHWC <-> NHCW reorders.
+ *
+ * The matrix is transposed in 8x8 tiles (using SSE2 on x86_64 and NEON on aarch64 for uint8/uint16), and the tiles are
+ * visited in blocks, so the destination lines written by a block are still cached when the next tiles write to them.
+ * On aarch64, the 3 columns matrices (RGB pixels) are (de)interleaved with the NEON structure loads/stores.
+ **/
+
+#ifndef _HAILO_TRANSPOSE_KERNELS_HPP_
+#define _HAILO_TRANSPOSE_KERNELS_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define HAILO_TRANSPOSE_SSE2_KERNELS
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define HAILO_TRANSPOSE_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+
+namespace hailort
+{
+
+class TransposeKernels final
+{
+public:
+    static const uint32_t TILE_SIZE = 8;
+    // Size (in tiles) of the square blocks of tiles transposed together
+    static const uint32_t BLOCK_TILES = 8;
+
+    // dst[c * dst_stride + r] = src[r * src_stride + c], for each r < rows, c < cols.
+    template<typename T>
+    static void transpose(const T *src, size_t src_stride, T *dst, size_t dst_stride, uint32_t rows, uint32_t cols)
+    {
+        if (transpose_3_cols(src, src_stride, dst, dst_stride, rows, cols) ||
+            transpose_3_rows(src, src_stride, dst, dst_stride, rows, cols)) {
+            return;
+        }
+
+        const uint32_t full_rows = rows - (rows % TILE_SIZE);
+        const uint32_t full_cols = cols - (cols % TILE_SIZE);
+        const uint32_t block_size = TILE_SIZE * BLOCK_TILES;
+
+        for (uint32_t block_r = 0; block_r < full_rows; block_r += block_size) {
+            const uint32_t block_rows_end = std::min(block_r + block_size, full_rows);
+            for (uint32_t block_c = 0; block_c < full_cols; block_c += block_size) {
+                const uint32_t block_cols_end = std::min(block_c + block_size, full_cols);
+                for (uint32_t r = block_r; r < block_rows_end; r += TILE_SIZE) {
+                    for (uint32_t c = block_c; c < block_cols_end; c += TILE_SIZE) {
+                        transpose_tile(src + (r * src_stride) + c, src_stride, dst + (c * dst_stride) + r, dst_stride);
+                    }
+                }
+            }
+        }
+
+        // The leftover columns of the full rows, and then the leftover rows
+        transpose_scalar(src, src_stride, dst, dst_stride, 0, full_rows, full_cols, cols);
+        transpose_scalar(src, src_stride, dst, dst_stride, full_rows, rows, 0, cols);
+    }
+
+private:
+    TransposeKernels() = default;
+
+    template<typename T>
+    static void transpose_scalar(const T *src, size_t src_stride, T *dst, size_t dst_stride, uint32_t rows_begin,
+        uint32_t rows_end, uint32_t cols_begin, uint32_t cols_end)
+    {
+        for (uint32_t r = rows_begin; r < rows_end; r++) {
+            for (uint32_t c = cols_begin; c < cols_end; c++) {
+                dst[(c * dst_stride) + r] = src[(r * src_stride) + c];
+            }
+        }
+    }
+
+    template<typename T>
+    static void transpose_tile(const T *src, size_t src_stride, T *dst, size_t dst_stride)
+    {
+        transpose_scalar(src, src_stride, dst, dst_stride, 0, TILE_SIZE, 0, TILE_SIZE);
+    }
+
+    // Returns false if the matrix wasn't transposed (the caller should transpose it).
+    template<typename T>
+    static bool transpose_3_cols(const T *, size_t, T *, size_t, uint32_t, uint32_t)
+    {
+        return false;
+    }
+
+    template<typename T>
+    static bool transpose_3_rows(const T *, size_t, T *, size_t, uint32_t, uint32_t)
+    {
+        return false;
+    }
+};
+
+#if defined(HAILO_TRANSPOSE_SSE2_KERNELS)
+
+template<>
+inline void TransposeKernels::transpose_tile<uint8_t>(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+{
+    const auto load_row = [src, src_stride](size_t row) {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (row * src_stride)));
+    };
+
+    // Interleaving the rows pairs, then the pairs of pairs - each 32 bits of rows01_23 hold a column of rows 0-3.
+    const auto rows01 = _mm_unpacklo_epi8(load_row(0), load_row(1));
+    const auto rows23 = _mm_unpacklo_epi8(load_row(2), load_row(3));
+    const auto rows45 = _mm_unpacklo_epi8(load_row(4), load_row(5));
+    const auto rows67 = _mm_unpacklo_epi8(load_row(6), load_row(7));
+    const auto cols0123_rows0123 = _mm_unpacklo_epi16(rows01, rows23);
+    const auto cols4567_rows0123 = _mm_unpackhi_epi16(rows01, rows23);
+    const auto cols0123_rows4567 = _mm_unpacklo_epi16(rows45, rows67);
+    const auto cols4567_rows4567 = _mm_unpackhi_epi16(rows45, rows67);
+    const __m128i cols[] = {
+        _mm_unpacklo_epi32(cols0123_rows0123, cols0123_rows4567),
+        _mm_unpackhi_epi32(cols0123_rows0123, cols0123_rows4567),
+        _mm_unpacklo_epi32(cols4567_rows0123, cols4567_rows4567),
+        _mm_unpackhi_epi32(cols4567_rows0123, cols4567_rows4567),
+    };
+
+    // Each register holds 2 columns
+    for (size_t i = 0; i < 4; i++) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + ((2 * i) * dst_stride)), cols[i]);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + ((2 * i + 1) * dst_stride)), _mm_unpackhi_epi64(cols[i], cols[i]));
+    }
+}
+
+template<>
+inline void TransposeKernels::transpose_tile<uint16_t>(const uint16_t *src, size_t src_stride, uint16_t *dst, size_t dst_stride)
+{
+    const auto load_row = [src, src_stride](size_t row) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (row * src_stride)));
+    };
+    const auto r0 = load_row(0);
+    const auto r1 = load_row(1);
+    const auto r2 = load_row(2);
+    const auto r3 = load_row(3);
+    const auto r4 = load_row(4);
+    const auto r5 = load_row(5);
+    const auto r6 = load_row(6);
+    const auto r7 = load_row(7);
+
+    const auto cols0123_rows01 = _mm_unpacklo_epi16(r0, r1);
+    const auto cols4567_rows01 = _mm_unpackhi_epi16(r0, r1);
+    const auto cols0123_rows23 = _mm_unpacklo_epi16(r2, r3);
+    const auto cols4567_rows23 = _mm_unpackhi_epi16(r2, r3);
+    const auto cols0123_rows45 = _mm_unpacklo_epi16(r4, r5);
+    const auto cols4567_rows45 = _mm_unpackhi_epi16(r4, r5);
+    const auto cols0123_rows67 = _mm_unpacklo_epi16(r6, r7);
+    const auto cols4567_rows67 = _mm_unpackhi_epi16(r6, r7);
+
+    const auto cols01_rows0123 = _mm_unpacklo_epi32(cols0123_rows01, cols0123_rows23);
+    const auto cols23_rows0123 = _mm_unpackhi_epi32(cols0123_rows01, cols0123_rows23);
+    const auto cols45_rows0123 = _mm_unpacklo_epi32(cols4567_rows01, cols4567_rows23);
+    const auto cols67_rows0123 = _mm_unpackhi_epi32(cols4567_rows01, cols4567_rows23);
+    const auto cols01_rows4567 = _mm_unpacklo_epi32(cols0123_rows45, cols0123_rows67);
+    const auto cols23_rows4567 = _mm_unpackhi_epi32(cols0123_rows45, cols0123_rows67);
+    const auto cols45_rows4567 = _mm_unpacklo_epi32(cols4567_rows45, cols4567_rows67);
+    const auto cols67_rows4567 = _mm_unpackhi_epi32(cols4567_rows45, cols4567_rows67);
+
+    const __m128i cols[] = {
+        _mm_unpacklo_epi64(cols01_rows0123, cols01_rows4567),
+        _mm_unpackhi_epi64(cols01_rows0123, cols01_rows4567),
+        _mm_unpacklo_epi64(cols23_rows0123, cols23_rows4567),
+        _mm_unpackhi_epi64(cols23_rows0123, cols23_rows4567),
+        _mm_unpacklo_epi64(cols45_rows0123, cols45_rows4567),
+        _mm_unpackhi_epi64(cols45_rows0123, cols45_rows4567),
+        _mm_unpacklo_epi64(cols67_rows0123, cols67_rows4567),
+        _mm_unpackhi_epi64(cols67_rows0123, cols67_rows4567),
+    };
+    for (size_t i = 0; i < TILE_SIZE; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i * dst_stride)), cols[i]);
+    }
+}
+
+#elif defined(HAILO_TRANSPOSE_NEON_KERNELS)
+
+template<>
+inline void TransposeKernels::transpose_tile<uint8_t>(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+{
+    // After the 8, 16 and 32 bits transpositions, col_x_y holds the columns x and y (in its low and high halves).
+    const uint8x8x2_t rows01 = vtrn_u8(vld1_u8(src), vld1_u8(src + src_stride));
+    const uint8x8x2_t rows23 = vtrn_u8(vld1_u8(src + (2 * src_stride)), vld1_u8(src + (3 * src_stride)));
+    const uint8x8x2_t rows45 = vtrn_u8(vld1_u8(src + (4 * src_stride)), vld1_u8(src + (5 * src_stride)));
+    const uint8x8x2_t rows67 = vtrn_u8(vld1_u8(src + (6 * src_stride)), vld1_u8(src + (7 * src_stride)));
+
+    const uint16x4x2_t even_cols_rows0123 = vtrn_u16(vreinterpret_u16_u8(rows01.val[0]), vreinterpret_u16_u8(rows23.val[0]));
+    const uint16x4x2_t odd_cols_rows0123 = vtrn_u16(vreinterpret_u16_u8(rows01.val[1]), vreinterpret_u16_u8(rows23.val[1]));
+    const uint16x4x2_t even_cols_rows4567 = vtrn_u16(vreinterpret_u16_u8(rows45.val[0]), vreinterpret_u16_u8(rows67.val[0]));
+    const uint16x4x2_t odd_cols_rows4567 = vtrn_u16(vreinterpret_u16_u8(rows45.val[1]), vreinterpret_u16_u8(rows67.val[1]));
+
+    const uint32x2x2_t col_0_4 = vtrn_u32(vreinterpret_u32_u16(even_cols_rows0123.val[0]), vreinterpret_u32_u16(even_cols_rows4567.val[0]));
+    const uint32x2x2_t col_2_6 = vtrn_u32(vreinterpret_u32_u16(even_cols_rows0123.val[1]), vreinterpret_u32_u16(even_cols_rows4567.val[1]));
+    const uint32x2x2_t col_1_5 = vtrn_u32(vreinterpret_u32_u16(odd_cols_rows0123.val[0]), vreinterpret_u32_u16(odd_cols_rows4567.val[0]));
+    const uint32x2x2_t col_3_7 = vtrn_u32(vreinterpret_u32_u16(odd_cols_rows0123.val[1]), vreinterpret_u32_u16(odd_cols_rows4567.val[1]));
+
+    vst1_u8(dst, vreinterpret_u8_u32(col_0_4.val[0]));
+    vst1_u8(dst + dst_stride, vreinterpret_u8_u32(col_1_5.val[0]));
+    vst1_u8(dst + (2 * dst_stride), vreinterpret_u8_u32(col_2_6.val[0]));
+    vst1_u8(dst + (3 * dst_stride), vreinterpret_u8_u32(col_3_7.val[0]));
+    vst1_u8(dst + (4 * dst_stride), vreinterpret_u8_u32(col_0_4.val[1]));
+    vst1_u8(dst + (5 * dst_stride), vreinterpret_u8_u32(col_1_5.val[1]));
+    vst1_u8(dst + (6 * dst_stride), vreinterpret_u8_u32(col_2_6.val[1]));
+    vst1_u8(dst + (7 * dst_stride), vreinterpret_u8_u32(col_3_7.val[1]));
+}
+
+template<>
+inline void TransposeKernels::transpose_tile<uint16_t>(const uint16_t *src, size_t src_stride, uint16_t *dst, size_t dst_stride)
+{
+    // After the 16 and 32 bits transpositions, cols_x_y holds rows 0-3 (or 4-7) of the columns x and y.
+    const uint16x8x2_t rows01 = vtrnq_u16(vld1q_u16(src), vld1q_u16(src + src_stride));
+    const uint16x8x2_t rows23 = vtrnq_u16(vld1q_u16(src + (2 * src_stride)), vld1q_u16(src + (3 * src_stride)));
+    const uint16x8x2_t rows45 = vtrnq_u16(vld1q_u16(src + (4 * src_stride)), vld1q_u16(src + (5 * src_stride)));
+    const uint16x8x2_t rows67 = vtrnq_u16(vld1q_u16(src + (6 * src_stride)), vld1q_u16(src + (7 * src_stride)));
+
+    const uint32x4x2_t even_cols_rows0123 = vtrnq_u32(vreinterpretq_u32_u16(rows01.val[0]), vreinterpretq_u32_u16(rows23.val[0]));
+    const uint32x4x2_t odd_cols_rows0123 = vtrnq_u32(vreinterpretq_u32_u16(rows01.val[1]), vreinterpretq_u32_u16(rows23.val[1]));
+    const uint32x4x2_t even_cols_rows4567 = vtrnq_u32(vreinterpretq_u32_u16(rows45.val[0]), vreinterpretq_u32_u16(rows67.val[0]));
+    const uint32x4x2_t odd_cols_rows4567 = vtrnq_u32(vreinterpretq_u32_u16(rows45.val[1]), vreinterpretq_u32_u16(rows67.val[1]));
+
+    const uint16x8_t cols_0_4_rows0123 = vreinterpretq_u16_u32(even_cols_rows0123.val[0]);
+    const uint16x8_t cols_2_6_rows0123 = vreinterpretq_u16_u32(even_cols_rows0123.val[1]);
+    const uint16x8_t cols_1_5_rows0123 = vreinterpretq_u16_u32(odd_cols_rows0123.val[0]);
+    const uint16x8_t cols_3_7_rows0123 = vreinterpretq_u16_u32(odd_cols_rows0123.val[1]);
+    const uint16x8_t cols_0_4_rows4567 = vreinterpretq_u16_u32(even_cols_rows4567.val[0]);
+    const uint16x8_t cols_2_6_rows4567 = vreinterpretq_u16_u32(even_cols_rows4567.val[1]);
+    const uint16x8_t cols_1_5_rows4567 = vreinterpretq_u16_u32(odd_cols_rows4567.val[0]);
+    const uint16x8_t cols_3_7_rows4567 = vreinterpretq_u16_u32(odd_cols_rows4567.val[1]);
+
+    vst1q_u16(dst, vcombine_u16(vget_low_u16(cols_0_4_rows0123), vget_low_u16(cols_0_4_rows4567)));
+    vst1q_u16(dst + dst_stride, vcombine_u16(vget_low_u16(cols_1_5_rows0123), vget_low_u16(cols_1_5_rows4567)));
+    vst1q_u16(dst + (2 * dst_stride), vcombine_u16(vget_low_u16(cols_2_6_rows0123), vget_low_u16(cols_2_6_rows4567)));
+    vst1q_u16(dst + (3 * dst_stride), vcombine_u16(vget_low_u16(cols_3_7_rows0123), vget_low_u16(cols_3_7_rows4567)));
+    vst1q_u16(dst + (4 * dst_stride), vcombine_u16(vget_high_u16(cols_0_4_rows0123), vget_high_u16(cols_0_4_rows4567)));
+    vst1q_u16(dst + (5 * dst_stride), vcombine_u16(vget_high_u16(cols_1_5_rows0123), vget_high_u16(cols_1_5_rows4567)));
+    vst1q_u16(dst + (6 * dst_stride), vcombine_u16(vget_high_u16(cols_2_6_rows0123), vget_high_u16(cols_2_6_rows4567)));
+    vst1q_u16(dst + (7 * dst_stride), vcombine_u16(vget_high_u16(cols_3_7_rows0123), vget_high_u16(cols_3_7_rows4567)));
+}
+
+// Packed RGB pixels (rows of 3 contiguous elements) are de-interleaved into 3 planes
+template<>
+inline bool TransposeKernels::transpose_3_cols<uint8_t>(const uint8_t *src, size_t src_stride, uint8_t *dst,
+    size_t dst_stride, uint32_t rows, uint32_t cols)
+{
+    static const uint32_t PIXELS_PER_LOAD = 16;
+    if ((3 != cols) || (3 != src_stride)) {
+        return false;
+    }
+
+    uint32_t r = 0;
+    for (; (r + PIXELS_PER_LOAD) <= rows; r += PIXELS_PER_LOAD) {
+        const uint8x16x3_t pixels = vld3q_u8(src + (r * 3));
+        vst1q_u8(dst + r, pixels.val[0]);
+        vst1q_u8(dst + dst_stride + r, pixels.val[1]);
+        vst1q_u8(dst + (2 * dst_stride) + r, pixels.val[2]);
+    }
+    transpose_scalar(src, src_stride, dst, dst_stride, r, rows, 0, cols);
+    return true;
+}
+
+template<>
+inline bool TransposeKernels::transpose_3_cols<uint16_t>(const uint16_t *src, size_t src_stride, uint16_t *dst,
+    size_t dst_stride, uint32_t rows, uint32_t cols)
+{
+    static const uint32_t PIXELS_PER_LOAD = 8;
+    if ((3 != cols) || (3 != src_stride)) {
+        return false;
+    }
+
+    uint32_t r = 0;
+    for (; (r + PIXELS_PER_LOAD) <= rows; r += PIXELS_PER_LOAD) {
+        const uint16x8x3_t pixels = vld3q_u16(src + (r * 3));
+        vst1q_u16(dst + r, pixels.val[0]);
+        vst1q_u16(dst + dst_stride + r, pixels.val[1]);
+        vst1q_u16(dst + (2 * dst_stride) + r, pixels.val[2]);
+    }
+    transpose_scalar(src, src_stride, dst, dst_stride, r, rows, 0, cols);
+    return true;
+}
+
+// 3 planes are interleaved into packed RGB pixels
+template<>
+inline bool TransposeKernels::transpose_3_rows<uint8_t>(const uint8_t *src, size_t src_stride, uint8_t *dst,
+    size_t dst_stride, uint32_t rows, uint32_t cols)
+{
+    static const uint32_t PIXELS_PER_STORE = 16;
+    if ((3 != rows) || (3 != dst_stride)) {
+        return false;
+    }
+
+    uint32_t c = 0;
+    for (; (c + PIXELS_PER_STORE) <= cols; c += PIXELS_PER_STORE) {
+        uint8x16x3_t pixels;
+        pixels.val[0] = vld1q_u8(src + c);
+        pixels.val[1] = vld1q_u8(src + src_stride + c);
+        pixels.val[2] = vld1q_u8(src + (2 * src_stride) + c);
+        vst3q_u8(dst + (c * 3), pixels);
+    }
+    transpose_scalar(src, src_stride, dst, dst_stride, 0, rows, c, cols);
+    return true;
+}
+
+template<>
+inline bool TransposeKernels::transpose_3_rows<uint16_t>(const uint16_t *src, size_t src_stride, uint16_t *dst,
+    size_t dst_stride, uint32_t rows, uint32_t cols)
+{
+    static const uint32_t PIXELS_PER_STORE = 8;
+    if ((3 != rows) || (3 != dst_stride)) {
+        return false;
+    }
+
+    uint32_t c = 0;
+    for (; (c + PIXELS_PER_STORE) <= cols; c += PIXELS_PER_STORE) {
+        uint16x8x3_t pixels;
+        pixels.val[0] = vld1q_u16(src + c);
+        pixels.val[1] = vld1q_u16(src + src_stride + c);
+        pixels.val[2] = vld1q_u16(src + (2 * src_stride) + c);
+        vst3q_u16(dst + (c * 3), pixels);
+    }
+    transpose_scalar(src, src_stride, dst, dst_stride, 0, rows, c, cols);
+    return true;
+}
+
+#endif
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSPOSE_KERNELS_HPP_ */
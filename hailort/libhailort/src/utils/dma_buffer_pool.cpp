@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dma_buffer_pool.cpp
+ * @brief A pool of physically continuous dma buffers
+ **/
+
+#include "hailo/dma_buffer_pool.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+#include "utils/dma_buffer_utils.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace hailort
+{
+
+class DmaBufferPoolImpl final
+{
+public:
+    DmaBufferPoolImpl(VDevice &vdevice, size_t buffer_size, hailo_dma_buffer_direction_t direction) :
+        m_vdevice(vdevice), m_buffer_size(buffer_size), m_direction(direction)
+    {}
+
+    ~DmaBufferPoolImpl()
+    {
+        for (const auto &buffer : m_buffers) {
+            if (buffer.is_mapped) {
+                auto status = m_vdevice.dma_unmap_dmabuf(buffer.dmabuf.fd, buffer.dmabuf.size, m_direction);
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__ERROR("Failed to unmap dmabuf {} of the pool, status = {}", buffer.dmabuf.fd, status);
+                }
+            }
+            auto status = DmaBufferUtils::free_dma_heap_buffer(buffer.dmabuf);
+            if (HAILO_SUCCESS != status) {
+                LOGGER__ERROR("Failed to free dmabuf {} of the pool, status = {}", buffer.dmabuf.fd, status);
+            }
+        }
+    }
+
+    DmaBufferPoolImpl(const DmaBufferPoolImpl &) = delete;
+    DmaBufferPoolImpl &operator=(const DmaBufferPoolImpl &) = delete;
+    DmaBufferPoolImpl(DmaBufferPoolImpl &&) = delete;
+    DmaBufferPoolImpl &operator=(DmaBufferPoolImpl &&) = delete;
+
+    // Called once, before the pool is used
+    hailo_status allocate(size_t buffers_count)
+    {
+        // Reserved up front, so acquire() and release() never allocate
+        m_buffers.reserve(buffers_count);
+        m_free_indices.reserve(buffers_count);
+        for (size_t i = 0; i < buffers_count; i++) {
+            TRY(const auto dmabuf, DmaBufferUtils::allocate_dma_heap_buffer(m_buffer_size));
+            m_buffers.emplace_back(Entry{dmabuf, false, false});
+            CHECK_SUCCESS(m_vdevice.dma_map_dmabuf(dmabuf.fd, dmabuf.size, m_direction),
+                "Failed to map dmabuf {} of the pool", dmabuf.fd);
+            m_buffers.back().is_mapped = true;
+            m_free_indices.push_back(buffers_count - i - 1);
+        }
+        return HAILO_SUCCESS;
+    }
+
+    size_t buffer_size() const
+    {
+        return m_buffer_size;
+    }
+
+    size_t buffers_count() const
+    {
+        return m_buffers.size();
+    }
+
+    Expected<hailo_dma_buffer_t> get_buffer(size_t index) const
+    {
+        CHECK_AS_EXPECTED(index < m_buffers.size(), HAILO_INVALID_ARGUMENT, "Invalid buffer index {}", index);
+        return Expected<hailo_dma_buffer_t>(m_buffers[index].dmabuf);
+    }
+
+    Expected<size_t> acquire(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_cv.wait_for(lock, timeout, [this] { return !m_free_indices.empty(); })) {
+            return make_unexpected(HAILO_TIMEOUT);
+        }
+
+        const auto index = m_free_indices.back();
+        m_free_indices.pop_back();
+        m_buffers[index].is_acquired = true;
+        return Expected<size_t>(index);
+    }
+
+    hailo_status release(size_t index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            CHECK(index < m_buffers.size(), HAILO_INVALID_ARGUMENT, "Invalid buffer index {}", index);
+            CHECK(m_buffers[index].is_acquired, HAILO_INVALID_OPERATION, "Buffer {} of the pool isn't acquired", index);
+            m_buffers[index].is_acquired = false;
+            m_free_indices.push_back(index);
+        }
+        m_cv.notify_one();
+        return HAILO_SUCCESS;
+    }
+
+private:
+    struct Entry {
+        hailo_dma_buffer_t dmabuf;
+        bool is_mapped;
+        bool is_acquired;
+    };
+
+    VDevice &m_vdevice;
+    const size_t m_buffer_size;
+    const hailo_dma_buffer_direction_t m_direction;
+    std::vector<Entry> m_buffers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // The most recently released buffer is acquired first (its cache lines are the hottest)
+    std::vector<size_t> m_free_indices;
+};
+
+Expected<std::shared_ptr<DmaBufferPool>> DmaBufferPool::create(VDevice &vdevice, size_t buffer_size,
+    size_t buffers_count, hailo_dma_buffer_direction_t direction)
+{
+    CHECK_AS_EXPECTED((0 < buffer_size) && (0 < buffers_count), HAILO_INVALID_ARGUMENT,
+        "Invalid dma buffer pool of {} buffers of {} bytes", buffers_count, buffer_size);
+
+    auto pimpl = make_unique_nothrow<DmaBufferPoolImpl>(vdevice, buffer_size, direction);
+    CHECK_NOT_NULL_AS_EXPECTED(pimpl, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(pimpl->allocate(buffers_count));
+
+    auto pool = make_shared_nothrow<DmaBufferPool>(std::move(pimpl));
+    CHECK_NOT_NULL_AS_EXPECTED(pool, HAILO_OUT_OF_HOST_MEMORY);
+    return pool;
+}
+
+DmaBufferPool::DmaBufferPool(std::unique_ptr<DmaBufferPoolImpl> pimpl) :
+    m_pimpl(std::move(pimpl))
+{}
+
+DmaBufferPool::~DmaBufferPool() = default;
+
+size_t DmaBufferPool::buffer_size() const
+{
+    return m_pimpl->buffer_size();
+}
+
+size_t DmaBufferPool::buffers_count() const
+{
+    return m_pimpl->buffers_count();
+}
+
+Expected<hailo_dma_buffer_t> DmaBufferPool::get_buffer(size_t index) const
+{
+    return m_pimpl->get_buffer(index);
+}
+
+Expected<size_t> DmaBufferPool::acquire(std::chrono::milliseconds timeout)
+{
+    return m_pimpl->acquire(timeout);
+}
+
+hailo_status DmaBufferPool::release(size_t index)
+{
+    return m_pimpl->release(index);
+}
+
+} /* namespace hailort */
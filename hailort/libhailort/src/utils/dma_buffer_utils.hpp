@@ -15,6 +15,8 @@
 #include "utils/buffer_storage.hpp"
 #include "net_flow/pipeline/pipeline.hpp"
 
+#include <algorithm>
+
 /** hailort namespace */
 namespace hailort
 {
@@ -24,6 +26,26 @@ class HAILORTAPI DmaBufferUtils
 public:
     static Expected<MemoryView> mmap_dma_buffer(hailo_dma_buffer_t dma_buffer, BufferProtection dma_buffer_protection);
     static hailo_status munmap_dma_buffer(hailo_dma_buffer_t dma_buffer, MemoryView dma_buffer_memview, BufferProtection dma_buffer_protection);
+
+    // Allocates a physically continuous dma buffer from the CMA heap (so it can be shared with devices without an
+    // iommu, such as the ISP of Hailo-15). Freed with free_dma_heap_buffer().
+    static Expected<hailo_dma_buffer_t> allocate_dma_heap_buffer(size_t size);
+    static hailo_status free_dma_heap_buffer(hailo_dma_buffer_t dma_buffer);
+
+    // The dmabuf of a plane of a DMABUF pix buffer, as it's mapped to the device. The planes that share a dmabuf are
+    // mapped up to the end of the last one of them, so all of them are transferred from the same mapping.
+    static hailo_dma_buffer_t get_plane_dma_buffer(const hailo_pix_buffer_t &pix_buffer, uint32_t plane_index)
+    {
+        const auto fd = pix_buffer.planes[plane_index].fd;
+        size_t size = 0;
+        for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
+            const auto &plane = pix_buffer.planes[i];
+            if (fd == plane.fd) {
+                size = std::max(size, static_cast<size_t>(plane.offset) + plane.plane_size);
+            }
+        }
+        return hailo_dma_buffer_t{fd, size};
+    }
 };
 
 } /* namespace hailort */
@@ -51,6 +51,8 @@ uint32_t HailoRTCommon::get_nms_host_frame_size(const hailo_nms_shape_t &nms_sha
     double frame_size = 0;
     if (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == format.order) {
         frame_size = get_nms_with_byte_mask_host_frame_size(nms_shape);
+    } else if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == format.order) {
+        frame_size = get_nms_by_score_host_frame_size(nms_shape);
     } else {
         auto shape_size = get_nms_host_shape_size(nms_shape);
         frame_size =  shape_size * get_format_data_bytes(format);
@@ -74,8 +76,8 @@ Expected<hailo_pix_buffer_t> HailoRTCommon::as_hailo_pix_buffer(MemoryView memor
 
         auto uv_data_ptr = reinterpret_cast<uint8_t*>(memory_view.data()) + y_plane_size;
 
-        hailo_pix_buffer_plane_t y {uint32_t(y_plane_size), uint32_t(y_plane_size), {memory_view.data()}};
-        hailo_pix_buffer_plane_t uv {uint32_t(uv_plane_size), uint32_t(uv_plane_size), {uv_data_ptr}};
+        hailo_pix_buffer_plane_t y {uint32_t(y_plane_size), uint32_t(y_plane_size), {memory_view.data()}, 0};
+        hailo_pix_buffer_plane_t uv {uint32_t(uv_plane_size), uint32_t(uv_plane_size), {uv_data_ptr}, 0};
         // Currently only support HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR
         hailo_pix_buffer_t buffer{0, {y, uv}, NUMBER_OF_PLANES_NV12_NV21, HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR};
 
@@ -91,16 +93,16 @@ Expected<hailo_pix_buffer_t> HailoRTCommon::as_hailo_pix_buffer(MemoryView memor
         auto u_data_ptr = (char*)memory_view.data() + y_plane_size;
         auto v_data_ptr = u_data_ptr + u_plane_size;
 
-        hailo_pix_buffer_plane_t y {uint32_t(y_plane_size), uint32_t(y_plane_size), {memory_view.data()}};
-        hailo_pix_buffer_plane_t u {uint32_t(u_plane_size), uint32_t(u_plane_size), {u_data_ptr}};
-        hailo_pix_buffer_plane_t v {uint32_t(v_plane_size), uint32_t(v_plane_size), {v_data_ptr}};
+        hailo_pix_buffer_plane_t y {uint32_t(y_plane_size), uint32_t(y_plane_size), {memory_view.data()}, 0};
+        hailo_pix_buffer_plane_t u {uint32_t(u_plane_size), uint32_t(u_plane_size), {u_data_ptr}, 0};
+        hailo_pix_buffer_plane_t v {uint32_t(v_plane_size), uint32_t(v_plane_size), {v_data_ptr}, 0};
         // Currently only support HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR
         hailo_pix_buffer_t buffer{0, {y, u, v}, NUMBER_OF_PLANES_I420, HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR};
 
         return buffer;
     }
     default: {
-        hailo_pix_buffer_plane_t plane = {(uint32_t)memory_view.size(), (uint32_t)memory_view.size(), {memory_view.data()}};
+        hailo_pix_buffer_plane_t plane = {(uint32_t)memory_view.size(), (uint32_t)memory_view.size(), {memory_view.data()}, 0};
         // Currently only support HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR
         hailo_pix_buffer_t buffer{0, {plane}, 1, HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR};
         return buffer;
@@ -108,6 +110,49 @@ Expected<hailo_pix_buffer_t> HailoRTCommon::as_hailo_pix_buffer(MemoryView memor
     }
 }
 
+Expected<hailo_pix_buffer_t> HailoRTCommon::as_hailo_pix_buffer(hailo_dma_buffer_t dma_buffer, hailo_format_order_t order)
+{
+    // The planes are laid out as in the buffers split by as_hailo_pix_buffer(MemoryView, order)
+    size_t planes_sizes[MAX_NUMBER_OF_PLANES] = {};
+    uint32_t number_of_planes = 0;
+    switch(order){
+    case HAILO_FORMAT_ORDER_NV12:
+    case HAILO_FORMAT_ORDER_NV21: {
+        CHECK_AS_EXPECTED(0 == (dma_buffer.size % 3), HAILO_INVALID_ARGUMENT, "buffer size must be divisible by 3");
+        planes_sizes[0] = dma_buffer.size * 2 / 3;
+        planes_sizes[1] = dma_buffer.size * 1 / 3;
+        number_of_planes = NUMBER_OF_PLANES_NV12_NV21;
+        break;
+    }
+    case HAILO_FORMAT_ORDER_I420: {
+        CHECK_AS_EXPECTED(0 == (dma_buffer.size % 6), HAILO_INVALID_ARGUMENT, "buffer size must be divisible by 6");
+        planes_sizes[0] = dma_buffer.size * 2 / 3;
+        planes_sizes[1] = dma_buffer.size * 1 / 6;
+        planes_sizes[2] = dma_buffer.size * 1 / 6;
+        number_of_planes = NUMBER_OF_PLANES_I420;
+        break;
+    }
+    default: {
+        planes_sizes[0] = dma_buffer.size;
+        number_of_planes = 1;
+        break;
+    }
+    }
+
+    hailo_pix_buffer_t buffer{};
+    buffer.number_of_planes = number_of_planes;
+    buffer.memory_type = HAILO_PIX_BUFFER_MEMORY_TYPE_DMABUF;
+    size_t offset = 0;
+    for (uint32_t i = 0; i < number_of_planes; i++) {
+        buffer.planes[i].bytes_used = static_cast<uint32_t>(planes_sizes[i]);
+        buffer.planes[i].plane_size = static_cast<uint32_t>(planes_sizes[i]);
+        buffer.planes[i].fd = dma_buffer.fd;
+        buffer.planes[i].offset = static_cast<uint32_t>(offset);
+        offset += planes_sizes[i];
+    }
+    return buffer;
+}
+
 bool HailoRTCommon::is_power_measurement_supported(const hailo_device_architecture_t &hw_arch)
 {
     switch(hw_arch) {
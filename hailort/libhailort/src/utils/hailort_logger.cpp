@@ -12,6 +12,7 @@
 
 #include "utils/hailort_logger.hpp"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -47,6 +48,11 @@ namespace hailort
 #define HAILORT_LOGGER_PATH_ENV_VAR ("HAILORT_LOGGER_PATH")
 #define HAILORT_LOGGER_FLUSH_EVERY_PRINT_ENV_VAR ("HAILORT_LOGGER_FLUSH_EVERY_PRINT")
 #define PERIODIC_FLUSH_INTERVAL_IN_SECONDS (5)
+// If set to "1", the messages are written to the sinks by a background thread, so logging never blocks the caller (once
+// the queue is full, the oldest messages are dropped)
+#define HAILORT_LOGGER_ASYNC_ENV_VAR ("HAILORT_LOGGER_ASYNC")
+#define ASYNC_LOGGER_QUEUE_SIZE (8192)
+#define ASYNC_LOGGER_THREADS_COUNT (1)
 
 
 std::string HailoRTLogger::parse_log_path(const char *log_path)
@@ -192,7 +198,15 @@ HailoRTLogger::HailoRTLogger(spdlog::level::level_enum console_level, spdlog::le
 
     m_console_sink->set_pattern(HAILORT_CONSOLE_LOGGER_PATTERN);
     spdlog::sinks_init_list sink_list = { m_console_sink, m_main_log_file_sink, m_local_log_file_sink };
-    m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sink_list.begin(), sink_list.end());
+    if (is_env_variable_on(HAILORT_LOGGER_ASYNC_ENV_VAR)) {
+        m_thread_pool = make_shared_nothrow<spdlog::details::thread_pool>(ASYNC_LOGGER_QUEUE_SIZE, ASYNC_LOGGER_THREADS_COUNT);
+        if (nullptr != m_thread_pool) {
+            m_hailort_logger = make_shared_nothrow<spdlog::async_logger>(HAILORT_NAME, sink_list.begin(), sink_list.end(),
+                m_thread_pool, spdlog::async_overflow_policy::overrun_oldest);
+        }
+    } else {
+        m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sink_list.begin(), sink_list.end());
+    }
     if (nullptr == m_hailort_logger) {
         std::cerr << "Allocating memory on heap for HailoRT logger has failed! Please check if this host has enough memory. Writing to log will result in a SEGFAULT!" << std::endl;
         return;
@@ -77,6 +77,8 @@ private:
     // The local log will be written to the local directory or to the path the user has chosen (via $HAILORT_LOGGER_PATH)
     std::shared_ptr<spdlog::sinks::sink> m_main_log_file_sink;
     std::shared_ptr<spdlog::sinks::sink> m_local_log_file_sink;
+    // Used if the logging is asynchronous (see HAILORT_LOGGER_ASYNC_ENV_VAR)
+    std::shared_ptr<spdlog::details::thread_pool> m_thread_pool;
     std::shared_ptr<spdlog::logger> m_hailort_logger;
 };
 
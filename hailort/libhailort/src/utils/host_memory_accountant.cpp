@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file host_memory_accountant.cpp
+ * @brief Accounting of the host memory allocated for the models configured on a VDevice
+ **/
+
+#include "utils/host_memory_accountant.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+namespace hailort
+{
+
+static thread_local HostMemoryAccountingScope *s_current_scope = nullptr;
+
+HostMemoryReservation::HostMemoryReservation(std::shared_ptr<HostMemoryAccountant> accountant, const std::string &owner,
+    HostMemoryType type, size_t size) :
+    m_accountant(std::move(accountant)), m_owner(owner), m_type(type), m_size(size)
+{}
+
+HostMemoryReservation::~HostMemoryReservation()
+{
+    m_accountant->release(m_owner, m_type, m_size);
+}
+
+Expected<std::shared_ptr<HostMemoryAccountant>> HostMemoryAccountant::create()
+{
+    auto accountant = make_shared_nothrow<HostMemoryAccountant>();
+    CHECK_NOT_NULL_AS_EXPECTED(accountant, HAILO_OUT_OF_HOST_MEMORY);
+
+    return accountant;
+}
+
+HostMemoryAccountant::HostMemoryAccountant() :
+    m_budget(0), m_total_size(0)
+{}
+
+void HostMemoryAccountant::set_budget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if ((0 != budget) && (m_total_size > budget)) {
+        // The memory already allocated isn't freed, but nothing more is allocated until it is
+        LOGGER__WARNING("Host memory budget {} is lower than the memory already in use {}", budget, m_total_size);
+    }
+    m_budget = budget;
+}
+
+bool HostMemoryAccountant::has_budget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (0 != m_budget);
+}
+
+Expected<HostMemoryReservationPtr> HostMemoryAccountant::reserve(const std::string &owner, HostMemoryType type,
+    size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        CHECK_AS_EXPECTED((0 == m_budget) || ((m_total_size + size) <= m_budget), HAILO_OUT_OF_HOST_MEMORY,
+            "Allocating {} bytes for {} exceeds the host memory budget ({} of {} bytes are in use)", size, owner,
+            m_total_size, m_budget);
+
+        auto &usage = m_usage_by_owner[owner];
+        usage.owner = owner;
+        if (HostMemoryType::HEAP == type) {
+            usage.heap_size += size;
+        } else {
+            usage.dma_size += size;
+        }
+        m_total_size += size;
+    }
+
+    auto reservation = make_shared_nothrow<HostMemoryReservation>(shared_from_this(), owner, type, size);
+    // On failure, the reservation was released by the destructor of the temporary
+    CHECK_NOT_NULL_AS_EXPECTED(reservation, HAILO_OUT_OF_HOST_MEMORY);
+
+    return reservation;
+}
+
+void HostMemoryAccountant::release(const std::string &owner, HostMemoryType type, size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto usage = m_usage_by_owner.find(owner);
+    assert(m_usage_by_owner.end() != usage);
+
+    if (HostMemoryType::HEAP == type) {
+        usage->second.heap_size -= size;
+    } else {
+        usage->second.dma_size -= size;
+    }
+    m_total_size -= size;
+
+    if ((0 == usage->second.heap_size) && (0 == usage->second.dma_size)) {
+        m_usage_by_owner.erase(usage);
+    }
+}
+
+std::vector<HostMemoryUsage> HostMemoryAccountant::get_usage() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<HostMemoryUsage> usage;
+    usage.reserve(m_usage_by_owner.size());
+    for (const auto &owner_usage : m_usage_by_owner) {
+        usage.push_back(owner_usage.second);
+    }
+
+    return usage;
+}
+
+HostMemoryAccountingScope::HostMemoryAccountingScope(std::shared_ptr<HostMemoryAccountant> accountant,
+    const std::string &owner) :
+    m_accountant(std::move(accountant)), m_owner(owner), m_previous_scope(s_current_scope)
+{
+    s_current_scope = this;
+}
+
+HostMemoryAccountingScope::~HostMemoryAccountingScope()
+{
+    assert(this == s_current_scope);
+    s_current_scope = m_previous_scope;
+}
+
+Expected<HostMemoryReservationPtr> HostMemoryAccountingScope::reserve(HostMemoryType type, size_t size)
+{
+    if ((nullptr == s_current_scope) || (nullptr == s_current_scope->m_accountant)) {
+        return HostMemoryReservationPtr();
+    }
+
+    return s_current_scope->m_accountant->reserve(s_current_scope->m_owner, type, size);
+}
+
+} /* namespace hailort */
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file host_memory_accountant.hpp
+ * @brief Accounting of the host memory allocated for the models configured on a VDevice, with an optional budget.
+ *
+ * The memory is accounted while a HostMemoryAccountingScope is active on the allocating thread (e.g. while an
+ * InferModel is configured) - the allocations of buffer storages and dma-able buffers reserve their size in the
+ * scope's accountant, and release it once they are freed. A reservation exceeding the budget fails with
+ * HAILO_OUT_OF_HOST_MEMORY, as a real allocation failure would.
+ **/
+
+#ifndef _HAILO_HOST_MEMORY_ACCOUNTANT_HPP_
+#define _HAILO_HOST_MEMORY_ACCOUNTANT_HPP_
+
+#include "hailo/expected.hpp"
+#include "hailo/vdevice.hpp"
+
+#include "common/utils.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+enum class HostMemoryType {
+    HEAP = 0,
+    // Memory allocated for DMA (pinned once it is mapped to the device)
+    DMA
+};
+
+class HostMemoryAccountant;
+
+// Holds size bytes reserved in the accountant, until it is destroyed
+class HostMemoryReservation final
+{
+public:
+    HostMemoryReservation(std::shared_ptr<HostMemoryAccountant> accountant, const std::string &owner,
+        HostMemoryType type, size_t size);
+    ~HostMemoryReservation();
+
+    HostMemoryReservation(const HostMemoryReservation &) = delete;
+    HostMemoryReservation &operator=(const HostMemoryReservation &) = delete;
+    HostMemoryReservation(HostMemoryReservation &&) = delete;
+    HostMemoryReservation &operator=(HostMemoryReservation &&) = delete;
+
+private:
+    std::shared_ptr<HostMemoryAccountant> m_accountant;
+    const std::string m_owner;
+    const HostMemoryType m_type;
+    const size_t m_size;
+};
+using HostMemoryReservationPtr = std::shared_ptr<HostMemoryReservation>;
+
+class HostMemoryAccountant final : public std::enable_shared_from_this<HostMemoryAccountant>
+{
+public:
+    static Expected<std::shared_ptr<HostMemoryAccountant>> create();
+
+    // 0 means unlimited
+    void set_budget(size_t budget);
+    bool has_budget() const;
+
+    Expected<HostMemoryReservationPtr> reserve(const std::string &owner, HostMemoryType type, size_t size);
+    std::vector<HostMemoryUsage> get_usage() const;
+
+    HostMemoryAccountant();
+
+private:
+    friend class HostMemoryReservation;
+    void release(const std::string &owner, HostMemoryType type, size_t size);
+
+    mutable std::mutex m_mutex;
+    size_t m_budget;
+    size_t m_total_size;
+    std::map<std::string, HostMemoryUsage> m_usage_by_owner;
+};
+
+// Accounts the allocations of the current thread to owner, until the scope is destroyed. Scopes may be nested (the
+// innermost one is used).
+class HostMemoryAccountingScope final
+{
+public:
+    HostMemoryAccountingScope(std::shared_ptr<HostMemoryAccountant> accountant, const std::string &owner);
+    ~HostMemoryAccountingScope();
+
+    HostMemoryAccountingScope(const HostMemoryAccountingScope &) = delete;
+    HostMemoryAccountingScope &operator=(const HostMemoryAccountingScope &) = delete;
+    HostMemoryAccountingScope(HostMemoryAccountingScope &&) = delete;
+    HostMemoryAccountingScope &operator=(HostMemoryAccountingScope &&) = delete;
+
+    // Reserves size bytes in the accountant of the current thread's scope. Returns nullptr if there is no scope.
+    static Expected<HostMemoryReservationPtr> reserve(HostMemoryType type, size_t size);
+
+    // Ties the reservation to the lifetime of object (the returned pointer shares the ownership of both)
+    template<typename T>
+    static std::shared_ptr<T> attach(std::shared_ptr<T> object, HostMemoryReservationPtr reservation)
+    {
+        if (nullptr == reservation) {
+            return object;
+        }
+
+        auto holder = make_shared_nothrow<std::pair<std::shared_ptr<T>, HostMemoryReservationPtr>>(std::move(object),
+            std::move(reservation));
+        if (nullptr == holder) {
+            return nullptr;
+        }
+        return std::shared_ptr<T>(holder, holder->first.get());
+    }
+
+private:
+    std::shared_ptr<HostMemoryAccountant> m_accountant;
+    const std::string m_owner;
+    HostMemoryAccountingScope *m_previous_scope;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_HOST_MEMORY_ACCOUNTANT_HPP_ */
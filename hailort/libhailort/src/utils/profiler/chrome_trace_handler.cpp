@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file chrome_trace_handler.cpp
+ * @brief Implementation of the Chrome trace event format handler
+ **/
+
+#include "chrome_trace_handler.hpp"
+#include "scheduler_profiler_handler.hpp"
+
+#include "common/logger_macros.hpp"
+
+#include "utils/hailort_logger.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+
+#define PROFILER_FILE_ENV_VAR ("HAILO_TRACE_PATH")
+#define HOST_PID (0)
+// tid 0 is used for the process' metadata
+#define CORE_OPS_TID (1)
+#define SCHEDULER_DECISIONS_TID (2)
+#define FIRST_STREAM_TID (3)
+// The frames' stages are instant, but the flow events must be bound to slices
+#define FRAME_STAGE_DURATION_US (1)
+
+static const std::string CHROME_TRACE_FILE_NAME_PREFIX("hailort");
+static const std::string CHROME_TRACE_FILE_NAME_SUFFIX(".json");
+
+namespace hailort
+{
+
+static std::string json_escape(const std::string &str)
+{
+    std::ostringstream os;
+    os << std::quoted(str);
+    return os.str();
+}
+
+static std::string create_file_path()
+{
+    auto file_env_var = std::getenv(PROFILER_FILE_ENV_VAR);
+    std::string file_name = CHROME_TRACE_FILE_NAME_PREFIX + "_" + get_current_datetime() + CHROME_TRACE_FILE_NAME_SUFFIX;
+    if (nullptr != file_env_var) {
+        file_name = std::string(file_env_var) + PATH_SEPARATOR + file_name;
+    }
+    return file_name;
+}
+
+ChromeTraceHandler::ChromeTraceHandler(int64_t start_time_since_epoch_ns) :
+    m_start_time_since_epoch_ns(start_time_since_epoch_ns),
+    m_file_path(create_file_path())
+{
+    add_metadata(HOST_PID, 0, "HailoRT host");
+}
+
+ChromeTraceHandler::~ChromeTraceHandler()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    dump();
+}
+
+std::string ChromeTraceHandler::timestamp_us(uint64_t timestamp) const
+{
+    const auto ns_since_epoch = static_cast<uint64_t>(m_start_time_since_epoch_ns) + timestamp;
+    std::ostringstream os;
+    os << (ns_since_epoch / 1000) << "." << std::setw(3) << std::setfill('0') << (ns_since_epoch % 1000);
+    return os.str();
+}
+
+void ChromeTraceHandler::add_event(const std::string &event)
+{
+    m_events.emplace_back(event);
+}
+
+void ChromeTraceHandler::add_metadata(uint32_t pid, uint32_t tid, const std::string &name)
+{
+    std::ostringstream os;
+    if (0 == tid) {
+        os << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"args\": {\"name\": " <<
+            json_escape(name) << "}}";
+    } else {
+        os << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid <<
+            ", \"args\": {\"name\": " << json_escape(name) << "}}";
+    }
+    add_event(os.str());
+}
+
+uint32_t ChromeTraceHandler::device_pid(const device_id_t &device_id)
+{
+    auto found = m_devices_pids.find(device_id);
+    if (found != m_devices_pids.end()) {
+        return found->second;
+    }
+
+    const auto pid = static_cast<uint32_t>(m_devices_pids.size() + 1);
+    m_devices_pids.emplace(device_id, pid);
+    add_metadata(pid, 0, "Hailo device " + device_id);
+    add_metadata(pid, CORE_OPS_TID, "Core-ops");
+    add_metadata(pid, SCHEDULER_DECISIONS_TID, "Scheduler decisions");
+    return pid;
+}
+
+ChromeTraceHandler::Track ChromeTraceHandler::stream_track(uint32_t pid, const std::string &stream_name)
+{
+    const auto key = std::make_pair(pid, stream_name);
+    auto found = m_streams_tids.find(key);
+    if (found != m_streams_tids.end()) {
+        return Track{pid, found->second};
+    }
+
+    auto &next_tid = m_next_tid_by_pid[pid];
+    if (next_tid < FIRST_STREAM_TID) {
+        next_tid = FIRST_STREAM_TID;
+    }
+    const auto tid = next_tid++;
+    m_streams_tids.emplace(key, tid);
+    add_metadata(pid, tid, stream_name);
+    return Track{pid, tid};
+}
+
+void ChromeTraceHandler::add_frame_stage(const Track &track, const std::string &name, uint64_t timestamp,
+    scheduler_core_op_handle_t core_op_handle, const std::string &stream_name, FrameStage stage)
+{
+    const auto frame_index = m_frames_count[std::make_tuple(core_op_handle, stream_name, stage)]++;
+    const auto ts = timestamp_us(timestamp);
+
+    std::ostringstream os;
+    os << "{\"name\": " << json_escape(name) << ", \"cat\": \"frame\", \"ph\": \"X\", \"ts\": " << ts << ", \"dur\": " <<
+        FRAME_STAGE_DURATION_US << ", \"pid\": " << track.pid << ", \"tid\": " << track.tid << ", \"args\": {\"frame\": " <<
+        frame_index << ", \"stream\": " << json_escape(stream_name) << "}}";
+    add_event(os.str());
+
+    // A flow per frame of the core-op - starts by its first input and finishes by its last output
+    const auto frame_key = std::make_pair(core_op_handle, frame_index);
+    const auto flow_id = (static_cast<uint64_t>(core_op_handle) << 40) | frame_index;
+    auto flow = m_frames_flows.find(frame_key);
+    std::string phase = "t";
+    if (flow == m_frames_flows.end()) {
+        if (FrameStage::H2D_ENQUEUE != stage) {
+            // The frame's flow started before the handler saw it (or the stage has no matching input)
+            return;
+        }
+        m_frames_flows.emplace(frame_key, 0);
+        phase = "s";
+    } else if (FrameStage::D2H_DEQUEUE == stage) {
+        flow->second++;
+        if (flow->second >= m_outputs_count[core_op_handle]) {
+            m_frames_flows.erase(flow);
+            phase = "f";
+        }
+    }
+
+    std::ostringstream flow_os;
+    flow_os << "{\"name\": \"frame\", \"cat\": \"frame\", \"ph\": \"" << phase << "\", \"id\": " << flow_id <<
+        ", \"ts\": " << ts << ", \"pid\": " << track.pid << ", \"tid\": " << track.tid <<
+        (("f" == phase) ? ", \"bp\": \"e\"}" : "}");
+    add_event(flow_os.str());
+}
+
+void ChromeTraceHandler::end_active_core_op(uint32_t pid, uint64_t timestamp)
+{
+    if (0 == m_active_core_op_pids.erase(pid)) {
+        return;
+    }
+
+    std::ostringstream os;
+    os << "{\"ph\": \"E\", \"ts\": " << timestamp_us(timestamp) << ", \"pid\": " << pid << ", \"tid\": " <<
+        CORE_OPS_TID << "}";
+    add_event(os.str());
+}
+
+void ChromeTraceHandler::handle_trace(const AddCoreOpTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_core_ops_names[trace.core_op_handle] = trace.core_op_name;
+}
+
+void ChromeTraceHandler::handle_trace(const AddDeviceTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    (void)device_pid(trace.device_id);
+}
+
+void ChromeTraceHandler::handle_trace(const AddStreamH2DTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    (void)stream_track(HOST_PID, trace.stream_name);
+    (void)stream_track(device_pid(trace.device_id), trace.stream_name);
+}
+
+void ChromeTraceHandler::handle_trace(const AddStreamD2HTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    (void)stream_track(HOST_PID, trace.stream_name);
+    (void)stream_track(device_pid(trace.device_id), trace.stream_name);
+    m_outputs_count[trace.core_op_handle]++;
+}
+
+void ChromeTraceHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    add_frame_stage(stream_track(HOST_PID, trace.queue_name), "write_frame", trace.timestamp, trace.core_op_handle,
+        trace.queue_name, FrameStage::H2D_ENQUEUE);
+}
+
+void ChromeTraceHandler::handle_trace(const FrameDequeueH2DTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    add_frame_stage(stream_track(device_pid(trace.device_id), trace.queue_name), "input_transfer", trace.timestamp,
+        trace.core_op_handle, trace.queue_name, FrameStage::H2D_DEQUEUE);
+}
+
+void ChromeTraceHandler::handle_trace(const FrameEnqueueD2HTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    add_frame_stage(stream_track(device_pid(trace.device_id), trace.queue_name), "output_transfer", trace.timestamp,
+        trace.core_op_handle, trace.queue_name, FrameStage::D2H_ENQUEUE);
+}
+
+void ChromeTraceHandler::handle_trace(const FrameDequeueD2HTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    add_frame_stage(stream_track(HOST_PID, trace.queue_name), "read_frame", trace.timestamp, trace.core_op_handle,
+        trace.queue_name, FrameStage::D2H_DEQUEUE);
+}
+
+void ChromeTraceHandler::handle_trace(const ActivateCoreOpTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto pid = device_pid(trace.device_id);
+    end_active_core_op(pid, trace.timestamp);
+
+    // The core-op's slice lasts until the next activation or deactivation on the device
+    auto found = m_core_ops_names.find(trace.core_op_handle);
+    const auto name = (found != m_core_ops_names.end()) ? found->second : std::to_string(trace.core_op_handle);
+    std::ostringstream os;
+    os << "{\"name\": " << json_escape(name) << ", \"cat\": \"core_op\", \"ph\": \"B\", \"ts\": " <<
+        timestamp_us(trace.timestamp) << ", \"pid\": " << pid << ", \"tid\": " << CORE_OPS_TID <<
+        ", \"args\": {\"activation_duration_ms\": " << trace.duration << ", \"batch_size\": " << trace.dynamic_batch_size << "}}";
+    add_event(os.str());
+    m_active_core_op_pids.insert(pid);
+}
+
+void ChromeTraceHandler::handle_trace(const DeactivateCoreOpTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    end_active_core_op(device_pid(trace.device_id), trace.timestamp);
+}
+
+void ChromeTraceHandler::handle_trace(const OracleDecisionTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_core_ops_names.find(trace.core_op_handle);
+    const auto name = (found != m_core_ops_names.end()) ? found->second : std::to_string(trace.core_op_handle);
+    std::ostringstream os;
+    os << "{\"name\": " << json_escape("switch to " + name) << ", \"cat\": \"scheduler\", \"ph\": \"i\", \"s\": \"t\", \"ts\": " <<
+        timestamp_us(trace.timestamp) << ", \"pid\": " << device_pid(trace.device_id) << ", \"tid\": " <<
+        SCHEDULER_DECISIONS_TID << ", \"args\": {\"reason_idle\": " << (trace.reason_idle ? "true" : "false") <<
+        ", \"over_threshold\": " << (trace.over_threshold ? "true" : "false") << ", \"over_timeout\": " <<
+        (trace.over_timeout ? "true" : "false") << "}}";
+    add_event(os.str());
+}
+
+void ChromeTraceHandler::handle_trace(const DumpProfilerStateTrace &)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    dump();
+}
+
+void ChromeTraceHandler::dump()
+{
+    // Rewriting the whole file, so it is always a valid trace (the core-ops' open slices are closed by the viewers)
+    std::ofstream output_file(m_file_path, std::ios::out | std::ios::trunc);
+    if (!output_file) {
+        LOGGER__ERROR("Failed opening the chrome trace file {}", m_file_path);
+        return;
+    }
+
+    output_file << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+    for (size_t i = 0; i < m_events.size(); i++) {
+        output_file << m_events[i] << ((i + 1 < m_events.size()) ? ",\n" : "\n");
+    }
+    output_file << "]}\n";
+    if (!output_file) {
+        LOGGER__ERROR("Failed writing the chrome trace file {}", m_file_path);
+    }
+}
+
+} /* namespace hailort */
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file chrome_trace_handler.hpp
+ * @brief Tracer handler exporting the scheduler traces in the Chrome trace event format (opened by Perfetto and by
+ *        chrome://tracing), so they can be viewed on one timeline with the application's own traces.
+ *
+ * The host streams are tracks of the "HailoRT host" process, and each device is a process with a track per stream,
+ * a track of the activated core-ops and a track of the scheduler decisions. The stages of each frame are linked by
+ * flow events. The timestamps are microseconds since the epoch.
+ **/
+
+#ifndef _HAILO_CHROME_TRACE_HANDLER_HPP_
+#define _HAILO_CHROME_TRACE_HANDLER_HPP_
+
+#include "handler.hpp"
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+
+namespace hailort
+{
+
+class ChromeTraceHandler final : public Handler
+{
+public:
+    ChromeTraceHandler(int64_t start_time_since_epoch_ns);
+    ~ChromeTraceHandler();
+
+    ChromeTraceHandler(const ChromeTraceHandler &) = delete;
+    ChromeTraceHandler &operator=(const ChromeTraceHandler &) = delete;
+
+    virtual void handle_trace(const AddCoreOpTrace&) override;
+    virtual void handle_trace(const AddDeviceTrace&) override;
+    virtual void handle_trace(const AddStreamH2DTrace&) override;
+    virtual void handle_trace(const AddStreamD2HTrace&) override;
+    virtual void handle_trace(const FrameEnqueueH2DTrace&) override;
+    virtual void handle_trace(const FrameDequeueH2DTrace&) override;
+    virtual void handle_trace(const FrameEnqueueD2HTrace&) override;
+    virtual void handle_trace(const FrameDequeueD2HTrace&) override;
+    virtual void handle_trace(const ActivateCoreOpTrace&) override;
+    virtual void handle_trace(const DeactivateCoreOpTrace&) override;
+    virtual void handle_trace(const OracleDecisionTrace&) override;
+    virtual void handle_trace(const DumpProfilerStateTrace&) override;
+
+private:
+    struct Track {
+        uint32_t pid;
+        uint32_t tid;
+    };
+
+    enum class FrameStage {
+        H2D_ENQUEUE = 0,
+        H2D_DEQUEUE,
+        D2H_ENQUEUE,
+        D2H_DEQUEUE,
+
+        COUNT
+    };
+
+    uint32_t device_pid(const device_id_t &device_id);
+    Track stream_track(uint32_t pid, const std::string &stream_name);
+    void add_metadata(uint32_t pid, uint32_t tid, const std::string &name);
+    void add_event(const std::string &event);
+    // Adds the frame's stage as a short slice (holding the frame's flow event)
+    void add_frame_stage(const Track &track, const std::string &name, uint64_t timestamp,
+        scheduler_core_op_handle_t core_op_handle, const std::string &stream_name, FrameStage stage);
+    void end_active_core_op(uint32_t pid, uint64_t timestamp);
+    std::string timestamp_us(uint64_t timestamp) const;
+    void dump();
+
+    const int64_t m_start_time_since_epoch_ns;
+    const std::string m_file_path;
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_events;
+    std::unordered_map<device_id_t, uint32_t> m_devices_pids;
+    // (pid, stream name) -> tid
+    std::map<std::pair<uint32_t, std::string>, uint32_t> m_streams_tids;
+    std::unordered_map<uint32_t, uint32_t> m_next_tid_by_pid;
+    std::unordered_map<scheduler_core_op_handle_t, std::string> m_core_ops_names;
+    std::unordered_map<scheduler_core_op_handle_t, uint32_t> m_outputs_count;
+    // (core-op, stream name, stage) -> the amount of the stream's frames that passed the stage, used as the frame's index
+    std::map<std::tuple<scheduler_core_op_handle_t, std::string, FrameStage>, uint64_t> m_frames_count;
+    // (core-op, frame index) of the frames whose flow started -> the amount of the frame's outputs read so far
+    std::map<std::pair<scheduler_core_op_handle_t, uint64_t>, uint32_t> m_frames_flows;
+    // The devices (pids) with an activated core-op, whose slice is still open
+    std::set<uint32_t> m_active_core_op_pids;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_CHROME_TRACE_HANDLER_HPP_ */
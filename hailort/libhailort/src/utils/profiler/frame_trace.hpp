@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file frame_trace.hpp
+ * @brief Trace ids of the frames sent to the service (multi-process mode), used for attributing their latency to the
+ *        client, the transport, the service and the device.
+ **/
+
+#ifndef _HAILO_FRAME_TRACE_HPP_
+#define _HAILO_FRAME_TRACE_HPP_
+
+#include "common/os_utils.hpp"
+
+#include <atomic>
+#include <chrono>
+
+
+namespace hailort
+{
+
+// Sets the trace id of the frames handled by the current thread (0 means no trace id) until the scope ends. The service
+// sets it around the infer request of each frame, so the traces made inside (e.g. FrameEnqueueH2DTrace) carry the id
+// given by the client.
+class FrameTraceIdScope final
+{
+public:
+    explicit FrameTraceIdScope(uint64_t trace_id) :
+        m_prev_trace_id(current())
+    {
+        current() = trace_id;
+    }
+
+    ~FrameTraceIdScope()
+    {
+        current() = m_prev_trace_id;
+    }
+
+    FrameTraceIdScope(const FrameTraceIdScope &) = delete;
+    FrameTraceIdScope &operator=(const FrameTraceIdScope &) = delete;
+    FrameTraceIdScope(FrameTraceIdScope &&) = delete;
+    FrameTraceIdScope &operator=(FrameTraceIdScope &&) = delete;
+
+    static uint64_t &current()
+    {
+        static thread_local uint64_t trace_id = 0;
+        return trace_id;
+    }
+
+private:
+    const uint64_t m_prev_trace_id;
+};
+
+// Unique among all the processes on the host (the pid is kept in the upper bits)
+inline uint64_t generate_frame_trace_id()
+{
+    static std::atomic<uint32_t> s_frames_counter(0);
+    return (static_cast<uint64_t>(OsUtils::get_curr_pid()) << 32) | (++s_frames_counter);
+}
+
+// Monotonic clock, shared by all the processes on the host, so it can time the stages crossing the client and the service
+inline uint64_t get_frame_trace_time_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FRAME_TRACE_HPP_ */
@@ -14,6 +14,7 @@
 #include "hailo/stream.hpp"
 
 #include "vdevice/scheduler/scheduler_base.hpp"
+#include "utils/profiler/frame_trace.hpp"
 
 namespace hailort
 {
@@ -116,11 +117,29 @@ struct AddStreamD2HTrace : Trace
 struct FrameEnqueueH2DTrace : Trace
 {
     FrameEnqueueH2DTrace(scheduler_core_op_handle_t core_op_handle, const std::string &queue_name)
-        : Trace("write_frame"), core_op_handle(core_op_handle), queue_name(queue_name)
+        : Trace("write_frame"), core_op_handle(core_op_handle), queue_name(queue_name),
+          trace_id(FrameTraceIdScope::current())
     {}
 
     scheduler_core_op_handle_t core_op_handle;
     std::string queue_name;
+    uint64_t trace_id; // 0 unless the frame came from a service client
+};
+
+// The frame written to an input stream (traced right after its FrameEnqueueH2DTrace, only while the payloads are
+// recorded). The views are valid only while the trace is handled - the trace is synchronous.
+struct InputFramePayloadTrace : Trace
+{
+    InputFramePayloadTrace(scheduler_core_op_handle_t core_op_handle, const std::string &queue_name,
+        std::vector<MemoryView> &&payload_parts)
+        : Trace("input_frame_payload"), core_op_handle(core_op_handle), queue_name(queue_name),
+          payload_parts(std::move(payload_parts))
+    {}
+
+    scheduler_core_op_handle_t core_op_handle;
+    std::string queue_name;
+    // Empty if the frame can't be read by the host (e.g. a dmabuf)
+    std::vector<MemoryView> payload_parts;
 };
 
 struct FrameDequeueH2DTrace : Trace
@@ -213,6 +232,18 @@ struct SetCoreOpPriorityTrace : Trace
     uint8_t priority;
 };
 
+// The core op's device time is accounted to the client (see CoreOpsScheduler::set_core_op_client)
+struct SetCoreOpClientTrace : Trace
+{
+    SetCoreOpClientTrace(vdevice_core_op_handle_t handle, uint32_t client_id, uint32_t quota_percent)
+        : Trace("set_client"), core_op_handle(handle), client_id(client_id), quota_percent(quota_percent)
+    {}
+
+    vdevice_core_op_handle_t core_op_handle;
+    uint32_t client_id;
+    uint32_t quota_percent;
+};
+
 struct OracleDecisionTrace : Trace
 {
     OracleDecisionTrace(bool reason_idle, device_id_t device_id, vdevice_core_op_handle_t handle, bool over_threshold,
@@ -241,6 +272,49 @@ struct HefLoadedTrace : Trace
     MD5_SUM_t md5_hash;
 };
 
+struct MappedBuffersCacheTrace : Trace
+{
+    MappedBuffersCacheTrace(const device_id_t &device_id, bool is_hit, size_t buffer_size, uint64_t hits_count,
+        uint64_t misses_count, size_t cached_bytes)
+        : Trace("mapped_buffers_cache"), device_id(device_id), is_hit(is_hit), buffer_size(buffer_size),
+          hits_count(hits_count), misses_count(misses_count), cached_bytes(cached_bytes)
+    {}
+
+    device_id_t device_id;
+    bool is_hit;
+    size_t buffer_size;
+    uint64_t hits_count;
+    uint64_t misses_count;
+    size_t cached_bytes;
+};
+
+// A sample of the device telemetry (see Device::start_telemetry)
+struct DeviceTelemetryTrace : Trace
+{
+    DeviceTelemetryTrace(const device_id_t &device_id, float32_t power_watts, float32_t ts0_temperature,
+        float32_t ts1_temperature)
+        : Trace("device_telemetry"), device_id(device_id), power_watts(power_watts), ts0_temperature(ts0_temperature),
+          ts1_temperature(ts1_temperature)
+    {}
+
+    device_id_t device_id;
+    float32_t power_watts;
+    float32_t ts0_temperature;
+    float32_t ts1_temperature;
+};
+
+// Time a frame of a service client spent in one stage of its way (e.g. "rpc_transport", "device")
+struct ServiceFrameStageTrace : Trace
+{
+    ServiceFrameStageTrace(uint64_t trace_id, const std::string &stage, uint64_t duration_ns)
+        : Trace("service_frame_stage"), trace_id(trace_id), stage(stage), duration_ns(duration_ns)
+    {}
+
+    uint64_t trace_id;
+    std::string stage;
+    uint64_t duration_ns;
+};
+
 struct DumpProfilerStateTrace : Trace
 {
     DumpProfilerStateTrace() : Trace("dump_profiler_state") {}
@@ -256,6 +330,7 @@ public:
     virtual void handle_trace(const AddStreamH2DTrace&) {};
     virtual void handle_trace(const AddStreamD2HTrace&) {};
     virtual void handle_trace(const FrameEnqueueH2DTrace&) {};
+    virtual void handle_trace(const InputFramePayloadTrace&) {};
     virtual void handle_trace(const FrameDequeueH2DTrace&) {};
     virtual void handle_trace(const FrameDequeueD2HTrace&) {};
     virtual void handle_trace(const FrameEnqueueD2HTrace&) {};
@@ -267,10 +342,14 @@ public:
     virtual void handle_trace(const SetCoreOpTimeoutTrace&) {};
     virtual void handle_trace(const SetCoreOpThresholdTrace&) {};
     virtual void handle_trace(const SetCoreOpPriorityTrace&) {};
+    virtual void handle_trace(const SetCoreOpClientTrace&) {};
     virtual void handle_trace(const OracleDecisionTrace&) {};
     virtual void handle_trace(const DumpProfilerStateTrace&) {};
     virtual void handle_trace(const InitProfilerProtoTrace&) {};
     virtual void handle_trace(const HefLoadedTrace&) {};
+    virtual void handle_trace(const MappedBuffersCacheTrace&) {};
+    virtual void handle_trace(const ServiceFrameStageTrace&) {};
+    virtual void handle_trace(const DeviceTelemetryTrace&) {};
 
 };
 
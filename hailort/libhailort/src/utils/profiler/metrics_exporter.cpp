@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file metrics_exporter.cpp
+ * @brief Implementation of the OpenMetrics endpoint of the scheduler monitor
+ **/
+
+#include "metrics_exporter.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+#include "common/os_utils.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#if defined(__GNUC__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+
+#define METRICS_HTTP_PATH ("/metrics")
+#define METRICS_LISTEN_BACKLOG (16)
+#define METRICS_POLL_TIMEOUT_MS (200)
+#define METRICS_MAX_REQUEST_SIZE (4096)
+#define METRICS_CONTENT_TYPE ("application/openmetrics-text; version=1.0.0; charset=utf-8")
+
+namespace hailort
+{
+
+static const std::vector<std::chrono::nanoseconds> LATENCY_BUCKETS_UPPER_BOUNDS = {
+    std::chrono::microseconds(500), std::chrono::milliseconds(1), std::chrono::milliseconds(2),
+    std::chrono::milliseconds(5), std::chrono::milliseconds(10), std::chrono::milliseconds(20),
+    std::chrono::milliseconds(50), std::chrono::milliseconds(100), std::chrono::milliseconds(200),
+    std::chrono::milliseconds(500), std::chrono::seconds(1), std::chrono::seconds(5)
+};
+
+void open_metrics_serialize_histogram(std::ostream &os, const std::string &name, const std::string &labels,
+    const LatencyHistogram &histogram)
+{
+    // The count is read first, so the buckets (recorded concurrently) never exceed it
+    const auto count = histogram.count();
+    std::chrono::nanoseconds sum(0);
+    const auto cumulative_counts = histogram.get_cumulative_counts(LATENCY_BUCKETS_UPPER_BOUNDS, sum);
+
+    const auto separator = labels.empty() ? "" : ",";
+    for (size_t i = 0; i < LATENCY_BUCKETS_UPPER_BOUNDS.size(); i++) {
+        const auto upper_bound_sec = std::chrono::duration_cast<std::chrono::duration<double>>(LATENCY_BUCKETS_UPPER_BOUNDS[i]).count();
+        os << name << "_bucket{" << labels << separator << "le=\"" << upper_bound_sec << "\"} " <<
+            std::min(static_cast<uint64_t>(count), cumulative_counts[i]) << "\n";
+    }
+    os << name << "_bucket{" << labels << separator << "le=\"+Inf\"} " << count << "\n";
+    os << name << "_count{" << labels << "} " << count << "\n";
+    os << name << "_sum{" << labels << "} " << std::chrono::duration_cast<std::chrono::duration<double>>(sum).count() << "\n";
+}
+
+std::string open_metrics_escape_label(const std::string &value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const auto c : value) {
+        if ('\\' == c) {
+            escaped += "\\\\";
+        } else if ('"' == c) {
+            escaped += "\\\"";
+        } else if ('\n' == c) {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+Expected<std::unique_ptr<MetricsExporter>> MetricsExporter::create_from_env()
+{
+    auto port_str = get_env_variable(SCHEDULER_MON_METRICS_PORT_ENV_VAR);
+    if (HAILO_SUCCESS != port_str.status()) {
+        return std::unique_ptr<MetricsExporter>(nullptr);
+    }
+
+    const auto port = std::atoi(port_str->c_str());
+    CHECK_AS_EXPECTED((port > 0) && (port <= UINT16_MAX), HAILO_INVALID_ARGUMENT, "Invalid {} value {}",
+        SCHEDULER_MON_METRICS_PORT_ENV_VAR, port_str.value());
+
+    auto address = get_env_variable(SCHEDULER_MON_METRICS_ADDRESS_ENV_VAR);
+    return create((HAILO_SUCCESS == address.status()) ? address.value() : SCHEDULER_MON_METRICS_DEFAULT_ADDRESS,
+        static_cast<uint16_t>(port));
+}
+
+#if defined(__GNUC__)
+
+Expected<std::unique_ptr<MetricsExporter>> MetricsExporter::create(const std::string &address, uint16_t port)
+{
+    sockaddr_in server_address = {};
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons(port);
+    CHECK_AS_EXPECTED(1 == inet_pton(AF_INET, address.c_str(), &server_address.sin_addr), HAILO_INVALID_ARGUMENT,
+        "Invalid metrics address {}", address);
+
+    auto socket_fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    CHECK_AS_EXPECTED(0 <= socket_fd, HAILO_OPEN_FILE_FAILURE, "Failed creating the metrics socket, errno {}", errno);
+
+    int reuse_address = 1;
+    (void)setsockopt(socket_fd, SOL_SOCKET, SO_REUSEADDR, &reuse_address, sizeof(reuse_address));
+    if ((0 != bind(socket_fd, reinterpret_cast<sockaddr*>(&server_address), sizeof(server_address))) ||
+        (0 != listen(socket_fd, METRICS_LISTEN_BACKLOG))) {
+        LOGGER__ERROR("Failed listening on {}:{} for the metrics endpoint, errno {}", address, port, errno);
+        close(socket_fd);
+        return make_unexpected(HAILO_INTERNAL_FAILURE);
+    }
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto exporter = std::unique_ptr<MetricsExporter>(new (std::nothrow) MetricsExporter(socket_fd, status));
+    if (nullptr == exporter) {
+        close(socket_fd);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    LOGGER__INFO("Serving the monitor metrics on {}:{}{}", address, port, METRICS_HTTP_PATH);
+    return exporter;
+}
+
+MetricsExporter::MetricsExporter(int socket_fd, hailo_status &status) :
+    m_socket_fd(socket_fd),
+    m_should_stop(false)
+{
+    m_thread = std::thread(&MetricsExporter::serve, this);
+    status = HAILO_SUCCESS;
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    m_should_stop = true;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    close(m_socket_fd);
+}
+
+void MetricsExporter::serve()
+{
+    OsUtils::set_current_thread_name("HRT_METRICS");
+    while (!m_should_stop) {
+        pollfd poll_fd = {};
+        poll_fd.fd = m_socket_fd;
+        poll_fd.events = POLLIN;
+        const auto poll_res = poll(&poll_fd, 1, METRICS_POLL_TIMEOUT_MS);
+        if (poll_res <= 0) {
+            continue;
+        }
+
+        auto connection_fd = accept4(m_socket_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (0 > connection_fd) {
+            continue;
+        }
+        handle_connection(connection_fd);
+        close(connection_fd);
+    }
+}
+
+void MetricsExporter::handle_connection(int connection_fd)
+{
+    // The scrapers send small requests, the request line is all we need
+    pollfd poll_fd = {};
+    poll_fd.fd = connection_fd;
+    poll_fd.events = POLLIN;
+    if (0 >= poll(&poll_fd, 1, METRICS_POLL_TIMEOUT_MS)) {
+        return;
+    }
+    std::array<char, METRICS_MAX_REQUEST_SIZE> request{};
+    const auto request_size = recv(connection_fd, request.data(), request.size() - 1, 0);
+    if (0 >= request_size) {
+        return;
+    }
+
+    const std::string request_str(request.data(), static_cast<size_t>(request_size));
+    const auto is_metrics_request = (0 == request_str.rfind(std::string("GET ") + METRICS_HTTP_PATH, 0));
+
+    std::string body;
+    if (is_metrics_request) {
+        std::lock_guard<std::mutex> lock(m_metrics_mutex);
+        body = m_metrics + "# EOF\n";
+    }
+
+    std::ostringstream response;
+    if (is_metrics_request) {
+        response << "HTTP/1.1 200 OK\r\nContent-Type: " << METRICS_CONTENT_TYPE << "\r\n";
+    } else {
+        response << "HTTP/1.1 404 Not Found\r\n";
+    }
+    response << "Content-Length: " << body.size() << "\r\nConnection: close\r\n\r\n" << body;
+
+    const auto response_str = response.str();
+    size_t sent = 0;
+    while (sent < response_str.size()) {
+        const auto res = send(connection_fd, response_str.data() + sent, response_str.size() - sent, MSG_NOSIGNAL);
+        if (0 >= res) {
+            return;
+        }
+        sent += static_cast<size_t>(res);
+    }
+}
+
+#else
+
+Expected<std::unique_ptr<MetricsExporter>> MetricsExporter::create(const std::string &address, uint16_t port)
+{
+    (void)address;
+    (void)port;
+    LOGGER__ERROR("The monitor metrics endpoint is not supported on this platform");
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
+MetricsExporter::MetricsExporter(int socket_fd, hailo_status &status) :
+    m_socket_fd(socket_fd),
+    m_should_stop(false)
+{
+    status = HAILO_NOT_IMPLEMENTED;
+}
+
+MetricsExporter::~MetricsExporter()
+{}
+
+void MetricsExporter::serve()
+{}
+
+void MetricsExporter::handle_connection(int)
+{}
+
+#endif
+
+void MetricsExporter::set_metrics(std::string &&metrics)
+{
+    std::lock_guard<std::mutex> lock(m_metrics_mutex);
+    m_metrics = std::move(metrics);
+}
+
+} /* namespace hailort */
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file metrics_exporter.hpp
+ * @brief HTTP endpoint serving the scheduler monitor's metrics in the OpenMetrics text format (scraped by Prometheus)
+ **/
+
+#ifndef _HAILO_METRICS_EXPORTER_HPP_
+#define _HAILO_METRICS_EXPORTER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "common/runtime_statistics_internal.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+
+namespace hailort
+{
+
+// When set (with HAILO_MONITOR=1), the metrics are served on this port at "/metrics"
+#define SCHEDULER_MON_METRICS_PORT_ENV_VAR ("HAILO_MONITOR_METRICS_PORT")
+// The address the metrics endpoint listens on (only the loopback by default)
+#define SCHEDULER_MON_METRICS_ADDRESS_ENV_VAR ("HAILO_MONITOR_METRICS_ADDRESS")
+#define SCHEDULER_MON_METRICS_DEFAULT_ADDRESS ("127.0.0.1")
+
+// Writes the histogram's samples in seconds (the buckets, the count and the sum), labels are added to every sample
+void open_metrics_serialize_histogram(std::ostream &os, const std::string &name, const std::string &labels,
+    const LatencyHistogram &histogram);
+
+// Escapes a label value of the OpenMetrics text format
+std::string open_metrics_escape_label(const std::string &value);
+
+class MetricsExporter final
+{
+public:
+    static Expected<std::unique_ptr<MetricsExporter>> create(const std::string &address, uint16_t port);
+    // Creates the exporter if SCHEDULER_MON_METRICS_PORT_ENV_VAR is set (nullptr otherwise)
+    static Expected<std::unique_ptr<MetricsExporter>> create_from_env();
+
+    MetricsExporter(int socket_fd, hailo_status &status);
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter &) = delete;
+    MetricsExporter &operator=(const MetricsExporter &) = delete;
+    MetricsExporter(MetricsExporter &&) = delete;
+    MetricsExporter &operator=(MetricsExporter &&) = delete;
+
+    // Sets the metrics served from now on (the exposition's text, without the "# EOF" line)
+    void set_metrics(std::string &&metrics);
+
+private:
+    void serve();
+    void handle_connection(int connection_fd);
+
+    const int m_socket_fd;
+    std::atomic<bool> m_should_stop;
+    std::mutex m_metrics_mutex;
+    std::string m_metrics;
+    std::thread m_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_METRICS_EXPORTER_HPP_ */
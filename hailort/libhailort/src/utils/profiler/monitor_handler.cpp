@@ -11,6 +11,10 @@
 
 #include "common/logger_macros.hpp"
 #include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+
+#include <algorithm>
+#include <sstream>
 
 namespace hailort
 {
@@ -33,6 +37,11 @@ void MonitorHandler::clear_monitor() {
     }
     m_devices_info.clear();
     m_core_ops_info.clear();
+    m_clients_info.clear();
+#if defined(__GNUC__)
+    // Removes the name, so the readers stop listing this process
+    m_mon_shared_state.reset();
+#endif
 }
 
 void MonitorHandler::handle_trace(const MonitorStartTrace &trace)
@@ -59,6 +68,28 @@ void MonitorHandler::handle_trace(const AddDeviceTrace &trace)
     m_devices_info.emplace(trace.device_id, device_info);
 }
 
+void MonitorHandler::handle_trace(const DeviceTelemetryTrace &trace)
+{
+    if (!contains(m_devices_info, trace.device_id)) { return; }
+    DeviceInfo::TelemetrySample telemetry;
+    telemetry.is_valid = true;
+    telemetry.power_watts = trace.power_watts;
+    // The hottest sensor is the one relevant for throttling
+    telemetry.temperature = std::max(trace.ts0_temperature, trace.ts1_temperature);
+    m_devices_info.at(trace.device_id).telemetry->store(telemetry);
+}
+
+void MonitorHandler::handle_trace(const SetCoreOpClientTrace &trace)
+{
+    if (!contains(m_core_ops_info, trace.core_op_handle)) { return; } // TODO (HRT-8835): Support multiple vdevices
+    m_core_ops_info[trace.core_op_handle].client_id = trace.client_id;
+    if (!contains(m_clients_info, trace.client_id)) {
+        auto client_name = OsUtils::get_process_name(trace.client_id);
+        m_clients_info[trace.client_id].client_name = client_name ? client_name.release() : "";
+    }
+    m_clients_info[trace.client_id].quota_percent = trace.quota_percent;
+}
+
 void MonitorHandler::handle_trace(const ActivateCoreOpTrace &trace)
 {
     // TODO: 'if' should be removed, this is temporary solution since this trace is called out of the scheduler or vdevice.
@@ -67,12 +98,24 @@ void MonitorHandler::handle_trace(const ActivateCoreOpTrace &trace)
     m_devices_info.at(trace.device_id).current_core_op_handle = trace.core_op_handle;
 }
 
+void MonitorHandler::handle_trace(const OracleDecisionTrace &trace)
+{
+    if (!m_is_monitor_currently_working) { return; }
+    if (!contains(m_core_ops_info, trace.core_op_handle)) { return; } // TODO (HRT-8835): Support multiple vdevices
+    if (!contains(m_devices_info, trace.device_id)) { return; } // TODO (HRT-8835): Support multiple vdevices
+    (*m_core_ops_info[trace.core_op_handle].scheduler_switches_count)++;
+    (*m_devices_info.at(trace.device_id).scheduler_switches_count)++;
+}
+
 void MonitorHandler::handle_trace(const AddStreamH2DTrace &trace)
 {
     auto core_op_handle = get_core_op_handle_by_name(trace.core_op_name);
     if (!contains(m_core_ops_info, core_op_handle)) { return; } // TODO (HRT-8835): Support multiple vdevices
     if (!contains(m_devices_info, trace.device_id)) { return; } // TODO (HRT-8835): Support multiple vdevices
     m_core_ops_info[core_op_handle].input_streams_info[trace.stream_name] = StreamsInfo{trace.queue_size};
+    if (m_core_ops_info[core_op_handle].latency_input_stream.empty()) {
+        m_core_ops_info[core_op_handle].latency_input_stream = trace.stream_name;
+    }
     if (!contains(m_devices_info.at(trace.device_id).requested_transferred_frames_h2d, core_op_handle)) {
         m_devices_info.at(trace.device_id).requested_transferred_frames_h2d.emplace(core_op_handle, make_shared_nothrow<SchedulerCounter>());
     }
@@ -85,6 +128,9 @@ void MonitorHandler::handle_trace(const AddStreamD2HTrace &trace)
     if (!contains(m_core_ops_info, core_op_handle)) { return ;} // TODO (HRT-8835): Support multiple vdevices
     if (!contains(m_devices_info, trace.device_id)) { return ;} // TODO (HRT-8835): Support multiple vdevices
     m_core_ops_info[core_op_handle].output_streams_info[trace.stream_name] = StreamsInfo{trace.queue_size};
+    if (m_core_ops_info[core_op_handle].latency_output_stream.empty()) {
+        m_core_ops_info[core_op_handle].latency_output_stream = trace.stream_name;
+    }
     if (!contains(m_devices_info.at(trace.device_id).finished_transferred_frames_d2h, core_op_handle)) {
         m_devices_info.at(trace.device_id).finished_transferred_frames_d2h.emplace(core_op_handle, make_shared_nothrow<SchedulerCounter>());
     }
@@ -95,19 +141,31 @@ void MonitorHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
 {
     if (!contains(m_core_ops_info, trace.core_op_handle)) { return ;} // TODO (HRT-8835): Support multiple vdevices
     if (!contains(m_core_ops_info[trace.core_op_handle].input_streams_info, trace.queue_name)) { return ;} // TODO (HRT-8835): Support multiple vdevices
-    auto &queue = m_core_ops_info[trace.core_op_handle].input_streams_info[trace.queue_name];
+    auto &core_op_info = m_core_ops_info[trace.core_op_handle];
+    auto &queue = core_op_info.input_streams_info[trace.queue_name];
     queue.pending_frames_count->fetch_add(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
+    if (trace.queue_name == core_op_info.latency_input_stream) {
+        core_op_info.pending_frames_timestamps.push_back(trace.timestamp);
+    }
 }
 
 void MonitorHandler::handle_trace(const FrameDequeueD2HTrace &trace)
 {
     if (!contains(m_core_ops_info, trace.core_op_handle)) { return ;} // TODO (HRT-8835): Support multiple vdevices
     if (!contains(m_core_ops_info[trace.core_op_handle].output_streams_info, trace.queue_name)) { return ;} // TODO (HRT-8835): Support multiple vdevices
-    auto &queue = m_core_ops_info[trace.core_op_handle].output_streams_info[trace.queue_name];
+    auto &core_op_info = m_core_ops_info[trace.core_op_handle];
+    auto &queue = core_op_info.output_streams_info[trace.queue_name];
     queue.pending_frames_count->fetch_sub(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
     queue.total_frames_count->fetch_add(1);
+    if ((trace.queue_name == core_op_info.latency_output_stream) && !core_op_info.pending_frames_timestamps.empty()) {
+        const auto write_timestamp = core_op_info.pending_frames_timestamps.front();
+        core_op_info.pending_frames_timestamps.pop_front();
+        if ((nullptr != core_op_info.latency_histogram) && (trace.timestamp >= write_timestamp)) {
+            core_op_info.latency_histogram->record(std::chrono::nanoseconds(trace.timestamp - write_timestamp));
+        }
+    }
 }
 
 void MonitorHandler::handle_trace(const FrameEnqueueD2HTrace &trace)
@@ -183,14 +241,29 @@ hailo_status MonitorHandler::start_mon(const std::string &unique_vdevice_hash)
     m_mon_shutdown_event = event_exp.release();
     m_last_measured_timestamp = std::chrono::steady_clock::now();
 
-    auto tmp_file = open_temp_mon_file();
-    CHECK_EXPECTED_AS_STATUS(tmp_file);
-    m_mon_tmp_output = tmp_file.release();
+    TRY(m_mon_shared_state, create_mon_shared_state());
+
+    auto interval_str = get_env_variable(SCHEDULER_MON_INTERVAL_ENV_VAR);
+    if (interval_str) {
+        TRY(const auto interval_ms, StringUtils::to_uint32(interval_str.value(), 10));
+        CHECK(0 != interval_ms, HAILO_INVALID_ARGUMENT, "{} must be positive", SCHEDULER_MON_INTERVAL_ENV_VAR);
+        m_mon_interval = std::chrono::milliseconds(interval_ms);
+    }
+
+    if (!m_is_metrics_exporter_initialized) {
+        m_is_metrics_exporter_initialized = true;
+        auto metrics_exporter = MetricsExporter::create_from_env();
+        if (metrics_exporter) {
+            m_metrics_exporter = metrics_exporter.release();
+        } else {
+            LOGGER__WARNING("Failed creating the monitor metrics endpoint, status {}", metrics_exporter.status());
+        }
+    }
 
     m_mon_thread = std::thread([this] ()
     {
         while (true) {
-            auto status = m_mon_shutdown_event->wait(DEFAULT_SCHEDULER_MON_INTERVAL);
+            auto status = m_mon_shutdown_event->wait(m_mon_interval);
             if (HAILO_TIMEOUT == status) {
                 dump_state();
             } else if (HAILO_SUCCESS == status) {
@@ -216,37 +289,44 @@ std::string get_curr_pid_as_str()
 }
 
 #if defined(__GNUC__)
-Expected<std::shared_ptr<TempFile>> MonitorHandler::open_temp_mon_file()
+Expected<SeqlockSharedMemoryPtr> MonitorHandler::create_mon_shared_state()
 {
-    std::string file_name = get_curr_pid_as_str();
-    auto tmp_file = TempFile::create(file_name, SCHEDULER_MON_TMP_DIR);
-    CHECK_EXPECTED(tmp_file);
-
-    auto tmp_file_ptr = make_shared_nothrow<TempFile>(tmp_file.release());
-    CHECK_AS_EXPECTED(nullptr != tmp_file_ptr, HAILO_OUT_OF_HOST_MEMORY);
+    const auto name = get_scheduler_mon_shm_name(OsUtils::get_curr_pid());
+    // A name of this pid can only be left by a previous process that crashed (a pid is reused after the process ends)
+    auto status = SharedMemoryBuffer::remove(name);
+    if (HAILO_SUCCESS == status) {
+        LOGGER__INFO("Removed stale monitor shared memory {}", name);
+    } else if (HAILO_NOT_FOUND != status) {
+        return make_unexpected(status);
+    }
 
-    return tmp_file_ptr;
+    return SeqlockSharedMemory::create_shared(name, SCHEDULER_MON_SHM_MAX_MESSAGE_SIZE);
 }
 
 void MonitorHandler::dump_state()
 {
-    auto file = LockedFile::create(m_mon_tmp_output->name(), "w");
-    if (HAILO_SUCCESS != file.status()) {
-        LOGGER__ERROR("Failed to open and lock file {}, with status: {}", m_mon_tmp_output->name(), file.status());
-        return;
-    }
-
     ProtoMon mon;
     mon.set_pid(get_curr_pid_as_str());
     time_dependent_events_cycle_calc();
     log_monitor_networks_infos(mon);
     log_monitor_device_infos(mon);
     log_monitor_frames_infos(mon);
+    log_monitor_clients_infos(mon);
+    if (nullptr != m_metrics_exporter) {
+        update_metrics(mon);
+    }
 
     clear_accumulators();
 
-    if (!mon.SerializeToFileDescriptor(file->get_fd())) {
-        LOGGER__ERROR("Failed to SerializeToFileDescriptor(), with errno: {}", errno);
+    m_mon_serialized_state.resize(mon.ByteSizeLong());
+    if (!mon.SerializeToArray(m_mon_serialized_state.data(), static_cast<int>(m_mon_serialized_state.size()))) {
+        LOGGER__ERROR("Failed to serialize the monitor state");
+        return;
+    }
+
+    auto status = m_mon_shared_state->write(m_mon_serialized_state.data(), m_mon_serialized_state.size());
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed to publish the monitor state, with status: {}", status);
     }
 }
 #endif
@@ -274,6 +354,13 @@ void MonitorHandler::log_monitor_device_infos(ProtoMon &mon)
         device_infos->set_device_id(device_info_pair.second.device_id);
         device_infos->set_utilization(utilization_percentage);
         device_infos->set_device_arch(device_info_pair.second.device_arch);
+        device_infos->set_scheduler_switches_count(device_info_pair.second.scheduler_switches_count->load());
+        const auto telemetry = device_info_pair.second.telemetry->load();
+        if (telemetry.is_valid) {
+            device_infos->set_has_telemetry(true);
+            device_infos->set_power_watts(telemetry.power_watts);
+            device_infos->set_temperature(telemetry.temperature);
+        }
     }
 }
 
@@ -293,6 +380,31 @@ void MonitorHandler::log_monitor_networks_infos(ProtoMon &mon)
         net_info->set_network_name(m_core_ops_info[core_op_handle].core_op_name);
         net_info->set_utilization(utilization);
         net_info->set_fps(min_fps);
+        net_info->set_scheduler_switches_count(m_core_ops_info[core_op_handle].scheduler_switches_count->load());
+    }
+}
+
+void MonitorHandler::log_monitor_clients_infos(ProtoMon &mon)
+{
+    if (m_clients_info.empty() || m_devices_info.empty()) {
+        return;
+    }
+
+    for (const auto &client_info_pair : m_clients_info) {
+        double client_utilization = 0;
+        for (const auto &core_op_info_pair : m_core_ops_info) {
+            if (client_info_pair.first == core_op_info_pair.second.client_id) {
+                client_utilization += core_op_info_pair.second.utilization;
+            }
+        }
+        auto utilization_percentage = ((client_utilization * 100) /
+            (m_last_measured_time_duration * static_cast<double>(m_devices_info.size())));
+
+        auto client_infos = mon.add_client_infos();
+        client_infos->set_client_pid(client_info_pair.first);
+        client_infos->set_client_name(client_info_pair.second.client_name);
+        client_infos->set_utilization(utilization_percentage);
+        client_infos->set_quota_percent(client_info_pair.second.quota_percent);
     }
 }
 
@@ -411,6 +523,93 @@ void MonitorHandler::update_utilization_read_buffers_finished(const device_id_t
     }
 }
 
+void MonitorHandler::update_metrics(const ProtoMon &mon)
+{
+    std::ostringstream os;
+    os << "# TYPE hailort_device_utilization_percent gauge\n";
+    for (const auto &device_info : mon.device_infos()) {
+        os << "hailort_device_utilization_percent{device_id=\"" << open_metrics_escape_label(device_info.device_id()) <<
+            "\",device_arch=\"" << open_metrics_escape_label(device_info.device_arch()) << "\"} " << device_info.utilization() << "\n";
+    }
+
+    std::ostringstream power_os;
+    std::ostringstream temperature_os;
+    for (const auto &device_info : mon.device_infos()) {
+        if (!device_info.has_telemetry()) {
+            continue;
+        }
+        const auto labels = "{device_id=\"" + open_metrics_escape_label(device_info.device_id()) + "\"}";
+        power_os << "hailort_device_power_watts" << labels << " " << device_info.power_watts() << "\n";
+        temperature_os << "hailort_device_temperature_celsius" << labels << " " << device_info.temperature() << "\n";
+    }
+    os << "# TYPE hailort_device_power_watts gauge\n" << power_os.str();
+    os << "# TYPE hailort_device_temperature_celsius gauge\n" << temperature_os.str();
+
+    os << "# TYPE hailort_network_utilization_percent gauge\n";
+    for (const auto &network_info : mon.networks_infos()) {
+        os << "hailort_network_utilization_percent{network=\"" << open_metrics_escape_label(network_info.network_name()) <<
+            "\"} " << network_info.utilization() << "\n";
+    }
+    os << "# TYPE hailort_network_fps gauge\n";
+    for (const auto &network_info : mon.networks_infos()) {
+        os << "hailort_network_fps{network=\"" << open_metrics_escape_label(network_info.network_name()) << "\"} " <<
+            network_info.fps() << "\n";
+    }
+
+    os << "# TYPE hailort_client_utilization_percent gauge\n";
+    for (const auto &client_info : mon.client_infos()) {
+        os << "hailort_client_utilization_percent{pid=\"" << client_info.client_pid() << "\",name=\"" <<
+            open_metrics_escape_label(client_info.client_name()) << "\"} " << client_info.utilization() << "\n";
+    }
+
+    os << "# TYPE hailort_network_scheduler_switches counter\n";
+    for (const auto &network_info : mon.networks_infos()) {
+        os << "hailort_network_scheduler_switches_total{network=\"" << open_metrics_escape_label(network_info.network_name()) <<
+            "\"} " << network_info.scheduler_switches_count() << "\n";
+    }
+
+    std::ostringstream queue_size_os;
+    std::ostringstream pending_frames_os;
+    std::ostringstream avg_pending_frames_os;
+    for (const auto &net_frames_info : mon.net_frames_infos()) {
+        for (const auto &stream_frames_info : net_frames_info.streams_frames_infos()) {
+            std::ostringstream labels;
+            labels << "{network=\"" << open_metrics_escape_label(net_frames_info.network_name()) << "\",stream=\"" <<
+                open_metrics_escape_label(stream_frames_info.stream_name()) << "\",direction=\"" <<
+                ((PROTO__STREAM_DIRECTION__HOST_TO_DEVICE == stream_frames_info.stream_direction()) ? "h2d" : "d2h") << "\"}";
+            queue_size_os << "hailort_stream_queue_size_frames" << labels.str() << " " << stream_frames_info.buffer_frames_size() << "\n";
+            pending_frames_os << "hailort_stream_pending_frames" << labels.str() << " " << stream_frames_info.pending_frames_count() << "\n";
+            avg_pending_frames_os << "hailort_stream_avg_pending_frames" << labels.str() << " " <<
+                stream_frames_info.avg_pending_frames_count() << "\n";
+        }
+    }
+    os << "# TYPE hailort_stream_queue_size_frames gauge\n" << queue_size_os.str();
+    os << "# TYPE hailort_stream_pending_frames gauge\n" << pending_frames_os.str();
+    os << "# TYPE hailort_stream_avg_pending_frames gauge\n" << avg_pending_frames_os.str();
+
+    // Called before clear_accumulators, so total_frames_count holds the frames read in the last cycle
+    for (auto &core_op_info : m_core_ops_info) {
+        for (const auto &stream : core_op_info.second.output_streams_info) {
+            m_total_read_frames[std::make_pair(core_op_info.second.core_op_name, stream.first)] += stream.second.total_frames_count->load();
+        }
+    }
+    os << "# TYPE hailort_stream_read_frames counter\n";
+    for (const auto &total_read_frames : m_total_read_frames) {
+        os << "hailort_stream_read_frames_total{network=\"" << open_metrics_escape_label(total_read_frames.first.first) <<
+            "\",stream=\"" << open_metrics_escape_label(total_read_frames.first.second) << "\"} " << total_read_frames.second << "\n";
+    }
+
+    os << "# TYPE hailort_frame_latency_seconds histogram\n";
+    for (const auto &core_op_info : m_core_ops_info) {
+        if (nullptr != core_op_info.second.latency_histogram) {
+            open_metrics_serialize_histogram(os, "hailort_frame_latency_seconds",
+                "network=\"" + open_metrics_escape_label(core_op_info.second.core_op_name) + "\"", *core_op_info.second.latency_histogram);
+        }
+    }
+
+    m_metrics_exporter->set_metrics(os.str());
+}
+
 void MonitorHandler::clear_accumulators()
 {
     for (auto &device_info : m_devices_info) {
@@ -11,6 +11,7 @@
 #define _HAILO_MONITOR_HANDLER_HPP_
 
 #include "handler.hpp"
+#include "metrics_exporter.hpp"
 
 #include "hailo/hailort.h"
 #include "hailo/expected.hpp"
@@ -18,11 +19,14 @@
 
 #include "common/filesystem.hpp"
 #include "common/utils.hpp"
+#include "common/seqlock_shared_memory.hpp"
 #include "common/runtime_statistics_internal.hpp"
 
 #include "vdevice/scheduler/scheduler_base.hpp"
 
+#include <deque>
 #include <iostream>
+#include <map>
 #include <string>
 #include <thread>
 
@@ -44,12 +48,23 @@
 namespace hailort
 {
 
-#define SCHEDULER_MON_TMP_DIR ("/tmp/hmon_files/")
+// Each monitored process publishes its state (a serialized ProtoMon) into the shared memory object named
+// SCHEDULER_MON_SHM_NAME_PREFIX + pid, listed (on Linux) under SCHEDULER_MON_SHM_DIR
+#define SCHEDULER_MON_SHM_NAME_PREFIX ("hailo_monitor_")
+#define SCHEDULER_MON_SHM_DIR ("/dev/shm/")
+#define SCHEDULER_MON_SHM_MAX_MESSAGE_SIZE (4 * 1024 * 1024)
 #define SCHEDULER_MON_ENV_VAR ("HAILO_MONITOR")
 #define SCHEDULER_MON_ENV_VAR_VALUE ("1")
+// Overrides the interval (in milliseconds) in which the monitored process publishes its state
+#define SCHEDULER_MON_INTERVAL_ENV_VAR ("HAILO_MONITOR_INTERVAL_MS")
 #define DEFAULT_SCHEDULER_MON_INTERVAL (std::chrono::seconds(1))
 #define SCHEDULER_MON_NAN_VAL (-1)
 
+inline std::string get_scheduler_mon_shm_name(uint32_t pid)
+{
+    return std::string("/") + SCHEDULER_MON_SHM_NAME_PREFIX + std::to_string(pid);
+}
+
 using stream_name = std::string;
 
 class SchedulerCounter
@@ -129,7 +144,9 @@ struct DeviceInfo {
     DeviceInfo(const device_id_t &device_id, const std::string &device_arch) :
         device_id(device_id), device_arch(device_arch), device_has_drained_everything(true),
         device_utilization_duration(0), last_measured_utilization_timestamp(std::chrono::steady_clock::now()),
-        current_core_op_handle(INVALID_CORE_OP_HANDLE), requested_transferred_frames_h2d(), finished_transferred_frames_d2h()
+        current_core_op_handle(INVALID_CORE_OP_HANDLE), requested_transferred_frames_h2d(), finished_transferred_frames_d2h(),
+        scheduler_switches_count(make_shared_nothrow<std::atomic<uint64_t>>(0)),
+        telemetry(make_shared_nothrow<std::atomic<TelemetrySample>>(TelemetrySample{}))
     {}
     std::string device_id;
     std::string device_arch;
@@ -139,6 +156,16 @@ struct DeviceInfo {
     scheduler_core_op_handle_t current_core_op_handle;
     std::unordered_map<scheduler_core_op_handle_t, std::shared_ptr<SchedulerCounter>> requested_transferred_frames_h2d;
     std::unordered_map<scheduler_core_op_handle_t, std::shared_ptr<SchedulerCounter>> finished_transferred_frames_d2h;
+    // Counted since the monitor started (not cleared on each cycle)
+    std::shared_ptr<std::atomic<uint64_t>> scheduler_switches_count;
+
+    // The last telemetry sample of the device, if the telemetry sampling runs (see Device::start_telemetry)
+    struct TelemetrySample {
+        bool is_valid = false;
+        float32_t power_watts = 0;
+        float32_t temperature = 0;
+    };
+    std::shared_ptr<std::atomic<TelemetrySample>> telemetry;
 };
 
 struct StreamsInfo {
@@ -153,6 +180,21 @@ struct CoreOpInfo {
     std::unordered_map<stream_name, StreamsInfo> output_streams_info;
     std::string core_op_name;
     double utilization;
+    // The frames' latency is measured from the write of the core-op's first input stream to the read of its first
+    // output stream (the frames are read in the order they were written)
+    stream_name latency_input_stream;
+    stream_name latency_output_stream;
+    std::deque<uint64_t> pending_frames_timestamps;
+    LatencyHistogramPtr latency_histogram = make_shared_nothrow<LatencyHistogram>();
+    // The scheduler's decisions to switch to the core-op, counted since the monitor started (not cleared on each cycle)
+    std::shared_ptr<std::atomic<uint64_t>> scheduler_switches_count = make_shared_nothrow<std::atomic<uint64_t>>(0);
+    // The client whose device time the core-op is accounted to (0 if none, see SetCoreOpClientTrace)
+    uint32_t client_id = 0;
+};
+
+struct ClientInfo {
+    std::string client_name;
+    uint32_t quota_percent;
 };
 
 class MonitorHandler : public Handler
@@ -173,40 +215,54 @@ public:
     virtual void handle_trace(const FrameDequeueH2DTrace&) override;
     virtual void handle_trace(const FrameEnqueueD2HTrace&) override;
     virtual void handle_trace(const ActivateCoreOpTrace&) override;
+    virtual void handle_trace(const OracleDecisionTrace&) override;
     virtual void handle_trace(const MonitorStartTrace&) override;
     virtual void handle_trace(const MonitorEndTrace&) override;
     virtual void handle_trace(const AddDeviceTrace&) override;
+    virtual void handle_trace(const DeviceTelemetryTrace&) override;
+    virtual void handle_trace(const SetCoreOpClientTrace&) override;
 
 private:
     hailo_status start_mon(const std::string &unique_vdevice_hash);
 #if defined(__GNUC__)
-    Expected<std::shared_ptr<TempFile>> open_temp_mon_file();
+    Expected<SeqlockSharedMemoryPtr> create_mon_shared_state();
     void dump_state();
 #endif
     void time_dependent_events_cycle_calc();
     void log_monitor_device_infos(ProtoMon &mon);
     void log_monitor_networks_infos(ProtoMon &mon);
     void log_monitor_frames_infos(ProtoMon &mon);
+    void log_monitor_clients_infos(ProtoMon &mon);
     void update_utilization_timers(const device_id_t &device_id, scheduler_core_op_handle_t core_op_handle);
     void update_utilization_timestamp(const device_id_t &device_id);
     void update_utilization_send_started(const device_id_t &device_id);
     void update_device_drained_state(const device_id_t &device_id, bool state);
     void update_utilization_read_buffers_finished(const device_id_t &device_id, scheduler_core_op_handle_t core_op_handle, bool is_drained_everything);
     void clear_accumulators();
+    void update_metrics(const ProtoMon &mon);
     scheduler_core_op_handle_t get_core_op_handle_by_name(const std::string &name);
 
     bool m_is_monitor_currently_working = false;
     std::thread m_mon_thread;
     EventPtr m_mon_shutdown_event;
 #if defined(__GNUC__)
-    std::shared_ptr<TempFile> m_mon_tmp_output;
+    SeqlockSharedMemoryPtr m_mon_shared_state;
+    // Reused between the cycles, so the state is serialized without allocations
+    std::vector<uint8_t> m_mon_serialized_state;
 #endif
+    std::chrono::milliseconds m_mon_interval = DEFAULT_SCHEDULER_MON_INTERVAL;
     std::chrono::time_point<std::chrono::steady_clock> m_last_measured_timestamp;
     double m_last_measured_time_duration;
     // TODO: Consider adding Accumulator classes for more info (min, max, mean, etc..)
     std::unordered_map<scheduler_core_op_handle_t, CoreOpInfo> m_core_ops_info;
     std::unordered_map<device_id_t, DeviceInfo> m_devices_info;
+    std::map<uint32_t, ClientInfo> m_clients_info;
     std::string m_unique_vdevice_hash; // only one vdevice is allowed at a time. vdevice will be unregistered in its destruction.
+    // Created on the first start_mon (if enabled), and kept until the process ends
+    std::unique_ptr<MetricsExporter> m_metrics_exporter;
+    bool m_is_metrics_exporter_initialized = false;
+    // (network name, stream name) -> the frames read since the monitor started
+    std::map<std::pair<std::string, std::string>, uint64_t> m_total_read_frames;
 };
 }
 
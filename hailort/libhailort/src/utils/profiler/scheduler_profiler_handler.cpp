@@ -261,7 +261,8 @@ void SchedulerProfilerHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
         {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
+        {"queue_name", json_to_string(trace.queue_name)},
+        {"trace_id", json_to_string(trace.trace_id)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
@@ -270,6 +271,7 @@ void SchedulerProfilerHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
     added_trace->mutable_frame_enqueue()->set_stream_name(trace.queue_name);
     added_trace->mutable_frame_enqueue()->set_core_op_handle(trace.core_op_handle);
     added_trace->mutable_frame_enqueue()->set_time_stamp(trace.timestamp);
+    added_trace->mutable_frame_enqueue()->set_trace_id(trace.trace_id);
 }
 
 void SchedulerProfilerHandler::handle_trace(const FrameDequeueH2DTrace &trace)
@@ -414,6 +416,48 @@ void SchedulerProfilerHandler::handle_trace(const OracleDecisionTrace &trace)
     added_trace->mutable_switch_core_op_decision()->set_over_timeout(trace.over_timeout);
 }
 
+void SchedulerProfilerHandler::handle_trace(const MappedBuffersCacheTrace &trace)
+{
+    log(JSON({
+        {"action", json_to_string(trace.name)},
+        {"timestamp", json_to_string(trace.timestamp)},
+        {"device_id", json_to_string(trace.device_id)},
+        {"is_hit", json_to_string(trace.is_hit)},
+        {"buffer_size", json_to_string((uint64_t)trace.buffer_size)},
+        {"hits_count", json_to_string(trace.hits_count)},
+        {"misses_count", json_to_string(trace.misses_count)},
+        {"cached_bytes", json_to_string((uint64_t)trace.cached_bytes)}
+    }));
+
+    std::lock_guard<std::mutex> lock(m_proto_lock);
+    auto added_trace = m_profiler_trace_proto.add_added_trace();
+    added_trace->mutable_mapped_buffers_cache()->set_time_stamp(trace.timestamp);
+    added_trace->mutable_mapped_buffers_cache()->set_device_id(trace.device_id);
+    added_trace->mutable_mapped_buffers_cache()->set_is_hit(trace.is_hit);
+    added_trace->mutable_mapped_buffers_cache()->set_buffer_size(trace.buffer_size);
+    added_trace->mutable_mapped_buffers_cache()->set_hits_count(trace.hits_count);
+    added_trace->mutable_mapped_buffers_cache()->set_misses_count(trace.misses_count);
+    added_trace->mutable_mapped_buffers_cache()->set_cached_bytes(trace.cached_bytes);
+}
+
+void SchedulerProfilerHandler::handle_trace(const ServiceFrameStageTrace &trace)
+{
+    log(JSON({
+        {"action", json_to_string(trace.name)},
+        {"timestamp", json_to_string(trace.timestamp)},
+        {"trace_id", json_to_string(trace.trace_id)},
+        {"stage", json_to_string(trace.stage)},
+        {"duration_ns", json_to_string(trace.duration_ns)}
+    }));
+
+    std::lock_guard<std::mutex> lock(m_proto_lock);
+    auto added_trace = m_profiler_trace_proto.add_added_trace();
+    added_trace->mutable_service_frame_stage()->set_time_stamp(trace.timestamp);
+    added_trace->mutable_service_frame_stage()->set_trace_id(trace.trace_id);
+    added_trace->mutable_service_frame_stage()->set_stage(trace.stage);
+    added_trace->mutable_service_frame_stage()->set_duration(trace.duration_ns);
+}
+
 void SchedulerProfilerHandler::handle_trace(const DumpProfilerStateTrace &trace)
 {
     (void)trace;
@@ -30,6 +30,9 @@
 
 namespace hailort
 {
+// Used for naming the trace files
+std::string get_current_datetime();
+
 class SchedulerProfilerHandler : public Handler
 {
 public:
@@ -56,6 +59,8 @@ public:
     virtual void handle_trace(const DumpProfilerStateTrace&) override;
     virtual void handle_trace(const InitProfilerProtoTrace&) override;
     virtual void handle_trace(const HefLoadedTrace&) override;
+    virtual void handle_trace(const MappedBuffersCacheTrace&) override;
+    virtual void handle_trace(const ServiceFrameStageTrace&) override;
 
 private:
     void log(JSON json);
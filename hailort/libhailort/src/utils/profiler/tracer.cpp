@@ -8,29 +8,156 @@
  **/
 
 #include "common/utils.hpp"
+#include "common/os_utils.hpp"
 
 #include "utils/profiler/tracer.hpp"
 
+#include <algorithm>
+
 #define PROFILER_ENV_VAR ("HAILO_TRACE")
 #define PROFILER_ENV_VAR_VALUE ("scheduler")
+#define PROFILER_CHROME_TRACE_ENV_VAR_VALUE ("chrome")
+#define PROFILER_TRAFFIC_RECORD_ENV_VAR_VALUE ("record")
+// Bounds the time the drain thread holds the rings, so new threads can register their rings meanwhile
+#define MAX_TRACES_PER_DRAIN (4 * TRACES_RING_SLOTS_COUNT)
+#define TRACER_DRAIN_INTERVAL (std::chrono::milliseconds(1))
 
 namespace hailort
 {
 
-Tracer::Tracer()
+static bool is_tracer_enabled_by_env()
+{
+    return is_env_variable_on(PROFILER_ENV_VAR, PROFILER_ENV_VAR_VALUE) ||
+        is_env_variable_on(PROFILER_ENV_VAR, PROFILER_CHROME_TRACE_ENV_VAR_VALUE) ||
+        is_env_variable_on(PROFILER_ENV_VAR, PROFILER_TRAFFIC_RECORD_ENV_VAR_VALUE) ||
+        is_env_variable_on(SCHEDULER_MON_ENV_VAR, SCHEDULER_MON_ENV_VAR_VALUE);
+}
+
+static bool is_recording_payloads_by_env()
+{
+    return is_env_variable_on(PROFILER_ENV_VAR, PROFILER_TRAFFIC_RECORD_ENV_VAR_VALUE) &&
+        is_env_variable_on(TRAFFIC_RECORD_PAYLOADS_ENV_VAR);
+}
+
+std::atomic<bool> Tracer::s_is_enabled(is_tracer_enabled_by_env());
+std::atomic<bool> Tracer::s_is_recording_payloads(is_recording_payloads_by_env());
+
+Tracer::Tracer() :
+    m_should_stop_drain(false)
 {
     init_scheduler_profiler_handler();
     init_monitor_handler();
+    init_traffic_record_handler();
+
+    m_is_async = (m_should_trace || m_should_monitor || m_should_record) && !is_env_variable_on(TRACER_SYNCHRONOUS_ENV_VAR);
+    if (m_is_async) {
+        m_drain_thread = std::thread(&Tracer::drain_thread, this);
+    }
+}
+
+Tracer::~Tracer()
+{
+    if (m_drain_thread.joinable()) {
+        m_should_stop_drain = true;
+        m_drain_thread.join();
+    }
+}
+
+TracesRing *Tracer::get_thread_ring()
+{
+    struct ThreadRing {
+        ~ThreadRing()
+        {
+            if (nullptr != ring) {
+                ring->is_thread_done = true;
+            }
+        }
+
+        std::shared_ptr<TracesRing> ring;
+    };
+    static thread_local ThreadRing thread_ring;
+
+    if (nullptr == thread_ring.ring) {
+        auto ring = make_shared_nothrow<TracesRing>();
+        if (nullptr == ring) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        m_rings.push_back(ring);
+        thread_ring.ring = ring;
+    }
+    return thread_ring.ring.get();
+}
+
+void Tracer::drain_thread()
+{
+    OsUtils::set_current_thread_name("HRT_TRACER");
+    while (!m_should_stop_drain) {
+        size_t handled_traces_count = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_drain_mutex);
+            handled_traces_count = drain_rings();
+        }
+        if (0 == handled_traces_count) {
+            std::this_thread::sleep_for(TRACER_DRAIN_INTERVAL);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    drain_all_rings();
+}
+
+size_t Tracer::drain_rings()
+{
+    std::lock_guard<std::mutex> lock(m_rings_mutex);
+    size_t handled_traces_count = 0;
+    while (handled_traces_count < MAX_TRACES_PER_DRAIN) {
+        // Merging the rings, so the handlers get the traces of all the threads by their timestamps order
+        TracesRing *earliest_ring = nullptr;
+        TraceSlot *earliest_slot = nullptr;
+        for (auto &ring : m_rings) {
+            auto slot = ring->peek();
+            if ((nullptr != slot) && ((nullptr == earliest_slot) || (slot->timestamp < earliest_slot->timestamp))) {
+                earliest_ring = ring.get();
+                earliest_slot = slot;
+            }
+        }
+        if (nullptr == earliest_slot) {
+            break;
+        }
+
+        earliest_slot->handle(earliest_slot->storage, m_handlers);
+        earliest_ring->commit_read();
+        handled_traces_count++;
+    }
+
+    // The rings of the exited threads are removed once drained (is_thread_done is checked first, so no trace is missed)
+    m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](const std::shared_ptr<TracesRing> &ring) {
+        return ring->is_thread_done && (nullptr == ring->peek());
+    }), m_rings.end());
+
+    return handled_traces_count;
+}
+
+void Tracer::drain_all_rings()
+{
+    while (MAX_TRACES_PER_DRAIN == drain_rings()) {}
 }
 
 void Tracer::init_scheduler_profiler_handler()
 {
     const char* env_var_name = PROFILER_ENV_VAR;
-    m_should_trace = is_env_variable_on(env_var_name, PROFILER_ENV_VAR_VALUE);
+    const bool should_profile = is_env_variable_on(env_var_name, PROFILER_ENV_VAR_VALUE);
+    const bool should_export_chrome_trace = is_env_variable_on(env_var_name, PROFILER_CHROME_TRACE_ENV_VAR_VALUE);
+    m_should_trace = should_profile || should_export_chrome_trace;
     if (m_should_trace) {
         m_start_time = std::chrono::high_resolution_clock::now();
         int64_t time_since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(m_start_time.time_since_epoch()).count();
-        m_handlers.push_back(std::make_unique<SchedulerProfilerHandler>(time_since_epoch));
+        if (should_profile) {
+            m_handlers.push_back(std::make_unique<SchedulerProfilerHandler>(time_since_epoch));
+        } else {
+            m_handlers.push_back(std::make_unique<ChromeTraceHandler>(time_since_epoch));
+        }
     }
 }
 
@@ -43,4 +170,14 @@ void Tracer::init_monitor_handler()
     }
 }
 
+void Tracer::init_traffic_record_handler()
+{
+    m_should_record = is_env_variable_on(PROFILER_ENV_VAR, PROFILER_TRAFFIC_RECORD_ENV_VAR_VALUE);
+    if (m_should_record) {
+        m_start_time = std::chrono::high_resolution_clock::now();
+        int64_t time_since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(m_start_time.time_since_epoch()).count();
+        m_handlers.push_back(std::make_unique<TrafficRecordHandler>(time_since_epoch, is_recording_payloads_by_env()));
+    }
+}
+
 }
@@ -14,17 +14,120 @@
 
 #include "scheduler_profiler_handler.hpp"
 #include "monitor_handler.hpp"
+#include "chrome_trace_handler.hpp"
+#include "traffic_record_handler.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#define TRACER_SYNCHRONOUS_ENV_VAR ("HAILO_TRACER_SYNCHRONOUS")
+// Must be a power of 2
+#define TRACES_RING_SLOTS_COUNT (1024)
+#define TRACE_SLOT_SIZE (192)
+
 namespace hailort
 {
+
+using Handlers = std::vector<std::unique_ptr<Handler>>;
+
+// A recorded trace, constructed in place in the slot
+struct TraceSlot
+{
+    // Passes the trace to the handlers and destroys it
+    using HandleFunc = void (*)(void *trace, Handlers &handlers);
+
+    uint64_t timestamp;
+    HandleFunc handle;
+    alignas(std::max_align_t) uint8_t storage[TRACE_SLOT_SIZE];
+};
+
+// Lock-free ring of the traces recorded by a single thread, read only by the tracer's drain thread
+class TracesRing final
+{
+public:
+    TracesRing() : is_thread_done(false), m_head(0), m_tail(0) {}
+
+    // Returns nullptr if the ring is full
+    TraceSlot *acquire_write_slot()
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if ((tail - m_head.load(std::memory_order_acquire)) == TRACES_RING_SLOTS_COUNT) {
+            return nullptr;
+        }
+        return &m_slots[tail & (TRACES_RING_SLOTS_COUNT - 1)];
+    }
+
+    void commit_write()
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Returns nullptr if the ring is empty
+    TraceSlot *peek()
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &m_slots[head & (TRACES_RING_SLOTS_COUNT - 1)];
+    }
+
+    void commit_read()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Set once the recording thread exits, so the ring can be removed after it is drained
+    std::atomic<bool> is_thread_done;
+
+private:
+    std::array<TraceSlot, TRACES_RING_SLOTS_COUNT> m_slots;
+    std::atomic<size_t> m_head;
+    std::atomic<size_t> m_tail;
+};
+
+// Traces handled on the calling thread (after all the traces recorded before them), since the caller relies on their effect
+template<class TraceType>
+struct is_synchronous_trace : std::integral_constant<bool, (sizeof(TraceType) > TRACE_SLOT_SIZE)> {};
+template<> struct is_synchronous_trace<InitProfilerProtoTrace> : std::true_type {};
+template<> struct is_synchronous_trace<DumpProfilerStateTrace> : std::true_type {};
+template<> struct is_synchronous_trace<MonitorStartTrace> : std::true_type {};
+template<> struct is_synchronous_trace<MonitorEndTrace> : std::true_type {};
+// The payload's buffers are valid only during the trace
+template<> struct is_synchronous_trace<InputFramePayloadTrace> : std::true_type {};
+
+// The traced threads only record the traces in their own ring, and a background thread passes them to the handlers (in
+// timestamps order), so the handlers' work and locks are out of the hot paths.
 class Tracer
 {
 public:
     Tracer();
+    ~Tracer();
+
+    // Whether any handler is enabled (set once, before the traces). Checked by TRACE before evaluating the trace's args
+    static bool is_enabled()
+    {
+        return s_is_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Whether the input frames are recorded (see TrafficRecordHandler). Checked by TRACE_PAYLOAD, so the frames aren't
+    // traced otherwise
+    static bool is_recording_payloads()
+    {
+        return s_is_recording_payloads.load(std::memory_order_relaxed);
+    }
+
     template<class TraceType, typename... Args>
-    static void trace(Args... trace_args)
+    static void trace(Args&&... trace_args)
     {
         auto &tracer = get_instance();
-        tracer->execute_trace<TraceType>(trace_args...);
+        tracer->execute_trace<TraceType>(std::forward<Args>(trace_args)...);
     }
 
     static std::unique_ptr<Tracer> &get_instance()
@@ -39,27 +142,97 @@ public:
 private:
     void init_monitor_handler();
     void init_scheduler_profiler_handler();
+    void init_traffic_record_handler();
     template<class TraceType, typename... Args>
-    void execute_trace(Args... trace_args)
+    void execute_trace(Args&&... trace_args)
     {
-        if ((!m_should_trace) && (!m_should_monitor)) {
+        if ((!m_should_trace) && (!m_should_monitor) && (!m_should_record)) {
             return;
         }
 
-        TraceType trace_struct(trace_args...);
-        auto curr_time = std::chrono::high_resolution_clock::now();
-        trace_struct.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(curr_time - this->m_start_time).count();
+        if (!m_is_async) {
+            handle_trace<TraceType>(std::forward<Args>(trace_args)...);
+            return;
+        }
+        record_trace<TraceType>(is_synchronous_trace<TraceType>(), std::forward<Args>(trace_args)...);
+    }
+
+    template<class TraceType, typename... Args>
+    void handle_trace(Args&&... trace_args)
+    {
+        TraceType trace_struct(std::forward<Args>(trace_args)...);
+        trace_struct.timestamp = get_timestamp();
         for (auto &handler : this->m_handlers) {
             handler->handle_trace(trace_struct);
         }
     }
 
+    template<class TraceType, typename... Args>
+    void record_trace(std::true_type /*is_synchronous*/, Args&&... trace_args)
+    {
+        std::lock_guard<std::mutex> lock(m_drain_mutex);
+        drain_all_rings();
+        handle_trace<TraceType>(std::forward<Args>(trace_args)...);
+    }
+
+    template<class TraceType, typename... Args>
+    void record_trace(std::false_type /*is_synchronous*/, Args&&... trace_args)
+    {
+        auto ring = get_thread_ring();
+        if (nullptr == ring) {
+            std::lock_guard<std::mutex> lock(m_drain_mutex);
+            handle_trace<TraceType>(std::forward<Args>(trace_args)...);
+            return;
+        }
+
+        auto slot = ring->acquire_write_slot();
+        while (nullptr == slot) {
+            // Waiting for the drain thread rather than losing traces the handlers' state depends on
+            std::this_thread::yield();
+            slot = ring->acquire_write_slot();
+        }
+        auto trace_struct = new (slot->storage) TraceType(std::forward<Args>(trace_args)...);
+        trace_struct->timestamp = get_timestamp();
+        slot->timestamp = trace_struct->timestamp;
+        slot->handle = [](void *trace, Handlers &handlers) {
+            auto &recorded_trace = *static_cast<TraceType*>(trace);
+            for (auto &handler : handlers) {
+                handler->handle_trace(recorded_trace);
+            }
+            recorded_trace.~TraceType();
+        };
+        ring->commit_write();
+    }
+
+    uint64_t get_timestamp() const
+    {
+        auto curr_time = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(curr_time - this->m_start_time).count();
+    }
+
+    TracesRing *get_thread_ring();
+    void drain_thread();
+    // Must be called with m_drain_mutex locked. Returns the amount of the handled traces
+    size_t drain_rings();
+    void drain_all_rings();
+
+    static std::atomic<bool> s_is_enabled;
+    static std::atomic<bool> s_is_recording_payloads;
+
     bool m_should_trace = false;
     bool m_should_monitor = false;
+    bool m_should_record = false;
+    bool m_is_async = false;
     std::chrono::high_resolution_clock::time_point m_start_time;
-    std::vector<std::unique_ptr<Handler>> m_handlers;
+    Handlers m_handlers;
+
+    std::mutex m_drain_mutex;
+    std::mutex m_rings_mutex;
+    std::vector<std::shared_ptr<TracesRing>> m_rings;
+    std::atomic<bool> m_should_stop_drain;
+    std::thread m_drain_thread;
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -10,6 +10,8 @@
 #ifndef _HAILO_TRACER_MACROS_HPP_
 #define _HAILO_TRACER_MACROS_HPP_
 
+#include "utils/profiler/frame_trace.hpp"
+
 #if defined HAILO_ENABLE_PROFILER_BUILD
 #include "tracer.hpp"
 #endif
@@ -21,10 +23,32 @@ struct VoidAll {
     template<typename... Args> VoidAll(Args const& ...) {}
 };
 
+// The trace's args are evaluated only when tracing is enabled, so a disabled trace costs a single branch (and nothing
+// when the profiler isn't built - HAILO_BUILD_PROFILER=OFF)
 #if defined HAILO_ENABLE_PROFILER_BUILD
-#define TRACE(type, ...) (Tracer::trace<type>(__VA_ARGS__))
+#define TRACE(type, ...)                            \
+    do {                                            \
+        if (Tracer::is_enabled()) {                 \
+            Tracer::trace<type>(__VA_ARGS__);       \
+        }                                           \
+    } while (0)
+// Traces the frames' payloads, evaluating the args only while the payloads are recorded (HAILO_TRACE=record and
+// HAILO_TRAFFIC_RECORD_PAYLOADS=1)
+#define TRACE_PAYLOAD(type, ...)                    \
+    do {                                            \
+        if (Tracer::is_recording_payloads()) {      \
+            Tracer::trace<type>(__VA_ARGS__);       \
+        }                                           \
+    } while (0)
 #else
-#define TRACE(type, ...) {VoidAll temporary_name{__VA_ARGS__};}
+// VoidAll keeps the args used (without evaluating them)
+#define TRACE(type, ...)                                \
+    do {                                                \
+        if (false) {                                    \
+            VoidAll temporary_name{__VA_ARGS__};        \
+        }                                               \
+    } while (0)
+#define TRACE_PAYLOAD(type, ...) TRACE(type, __VA_ARGS__)
 #endif
 
 }
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file traffic_record_format.hpp
+ * @brief The format of the traffic record files - written by the TrafficRecordHandler, and replayed by
+ *        "hailortcli replay"
+ *
+ * A record file is a TrafficRecordFileHeader, followed by records. Each record is a TrafficRecordHeader, followed by
+ * the record's data (data_size bytes). The fields are in the host's byte order.
+ *  - CORE_OP - a core-op was added. The data is the core-op's name.
+ *  - INPUT_STREAM - the first frame of an input stream of the core-op. The data is the stream's name.
+ *  - FRAME - a frame was written to an input stream (no data).
+ *  - PAYLOAD - the frame of the last FRAME record of the stream. The data is the frame.
+ **/
+
+#ifndef _HAILO_TRAFFIC_RECORD_FORMAT_HPP_
+#define _HAILO_TRAFFIC_RECORD_FORMAT_HPP_
+
+#include <cstdint>
+
+
+namespace hailort
+{
+
+#define TRAFFIC_RECORD_MAGIC (0x5254484C) // "HLTR"
+#define TRAFFIC_RECORD_VERSION (1)
+
+enum TrafficRecordFlags : uint32_t {
+    TRAFFIC_RECORD_FLAGS_NONE = 0,
+    TRAFFIC_RECORD_FLAGS_PAYLOADS = 1 << 0,
+};
+
+enum class TrafficRecordType : uint16_t {
+    CORE_OP = 1,
+    INPUT_STREAM,
+    FRAME,
+    PAYLOAD,
+};
+
+struct TrafficRecordFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t reserved;
+    // The time the record started, the timestamps of the records are relative to it
+    int64_t start_time_since_epoch_ns;
+};
+static_assert(24 == sizeof(TrafficRecordFileHeader), "Unexpected TrafficRecordFileHeader size");
+
+struct TrafficRecordHeader {
+    uint16_t type;
+    // The index of the input stream in its core-op (by the order of their INPUT_STREAM records)
+    uint16_t stream_index;
+    uint32_t core_op_handle;
+    uint64_t timestamp_ns;
+    uint32_t data_size;
+    // The batch size of the core-op (CORE_OP records)
+    uint32_t batch_size;
+};
+static_assert(24 == sizeof(TrafficRecordHeader), "Unexpected TrafficRecordHeader size");
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRAFFIC_RECORD_FORMAT_HPP_ */
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file traffic_record_handler.cpp
+ * @brief Implementation of the traffic record handler
+ **/
+
+#include "traffic_record_handler.hpp"
+#include "scheduler_profiler_handler.hpp"
+
+#include "common/logger_macros.hpp"
+
+#include "utils/hailort_logger.hpp"
+
+#include <limits>
+
+
+#define PROFILER_FILE_ENV_VAR ("HAILO_TRACE_PATH")
+
+static const std::string TRAFFIC_RECORD_FILE_NAME_PREFIX("hailort");
+static const std::string TRAFFIC_RECORD_FILE_NAME_SUFFIX(".hrec");
+
+namespace hailort
+{
+
+static std::string create_file_path()
+{
+    auto file_env_var = std::getenv(PROFILER_FILE_ENV_VAR);
+    std::string file_name = TRAFFIC_RECORD_FILE_NAME_PREFIX + "_" + get_current_datetime() + TRAFFIC_RECORD_FILE_NAME_SUFFIX;
+    if (nullptr != file_env_var) {
+        file_name = std::string(file_env_var) + PATH_SEPARATOR + file_name;
+    }
+    return file_name;
+}
+
+TrafficRecordHandler::TrafficRecordHandler(int64_t start_time_since_epoch_ns, bool should_record_payloads) :
+    m_file_path(create_file_path()),
+    m_should_record_payloads(should_record_payloads),
+    m_file(m_file_path, std::ios::out | std::ios::binary | std::ios::trunc),
+    m_frames_count(0),
+    m_payloads_bytes(0)
+{
+    if (!m_file) {
+        LOGGER__ERROR("Failed opening the traffic record file {}", m_file_path);
+        return;
+    }
+
+    TrafficRecordFileHeader header{};
+    header.magic = TRAFFIC_RECORD_MAGIC;
+    header.version = TRAFFIC_RECORD_VERSION;
+    header.flags = m_should_record_payloads ? TRAFFIC_RECORD_FLAGS_PAYLOADS : TRAFFIC_RECORD_FLAGS_NONE;
+    header.start_time_since_epoch_ns = start_time_since_epoch_ns;
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    LOGGER__INFO("Recording the traffic to {}{}", m_file_path, m_should_record_payloads ? " (with the frames)" : "");
+}
+
+TrafficRecordHandler::~TrafficRecordHandler()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    m_file.flush();
+    if (!m_file) {
+        LOGGER__ERROR("Failed writing the traffic record file {}", m_file_path);
+        return;
+    }
+    LOGGER__INFO("Recorded {} input frames ({} bytes of frames) to {}", m_frames_count, m_payloads_bytes, m_file_path);
+}
+
+void TrafficRecordHandler::write_record(TrafficRecordType type, scheduler_core_op_handle_t core_op_handle,
+    uint16_t stream_index, uint64_t timestamp, const std::string &name, uint32_t batch_size)
+{
+    TrafficRecordHeader header{};
+    header.type = static_cast<uint16_t>(type);
+    header.stream_index = stream_index;
+    header.core_op_handle = core_op_handle;
+    header.timestamp_ns = timestamp;
+    header.data_size = static_cast<uint32_t>(name.size());
+    header.batch_size = batch_size;
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file.write(name.data(), static_cast<std::streamsize>(name.size()));
+}
+
+uint16_t TrafficRecordHandler::stream_index(scheduler_core_op_handle_t core_op_handle, const std::string &stream_name,
+    uint64_t timestamp)
+{
+    const auto key = std::make_pair(core_op_handle, stream_name);
+    auto found = m_streams_indices.find(key);
+    if (m_streams_indices.end() != found) {
+        return found->second;
+    }
+
+    const auto index = m_streams_count[core_op_handle]++;
+    m_streams_indices.emplace(key, index);
+    write_record(TrafficRecordType::INPUT_STREAM, core_op_handle, index, timestamp, stream_name);
+    return index;
+}
+
+void TrafficRecordHandler::handle_trace(const AddCoreOpTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    write_record(TrafficRecordType::CORE_OP, trace.core_op_handle, 0, trace.timestamp, trace.core_op_name,
+        static_cast<uint32_t>(trace.batch_size));
+}
+
+void TrafficRecordHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto index = stream_index(trace.core_op_handle, trace.queue_name, trace.timestamp);
+    write_record(TrafficRecordType::FRAME, trace.core_op_handle, index, trace.timestamp);
+    m_frames_count++;
+}
+
+void TrafficRecordHandler::handle_trace(const InputFramePayloadTrace &trace)
+{
+    if (!m_should_record_payloads || trace.payload_parts.empty()) {
+        return;
+    }
+
+    size_t payload_size = 0;
+    for (const auto &part : trace.payload_parts) {
+        payload_size += part.size();
+    }
+    if (payload_size > std::numeric_limits<uint32_t>::max()) {
+        LOGGER__WARNING("Frame of {} bytes of stream {} is too large to be recorded", payload_size, trace.queue_name);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TrafficRecordHeader header{};
+    header.type = static_cast<uint16_t>(TrafficRecordType::PAYLOAD);
+    header.stream_index = stream_index(trace.core_op_handle, trace.queue_name, trace.timestamp);
+    header.core_op_handle = trace.core_op_handle;
+    header.timestamp_ns = trace.timestamp;
+    header.data_size = static_cast<uint32_t>(payload_size);
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto &part : trace.payload_parts) {
+        m_file.write(reinterpret_cast<const char*>(part.data()), static_cast<std::streamsize>(part.size()));
+    }
+    m_payloads_bytes += payload_size;
+}
+
+void TrafficRecordHandler::handle_trace(const DumpProfilerStateTrace &)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_file.flush();
+}
+
+} /* namespace hailort */
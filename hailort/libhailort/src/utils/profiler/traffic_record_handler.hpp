@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file traffic_record_handler.hpp
+ * @brief Tracer handler recording the arrival of the input frames of each core-op (and optionally the frames
+ *        themselves) to a compact file (see traffic_record_format.hpp), so the traffic can be replayed by
+ *        "hailortcli replay"
+ **/
+
+#ifndef _HAILO_TRAFFIC_RECORD_HANDLER_HPP_
+#define _HAILO_TRAFFIC_RECORD_HANDLER_HPP_
+
+#include "handler.hpp"
+#include "traffic_record_format.hpp"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+// If set (with HAILO_TRACE=record), the input frames are recorded as well (each frame is copied to the file as it is
+// written, so the recording slows down the inference)
+#define TRAFFIC_RECORD_PAYLOADS_ENV_VAR ("HAILO_TRAFFIC_RECORD_PAYLOADS")
+
+namespace hailort
+{
+
+class TrafficRecordHandler final : public Handler
+{
+public:
+    TrafficRecordHandler(int64_t start_time_since_epoch_ns, bool should_record_payloads);
+    ~TrafficRecordHandler();
+
+    TrafficRecordHandler(const TrafficRecordHandler &) = delete;
+    TrafficRecordHandler &operator=(const TrafficRecordHandler &) = delete;
+
+    virtual void handle_trace(const AddCoreOpTrace&) override;
+    virtual void handle_trace(const FrameEnqueueH2DTrace&) override;
+    virtual void handle_trace(const InputFramePayloadTrace&) override;
+    virtual void handle_trace(const DumpProfilerStateTrace&) override;
+
+private:
+    // Returns the index of the stream, adding its INPUT_STREAM record on its first frame
+    uint16_t stream_index(scheduler_core_op_handle_t core_op_handle, const std::string &stream_name, uint64_t timestamp);
+    void write_record(TrafficRecordType type, scheduler_core_op_handle_t core_op_handle, uint16_t stream_index,
+        uint64_t timestamp, const std::string &name = "", uint32_t batch_size = 0);
+
+    const std::string m_file_path;
+    const bool m_should_record_payloads;
+
+    std::mutex m_mutex;
+    std::ofstream m_file;
+    // (core-op, stream name) -> the index of the stream in its core-op
+    std::map<std::pair<scheduler_core_op_handle_t, std::string>, uint16_t> m_streams_indices;
+    std::unordered_map<scheduler_core_op_handle_t, uint16_t> m_streams_count;
+    uint64_t m_frames_count;
+    uint64_t m_payloads_bytes;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRAFFIC_RECORD_HANDLER_HPP_ */
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file read_mostly_map.hpp
+ * @brief A map for read-mostly lookups (e.g. of handles on the inference path), whose readers never lock.
+ **/
+
+#ifndef HAILO_READ_MOSTLY_MAP_HPP_
+#define HAILO_READ_MOSTLY_MAP_HPP_
+
+#include "hailo/expected.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace hailort
+{
+
+/// A read-copy-update map - the writers copy the map, modify the copy and publish it, while the readers keep on looking
+/// up in the map they started with. An old map is freed once the readers that may use it are done (epoch based - the
+/// readers are counted in the epoch they started in, and a writer waits only for the readers of the previous epoch).
+///
+/// The readers (find, for_each) only update an atomic counter, so they never block each other or wait for a writer.
+/// The writers are serialized, and each one copies the whole map - use it for maps that rarely change.
+template<typename Key, typename Value, typename MapType=std::unordered_map<Key, Value>>
+class ReadMostlyMap final {
+public:
+    ReadMostlyMap() :
+        m_map(new MapType()), m_epoch(0)
+    {
+        m_readers[0] = 0;
+        m_readers[1] = 0;
+    }
+
+    ~ReadMostlyMap()
+    {
+        delete m_map.load();
+    }
+
+    ReadMostlyMap(const ReadMostlyMap &) = delete;
+    ReadMostlyMap &operator=(const ReadMostlyMap &) = delete;
+    ReadMostlyMap(ReadMostlyMap &&) = delete;
+    ReadMostlyMap &operator=(ReadMostlyMap &&) = delete;
+
+    // Return by value (and not by reference) since the map may be freed once the lookup is done.
+    Expected<Value> find(const Key &key) const
+    {
+        ReadSection section(*this);
+        const auto &map = *m_map.load();
+        auto found = map.find(key);
+        if (map.end() == found) {
+            return make_unexpected(HAILO_NOT_FOUND);
+        }
+        return Value(found->second);
+    }
+
+    // func must not call the writers of this map (it would wait for itself).
+    template<typename Func>
+    void for_each(Func &&func) const
+    {
+        ReadSection section(*this);
+        const auto &map = *m_map.load();
+        for (const auto &pair : map) {
+            func(pair);
+        }
+    }
+
+    // Calls func(MapType&) on a copy of the map, which replaces the map once func returns.
+    template<typename Func>
+    void update(Func &&func)
+    {
+        std::unique_lock<std::mutex> lock(m_writers_mutex);
+        std::unique_ptr<MapType> old_map(m_map.load());
+        std::unique_ptr<MapType> new_map(new MapType(*old_map));
+        func(*new_map);
+        m_map.store(new_map.release());
+
+        // From here on, the new readers find the new map. Moving to the next epoch, and waiting for the readers of the
+        // current one, waits for all of the readers that may have loaded the old map.
+        const auto previous_epoch_index = m_epoch.fetch_add(1) & 1;
+        while (0 != m_readers[previous_epoch_index].load()) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    class ReadSection final {
+    public:
+        ReadSection(const ReadMostlyMap &map) :
+            m_readers(map.m_readers)
+        {
+            while (true) {
+                m_epoch_index = map.m_epoch.load() & 1;
+                m_readers[m_epoch_index].fetch_add(1);
+                // If a writer moved to the next epoch in the meantime, it may not have waited for this reader
+                if (m_epoch_index == (map.m_epoch.load() & 1)) {
+                    break;
+                }
+                m_readers[m_epoch_index].fetch_sub(1);
+            }
+        }
+
+        ~ReadSection()
+        {
+            m_readers[m_epoch_index].fetch_sub(1);
+        }
+
+        ReadSection(const ReadSection &) = delete;
+        ReadSection &operator=(const ReadSection &) = delete;
+
+    private:
+        std::atomic<uint32_t> *m_readers;
+        uint64_t m_epoch_index;
+    };
+
+    std::atomic<MapType*> m_map;
+    std::atomic<uint64_t> m_epoch;
+    // The amount of readers that started in an even/odd epoch
+    mutable std::atomic<uint32_t> m_readers[2];
+    std::mutex m_writers_mutex;
+};
+
+} /* namespace hailort */
+
+#endif // HAILO_READ_MOSTLY_MAP_HPP_
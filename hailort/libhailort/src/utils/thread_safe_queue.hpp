@@ -37,6 +37,8 @@
 #include <memory>
 #include <condition_variable>
 #include <chrono>
+#include <atomic>
+#include <type_traits>
 
 
 namespace hailort
@@ -74,7 +76,7 @@ public:
     {
         std::lock_guard<std::mutex> lock(m_mutex);
         CHECK_AS_EXPECTED(!m_queue.empty(), HAILO_INTERNAL_FAILURE, "Can't dequeue if queue is empty");
-        T val = m_queue.front();
+        T val = std::move(m_queue.front());
         m_queue.pop();
         return val;
     }
@@ -320,6 +322,206 @@ private:
     std::chrono::milliseconds m_default_timeout;
 };
 
+// Node of IntrusiveMpscQueue. Objects that are pushed into the queue must derive from it.
+class MpscQueueNode
+{
+public:
+    MpscQueueNode() : m_next(nullptr) {}
+    MpscQueueNode(const MpscQueueNode &) = delete;
+    MpscQueueNode &operator=(const MpscQueueNode &) = delete;
+
+private:
+    template<typename T>
+    friend class IntrusiveMpscQueue;
+
+    std::atomic<MpscQueueNode*> m_next;
+};
+
+// Lock-free, unbounded, intrusive Multi-Producer Single-Consumer queue (Based on Dmitry Vyukov's MPSC node based
+// queue). Since the nodes are owned by the user, push/pop don't allocate memory.
+// A node can be pushed again only after it was popped.
+template<typename T>
+class IntrusiveMpscQueue final
+{
+public:
+    static_assert(std::is_base_of<MpscQueueNode, T>::value, "T must derive from MpscQueueNode");
+
+    IntrusiveMpscQueue() :
+        m_head(&m_stub),
+        m_tail(&m_stub)
+    {}
+
+    IntrusiveMpscQueue(const IntrusiveMpscQueue &) = delete;
+    IntrusiveMpscQueue &operator=(const IntrusiveMpscQueue &) = delete;
+
+    // Can be called from any thread.
+    void push(T &item)
+    {
+        push_node(static_cast<MpscQueueNode*>(&item));
+    }
+
+    // Must be called only from the consumer thread. May return nullptr if the queue is not empty, but a producer is
+    // in the middle of a push (the caller should retry).
+    T *pop()
+    {
+        MpscQueueNode *tail = m_tail;
+        MpscQueueNode *next = tail->m_next.load(std::memory_order_acquire);
+        if (&m_stub == tail) {
+            if (nullptr == next) {
+                return nullptr;
+            }
+            m_tail = next;
+            tail = next;
+            next = next->m_next.load(std::memory_order_acquire);
+        }
+
+        if (nullptr != next) {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        if (m_head.load(std::memory_order_acquire) != tail) {
+            // A producer is in the middle of a push
+            return nullptr;
+        }
+
+        // tail is the last node, push the stub so tail can be detached.
+        push_node(&m_stub);
+        next = tail->m_next.load(std::memory_order_acquire);
+        if (nullptr != next) {
+            m_tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+private:
+    void push_node(MpscQueueNode *node)
+    {
+        node->m_next.store(nullptr, std::memory_order_relaxed);
+        MpscQueueNode *prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    std::atomic<MpscQueueNode*> m_head;
+    // Accessed only by the consumer
+    MpscQueueNode *m_tail;
+    MpscQueueNode m_stub;
+};
+
+// Lock-free, bounded, Multi-Producer Multi-Consumer queue (Based on Dmitry Vyukov's bounded MPMC queue). The items
+// are moved in and out of preallocated slots, so enqueue/dequeue don't allocate or copy.
+// The capacity is rounded up to a power of 2.
+template<typename T>
+class BoundedMpmcQueue final
+{
+public:
+    static Expected<std::unique_ptr<BoundedMpmcQueue>> create(size_t min_capacity)
+    {
+        CHECK_AS_EXPECTED(min_capacity > 0, HAILO_INVALID_ARGUMENT, "Invalid queue capacity (must be greater than zero)");
+
+        size_t capacity = 1;
+        while (capacity < min_capacity) {
+            capacity <<= 1;
+        }
+
+        auto queue = make_unique_nothrow<BoundedMpmcQueue>(capacity);
+        CHECK_NOT_NULL_AS_EXPECTED(queue, HAILO_OUT_OF_HOST_MEMORY);
+        CHECK_AS_EXPECTED(nullptr != queue->m_slots, HAILO_OUT_OF_HOST_MEMORY);
+        return queue;
+    }
+
+    explicit BoundedMpmcQueue(size_t capacity) :
+        m_slots(new (std::nothrow) Slot[capacity]),
+        m_mask(capacity - 1)
+    {
+        m_enqueue_pos.value.store(0, std::memory_order_relaxed);
+        m_dequeue_pos.value.store(0, std::memory_order_relaxed);
+        if (nullptr != m_slots) {
+            for (size_t i = 0; i < capacity; i++) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    ~BoundedMpmcQueue()
+    {
+        if (nullptr != m_slots) {
+            while (dequeue()) {}
+        }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue &) = delete;
+    BoundedMpmcQueue &operator=(const BoundedMpmcQueue &) = delete;
+
+    // Returns HAILO_QUEUE_IS_FULL if the queue is full (t is not moved in that case).
+    hailo_status enqueue(T &&t)
+    {
+        size_t pos = m_enqueue_pos.value.load(std::memory_order_relaxed);
+        while (true) {
+            auto &slot = m_slots[pos & m_mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (0 == diff) {
+                if (m_enqueue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    new (slot.storage()) T(std::move(t));
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return HAILO_SUCCESS;
+                }
+            } else if (diff < 0) {
+                return HAILO_QUEUE_IS_FULL;
+            } else {
+                pos = m_enqueue_pos.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns HAILO_NOT_FOUND if the queue is empty.
+    Expected<T> dequeue()
+    {
+        size_t pos = m_dequeue_pos.value.load(std::memory_order_relaxed);
+        while (true) {
+            auto &slot = m_slots[pos & m_mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (m_dequeue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T *item = reinterpret_cast<T*>(slot.storage());
+                    T val = std::move(*item);
+                    item->~T();
+                    slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                    return val;
+                }
+            } else if (diff < 0) {
+                return make_unexpected(HAILO_NOT_FOUND);
+            } else {
+                pos = m_dequeue_pos.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t capacity() const { return m_mask + 1; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type item;
+
+        void *storage() { return &item; }
+    };
+
+    // Keeps the producers and consumers positions on separate cache lines
+    struct PaddedPosition {
+        std::atomic<size_t> value;
+        uint8_t padding[64 - sizeof(std::atomic<size_t>)];
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    const size_t m_mask;
+    PaddedPosition m_enqueue_pos;
+    PaddedPosition m_dequeue_pos;
+};
+
 } /* namespace hailort */
 
 #endif // HAILO_THREAD_SAFE_QUEUE_HPP_
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file transient_object_pool.hpp
+ * @brief A pool of fixed size memory blocks, for the short-lived objects allocated per frame (e.g. the state of an
+ * async infer job), so launching a frame doesn't go to the heap.
+ *
+ * The objects are created with make_pooled_shared(), which allocates both the object and its shared_ptr control block
+ * as a single block of the pool. When the pool is exhausted (or the object doesn't fit in a block), the allocation
+ * falls back to the heap. Building with HAILO_ASSERT_NO_TRANSIENT_ALLOCATIONS turns such a fallback into an assert, to
+ * catch heap allocations in the steady state.
+ **/
+
+#ifndef _HAILO_TRANSIENT_OBJECT_POOL_HPP_
+#define _HAILO_TRANSIENT_OBJECT_POOL_HPP_
+
+#include "hailo/expected.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hailort
+{
+
+// Large enough for the per-frame objects of the pipeline together with their control block
+#define TRANSIENT_OBJECT_POOL_DEFAULT_BLOCK_SIZE (256)
+
+class TransientObjectPool final
+{
+public:
+    static Expected<std::shared_ptr<TransientObjectPool>> create(size_t blocks_count,
+        size_t block_size = TRANSIENT_OBJECT_POOL_DEFAULT_BLOCK_SIZE)
+    {
+        CHECK_AS_EXPECTED(0 < blocks_count, HAILO_INVALID_ARGUMENT, "Transient object pool must have blocks");
+
+        // Every block is aligned as any object
+        static const size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+        const auto aligned_block_size = ((block_size + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT) * BLOCK_ALIGNMENT;
+        auto pool = make_shared_nothrow<TransientObjectPool>(blocks_count, aligned_block_size);
+        CHECK_NOT_NULL_AS_EXPECTED(pool, HAILO_OUT_OF_HOST_MEMORY);
+        CHECK_AS_EXPECTED(nullptr != pool->m_arena, HAILO_OUT_OF_HOST_MEMORY);
+
+        return pool;
+    }
+
+    TransientObjectPool(size_t blocks_count, size_t block_size) :
+        m_block_size(block_size), m_arena_size(blocks_count * block_size),
+        m_arena(static_cast<uint8_t*>(::operator new(m_arena_size, std::nothrow))), m_heap_allocations_count(0)
+    {
+        if (nullptr == m_arena) {
+            return;
+        }
+
+        m_free_blocks.reserve(blocks_count);
+        for (size_t i = 0; i < blocks_count; i++) {
+            m_free_blocks.push_back(m_arena + ((blocks_count - i - 1) * block_size));
+        }
+    }
+
+    ~TransientObjectPool()
+    {
+        ::operator delete(m_arena);
+    }
+
+    TransientObjectPool(const TransientObjectPool &) = delete;
+    TransientObjectPool &operator=(const TransientObjectPool &) = delete;
+    TransientObjectPool(TransientObjectPool &&) = delete;
+    TransientObjectPool &operator=(TransientObjectPool &&) = delete;
+
+    void *allocate(size_t size)
+    {
+        if (size <= m_block_size) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free_blocks.empty()) {
+                auto block = m_free_blocks.back();
+                m_free_blocks.pop_back();
+                return block;
+            }
+        }
+
+        m_heap_allocations_count++;
+        LOGGER__DEBUG("Transient object pool can't hold an object of {} bytes, allocating it on the heap", size);
+#ifdef HAILO_ASSERT_NO_TRANSIENT_ALLOCATIONS
+        assert(false && "Transient object allocated on the heap");
+#endif
+        return ::operator new(size);
+    }
+
+    void deallocate(void *ptr)
+    {
+        auto block = static_cast<uint8_t*>(ptr);
+        if ((block < m_arena) || (block >= (m_arena + m_arena_size))) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        // m_free_blocks was reserved for all of the blocks, so it never reallocates
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free_blocks.push_back(block);
+    }
+
+    // The amount of allocations that fell back to the heap since the pool was created
+    size_t heap_allocations_count() const
+    {
+        return m_heap_allocations_count.load();
+    }
+
+private:
+    const size_t m_block_size;
+    const size_t m_arena_size;
+    uint8_t *m_arena;
+    std::mutex m_mutex;
+    std::vector<uint8_t*> m_free_blocks;
+    std::atomic_size_t m_heap_allocations_count;
+};
+
+// An allocator of one object from a TransientObjectPool (the pool is kept alive by the objects allocated from it, so
+// they may outlive its owner)
+template<typename T>
+class TransientObjectAllocator final
+{
+public:
+    using value_type = T;
+
+    explicit TransientObjectAllocator(std::shared_ptr<TransientObjectPool> pool) : m_pool(std::move(pool)) {}
+
+    template<typename U>
+    TransientObjectAllocator(const TransientObjectAllocator<U> &other) : m_pool(other.pool()) {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t /*n*/)
+    {
+        m_pool->deallocate(ptr);
+    }
+
+    const std::shared_ptr<TransientObjectPool> &pool() const
+    {
+        return m_pool;
+    }
+
+    template<typename U>
+    bool operator==(const TransientObjectAllocator<U> &other) const
+    {
+        return m_pool == other.pool();
+    }
+
+    template<typename U>
+    bool operator!=(const TransientObjectAllocator<U> &other) const
+    {
+        return m_pool != other.pool();
+    }
+
+private:
+    std::shared_ptr<TransientObjectPool> m_pool;
+};
+
+// Creates a shared object (and its control block) from the pool. A null pool creates it on the heap.
+template<typename T, typename... Args>
+static inline std::shared_ptr<T> make_pooled_shared(const std::shared_ptr<TransientObjectPool> &pool, Args&&... args)
+{
+    if (nullptr == pool) {
+        return make_shared_nothrow<T>(std::forward<Args>(args)...);
+    }
+
+    return std::allocate_shared<T>(TransientObjectAllocator<T>(pool), std::forward<Args>(args)...);
+}
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSIENT_OBJECT_POOL_HPP_ */
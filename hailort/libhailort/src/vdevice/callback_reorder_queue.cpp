@@ -34,6 +34,13 @@ void CallbackReorderQueue::cancel_last_callback()
     m_registered_callbacks--;
 }
 
+void CallbackReorderQueue::set_max_skew(uint64_t max_skew)
+{
+    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
+    assert(m_callbacks_queue.empty());
+    m_max_skew = max_skew;
+}
+
 void CallbackReorderQueue::push_callback(const Callback &callback)
 {
     std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
@@ -59,16 +66,32 @@ Expected<CallbackReorderQueue::Callback> CallbackReorderQueue::pop_ready_callbac
         return make_unexpected(HAILO_NOT_AVAILABLE);
     }
 
-    if (m_callbacks_queue.top().first != m_called_callbacks) {
-        // We need to wait until top() contains callback with index - m_called_callbacks.
+    // All the callbacks before m_called_callbacks were called, so top() is at least m_called_callbacks.
+    assert(m_callbacks_queue.top().first >= m_called_callbacks);
+    if ((m_callbacks_queue.top().first - m_called_callbacks) > m_max_skew) {
+        // We need to wait until top() is close enough to the first callback that wasn't called.
         return make_unexpected(HAILO_NOT_AVAILABLE);
     }
 
     auto next_callback = m_callbacks_queue.top();
     m_callbacks_queue.pop();
 
-    m_called_callbacks++;
+    mark_callback_called(next_callback.first);
     return next_callback;
 }
 
+void CallbackReorderQueue::mark_callback_called(uint64_t callback_index)
+{
+    if (callback_index != m_called_callbacks) {
+        m_called_out_of_order_indices.push(callback_index);
+        return;
+    }
+
+    m_called_callbacks++;
+    while (!m_called_out_of_order_indices.empty() && (m_called_out_of_order_indices.top() == m_called_callbacks)) {
+        m_called_out_of_order_indices.pop();
+        m_called_callbacks++;
+    }
+}
+
 } /* namespace hailort */
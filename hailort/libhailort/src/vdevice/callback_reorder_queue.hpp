@@ -7,6 +7,8 @@
  * @brief When using multiple devices with async API, we may get interrupt for some input/output stream out of order
  *        (For example - the second device may be faster than the first).
  *        To ensure the order of the callbacks, we put the callbacks in queue and call them in the same order inserted.
+ *        The order may be relaxed by a max skew - a callback may then be called before at most max skew callbacks
+ *        that were inserted before it.
  **/
 
 #ifndef _HAILO_CALLBACK_REORDER_QUEUE_HPP_
@@ -14,6 +16,8 @@
 
 #include "stream_common/transfer_common.hpp"
 
+#include <functional>
+#include <limits>
 #include <mutex>
 #include <queue>
 
@@ -22,9 +26,16 @@ namespace hailort
 
 class CallbackReorderQueue final {
 public:
+    // Callbacks are called in the order they were wrapped.
+    static constexpr uint64_t IN_ORDER_MAX_SKEW = 0;
+    // Callbacks are called as soon as they are done.
+    static constexpr uint64_t OUT_OF_ORDER_MAX_SKEW = std::numeric_limits<uint64_t>::max();
+
     CallbackReorderQueue(size_t max_size) :
         m_max_size(max_size),
-        m_callbacks_queue(compare_callbacks{}, make_queue_storage(m_max_size))
+        m_max_skew(IN_ORDER_MAX_SKEW),
+        m_callbacks_queue(compare_callbacks{}, make_queue_storage(m_max_size)),
+        m_called_out_of_order_indices(std::greater<uint64_t>{}, make_indices_storage(m_max_size))
     {}
 
     // Wraps the given original callback so it will be called in the same wrap_callback order.
@@ -37,6 +48,10 @@ public:
     //   * Make sure the wrapped callback will never be called! (Otherwise counters will loss syncronization).
     void cancel_last_callback();
 
+    // A callback is called only after all the callbacks wrapped more than max_skew callbacks before it were called.
+    // Note! Call this function only when there are no ongoing callbacks (All wrapped callbacks were called).
+    void set_max_skew(uint64_t max_skew);
+
 private:
     // must be called with m_lock held
     void call_queued_callbacks_in_order();
@@ -57,17 +72,29 @@ private:
         return storage;
     }
 
+    static std::vector<uint64_t> make_indices_storage(size_t max_size)
+    {
+        std::vector<uint64_t> storage;
+        storage.reserve(max_size);
+        return storage;
+    }
+
+    // must be called with m_queue_mutex held
+    void mark_callback_called(uint64_t callback_index);
+
     const size_t m_max_size;
 
-    // Guards access to m_callbacks_queue and the counters.
+    // Guards access to m_callbacks_queue, the max skew and the counters.
     std::mutex m_queue_mutex;
 
+    uint64_t m_max_skew;
+
     // Increasing counter for the index on next register callback. We don't worry about overflow (Even if we assume
     // extreme value of 1,000,000 per second)
     uint64_t m_registered_callbacks = 0;
 
-    // Amount of callback that have called. Because the callbacks are called in order, this counter contains the index
-    // of the next callback expected to be executed.
+    // Amount of callback that have called in order. This counter contains the index of the first callback that wasn't
+    // called yet (Callbacks after it may have been called, if the max skew allows it).
     uint64_t m_called_callbacks = 0;
 
     struct compare_callbacks {
@@ -82,6 +109,9 @@ private:
     // The queue is sorted by the callbacks index (so we pop the callbacks with the smallest index first).
     std::priority_queue<Callback, std::vector<Callback>, compare_callbacks> m_callbacks_queue;
 
+    // Indices of the callbacks called before m_called_callbacks (Sorted so we pop the smallest index first).
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> m_called_out_of_order_indices;
+
     // This lock guarantee that only one thread is executing the callbacks.
     std::mutex m_callbacks_mutex;
 };
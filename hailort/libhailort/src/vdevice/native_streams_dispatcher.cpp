@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file native_streams_dispatcher.cpp
+ * @brief Chooses the device each batch of the native (not scheduled) vdevice streams of a network is transferred to.
+ **/
+
+#include "vdevice/native_streams_dispatcher.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+
+namespace hailort
+{
+
+static Expected<NativeStreamsDispatchPolicy> get_dispatch_policy_from_env()
+{
+    auto policy_env_var = get_env_variable(HAILO_VDEVICE_DISPATCH_POLICY_ENV_VAR);
+    if (!policy_env_var || ("round_robin" == policy_env_var.value())) {
+        return NativeStreamsDispatchPolicy::ROUND_ROBIN;
+    }
+    if ("least_outstanding" == policy_env_var.value()) {
+        return NativeStreamsDispatchPolicy::LEAST_OUTSTANDING;
+    }
+
+    LOGGER__ERROR("Invalid {} value '{}', expected 'round_robin' or 'least_outstanding'",
+        HAILO_VDEVICE_DISPATCH_POLICY_ENV_VAR, policy_env_var.value());
+    return make_unexpected(HAILO_INVALID_ARGUMENT);
+}
+
+Expected<std::shared_ptr<NativeStreamsDispatcher>> NativeStreamsDispatcher::create(
+    const std::vector<device_id_t> &device_ids)
+{
+    CHECK_AS_EXPECTED(!device_ids.empty(), HAILO_INVALID_ARGUMENT);
+    TRY(const auto policy, get_dispatch_policy_from_env());
+
+    auto dispatcher = make_shared_nothrow<NativeStreamsDispatcher>(device_ids, policy);
+    CHECK_NOT_NULL_AS_EXPECTED(dispatcher, HAILO_OUT_OF_HOST_MEMORY);
+    return dispatcher;
+}
+
+NativeStreamsDispatcher::NativeStreamsDispatcher(const std::vector<device_id_t> &device_ids,
+    NativeStreamsDispatchPolicy policy) :
+        m_device_ids(device_ids),
+        m_policy(policy),
+        m_outputs_count(0),
+        m_first_batch_index(0),
+        m_dispatched_frames(device_ids.size(), 0),
+        m_done_output_frames(device_ids.size(), 0),
+        m_last_chosen_device(device_ids.size() - 1)
+{}
+
+NativeStreamsDispatcher::stream_index_t NativeStreamsDispatcher::register_stream(bool is_output)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (is_output) {
+        m_outputs_count++;
+    }
+    m_streams_next_batch.push_back(0);
+    return m_streams_next_batch.size() - 1;
+}
+
+device_id_t NativeStreamsDispatcher::next_batch_device(stream_index_t stream_index, uint16_t batch_size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assert(stream_index < m_streams_next_batch.size());
+    const auto batch_index = m_streams_next_batch[stream_index]++;
+
+    if (NativeStreamsDispatchPolicy::ROUND_ROBIN == m_policy) {
+        return m_device_ids[batch_index % m_device_ids.size()];
+    }
+
+    // All the streams passed the batches before m_first_batch_index, so the batch is either known, or it is the next
+    // batch to be dispatched.
+    assert(batch_index >= m_first_batch_index);
+    const auto batch_offset = static_cast<size_t>(batch_index - m_first_batch_index);
+    if (batch_offset == m_batches_devices.size()) {
+        const auto chosen_device = choose_least_outstanding_device();
+        m_batches_devices.push_back(chosen_device);
+        m_dispatched_frames[chosen_device] += batch_size;
+        m_last_chosen_device = chosen_device;
+    }
+    assert(batch_offset < m_batches_devices.size());
+
+    const auto &device_id = m_device_ids[m_batches_devices[batch_offset]];
+    drop_passed_batches();
+    return device_id;
+}
+
+void NativeStreamsDispatcher::frames_done(const device_id_t &device_id, size_t frames_count)
+{
+    if (NativeStreamsDispatchPolicy::ROUND_ROBIN == m_policy) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_done_output_frames[device_index(device_id)] += frames_count;
+}
+
+size_t NativeStreamsDispatcher::choose_least_outstanding_device() const
+{
+    // A frame is done once all the outputs read it, so the frames in flight are counted in output frames. Starting
+    // after the last chosen device, so devices with the same load are chosen one after the other.
+    const auto outputs_count = std::max(m_outputs_count, static_cast<size_t>(1));
+    auto outstanding_output_frames = [this, outputs_count](size_t device) {
+        const auto dispatched_output_frames = m_dispatched_frames[device] * outputs_count;
+        return (dispatched_output_frames > m_done_output_frames[device]) ?
+            (dispatched_output_frames - m_done_output_frames[device]) : 0;
+    };
+
+    size_t chosen_device = (m_last_chosen_device + 1) % m_device_ids.size();
+    for (size_t i = 1; i < m_device_ids.size(); i++) {
+        const auto device = (m_last_chosen_device + 1 + i) % m_device_ids.size();
+        if (outstanding_output_frames(device) < outstanding_output_frames(chosen_device)) {
+            chosen_device = device;
+        }
+    }
+    return chosen_device;
+}
+
+size_t NativeStreamsDispatcher::device_index(const device_id_t &device_id) const
+{
+    const auto it = std::find(m_device_ids.begin(), m_device_ids.end(), device_id);
+    assert(m_device_ids.end() != it);
+    return static_cast<size_t>(std::distance(m_device_ids.begin(), it));
+}
+
+void NativeStreamsDispatcher::drop_passed_batches()
+{
+    const auto min_next_batch = *std::min_element(m_streams_next_batch.begin(), m_streams_next_batch.end());
+    while ((m_first_batch_index < min_next_batch) && !m_batches_devices.empty()) {
+        m_batches_devices.pop_front();
+        m_first_batch_index++;
+    }
+}
+
+} /* namespace hailort */
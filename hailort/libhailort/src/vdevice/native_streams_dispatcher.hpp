@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file native_streams_dispatcher.hpp
+ * @brief Chooses the device each batch of the native (not scheduled) vdevice streams of a network is transferred to.
+ *
+ * The outputs of a frame must be read from the device its inputs were written to, so all the streams of a network
+ * transfer each batch to the same device. The device of a batch is chosen once - by the first stream that transfers the
+ * batch - and the rest of the streams follow that choice.
+ **/
+
+#ifndef _HAILO_NATIVE_STREAMS_DISPATCHER_HPP_
+#define _HAILO_NATIVE_STREAMS_DISPATCHER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/stream.hpp"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hailort
+{
+
+// The policy the devices of the batches are chosen by:
+//   "round_robin" - The devices are chosen one after the other (default).
+//   "least_outstanding" - The device with the least frames in flight is chosen, so slower devices (e.g. a Hailo-8L
+//                         next to a Hailo-8, or a thermally throttled device) get less frames.
+#define HAILO_VDEVICE_DISPATCH_POLICY_ENV_VAR ("HAILO_VDEVICE_DISPATCH_POLICY")
+
+enum class NativeStreamsDispatchPolicy {
+    ROUND_ROBIN,
+    LEAST_OUTSTANDING,
+};
+
+class NativeStreamsDispatcher final {
+public:
+    using stream_index_t = size_t;
+
+    static Expected<std::shared_ptr<NativeStreamsDispatcher>> create(const std::vector<device_id_t> &device_ids);
+
+    NativeStreamsDispatcher(const std::vector<device_id_t> &device_ids, NativeStreamsDispatchPolicy policy);
+
+    // Must be called for all the streams of the network before any transfer is made.
+    stream_index_t register_stream(bool is_output);
+
+    // Returns the device the next batch of the stream is transferred to.
+    device_id_t next_batch_device(stream_index_t stream_index, uint16_t batch_size);
+
+    // Called by the output streams once frames read from the device are done, to track the frames in flight.
+    void frames_done(const device_id_t &device_id, size_t frames_count);
+
+private:
+    size_t choose_least_outstanding_device() const;
+    size_t device_index(const device_id_t &device_id) const;
+    void drop_passed_batches();
+
+    const std::vector<device_id_t> m_device_ids;
+    const NativeStreamsDispatchPolicy m_policy;
+
+    std::mutex m_mutex;
+
+    // Index of the next batch of each stream
+    std::vector<uint64_t> m_streams_next_batch;
+    size_t m_outputs_count;
+
+    // Devices (indices in m_device_ids) of the batches that some stream didn't transfer yet, starting from
+    // m_first_batch_index. Used only by the least outstanding policy.
+    std::deque<size_t> m_batches_devices;
+    uint64_t m_first_batch_index;
+
+    // Frames dispatched to each device, and frames read from each device by each of the output streams.
+    std::vector<uint64_t> m_dispatched_frames;
+    std::vector<uint64_t> m_done_output_frames;
+    size_t m_last_chosen_device;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_NATIVE_STREAMS_DISPATCHER_HPP_ */
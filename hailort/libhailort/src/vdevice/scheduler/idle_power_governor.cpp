@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file idle_power_governor.cpp
+ * @brief Puts the idle devices of a scheduled vdevice to sleep, and wakes them once frames are enqueued again
+ **/
+
+#include "vdevice/scheduler/idle_power_governor.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+
+namespace hailort
+{
+
+constexpr std::chrono::milliseconds IdlePowerGovernor::MIN_SAMPLING_INTERVAL;
+constexpr std::chrono::milliseconds IdlePowerGovernor::MAX_SAMPLING_INTERVAL;
+
+Expected<std::unique_ptr<IdlePowerGovernor>> IdlePowerGovernor::create_from_env(
+    std::vector<std::reference_wrapper<Device>> &&devices, CoreOpsSchedulerPtr scheduler)
+{
+    auto timeout_env_var = get_env_variable(HAILO_SCHEDULER_IDLE_POWER_TIMEOUT_ENV_VAR);
+    if (!timeout_env_var) {
+        return std::unique_ptr<IdlePowerGovernor>();
+    }
+
+    TRY(const auto idle_timeout_ms, StringUtils::to_uint32(timeout_env_var.value(), 10),
+        "Invalid {} value '{}', expected the idle time in milliseconds", HAILO_SCHEDULER_IDLE_POWER_TIMEOUT_ENV_VAR,
+        timeout_env_var.value());
+    CHECK_AS_EXPECTED(0 != idle_timeout_ms, HAILO_INVALID_ARGUMENT, "{} must be positive",
+        HAILO_SCHEDULER_IDLE_POWER_TIMEOUT_ENV_VAR);
+
+    auto governor = make_unique_nothrow<IdlePowerGovernor>(std::move(devices), scheduler,
+        std::chrono::milliseconds(idle_timeout_ms));
+    CHECK_NOT_NULL_AS_EXPECTED(governor, HAILO_OUT_OF_HOST_MEMORY);
+
+    // The callback is removed by the governor's destructor
+    auto governor_ptr = governor.get();
+    scheduler->set_wake_device_callback([governor_ptr](const device_id_t &device_id) {
+        governor_ptr->request_wake(device_id);
+    });
+    return governor;
+}
+
+IdlePowerGovernor::IdlePowerGovernor(std::vector<std::reference_wrapper<Device>> &&devices,
+    CoreOpsSchedulerWeakPtr scheduler, std::chrono::milliseconds idle_timeout) :
+    m_devices(std::move(devices)),
+    m_scheduler(scheduler),
+    m_idle_timeout(idle_timeout),
+    m_sampling_interval(std::min(std::max(idle_timeout / 4, MIN_SAMPLING_INTERVAL), MAX_SAMPLING_INTERVAL)),
+    m_is_asleep(m_devices.size(), false),
+    m_is_sleep_supported(m_devices.size(), true),
+    m_wakes_count(0),
+    m_total_wake_latency_ms(0),
+    m_max_wake_latency_ms(0),
+    m_should_stop(false),
+    m_thread([this]() {
+        OsUtils::set_current_thread_name("IDLE_POWER_GOV");
+        governor_thread_main();
+    })
+{}
+
+IdlePowerGovernor::~IdlePowerGovernor()
+{
+    auto scheduler = m_scheduler.lock();
+    if (nullptr != scheduler) {
+        scheduler->set_wake_device_callback(nullptr);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    if (0 != m_wakes_count) {
+        LOGGER__INFO("Idle power governor woke devices {} times, wake latency: average {:.1f} ms, max {:.1f} ms",
+            m_wakes_count, m_total_wake_latency_ms / m_wakes_count, m_max_wake_latency_ms);
+    }
+
+    // The devices are left awake (as they were before the governor started)
+    const auto now = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < m_devices.size(); i++) {
+        if (m_is_asleep[i]) {
+            wake_device(i, now);
+        }
+    }
+}
+
+void IdlePowerGovernor::request_wake(const device_id_t &device_id)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_wake_requests.push_back(WakeRequest{device_id, std::chrono::steady_clock::now()});
+    }
+    m_cv.notify_one();
+}
+
+void IdlePowerGovernor::governor_thread_main()
+{
+    while (true) {
+        std::vector<WakeRequest> wake_requests;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait_for(lock, m_sampling_interval, [this]() { return m_should_stop || !m_wake_requests.empty(); });
+            if (m_should_stop) {
+                return;
+            }
+            wake_requests.swap(m_wake_requests);
+        }
+
+        if (wake_requests.empty()) {
+            put_idle_devices_to_sleep();
+            continue;
+        }
+
+        // The wakes are handled first, since frames wait for them
+        for (const auto &wake_request : wake_requests) {
+            const auto device_index = get_device_index(wake_request.device_id);
+            if ((device_index < m_devices.size()) && m_is_asleep[device_index]) {
+                wake_device(device_index, wake_request.request_time);
+            }
+        }
+    }
+}
+
+void IdlePowerGovernor::put_idle_devices_to_sleep()
+{
+    auto scheduler = m_scheduler.lock();
+    if (nullptr == scheduler) {
+        return;
+    }
+
+    for (size_t i = 0; i < m_devices.size(); i++) {
+        if (m_is_asleep[i] || !m_is_sleep_supported[i]) {
+            continue;
+        }
+
+        auto &device = m_devices[i].get();
+        auto is_marked_asleep = scheduler->mark_device_asleep_if_idle(device.get_dev_id(), m_idle_timeout);
+        if (!is_marked_asleep) {
+            LOGGER__WARNING("Idle power governor failed checking device {}, status {}", device.get_dev_id(),
+                is_marked_asleep.status());
+            continue;
+        }
+        if (!is_marked_asleep.value()) {
+            continue;
+        }
+
+        auto status = device.set_sleep_state(HAILO_SLEEP_STATE_SLEEPING);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Idle power governor failed putting device {} to sleep (status {}), keeping it awake",
+                device.get_dev_id(), status);
+            m_is_sleep_supported[i] = false;
+            scheduler->mark_device_awake(device.get_dev_id());
+            continue;
+        }
+
+        m_is_asleep[i] = true;
+        LOGGER__INFO("Device {} was idle for {} ms, put it to sleep", device.get_dev_id(), m_idle_timeout.count());
+    }
+}
+
+void IdlePowerGovernor::wake_device(size_t device_index, std::chrono::steady_clock::time_point request_time)
+{
+    auto &device = m_devices[device_index].get();
+    auto status = device.set_sleep_state(HAILO_SLEEP_STATE_AWAKE);
+    if (HAILO_SUCCESS != status) {
+        // Scheduling the device anyway - keeping it off would leave its core ops with no device to run on
+        LOGGER__ERROR("Idle power governor failed waking device {}, status {}", device.get_dev_id(), status);
+    }
+    m_is_asleep[device_index] = false;
+
+    auto scheduler = m_scheduler.lock();
+    if (nullptr != scheduler) {
+        scheduler->mark_device_awake(device.get_dev_id());
+    }
+
+    const auto wake_latency_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - request_time).count();
+    m_wakes_count++;
+    m_total_wake_latency_ms += wake_latency_ms;
+    m_max_wake_latency_ms = std::max(m_max_wake_latency_ms, wake_latency_ms);
+    LOGGER__INFO("Device {} woke up, {:.1f} ms after the wake was requested", device.get_dev_id(), wake_latency_ms);
+}
+
+size_t IdlePowerGovernor::get_device_index(const device_id_t &device_id) const
+{
+    for (size_t i = 0; i < m_devices.size(); i++) {
+        if (device_id == m_devices[i].get().get_dev_id()) {
+            return i;
+        }
+    }
+    return m_devices.size();
+}
+
+} /* namespace hailort */
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file idle_power_governor.hpp
+ * @brief Puts the idle devices of a scheduled vdevice to sleep, and wakes them once frames are enqueued again
+ **/
+
+#ifndef _HAILO_IDLE_POWER_GOVERNOR_HPP_
+#define _HAILO_IDLE_POWER_GOVERNOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/device.hpp"
+
+#include "vdevice/scheduler/scheduler.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+// The time (in milliseconds) a device may be idle before it is put to sleep. If set (and the vdevice is scheduled),
+// devices that didn't run frames for that long - the whole vdevice while the traffic pauses, or the devices the
+// scheduler doesn't need under the current load - are put to sleep. A device is woken once a frame is enqueued to a
+// core op that has no awake device to run on (or more pending frames than its awake devices may run).
+#define HAILO_SCHEDULER_IDLE_POWER_TIMEOUT_ENV_VAR ("HAILO_SCHEDULER_IDLE_POWER_TIMEOUT_MS")
+
+class IdlePowerGovernor final {
+public:
+    // Returns nullptr if the idle timeout isn't set
+    static Expected<std::unique_ptr<IdlePowerGovernor>> create_from_env(
+        std::vector<std::reference_wrapper<Device>> &&devices, CoreOpsSchedulerPtr scheduler);
+
+    IdlePowerGovernor(std::vector<std::reference_wrapper<Device>> &&devices, CoreOpsSchedulerWeakPtr scheduler,
+        std::chrono::milliseconds idle_timeout);
+    // Wakes the devices that are asleep
+    ~IdlePowerGovernor();
+
+    IdlePowerGovernor(const IdlePowerGovernor &) = delete;
+    IdlePowerGovernor &operator=(const IdlePowerGovernor &) = delete;
+
+    // The devices are checked for idleness in a quarter of the idle timeout, within these bounds
+    static constexpr std::chrono::milliseconds MIN_SAMPLING_INTERVAL = std::chrono::milliseconds(10);
+    static constexpr std::chrono::milliseconds MAX_SAMPLING_INTERVAL = std::chrono::milliseconds(1000);
+
+private:
+    struct WakeRequest {
+        device_id_t device_id;
+        std::chrono::steady_clock::time_point request_time;
+    };
+
+    void governor_thread_main();
+    void request_wake(const device_id_t &device_id);
+    void put_idle_devices_to_sleep();
+    void wake_device(size_t device_index, std::chrono::steady_clock::time_point request_time);
+    size_t get_device_index(const device_id_t &device_id) const;
+
+    std::vector<std::reference_wrapper<Device>> m_devices;
+    CoreOpsSchedulerWeakPtr m_scheduler;
+    const std::chrono::milliseconds m_idle_timeout;
+    const std::chrono::milliseconds m_sampling_interval;
+
+    // Accessed only by the governor thread (and by the destructor, once it has stopped)
+    std::vector<bool> m_is_asleep;
+    // Cleared for devices that failed going to sleep, so they aren't retried on every sample
+    std::vector<bool> m_is_sleep_supported;
+    uint32_t m_wakes_count;
+    double m_total_wake_latency_ms;
+    double m_max_wake_latency_ms;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_should_stop;
+    std::vector<WakeRequest> m_wake_requests;
+    std::thread m_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_IDLE_POWER_GOVERNOR_HPP_ */
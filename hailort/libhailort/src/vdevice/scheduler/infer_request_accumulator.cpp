@@ -20,36 +20,52 @@ InferRequestAccumulator::InferRequestAccumulator(size_t streams_count, size_t ma
         m_ongoing_infer_requests(0)
 {}
 
-hailo_status InferRequestAccumulator::add_transfer_request(const std::string &stream_name, TransferRequest &&request)
+hailo_status InferRequestAccumulator::add_transfer_request(size_t stream_index, TransferRequest &&request)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_shutdown) {
         return HAILO_STREAM_NOT_ACTIVATED;
     }
+    assert(stream_index < m_streams_count);
 
     // Insert the transfer to next available infer request
-    auto infer_request = get_infer_request(stream_name);
+    auto infer_request = get_infer_request(stream_index);
     if (!infer_request) {
         return infer_request.status();
     }
-    infer_request->get().emplace(stream_name, std::move(request));
+    auto &partial_infer_request = infer_request->get();
+    partial_infer_request.transfers[stream_index] = std::move(request);
+    partial_infer_request.has_transfer[stream_index] = true;
+    partial_infer_request.transfers_count++;
 
     // If first infer request was finished, call m_frame_accumulated on it
-    if (m_partial_infer_requests.front().size() == m_streams_count) {
+    auto &first_infer_request = m_partial_infer_requests.front();
+    if (first_infer_request.transfers_count == m_streams_count) {
+
+        // All of the request's transfers share the control of the request (if any)
+        InferRequestControlPtr control = nullptr;
+        for (const auto &stream_transfer_request : first_infer_request.transfers) {
+            if (nullptr != stream_transfer_request.control) {
+                control = stream_transfer_request.control;
+                break;
+            }
+        }
 
         m_ongoing_infer_requests++;
         m_frame_accumulated(InferRequest{
-            std::move(m_partial_infer_requests.front()),
+            std::move(first_infer_request.transfers),
             [this](hailo_status) {
                 {
                     std::lock_guard<std::mutex> lock(m_mutex);
                     m_ongoing_infer_requests--;
                 }
                 m_cv.notify_all();
-            }
+            },
+            std::move(control)
         });
-        m_partial_infer_requests.pop_front();
+        m_free_partial_infer_requests.splice(m_free_partial_infer_requests.end(), m_partial_infer_requests,
+            m_partial_infer_requests.begin());
     }
 
     return HAILO_SUCCESS;
@@ -68,21 +84,24 @@ hailo_status InferRequestAccumulator::shutdown(std::chrono::milliseconds timeout
 
     // Now cancel all partial request
     for (auto &partial_request : m_partial_infer_requests) {
-        for (auto &stream_transfer_request : partial_request) {
-            stream_transfer_request.second.callback(HAILO_STREAM_ABORT);
+        for (size_t i = 0; i < partial_request.transfers.size(); i++) {
+            if (partial_request.has_transfer[i]) {
+                partial_request.transfers[i].callback(HAILO_STREAM_ABORT);
+            }
         }
     }
     m_partial_infer_requests.clear();
+    m_free_partial_infer_requests.clear();
 
     return HAILO_SUCCESS;
 }
 
 ExpectedRef<InferRequestAccumulator::PartialInferRequest> InferRequestAccumulator::get_infer_request(
-    const std::string &stream_name)
+    size_t stream_index)
 {
-    // Try find infer request that doesn't contain transfer for stream name.
+    // Try find infer request that doesn't contain transfer for the stream.
     for (auto &partial_infer_request : m_partial_infer_requests) {
-        if (!contains(partial_infer_request, stream_name)) {
+        if (!partial_infer_request.has_transfer[stream_index]) {
             return std::ref(partial_infer_request);
         }
     }
@@ -92,8 +111,19 @@ ExpectedRef<InferRequestAccumulator::PartialInferRequest> InferRequestAccumulato
         return make_unexpected(HAILO_QUEUE_IS_FULL);
     }
 
-    m_partial_infer_requests.emplace_back();
-    return std::ref(m_partial_infer_requests.back());
+    if (m_free_partial_infer_requests.empty()) {
+        m_free_partial_infer_requests.emplace_back();
+    }
+    m_partial_infer_requests.splice(m_partial_infer_requests.end(), m_free_partial_infer_requests,
+        m_free_partial_infer_requests.begin());
+
+    // The transfers of a reused request were moved to its infer request
+    auto &partial_infer_request = m_partial_infer_requests.back();
+    partial_infer_request.transfers.clear();
+    partial_infer_request.transfers.resize(m_streams_count);
+    partial_infer_request.has_transfer.assign(m_streams_count, false);
+    partial_infer_request.transfers_count = 0;
+    return std::ref(partial_infer_request);
 }
 
 } /* namespace hailort */
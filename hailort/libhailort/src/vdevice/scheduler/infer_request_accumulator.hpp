@@ -16,6 +16,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <list>
+#include <vector>
 
 namespace hailort
 {
@@ -25,7 +26,8 @@ public:
     InferRequestAccumulator(size_t streams_count, size_t max_queue_size,
         std::function<void(InferRequest&&)> frame_accumulated);
 
-    hailo_status add_transfer_request(const std::string &stream_name, TransferRequest &&request);
+    // stream_index is the index of the stream in the core op (see CoreOp::get_stream_index)
+    hailo_status add_transfer_request(size_t stream_index, TransferRequest &&request);
 
     // All new add_transfer_request call will fail. Waits until all accumulated infer requests are done, cancel all
     // partial requests.
@@ -35,10 +37,15 @@ public:
 
 private:
 
-    using PartialInferRequest = std::unordered_map<std::string, TransferRequest>;
+    struct PartialInferRequest {
+        // Indexed by the stream index
+        std::vector<TransferRequest> transfers;
+        std::vector<bool> has_transfer;
+        size_t transfers_count;
+    };
 
-    // Find an infer request that can contain transfer request for the given stream name.
-    ExpectedRef<PartialInferRequest> get_infer_request(const std::string &stream_name);
+    // Find an infer request that can contain transfer request for the given stream index.
+    ExpectedRef<PartialInferRequest> get_infer_request(size_t stream_index);
 
     const size_t m_streams_count;
     const size_t m_max_queue_size;
@@ -54,6 +61,8 @@ private:
     // A partial infer request contains TransferRequest from subset of the core op streams.
     // When a partial infer request is completed (all streams are filled), the m_frame_accumulated is called.
     std::list<PartialInferRequest> m_partial_infer_requests;
+    // The completed partial infer requests, reused (with their list nodes) by the next frames
+    std::list<PartialInferRequest> m_free_partial_infer_requests;
 };
 
 } /* namespace hailort */
@@ -9,25 +9,51 @@
 
 #include "vdevice/scheduler/scheduler_oracle.hpp"
 #include "vdevice/scheduler/scheduled_core_op_state.hpp"
+#include "vdevice/scheduler/scheduler_cost_model.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 
 
 namespace hailort
 {
 
+// Weight of a new measurement in the moving averages of the cost model.
+static constexpr double COST_MODEL_SMOOTHING_FACTOR = 0.1;
+
 ScheduledCoreOp::ScheduledCoreOp(std::shared_ptr<VDeviceCoreOp> core_op, std::chrono::milliseconds timeout,
     uint16_t max_batch_size,  uint32_t max_ongoing_frames_per_device, bool use_dynamic_batch_flow) :
     m_core_op(core_op),
     m_last_run_time_stamp(std::chrono::steady_clock::now()),
     m_timeout(std::move(timeout)),
     m_max_batch_size(max_batch_size),
+    m_batch_size(max_batch_size),
     m_max_ongoing_frames_per_device(max_ongoing_frames_per_device),
     m_use_dynamic_batch_flow(use_dynamic_batch_flow),
     m_instances_count(1),
     m_requested_infer_requests(0),
     m_min_threshold(DEFAULT_SCHEDULER_MIN_THRESHOLD),
     m_priority(HAILO_SCHEDULER_PRIORITY_NORMAL),
-    m_last_device_id(INVALID_DEVICE_ID)
+    m_deadline(DEFAULT_SCHEDULER_DEADLINE),
+    m_pending_requests_mutex(),
+    m_pending_requests_timestamps(),
+    m_last_request_timestamp(),
+    m_inter_arrival_time_ms(0),
+    m_is_cost_model_enabled(!is_env_variable_on(DISABLE_SCHEDULER_COST_MODEL_ENV_VAR)),
+    m_cost_model_mutex(),
+    m_switch_time_ms(0),
+    m_frame_time_ms(0),
+    m_share(HAILO_SCHEDULER_SHARE_DEFAULT),
+    m_consumed_device_time_ms(0),
+    m_min_burst_size(HAILO_SCHEDULER_BURST_SIZE_DEFAULT),
+    m_max_burst_size(HAILO_SCHEDULER_BURST_SIZE_DEFAULT),
+    m_device_affinity_mask(HAILO_SCHEDULER_ALL_DEVICES_MASK),
+    m_is_sticky(false),
+    m_client_id(0),
+    m_overload_policy(HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE),
+    m_max_pending_frames(0),
+    m_dropped_frames_count(0),
+    m_rejected_frames_count(0),
+    m_last_device_id(INVALID_DEVICE_ID),
+    m_last_device_index(INVALID_DEVICE_INDEX)
 {}
 
 Expected<std::shared_ptr<ScheduledCoreOp>> ScheduledCoreOp::create(std::shared_ptr<VDeviceCoreOp> added_core_op,
@@ -89,14 +115,220 @@ void ScheduledCoreOp::set_priority(core_op_priority_t priority)
     m_priority = priority;
 }
 
+std::chrono::milliseconds ScheduledCoreOp::get_deadline()
+{
+    return m_deadline;
+}
+
+hailo_status ScheduledCoreOp::set_deadline(const std::chrono::milliseconds &deadline)
+{
+    m_deadline = deadline;
+    LOGGER__INFO("Setting scheduler deadline of {} to {}ms", m_core_op->name(), deadline.count());
+    return HAILO_SUCCESS;
+}
+
+uint32_t ScheduledCoreOp::get_share()
+{
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    return m_share;
+}
+
+hailo_status ScheduledCoreOp::set_share(uint32_t share)
+{
+    CHECK(share > 0, HAILO_INVALID_ARGUMENT, "Scheduler share must be larger than 0");
+
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    // Keeping the virtual time, so changing the share doesn't give the core op (or take from it) past device time.
+    m_consumed_device_time_ms = (m_consumed_device_time_ms / m_share) * share;
+    m_share = share;
+    LOGGER__INFO("Setting scheduler share of {} to {}", m_core_op->name(), share);
+    return HAILO_SUCCESS;
+}
+
+bool ScheduledCoreOp::is_allowed_on_device(uint32_t device_index) const
+{
+    return (device_index < (sizeof(uint64_t) * 8)) && (0 != (m_device_affinity_mask.load() & (1ULL << device_index)));
+}
+
+void ScheduledCoreOp::set_device_affinity(uint64_t device_mask)
+{
+    m_device_affinity_mask = device_mask;
+    LOGGER__INFO("Setting scheduler device affinity of {} to 0x{:x}", m_core_op->name(), device_mask);
+}
+
+bool ScheduledCoreOp::is_sticky() const
+{
+    return m_is_sticky;
+}
+
+void ScheduledCoreOp::set_sticky_placement(bool is_sticky)
+{
+    m_is_sticky = is_sticky;
+    LOGGER__INFO("Setting scheduler sticky placement of {} to {}", m_core_op->name(), is_sticky);
+}
+
+uint32_t ScheduledCoreOp::get_client_id() const
+{
+    return m_client_id;
+}
+
+void ScheduledCoreOp::set_client_id(uint32_t client_id)
+{
+    m_client_id = client_id;
+}
+
+static void update_moving_average(double &average, double sample)
+{
+    average = (0 == average) ? sample : (average + (COST_MODEL_SMOOTHING_FACTOR * (sample - average)));
+}
+
+hailo_scheduler_overload_policy_t ScheduledCoreOp::get_overload_policy() const
+{
+    return m_overload_policy;
+}
+
+uint32_t ScheduledCoreOp::get_max_pending_frames() const
+{
+    return m_max_pending_frames;
+}
+
+hailo_status ScheduledCoreOp::set_overload_policy(hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames)
+{
+    switch (policy) {
+    case HAILO_SCHEDULER_OVERLOAD_POLICY_QUEUE:
+        break;
+    case HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_OLDEST:
+    case HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_NEWEST:
+    case HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT:
+        CHECK(max_pending_frames > 0, HAILO_INVALID_ARGUMENT, "Max pending frames must be larger than 0");
+        break;
+    default:
+        LOGGER__ERROR("Invalid scheduler overload policy {}", static_cast<int>(policy));
+        return HAILO_INVALID_ARGUMENT;
+    }
+
+    // The max pending frames is set first, so the new policy is never applied with the previous value.
+    m_max_pending_frames = max_pending_frames;
+    m_overload_policy = policy;
+    LOGGER__INFO("Setting scheduler overload policy of {} to {} (max pending frames {})", m_core_op->name(),
+        static_cast<int>(policy), max_pending_frames);
+    return HAILO_SUCCESS;
+}
+
+void ScheduledCoreOp::add_shed_frame(hailo_status status)
+{
+    if (HAILO_QUEUE_IS_FULL == status) {
+        m_rejected_frames_count++;
+    } else {
+        m_dropped_frames_count++;
+    }
+}
+
+hailo_scheduler_overload_stats_t ScheduledCoreOp::get_overload_stats() const
+{
+    hailo_scheduler_overload_stats_t stats{};
+    stats.dropped_frames = m_dropped_frames_count;
+    stats.rejected_frames = m_rejected_frames_count;
+    return stats;
+}
+
+void ScheduledCoreOp::push_pending_request_timestamp(const std::chrono::time_point<std::chrono::steady_clock> &timestamp)
+{
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+    m_pending_requests_timestamps.push_back(timestamp);
+
+    if (std::chrono::time_point<std::chrono::steady_clock>() != m_last_request_timestamp) {
+        const std::chrono::duration<double, std::milli> inter_arrival_time = timestamp - m_last_request_timestamp;
+        update_moving_average(m_inter_arrival_time_ms, inter_arrival_time.count());
+    }
+    m_last_request_timestamp = timestamp;
+}
+
+void ScheduledCoreOp::pop_pending_request_timestamp()
+{
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+    assert(!m_pending_requests_timestamps.empty());
+    m_pending_requests_timestamps.pop_front();
+}
+
+std::chrono::time_point<std::chrono::steady_clock> ScheduledCoreOp::get_next_deadline()
+{
+    if (DEFAULT_SCHEDULER_DEADLINE == m_deadline) {
+        return std::chrono::time_point<std::chrono::steady_clock>::max();
+    }
+
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+    if (m_pending_requests_timestamps.empty()) {
+        return std::chrono::time_point<std::chrono::steady_clock>::max();
+    }
+    return m_pending_requests_timestamps.front() + m_deadline;
+}
+
 bool ScheduledCoreOp::is_over_threshold() const
 {
-    return m_requested_infer_requests.load() >= m_min_threshold;
+    const auto threshold = (DEFAULT_SCHEDULER_MIN_THRESHOLD != m_min_threshold) ? m_min_threshold : get_auto_threshold();
+    return m_requested_infer_requests.load() >= threshold;
 }
 
 bool ScheduledCoreOp::is_over_timeout() const
 {
-    return m_timeout <= (std::chrono::steady_clock::now() - m_last_run_time_stamp);
+    const auto timeout = (DEFAULT_SCHEDULER_TIMEOUT != m_timeout) ? m_timeout : get_auto_timeout();
+    return timeout <= (std::chrono::steady_clock::now() - m_last_run_time_stamp);
+}
+
+void ScheduledCoreOp::update_switch_time(const std::chrono::duration<double, std::milli> &switch_time)
+{
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    update_moving_average(m_switch_time_ms, switch_time.count());
+}
+
+void ScheduledCoreOp::update_frame_time(const std::chrono::duration<double, std::milli> &frame_time)
+{
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    update_moving_average(m_frame_time_ms, frame_time.count());
+    m_consumed_device_time_ms += frame_time.count();
+}
+
+double ScheduledCoreOp::get_virtual_time() const
+{
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    return m_consumed_device_time_ms / m_share;
+}
+
+void ScheduledCoreOp::catch_up_virtual_time(double virtual_time)
+{
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    m_consumed_device_time_ms = std::max(m_consumed_device_time_ms, virtual_time * m_share);
+}
+
+uint32_t ScheduledCoreOp::get_auto_threshold() const
+{
+    double switch_time_ms = 0;
+    double frame_time_ms = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+        switch_time_ms = m_switch_time_ms;
+        frame_time_ms = m_frame_time_ms;
+    }
+
+    if (!m_is_cost_model_enabled) {
+        return DEFAULT_SCHEDULER_MIN_THRESHOLD;
+    }
+    return SchedulerCostModel::get_threshold(switch_time_ms, frame_time_ms, m_deadline, get_burst_size());
+}
+
+std::chrono::milliseconds ScheduledCoreOp::get_auto_timeout() const
+{
+    double switch_time_ms = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+        switch_time_ms = m_switch_time_ms;
+    }
+
+    if (!m_is_cost_model_enabled) {
+        return DEFAULT_SCHEDULER_TIMEOUT;
+    }
+    return SchedulerCostModel::get_timeout(switch_time_ms, m_deadline);
 }
 
 device_id_t ScheduledCoreOp::get_last_device()
@@ -104,9 +336,15 @@ device_id_t ScheduledCoreOp::get_last_device()
     return m_last_device_id;
 }
 
-void ScheduledCoreOp::set_last_device(const device_id_t &device_id)
+void ScheduledCoreOp::set_last_device(const device_id_t &device_id, uint32_t device_index)
 {
     m_last_device_id = device_id;
+    m_last_device_index = device_index;
+}
+
+uint32_t ScheduledCoreOp::get_last_device_index() const
+{
+    return m_last_device_index;
 }
 
 std::shared_ptr<CoreOp> ScheduledCoreOp::get_core_op()
@@ -144,14 +382,85 @@ uint16_t ScheduledCoreOp::get_max_batch_size() const
     return m_max_batch_size;
 }
 
+uint16_t ScheduledCoreOp::get_batch_size() const
+{
+    return m_batch_size.load();
+}
+
+hailo_status ScheduledCoreOp::set_batch_size(uint16_t batch_size)
+{
+    CHECK(use_dynamic_batch_flow(), HAILO_INVALID_OPERATION,
+        "Batch size of {} can't be changed, since it isn't configured with a batch size greater than 1 on a multi-context HEF",
+        m_core_op->name());
+    CHECK((batch_size > 0) && (batch_size <= m_max_batch_size), HAILO_INVALID_ARGUMENT,
+        "Batch size must be between 1 and the configured batch size {} (got {})", m_max_batch_size, batch_size);
+
+    m_batch_size = batch_size;
+    LOGGER__INFO("Setting scheduler batch size of {} to {}", m_core_op->name(), batch_size);
+    return HAILO_SUCCESS;
+}
+
 uint16_t ScheduledCoreOp::get_burst_size() const
 {
+    {
+        std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+        if (HAILO_SCHEDULER_BURST_SIZE_DEFAULT != m_max_burst_size) {
+            return m_max_burst_size;
+        }
+    }
+
     // When the user don't explicitly pass batch size, in order to preserve performance from previous scheduler version,
     // we don't want to stop streaming until we transferred at least m_max_ongoing_frames_per_device frames (This was
     // the behaviour in previous scheduler versions).
     return m_core_op->is_default_batch_size() ?
         static_cast<uint16_t>(m_max_ongoing_frames_per_device) :
-        get_max_batch_size();
+        get_batch_size();
+}
+
+uint16_t ScheduledCoreOp::get_adaptive_burst_size() const
+{
+    uint16_t min_burst_size = HAILO_SCHEDULER_BURST_SIZE_DEFAULT;
+    uint16_t max_burst_size = HAILO_SCHEDULER_BURST_SIZE_DEFAULT;
+    double frame_time_ms = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+        min_burst_size = m_min_burst_size;
+        max_burst_size = m_max_burst_size;
+        frame_time_ms = m_frame_time_ms;
+    }
+
+    if (HAILO_SCHEDULER_BURST_SIZE_DEFAULT == max_burst_size) {
+        return get_burst_size();
+    }
+
+    double inter_arrival_time_ms = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+        inter_arrival_time_ms = m_inter_arrival_time_ms;
+    }
+
+    return SchedulerCostModel::get_burst_size(m_requested_infer_requests.load(), frame_time_ms, inter_arrival_time_ms,
+        min_burst_size, max_burst_size);
+}
+
+hailo_status ScheduledCoreOp::set_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size)
+{
+    const bool is_default = (HAILO_SCHEDULER_BURST_SIZE_DEFAULT == min_burst_size) &&
+        (HAILO_SCHEDULER_BURST_SIZE_DEFAULT == max_burst_size);
+    if (!is_default) {
+        CHECK(!use_dynamic_batch_flow(), HAILO_INVALID_OPERATION,
+            "Burst size bounds can't be set for {}, since its burst size is its batch size", m_core_op->name());
+        CHECK((min_burst_size > 0) && (min_burst_size <= max_burst_size), HAILO_INVALID_ARGUMENT,
+            "Invalid burst size bounds [{}, {}]", min_burst_size, max_burst_size);
+        CHECK(max_burst_size <= UINT16_MAX, HAILO_INVALID_ARGUMENT,
+            "Max burst size must be equal or lower than {}", UINT16_MAX);
+    }
+
+    std::lock_guard<std::mutex> lock(m_cost_model_mutex);
+    m_min_burst_size = static_cast<uint16_t>(min_burst_size);
+    m_max_burst_size = static_cast<uint16_t>(max_burst_size);
+    LOGGER__INFO("Setting scheduler burst size bounds of {} to [{}, {}]", m_core_op->name(), min_burst_size, max_burst_size);
+    return HAILO_SUCCESS;
 }
 
 void ScheduledCoreOp::add_instance()
@@ -20,12 +20,16 @@
 
 #include <condition_variable>
 #include <queue>
+#include <deque>
+#include <mutex>
+#include <atomic>
 
 
 namespace hailort
 {
 
 constexpr const char *INVALID_DEVICE_ID = "";
+constexpr const uint32_t INVALID_DEVICE_INDEX = UINT32_MAX;
 
 using core_op_priority_t = uint8_t;
 
@@ -53,11 +57,21 @@ public:
     uint32_t get_max_ongoing_frames_per_device() const;
 
     uint16_t get_max_batch_size() const;
+    // Batch size the core op runs with (on the dynamic batch flow). Any batch size up to the max batch size may be
+    // set, since the core op's resources are allocated for the max batch size.
+    uint16_t get_batch_size() const;
+    hailo_status set_batch_size(uint16_t batch_size);
     uint16_t get_burst_size() const;
+    // Burst size of the next switch to the core op. If burst size bounds are set, it adapts (within the bounds) to
+    // the queue depth and the frames inter-arrival time. Otherwise, it is get_burst_size().
+    uint16_t get_adaptive_burst_size() const;
+    hailo_status set_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size);
     bool use_dynamic_batch_flow() const;
 
     device_id_t get_last_device();
-    void set_last_device(const device_id_t &device_id);
+    void set_last_device(const device_id_t &device_id, uint32_t device_index);
+    // Unlike get_last_device, may be called without synchronizing with the scheduler thread.
+    uint32_t get_last_device_index() const;
 
     std::chrono::milliseconds get_timeout();
     hailo_status set_timeout(const std::chrono::milliseconds &timeout);
@@ -65,15 +79,57 @@ public:
     hailo_status set_threshold(uint32_t threshold);
     core_op_priority_t get_priority();
     void set_priority(core_op_priority_t priority);
+    std::chrono::milliseconds get_deadline();
+    hailo_status set_deadline(const std::chrono::milliseconds &deadline);
+    uint32_t get_share();
+    hailo_status set_share(uint32_t share);
+    bool is_allowed_on_device(uint32_t device_index) const;
+    void set_device_affinity(uint64_t device_mask);
+    bool is_sticky() const;
+    void set_sticky_placement(bool is_sticky);
+    // The client (process) that owns the core op, when its device time is accounted per client. 0 if it isn't.
+    uint32_t get_client_id() const;
+    void set_client_id(uint32_t client_id);
+
+    // Overload policy - what is done with a new infer request, once the core op has max pending frames.
+    hailo_scheduler_overload_policy_t get_overload_policy() const;
+    uint32_t get_max_pending_frames() const;
+    hailo_status set_overload_policy(hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames);
+    // Counts a frame shed by the overload policy (completed with status).
+    void add_shed_frame(hailo_status status);
+    hailo_scheduler_overload_stats_t get_overload_stats() const;
 
     bool is_over_threshold() const;
     bool is_over_timeout() const;
 
+    // Cost model, used to choose the threshold and timeout when the user didn't set them. The measured switch time
+    // and device time per frame are averaged, and the threshold is the amount of frames for which the switch to the
+    // core op is amortized (bounded by the burst size and by the deadline, if set).
+    void update_switch_time(const std::chrono::duration<double, std::milli> &switch_time);
+    // Also adds the frame time to the device time consumed by the core op.
+    void update_frame_time(const std::chrono::duration<double, std::milli> &frame_time);
+    uint32_t get_auto_threshold() const;
+    std::chrono::milliseconds get_auto_timeout() const;
+
+    // Device time consumed by the core op, divided by its share (used for the fair share scheduling algorithm).
+    double get_virtual_time() const;
+    // Advances the virtual time to the given virtual time (if it is behind it), so a core op that was idle won't
+    // take the device until it catches up with the other core ops.
+    void catch_up_virtual_time(double virtual_time);
+
     std::chrono::time_point<std::chrono::steady_clock> get_last_run_timestamp();
     void set_last_run_timestamp(const std::chrono::time_point<std::chrono::steady_clock> &timestamp);
 
     std::atomic_uint32_t &requested_infer_requests() { return m_requested_infer_requests; }
 
+    // Arrival times of the pending infer requests (oldest first), used for the deadline scheduling algorithm (and to
+    // measure the frames inter-arrival time).
+    void push_pending_request_timestamp(const std::chrono::time_point<std::chrono::steady_clock> &timestamp);
+    void pop_pending_request_timestamp();
+    // Returns the time the oldest pending infer request should be scheduled by. If the core op has no deadline (or
+    // no pending infer request), time_point::max() is returned.
+    std::chrono::time_point<std::chrono::steady_clock> get_next_deadline();
+
     void add_instance();
     void remove_instance();
     size_t instances_count() const;
@@ -86,6 +142,7 @@ private:
     std::chrono::time_point<std::chrono::steady_clock> m_last_run_time_stamp;
     std::chrono::milliseconds m_timeout;
     const uint16_t m_max_batch_size;
+    std::atomic<uint16_t> m_batch_size;
     const uint32_t m_max_ongoing_frames_per_device;
     const bool m_use_dynamic_batch_flow;
     size_t m_instances_count;
@@ -96,7 +153,39 @@ private:
 
     core_op_priority_t m_priority;
 
+    // 0 means no deadline
+    std::chrono::milliseconds m_deadline;
+    mutable std::mutex m_pending_requests_mutex;
+    std::deque<std::chrono::time_point<std::chrono::steady_clock>> m_pending_requests_timestamps;
+    std::chrono::time_point<std::chrono::steady_clock> m_last_request_timestamp;
+    // Moving average (0 until measured)
+    double m_inter_arrival_time_ms;
+
+    const bool m_is_cost_model_enabled;
+    mutable std::mutex m_cost_model_mutex;
+    // Moving averages of the measured times (0 until measured)
+    double m_switch_time_ms;
+    double m_frame_time_ms;
+
+    uint32_t m_share;
+    double m_consumed_device_time_ms;
+
+    // HAILO_SCHEDULER_BURST_SIZE_DEFAULT if not set (guarded by m_cost_model_mutex)
+    uint16_t m_min_burst_size;
+    uint16_t m_max_burst_size;
+
+    // Bit i allows the core op to run on the i-th device of the vdevice
+    std::atomic<uint64_t> m_device_affinity_mask;
+    std::atomic_bool m_is_sticky;
+    std::atomic_uint32_t m_client_id;
+
+    std::atomic<hailo_scheduler_overload_policy_t> m_overload_policy;
+    std::atomic_uint32_t m_max_pending_frames;
+    std::atomic<uint64_t> m_dropped_frames_count;
+    std::atomic<uint64_t> m_rejected_frames_count;
+
     device_id_t m_last_device_id;
+    std::atomic<uint32_t> m_last_device_index;
 };
 
 
@@ -26,7 +26,8 @@ Expected<std::unique_ptr<ScheduledInputStream>> ScheduledInputStream::create(
     const LayerInfo &layer_info,
     const scheduler_core_op_handle_t &core_op_handle,
     EventPtr core_op_activated_event,
-    std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator)
+    std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator,
+    size_t stream_index)
 {
     // In all cases, the buffer mode of the low level streams is always NOT_OWNING (the buffer is owned either by
     // ScheduledInputStream or by the user)
@@ -37,7 +38,7 @@ Expected<std::unique_ptr<ScheduledInputStream>> ScheduledInputStream::create(
 
     auto status = HAILO_UNINITIALIZED;
     auto local_vdevice_stream = make_unique_nothrow<ScheduledInputStream>(vdevice, std::move(streams), core_op_handle,
-        std::move(core_op_activated_event), layer_info, std::move(infer_requests_accumulator), status);
+        std::move(core_op_activated_event), layer_info, std::move(infer_requests_accumulator), stream_index, status);
     CHECK_NOT_NULL_AS_EXPECTED(local_vdevice_stream, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -46,8 +47,7 @@ Expected<std::unique_ptr<ScheduledInputStream>> ScheduledInputStream::create(
 
 hailo_stream_interface_t ScheduledInputStream::get_interface() const
 {
-    // All interface values of m_streams should be the same
-    return m_streams.begin()->second.get().get_interface();
+    return m_interface;
 }
 
 Expected<std::unique_ptr<StreamBufferPool>> ScheduledInputStream::allocate_buffer_pool()
@@ -68,9 +68,10 @@ size_t ScheduledInputStream::get_max_ongoing_transfers() const
 hailo_status ScheduledInputStream::write_async_impl(TransferRequest &&transfer_request)
 {
     TRACE(FrameEnqueueH2DTrace, m_core_op_handle, name());
+    TRACE_PAYLOAD(InputFramePayloadTrace, m_core_op_handle, name(), transfer_request.transfer_buffers.memory_views());
 
     transfer_request.callback = m_callback_reorder_queue.wrap_callback(transfer_request.callback);
-    auto status = m_infer_requests_accumulator->add_transfer_request(name(), std::move(transfer_request));
+    auto status = m_infer_requests_accumulator->add_transfer_request(m_stream_index, std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
         m_callback_reorder_queue.cancel_last_callback();
         if (HAILO_QUEUE_IS_FULL == status) {
@@ -89,7 +90,8 @@ Expected<std::unique_ptr<ScheduledOutputStream>> ScheduledOutputStream::create(
     const scheduler_core_op_handle_t &core_op_handle,
     const LayerInfo &layer_info,
     EventPtr core_op_activated_event,
-    std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator)
+    std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator,
+    size_t stream_index)
 {
     // In all cases, the buffer mode of the low level streams is always NOT_OWNING (the buffer is owned either by
     // ScheduledOutputStream or by the user)
@@ -101,7 +103,7 @@ Expected<std::unique_ptr<ScheduledOutputStream>> ScheduledOutputStream::create(
 
     auto status = HAILO_UNINITIALIZED;
     auto stream = make_unique_nothrow<ScheduledOutputStream>(vdevice, std::move(streams), core_op_handle,
-        layer_info, std::move(core_op_activated_event), std::move(infer_requests_accumulator), status);
+        layer_info, std::move(core_op_activated_event), std::move(infer_requests_accumulator), stream_index, status);
     CHECK_NOT_NULL_AS_EXPECTED(stream, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -110,8 +112,7 @@ Expected<std::unique_ptr<ScheduledOutputStream>> ScheduledOutputStream::create(
 
 hailo_stream_interface_t ScheduledOutputStream::get_interface() const
 {
-    // All interface values of m_streams should be the same
-    return m_streams.begin()->second.get().get_interface();
+    return m_interface;
 }
 
 Expected<std::unique_ptr<StreamBufferPool>> ScheduledOutputStream::allocate_buffer_pool()
@@ -132,7 +133,7 @@ size_t ScheduledOutputStream::get_max_ongoing_transfers() const
 hailo_status ScheduledOutputStream::read_async_impl(TransferRequest &&transfer_request)
 {
     transfer_request.callback = m_callback_reorder_queue.wrap_callback(transfer_request.callback);
-    auto status = m_infer_requests_accumulator->add_transfer_request(name(), std::move(transfer_request));
+    auto status = m_infer_requests_accumulator->add_transfer_request(m_stream_index, std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
         m_callback_reorder_queue.cancel_last_callback();
         if (HAILO_QUEUE_IS_FULL == status) {
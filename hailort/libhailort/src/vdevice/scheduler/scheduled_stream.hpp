@@ -36,7 +36,8 @@ public:
         const LayerInfo &layer_info,
         const scheduler_core_op_handle_t &core_op_handle,
         EventPtr core_op_activated_event,
-        std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator);
+        std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator,
+        size_t stream_index);
 
     ScheduledInputStream(
         VDevice &vdevice,
@@ -45,12 +46,14 @@ public:
         EventPtr &&core_op_activated_event,
         const LayerInfo &layer_info,
         std::shared_ptr<InferRequestAccumulator> &&infer_requests_accumulator,
+        size_t stream_index,
         hailo_status &status) :
             AsyncInputStreamBase(layer_info, std::move(core_op_activated_event), status),
             m_vdevice(vdevice),
-            m_streams(std::move(streams)),
+            m_interface(streams.begin()->second.get().get_interface()),
             m_core_op_handle(core_op_handle),
             m_infer_requests_accumulator(infer_requests_accumulator),
+            m_stream_index(stream_index),
             m_callback_reorder_queue(infer_requests_accumulator->queue_size()) // TODO HRT-1058 - use reorder queue only when needed
     {}
 
@@ -60,14 +63,23 @@ public:
     virtual size_t get_max_ongoing_transfers() const override;
     virtual hailo_status write_async_impl(TransferRequest &&transfer_request) override;
 
+    // See CallbackReorderQueue::set_max_skew
+    void set_callbacks_max_skew(uint64_t max_skew)
+    {
+        m_callback_reorder_queue.set_max_skew(max_skew);
+    }
 
     virtual bool is_scheduled() override final { return true; };
 
 private:
     VDevice &m_vdevice;
-    std::map<device_id_t, std::reference_wrapper<InputStreamBase>> m_streams;
+    // The interface of all of the low level streams (the low level streams themselves are used by the scheduler,
+    // through the core op of each device - which may be added to or removed from the vdevice)
+    const hailo_stream_interface_t m_interface;
     scheduler_core_op_handle_t m_core_op_handle;
     std::shared_ptr<InferRequestAccumulator> m_infer_requests_accumulator;
+    // The index of the stream in the core op (see CoreOp::get_stream_index)
+    const size_t m_stream_index;
 
     CallbackReorderQueue m_callback_reorder_queue;
 };
@@ -80,7 +92,8 @@ public:
         const scheduler_core_op_handle_t &core_op_handle,
         const LayerInfo &layer_info,
         EventPtr core_op_activated_event,
-        std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator);
+        std::shared_ptr<InferRequestAccumulator> infer_requests_accumulator,
+        size_t stream_index);
 
     ScheduledOutputStream(
         VDevice &vdevice,
@@ -89,12 +102,14 @@ public:
         const LayerInfo &layer_info,
         EventPtr &&core_op_activated_event,
         std::shared_ptr<InferRequestAccumulator> &&infer_requests_accumulator,
+        size_t stream_index,
         hailo_status &status) :
             AsyncOutputStreamBase(layer_info, std::move(core_op_activated_event), status),
             m_vdevice(vdevice),
-            m_streams(std::move(streams)),
+            m_interface(streams.begin()->second.get().get_interface()),
             m_core_op_handle(core_op_handle),
             m_infer_requests_accumulator(infer_requests_accumulator),
+            m_stream_index(stream_index),
             m_callback_reorder_queue(infer_requests_accumulator->queue_size()) // TODO HRT-1058 - use reorder queue only when needed
     {}
 
@@ -115,6 +130,12 @@ public:
 
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) override;
 
+    // See CallbackReorderQueue::set_max_skew
+    void set_callbacks_max_skew(uint64_t max_skew)
+    {
+        m_callback_reorder_queue.set_max_skew(max_skew);
+    }
+
     virtual bool is_scheduled() override final { return true; };
 
     virtual hailo_status read_impl(MemoryView user_buffer) override
@@ -129,9 +150,13 @@ public:
 
 private:
     VDevice &m_vdevice;
-    std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> m_streams;
+    // The interface of all of the low level streams (the low level streams themselves are used by the scheduler,
+    // through the core op of each device - which may be added to or removed from the vdevice)
+    const hailo_stream_interface_t m_interface;
     scheduler_core_op_handle_t m_core_op_handle;
     std::shared_ptr<InferRequestAccumulator> m_infer_requests_accumulator;
+    // The index of the stream in the core op (see CoreOp::get_stream_index)
+    const size_t m_stream_index;
 
     CallbackReorderQueue m_callback_reorder_queue;
 };
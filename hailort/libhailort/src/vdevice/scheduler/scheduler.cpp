@@ -15,18 +15,25 @@
 #include "vdevice/scheduler/scheduler_oracle.hpp"
 #include "vdma/vdma_config_manager.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <thread>
 
 
 namespace hailort
 {
 
 #define DEFAULT_BURST_SIZE (1)
+// The device time of each client is accounted over the last one to two windows
+static constexpr std::chrono::milliseconds CLIENT_ACCOUNTING_WINDOW(1000);
 
 CoreOpsScheduler::CoreOpsScheduler(hailo_scheduling_algorithm_t algorithm, std::vector<std::string> &devices_ids,
-    std::vector<std::string> &devices_arch) :
+    std::vector<std::string> &devices_arch, int numa_node, uint64_t cpu_affinity_mask, uint32_t realtime_priority) :
     SchedulerBase(algorithm, devices_ids, devices_arch),
-    m_scheduler_thread(*this)
+    m_is_mapping_prefetch_enabled(!is_env_variable_on(DISABLE_SCHEDULER_MAPPING_PREFETCH_ENV_VAR)),
+    m_asleep_devices_count(0),
+    m_scheduler_thread(*this, numa_node, cpu_affinity_mask, realtime_priority)
 {}
 
 CoreOpsScheduler::~CoreOpsScheduler()
@@ -34,9 +41,31 @@ CoreOpsScheduler::~CoreOpsScheduler()
     shutdown();
 }
 
-Expected<CoreOpsSchedulerPtr> CoreOpsScheduler::create_round_robin(std::vector<std::string> &devices_bdf_id, std::vector<std::string> &devices_arch)
+Expected<CoreOpsSchedulerPtr> CoreOpsScheduler::create_round_robin(std::vector<std::string> &devices_bdf_id, std::vector<std::string> &devices_arch,
+    int numa_node, uint64_t cpu_affinity_mask, uint32_t realtime_priority)
 {
-    auto ptr = make_shared_nothrow<CoreOpsScheduler>(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN, devices_bdf_id, devices_arch);
+    auto ptr = make_shared_nothrow<CoreOpsScheduler>(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN, devices_bdf_id, devices_arch,
+        numa_node, cpu_affinity_mask, realtime_priority);
+    CHECK_AS_EXPECTED(nullptr != ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    return ptr;
+}
+
+Expected<CoreOpsSchedulerPtr> CoreOpsScheduler::create_deadline(std::vector<std::string> &devices_bdf_id, std::vector<std::string> &devices_arch,
+    int numa_node, uint64_t cpu_affinity_mask, uint32_t realtime_priority)
+{
+    auto ptr = make_shared_nothrow<CoreOpsScheduler>(HAILO_SCHEDULING_ALGORITHM_DEADLINE, devices_bdf_id, devices_arch,
+        numa_node, cpu_affinity_mask, realtime_priority);
+    CHECK_AS_EXPECTED(nullptr != ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    return ptr;
+}
+
+Expected<CoreOpsSchedulerPtr> CoreOpsScheduler::create_fair_share(std::vector<std::string> &devices_bdf_id, std::vector<std::string> &devices_arch,
+    int numa_node, uint64_t cpu_affinity_mask, uint32_t realtime_priority)
+{
+    auto ptr = make_shared_nothrow<CoreOpsScheduler>(HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE, devices_bdf_id, devices_arch,
+        numa_node, cpu_affinity_mask, realtime_priority);
     CHECK_AS_EXPECTED(nullptr != ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     return ptr;
@@ -47,9 +76,16 @@ hailo_status CoreOpsScheduler::add_core_op(scheduler_core_op_handle_t core_op_ha
 {
     std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
 
+    // Each instance may have up to its async queue size pending infer requests.
+    TRY(const auto instance_queue_size, added_cng->get_async_max_queue_size());
+
     auto scheduled_core_op_it = m_scheduled_core_ops.find(core_op_handle);
     if (scheduled_core_op_it != m_scheduled_core_ops.end()) {
         scheduled_core_op_it->second->add_instance();
+
+        const auto capacity = scheduled_core_op_it->second->instances_count() * instance_queue_size;
+        auto status = resize_infer_requests_queue(core_op_handle, capacity);
+        CHECK_SUCCESS(status);
     } else {
         auto stream_infos = added_cng->get_all_stream_infos();
         CHECK_EXPECTED_AS_STATUS(stream_infos);
@@ -59,10 +95,11 @@ hailo_status CoreOpsScheduler::add_core_op(scheduler_core_op_handle_t core_op_ha
 
         m_scheduled_core_ops.emplace(core_op_handle, scheduled_core_op.release());
 
-        // To allow multiple instances of the same phyiscal core op, we don't limit the queue here. Each core-op and
-        // scheduled should limit themself. Since the ctor accept no argument, we init it using operator[].
-        // TODO HRT-12136: limit the queue size (based on instances count)
-        m_infer_requests[core_op_handle];
+        // The queue grows when more instances of the same physical core op are added.
+        TRY(auto infer_requests_queue, InferRequestQueue::create(instance_queue_size));
+        m_infer_requests.emplace(core_op_handle, std::move(infer_requests_queue));
+        TRY(auto shed_infer_requests_queue, ShedInferRequestQueue::create(instance_queue_size));
+        m_shed_infer_requests.emplace(core_op_handle, std::move(shed_infer_requests_queue));
 
         const core_op_priority_t normal_priority = HAILO_SCHEDULER_PRIORITY_NORMAL;
         m_core_op_priority[normal_priority].add(core_op_handle);
@@ -74,7 +111,25 @@ hailo_status CoreOpsScheduler::add_core_op(scheduler_core_op_handle_t core_op_ha
 void CoreOpsScheduler::remove_core_op(scheduler_core_op_handle_t core_op_handle)
 {
     std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
-    m_scheduled_core_ops.at(core_op_handle)->remove_instance();
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    scheduled_core_op->remove_instance();
+
+    const auto client_id = scheduled_core_op->get_client_id();
+    if ((0 != client_id) && (0 == scheduled_core_op->instances_count())) {
+        const auto has_other_core_ops = std::any_of(m_scheduled_core_ops.begin(), m_scheduled_core_ops.end(),
+            [client_id](const std::pair<const vdevice_core_op_handle_t, ScheduledCoreOpPtr> &pair) {
+                return (client_id == pair.second->get_client_id()) && (pair.second->instances_count() > 0);
+            });
+        if (!has_other_core_ops) {
+            // The frames in flight keep their client state alive until they are done
+            m_clients.erase(client_id);
+            for (auto &pair : m_scheduled_core_ops) {
+                if (client_id == pair.second->get_client_id()) {
+                    pair.second->set_client_id(0);
+                }
+            }
+        }
+    }
     m_scheduler_thread.signal();
 }
 
@@ -101,7 +156,7 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
     assert(curr_device_info->is_idle());
     curr_device_info->is_switching_core_op = false;
 
-    const auto burst_size = scheduled_core_op->get_burst_size();
+    const auto burst_size = scheduled_core_op->get_adaptive_burst_size();
 
     auto frames_count = std::min(get_frames_ready_to_transfer(core_op_handle, device_id), burst_size);
     auto hw_batch_size = scheduled_core_op->use_dynamic_batch_flow() ? frames_count : SINGLE_CONTEXT_BATCH_SIZE;
@@ -124,11 +179,16 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
             TRY(current_core_op, get_vdma_core_op(curr_device_info->current_core_op_handle, device_id));
         }
 
+        const auto switch_start_time = std::chrono::steady_clock::now();
         auto status = VdmaConfigManager::set_core_op(device_id, current_core_op, next_core_op, hw_batch_size);
         CHECK_SUCCESS(status, "Failed switching core-op");
+        if (core_op_handle != curr_device_info->current_core_op_handle) {
+            scheduled_core_op->update_switch_time(std::chrono::steady_clock::now() - switch_start_time);
+        }
     }
 
     scheduled_core_op->set_last_run_timestamp(std::chrono::steady_clock::now()); // Mark timestamp on activation
+    curr_device_info->last_frame_done_time = std::chrono::steady_clock::now();
     curr_device_info->current_core_op_handle = core_op_handle;
 
     auto status = send_all_pending_buffers(core_op_handle, device_id, frames_count);
@@ -139,7 +199,7 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
 
 hailo_status CoreOpsScheduler::deactivate_core_op(const device_id_t &device_id)
 {
-    const auto core_op_handle = m_devices[device_id]->current_core_op_handle;
+    const scheduler_core_op_handle_t core_op_handle = m_devices[device_id]->current_core_op_handle;
     if (INVALID_CORE_OP_HANDLE == core_op_handle) {
         return HAILO_SUCCESS;
     }
@@ -170,10 +230,12 @@ hailo_status CoreOpsScheduler::send_all_pending_buffers(const scheduler_core_op_
         CHECK_SUCCESS(status);
     }
 
-    scheduled_core_op->set_last_device(device_id);
+    scheduled_core_op->set_last_device(device_id, current_device_info->device_index);
     return HAILO_SUCCESS;
 }
 
+static void complete_infer_request(InferRequest &infer_request, hailo_status status);
+
 hailo_status CoreOpsScheduler::infer_async(const scheduler_core_op_handle_t &core_op_handle,
     const device_id_t &device_id)
 {
@@ -185,10 +247,35 @@ hailo_status CoreOpsScheduler::infer_async(const scheduler_core_op_handle_t &cor
     auto infer_request = dequeue_infer_request(core_op_handle);
     CHECK_EXPECTED_AS_STATUS(infer_request);
 
+    // A request cancelled by its issuer (or whose deadline passed) while it was queued isn't sent to the device
+    if (nullptr != infer_request->control) {
+        const auto drop_status = infer_request->control->get_drop_status(std::chrono::steady_clock::now());
+        if (HAILO_SUCCESS != drop_status) {
+            complete_infer_request(infer_request.value(), drop_status);
+            return HAILO_SUCCESS;
+        }
+    }
+
     current_device_info->ongoing_infer_requests.fetch_add(1);
 
+    const auto client_id = scheduled_core_op->get_client_id();
+    const auto client_state = (0 == client_id) ? nullptr : m_clients.at(client_id);
+
     auto original_callback = infer_request->callback;
-    infer_request->callback = [current_device_info, this, original_callback](hailo_status status) {
+    const auto send_time = std::chrono::steady_clock::now();
+    infer_request->callback = [current_device_info, scheduled_core_op, client_state, send_time, this,
+            original_callback](hailo_status status) {
+        if (HAILO_SUCCESS == status) {
+            // If the device was busy when the request was sent, the time since the previous request was done is the
+            // device time of this request.
+            const auto done_time = std::chrono::steady_clock::now();
+            const auto prev_done_time = current_device_info->last_frame_done_time.exchange(done_time);
+            const std::chrono::duration<double, std::milli> frame_time = done_time - std::max(prev_done_time, send_time);
+            scheduled_core_op->update_frame_time(frame_time);
+            if (nullptr != client_state) {
+                client_state->add_device_time(frame_time.count());
+            }
+        }
         current_device_info->ongoing_infer_requests.fetch_sub(1);
         m_scheduler_thread.signal();
         original_callback(status);
@@ -210,10 +297,19 @@ CoreOpsScheduler::ReadyInfo CoreOpsScheduler::is_core_op_ready(const scheduler_c
     result.is_ready = false;
 
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    const auto &device_info = *m_devices.at(device_id);
+    if (!is_allowed_on_device(core_op_handle, device_info)) {
+        return result;
+    }
+    // A core op that owns the device isn't deferred (its client doesn't take device time from the other clients)
+    if ((core_op_handle != device_info.pinned_core_op_handle) && is_client_deferred(core_op_handle)) {
+        return result;
+    }
 
     result.is_ready = (get_frames_ready_to_transfer(core_op_handle, device_id) > 0);
 
-    if (check_threshold) {
+    // A core op that owns the device doesn't wait for its threshold (there's no other core op to share the device with)
+    if (check_threshold && (core_op_handle != device_info.pinned_core_op_handle)) {
         result.over_threshold = scheduled_core_op->is_over_threshold();
         result.over_timeout = scheduled_core_op->is_over_timeout();
 
@@ -225,6 +321,22 @@ CoreOpsScheduler::ReadyInfo CoreOpsScheduler::is_core_op_ready(const scheduler_c
     return result;
 }
 
+std::chrono::time_point<std::chrono::steady_clock> CoreOpsScheduler::get_core_op_deadline(
+    const scheduler_core_op_handle_t &core_op_handle)
+{
+    return m_scheduled_core_ops.at(core_op_handle)->get_next_deadline();
+}
+
+double CoreOpsScheduler::get_core_op_virtual_time(const scheduler_core_op_handle_t &core_op_handle)
+{
+    return m_scheduled_core_ops.at(core_op_handle)->get_virtual_time();
+}
+
+bool CoreOpsScheduler::is_core_op_sticky(const scheduler_core_op_handle_t &core_op_handle)
+{
+    return m_scheduled_core_ops.at(core_op_handle)->is_sticky();
+}
+
 hailo_status CoreOpsScheduler::enqueue_infer_request(const scheduler_core_op_handle_t &core_op_handle,
     InferRequest &&infer_request)
 {
@@ -233,14 +345,122 @@ hailo_status CoreOpsScheduler::enqueue_infer_request(const scheduler_core_op_han
     CHECK(m_scheduled_core_ops.at(core_op_handle)->instances_count() > 0, HAILO_INTERNAL_FAILURE,
         "Trying to enqueue infer request on a core-op with instances_count==0");
 
-    auto status = m_infer_requests.at(core_op_handle).enqueue(std::move(infer_request));
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    const auto overload_policy = scheduled_core_op->get_overload_policy();
+    if (((HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_NEWEST == overload_policy) ||
+         (HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT == overload_policy)) &&
+        (scheduled_core_op->requested_infer_requests() >= scheduled_core_op->get_max_pending_frames())) {
+        const auto shed_status = (HAILO_SCHEDULER_OVERLOAD_POLICY_REJECT == overload_policy) ?
+            HAILO_QUEUE_IS_FULL : HAILO_FRAME_DROPPED;
+        auto status = m_shed_infer_requests.at(core_op_handle)->enqueue(
+            ShedInferRequest{std::move(infer_request), shed_status});
+        if (HAILO_SUCCESS == status) {
+            m_scheduler_thread.signal();
+        }
+        return status;
+    }
+
+    if (m_is_mapping_prefetch_enabled) {
+        prefetch_mappings(core_op_handle, infer_request);
+    }
+
+    const auto enqueue_timestamp = std::chrono::steady_clock::now();
+    auto status = m_infer_requests.at(core_op_handle)->enqueue(std::move(infer_request));
     if (HAILO_SUCCESS == status) {
-        m_scheduled_core_ops.at(core_op_handle)->requested_infer_requests().fetch_add(1);
+        // The timestamp is pushed before requested_infer_requests is increased, so it exists once the request is
+        // dequeued.
+        m_scheduled_core_ops.at(core_op_handle)->push_pending_request_timestamp(enqueue_timestamp);
+        const auto prev_requested = m_scheduled_core_ops.at(core_op_handle)->requested_infer_requests().fetch_add(1);
+        if ((0 == prev_requested) && (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == m_algorithm)) {
+            catch_up_virtual_time(core_op_handle);
+        }
+        if (0 != m_asleep_devices_count) {
+            request_devices_wake(core_op_handle);
+        }
         m_scheduler_thread.signal();
     }
     return status;
 }
 
+// The first frame after the devices of the core op went asleep wakes one of them (so the wake starts while the frame
+// waits in the queue). Another device is woken once the core op has more pending frames than its awake devices may run.
+// Assumes that m_scheduler_mutex is locked (shared)!
+void CoreOpsScheduler::request_devices_wake(scheduler_core_op_handle_t core_op_handle)
+{
+    if (!m_wake_device_callback) {
+        return;
+    }
+
+    auto pinned_device = get_pinned_device(core_op_handle);
+    if (nullptr != pinned_device) {
+        // The core op runs only on its pinned device
+        if (pinned_device->is_asleep && !pinned_device->is_wake_requested.exchange(true)) {
+            m_wake_device_callback(pinned_device->device_id);
+        }
+        return;
+    }
+
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    uint32_t awake_devices_count = 0;
+    std::shared_ptr<ActiveDeviceInfo> device_to_wake;
+    for (const auto &pair : m_devices) {
+        if (!scheduled_core_op->is_allowed_on_device(pair.second->device_index) ||
+                (INVALID_CORE_OP_HANDLE != pair.second->pinned_core_op_handle) || pair.second->is_draining) {
+            continue;
+        }
+        if (!pair.second->is_asleep) {
+            awake_devices_count++;
+        } else if ((nullptr == device_to_wake) && !pair.second->is_wake_requested) {
+            device_to_wake = pair.second;
+        }
+    }
+    if (nullptr == device_to_wake) {
+        return;
+    }
+
+    const auto max_running_frames = awake_devices_count * scheduled_core_op->get_max_ongoing_frames_per_device();
+    if (((0 == awake_devices_count) || (scheduled_core_op->requested_infer_requests() > max_running_frames)) &&
+            !device_to_wake->is_wake_requested.exchange(true)) {
+        m_wake_device_callback(device_to_wake->device_id);
+    }
+}
+
+// While another core op is running on the device the core op is expected to run on (the device it ran on last, or the
+// only device), the request buffers are mapped on the user thread, so the burst launched after the switch doesn't map
+// them (on the scheduler thread, while the device waits for them).
+// Assumes that m_scheduler_mutex is locked (shared)!
+void CoreOpsScheduler::prefetch_mappings(scheduler_core_op_handle_t core_op_handle, InferRequest &infer_request)
+{
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    const auto predicted_device_index = (1 == m_devices.size()) ? m_devices.begin()->second->device_index :
+        scheduled_core_op->get_last_device_index();
+
+    for (const auto &device_pair : m_devices) {
+        const auto &device_info = device_pair.second;
+        if (device_info->device_index != predicted_device_index) {
+            continue;
+        }
+
+        if ((INVALID_CORE_OP_HANDLE == device_info->current_core_op_handle) ||
+            (core_op_handle == device_info->current_core_op_handle)) {
+            // The request will be launched without a switch (or right after activating an idle device).
+            return;
+        }
+
+        auto vdma_core_op = get_vdma_core_op(core_op_handle, device_pair.first);
+        if (!vdma_core_op) {
+            return;
+        }
+
+        // On failure, the buffers are mapped when the request is launched.
+        auto status = vdma_core_op.value()->prefetch_mappings(infer_request);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__DEBUG("Failed prefetching mappings for core op {}, status {}", core_op_handle, status);
+        }
+        return;
+    }
+}
+
 hailo_status CoreOpsScheduler::set_timeout(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &timeout, const std::string &/*network_name*/)
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
@@ -284,9 +504,375 @@ hailo_status CoreOpsScheduler::set_priority(const scheduler_core_op_handle_t &co
     return HAILO_SUCCESS;
 }
 
+hailo_status CoreOpsScheduler::set_deadline(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &deadline, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    auto status = m_scheduled_core_ops.at(core_op_handle)->set_deadline(deadline);
+    // The deadline may change the next decision
+    m_scheduler_thread.signal();
+    return status;
+}
+
+hailo_status CoreOpsScheduler::set_share(const scheduler_core_op_handle_t &core_op_handle, uint32_t share, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    auto status = m_scheduled_core_ops.at(core_op_handle)->set_share(share);
+    // The share may change the next decision
+    m_scheduler_thread.signal();
+    return status;
+}
+
+hailo_status CoreOpsScheduler::set_core_op_client(const scheduler_core_op_handle_t &core_op_handle, uint32_t client_id,
+    uint32_t quota_percent)
+{
+    CHECK(0 != client_id, HAILO_INVALID_ARGUMENT, "Client id 0 is reserved for core ops without a client");
+    CHECK(quota_percent <= 100, HAILO_INVALID_ARGUMENT, "Invalid client quota {}%", quota_percent);
+
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    if (0 != scheduled_core_op->get_client_id()) {
+        // A core op shared by the networks of several clients is accounted to the first one
+        return HAILO_SUCCESS;
+    }
+
+    if (contains(m_clients, client_id)) {
+        m_clients.at(client_id)->set_quota_percent(quota_percent);
+    } else {
+        auto client_state = make_shared_nothrow<ClientState>(quota_percent);
+        CHECK_NOT_NULL(client_state, HAILO_OUT_OF_HOST_MEMORY);
+        m_clients.emplace(client_id, client_state);
+    }
+    scheduled_core_op->set_client_id(client_id);
+
+    TRACE(SetCoreOpClientTrace, core_op_handle, client_id, quota_percent);
+    return HAILO_SUCCESS;
+}
+
+hailo_status CoreOpsScheduler::set_device_affinity(const scheduler_core_op_handle_t &core_op_handle, uint64_t device_mask, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+
+    // The devices' indices may have gaps, once devices were removed from the vdevice
+    uint64_t vdevice_mask = 0;
+    for (const auto &pair : m_devices) {
+        if (pair.second->device_index < (sizeof(uint64_t) * 8)) {
+            vdevice_mask |= (1ULL << pair.second->device_index);
+        }
+    }
+    CHECK(0 != (device_mask & vdevice_mask), HAILO_INVALID_ARGUMENT,
+        "Device affinity mask 0x{:x} doesn't contain any of the vdevice's {} devices", device_mask, m_devices.size());
+
+    m_scheduled_core_ops.at(core_op_handle)->set_device_affinity(device_mask);
+    m_scheduler_thread.signal();
+    return HAILO_SUCCESS;
+}
+
+hailo_status CoreOpsScheduler::set_sticky_placement(const scheduler_core_op_handle_t &core_op_handle, bool is_sticky, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    m_scheduled_core_ops.at(core_op_handle)->set_sticky_placement(is_sticky);
+    m_scheduler_thread.signal();
+    return HAILO_SUCCESS;
+}
+
+hailo_status CoreOpsScheduler::set_pinned_device(const scheduler_core_op_handle_t &core_op_handle, uint32_t device_index,
+    const std::string &/*network_name*/)
+{
+    // Unique lock, so the scheduler thread sees the pinning of all of the devices at once
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+
+    std::shared_ptr<ActiveDeviceInfo> pinned_device = nullptr;
+    if (HAILO_SCHEDULER_NO_PINNED_DEVICE != device_index) {
+        for (const auto &pair : m_devices) {
+            if (pair.second->device_index == device_index) {
+                pinned_device = pair.second;
+            }
+        }
+        CHECK(nullptr != pinned_device, HAILO_INVALID_ARGUMENT, "Invalid device index {}, the vdevice has {} devices",
+            device_index, m_devices.size());
+        CHECK((INVALID_CORE_OP_HANDLE == pinned_device->pinned_core_op_handle) ||
+            (core_op_handle == pinned_device->pinned_core_op_handle), HAILO_INVALID_OPERATION,
+            "Device {} is already pinned to another core op", pinned_device->device_id);
+    }
+
+    auto previous_pinned_device = get_pinned_device(core_op_handle);
+    if (nullptr != previous_pinned_device) {
+        previous_pinned_device->pinned_core_op_handle = INVALID_CORE_OP_HANDLE;
+    }
+    if (nullptr != pinned_device) {
+        pinned_device->pinned_core_op_handle = core_op_handle;
+        LOGGER__INFO("Pinning core op {} to device {}", core_op_handle, pinned_device->device_id);
+    }
+
+    m_scheduler_thread.signal();
+    return HAILO_SUCCESS;
+}
+
+std::shared_ptr<ActiveDeviceInfo> CoreOpsScheduler::get_pinned_device(scheduler_core_op_handle_t core_op_handle) const
+{
+    for (const auto &pair : m_devices) {
+        if (core_op_handle == pair.second->pinned_core_op_handle) {
+            return pair.second;
+        }
+    }
+    return nullptr;
+}
+
+bool CoreOpsScheduler::is_allowed_on_device(scheduler_core_op_handle_t core_op_handle,
+    const ActiveDeviceInfo &device_info) const
+{
+    if (device_info.is_asleep || device_info.is_draining) {
+        return false;
+    }
+
+    const scheduler_core_op_handle_t device_owner = device_info.pinned_core_op_handle;
+    if (INVALID_CORE_OP_HANDLE != device_owner) {
+        // Only the owner runs on a pinned device - and it runs on it regardless of its affinity or the device thermal
+        // state (it doesn't run anywhere else)
+        return (core_op_handle == device_owner);
+    }
+    if (nullptr != get_pinned_device(core_op_handle)) {
+        return false;
+    }
+
+    const auto &scheduled_core_op = *m_scheduled_core_ops.at(core_op_handle);
+    return scheduled_core_op.is_allowed_on_device(device_info.device_index) &&
+        !should_avoid_device(scheduled_core_op, device_info);
+}
+
+void CoreOpsScheduler::set_device_thermally_throttled(const device_id_t &device_id, bool is_throttled)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    if (!contains(m_devices, device_id)) {
+        return;
+    }
+    m_devices.at(device_id)->is_thermally_throttled = is_throttled;
+    m_scheduler_thread.signal();
+}
+
+Expected<bool> CoreOpsScheduler::mark_device_asleep_if_idle(const device_id_t &device_id,
+    std::chrono::milliseconds idle_time)
+{
+    const auto is_idle_for = [this, &device_id, idle_time]() {
+        const auto &device_info = *m_devices.at(device_id);
+        if (!device_info.is_idle() || device_info.is_switching_core_op ||
+                ((std::chrono::steady_clock::now() - device_info.last_frame_done_time.load()) < idle_time)) {
+            return false;
+        }
+        for (const auto &pair : m_scheduled_core_ops) {
+            if ((pair.second->requested_infer_requests() > 0) &&
+                    pair.second->is_allowed_on_device(device_info.device_index)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Checked under a shared lock first, so the (periodic) check doesn't block the enqueues of busy devices
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+        CHECK_AS_EXPECTED(contains(m_devices, device_id), HAILO_NOT_FOUND, "Device {} is not scheduled", device_id);
+        if (m_devices.at(device_id)->is_asleep) {
+            return true;
+        }
+        if (!is_idle_for()) {
+            return false;
+        }
+    }
+
+    // Unique lock, so no core op is switched to the device (or sent frames) meanwhile
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    if (!is_idle_for()) {
+        return false;
+    }
+    auto status = deactivate_core_op(device_id);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    auto &device_info = *m_devices.at(device_id);
+    device_info.is_wake_requested = false;
+    device_info.is_asleep = true;
+    m_asleep_devices_count++;
+    return true;
+}
+
+void CoreOpsScheduler::mark_device_awake(const device_id_t &device_id)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    if (!contains(m_devices, device_id)) {
+        return;
+    }
+    auto &device_info = *m_devices.at(device_id);
+    if (device_info.is_asleep.exchange(false)) {
+        m_asleep_devices_count--;
+    }
+    device_info.is_wake_requested = false;
+    // The idle time is counted from the wake
+    device_info.last_frame_done_time = std::chrono::steady_clock::now();
+    m_scheduler_thread.signal();
+}
+
+void CoreOpsScheduler::set_wake_device_callback(std::function<void(const device_id_t &device_id)> callback)
+{
+    // Unique lock, so the previous callback isn't called once this function returns
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    m_wake_device_callback = callback;
+}
+
+hailo_status CoreOpsScheduler::add_device(const device_id_t &device_id, const std::string &device_arch,
+    const std::function<void()> &attach_device_core_ops)
+{
+    // Unique lock, so the scheduler thread sees the device only once its core ops are attached
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    CHECK(!contains(m_devices, device_id), HAILO_INVALID_OPERATION, "Device {} is already scheduled", device_id);
+
+    // The device takes the lowest free index, so the indices of the other devices (which the device affinity masks
+    // refer to) are kept
+    uint32_t device_index = 0;
+    while (std::any_of(m_devices.begin(), m_devices.end(),
+            [device_index](const std::pair<const device_id_t, std::shared_ptr<ActiveDeviceInfo>> &pair) {
+                return device_index == pair.second->device_index;
+            })) {
+        device_index++;
+    }
+    auto device_info = make_shared_nothrow<ActiveDeviceInfo>(device_id, device_arch, device_index);
+    CHECK_NOT_NULL(device_info, HAILO_OUT_OF_HOST_MEMORY);
+
+    attach_device_core_ops();
+    m_devices.emplace(device_id, device_info);
+    LOGGER__INFO("Scheduling core ops on added device {} (device index {})", device_id, device_index);
+
+    m_scheduler_thread.signal();
+    return HAILO_SUCCESS;
+}
+
+hailo_status CoreOpsScheduler::remove_device(const device_id_t &device_id, std::chrono::milliseconds timeout,
+    const std::function<void()> &detach_device_core_ops)
+{
+    std::shared_ptr<ActiveDeviceInfo> device_info = nullptr;
+    {
+        // Unique lock, so no core op is switched to the device (or sent frames) once it is draining
+        std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+        CHECK(contains(m_devices, device_id), HAILO_NOT_FOUND, "Device {} is not scheduled", device_id);
+        CHECK(m_devices.size() > 1, HAILO_INVALID_OPERATION, "Can't remove device {}, the last device of the vdevice",
+            device_id);
+        device_info = m_devices.at(device_id);
+        CHECK(!device_info->is_draining, HAILO_INVALID_OPERATION, "Device {} is already being removed", device_id);
+        device_info->is_draining = true;
+        // The core op that owned the device runs on the other devices from now on
+        device_info->pinned_core_op_handle = INVALID_CORE_OP_HANDLE;
+    }
+    m_scheduler_thread.signal();
+
+    const auto drain_start_time = std::chrono::steady_clock::now();
+    while (!device_info->is_idle() && ((std::chrono::steady_clock::now() - drain_start_time) < timeout)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (!device_info->is_idle()) {
+        LOGGER__WARNING("Device {} still has {} frames in flight after {} ms, aborting them", device_id,
+            device_info->ongoing_infer_requests.load(), timeout.count());
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    // Deactivating the core op cancels the transfers still in flight (they are completed with HAILO_STREAM_ABORT)
+    auto status = deactivate_core_op(device_id);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed deactivating the core op of removed device {}, status {}", device_id, status);
+        // continue, the device is removed anyway
+    }
+    if (device_info->is_asleep.exchange(false)) {
+        m_asleep_devices_count--;
+    }
+    m_devices.erase(device_id);
+    detach_device_core_ops();
+    LOGGER__INFO("Stopped scheduling core ops on removed device {}", device_id);
+
+    m_scheduler_thread.signal();
+    return HAILO_SUCCESS;
+}
+
+bool CoreOpsScheduler::should_avoid_device(const ScheduledCoreOp &scheduled_core_op,
+    const ActiveDeviceInfo &device_info) const
+{
+    if (!device_info.is_thermally_throttled) {
+        return false;
+    }
+
+    // If all the devices the core op may run on are throttled, it keeps running on them
+    for (const auto &pair : m_devices) {
+        if (!pair.second->is_thermally_throttled && !pair.second->is_draining &&
+                (INVALID_CORE_OP_HANDLE == pair.second->pinned_core_op_handle) &&
+                scheduled_core_op.is_allowed_on_device(pair.second->device_index)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+hailo_status CoreOpsScheduler::recover_core_op(const scheduler_core_op_handle_t &core_op_handle)
+{
+    // Unique lock, so the core op isn't switched (or sent frames) by the scheduler thread meanwhile
+    std::unique_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    CHECK(contains(m_scheduled_core_ops, core_op_handle), HAILO_NOT_FOUND, "Core op {} is not scheduled", core_op_handle);
+
+    hailo_status status = HAILO_SUCCESS;
+    for (const auto &device_state : m_devices) {
+        if (device_state.second->current_core_op_handle != core_op_handle) {
+            continue;
+        }
+        LOGGER__WARNING("Recovering core op {} on device {}", core_op_handle, device_state.first);
+        // The transfers in flight are canceled (completed with HAILO_STREAM_ABORT), and the device is released, so
+        // the core op is activated again by switch_core_op.
+        auto deactivate_status = deactivate_core_op(device_state.first);
+        if (HAILO_SUCCESS != deactivate_status) {
+            LOGGER__ERROR("Failed recovering core op {} on device {}, status = {}", core_op_handle, device_state.first,
+                deactivate_status);
+            status = deactivate_status;
+            // continue
+        }
+    }
+
+    m_scheduler_thread.signal();
+    return status;
+}
+
+hailo_status CoreOpsScheduler::set_burst_size_bounds(const scheduler_core_op_handle_t &core_op_handle,
+    uint32_t min_burst_size, uint32_t max_burst_size, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    return m_scheduled_core_ops.at(core_op_handle)->set_burst_size_bounds(min_burst_size, max_burst_size);
+}
+
+hailo_status CoreOpsScheduler::set_batch_size(const scheduler_core_op_handle_t &core_op_handle, uint16_t batch_size,
+    const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    return m_scheduled_core_ops.at(core_op_handle)->set_batch_size(batch_size);
+}
+
+hailo_status CoreOpsScheduler::set_overload_policy(const scheduler_core_op_handle_t &core_op_handle,
+    hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    auto status = m_scheduled_core_ops.at(core_op_handle)->set_overload_policy(policy, max_pending_frames);
+    // Frames above the new max pending frames may be dropped
+    m_scheduler_thread.signal();
+    return status;
+}
+
+Expected<hailo_scheduler_overload_stats_t> CoreOpsScheduler::get_overload_stats(const scheduler_core_op_handle_t &core_op_handle)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    return m_scheduled_core_ops.at(core_op_handle)->get_overload_stats();
+}
+
 hailo_status CoreOpsScheduler::optimize_streaming_if_enabled(const scheduler_core_op_handle_t &core_op_handle)
 {
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    auto pinned_device = get_pinned_device(core_op_handle);
+    if ((nullptr != pinned_device) && !scheduled_core_op->use_dynamic_batch_flow()) {
+        return stream_to_pinned_device(core_op_handle, *pinned_device);
+    }
+
     if (!scheduled_core_op->use_dynamic_batch_flow()) {
         auto next_pair = m_devices.upper_bound(scheduled_core_op->get_last_device()); // Get last device and go to the next device in the map
         if (m_devices.end() == next_pair){ // In case we reached to the end of the map - start from the beginning
@@ -294,6 +880,7 @@ hailo_status CoreOpsScheduler::optimize_streaming_if_enabled(const scheduler_cor
         }
         auto &device_info = next_pair->second;
         if (device_info->current_core_op_handle == core_op_handle && !device_info->is_switching_core_op &&
+            is_allowed_on_device(core_op_handle, *device_info) && !is_client_deferred(core_op_handle) &&
             !CoreOpsSchedulerOracle::should_stop_streaming(*this, scheduled_core_op->get_priority(), device_info->device_id) &&
             (get_frames_ready_to_transfer(core_op_handle, device_info->device_id) >= DEFAULT_BURST_SIZE)) {
             auto status = send_all_pending_buffers(core_op_handle, device_info->device_id, DEFAULT_BURST_SIZE);
@@ -303,15 +890,122 @@ hailo_status CoreOpsScheduler::optimize_streaming_if_enabled(const scheduler_cor
     return HAILO_SUCCESS;
 }
 
+// The core op owns the device, so all of its ready frames are sent as soon as they are ready - without waiting for a
+// burst, and without considering other core ops.
+hailo_status CoreOpsScheduler::stream_to_pinned_device(scheduler_core_op_handle_t core_op_handle,
+    const ActiveDeviceInfo &device_info)
+{
+    if ((device_info.current_core_op_handle != core_op_handle) || device_info.is_switching_core_op) {
+        // The core op is activated on the device by the oracle's decisions
+        return HAILO_SUCCESS;
+    }
+
+    const auto frames_count = get_frames_ready_to_transfer(core_op_handle, device_info.device_id);
+    if (0 == frames_count) {
+        return HAILO_SUCCESS;
+    }
+    return send_all_pending_buffers(core_op_handle, device_info.device_id, frames_count);
+}
+
 Expected<InferRequest> CoreOpsScheduler::dequeue_infer_request(scheduler_core_op_handle_t core_op_handle)
 {
-    auto infer_request = m_infer_requests.at(core_op_handle).dequeue();
-    CHECK_EXPECTED(infer_request);
+    auto infer_request = m_infer_requests.at(core_op_handle)->dequeue();
+    CHECK_EXPECTED(infer_request, "Can't dequeue infer request if queue is empty");
 
     m_scheduled_core_ops.at(core_op_handle)->requested_infer_requests().fetch_sub(1);
+    m_scheduled_core_ops.at(core_op_handle)->pop_pending_request_timestamp();
     return infer_request.release();
 }
 
+static void complete_infer_request(InferRequest &infer_request, hailo_status status)
+{
+    for (auto &transfer : infer_request.transfers) {
+        transfer.callback(status);
+    }
+
+    // Before calling infer_callback, we must ensure all stream callbacks were called and released (since the
+    // user may capture some variables in the callbacks).
+    infer_request.transfers.clear();
+    infer_request.callback(status);
+}
+
+// Completes the infer requests shed on enqueue, and (for the drop oldest policy) drops the oldest pending infer
+// requests while the core op has more than its max pending frames.
+void CoreOpsScheduler::shed_infer_requests(scheduler_core_op_handle_t core_op_handle)
+{
+    auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+
+    auto &shed_queue = m_shed_infer_requests.at(core_op_handle);
+    while (true) {
+        auto shed_request = shed_queue->dequeue();
+        if (!shed_request) {
+            break;
+        }
+        scheduled_core_op->add_shed_frame(shed_request->status);
+        complete_infer_request(shed_request->infer_request, shed_request->status);
+    }
+
+    if (HAILO_SCHEDULER_OVERLOAD_POLICY_DROP_OLDEST != scheduled_core_op->get_overload_policy()) {
+        return;
+    }
+
+    // Only the scheduler thread dequeues, so the pending requests can't run out while dropping.
+    while (scheduled_core_op->requested_infer_requests() > scheduled_core_op->get_max_pending_frames()) {
+        auto infer_request = dequeue_infer_request(core_op_handle);
+        if (!infer_request) {
+            break;
+        }
+        scheduled_core_op->add_shed_frame(HAILO_FRAME_DROPPED);
+        complete_infer_request(infer_request.value(), HAILO_FRAME_DROPPED);
+    }
+}
+
+// A core op that had no pending requests starts competing from the lowest virtual time of the core ops that have
+// pending requests (instead of using the device time it didn't use while it was idle).
+void CoreOpsScheduler::catch_up_virtual_time(scheduler_core_op_handle_t core_op_handle)
+{
+    auto min_virtual_time = std::numeric_limits<double>::max();
+    for (const auto &core_op_pair : m_scheduled_core_ops) {
+        if ((core_op_pair.first != core_op_handle) && (core_op_pair.second->requested_infer_requests() > 0)) {
+            min_virtual_time = std::min(min_virtual_time, core_op_pair.second->get_virtual_time());
+        }
+    }
+
+    if (std::numeric_limits<double>::max() != min_virtual_time) {
+        m_scheduled_core_ops.at(core_op_handle)->catch_up_virtual_time(min_virtual_time);
+    }
+}
+
+template<typename T>
+static hailo_status resize_queue(std::unique_ptr<BoundedMpmcQueue<T>> &queue, size_t capacity)
+{
+    if (queue->capacity() >= capacity) {
+        return HAILO_SUCCESS;
+    }
+
+    TRY(auto new_queue, BoundedMpmcQueue<T>::create(capacity));
+    while (true) {
+        auto item = queue->dequeue();
+        if (!item) {
+            break;
+        }
+        auto status = new_queue->enqueue(item.release());
+        CHECK_SUCCESS(status, "Failed moving infer request to the resized queue");
+    }
+
+    queue = std::move(new_queue);
+    return HAILO_SUCCESS;
+}
+
+// Assumes that m_scheduler_mutex is locked using unique_lock!
+hailo_status CoreOpsScheduler::resize_infer_requests_queue(scheduler_core_op_handle_t core_op_handle, size_t capacity)
+{
+    auto status = resize_queue(m_infer_requests.at(core_op_handle), capacity);
+    CHECK_SUCCESS(status);
+
+    return resize_queue(m_shed_infer_requests.at(core_op_handle), capacity);
+}
+
 uint16_t CoreOpsScheduler::get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle,
     const device_id_t &device_id) const
 {
@@ -344,8 +1038,11 @@ Expected<std::shared_ptr<VdmaConfigCoreOp>> CoreOpsScheduler::get_vdma_core_op(s
 
 void CoreOpsScheduler::shutdown_core_op(scheduler_core_op_handle_t core_op_handle)
 {
-    // Deactivate core op from all devices
+    // Deactivate core op from all devices (and release the device it owns)
     for (const auto &device_state : m_devices) {
+        if (device_state.second->pinned_core_op_handle == core_op_handle) {
+            device_state.second->pinned_core_op_handle = INVALID_CORE_OP_HANDLE;
+        }
         if (device_state.second->current_core_op_handle == core_op_handle) {
             auto status = deactivate_core_op(device_state.first);
             if (HAILO_SUCCESS != status) {
@@ -355,26 +1052,26 @@ void CoreOpsScheduler::shutdown_core_op(scheduler_core_op_handle_t core_op_handl
         }
     }
 
-    // Cancel all requests on the queue
+    // Complete the shed requests, and cancel all requests on the queue
+    shed_infer_requests(core_op_handle);
     auto core_op = m_scheduled_core_ops.at(core_op_handle);
     while (core_op->requested_infer_requests() > 0) {
         auto request = dequeue_infer_request(core_op_handle);
         assert(request);
-        for (auto &transfer : request->transfers) {
-            transfer.second.callback(HAILO_STREAM_ABORT);
-        }
-
-        // Before calling infer_callback, we must ensure all stream callbacks were called and released (since the
-        // user may capture some variables in the callbacks).
-        request->transfers.clear();
-        request->callback(HAILO_STREAM_ABORT);
+        complete_infer_request(request.value(), HAILO_STREAM_ABORT);
     }
 }
 
 void CoreOpsScheduler::schedule()
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
-    // First, we are using streaming optimization (where switch is not needed)
+    // First, we shed the infer requests that the overload policies of the core ops don't allow to queue
+    for (auto &core_op_pair : m_scheduled_core_ops) {
+        shed_infer_requests(core_op_pair.first);
+    }
+    update_deferred_clients();
+
+    // Then, we are using streaming optimization (where switch is not needed)
     for (auto &core_op_pair : m_scheduled_core_ops) {
         auto status = optimize_streaming_if_enabled(core_op_pair.first);
         if ((HAILO_SUCCESS != status) &&
@@ -401,8 +1098,115 @@ void CoreOpsScheduler::schedule()
     }
 }
 
-CoreOpsScheduler::SchedulerThread::SchedulerThread(CoreOpsScheduler &scheduler) :
+// A client is deferred while another client that has frames to run is behind it: over its quota while the other is
+// within its own, or over its fair part of the vdevice (among the clients with frames to run) while the other is under
+// it. The client that used the least device time (among the clients within their quotas) is never deferred - so the
+// devices aren't left idle.
+void CoreOpsScheduler::update_deferred_clients()
+{
+    m_deferred_clients.clear();
+    if (m_clients.size() < 2) {
+        return;
+    }
+
+    std::unordered_set<uint32_t> waiting_clients;
+    for (const auto &pair : m_scheduled_core_ops) {
+        auto &scheduled_core_op = *pair.second;
+        const auto client_id = scheduled_core_op.get_client_id();
+        if ((0 != client_id) && (scheduled_core_op.requested_infer_requests() > 0) &&
+                (scheduled_core_op.is_over_threshold() || scheduled_core_op.is_over_timeout())) {
+            waiting_clients.insert(client_id);
+        }
+    }
+    if (waiting_clients.size() < 2) {
+        return;
+    }
+
+    std::unordered_map<uint32_t, double> utilizations;
+    std::unordered_set<uint32_t> within_quota_clients;
+    for (const auto client_id : waiting_clients) {
+        auto &client_state = *m_clients.at(client_id);
+        const auto utilization = client_state.get_utilization(m_devices.size());
+        utilizations[client_id] = utilization;
+        if ((0 == client_state.quota_percent()) || ((utilization * 100) < client_state.quota_percent())) {
+            within_quota_clients.insert(client_id);
+        }
+    }
+
+    // If all the waiting clients are over their quotas, they share the vdevice fairly
+    const auto &candidates = within_quota_clients.empty() ? waiting_clients : within_quota_clients;
+    for (const auto client_id : waiting_clients) {
+        if (!contains(candidates, client_id)) {
+            m_deferred_clients.insert(client_id);
+        }
+    }
+
+    const auto fair_utilization = 1.0 / static_cast<double>(candidates.size());
+    const auto has_lagging_client = std::any_of(candidates.begin(), candidates.end(),
+        [&utilizations, fair_utilization](uint32_t client_id) { return utilizations.at(client_id) < fair_utilization; });
+    if (!has_lagging_client) {
+        return;
+    }
+    for (const auto client_id : candidates) {
+        if (utilizations.at(client_id) > fair_utilization) {
+            m_deferred_clients.insert(client_id);
+        }
+    }
+}
+
+bool CoreOpsScheduler::is_client_deferred(scheduler_core_op_handle_t core_op_handle) const
+{
+    if (m_deferred_clients.empty()) {
+        return false;
+    }
+    const auto client_id = m_scheduled_core_ops.at(core_op_handle)->get_client_id();
+    return (0 != client_id) && contains(m_deferred_clients, client_id);
+}
+
+CoreOpsScheduler::ClientState::ClientState(uint32_t quota_percent) :
+    m_quota_percent(quota_percent),
+    m_window_start(std::chrono::steady_clock::now()),
+    m_current_window_device_time_ms(0),
+    m_previous_window_device_time_ms(0)
+{}
+
+void CoreOpsScheduler::ClientState::rotate_window(std::chrono::steady_clock::time_point now)
+{
+    const auto elapsed = now - m_window_start;
+    if (elapsed < CLIENT_ACCOUNTING_WINDOW) {
+        return;
+    }
+    // A client that didn't run for a whole window starts over
+    m_previous_window_device_time_ms = (elapsed < (2 * CLIENT_ACCOUNTING_WINDOW)) ? m_current_window_device_time_ms : 0;
+    m_current_window_device_time_ms = 0;
+    m_window_start = now;
+}
+
+void CoreOpsScheduler::ClientState::add_device_time(double device_time_ms)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rotate_window(std::chrono::steady_clock::now());
+    m_current_window_device_time_ms += device_time_ms;
+}
+
+double CoreOpsScheduler::ClientState::get_utilization(size_t devices_count)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    rotate_window(now);
+
+    const auto accounted_time_ms = std::chrono::duration<double, std::milli>(
+        CLIENT_ACCOUNTING_WINDOW + (now - m_window_start)).count();
+    const auto device_time_ms = m_previous_window_device_time_ms + m_current_window_device_time_ms;
+    return std::min(1.0, device_time_ms / (accounted_time_ms * static_cast<double>(devices_count)));
+}
+
+CoreOpsScheduler::SchedulerThread::SchedulerThread(CoreOpsScheduler &scheduler, int numa_node,
+    uint64_t cpu_affinity_mask, uint32_t realtime_priority) :
     m_scheduler(scheduler),
+    m_numa_node(numa_node),
+    m_cpu_affinity_mask(cpu_affinity_mask),
+    m_realtime_priority(realtime_priority),
     m_is_running(true),
     m_execute_worker_thread(false),
     m_thread([this]() { worker_thread_main(); })
@@ -433,7 +1237,28 @@ void CoreOpsScheduler::SchedulerThread::stop()
 
 void CoreOpsScheduler::SchedulerThread::worker_thread_main()
 {
-    OsUtils::set_current_thread_name("SCHEDULER");
+    OsUtils::set_current_thread_name("HRT_SCHEDULER");
+
+    if (0 != m_cpu_affinity_mask) {
+        auto status = OsUtils::set_current_thread_cpu_mask(m_cpu_affinity_mask);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting scheduler thread affinity to cpu mask 0x{:x}, status {}",
+                m_cpu_affinity_mask, status);
+        }
+    } else if (HailoRTDriver::UNKNOWN_NUMA_NODE != m_numa_node) {
+        auto status = OsUtils::set_current_thread_numa_affinity(m_numa_node);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting scheduler thread affinity to numa node {}, status {}", m_numa_node, status);
+        }
+    }
+
+    if (0 != m_realtime_priority) {
+        auto status = OsUtils::set_current_thread_realtime_priority(m_realtime_priority);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting scheduler thread real-time priority {}, status {}", m_realtime_priority,
+                status);
+        }
+    }
 
     while (m_is_running) {
         {
@@ -19,13 +19,20 @@
 #include "utils/thread_safe_map.hpp"
 #include "utils/thread_safe_queue.hpp"
 
+#include "vdma/driver/hailort_driver.hpp"
+
 #include "vdevice/scheduler/scheduled_core_op_state.hpp"
 #include "vdevice/scheduler/scheduler_base.hpp"
 
+#include <functional>
+#include <unordered_set>
+
 
 namespace hailort
 {
 
+#define DISABLE_SCHEDULER_MAPPING_PREFETCH_ENV_VAR ("HAILO_DISABLE_SCHEDULER_MAPPING_PREFETCH")
+
 using scheduler_core_op_handle_t = uint32_t;
 using core_op_priority_t = uint8_t;
 
@@ -42,10 +49,19 @@ class VDeviceCoreOp;
 class CoreOpsScheduler : public SchedulerBase
 {
 public:
+    // The scheduler thread is pinned to the cpus in cpu_affinity_mask, or if it is 0, placed on numa_node (if it is
+    // known). If realtime_priority isn't 0, the thread runs with a real-time policy at that priority.
     static Expected<CoreOpsSchedulerPtr> create_round_robin(std::vector<std::string> &devices_ids, 
-        std::vector<std::string> &devices_arch);
+        std::vector<std::string> &devices_arch, int numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE,
+        uint64_t cpu_affinity_mask = 0, uint32_t realtime_priority = 0);
+    static Expected<CoreOpsSchedulerPtr> create_deadline(std::vector<std::string> &devices_ids,
+        std::vector<std::string> &devices_arch, int numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE,
+        uint64_t cpu_affinity_mask = 0, uint32_t realtime_priority = 0);
+    static Expected<CoreOpsSchedulerPtr> create_fair_share(std::vector<std::string> &devices_ids,
+        std::vector<std::string> &devices_arch, int numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE,
+        uint64_t cpu_affinity_mask = 0, uint32_t realtime_priority = 0);
     CoreOpsScheduler(hailo_scheduling_algorithm_t algorithm, std::vector<std::string> &devices_ids, 
-        std::vector<std::string> &devices_arch);
+        std::vector<std::string> &devices_arch, int numa_node, uint64_t cpu_affinity_mask, uint32_t realtime_priority);
 
     virtual ~CoreOpsScheduler();
     CoreOpsScheduler(const CoreOpsScheduler &other) = delete;
@@ -65,9 +81,60 @@ public:
     hailo_status set_timeout(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &timeout, const std::string &network_name);
     hailo_status set_threshold(const scheduler_core_op_handle_t &core_op_handle, uint32_t threshold, const std::string &network_name);
     hailo_status set_priority(const scheduler_core_op_handle_t &core_op_handle, core_op_priority_t priority, const std::string &network_name);
+    hailo_status set_deadline(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &deadline, const std::string &network_name);
+    hailo_status set_share(const scheduler_core_op_handle_t &core_op_handle, uint32_t share, const std::string &network_name);
+    hailo_status set_device_affinity(const scheduler_core_op_handle_t &core_op_handle, uint64_t device_mask, const std::string &network_name);
+    hailo_status set_sticky_placement(const scheduler_core_op_handle_t &core_op_handle, bool is_sticky, const std::string &network_name);
+    // Pins the core op to the device at device_index (or unpins it, if HAILO_SCHEDULER_NO_PINNED_DEVICE)
+    hailo_status set_pinned_device(const scheduler_core_op_handle_t &core_op_handle, uint32_t device_index,
+        const std::string &network_name);
+    hailo_status set_burst_size_bounds(const scheduler_core_op_handle_t &core_op_handle, uint32_t min_burst_size,
+        uint32_t max_burst_size, const std::string &network_name);
+    // Deactivates the core op on the devices it is active on (canceling its transfers in flight), so it is activated
+    // again, from a reset state, before its next frames are sent. Its queued infer requests are kept.
+    hailo_status recover_core_op(const scheduler_core_op_handle_t &core_op_handle);
+    hailo_status set_batch_size(const scheduler_core_op_handle_t &core_op_handle, uint16_t batch_size,
+        const std::string &network_name);
+    hailo_status set_overload_policy(const scheduler_core_op_handle_t &core_op_handle,
+        hailo_scheduler_overload_policy_t policy, uint32_t max_pending_frames, const std::string &network_name);
+    Expected<hailo_scheduler_overload_stats_t> get_overload_stats(const scheduler_core_op_handle_t &core_op_handle);
+
+    // While a device is throttled, core ops are kept off it as long as another (not throttled) device may run them
+    void set_device_thermally_throttled(const device_id_t &device_id, bool is_throttled);
+
+    // Idle power management (see IdlePowerGovernor):
+    // Marks the device asleep if it didn't run frames for idle_time (and no frames wait for it), deactivating its core
+    // op. Returns false if the device isn't idle for long enough. Once marked, the caller puts the device to sleep.
+    Expected<bool> mark_device_asleep_if_idle(const device_id_t &device_id, std::chrono::milliseconds idle_time);
+    // Lets the scheduler run core ops on the device again, once it is awake
+    void mark_device_awake(const device_id_t &device_id);
+    // The callback is called (on enqueue, from the user threads) with an asleep device that should be woken - since
+    // a core op has no awake device to run on, or more pending frames than its awake devices may run.
+    void set_wake_device_callback(std::function<void(const device_id_t &device_id)> callback);
+
+    // Devices hot plug (see VDevice::add_device):
+    // Starts scheduling core ops on the device. attach_device_core_ops is called (under the scheduler's unique lock)
+    // before the device is scheduled, to add the core ops configured on the device to the scheduled core ops.
+    hailo_status add_device(const device_id_t &device_id, const std::string &device_arch,
+        const std::function<void()> &attach_device_core_ops);
+    // Stops scheduling core ops on the device, waits up to timeout for its frames in flight (the frames left after
+    // the timeout are aborted), and deactivates its core op. detach_device_core_ops is called (under the scheduler's
+    // unique lock) once the device is no longer scheduled, to remove the device's core ops from the scheduled core ops.
+    hailo_status remove_device(const device_id_t &device_id, std::chrono::milliseconds timeout,
+        const std::function<void()> &detach_device_core_ops);
+
+    // Accounts the device time of the core op to client_id (e.g. the pid of a service client). While several clients
+    // have frames to run, a client that used more than quota_percent of the vdevice's device time (0 for no quota), or
+    // more than its fair part of it while others lag behind, isn't scheduled until the others catch up.
+    hailo_status set_core_op_client(const scheduler_core_op_handle_t &core_op_handle, uint32_t client_id,
+        uint32_t quota_percent);
 
     virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
         const device_id_t &device_id) override;
+    virtual std::chrono::time_point<std::chrono::steady_clock> get_core_op_deadline(
+        const scheduler_core_op_handle_t &core_op_handle) override;
+    virtual double get_core_op_virtual_time(const scheduler_core_op_handle_t &core_op_handle) override;
+    virtual bool is_core_op_sticky(const scheduler_core_op_handle_t &core_op_handle) override;
 
 private:
     hailo_status switch_core_op(const scheduler_core_op_handle_t &core_op_handle, const device_id_t &device_id);
@@ -79,17 +146,51 @@ private:
     hailo_status optimize_streaming_if_enabled(const scheduler_core_op_handle_t &core_op_handle);
 
     Expected<InferRequest> dequeue_infer_request(scheduler_core_op_handle_t core_op_handle);
+    void shed_infer_requests(scheduler_core_op_handle_t core_op_handle);
+    void prefetch_mappings(scheduler_core_op_handle_t core_op_handle, InferRequest &infer_request);
+    void request_devices_wake(scheduler_core_op_handle_t core_op_handle);
+    void catch_up_virtual_time(scheduler_core_op_handle_t core_op_handle);
+    hailo_status resize_infer_requests_queue(scheduler_core_op_handle_t core_op_handle, size_t capacity);
     uint16_t get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id) const;
+    bool should_avoid_device(const ScheduledCoreOp &scheduled_core_op, const ActiveDeviceInfo &device_info) const;
+    bool is_allowed_on_device(scheduler_core_op_handle_t core_op_handle, const ActiveDeviceInfo &device_info) const;
+    std::shared_ptr<ActiveDeviceInfo> get_pinned_device(scheduler_core_op_handle_t core_op_handle) const;
+    hailo_status stream_to_pinned_device(scheduler_core_op_handle_t core_op_handle, const ActiveDeviceInfo &device_info);
 
     Expected<std::shared_ptr<VdmaConfigCoreOp>> get_vdma_core_op(scheduler_core_op_handle_t core_op_handle,
         const device_id_t &device_id);
 
     void shutdown_core_op(scheduler_core_op_handle_t core_op_handle);
+    void update_deferred_clients();
+    bool is_client_deferred(scheduler_core_op_handle_t core_op_handle) const;
     void schedule();
 
+    // The device time used by a client, over a sliding window of CLIENT_ACCOUNTING_WINDOW to two of them
+    class ClientState final {
+    public:
+        explicit ClientState(uint32_t quota_percent);
+
+        void add_device_time(double device_time_ms);
+        // The part of the vdevice's device time used by the client, in [0, 1]
+        double get_utilization(size_t devices_count);
+        uint32_t quota_percent() const { return m_quota_percent; }
+        void set_quota_percent(uint32_t quota_percent) { m_quota_percent = quota_percent; }
+
+    private:
+        void rotate_window(std::chrono::steady_clock::time_point now);
+
+        std::atomic_uint32_t m_quota_percent;
+        std::mutex m_mutex;
+        std::chrono::steady_clock::time_point m_window_start;
+        double m_current_window_device_time_ms;
+        double m_previous_window_device_time_ms;
+    };
+    using ClientStatePtr = std::shared_ptr<ClientState>;
+
     class SchedulerThread final {
     public:
-        SchedulerThread(CoreOpsScheduler &scheduler);
+        SchedulerThread(CoreOpsScheduler &scheduler, int numa_node, uint64_t cpu_affinity_mask,
+            uint32_t realtime_priority);
 
         ~SchedulerThread();
 
@@ -103,6 +204,9 @@ private:
         void worker_thread_main();
 
         CoreOpsScheduler &m_scheduler;
+        const int m_numa_node;
+        const uint64_t m_cpu_affinity_mask;
+        const uint32_t m_realtime_priority;
         std::mutex m_mutex;
         std::condition_variable m_cv;
         std::atomic_bool m_is_running;
@@ -112,18 +216,41 @@ private:
 
     std::unordered_map<vdevice_core_op_handle_t, ScheduledCoreOpPtr> m_scheduled_core_ops;
 
-    using InferRequestQueue = SafeQueue<InferRequest>;
-    std::unordered_map<vdevice_core_op_handle_t, InferRequestQueue> m_infer_requests;
+    // Lock-free, so enqueue (from the user threads) and dequeue (from the scheduler thread) don't block each other.
+    // The capacity is large enough for the async queues of all instances of the core op.
+    using InferRequestQueue = BoundedMpmcQueue<InferRequest>;
+    std::unordered_map<vdevice_core_op_handle_t, std::unique_ptr<InferRequestQueue>> m_infer_requests;
+
+    // Infer requests shed by the overload policy of the core op on enqueue. They are completed (with the status) on
+    // the scheduler thread, since enqueue_infer_request is called from the context the request callback locks.
+    struct ShedInferRequest {
+        InferRequest infer_request;
+        hailo_status status;
+    };
+    using ShedInferRequestQueue = BoundedMpmcQueue<ShedInferRequest>;
+    std::unordered_map<vdevice_core_op_handle_t, std::unique_ptr<ShedInferRequestQueue>> m_shed_infer_requests;
 
     // This shared mutex guards accessing the scheduler data structures including:
     //   - m_scheduled_core_ops
     //   - m_infer_requests
+    //   - m_shed_infer_requests
     //   - m_core_op_priority
+    //   - m_clients
     // Any function that is modifing these structures (for example by adding/removing items) must lock this mutex using
     // unique_lock. Any function accessing these structures (for example access to
     // m_scheduled_core_ops.at(core_op_handle) can use shared_lock.
     std::shared_timed_mutex m_scheduler_mutex;
 
+    const bool m_is_mapping_prefetch_enabled;
+
+    // Read on enqueue, so the devices are checked only while some of them are asleep
+    std::atomic_uint32_t m_asleep_devices_count;
+    std::function<void(const device_id_t &device_id)> m_wake_device_callback;
+
+    std::unordered_map<uint32_t, ClientStatePtr> m_clients;
+    // Updated by the scheduler thread on each pass, and read only by it
+    std::unordered_set<uint32_t> m_deferred_clients;
+
     SchedulerThread m_scheduler_thread;
 };
 } /* namespace hailort */
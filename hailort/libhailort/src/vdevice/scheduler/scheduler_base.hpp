@@ -26,6 +26,7 @@ namespace hailort
 
 #define DEFAULT_SCHEDULER_TIMEOUT (std::chrono::milliseconds(0))
 #define DEFAULT_SCHEDULER_MIN_THRESHOLD (0)
+#define DEFAULT_SCHEDULER_DEADLINE (std::chrono::milliseconds(0))
 
 
 using scheduler_core_op_handle_t = uint32_t;
@@ -34,13 +35,20 @@ using core_op_priority_t = uint8_t;
 using stream_name_t = std::string;
 
 struct ActiveDeviceInfo {
-    ActiveDeviceInfo(const device_id_t &device_id, const std::string &device_arch) : 
+    ActiveDeviceInfo(const device_id_t &device_id, const std::string &device_arch, uint32_t device_index) : 
         current_core_op_handle(INVALID_CORE_OP_HANDLE), next_core_op_handle(INVALID_CORE_OP_HANDLE), is_switching_core_op(false), 
         current_batch_size(0),
         frames_left_before_stop_streaming(0),
         ongoing_infer_requests(0),
+        last_frame_done_time(std::chrono::steady_clock::now()),
+        is_thermally_throttled(false),
+        is_asleep(false),
+        is_wake_requested(false),
+        is_draining(false),
+        pinned_core_op_handle(INVALID_CORE_OP_HANDLE),
         device_id(device_id),
-        device_arch(device_arch)
+        device_arch(device_arch),
+        device_index(device_index)
     {}
 
     bool is_idle() const
@@ -48,7 +56,8 @@ struct ActiveDeviceInfo {
         return 0 == ongoing_infer_requests;
     }
 
-    scheduler_core_op_handle_t current_core_op_handle;
+    // Atomic since it is read on enqueue (from the user threads)
+    std::atomic<scheduler_core_op_handle_t> current_core_op_handle;
     scheduler_core_op_handle_t next_core_op_handle;
     std::atomic_bool is_switching_core_op;
     std::atomic_uint32_t current_batch_size;
@@ -59,8 +68,31 @@ struct ActiveDeviceInfo {
 
     std::atomic_uint32_t ongoing_infer_requests;
 
+    // Time the last infer request of the current core op was done (or the time the core op was activated). Used to
+    // measure the device time per frame.
+    std::atomic<std::chrono::steady_clock::time_point> last_frame_done_time;
+
+    // Set by the thermal governor while the device is over the thermal envelope (see ThermalGovernor)
+    std::atomic_bool is_thermally_throttled;
+
+    // Set while the idle power governor keeps the device asleep (see IdlePowerGovernor). No core op is activated on an
+    // asleep device.
+    std::atomic_bool is_asleep;
+    // Set once the wake of the asleep device was requested, so it is requested only once
+    std::atomic_bool is_wake_requested;
+
+    // Set while the device is removed from the vdevice (see CoreOpsScheduler::remove_device). No core op is activated
+    // on (or sent frames to) a draining device.
+    std::atomic_bool is_draining;
+
+    // The core op that owns the device, if any - no other core op runs on it, and the core op streams to it without
+    // the per-burst scheduling decisions (see CoreOpsScheduler::set_pinned_device)
+    std::atomic<scheduler_core_op_handle_t> pinned_core_op_handle;
+
     device_id_t device_id;
     std::string device_arch;
+    // Index of the device in the vdevice (used for the core ops device affinity masks)
+    uint32_t device_index;
 };
 
 // Group of core ops with the same priority.
@@ -128,6 +160,18 @@ public:
     virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
         const device_id_t &device_id) = 0;
 
+    // Returns the time the oldest pending request of the core op should be scheduled by (time_point::max() if the
+    // core op has no deadline or no pending requests).
+    virtual std::chrono::time_point<std::chrono::steady_clock> get_core_op_deadline(
+        const scheduler_core_op_handle_t &core_op_handle) = 0;
+
+    // Returns the device time consumed by the core op divided by its share.
+    virtual double get_core_op_virtual_time(const scheduler_core_op_handle_t &core_op_handle) = 0;
+
+    // Sticky core ops are not loaded on a device while another device holds them (unless the device has nothing
+    // else to run).
+    virtual bool is_core_op_sticky(const scheduler_core_op_handle_t &core_op_handle) = 0;
+
     virtual uint32_t get_device_count() const
     {
         return static_cast<uint32_t>(m_devices.size());
@@ -153,7 +197,7 @@ protected:
          std::vector<std::string> &devices_arch) : m_algorithm(algorithm)
     {
         for (uint32_t i = 0; i < devices_ids.size(); i++) {
-            m_devices[devices_ids.at(i)] = make_shared_nothrow<ActiveDeviceInfo>(devices_ids[i], devices_arch[i]);
+            m_devices[devices_ids.at(i)] = make_shared_nothrow<ActiveDeviceInfo>(devices_ids[i], devices_arch[i], i);
         }
     };
 
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_client_utils.cpp
+ * @brief Accounting the device time of scheduled network groups per client (used by the multi-process service)
+ **/
+
+#include "vdevice/scheduler/scheduler_client_utils.hpp"
+#include "vdevice/vdevice_core_op.hpp"
+#include "network_group/network_group_internal.hpp"
+
+namespace hailort
+{
+
+hailo_status SchedulerClientUtils::set_network_group_client(ConfiguredNetworkGroup &network_group, uint32_t client_id,
+    uint32_t quota_percent)
+{
+    auto network_group_base = dynamic_cast<ConfiguredNetworkGroupBase*>(&network_group);
+    CHECK(nullptr != network_group_base, HAILO_INVALID_OPERATION,
+        "Setting the scheduler client is supported only in the process that configured the network group");
+    auto core_op = std::dynamic_pointer_cast<VDeviceCoreOp>(network_group_base->get_core_op());
+    CHECK(nullptr != core_op, HAILO_INVALID_OPERATION, "Network group {} isn't configured on a vdevice",
+        network_group.name());
+    return core_op->set_scheduler_client(client_id, quota_percent);
+}
+
+} /* namespace hailort */
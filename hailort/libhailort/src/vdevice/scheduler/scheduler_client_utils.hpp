@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_client_utils.hpp
+ * @brief Accounting the device time of scheduled network groups per client (used by the multi-process service)
+ **/
+
+#ifndef _HAILO_SCHEDULER_CLIENT_UTILS_HPP_
+#define _HAILO_SCHEDULER_CLIENT_UTILS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/network_group.hpp"
+
+namespace hailort
+{
+
+class HAILORTAPI SchedulerClientUtils final
+{
+public:
+    // Accounts the device time of the network group to client_id, which gets at most quota_percent of the vdevice's
+    // device time while other clients have frames to run (0 for no quota). See CoreOpsScheduler::set_core_op_client.
+    static hailo_status set_network_group_client(ConfiguredNetworkGroup &network_group, uint32_t client_id,
+        uint32_t quota_percent);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SCHEDULER_CLIENT_UTILS_HPP_ */
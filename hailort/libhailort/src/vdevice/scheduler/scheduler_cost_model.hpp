@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_cost_model.hpp
+ * @brief Chooses the scheduler threshold and timeout of a core op from its measured switch and frame times.
+ **/
+
+#ifndef _HAILO_SCHEDULER_COST_MODEL_HPP_
+#define _HAILO_SCHEDULER_COST_MODEL_HPP_
+
+#include "vdevice/scheduler/scheduler_base.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+
+namespace hailort
+{
+
+#define DISABLE_SCHEDULER_COST_MODEL_ENV_VAR ("HAILO_DISABLE_SCHEDULER_COST_MODEL")
+
+class SchedulerCostModel final
+{
+public:
+    // A switch to a core op is amortized once it takes at most this fraction of the time the core op runs after it.
+    static constexpr double MAX_SWITCH_OVERHEAD = 0.2;
+
+    // Returns the amount of frames worth switching to the core op for (DEFAULT_SCHEDULER_MIN_THRESHOLD if the times
+    // were not measured yet).
+    static uint32_t get_threshold(double switch_time_ms, double frame_time_ms, std::chrono::milliseconds deadline,
+        uint16_t burst_size)
+    {
+        if ((0 == switch_time_ms) || (0 == frame_time_ms)) {
+            return DEFAULT_SCHEDULER_MIN_THRESHOLD;
+        }
+
+        auto frames = std::ceil(switch_time_ms / (MAX_SWITCH_OVERHEAD * frame_time_ms));
+
+        // Running the frames must not miss the deadline.
+        if (DEFAULT_SCHEDULER_DEADLINE != deadline) {
+            const auto deadline_ms = static_cast<double>(deadline.count());
+            frames = std::min(frames, std::floor((deadline_ms - switch_time_ms) / frame_time_ms));
+        }
+
+        // Frames above the burst size won't be sent after a single switch anyway.
+        frames = std::min(frames, static_cast<double>(burst_size));
+        return static_cast<uint32_t>(std::max(frames, 1.0));
+    }
+
+    // Returns the time worth waiting for the threshold (DEFAULT_SCHEDULER_TIMEOUT if the switch time was not measured
+    // yet).
+    static std::chrono::milliseconds get_timeout(double switch_time_ms, std::chrono::milliseconds deadline)
+    {
+        if (0 == switch_time_ms) {
+            return DEFAULT_SCHEDULER_TIMEOUT;
+        }
+
+        // Waiting for the threshold is bounded by the time the core op would run after the switch (so the latency
+        // added by the wait is in the order of the latency added by the switch), and by the deadline.
+        auto timeout = std::chrono::milliseconds(static_cast<uint64_t>(switch_time_ms / MAX_SWITCH_OVERHEAD));
+        if (DEFAULT_SCHEDULER_DEADLINE != deadline) {
+            timeout = std::min(timeout, deadline);
+        }
+        return timeout;
+    }
+
+    // Returns the amount of frames to stream after a switch to the core op - the frames already queued, and the frames
+    // expected to arrive while the burst runs (max_burst_size if the frames arrive faster than the device runs them,
+    // or if the times were not measured yet).
+    static uint16_t get_burst_size(uint32_t queue_depth, double frame_time_ms, double inter_arrival_time_ms,
+        uint16_t min_burst_size, uint16_t max_burst_size)
+    {
+        if ((0 == frame_time_ms) || (0 == inter_arrival_time_ms)) {
+            return max_burst_size;
+        }
+
+        // A burst of b frames runs for b * frame_time, during which b * load more frames arrive, so the burst keeps the
+        // device busy once b = queue_depth + (b * load).
+        const auto load = frame_time_ms / inter_arrival_time_ms;
+        if (load >= 1) {
+            return max_burst_size;
+        }
+
+        auto frames = std::ceil(static_cast<double>(queue_depth) / (1 - load));
+        frames = std::min(std::max(frames, static_cast<double>(min_burst_size)), static_cast<double>(max_burst_size));
+        return static_cast<uint16_t>(frames);
+    }
+
+private:
+    SchedulerCostModel() = default;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SCHEDULER_COST_MODEL_HPP_ */
@@ -10,21 +10,57 @@
 #include "vdevice/scheduler/scheduler_oracle.hpp"
 #include "utils/profiler/tracer_macros.hpp"
 
+#include <limits>
+
 
 namespace hailort
 {
 
-scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold)
+scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold,
+    bool allow_moving_sticky_core_ops)
 {
     auto device_info = scheduler.get_device_info(device_id);
+
+    // Core ops with a deadline are chosen first. Core ops without a deadline are chosen by priority (as in round robin).
+    if (HAILO_SCHEDULING_ALGORITHM_DEADLINE == scheduler.algorithm()) {
+        const bool DONT_SKIP_ACTIVE_CORE_OPS = false;
+        const auto core_op_handle = choose_earliest_deadline_model(scheduler, device_id, DONT_SKIP_ACTIVE_CORE_OPS,
+            allow_moving_sticky_core_ops);
+        if (INVALID_CORE_OP_HANDLE != core_op_handle) {
+            bool switch_because_idle = !(check_threshold);
+            TRACE(OracleDecisionTrace, switch_because_idle, device_id, core_op_handle, false, false);
+            device_info->is_switching_core_op = true;
+            device_info->next_core_op_handle = core_op_handle;
+            return core_op_handle;
+        }
+    }
+
     auto &priority_map = scheduler.get_core_op_priority_map();
     for (auto iter = priority_map.rbegin(); iter != priority_map.rend(); ++iter) {
         auto &priority_group = iter->second;
 
+        if (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == scheduler.algorithm()) {
+            SchedulerBase::ReadyInfo ready_info;
+            const auto index = choose_fair_share_index(scheduler, priority_group, device_id, check_threshold,
+                allow_moving_sticky_core_ops, ready_info);
+            if (index < priority_group.size()) {
+                const auto core_op_handle = priority_group.get(index);
+                bool switch_because_idle = !(check_threshold);
+                TRACE(OracleDecisionTrace, switch_because_idle, device_id, core_op_handle, ready_info.over_threshold, ready_info.over_timeout);
+                device_info->is_switching_core_op = true;
+                device_info->next_core_op_handle = core_op_handle;
+                // Core ops with equal virtual times are still chosen in round-robin order
+                priority_group.set_next(index + 1);
+                return core_op_handle;
+            }
+            continue;
+        }
+
         // Iterate all core ops inside the priority group starting from priority_group next core op
         for (uint32_t i = 0; i < priority_group.size(); i++) {
             auto core_op_handle = priority_group.get(i);
-            auto ready_info = scheduler.is_core_op_ready(core_op_handle, check_threshold, device_id);
+            auto ready_info = is_core_op_ready(scheduler, core_op_handle, check_threshold, device_id,
+                allow_moving_sticky_core_ops);
             if (ready_info.is_ready) {
                 // In cases device is idle the check_threshold is not needed, therefore is false.
                 bool switch_because_idle = !(check_threshold);
@@ -41,9 +77,77 @@ scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBa
     return INVALID_CORE_OP_HANDLE;
 }
 
+scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_earliest_deadline_model(SchedulerBase &scheduler,
+    const device_id_t &device_id, bool skip_active_core_ops, bool allow_moving_sticky_core_ops)
+{
+    auto earliest_core_op_handle = INVALID_CORE_OP_HANDLE;
+    auto earliest_deadline = std::chrono::time_point<std::chrono::steady_clock>::max();
+
+    // Iterating from the highest priority, so on equal deadlines the core op with the higher priority is chosen.
+    auto &priority_map = scheduler.get_core_op_priority_map();
+    for (auto iter = priority_map.rbegin(); iter != priority_map.rend(); ++iter) {
+        auto &priority_group = iter->second;
+        for (uint32_t i = 0; i < priority_group.size(); i++) {
+            const auto core_op_handle = priority_group.get(i);
+            const auto deadline = scheduler.get_core_op_deadline(core_op_handle);
+            if ((deadline >= earliest_deadline) || (skip_active_core_ops && is_core_op_active(scheduler, core_op_handle))) {
+                continue;
+            }
+
+            const bool DONT_CHECK_THRESHOLD = false;
+            if (is_core_op_ready(scheduler, core_op_handle, DONT_CHECK_THRESHOLD, device_id,
+                    allow_moving_sticky_core_ops).is_ready) {
+                earliest_core_op_handle = core_op_handle;
+                earliest_deadline = deadline;
+            }
+        }
+    }
+
+    return earliest_core_op_handle;
+}
+
+size_t CoreOpsSchedulerOracle::choose_fair_share_index(SchedulerBase &scheduler, const PriorityGroup &priority_group,
+    const device_id_t &device_id, bool check_threshold, bool allow_moving_sticky_core_ops,
+    SchedulerBase::ReadyInfo &ready_info)
+{
+    auto chosen_index = priority_group.size();
+    auto min_virtual_time = std::numeric_limits<double>::max();
+
+    for (size_t i = 0; i < priority_group.size(); i++) {
+        const auto core_op_handle = priority_group.get(i);
+        const auto virtual_time = scheduler.get_core_op_virtual_time(core_op_handle);
+        if (virtual_time >= min_virtual_time) {
+            continue;
+        }
+
+        const auto current_ready_info = is_core_op_ready(scheduler, core_op_handle, check_threshold, device_id,
+            allow_moving_sticky_core_ops);
+        if (current_ready_info.is_ready) {
+            chosen_index = i;
+            min_virtual_time = virtual_time;
+            ready_info = current_ready_info;
+        }
+    }
+
+    return chosen_index;
+}
+
 bool CoreOpsSchedulerOracle::should_stop_streaming(SchedulerBase &scheduler, core_op_priority_t core_op_priority, const device_id_t &device_id)
 {
     const auto device_info = scheduler.get_device_info(device_id);
+
+    if (HAILO_SCHEDULING_ALGORITHM_DEADLINE == scheduler.algorithm()) {
+        // A core op that is closer to missing its deadline preempts the current core op (even in the middle of a burst).
+        const bool SKIP_ACTIVE_CORE_OPS = true;
+        const bool DONT_MOVE_STICKY_CORE_OPS = false;
+        const auto core_op_handle = choose_earliest_deadline_model(scheduler, device_id, SKIP_ACTIVE_CORE_OPS,
+            DONT_MOVE_STICKY_CORE_OPS);
+        if ((INVALID_CORE_OP_HANDLE != core_op_handle) && (scheduler.get_core_op_deadline(core_op_handle) <
+                scheduler.get_core_op_deadline(device_info->current_core_op_handle))) {
+            return true;
+        }
+    }
+
     if (device_info->frames_left_before_stop_streaming > 0) {
         // Only when frames_left_before_stop_streaming we consider stop streaming
         return false;
@@ -57,7 +161,9 @@ bool CoreOpsSchedulerOracle::should_stop_streaming(SchedulerBase &scheduler, cor
         // Iterate all core ops inside the priority group starting from next_core_op_index
         for (uint32_t i = 0; i < priority_group.size(); i++) {
             auto core_op_handle = priority_group.get(i);
-            if (!is_core_op_active(scheduler, core_op_handle) && scheduler.is_core_op_ready(core_op_handle, true, device_id).is_ready) {
+            const bool DONT_MOVE_STICKY_CORE_OPS = false;
+            if (!is_core_op_active(scheduler, core_op_handle) &&
+                is_core_op_ready(scheduler, core_op_handle, true, device_id, DONT_MOVE_STICKY_CORE_OPS).is_ready) {
                 return true;
             }
         }
@@ -79,6 +185,31 @@ bool CoreOpsSchedulerOracle::is_core_op_active(SchedulerBase &scheduler, schedul
     return false;
 }
 
+bool CoreOpsSchedulerOracle::is_core_op_held_by_other_device(SchedulerBase &scheduler,
+    scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id)
+{
+    auto &devices = scheduler.get_device_infos();
+    for (const auto &pair : devices) {
+        if ((pair.first != device_id) && (core_op_handle == pair.second->current_core_op_handle)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+SchedulerBase::ReadyInfo CoreOpsSchedulerOracle::is_core_op_ready(SchedulerBase &scheduler,
+    scheduler_core_op_handle_t core_op_handle, bool check_threshold, const device_id_t &device_id,
+    bool allow_moving_sticky_core_ops)
+{
+    if (!allow_moving_sticky_core_ops && scheduler.is_core_op_sticky(core_op_handle) &&
+        is_core_op_held_by_other_device(scheduler, core_op_handle, device_id)) {
+        return SchedulerBase::ReadyInfo();
+    }
+
+    return scheduler.is_core_op_ready(core_op_handle, check_threshold, device_id);
+}
+
 std::vector<RunParams> CoreOpsSchedulerOracle::get_oracle_decisions(SchedulerBase &scheduler)
 {
     auto &devices = scheduler.get_device_infos();
@@ -86,6 +217,9 @@ std::vector<RunParams> CoreOpsSchedulerOracle::get_oracle_decisions(SchedulerBas
 
     for (const auto &pair : devices) {
         auto &active_device_info = pair.second;
+        if (active_device_info->is_asleep || active_device_info->is_draining) {
+            continue; // Nothing runs on the device until the idle power governor wakes it (or until it is removed)
+        }
 
         // Check if device is switching ng
         if (active_device_info->is_switching_core_op) {
@@ -95,12 +229,22 @@ std::vector<RunParams> CoreOpsSchedulerOracle::get_oracle_decisions(SchedulerBas
         // Check if device is idle
         if (!active_device_info->is_switching_core_op && active_device_info->is_idle()) {
             const bool CHECK_THRESHOLD = true;
-            auto core_op_handle = choose_next_model(scheduler, active_device_info->device_id, CHECK_THRESHOLD);
+            const bool ALLOW_MOVING_STICKY_CORE_OPS = true;
+            const bool is_idle_opt_enabled = !is_env_variable_on("HAILO_DISABLE_IDLE_OPT");
+            auto core_op_handle = choose_next_model(scheduler, active_device_info->device_id, CHECK_THRESHOLD,
+                !ALLOW_MOVING_STICKY_CORE_OPS);
 
             // If there is no suitable model when checking with threshold, and the idle optimization is disabled,
             // try again without threshold.
-            if (!is_env_variable_on("HAILO_DISABLE_IDLE_OPT") && (core_op_handle == INVALID_CORE_OP_HANDLE)) {
-                core_op_handle = choose_next_model(scheduler, active_device_info->device_id, !CHECK_THRESHOLD);
+            if (is_idle_opt_enabled && (core_op_handle == INVALID_CORE_OP_HANDLE)) {
+                core_op_handle = choose_next_model(scheduler, active_device_info->device_id, !CHECK_THRESHOLD,
+                    !ALLOW_MOVING_STICKY_CORE_OPS);
+            }
+
+            // Sticky core ops held by other devices are loaded on this device only if it has nothing else to run.
+            if (core_op_handle == INVALID_CORE_OP_HANDLE) {
+                core_op_handle = choose_next_model(scheduler, active_device_info->device_id, !is_idle_opt_enabled,
+                    ALLOW_MOVING_STICKY_CORE_OPS);
             }
 
             if (core_op_handle != INVALID_CORE_OP_HANDLE) {
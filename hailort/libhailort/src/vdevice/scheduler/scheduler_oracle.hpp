@@ -29,7 +29,8 @@ struct RunParams {
 class CoreOpsSchedulerOracle
 {
 public:
-    static scheduler_core_op_handle_t choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold);
+    static scheduler_core_op_handle_t choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold,
+        bool allow_moving_sticky_core_ops);
     static std::vector<RunParams> get_oracle_decisions(SchedulerBase &scheduler);
     static bool should_stop_streaming(SchedulerBase &scheduler, core_op_priority_t core_op_priority, const device_id_t &device_id);
 
@@ -37,6 +38,24 @@ private:
     CoreOpsSchedulerOracle() {}
     // TODO: Consider returning a vector of devices (we can use this function in other places)
     static bool is_core_op_active(SchedulerBase &scheduler, scheduler_core_op_handle_t core_op_handle);
+    static bool is_core_op_held_by_other_device(SchedulerBase &scheduler, scheduler_core_op_handle_t core_op_handle,
+        const device_id_t &device_id);
+
+    // Same as SchedulerBase::is_core_op_ready, but sticky core ops held by another device are not ready (unless
+    // allow_moving_sticky_core_ops is set).
+    static SchedulerBase::ReadyInfo is_core_op_ready(SchedulerBase &scheduler, scheduler_core_op_handle_t core_op_handle,
+        bool check_threshold, const device_id_t &device_id, bool allow_moving_sticky_core_ops);
+
+    // Returns the ready core op whose oldest pending request has the earliest deadline (INVALID_CORE_OP_HANDLE if no
+    // core op with a deadline is ready). The threshold is not checked, since waiting for it may miss the deadline.
+    static scheduler_core_op_handle_t choose_earliest_deadline_model(SchedulerBase &scheduler,
+        const device_id_t &device_id, bool skip_active_core_ops, bool allow_moving_sticky_core_ops);
+
+    // Returns the index (relative to the group's next core op) of the ready core op that consumed the least device
+    // time relative to its share (priority_group.size() if no core op in the group is ready).
+    static size_t choose_fair_share_index(SchedulerBase &scheduler, const PriorityGroup &priority_group,
+        const device_id_t &device_id, bool check_threshold, bool allow_moving_sticky_core_ops,
+        SchedulerBase::ReadyInfo &ready_info);
 };
 
 } /* namespace hailort */
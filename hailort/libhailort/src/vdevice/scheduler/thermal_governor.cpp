@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file thermal_governor.cpp
+ * @brief Keeps the devices of a scheduled vdevice within a thermal envelope, by moving the load off hot devices
+ **/
+
+#include "vdevice/scheduler/thermal_governor.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+
+namespace hailort
+{
+
+constexpr std::chrono::milliseconds ThermalGovernor::SAMPLING_INTERVAL;
+constexpr float32_t ThermalGovernor::HYSTERESIS;
+
+Expected<std::unique_ptr<ThermalGovernor>> ThermalGovernor::create_from_env(
+    std::vector<std::reference_wrapper<Device>> &&devices, CoreOpsSchedulerWeakPtr scheduler)
+{
+    auto envelope_env_var = get_env_variable(HAILO_SCHEDULER_THERMAL_ENVELOPE_ENV_VAR);
+    if (!envelope_env_var) {
+        return std::unique_ptr<ThermalGovernor>();
+    }
+
+    TRY(const auto thermal_envelope, StringUtils::to_uint32(envelope_env_var.value(), 10),
+        "Invalid {} value '{}', expected the temperature in Celsius", HAILO_SCHEDULER_THERMAL_ENVELOPE_ENV_VAR,
+        envelope_env_var.value());
+
+    auto governor = make_unique_nothrow<ThermalGovernor>(std::move(devices), scheduler,
+        static_cast<float32_t>(thermal_envelope));
+    CHECK_NOT_NULL_AS_EXPECTED(governor, HAILO_OUT_OF_HOST_MEMORY);
+    return governor;
+}
+
+ThermalGovernor::ThermalGovernor(std::vector<std::reference_wrapper<Device>> &&devices,
+    CoreOpsSchedulerWeakPtr scheduler, float32_t thermal_envelope) :
+    m_devices(std::move(devices)),
+    m_scheduler(scheduler),
+    m_thermal_envelope(thermal_envelope),
+    m_should_stop(false),
+    m_thread([this]() {
+        OsUtils::set_current_thread_name("THERMAL_GOV");
+        governor_thread_main();
+    })
+{}
+
+ThermalGovernor::~ThermalGovernor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_should_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void ThermalGovernor::governor_thread_main()
+{
+    std::vector<bool> is_throttled(m_devices.size(), false);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_cv.wait_for(lock, SAMPLING_INTERVAL, [this]() { return m_should_stop; })) {
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < m_devices.size(); i++) {
+            bool device_is_throttled = is_throttled[i];
+            update_device(m_devices[i].get(), device_is_throttled);
+            is_throttled[i] = device_is_throttled;
+        }
+    }
+}
+
+void ThermalGovernor::update_device(Device &device, bool &is_throttled)
+{
+    auto temperature_info = device.get_chip_temperature();
+    if (!temperature_info) {
+        LOGGER__WARNING("Thermal governor failed to read the temperature of device {}, status {}", device.get_dev_id(),
+            temperature_info.status());
+        return;
+    }
+    const auto temperature = std::max(temperature_info->ts0_temperature, temperature_info->ts1_temperature);
+
+    const bool should_throttle = is_throttled ? (temperature > (m_thermal_envelope - HYSTERESIS)) :
+        (temperature > m_thermal_envelope);
+    if (should_throttle == is_throttled) {
+        return;
+    }
+    is_throttled = should_throttle;
+
+    if (is_throttled) {
+        LOGGER__INFO("Device {} reached {:.1f}C (envelope {:.1f}C), moving its load to cooler devices",
+            device.get_dev_id(), temperature, m_thermal_envelope);
+    } else {
+        LOGGER__INFO("Device {} cooled down to {:.1f}C, scheduling it again", device.get_dev_id(), temperature);
+    }
+
+    auto scheduler = m_scheduler.lock();
+    if (nullptr != scheduler) {
+        scheduler->set_device_thermally_throttled(device.get_dev_id(), is_throttled);
+    }
+}
+
+} /* namespace hailort */
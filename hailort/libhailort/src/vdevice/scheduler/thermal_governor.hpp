@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file thermal_governor.hpp
+ * @brief Keeps the devices of a scheduled vdevice within a thermal envelope, by moving the load off hot devices
+ **/
+
+#ifndef _HAILO_THERMAL_GOVERNOR_HPP_
+#define _HAILO_THERMAL_GOVERNOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/device.hpp"
+
+#include "vdevice/scheduler/scheduler.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+// The temperature (in Celsius) the devices are kept under. If set (and the vdevice is scheduled), the scheduler moves
+// the load off devices that get hotter than the envelope, to devices that are still under it - so the firmware doesn't
+// throttle the hot device's clock (which makes its FPS collapse).
+#define HAILO_SCHEDULER_THERMAL_ENVELOPE_ENV_VAR ("HAILO_SCHEDULER_THERMAL_ENVELOPE")
+
+class ThermalGovernor final {
+public:
+    // Returns nullptr if the thermal envelope isn't set
+    static Expected<std::unique_ptr<ThermalGovernor>> create_from_env(std::vector<std::reference_wrapper<Device>> &&devices,
+        CoreOpsSchedulerWeakPtr scheduler);
+
+    ThermalGovernor(std::vector<std::reference_wrapper<Device>> &&devices, CoreOpsSchedulerWeakPtr scheduler,
+        float32_t thermal_envelope);
+    ~ThermalGovernor();
+
+    ThermalGovernor(const ThermalGovernor &) = delete;
+    ThermalGovernor &operator=(const ThermalGovernor &) = delete;
+
+    static constexpr std::chrono::milliseconds SAMPLING_INTERVAL = std::chrono::milliseconds(1000);
+    // A throttled device gets load again only when it's this much under the envelope, so the devices don't flip
+    // between the states on every sample
+    static constexpr float32_t HYSTERESIS = 3.0f;
+
+private:
+    void governor_thread_main();
+    void update_device(Device &device, bool &is_throttled);
+
+    std::vector<std::reference_wrapper<Device>> m_devices;
+    CoreOpsSchedulerWeakPtr m_scheduler;
+    const float32_t m_thermal_envelope;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_should_stop;
+    std::thread m_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_THERMAL_GOVERNOR_HPP_ */
@@ -24,6 +24,8 @@
 #include "utils/shared_resource_manager.hpp"
 #include "network_group/network_group_internal.hpp"
 #include "net_flow/pipeline/infer_model_internal.hpp"
+#include "net_flow/pipeline/async_pipeline_executor.hpp"
+#include "utils/host_memory_accountant.hpp"
 #include "core_op/core_op.hpp"
 #include "hef/hef_internal.hpp"
 
@@ -121,6 +123,50 @@ hailo_status VDevice::after_fork_in_child()
     return HAILO_SUCCESS;
 }
 
+hailo_status VDevice::add_device(const std::string &device_id)
+{
+    LOGGER__ERROR("Adding device {} failed, adding devices is not supported on this vdevice", device_id);
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status VDevice::remove_device(const std::string &device_id, std::chrono::milliseconds /*timeout*/)
+{
+    LOGGER__ERROR("Removing device {} failed, removing devices is not supported on this vdevice", device_id);
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<std::shared_ptr<AsyncPipelineExecutor>> VDevice::get_async_pipeline_executor()
+{
+    std::lock_guard<std::mutex> lock(m_async_pipeline_executor_mutex);
+    if (!m_is_async_pipeline_executor_created) {
+        TRY(m_async_pipeline_executor, AsyncPipelineExecutor::create_shared());
+        m_is_async_pipeline_executor_created = true;
+    }
+    return std::shared_ptr<AsyncPipelineExecutor>(m_async_pipeline_executor);
+}
+
+Expected<std::shared_ptr<HostMemoryAccountant>> VDevice::get_host_memory_accountant()
+{
+    std::lock_guard<std::mutex> lock(m_host_memory_accountant_mutex);
+    if (nullptr == m_host_memory_accountant) {
+        TRY(m_host_memory_accountant, HostMemoryAccountant::create());
+    }
+    return std::shared_ptr<HostMemoryAccountant>(m_host_memory_accountant);
+}
+
+hailo_status VDevice::set_host_memory_budget(size_t budget)
+{
+    TRY(auto accountant, get_host_memory_accountant());
+    accountant->set_budget(budget);
+    return HAILO_SUCCESS;
+}
+
+Expected<std::vector<HostMemoryUsage>> VDevice::get_host_memory_usage()
+{
+    TRY(auto accountant, get_host_memory_accountant());
+    return accountant->get_usage();
+}
+
 VDeviceHandle::VDeviceHandle(uint32_t handle) : m_handle(handle)
 {}
 
@@ -179,6 +225,24 @@ Expected<std::vector<std::string>> VDeviceHandle::get_physical_devices_ids() con
     return vdevice.value()->get_physical_devices_ids();
 }
 
+hailo_status VDeviceHandle::add_device(const std::string &device_id)
+{
+    auto &manager = SharedResourceManager<std::string, VDeviceBase>::get_instance();
+    auto vdevice = manager.resource_lookup(m_handle);
+    CHECK_EXPECTED_AS_STATUS(vdevice);
+
+    return vdevice.value()->add_device(device_id);
+}
+
+hailo_status VDeviceHandle::remove_device(const std::string &device_id, std::chrono::milliseconds timeout)
+{
+    auto &manager = SharedResourceManager<std::string, VDeviceBase>::get_instance();
+    auto vdevice = manager.resource_lookup(m_handle);
+    CHECK_EXPECTED_AS_STATUS(vdevice);
+
+    return vdevice.value()->remove_device(device_id, timeout);
+}
+
 Expected<hailo_stream_interface_t> VDeviceHandle::get_default_streams_interface() const
 {
     auto &manager = SharedResourceManager<std::string, VDeviceBase>::get_instance();
@@ -414,32 +478,50 @@ hailo_status VDeviceClient::listener_run_in_thread(VDeviceIdentifier identifier)
     auto client = make_unique_nothrow<HailoRtRpcClient>(channel);
     CHECK_NOT_NULL(client, HAILO_OUT_OF_HOST_MEMORY);
 
-    while (m_is_listener_thread_running) {
-        auto callback_id = client->VDevice_get_callback_id(identifier);
-        if (HAILO_SUCCESS != callback_id.status()) {
+    hailo_status callbacks_status = HAILO_SUCCESS;
+    auto handle_callback = [this, &callbacks_status] (const ProtoCallbackIdentifier &callback_id) -> hailo_status {
+        std::shared_ptr<ConfiguredNetworkGroupClient> ng_ptr;
+        {
             std::unique_lock<std::mutex> lock(m_mutex);
-            for (auto &ng_ptr_pair : m_network_groups) {
-                ng_ptr_pair.second->execute_callbacks_on_error(callback_id.status());
+            assert(contains(m_network_groups, callback_id.network_group_handle()));
+            ng_ptr = m_network_groups.at(callback_id.network_group_handle());
+        }
+        callbacks_status = ng_ptr->execute_callback(callback_id);
+        return callbacks_status;
+    };
+
+    // The ready callbacks are received in batches - streamed by the service, or polled if the stream is disabled
+    hailo_status status = HAILO_SUCCESS;
+    if (!is_env_variable_on(HAILO_SERVICE_DISABLE_CALLBACKS_STREAM_ENV_VAR)) {
+        status = client->VDevice_get_callback_ids_stream(identifier, MAX_CALLBACKS_PER_LISTENER_REPLY, handle_callback);
+    } else {
+        while (m_is_listener_thread_running && (HAILO_SUCCESS == callbacks_status)) {
+            auto callback_ids = client->VDevice_get_callback_ids(identifier, MAX_CALLBACKS_PER_LISTENER_REPLY);
+            if (!callback_ids) {
+                status = callback_ids.status();
+                break;
             }
-            if (callback_id.status() == HAILO_SHUTDOWN_EVENT_SIGNALED) {
-                LOGGER__INFO("Shutdown event was signaled in listener_run_in_thread");
-            } else if (callback_id.status() == HAILO_RPC_FAILED) {
-                LOGGER__ERROR("Lost communication with the service..");
-            } else {
-                LOGGER__ERROR("Failed to get callback_id from listener thread with {}", callback_id.status());
+            for (const auto &callback_id : callback_ids.value()) {
+                if (HAILO_SUCCESS != handle_callback(callback_id)) {
+                    break;
+                }
             }
-            break;
         }
-        CHECK_EXPECTED_AS_STATUS(callback_id);
+    }
+    CHECK_SUCCESS(callbacks_status);
 
-        std::shared_ptr<ConfiguredNetworkGroupClient> ng_ptr;
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            assert(contains(m_network_groups, callback_id->network_group_handle()));
-            ng_ptr = m_network_groups.at(callback_id->network_group_handle());
+    if (HAILO_SUCCESS != status) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto &ng_ptr_pair : m_network_groups) {
+            ng_ptr_pair.second->execute_callbacks_on_error(status);
+        }
+        if (status == HAILO_SHUTDOWN_EVENT_SIGNALED) {
+            LOGGER__INFO("Shutdown event was signaled in listener_run_in_thread");
+        } else if (status == HAILO_RPC_FAILED) {
+            LOGGER__ERROR("Lost communication with the service..");
+        } else {
+            LOGGER__ERROR("Failed to get callback_id from listener thread with {}", status);
         }
-        auto status = ng_ptr->execute_callback(callback_id.value());
-        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
@@ -617,6 +699,25 @@ hailo_status VDeviceBase::validate_params(const hailo_vdevice_params_t &params)
         "VDevice over ETH is supported for 1 device. Passed device_count: {}", params.device_count);
     CHECK(!(device_ids_contains_eth && (HAILO_SCHEDULING_ALGORITHM_NONE != params.scheduling_algorithm)), HAILO_INVALID_ARGUMENT,
         "VDevice over ETH is not supported when scheduler is enabled.");
+    CHECK((HAILO_INTERRUPTS_WAIT_MODE_BLOCKING == params.interrupts_wait_mode) ||
+        (HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING == params.interrupts_wait_mode), HAILO_INVALID_ARGUMENT,
+        "VDevice creation failed. invalid interrupts_wait_mode ({}).", static_cast<int>(params.interrupts_wait_mode));
+    CHECK(0 != params.transfer_launcher_workers_count, HAILO_INVALID_ARGUMENT,
+        "VDevice creation failed. invalid transfer_launcher_workers_count ({}).", params.transfer_launcher_workers_count);
+    CHECK((HAILO_NUMA_NODE_AUTO == params.numa_node) || (HAILO_NUMA_NODE_NONE == params.numa_node) ||
+        (params.numa_node >= 0), HAILO_INVALID_ARGUMENT,
+        "VDevice creation failed. invalid numa_node ({}).", params.numa_node);
+    CHECK(params.threads_realtime_priority <= HAILO_MAX_THREADS_REALTIME_PRIORITY, HAILO_INVALID_ARGUMENT,
+        "VDevice creation failed. invalid threads_realtime_priority ({}).", params.threads_realtime_priority);
+    CHECK(!(params.multi_device_pipelining && (HAILO_SCHEDULING_ALGORITHM_NONE == params.scheduling_algorithm)),
+        HAILO_INVALID_ARGUMENT, "VDevice creation failed. multi_device_pipelining requires the scheduler to be enabled.");
+    CHECK(!(params.allow_devices_hot_plug && (HAILO_SCHEDULING_ALGORITHM_NONE == params.scheduling_algorithm)),
+        HAILO_INVALID_ARGUMENT, "VDevice creation failed. allow_devices_hot_plug requires the scheduler to be enabled.");
+    // The network groups are placed by the order of the devices, which added devices don't keep
+    CHECK(!(params.allow_devices_hot_plug && params.multi_device_pipelining), HAILO_INVALID_ARGUMENT,
+        "VDevice creation failed. allow_devices_hot_plug is not supported with multi_device_pipelining.");
+    CHECK(!(params.allow_devices_hot_plug && params.multi_process_service), HAILO_NOT_SUPPORTED,
+        "VDevice creation failed. allow_devices_hot_plug is not supported with multi_process_service.");
 
     return HAILO_SUCCESS;
 }
@@ -638,8 +739,20 @@ Expected<std::unique_ptr<VDeviceBase>> VDeviceBase::create(const hailo_vdevice_p
     device_archs.reserve(params.device_count);
 
     std::string vdevice_ids = "VDevice Infos:";
+    // The scheduler thread serves all devices, so it is placed on a numa node only if all devices are on that node.
+    int scheduler_numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE;
+    bool is_first_device = true;
     for (const auto &pair : devices) {
         auto &device = pair.second;
+        int device_numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE;
+        if ((Device::Type::INTEGRATED == device->get_type()) || (Device::Type::PCIE == device->get_type())) {
+            device_numa_node = dynamic_cast<VdmaDevice&>(*device).get_driver().numa_node();
+        }
+        if (!is_first_device && (scheduler_numa_node != device_numa_node)) {
+            device_numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE;
+        }
+        scheduler_numa_node = device_numa_node;
+        is_first_device = false;
         auto id_info_str = device->get_dev_id();
         device_ids.emplace_back(id_info_str);
         auto device_arch = device->get_architecture();
@@ -654,23 +767,60 @@ Expected<std::unique_ptr<VDeviceBase>> VDeviceBase::create(const hailo_vdevice_p
     CoreOpsSchedulerPtr scheduler_ptr;
     if (HAILO_SCHEDULING_ALGORITHM_NONE != params.scheduling_algorithm) {
         if (HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN == params.scheduling_algorithm) {
-            auto core_ops_scheduler = CoreOpsScheduler::create_round_robin(device_ids, device_archs);
+            auto core_ops_scheduler = CoreOpsScheduler::create_round_robin(device_ids, device_archs,
+                scheduler_numa_node, params.scheduler_cpu_affinity_mask, params.threads_realtime_priority);
             CHECK_EXPECTED(core_ops_scheduler);
             scheduler_ptr = core_ops_scheduler.release();
+        } else if (HAILO_SCHEDULING_ALGORITHM_DEADLINE == params.scheduling_algorithm) {
+            TRY(scheduler_ptr, CoreOpsScheduler::create_deadline(device_ids, device_archs, scheduler_numa_node,
+                params.scheduler_cpu_affinity_mask, params.threads_realtime_priority));
+        } else if (HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == params.scheduling_algorithm) {
+            TRY(scheduler_ptr, CoreOpsScheduler::create_fair_share(device_ids, device_archs, scheduler_numa_node,
+                params.scheduler_cpu_affinity_mask, params.threads_realtime_priority));
         } else {
             LOGGER__ERROR("Unsupported scheduling algorithm");
             return make_unexpected(HAILO_INVALID_ARGUMENT);
         }
     }
 
-    auto vdevice = std::unique_ptr<VDeviceBase>(new (std::nothrow) VDeviceBase(std::move(devices), scheduler_ptr, unique_vdevice_hash));
+    auto vdevice = std::unique_ptr<VDeviceBase>(new (std::nothrow) VDeviceBase(std::move(devices), scheduler_ptr,
+        params, unique_vdevice_hash));
     CHECK_AS_EXPECTED(nullptr != vdevice, HAILO_OUT_OF_HOST_MEMORY);
 
+    auto status = vdevice->start_governors();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
     return vdevice;
 }
 
+hailo_status VDeviceBase::start_governors()
+{
+    if (nullptr == m_core_ops_scheduler) {
+        return HAILO_SUCCESS;
+    }
+
+    std::vector<std::reference_wrapper<Device>> governed_devices;
+    for (auto &pair : m_devices) {
+        governed_devices.emplace_back(*pair.second);
+    }
+    std::vector<std::reference_wrapper<Device>> power_governed_devices = governed_devices;
+    TRY(m_thermal_governor, ThermalGovernor::create_from_env(std::move(governed_devices), m_core_ops_scheduler));
+    TRY(m_idle_power_governor, IdlePowerGovernor::create_from_env(std::move(power_governed_devices),
+        m_core_ops_scheduler));
+    return HAILO_SUCCESS;
+}
+
+void VDeviceBase::stop_governors()
+{
+    // The idle power governor wakes the devices it put to sleep
+    m_idle_power_governor.reset();
+    m_thermal_governor.reset();
+}
+
 VDeviceBase::~VDeviceBase()
 {
+    // Stopped first, as they access the devices
+    stop_governors();
     if (m_core_ops_scheduler) {
         // The scheduler is held as weak/shared ptr, so it may not be freed by this destructor implicitly.
         // The scheduler will be freed when the last reference is freed. If it will be freed inside some interrupt
@@ -711,6 +861,9 @@ Expected<ConfiguredNetworkGroupVector> VDeviceBase::configure(Hef &hef,
         }
         std::shared_ptr<VDeviceCoreOp> vdevice_core_op = nullptr;
         if (identical_core_op) {
+            // The instances are scheduled as one core op - their infer requests are queued together, and batched together
+            LOGGER__INFO("Network group {} is already configured with the same params, sharing its core op",
+                network_params_pair.first);
             auto vdevice_core_op_exp = VDeviceCoreOp::duplicate(identical_core_op, network_params_pair.second);
             CHECK_EXPECTED(vdevice_core_op_exp);
             vdevice_core_op = vdevice_core_op_exp.release();
@@ -719,6 +872,11 @@ Expected<ConfiguredNetworkGroupVector> VDeviceBase::configure(Hef &hef,
             CHECK_EXPECTED(vdevice_core_op_exp);
             vdevice_core_op = vdevice_core_op_exp.release();
             m_vdevice_core_ops.emplace_back(vdevice_core_op);
+
+            if (m_hot_plug_params.allow_devices_hot_plug && !contains(m_hot_plug_hefs, hef.hash())) {
+                TRY(auto shared_hef, hef.pimpl->share());
+                m_hot_plug_hefs.emplace(hef.hash(), std::move(shared_hef));
+            }
         }
 
         if (m_core_ops_scheduler) {
@@ -747,12 +905,155 @@ Expected<ConfiguredNetworkGroupVector> VDeviceBase::configure(Hef &hef,
         m_network_groups.push_back(network_group_ptr);
     }
 
+    if (m_multi_device_pipelining) {
+        auto status = place_network_groups_on_consecutive_devices(added_network_groups);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
     auto elapsed_time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
     LOGGER__INFO("Configuring HEF on VDevice took {} milliseconds", elapsed_time_ms);
 
     return added_network_groups;
 }
 
+hailo_status VDeviceBase::place_network_groups_on_consecutive_devices(const ConfiguredNetworkGroupVector &network_groups)
+{
+    assert(m_core_ops_scheduler);
+    // The device affinity mask refers to the devices by their order in m_devices
+    const auto devices_count = m_devices.size();
+    CHECK(devices_count <= (sizeof(uint64_t) * CHAR_BIT), HAILO_NOT_SUPPORTED,
+        "multi_device_pipelining supports up to {} devices", sizeof(uint64_t) * CHAR_BIT);
+
+    for (auto &network_group : network_groups) {
+        const auto device_index = m_next_pipeline_device_index;
+        m_next_pipeline_device_index = (m_next_pipeline_device_index + 1) % devices_count;
+
+        auto status = network_group->set_scheduler_device_affinity(static_cast<uint64_t>(1) << device_index);
+        CHECK_SUCCESS(status);
+        status = network_group->set_scheduler_sticky_placement(true);
+        CHECK_SUCCESS(status);
+        LOGGER__INFO("Network group {} is placed on device {}", network_group->name(),
+            std::next(m_devices.begin(), device_index)->first);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+std::vector<std::shared_ptr<VDeviceCoreOp>> VDeviceBase::get_all_vdevice_core_ops() const
+{
+    std::vector<std::shared_ptr<VDeviceCoreOp>> vdevice_core_ops;
+    for (const auto &network_group : m_network_groups) {
+        auto network_group_base = std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(network_group);
+        assert(nullptr != network_group_base);
+        for (const auto &core_op : network_group_base->get_core_ops()) {
+            auto vdevice_core_op = std::dynamic_pointer_cast<VDeviceCoreOp>(core_op);
+            assert(nullptr != vdevice_core_op);
+            vdevice_core_ops.emplace_back(vdevice_core_op);
+        }
+    }
+    return vdevice_core_ops;
+}
+
+hailo_status VDeviceBase::add_device(const std::string &device_id)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(m_hot_plug_params.allow_devices_hot_plug, HAILO_INVALID_OPERATION,
+        "Adding device {} failed, the vdevice wasn't created with allow_devices_hot_plug", device_id);
+    assert(nullptr != m_core_ops_scheduler);
+
+    auto params = m_hot_plug_params;
+    params.device_count = static_cast<uint32_t>(m_devices.size() + 1);
+    TRY(auto device, create_device(device_id, params), "Failed creating added device {}", device_id);
+    const device_id_t added_device_id = device->get_dev_id();
+    CHECK(!contains(m_devices, added_device_id), HAILO_INVALID_OPERATION, "Device {} is already part of the vdevice",
+        added_device_id);
+
+    // The vdevice is homogeneous - the core ops are configured on all of its devices by the same params
+    CHECK((Device::Type::INTEGRATED == device->get_type()) || (Device::Type::PCIE == device->get_type()),
+        HAILO_NOT_SUPPORTED, "Adding device {} failed, only PCIe and integrated devices can be added", added_device_id);
+    TRY(const auto device_arch, device->get_architecture());
+    TRY(const auto vdevice_arch, m_devices.begin()->second->get_architecture());
+    CHECK(device_arch == vdevice_arch, HAILO_INVALID_OPERATION,
+        "Adding device {} failed, its architecture {} differs from the vdevice's architecture {}", added_device_id,
+        HailoRTCommon::get_device_arch_str(device_arch), HailoRTCommon::get_device_arch_str(vdevice_arch));
+
+    // Each physical core op is configured once on the device (the instances of a core op share its physical core ops).
+    // The configuration takes a while, but the other devices keep running meanwhile.
+    std::map<vdevice_core_op_handle_t, std::shared_ptr<CoreOp>> added_core_ops;
+    for (const auto &vdevice_core_op : m_vdevice_core_ops) {
+        auto hef = m_hot_plug_hefs.find(vdevice_core_op->hef_hash());
+        CHECK(m_hot_plug_hefs.end() != hef, HAILO_INTERNAL_FAILURE, "The HEF of core op {} wasn't kept",
+            vdevice_core_op->name());
+        auto status = dynamic_cast<DeviceBase&>(*device).check_hef_is_compatible(hef->second);
+        CHECK_SUCCESS(status);
+
+        TRY(auto core_op, create_physical_core_op(*device, hef->second, vdevice_core_op->name(),
+            vdevice_core_op->get_config_params()), "Failed configuring {} on added device {}", vdevice_core_op->name(),
+            added_device_id);
+        status = VDeviceCoreOp::prepare_physical_core_op(*core_op, vdevice_core_op->core_op_handle());
+        CHECK_SUCCESS(status);
+        added_core_ops.emplace(vdevice_core_op->core_op_handle(), std::move(core_op));
+    }
+
+    const auto vdevice_core_ops = get_all_vdevice_core_ops();
+    stop_governors();
+    const auto device_arch_str = HailoRTCommon::get_device_arch_str(device_arch);
+    auto status = m_core_ops_scheduler->add_device(added_device_id, device_arch_str,
+        [&vdevice_core_ops, &added_core_ops, &added_device_id]() {
+            for (const auto &vdevice_core_op : vdevice_core_ops) {
+                vdevice_core_op->add_physical_core_op(added_device_id,
+                    added_core_ops.at(vdevice_core_op->core_op_handle()));
+            }
+        });
+    if (HAILO_SUCCESS == status) {
+        TRACE(AddDeviceTrace, added_device_id, device_arch_str);
+        m_devices.emplace(added_device_id, std::move(device));
+        LOGGER__INFO("Added device {} to the vdevice, configured {} core ops on it", added_device_id,
+            added_core_ops.size());
+    }
+
+    auto governors_status = start_governors();
+    CHECK_SUCCESS(status);
+    CHECK_SUCCESS(governors_status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceBase::remove_device(const std::string &device_id, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(m_hot_plug_params.allow_devices_hot_plug, HAILO_INVALID_OPERATION,
+        "Removing device {} failed, the vdevice wasn't created with allow_devices_hot_plug", device_id);
+    assert(nullptr != m_core_ops_scheduler);
+
+    auto device_it = std::find_if(m_devices.begin(), m_devices.end(),
+        [&device_id](const std::pair<const device_id_t, std::unique_ptr<Device>> &pair) {
+            return (device_id == pair.first) || (device_id == pair.second->get_dev_id());
+        });
+    CHECK(m_devices.end() != device_it, HAILO_NOT_FOUND, "Device {} is not part of the vdevice", device_id);
+    CHECK(m_devices.size() > 1, HAILO_INVALID_OPERATION, "Can't remove device {}, the last device of the vdevice",
+        device_id);
+    const device_id_t removed_device_id = device_it->first;
+
+    const auto vdevice_core_ops = get_all_vdevice_core_ops();
+    stop_governors();
+    auto status = m_core_ops_scheduler->remove_device(removed_device_id, timeout,
+        [&vdevice_core_ops, &removed_device_id]() {
+            for (const auto &vdevice_core_op : vdevice_core_ops) {
+                vdevice_core_op->remove_physical_core_op(removed_device_id);
+            }
+        });
+    if (HAILO_SUCCESS == status) {
+        // Releases the device, with the core ops configured on it
+        m_devices.erase(device_it);
+        LOGGER__INFO("Removed device {} from the vdevice", removed_device_id);
+    }
+
+    auto governors_status = start_governors();
+    CHECK_SUCCESS(status);
+    CHECK_SUCCESS(governors_status);
+    return HAILO_SUCCESS;
+}
+
 Expected<std::shared_ptr<InferModel>> VDevice::create_infer_model(const std::string &hef_path, const std::string &network_name)
 {
     CHECK_AS_EXPECTED(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Passing network name is not supported yet!");
@@ -781,6 +1082,80 @@ Expected<hailo_stream_interface_t> VDeviceBase::get_default_streams_interface()
     return stream_interface.release();
 }
 
+// Runs func(i) for each i in [0, count) on its own thread, so per-device work (mostly control round trips) takes as
+// long as the slowest device instead of the sum of all devices. Returns the status of each call.
+template<typename Func>
+static std::vector<hailo_status> run_per_device_in_parallel(const std::string &thread_name, size_t count, Func func)
+{
+    std::vector<hailo_status> statuses(count, HAILO_UNINITIALIZED);
+    if (1 == count) {
+        statuses[0] = func(0);
+        return statuses;
+    }
+
+    std::vector<AsyncThreadPtr<hailo_status>> threads(count);
+    for (size_t i = 0; i < count; i++) {
+        threads[i] = make_unique_nothrow<AsyncThread<hailo_status>>(thread_name, [&func, i]() { return func(i); });
+        if (nullptr == threads[i]) {
+            // Failing to allocate a thread isn't a reason to fail, the call just runs on the current thread
+            statuses[i] = func(i);
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (nullptr != threads[i]) {
+            statuses[i] = threads[i]->get();
+        }
+    }
+    return statuses;
+}
+
+Expected<std::unique_ptr<Device>> VDeviceBase::create_device(const std::string &device_id,
+    const hailo_vdevice_params_t &params)
+{
+    TRY(auto device, Device::create(device_id));
+
+    // Validate That if (device_count != 1), device arch is not H8L. May be changed in SDK-28729
+    if (1 != params.device_count) {
+        TRY(const auto device_arch, device->get_architecture());
+        CHECK_AS_EXPECTED(HAILO_ARCH_HAILO8L != device_arch, HAILO_INVALID_OPERATION,
+            "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO8L. device {} is HAILO_ARCH_HAILO8L", device_id);
+        CHECK_AS_EXPECTED(HAILO_ARCH_HAILO15M != device_arch, HAILO_INVALID_OPERATION,
+            "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO15M. device {} is HAILO_ARCH_HAILO15M", device_id);
+        CHECK_AS_EXPECTED(HAILO_ARCH_HAILO10H != device_arch, HAILO_INVALID_OPERATION,
+            "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO10H. device {} is HAILO_ARCH_HAILO10H", device_id);
+    }
+
+    TRY(const auto dev_type, Device::get_device_type(device_id));
+    if ((Device::Type::INTEGRATED == dev_type) || (Device::Type::PCIE == dev_type)) {
+        auto &vdma_device = dynamic_cast<VdmaDevice&>(*device);
+        auto status = vdma_device.mark_as_used();
+        if (HAILO_DEVICE_IN_USE == status) {
+            // Not logged as an error, the caller may skip the device
+            return make_unexpected(status);
+        }
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        status = vdma_device.set_interrupts_wait_mode(params.interrupts_wait_mode,
+            std::chrono::microseconds(params.interrupts_polling_idle_budget_us));
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        status = vdma_device.set_mapped_buffers_cache_size(static_cast<size_t>(params.user_buffers_mapping_cache_size));
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        status = vdma_device.set_transfer_launcher_params(params.transfer_launcher_workers_count,
+            params.transfer_launcher_cpu_affinity_mask);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        status = vdma_device.set_numa_node(params.numa_node);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        status = vdma_device.set_threads_params(params.interrupts_cpu_affinity_mask, params.threads_realtime_priority);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    return device;
+}
+
 Expected<std::map<device_id_t, std::unique_ptr<Device>>> VDeviceBase::create_devices(const hailo_vdevice_params_t &params)
 {
     std::map<device_id_t, std::unique_ptr<Device>> devices;
@@ -790,36 +1165,34 @@ Expected<std::map<device_id_t, std::unique_ptr<Device>>> VDeviceBase::create_dev
     auto device_ids = get_device_ids(params);
     CHECK_EXPECTED(device_ids);
 
-    for (const auto &device_id : device_ids.value()) {
-        if (devices.size() == params.device_count) {
-            break;
-        }
-        auto device = Device::create(device_id);
-        CHECK_EXPECTED(device);
-
-        // Validate That if (device_count != 1), device arch is not H8L. May be changed in SDK-28729
-        if (1 != params.device_count) {
-            auto device_arch = device.value()->get_architecture();
-            CHECK_EXPECTED(device_arch);
-            CHECK_AS_EXPECTED(HAILO_ARCH_HAILO8L != device_arch.value(), HAILO_INVALID_OPERATION,
-                "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO8L. device {} is HAILO_ARCH_HAILO8L", device_id);
-            CHECK_AS_EXPECTED(HAILO_ARCH_HAILO15M != device_arch.value(), HAILO_INVALID_OPERATION,
-                "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO15M. device {} is HAILO_ARCH_HAILO15M", device_id);
-            CHECK_AS_EXPECTED(HAILO_ARCH_HAILO10H != device_arch.value(), HAILO_INVALID_OPERATION,
-                "VDevice with multiple devices is not supported on HAILO_ARCH_HAILO10H. device {} is HAILO_ARCH_HAILO10H", device_id);
-        }
+    // The devices are created in parallel, as many as still missing on each round. Devices that are in use are
+    // skipped (only if the user didn't ask for specific devices), and the next ones are tried on the next round.
+    size_t next_device_index = 0;
+    while ((devices.size() < params.device_count) && (next_device_index < device_ids->size())) {
+        const auto round_size = std::min(static_cast<size_t>(params.device_count) - devices.size(),
+            device_ids->size() - next_device_index);
+
+        std::vector<std::unique_ptr<Device>> round_devices(round_size);
+        const auto statuses = run_per_device_in_parallel("VDEV_OPEN", round_size,
+            [&](size_t i) -> hailo_status {
+                auto device = create_device(device_ids.value()[next_device_index + i], params);
+                if (!device) {
+                    return device.status();
+                }
+                round_devices[i] = device.release();
+                return HAILO_SUCCESS;
+            });
 
-        auto dev_type = Device::get_device_type(device_id);
-        CHECK_EXPECTED(dev_type);
-        if ((Device::Type::INTEGRATED == dev_type.value()) || (Device::Type::PCIE == dev_type.value())) {
-            auto status = dynamic_cast<VdmaDevice&>(*device.value()).mark_as_used();
-            if (!user_specific_devices && (HAILO_DEVICE_IN_USE == status)) {
+        for (size_t i = 0; i < round_size; i++) {
+            const auto &device_id = device_ids.value()[next_device_index + i];
+            if (!user_specific_devices && (HAILO_DEVICE_IN_USE == statuses[i])) {
                 // Continue only if the user didn't ask for specific devices
                 continue;
             }
-            CHECK_SUCCESS_AS_EXPECTED(status);
+            CHECK_SUCCESS_AS_EXPECTED(statuses[i], "Failed creating device {}", device_id);
+            devices[device_id] = std::move(round_devices[i]);
         }
-        devices[device_id] = device.release();
+        next_device_index += round_size;
     }
     CHECK_AS_EXPECTED(params.device_count == devices.size(), HAILO_OUT_OF_PHYSICAL_DEVICES,
         "Failed to create vdevice. there are not enough free devices. requested: {}, found: {}",
@@ -848,9 +1221,14 @@ Expected<std::vector<std::string>> VDeviceBase::get_device_ids(const hailo_vdevi
 
 Expected<NetworkGroupsParamsMap> VDeviceBase::create_local_config_params(Hef &hef, const NetworkGroupsParamsMap &configure_params)
 {
+    std::vector<std::reference_wrapper<Device>> devices;
     for (const auto &pair : m_devices) {
-        auto &device = pair.second;
-        auto status = dynamic_cast<DeviceBase&>(*device).check_hef_is_compatible(hef);
+        devices.emplace_back(*pair.second);
+    }
+    const auto statuses = run_per_device_in_parallel("VDEV_HEF_CHECK", devices.size(), [&devices, &hef](size_t i) {
+        return dynamic_cast<DeviceBase&>(devices[i].get()).check_hef_is_compatible(hef);
+    });
+    for (const auto status : statuses) {
         CHECK_SUCCESS_AS_EXPECTED(status);
     }
 
@@ -922,12 +1300,26 @@ Expected<std::shared_ptr<CoreOp>> VDeviceBase::create_physical_core_op(Device &d
 Expected<std::shared_ptr<VDeviceCoreOp>> VDeviceBase::create_vdevice_core_op(Hef &hef,
     const std::pair<const std::string, ConfigureNetworkParams> &params)
 {
-    std::map<device_id_t, std::shared_ptr<CoreOp>> physical_core_ops;
+    std::vector<std::pair<device_id_t, std::reference_wrapper<Device>>> devices;
+    for (const auto &pair : m_devices) {
+        devices.emplace_back(pair.first, *pair.second);
+    }
 
-	for (const auto &device : m_devices) {
-        auto physical_core_op = create_physical_core_op(*device.second, hef, params.first, params.second);
-        CHECK_EXPECTED(physical_core_op);
-        physical_core_ops.emplace(device.first, physical_core_op.release());
+    // Each device is configured on its own thread (the devices don't share any state the configuration changes)
+    std::vector<std::shared_ptr<CoreOp>> devices_core_ops(devices.size());
+    const auto statuses = run_per_device_in_parallel("VDEV_CONFIGURE", devices.size(), [&](size_t i) -> hailo_status {
+        auto physical_core_op = create_physical_core_op(devices[i].second.get(), hef, params.first, params.second);
+        if (!physical_core_op) {
+            return physical_core_op.status();
+        }
+        devices_core_ops[i] = physical_core_op.release();
+        return HAILO_SUCCESS;
+    });
+
+    std::map<device_id_t, std::shared_ptr<CoreOp>> physical_core_ops;
+    for (size_t i = 0; i < devices.size(); i++) {
+        CHECK_SUCCESS_AS_EXPECTED(statuses[i], "Failed configuring device {}", devices[i].first);
+        physical_core_ops.emplace(devices[i].first, std::move(devices_core_ops[i]));
     }
 
     auto core_op_handle = allocate_core_op_handle();
@@ -27,15 +27,7 @@ Expected<std::shared_ptr<VDeviceCoreOp>> VDeviceCoreOp::create(VDevice &vdevice,
 {
 
     for (auto &core_op : core_ops) {
-        core_op.second->set_vdevice_core_op_handle(core_op_handle);
-        for (auto &stream : core_op.second->get_input_streams()) {
-            auto &stream_base = dynamic_cast<InputStreamBase&>(stream.get());
-            stream_base.set_vdevice_core_op_handle(core_op_handle);
-        }
-        for (auto &stream : core_op.second->get_output_streams()) {
-            auto &stream_base = dynamic_cast<OutputStreamBase&>(stream.get());
-            stream_base.set_vdevice_core_op_handle(core_op_handle);
-        }
+        set_physical_core_op_handle(*core_op.second, core_op_handle);
     }
 
     // On HcpConfigCoreOp, we don't support get_async_max_queue_size (and the core op doesn't use the queue).
@@ -63,6 +55,19 @@ Expected<std::shared_ptr<VDeviceCoreOp>> VDeviceCoreOp::create(VDevice &vdevice,
     return vdevice_core_op;
 }
 
+void VDeviceCoreOp::set_physical_core_op_handle(CoreOp &core_op, vdevice_core_op_handle_t core_op_handle)
+{
+    core_op.set_vdevice_core_op_handle(core_op_handle);
+    for (auto &stream : core_op.get_input_streams()) {
+        auto &stream_base = dynamic_cast<InputStreamBase&>(stream.get());
+        stream_base.set_vdevice_core_op_handle(core_op_handle);
+    }
+    for (auto &stream : core_op.get_output_streams()) {
+        auto &stream_base = dynamic_cast<OutputStreamBase&>(stream.get());
+        stream_base.set_vdevice_core_op_handle(core_op_handle);
+    }
+}
+
 Expected<std::shared_ptr<VDeviceCoreOp>> VDeviceCoreOp::duplicate(std::shared_ptr<VDeviceCoreOp> other,
     const ConfigureNetworkParams &configure_params)
 {
@@ -86,6 +91,56 @@ Expected<std::shared_ptr<VDeviceCoreOp>> VDeviceCoreOp::duplicate(std::shared_pt
     return vdevice_core_op;
 }
 
+// Compares the params the physical core ops (and their channels) are configured by. The rest of the params (e.g. the
+// streams' formats and flags) only affect the vdevice streams, which each instance creates on its own.
+static bool have_same_physical_params(const ConfigureNetworkParams &params, const ConfigureNetworkParams &other)
+{
+    if ((params.batch_size != other.batch_size) || (params.power_mode != other.power_mode) ||
+        (params.latency != other.latency)) {
+        return false;
+    }
+
+    // The batch size is given per network (see Hef::Impl::update_network_batch_size)
+    if (params.network_params_by_name.size() != other.network_params_by_name.size()) {
+        return false;
+    }
+    for (const auto &network_params : params.network_params_by_name) {
+        const auto other_network_params = other.network_params_by_name.find(network_params.first);
+        if ((other.network_params_by_name.end() == other_network_params) ||
+            (network_params.second.batch_size != other_network_params->second.batch_size)) {
+            return false;
+        }
+    }
+
+    for (const auto &stream_params : params.stream_params_by_name) {
+        const auto other_stream_params = other.stream_params_by_name.find(stream_params.first);
+        if (other.stream_params_by_name.end() == other_stream_params) {
+            return false;
+        }
+        const auto &coalescing = stream_params.second.interrupts_coalescing;
+        const auto &other_coalescing = other_stream_params->second.interrupts_coalescing;
+        if ((coalescing.max_transfers != other_coalescing.max_transfers) ||
+            (coalescing.timeout_us != other_coalescing.timeout_us)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool VDeviceCoreOp::equals(const Hef &hef, const std::pair<const std::string, ConfigureNetworkParams> &params_pair)
+{
+    if ((params_pair.first == name()) && (hef.hash() == m_hef_hash)) {
+        if (have_same_physical_params(params_pair.second, m_config_params)) {
+            return true;
+        }
+        LOGGER__INFO("The network group: {} was already configured to the device with different params."
+            " To use the Stream Multiplexer configure the network with the same params.", name());
+    }
+
+    return false;
+}
+
 VDeviceCoreOp::VDeviceCoreOp(VDevice &vdevice,
     ActiveCoreOpHolder &active_core_op_holder,
     const ConfigureNetworkParams &configure_params,
@@ -220,8 +275,9 @@ hailo_status VDeviceCoreOp::create_input_vdevice_stream_from_config_params(const
 
     if (m_core_ops_scheduler.lock()) {
         assert(m_infer_requests_accumulator);
+        TRY(const auto stream_index, get_stream_index(stream_name));
         auto scheduled_stream = ScheduledInputStream::create(m_vdevice, std::move(low_level_streams),
-            edge_layer.value(), m_core_op_handle, m_core_op_activated_event, m_infer_requests_accumulator);
+            edge_layer.value(), m_core_op_handle, m_core_op_activated_event, m_infer_requests_accumulator, stream_index);
         CHECK_EXPECTED_AS_STATUS(scheduled_stream);
 
         input_stream = scheduled_stream.release();
@@ -229,8 +285,9 @@ hailo_status VDeviceCoreOp::create_input_vdevice_stream_from_config_params(const
         auto max_batch_size = get_stream_batch_size(stream_name);
         CHECK_EXPECTED_AS_STATUS(max_batch_size);
 
+        TRY(auto dispatcher, get_native_streams_dispatcher(edge_layer->network_name));
         auto native_stream = VDeviceNativeInputStream::create(std::move(low_level_streams),
-            m_core_op_activated_event, edge_layer.value(), max_batch_size.release(), m_core_op_handle);
+            m_core_op_activated_event, edge_layer.value(), max_batch_size.release(), m_core_op_handle, dispatcher);
         CHECK_EXPECTED_AS_STATUS(native_stream);
 
         input_stream = native_stream.release();
@@ -261,8 +318,9 @@ hailo_status VDeviceCoreOp::create_output_vdevice_stream_from_config_params(cons
 
     if (m_core_ops_scheduler.lock()) {
         assert(m_infer_requests_accumulator);
+        TRY(const auto stream_index, get_stream_index(stream_name));
         auto scheduled_stream = ScheduledOutputStream::create(m_vdevice, std::move(low_level_streams),
-            m_core_op_handle, edge_layer.value(), m_core_op_activated_event, m_infer_requests_accumulator);
+            m_core_op_handle, edge_layer.value(), m_core_op_activated_event, m_infer_requests_accumulator, stream_index);
         CHECK_EXPECTED_AS_STATUS(scheduled_stream);
 
         output_stream = scheduled_stream.release();
@@ -270,8 +328,9 @@ hailo_status VDeviceCoreOp::create_output_vdevice_stream_from_config_params(cons
         auto max_batch_size = get_stream_batch_size(stream_name);
         CHECK_EXPECTED_AS_STATUS(max_batch_size);
 
+        TRY(auto dispatcher, get_native_streams_dispatcher(edge_layer->network_name));
         auto native_stream = VDeviceNativeOutputStream::create(std::move(low_level_streams),
-            m_core_op_activated_event, edge_layer.value(), max_batch_size.release(), m_core_op_handle);
+            m_core_op_activated_event, edge_layer.value(), max_batch_size.release(), m_core_op_handle, dispatcher);
         CHECK_EXPECTED_AS_STATUS(native_stream);
 
         output_stream = native_stream.release();
@@ -283,6 +342,23 @@ hailo_status VDeviceCoreOp::create_output_vdevice_stream_from_config_params(cons
     return HAILO_SUCCESS;
 }
 
+Expected<std::shared_ptr<NativeStreamsDispatcher>> VDeviceCoreOp::get_native_streams_dispatcher(
+    const std::string &network_name)
+{
+    auto it = m_native_streams_dispatchers.find(network_name);
+    if (m_native_streams_dispatchers.end() != it) {
+        return std::shared_ptr<NativeStreamsDispatcher>(it->second);
+    }
+
+    std::vector<device_id_t> device_ids;
+    for (const auto &pair : m_core_ops) {
+        device_ids.emplace_back(pair.first);
+    }
+    TRY(auto dispatcher, NativeStreamsDispatcher::create(device_ids));
+    m_native_streams_dispatchers.emplace(network_name, dispatcher);
+    return dispatcher;
+}
+
 vdevice_core_op_handle_t VDeviceCoreOp::core_op_handle() const
 {
     return m_core_op_handle;
@@ -332,6 +408,164 @@ hailo_status VDeviceCoreOp::set_scheduler_priority(uint8_t priority, const std::
     return HAILO_SUCCESS;
 }
 
+hailo_status VDeviceCoreOp::set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+    const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler deadline for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    CHECK(HAILO_SCHEDULING_ALGORITHM_DEADLINE == core_ops_scheduler->algorithm(), HAILO_INVALID_OPERATION,
+        "Cannot set scheduler deadline for core-op {}, as the scheduling algorithm is not HAILO_SCHEDULING_ALGORITHM_DEADLINE", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler deadline for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_deadline(m_core_op_handle, deadline, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_share(uint32_t share, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler share for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    CHECK(HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE == core_ops_scheduler->algorithm(), HAILO_INVALID_OPERATION,
+        "Cannot set scheduler share for core-op {}, as the scheduling algorithm is not HAILO_SCHEDULING_ALGORITHM_FAIR_SHARE", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler share for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_share(m_core_op_handle, share, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler device affinity for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler device affinity for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_device_affinity(m_core_op_handle, device_mask, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler sticky placement for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler sticky placement for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_sticky_placement(m_core_op_handle, is_sticky, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler pinned device for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler pinned device for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_pinned_device(m_core_op_handle, device_index, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+    const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler burst size bounds for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler burst size bounds for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_burst_size_bounds(m_core_op_handle, min_burst_size, max_burst_size, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler batch size for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler batch size for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_batch_size(m_core_op_handle, batch_size, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+    uint32_t max_pending_frames, const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler overload policy for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Setting scheduler overload policy for a specific network is currently not supported");
+    }
+    auto status = core_ops_scheduler->set_overload_policy(m_core_op_handle, policy, max_pending_frames, network_name);
+    CHECK_SUCCESS(status);
+    return HAILO_SUCCESS;
+}
+
+Expected<hailo_scheduler_overload_stats_t> VDeviceCoreOp::get_scheduler_overload_stats(const std::string &network_name)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK_AS_EXPECTED(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot get scheduler overload stats for core-op {}, as it is configured on a vdevice which does not have scheduling enabled", name());
+    if (network_name != HailoRTDefaults::get_network_name(name())) {
+        CHECK_AS_EXPECTED(network_name.empty(), HAILO_NOT_IMPLEMENTED, "Getting scheduler overload stats for a specific network is currently not supported");
+    }
+    return core_ops_scheduler->get_overload_stats(m_core_op_handle);
+}
+
+hailo_status VDeviceCoreOp::recover()
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot recover core-op {} through the scheduler, as it is configured on a vdevice which does not have scheduling enabled (deactivate and activate it instead)",
+        name());
+    return core_ops_scheduler->recover_core_op(m_core_op_handle);
+}
+
+hailo_status VDeviceCoreOp::set_scheduler_client(uint32_t client_id, uint32_t quota_percent)
+{
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INVALID_OPERATION,
+        "Cannot set scheduler client for core-op {}, as it is configured on a vdevice which does not have scheduling enabled",
+        name());
+    return core_ops_scheduler->set_core_op_client(m_core_op_handle, client_id, quota_percent);
+}
+
+void VDeviceCoreOp::set_callbacks_max_skew(uint64_t max_skew)
+{
+    for (auto &name_stream_pair : m_input_streams) {
+        if (auto scheduled_stream = std::dynamic_pointer_cast<ScheduledInputStream>(name_stream_pair.second)) {
+            scheduled_stream->set_callbacks_max_skew(max_skew);
+        } else if (auto native_stream = std::dynamic_pointer_cast<VDeviceNativeInputStream>(name_stream_pair.second)) {
+            native_stream->set_callbacks_max_skew(max_skew);
+        }
+    }
+    for (auto &name_stream_pair : m_output_streams) {
+        if (auto scheduled_stream = std::dynamic_pointer_cast<ScheduledOutputStream>(name_stream_pair.second)) {
+            scheduled_stream->set_callbacks_max_skew(max_skew);
+        } else if (auto native_stream = std::dynamic_pointer_cast<VDeviceNativeOutputStream>(name_stream_pair.second)) {
+            native_stream->set_callbacks_max_skew(max_skew);
+        }
+    }
+}
+
 Expected<std::shared_ptr<LatencyMetersMap>> VDeviceCoreOp::get_latency_meters()
 {
     return m_core_ops.begin()->second->get_latency_meters();
@@ -439,6 +673,35 @@ Expected<std::shared_ptr<VdmaConfigCoreOp>> VDeviceCoreOp::get_core_op_by_device
     return core_op;
 }
 
+hailo_status VDeviceCoreOp::prepare_physical_core_op(CoreOp &core_op, vdevice_core_op_handle_t core_op_handle)
+{
+    set_physical_core_op_handle(core_op, core_op_handle);
+
+    // As on the other devices, the buffers of the low level streams are owned by the scheduled streams or by the user
+    for (auto &stream : core_op.get_input_streams()) {
+        auto status = dynamic_cast<InputStreamBase&>(stream.get()).set_buffer_mode(StreamBufferMode::NOT_OWNING);
+        CHECK_SUCCESS(status);
+    }
+    for (auto &stream : core_op.get_output_streams()) {
+        auto status = dynamic_cast<OutputStreamBase&>(stream.get()).set_buffer_mode(StreamBufferMode::NOT_OWNING);
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+void VDeviceCoreOp::add_physical_core_op(const device_id_t &device_id, std::shared_ptr<CoreOp> core_op)
+{
+    assert(is_scheduled());
+    m_core_ops[device_id] = std::move(core_op);
+}
+
+void VDeviceCoreOp::remove_physical_core_op(const device_id_t &device_id)
+{
+    assert(m_core_ops.size() > 1);
+    m_core_ops.erase(device_id);
+}
+
 Expected<size_t> VDeviceCoreOp::get_async_max_queue_size_per_device() const
 {
     return m_core_ops.begin()->second->get_async_max_queue_size();
@@ -458,6 +721,18 @@ Expected<Buffer> VDeviceCoreOp::get_intermediate_buffer(const IntermediateBuffer
     return m_core_ops.begin()->second->get_intermediate_buffer(key);
 }
 
+Expected<ConfigureStagesDurations> VDeviceCoreOp::get_configure_stages_durations() const
+{
+    ConfigureStagesDurations durations{};
+    for (const auto &core_op : m_core_ops) {
+        TRY(const auto core_op_durations, core_op.second->get_configure_stages_durations());
+        durations.buffers_allocation += core_op_durations.buffers_allocation;
+        durations.resources_building += core_op_durations.resources_building;
+        durations.firmware_upload += core_op_durations.firmware_upload;
+    }
+    return durations;
+}
+
 Expected<Buffer> VDeviceCoreOp::get_cache_buffer(uint32_t cache_id)
 {
     CHECK_AS_EXPECTED(1 == m_core_ops.size(), HAILO_INVALID_OPERATION,
@@ -472,6 +747,13 @@ Expected<std::map<uint32_t, Buffer>> VDeviceCoreOp::get_cache_buffers()
     return m_core_ops.begin()->second->get_cache_buffers();
 }
 
+hailo_status VDeviceCoreOp::write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers)
+{
+    CHECK(1 == m_core_ops.size(), HAILO_INVALID_OPERATION,
+        "write_cache_buffers function is not supported on more than 1 physical device.");
+    return m_core_ops.begin()->second->write_cache_buffers(cache_buffers);
+}
+
 Expected<uint32_t> VDeviceCoreOp::get_cache_read_size() const
 {
     CHECK(1 == m_core_ops.size(), HAILO_INVALID_OPERATION,
@@ -536,9 +818,11 @@ hailo_status VDeviceCoreOp::add_to_trace()
             const uint32_t queue_size = static_cast<uint32_t>(*queue_size_exp);
 
             for (const auto &stream_params : m_config_params.stream_params_by_name) {
-                (stream_params.second.direction == HAILO_H2D_STREAM) ?
-                    TRACE(AddStreamH2DTrace, core_op.first, name(), stream_params.first, queue_size, m_core_op_handle) :
+                if (stream_params.second.direction == HAILO_H2D_STREAM) {
+                    TRACE(AddStreamH2DTrace, core_op.first, name(), stream_params.first, queue_size, m_core_op_handle);
+                } else {
                     TRACE(AddStreamD2HTrace, core_op.first, name(), stream_params.first, queue_size, m_core_op_handle);
+                }
             }
         }
     }
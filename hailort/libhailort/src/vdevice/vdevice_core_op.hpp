@@ -19,6 +19,7 @@
 
 #include "vdevice/scheduler/scheduler.hpp"
 #include "vdevice/scheduler/infer_request_accumulator.hpp"
+#include "vdevice/native_streams_dispatcher.hpp"
 #include "utils/profiler/tracer_macros.hpp"
 
 #include <cstdint>
@@ -47,19 +48,8 @@ public:
     VDeviceCoreOp &operator=(const VDeviceCoreOp &other) = delete;
     VDeviceCoreOp &operator=(VDeviceCoreOp &&other) = delete;
 
-    bool equals(const Hef &hef, const std::pair<const std::string, ConfigureNetworkParams> &params_pair)
-    {
-        if ((params_pair.first == name()) && (hef.hash() == m_hef_hash)) {
-            if ((params_pair.second.batch_size == m_config_params.batch_size) &&
-                (params_pair.second.power_mode == m_config_params.power_mode)) {
-                    return true;
-            }
-            LOGGER__INFO("The network group: {} was already configured to the device with different params."
-                " To use the Stream Multiplexer configure the network with the same params.", name());
-        }
-
-        return false;
-    }
+    // An identical core op shares our physical core ops (and our scheduler handle)
+    bool equals(const Hef &hef, const std::pair<const std::string, ConfigureNetworkParams> &params_pair);
 
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() override;
 
@@ -72,6 +62,26 @@ public:
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout, const std::string &network_name) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold, const std::string &network_name) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) override;
+
+    // Sets the max skew of the callbacks of the streams' async transfers (see CallbackReorderQueue::set_max_skew).
+    void set_callbacks_max_skew(uint64_t max_skew);
+
+    // Resets the core op on its devices after an error, without reconfiguring it (see CoreOpsScheduler::recover_core_op).
+    hailo_status recover();
+    // Accounts the core op's device time to the client (see CoreOpsScheduler::set_core_op_client)
+    hailo_status set_scheduler_client(uint32_t client_id, uint32_t quota_percent);
 
     virtual hailo_status wait_for_activation(const std::chrono::milliseconds &timeout) override
     {
@@ -88,12 +98,23 @@ public:
     size_t devices_count() const { return m_core_ops.size(); }
     Expected<std::shared_ptr<VdmaConfigCoreOp>> get_core_op_by_device_id(const device_id_t &device_bdf_id);
 
+    // Devices hot plug (see VDevice::add_device), supported only on scheduled core ops:
+    // Prepares the core op configured on an added device to be scheduled as part of the vdevice core op.
+    static hailo_status prepare_physical_core_op(CoreOp &core_op, vdevice_core_op_handle_t core_op_handle);
+    // Must be called while the scheduler doesn't access the core op (see CoreOpsScheduler::add_device).
+    void add_physical_core_op(const device_id_t &device_id, std::shared_ptr<CoreOp> core_op);
+    void remove_physical_core_op(const device_id_t &device_id);
+
+    const std::string &hef_hash() const { return m_hef_hash; }
+
     Expected<size_t> get_async_max_queue_size_per_device() const;
 
     virtual Expected<HwInferResults> run_hw_infer_estimator() override;
     virtual Expected<Buffer> get_intermediate_buffer(const IntermediateBufferKey &) override;
+    virtual Expected<ConfigureStagesDurations> get_configure_stages_durations() const override;
     virtual Expected<Buffer> get_cache_buffer(uint32_t cache_id) override;
     virtual Expected<std::map<uint32_t, Buffer>> get_cache_buffers() override;
+    virtual hailo_status write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers) override;
     virtual bool has_caches() const override;
     virtual Expected<uint32_t> get_cache_read_size() const override;
     virtual Expected<uint32_t> get_cache_write_size() const override;
@@ -119,8 +140,13 @@ private:
 
     hailo_status create_vdevice_streams_from_duplicate(std::shared_ptr<VDeviceCoreOp> other);
 
+    // The native streams of a network share a dispatcher, so they transfer each batch to the same device.
+    Expected<std::shared_ptr<NativeStreamsDispatcher>> get_native_streams_dispatcher(const std::string &network_name);
+
     hailo_status add_to_trace();
 
+    static void set_physical_core_op_handle(CoreOp &core_op, vdevice_core_op_handle_t core_op_handle);
+
     VDevice &m_vdevice;
     std::map<device_id_t, std::shared_ptr<CoreOp>> m_core_ops;
     CoreOpsSchedulerWeakPtr m_core_ops_scheduler;
@@ -128,6 +154,7 @@ private:
     std::string m_hef_hash;
 
     std::shared_ptr<InferRequestAccumulator> m_infer_requests_accumulator;
+    std::map<std::string, std::shared_ptr<NativeStreamsDispatcher>> m_native_streams_dispatchers;
 };
 
 }
@@ -32,6 +32,7 @@ Expected<std::unique_ptr<VDevice>> VDeviceHrpcClient::create(const hailo_vdevice
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     auto vdevice_handle = std::get<1>(tuple);
+    client->set_flat_messages_enabled(std::get<2>(tuple));
     auto vdevice_client = make_unique_nothrow<VDeviceHrpcClient>(std::move(client), vdevice_handle);
     CHECK_NOT_NULL(vdevice_client, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -29,6 +29,8 @@
 #include "vdma/vdma_config_manager.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 #include "vdevice/scheduler/scheduler.hpp"
+#include "vdevice/scheduler/thermal_governor.hpp"
+#include "vdevice/scheduler/idle_power_governor.hpp"
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 #include "service/hailort_rpc_client.hpp"
@@ -82,6 +84,11 @@ public:
     // Currently only homogeneous vDevice is allow (= all devices are from the same type)
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() const override;
 
+    // Devices hot plug. Must not be called concurrently with the other functions of the vdevice (the inference keeps
+    // running meanwhile).
+    virtual hailo_status add_device(const std::string &device_id) override;
+    virtual hailo_status remove_device(const std::string &device_id, std::chrono::milliseconds timeout) override;
+
     virtual hailo_status dma_map(void *address, size_t size, hailo_dma_buffer_direction_t direction) override
     {
         for (const auto &pair : m_devices) {
@@ -144,10 +151,17 @@ public:
 
 private:
     VDeviceBase(std::map<device_id_t, std::unique_ptr<Device>> &&devices, CoreOpsSchedulerPtr core_ops_scheduler,
-        const std::string &unique_vdevice_hash="") :
-        m_devices(std::move(devices)), m_core_ops_scheduler(core_ops_scheduler), m_next_core_op_handle(0), m_unique_vdevice_hash(unique_vdevice_hash)
-        {}
+        const hailo_vdevice_params_t &params, const std::string &unique_vdevice_hash="") :
+        m_devices(std::move(devices)), m_core_ops_scheduler(core_ops_scheduler), m_next_core_op_handle(0),
+        m_multi_device_pipelining(params.multi_device_pipelining), m_next_pipeline_device_index(0),
+        m_unique_vdevice_hash(unique_vdevice_hash), m_hot_plug_params(params)
+    {
+        // The user's device ids are valid only during the vdevice creation
+        m_hot_plug_params.device_ids = nullptr;
+    }
 
+    static Expected<std::unique_ptr<Device>> create_device(const std::string &device_id,
+        const hailo_vdevice_params_t &params);
     static Expected<std::map<device_id_t, std::unique_ptr<Device>>> create_devices(const hailo_vdevice_params_t &params);
     static Expected<std::vector<std::string>> get_device_ids(const hailo_vdevice_params_t &params);
     Expected<NetworkGroupsParamsMap> create_local_config_params(Hef &hef, const NetworkGroupsParamsMap &configure_params);
@@ -157,18 +171,41 @@ private:
         const ConfigureNetworkParams &params);
     bool should_use_multiplexer();
     vdevice_core_op_handle_t allocate_core_op_handle();
+    // Pins each of the network groups to the device after the previous network group's (see multi_device_pipelining)
+    hailo_status place_network_groups_on_consecutive_devices(const ConfiguredNetworkGroupVector &network_groups);
+    // The governors access the devices, so they are stopped while devices are added or removed
+    hailo_status start_governors();
+    void stop_governors();
+    // All of the vdevice core ops, including the instances sharing the physical core ops of others
+    std::vector<std::shared_ptr<VDeviceCoreOp>> get_all_vdevice_core_ops() const;
 
     std::map<device_id_t, std::unique_ptr<Device>> m_devices;
     CoreOpsSchedulerPtr m_core_ops_scheduler;
+    // Created only if the vdevice is scheduled and the thermal envelope is set
+    std::unique_ptr<ThermalGovernor> m_thermal_governor;
+    // Created only if the vdevice is scheduled and the idle power timeout is set
+    std::unique_ptr<IdlePowerGovernor> m_idle_power_governor;
     std::vector<std::shared_ptr<VDeviceCoreOp>> m_vdevice_core_ops;
     std::vector<std::shared_ptr<ConfiguredNetworkGroup>> m_network_groups; // TODO: HRT-9547 - Remove when ConfiguredNetworkGroup will be kept in global context
     ActiveCoreOpHolder m_active_core_op_holder;
     vdevice_core_op_handle_t m_next_core_op_handle;
+    const bool m_multi_device_pipelining;
+    // Index (in m_devices) of the device the next configured network group is placed on
+    size_t m_next_pipeline_device_index;
     const std::string m_unique_vdevice_hash; // Used to identify this vdevice in the monitor. consider removing - TODO (HRT-8835)
+    // The params added devices are created by (see add_device)
+    hailo_vdevice_params_t m_hot_plug_params;
+    // The HEFs of the configured core ops by their hash, kept (if allow_devices_hot_plug is set) to configure the core
+    // ops on added devices
+    std::map<std::string, Hef> m_hot_plug_hefs;
     std::mutex m_mutex;
 };
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
+// Makes the callbacks listener poll the service for the ready callbacks, instead of having the service stream them
+#define HAILO_SERVICE_DISABLE_CALLBACKS_STREAM_ENV_VAR ("HAILO_SERVICE_DISABLE_CALLBACKS_STREAM")
+#define MAX_CALLBACKS_PER_LISTENER_REPLY (64)
+
 using network_group_handle_t = uint32_t;
 
 class VDeviceClient : public VDevice
@@ -239,6 +276,8 @@ public:
     Expected<hailo_stream_interface_t> get_default_streams_interface() const override;
     Expected<std::shared_ptr<InferModel>> create_infer_model(const std::string &hef_path,
         const std::string &network_name = "") override;
+    virtual hailo_status add_device(const std::string &device_id) override;
+    virtual hailo_status remove_device(const std::string &device_id, std::chrono::milliseconds timeout) override;
     virtual hailo_status dma_map(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
     virtual hailo_status dma_unmap(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
     virtual hailo_status dma_map_dmabuf(int dmabuf_fd, size_t size, hailo_dma_buffer_direction_t direction) override;
@@ -19,7 +19,8 @@ Expected<std::unique_ptr<VDeviceNativeInputStream>> VDeviceNativeInputStream::cr
     EventPtr core_op_activated_event,
     const LayerInfo &layer_info,
     uint16_t batch_size,
-    vdevice_core_op_handle_t core_op_handle)
+    vdevice_core_op_handle_t core_op_handle,
+    std::shared_ptr<NativeStreamsDispatcher> dispatcher)
 {
     std::unique_ptr<CallbackReorderQueue> reorder_queue = nullptr;
     // Ifaces of all streams should be the same
@@ -34,7 +35,8 @@ Expected<std::unique_ptr<VDeviceNativeInputStream>> VDeviceNativeInputStream::cr
 
     auto status = HAILO_UNINITIALIZED;
     auto stream = make_unique_nothrow<VDeviceNativeInputStream>(std::move(streams),
-        std::move(core_op_activated_event), layer_info, batch_size, core_op_handle, std::move(reorder_queue), status);
+        std::move(core_op_activated_event), layer_info, batch_size, core_op_handle, std::move(reorder_queue),
+        std::move(dispatcher), status);
     CHECK_AS_EXPECTED((nullptr != stream), HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
     return stream;
@@ -136,6 +138,7 @@ hailo_status VDeviceNativeInputStream::flush()
 hailo_status VDeviceNativeInputStream::write_impl(const MemoryView &buffer)
 {
     TRACE(FrameEnqueueH2DTrace, m_core_op_handle, name());
+    TRACE_PAYLOAD(InputFramePayloadTrace, m_core_op_handle, name(), std::vector<MemoryView>{buffer});
 
     auto status = next_stream().write_impl(buffer);
     if ((HAILO_STREAM_ABORT == status) || (HAILO_STREAM_NOT_ACTIVATED == status)){
@@ -150,7 +153,7 @@ hailo_status VDeviceNativeInputStream::write_impl(const MemoryView &buffer)
 
 hailo_status VDeviceNativeInputStream::wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout)
 {
-    return m_streams.at(m_next_transfer_stream).get().wait_for_async_ready(transfer_size, timeout);
+    return next_stream().wait_for_async_ready(transfer_size, timeout);
 }
 
 Expected<size_t> VDeviceNativeInputStream::get_async_max_queue_size() const
@@ -183,6 +186,13 @@ Expected<size_t> VDeviceNativeInputStream::get_async_max_queue_size() const
     }
 }
 
+void VDeviceNativeInputStream::set_callbacks_max_skew(uint64_t max_skew)
+{
+    if (m_callback_reorder_queue) {
+        m_callback_reorder_queue->set_max_skew(max_skew);
+    }
+}
+
 hailo_status VDeviceNativeInputStream::write_async(TransferRequest &&transfer_request)
 {
     // TODO HRT-10583 - allow option to remove reorder queue
@@ -190,6 +200,7 @@ hailo_status VDeviceNativeInputStream::write_async(TransferRequest &&transfer_re
     transfer_request.callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
 
     TRACE(FrameEnqueueH2DTrace, m_core_op_handle, name());
+    TRACE_PAYLOAD(InputFramePayloadTrace, m_core_op_handle, name(), transfer_request.transfer_buffers.memory_views());
 
     auto status = next_stream().write_async(std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
@@ -203,17 +214,17 @@ hailo_status VDeviceNativeInputStream::write_async(TransferRequest &&transfer_re
 
 InputStreamBase &VDeviceNativeInputStream::next_stream()
 {
+    if (!m_is_next_transfer_stream_chosen) {
+        m_next_transfer_stream = m_dispatcher->next_batch_device(m_dispatcher_stream_index, m_batch_size);
+        m_is_next_transfer_stream_chosen = true;
+    }
     return m_streams.at(m_next_transfer_stream).get();
 }
 
 void VDeviceNativeInputStream::advance_stream()
 {
     if (0 == (++m_acc_frames % m_batch_size)) {
-        auto it = m_streams.upper_bound(m_next_transfer_stream);
-        if (m_streams.end() == it) {
-            it = m_streams.begin();
-        }
-        m_next_transfer_stream = it->first;
+        m_is_next_transfer_stream_chosen = false;
         m_acc_frames = 0;
     }
 }
@@ -224,7 +235,8 @@ Expected<std::unique_ptr<VDeviceNativeOutputStream>> VDeviceNativeOutputStream::
     EventPtr core_op_activated_event,
     const LayerInfo &layer_info,
     uint16_t batch_size,
-    vdevice_core_op_handle_t core_op_handle)
+    vdevice_core_op_handle_t core_op_handle,
+    std::shared_ptr<NativeStreamsDispatcher> dispatcher)
 {
     std::unique_ptr<CallbackReorderQueue> reorder_queue = nullptr;
     // Ifaces of all streams should be the same
@@ -239,7 +251,8 @@ Expected<std::unique_ptr<VDeviceNativeOutputStream>> VDeviceNativeOutputStream::
 
     auto status = HAILO_UNINITIALIZED;
     auto stream = make_unique_nothrow<VDeviceNativeOutputStream>(std::move(streams),
-        std::move(core_op_activated_event), layer_info, batch_size, core_op_handle, std::move(reorder_queue), status);
+        std::move(core_op_activated_event), layer_info, batch_size, core_op_handle, std::move(reorder_queue),
+        std::move(dispatcher), status);
     CHECK_AS_EXPECTED((nullptr != stream), HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
     return stream;
@@ -332,6 +345,7 @@ hailo_status VDeviceNativeOutputStream::read_impl(MemoryView buffer)
       return status;
     }
     CHECK_SUCCESS(status, "Failed read from stream (device: {})", m_next_transfer_stream);
+    m_dispatcher->frames_done(m_next_transfer_stream, 1);
 
     if (INVALID_CORE_OP_HANDLE != m_core_op_handle) {
         TRACE(FrameDequeueD2HTrace, m_core_op_handle, name());
@@ -376,6 +390,13 @@ Expected<size_t> VDeviceNativeOutputStream::get_async_max_queue_size() const
     }
 }
 
+void VDeviceNativeOutputStream::set_callbacks_max_skew(uint64_t max_skew)
+{
+    if (m_callback_reorder_queue) {
+        m_callback_reorder_queue->set_max_skew(max_skew);
+    }
+}
+
 hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_request)
 {
     // TODO HRT-10583 - allow option to remove reorder queue
@@ -384,14 +405,16 @@ hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_re
 
     auto reorder_queue_callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
 
-    transfer_request.callback = [this, callback=reorder_queue_callback](hailo_status status) {
+    auto &stream = next_stream();
+    transfer_request.callback = [this, callback=reorder_queue_callback, device_id=m_next_transfer_stream](hailo_status status) {
+        m_dispatcher->frames_done(device_id, 1);
         callback(status);
         if ((HAILO_SUCCESS == status) && (INVALID_CORE_OP_HANDLE != m_core_op_handle)) {
             TRACE(FrameDequeueD2HTrace, m_core_op_handle, name());
         }
     };
 
-    auto status = next_stream().read_async(std::move(transfer_request));
+    auto status = stream.read_async(std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
         m_callback_reorder_queue->cancel_last_callback();
         return status;
@@ -405,7 +428,12 @@ hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_re
 hailo_status VDeviceNativeOutputStream::read_unaligned_address_async(const MemoryView &buffer,
     const TransferDoneCallback &user_callback)
 {
-    auto status = next_stream().read_unaligned_address_async(buffer, user_callback);
+    auto &stream = next_stream();
+    auto status = stream.read_unaligned_address_async(buffer,
+        [this, user_callback, device_id=m_next_transfer_stream](const OutputStream::CompletionInfo &completion_info) {
+            m_dispatcher->frames_done(device_id, 1);
+            user_callback(completion_info);
+        });
     CHECK_SUCCESS(status);
     advance_stream();
     return HAILO_SUCCESS;
@@ -413,17 +441,17 @@ hailo_status VDeviceNativeOutputStream::read_unaligned_address_async(const Memor
 
 OutputStreamBase &VDeviceNativeOutputStream::next_stream()
 {
+    if (!m_is_next_transfer_stream_chosen) {
+        m_next_transfer_stream = m_dispatcher->next_batch_device(m_dispatcher_stream_index, m_batch_size);
+        m_is_next_transfer_stream_chosen = true;
+    }
     return m_streams.at(m_next_transfer_stream).get();
 }
 
 void VDeviceNativeOutputStream::advance_stream()
 {
     if (0 == (++m_acc_frames % m_batch_size)) {
-        auto it = m_streams.upper_bound(m_next_transfer_stream);
-        if (m_streams.end() == it) {
-            it = m_streams.begin();
-        }
-        m_next_transfer_stream = it->first;
+        m_is_next_transfer_stream_chosen = false;
         m_acc_frames = 0;
     }
 }
@@ -16,6 +16,7 @@
 
 #include "stream_common/stream_internal.hpp"
 #include "vdevice/callback_reorder_queue.hpp"
+#include "vdevice/native_streams_dispatcher.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 
 
@@ -30,7 +31,8 @@ public:
         EventPtr core_op_activated_event,
         const LayerInfo &layer_info,
         uint16_t batch_size,
-        vdevice_core_op_handle_t core_op_handle);
+        vdevice_core_op_handle_t core_op_handle,
+        std::shared_ptr<NativeStreamsDispatcher> dispatcher);
 
     VDeviceNativeInputStream(
         std::map<device_id_t, std::reference_wrapper<InputStreamBase>> &&streams,
@@ -39,10 +41,13 @@ public:
         uint16_t batch_size,
         vdevice_core_op_handle_t core_op_handle,
         std::unique_ptr<CallbackReorderQueue> &&callback_reorder_queue,
+        std::shared_ptr<NativeStreamsDispatcher> &&dispatcher,
         hailo_status &status) :
             InputStreamBase(layer_info, std::move(core_op_activated_event), status),
             m_streams(std::move(streams)),
-            m_next_transfer_stream(m_streams.begin()->first),
+            m_dispatcher(std::move(dispatcher)),
+            m_dispatcher_stream_index(m_dispatcher->register_stream(false)),
+            m_is_next_transfer_stream_chosen(false),
             m_acc_frames(0),
             m_batch_size(batch_size),
             m_callback_reorder_queue(std::move(callback_reorder_queue)),
@@ -67,12 +72,19 @@ public:
     virtual hailo_status write_async(TransferRequest &&transfer_request) override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
 
+    // See CallbackReorderQueue::set_max_skew
+    void set_callbacks_max_skew(uint64_t max_skew);
+
 protected:
 
     InputStreamBase &next_stream();
     void advance_stream();
 
     std::map<device_id_t, std::reference_wrapper<InputStreamBase>> m_streams;
+    std::shared_ptr<NativeStreamsDispatcher> m_dispatcher;
+    const NativeStreamsDispatcher::stream_index_t m_dispatcher_stream_index;
+    // The device of the current batch is chosen by the dispatcher on the batch's first transfer
+    bool m_is_next_transfer_stream_chosen;
     device_id_t m_next_transfer_stream;
     uint32_t m_acc_frames;
     const uint16_t m_batch_size;
@@ -86,7 +98,7 @@ public:
     static Expected<std::unique_ptr<VDeviceNativeOutputStream>> create(
         std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> &&streams,
         EventPtr core_op_activated_event, const LayerInfo &layer_info, uint16_t batch_size,
-        vdevice_core_op_handle_t core_op_handle);
+        vdevice_core_op_handle_t core_op_handle, std::shared_ptr<NativeStreamsDispatcher> dispatcher);
 
     VDeviceNativeOutputStream(
         std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> &&streams,
@@ -95,10 +107,13 @@ public:
         uint16_t batch_size,
         vdevice_core_op_handle_t core_op_handle,
         std::unique_ptr<CallbackReorderQueue> &&callback_reorder_queue,
+        std::shared_ptr<NativeStreamsDispatcher> &&dispatcher,
         hailo_status &status) :
             OutputStreamBase(layer_info, std::move(core_op_activated_event), status),
             m_streams(std::move(streams)),
-            m_next_transfer_stream(m_streams.begin()->first),
+            m_dispatcher(std::move(dispatcher)),
+            m_dispatcher_stream_index(m_dispatcher->register_stream(true)),
+            m_is_next_transfer_stream_chosen(false),
             m_acc_frames(0),
             m_batch_size(batch_size),
             m_core_op_handle(core_op_handle),
@@ -123,11 +138,18 @@ public:
         const TransferDoneCallback &user_callback) override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
 
+    // See CallbackReorderQueue::set_max_skew
+    void set_callbacks_max_skew(uint64_t max_skew);
+
 private:
     OutputStreamBase &next_stream();
     void advance_stream();
 
     std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> m_streams;
+    std::shared_ptr<NativeStreamsDispatcher> m_dispatcher;
+    const NativeStreamsDispatcher::stream_index_t m_dispatcher_stream_index;
+    // The device of the current batch is chosen by the dispatcher on the batch's first transfer
+    bool m_is_next_transfer_stream_chosen;
     device_id_t m_next_transfer_stream;
     uint32_t m_acc_frames;
     const uint16_t m_batch_size;
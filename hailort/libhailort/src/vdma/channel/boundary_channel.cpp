@@ -15,6 +15,7 @@
 #include "vdma/memory/vdma_edge_layer.hpp"
 
 #include <list>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <iostream>
@@ -24,11 +25,12 @@ namespace hailort {
 namespace vdma {
 Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma::ChannelId channel_id,
     Direction direction, vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
-    size_t ongoing_transfers, size_t pending_transfers, const std::string &stream_name, LatencyMeterPtr latency_meter)
+    size_t ongoing_transfers, size_t pending_transfers, const std::string &stream_name, LatencyMeterPtr latency_meter,
+    MappedBuffersCachePtr mapped_buffers_cache)
 {
     hailo_status status = HAILO_UNINITIALIZED;
     auto channel_ptr = make_shared_nothrow<BoundaryChannel>(driver, channel_id, direction, std::move(desc_list),
-        transfer_launcher, ongoing_transfers, pending_transfers, stream_name, latency_meter, status);
+        transfer_launcher, ongoing_transfers, pending_transfers, stream_name, latency_meter, mapped_buffers_cache, status);
     CHECK_NOT_NULL_AS_EXPECTED(channel_ptr, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating BoundaryChannel");
     return channel_ptr;
@@ -37,7 +39,8 @@ Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma
 BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
                                  DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
                                  size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
-                                 const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status) :
+                                 const std::string &stream_name, LatencyMeterPtr latency_meter,
+                                 MappedBuffersCachePtr mapped_buffers_cache, hailo_status &status) :
     m_channel_id(channel_id),
     m_direction(direction),
     m_driver(driver),
@@ -53,7 +56,13 @@ BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_
     m_latency_meter(latency_meter),
     m_pending_latency_measurements(ONGOING_TRANSFERS_SIZE), // Make sure there will always be place for latency measure
     m_last_timestamp_num_processed(0),
-    m_bounded_buffer(nullptr)
+    m_bounded_buffer(nullptr),
+    m_mapped_buffers_cache(mapped_buffers_cache),
+    m_coalescing_max_transfers(0),
+    m_coalescing_timeout(0),
+    m_transfers_since_interrupt(0),
+    m_deferred_batch(nullptr),
+    m_deferred_transfers_count(0)
 {
     if (Direction::BOTH == direction) {
         LOGGER__ERROR("Boundary channels must be unidirectional");
@@ -83,10 +92,10 @@ static hailo_status get_callback_status(vdma::ChannelId channel_id, const Channe
     if (!irq_data.is_active) {
         status = HAILO_STREAM_ABORT;
     } else if (!irq_data.validation_success) {
-        LOGGER__WARNING("Channel {} validation failed", channel_id);
+        LOGGER__WARNING_RATE_LIMITED("Channel {} validation failed", channel_id);
         status = HAILO_INTERNAL_FAILURE;
     } else if ((0 != irq_data.host_error) || (0 != irq_data.device_error)) {
-        LOGGER__WARNING("Channel {} completed with errors: host_error {} device_error {}",
+        LOGGER__WARNING_RATE_LIMITED("Channel {} completed with errors: host_error {} device_error {}",
             channel_id, irq_data.host_error, irq_data.device_error);
         status = HAILO_INTERNAL_FAILURE;
     } else {
@@ -123,20 +132,13 @@ hailo_status BoundaryChannel::trigger_channel_completion(const ChannelIrqData &i
         //  2. On H2D channels - new input can be written to the buffer.
         m_descs.set_tail((transfer.last_desc + 1) & m_descs.size_mask());
 
+        if ((Direction::D2H == m_direction) && (nullptr != transfer.request.control)) {
+            transfer.request.control->on_d2h_transfer_completed(std::chrono::steady_clock::now());
+        }
+
         // We've freed up room in the descriptor list, so we can launch another transfer
         if (!m_pending_transfers.empty()) {
-            m_transfer_launcher.enqueue_transfer([this]() {
-                std::unique_lock<std::mutex> lock(m_channel_mutex);
-                if (m_pending_transfers.empty()) {
-                    return;
-                }
-                auto transfer_request = std::move(m_pending_transfers.front());
-                m_pending_transfers.pop_front();
-                const auto status = launch_transfer_impl(std::move(transfer_request));
-                if (status != HAILO_SUCCESS) {
-                    on_request_complete(lock, transfer_request, status);
-                }
-            });
+            launch_pending_transfers_async();
         }
 
         // Call the user callback
@@ -167,6 +169,18 @@ hailo_status BoundaryChannel::activate()
     assert(m_ongoing_transfers.empty());
     m_last_timestamp_num_processed = 0;
     m_descs.reset();
+    m_transfers_since_interrupt = 0;
+
+    if (m_coalescing_max_transfers > 1) {
+        // The channel may have been used by other core-op, so the driver timeout is set on each activation.
+        auto status = m_driver.vdma_set_interrupts_coalescing(m_channel_id, m_coalescing_timeout);
+        if (HAILO_NOT_SUPPORTED == status) {
+            LOGGER__WARNING("Driver doesn't support interrupts coalescing, disabling it on channel {}", m_channel_id);
+            m_coalescing_max_transfers = 0;
+        } else {
+            CHECK_SUCCESS(status);
+        }
+    }
 
     return HAILO_SUCCESS;
 }
@@ -184,7 +198,7 @@ hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request
         return HAILO_STREAM_NOT_ACTIVATED;
     }
 
-    if ((m_ongoing_transfers.size() < m_ongoing_transfers.capacity()) && (m_pending_transfers.size() == 0)) {
+    if (can_launch_on_user_thread()) {
         // There's room in the desc list and there are no pending transfers => execute on user's thread
         // We can't use the user thread to launch the transfer if there are pending transfers, because we need to
         // preserve the order of the transfers.
@@ -200,6 +214,114 @@ hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request
     return HAILO_SUCCESS;
 }
 
+hailo_status BoundaryChannel::prefetch_mappings(TransferRequest &transfer_request)
+{
+    if ((nullptr == m_mapped_buffers_cache) || transfer_request.transfer_buffers.empty()) {
+        return HAILO_SUCCESS;
+    }
+
+    if (TransferBufferType::MEMORYVIEW == transfer_request.transfer_buffers[0].type()) {
+        // Unaligned user buffers are copied to an aligned buffer by the stream, so they are not mapped.
+        TRY(const auto is_request_aligned, transfer_request.is_request_aligned());
+        if (!is_request_aligned) {
+            return HAILO_SUCCESS;
+        }
+    }
+
+    for (auto &transfer_buffer : transfer_request.transfer_buffers) {
+        CHECK_SUCCESS(transfer_buffer.prefetch_mapping(*m_mapped_buffers_cache, m_direction));
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status BoundaryChannel::set_interrupts_coalescing(const hailo_stream_interrupts_coalescing_params_t &params)
+{
+    std::lock_guard<std::mutex> lock(m_channel_mutex);
+    CHECK(!m_is_channel_activated, HAILO_INVALID_OPERATION,
+        "Can't set interrupts coalescing on an activated channel {}", m_channel_id);
+    CHECK((params.max_transfers <= 1) || (0 != params.timeout_us), HAILO_INVALID_ARGUMENT,
+        "Interrupts coalescing timeout must be set when max_transfers > 1 (channel {})", m_channel_id);
+
+    if ((params.max_transfers > 1) && (nullptr != m_latency_meter)) {
+        // The latency meter uses the interrupts timestamps of each transfer.
+        LOGGER__WARNING("Interrupts coalescing is not supported with latency measurement, ignoring it on channel {}",
+            m_channel_id);
+        return HAILO_SUCCESS;
+    }
+
+    m_coalescing_max_transfers = params.max_transfers;
+    m_coalescing_timeout = std::chrono::microseconds(params.timeout_us);
+    return HAILO_SUCCESS;
+}
+
+// Assumes that the m_channel_mutex is locked!
+bool BoundaryChannel::can_launch_on_user_thread() const
+{
+    if ((nullptr != m_deferred_batch) && (TransferLaunchBatch::current() != m_deferred_batch)) {
+        // Other thread's batch holds transfers that were not launched yet.
+        return false;
+    }
+
+    return ((m_ongoing_transfers.size() + m_deferred_transfers_count) < m_ongoing_transfers.capacity()) &&
+        (m_pending_transfers.size() == 0);
+}
+
+// Assumes that the m_channel_mutex is locked!
+bool BoundaryChannel::should_defer_to_batch(TransferLaunchBatch *batch) const
+{
+    // When measuring latency, the launch order of the transfers is tracked in m_pending_latency_measurements, so we
+    // launch the transfer immediately.
+    return (nullptr != batch) && batch->can_add(m_driver) && (nullptr == m_latency_meter);
+}
+
+// Assumes that the m_channel_mutex is locked!
+bool BoundaryChannel::should_interrupt_on_transfer() const
+{
+    if (m_coalescing_max_transfers <= 1) {
+        return true;
+    }
+
+    if ((m_transfers_since_interrupt + 1) >= m_coalescing_max_transfers) {
+        return true;
+    }
+
+    // If this transfer fills the channel, no other transfer can be launched until some transfer is completed, so
+    // there is no point waiting for the coalescing timeout.
+    return (m_ongoing_transfers.size() + m_deferred_transfers_count + 1) >= m_ongoing_transfers.capacity();
+}
+
+// Assumes that the m_channel_mutex is locked!
+void BoundaryChannel::launch_pending_transfers_async()
+{
+    const auto status = m_transfer_launcher.enqueue_transfer(*this, transfer_launcher_key());
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR_RATE_LIMITED("Failed enqueueing pending transfers of channel {} to the transfer launcher, status {}",
+            m_channel_id, status);
+    }
+}
+
+size_t BoundaryChannel::transfer_launcher_key() const
+{
+    return (m_channel_id.engine_index * VDMA_CHANNELS_PER_ENGINE) + m_channel_id.channel_index;
+}
+
+void BoundaryChannel::launch_pending_transfers()
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+    // If some transfers are deferred, the pending transfers are launched after the batch is flushed. Pending transfers
+    // of a deactivated channel are canceled in cancel_pending_transfers.
+    while (m_is_channel_activated && !m_pending_transfers.empty() && (nullptr == m_deferred_batch) &&
+           ((m_ongoing_transfers.size() + m_deferred_transfers_count) < m_ongoing_transfers.capacity())) {
+        auto transfer_request = std::move(m_pending_transfers.front());
+        m_pending_transfers.pop_front();
+        const auto status = launch_transfer_impl(std::move(transfer_request));
+        if (status != HAILO_SUCCESS) {
+            on_request_complete(lock, transfer_request, status);
+        }
+    }
+}
+
 // Assumes that the m_channel_mutex is locked!
 hailo_status BoundaryChannel::launch_transfer_impl(TransferRequest &&transfer_request)
 {
@@ -207,10 +329,40 @@ hailo_status BoundaryChannel::launch_transfer_impl(TransferRequest &&transfer_re
         return HAILO_STREAM_NOT_ACTIVATED;
     }
 
-    if (m_ongoing_transfers.size() >= m_ongoing_transfers.capacity()) {
+    if ((m_ongoing_transfers.size() + m_deferred_transfers_count) >= m_ongoing_transfers.capacity()) {
         return HAILO_QUEUE_IS_FULL;
     }
 
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_OUT_OF_DESCRIPTORS, auto prepared, prepare_transfer(transfer_request));
+
+    auto batch = TransferLaunchBatch::current();
+    if (should_defer_to_batch(batch)) {
+        batch->add(*this, std::move(prepared), std::move(transfer_request));
+        return HAILO_SUCCESS;
+    }
+
+    const auto &launch = prepared.launch;
+    TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto desc_programmed, m_driver.launch_transfer(
+        launch.channel_id,
+        launch.desc_handle,
+        launch.starting_desc,
+        launch.transfer_buffers,
+        launch.should_bind,
+        launch.first_desc_interrupts,
+        launch.last_desc_interrupts
+        ));
+    CHECK(prepared.total_descs_count == desc_programmed, HAILO_INTERNAL_FAILURE,
+        "Inconsistent desc programed expecting {} got {}", prepared.total_descs_count, desc_programmed);
+    on_transfer_launched(transfer_request);
+    m_ongoing_transfers.push_back(OngoingTransfer{std::move(transfer_request), prepared.last_desc});
+
+    return HAILO_SUCCESS;
+}
+
+// Assumes that the m_channel_mutex is locked!
+// Maps the transfer buffers and reserves descriptors for the transfer (The descriptors are not programmed).
+Expected<BoundaryChannel::PreparedTransfer> BoundaryChannel::prepare_transfer(TransferRequest &transfer_request)
+{
     auto num_available = static_cast<uint16_t>(m_descs.head());
     const uint16_t first_desc = num_available;
     uint16_t last_desc = std::numeric_limits<uint16_t>::max();
@@ -225,7 +377,8 @@ hailo_status BoundaryChannel::launch_transfer_impl(TransferRequest &&transfer_re
 
     auto current_num_available = num_available;
     for (auto &transfer_buffer : transfer_request.transfer_buffers) {
-        TRY(auto mapped_buffer, transfer_buffer.map_buffer(m_driver, m_direction));
+        TRY(auto mapped_buffer, transfer_buffer.map_buffer(m_driver, m_direction,
+            m_mapped_buffers_cache.get()));
         driver_transfer_buffers.emplace_back(HailoRTDriver::TransferBuffer{
             mapped_buffer->handle(),
             transfer_buffer.offset(),
@@ -247,12 +400,13 @@ hailo_status BoundaryChannel::launch_transfer_impl(TransferRequest &&transfer_re
         // If we measure latency, we need an interrupt on the first descriptor for each H2D channel.
         first_desc_interrupts = InterruptsDomain::HOST;
     }
-    const auto last_desc_interrupts = InterruptsDomain::HOST;
+    const bool should_interrupt = should_interrupt_on_transfer();
+    const auto last_desc_interrupts = should_interrupt ? InterruptsDomain::HOST : InterruptsDomain::NONE;
 
     int num_processed = m_descs.tail();
     int num_free = m_descs.avail(num_available, num_processed);
     if (total_descs_count > num_free) {
-        return HAILO_OUT_OF_DESCRIPTORS;
+        return make_unexpected(HAILO_OUT_OF_DESCRIPTORS);
     }
 
     if (m_latency_meter) {
@@ -260,21 +414,21 @@ hailo_status BoundaryChannel::launch_transfer_impl(TransferRequest &&transfer_re
         m_pending_latency_measurements.push_back(m_direction == Direction::H2D ? first_desc : last_desc);
     }
     m_descs.enqueue(total_descs_count);
-
-    TRY_WITH_ACCEPTABLE_STATUS(HAILO_STREAM_ABORT, const auto desc_programmed, m_driver.launch_transfer(
-        m_channel_id,
-        m_desc_list.handle(),
-        num_available,
-        driver_transfer_buffers,
-        should_bind,
-        first_desc_interrupts,
-        last_desc_interrupts
-        ));
-    CHECK(total_descs_count == desc_programmed, HAILO_INTERNAL_FAILURE,
-        "Inconsistent desc programed expecting {} got {}", total_descs_count, desc_programmed);
-    m_ongoing_transfers.push_back(OngoingTransfer{std::move(transfer_request), last_desc});
-
-    return HAILO_SUCCESS;
+    m_transfers_since_interrupt = should_interrupt ? 0 : (m_transfers_since_interrupt + 1);
+
+    PreparedTransfer prepared{};
+    prepared.launch.channel_id = m_channel_id;
+    prepared.launch.desc_handle = m_desc_list.handle();
+    prepared.launch.starting_desc = num_available;
+    prepared.launch.transfer_buffers = std::move(driver_transfer_buffers);
+    prepared.launch.should_bind = should_bind;
+    prepared.launch.first_desc_interrupts = first_desc_interrupts;
+    prepared.launch.last_desc_interrupts = last_desc_interrupts;
+    prepared.launch.status = HAILO_UNINITIALIZED;
+    prepared.first_desc = first_desc;
+    prepared.last_desc = last_desc;
+    prepared.total_descs_count = total_descs_count;
+    return prepared;
 }
 
 hailo_status BoundaryChannel::bind_buffer(MappedBufferPtr buffer)
@@ -366,6 +520,13 @@ hailo_status BoundaryChannel::update_latency_meter()
     return HAILO_SUCCESS;
 }
 
+void BoundaryChannel::on_transfer_launched(TransferRequest &request)
+{
+    if ((Direction::H2D == m_direction) && (nullptr != request.control)) {
+        request.control->on_h2d_transfer_launched(std::chrono::steady_clock::now());
+    }
+}
+
 void BoundaryChannel::on_request_complete(std::unique_lock<std::mutex> &lock, TransferRequest &request,
     hailo_status complete_status)
 {
@@ -409,5 +570,131 @@ hailo_status BoundaryChannel::validate_bound_buffer(TransferRequest &transfer_re
     return HAILO_SUCCESS;
 }
 
+static thread_local TransferLaunchBatch *s_current_launch_batch = nullptr;
+
+TransferLaunchBatch::TransferLaunchBatch() :
+    m_driver(nullptr),
+    m_transfers(),
+    m_previous_batch(s_current_launch_batch)
+{
+    s_current_launch_batch = this;
+}
+
+TransferLaunchBatch::~TransferLaunchBatch()
+{
+    // Restore the previous batch first, callbacks called on flush may launch new transfers.
+    s_current_launch_batch = m_previous_batch;
+
+    auto status = flush();
+    if ((HAILO_SUCCESS != status) && (HAILO_STREAM_ABORT != status)) {
+        LOGGER__ERROR_RATE_LIMITED("Failed launching transfers batch, status {}", status);
+    }
+}
+
+TransferLaunchBatch *TransferLaunchBatch::current()
+{
+    return s_current_launch_batch;
+}
+
+void TransferLaunchBatch::add(BoundaryChannel &channel, BoundaryChannel::PreparedTransfer &&prepared,
+    TransferRequest &&request)
+{
+    assert(can_add(channel.m_driver));
+    m_driver = &channel.m_driver;
+
+    channel.m_deferred_batch = this;
+    channel.m_deferred_transfers_count++;
+    m_transfers.emplace_back(DeferredTransfer{&channel, std::move(prepared), std::move(request)});
+}
+
+hailo_status TransferLaunchBatch::flush()
+{
+    if (m_transfers.empty()) {
+        return HAILO_SUCCESS;
+    }
+
+    // Lock all channels of the batch. The channels are sorted, so concurrent batches lock them in the same order.
+    std::vector<BoundaryChannel*> channels;
+    channels.reserve(m_transfers.size());
+    for (const auto &transfer : m_transfers) {
+        channels.push_back(transfer.channel);
+    }
+    std::sort(channels.begin(), channels.end());
+    channels.erase(std::unique(channels.begin(), channels.end()), channels.end());
+
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(channels.size());
+    for (auto channel : channels) {
+        locks.emplace_back(channel->m_channel_mutex);
+    }
+
+    // Transfers on channels deactivated since the transfer was added are not launched.
+    std::vector<HailoRTDriver::TransferLaunch> launches;
+    launches.reserve(m_transfers.size());
+    for (const auto &transfer : m_transfers) {
+        if (transfer.channel->m_is_channel_activated) {
+            launches.emplace_back(transfer.prepared.launch);
+        }
+    }
+
+    auto status = HAILO_SUCCESS;
+    if (!launches.empty()) {
+        status = m_driver->launch_transfers(launches);
+    }
+
+    std::vector<std::pair<TransferRequest, hailo_status>> failed_requests;
+    std::vector<bool> launched(m_transfers.size(), false);
+    auto launch = launches.begin();
+    for (size_t i = 0; i < m_transfers.size(); i++) {
+        auto &transfer = m_transfers[i];
+        auto transfer_status = HAILO_STREAM_ABORT;
+        if (transfer.channel->m_is_channel_activated) {
+            // If a previous transfer failed, the rest are not launched (marked as HAILO_UNINITIALIZED).
+            transfer_status = (HAILO_UNINITIALIZED == launch->status) ? status : launch->status;
+            launched[i] = (HAILO_SUCCESS == transfer_status);
+            if (launched[i] && (transfer.prepared.total_descs_count != launch->descs_programed)) {
+                LOGGER__ERROR("Inconsistent desc programed expecting {} got {}", transfer.prepared.total_descs_count,
+                    launch->descs_programed);
+                transfer_status = HAILO_INTERNAL_FAILURE;
+            }
+            launch++;
+        }
+
+        if (HAILO_SUCCESS == transfer_status) {
+            transfer.channel->on_transfer_launched(transfer.request);
+            transfer.channel->m_ongoing_transfers.push_back(OngoingTransfer{std::move(transfer.request),
+                transfer.prepared.last_desc});
+        } else {
+            failed_requests.emplace_back(std::move(transfer.request), transfer_status);
+        }
+    }
+
+    // Release the descriptors of transfers that were not launched. On each channel, those are the last transfers,
+    // so going backwards leaves head at the first transfer that was not launched.
+    for (size_t i = m_transfers.size(); i > 0; i--) {
+        if (!launched[i - 1]) {
+            m_transfers[i - 1].channel->m_descs.set_head(m_transfers[i - 1].prepared.first_desc);
+        }
+    }
+
+    for (auto channel : channels) {
+        channel->m_deferred_batch = nullptr;
+        channel->m_deferred_transfers_count = 0;
+        if (!channel->m_pending_transfers.empty()) {
+            channel->launch_pending_transfers_async();
+        }
+    }
+
+    m_transfers.clear();
+    m_driver = nullptr;
+    locks.clear();
+
+    for (auto &failed_request : failed_requests) {
+        failed_request.first.callback(failed_request.second);
+    }
+
+    return status;
+}
+
 } /* namespace vdma */
 } /* namespace hailort */
@@ -16,6 +16,7 @@
 #include "stream_common/transfer_common.hpp"
 
 #include "common/latency_meter.hpp"
+#include "common/circular_buffer.hpp"
 
 #include "context_switch_defs.h"
 
@@ -31,19 +32,22 @@ struct OngoingTransfer {
 };
 
 class BoundaryChannel;
+class TransferLaunchBatch;
 using BoundaryChannelPtr = std::shared_ptr<BoundaryChannel>;
-class BoundaryChannel final
+class BoundaryChannel final : public TransferLauncher::Source
 {
 public:
     using Direction = HailoRTDriver::DmaDirection;
 
     static Expected<BoundaryChannelPtr> create(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
         vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher, size_t ongoing_transfers,
-        size_t pending_transfers = 0, const std::string &stream_name = "", LatencyMeterPtr latency_meter = nullptr);
+        size_t pending_transfers = 0, const std::string &stream_name = "", LatencyMeterPtr latency_meter = nullptr,
+        MappedBuffersCachePtr mapped_buffers_cache = nullptr);
 
     BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction, DescriptorList &&desc_list,
         TransferLauncher &transfer_launcher, size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
-        const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status);
+        const std::string &stream_name, LatencyMeterPtr latency_meter, MappedBuffersCachePtr mapped_buffers_cache,
+        hailo_status &status);
     BoundaryChannel(const BoundaryChannel &other) = delete;
     BoundaryChannel &operator=(const BoundaryChannel &other) = delete;
     BoundaryChannel(BoundaryChannel &&other) = delete;
@@ -73,6 +77,15 @@ public:
 
     hailo_status launch_transfer(TransferRequest &&transfer_request);
 
+    // Maps the transfer buffers into the mapped buffers cache ahead of launch_transfer (does nothing if the channel has
+    // no cache). May be called on an inactive channel.
+    hailo_status prefetch_mappings(TransferRequest &transfer_request);
+
+    // Configures interrupts coalescing for the channel - an interrupt is requested only once every max_transfers
+    // transfers, and the driver reports the completion of transfers launched without interrupt after timeout_us.
+    // Should be called before the channel is activated. Ignored (with a warning) if the driver doesn't support it.
+    hailo_status set_interrupts_coalescing(const hailo_stream_interrupts_coalescing_params_t &params);
+
     // To avoid buffer bindings, one can call this function to statically bind a full buffer to the channel. The buffer
     // size should be exactly desc_page_size() * descs_count() of current descriptors list.
     hailo_status bind_buffer(MappedBufferPtr buffer);
@@ -100,12 +113,32 @@ public:
 
     bool should_measure_timestamp() const { return m_latency_meter != nullptr; }
 
+    // Called by the transfer launcher, launches the pending transfers for which there is room in the channel.
+    virtual void launch_pending_transfers() override;
+
 private:
+    friend class TransferLaunchBatch;
+
+    struct PreparedTransfer {
+        HailoRTDriver::TransferLaunch launch;
+        uint16_t first_desc;
+        uint16_t last_desc;
+        uint16_t total_descs_count;
+    };
+
     hailo_status update_latency_meter();
 
+    // Records the launch time of input transfers on their infer request's control (see InferRequestControl)
+    void on_transfer_launched(TransferRequest &request);
     void on_request_complete(std::unique_lock<std::mutex> &lock, TransferRequest &request,
         hailo_status complete_status);
     hailo_status launch_transfer_impl(TransferRequest &&transfer_request);
+    Expected<PreparedTransfer> prepare_transfer(TransferRequest &transfer_request);
+    bool can_launch_on_user_thread() const;
+    bool should_defer_to_batch(TransferLaunchBatch *batch) const;
+    bool should_interrupt_on_transfer() const;
+    void launch_pending_transfers_async();
+    size_t transfer_launcher_key() const;
 
     static bool is_desc_between(uint16_t begin, uint16_t end, uint16_t desc);
     hailo_status validate_bound_buffer(TransferRequest &transfer_request);
@@ -149,6 +182,66 @@ private:
 
     // When bind_buffer is called, we keep a reference to the buffer here. This is used to avoid buffer bindings.
     std::shared_ptr<MappedBuffer> m_bounded_buffer;
+
+    // If not null, user buffers are mapped through the cache (instead of being mapped on each transfer).
+    MappedBuffersCachePtr m_mapped_buffers_cache;
+
+    // Interrupts coalescing - m_coalescing_max_transfers <= 1 means an interrupt is requested on each transfer.
+    uint32_t m_coalescing_max_transfers;
+    std::chrono::microseconds m_coalescing_timeout;
+    // Amount of transfers launched since the last transfer that requested an interrupt.
+    uint32_t m_transfers_since_interrupt;
+
+    // Transfers that were prepared (their descriptors are already reserved in m_descs), but are waiting to be launched
+    // by the TransferLaunchBatch they were added to. While there are deferred transfers, other transfers are queued
+    // to m_pending_transfers in order to preserve the transfers order.
+    TransferLaunchBatch *m_deferred_batch;
+    size_t m_deferred_transfers_count;
+};
+
+// Collects the transfers launched from the current thread on boundary channels of a single device, and launches
+// all of them using a single HailoRTDriver::launch_transfers call when flushed (or on destruction).
+// Used to submit all streams of a single infer request in one kernel crossing.
+// Note: Transfers are deferred only if they could have been launched directly on the user's thread, otherwise the
+//       regular flow (via the pending transfers queue) is used.
+class TransferLaunchBatch final
+{
+public:
+    TransferLaunchBatch();
+    ~TransferLaunchBatch();
+
+    TransferLaunchBatch(const TransferLaunchBatch &other) = delete;
+    TransferLaunchBatch &operator=(const TransferLaunchBatch &other) = delete;
+    TransferLaunchBatch(TransferLaunchBatch &&other) = delete;
+    TransferLaunchBatch &operator=(TransferLaunchBatch &&other) = delete;
+
+    // Launches all deferred transfers. Transfers that failed to launch are completed (their callback is called) with
+    // the failure status.
+    hailo_status flush();
+
+    // Returns the batch active on the current thread (nullptr if there is none).
+    static TransferLaunchBatch *current();
+
+private:
+    friend class BoundaryChannel;
+
+    struct DeferredTransfer {
+        BoundaryChannel *channel;
+        BoundaryChannel::PreparedTransfer prepared;
+        TransferRequest request;
+    };
+
+    bool can_add(const HailoRTDriver &driver) const
+    {
+        return (nullptr == m_driver) || (&driver == m_driver);
+    }
+
+    // Assumes that the channel's m_channel_mutex is locked!
+    void add(BoundaryChannel &channel, BoundaryChannel::PreparedTransfer &&prepared, TransferRequest &&request);
+
+    HailoRTDriver *m_driver;
+    std::vector<DeferredTransfer> m_transfers;
+    TransferLaunchBatch *m_previous_batch;
 };
 
 } /* namespace vdma */
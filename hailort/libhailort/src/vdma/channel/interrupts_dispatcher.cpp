@@ -14,15 +14,29 @@
 namespace hailort {
 namespace vdma {
 
-Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver)
+Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver,
+    hailo_interrupts_wait_mode_t wait_mode, std::chrono::microseconds polling_idle_budget, uint64_t cpu_affinity_mask,
+    uint32_t realtime_priority)
 {
-    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver);
+    CHECK_AS_EXPECTED((HAILO_INTERRUPTS_WAIT_MODE_BLOCKING == wait_mode) ||
+        (HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING == wait_mode), HAILO_INVALID_ARGUMENT,
+        "Invalid interrupts wait mode {}", static_cast<int>(wait_mode));
+
+    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver, wait_mode, polling_idle_budget, cpu_affinity_mask,
+        realtime_priority);
     CHECK_NOT_NULL_AS_EXPECTED(thread, HAILO_OUT_OF_HOST_MEMORY);
     return thread;
 }
 
-InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver) :
+InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver,
+    hailo_interrupts_wait_mode_t wait_mode, std::chrono::microseconds polling_idle_budget, uint64_t cpu_affinity_mask,
+    uint32_t realtime_priority) :
     m_driver(driver),
+    m_wait_mode(wait_mode),
+    m_polling_idle_budget(polling_idle_budget),
+    m_cpu_affinity_mask(cpu_affinity_mask),
+    m_realtime_priority(realtime_priority),
+    m_should_stop_polling(false),
     m_interrupts_thread([this] { wait_interrupts(); })
 {}
 
@@ -51,6 +65,7 @@ hailo_status InterruptsDispatcher::start(const ChannelsBitmap &channels_bitmap,
         auto wait_context = make_unique_nothrow<WaitContext>(WaitContext{channels_bitmap, process_irq});
         CHECK_NOT_NULL(wait_context, HAILO_OUT_OF_HOST_MEMORY);
         m_wait_context = std::move(wait_context);
+        m_should_stop_polling = false;
 
         auto status = m_driver.get().vdma_enable_channels(m_wait_context->bitmap, enable_timestamp_measure);
         CHECK_SUCCESS(status, "Failed to enable vdma channels");
@@ -80,6 +95,7 @@ hailo_status InterruptsDispatcher::stop()
     // Nullify wait context so the thread will pause
     const auto bitmap = m_wait_context->bitmap;
     m_wait_context = nullptr;
+    m_should_stop_polling = true;
 
     // Calling disable interrupts will cause the vdma_interrupts_wait to return.
     auto status = m_driver.get().vdma_disable_channels(bitmap);
@@ -95,7 +111,30 @@ hailo_status InterruptsDispatcher::stop()
 
 void InterruptsDispatcher::wait_interrupts()
 {
-    OsUtils::set_current_thread_name("CHANNEL_INTR");
+    OsUtils::set_current_thread_name("HRT_INTERRUPTS");
+
+    const auto numa_node = m_driver.get().numa_node();
+    if (0 != m_cpu_affinity_mask) {
+        auto status = OsUtils::set_current_thread_cpu_mask(m_cpu_affinity_mask);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting interrupts thread affinity to cpu mask 0x{:x}, status {}",
+                m_cpu_affinity_mask, status);
+        }
+    } else if (HailoRTDriver::UNKNOWN_NUMA_NODE != numa_node) {
+        // Run near the device (the irq data is written by the driver on the device local node).
+        auto status = OsUtils::set_current_thread_numa_affinity(numa_node);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting interrupts thread affinity to numa node {}, status {}", numa_node, status);
+        }
+    }
+
+    if (0 != m_realtime_priority) {
+        auto status = OsUtils::set_current_thread_realtime_priority(m_realtime_priority);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting interrupts thread real-time priority {}, status {}", m_realtime_priority,
+                status);
+        }
+    }
 
     std::unique_lock<std::mutex> lock(m_mutex);
     while (true) {
@@ -115,8 +154,11 @@ void InterruptsDispatcher::wait_interrupts()
         //   1. We got a new interrupts, irq_data will be passed to the process_irq callback
         //   2. vdma_disable_channels will be called, vdma_interrupts_wait will return with an empty list.
         //   3. Other error returns - shouldn't really happen, we exit the interrupt thread.
+        // On polling mode, poll_interrupts behaves the same, only it spins before blocking.
         lock.unlock();
-        auto irq_data = m_driver.get().vdma_interrupts_wait(wait_context.bitmap);
+        auto irq_data = (HAILO_INTERRUPTS_WAIT_MODE_ADAPTIVE_POLLING == m_wait_mode) ?
+            poll_interrupts(wait_context.bitmap) :
+            m_driver.get().vdma_interrupts_wait(wait_context.bitmap);
         lock.lock();
 
         if (!irq_data.has_value()) {
@@ -130,6 +172,31 @@ void InterruptsDispatcher::wait_interrupts()
     }
 }
 
+Expected<IrqData> InterruptsDispatcher::poll_interrupts(const ChannelsBitmap &bitmap)
+{
+    const auto polling_start = std::chrono::steady_clock::now();
+    while (m_is_polling_supported && !m_should_stop_polling) {
+        auto irq_data = m_driver.get().vdma_interrupts_poll(bitmap);
+        if (HAILO_NOT_SUPPORTED == irq_data.status()) {
+            LOGGER__INFO("Driver doesn't support vdma interrupts polling, using blocking wait");
+            m_is_polling_supported = false;
+            break;
+        }
+
+        if (!irq_data.has_value() || (irq_data->channels_count > 0)) {
+            return irq_data;
+        }
+
+        if ((std::chrono::steady_clock::now() - polling_start) >= m_polling_idle_budget) {
+            // Idle for too long, stop burning cpu until the next interrupt.
+            break;
+        }
+    }
+
+    // If stop() was called, the channels are disabled and the wait returns immediately with an empty list.
+    return m_driver.get().vdma_interrupts_wait(bitmap);
+}
+
 void InterruptsDispatcher::signal_thread_quit()
 {
     {
@@ -14,6 +14,8 @@
 #include "vdma/channel/channels_group.hpp"
 
 #include <thread>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <condition_variable>
 
@@ -26,8 +28,14 @@ public:
     // The actual irq process callback, should run quickly (blocks the interrupts thread).
     using ProcessIrqCallback = std::function<void(IrqData &&irq_data)>;
 
-    static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver);
-    explicit InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver);
+    // The thread is pinned to the cpus in cpu_affinity_mask, or if it is 0, placed on the device numa node (if it is
+    // known). If realtime_priority isn't 0, the thread runs with a real-time policy at that priority.
+    static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver,
+        hailo_interrupts_wait_mode_t wait_mode = HAILO_INTERRUPTS_WAIT_MODE_BLOCKING,
+        std::chrono::microseconds polling_idle_budget = std::chrono::microseconds(HAILO_DEFAULT_INTERRUPTS_POLLING_IDLE_BUDGET_US),
+        uint64_t cpu_affinity_mask = 0, uint32_t realtime_priority = 0);
+    InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver, hailo_interrupts_wait_mode_t wait_mode,
+        std::chrono::microseconds polling_idle_budget, uint64_t cpu_affinity_mask, uint32_t realtime_priority);
     ~InterruptsDispatcher();
 
     InterruptsDispatcher(const InterruptsDispatcher &) = delete;
@@ -45,6 +53,9 @@ private:
     void wait_interrupts();
     void signal_thread_quit();
 
+    // Polls the driver until an interrupt arrives, falling back to a blocking wait once the idle budget is exhausted.
+    Expected<IrqData> poll_interrupts(const ChannelsBitmap &bitmap);
+
     struct WaitContext {
         ChannelsBitmap bitmap;
         ProcessIrqCallback process_irq;
@@ -63,6 +74,15 @@ private:
 
     const std::reference_wrapper<HailoRTDriver> m_driver;
 
+    const hailo_interrupts_wait_mode_t m_wait_mode;
+    const std::chrono::microseconds m_polling_idle_budget;
+    const uint64_t m_cpu_affinity_mask;
+    const uint32_t m_realtime_priority;
+    // Accessed only by the interrupts thread, cleared if the driver doesn't support polling.
+    bool m_is_polling_supported = true;
+    // Set by stop() so the polling loop will exit without waiting for the idle budget.
+    std::atomic_bool m_should_stop_polling;
+
     ThreadState m_thread_state = ThreadState::not_active;
     // When m_wait_context is not nullptr, the thread should start waiting for interrupts.
     std::unique_ptr<WaitContext> m_wait_context;
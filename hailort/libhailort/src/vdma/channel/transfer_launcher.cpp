@@ -1,123 +1,203 @@
-/**
- * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
- * Distributed under the MIT license (https://opensource.org/licenses/MIT)
-**/
-/**
- * @file transfer_launcher.cpp
- * @brief Manages a thread that launches non-bound async vdma read/writes
- **/
-
-#include "transfer_launcher.hpp"
-#include "common/utils.hpp"
-#include "common/os_utils.hpp"
-
-namespace hailort {
-namespace vdma {
-
-Expected<std::unique_ptr<TransferLauncher>> TransferLauncher::create()
-{
-    auto thread = make_unique_nothrow<TransferLauncher>();
-    CHECK_NOT_NULL_AS_EXPECTED(thread, HAILO_OUT_OF_HOST_MEMORY);
-    return thread;
-}
-
-TransferLauncher::TransferLauncher() :
-    m_mutex(),
-    m_cond(),
-    m_queue(),
-    m_should_quit(false),
-    m_thread_active(false),
-    m_worker_thread([this] { worker_thread(); })
-{}
-
-TransferLauncher::~TransferLauncher()
-{
-    const auto status = stop();
-    if (status != HAILO_SUCCESS) {
-        LOGGER__ERROR("Failed stopping transfer launcher thread on destructor");
-    }
-
-    if (m_worker_thread.joinable()) {
-        signal_thread_quit();
-        m_worker_thread.join();
-    }
-}
-
-hailo_status TransferLauncher::enqueue_transfer(Transfer &&transfer)
-{
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.emplace(std::move(transfer));
-    }
-
-    m_cond.notify_one();
-    return HAILO_SUCCESS;
-}
-
-hailo_status TransferLauncher::start()
-{
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        CHECK(!m_thread_active, HAILO_INVALID_OPERATION, "Transfer launcher thread already running");
-
-        m_thread_active = true;
-    }
-    m_cond.notify_one();
-
-    return HAILO_SUCCESS;
-}
-
-hailo_status TransferLauncher::stop()
-{
-    std::unique_lock<std::mutex> lock(m_mutex);
-
-    if (!m_thread_active) {
-        // Already stopped
-        return HAILO_SUCCESS;
-    }
-
-    m_thread_active = false;
-
-    while (!m_queue.empty()) {
-        // No need signal that the transfer was aborted, it'll be done in BoundaryChannel::cancel_pending_transfers
-        m_queue.pop();
-    }
-
-    // TODO: Keep stop flow used in interrupt thread? (HRT-13110)
-    //       E.g. look for comment "The wait is needed because otherwise, on a fast stop()..."
-
-    return HAILO_SUCCESS;
-}
-
-void TransferLauncher::worker_thread()
-{
-    OsUtils::set_current_thread_name("TRANSFR_LNCH");
-
-    while (true) {
-        Transfer transfer;
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_cond.wait(lock, [this] { return m_should_quit || (!m_queue.empty() && m_thread_active); });
-            if (m_should_quit) {
-                return;
-            }
-
-            // There's work to do
-            transfer = std::move(m_queue.front());
-            m_queue.pop();
-        }
-        transfer();
-    }
-}
-
-void TransferLauncher::signal_thread_quit()
-{
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_should_quit = true;
-    }
-    m_cond.notify_all();
-}
-
-} /* namespace vdma */
-} /* namespace hailort */
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file transfer_launcher.cpp
+ * @brief Manages a pool of threads that launch non-bound async vdma read/writes
+ **/
+
+#include "transfer_launcher.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+namespace hailort {
+namespace vdma {
+
+Expected<std::unique_ptr<TransferLauncher>> TransferLauncher::create(size_t workers_count, uint64_t cpu_affinity_mask,
+    int numa_node, uint32_t realtime_priority)
+{
+    CHECK_AS_EXPECTED(workers_count > 0, HAILO_INVALID_ARGUMENT, "Transfer launcher workers count must be larger than 0");
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto thread = make_unique_nothrow<TransferLauncher>(workers_count, cpu_affinity_mask, numa_node,
+        realtime_priority, status);
+    CHECK_NOT_NULL_AS_EXPECTED(thread, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating transfer launcher");
+    return thread;
+}
+
+TransferLauncher::TransferLauncher(size_t workers_count, uint64_t cpu_affinity_mask, int numa_node,
+    uint32_t realtime_priority, hailo_status &status) :
+    m_cpu_affinity_mask(cpu_affinity_mask),
+    m_numa_node(numa_node),
+    m_realtime_priority(realtime_priority),
+    m_should_quit(false),
+    m_thread_active(false),
+    m_workers()
+{
+    m_workers.reserve(workers_count);
+    for (size_t i = 0; i < workers_count; i++) {
+        auto worker = make_unique_nothrow<Worker>();
+        if (nullptr == worker) {
+            LOGGER__ERROR("Failed allocating transfer launcher worker");
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        m_workers.emplace_back(std::move(worker));
+    }
+
+    // The threads are created after all workers are constructed, since the workers vector must not change while the
+    // threads are running.
+    for (size_t i = 0; i < workers_count; i++) {
+        auto &worker = *m_workers[i];
+        worker.thread = std::thread([this, &worker, i] { worker_thread(worker, i); });
+    }
+
+    status = HAILO_SUCCESS;
+}
+
+TransferLauncher::~TransferLauncher()
+{
+    const auto status = stop();
+    if (status != HAILO_SUCCESS) {
+        LOGGER__ERROR("Failed stopping transfer launcher thread on destructor");
+    }
+
+    signal_thread_quit();
+    for (auto &worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+hailo_status TransferLauncher::enqueue_transfer(Source &source, size_t key)
+{
+    if (source.m_is_queued.exchange(true)) {
+        // The source is already queued, and will launch all of its pending transfers once handled.
+        return HAILO_SUCCESS;
+    }
+
+    auto &worker = *m_workers[key % m_workers.size()];
+    // queued_count is increased before the push, so the worker won't miss the source (it retries popping while
+    // queued_count > 0).
+    worker.queued_count++;
+    worker.queue.push(source);
+
+    if (worker.is_sleeping) {
+        // Locking the mutex makes sure the worker is either before checking queued_count or already waiting.
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.cond.notify_one();
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status TransferLauncher::start()
+{
+    CHECK(!m_thread_active.exchange(true), HAILO_INVALID_OPERATION, "Transfer launcher thread already running");
+    return HAILO_SUCCESS;
+}
+
+hailo_status TransferLauncher::stop()
+{
+    if (!m_thread_active.exchange(false)) {
+        // Already stopped
+        return HAILO_SUCCESS;
+    }
+
+    // Sources queued while the launcher is stopped are discarded by the workers (no need signal that the transfers
+    // were aborted, it'll be done in BoundaryChannel::cancel_pending_transfers). We wait for the queues to drain, so
+    // no source is referenced by the launcher once stop() returns.
+    for (auto &worker : m_workers) {
+        std::unique_lock<std::mutex> lock(worker->mutex);
+        worker->drained_cond.wait(lock, [&worker] { return 0 == worker->queued_count; });
+    }
+
+    return HAILO_SUCCESS;
+}
+
+void TransferLauncher::worker_thread(Worker &worker, size_t worker_index)
+{
+    OsUtils::set_current_thread_name("HRT_LAUNCH_" + std::to_string(worker_index));
+    set_worker_affinity(worker_index);
+    if (0 != m_realtime_priority) {
+        auto status = OsUtils::set_current_thread_realtime_priority(m_realtime_priority);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed setting transfer launcher thread real-time priority {}, status {}",
+                m_realtime_priority, status);
+        }
+    }
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.is_sleeping = true;
+            worker.cond.wait(lock, [this, &worker] { return m_should_quit || (worker.queued_count > 0); });
+            worker.is_sleeping = false;
+            if (m_should_quit) {
+                return;
+            }
+        }
+
+        while (worker.queued_count > 0) {
+            auto source = worker.queue.pop();
+            if (nullptr == source) {
+                // Some producer is in the middle of a push
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Cleared before launching, so transfers added while launching will queue the source again.
+            source->m_is_queued = false;
+            if (m_thread_active) {
+                source->launch_pending_transfers();
+            }
+
+            if (1 == worker.queued_count.fetch_sub(1)) {
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                worker.drained_cond.notify_all();
+            }
+        }
+    }
+}
+
+void TransferLauncher::set_worker_affinity(size_t worker_index)
+{
+    if (0 == m_cpu_affinity_mask) {
+        if (HailoRTDriver::UNKNOWN_NUMA_NODE != m_numa_node) {
+            auto status = OsUtils::set_current_thread_numa_affinity(m_numa_node);
+            if (HAILO_SUCCESS != status) {
+                LOGGER__WARNING("Failed setting transfer launcher thread affinity to numa node {}, status {}",
+                    m_numa_node, status);
+            }
+        }
+        return;
+    }
+
+    // Worker i is pinned to the i-th cpu set in the mask (wrapping around if there are more workers than cpus).
+    std::vector<uint8_t> cpus;
+    for (uint8_t cpu = 0; cpu < (sizeof(m_cpu_affinity_mask) * 8); cpu++) {
+        if (m_cpu_affinity_mask & (1ULL << cpu)) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    const auto cpu_index = cpus[worker_index % cpus.size()];
+    const auto status = OsUtils::set_current_thread_affinity(cpu_index);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__WARNING("Failed setting transfer launcher thread affinity to cpu {}, status {}", cpu_index, status);
+    }
+}
+
+void TransferLauncher::signal_thread_quit()
+{
+    m_should_quit = true;
+    for (auto &worker : m_workers) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->cond.notify_all();
+    }
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
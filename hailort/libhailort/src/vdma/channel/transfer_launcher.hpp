@@ -1,61 +1,94 @@
-/**
- * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
- * Distributed under the MIT license (https://opensource.org/licenses/MIT)
-**/
-/**
- * @file transfer_launcher.hpp
- * @brief Manages a thread that launches non-bound async vdma read/writes
- **/
-
-#ifndef _HAILO_TRANSFER_LAUNCHER_HPP_
-#define _HAILO_TRANSFER_LAUNCHER_HPP_
-
-#include "hailo/hailort.h"
-#include "hailo/expected.hpp"
-
-#include <memory>
-#include <functional>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
-#include <queue>
-
-namespace hailort {
-namespace vdma {
-
-class TransferLauncher final
-{
-public:
-    using Transfer = std::function<void()>;
-
-    static Expected<std::unique_ptr<TransferLauncher>> create();
-    TransferLauncher();
-    ~TransferLauncher();
-
-    TransferLauncher(TransferLauncher &&) = delete;
-    TransferLauncher(const TransferLauncher &) = delete;
-    TransferLauncher &operator=(TransferLauncher &&) = delete;
-    TransferLauncher &operator=(const TransferLauncher &) = delete;
-
-    hailo_status enqueue_transfer(Transfer &&transfer);
-    hailo_status start();
-    hailo_status stop();
-
-private:
-    void worker_thread();
-    void signal_thread_quit();
-
-    std::mutex m_mutex;
-    std::condition_variable m_cond;
-    // TODO: use SpscQueue (HRT-10554)
-    std::queue<Transfer> m_queue;
-    // m_should_quit is used to quit the thread (called on destruction)
-    bool m_should_quit;
-    bool m_thread_active;
-    std::thread m_worker_thread;
-};
-
-} /* namespace vdma */
-} /* namespace hailort */
-
-#endif /* _HAILO_TRANSFER_LAUNCHER_HPP_ */
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file transfer_launcher.hpp
+ * @brief Manages a pool of threads that launch non-bound async vdma read/writes
+ **/
+
+#ifndef _HAILO_TRANSFER_LAUNCHER_HPP_
+#define _HAILO_TRANSFER_LAUNCHER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "utils/thread_safe_queue.hpp"
+#include "vdma/driver/hailort_driver.hpp"
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace hailort {
+namespace vdma {
+
+class TransferLauncher final
+{
+public:
+    // Object that has pending transfers to launch (e.g. BoundaryChannel). The source is queued intrusively, so
+    // enqueueing it doesn't allocate memory. A source that is already queued isn't queued again - launch_pending_transfers
+    // should launch all transfers that can be launched.
+    class Source : public MpscQueueNode
+    {
+    public:
+        Source() : m_is_queued(false) {}
+        virtual ~Source() = default;
+
+        virtual void launch_pending_transfers() = 0;
+
+    private:
+        friend class TransferLauncher;
+        std::atomic_bool m_is_queued;
+    };
+
+    // If cpu_affinity_mask is 0, the workers are placed on numa_node (if it is known). If realtime_priority isn't 0, the
+    // workers run with a real-time policy at that priority.
+    static Expected<std::unique_ptr<TransferLauncher>> create(size_t workers_count = 1, uint64_t cpu_affinity_mask = 0,
+        int numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE, uint32_t realtime_priority = 0);
+    TransferLauncher(size_t workers_count, uint64_t cpu_affinity_mask, int numa_node, uint32_t realtime_priority,
+        hailo_status &status);
+    ~TransferLauncher();
+
+    TransferLauncher(TransferLauncher &&) = delete;
+    TransferLauncher(const TransferLauncher &) = delete;
+    TransferLauncher &operator=(TransferLauncher &&) = delete;
+    TransferLauncher &operator=(const TransferLauncher &) = delete;
+
+    // Sources with the same key are always handled by the same worker (in order to keep the launch order of a source).
+    hailo_status enqueue_transfer(Source &source, size_t key);
+    hailo_status start();
+    hailo_status stop();
+
+private:
+    struct Worker {
+        IntrusiveMpscQueue<Source> queue;
+        // Amount of sources pushed to the queue and not yet handled by the worker.
+        std::atomic<size_t> queued_count{0};
+        std::atomic_bool is_sleeping{false};
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::condition_variable drained_cond;
+        std::thread thread;
+    };
+
+    void worker_thread(Worker &worker, size_t worker_index);
+    void set_worker_affinity(size_t worker_index);
+    void signal_thread_quit();
+
+    const uint64_t m_cpu_affinity_mask;
+    const int m_numa_node;
+    const uint32_t m_realtime_priority;
+    // m_should_quit is used to quit the threads (called on destruction)
+    std::atomic_bool m_should_quit;
+    std::atomic_bool m_thread_active;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSFER_LAUNCHER_HPP_ */
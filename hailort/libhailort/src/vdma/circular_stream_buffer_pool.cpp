@@ -43,31 +43,36 @@ CircularStreamBufferPool::CircularStreamBufferPool(size_t desc_page_size, size_t
         m_transfer_size(transfer_size),
         m_base_buffer(std::move(base_buffer)),
         m_mappings(std::move(mappings)),
-        m_queue(static_cast<int>(descs_count)),
+        m_descs_count(descs_count),
+        m_descs_count_mask(descs_count - 1),
+        m_head(),
+        m_tail(),
         m_next_enqueue_desc_offset(0)
 {
     assert(is_powerof2(descs_count) && (descs_count > 0));
     assert(m_base_buffer.size() == (m_desc_page_size * descs_count));
-    m_queue.set_head(static_cast<int>(descs_count) - 1);
+    reset_pointers();
 }
 
 size_t CircularStreamBufferPool::max_queue_size() const
 {
-    return (m_queue.size() - 1) / DIV_ROUND_UP(m_transfer_size, m_desc_page_size);
+    return (m_descs_count - 1) / DIV_ROUND_UP(m_transfer_size, m_desc_page_size);
 }
 
 size_t CircularStreamBufferPool::buffers_ready_to_dequeue() const
 {
-    const size_t descs_available = m_queue.prog(m_queue.head(), m_queue.tail());
-    return descs_available / descs_in_transfer();
+    return descs_ready_to_dequeue() / descs_in_transfer();
 }
 
 Expected<TransferBuffer> CircularStreamBufferPool::dequeue()
 {
     CHECK_AS_EXPECTED(buffers_ready_to_dequeue() > 0, HAILO_INTERNAL_FAILURE, "CircularStreamBufferPool is empty");
 
-    const size_t offset_in_buffer = m_queue.tail() * m_desc_page_size;
-    m_queue.dequeue(static_cast<int>(descs_in_transfer()));
+    // Only the consumer writes m_tail
+    const auto tail = m_tail.value.load(std::memory_order_relaxed);
+    const size_t offset_in_buffer = (tail & m_descs_count_mask) * m_desc_page_size;
+    // Release, so the producer sees the new tail only after the dequeue is done.
+    m_tail.value.store(tail + descs_in_transfer(), std::memory_order_release);
     return TransferBuffer {
         MemoryView(m_base_buffer),
         m_transfer_size,
@@ -78,7 +83,10 @@ Expected<TransferBuffer> CircularStreamBufferPool::dequeue()
 hailo_status CircularStreamBufferPool::enqueue(TransferBuffer &&buffer_info)
 {
     const size_t descs_required = descs_in_transfer();
-    const size_t descs_available = m_queue.avail(m_queue.head(), m_queue.tail());
+    // Only the producer writes m_head
+    const auto head = m_head.value.load(std::memory_order_relaxed);
+    const auto tail = m_tail.value.load(std::memory_order_acquire);
+    const size_t descs_available = (m_descs_count - 1) - (head - tail);
     CHECK(descs_available >= descs_required, HAILO_INTERNAL_FAILURE, "Can enqueue without previous dequeue");
     TRY(auto base_buffer, buffer_info.base_buffer());
     CHECK(base_buffer.data() == m_base_buffer.data(), HAILO_INTERNAL_FAILURE, "Got the wrong buffer");
@@ -90,15 +98,17 @@ hailo_status CircularStreamBufferPool::enqueue(TransferBuffer &&buffer_info)
         "Out of order enqueue is not supported in CircularStreamBufferPool. Got offset {}, expected {}",
         buffer_info.offset(), expected_offset);
 
-    m_queue.enqueue(static_cast<int>(descs_required));
-    m_next_enqueue_desc_offset = (m_next_enqueue_desc_offset + descs_required) & m_queue.size_mask();
+    // Release, so the consumer sees the buffer only after it was returned.
+    m_head.value.store(head + descs_required, std::memory_order_release);
+    m_next_enqueue_desc_offset = (m_next_enqueue_desc_offset + descs_required) & m_descs_count_mask;
     return HAILO_SUCCESS;
 }
 
 void CircularStreamBufferPool::reset_pointers()
 {
-    m_queue.reset();
-    m_queue.set_head(static_cast<int>(m_queue.size()) - 1);
+    // All buffers are ready to dequeue (one desc is kept free, to tell a full pool from an empty one).
+    m_tail.value.store(0);
+    m_head.value.store(m_descs_count - 1);
     m_next_enqueue_desc_offset = 0;
 }
 
@@ -112,6 +122,13 @@ Expected<Buffer> CircularStreamBufferPool::allocate_buffer(VdmaDevice &device, s
     return Buffer::create(dma_storage);
 }
 
+size_t CircularStreamBufferPool::descs_ready_to_dequeue() const
+{
+    const auto tail = m_tail.value.load(std::memory_order_relaxed);
+    const auto head = m_head.value.load(std::memory_order_acquire);
+    return head - tail;
+}
+
 size_t CircularStreamBufferPool::descs_in_transfer() const
 {
     assert(IS_FIT_IN_UINT16(m_desc_page_size));
@@ -11,12 +11,12 @@
 #define _HAILO_CIRCULAR_STREAM_BUFFER_POOL_HPP_
 
 #include "vdma/memory/mapped_buffer.hpp"
-#include "common/circular_buffer.hpp"
 #include "stream_common/stream_buffer_pool.hpp"
 #include "vdma/vdma_device.hpp"
 #include "hailo/dma_mapped_buffer.hpp"
 
 #include <condition_variable>
+#include <atomic>
 
 
 namespace hailort
@@ -25,8 +25,7 @@ namespace hailort
 // A buffer pool taken from a single virtually continuous buffer.
 // The buffer are dequeued in a circular way.
 // This class can be used in multiple threads without any lock if there is only one consumer (calls dequeue and
-// buffers_ready_to_dequeue)
-// and one producer (calls enqueue).
+// buffers_ready_to_dequeue) and one producer (calls enqueue).
 class CircularStreamBufferPool final : public StreamBufferPool {
 public:
     static Expected<std::unique_ptr<CircularStreamBufferPool>> create(VdmaDevice &device,
@@ -56,21 +55,35 @@ private:
 
     const size_t m_transfer_size;
 
-    // m_mapped_buffer.size() must be m_queue.size() * m_desc_page_size
+    // m_mapped_buffer.size() must be m_descs_count * m_desc_page_size
     Buffer m_base_buffer;
     DmaMappedBuffer m_mappings;
 
-    // Head/tail based queue that manages the buffer pool.
-    // The head and tail are in m_desc_page_size granularity.
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Each index is written by a single thread, and is padded to its own cache line (so the producer and the consumer
+    // won't bounce the same line on each enqueue/dequeue).
+    struct PaddedIndex {
+        std::atomic_size_t value;
+        uint8_t padding[CACHE_LINE_SIZE - sizeof(std::atomic_size_t)];
+    };
+
+    size_t descs_ready_to_dequeue() const;
+
+    // Head/tail based queue that manages the buffer pool. The head and tail are free running counters (the position
+    // in the buffer is the counter & m_descs_count_mask) in m_desc_page_size granularity.
     //
-    // If m_queue.head() == m_queue.tail() the pool is empty.
+    // If m_head == m_tail the pool is empty.
     // Otherwise, the buffers that can be in use starts from
-    //   m_queue.tail() * m_desc_page_size (inclusive)
+    //   (m_tail & m_descs_count_mask) * m_desc_page_size (inclusive)
     // until
-    //   m_queue.head() * m_desc_page_size (exclusive)
-    CircularBuffer<IsPow2Tag> m_queue;
+    //   (m_head & m_descs_count_mask) * m_desc_page_size (exclusive)
+    const size_t m_descs_count;
+    const size_t m_descs_count_mask;
+    PaddedIndex m_head; // Written by the producer (enqueue)
+    PaddedIndex m_tail; // Written by the consumer (dequeue)
 
-    // Used to validate that the buffers are enqueued in order.
+    // Used to validate that the buffers are enqueued in order. Accessed only by the producer.
     size_t m_next_enqueue_desc_offset;
 };
 
@@ -213,7 +213,10 @@ static hailo_status validate_driver_version(const hailo_driver_info &driver_info
 HailoRTDriver::HailoRTDriver(const std::string &device_id, FileDescriptor &&fd, hailo_status &status) :
     m_fd(std::move(fd)),
     m_device_id(device_id),
-    m_allocate_driver_buffer(false)
+    m_allocate_driver_buffer(false),
+    m_numa_node(query_device_numa_node(device_id)),
+    m_is_launch_transfers_supported(true),
+    m_is_desc_list_program_batch_supported(true)
 {
     hailo_driver_info driver_info{};
     auto err = run_ioctl(HAILO_QUERY_DRIVER_INFO, &driver_info);
@@ -381,6 +384,24 @@ hailo_status HailoRTDriver::vdma_disable_channels(const ChannelsBitmap &channels
     return HAILO_SUCCESS;
 }
 
+hailo_status HailoRTDriver::vdma_set_interrupts_coalescing(vdma::ChannelId channel_id,
+    std::chrono::microseconds timeout)
+{
+    CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
+    CHECK(IS_FIT_IN_UINT32(timeout.count()), HAILO_INVALID_ARGUMENT, "Invalid interrupts coalescing timeout");
+    hailo_vdma_interrupts_coalescing_params params{};
+    params.engine_index = channel_id.engine_index;
+    params.channel_index = channel_id.channel_index;
+    params.timeout_us = static_cast<uint32_t>(timeout.count());
+
+    int err = run_ioctl(HAILO_VDMA_SET_INTERRUPTS_COALESCING, &params);
+    if (ENOTTY == err) {
+        return HAILO_NOT_SUPPORTED;
+    }
+    CHECK_IOCTL_RESULT(err, "Failed set interrupts coalescing");
+    return HAILO_SUCCESS;
+}
+
 static Expected<ChannelInterruptTimestampList> create_interrupt_timestamp_list(
     hailo_vdma_interrupts_read_timestamp_params &inter_data)
 {
@@ -435,6 +456,22 @@ Expected<IrqData> HailoRTDriver::vdma_interrupts_wait(const ChannelsBitmap &chan
     return to_irq_data(params, static_cast<uint8_t>(m_dma_engines_count));
 }
 
+Expected<IrqData> HailoRTDriver::vdma_interrupts_poll(const ChannelsBitmap &channels_bitmap)
+{
+    CHECK_AS_EXPECTED(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
+    hailo_vdma_interrupts_wait_params params{};
+    std::copy(channels_bitmap.begin(), channels_bitmap.end(), params.channels_bitmap_per_engine);
+
+    int err = run_ioctl(HAILO_VDMA_INTERRUPTS_POLL, &params);
+    if (ENOTTY == err) {
+        // Older drivers - the caller should fall back to vdma_interrupts_wait.
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+    CHECK_IOCTL_RESULT(err, "Failed poll vdma interrupts");
+
+    return to_irq_data(params, static_cast<uint8_t>(m_dma_engines_count));
+}
+
 Expected<ChannelInterruptTimestampList> HailoRTDriver::vdma_interrupts_read_timestamps(vdma::ChannelId channel_id)
 {
     hailo_vdma_interrupts_read_timestamp_params params{};
@@ -665,15 +702,74 @@ hailo_status HailoRTDriver::descriptors_list_program(uintptr_t desc_handle, Vdma
     return HAILO_SUCCESS;
 }
 
-Expected<uint32_t> HailoRTDriver::launch_transfer(vdma::ChannelId channel_id, uintptr_t desc_handle,
-    uint32_t starting_desc, const std::vector<TransferBuffer> &transfer_buffers,
-    bool should_bind, InterruptsDomain first_desc_interrupts, InterruptsDomain last_desc_interrupts)
+hailo_status HailoRTDriver::descriptors_list_program_batch(uintptr_t desc_handle, uint8_t channel_index,
+    const std::vector<DescriptorsListProgram> &programs, bool should_bind)
 {
-    CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
-    CHECK(transfer_buffers.size() <= ARRAY_ENTRIES(hailo_vdma_launch_transfer_params::buffers), HAILO_INVALID_ARGUMENT,
-        "Invalid transfer buffers size {} given", transfer_buffers.size());
+    auto begin = programs.begin();
+    while (begin != programs.end()) {
+        const auto chunk_size = std::min(static_cast<size_t>(std::distance(begin, programs.end())),
+            static_cast<size_t>(HAILO_MAX_DESC_LIST_PROGRAMS_PER_BATCH));
+        const auto end = begin + chunk_size;
+        const auto status = m_is_desc_list_program_batch_supported ?
+            descriptors_list_program_batch_ioctl(desc_handle, channel_index, begin, end, should_bind) :
+            descriptors_list_program_one_by_one(desc_handle, channel_index, begin, end, should_bind);
+        CHECK_SUCCESS(status);
+        begin = end;
+    }
 
-    hailo_vdma_launch_transfer_params params{};
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoRTDriver::descriptors_list_program_batch_ioctl(uintptr_t desc_handle, uint8_t channel_index,
+    std::vector<DescriptorsListProgram>::const_iterator begin, std::vector<DescriptorsListProgram>::const_iterator end,
+    bool should_bind)
+{
+    hailo_desc_list_program_batch_params params{};
+    params.desc_handle = desc_handle;
+    params.channel_index = channel_index;
+    params.should_bind = should_bind;
+#ifdef NDEBUG
+    params.is_debug = false;
+#else
+    params.is_debug = true;
+#endif
+    params.programs_count = static_cast<uint8_t>(std::distance(begin, end));
+    for (auto it = begin; it != end; it++) {
+        auto &program = params.programs[std::distance(begin, it)];
+        program.buffer_handle = it->buffer_handle;
+        program.buffer_size = it->buffer_size;
+        program.buffer_offset = it->buffer_offset;
+        program.starting_desc = it->starting_desc;
+        program.last_interrupts_domain = (hailo_vdma_interrupts_domain)it->last_desc_interrupts;
+    }
+
+    int err = run_ioctl(HAILO_DESC_LIST_PROGRAM_BATCH, &params);
+    if ((ENOTTY == err) && (0 == params.programmed_count)) {
+        LOGGER__INFO("Driver doesn't support batched descriptors list program, programming buffers one by one");
+        m_is_desc_list_program_batch_supported = false;
+        return descriptors_list_program_one_by_one(desc_handle, channel_index, begin, end, should_bind);
+    }
+    CHECK(0 == err, HAILO_DRIVER_FAIL, "Failed bind buffers to desc list (programmed {} out of {}) errno: {}",
+        params.programmed_count, params.programs_count, err);
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoRTDriver::descriptors_list_program_one_by_one(uintptr_t desc_handle, uint8_t channel_index,
+    std::vector<DescriptorsListProgram>::const_iterator begin, std::vector<DescriptorsListProgram>::const_iterator end,
+    bool should_bind)
+{
+    for (auto it = begin; it != end; it++) {
+        CHECK_SUCCESS(descriptors_list_program(desc_handle, it->buffer_handle, it->buffer_size, it->buffer_offset,
+            channel_index, it->starting_desc, should_bind, it->last_desc_interrupts));
+    }
+    return HAILO_SUCCESS;
+}
+
+static void fill_launch_transfer_params(vdma::ChannelId channel_id, uintptr_t desc_handle, uint32_t starting_desc,
+    const std::vector<HailoRTDriver::TransferBuffer> &transfer_buffers, bool should_bind,
+    InterruptsDomain first_desc_interrupts, InterruptsDomain last_desc_interrupts,
+    hailo_vdma_launch_transfer_params &params)
+{
     params.engine_index = channel_id.engine_index;
     params.channel_index = channel_id.channel_index;
     params.desc_handle = desc_handle;
@@ -693,6 +789,19 @@ Expected<uint32_t> HailoRTDriver::launch_transfer(vdma::ChannelId channel_id, ui
 #else
     params.is_debug = true;
 #endif
+}
+
+Expected<uint32_t> HailoRTDriver::launch_transfer(vdma::ChannelId channel_id, uintptr_t desc_handle,
+    uint32_t starting_desc, const std::vector<TransferBuffer> &transfer_buffers,
+    bool should_bind, InterruptsDomain first_desc_interrupts, InterruptsDomain last_desc_interrupts)
+{
+    CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
+    CHECK(transfer_buffers.size() <= ARRAY_ENTRIES(hailo_vdma_launch_transfer_params::buffers), HAILO_INVALID_ARGUMENT,
+        "Invalid transfer buffers size {} given", transfer_buffers.size());
+
+    hailo_vdma_launch_transfer_params params{};
+    fill_launch_transfer_params(channel_id, desc_handle, starting_desc, transfer_buffers, should_bind,
+        first_desc_interrupts, last_desc_interrupts, params);
 
     int err = run_ioctl(HAILO_VDMA_LAUNCH_TRANSFER, &params);
     if ((0 != err) && (-ECONNRESET == params.launch_transfer_status)) {
@@ -703,6 +812,88 @@ Expected<uint32_t> HailoRTDriver::launch_transfer(vdma::ChannelId channel_id, ui
     return Expected<uint32_t>(params.descs_programed);
 }
 
+hailo_status HailoRTDriver::launch_transfers(std::vector<TransferLaunch> &transfers)
+{
+    for (auto &transfer : transfers) {
+        CHECK(is_valid_channel_id(transfer.channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given",
+            transfer.channel_id);
+        CHECK(transfer.transfer_buffers.size() <= ARRAY_ENTRIES(hailo_vdma_launch_transfer_params::buffers),
+            HAILO_INVALID_ARGUMENT, "Invalid transfer buffers size {} given", transfer.transfer_buffers.size());
+        transfer.status = HAILO_UNINITIALIZED;
+        transfer.descs_programed = 0;
+    }
+
+    auto begin = transfers.begin();
+    while (begin != transfers.end()) {
+        const auto chunk_size = std::min(static_cast<size_t>(std::distance(begin, transfers.end())),
+            static_cast<size_t>(HAILO_MAX_TRANSFERS_PER_LAUNCH));
+        const auto end = begin + chunk_size;
+        const auto status = m_is_launch_transfers_supported ?
+            launch_transfers_ioctl(begin, end) : launch_transfers_one_by_one(begin, end);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+        begin = end;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoRTDriver::launch_transfers_ioctl(std::vector<TransferLaunch>::iterator begin,
+    std::vector<TransferLaunch>::iterator end)
+{
+    hailo_vdma_launch_transfers_params params{};
+    params.transfers_count = static_cast<uint8_t>(std::distance(begin, end));
+    for (auto it = begin; it != end; it++) {
+        fill_launch_transfer_params(it->channel_id, it->desc_handle, it->starting_desc, it->transfer_buffers,
+            it->should_bind, it->first_desc_interrupts, it->last_desc_interrupts,
+            params.transfers[std::distance(begin, it)]);
+    }
+
+    int err = run_ioctl(HAILO_VDMA_LAUNCH_TRANSFERS, &params);
+    if ((ENOTTY == err) && (0 == params.launched_count)) {
+        LOGGER__INFO("Driver doesn't support batched transfers launch, launching transfers one by one");
+        m_is_launch_transfers_supported = false;
+        return launch_transfers_one_by_one(begin, end);
+    }
+
+    for (auto it = begin; it != end; it++) {
+        const auto index = std::distance(begin, it);
+        if (index < params.launched_count) {
+            it->status = HAILO_SUCCESS;
+            it->descs_programed = params.transfers[index].descs_programed;
+            continue;
+        }
+
+        // First failed transfer, the rest of the transfers were not launched.
+        if (-ECONNRESET == params.transfers[index].launch_transfer_status) {
+            it->status = HAILO_STREAM_ABORT;
+            return HAILO_STREAM_ABORT;
+        }
+        LOGGER__ERROR("Failed launch transfer on channel {} errno: {}", it->channel_id, err);
+        it->status = HAILO_DRIVER_FAIL;
+        return HAILO_DRIVER_FAIL;
+    }
+
+    CHECK(0 == err, HAILO_DRIVER_FAIL, "Failed launch transfers errno: {}", err);
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoRTDriver::launch_transfers_one_by_one(std::vector<TransferLaunch>::iterator begin,
+    std::vector<TransferLaunch>::iterator end)
+{
+    for (auto it = begin; it != end; it++) {
+        auto descs_programed = launch_transfer(it->channel_id, it->desc_handle, it->starting_desc, it->transfer_buffers,
+            it->should_bind, it->first_desc_interrupts, it->last_desc_interrupts);
+        it->status = descs_programed.status();
+        if (HAILO_SUCCESS != it->status) {
+            return it->status;
+        }
+        it->descs_programed = descs_programed.value();
+    }
+    return HAILO_SUCCESS;
+}
+
 #if defined(__linux__)
 Expected<uintptr_t> HailoRTDriver::vdma_low_memory_buffer_alloc(size_t size)
 {
@@ -852,6 +1043,9 @@ static bool is_blocking_ioctl(unsigned long request)
 {
     switch (request) {
     case HAILO_VDMA_INTERRUPTS_WAIT:
+    // Not really blocking, but it is called in a tight loop by the polling interrupts thread and must not contend
+    // with other ioctls on m_driver_lock.
+    case HAILO_VDMA_INTERRUPTS_POLL:
     case HAILO_FW_CONTROL:
     case HAILO_READ_NOTIFICATION:
         return true;
@@ -26,6 +26,7 @@
 #include <array>
 #include <list>
 #include <cerrno>
+#include <atomic>
 
 #ifdef __QNX__
 #include <sys/mman.h>
@@ -195,6 +196,8 @@ public:
 
     using VdmaBufferHandle = size_t;
 
+    static constexpr int UNKNOWN_NUMA_NODE = -1;
+
     static Expected<std::unique_ptr<HailoRTDriver>> create(const std::string &device_id, const std::string &dev_path);
 
     static Expected<std::unique_ptr<HailoRTDriver>> create_pcie(const std::string &device_id);
@@ -215,7 +218,21 @@ public:
 
     hailo_status vdma_enable_channels(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure);
     hailo_status vdma_disable_channels(const ChannelsBitmap &channel_id);
+
+    /**
+     * Sets the timeout after which the driver reports completion of transfers launched without interrupt on the
+     * given channel. Returns HAILO_NOT_SUPPORTED if the driver doesn't support interrupts coalescing.
+     */
+    hailo_status vdma_set_interrupts_coalescing(vdma::ChannelId channel_id, std::chrono::microseconds timeout);
+
     Expected<IrqData> vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap);
+
+    /**
+     * Non blocking version of vdma_interrupts_wait - returns an empty IrqData if no interrupt is pending.
+     * Returns HAILO_NOT_SUPPORTED if the driver doesn't support interrupts polling.
+     */
+    Expected<IrqData> vdma_interrupts_poll(const ChannelsBitmap &channels_bitmap);
+
     Expected<ChannelInterruptTimestampList> vdma_interrupts_read_timestamps(vdma::ChannelId channel_id);
 
     Expected<std::vector<uint8_t>> read_notification();
@@ -291,6 +308,24 @@ public:
         size_t buffer_size, size_t buffer_offset, uint8_t channel_index,
         uint32_t starting_desc, bool should_bind, InterruptsDomain last_desc_interrupts);
 
+    struct DescriptorsListProgram {
+        VdmaBufferHandle buffer_handle;
+        size_t buffer_size;
+        size_t buffer_offset;
+        uint32_t starting_desc;
+        InterruptsDomain last_desc_interrupts;
+    };
+
+    /**
+     * Programs the given descriptors list to point to multiple buffers (or multiple parts of a buffer), with a single
+     * driver call (per HAILO_MAX_DESC_LIST_PROGRAMS_PER_BATCH buffers). The buffers are programmed by the given order.
+     *
+     * @note If the driver doesn't support batched program, each buffer is programmed with
+     *       HailoRTDriver::descriptors_list_program.
+     */
+    hailo_status descriptors_list_program_batch(uintptr_t desc_handle, uint8_t channel_index,
+        const std::vector<DescriptorsListProgram> &programs, bool should_bind);
+
     struct TransferBuffer {
         VdmaBufferHandle buffer_handle;
         size_t offset;
@@ -304,6 +339,29 @@ public:
         uint32_t starting_desc, const std::vector<TransferBuffer> &transfer_buffer, bool should_bind,
         InterruptsDomain first_desc_interrupts, InterruptsDomain last_desc_interrupts);
 
+    struct TransferLaunch {
+        vdma::ChannelId channel_id;
+        uintptr_t desc_handle;
+        uint32_t starting_desc;
+        std::vector<TransferBuffer> transfer_buffers;
+        bool should_bind;
+        InterruptsDomain first_desc_interrupts;
+        InterruptsDomain last_desc_interrupts;
+
+        // Outputs
+        hailo_status status;        // HAILO_UNINITIALIZED if the transfer wasn't launched since a previous one failed.
+        uint32_t descs_programed;
+    };
+
+    /**
+     * Launches multiple transfers (possibly on different channels) with a single driver call. The transfers are
+     * launched by the given order, and on the first failure the rest of the transfers are not launched.
+     * The status of each transfer is returned in TransferLaunch::status.
+     *
+     * @note If the driver doesn't support batched launch, each transfer is launched with HailoRTDriver::launch_transfer.
+     */
+    hailo_status launch_transfers(std::vector<TransferLaunch> &transfers);
+
     Expected<uintptr_t> vdma_low_memory_buffer_alloc(size_t size);
     hailo_status vdma_low_memory_buffer_free(uintptr_t buffer_handle);
 
@@ -345,6 +403,19 @@ public:
         return m_dma_type;
     }
 
+    // NUMA node the device is attached to (detected on creation), UNKNOWN_NUMA_NODE if unknown. Memory and threads
+    // serving the device are placed on this node.
+    inline int numa_node() const
+    {
+        return m_numa_node;
+    }
+
+    // Overrides the detected NUMA node (UNKNOWN_NUMA_NODE disables the NUMA placement).
+    void set_numa_node(int numa_node)
+    {
+        m_numa_node = numa_node;
+    }
+
     FileDescriptor& fd() {return m_fd;}
 
     inline bool allocate_driver_buffer() const
@@ -400,6 +471,16 @@ private:
     HailoRTDriver(const std::string &device_id, FileDescriptor &&fd, hailo_status &status);
 
     bool is_valid_channel_id(const vdma::ChannelId &channel_id);
+    hailo_status launch_transfers_ioctl(std::vector<TransferLaunch>::iterator begin,
+        std::vector<TransferLaunch>::iterator end);
+    hailo_status launch_transfers_one_by_one(std::vector<TransferLaunch>::iterator begin,
+        std::vector<TransferLaunch>::iterator end);
+    hailo_status descriptors_list_program_batch_ioctl(uintptr_t desc_handle, uint8_t channel_index,
+        std::vector<DescriptorsListProgram>::const_iterator begin, std::vector<DescriptorsListProgram>::const_iterator end,
+        bool should_bind);
+    hailo_status descriptors_list_program_one_by_one(uintptr_t desc_handle, uint8_t channel_index,
+        std::vector<DescriptorsListProgram>::const_iterator begin, std::vector<DescriptorsListProgram>::const_iterator end,
+        bool should_bind);
     bool is_valid_channels_bitmap(const ChannelsBitmap &bitmap)
     {
         for (size_t engine_index = m_dma_engines_count; engine_index < MAX_VDMA_ENGINES_COUNT; engine_index++) {
@@ -419,7 +500,12 @@ private:
     DmaType m_dma_type;
     bool m_allocate_driver_buffer;
     size_t m_dma_engines_count;
+    int m_numa_node;
     bool m_is_fw_loaded;
+    // Cleared if the driver doesn't support HAILO_VDMA_LAUNCH_TRANSFERS (older driver), so we don't retry it.
+    std::atomic_bool m_is_launch_transfers_supported;
+    // Cleared if the driver doesn't support HAILO_DESC_LIST_PROGRAM_BATCH (older driver), so we don't retry it.
+    std::atomic_bool m_is_desc_list_program_batch_supported;
 #ifdef __QNX__
     pid_t m_resource_manager_pid;
 #endif // __QNX__
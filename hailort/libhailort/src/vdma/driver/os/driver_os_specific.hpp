@@ -25,6 +25,8 @@ Expected<FileDescriptor> open_device_file(const std::string &path);
 Expected<HailoRTDriver::DeviceInfo> query_device_info(const std::string &device_name);
 Expected<std::vector<HailoRTDriver::DeviceInfo>> scan_nnc_devices();
 Expected<std::vector<HailoRTDriver::DeviceInfo>> scan_soc_devices();
+// Returns the NUMA node the device is attached to, or HailoRTDriver::UNKNOWN_NUMA_NODE if it is unknown.
+int query_device_numa_node(const std::string &device_id);
 
 #ifndef _WIN32
 
@@ -25,6 +25,8 @@ namespace hailort
 #define HAILO_CLASS_PATH ("/sys/class/hailo_chardev")
 #define HAILO_BOARD_LOCATION_FILENAME ("board_location")
 #define HAILO_BOARD_ACCELERATOR_TYPE_FILENAME ("accelerator_type")
+#define PCI_DEVICES_PATH ("/sys/bus/pci/devices")
+#define PCI_NUMA_NODE_FILENAME ("numa_node")
 
 Expected<FileDescriptor> open_device_file(const std::string &path)
 {
@@ -138,6 +140,25 @@ Expected<HailoRTDriver::DeviceInfo> query_device_info(const std::string &device_
     return device_info;
 }
 
+int query_device_numa_node(const std::string &device_id)
+{
+    // The device id of pcie devices is its bdf. Other devices (e.g. integrated) have no numa_node file.
+    const std::string numa_node_path = std::string(PCI_DEVICES_PATH) + "/" + device_id + "/" + PCI_NUMA_NODE_FILENAME;
+    std::ifstream file(numa_node_path);
+    if (!file.good()) {
+        return HailoRTDriver::UNKNOWN_NUMA_NODE;
+    }
+
+    // The kernel reports -1 if the platform has no numa information.
+    int numa_node = HailoRTDriver::UNKNOWN_NUMA_NODE;
+    file >> numa_node;
+    if (file.fail() || (numa_node < 0)) {
+        return HailoRTDriver::UNKNOWN_NUMA_NODE;
+    }
+
+    return numa_node;
+}
+
 int run_hailo_ioctl(underlying_handle_t file, uint32_t ioctl_code, void *param) {
     int res = ioctl(file, ioctl_code, param);
     return (res < 0) ? errno : 0;
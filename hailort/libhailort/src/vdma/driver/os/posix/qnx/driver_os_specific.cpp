@@ -67,6 +67,13 @@ Expected<std::vector<std::string>> list_devices()
     return devices;
 }
 
+int query_device_numa_node(const std::string &device_id)
+{
+    // TODO: query the device numa node
+    (void)device_id;
+    return HailoRTDriver::UNKNOWN_NUMA_NODE;
+}
+
 Expected<HailoRTDriver::DeviceInfo> query_device_info(const std::string &device_name)
 {
     HailoRTDriver::DeviceInfo dev_info = {};
@@ -234,6 +234,13 @@ static Expected<uint32_t> parse_uint32_property(const std::wstring &dev_interfac
 #define DEVICE_ADDRESS_GET_FUNC(device_func) ((device_func) & 0xff)
 #define DEVICE_ADDRESS_GET_DEV(device_func) ((device_func) >> 16)
 
+int query_device_numa_node(const std::string &device_id)
+{
+    // TODO: query the device numa node
+    (void)device_id;
+    return HailoRTDriver::UNKNOWN_NUMA_NODE;
+}
+
 Expected<HailoRTDriver::DeviceInfo> query_device_info(const std::string &device_name)
 {
     const auto device_name_wstring = StringConverter::ansi_to_utf16(device_name);
@@ -288,6 +295,8 @@ COMPATIBLE_PARAM_CAST(hailo_driver_info, DriverInfo)
 COMPATIBLE_PARAM_CAST(hailo_read_log_params, ReadLog)
 COMPATIBLE_PARAM_CAST(hailo_mark_as_in_use_params, MarkAsInUse)
 COMPATIBLE_PARAM_CAST(hailo_vdma_launch_transfer_params, LaunchTransfer)
+COMPATIBLE_PARAM_CAST(hailo_vdma_launch_transfers_params, LaunchTransfers)
+COMPATIBLE_PARAM_CAST(hailo_vdma_interrupts_coalescing_params, VdmaInterruptsCoalescing)
 COMPATIBLE_PARAM_CAST(hailo_soc_connect_params, ConnectParams)
 COMPATIBLE_PARAM_CAST(hailo_soc_close_params, SocCloseParams)
 COMPATIBLE_PARAM_CAST(hailo_pci_ep_accept_params, AcceptParams)
@@ -19,7 +19,7 @@ namespace vdma {
 Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requirements_multiple_transfers(
     vdma::VdmaBuffer::Type buffer_type, uint16_t max_desc_page_size, uint16_t batch_size,
     const std::vector<uint32_t> &transfer_sizes, bool is_circular, bool force_default_page_size,
-    bool force_batch_size)
+    bool force_batch_size, bool is_huge_pages_backed)
 {
     const uint32_t MAX_DESCS_COUNT = (buffer_type == vdma::VdmaBuffer::Type::SCATTER_GATHER) ?
         MAX_SG_DESCS_COUNT : MAX_CCB_DESCS_COUNT;
@@ -31,7 +31,7 @@ Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requiremen
         MIN_SG_PAGE_SIZE : MIN_CCB_PAGE_SIZE;
 
     const uint16_t initial_desc_page_size = find_initial_desc_page_size(buffer_type, transfer_sizes, max_desc_page_size,
-        force_default_page_size, MIN_PAGE_SIZE);
+        force_default_page_size, MIN_PAGE_SIZE, is_huge_pages_backed);
 
     CHECK_AS_EXPECTED(max_desc_page_size <= MAX_PAGE_SIZE, HAILO_INTERNAL_FAILURE,
         "max_desc_page_size given {} is bigger than hw max desc page size {}",
@@ -92,7 +92,8 @@ Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requiremen
 
 Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requirements_single_transfer(
     vdma::VdmaBuffer::Type buffer_type, uint16_t max_desc_page_size, uint16_t min_batch_size, uint16_t max_batch_size,
-    uint32_t transfer_size, bool is_circular, bool force_default_page_size, bool force_batch_size, bool is_vdma_aligned_buffer)
+    uint32_t transfer_size, bool is_circular, bool force_default_page_size, bool force_batch_size, bool is_vdma_aligned_buffer,
+    bool is_huge_pages_backed)
 {
     const uint32_t MAX_DESCS_COUNT = (buffer_type == vdma::VdmaBuffer::Type::SCATTER_GATHER) ?
         MAX_SG_DESCS_COUNT : MAX_CCB_DESCS_COUNT;
@@ -101,7 +102,7 @@ Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requiremen
 
     // First, get the result for the min size
     auto results = get_buffer_requirements_multiple_transfers(buffer_type, max_desc_page_size,
-        min_batch_size, {transfer_size}, is_circular, force_default_page_size, force_batch_size);
+        min_batch_size, {transfer_size}, is_circular, force_default_page_size, force_batch_size, is_huge_pages_backed);
     if (HAILO_CANT_MEET_BUFFER_REQUIREMENTS == results.status()) {
         // In case of failure to meet requirements, return without error printed to the prompt.
         return make_unexpected(HAILO_CANT_MEET_BUFFER_REQUIREMENTS);
@@ -128,11 +129,16 @@ Expected<BufferSizesRequirements> BufferSizesRequirements::get_buffer_requiremen
 
 uint16_t BufferSizesRequirements::find_initial_desc_page_size(
     vdma::VdmaBuffer::Type buffer_type, const std::vector<uint32_t> &transfer_sizes,
-    uint16_t max_desc_page_size, bool force_default_page_size, uint16_t min_page_size)
+    uint16_t max_desc_page_size, bool force_default_page_size, uint16_t min_page_size, bool is_huge_pages_backed)
 {
-    static const uint16_t DEFAULT_PAGE_SIZE = (buffer_type == vdma::VdmaBuffer::Type::SCATTER_GATHER) ?
+    const uint16_t DEFAULT_PAGE_SIZE = (buffer_type == vdma::VdmaBuffer::Type::SCATTER_GATHER) ?
         DEFAULT_SG_PAGE_SIZE : DEFAULT_CCB_PAGE_SIZE;
-    const uint16_t channel_max_page_size = std::min(DEFAULT_PAGE_SIZE, max_desc_page_size);
+    // Huge pages backed buffers are big, and their memory is contiguous per huge page - using the largest page size
+    // reduces the descriptors count (and the descriptors memory the hw needs to fetch).
+    const bool use_max_page_size = is_huge_pages_backed && !force_default_page_size &&
+        (buffer_type == vdma::VdmaBuffer::Type::SCATTER_GATHER);
+    const uint16_t channel_max_page_size = use_max_page_size ? max_desc_page_size :
+        std::min(DEFAULT_PAGE_SIZE, max_desc_page_size);
     const auto max_transfer_size = *std::max_element(transfer_sizes.begin(), transfer_sizes.end());
     // Note: If the pages pointed to by the descriptors are copied in their entirety, then DEFAULT_PAGE_SIZE
     //       is the optimal value. For transfer_sizes smaller than DEFAULT_PAGE_SIZE using smaller descriptor page
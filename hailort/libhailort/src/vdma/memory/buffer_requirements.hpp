@@ -36,19 +36,22 @@ public:
     uint16_t desc_page_size() const { return m_desc_page_size; }
     uint32_t buffer_size() const { return m_descs_count * m_desc_page_size; }
 
+    // is_huge_pages_backed - The (scatter-gather) buffer is backed by huge pages. In that case the max descriptor page
+    //                        size is used instead of the default one, minimizing the descriptors count.
     static Expected<BufferSizesRequirements> get_buffer_requirements_multiple_transfers(
         vdma::VdmaBuffer::Type buffer_type, uint16_t max_desc_page_size,
         uint16_t batch_size, const std::vector<uint32_t> &transfer_sizes, bool is_circular,
-        bool force_default_page_size, bool force_batch_size);
+        bool force_default_page_size, bool force_batch_size, bool is_huge_pages_backed = false);
 
     static Expected<BufferSizesRequirements> get_buffer_requirements_single_transfer(
         vdma::VdmaBuffer::Type buffer_type, uint16_t max_desc_page_size,
         uint16_t min_batch_size, uint16_t max_batch_size, uint32_t transfer_size, bool is_circular,
-        bool force_default_page_size, bool force_batch_size, bool is_vdma_aligned_buffer);
+        bool force_default_page_size, bool force_batch_size, bool is_vdma_aligned_buffer,
+        bool is_huge_pages_backed = false);
 
 private:
     static uint16_t find_initial_desc_page_size(vdma::VdmaBuffer::Type buffer_type, const std::vector<uint32_t> &transfer_sizes,
-        uint16_t max_desc_page_size, bool force_default_page_size, uint16_t min_page_size);
+        uint16_t max_desc_page_size, bool force_default_page_size, uint16_t min_page_size, bool is_huge_pages_backed);
     static uint32_t get_required_descriptor_count(const std::vector<uint32_t> &transfer_sizes, uint16_t desc_page_size);
 
     const uint32_t m_descs_count;
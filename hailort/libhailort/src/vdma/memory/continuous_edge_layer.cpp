@@ -61,6 +61,15 @@ Expected<uint32_t> ContinuousEdgeLayer::program_descriptors(size_t transfer_size
     return descriptors_in_buffer(transfer_size);
 }
 
+Expected<uint32_t> ContinuousEdgeLayer::program_transfers_descriptors(size_t transfer_size, uint16_t transfers_count,
+    InterruptsDomain last_transfer_interrupts_domain)
+{
+    (void)last_transfer_interrupts_domain;
+
+    // The descriptors in continuous mode are programmed by the hw, nothing to do here.
+    return descriptors_in_buffer(transfer_size) * transfers_count;
+}
+
 ContinuousEdgeLayer::ContinuousEdgeLayer(std::shared_ptr<ContinuousBuffer> &&buffer, size_t size, size_t offset,
         uint16_t page_size, uint32_t num_pages) :
     VdmaEdgeLayer(std::move(buffer), size, offset),
@@ -11,9 +11,111 @@
 
 #include "utils.h"
 
+#include <unordered_map>
+
 namespace hailort {
 namespace vdma {
 
+// Pools by their driver. The pools are held as weak_ptr, so a pool is unregistered once its device releases it.
+static std::mutex &pools_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::unordered_map<HailoRTDriver*, std::weak_ptr<DescriptorListPool>> &pools()
+{
+    static std::unordered_map<HailoRTDriver*, std::weak_ptr<DescriptorListPool>> pools;
+    return pools;
+}
+
+Expected<DescriptorListPoolPtr> DescriptorListPool::create_shared(HailoRTDriver &driver, size_t max_cached_lists)
+{
+    CHECK_AS_EXPECTED(0 != max_cached_lists, HAILO_INVALID_ARGUMENT, "Descriptor list pool size must be larger than 0");
+
+    auto pool = make_shared_nothrow<DescriptorListPool>(driver, max_cached_lists);
+    CHECK_NOT_NULL_AS_EXPECTED(pool, HAILO_OUT_OF_HOST_MEMORY);
+
+    std::lock_guard<std::mutex> lock(pools_mutex());
+    auto &registered_pool = pools()[&driver];
+    CHECK_AS_EXPECTED(registered_pool.expired(), HAILO_INVALID_OPERATION,
+        "Descriptor list pool already exists for device {}", driver.device_id());
+    registered_pool = pool;
+    return pool;
+}
+
+DescriptorListPoolPtr DescriptorListPool::get(HailoRTDriver &driver)
+{
+    std::lock_guard<std::mutex> lock(pools_mutex());
+    auto pool = pools().find(&driver);
+    return (pool != pools().end()) ? pool->second.lock() : nullptr;
+}
+
+DescriptorListPool::DescriptorListPool(HailoRTDriver &driver, size_t max_cached_lists) :
+    m_driver(driver),
+    m_max_cached_lists(max_cached_lists)
+{}
+
+DescriptorListPool::~DescriptorListPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(pools_mutex());
+        auto pool = pools().find(&m_driver);
+        if ((pool != pools().end()) && pool->second.expired()) {
+            pools().erase(pool);
+        }
+    }
+
+    clear();
+}
+
+Expected<DescriptorsListInfo> DescriptorListPool::acquire(uint32_t desc_count, uint16_t desc_page_size,
+    bool is_circular)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto key = std::make_tuple(desc_count, desc_page_size, is_circular);
+    // Searching from the back, so the most recently released list is reused.
+    for (auto it = m_lists.rbegin(); it != m_lists.rend(); it++) {
+        if (key == it->first) {
+            auto desc_list_info = it->second;
+            m_lists.erase(std::next(it).base());
+            return desc_list_info;
+        }
+    }
+
+    return make_unexpected(HAILO_NOT_FOUND);
+}
+
+void DescriptorListPool::release(const DescriptorsListInfo &desc_list_info, uint32_t desc_count,
+    uint16_t desc_page_size, bool is_circular)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_lists.size() >= m_max_cached_lists) {
+        // Evict the least recently released list.
+        const auto status = m_driver.descriptors_list_release(m_lists.front().second);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to release descriptor list {} with status {}", m_lists.front().second.handle, status);
+        }
+        m_lists.pop_front();
+    }
+
+    m_lists.emplace_back(std::make_tuple(desc_count, desc_page_size, is_circular), desc_list_info);
+}
+
+void DescriptorListPool::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &desc_list : m_lists) {
+        const auto status = m_driver.descriptors_list_release(desc_list.second);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to release descriptor list {} with status {}", desc_list.second.handle, status);
+        }
+    }
+    m_lists.clear();
+}
+
 
 Expected<DescriptorList> DescriptorList::create(uint32_t desc_count, uint16_t desc_page_size, bool is_circular,
     HailoRTDriver &driver)
@@ -37,6 +139,7 @@ Expected<DescriptorList> DescriptorList::create(uint32_t desc_count, uint16_t de
 DescriptorList::DescriptorList(uint32_t desc_count, uint16_t desc_page_size, bool is_circular, HailoRTDriver &driver,
                                hailo_status &status) :
     m_desc_list_info(),
+    m_pool(),
     m_desc_count(desc_count),
     m_is_circular(is_circular),
     m_driver(driver),
@@ -48,6 +151,18 @@ DescriptorList::DescriptorList(uint32_t desc_count, uint16_t desc_page_size, boo
         return;
     }
 
+    auto pool = DescriptorListPool::get(m_driver);
+    if (nullptr != pool) {
+        m_pool = pool;
+        auto cached_desc_list_info = pool->acquire(desc_count, m_desc_page_size, m_is_circular);
+        if (cached_desc_list_info) {
+            // The descriptors are programmed again before the list is used, so no need to reset them.
+            m_desc_list_info = cached_desc_list_info.release();
+            status = HAILO_SUCCESS;
+            return;
+        }
+    }
+
     auto desc_list_info = m_driver.descriptors_list_create(desc_count, m_desc_page_size, m_is_circular);
     if (!desc_list_info) {
         status = desc_list_info.status();
@@ -62,6 +177,12 @@ DescriptorList::DescriptorList(uint32_t desc_count, uint16_t desc_page_size, boo
 DescriptorList::~DescriptorList()
 {
     if (0 != m_desc_list_info.handle) {
+        auto pool = m_pool.lock();
+        if (nullptr != pool) {
+            pool->release(m_desc_list_info, m_desc_count, m_desc_page_size, m_is_circular);
+            return;
+        }
+
         auto status = m_driver.descriptors_list_release(m_desc_list_info);
         if(HAILO_SUCCESS != status) {
             LOGGER__ERROR("Failed to release descriptor list {} with status {}", m_desc_list_info.handle, status);
@@ -71,6 +192,7 @@ DescriptorList::~DescriptorList()
 
 DescriptorList::DescriptorList(DescriptorList &&other) noexcept :
     m_desc_list_info(),
+    m_pool(std::move(other.m_pool)),
     m_desc_count(other.m_desc_count),
     m_is_circular(std::move(other.m_is_circular)),
     m_driver(other.m_driver),
@@ -93,6 +215,20 @@ hailo_status DescriptorList::program(MappedBuffer& buffer, size_t buffer_size,
         buffer_offset, channel_id.channel_index, starting_desc, should_bind, last_desc_interrupts);
 }
 
+hailo_status DescriptorList::program_batch(const std::vector<HailoRTDriver::DescriptorsListProgram> &programs,
+    ChannelId channel_id, bool should_bind /* = true */)
+{
+    const auto desc_list_capacity = m_desc_page_size * count();
+    for (const auto &program : programs) {
+        CHECK(program.buffer_size <= desc_list_capacity, HAILO_INVALID_ARGUMENT,
+            "Can't bind a buffer larger than the descriptor list's capacity. Buffer size {}, descriptor list capacity {}",
+            program.buffer_size, desc_list_capacity);
+    }
+
+    return m_driver.descriptors_list_program_batch(m_desc_list_info.handle, channel_id.channel_index, programs,
+        should_bind);
+}
+
 uint32_t DescriptorList::descriptors_in_buffer(size_t buffer_size) const
 {
     return descriptors_in_buffer(buffer_size, m_desc_page_size);
@@ -19,6 +19,10 @@
 #include "vdma/memory/mapped_buffer.hpp"
 #include "vdma/driver/hailort_driver.hpp"
 
+#include <list>
+#include <mutex>
+#include <tuple>
+
 
 namespace hailort {
 namespace vdma {
@@ -51,6 +55,51 @@ static_assert(MAX_SG_PAGE_SIZE > 0, "MAX_SG_PAGE_SIZE must be larger then 0");
 static_assert(is_powerof2(DEFAULT_SG_PAGE_SIZE), "DEFAULT_SG_PAGE_SIZE must be a power of 2");
 static_assert(DEFAULT_SG_PAGE_SIZE > 0, "DEFAULT_SG_PAGE_SIZE must be larger then 0");
 
+// Max amount of released descriptor lists kept (per device) by DescriptorListPool.
+static constexpr size_t DEFAULT_DESC_LIST_POOL_SIZE = 64;
+
+
+class DescriptorListPool;
+using DescriptorListPoolPtr = std::shared_ptr<DescriptorListPool>;
+
+// Per-device pool of released descriptor lists. Creating a descriptor list allocates (and maps) its memory on the
+// driver, which is paid again on every configure. Released lists are kept in the pool and are reused by new lists with
+// the same params (e.g. when a model is configured again), up to some amount of cached lists.
+// The pool is registered to its driver on creation, so any DescriptorList created on the driver uses it.
+class DescriptorListPool final
+{
+public:
+    static Expected<DescriptorListPoolPtr> create_shared(HailoRTDriver &driver, size_t max_cached_lists);
+    // Returns nullptr if no pool is registered to the given driver.
+    static DescriptorListPoolPtr get(HailoRTDriver &driver);
+
+    DescriptorListPool(HailoRTDriver &driver, size_t max_cached_lists);
+    ~DescriptorListPool();
+
+    DescriptorListPool(const DescriptorListPool &) = delete;
+    DescriptorListPool &operator=(const DescriptorListPool &) = delete;
+    DescriptorListPool(DescriptorListPool &&) = delete;
+    DescriptorListPool &operator=(DescriptorListPool &&) = delete;
+
+    // Removes a cached list with the given params from the pool and returns it. Returns HAILO_NOT_FOUND if there is
+    // no such list.
+    Expected<DescriptorsListInfo> acquire(uint32_t desc_count, uint16_t desc_page_size, bool is_circular);
+    // Keeps the list in the pool (the least recently released list is released if the pool is full).
+    void release(const DescriptorsListInfo &desc_list_info, uint32_t desc_count, uint16_t desc_page_size,
+        bool is_circular);
+    void clear();
+
+private:
+    // (desc count, desc page size, is circular)
+    using Key = std::tuple<uint32_t, uint16_t, bool>;
+
+    HailoRTDriver &m_driver;
+    const size_t m_max_cached_lists;
+
+    std::mutex m_mutex;
+    // Least recently released list is at the front.
+    std::list<std::pair<Key, DescriptorsListInfo>> m_lists;
+};
 
 class DescriptorList
 {
@@ -98,6 +147,10 @@ public:
         ChannelId channel_id, uint32_t starting_desc = 0, bool should_bind = true,
         InterruptsDomain last_desc_interrupts = InterruptsDomain::NONE);
 
+    // Same as program, for multiple buffers (or multiple parts of a buffer), with a single driver call.
+    hailo_status program_batch(const std::vector<HailoRTDriver::DescriptorsListProgram> &programs,
+        ChannelId channel_id, bool should_bind = true);
+
     uint32_t descriptors_in_buffer(size_t buffer_size) const;
     static uint32_t descriptors_in_buffer(size_t buffer_size, uint16_t desc_page_size);
     static uint32_t calculate_descriptors_count(uint32_t buffer_size, uint16_t batch_size, uint16_t desc_page_size);
@@ -107,6 +160,8 @@ private:
         hailo_status &status);
 
     DescriptorsListInfo m_desc_list_info;
+    // The pool the list is returned to on destruction (if it is still alive).
+    std::weak_ptr<DescriptorListPool> m_pool;
     const uint32_t m_desc_count;
     const bool m_is_circular;
     HailoRTDriver &m_driver;
@@ -11,6 +11,7 @@
 #include "hailo/hailort_common.hpp"
 #include "dma_able_buffer.hpp"
 #include "common/os_utils.hpp"
+#include "utils/host_memory_accountant.hpp"
 
 #if defined(_MSC_VER)
 #include "os/windows/virtual_alloc_guard.hpp"
@@ -64,35 +65,42 @@ private:
 #if defined(__linux__)
 class PageAlignedDmaAbleBuffer : public DmaAbleBuffer {
 public:
-    static Expected<DmaAbleBufferPtr> create(size_t size)
+    static Expected<DmaAbleBufferPtr> create(size_t size, bool use_huge_pages)
     {
         // Shared memory to allow python fork.
-        auto mmapped_buffer = MmapBuffer<void>::create_shared_memory(size);
+        auto mmapped_buffer = use_huge_pages ?
+            MmapBuffer<void>::create_shared_memory_huge_pages(size) :
+            MmapBuffer<void>::create_shared_memory(size);
         CHECK_EXPECTED(mmapped_buffer);
 
-        auto buffer =  make_shared_nothrow<PageAlignedDmaAbleBuffer>(mmapped_buffer.release());
+        auto buffer =  make_shared_nothrow<PageAlignedDmaAbleBuffer>(mmapped_buffer.release(), size);
         CHECK_NOT_NULL_AS_EXPECTED(buffer, HAILO_OUT_OF_HOST_MEMORY);
         return std::static_pointer_cast<DmaAbleBuffer>(buffer);
     }
 
-    PageAlignedDmaAbleBuffer(MmapBuffer<void> &&mmapped_buffer) :
-        m_mmapped_buffer(std::move(mmapped_buffer))
+    PageAlignedDmaAbleBuffer(MmapBuffer<void> &&mmapped_buffer, size_t size) :
+        m_mmapped_buffer(std::move(mmapped_buffer)),
+        m_size(size)
     {}
 
     virtual void* user_address() override { return m_mmapped_buffer.address(); }
-    virtual size_t size() const override { return m_mmapped_buffer.size(); }
+    // The mmapped buffer may be larger than size (when rounded up to the huge page size)
+    virtual size_t size() const override { return m_size; }
     virtual vdma_mapped_buffer_driver_identifier buffer_identifier() override { return HailoRTDriver::INVALID_MAPPED_BUFFER_DRIVER_IDENTIFIER; }
 
 private:
     // Using mmap instead of aligned_alloc to enable MEM_SHARE flag - used for multi-process fork.
     MmapBuffer<void> m_mmapped_buffer;
+    const size_t m_size;
 };
 
 #elif defined(_MSC_VER)
 class PageAlignedDmaAbleBuffer : public DmaAbleBuffer {
 public:
-    static Expected<DmaAbleBufferPtr> create(size_t size)
+    static Expected<DmaAbleBufferPtr> create(size_t size, bool use_huge_pages)
     {
+        // Large pages on windows require the SeLockMemoryPrivilege, hence they are not used.
+        (void)use_huge_pages;
         auto memory_guard = VirtualAllocGuard::create(size);
         CHECK_EXPECTED(memory_guard);
 
@@ -183,19 +191,26 @@ Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_from_user_address(void *user_ad
     return UserAllocatedDmaAbleBuffer::create(user_address, size);
 }
 
-Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size)
+static Expected<DmaAbleBufferPtr> allocate_dma_able_buffer(size_t size, bool use_huge_pages)
 {
-    return PageAlignedDmaAbleBuffer::create(size);
+    return PageAlignedDmaAbleBuffer::create(size, use_huge_pages);
 }
 
-Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size, HailoRTDriver &driver)
+static Expected<DmaAbleBufferPtr> allocate_dma_able_buffer(size_t size, HailoRTDriver &driver, bool use_huge_pages)
 {
     if (driver.allocate_driver_buffer()) {
         return DriverAllocatedDmaAbleBuffer::create(driver, size);
-    } else {
-        // The driver is not needed.
-        return create_by_allocation(size);
     }
+
+    TRY(auto buffer, allocate_dma_able_buffer(size, use_huge_pages));
+    if (HailoRTDriver::UNKNOWN_NUMA_NODE != driver.numa_node()) {
+        // The pages are not touched yet, so they will be allocated on the device local node.
+        auto status = OsUtils::bind_memory_to_numa_node(buffer->user_address(), buffer->size(), driver.numa_node());
+        if (HAILO_SUCCESS != status) {
+            LOGGER__WARNING("Failed binding dma buffer to numa node {}, status {}", driver.numa_node(), status);
+        }
+    }
+    return buffer;
 }
 
 #elif defined(__QNX__)
@@ -258,22 +273,49 @@ Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_from_user_address(void *user_ad
     return UserAllocatedDmaAbleBuffer::create(user_address, size);
 }
 
-Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size)
+static Expected<DmaAbleBufferPtr> allocate_dma_able_buffer(size_t size, bool use_huge_pages)
 {
+    // The typed memory used on qnx is not backed by huge pages
+    (void)use_huge_pages;
     return SharedMemoryDmaAbleBuffer::create(size);
 }
 
-Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size, HailoRTDriver &driver)
+static Expected<DmaAbleBufferPtr> allocate_dma_able_buffer(size_t size, HailoRTDriver &driver, bool use_huge_pages)
 {
     // qnx doesn't need the driver for the allocation
     (void)driver;
-    return create_by_allocation(size);
+    return allocate_dma_able_buffer(size, use_huge_pages);
 }
 
 #else
 #error "unsupported platform!"
 #endif
 
+// The allocated buffers are accounted in the host memory accountant of the current thread's scope (if any), for as
+// long as they are alive
+static Expected<DmaAbleBufferPtr> attach_host_memory_reservation(DmaAbleBufferPtr buffer,
+    HostMemoryReservationPtr reservation)
+{
+    auto result = HostMemoryAccountingScope::attach(std::move(buffer), std::move(reservation));
+    CHECK_NOT_NULL_AS_EXPECTED(result, HAILO_OUT_OF_HOST_MEMORY);
+    return result;
+}
+
+Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size, bool use_huge_pages)
+{
+    TRY(auto reservation, HostMemoryAccountingScope::reserve(HostMemoryType::DMA, size));
+    TRY(auto buffer, allocate_dma_able_buffer(size, use_huge_pages));
+    return attach_host_memory_reservation(std::move(buffer), std::move(reservation));
+}
+
+Expected<DmaAbleBufferPtr> DmaAbleBuffer::create_by_allocation(size_t size, HailoRTDriver &driver,
+    bool use_huge_pages)
+{
+    TRY(auto reservation, HostMemoryAccountingScope::reserve(HostMemoryType::DMA, size));
+    TRY(auto buffer, allocate_dma_able_buffer(size, driver, use_huge_pages));
+    return attach_host_memory_reservation(std::move(buffer), std::move(reservation));
+}
+
 
 } /* namespace vdma */
 } /* namespace hailort */
@@ -8,6 +8,8 @@
  *        There are several options for that buffer:
  *          1. No allocation - The user gives its own buffer pointer and address. The buffer must be page aligned.
  *          2. Normal allocation - page aligned allocation. This is the default option for linux and windows.
+ *             On linux, the allocation can be backed by huge pages (hugetlbfs pool if reserved, else transparent huge
+ *             pages), reducing the amount of scatter-gather entries and IOMMU TLB pressure of large buffers.
  *          3. Driver allocation - On some platforms, default user mode memory allocation is not DMAAble. To overcome
  *             this, we allocate the buffer in a low memory using hailort driver. We check it querying
  *             HailoRTDriver::allocate_driver_buffer().
@@ -34,12 +36,14 @@ public:
     // Create a DmaAbleBuffer from the user's provided address.
     static Expected<DmaAbleBufferPtr> create_from_user_address(void *user_address, size_t size);
 
-    // Create a DmaAbleBuffer by allocating memory.
-    static Expected<DmaAbleBufferPtr> create_by_allocation(size_t size);
+    // Create a DmaAbleBuffer by allocating memory. use_huge_pages is a hint, ignored on platforms that don't
+    // support it.
+    static Expected<DmaAbleBufferPtr> create_by_allocation(size_t size, bool use_huge_pages = false);
 
     // Create a DmaAbleBuffer by allocating memory, using the driver if needed (i.e.
-    // if driver.allocate_driver_buffer is true)
-    static Expected<DmaAbleBufferPtr> create_by_allocation(size_t size, HailoRTDriver &driver);
+    // if driver.allocate_driver_buffer is true). Driver allocated buffers don't use huge pages.
+    static Expected<DmaAbleBufferPtr> create_by_allocation(size_t size, HailoRTDriver &driver,
+        bool use_huge_pages = false);
 
     DmaAbleBuffer() = default;
     DmaAbleBuffer(DmaAbleBuffer &&other) = delete;
@@ -26,9 +26,9 @@ Expected<MappedBufferPtr> MappedBuffer::create_shared(DmaAbleBufferPtr buffer, H
 }
 
 Expected<MappedBufferPtr> MappedBuffer::create_shared_by_allocation(size_t size, HailoRTDriver &driver,
-    HailoRTDriver::DmaDirection data_direction)
+    HailoRTDriver::DmaDirection data_direction, bool use_huge_pages)
 {
-    auto buffer = DmaAbleBuffer::create_by_allocation(size, driver);
+    auto buffer = DmaAbleBuffer::create_by_allocation(size, driver, use_huge_pages);
     CHECK_EXPECTED(buffer);
 
     return create_shared(buffer.release(), driver, data_direction);
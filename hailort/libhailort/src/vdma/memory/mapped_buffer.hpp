@@ -44,7 +44,7 @@ public:
 
     // A DmaAbleBuffer of 'size' bytes will be allocated and mapped to dma in 'data_direction'
     static Expected<MappedBufferPtr> create_shared_by_allocation(size_t size, HailoRTDriver &driver,
-        HailoRTDriver::DmaDirection data_direction);
+        HailoRTDriver::DmaDirection data_direction, bool use_huge_pages = false);
 
     // Receive an fd to a dmabuf object and map it in our driver and create MappedBuffer
     static Expected<MappedBufferPtr> create_shared_from_dmabuf(int dmabuf_fd, size_t size, HailoRTDriver &driver,
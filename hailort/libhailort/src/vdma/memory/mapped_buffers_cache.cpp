@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file mapped_buffers_cache.cpp
+ * @brief Device-wide cache of user buffers mappings
+ **/
+
+#include "vdma/memory/mapped_buffers_cache.hpp"
+#include "utils/profiler/tracer_macros.hpp"
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#endif /* defined(__linux__) */
+
+
+namespace hailort {
+namespace vdma {
+
+static Expected<uint64_t> get_dmabuf_inode(int dmabuf_fd)
+{
+#if defined(__linux__)
+    struct stat dmabuf_stat{};
+    CHECK_AS_EXPECTED(0 == fstat(dmabuf_fd, &dmabuf_stat), HAILO_INVALID_ARGUMENT,
+        "Failed to fstat dmabuf fd {}, errno {}", dmabuf_fd, errno);
+    return static_cast<uint64_t>(dmabuf_stat.st_ino);
+#else
+    (void)dmabuf_fd;
+    LOGGER__ERROR("dmabuf is supported only on linux");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+#endif /* defined(__linux__) */
+}
+
+Expected<MappedBuffersCachePtr> MappedBuffersCache::create_shared(HailoRTDriver &driver, size_t max_cached_bytes)
+{
+    CHECK_AS_EXPECTED(0 != max_cached_bytes, HAILO_INVALID_ARGUMENT, "Mapped buffers cache size must be larger than 0");
+
+    auto cache = make_shared_nothrow<MappedBuffersCache>(driver, max_cached_bytes);
+    CHECK_NOT_NULL_AS_EXPECTED(cache, HAILO_OUT_OF_HOST_MEMORY);
+    return cache;
+}
+
+MappedBuffersCache::MappedBuffersCache(HailoRTDriver &driver, size_t max_cached_bytes) :
+    m_driver(driver),
+    m_max_cached_bytes(max_cached_bytes),
+    m_cached_bytes(0),
+    m_hits_count(0),
+    m_misses_count(0)
+{}
+
+Expected<MappedBufferPtr> MappedBuffersCache::get_mapping(MemoryView user_buffer,
+    HailoRTDriver::DmaDirection direction)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto key = std::make_tuple(HailoRTDriver::DmaBufferType::USER_PTR_BUFFER,
+        reinterpret_cast<uintptr_t>(user_buffer.data()), uint64_t(0), user_buffer.size(), direction);
+    return get_mapping_impl(key, [&]() -> Expected<MappedBufferPtr> {
+        TRY(auto dma_able_buffer, DmaAbleBuffer::create_from_user_address(user_buffer.data(), user_buffer.size()));
+        return MappedBuffer::create_shared(std::move(dma_able_buffer), m_driver, direction);
+    });
+}
+
+Expected<MappedBufferPtr> MappedBuffersCache::get_dmabuf_mapping(hailo_dma_buffer_t dmabuf,
+    HailoRTDriver::DmaDirection direction)
+{
+    TRY(const auto inode, get_dmabuf_inode(dmabuf.fd));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto key = std::make_tuple(HailoRTDriver::DmaBufferType::DMABUF_BUFFER, static_cast<uintptr_t>(dmabuf.fd),
+        inode, dmabuf.size, direction);
+    return get_mapping_impl(key, [&]() -> Expected<MappedBufferPtr> {
+        // The driver identifies dmabuf mappings by their fd, so mappings of a dmabuf that was closed (and its fd reused)
+        // must be removed before mapping the new dmabuf.
+        for (auto it = m_lru.begin(); it != m_lru.end();) {
+            auto current = it++;
+            if ((HailoRTDriver::DmaBufferType::DMABUF_BUFFER == std::get<0>(current->first)) &&
+                (static_cast<uintptr_t>(dmabuf.fd) == std::get<1>(current->first))) {
+                erase(current);
+            }
+        }
+        return MappedBuffer::create_shared_from_dmabuf(dmabuf.fd, dmabuf.size, m_driver, direction);
+    });
+}
+
+// Assumes that m_mutex is locked!
+Expected<MappedBufferPtr> MappedBuffersCache::get_mapping_impl(const Key &key,
+    const std::function<Expected<MappedBufferPtr>()> &create_mapping)
+{
+    const auto buffer_size = std::get<3>(key);
+    auto mapping = m_mappings.find(key);
+    if (mapping != m_mappings.end()) {
+        m_hits_count++;
+        // Move to the front of the lru list (iterators are not invalidated by splice)
+        m_lru.splice(m_lru.begin(), m_lru, mapping->second);
+        TRACE(MappedBuffersCacheTrace, m_driver.device_id(), true, buffer_size, m_hits_count, m_misses_count,
+            m_cached_bytes);
+        return MappedBufferPtr(mapping->second->second);
+    }
+
+    m_misses_count++;
+    TRY(auto mapped_buffer, create_mapping());
+
+    // Buffers larger than the whole budget are not cached (they would evict all other mappings).
+    if (buffer_size <= m_max_cached_bytes) {
+        m_lru.emplace_front(key, mapped_buffer);
+        m_mappings.emplace(key, m_lru.begin());
+        m_cached_bytes += buffer_size;
+        evict_lru_mappings();
+    }
+
+    TRACE(MappedBuffersCacheTrace, m_driver.device_id(), false, buffer_size, m_hits_count, m_misses_count,
+        m_cached_bytes);
+    return mapped_buffer;
+}
+
+void MappedBuffersCache::evict(void *address, size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto begin = reinterpret_cast<uintptr_t>(address);
+    const auto end = begin + size;
+    for (auto it = m_lru.begin(); it != m_lru.end();) {
+        const auto mapping_begin = std::get<1>(it->first);
+        const auto mapping_end = mapping_begin + std::get<3>(it->first);
+        auto current = it++;
+        if ((HailoRTDriver::DmaBufferType::USER_PTR_BUFFER == std::get<0>(current->first)) &&
+            (mapping_begin < end) && (begin < mapping_end)) {
+            erase(current);
+        }
+    }
+}
+
+void MappedBuffersCache::evict_dmabuf(int dmabuf_fd)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_lru.begin(); it != m_lru.end();) {
+        auto current = it++;
+        if ((HailoRTDriver::DmaBufferType::DMABUF_BUFFER == std::get<0>(current->first)) &&
+            (static_cast<uintptr_t>(dmabuf_fd) == std::get<1>(current->first))) {
+            erase(current);
+        }
+    }
+}
+
+void MappedBuffersCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mappings.clear();
+    m_lru.clear();
+    m_cached_bytes = 0;
+}
+
+// Assumes that m_mutex is locked!
+void MappedBuffersCache::evict_lru_mappings()
+{
+    while (m_cached_bytes > m_max_cached_bytes) {
+        assert(!m_lru.empty());
+        erase(std::prev(m_lru.end()));
+    }
+}
+
+// Assumes that m_mutex is locked!
+void MappedBuffersCache::erase(LruList::iterator it)
+{
+    m_cached_bytes -= std::get<3>(it->first);
+    m_mappings.erase(it->first);
+    // If no transfer uses the mapping, the buffer is unmapped here.
+    m_lru.erase(it);
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
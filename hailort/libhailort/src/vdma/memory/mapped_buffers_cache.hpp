@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file mapped_buffers_cache.hpp
+ * @brief Device-wide cache of user buffers mappings.
+ *
+ * User buffers that were not mapped by the user (using dma_map) are mapped on each transfer, and unmapped once the
+ * transfer is done. On applications that reuse the same buffers (for example, ring buffers of a capture stack), the
+ * pin/IOMMU cost is paid on every transfer.
+ * The cache keeps the mappings of the last used buffers alive (up to some budget of mapped bytes), evicting the least
+ * recently used mapping when the budget is exceeded.
+ *
+ * Dmabufs are cached as well (saving the dmabuf import on each transfer). Since fds can be reused after the dmabuf is
+ * closed, dmabuf mappings are identified by the dmabuf inode.
+ *
+ * Note: A cached buffer stays mapped after its transfer is done, so the user must not free it while it is cached. The
+ *       buffer can be evicted by calling dma_unmap (or dma_unmap_dmabuf) on it.
+ **/
+
+#ifndef _HAILO_VDMA_MAPPED_BUFFERS_CACHE_HPP_
+#define _HAILO_VDMA_MAPPED_BUFFERS_CACHE_HPP_
+
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+#include "vdma/memory/mapped_buffer.hpp"
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <functional>
+
+
+namespace hailort {
+namespace vdma {
+
+class MappedBuffersCache;
+using MappedBuffersCachePtr = std::shared_ptr<MappedBuffersCache>;
+
+class MappedBuffersCache final
+{
+public:
+    static Expected<MappedBuffersCachePtr> create_shared(HailoRTDriver &driver, size_t max_cached_bytes);
+
+    MappedBuffersCache(HailoRTDriver &driver, size_t max_cached_bytes);
+    MappedBuffersCache(const MappedBuffersCache &) = delete;
+    MappedBuffersCache &operator=(const MappedBuffersCache &) = delete;
+    MappedBuffersCache(MappedBuffersCache &&) = delete;
+    MappedBuffersCache &operator=(MappedBuffersCache &&) = delete;
+    ~MappedBuffersCache() = default;
+
+    // Returns the cached mapping of the user buffer, or maps it (and caches the mapping) if it is not cached.
+    Expected<MappedBufferPtr> get_mapping(MemoryView user_buffer, HailoRTDriver::DmaDirection direction);
+    Expected<MappedBufferPtr> get_dmabuf_mapping(hailo_dma_buffer_t dmabuf, HailoRTDriver::DmaDirection direction);
+
+    // Removes all cached mappings overlapping the given address range (on all directions). The mappings are unmapped
+    // once the transfers using them are done.
+    void evict(void *address, size_t size);
+    // Removes all cached mappings of the given dmabuf fd (on all directions).
+    void evict_dmabuf(int dmabuf_fd);
+
+    void clear();
+
+private:
+    // (buffer type, address or fd, dmabuf inode (0 for user buffers), size, direction)
+    using Key = std::tuple<HailoRTDriver::DmaBufferType, uintptr_t, uint64_t, size_t, HailoRTDriver::DmaDirection>;
+    using LruList = std::list<std::pair<Key, MappedBufferPtr>>;
+
+    // Assumes that m_mutex is locked!
+    Expected<MappedBufferPtr> get_mapping_impl(const Key &key,
+        const std::function<Expected<MappedBufferPtr>()> &create_mapping);
+    void evict_lru_mappings();
+    void erase(LruList::iterator it);
+
+    HailoRTDriver &m_driver;
+    const size_t m_max_cached_bytes;
+
+    std::mutex m_mutex;
+    // Most recently used mapping is at the front.
+    LruList m_lru;
+    std::map<Key, LruList::iterator> m_mappings;
+    size_t m_cached_bytes;
+
+    // Exposed through MappedBuffersCacheTrace
+    uint64_t m_hits_count;
+    uint64_t m_misses_count;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_MAPPED_BUFFERS_CACHE_HPP_ */
@@ -9,18 +9,27 @@
 
 #include "vdma/memory/sg_buffer.hpp"
 
+#include <cstdlib>
+
 
 namespace hailort {
 namespace vdma {
 
-Expected<SgBuffer> SgBuffer::create(HailoRTDriver &driver, size_t size, HailoRTDriver::DmaDirection data_direction)
+Expected<SgBuffer> SgBuffer::create(HailoRTDriver &driver, size_t size, HailoRTDriver::DmaDirection data_direction,
+    bool use_huge_pages)
 {
-    auto mapped_buffer = MappedBuffer::create_shared_by_allocation(size, driver, data_direction);
+    auto mapped_buffer = MappedBuffer::create_shared_by_allocation(size, driver, data_direction, use_huge_pages);
     CHECK_EXPECTED(mapped_buffer);
 
     return SgBuffer(mapped_buffer.release());
 }
 
+bool SgBuffer::should_use_huge_pages_for_internal_buffers()
+{
+    static const bool use_huge_pages = (nullptr != std::getenv(HAILO_SG_BUFFERS_USE_HUGE_PAGES_ENV_VAR));
+    return use_huge_pages;
+}
+
 SgBuffer::SgBuffer(std::shared_ptr<MappedBuffer> mapped_buffer) :
     m_mapped_buffer(mapped_buffer)
 {}
@@ -20,9 +20,16 @@
 namespace hailort {
 namespace vdma {
 
+#define HAILO_SG_BUFFERS_USE_HUGE_PAGES_ENV_VAR "HAILO_SG_BUFFERS_USE_HUGE_PAGES"
+
 class SgBuffer final : public VdmaBuffer {
 public:
-    static Expected<SgBuffer> create(HailoRTDriver &driver, size_t size, HailoRTDriver::DmaDirection data_direction);
+    static Expected<SgBuffer> create(HailoRTDriver &driver, size_t size, HailoRTDriver::DmaDirection data_direction,
+        bool use_huge_pages = false);
+
+    // Internal sg buffers (inter-context and ddr buffers) are backed by huge pages (and use the max descriptor page
+    // size, see BufferSizesRequirements) only if HAILO_SG_BUFFERS_USE_HUGE_PAGES_ENV_VAR is set.
+    static bool should_use_huge_pages_for_internal_buffers();
 
     virtual ~SgBuffer() = default;
 
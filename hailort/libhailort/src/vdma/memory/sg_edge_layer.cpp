@@ -69,5 +69,25 @@ Expected<uint32_t> SgEdgeLayer::program_descriptors(size_t transfer_size, Interr
     return descriptors_in_buffer(transfer_size);
 }
 
+Expected<uint32_t> SgEdgeLayer::program_transfers_descriptors(size_t transfer_size, uint16_t transfers_count,
+    InterruptsDomain last_transfer_interrupts_domain)
+{
+    const auto descs_per_transfer = descriptors_in_buffer(transfer_size);
+    const auto buffer_handle = get_mapped_buffer()->handle();
+
+    std::vector<HailoRTDriver::DescriptorsListProgram> programs;
+    programs.reserve(transfers_count);
+    for (uint16_t i = 0; i < transfers_count; i++) {
+        const auto desc_offset = static_cast<uint32_t>(i * descs_per_transfer);
+        const auto last_desc_interrupts = ((transfers_count - 1) == i) ?
+            last_transfer_interrupts_domain : InterruptsDomain::NONE;
+        programs.emplace_back(HailoRTDriver::DescriptorsListProgram{buffer_handle, transfer_size,
+            desc_offset * desc_page_size(), desc_offset, last_desc_interrupts});
+    }
+
+    CHECK_SUCCESS(m_desc_list.program_batch(programs, m_channel_id, false));
+    return descs_per_transfer * transfers_count;
+}
+
 }
 }
\ No newline at end of file
@@ -48,6 +48,8 @@ public:
 
     virtual Expected<uint32_t> program_descriptors(size_t transfer_size, InterruptsDomain last_desc_interrupts_domain,
         size_t desc_offset, size_t buffer_offset = 0, bool should_bind = false) override;
+    virtual Expected<uint32_t> program_transfers_descriptors(size_t transfer_size, uint16_t transfers_count,
+        InterruptsDomain last_transfer_interrupts_domain) override;
 
 private:
     SgEdgeLayer(std::shared_ptr<SgBuffer> &&buffer, DescriptorList &&desc_list,
@@ -9,12 +9,181 @@
 #include "pcie_session.hpp"
 #include "vdma/channel/channels_group.hpp"
 
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
 namespace hailort
 {
 
 static constexpr uint64_t MAX_ONGOING_TRANSFERS = 128;
 
-Expected<PcieSession> PcieSession::connect(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port)
+// The streaming mode state: the send and receive buffers (each mapped once, when the session is created), used as
+// rings. The transfers of a channel are completed in order, hence the buffers are reused in order as well.
+class PcieSessionStreaming final : public std::enable_shared_from_this<PcieSessionStreaming>
+{
+public:
+    static Expected<std::shared_ptr<PcieSessionStreaming>> create(std::shared_ptr<HailoRTDriver> driver,
+        const PcieSessionStreamingParams &params)
+    {
+        CHECK_AS_EXPECTED((0 == (params.message_size % 8)) && (params.message_size <= PcieSession::max_transfer_size()),
+            HAILO_INVALID_ARGUMENT, "Invalid streaming message size {} (must be a multiple of 8, up to {})",
+            params.message_size, PcieSession::max_transfer_size());
+        // Each message takes its descriptors on the (circular) descriptors list, which must never be full
+        const auto descs_per_message = (params.message_size + vdma::DEFAULT_SG_PAGE_SIZE - 1) / vdma::DEFAULT_SG_PAGE_SIZE;
+        CHECK_AS_EXPECTED((0 < params.credits_count) && (params.credits_count <= MAX_ONGOING_TRANSFERS) &&
+            ((params.credits_count * descs_per_message) < MAX_SG_DESCS_COUNT), HAILO_INVALID_ARGUMENT,
+            "Invalid streaming credits count {} for messages of {} bytes (must be between 1 and {}, and fit in {} descriptors)",
+            params.credits_count, params.message_size, MAX_ONGOING_TRANSFERS, MAX_SG_DESCS_COUNT - 1);
+
+        auto create_buffers = [&](HailoRTDriver::DmaDirection direction) -> Expected<std::vector<Slot>> {
+            std::vector<Slot> slots(params.credits_count);
+            for (auto &slot : slots) {
+                TRY(slot.buffer, vdma::MappedBuffer::create_shared_by_allocation(params.message_size, *driver, direction));
+            }
+            return slots;
+        };
+        TRY(auto send_slots, create_buffers(HailoRTDriver::DmaDirection::H2D));
+        TRY(auto receive_slots, create_buffers(HailoRTDriver::DmaDirection::D2H));
+
+        auto streaming = make_shared_nothrow<PcieSessionStreaming>(std::move(driver), params.message_size,
+            std::move(send_slots), std::move(receive_slots));
+        CHECK_NOT_NULL_AS_EXPECTED(streaming, HAILO_OUT_OF_HOST_MEMORY);
+        return streaming;
+    }
+
+    struct Slot {
+        vdma::MappedBufferPtr buffer;
+        // HAILO_UNINITIALIZED while the transfer of the buffer is ongoing
+        hailo_status status = HAILO_SUCCESS;
+    };
+
+    PcieSessionStreaming(std::shared_ptr<HailoRTDriver> &&driver, size_t message_size, std::vector<Slot> &&send_slots,
+        std::vector<Slot> &&receive_slots) :
+        m_driver(std::move(driver)), m_message_size(message_size), m_send_slots(std::move(send_slots)),
+        m_receive_slots(std::move(receive_slots)), m_send_index(0), m_receive_index(0), m_send_status(HAILO_SUCCESS)
+    {}
+
+    // Posts all of the receive buffers, giving the other side its initial credits
+    hailo_status start(vdma::BoundaryChannel &output)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_receive_slots.size(); i++) {
+            CHECK_SUCCESS(post_receive(output, i));
+        }
+        return HAILO_SUCCESS;
+    }
+
+    hailo_status write(vdma::BoundaryChannel &input, const uint8_t *buffer, size_t size, std::chrono::milliseconds timeout)
+    {
+        std::lock_guard<std::mutex> write_lock(m_write_mutex);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (size_t offset = 0; offset < size; offset += m_message_size) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto &slot = m_send_slots[m_send_index];
+            CHECK(m_cv.wait_until(lock, deadline, [&] { return HAILO_UNINITIALIZED != slot.status; }), HAILO_TIMEOUT,
+                "Timeout waiting for a send buffer of the pcie session");
+            if (HAILO_SUCCESS != m_send_status) {
+                // An earlier message failed, so the stream of messages is broken
+                return m_send_status;
+            }
+
+            const auto message_bytes = std::min(size - offset, m_message_size);
+            std::memcpy(slot.buffer->user_address(), buffer + offset, message_bytes);
+            slot.status = HAILO_UNINITIALIZED;
+            auto self = shared_from_this();
+            auto slot_ptr = &slot;
+            auto status = launch(input, slot, [self, slot_ptr](hailo_status transfer_status) {
+                {
+                    std::lock_guard<std::mutex> callback_lock(self->m_mutex);
+                    slot_ptr->status = HAILO_SUCCESS;
+                    if ((HAILO_SUCCESS != transfer_status) && (HAILO_SUCCESS == self->m_send_status)) {
+                        self->m_send_status = transfer_status;
+                    }
+                }
+                self->m_cv.notify_all();
+            });
+            if (HAILO_SUCCESS != status) {
+                slot.status = HAILO_SUCCESS;
+                return status;
+            }
+            m_send_index = (m_send_index + 1) % m_send_slots.size();
+        }
+
+        return HAILO_SUCCESS;
+    }
+
+    hailo_status read(vdma::BoundaryChannel &output, uint8_t *buffer, size_t size, std::chrono::milliseconds timeout)
+    {
+        std::lock_guard<std::mutex> read_lock(m_read_mutex);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (size_t offset = 0; offset < size; offset += m_message_size) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto &slot = m_receive_slots[m_receive_index];
+            CHECK(m_cv.wait_until(lock, deadline, [&] { return HAILO_UNINITIALIZED != slot.status; }), HAILO_TIMEOUT,
+                "Timeout waiting for a message on the pcie session");
+            if (HAILO_SUCCESS != slot.status) {
+                return slot.status;
+            }
+
+            std::memcpy(buffer + offset, slot.buffer->user_address(), std::min(size - offset, m_message_size));
+            // Reposting the buffer returns its credit to the other side
+            CHECK_SUCCESS(post_receive(output, m_receive_index));
+            m_receive_index = (m_receive_index + 1) % m_receive_slots.size();
+        }
+
+        return HAILO_SUCCESS;
+    }
+
+private:
+    // Called with m_mutex locked
+    hailo_status post_receive(vdma::BoundaryChannel &output, size_t index)
+    {
+        auto &slot = m_receive_slots[index];
+        slot.status = HAILO_UNINITIALIZED;
+        auto self = shared_from_this();
+        auto slot_ptr = &slot;
+        auto status = launch(output, slot, [self, slot_ptr](hailo_status transfer_status) {
+            {
+                std::lock_guard<std::mutex> callback_lock(self->m_mutex);
+                slot_ptr->status = transfer_status;
+            }
+            self->m_cv.notify_all();
+        });
+        if (HAILO_SUCCESS != status) {
+            slot.status = status;
+        }
+        return status;
+    }
+
+    hailo_status launch(vdma::BoundaryChannel &channel, Slot &slot, std::function<void(hailo_status)> &&callback)
+    {
+        TransferRequest request{
+            {TransferBuffer(MemoryView(slot.buffer->user_address(), m_message_size))},
+            std::move(callback)
+        };
+
+        return channel.launch_transfer(std::move(request));
+    }
+
+    // The buffers are unmapped using the driver
+    std::shared_ptr<HailoRTDriver> m_driver;
+    const size_t m_message_size;
+    std::vector<Slot> m_send_slots;
+    std::vector<Slot> m_receive_slots;
+    size_t m_send_index;
+    size_t m_receive_index;
+    // The first failure of a sent message
+    hailo_status m_send_status;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // Serialize the writers (and the readers), so the messages of a write (or a read) aren't interleaved with others
+    std::mutex m_write_mutex;
+    std::mutex m_read_mutex;
+};
+
+Expected<PcieSession> PcieSession::connect(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port,
+    const PcieSessionStreamingParams &streaming_params)
 {
     TRY(auto input_desc_list, create_desc_list(*driver));
     TRY(auto output_desc_list, create_desc_list(*driver));
@@ -24,10 +193,11 @@ Expected<PcieSession> PcieSession::connect(std::shared_ptr<HailoRTDriver> driver
     (void)port;
 
     return PcieSession::create(driver, channel_pair.first, channel_pair.second, std::move(input_desc_list),
-        std::move(output_desc_list), PcieSessionType::CLIENT);
+        std::move(output_desc_list), PcieSessionType::CLIENT, streaming_params);
 }
 
-Expected<PcieSession> PcieSession::accept(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port)
+Expected<PcieSession> PcieSession::accept(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port,
+    const PcieSessionStreamingParams &streaming_params)
 {
     TRY(auto input_desc_list, create_desc_list(*driver));
     TRY(auto output_desc_list, create_desc_list(*driver));
@@ -37,22 +207,23 @@ Expected<PcieSession> PcieSession::accept(std::shared_ptr<HailoRTDriver> driver,
     (void)port;
 
     return PcieSession::create(driver, channel_pair.first, channel_pair.second, std::move(input_desc_list),
-        std::move(output_desc_list), PcieSessionType::SERVER);
+        std::move(output_desc_list), PcieSessionType::SERVER, streaming_params);
 }
 
 Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver, vdma::ChannelId input_channel_id,
     vdma::ChannelId output_channel_id, vdma::DescriptorList &&input_desc_list, vdma::DescriptorList &&output_desc_list,
-    PcieSessionType session_type)
+    PcieSessionType session_type, const PcieSessionStreamingParams &streaming_params)
 {
     // TODO: HRT-14038 - remove this to support multiple connections. Until then, mark as used to allow ctrl+c handle
     CHECK_SUCCESS(driver->mark_as_used());
 
     TRY(auto interrupts_dispatcher, vdma::InterruptsDispatcher::create(*driver));
     TRY(auto transfer_launcher, vdma::TransferLauncher::create());
+    TRY(auto mapped_buffers_cache, create_mapped_buffers_cache(*driver));
 
     auto create_channel = [&](vdma::ChannelId id, vdma::BoundaryChannel::Direction dir, vdma::DescriptorList &&desc_list) {
         return vdma::BoundaryChannel::create(*driver, id, dir, std::move(desc_list), *transfer_launcher,
-            MAX_ONGOING_TRANSFERS);
+            MAX_ONGOING_TRANSFERS, 0, "", nullptr, mapped_buffers_cache);
     };
 
     TRY(auto input_channel, create_channel(input_channel_id, vdma::BoundaryChannel::Direction::H2D, std::move(input_desc_list)));
@@ -64,27 +235,44 @@ Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver,
     CHECK_SUCCESS(input_channel->activate());
     CHECK_SUCCESS(output_channel->activate());
 
-    return PcieSession(std::move(driver), std::move(interrupts_dispatcher), std::move(transfer_launcher),
-        std::move(input_channel), std::move(output_channel), session_type);
+    std::shared_ptr<PcieSessionStreaming> streaming = nullptr;
+    if (0 != streaming_params.message_size) {
+        TRY(streaming, PcieSessionStreaming::create(driver, streaming_params));
+        CHECK_SUCCESS(streaming->start(*output_channel));
+    }
+
+    return PcieSession(std::move(driver), std::move(mapped_buffers_cache), std::move(interrupts_dispatcher),
+        std::move(transfer_launcher), std::move(input_channel), std::move(output_channel), session_type,
+        std::move(streaming));
 }
 
 hailo_status PcieSession::write(const void *buffer, size_t size, std::chrono::milliseconds timeout)
 {
+    if (m_streaming) {
+        return m_streaming->write(*m_input, static_cast<const uint8_t*>(buffer), size, timeout);
+    }
     return launch_transfer_sync(*m_input, const_cast<void *>(buffer), size, timeout);
 }
 
 hailo_status PcieSession::read(void *buffer, size_t size, std::chrono::milliseconds timeout)
 {
+    if (m_streaming) {
+        return m_streaming->read(*m_output, static_cast<uint8_t*>(buffer), size, timeout);
+    }
     return launch_transfer_sync(*m_output, buffer, size, timeout);
 }
 
 hailo_status PcieSession::write_async(const void *buffer, size_t size, std::function<void(hailo_status)> &&callback)
 {
+    // The async transfers of the user would break the messages of the streaming mode
+    CHECK(!m_streaming, HAILO_INVALID_OPERATION, "write_async is not supported in streaming mode");
     return launch_transfer_async(*m_input, const_cast<void *>(buffer), size, std::move(callback));
 }
 
 hailo_status PcieSession::read_async(void *buffer, size_t size, std::function<void(hailo_status)> &&callback)
 {
+    // The async transfers of the user would break the messages of the streaming mode
+    CHECK(!m_streaming, HAILO_INVALID_OPERATION, "read_async is not supported in streaming mode");
     return launch_transfer_async(*m_output, buffer, size, std::move(callback));
 }
 
@@ -167,6 +355,22 @@ hailo_status PcieSession::launch_transfer_async(vdma::BoundaryChannel &channel,
     return channel.launch_transfer(std::move(request));
 }
 
+Expected<vdma::MappedBuffersCachePtr> PcieSession::create_mapped_buffers_cache(HailoRTDriver &driver)
+{
+    auto cache_size_env_var = get_env_variable(HAILO_PCIE_SESSION_MAPPING_CACHE_SIZE_ENV_VAR);
+    if (!cache_size_env_var) {
+        return vdma::MappedBuffersCachePtr(nullptr);
+    }
+
+    const auto max_cached_bytes = std::stoull(cache_size_env_var.value());
+    if (0 == max_cached_bytes) {
+        return vdma::MappedBuffersCachePtr(nullptr);
+    }
+
+    LOGGER__INFO("Caching the mappings of up to {} bytes of user buffers transferred on the pcie session", max_cached_bytes);
+    return vdma::MappedBuffersCache::create_shared(driver, static_cast<size_t>(max_cached_bytes));
+}
+
 Expected<vdma::DescriptorList> PcieSession::create_desc_list(HailoRTDriver &driver)
 {
     const bool circular = true;
@@ -15,15 +15,40 @@
 #include "vdma/channel/boundary_channel.hpp"
 #include "vdma/channel/interrupts_dispatcher.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/memory/mapped_buffers_cache.hpp"
 
 namespace hailort
 {
 
+// Maximum amount of bytes of user buffers whose mappings are kept alive after their transfers on the session are done,
+// so buffers that are reused (e.g. the frames of an application cycling over a fixed set of buffers) are mapped once
+// instead of on each transfer. Defaults to 0 (cache disabled).
+// Note: A cached buffer stays mapped after its transfer is done, hence it must not be freed while the session is alive.
+#define HAILO_PCIE_SESSION_MAPPING_CACHE_SIZE_ENV_VAR ("HAILO_PCIE_SESSION_MAPPING_CACHE_SIZE")
+
+// Enables the streaming mode (see PcieSessionStreamingParams) of the sessions of the hrpc connections over PCIe, with
+// messages of the given size. Must be set to the same value on both sides of the connection.
+#define HAILO_PCIE_SESSION_STREAMING_MESSAGE_SIZE_ENV_VAR ("HAILO_PCIE_SESSION_STREAMING_MESSAGE_SIZE")
+
 // A special magic number used to match each accept() with the corresponding connect().
 // By using this magic, multiple servers can be implemented and run simultaneously on the same device.
 using pcie_connection_port_t = uint32_t;
 using PcieSessionType = HailoRTDriver::PcieSessionType;
 
+// Parameters of the streaming mode of a session. In streaming mode, the session keeps credits_count pre-mapped buffers
+// of message_size bytes for each direction: the receive buffers are always posted on the descriptors ring (so a write
+// of the other side lands without waiting for a read to be launched), and a write only copies into a free send buffer
+// and launches it (so successive writes don't wait for each other nor map the user buffer).
+// Both sides of the session must use the same message_size - each write is sent as messages of message_size bytes (the
+// last one is padded), and each read receives the same amount of messages.
+struct PcieSessionStreamingParams {
+    // 0 disables the streaming mode. Must be a multiple of 8, no larger than PcieSession::max_transfer_size().
+    size_t message_size;
+    size_t credits_count;
+};
+
+class PcieSessionStreaming;
+
 /**
  * a PcieSession object need to be constructed both at the device side (via accept) or the host side (via connect).
  * After the session is created on both sides, the session can be used to send and receive data (based on the desired
@@ -54,9 +79,13 @@ using PcieSessionType = HailoRTDriver::PcieSessionType;
 class PcieSession final {
 public:
 
-    static Expected<PcieSession> connect(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port);
-    static Expected<PcieSession> accept(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port);
+    static Expected<PcieSession> connect(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port,
+        const PcieSessionStreamingParams &streaming_params = PcieSessionStreamingParams{});
+    static Expected<PcieSession> accept(std::shared_ptr<HailoRTDriver> driver, pcie_connection_port_t port,
+        const PcieSessionStreamingParams &streaming_params = PcieSessionStreamingParams{});
 
+    // In streaming mode, the buffers have no alignment or size limitations (they are copied to the session's buffers),
+    // and write returns once the data is copied (a failure of the transfer is returned by the following write).
     hailo_status write(const void *buffer, size_t size, std::chrono::milliseconds timeout);
     hailo_status read(void *buffer, size_t size, std::chrono::milliseconds timeout);
 
@@ -70,6 +99,11 @@ public:
         return m_session_type;
     }
 
+    inline bool is_streaming() const
+    {
+        return nullptr != m_streaming;
+    }
+
     static uint64_t max_transfer_size();
 
 private:
@@ -79,18 +113,21 @@ private:
 
     static Expected<PcieSession> create(std::shared_ptr<HailoRTDriver> driver, vdma::ChannelId input_channel,
         vdma::ChannelId output_channel, vdma::DescriptorList &&input_desc_list, vdma::DescriptorList &&output_desc_list,
-        PcieSessionType session_type);
+        PcieSessionType session_type, const PcieSessionStreamingParams &streaming_params);
 
-    PcieSession(std::shared_ptr<HailoRTDriver> &&driver,
+    PcieSession(std::shared_ptr<HailoRTDriver> &&driver, vdma::MappedBuffersCachePtr &&mapped_buffers_cache,
         std::unique_ptr<vdma::InterruptsDispatcher> &&interrupts_dispatcher,
         std::unique_ptr<vdma::TransferLauncher> &&transfer_launcher,
-        vdma::BoundaryChannelPtr &&input, vdma::BoundaryChannelPtr &&output, PcieSessionType session_type) :
+        vdma::BoundaryChannelPtr &&input, vdma::BoundaryChannelPtr &&output, PcieSessionType session_type,
+        std::shared_ptr<PcieSessionStreaming> &&streaming) :
         m_driver(std::move(driver)),
+        m_mapped_buffers_cache(std::move(mapped_buffers_cache)),
         m_interrupts_dispatcher(std::move(interrupts_dispatcher)),
         m_transfer_launcher(std::move(transfer_launcher)),
         m_input(std::move(input)),
         m_output(std::move(output)),
-        m_session_type(session_type)
+        m_session_type(session_type),
+        m_streaming(std::move(streaming))
     {}
 
     static hailo_status launch_transfer_sync(vdma::BoundaryChannel &channel,
@@ -98,8 +135,11 @@ private:
     static hailo_status launch_transfer_async(vdma::BoundaryChannel &channel,
         void *buffer, size_t size, std::function<void(hailo_status)> &&callback);
     static Expected<vdma::DescriptorList> create_desc_list(HailoRTDriver &driver);
+    static Expected<vdma::MappedBuffersCachePtr> create_mapped_buffers_cache(HailoRTDriver &driver);
 
     std::shared_ptr<HailoRTDriver> m_driver;
+    // Must be destroyed before the driver, as the cached mappings are unmapped using it. nullptr if disabled.
+    vdma::MappedBuffersCachePtr m_mapped_buffers_cache;
 
     std::unique_ptr<vdma::InterruptsDispatcher> m_interrupts_dispatcher;
     std::unique_ptr<vdma::TransferLauncher> m_transfer_launcher;
@@ -108,6 +148,9 @@ private:
     vdma::BoundaryChannelPtr m_output;
 
     PcieSessionType m_session_type;
+
+    // nullptr if the streaming mode is disabled. Shared with the callbacks of the posted transfers.
+    std::shared_ptr<PcieSessionStreaming> m_streaming;
 };
 
 } /* namespace hailort */
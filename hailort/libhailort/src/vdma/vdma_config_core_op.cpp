@@ -40,7 +40,13 @@ VdmaConfigCoreOp::VdmaConfigCoreOp(ActiveCoreOpHolder &active_core_op_holder, co
                                    std::shared_ptr<CoreOpMetadata> metadata, hailo_status &status) :
     CoreOp(config_params, metadata, active_core_op_holder, status),
     m_resources_manager(std::move(resources_manager)),
-    m_cache_manager(cache_manager)
+    m_cache_manager(cache_manager),
+    m_defer_cache_offset_updates(is_env_variable_on(HAILORT_DEFER_CACHE_OFFSET_UPDATES_ENV_VAR)),
+    m_is_fast_manual_switch(is_env_variable_on(HAILORT_FAST_MANUAL_SWITCH_ENV_VAR) &&
+        (Device::Type::INTEGRATED != m_resources_manager->get_device().get_type())),
+    m_pending_cache_offset_mutex(),
+    m_has_pending_cache_offset_update(false),
+    m_pending_cache_offset_delta(0)
 {}
 
 
@@ -67,11 +73,41 @@ hailo_status VdmaConfigCoreOp::cancel_pending_transfers()
     return status;
 }
 
-hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
+hailo_status VdmaConfigCoreOp::infer_async(InferRequest &&request)
 {
-    auto status = register_cache_update_callback();
-    CHECK_SUCCESS(status, "Failed to register cache update callback");
+    // All streams transfers launched on this thread are collected by the batch, and launched on its destruction.
+    vdma::TransferLaunchBatch launch_batch;
+
+    auto status = apply_pending_cache_offset_update();
+    CHECK_SUCCESS(status, "Failed applying the pending cache offset update");
+
+    return CoreOp::infer_async(std::move(request));
+}
+
+hailo_status VdmaConfigCoreOp::prefetch_mappings(InferRequest &request)
+{
+    // The transfers are indexed by the order of the inputs followed by the outputs (see CoreOp::get_stream_index)
+    assert(request.transfers.size() == (m_input_streams.size() + m_output_streams.size()));
+    size_t stream_index = 0;
+    auto prefetch_stream_mappings = [this, &request, &stream_index](const std::string &stream_name) -> hailo_status {
+        TRY(auto channel, get_boundary_vdma_channel_by_stream_name(stream_name));
+        CHECK_SUCCESS(channel->prefetch_mappings(request.transfers[stream_index]), "Failed prefetching mappings for stream {}",
+            stream_name);
+        stream_index++;
+        return HAILO_SUCCESS;
+    };
 
+    for (const auto &input : m_input_streams) {
+        CHECK_SUCCESS(prefetch_stream_mappings(input.first));
+    }
+    for (const auto &output : m_output_streams) {
+        CHECK_SUCCESS(prefetch_stream_mappings(output.first));
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
+{
     auto start_time = std::chrono::steady_clock::now();
     if (CONTROL_PROTOCOL__IGNORE_DYNAMIC_BATCH_SIZE != dynamic_batch_size) {
         CHECK(dynamic_batch_size <= get_smallest_configured_batch_size(get_config_params()),
@@ -79,8 +115,17 @@ hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
             get_smallest_configured_batch_size(get_config_params()));
     }
 
-    status = m_resources_manager->enable_state_machine(dynamic_batch_size);
-    CHECK_SUCCESS(status, "Failed to activate state-machine");
+    auto core_op_pending_reset = m_resources_manager->get_device().take_core_op_pending_reset();
+    if (nullptr != core_op_pending_reset) {
+        auto status = switch_from_core_op(*core_op_pending_reset, dynamic_batch_size);
+        CHECK_SUCCESS(status, "Failed to switch state-machine");
+    } else {
+        auto status = register_cache_update_callback();
+        CHECK_SUCCESS(status, "Failed to register cache update callback");
+
+        status = m_resources_manager->enable_state_machine(dynamic_batch_size);
+        CHECK_SUCCESS(status, "Failed to activate state-machine");
+    }
 
     CHECK_SUCCESS(activate_host_resources(), "Failed to activate host resources");
 
@@ -99,7 +144,26 @@ hailo_status VdmaConfigCoreOp::deactivate_impl()
     auto status = deactivate_host_resources();
     CHECK_SUCCESS(status);
 
-    status = m_resources_manager->reset_state_machine();
+    if (m_is_fast_manual_switch && m_resources_manager->get_is_activated()) {
+        // The fw keeps running the (now idle) core-op until the next activation switches from it. Its pending
+        // transfers are released only then, since its channels may still be in use until the switch.
+        m_resources_manager->get_device().set_core_op_pending_reset(this);
+    } else {
+        status = reset_core_op();
+        CHECK_SUCCESS(status);
+    }
+
+    //TODO: HRT-13019 - Unite with the calculation in core_op.cpp
+    const auto elapsed_time_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start_time).count();
+    TRACE(DeactivateCoreOpTrace, std::string(m_resources_manager->get_dev_id()), vdevice_core_op_handle(), elapsed_time_ms);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaConfigCoreOp::reset_core_op()
+{
+    auto status = m_resources_manager->reset_state_machine();
     CHECK_SUCCESS(status, "Failed to reset context switch state machine");
 
     // After the state machine has been reset the vdma channels are no longer active, so we
@@ -107,17 +171,50 @@ hailo_status VdmaConfigCoreOp::deactivate_impl()
     status = cancel_pending_transfers();
     CHECK_SUCCESS(status, "Failed to cancel pending transfers");
 
-    //TODO: HRT-13019 - Unite with the calculation in core_op.cpp
-    const auto elapsed_time_ms = std::chrono::duration<double, std::milli>(
-        std::chrono::steady_clock::now() - start_time).count();
-    TRACE(DeactivateCoreOpTrace, std::string(m_resources_manager->get_dev_id()), vdevice_core_op_handle(), elapsed_time_ms);
-
     status = unregister_cache_update_callback();
     CHECK_SUCCESS(status, "Failed to unregister cache update callback");
 
     return HAILO_SUCCESS;
 }
 
+hailo_status VdmaConfigCoreOp::reset_deferred_deactivation()
+{
+    LOGGER__INFO("Resetting core-op {}, left enabled by its manual deactivation", name());
+    return reset_core_op();
+}
+
+hailo_status VdmaConfigCoreOp::switch_from_core_op(VdmaConfigCoreOp &previous, uint16_t dynamic_batch_size)
+{
+    // Same order as the scheduler's switch (see VdmaConfigManager::switch_core_op). The previous core-op's host
+    // resources were already deactivated.
+    if (&previous != this) {
+        auto status = register_cache_update_callback();
+        CHECK_SUCCESS(status, "Failed to register cache update callback");
+    }
+
+    auto status = m_resources_manager->enable_state_machine(dynamic_batch_size);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed switching from core-op {} to {}, status {}", previous.name(), name(), status);
+        // The previous core-op is reset, so the next activation starts from a clean state machine
+        auto reset_status = previous.reset_core_op();
+        if (HAILO_SUCCESS != reset_status) {
+            LOGGER__ERROR("Failed resetting core-op {}, status {}", previous.name(), reset_status);
+        }
+        return status;
+    }
+
+    // The fw switched out of the previous core-op, so its channels are no longer active
+    status = previous.cancel_pending_transfers();
+    CHECK_SUCCESS(status, "Failed canceling pending transfers from previous core-op");
+    if (&previous != this) {
+        previous.get_resources_manager()->set_is_activated(false);
+        status = previous.unregister_cache_update_callback();
+        CHECK_SUCCESS(status, "Failed unregistering cache updates from previous core-op");
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status VdmaConfigCoreOp::register_cache_update_callback()
 {
     const auto cache_offset_env_var = get_env_variable(HAILORT_AUTO_UPDATE_CACHE_OFFSET_ENV_VAR);
@@ -144,7 +241,8 @@ hailo_status VdmaConfigCoreOp::register_cache_update_callback()
                 return;
             }
 
-            const auto status = this->update_cache_offset(static_cast<int32_t>(offset_delta));
+            // The fw waits for the update, so it isn't deferred
+            const auto status = this->apply_cache_offset_update(static_cast<int32_t>(offset_delta));
             if (HAILO_SUCCESS != status) {
                 LOGGER__ERROR("Failed to update cache offset");
             }
@@ -182,6 +280,19 @@ hailo_status VdmaConfigCoreOp::shutdown()
         status = deactivate_status;
     }
 
+    // A shutdown core-op isn't left enabled on the fw
+    auto &device = m_resources_manager->get_device();
+    auto core_op_pending_reset = device.take_core_op_pending_reset();
+    if (this == core_op_pending_reset) {
+        auto reset_status = reset_core_op();
+        if (HAILO_SUCCESS != reset_status) {
+            LOGGER__ERROR("Failed reset core op with status {}", reset_status);
+            status = reset_status;
+        }
+    } else {
+        device.set_core_op_pending_reset(core_op_pending_reset);
+    }
+
     return status;
 }
 
@@ -230,6 +341,63 @@ hailo_status VdmaConfigCoreOp::set_scheduler_priority(uint8_t /*priority*/, cons
     return HAILO_INVALID_OPERATION;
 }
 
+hailo_status VdmaConfigCoreOp::set_scheduler_deadline(const std::chrono::milliseconds &/*deadline*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's deadline is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_share(uint32_t /*share*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's share is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_device_affinity(uint64_t /*device_mask*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's device affinity is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_sticky_placement(bool /*is_sticky*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's sticky placement is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_pinned_device(uint32_t /*device_index*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's pinned device is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_burst_size_bounds(uint32_t /*min_burst_size*/, uint32_t /*max_burst_size*/,
+    const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's burst size bounds is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_batch_size(uint16_t /*batch_size*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's batch size is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+hailo_status VdmaConfigCoreOp::set_scheduler_overload_policy(hailo_scheduler_overload_policy_t /*policy*/,
+    uint32_t /*max_pending_frames*/, const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Setting scheduler's overload policy is only allowed when working with VDevice and scheduler enabled");
+    return HAILO_INVALID_OPERATION;
+}
+
+Expected<hailo_scheduler_overload_stats_t> VdmaConfigCoreOp::get_scheduler_overload_stats(const std::string &/*network_name*/)
+{
+    LOGGER__ERROR("Getting scheduler's overload stats is only allowed when working with VDevice and scheduler enabled");
+    return make_unexpected(HAILO_INVALID_OPERATION);
+}
+
 Expected<std::shared_ptr<LatencyMetersMap>> VdmaConfigCoreOp::get_latency_meters()
 {
     auto latency_meters = m_resources_manager->get_latency_meters();
@@ -254,6 +422,11 @@ Expected<Buffer> VdmaConfigCoreOp::get_intermediate_buffer(const IntermediateBuf
     return m_resources_manager->read_intermediate_buffer(key);
 }
 
+Expected<ConfigureStagesDurations> VdmaConfigCoreOp::get_configure_stages_durations() const
+{
+    return ConfigureStagesDurations(m_resources_manager->get_configure_stages_durations());
+}
+
 Expected<Buffer> VdmaConfigCoreOp::get_cache_buffer(uint32_t cache_id)
 {
     return m_resources_manager->read_cache_buffer(cache_id);
@@ -264,6 +437,11 @@ Expected<std::map<uint32_t, Buffer>> VdmaConfigCoreOp::get_cache_buffers()
     return m_resources_manager->read_cache_buffers();
 }
 
+hailo_status VdmaConfigCoreOp::write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers)
+{
+    return m_resources_manager->write_cache_buffers(cache_buffers);
+}
+
 bool VdmaConfigCoreOp::has_caches() const
 {
     return m_resources_manager->get_cache_buffers().size() > 0;
@@ -305,6 +483,14 @@ Expected<uint32_t> VdmaConfigCoreOp::get_cache_write_size() const
 hailo_status VdmaConfigCoreOp::init_cache(uint32_t read_offset, int32_t write_offset_delta)
 {
     CHECK(has_caches(), HAILO_INVALID_OPERATION, "No caches in core-op");
+
+    {
+        // The new offsets override the pending update
+        std::lock_guard<std::mutex> lock(m_pending_cache_offset_mutex);
+        m_has_pending_cache_offset_update = false;
+        m_pending_cache_offset_delta = 0;
+    }
+
     return m_cache_manager->init_caches(read_offset, write_offset_delta);
 }
 
@@ -312,9 +498,19 @@ Expected<hailo_cache_info_t> VdmaConfigCoreOp::get_cache_info() const
 {
     CHECK(has_caches(), HAILO_INVALID_OPERATION, "No caches in core-op");
 
+    const auto cache_size = m_cache_manager->get_cache_size();
+    auto read_offset = m_cache_manager->get_read_offset_bytes();
+    {
+        // Including the deferred update (if any), as it will be applied before the next infer request
+        std::lock_guard<std::mutex> lock(m_pending_cache_offset_mutex);
+        if (m_has_pending_cache_offset_update) {
+            read_offset = (read_offset + m_pending_cache_offset_delta) % cache_size;
+        }
+    }
+
     return hailo_cache_info_t{
-        m_cache_manager->get_cache_size(),
-        m_cache_manager->get_read_offset_bytes(),
+        cache_size,
+        read_offset,
         m_cache_manager->get_write_offset_bytes_delta()
     };
 }
@@ -327,6 +523,40 @@ hailo_status VdmaConfigCoreOp::update_cache_offset(int32_t offset_delta_bytes)
     // auto status = wait_for_activation(std::chrono::milliseconds(0));
     // CHECK_SUCCESS(status, "Core op must be activated before updating cache offset");
 
+    if (m_defer_cache_offset_updates) {
+        // Consecutive updates are folded into one, saving a reprogramming of the caches and a fw round trip per update
+        std::lock_guard<std::mutex> lock(m_pending_cache_offset_mutex);
+        const auto cache_size = static_cast<int64_t>(m_cache_manager->get_cache_size());
+        const auto pending_delta = static_cast<int64_t>(m_pending_cache_offset_delta) + offset_delta_bytes;
+        m_pending_cache_offset_delta = static_cast<int32_t>((0 == cache_size) ? pending_delta : (pending_delta % cache_size));
+        m_has_pending_cache_offset_update = true;
+        return HAILO_SUCCESS;
+    }
+
+    return apply_cache_offset_update(offset_delta_bytes);
+}
+
+hailo_status VdmaConfigCoreOp::apply_pending_cache_offset_update()
+{
+    if (!m_defer_cache_offset_updates) {
+        return HAILO_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(m_pending_cache_offset_mutex);
+    if (!m_has_pending_cache_offset_update) {
+        return HAILO_SUCCESS;
+    }
+
+    auto status = apply_cache_offset_update(m_pending_cache_offset_delta);
+    CHECK_SUCCESS(status);
+
+    m_has_pending_cache_offset_update = false;
+    m_pending_cache_offset_delta = 0;
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaConfigCoreOp::apply_cache_offset_update(int32_t offset_delta_bytes)
+{
     // Update the offsets in the cache manager
     auto status = m_cache_manager->update_cache_offset(offset_delta_bytes);
     CHECK_SUCCESS(status);
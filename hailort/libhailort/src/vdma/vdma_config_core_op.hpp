@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <assert.h>
 #include <map>
+#include <mutex>
 #include <set>
 
 
@@ -66,6 +67,17 @@ public:
 
     hailo_status cancel_pending_transfers();
 
+    // Completes the deactivation of a core-op that was left enabled on the fw (see HAILORT_FAST_MANUAL_SWITCH_ENV_VAR),
+    // resetting the state machine.
+    hailo_status reset_deferred_deactivation();
+
+    // Launches the transfers of all streams with a single driver call (see vdma::TransferLaunchBatch).
+    virtual hailo_status infer_async(InferRequest &&request) override;
+
+    // Maps the request buffers into the device's mapped buffers cache (if it has one), so the request can be launched
+    // without mapping once the core op is active. Used by the scheduler while another core op is running.
+    hailo_status prefetch_mappings(InferRequest &request);
+
     hailo_status register_cache_update_callback();
     hailo_status unregister_cache_update_callback();
 
@@ -79,10 +91,24 @@ public:
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout, const std::string &network_name) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold, const std::string &network_name) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_deadline(const std::chrono::milliseconds &deadline,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_share(uint32_t share, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_device_affinity(uint64_t device_mask, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_sticky_placement(bool is_sticky, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_pinned_device(uint32_t device_index, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_burst_size_bounds(uint32_t min_burst_size, uint32_t max_burst_size,
+        const std::string &network_name) override;
+    virtual hailo_status set_scheduler_batch_size(uint16_t batch_size, const std::string &network_name) override;
+    virtual hailo_status set_scheduler_overload_policy(hailo_scheduler_overload_policy_t policy,
+        uint32_t max_pending_frames, const std::string &network_name) override;
+    virtual Expected<hailo_scheduler_overload_stats_t> get_scheduler_overload_stats(const std::string &network_name) override;
     virtual Expected<HwInferResults> run_hw_infer_estimator() override;
     virtual Expected<Buffer> get_intermediate_buffer(const IntermediateBufferKey &) override;
+    virtual Expected<ConfigureStagesDurations> get_configure_stages_durations() const override;
     virtual Expected<Buffer> get_cache_buffer(uint32_t cache_id) override;
     virtual Expected<std::map<uint32_t, Buffer>> get_cache_buffers() override;
+    virtual hailo_status write_cache_buffers(const std::map<uint32_t, Buffer> &cache_buffers) override;
     virtual bool has_caches() const override;
     virtual Expected<uint32_t> get_cache_read_size() const override;
     virtual Expected<uint32_t> get_cache_write_size() const override;
@@ -96,7 +122,12 @@ public:
     VdmaConfigCoreOp &operator=(VdmaConfigCoreOp &&other) = delete;
     VdmaConfigCoreOp(VdmaConfigCoreOp &&other) noexcept : CoreOp(std::move(other)),
         m_resources_manager(std::move(other.m_resources_manager)),
-        m_cache_manager(std::move(other.m_cache_manager))
+        m_cache_manager(std::move(other.m_cache_manager)),
+        m_defer_cache_offset_updates(other.m_defer_cache_offset_updates),
+        m_is_fast_manual_switch(other.m_is_fast_manual_switch),
+        m_pending_cache_offset_mutex(),
+        m_has_pending_cache_offset_update(other.m_has_pending_cache_offset_update),
+        m_pending_cache_offset_delta(other.m_pending_cache_offset_delta)
         {}
 
 private:
@@ -106,8 +137,25 @@ private:
         std::shared_ptr<CacheManager> cache_manager,
         std::shared_ptr<CoreOpMetadata> metadata, hailo_status &status);
 
+    // Resets the core-op on the fw, and releases the transfers that were pending on its channels
+    hailo_status reset_core_op();
+    // Switches the fw from the core-op left enabled by the previous manual deactivation (may be this core-op) to
+    // this core-op, without resetting the state machine in between.
+    hailo_status switch_from_core_op(VdmaConfigCoreOp &previous, uint16_t dynamic_batch_size);
+
+    // Reprograms the caches to the new offsets, and signals the fw that they were updated
+    hailo_status apply_cache_offset_update(int32_t offset_delta_bytes);
+    hailo_status apply_pending_cache_offset_update();
+
     std::shared_ptr<ResourcesManager> m_resources_manager;
     std::shared_ptr<CacheManager> m_cache_manager;
+    // See HAILORT_DEFER_CACHE_OFFSET_UPDATES_ENV_VAR
+    const bool m_defer_cache_offset_updates;
+    // See HAILORT_FAST_MANUAL_SWITCH_ENV_VAR
+    const bool m_is_fast_manual_switch;
+    mutable std::mutex m_pending_cache_offset_mutex;
+    bool m_has_pending_cache_offset_update;
+    int32_t m_pending_cache_offset_delta;
 };
 
 } /* namespace hailort */
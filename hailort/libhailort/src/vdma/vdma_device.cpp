@@ -35,13 +35,40 @@ static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT(1000);
 static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT(50000);
 #endif /* ifndef HAILO_EMULATOR */
 
+#define HAILO_DESC_LIST_POOL_SIZE_ENV_VAR ("HAILO_DESC_LIST_POOL_SIZE")
+
 VdmaDevice::VdmaDevice(std::unique_ptr<HailoRTDriver> &&driver, Device::Type type, hailo_status &status) :
     DeviceBase::DeviceBase(type),
     m_driver(std::move(driver)),
-    m_is_configured(false)
+    m_desc_list_pool(),
+    m_core_op_pending_reset(nullptr),
+    m_is_configured(false),
+    m_interrupts_wait_mode(HAILO_INTERRUPTS_WAIT_MODE_BLOCKING),
+    m_interrupts_polling_idle_budget(HAILO_DEFAULT_INTERRUPTS_POLLING_IDLE_BUDGET_US),
+    m_mapped_buffers_cache_size(0),
+    m_transfer_launcher_workers_count(HAILO_DEFAULT_TRANSFER_LAUNCHER_WORKERS_COUNT),
+    m_transfer_launcher_cpu_affinity_mask(0),
+    m_interrupts_cpu_affinity_mask(0),
+    m_threads_realtime_priority(0)
 {
     activate_notifications(get_dev_id());
 
+    // Released descriptor lists are kept, so configuring a model again won't allocate its descriptor lists again.
+    size_t desc_list_pool_size = vdma::DEFAULT_DESC_LIST_POOL_SIZE;
+    auto desc_list_pool_size_env_var = get_env_variable(HAILO_DESC_LIST_POOL_SIZE_ENV_VAR);
+    if (desc_list_pool_size_env_var) {
+        desc_list_pool_size = std::stoul(desc_list_pool_size_env_var.value());
+    }
+    if (0 != desc_list_pool_size) {
+        auto desc_list_pool = vdma::DescriptorListPool::create_shared(*m_driver, desc_list_pool_size);
+        if (!desc_list_pool) {
+            LOGGER__ERROR("Failed creating descriptor list pool, status {}", desc_list_pool.status());
+            status = desc_list_pool.status();
+            return;
+        }
+        m_desc_list_pool = desc_list_pool.release();
+    }
+
     status = HAILO_SUCCESS;
 }
 
@@ -151,14 +178,29 @@ Expected<ConfiguredNetworkGroupVector> VdmaDevice::add_hef(Hef &hef, const Netwo
         TRY(m_cache_manager, CacheManager::create_shared(get_driver()));
 
         assert(nullptr == m_vdma_interrupts_dispatcher);
-        TRY(m_vdma_interrupts_dispatcher, vdma::InterruptsDispatcher::create(get_driver()));
+        TRY(m_vdma_interrupts_dispatcher, vdma::InterruptsDispatcher::create(get_driver(), m_interrupts_wait_mode,
+            m_interrupts_polling_idle_budget, m_interrupts_cpu_affinity_mask, m_threads_realtime_priority));
 
         assert(nullptr == m_vdma_transfer_launcher);
-        TRY(m_vdma_transfer_launcher, vdma::TransferLauncher::create());
+        TRY(m_vdma_transfer_launcher, vdma::TransferLauncher::create(m_transfer_launcher_workers_count,
+            m_transfer_launcher_cpu_affinity_mask, get_driver().numa_node(), m_threads_realtime_priority));
+
+        if (0 != m_mapped_buffers_cache_size) {
+            assert(nullptr == m_mapped_buffers_cache);
+            TRY(m_mapped_buffers_cache, vdma::MappedBuffersCache::create_shared(get_driver(),
+                m_mapped_buffers_cache_size));
+        }
 
         m_is_configured = true;
     }
 
+    // The fw isn't configured while a core-op is still enabled on it
+    auto core_op_pending_reset = take_core_op_pending_reset();
+    if (nullptr != core_op_pending_reset) {
+        status = core_op_pending_reset->reset_deferred_deactivation();
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
     auto added_network_groups = create_networks_group_vector(hef, configure_params);
     CHECK_EXPECTED(added_network_groups);
 
@@ -246,6 +288,62 @@ hailo_status VdmaDevice::mark_as_used()
     return m_driver->mark_as_used();
 }
 
+hailo_status VdmaDevice::set_interrupts_wait_mode(hailo_interrupts_wait_mode_t wait_mode,
+    std::chrono::microseconds polling_idle_budget)
+{
+    CHECK(!m_is_configured, HAILO_INVALID_OPERATION,
+        "Can't change interrupts wait mode of device {} after it was configured", get_dev_id());
+    m_interrupts_wait_mode = wait_mode;
+    m_interrupts_polling_idle_budget = polling_idle_budget;
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaDevice::set_mapped_buffers_cache_size(size_t max_cached_bytes)
+{
+    CHECK(!m_is_configured, HAILO_INVALID_OPERATION,
+        "Can't change mapped buffers cache size of device {} after it was configured", get_dev_id());
+    m_mapped_buffers_cache_size = max_cached_bytes;
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaDevice::set_transfer_launcher_params(uint32_t workers_count, uint64_t cpu_affinity_mask)
+{
+    CHECK(!m_is_configured, HAILO_INVALID_OPERATION,
+        "Can't change transfer launcher params of device {} after it was configured", get_dev_id());
+    CHECK(0 != workers_count, HAILO_INVALID_ARGUMENT, "Transfer launcher workers count must be larger than 0");
+    m_transfer_launcher_workers_count = workers_count;
+    m_transfer_launcher_cpu_affinity_mask = cpu_affinity_mask;
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaDevice::set_numa_node(int32_t numa_node)
+{
+    CHECK(!m_is_configured, HAILO_INVALID_OPERATION,
+        "Can't change numa node of device {} after it was configured", get_dev_id());
+    if (HAILO_NUMA_NODE_AUTO == numa_node) {
+        // Keep the node detected by the driver
+        return HAILO_SUCCESS;
+    }
+
+    CHECK((HAILO_NUMA_NODE_NONE == numa_node) || (numa_node >= 0), HAILO_INVALID_ARGUMENT,
+        "Invalid numa node {}", numa_node);
+    if (HAILO_NUMA_NODE_NONE == numa_node) {
+        m_driver->set_numa_node(HailoRTDriver::UNKNOWN_NUMA_NODE);
+    } else {
+        m_driver->set_numa_node(numa_node);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaDevice::set_threads_params(uint64_t interrupts_cpu_affinity_mask, uint32_t realtime_priority)
+{
+    CHECK(!m_is_configured, HAILO_INVALID_OPERATION,
+        "Can't change threads params of device {} after it was configured", get_dev_id());
+    m_interrupts_cpu_affinity_mask = interrupts_cpu_affinity_mask;
+    m_threads_realtime_priority = realtime_priority;
+    return HAILO_SUCCESS;
+}
+
 ExpectedRef<vdma::InterruptsDispatcher> VdmaDevice::get_vdma_interrupts_dispatcher()
 {
     CHECK_AS_EXPECTED(m_vdma_interrupts_dispatcher, HAILO_INTERNAL_FAILURE, "vDMA interrupt dispatcher wasn't created");
@@ -260,7 +358,11 @@ ExpectedRef<vdma::TransferLauncher> VdmaDevice::get_vdma_transfer_launcher()
 
 VdmaDevice::~VdmaDevice()
 {
-    auto status = stop_notification_fetch_thread();
+    auto status = stop_telemetry();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__WARNING("Failed to stop telemetry sampling, status {}", status);
+    }
+    status = stop_notification_fetch_thread();
     if (HAILO_SUCCESS != status) {
         LOGGER__WARNING("Stopping notification thread ungracefully");
     }
@@ -307,6 +409,11 @@ hailo_status VdmaDevice::dma_map(void *address, size_t size, hailo_dma_buffer_di
 
 hailo_status VdmaDevice::dma_unmap(void *address, size_t size, hailo_dma_buffer_direction_t data_direction)
 {
+    if (m_mapped_buffers_cache) {
+        // The user is done with the buffer, drop its cached mappings (so they won't outlive the buffer).
+        m_mapped_buffers_cache->evict(address, size);
+    }
+
     // Since we can't map unaligned addresses (to dma alignment), we map only the aligned part of the buffer. The other
     // unaligned part will be copied into some bounce buffer (which is already mapped).
     std::tie(address, size) = aligned_part_to_map(address, size);
@@ -330,6 +437,10 @@ hailo_status VdmaDevice::dma_map_dmabuf(int dmabuf_fd, size_t size, hailo_dma_bu
 
 hailo_status VdmaDevice::dma_unmap_dmabuf(int dmabuf_fd, size_t size, hailo_dma_buffer_direction_t data_direction)
 {
+    if (nullptr != m_mapped_buffers_cache) {
+        m_mapped_buffers_cache->evict_dmabuf(dmabuf_fd);
+    }
+
     return m_driver->vdma_buffer_unmap(dmabuf_fd, size, to_hailo_driver_direction(data_direction));
 }
 
@@ -18,12 +18,16 @@
 #include "network_group/network_group_internal.hpp"
 #include "vdma/channel/interrupts_dispatcher.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/memory/mapped_buffers_cache.hpp"
+#include "vdma/memory/descriptor_list.hpp"
 #include "vdma/driver/hailort_driver.hpp"
 #include "core_op/resource_manager/cache_manager.hpp"
 
 namespace hailort
 {
 
+class VdmaConfigCoreOp;
+
 class VdmaDevice : public DeviceBase {
 public:
     static Expected<std::unique_ptr<VdmaDevice>> create(const std::string &device_id);
@@ -35,6 +39,18 @@ public:
     virtual void shutdown_core_ops() override;
     virtual hailo_reset_device_mode_t get_default_reset_mode() override;
     hailo_status mark_as_used();
+    // Must be called before the first configure (the interrupts dispatcher is created on the first configure).
+    hailo_status set_interrupts_wait_mode(hailo_interrupts_wait_mode_t wait_mode,
+        std::chrono::microseconds polling_idle_budget);
+    // Must be called before the first configure. 0 disables the user buffers mappings cache.
+    hailo_status set_mapped_buffers_cache_size(size_t max_cached_bytes);
+    // Must be called before the first configure (the transfer launcher is created on the first configure).
+    hailo_status set_transfer_launcher_params(uint32_t workers_count, uint64_t cpu_affinity_mask);
+    // Must be called before the first configure. Gets HAILO_NUMA_NODE_AUTO, HAILO_NUMA_NODE_NONE or a node index.
+    hailo_status set_numa_node(int32_t numa_node);
+    // Must be called before the first configure. interrupts_cpu_affinity_mask pins the interrupts thread (0 - placed
+    // on the numa node), realtime_priority applies to the interrupts and transfer launcher threads (0 - not real-time).
+    hailo_status set_threads_params(uint64_t interrupts_cpu_affinity_mask, uint32_t realtime_priority);
     virtual Expected<size_t> read_log(MemoryView &buffer, hailo_cpu_id_t cpu_id) override;
 
     HailoRTDriver &get_driver()
@@ -50,6 +66,14 @@ public:
 
     ExpectedRef<vdma::InterruptsDispatcher> get_vdma_interrupts_dispatcher();
     ExpectedRef<vdma::TransferLauncher> get_vdma_transfer_launcher();
+    // Returns nullptr if the user buffers mappings cache is disabled.
+    vdma::MappedBuffersCachePtr get_mapped_buffers_cache() const { return m_mapped_buffers_cache; }
+
+    // The core-op that was manually deactivated but left enabled on the fw (see HAILORT_FAST_MANUAL_SWITCH_ENV_VAR).
+    // Used only by the manual activation flow, which isn't thread safe anyway.
+    void set_core_op_pending_reset(VdmaConfigCoreOp *core_op) { m_core_op_pending_reset = core_op; }
+    // Returns nullptr if there is no such core-op
+    VdmaConfigCoreOp *take_core_op_pending_reset() { return std::exchange(m_core_op_pending_reset, nullptr); }
 
     virtual hailo_status dma_map(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
     virtual hailo_status dma_unmap(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
@@ -66,6 +90,9 @@ protected:
     virtual Expected<ConfiguredNetworkGroupVector> add_hef(Hef &hef, const NetworkGroupsParamsMap &configure_params) override;
 
     std::unique_ptr<HailoRTDriver> m_driver;
+    // Must be destroyed after the core ops (which return their descriptor lists to the pool) and before the driver.
+    // nullptr if the pool is disabled.
+    vdma::DescriptorListPoolPtr m_desc_list_pool;
     CacheManagerPtr m_cache_manager;
     // TODO - HRT-13234, move to DeviceBase
     std::vector<std::shared_ptr<CoreOp>> m_core_ops;
@@ -75,9 +102,19 @@ protected:
     // (reference to the ResourcesManager). Hence, it must be destroyed before the networks groups are destroyed.
     std::unique_ptr<vdma::InterruptsDispatcher> m_vdma_interrupts_dispatcher;
     std::unique_ptr<vdma::TransferLauncher> m_vdma_transfer_launcher;
+    vdma::MappedBuffersCachePtr m_mapped_buffers_cache;
 
     ActiveCoreOpHolder m_active_core_op_holder;
+    // Owned by m_core_ops
+    VdmaConfigCoreOp *m_core_op_pending_reset;
     bool m_is_configured;
+    hailo_interrupts_wait_mode_t m_interrupts_wait_mode;
+    std::chrono::microseconds m_interrupts_polling_idle_budget;
+    size_t m_mapped_buffers_cache_size;
+    uint32_t m_transfer_launcher_workers_count;
+    uint64_t m_transfer_launcher_cpu_affinity_mask;
+    uint64_t m_interrupts_cpu_affinity_mask;
+    uint32_t m_threads_realtime_priority;
 
 private:
     Expected<std::shared_ptr<ConfiguredNetworkGroup>> create_configured_network_group(
@@ -17,6 +17,24 @@
 namespace hailort
 {
 
+void UnalignedTransfersCounter::count(const std::string &stream_name, const void *user_address, size_t user_size)
+{
+    m_count++;
+    if (!m_is_warned.exchange(true)) {
+        LOGGER__WARNING("Stream {} was provided an unaligned buffer (address=0x{:x}, size={}), which is copied through a "
+            "bounce buffer and degrades performance. Use buffers aligned to {} bytes (e.g. allocated with "
+            "InferModel::InferStream::allocate_buffer) for optimal performance", stream_name,
+            reinterpret_cast<size_t>(user_address), user_size, OsUtils::get_dma_able_alignment());
+    }
+}
+
+void UnalignedTransfersCounter::report(const std::string &stream_name)
+{
+    const auto count = m_count.exchange(0);
+    if (0 != count) {
+        LOGGER__WARNING("Stream {} copied {} unaligned buffers through bounce buffers", stream_name, count);
+    }
+}
 
 /** Input stream **/
 Expected<std::shared_ptr<VdmaInputStream>> VdmaInputStream::create(hailo_stream_interface_t interface,
@@ -133,7 +151,7 @@ size_t VdmaInputStream::get_max_ongoing_transfers() const
 Expected<TransferRequest> VdmaInputStream::align_transfer_request(TransferRequest &&transfer_request)
 {
     const auto dma_alignment = OsUtils::get_dma_able_alignment();
-    std::vector<TransferBuffer> transfer_buffers;
+    TransferBuffers transfer_buffers;
     TRY(auto base_buffer, transfer_request.transfer_buffers[0].base_buffer());
     const auto buffer_address = base_buffer.data();
     const auto buffer_size = transfer_request.transfer_buffers[0].size();
@@ -168,7 +186,9 @@ Expected<TransferRequest> VdmaInputStream::align_transfer_request(TransferReques
         user_callback(callback_status);
     };
 
-    return TransferRequest(std::move(transfer_buffers), wrapped_callback);
+    TransferRequest aligned_request(std::move(transfer_buffers), wrapped_callback);
+    aligned_request.control = std::move(transfer_request.control);
+    return aligned_request;
 }
 
 hailo_status VdmaInputStream::write_async_impl(TransferRequest &&transfer_request)
@@ -182,6 +202,9 @@ hailo_status VdmaInputStream::write_async_impl(TransferRequest &&transfer_reques
         if (is_request_aligned) {
             return m_channel->launch_transfer(std::move(transfer_request));
         } else {
+            TRY(auto base_buffer, transfer_request.transfer_buffers[0].base_buffer());
+            m_unaligned_transfers.count(name(), base_buffer.data(), base_buffer.size());
+
             auto realigned_transfer_request = align_transfer_request(std::move(transfer_request));
             CHECK_EXPECTED_AS_STATUS(realigned_transfer_request);
             return m_channel->launch_transfer(realigned_transfer_request.release());
@@ -197,6 +220,7 @@ hailo_status VdmaInputStream::activate_stream_impl()
 hailo_status VdmaInputStream::deactivate_stream_impl()
 {
     m_channel->deactivate();
+    m_unaligned_transfers.report(name());
     return HAILO_SUCCESS;
 }
 
@@ -298,7 +322,9 @@ Expected<TransferRequest> VdmaOutputStream::align_transfer_request(TransferReque
         user_callback(callback_status);
     };
 
-    return TransferRequest(MemoryView(bounce_buffer->data(), bounce_buffer->size()), wrapped_callback);
+    TransferRequest aligned_request(MemoryView(bounce_buffer->data(), bounce_buffer->size()), wrapped_callback);
+    aligned_request.control = std::move(transfer_request.control);
+    return aligned_request;
 }
 
 hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_request)
@@ -322,8 +348,7 @@ hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_reques
         } else {
             // In case of read unaligned - don't support using users buffer - so well allocate complete new buffer size of user's buffer
             TRY(auto base_buffer, transfer_request.transfer_buffers[0].base_buffer());
-            LOGGER__WARNING("read_async() was provided an unaligned buffer (address=0x{:x}), which causes performance degradation. Use buffers algined to {} bytes for optimal performance",
-                reinterpret_cast<size_t>(base_buffer.data()), OsUtils::get_dma_able_alignment());
+            m_unaligned_transfers.count(name(), base_buffer.data(), base_buffer.size());
 
             auto realigned_transfer_request = align_transfer_request(std::move(transfer_request));
             CHECK_EXPECTED_AS_STATUS(realigned_transfer_request);
@@ -340,6 +365,7 @@ hailo_status VdmaOutputStream::activate_stream_impl()
 hailo_status VdmaOutputStream::deactivate_stream_impl()
 {
     m_channel->deactivate();
+    m_unaligned_transfers.report(name());
     return HAILO_SUCCESS;
 }
 
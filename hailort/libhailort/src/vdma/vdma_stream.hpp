@@ -16,6 +16,7 @@
 #include "vdma/vdma_device.hpp"
 #include "vdma/channel/boundary_channel.hpp"
 
+#include <atomic>
 
 namespace hailort
 {
@@ -29,6 +30,18 @@ using BounceBufferPtr = std::shared_ptr<BounceBuffer>;
 using BounceBufferQueue = SafeQueue<BounceBufferPtr>;
 using BounceBufferQueuePtr = std::unique_ptr<BounceBufferQueue>;
 
+// Counts the transfers of unaligned user buffers (which are copied through bounce buffers). Warns on the first one, so
+// the slow path is visible without flooding the log on every frame, and logs the count once the stream is deactivated.
+class UnalignedTransfersCounter final {
+public:
+    void count(const std::string &stream_name, const void *user_address, size_t user_size);
+    void report(const std::string &stream_name);
+
+private:
+    std::atomic<uint64_t> m_count{0};
+    std::atomic_bool m_is_warned{false};
+};
+
 class VdmaInputStream : public AsyncInputStreamBase {
 public:
 
@@ -58,6 +71,7 @@ private:
 
     VdmaDevice &m_device;
     BounceBufferQueuePtr m_bounce_buffers_pool;
+    UnalignedTransfersCounter m_unaligned_transfers;
 
     vdma::BoundaryChannelPtr m_channel;
     const hailo_stream_interface_t m_interface;
@@ -103,6 +117,7 @@ private:
     const uint32_t m_transfer_size;
     vdevice_core_op_handle_t m_core_op_handle;
     std::function<void(hailo_status)> m_d2h_callback;
+    UnalignedTransfersCounter m_unaligned_transfers;
 };
 
 